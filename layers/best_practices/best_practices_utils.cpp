@@ -51,7 +51,7 @@ std::shared_ptr<vvl::CommandBuffer> BestPractices::CreateCmdBufferState(VkComman
                                                                         const VkCommandBufferAllocateInfo* pCreateInfo,
                                                                         const vvl::CommandPool* pool) {
     return std::static_pointer_cast<vvl::CommandBuffer>(
-        std::make_shared<bp_state::CommandBuffer>(*this, handle, pCreateInfo, pool));
+        vvl::MakeState<bp_state::CommandBuffer>(*this, handle, pCreateInfo, pool));
 }
 
 bp_state::CommandBuffer::CommandBuffer(BestPractices& bp, VkCommandBuffer handle, const VkCommandBufferAllocateInfo* pCreateInfo,
@@ -22,6 +22,7 @@
 #include "generated/chassis.h"
 #include "state_tracker/state_tracker.h"
 #include "state_tracker/cmd_buffer_state.h"
+#include "containers/sharded_counter.h"
 #include <string>
 #include <deque>
 #include <chrono>
@@ -604,7 +605,7 @@ class BestPractices : public ValidationStateTracker {
     bool PreCallValidateCmdResolveImage2(VkCommandBuffer commandBuffer, const VkResolveImageInfo2* pResolveImageInfo,
                                          const ErrorObject& error_obj) const override;
 
-    using QueueCallbacks = std::vector<vvl::CommandBuffer::QueueCallback>;
+    using QueueCallbacks = vvl::CommandBuffer::QueueCallbacks;
 
     void QueueValidateImageView(QueueCallbacks& func, Func command, vvl::ImageView* view, IMAGE_SUBRESOURCE_USAGE_BP usage);
     void QueueValidateImage(QueueCallbacks& func, Func command, std::shared_ptr<bp_state::Image>& state,
@@ -871,12 +872,26 @@ class BestPractices : public ValidationStateTracker {
         uint32_t iteration = 0;
     };
 
+    // What ValidateIndexBufferArm needs to know about the indices of a draw. The counts of vertices are only computed when
+    // min_index < max_index and the range of indices is not larger than the count of indices, they are 0 otherwise.
+    struct IndexBufferStats {
+        uint32_t min_index = ~0u;
+        uint32_t max_index = 0u;
+        uint32_t vertex_shade_count = 0;
+        uint32_t vertex_reference_count = 0;
+    };
+
+    template <typename IndexType>
+    static IndexBufferStats AnalyzeIndices(const IndexType* indices, uint32_t index_count, bool primitive_restart_enable);
+    IndexBufferStats GetIndexBufferStats(const uint8_t* indices, uint32_t index_count, VkIndexType index_type,
+                                         bool primitive_restart_enable) const;
+
     // Check that vendor-specific checks are enabled for at least one of the vendors
     bool VendorCheckEnabled(BPVendorFlags vendors) const;
     const char* VendorSpecificTag(BPVendorFlags vendors) const;
 
     void RecordCmdDrawTypeArm(bp_state::CommandBuffer& cb_state, uint32_t draw_count);
-    void RecordCmdDrawTypeNVIDIA(bp_state::CommandBuffer& cb_state);
+    void RecordCmdDrawTypeNVIDIA(bp_state::CommandBuffer& cb_state, uint32_t num_draws);
 
     // Get BestPractices-specific for the current instance
     bp_state::PhysicalDevice* GetPhysicalDeviceState();
@@ -898,6 +913,13 @@ class BestPractices : public ValidationStateTracker {
 
     void RecordSetDepthTestState(bp_state::CommandBuffer& cb_state, VkCompareOp new_depth_compare_op, bool new_depth_test_enable);
 
+    void RecordTessGeometryMeshSwitchNVIDIA(bp_state::CommandBuffer& cb_state,
+                                            bp_state::CommandBufferStateNV::TessGeometryMesh::State new_state);
+    bool ValidateTessGeometryMeshSwitchNVIDIA(const bp_state::CommandBuffer& cb_state, const Location& loc) const;
+
+    // Runs the NVIDIA state machines on the commands logged with deferred vendor checks
+    void ReplayDeferredCommandsNVIDIA(bp_state::CommandBuffer& cb_state);
+
     void RecordCmdBeginRenderingCommon(VkCommandBuffer commandBuffer);
     void RecordCmdEndRenderingCommon(VkCommandBuffer commandBuffer);
 
@@ -912,7 +934,7 @@ class BestPractices : public ValidationStateTracker {
     void RecordSetZcullDirection(bp_state::CommandBuffer& cb_state, VkImage depth_image,
                                  const VkImageSubresourceRange& subresource_range, ZcullDirection mode);
 
-    void RecordZcullDraw(bp_state::CommandBuffer& cb_state);
+    void RecordZcullDraw(bp_state::CommandBuffer& cb_state, uint32_t num_draws);
 
     bool ValidateZcullScope(const bp_state::CommandBuffer& cb_state, const Location& loc) const;
     bool ValidateZcull(const bp_state::CommandBuffer& cb_state, VkImage image, const VkImageSubresourceRange& subresource_range,
@@ -923,22 +945,18 @@ class BestPractices : public ValidationStateTracker {
                             const Location& loc) const;
 
     void PipelineUsedInFrame(VkPipeline pipeline) {
-        WriteLockGuard guard(pipeline_lock_);
-        pipelines_used_in_frame_.insert(pipeline);
+        if (!pipelines_used_in_frame_.contains(pipeline)) {
+            pipelines_used_in_frame_.insert(pipeline, true);
+        }
     }
 
-    void ClearPipelinesUsedInFrame() {
-        WriteLockGuard guard(pipeline_lock_);
-        pipelines_used_in_frame_.clear();
-    }
+    void ClearPipelinesUsedInFrame() { pipelines_used_in_frame_.clear(); }
 
-    bool IsPipelineUsedInFrame(VkPipeline pipeline) const {
-        ReadLockGuard guard(pipeline_lock_);
-        return pipelines_used_in_frame_.count(pipeline) != 0;
-    }
+    bool IsPipelineUsedInFrame(VkPipeline pipeline) const { return pipelines_used_in_frame_.contains(pipeline); }
 
     // AMD tracked
-    std::atomic<uint32_t> num_barriers_objects_{0};
+    // Added to on every barrier recorded, from any thread
+    vvl::ShardedCounter<uint32_t> num_barriers_objects_;
     std::atomic<uint32_t> num_pso_{0};
     std::atomic<uint32_t> num_queue_submissions_{0};
 
@@ -956,6 +974,37 @@ class BestPractices : public ValidationStateTracker {
     std::set<std::array<uint32_t, 4>> clear_colors_;
     mutable std::shared_mutex clear_colors_lock_;
 
-    vvl::unordered_set<VkPipeline> pipelines_used_in_frame_;
-    mutable std::shared_mutex pipeline_lock_;
+    // Bound pipelines are spread over the buckets of the map, each with its own lock
+    vvl::concurrent_unordered_map<VkPipeline, bool, 4> pipelines_used_in_frame_;
+
+    // Stats of the index ranges already drawn from, ex. the meshes that are drawn every frame. The host writes to coherent
+    // memory are not seen by the layer, so an entry keeps a copy of the indices it was computed from and is only used while
+    // the mapped memory still holds them.
+    struct IndexBufferCacheKey {
+        const uint8_t* indices;
+        uint32_t index_count;
+        VkIndexType index_type;
+        bool primitive_restart_enable;
+
+        bool operator==(const IndexBufferCacheKey& rhs) const {
+            return indices == rhs.indices && index_count == rhs.index_count && index_type == rhs.index_type &&
+                   primitive_restart_enable == rhs.primitive_restart_enable;
+        }
+        size_t hash() const {
+            hash_util::HashCombiner hc;
+            hc << indices << index_count << index_type << primitive_restart_enable;
+            return hc.Value();
+        }
+    };
+    struct IndexBufferCacheEntry {
+        std::vector<uint8_t> indices;
+        IndexBufferStats stats;
+    };
+    // Smaller ranges are scanned again, larger ones are only cached while the copies fit in kMaxIndexBufferCacheBytes
+    static constexpr uint32_t kMinCachedIndexCount = 64;
+    static constexpr size_t kMaxIndexBufferCacheBytes = 16 * 1024 * 1024;
+    mutable vvl::unordered_map<IndexBufferCacheKey, IndexBufferCacheEntry, hash_util::HasHashMember<IndexBufferCacheKey>>
+        index_buffer_cache_;
+    mutable size_t index_buffer_cache_bytes_ = 0;
+    mutable std::shared_mutex index_buffer_cache_lock_;
 };
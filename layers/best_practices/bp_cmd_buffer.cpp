@@ -69,6 +69,13 @@ void BestPractices::PreCallRecordBeginCommandBuffer(VkCommandBuffer commandBuffe
     cb_state->num_submits = 0;
     cb_state->uses_vertex_buffer = false;
     cb_state->small_indexed_draw_call_count = 0;
+
+    cb_state->deferred_nv_commands.clear();
+    cb_state->defer_nv_commands = enabled[best_practices_deferred_vendor_checks] && VendorCheckEnabled(kBPVendorNVIDIA);
+    if (cb_state->defer_nv_commands) {
+        // The log is replayed from a clean state
+        cb_state->nv = {};
+    }
 }
 
 bool BestPractices::PreCallValidateBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo,
@@ -57,6 +57,16 @@ void BestPractices::RecordSetDepthTestState(bp_state::CommandBuffer& cmd_state,
                                             bool new_depth_test_enable) {
     assert(VendorCheckEnabled(kBPVendorNVIDIA));
 
+    if (cmd_state.defer_nv_commands) {
+        // The callers read back the current values when only one of them changes
+        cmd_state.nv.depth_compare_op = new_depth_compare_op;
+        cmd_state.nv.depth_test_enable = new_depth_test_enable;
+        auto& command = cmd_state.DeferNVCommand(bp_state::DeferredCommandNV::Type::SetDepthTestState);
+        command.depth_compare_op = new_depth_compare_op;
+        command.depth_test_enable = new_depth_test_enable;
+        return;
+    }
+
     if (cmd_state.nv.depth_compare_op != new_depth_compare_op) {
         switch (new_depth_compare_op) {
             case VK_COMPARE_OP_LESS:
@@ -80,6 +90,13 @@ void BestPractices::RecordBindZcullScope(bp_state::CommandBuffer& cmd_state, VkI
                                          const VkImageSubresourceRange& subresource_range) {
     assert(VendorCheckEnabled(kBPVendorNVIDIA));
 
+    if (cmd_state.defer_nv_commands) {
+        auto& command = cmd_state.DeferNVCommand(bp_state::DeferredCommandNV::Type::BindZcullScope);
+        command.image = depth_attachment;
+        command.range = subresource_range;
+        return;
+    }
+
     if (depth_attachment == VK_NULL_HANDLE) {
         cmd_state.nv.zcull_scope = {};
         return;
@@ -114,6 +131,11 @@ void BestPractices::RecordUnbindZcullScope(bp_state::CommandBuffer& cmd_state) {
 void BestPractices::RecordResetScopeZcullDirection(bp_state::CommandBuffer& cmd_state) {
     assert(VendorCheckEnabled(kBPVendorNVIDIA));
 
+    if (cmd_state.defer_nv_commands) {
+        cmd_state.DeferNVCommand(bp_state::DeferredCommandNV::Type::ResetScopeZcullDirection);
+        return;
+    }
+
     auto& scope = cmd_state.nv.zcull_scope;
     RecordResetZcullDirection(cmd_state, scope.image, scope.range);
 }
@@ -138,6 +160,13 @@ void BestPractices::RecordResetZcullDirection(bp_state::CommandBuffer& cmd_state
                                               const VkImageSubresourceRange& subresource_range) {
     assert(VendorCheckEnabled(kBPVendorNVIDIA));
 
+    if (cmd_state.defer_nv_commands) {
+        auto& command = cmd_state.DeferNVCommand(bp_state::DeferredCommandNV::Type::ResetZcullDirection);
+        command.image = depth_image;
+        command.range = subresource_range;
+        return;
+    }
+
     RecordSetZcullDirection(cmd_state, depth_image, subresource_range, ZcullDirection::Unknown);
 
     const auto image_it = cmd_state.nv.zcull_per_image.find(depth_image);
@@ -181,16 +210,16 @@ void BestPractices::RecordSetZcullDirection(bp_state::CommandBuffer& cmd_state,
     });
 }
 
-void BestPractices::RecordZcullDraw(bp_state::CommandBuffer& cmd_state) {
+void BestPractices::RecordZcullDraw(bp_state::CommandBuffer& cmd_state, uint32_t num_draws) {
     assert(VendorCheckEnabled(kBPVendorNVIDIA));
 
-    // Add one draw to each subresource depending on the current Z-cull direction
+    // Add the draws to each subresource depending on the current Z-cull direction
     auto& scope = cmd_state.nv.zcull_scope;
 
     auto image = Get<vvl::Image>(scope.image);
     if (!image) return;
 
-    ForEachSubresource(*image, scope.range, [&scope](uint32_t layer, uint32_t level) {
+    ForEachSubresource(*image, scope.range, [&scope, num_draws](uint32_t layer, uint32_t level) {
         auto& subresource = scope.tree->GetState(layer, level);
 
         switch (subresource.direction) {
@@ -199,10 +228,10 @@ void BestPractices::RecordZcullDraw(bp_state::CommandBuffer& cmd_state) {
                 assert(0);
                 break;
             case ZcullDirection::Less:
-                ++subresource.num_less_draws;
+                subresource.num_less_draws += num_draws;
                 break;
             case ZcullDirection::Greater:
-                ++subresource.num_greater_draws;
+                subresource.num_greater_draws += num_draws;
                 break;
         }
     });
@@ -213,6 +242,11 @@ bool BestPractices::ValidateZcullScope(const bp_state::CommandBuffer& cmd_state,
 
     bool skip = false;
 
+    if (cmd_state.defer_nv_commands) {
+        cmd_state.DeferNVCommand(bp_state::DeferredCommandNV::Type::ValidateZcullScope).function = loc.function;
+        return skip;
+    }
+
     if (cmd_state.nv.depth_test_enable) {
         auto& scope = cmd_state.nv.zcull_scope;
         skip |= ValidateZcull(cmd_state, scope.image, scope.range, loc);
@@ -225,6 +259,14 @@ bool BestPractices::ValidateZcull(const bp_state::CommandBuffer& cmd_state, VkIm
                                   const VkImageSubresourceRange& subresource_range, const Location& loc) const {
     bool skip = false;
 
+    if (cmd_state.defer_nv_commands) {
+        auto& command = cmd_state.DeferNVCommand(bp_state::DeferredCommandNV::Type::ValidateZcull);
+        command.image = image;
+        command.range = subresource_range;
+        command.function = loc.function;
+        return skip;
+    }
+
     const char* good_mode = nullptr;
     const char* bad_mode = nullptr;
     bool is_balanced = false;
@@ -277,6 +319,57 @@ bool BestPractices::ValidateZcull(const bp_state::CommandBuffer& cmd_state, VkIm
     return skip;
 }
 
+void BestPractices::ReplayDeferredCommandsNVIDIA(bp_state::CommandBuffer& cmd_state) {
+    assert(VendorCheckEnabled(kBPVendorNVIDIA));
+    using Type = bp_state::DeferredCommandNV::Type;
+
+    // Each helper updates the state or validates when the log is off, like for a command that is being recorded
+    std::vector<bp_state::DeferredCommandNV> commands = std::move(cmd_state.deferred_nv_commands);
+    cmd_state.deferred_nv_commands.clear();
+    cmd_state.defer_nv_commands = false;
+    cmd_state.nv = {};
+
+    for (const auto& command : commands) {
+        switch (command.type) {
+            case Type::Reset:
+                cmd_state.nv = {};
+                break;
+            case Type::BindPipeline:
+                ValidateTessGeometryMeshSwitchNVIDIA(cmd_state, Location(Func::vkCmdBindPipeline));
+                RecordTessGeometryMeshSwitchNVIDIA(cmd_state, command.tess_geometry_mesh);
+                break;
+            case Type::SetDepthTestState:
+                RecordSetDepthTestState(cmd_state, command.depth_compare_op, command.depth_test_enable);
+                break;
+            case Type::BindZcullScope:
+                RecordBindZcullScope(cmd_state, command.image, command.range);
+                break;
+            case Type::ResetScopeZcullDirection:
+                RecordResetScopeZcullDirection(cmd_state);
+                break;
+            case Type::ResetZcullDirection:
+                RecordResetZcullDirection(cmd_state, command.image, command.range);
+                break;
+            case Type::Draw:
+                RecordCmdDrawTypeNVIDIA(cmd_state, command.num_draws);
+                break;
+            case Type::ValidateZcullScope:
+                ValidateZcullScope(cmd_state, Location(command.function));
+                break;
+            case Type::ValidateZcull:
+                ValidateZcull(cmd_state, command.image, command.range, Location(command.function));
+                break;
+        }
+    }
+}
+
+void BestPractices::ManualPostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, const RecordObject& record_obj) {
+    auto cb_state = GetWrite<bp_state::CommandBuffer>(commandBuffer);
+    if (cb_state && cb_state->defer_nv_commands) {
+        ReplayDeferredCommandsNVIDIA(*cb_state);
+    }
+}
+
 static constexpr std::array<VkFormat, 12> kCustomClearColorCompressedFormatsNVIDIA = {
     VK_FORMAT_R8G8B8A8_UNORM,           VK_FORMAT_B8G8R8A8_UNORM,           VK_FORMAT_A8B8G8R8_UNORM_PACK32,
     VK_FORMAT_A2R10G10B10_UNORM_PACK32, VK_FORMAT_A2B10G10R10_UNORM_PACK32, VK_FORMAT_R16G16B16A16_UNORM,
@@ -183,5 +183,5 @@ bool BestPractices::PreCallValidateCreateDescriptorUpdateTemplate(VkDevice devic
 
 std::shared_ptr<vvl::DescriptorPool> BestPractices::CreateDescriptorPoolState(VkDescriptorPool handle,
                                                                               const VkDescriptorPoolCreateInfo* pCreateInfo) {
-    return std::static_pointer_cast<vvl::DescriptorPool>(std::make_shared<bp_state::DescriptorPool>(*this, handle, pCreateInfo));
+    return std::static_pointer_cast<vvl::DescriptorPool>(vvl::MakeState<bp_state::DescriptorPool>(*this, handle, pCreateInfo));
 }
\ No newline at end of file
@@ -22,7 +22,11 @@
 #include "best_practices/bp_state.h"
 #include "state_tracker/buffer_state.h"
 #include "state_tracker/render_pass_state.h"
+#include <algorithm>
+#include <array>
 #include <bitset>
+#include <cstring>
+#include <limits>
 
 // Generic function to handle validation for all CmdDraw* type functions
 bool BestPractices::ValidateCmdDrawType(VkCommandBuffer cmd_buffer, const Location& loc) const {
@@ -74,7 +78,7 @@ void BestPractices::RecordCmdDrawType(VkCommandBuffer cmd_buffer, uint32_t draw_
         RecordCmdDrawTypeArm(*cb_state, draw_count);
     }
     if (VendorCheckEnabled(kBPVendorNVIDIA)) {
-        RecordCmdDrawTypeNVIDIA(*cb_state);
+        RecordCmdDrawTypeNVIDIA(*cb_state, 1);
     }
 
     if (cb_state->render_pass_state.drawTouchAttachments) {
@@ -107,12 +111,21 @@ void BestPractices::RecordCmdDrawTypeArm(bp_state::CommandBuffer& cb_state, uint
     }
 }
 
-void BestPractices::RecordCmdDrawTypeNVIDIA(bp_state::CommandBuffer& cmd_state) {
+void BestPractices::RecordCmdDrawTypeNVIDIA(bp_state::CommandBuffer& cmd_state, uint32_t num_draws) {
     assert(VendorCheckEnabled(kBPVendorNVIDIA));
 
+    if (cmd_state.defer_nv_commands) {
+        auto& commands = cmd_state.deferred_nv_commands;
+        if (commands.empty() || commands.back().type != bp_state::DeferredCommandNV::Type::Draw) {
+            cmd_state.DeferNVCommand(bp_state::DeferredCommandNV::Type::Draw);
+        }
+        commands.back().num_draws += num_draws;
+        return;
+    }
+
     if (cmd_state.nv.depth_test_enable && cmd_state.nv.zcull_direction != ZcullDirection::Unknown) {
         RecordSetScopeZcullDirection(cmd_state, cmd_state.nv.zcull_direction);
-        RecordZcullDraw(cmd_state);
+        RecordZcullDraw(cmd_state, num_draws);
     }
 }
 
@@ -190,6 +203,128 @@ bool BestPractices::PostTransformLRUCacheModel::query_cache(uint32_t value) {
     return false;
 }
 
+template <typename IndexType>
+BestPractices::IndexBufferStats BestPractices::AnalyzeIndices(const IndexType* indices, uint32_t index_count,
+                                                              bool primitive_restart_enable) {
+    IndexBufferStats stats;
+
+    // Min and max are important to track for some Mali architectures. In older Mali devices without IDVS, all
+    // vertices corresponding to indices between the minimum and maximum may be loaded, and possibly shaded,
+    // irrespective of whether or not they're part of the draw call.
+    //
+    // The lanes are independent so the compiler keeps them in vector registers, this pass decides if the slower ones below
+    // are needed at all.
+    constexpr uint32_t kLanes = 16;
+    std::array<uint32_t, kLanes> min_lanes;
+    std::array<uint32_t, kLanes> max_lanes;
+    min_lanes.fill(~0u);
+    max_lanes.fill(0u);
+    uint32_t i = 0;
+    for (; i + kLanes <= index_count; i += kLanes) {
+        for (uint32_t lane = 0; lane < kLanes; ++lane) {
+            const uint32_t index = indices[i + lane];
+            min_lanes[lane] = std::min(min_lanes[lane], index);
+            max_lanes[lane] = std::max(max_lanes[lane], index);
+        }
+    }
+    for (; i < index_count; ++i) {
+        min_lanes[0] = std::min(min_lanes[0], static_cast<uint32_t>(indices[i]));
+        max_lanes[0] = std::max(max_lanes[0], static_cast<uint32_t>(indices[i]));
+    }
+    stats.min_index = *std::min_element(min_lanes.begin(), min_lanes.end());
+    stats.max_index = *std::max_element(max_lanes.begin(), max_lanes.end());
+
+    // Nothing else is looked at when all the indices are the same or when the index buffer is sparse whatever their order
+    if (stats.max_index <= stats.min_index || stats.max_index - stats.min_index >= index_count) {
+        return stats;
+    }
+
+    // we're looking to simulate a model LRU post-transform cache, estimating the number of vertices shaded
+    // for the given index buffer
+    PostTransformLRUCacheModel post_transform_cache;
+
+    // The size of the cache being modelled positively correlates with how much behaviour it can capture about
+    // arbitrary ground-truth hardware/architecture cache behaviour. I.e. it's a good solution when we don't know the
+    // target architecture.
+    // However, modelling a post-transform cache with more than 32 elements gives diminishing returns in practice.
+    // http://eelpi.gotdns.org/papers/fast_vert_cache_opt.html
+    post_transform_cache.resize(32);
+
+    constexpr uint32_t primitive_restart_value = std::numeric_limits<IndexType>::max();
+    for (i = 0; i < index_count; ++i) {
+        const uint32_t scan_index = indices[i];
+        if (!primitive_restart_enable || scan_index != primitive_restart_value) {
+            const bool in_cache = post_transform_cache.query_cache(scan_index);
+            // if the shaded vertex corresponding to the index is not in the PT-cache, we need to shade again
+            if (!in_cache) stats.vertex_shade_count++;
+        }
+    }
+
+    // use a dynamic vector of bitsets as a memory-compact representation of which indices are included in the draw call
+    // each bit of the n-th bucket contains the inclusion information for indices (n*n_buckets) to ((n+1)*n_buckets)
+    const size_t refs_per_bucket = 64;
+    std::vector<std::bitset<refs_per_bucket>> vertex_reference_buckets;
+
+    const uint32_t n_indices = stats.max_index - stats.min_index + 1;
+    const uint32_t n_buckets = (n_indices / static_cast<uint32_t>(refs_per_bucket)) +
+                               ((n_indices % static_cast<uint32_t>(refs_per_bucket)) != 0 ? 1 : 0);
+
+    // there needs to be at least one bitset to store a set of indices smaller than n_buckets
+    vertex_reference_buckets.resize(std::max(1u, n_buckets));
+
+    // To avoid using too much memory, we run over the indices again.
+    // Knowing the size from the last scan allows us to record index usage with bitsets
+    for (i = 0; i < index_count; ++i) {
+        // keep track of the set of all indices used to reference vertices in the draw call
+        size_t index_offset = indices[i] - stats.min_index;
+        size_t bitset_bucket_index = index_offset / refs_per_bucket;
+        uint64_t used_indices = 1ull << ((index_offset % refs_per_bucket) & 0xFFFFFFFFu);
+        vertex_reference_buckets[bitset_bucket_index] |= used_indices;
+    }
+
+    for (const auto& bitset : vertex_reference_buckets) {
+        stats.vertex_reference_count += static_cast<uint32_t>(bitset.count());
+    }
+    return stats;
+}
+
+BestPractices::IndexBufferStats BestPractices::GetIndexBufferStats(const uint8_t* indices, uint32_t index_count,
+                                                                   VkIndexType index_type, bool primitive_restart_enable) const {
+    const size_t size = static_cast<size_t>(index_count) * GetIndexAlignment(index_type);
+    const IndexBufferCacheKey key{indices, index_count, index_type, primitive_restart_enable};
+    const bool cached = index_count >= kMinCachedIndexCount;
+    if (cached) {
+        std::shared_lock<std::shared_mutex> guard(index_buffer_cache_lock_);
+        auto it = index_buffer_cache_.find(key);
+        if (it != index_buffer_cache_.end() && std::memcmp(it->second.indices.data(), indices, size) == 0) {
+            return it->second.stats;
+        }
+    }
+
+    IndexBufferStats stats;
+    if (index_type == VK_INDEX_TYPE_UINT8_KHR) {
+        stats = AnalyzeIndices(indices, index_count, primitive_restart_enable);
+    } else if (index_type == VK_INDEX_TYPE_UINT16) {
+        stats = AnalyzeIndices(reinterpret_cast<const uint16_t*>(indices), index_count, primitive_restart_enable);
+    } else {
+        stats = AnalyzeIndices(reinterpret_cast<const uint32_t*>(indices), index_count, primitive_restart_enable);
+    }
+
+    if (cached) {
+        std::unique_lock<std::shared_mutex> guard(index_buffer_cache_lock_);
+        auto it = index_buffer_cache_.find(key);
+        if (it != index_buffer_cache_.end()) {
+            // The indices were rewritten, same key so same size
+            it->second.indices.assign(indices, indices + size);
+            it->second.stats = stats;
+        } else if (index_buffer_cache_bytes_ + size <= kMaxIndexBufferCacheBytes) {
+            index_buffer_cache_.emplace(key, IndexBufferCacheEntry{std::vector<uint8_t>(indices, indices + size), stats});
+            index_buffer_cache_bytes_ += size;
+        }
+    }
+    return stats;
+}
+
 bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBuffer& cmd_state, uint32_t indexCount, uint32_t instanceCount,
                                            uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance,
                                            const Location& loc) const {
@@ -217,53 +352,9 @@ bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBuffer& cmd_st
     if (ib_mem && last_bound.IsUsing()) {
         const uint32_t scan_stride = GetIndexAlignment(ib_type);
         const uint8_t* scan_begin = static_cast<const uint8_t*>(ib_mem) + firstIndex * scan_stride;
-        const uint8_t* scan_end = scan_begin + indexCount * scan_stride;
-
-        // Min and max are important to track for some Mali architectures. In older Mali devices without IDVS, all
-        // vertices corresponding to indices between the minimum and maximum may be loaded, and possibly shaded,
-        // irrespective of whether or not they're part of the draw call.
-
-        // start with minimum as 0xFFFFFFFF and adjust to indices in the buffer
-        uint32_t min_index = ~0u;
-        // start with maximum as 0 and adjust to indices in the buffer
-        uint32_t max_index = 0u;
-
-        // first scan-through, we're looking to simulate a model LRU post-transform cache, estimating the number of vertices shaded
-        // for the given index buffer
-        uint32_t vertex_shade_count = 0;
-
-        PostTransformLRUCacheModel post_transform_cache;
-
-        // The size of the cache being modelled positively correlates with how much behaviour it can capture about
-        // arbitrary ground-truth hardware/architecture cache behaviour. I.e. it's a good solution when we don't know the
-        // target architecture.
-        // However, modelling a post-transform cache with more than 32 elements gives diminishing returns in practice.
-        // http://eelpi.gotdns.org/papers/fast_vert_cache_opt.html
-        post_transform_cache.resize(32);
-
-        for (const uint8_t* scan_ptr = scan_begin; scan_ptr < scan_end; scan_ptr += scan_stride) {
-            uint32_t scan_index;
-            uint32_t primitive_restart_value;
-            if (ib_type == VK_INDEX_TYPE_UINT8_KHR) {
-                scan_index = *reinterpret_cast<const uint8_t*>(scan_ptr);
-                primitive_restart_value = 0xFF;
-            } else if (ib_type == VK_INDEX_TYPE_UINT16) {
-                scan_index = *reinterpret_cast<const uint16_t*>(scan_ptr);
-                primitive_restart_value = 0xFFFF;
-            } else {
-                scan_index = *reinterpret_cast<const uint32_t*>(scan_ptr);
-                primitive_restart_value = 0xFFFFFFFF;
-            }
-
-            max_index = std::max(max_index, scan_index);
-            min_index = std::min(min_index, scan_index);
-
-            if (!primitive_restart_enable || scan_index != primitive_restart_value) {
-                const bool in_cache = post_transform_cache.query_cache(scan_index);
-                // if the shaded vertex corresponding to the index is not in the PT-cache, we need to shade again
-                if (!in_cache) vertex_shade_count++;
-            }
-        }
+        const IndexBufferStats stats = GetIndexBufferStats(scan_begin, indexCount, ib_type, primitive_restart_enable);
+        const uint32_t min_index = stats.min_index;
+        const uint32_t max_index = stats.max_index;
 
         // if the max and min values were not set, then we either have no indices, or all primitive restarts, exit...
         // if the max and min are the same, then it implies all the indices are the same, then we don't need to do anything
@@ -281,45 +372,10 @@ bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBuffer& cmd_st
             return skip;
         }
 
-        // use a dynamic vector of bitsets as a memory-compact representation of which indices are included in the draw call
-        // each bit of the n-th bucket contains the inclusion information for indices (n*n_buckets) to ((n+1)*n_buckets)
-        const size_t refs_per_bucket = 64;
-        std::vector<std::bitset<refs_per_bucket>> vertex_reference_buckets;
-
-        const uint32_t n_indices = max_index - min_index + 1;
-        const uint32_t n_buckets = (n_indices / static_cast<uint32_t>(refs_per_bucket)) +
-                                   ((n_indices % static_cast<uint32_t>(refs_per_bucket)) != 0 ? 1 : 0);
-
-        // there needs to be at least one bitset to store a set of indices smaller than n_buckets
-        vertex_reference_buckets.resize(std::max(1u, n_buckets));
-
-        // To avoid using too much memory, we run over the indices again.
-        // Knowing the size from the last scan allows us to record index usage with bitsets
-        for (const uint8_t* scan_ptr = scan_begin; scan_ptr < scan_end; scan_ptr += scan_stride) {
-            uint32_t scan_index;
-            if (ib_type == VK_INDEX_TYPE_UINT8_KHR) {
-                scan_index = *reinterpret_cast<const uint8_t*>(scan_ptr);
-            } else if (ib_type == VK_INDEX_TYPE_UINT16) {
-                scan_index = *reinterpret_cast<const uint16_t*>(scan_ptr);
-            } else {
-                scan_index = *reinterpret_cast<const uint32_t*>(scan_ptr);
-            }
-            // keep track of the set of all indices used to reference vertices in the draw call
-            size_t index_offset = scan_index - min_index;
-            size_t bitset_bucket_index = index_offset / refs_per_bucket;
-            uint64_t used_indices = 1ull << ((index_offset % refs_per_bucket) & 0xFFFFFFFFu);
-            vertex_reference_buckets[bitset_bucket_index] |= used_indices;
-        }
-
-        uint32_t vertex_reference_count = 0;
-        for (const auto& bitset : vertex_reference_buckets) {
-            vertex_reference_count += static_cast<uint32_t>(bitset.count());
-        }
-
         // low index buffer utilization implies that: of the vertices available to the draw call, not all are utilized
-        float utilization = static_cast<float>(vertex_reference_count) / static_cast<float>(max_index - min_index + 1);
+        float utilization = static_cast<float>(stats.vertex_reference_count) / static_cast<float>(max_index - min_index + 1);
         // low hit rate (high miss rate) implies the order of indices in the draw call may be possible to improve
-        float cache_hit_rate = static_cast<float>(vertex_reference_count) / static_cast<float>(vertex_shade_count);
+        float cache_hit_rate = static_cast<float>(stats.vertex_reference_count) / static_cast<float>(stats.vertex_shade_count);
 
         if (utilization < 0.5f) {
             skip |= LogPerformanceWarning(kVUID_BestPractices_CmdDrawIndexed_SparseIndexBuffer, device, loc,
@@ -605,7 +661,7 @@ void BestPractices::ValidateBoundDescriptorSets(bp_state::CommandBuffer& cb_stat
             for (uint32_t i = 0; i < binding->count; ++i) {
                 VkImageView image_view{VK_NULL_HANDLE};
 
-                auto descriptor = binding->GetDescriptor(i);
+                const auto* descriptor = std::as_const(*binding).GetDescriptor(i);
                 if (!descriptor) {
                     continue;
                 }
@@ -505,7 +505,7 @@ void BestPractices::ManualPostCallRecordQueueSubmit(VkQueue queue, uint32_t subm
 }
 
 std::shared_ptr<vvl::PhysicalDevice> BestPractices::CreatePhysicalDeviceState(VkPhysicalDevice handle) {
-    return std::static_pointer_cast<vvl::PhysicalDevice>(std::make_shared<bp_state::PhysicalDevice>(handle));
+    return std::static_pointer_cast<vvl::PhysicalDevice>(vvl::MakeState<bp_state::PhysicalDevice>(handle));
 }
 
 bp_state::PhysicalDevice* BestPractices::GetPhysicalDeviceState() {
@@ -264,7 +264,7 @@ std::shared_ptr<vvl::Pipeline> BestPractices::CreateGraphicsPipelineState(const
                                                                           std::shared_ptr<const vvl::RenderPass>&& render_pass,
                                                                           std::shared_ptr<const vvl::PipelineLayout>&& layout,
                                                                           ShaderModuleUniqueIds* shader_unique_id_map) const {
-    return std::static_pointer_cast<vvl::Pipeline>(std::make_shared<bp_state::Pipeline>(
+    return std::static_pointer_cast<vvl::Pipeline>(vvl::MakeState<bp_state::Pipeline>(
         *this, pCreateInfo, std::move(pipeline_cache), std::move(render_pass), std::move(layout), shader_unique_id_map));
 }
 
@@ -441,20 +441,13 @@ void BestPractices::PreCallRecordCmdBindPipeline(VkCommandBuffer commandBuffer,
 
     if (pipelineBindPoint == VK_PIPELINE_BIND_POINT_GRAPHICS && VendorCheckEnabled(kBPVendorNVIDIA)) {
         using TessGeometryMeshState = bp_state::CommandBufferStateNV::TessGeometryMesh::State;
-        auto& tgm = cb_state->nv.tess_geometry_mesh;
-
-        // Make sure the message is only signaled once per command buffer
-        tgm.threshold_signaled = tgm.num_switches >= kNumBindPipelineTessGeometryMeshSwitchesThresholdNVIDIA;
 
         // Track pipeline switches with tessellation, geometry, and/or mesh shaders enabled, and disabled
         auto tgm_stages = VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT | VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT |
                           VK_SHADER_STAGE_GEOMETRY_BIT | VK_SHADER_STAGE_TASK_BIT_EXT | VK_SHADER_STAGE_MESH_BIT_EXT;
         auto new_tgm_state =
             (pipeline_info->active_shaders & tgm_stages) != 0 ? TessGeometryMeshState::Enabled : TessGeometryMeshState::Disabled;
-        if (tgm.state != new_tgm_state && tgm.state != TessGeometryMeshState::Unknown) {
-            tgm.num_switches++;
-        }
-        tgm.state = new_tgm_state;
+        RecordTessGeometryMeshSwitchNVIDIA(*cb_state, new_tgm_state);
 
         // Track depthTestEnable and depthCompareOp
         auto& pipeline_create_info = pipeline_info->GraphicsCreateInfo();
@@ -479,6 +472,47 @@ void BestPractices::PreCallRecordCmdBindPipeline(VkCommandBuffer commandBuffer,
     }
 }
 
+void BestPractices::RecordTessGeometryMeshSwitchNVIDIA(bp_state::CommandBuffer& cb_state,
+                                                       bp_state::CommandBufferStateNV::TessGeometryMesh::State new_state) {
+    assert(VendorCheckEnabled(kBPVendorNVIDIA));
+    using TessGeometryMeshState = bp_state::CommandBufferStateNV::TessGeometryMesh::State;
+
+    if (cb_state.defer_nv_commands) {
+        cb_state.DeferNVCommand(bp_state::DeferredCommandNV::Type::BindPipeline).tess_geometry_mesh = new_state;
+        return;
+    }
+
+    auto& tgm = cb_state.nv.tess_geometry_mesh;
+
+    // Make sure the message is only signaled once per command buffer
+    tgm.threshold_signaled = tgm.num_switches >= kNumBindPipelineTessGeometryMeshSwitchesThresholdNVIDIA;
+
+    if (tgm.state != new_state && tgm.state != TessGeometryMeshState::Unknown) {
+        tgm.num_switches++;
+    }
+    tgm.state = new_state;
+}
+
+bool BestPractices::ValidateTessGeometryMeshSwitchNVIDIA(const bp_state::CommandBuffer& cb_state, const Location& loc) const {
+    bool skip = false;
+
+    // With deferred checks this runs when the logged vkCmdBindPipeline is replayed
+    if (cb_state.defer_nv_commands) {
+        return skip;
+    }
+
+    const auto& tgm = cb_state.nv.tess_geometry_mesh;
+    if (tgm.num_switches >= kNumBindPipelineTessGeometryMeshSwitchesThresholdNVIDIA && !tgm.threshold_signaled) {
+        LogPerformanceWarning(kVUID_BestPractices_BindPipeline_SwitchTessGeometryMesh, cb_state.Handle(), loc,
+                              "%s Avoid switching between pipelines with and without tessellation, geometry, task, "
+                              "and/or mesh shaders. Group draw calls using these shader stages together.",
+                              VendorSpecificTag(kBPVendorNVIDIA));
+        // Do not set 'skip' so the number of switches gets properly counted after the message.
+    }
+
+    return skip;
+}
+
 void BestPractices::PostCallRecordCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
                                                   VkPipeline pipeline, const RecordObject& record_obj) {
     StateTracker::PostCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline, record_obj);
@@ -659,14 +693,7 @@ bool BestPractices::PreCallValidateCmdBindPipeline(VkCommandBuffer commandBuffer
     }
     if (VendorCheckEnabled(kBPVendorNVIDIA)) {
         auto cb_state = Get<bp_state::CommandBuffer>(commandBuffer);
-        const auto& tgm = cb_state->nv.tess_geometry_mesh;
-        if (tgm.num_switches >= kNumBindPipelineTessGeometryMeshSwitchesThresholdNVIDIA && !tgm.threshold_signaled) {
-            LogPerformanceWarning(kVUID_BestPractices_BindPipeline_SwitchTessGeometryMesh, commandBuffer, error_obj.location,
-                                  "%s Avoid switching between pipelines with and without tessellation, geometry, task, "
-                                  "and/or mesh shaders. Group draw calls using these shader stages together.",
-                                  VendorSpecificTag(kBPVendorNVIDIA));
-            // Do not set 'skip' so the number of switches gets properly counted after the message.
-        }
+        skip |= ValidateTessGeometryMeshSwitchNVIDIA(*cb_state, error_obj.location);
     }
 
     return skip;
@@ -310,9 +310,7 @@ void BestPractices::PreCallRecordCmdEndRenderPass(VkCommandBuffer commandBuffer,
     auto cb_state = GetWrite<bp_state::CommandBuffer>(commandBuffer);
     if (cb_state) {
         // Add Deferred Queue
-        cb_state->queue_submit_functions.insert(cb_state->queue_submit_functions.end(),
-                                                cb_state->queue_submit_functions_after_render_pass.begin(),
-                                                cb_state->queue_submit_functions_after_render_pass.end());
+        cb_state->queue_submit_functions.append(cb_state->queue_submit_functions_after_render_pass);
         cb_state->queue_submit_functions_after_render_pass.clear();
     }
 }
@@ -325,9 +323,7 @@ void BestPractices::PreCallRecordCmdEndRenderPass2(VkCommandBuffer commandBuffer
     auto cb_state = GetWrite<bp_state::CommandBuffer>(commandBuffer);
     if (cb_state) {
         // Add Deferred Queue
-        cb_state->queue_submit_functions.insert(cb_state->queue_submit_functions.end(),
-                                                cb_state->queue_submit_functions_after_render_pass.begin(),
-                                                cb_state->queue_submit_functions_after_render_pass.end());
+        cb_state->queue_submit_functions.append(cb_state->queue_submit_functions_after_render_pass);
         cb_state->queue_submit_functions_after_render_pass.clear();
     }
 }
@@ -709,6 +705,9 @@ void BestPractices::PostRecordCmdBeginRenderPass(VkCommandBuffer commandBuffer,
 
     // Reset NV state
     cb_state->nv = {};
+    if (cb_state->defer_nv_commands) {
+        cb_state->DeferNVCommand(bp_state::DeferredCommandNV::Type::Reset);
+    }
 
     if (auto rp_state = Get<vvl::RenderPass>(pRenderPassBegin->renderPass)) {
         // track depth / color attachment usage within the renderpass
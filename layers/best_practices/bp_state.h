@@ -187,6 +187,31 @@ struct CommandBufferStateNV {
     bool depth_test_enable = false;
 };
 
+// With deferred vendor checks, the commands feeding the NVIDIA state machines are logged while recording and replayed when
+// the command buffer ends, instead of updating CommandBufferStateNV as each command is recorded.
+struct DeferredCommandNV {
+    enum class Type : uint8_t {
+        Reset,                     // vkCmdBeginRenderPass
+        BindPipeline,              // tess_geometry_mesh
+        SetDepthTestState,         // depth_compare_op, depth_test_enable
+        BindZcullScope,            // image (VK_NULL_HANDLE to unbind), range
+        ResetScopeZcullDirection,
+        ResetZcullDirection,       // image, range
+        Draw,                      // num_draws, consecutive draws share one entry
+        ValidateZcullScope,        // function
+        ValidateZcull,             // image, range, function
+    };
+
+    Type type;
+    CommandBufferStateNV::TessGeometryMesh::State tess_geometry_mesh = CommandBufferStateNV::TessGeometryMesh::State::Unknown;
+    bool depth_test_enable = false;
+    VkCompareOp depth_compare_op = VK_COMPARE_OP_NEVER;
+    uint32_t num_draws = 0;
+    vvl::Func function = vvl::Func::Empty;
+    VkImage image = VK_NULL_HANDLE;
+    VkImageSubresourceRange range{};
+};
+
 class CommandBuffer : public vvl::CommandBuffer {
   public:
     CommandBuffer(BestPractices& bp, VkCommandBuffer handle, const VkCommandBufferAllocateInfo* pCreateInfo,
@@ -194,6 +219,15 @@ class CommandBuffer : public vvl::CommandBuffer {
 
     RenderPassState render_pass_state;
     CommandBufferStateNV nv;
+    // Set when vkBeginCommandBuffer is recorded with deferred NVIDIA checks. The checks done while validating a command are
+    // logged too, which is why the log is mutable.
+    bool defer_nv_commands = false;
+    mutable std::vector<DeferredCommandNV> deferred_nv_commands;
+    DeferredCommandNV& DeferNVCommand(DeferredCommandNV::Type type) const {
+        DeferredCommandNV& command = deferred_nv_commands.emplace_back();
+        command.type = type;
+        return command;
+    }
     uint64_t num_submits = 0;
     bool uses_vertex_buffer = false;
     uint32_t small_indexed_draw_call_count = 0;
@@ -197,7 +197,7 @@ void BestPractices::ManualPostCallRecordQueuePresentKHR(VkQueue queue, const VkP
     // AMD best practice
     // end-of-frame cleanup
     num_queue_submissions_ = 0;
-    num_barriers_objects_ = 0;
+    num_barriers_objects_.Reset();
     ClearPipelinesUsedInFrame();
 }
 
@@ -376,5 +376,5 @@ void BestPractices::ManualPostCallRecordGetSwapchainImagesKHR(VkDevice device, V
 
 std::shared_ptr<vvl::Swapchain> BestPractices::CreateSwapchainState(const VkSwapchainCreateInfoKHR* pCreateInfo,
                                                                     VkSwapchainKHR handle) {
-    return std::static_pointer_cast<vvl::Swapchain>(std::make_shared<bp_state::Swapchain>(*this, pCreateInfo, handle));
+    return std::static_pointer_cast<vvl::Swapchain>(vvl::MakeState<bp_state::Swapchain>(*this, pCreateInfo, handle));
 }
\ No newline at end of file
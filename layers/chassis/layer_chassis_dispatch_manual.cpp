@@ -485,8 +485,9 @@ VkResult DispatchAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAl
     if (VK_SUCCESS == result) {
         WriteLockGuard lock(dispatch_lock);
         auto &pool_descriptor_sets = layer_data->pool_descriptor_sets_map[pAllocateInfo->descriptorPool];
+        layer_data->WrapNewArray(pDescriptorSets, pAllocateInfo->descriptorSetCount);
+        pool_descriptor_sets.reserve(pool_descriptor_sets.size() + pAllocateInfo->descriptorSetCount);
         for (uint32_t index0 = 0; index0 < pAllocateInfo->descriptorSetCount; index0++) {
-            pDescriptorSets[index0] = layer_data->WrapNew(pDescriptorSets[index0]);
             pool_descriptor_sets.insert(pDescriptorSets[index0]);
         }
     }
@@ -0,0 +1,122 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace vvl {
+
+// Fixed size array split in chunks of kChunkSize elements, for large arrays that mostly keep their default value (ex. the
+// descriptors of a bindless binding).
+//
+// A chunk is allocated by the first non-const access to one of its elements. Const accesses to a chunk that was never
+// allocated return a shared default constructed T, so reading an array does not allocate. Copies of an array share its
+// chunks, and a shared chunk is cloned by the first non-const access to it through either array, so a copy costs a
+// pointer per chunk and a write only copies the chunk it touches.
+//
+// Non-const accesses from several threads are safe, chunks are allocated or cloned with a compare exchange. Writing the
+// same element from several threads still needs external synchronization. A reference to an element stays valid until
+// the array is destroyed or, for a shared chunk, until the chunk is cloned.
+template <typename T, uint32_t kChunkSizeLog2 = 6>
+class CowChunkedArray {
+  public:
+    static constexpr uint32_t kChunkSize = 1u << kChunkSizeLog2;
+
+    CowChunkedArray() = default;
+    explicit CowChunkedArray(uint32_t size)
+        : size_(size),
+          chunk_count_((size + kChunkSize - 1) >> kChunkSizeLog2),
+          chunks_(chunk_count_ ? std::make_unique<std::atomic<Chunk *>[]>(chunk_count_) : nullptr) {}
+
+    CowChunkedArray(const CowChunkedArray &other)
+        : size_(other.size_),
+          chunk_count_(other.chunk_count_),
+          chunks_(chunk_count_ ? std::make_unique<std::atomic<Chunk *>[]>(chunk_count_) : nullptr) {
+        for (uint32_t i = 0; i < chunk_count_; ++i) {
+            Chunk *chunk = other.chunks_[i].load(std::memory_order_acquire);
+            if (chunk) {
+                chunk->refs.fetch_add(1, std::memory_order_relaxed);
+            }
+            chunks_[i].store(chunk, std::memory_order_relaxed);
+        }
+    }
+    CowChunkedArray &operator=(const CowChunkedArray &) = delete;
+    ~CowChunkedArray() {
+        for (uint32_t i = 0; i < chunk_count_; ++i) {
+            Release(chunks_[i].load(std::memory_order_relaxed));
+        }
+    }
+
+    uint32_t size() const { return size_; }
+
+    const T &operator[](uint32_t index) const {
+        const Chunk *chunk = chunks_[index >> kChunkSizeLog2].load(std::memory_order_acquire);
+        return chunk ? chunk->items[index & (kChunkSize - 1)] : DefaultValue();
+    }
+    T &operator[](uint32_t index) { return OwnedChunk(index >> kChunkSizeLog2).items[index & (kChunkSize - 1)]; }
+
+    bool IsChunkAllocated(uint32_t index) const {
+        return chunks_[index >> kChunkSizeLog2].load(std::memory_order_acquire) != nullptr;
+    }
+
+  private:
+    struct Chunk {
+        Chunk() = default;
+        Chunk(const Chunk &other) { std::copy(other.items, other.items + kChunkSize, items); }
+
+        // Number of arrays sharing the chunk
+        std::atomic<uint32_t> refs{1};
+        T items[kChunkSize];
+    };
+
+    static const T &DefaultValue() {
+        static const T default_value{};
+        return default_value;
+    }
+
+    static void Release(Chunk *chunk) {
+        if (chunk && chunk->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete chunk;
+        }
+    }
+
+    Chunk &OwnedChunk(uint32_t chunk_index) {
+        std::atomic<Chunk *> &chunk_ptr = chunks_[chunk_index];
+        Chunk *chunk = chunk_ptr.load(std::memory_order_acquire);
+        while (!chunk || chunk->refs.load(std::memory_order_acquire) != 1) {
+            Chunk *new_chunk = chunk ? new Chunk(*chunk) : new Chunk();
+            if (chunk_ptr.compare_exchange_strong(chunk, new_chunk, std::memory_order_acq_rel)) {
+                // The array does not share the old chunk anymore
+                Release(chunk);
+                return *new_chunk;
+            }
+            // Another thread allocated or cloned the chunk first, chunk now holds its version
+            delete new_chunk;
+        }
+        return *chunk;
+    }
+
+    uint32_t size_ = 0;
+    uint32_t chunk_count_ = 0;
+    std::unique_ptr<std::atomic<Chunk *>[]> chunks_;
+};
+
+}  // namespace vvl
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cmath>
 
 #include <cassert>
@@ -40,6 +41,8 @@
 
 #include <vulkan/utility/vk_concurrent_unordered_map.hpp>
 
+#include "containers/layer_allocator.h"
+
 // namespace aliases to allow map and set implementations to easily be swapped out
 namespace vvl {
 
@@ -331,7 +334,7 @@ class small_vector {
         // Since this can't shrink, if we're growing we're newing
         if (new_cap > capacity_) {
             assert(capacity_ >= kSmallCapacity);
-            auto new_store = std::unique_ptr<BackingStore[]>(new BackingStore[new_cap]);
+            auto new_store = NewLargeStore(new_cap);
             auto working_store = GetWorkingStore();
             for (size_type i = 0; i < size_; i++) {
                 new (new_store[i].data) value_type(std::move(working_store[i]));
@@ -375,12 +378,12 @@ class small_vector {
         } else if ((capacity_ > kSmallCapacity) && (capacity_ > size_)) {
             auto source = GetWorkingStore();
             // Keep the source from disappearing until the end of the function
-            auto old_store = std::unique_ptr<BackingStore[]>(std::move(large_store_));
+            auto old_store = LargeStore(std::move(large_store_));
             assert(!large_store_);
             if (size_ < kSmallCapacity) {
                 capacity_ = kSmallCapacity;
             } else {
-                large_store_ = std::unique_ptr<BackingStore[]>(new BackingStore[size_]);
+                large_store_ = NewLargeStore(size_);
                 capacity_ = size_;
             }
             UpdateWorkingStore();
@@ -439,10 +442,35 @@ class small_vector {
         uint8_t data[sizeof(value_type)];
         value_type object;
     };
+
+    // The heap storage comes from the layer allocator and is counted in its Containers statistics
+    static constexpr bool kUseLayerAllocator = alignof(BackingStore) <= alignof(std::max_align_t);
+    struct LargeStoreDeleter {
+        void operator()(BackingStore *store) const noexcept {
+            if constexpr (kUseLayerAllocator) {
+                vvl::Free(store);
+            } else {
+                delete[] store;
+            }
+        }
+    };
+    using LargeStore = std::unique_ptr<BackingStore[], LargeStoreDeleter>;
+
+    static LargeStore NewLargeStore(size_type count) {
+        if constexpr (kUseLayerAllocator) {
+            void *memory = vvl::Allocate(sizeof(BackingStore) * count, vvl::AllocationSubsystem::Containers);
+            auto *store = static_cast<BackingStore *>(memory);
+            std::uninitialized_default_construct_n(store, count);
+            return LargeStore(store);
+        } else {
+            return LargeStore(new BackingStore[count]);
+        }
+    }
+
     size_type size_;
     size_type capacity_;
     BackingStore small_store_[N];
-    std::unique_ptr<BackingStore[]> large_store_;
+    LargeStore large_store_;
     value_type *working_store_;
 
 #ifndef NDEBUG
@@ -814,16 +842,54 @@ class small_unordered_map : public small_container<Key, typename vvl::unordered_
 template <typename Key, int N = 1>
 class small_unordered_set : public small_container<Key, Key, vvl::unordered_set<Key>, value_type_helper_set<Key>, N> {};
 
+// Last GetLayerDataPtr() result of the thread, almost every call of a thread is made on the same device. Creating or freeing
+// any layer data of the type bumps the generation, which invalidates the cache of every thread.
+template <typename DATA_T>
+struct LayerDataCache {
+    static inline std::atomic<uint64_t> generation{1};
+
+    const void *map = nullptr;
+    void *key = nullptr;
+    DATA_T *data = nullptr;
+    uint64_t seen_generation = 0;
+
+    static LayerDataCache &Get() {
+        static thread_local LayerDataCache cache;
+        return cache;
+    }
+    static void Invalidate() { generation.fetch_add(1, std::memory_order_acq_rel); }
+
+    DATA_T *Find(const void *data_map, void *data_key, uint64_t current_generation) const {
+        return (key == data_key && map == data_map && seen_generation == current_generation) ? data : nullptr;
+    }
+    void Set(const void *data_map, void *data_key, DATA_T *data_ptr, uint64_t current_generation) {
+        map = data_map;
+        key = data_key;
+        data = data_ptr;
+        seen_generation = current_generation;
+    }
+};
+
 // For the given data key, look up the layer_data instance from given layer_data_map
 template <typename DATA_T>
 DATA_T *GetLayerDataPtr(void *data_key, small_unordered_map<void *, DATA_T *, 2> &layer_data_map) {
+    auto &cache = LayerDataCache<DATA_T>::Get();
+    // Read before the lookup, a generation bumped during it must not be cached with the result
+    const uint64_t generation = LayerDataCache<DATA_T>::generation.load(std::memory_order_acquire);
+    if (DATA_T *cached = cache.Find(&layer_data_map, data_key, generation)) {
+        return cached;
+    }
+
     /* TODO: We probably should lock here, or have caller lock */
     DATA_T *&got = layer_data_map[data_key];
 
     if (got == nullptr) {
         got = new DATA_T;
+        LayerDataCache<DATA_T>::Invalidate();
+        return got;
     }
 
+    cache.Set(&layer_data_map, data_key, got, generation);
     return got;
 }
 
@@ -831,11 +897,18 @@ template <typename DATA_T>
 void FreeLayerDataPtr(void *data_key, small_unordered_map<void *, DATA_T *, 2> &layer_data_map) {
     delete layer_data_map[data_key];
     layer_data_map.erase(data_key);
+    LayerDataCache<DATA_T>::Invalidate();
 }
 
 // For the given data key, look up the layer_data instance from given layer_data_map
 template <typename DATA_T>
 DATA_T *GetLayerDataPtr(void *data_key, std::unordered_map<void *, DATA_T *> &layer_data_map) {
+    auto &cache = LayerDataCache<DATA_T>::Get();
+    const uint64_t generation = LayerDataCache<DATA_T>::generation.load(std::memory_order_acquire);
+    if (DATA_T *cached = cache.Find(&layer_data_map, data_key, generation)) {
+        return cached;
+    }
+
     DATA_T *debug_data;
     /* TODO: We probably should lock here, or have caller lock */
     auto got = layer_data_map.find(data_key);
@@ -843,8 +916,10 @@ DATA_T *GetLayerDataPtr(void *data_key, std::unordered_map<void *, DATA_T *> &la
     if (got == layer_data_map.end()) {
         debug_data = new DATA_T;
         layer_data_map[(void *)data_key] = debug_data;
+        LayerDataCache<DATA_T>::Invalidate();
     } else {
         debug_data = got->second;
+        cache.Set(&layer_data_map, data_key, debug_data, generation);
     }
 
     return debug_data;
@@ -857,6 +932,7 @@ void FreeLayerDataPtr(void *data_key, std::unordered_map<void *, DATA_T *> &laye
 
     delete got->second;
     layer_data_map.erase(got);
+    LayerDataCache<DATA_T>::Invalidate();
 }
 
 namespace vvl {
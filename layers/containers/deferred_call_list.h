@@ -0,0 +1,130 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "containers/monotonic_arena.h"
+
+namespace vvl {
+
+template <typename Signature>
+class DeferredCallList;
+
+// List of callables recorded now and called later (ex. the submit time callbacks of a command buffer), used like a
+// std::vector<std::function<Signature>>.
+//
+// The callables are stored in a MonotonicArena instead of being allocated by std::function, so a list that is cleared
+// and refilled (a command buffer recorded again) reuses the same memory. Each entry is the callable and a pointer to the
+// static table of its type, calling it is a single indirect call. Without an arena the callables come from operator new.
+//
+// Not thread safe, the owner must serialize access to the list and its arena.
+template <typename R, typename... Args>
+class DeferredCallList<R(Args...)> {
+  public:
+    class Call {
+      public:
+        R operator()(Args... args) const { return ops_->invoke(callable_, std::forward<Args>(args)...); }
+
+      private:
+        friend DeferredCallList;
+        struct Ops {
+            R (*invoke)(void *callable, Args... args);
+            void *(*copy)(const void *callable, MonotonicArena *arena);
+            void (*destroy)(void *callable, MonotonicArena *arena);
+        };
+
+        Call(const Ops *ops, void *callable) : ops_(ops), callable_(callable) {}
+
+        const Ops *ops_;
+        void *callable_;
+    };
+
+    explicit DeferredCallList(MonotonicArena *arena = nullptr) : arena_(arena) {}
+    DeferredCallList(const DeferredCallList &) = delete;
+    DeferredCallList &operator=(const DeferredCallList &) = delete;
+    ~DeferredCallList() { clear(); }
+
+    template <typename Fn>
+    void emplace_back(Fn &&fn) {
+        using Callable = std::decay_t<Fn>;
+        static_assert(alignof(Callable) <= MonotonicArena::kAlignment, "over aligned callable");
+        void *storage = Allocate(arena_, sizeof(Callable));
+        calls_.emplace_back(Call(&kOps<Callable>, new (storage) Callable(std::forward<Fn>(fn))));
+    }
+    void push_back(const Call &call) { calls_.emplace_back(Call(call.ops_, call.ops_->copy(call.callable_, arena_))); }
+
+    // Copies the calls of other to the end of this list
+    void append(const DeferredCallList &other) {
+        calls_.reserve(calls_.size() + other.calls_.size());
+        for (const Call &call : other) {
+            push_back(call);
+        }
+    }
+
+    const Call *begin() const { return calls_.data(); }
+    const Call *end() const { return calls_.data() + calls_.size(); }
+    size_t size() const { return calls_.size(); }
+    bool empty() const { return calls_.empty(); }
+
+    // The entries keep their capacity and the callable memory goes back to the arena
+    void clear() {
+        for (const Call &call : calls_) {
+            call.ops_->destroy(call.callable_, arena_);
+        }
+        calls_.clear();
+    }
+
+  private:
+    static void *Allocate(MonotonicArena *arena, size_t size) {
+        return arena ? arena->Allocate(size, MonotonicArena::kAlignment) : ::operator new(size);
+    }
+    static void Free(MonotonicArena *arena, void *ptr, size_t size) {
+        if (arena) {
+            arena->Free(ptr, size);
+        } else {
+            ::operator delete(ptr);
+        }
+    }
+
+    template <typename Callable>
+    static R Invoke(void *callable, Args... args) {
+        return (*static_cast<Callable *>(callable))(std::forward<Args>(args)...);
+    }
+    template <typename Callable>
+    static void *Copy(const void *callable, MonotonicArena *arena) {
+        return new (Allocate(arena, sizeof(Callable))) Callable(*static_cast<const Callable *>(callable));
+    }
+    template <typename Callable>
+    static void Destroy(void *callable, MonotonicArena *arena) {
+        static_cast<Callable *>(callable)->~Callable();
+        Free(arena, callable, sizeof(Callable));
+    }
+
+    template <typename Callable>
+    static constexpr typename Call::Ops kOps = {&Invoke<Callable>, &Copy<Callable>, &Destroy<Callable>};
+
+    MonotonicArena *arena_;
+    std::vector<Call> calls_;
+};
+
+}  // namespace vvl
@@ -0,0 +1,213 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "utils/cast_utils.h"
+
+namespace vvl {
+
+// Map from handles to values for the small per object maps that are filled, walked and cleared over and over, ex. the
+// image layouts of a command buffer.
+//
+// The entries are stored densely in insertion order, so walking the map touches one contiguous array, and the position of
+// an entry is its ordinal. Up to kLinearLimit entries a lookup scans the keys, past it an open addressed index of ordinals
+// with linear probing is built next to them. Erasing moves the last entry into the hole and the index uses backward shift
+// deletion, so there are no tombstones. clear() keeps the allocations for the next use.
+//
+// NOTE: Unlike an unordered_map, erasing invalidates the iterators to the last entry, and erase(iterator) returns an
+// iterator to the entry moved into the erased position.
+template <typename Key, typename T>
+class DenseHandleMap {
+  public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using iterator = typename std::vector<value_type>::iterator;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+    static constexpr size_t kLinearLimit = 8;
+
+    iterator begin() { return entries_.begin(); }
+    iterator end() { return entries_.end(); }
+    const_iterator begin() const { return entries_.begin(); }
+    const_iterator end() const { return entries_.end(); }
+    const_iterator cbegin() const { return entries_.cbegin(); }
+    const_iterator cend() const { return entries_.cend(); }
+
+    bool empty() const { return entries_.empty(); }
+    size_t size() const { return entries_.size(); }
+
+    void clear() {
+        entries_.clear();
+        index_.clear();
+    }
+
+    iterator find(const Key &key) {
+        const uint32_t ordinal = FindOrdinal(key);
+        return ordinal == kNotFound ? entries_.end() : entries_.begin() + ordinal;
+    }
+    const_iterator find(const Key &key) const {
+        const uint32_t ordinal = FindOrdinal(key);
+        return ordinal == kNotFound ? entries_.cend() : entries_.cbegin() + ordinal;
+    }
+    size_t count(const Key &key) const { return FindOrdinal(key) == kNotFound ? 0 : 1; }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(const Key &key, Args &&...args) {
+        const uint32_t ordinal = FindOrdinal(key);
+        if (ordinal != kNotFound) {
+            return {entries_.begin() + ordinal, false};
+        }
+        entries_.emplace_back(std::piecewise_construct, std::forward_as_tuple(key),
+                              std::forward_as_tuple(std::forward<Args>(args)...));
+        AddToIndex(static_cast<uint32_t>(entries_.size() - 1));
+        return {entries_.end() - 1, true};
+    }
+    std::pair<iterator, bool> insert(value_type &&value) { return emplace(value.first, std::move(value.second)); }
+    std::pair<iterator, bool> insert(const value_type &value) { return emplace(value.first, value.second); }
+
+    T &operator[](const Key &key) { return emplace(key).first->second; }
+
+    size_t erase(const Key &key) {
+        const uint32_t ordinal = FindOrdinal(key);
+        if (ordinal == kNotFound) {
+            return 0;
+        }
+        EraseOrdinal(ordinal);
+        return 1;
+    }
+    iterator erase(const_iterator pos) {
+        const size_t ordinal = pos - entries_.cbegin();
+        EraseOrdinal(static_cast<uint32_t>(ordinal));
+        return entries_.begin() + ordinal;
+    }
+
+  private:
+    static constexpr uint32_t kNotFound = ~0U;
+    // Slots of the index hold the ordinal + 1, 0 is an empty slot
+    static constexpr uint32_t kEmptySlot = 0;
+
+    static uint64_t Hash(const Key &key) {
+        uint64_t bits = CastToUint64(key);
+        bits ^= bits >> 33;
+        bits *= 0xff51afd7ed558ccdULL;
+        bits ^= bits >> 33;
+        return bits;
+    }
+
+    uint32_t FindOrdinal(const Key &key) const {
+        if (index_.empty()) {
+            for (size_t i = 0; i < entries_.size(); ++i) {
+                if (entries_[i].first == key) {
+                    return static_cast<uint32_t>(i);
+                }
+            }
+            return kNotFound;
+        }
+        const size_t mask = index_.size() - 1;
+        for (size_t slot = Hash(key) & mask;; slot = (slot + 1) & mask) {
+            const uint32_t value = index_[slot];
+            if (value == kEmptySlot) {
+                return kNotFound;
+            }
+            if (entries_[value - 1].first == key) {
+                return value - 1;
+            }
+        }
+    }
+
+    size_t FindSlot(uint32_t ordinal) const {
+        const size_t mask = index_.size() - 1;
+        size_t slot = Hash(entries_[ordinal].first) & mask;
+        while (index_[slot] != ordinal + 1) {
+            assert(index_[slot] != kEmptySlot);
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+
+    void PlaceInIndex(uint32_t ordinal) {
+        const size_t mask = index_.size() - 1;
+        size_t slot = Hash(entries_[ordinal].first) & mask;
+        while (index_[slot] != kEmptySlot) {
+            slot = (slot + 1) & mask;
+        }
+        index_[slot] = ordinal + 1;
+    }
+
+    // Called once entries_[ordinal] has been appended
+    void AddToIndex(uint32_t ordinal) {
+        const size_t count = entries_.size();
+        if (index_.empty() && count <= kLinearLimit) {
+            return;
+        }
+        // At most half full
+        if (2 * count > index_.size()) {
+            size_t capacity = index_.empty() ? 4 * kLinearLimit : 2 * index_.size();
+            while (2 * count > capacity) {
+                capacity *= 2;
+            }
+            index_.assign(capacity, kEmptySlot);
+            for (uint32_t i = 0; i < count; ++i) {
+                PlaceInIndex(i);
+            }
+            return;
+        }
+        PlaceInIndex(ordinal);
+    }
+
+    void EraseOrdinal(uint32_t ordinal) {
+        const uint32_t last = static_cast<uint32_t>(entries_.size() - 1);
+        if (!index_.empty()) {
+            RemoveFromIndex(FindSlot(ordinal));
+            if (ordinal != last) {
+                index_[FindSlot(last)] = ordinal + 1;
+            }
+        }
+        if (ordinal != last) {
+            entries_[ordinal] = std::move(entries_[last]);
+        }
+        entries_.pop_back();
+    }
+
+    // Backward shift deletion: the entries after the hole that would not be found past it anymore are moved into it
+    void RemoveFromIndex(size_t hole) {
+        const size_t mask = index_.size() - 1;
+        for (size_t slot = (hole + 1) & mask; index_[slot] != kEmptySlot; slot = (slot + 1) & mask) {
+            const size_t home = Hash(entries_[index_[slot] - 1].first) & mask;
+            // The entry stays if its home is cyclically in (hole, slot]
+            if (((slot - home) & mask) < ((slot - hole) & mask)) {
+                continue;
+            }
+            index_[hole] = index_[slot];
+            hole = slot;
+        }
+        index_[hole] = kEmptySlot;
+    }
+
+    std::vector<value_type> entries_;
+    // Empty while the keys are scanned, a power of two in size once built
+    std::vector<uint32_t> index_;
+};
+
+}  // namespace vvl
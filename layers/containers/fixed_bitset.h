@@ -0,0 +1,268 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace vvl {
+
+namespace bits {
+static inline uint32_t PopCount(uint64_t word) {
+#if defined(__GNUC__)
+    return static_cast<uint32_t>(__builtin_popcountll(word));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return static_cast<uint32_t>(__popcnt64(word));
+#else
+    uint32_t count = 0;
+    for (; word; word &= word - 1) {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+// Note: the result is undefined for a word of 0
+static inline uint32_t CountTrailingZeros(uint64_t word) {
+    assert(word != 0);
+#if defined(__GNUC__)
+    return static_cast<uint32_t>(__builtin_ctzll(word));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long bit_pos;
+    _BitScanForward64(&bit_pos, word);
+    return static_cast<uint32_t>(bit_pos);
+#else
+    uint32_t count = 0;
+    for (; (word & 1) == 0; word >>= 1) {
+        ++count;
+    }
+    return count;
+#endif
+}
+}  // namespace bits
+
+// Drop in replacement for the subset of std::bitset the layers use, stored as an array of 64 bit words.
+//
+// std::bitset does not promise anything about its storage, and its implementations often loop over the words for
+// operations like any() or operator&, and bit by bit for iteration. Here every operation is a fixed length loop over
+// the words that compilers fully unroll (and vectorize where it helps), everything is constexpr so masks can be compile
+// time constants, and set bits are iterated with count trailing zeros.
+template <size_t N>
+class FixedBitset {
+  public:
+    static constexpr size_t kWordBits = 64;
+    static constexpr size_t kWordCount = N / kWordBits;
+    static_assert(N > 0 && (N % kWordBits) == 0, "FixedBitset size must be a multiple of 64");
+
+    constexpr FixedBitset() noexcept : words_{} {}
+    constexpr FixedBitset(unsigned long long value) noexcept : words_{} { words_[0] = value; }
+
+    static constexpr size_t size() noexcept { return N; }
+
+    constexpr bool test(size_t pos) const {
+        assert(pos < N);
+        return ((words_[pos / kWordBits] >> (pos % kWordBits)) & 1) != 0;
+    }
+    constexpr bool operator[](size_t pos) const { return test(pos); }
+
+    constexpr FixedBitset &set() noexcept {
+        for (auto &word : words_) {
+            word = ~uint64_t(0);
+        }
+        return *this;
+    }
+    constexpr FixedBitset &set(size_t pos, bool value = true) {
+        assert(pos < N);
+        const uint64_t bit = uint64_t(1) << (pos % kWordBits);
+        if (value) {
+            words_[pos / kWordBits] |= bit;
+        } else {
+            words_[pos / kWordBits] &= ~bit;
+        }
+        return *this;
+    }
+    constexpr FixedBitset &reset() noexcept {
+        for (auto &word : words_) {
+            word = 0;
+        }
+        return *this;
+    }
+    constexpr FixedBitset &reset(size_t pos) { return set(pos, false); }
+
+    constexpr bool any() const noexcept {
+        uint64_t combined = 0;
+        for (const auto word : words_) {
+            combined |= word;
+        }
+        return combined != 0;
+    }
+    constexpr bool none() const noexcept { return !any(); }
+    constexpr bool all() const noexcept {
+        uint64_t combined = ~uint64_t(0);
+        for (const auto word : words_) {
+            combined &= word;
+        }
+        return combined == ~uint64_t(0);
+    }
+    size_t count() const noexcept {
+        size_t result = 0;
+        for (const auto word : words_) {
+            result += bits::PopCount(word);
+        }
+        return result;
+    }
+
+    // (*this & other).any() without building the intermediate value
+    constexpr bool Intersects(const FixedBitset &other) const noexcept {
+        uint64_t combined = 0;
+        for (size_t i = 0; i < kWordCount; ++i) {
+            combined |= words_[i] & other.words_[i];
+        }
+        return combined != 0;
+    }
+    // (*this & ~other)
+    constexpr FixedBitset AndNot(const FixedBitset &other) const noexcept {
+        FixedBitset result;
+        for (size_t i = 0; i < kWordCount; ++i) {
+            result.words_[i] = words_[i] & ~other.words_[i];
+        }
+        return result;
+    }
+
+    // Index of the lowest set bit, or size() if none is set
+    size_t FindFirst() const noexcept {
+        for (size_t i = 0; i < kWordCount; ++i) {
+            if (words_[i]) {
+                return i * kWordBits + bits::CountTrailingZeros(words_[i]);
+            }
+        }
+        return N;
+    }
+
+    // Calls func(size_t index) for each set bit, in increasing order
+    template <typename Func>
+    void ForEachSetBit(Func &&func) const {
+        for (size_t i = 0; i < kWordCount; ++i) {
+            for (uint64_t word = words_[i]; word; word &= word - 1) {
+                func(i * kWordBits + bits::CountTrailingZeros(word));
+            }
+        }
+    }
+
+    constexpr FixedBitset &operator&=(const FixedBitset &other) noexcept {
+        for (size_t i = 0; i < kWordCount; ++i) {
+            words_[i] &= other.words_[i];
+        }
+        return *this;
+    }
+    constexpr FixedBitset &operator|=(const FixedBitset &other) noexcept {
+        for (size_t i = 0; i < kWordCount; ++i) {
+            words_[i] |= other.words_[i];
+        }
+        return *this;
+    }
+    constexpr FixedBitset &operator^=(const FixedBitset &other) noexcept {
+        for (size_t i = 0; i < kWordCount; ++i) {
+            words_[i] ^= other.words_[i];
+        }
+        return *this;
+    }
+    constexpr FixedBitset operator~() const noexcept {
+        FixedBitset result;
+        for (size_t i = 0; i < kWordCount; ++i) {
+            result.words_[i] = ~words_[i];
+        }
+        return result;
+    }
+
+    constexpr FixedBitset &operator<<=(size_t shift) noexcept {
+        if (shift >= N) {
+            return reset();
+        }
+        const size_t word_shift = shift / kWordBits;
+        const size_t bit_shift = shift % kWordBits;
+        for (size_t i = kWordCount; i-- > 0;) {
+            uint64_t word = 0;
+            if (i >= word_shift) {
+                word = words_[i - word_shift] << bit_shift;
+                if (bit_shift && i > word_shift) {
+                    word |= words_[i - word_shift - 1] >> (kWordBits - bit_shift);
+                }
+            }
+            words_[i] = word;
+        }
+        return *this;
+    }
+    constexpr FixedBitset &operator>>=(size_t shift) noexcept {
+        if (shift >= N) {
+            return reset();
+        }
+        const size_t word_shift = shift / kWordBits;
+        const size_t bit_shift = shift % kWordBits;
+        for (size_t i = 0; i < kWordCount; ++i) {
+            uint64_t word = 0;
+            if (i + word_shift < kWordCount) {
+                word = words_[i + word_shift] >> bit_shift;
+                if (bit_shift && i + word_shift + 1 < kWordCount) {
+                    word |= words_[i + word_shift + 1] << (kWordBits - bit_shift);
+                }
+            }
+            words_[i] = word;
+        }
+        return *this;
+    }
+    constexpr FixedBitset operator<<(size_t shift) const noexcept { return FixedBitset(*this) <<= shift; }
+    constexpr FixedBitset operator>>(size_t shift) const noexcept { return FixedBitset(*this) >>= shift; }
+
+    constexpr bool operator==(const FixedBitset &other) const noexcept {
+        uint64_t difference = 0;
+        for (size_t i = 0; i < kWordCount; ++i) {
+            difference |= words_[i] ^ other.words_[i];
+        }
+        return difference == 0;
+    }
+    constexpr bool operator!=(const FixedBitset &other) const noexcept { return !(*this == other); }
+
+    constexpr uint64_t Word(size_t index) const {
+        assert(index < kWordCount);
+        return words_[index];
+    }
+
+  private:
+    uint64_t words_[kWordCount];
+};
+
+template <size_t N>
+constexpr FixedBitset<N> operator&(const FixedBitset<N> &lhs, const FixedBitset<N> &rhs) noexcept {
+    return FixedBitset<N>(lhs) &= rhs;
+}
+template <size_t N>
+constexpr FixedBitset<N> operator|(const FixedBitset<N> &lhs, const FixedBitset<N> &rhs) noexcept {
+    return FixedBitset<N>(lhs) |= rhs;
+}
+template <size_t N>
+constexpr FixedBitset<N> operator^(const FixedBitset<N> &lhs, const FixedBitset<N> &rhs) noexcept {
+    return FixedBitset<N>(lhs) ^= rhs;
+}
+
+}  // namespace vvl
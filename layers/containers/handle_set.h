@@ -0,0 +1,209 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "utils/epoch.h"
+
+namespace vvl {
+
+// Set of handle values, for lookups that only need to know whether a handle is live.
+//
+// The values are stored in an open addressed table of atomics with linear probing, so Contains() takes no lock and does
+// not touch any shared reference count: it enters an EpochGuard, loads the current table and probes it. Insert() and
+// Erase() are serialized by a mutex, they only run when objects are created or destroyed. Erased values leave a
+// tombstone, and the table is rebuilt once live values and tombstones fill half of it. The rebuilt table is published
+// atomically and the previous one is retired to an EpochRetireList, so a concurrent Contains() can finish probing it.
+//
+// NOTE: A Contains() racing with an Insert() or Erase() of the same value may see either result, like any unsynchronized
+// use of an object that is being created or destroyed.
+class ConcurrentHandleSet {
+  public:
+    ConcurrentHandleSet() : current_(std::make_shared<Table>(kMinCapacity)) { table_.store(current_.get()); }
+    ConcurrentHandleSet(const ConcurrentHandleSet &) = delete;
+    ConcurrentHandleSet &operator=(const ConcurrentHandleSet &) = delete;
+    ~ConcurrentHandleSet() { retired_tables_.ReleaseAll(); }
+
+    bool Contains(uint64_t handle) const {
+        if (handle == kEmpty || handle == kTombstone) {
+            return handle == kTombstone && has_tombstone_value_.load(std::memory_order_acquire);
+        }
+        EpochGuard guard;
+        const Table *table = table_.load(std::memory_order_acquire);
+        for (uint64_t i = Hash(handle);; ++i) {
+            const uint64_t value = table->slots[i & table->mask].load(std::memory_order_acquire);
+            if (value == handle) {
+                return true;
+            }
+            if (value == kEmpty) {
+                return false;
+            }
+        }
+    }
+
+    // Returns false if the handle was already in the set
+    bool Insert(uint64_t handle) {
+        std::lock_guard<std::mutex> lock(lock_);
+        return InsertLocked(handle);
+    }
+
+    // Inserts handles[0, count) under one lock, growing the table at most once for the whole batch
+    void InsertBatch(const uint64_t *handles, size_t count) {
+        std::lock_guard<std::mutex> lock(lock_);
+        if (2 * (used_ + count) > current_->mask + 1) {
+            Rebuild(count);
+        }
+        for (size_t i = 0; i < count; ++i) {
+            InsertLocked(handles[i]);
+        }
+    }
+
+    // Returns false if the handle was not in the set
+    bool Erase(uint64_t handle) {
+        std::lock_guard<std::mutex> lock(lock_);
+        if (handle == kEmpty) {
+            return false;
+        }
+        if (handle == kTombstone) {
+            return has_tombstone_value_.exchange(false, std::memory_order_release);
+        }
+        Table &table = *current_;
+        for (uint64_t i = Hash(handle);; ++i) {
+            auto &slot = table.slots[i & table.mask];
+            const uint64_t value = slot.load(std::memory_order_relaxed);
+            if (value == handle) {
+                slot.store(kTombstone, std::memory_order_release);
+                --size_;
+                return true;
+            }
+            if (value == kEmpty) {
+                return false;
+            }
+        }
+    }
+
+    void Clear() {
+        std::lock_guard<std::mutex> lock(lock_);
+        has_tombstone_value_.store(false, std::memory_order_release);
+        size_ = 0;
+        Rebuild();
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(lock_);
+        return size_ + (has_tombstone_value_.load(std::memory_order_relaxed) ? 1 : 0);
+    }
+
+  private:
+    static constexpr uint64_t kEmpty = 0;
+    static constexpr uint64_t kTombstone = ~uint64_t(0);
+    static constexpr size_t kMinCapacity = 64;
+
+    struct Table {
+        explicit Table(size_t capacity) : mask(capacity - 1), slots(new std::atomic<uint64_t>[capacity]) {
+            assert((capacity & mask) == 0);
+            for (size_t i = 0; i < capacity; ++i) {
+                slots[i].store(kEmpty, std::memory_order_relaxed);
+            }
+        }
+        const uint64_t mask;
+        const std::unique_ptr<std::atomic<uint64_t>[]> slots;
+    };
+
+    // Handles are often aligned pointers or sequential ids, the low bits used as the first slot need to be mixed
+    static uint64_t Hash(uint64_t handle) {
+        handle ^= handle >> 33;
+        handle *= 0xff51afd7ed558ccdULL;
+        handle ^= handle >> 33;
+        return handle;
+    }
+
+    bool InsertLocked(uint64_t handle) {
+        assert(handle != kEmpty);
+        if (handle == kTombstone) {
+            return !has_tombstone_value_.exchange(true, std::memory_order_release);
+        }
+        Table &table = *current_;
+        std::atomic<uint64_t> *free_slot = nullptr;
+        for (uint64_t i = Hash(handle);; ++i) {
+            auto &slot = table.slots[i & table.mask];
+            const uint64_t value = slot.load(std::memory_order_relaxed);
+            if (value == handle) {
+                return false;
+            }
+            if (value == kTombstone && !free_slot) {
+                free_slot = &slot;
+            } else if (value == kEmpty) {
+                if (!free_slot) {
+                    free_slot = &slot;
+                    ++used_;
+                }
+                break;
+            }
+        }
+        free_slot->store(handle, std::memory_order_release);
+        ++size_;
+        if (2 * used_ > table.mask + 1) {
+            Rebuild();
+        }
+        return true;
+    }
+
+    // Copies the live values to a table that is at most a quarter full, counting |extra| values about to be inserted
+    void Rebuild(size_t extra = 0) {
+        size_t capacity = kMinCapacity;
+        while (capacity < 4 * (size_ + extra)) {
+            capacity *= 2;
+        }
+        auto rebuilt = std::make_shared<Table>(capacity);
+        const Table &table = *current_;
+        for (uint64_t i = 0; size_ != 0 && i <= table.mask; ++i) {
+            const uint64_t value = table.slots[i].load(std::memory_order_relaxed);
+            if (value == kEmpty || value == kTombstone) {
+                continue;
+            }
+            for (uint64_t j = Hash(value);; ++j) {
+                auto &slot = rebuilt->slots[j & rebuilt->mask];
+                if (slot.load(std::memory_order_relaxed) == kEmpty) {
+                    slot.store(value, std::memory_order_relaxed);
+                    break;
+                }
+            }
+        }
+        used_ = size_;
+        table_.store(rebuilt.get(), std::memory_order_release);
+        retired_tables_.Retire(std::move(current_));
+        current_ = std::move(rebuilt);
+    }
+
+    mutable std::mutex lock_;
+    std::shared_ptr<Table> current_;
+    std::atomic<const Table *> table_;
+    EpochRetireList retired_tables_;
+    // The all ones value is the tombstone marker, a handle with that value is tracked on the side
+    std::atomic<bool> has_tombstone_value_{false};
+    size_t size_ = 0;
+    // Live values plus tombstones, the slots that a probe may have to step over
+    size_t used_ = 0;
+};
+
+}  // namespace vvl
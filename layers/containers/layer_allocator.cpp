@@ -0,0 +1,248 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "containers/layer_allocator.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+
+#include "containers/node_pool_allocator.h"
+#include "containers/sharded_counter.h"
+
+#if defined(USE_MIMALLOC)
+#include <mimalloc.h>
+#endif
+
+namespace vvl {
+namespace {
+
+// Put in front of every block, so Free() knows where the block came from and how much to take off the statistics
+struct alignas(std::max_align_t) BlockHeader {
+    uint64_t size;
+    AllocatorKind kind;
+    AllocationSubsystem subsystem;
+};
+
+// Thread arena size classes, the header included
+constexpr size_t kArenaGranule = alignof(std::max_align_t);
+constexpr size_t kArenaClassCount = 16;
+constexpr size_t kArenaMaxBlock = kArenaGranule * kArenaClassCount;
+
+struct ArenaClass {
+    void *(*allocate)();
+    void (*free)(void *);
+};
+
+template <size_t... I>
+constexpr std::array<ArenaClass, sizeof...(I)> MakeArenaClasses(std::index_sequence<I...>) {
+    return {{{&detail::NodePool<(I + 1) * kArenaGranule, alignof(std::max_align_t)>::Allocate,
+              &detail::NodePool<(I + 1) * kArenaGranule, alignof(std::max_align_t)>::Free}...}};
+}
+constexpr auto kArenaClasses = MakeArenaClasses(std::make_index_sequence<kArenaClassCount>());
+
+// The peak is sampled every kPeakSampleInterval allocations of a thread, reading the live bytes adds all their shards up
+constexpr uint32_t kPeakSampleInterval = 256;
+
+struct SubsystemCounters {
+    ShardedCounter<uint64_t> allocations;
+    // Frees add the two's complement, the sum of the shards wraps back to the live count
+    ShardedCounter<uint64_t> live_allocations;
+    ShardedCounter<uint64_t> live_bytes;
+    std::atomic<uint64_t> peak_bytes{0};
+
+    void SamplePeak() {
+        const uint64_t live = live_bytes.Load();
+        uint64_t peak = peak_bytes.load(std::memory_order_relaxed);
+        while (live > peak && !peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        }
+    }
+};
+
+SubsystemCounters &GetCounters(AllocationSubsystem subsystem) {
+    // Intentionally never destroyed, objects with static storage duration can free their memory after it would have been
+    static auto *counters = new std::array<SubsystemCounters, static_cast<size_t>(AllocationSubsystem::Count)>();
+    return (*counters)[static_cast<size_t>(subsystem)];
+}
+
+std::atomic<AllocatorKind> allocator_kind{AllocatorKind::System};
+
+// Periodic report, in steady_clock nanoseconds. The thread that moves next_report_ns forward prints the report
+std::atomic<int64_t> report_period_ns{0};
+std::atomic<int64_t> next_report_ns{0};
+
+void ReportIfDue() {
+    const int64_t period = report_period_ns.load(std::memory_order_relaxed);
+    if (period == 0) {
+        return;
+    }
+    const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now().time_since_epoch())
+                            .count();
+    int64_t next = next_report_ns.load(std::memory_order_relaxed);
+    if (now < next || !next_report_ns.compare_exchange_strong(next, now + period, std::memory_order_relaxed)) {
+        return;
+    }
+    printf("Validation Allocation Statistics\n%s", FormatAllocationStatistics().c_str());
+}
+
+void CountAllocation(size_t size, AllocationSubsystem subsystem) {
+    SubsystemCounters &counters = GetCounters(subsystem);
+    counters.allocations.Add(1);
+    counters.live_allocations.Add(1);
+    counters.live_bytes.Add(size);
+    thread_local uint32_t allocations_since_sample = 0;
+    if (++allocations_since_sample == kPeakSampleInterval) {
+        allocations_since_sample = 0;
+        counters.SamplePeak();
+        ReportIfDue();
+    }
+}
+
+void CountFree(size_t size, AllocationSubsystem subsystem) {
+    SubsystemCounters &counters = GetCounters(subsystem);
+    counters.live_allocations.Add(~uint64_t(0));
+    counters.live_bytes.Add(uint64_t(0) - size);
+}
+
+}  // namespace
+
+bool IsAllocatorAvailable(AllocatorKind kind) {
+#if defined(USE_MIMALLOC)
+    return true;
+#else
+    return kind != AllocatorKind::Mimalloc;
+#endif
+}
+
+void SetAllocatorKind(AllocatorKind kind) {
+    allocator_kind.store(IsAllocatorAvailable(kind) ? kind : AllocatorKind::System, std::memory_order_relaxed);
+}
+
+AllocatorKind GetAllocatorKind() { return allocator_kind.load(std::memory_order_relaxed); }
+
+void *Allocate(size_t size, AllocationSubsystem subsystem) {
+    const size_t block_size = sizeof(BlockHeader) + size;
+    AllocatorKind kind = GetAllocatorKind();
+    if (kind == AllocatorKind::ThreadArena && block_size > kArenaMaxBlock) {
+        kind = AllocatorKind::System;
+    }
+
+    void *block = nullptr;
+    switch (kind) {
+        case AllocatorKind::ThreadArena:
+            block = kArenaClasses[(block_size - 1) / kArenaGranule].allocate();
+            break;
+#if defined(USE_MIMALLOC)
+        case AllocatorKind::Mimalloc:
+            block = mi_malloc(block_size);
+            break;
+#endif
+        default:
+            kind = AllocatorKind::System;
+            block = std::malloc(block_size);
+            break;
+    }
+    if (!block) {
+        throw std::bad_alloc();
+    }
+
+    CountAllocation(size, subsystem);
+    auto *header = new (block) BlockHeader{size, kind, subsystem};
+    return header + 1;
+}
+
+void Free(void *p) noexcept {
+    if (!p) {
+        return;
+    }
+    BlockHeader *header = static_cast<BlockHeader *>(p) - 1;
+    CountFree(header->size, header->subsystem);
+
+    switch (header->kind) {
+        case AllocatorKind::ThreadArena:
+            kArenaClasses[(sizeof(BlockHeader) + header->size - 1) / kArenaGranule].free(header);
+            break;
+#if defined(USE_MIMALLOC)
+        case AllocatorKind::Mimalloc:
+            mi_free(header);
+            break;
+#endif
+        default:
+            std::free(header);
+            break;
+    }
+}
+
+void TrackAllocation(size_t size, AllocationSubsystem subsystem) { CountAllocation(size, subsystem); }
+
+void UntrackAllocation(size_t size, AllocationSubsystem subsystem) { CountFree(size, subsystem); }
+
+AllocationStatistics GetAllocationStatistics(AllocationSubsystem subsystem) {
+    SubsystemCounters &counters = GetCounters(subsystem);
+    counters.SamplePeak();
+    AllocationStatistics statistics;
+    statistics.allocations = counters.allocations.Load();
+    statistics.live_allocations = counters.live_allocations.Load();
+    statistics.live_bytes = counters.live_bytes.Load();
+    statistics.peak_bytes = counters.peak_bytes.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+const char *String(AllocationSubsystem subsystem) {
+    switch (subsystem) {
+        case AllocationSubsystem::Containers:
+            return "Containers";
+        case AllocationSubsystem::StateTracker:
+            return "StateTracker";
+        case AllocationSubsystem::SyncValidation:
+            return "SyncValidation";
+        case AllocationSubsystem::ShaderModules:
+            return "ShaderModules";
+        case AllocationSubsystem::ObjectLifetimes:
+            return "ObjectLifetimes";
+        case AllocationSubsystem::GpuAssisted:
+            return "GpuAssisted";
+        default:
+            return "Unknown";
+    }
+}
+
+std::string FormatAllocationStatistics() {
+    std::string report;
+    for (uint32_t i = 0; i < static_cast<uint32_t>(AllocationSubsystem::Count); ++i) {
+        const auto subsystem = static_cast<AllocationSubsystem>(i);
+        const AllocationStatistics statistics = GetAllocationStatistics(subsystem);
+        char line[256];
+        std::snprintf(line, sizeof(line),
+                      "%s: %" PRIu64 " allocations, %" PRIu64 " bytes live in %" PRIu64 " allocations, %" PRIu64
+                      " bytes peak\n",
+                      String(subsystem), statistics.allocations, statistics.live_bytes, statistics.live_allocations,
+                      statistics.peak_bytes);
+        report += line;
+    }
+    return report;
+}
+
+void SetAllocationReportPeriod(uint32_t seconds) {
+    report_period_ns.store(int64_t(seconds) * 1000000000, std::memory_order_relaxed);
+}
+
+}  // namespace vvl
@@ -0,0 +1,151 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+
+namespace vvl {
+
+// Where the memory of the layer allocator comes from, selected at runtime with the allocator setting
+enum class AllocatorKind : uint32_t {
+    System = 0,
+    // mi_malloc, only available in builds with USE_MIMALLOC
+    Mimalloc,
+    // Small blocks come from per thread free lists of size classes, larger ones from the system
+    ThreadArena,
+};
+
+// The parts of the layer the allocation statistics are kept for
+enum class AllocationSubsystem : uint32_t {
+    Containers = 0,
+    StateTracker,
+    // Access state maps and access logs of synchronization validation
+    SyncValidation,
+    // SPIR-V words and parse of the shader modules
+    ShaderModules,
+    ObjectLifetimes,
+    // Device memory blocks of the VMA allocators of GPU-AV and DebugPrintf
+    GpuAssisted,
+    Count,
+};
+
+struct AllocationStatistics {
+    uint64_t allocations = 0;
+    uint64_t live_allocations = 0;
+    uint64_t live_bytes = 0;
+    uint64_t peak_bytes = 0;
+};
+
+bool IsAllocatorAvailable(AllocatorKind kind);
+// Applies to the allocations made from now on, blocks remember the allocator they came from so they can be freed after a
+// change
+void SetAllocatorKind(AllocatorKind kind);
+AllocatorKind GetAllocatorKind();
+
+// Returned memory is aligned to alignof(std::max_align_t)
+void *Allocate(size_t size, AllocationSubsystem subsystem);
+void Free(void *p) noexcept;
+
+// Counts memory that does not come from vvl::Allocate, each TrackAllocation must be matched by an UntrackAllocation of the
+// same size
+void TrackAllocation(size_t size, AllocationSubsystem subsystem);
+void UntrackAllocation(size_t size, AllocationSubsystem subsystem);
+
+AllocationStatistics GetAllocationStatistics(AllocationSubsystem subsystem);
+const char *String(AllocationSubsystem subsystem);
+// One line per subsystem
+std::string FormatAllocationStatistics();
+// Prints the statistics to stdout at most every |seconds| while the layer allocates, 0 disables the periodic report
+void SetAllocationReportPeriod(uint32_t seconds);
+
+// Stateless allocator going through vvl::Allocate, counted in the statistics of |Subsystem|
+template <typename T, AllocationSubsystem Subsystem>
+class LayerAllocator {
+    static_assert(alignof(T) <= alignof(std::max_align_t), "LayerAllocator does not support over-aligned types");
+
+  public:
+    using value_type = T;
+    template <typename U>
+    struct rebind {
+        using other = LayerAllocator<U, Subsystem>;
+    };
+
+    LayerAllocator() noexcept = default;
+    template <typename U>
+    LayerAllocator(const LayerAllocator<U, Subsystem> &) noexcept {}
+
+    T *allocate(size_t n) { return static_cast<T *>(Allocate(n * sizeof(T), Subsystem)); }
+    void deallocate(T *p, size_t) noexcept { Free(p); }
+
+    template <typename U>
+    bool operator==(const LayerAllocator<U, Subsystem> &) const noexcept {
+        return true;
+    }
+    template <typename U>
+    bool operator!=(const LayerAllocator<U, Subsystem> &) const noexcept {
+        return false;
+    }
+};
+
+// Allocator that counts the memory |Inner| hands out in the statistics of |Subsystem|, for containers that keep their own
+// allocation policy
+template <typename T, AllocationSubsystem Subsystem, typename Inner = std::allocator<T>>
+class TrackedAllocator {
+  public:
+    using value_type = T;
+    template <typename U>
+    struct rebind {
+        using other = TrackedAllocator<U, Subsystem, typename std::allocator_traits<Inner>::template rebind_alloc<U>>;
+    };
+
+    TrackedAllocator() noexcept = default;
+    template <typename U, typename OtherInner>
+    TrackedAllocator(const TrackedAllocator<U, Subsystem, OtherInner> &) noexcept {}
+
+    T *allocate(size_t n) {
+        T *p = Inner().allocate(n);
+        TrackAllocation(n * sizeof(T), Subsystem);
+        return p;
+    }
+    void deallocate(T *p, size_t n) noexcept {
+        UntrackAllocation(n * sizeof(T), Subsystem);
+        Inner().deallocate(p, n);
+    }
+
+    template <typename U, typename OtherInner>
+    bool operator==(const TrackedAllocator<U, Subsystem, OtherInner> &) const noexcept {
+        return true;
+    }
+    template <typename U, typename OtherInner>
+    bool operator!=(const TrackedAllocator<U, Subsystem, OtherInner> &) const noexcept {
+        return false;
+    }
+};
+
+// std::make_shared through the layer allocator, the object and its control block are one allocation of |Subsystem|
+template <typename T, AllocationSubsystem Subsystem, typename... Args>
+std::shared_ptr<T> AllocateShared(Args &&...args) {
+    return std::allocate_shared<T>(LayerAllocator<T, Subsystem>(), std::forward<Args>(args)...);
+}
+
+}  // namespace vvl
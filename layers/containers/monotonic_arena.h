@@ -0,0 +1,152 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace vvl {
+
+// Bump pointer allocator for the many small, same sized allocations of node based containers (ex. range map nodes).
+//
+// Freed memory goes to a free list per size and is handed out again by the next allocation of that size, so an owner
+// that clears and refills its containers (ex. a command buffer that is reset and re-recorded every frame) stops
+// allocating from the system once it has reached its peak size. Blocks are only released when the arena is destroyed.
+// Allocations larger than kMaxRecycledSize are forwarded to operator new.
+//
+// Not thread safe, the owner must serialize access the same way it does for the containers using it.
+class MonotonicArena {
+  public:
+    static constexpr size_t kBlockSize = 64 * 1024;
+    static constexpr size_t kAlignment = alignof(std::max_align_t);
+    static constexpr size_t kMaxRecycledSize = 1024;
+
+    MonotonicArena() = default;
+    MonotonicArena(const MonotonicArena &) = delete;
+    MonotonicArena &operator=(const MonotonicArena &) = delete;
+
+    void *Allocate(size_t size, size_t alignment) {
+        assert(alignment <= kAlignment);
+        (void)alignment;
+        size = RoundUp(size);
+        if (size > kMaxRecycledSize) {
+            return ::operator new(size);
+        }
+        FreeNode *&free_list = free_lists_[Bucket(size)];
+        if (free_list) {
+            FreeNode *node = free_list;
+            free_list = node->next;
+            return node;
+        }
+        if (blocks_.empty() || offset_ + size > kBlockSize) {
+            blocks_.emplace_back(new std::byte[kBlockSize]);
+            offset_ = 0;
+        }
+        void *ptr = blocks_.back().get() + offset_;
+        offset_ += size;
+        return ptr;
+    }
+
+    void Free(void *ptr, size_t size) {
+        size = RoundUp(size);
+        if (size > kMaxRecycledSize) {
+            ::operator delete(ptr);
+            return;
+        }
+        FreeNode *node = static_cast<FreeNode *>(ptr);
+        FreeNode *&free_list = free_lists_[Bucket(size)];
+        node->next = free_list;
+        free_list = node;
+    }
+
+    size_t BlockCount() const { return blocks_.size(); }
+
+  private:
+    struct FreeNode {
+        FreeNode *next;
+    };
+    static constexpr size_t kBucketCount = kMaxRecycledSize / kAlignment;
+    static_assert(sizeof(FreeNode) <= kAlignment, "free list node must fit in the smallest allocation");
+
+    static size_t RoundUp(size_t size) { return size ? (size + kAlignment - 1) & ~(kAlignment - 1) : kAlignment; }
+    static size_t Bucket(size_t rounded_size) { return rounded_size / kAlignment - 1; }
+
+    std::vector<std::unique_ptr<std::byte[]>> blocks_;
+    FreeNode *free_lists_[kBucketCount]{};
+    size_t offset_ = 0;
+};
+
+// Allocator that draws from a MonotonicArena, or from Fallback when constructed without one.
+//
+// The arena is never propagated: a copy of a container gets the Fallback allocator and assigning or moving into a
+// container keeps the allocator of the destination, so a container that outlives the arena cannot end up using it.
+// Move construction is the exception (allocators always move with the container), the moved-to container must not
+// outlive the arena.
+template <typename T, typename Fallback = std::allocator<T>>
+class ArenaAllocator {
+  public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+    template <typename U>
+    struct rebind {
+        using other = ArenaAllocator<U, typename std::allocator_traits<Fallback>::template rebind_alloc<U>>;
+    };
+
+    ArenaAllocator() noexcept = default;
+    explicit ArenaAllocator(MonotonicArena *arena) noexcept : arena_(arena) {}
+    template <typename U, typename OtherFallback>
+    ArenaAllocator(const ArenaAllocator<U, OtherFallback> &other) noexcept : arena_(other.GetArena()) {}
+
+    T *allocate(size_t n) {
+        if (!arena_) {
+            return Fallback().allocate(n);
+        }
+        return static_cast<T *>(arena_->Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *p, size_t n) noexcept {
+        if (!arena_) {
+            Fallback().deallocate(p, n);
+            return;
+        }
+        arena_->Free(p, n * sizeof(T));
+    }
+
+    ArenaAllocator select_on_container_copy_construction() const { return ArenaAllocator(); }
+
+    MonotonicArena *GetArena() const { return arena_; }
+
+    template <typename U, typename OtherFallback>
+    bool operator==(const ArenaAllocator<U, OtherFallback> &other) const noexcept {
+        return arena_ == other.GetArena();
+    }
+    template <typename U, typename OtherFallback>
+    bool operator!=(const ArenaAllocator<U, OtherFallback> &other) const noexcept {
+        return arena_ != other.GetArena();
+    }
+
+  private:
+    MonotonicArena *arena_ = nullptr;
+};
+
+}  // namespace vvl
@@ -0,0 +1,106 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace vvl {
+
+// Bounded queue with any number of producers and a single consumer, where neither side takes a lock.
+//
+// Each slot carries a sequence number that tells whether it is free for the producer claiming position N (sequence == N)
+// or holds the value pushed for position N (sequence == N + 1). Producers claim a position with a CAS on the tail and
+// publish the value with a release store of the sequence; the consumer owns the head and hands the slot back to the
+// producers one lap later.
+template <typename T>
+class MpscRing {
+  public:
+    // The capacity is rounded up to a power of two
+    explicit MpscRing(size_t capacity) {
+        size_t rounded = 2;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        mask_ = rounded - 1;
+        slots_ = std::make_unique<Slot[]>(rounded);
+        for (size_t i = 0; i < rounded; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+    MpscRing(const MpscRing &) = delete;
+    MpscRing &operator=(const MpscRing &) = delete;
+
+    size_t Capacity() const { return mask_ + 1; }
+
+    // Returns false, leaving value untouched, if the ring is full
+    bool TryPush(T &&value) {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        Slot *slot;
+        while (true) {
+            slot = &slots_[pos & mask_];
+            const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // The consumer has not released this slot from the previous lap yet
+                return false;
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+        slot->value = std::move(value);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only
+    bool TryPop(T &value) {
+        Slot &slot = slots_[head_ & mask_];
+        if (slot.sequence.load(std::memory_order_acquire) != head_ + 1) {
+            return false;
+        }
+        value = std::move(slot.value);
+        slot.value = T();
+        slot.sequence.store(head_ + mask_ + 1, std::memory_order_release);
+        ++head_;
+        return true;
+    }
+
+    // Consumer only, a push that is still being published counts as empty
+    bool Empty() const { return slots_[head_ & mask_].sequence.load(std::memory_order_acquire) != head_ + 1; }
+
+  private:
+    struct Slot {
+        std::atomic<size_t> sequence{0};
+        T value{};
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    size_t mask_ = 0;
+    // Keep the producer and consumer cursors on separate cache lines
+    alignas(64) std::atomic<size_t> tail_{0};
+    alignas(64) size_t head_ = 0;
+};
+
+}  // namespace vvl
@@ -0,0 +1,189 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+
+namespace vvl {
+namespace detail {
+
+// Fixed size node storage shared by every NodePoolAllocator instantiation with the same node size and alignment.
+//
+// Nodes are carved out of chunks, and each thread keeps its own free list so allocating and freeing a node is a couple of
+// pointer writes. Nodes freed on another thread than the one that allocated them simply join the free list of the freeing
+// thread. A thread hands its free list back to the shared one when it grows too large or when the thread exits.
+//
+// Chunks are never returned to the system, the pool keeps the peak number of nodes for the lifetime of the process.
+template <size_t Size, size_t Align>
+class NodePool {
+    struct FreeNode {
+        FreeNode *next;
+    };
+    static constexpr size_t kSlotAlign = Align > alignof(FreeNode) ? Align : alignof(FreeNode);
+    static constexpr size_t kSlotSize = ((Size > sizeof(FreeNode) ? Size : sizeof(FreeNode)) + kSlotAlign - 1) / kSlotAlign * kSlotAlign;
+    static_assert(kSlotAlign <= alignof(std::max_align_t), "NodePool does not support over-aligned nodes");
+
+  public:
+    static constexpr size_t kNodesPerChunk = 256;
+    static constexpr size_t kMaxCachedNodes = 4 * kNodesPerChunk;
+
+    static void *Allocate() {
+        NodeList &local = GetLocalCache().free_nodes;
+        if (!local.head) {
+            Refill(local);
+        }
+        return local.Pop();
+    }
+
+    static void Free(void *p) {
+        NodeList &local = GetLocalCache().free_nodes;
+        local.Push(static_cast<FreeNode *>(p));
+        if (local.count > kMaxCachedNodes) {
+            Shared &shared = GetShared();
+            std::lock_guard<std::mutex> guard(shared.lock);
+            shared.free_nodes.Splice(local);
+        }
+    }
+
+  private:
+    struct NodeList {
+        FreeNode *head = nullptr;
+        FreeNode *tail = nullptr;
+        size_t count = 0;
+
+        void Push(FreeNode *node) {
+            node->next = head;
+            head = node;
+            if (!tail) {
+                tail = node;
+            }
+            ++count;
+        }
+        FreeNode *Pop() {
+            FreeNode *node = head;
+            head = node->next;
+            if (!head) {
+                tail = nullptr;
+            }
+            --count;
+            return node;
+        }
+        // Moves every node of |other| to this list
+        void Splice(NodeList &other) {
+            if (!other.head) {
+                return;
+            }
+            other.tail->next = head;
+            if (!tail) {
+                tail = other.tail;
+            }
+            head = other.head;
+            count += other.count;
+            other = NodeList();
+        }
+    };
+
+    struct Shared {
+        std::mutex lock;
+        NodeList free_nodes;
+    };
+
+    struct LocalCache {
+        NodeList free_nodes;
+        ~LocalCache() {
+            Shared &shared = GetShared();
+            std::lock_guard<std::mutex> guard(shared.lock);
+            shared.free_nodes.Splice(free_nodes);
+        }
+    };
+
+    static Shared &GetShared() {
+        // Intentionally never destroyed, containers owned by objects with static storage duration can free their nodes
+        // after it would have been
+        static Shared *shared = new Shared();
+        return *shared;
+    }
+
+    static LocalCache &GetLocalCache() {
+        thread_local LocalCache cache;
+        return cache;
+    }
+
+    static void Refill(NodeList &local) {
+        {
+            Shared &shared = GetShared();
+            std::lock_guard<std::mutex> guard(shared.lock);
+            while (shared.free_nodes.head && local.count < kNodesPerChunk) {
+                local.Push(shared.free_nodes.Pop());
+            }
+        }
+        if (local.head) {
+            return;
+        }
+        auto *chunk = static_cast<std::byte *>(::operator new(kSlotSize * kNodesPerChunk));
+        for (size_t i = 0; i < kNodesPerChunk; ++i) {
+            local.Push(reinterpret_cast<FreeNode *>(chunk + i * kSlotSize));
+        }
+    }
+};
+
+}  // namespace detail
+
+// Stateless allocator for node based containers (std::map, std::set, std::list) that serves single element allocations
+// from a NodePool, which cuts the cost of the malloc/free pair done for every insert/erase and keeps nodes allocated close
+// together in memory. Other allocations fall through to std::allocator.
+//
+// All instances compare equal, so containers using it can be moved and swapped exactly like with std::allocator.
+template <typename T>
+class NodePoolAllocator {
+  public:
+    using value_type = T;
+
+    NodePoolAllocator() noexcept = default;
+    template <typename U>
+    NodePoolAllocator(const NodePoolAllocator<U> &) noexcept {}
+
+    T *allocate(size_t n) {
+        if (n != 1) {
+            return std::allocator<T>().allocate(n);
+        }
+        return static_cast<T *>(detail::NodePool<sizeof(T), alignof(T)>::Allocate());
+    }
+
+    void deallocate(T *p, size_t n) noexcept {
+        if (n != 1) {
+            std::allocator<T>().deallocate(p, n);
+            return;
+        }
+        detail::NodePool<sizeof(T), alignof(T)>::Free(p);
+    }
+
+    template <typename U>
+    bool operator==(const NodePoolAllocator<U> &) const noexcept {
+        return true;
+    }
+    template <typename U>
+    bool operator!=(const NodePoolAllocator<U> &) const noexcept {
+        return false;
+    }
+};
+
+}  // namespace vvl
@@ -17,9 +17,14 @@
  * limitations under the License.
  */
 #pragma once
+#include <algorithm>
+#include <tuple>
+#include <utility>
+#include <vector>
+
 #include "custom_containers.h"
 #include "sync/sync_utils.h"
-#include "utils/hash_util.h"
+#include "utils/cast_utils.h"
 
 // Types to store queue family ownership (QFO) Transfers
 
@@ -44,16 +49,12 @@ struct QFOTransferBarrierBase {
     QFOTransferBarrierBase(const Handle &resource_handle, uint32_t src, uint32_t dst)
         : handle(resource_handle), srcQueueFamilyIndex(src), dstQueueFamilyIndex(dst) {}
 
-    hash_util::HashCombiner base_hash_combiner() const {
-        hash_util::HashCombiner hc;
-        hc << srcQueueFamilyIndex << dstQueueFamilyIndex << handle;
-        return hc;
-    }
-
     bool operator==(const QFOTransferBarrierBase<Handle> &rhs) const {
         return (srcQueueFamilyIndex == rhs.srcQueueFamilyIndex) && (dstQueueFamilyIndex == rhs.dstQueueFamilyIndex) &&
                (handle == rhs.handle);
     }
+    // Ordered by handle first, so the barriers of a resource are next to each other in a QFOTransferBarrierList
+    auto base_tie() const { return std::make_tuple(CastToUint64(handle), srcQueueFamilyIndex, dstQueueFamilyIndex); }
 };
 
 // Image barrier specific implementation
@@ -70,16 +71,19 @@ struct QFOImageTransferBarrier : public QFOTransferBarrierBase<VkImage> {
           oldLayout(barrier.oldLayout),
           newLayout(barrier.newLayout),
           subresourceRange(barrier.subresourceRange) {}
-    size_t hash() const {
-        // Ignoring the layout information for the purpose of the hash, as we're interested in QFO release/acquisition w.r.t.
-        // the subresource affected, an layout transitions are current validated on another path
-        auto hc = base_hash_combiner() << subresourceRange;
-        return hc.Value();
-    }
     bool operator==(const QFOImageTransferBarrier &rhs) const {
-        // Ignoring layout w.r.t. equality. See comment in hash above.
+        // Ignoring the layout information for the purpose of equality and order, as we're interested in QFO
+        // release/acquisition w.r.t. the subresource affected, an layout transitions are current validated on another path
         return (static_cast<BaseType>(*this) == static_cast<BaseType>(rhs)) && (subresourceRange == rhs.subresourceRange);
     }
+    bool operator<(const QFOImageTransferBarrier &rhs) const {
+        const auto tie = [](const QFOImageTransferBarrier &barrier) {
+            const VkImageSubresourceRange &range = barrier.subresourceRange;
+            return std::tuple_cat(barrier.base_tie(), std::make_tuple(range.aspectMask, range.baseMipLevel, range.levelCount,
+                                                                      range.baseArrayLayer, range.layerCount));
+        };
+        return tie(*this) < tie(rhs);
+    }
     // TODO: codegen a comprehensive complie time type -> string (and or other traits) template family
     static const char *BarrierName() { return "VkImageMemoryBarrier"; }
     static const char *HandleName() { return "VkImage"; }
@@ -104,13 +108,13 @@ struct QFOBufferTransferBarrier : public QFOTransferBarrierBase<VkBuffer> {
         : BaseType(barrier.buffer, barrier.srcQueueFamilyIndex, barrier.dstQueueFamilyIndex),
           offset(barrier.offset),
           size(barrier.size) {}
-    size_t hash() const {
-        auto hc = base_hash_combiner() << offset << size;
-        return hc.Value();
-    }
     bool operator==(const QFOBufferTransferBarrier &rhs) const {
         return (static_cast<BaseType>(*this) == static_cast<BaseType>(rhs)) && (offset == rhs.offset) && (size == rhs.size);
     }
+    bool operator<(const QFOBufferTransferBarrier &rhs) const {
+        return std::tuple_cat(base_tie(), std::make_tuple(offset, size)) <
+               std::tuple_cat(rhs.base_tie(), std::make_tuple(rhs.offset, rhs.size));
+    }
     static const char *BarrierName() { return "VkBufferMemoryBarrier"; }
     static const char *HandleName() { return "VkBuffer"; }
     // QFO transfer buffer barrier must not duplicate QFO recorded in command buffer
@@ -123,17 +127,94 @@ struct QFOBufferTransferBarrier : public QFOTransferBarrierBase<VkBuffer> {
     static const char *MissingQFOReleaseInSubmit() { return "UNASSIGNED-VkBufferMemoryBarrier-buffer-00004"; }
 };
 
+// Barriers without duplicates, sorted so the ones of a resource can be looked up and merged together without hashing each of
+// them. New barriers are appended and merged into the sorted part once a few have accumulated, so recording thousands of
+// transfers in any order stays cheap, and Sort() merges the rest when the command buffer is ended.
 template <typename TransferBarrier>
-using QFOTransferBarrierHash = hash_util::HasHashMember<TransferBarrier>;
+class QFOTransferBarrierList {
+  public:
+    using const_iterator = typename std::vector<TransferBarrier>::const_iterator;
+
+    const TransferBarrier *Find(const TransferBarrier &barrier) const {
+        const auto sorted_end = barriers_.begin() + sorted_count_;
+        const auto found = std::lower_bound(barriers_.begin(), sorted_end, barrier);
+        if (found != sorted_end && *found == barrier) {
+            return &(*found);
+        }
+        const auto unsorted = std::find(sorted_end, barriers_.end(), barrier);
+        return unsorted != barriers_.end() ? &(*unsorted) : nullptr;
+    }
 
-// Command buffers store the set of barriers recorded
-template <typename TransferBarrier>
-using QFOTransferBarrierSet = vvl::unordered_set<TransferBarrier, QFOTransferBarrierHash<TransferBarrier>>;
+    // Returns false when the barrier was already in the list
+    bool Insert(const TransferBarrier &barrier) {
+        if (Find(barrier)) {
+            return false;
+        }
+        barriers_.emplace_back(barrier);
+        if (barriers_.size() - sorted_count_ > kMaxUnsorted) {
+            Sort();
+        }
+        return true;
+    }
 
+    bool Erase(const TransferBarrier &barrier) {
+        const TransferBarrier *found = Find(barrier);
+        if (!found) {
+            return false;
+        }
+        const size_t index = static_cast<size_t>(found - barriers_.data());
+        barriers_.erase(barriers_.begin() + index);
+        if (index < sorted_count_) {
+            --sorted_count_;
+        }
+        return true;
+    }
+
+    void Sort() {
+        const auto sorted_end = barriers_.begin() + sorted_count_;
+        std::sort(sorted_end, barriers_.end());
+        std::inplace_merge(barriers_.begin(), sorted_end, barriers_.end());
+        sorted_count_ = barriers_.size();
+    }
+    bool IsSorted() const { return sorted_count_ == barriers_.size(); }
+
+    void clear() {
+        barriers_.clear();
+        sorted_count_ = 0;
+    }
+    bool empty() const { return barriers_.empty(); }
+    size_t size() const { return barriers_.size(); }
+    const_iterator begin() const { return barriers_.begin(); }
+    const_iterator end() const { return barriers_.end(); }
+
+  private:
+    static constexpr size_t kMaxUnsorted = 32;
+    std::vector<TransferBarrier> barriers_;
+    size_t sorted_count_ = 0;
+};
+
+// Calls func(handle, first, last) for each run of barriers of the same resource. The runs of a sorted list are all the barriers
+// of the resource, so anything keyed by resource is looked up once per resource instead of once per barrier.
+template <typename TransferBarrier, typename Func>
+void ForEachQFOTransferHandle(const QFOTransferBarrierList<TransferBarrier> &barriers, Func &&func) {
+    for (auto first = barriers.begin(); first != barriers.end();) {
+        const auto handle = first->handle;
+        const auto last =
+            std::find_if(first, barriers.end(), [handle](const TransferBarrier &barrier) { return barrier.handle != handle; });
+        func(handle, first, last);
+        first = last;
+    }
+}
+
+// Command buffers store the list of barriers recorded
 template <typename TransferBarrier>
 struct QFOTransferBarrierSets {
-    QFOTransferBarrierSet<TransferBarrier> release;
-    QFOTransferBarrierSet<TransferBarrier> acquire;
+    QFOTransferBarrierList<TransferBarrier> release;
+    QFOTransferBarrierList<TransferBarrier> acquire;
+    void Sort() {
+        release.Sort();
+        acquire.Sort();
+    }
     void Reset() {
         acquire.clear();
         release.clear();
@@ -143,12 +224,12 @@ struct QFOTransferBarrierSets {
 // The layer_data stores the map of pending release barriers
 template <typename TransferBarrier>
 using GlobalQFOTransferBarrierMap =
-    vvl::concurrent_unordered_map<typename TransferBarrier::HandleType, QFOTransferBarrierSet<TransferBarrier>>;
+    vvl::concurrent_unordered_map<typename TransferBarrier::HandleType, QFOTransferBarrierList<TransferBarrier>>;
 
-// Submit queue uses the Scoreboard to track all release/acquire operations in a batch.
+// Submit queue uses the Scoreboard to track all release/acquire operations in a batch, sorted like QFOTransferBarrierList with
+// the command buffer that first submitted each barrier. The barriers of each command buffer are merged in with one pass.
 template <typename TransferBarrier>
-using QFOTransferCBScoreboard =
-    vvl::unordered_map<TransferBarrier, const vvl::CommandBuffer *, QFOTransferBarrierHash<TransferBarrier>>;
+using QFOTransferCBScoreboard = std::vector<std::pair<TransferBarrier, const vvl::CommandBuffer *>>;
 
 template <typename TransferBarrier>
 struct QFOTransferCBScoreboards {
@@ -29,6 +29,7 @@
 #include <utility>
 #include <cstdint>
 #include "custom_containers.h"
+#include "node_pool_allocator.h"
 
 #define RANGE_ASSERT(b) assert(b)
 
@@ -746,11 +747,35 @@ class range_map {
     bool empty() const { return impl_map_.empty(); }
     size_type size() const { return impl_map_.size(); }
 
+    range_map() = default;
+    // For an ImplMap using a stateful allocator
+    template <typename Allocator>
+    explicit range_map(const Allocator &allocator) : impl_map_(allocator) {}
+
     // For configuration/debug use // Use with caution...
     ImplMap &get_implementation_map() { return impl_map_; }
     const ImplMap &get_implementation_map() const { return impl_map_; }
 };
 
+// range_map whose std::map nodes come from a vvl::NodePoolAllocator. The algorithms of range_map keep iterators across
+// inserts and erases, so the node based ImplMap is kept and only the allocation of the nodes changes.
+template <typename Key, typename T, typename RangeKey = range<Key>>
+using pooled_range_map =
+    range_map<Key, T, RangeKey, std::map<RangeKey, T, std::less<RangeKey>, vvl::NodePoolAllocator<std::pair<const RangeKey, T>>>>;
+
+// For the large range maps that are updated on hot paths (sync validation access state, global image layouts).
+// The USE_RANGE_MAP_NODE_POOL build option selects the pooled variant for them.
+#ifdef USE_RANGE_MAP_NODE_POOL
+template <typename Value>
+using hot_range_map_allocator = vvl::NodePoolAllocator<Value>;
+#else
+template <typename Value>
+using hot_range_map_allocator = std::allocator<Value>;
+#endif
+template <typename Key, typename T, typename RangeKey = range<Key>>
+using hot_range_map =
+    range_map<Key, T, RangeKey, std::map<RangeKey, T, std::less<RangeKey>, hot_range_map_allocator<std::pair<const RangeKey, T>>>>;
+
 template <typename Container>
 using const_correct_iterator = decltype(std::declval<Container>().begin());
 
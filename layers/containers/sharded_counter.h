@@ -0,0 +1,133 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace vvl {
+
+namespace sharded_counter {
+// Given round robin to each thread when it first uses a sharded counter, the same for all the counters
+inline size_t ThreadIndex() {
+    static std::atomic<size_t> next_index{0};
+    thread_local const size_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+}  // namespace sharded_counter
+
+// Counter for statistics that many threads add to, and that are read much less often than they are updated.
+//
+// The count is split in shards on separate cache lines. Each thread is given its own shard when it first adds to a
+// counter, round robin, so threads recording at the same time do not contend for the cache line of a single atomic.
+// Load() adds all the shards up.
+//
+// NOTE: A Load() or Reset() that runs concurrently with Add() calls may or may not see them, like a relaxed atomic.
+template <typename T, size_t ShardCount = 16>
+class ShardedCounter {
+  public:
+    void Add(T value) { shards_[LocalShardIndex()].count.fetch_add(value, std::memory_order_relaxed); }
+
+    T Load() const {
+        T total = 0;
+        for (const auto &shard : shards_) {
+            total += shard.count.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    void Reset() {
+        for (auto &shard : shards_) {
+            shard.count.store(0, std::memory_order_relaxed);
+        }
+    }
+
+  private:
+    struct alignas(64) Shard {
+        std::atomic<T> count{0};
+    };
+
+    static size_t LocalShardIndex() { return sharded_counter::ThreadIndex() % ShardCount; }
+
+    std::array<Shard, ShardCount> shards_;
+};
+
+// ShardedCounter for a set of counters that are updated together, ex. one per object type. A shard holds all of them, the
+// counters written by one thread share cache lines with each other and not with the ones of other threads.
+// A shard can go below 0 when a thread subtracts what another one added, only the sums are meaningful.
+template <typename T, size_t Count, size_t ShardCount = 16>
+class ShardedCounterArray {
+  public:
+    void Add(size_t index, T value) { shards_[LocalShardIndex()].counts[index].fetch_add(value, std::memory_order_relaxed); }
+    void Subtract(size_t index, T value) {
+        shards_[LocalShardIndex()].counts[index].fetch_sub(value, std::memory_order_relaxed);
+    }
+
+    T Load(size_t index) const {
+        T total = 0;
+        for (const auto &shard : shards_) {
+            total += shard.counts[index].load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    // Sum of all the counters
+    T LoadTotal() const {
+        T total = 0;
+        for (const auto &shard : shards_) {
+            for (const auto &count : shard.counts) {
+                total += count.load(std::memory_order_relaxed);
+            }
+        }
+        return total;
+    }
+
+  private:
+    struct alignas(64) Shard {
+        std::array<std::atomic<T>, Count> counts{};
+    };
+
+    static size_t LocalShardIndex() { return sharded_counter::ThreadIndex() % ShardCount; }
+
+    std::array<Shard, ShardCount> shards_;
+};
+
+// Unique ids for the objects created by many threads. Each thread takes a block of BlockSize ids from the shared atomic and
+// hands them out on its own, so it only writes the shared cache line once per block. The ids of a thread are increasing,
+// across threads they are not in creation order. The generators of a type all share the same ids, 0 is never returned.
+template <typename T, T BlockSize = 256>
+class BlockIdGenerator {
+  public:
+    static T Next() {
+        thread_local T next = 0;
+        thread_local T end = 0;
+        if (next == end) {
+            next = next_block_.fetch_add(BlockSize, std::memory_order_relaxed);
+            end = next + BlockSize;
+            if (next == 0) {
+                ++next;
+            }
+        }
+        return next++;
+    }
+
+  private:
+    static inline std::atomic<T> next_block_{0};
+};
+
+}  // namespace vvl
@@ -0,0 +1,153 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace vvl {
+
+// Maps non-zero 64 bit values to ids that it hands out, where looking up an id is a couple of loads with no hashing and
+// no lock.
+//
+// The id encodes the index of a slot. Slots live in fixed size blocks that are allocated on demand and never moved or
+// freed before the map is destroyed, so readers can use a published block without synchronizing with writers. Slots
+// are recycled after Pop(), and the generation of the slot is part of the id so a stale id does not resolve to the value
+// stored later in the same slot. Only Insert() and Pop() take a lock.
+//
+// Every id has kIdTag set, which lets the ids coexist with the ones of another scheme that keeps that bit clear.
+class SlabIdMap {
+  public:
+    static constexpr uint64_t kIdTag = 1ULL << 63;
+    static constexpr uint32_t kBlockSizeLog2 = 12;
+    static constexpr uint32_t kBlockSize = 1U << kBlockSizeLog2;
+    static constexpr uint32_t kMaxBlocks = 1U << 14;
+    static constexpr uint32_t kMaxSlots = kBlockSize * kMaxBlocks;
+
+    static bool IsSlabId(uint64_t id) { return (id & kIdTag) != 0; }
+
+    SlabIdMap() = default;
+    SlabIdMap(const SlabIdMap &) = delete;
+    SlabIdMap &operator=(const SlabIdMap &) = delete;
+    ~SlabIdMap() {
+        for (auto &block : blocks_) {
+            delete[] block.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Returns 0 if every slot is in use
+    uint64_t Insert(uint64_t value) {
+        std::lock_guard<std::mutex> guard(lock_);
+        return InsertLocked(value);
+    }
+
+    // Inserts values[0, count) under one lock and writes their ids to ids. Returns how many were inserted, which is less
+    // than count only once every slot is in use.
+    uint32_t InsertBatch(const uint64_t *values, uint32_t count, uint64_t *ids) {
+        std::lock_guard<std::mutex> guard(lock_);
+        for (uint32_t i = 0; i < count; ++i) {
+            ids[i] = InsertLocked(values[i]);
+            if (ids[i] == 0) {
+                return i;
+            }
+        }
+        return count;
+    }
+
+    std::optional<uint64_t> Find(uint64_t id) const {
+        const Slot *slot = FindSlot(id);
+        if (!slot) {
+            return {};
+        }
+        // Pop() bumps the generation after clearing the value, so reading in the opposite order never pairs a value with
+        // a generation it was not stored under
+        const uint64_t value = slot->value.load(std::memory_order_acquire);
+        if (value == 0 || slot->generation.load(std::memory_order_acquire) != Generation(id)) {
+            return {};
+        }
+        return value;
+    }
+
+    std::optional<uint64_t> Pop(uint64_t id) {
+        std::lock_guard<std::mutex> guard(lock_);
+        Slot *slot = FindSlot(id);
+        if (!slot || slot->generation.load(std::memory_order_relaxed) != Generation(id)) {
+            return {};
+        }
+        const uint64_t value = slot->value.exchange(0, std::memory_order_acq_rel);
+        if (value == 0) {
+            return {};
+        }
+        slot->generation.store((Generation(id) + 1) & kGenerationMask, std::memory_order_release);
+        free_slots_.push_back(static_cast<uint32_t>(id));
+        return value;
+    }
+
+  private:
+    static constexpr uint32_t kGenerationShift = 32;
+    static constexpr uint32_t kGenerationMask = 0x7fffffff;
+
+    struct Slot {
+        std::atomic<uint64_t> value{0};
+        std::atomic<uint32_t> generation{0};
+    };
+
+    static uint32_t Generation(uint64_t id) { return static_cast<uint32_t>(id >> kGenerationShift) & kGenerationMask; }
+
+    uint64_t InsertLocked(uint64_t value) {
+        uint32_t index;
+        if (!free_slots_.empty()) {
+            index = free_slots_.back();
+            free_slots_.pop_back();
+        } else {
+            if (slot_count_ == kMaxSlots) {
+                return 0;
+            }
+            index = slot_count_++;
+            std::atomic<Slot *> &block = blocks_[index >> kBlockSizeLog2];
+            if (!block.load(std::memory_order_relaxed)) {
+                block.store(new Slot[kBlockSize], std::memory_order_release);
+            }
+        }
+        Slot &slot = blocks_[index >> kBlockSizeLog2].load(std::memory_order_relaxed)[index & (kBlockSize - 1)];
+        slot.value.store(value, std::memory_order_release);
+        return kIdTag | (uint64_t(slot.generation.load(std::memory_order_relaxed)) << kGenerationShift) | index;
+    }
+
+    Slot *FindSlot(uint64_t id) const {
+        if (!IsSlabId(id)) {
+            return nullptr;
+        }
+        const uint32_t index = static_cast<uint32_t>(id);
+        if (index >= kMaxSlots) {
+            return nullptr;
+        }
+        Slot *block = blocks_[index >> kBlockSizeLog2].load(std::memory_order_acquire);
+        return block ? &block[index & (kBlockSize - 1)] : nullptr;
+    }
+
+    std::atomic<Slot *> blocks_[kMaxBlocks]{};
+    std::mutex lock_;
+    std::vector<uint32_t> free_slots_;
+    uint32_t slot_count_ = 0;
+};
+
+}  // namespace vvl
@@ -0,0 +1,261 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+#include "containers/custom_containers.h"
+#include "containers/slab_id_map.h"
+#include "utils/cast_utils.h"
+
+namespace vvl {
+
+// Drop-in replacement for the vvl::concurrent_unordered_map holding the state objects of one handle type, with the same
+// find/pop/insert_or_assign/snapshot interface.
+//
+// Once UseSlabIds() is called, the keys handed out by SlabIdMap (see UniqueIdMapping) are not hashed: the slot index
+// encoded in the id selects the entry of a dense array, so a lookup is a bounds check, a shared lock of one of kLockCount
+// stripes and the shared_ptr copy. The array is split in blocks that are allocated the first time one of their slots is
+// used and never moved, so readers do not synchronize with growth. Keys that are not slab ids (slab full, handle
+// wrapping disabled, dispatchable handles) keep going to the hash map.
+//
+// Slab ids come from a single slab shared by all handle types, so the slots of one map are sparse: a block costs
+// SlabIdMap::kBlockSize * sizeof(Slot) for each map, even with a single live object in it.
+//
+// FindBorrowed() returns the object without copying the pointer. For slab ids it does not lock either: the id and the raw
+// pointer of a slot are read like a seqlock.
+template <typename Key, typename T>
+class SlabStateMap {
+  public:
+    using HashMap = vvl::concurrent_unordered_map<Key, T>;
+    using Element = typename T::element_type;
+
+    class FindResult {
+      public:
+        FindResult() = default;
+        FindResult(Key key, T value) : found_(true), entry_(key, std::move(value)) {}
+        bool operator==(const FindResult &other) const { return found_ == other.found_; }
+        bool operator!=(const FindResult &other) const { return found_ != other.found_; }
+        std::pair<Key, T> *operator->() { return &entry_; }
+        const std::pair<Key, T> *operator->() const { return &entry_; }
+
+      private:
+        bool found_ = false;
+        std::pair<Key, T> entry_{};
+    };
+
+    SlabStateMap() = default;
+    SlabStateMap(const SlabStateMap &) = delete;
+    SlabStateMap &operator=(const SlabStateMap &) = delete;
+    ~SlabStateMap() {
+        if (blocks_) {
+            for (uint32_t i = 0; i < SlabIdMap::kMaxBlocks; ++i) {
+                delete[] blocks_[i].load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Must be called before the first insertion
+    void UseSlabIds() {
+        assert(empty());
+        if (!blocks_) {
+            blocks_ = std::make_unique<std::atomic<Slot *>[]>(SlabIdMap::kMaxBlocks);
+        }
+    }
+
+    void insert_or_assign(const Key &key, T value) {
+        if (Slot *slot = GetSlot(key, true)) {
+            std::unique_lock<std::shared_mutex> guard(SlotLock(key));
+            if (!slot->value) {
+                dense_count_.fetch_add(1, std::memory_order_relaxed);
+            }
+            slot->value = std::move(value);
+            slot->raw.store(slot->value.get(), std::memory_order_relaxed);
+            slot->id.store(CastToUint64(key), std::memory_order_release);
+            return;
+        }
+        hash_map_.insert_or_assign(key, std::move(value));
+    }
+
+    FindResult find(const Key &key) const {
+        if (IsDense(key)) {
+            const Slot *slot = GetSlot(key, false);
+            if (!slot) {
+                return end();
+            }
+            std::shared_lock<std::shared_mutex> guard(SlotLock(key));
+            // Comparing the whole key checks the generation, so a stale id does not find the object now in the slot
+            return (slot->value && slot->id.load(std::memory_order_relaxed) == CastToUint64(key)) ? FindResult(key, slot->value)
+                                                                                                 : end();
+        }
+        const auto iter = hash_map_.find(key);
+        return iter != hash_map_.end() ? FindResult(key, iter->second) : end();
+    }
+
+    // The caller has to keep the object alive some other way, ex. with an EpochGuard entered before the call and the
+    // popped values handed to an EpochRetireList. Keys of the hash map still cost a copy of the value.
+    Element *FindBorrowed(const Key &key) const {
+        if (IsDense(key)) {
+            const Slot *slot = GetSlot(key, false);
+            const uint64_t id = CastToUint64(key);
+            if (!slot || slot->id.load(std::memory_order_acquire) != id) {
+                return nullptr;
+            }
+            Element *raw = slot->raw.load(std::memory_order_relaxed);
+            // Pairs with the fence of ClearSlot(): if raw was changed by a pop, the id read again has changed too
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return slot->id.load(std::memory_order_relaxed) == id ? raw : nullptr;
+        }
+        const auto iter = hash_map_.find(key);
+        return iter != hash_map_.end() ? iter->second.get() : nullptr;
+    }
+
+    FindResult pop(const Key &key) {
+        if (IsDense(key)) {
+            Slot *slot = GetSlot(key, false);
+            if (!slot) {
+                return end();
+            }
+            T value;
+            {
+                std::unique_lock<std::shared_mutex> guard(SlotLock(key));
+                if (!slot->value || slot->id.load(std::memory_order_relaxed) != CastToUint64(key)) {
+                    return end();
+                }
+                value = ClearSlot(*slot);
+                dense_count_.fetch_sub(1, std::memory_order_relaxed);
+            }
+            // The state object is released by the caller, outside of the stripe lock
+            return FindResult(key, std::move(value));
+        }
+        auto iter = hash_map_.pop(key);
+        return iter != hash_map_.end() ? FindResult(key, std::move(iter->second)) : end();
+    }
+
+    void erase(const Key &key) { pop(key); }
+
+    FindResult end() const { return FindResult(); }
+
+    size_t size() const { return dense_count_.load(std::memory_order_relaxed) + hash_map_.size(); }
+    bool empty() const { return size() == 0; }
+
+    void clear() {
+        if (blocks_) {
+            // Values are moved out first, so the state objects are not destroyed with a stripe locked
+            std::vector<T> released;
+            ForEachDenseSlot([&released](Slot &slot) {
+                if (slot.value) {
+                    released.emplace_back(ClearSlot(slot));
+                }
+            });
+            dense_count_.store(0, std::memory_order_relaxed);
+        }
+        hash_map_.clear();
+    }
+
+    std::vector<std::pair<Key, T>> snapshot() const {
+        std::vector<std::pair<Key, T>> entries;
+        entries.reserve(size());
+        if (blocks_) {
+            ForEachDenseSlot([&entries](const Slot &slot) {
+                if (slot.value) {
+                    entries.emplace_back(CastFromUint64<Key>(slot.id.load(std::memory_order_relaxed)), slot.value);
+                }
+            });
+        }
+        for (auto &entry : hash_map_.snapshot()) {
+            entries.emplace_back(entry.first, std::move(entry.second));
+        }
+        return entries;
+    }
+
+  private:
+    static constexpr uint32_t kLockCount = 64;
+
+    // value is guarded by the stripe lock, id and raw are also read without it by FindBorrowed()
+    struct Slot {
+        std::atomic<uint64_t> id{0};
+        std::atomic<Element *> raw{nullptr};
+        T value{};
+    };
+
+    // NOTE: The stripe lock of the slot must be held
+    static T ClearSlot(Slot &slot) {
+        slot.id.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.raw.store(nullptr, std::memory_order_relaxed);
+        T value = std::move(slot.value);
+        slot.value = T();
+        return value;
+    }
+
+    bool IsDense(const Key &key) const { return blocks_ && SlabIdMap::IsSlabId(CastToUint64(key)); }
+
+    static uint32_t SlotIndex(const Key &key) { return static_cast<uint32_t>(CastToUint64(key)); }
+
+    std::shared_mutex &SlotLock(const Key &key) const { return locks_[SlotIndex(key) & (kLockCount - 1)]; }
+
+    // Returns nullptr for keys that go to the hash map, and for slots not allocated yet if allocate is false
+    Slot *GetSlot(const Key &key, bool allocate) const {
+        if (!IsDense(key)) {
+            return nullptr;
+        }
+        const uint32_t index = SlotIndex(key);
+        if (index >= SlabIdMap::kMaxSlots) {
+            return nullptr;
+        }
+        std::atomic<Slot *> &block_ptr = blocks_[index >> SlabIdMap::kBlockSizeLog2];
+        Slot *block = block_ptr.load(std::memory_order_acquire);
+        if (!block && allocate) {
+            Slot *new_block = new Slot[SlabIdMap::kBlockSize];
+            if (block_ptr.compare_exchange_strong(block, new_block, std::memory_order_acq_rel)) {
+                block = new_block;
+            } else {
+                delete[] new_block;
+            }
+        }
+        return block ? &block[index & (SlabIdMap::kBlockSize - 1)] : nullptr;
+    }
+
+    // Each slot is visited with its stripe locked
+    template <typename Fn>
+    void ForEachDenseSlot(Fn &&fn) const {
+        for (uint32_t block_index = 0; block_index < SlabIdMap::kMaxBlocks; ++block_index) {
+            Slot *block = blocks_[block_index].load(std::memory_order_acquire);
+            if (!block) {
+                continue;
+            }
+            for (uint32_t i = 0; i < SlabIdMap::kBlockSize; ++i) {
+                std::unique_lock<std::shared_mutex> guard(locks_[i & (kLockCount - 1)]);
+                fn(block[i]);
+            }
+        }
+    }
+
+    HashMap hash_map_;
+    std::unique_ptr<std::atomic<Slot *>[]> blocks_;
+    mutable std::shared_mutex locks_[kLockCount];
+    std::atomic<size_t> dense_count_{0};
+};
+
+}  // namespace vvl
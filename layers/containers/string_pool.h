@@ -0,0 +1,87 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include "containers/custom_containers.h"
+
+namespace vvl {
+
+// Interns strings into storage that is never moved or freed before the pool itself, so the returned views can be
+// handed out and kept without copying. Equal strings share one copy. Every interned string is followed by a null
+// character, data() of a returned view can be used as a C string.
+//
+// Meant for small sets of long lived strings that are read far more often than added (ex. object debug names), the
+// memory of a string is only released with the pool.
+class StringPool {
+  public:
+    static constexpr size_t kBlockSize = 4 * 1024;
+
+    StringPool() = default;
+    StringPool(const StringPool &) = delete;
+    StringPool &operator=(const StringPool &) = delete;
+
+    // Thread safe
+    std::string_view Intern(std::string_view str) {
+        std::lock_guard<std::mutex> guard(lock_);
+        auto iter = strings_.find(str);
+        if (iter != strings_.end()) {
+            return *iter;
+        }
+        char *storage = AllocateLocked(str.size() + 1);
+        memcpy(storage, str.data(), str.size());
+        storage[str.size()] = '\0';
+        const std::string_view interned(storage, str.size());
+        strings_.insert(interned);
+        return interned;
+    }
+
+    size_t Size() const {
+        std::lock_guard<std::mutex> guard(lock_);
+        return strings_.size();
+    }
+
+  private:
+    char *AllocateLocked(size_t size) {
+        // Long strings get a block of their own, so the current block keeps its free space
+        if (size > kBlockSize / 4) {
+            return large_blocks_.emplace_back(new char[size]).get();
+        }
+        if (blocks_.empty() || offset_ + size > kBlockSize) {
+            blocks_.emplace_back(new char[kBlockSize]);
+            offset_ = 0;
+        }
+        char *ptr = blocks_.back().get() + offset_;
+        offset_ += size;
+        return ptr;
+    }
+
+    mutable std::mutex lock_;
+    vvl::unordered_set<std::string_view> strings_;
+    // The last block is the one being filled
+    std::vector<std::unique_ptr<char[]>> blocks_;
+    std::vector<std::unique_ptr<char[]>> large_blocks_;
+    size_t offset_ = 0;
+};
+
+}  // namespace vvl
@@ -24,6 +24,7 @@
 #include "subresource_adapter.h"
 #include <cmath>
 #include "state_tracker/image_state.h"
+#include "utils/hash_util.h"
 #include "generated/layer_chassis_dispatch.h"
 
 namespace subresource_adapter {
@@ -367,6 +368,49 @@ ImageRangeEncoder::ImageRangeEncoder(const vvl::Image& image, const AspectParame
     }
 }
 
+bool ImageRangeEncoderCache::Key::operator==(const Key& other) const {
+    return format == other.format && image_type == other.image_type && extent.width == other.extent.width &&
+           extent.height == other.extent.height && extent.depth == other.extent.depth && mip_levels == other.mip_levels &&
+           array_layers == other.array_layers && aspect_mask == other.aspect_mask && corner_sampled == other.corner_sampled;
+}
+
+size_t ImageRangeEncoderCache::Key::Hash::operator()(const Key& key) const {
+    hash_util::HashCombiner hc;
+    hc << key.format << key.image_type << key.extent.width << key.extent.height << key.extent.depth << key.mip_levels
+       << key.array_layers << key.aspect_mask << key.corner_sampled;
+    return hc.Value();
+}
+
+std::shared_ptr<const ImageRangeEncoder> ImageRangeEncoderCache::Get(const vvl::Image& image) {
+    const auto& create_info = image.create_info;
+    if (create_info.tiling == VK_IMAGE_TILING_LINEAR) {
+        return std::make_shared<const ImageRangeEncoder>(image);
+    }
+    // Everything the encoder constructor reads from the image
+    const Key key{create_info.format,
+                  create_info.imageType,
+                  create_info.extent,
+                  create_info.mipLevels,
+                  create_info.arrayLayers,
+                  image.full_range.aspectMask,
+                  (create_info.flags & VK_IMAGE_CREATE_CORNER_SAMPLED_BIT_NV) != 0};
+
+    std::lock_guard<std::mutex> guard(lock_);
+    auto& entry = entries_[key];
+    std::shared_ptr<const ImageRangeEncoder> encoder = entry.lock();
+    if (!encoder) {
+        encoder = std::make_shared<const ImageRangeEncoder>(image);
+        entry = encoder;
+        if (entries_.size() >= sweep_size_) {
+            for (auto it = entries_.begin(); it != entries_.end();) {
+                it = it->second.expired() ? entries_.erase(it) : std::next(it);
+            }
+            sweep_size_ = std::max(kMinSweepSize, entries_.size() * 2);
+        }
+    }
+    return encoder;
+}
+
 IndexType ImageRangeEncoder::Encode2D(const VkSubresourceLayout& layout, uint32_t layer, uint32_t aspect_index,
                                       const VkOffset3D& offset) const {
     assert(offset.z == 0U);
@@ -753,6 +797,20 @@ ImageRangeGenerator& ImageRangeGenerator::operator++() {
     return *this;
 }
 
+uint32_t ImageRangeGenerator::NextRanges(IndexRange* ranges, uint32_t max_count) {
+    uint32_t count = 0;
+    for (; pos_.non_empty(); ++(*this)) {
+        if (count > 0 && ranges[count - 1].end == pos_.begin) {
+            ranges[count - 1].end = pos_.end;
+        } else if (count < max_count) {
+            ranges[count++] = pos_;
+        } else {
+            break;
+        }
+    }
+    return count;
+}
+
 template <typename AspectTraits>
 class AspectParametersImpl : public AspectParameters {
   public:
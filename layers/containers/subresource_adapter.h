@@ -22,6 +22,8 @@
 
 #include <algorithm>
 #include <array>
+#include <memory>
+#include <mutex>
 #include <vector>
 #include "range_vector.h"
 #include "custom_containers.h"
@@ -403,6 +405,36 @@ class ImageRangeEncoder : public RangeEncoder {
     bool is_compressed_;
 };
 
+// Shares one ImageRangeEncoder between the images of the same shape (format, type, extent, mip levels, array layers),
+// applications often create many of them. Linear images ask the driver for their subresource layouts, they keep their own
+// encoder. The cache only holds weak references, so an encoder is freed with the last image using it.
+class ImageRangeEncoderCache {
+  public:
+    std::shared_ptr<const ImageRangeEncoder> Get(const vvl::Image& image);
+
+  private:
+    struct Key {
+        VkFormat format;
+        VkImageType image_type;
+        VkExtent3D extent;
+        uint32_t mip_levels;
+        uint32_t array_layers;
+        VkImageAspectFlags aspect_mask;
+        bool corner_sampled;
+
+        bool operator==(const Key& other) const;
+        struct Hash {
+            size_t operator()(const Key& key) const;
+        };
+    };
+    // Expired entries are removed when the map grows past this size
+    static constexpr size_t kMinSweepSize = 64;
+
+    std::mutex lock_;
+    vvl::unordered_map<Key, std::weak_ptr<const ImageRangeEncoder>, Key::Hash> entries_;
+    size_t sweep_size_ = kMinSweepSize;
+};
+
 class ImageRangeGenerator {
   public:
     using RangeType = IndexRange;
@@ -426,6 +458,11 @@ class ImageRangeGenerator {
     ImageRangeGenerator& operator++();
     ImageRangeGenerator& operator=(const ImageRangeGenerator&) = default;
 
+    // Copies the next ranges to |ranges| and advances past them, returns how many were written (0 at the end). A range that
+    // starts where the previous one ends is merged into it, ex. the rows of consecutive layers of a linear image, so the
+    // count can be lower than the number of increments.
+    uint32_t NextRanges(IndexRange* ranges, uint32_t max_count);
+
   private:
     bool Convert2DCompatibleTo3D();
     void SetUpSubresInfo();
@@ -477,10 +514,11 @@ class ImageRangeGenerator {
 // double wrapped map variants.. to avoid needing to templatize on the range map type.  The underlying maps are available for
 // use in performance sensitive places that are *already* templatized (for example update_range_value).
 // In STL style.  Note that N must be < uint8_t max
+// BigMapType allows the large map to use a different range_map implementation (ex. sparse_container::hot_range_map)
 enum BothRangeMapMode { kTristate, kSmall, kBig };
-template <typename T, size_t N>
+template <typename T, size_t N, typename BigMapType = sparse_container::range_map<IndexType, T>>
 class BothRangeMap {
-    using BigMap = sparse_container::range_map<IndexType, T>;
+    using BigMap = BigMapType;
     using RangeType = sparse_container::range<IndexType>;
     using SmallMap = sparse_container::small_range_map<IndexType, T, RangeType, N>;
     using SmallMapIterator = typename SmallMap::iterator;
@@ -748,6 +786,15 @@ class BothRangeMap {
         }
     }
 
+    inline void clear() {
+        if (SmallMode()) {
+            small_map_->clear();
+        } else {
+            assert(BigMode());
+            big_map_->clear();
+        }
+    }
+
     inline size_t size() const {
         if (SmallMode()) {
             return small_map_->size();
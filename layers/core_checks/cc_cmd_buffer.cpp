@@ -353,6 +353,21 @@ bool CoreChecks::PreCallValidateEndCommandBuffer(VkCommandBuffer commandBuffer,
     return skip;
 }
 
+void CoreChecks::PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, const RecordObject &record_obj) {
+    StateTracker::PostCallRecordEndCommandBuffer(commandBuffer, record_obj);
+    auto cb_state_ptr = GetWrite<vvl::CommandBuffer>(commandBuffer);
+    if (!cb_state_ptr || cb_state_ptr->deferred_validations.empty()) {
+        return;
+    }
+    // The recording is done, the validations only read what they captured and the state that does not change until the
+    // command buffer is reset, which waits for them. Without a pool they run here.
+    vvl::CommandBuffer &cb_state = *cb_state_ptr;
+    cb_state.deferred_validation_tasks = std::make_unique<vvl::WorkerPool::TaskGroup>(worker_pool.get());
+    for (const auto &validation : cb_state.deferred_validations) {
+        cb_state.deferred_validation_tasks->Run([this, &validation, &cb_state]() { validation(*this, cb_state); });
+    }
+}
+
 bool CoreChecks::PreCallValidateResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags,
                                                    const ErrorObject &error_obj) const {
     bool skip = false;
@@ -729,25 +744,29 @@ class CoreChecks::ViewportScissorInheritanceTracker {
                     break;
             }
 
-            std::stringstream ss;
-            ss << "(" << validation_.FormatHandle(secondary_state.Handle()).c_str() << ") consume inherited " << state_name << " ";
-            if (format_index) {
-                if (index >= static_use_count) {
-                    ss << "(with count) ";
+            const auto format_message = [&]() {
+                std::stringstream ss;
+                ss << "(" << validation_.FormatHandle(secondary_state.Handle()).c_str() << ") consume inherited " << state_name
+                   << " ";
+                if (format_index) {
+                    if (index >= static_use_count) {
+                        ss << "(with count) ";
+                    }
+                    ss << index << " ";
                 }
-                ss << index << " ";
-            }
-            ss << "but this state ";
-            if (!was_ever_defined) {
-                ss << "was never defined.";
-            } else if (trashed_by == kTrashedByPrimary) {
-                ss << "was left undefined after vkCmdExecuteCommands or vkCmdBindPipeline (with non-dynamic state) in "
-                      "the calling primary command buffer.";
-            } else {
-                ss << "was left undefined after vkCmdBindPipeline (with non-dynamic state) in pCommandBuffers[" << trashed_by
-                   << "].";
-            }
-            return validation_.LogError("VUID-vkCmdDraw-None-07850", primary_state_->Handle(), cb_loc, "%s", ss.str().c_str());
+                ss << "but this state ";
+                if (!was_ever_defined) {
+                    ss << "was never defined.";
+                } else if (trashed_by == kTrashedByPrimary) {
+                    ss << "was left undefined after vkCmdExecuteCommands or vkCmdBindPipeline (with non-dynamic state) in "
+                          "the calling primary command buffer.";
+                } else {
+                    ss << "was left undefined after vkCmdBindPipeline (with non-dynamic state) in pCommandBuffers[" << trashed_by
+                       << "].";
+                }
+                return ss.str();
+            };
+            return validation_.LogError("VUID-vkCmdDraw-None-07850", primary_state_->Handle(), cb_loc, format_message);
         };
 
         // Check if secondary command buffer uses viewport/scissor-with-count state, and validate this state if so.
@@ -37,6 +37,9 @@ bool CoreChecks::ValidateDynamicStateIsSet(const CBDynamicFlags& state_status_cb
     return false;
 }
 
+static constexpr ExtensionBits kLineRasterizationExtensions =
+    MakeExtensionBits({vvl::Extension::_VK_EXT_line_rasterization, vvl::Extension::_VK_KHR_line_rasterization});
+
 // Makes sure the vkCmdSet* call was called correctly prior to a draw
 bool CoreChecks::ValidateGraphicsDynamicStateSetStatus(const LastBound& last_bound_state, const Location& loc) const {
     bool skip = false;
@@ -59,6 +62,12 @@ bool CoreChecks::ValidateGraphicsDynamicStateSetStatus(const LastBound& last_bou
     // build the mask of what has been set in the Pipeline, but yet to be set in the Command Buffer
     const CBDynamicFlags state_status_cb = ~((cb_state.dynamic_state_status.cb ^ pipeline.dynamic_state) & pipeline.dynamic_state);
 
+    // Everything below only reports dynamic state the pipeline needs but the command buffer never set. In the common case
+    // all of it was set and a single compare of the masks replaces the per state checks.
+    if (state_status_cb.all()) {
+        return skip;
+    }
+
     // VK_EXT_extended_dynamic_state
     {
         skip |= ValidateDynamicStateIsSet(state_status_cb, CB_DYNAMIC_STATE_CULL_MODE, objlist, loc, vuid.dynamic_cull_mode_07840);
@@ -1376,8 +1385,7 @@ bool CoreChecks::ValidateDrawDynamicStateShaderObject(const LastBound& last_boun
             skip |= ValidateDynamicStateIsSet(cb_state.dynamic_state_status.cb, CB_DYNAMIC_STATE_STENCIL_REFERENCE, objlist, loc,
                                               vuid.set_stencil_reference_08625);
         }
-        const bool line_rasterization_extension =
-            IsExtEnabled(device_extensions.vk_ext_line_rasterization) || IsExtEnabled(device_extensions.vk_khr_line_rasterization);
+        const bool line_rasterization_extension = device_extensions.IsAnyExtEnabled(kLineRasterizationExtensions);
         if (line_rasterization_extension && !cb_state.dynamic_state_value.rasterizer_discard_enable) {
             if (cb_state.dynamic_state_value.polygon_mode == VK_POLYGON_MODE_LINE) {
                 skip |= ValidateDynamicStateIsSet(cb_state.dynamic_state_status.cb, CB_DYNAMIC_STATE_LINE_RASTERIZATION_MODE_EXT,
@@ -20,6 +20,7 @@
 #include <string>
 #include <sstream>
 #include <vector>
+#include <algorithm>
 
 #include "core_validation.h"
 #include "cc_vuid_maps.h"
@@ -29,6 +30,7 @@
 #include "state_tracker/image_state.h"
 #include "state_tracker/buffer_state.h"
 #include "state_tracker/device_state.h"
+#include "utils/hash_util.h"
 
 struct ImageRegionIntersection {
     VkImageSubresourceLayers subresource = {};
@@ -679,6 +681,53 @@ bool CoreChecks::ValidateBufferImageCopyData(const vvl::CommandBuffer &cb_state,
     return skip;
 }
 
+// Returns the first of the first search_count regions whose source range overlaps the destination range of any region in
+// memory, or region_count if there is none. Non sparse buffers are bound to a single range of a single memory, so the regions
+// are compared in memory space against the destination ranges sorted once, rather than comparing every pair of regions.
+template <typename RegionType>
+static uint32_t FindFirstOverlappingCopyRegion(const vvl::Buffer &src_buffer_state, const vvl::Buffer &dst_buffer_state,
+                                               uint32_t search_count, uint32_t region_count, const RegionType *regions) {
+    using MemoryRange = sparse_container::range<VkDeviceSize>;
+    const MEM_BINDING *src_binding = src_buffer_state.Binding();
+    const MEM_BINDING *dst_binding = dst_buffer_state.Binding();
+    if (!src_binding || !dst_binding || src_binding->memory_state->VkHandle() != dst_binding->memory_state->VkHandle()) {
+        return region_count;
+    }
+
+    std::vector<MemoryRange> dst_ranges(region_count);
+    for (uint32_t i = 0; i < region_count; i++) {
+        const VkDeviceSize begin = dst_binding->memory_offset + regions[i].dstOffset;
+        dst_ranges[i] = MemoryRange(begin, begin + regions[i].size);
+    }
+    std::sort(dst_ranges.begin(), dst_ranges.end(),
+              [](const MemoryRange &a, const MemoryRange &b) { return a.begin < b.begin; });
+    // The furthest end of the destination ranges up to each one, to find the ranges that start before a source range
+    std::vector<VkDeviceSize> max_ends(region_count);
+    VkDeviceSize max_end = 0;
+    for (uint32_t i = 0; i < region_count; i++) {
+        max_end = std::max(max_end, dst_ranges[i].end);
+        max_ends[i] = max_end;
+    }
+
+    for (uint32_t i = 0; i < search_count; i++) {
+        const VkDeviceSize begin = src_binding->memory_offset + regions[i].srcOffset;
+        const MemoryRange src_range(begin, begin + regions[i].size);
+        // Same test as range::intersects, either a destination range starts within the source range...
+        auto it = std::lower_bound(dst_ranges.begin(), dst_ranges.end(), src_range.begin,
+                                   [](const MemoryRange &range, VkDeviceSize value) { return range.begin < value; });
+        if (it != dst_ranges.end() && it->begin < src_range.end) {
+            return i;
+        }
+        // ...or the source range starts within a destination range that starts at or before it
+        it = std::upper_bound(dst_ranges.begin(), dst_ranges.end(), src_range.begin,
+                              [](VkDeviceSize value, const MemoryRange &range) { return value < range.begin; });
+        if (it != dst_ranges.begin() && max_ends[std::distance(dst_ranges.begin(), it) - 1] > src_range.begin) {
+            return i;
+        }
+    }
+    return region_count;
+}
+
 template <typename RegionType>
 bool CoreChecks::ValidateCmdCopyBufferBounds(VkCommandBuffer cb, const vvl::Buffer &src_buffer_state,
                                              const vvl::Buffer &dst_buffer_state, uint32_t regionCount, const RegionType *pRegions,
@@ -693,6 +742,7 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(VkCommandBuffer cb, const vvl::Buff
 
     const LogObjectList src_objlist(cb, dst_buffer_state.Handle());
     const LogObjectList dst_objlist(cb, dst_buffer_state.Handle());
+    uint32_t first_error_region = regionCount;
     for (uint32_t i = 0; i < regionCount; i++) {
         const Location region_loc = loc.dot(Field::pRegions, i);
         const RegionType region = pRegions[i];
@@ -731,8 +781,19 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(VkCommandBuffer cb, const vvl::Buff
                              region.size, dst_buffer_size, region.dstOffset);
         }
 
-        // The union of the source regions, and the union of the destination regions, must not overlap in memory
-        if (!skip && !are_buffers_sparse) {
+        if (skip && first_error_region == regionCount) {
+            first_error_region = i;
+        }
+    }
+
+    // The union of the source regions, and the union of the destination regions, must not overlap in memory.
+    // The overlaps of the first overlapping source region are reported, unless a region before it already had an error.
+    if (!are_buffers_sparse) {
+        const uint32_t overlap_region =
+            FindFirstOverlappingCopyRegion(src_buffer_state, dst_buffer_state, first_error_region, regionCount, pRegions);
+        if (overlap_region < first_error_region) {
+            const RegionType &region = pRegions[overlap_region];
+            const Location region_loc = loc.dot(Field::pRegions, overlap_region);
             auto src_region = sparse_container::range<VkDeviceSize>{region.srcOffset, region.srcOffset + region.size};
             for (uint32_t j = 0; j < regionCount; j++) {
                 auto dst_region =
@@ -748,45 +809,62 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(VkCommandBuffer cb, const vvl::Buff
 
     return skip;
 }
+
+// Only reads the parameters and the state of the buffers that does not change once they are bound, so it can run after
+// vkEndCommandBuffer with the deferred_command_validation setting
 template <typename RegionType>
-bool CoreChecks::ValidateCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount,
-                                       const RegionType *pRegions, const Location &loc) const {
+bool CoreChecks::ValidateCmdCopyBufferResources(const vvl::CommandBuffer &cb_state, const vvl::Buffer &src_buffer_state,
+                                                const vvl::Buffer &dst_buffer_state, uint32_t regionCount,
+                                                const RegionType *pRegions, const Location &loc) const {
     bool skip = false;
-    auto cb_state_ptr = GetRead<vvl::CommandBuffer>(commandBuffer);
-    auto src_buffer_state = Get<vvl::Buffer>(srcBuffer);
-    auto dst_buffer_state = Get<vvl::Buffer>(dstBuffer);
-    if (!cb_state_ptr || !src_buffer_state || !dst_buffer_state) {
-        return skip;
-    }
-    const vvl::CommandBuffer &cb_state = *cb_state_ptr;
-
+    const VkCommandBuffer commandBuffer = cb_state.VkHandle();
     const bool is_2 = loc.function == Func::vkCmdCopyBuffer2 || loc.function == Func::vkCmdCopyBuffer2KHR;
     const char *vuid;
     const Location src_buffer_loc = loc.dot(Field::srcBuffer);
     const Location dst_buffer_loc = loc.dot(Field::dstBuffer);
 
     vuid = is_2 ? "VUID-VkCopyBufferInfo2-srcBuffer-00119" : "VUID-vkCmdCopyBuffer-srcBuffer-00119";
-    skip |= ValidateMemoryIsBoundToBuffer(commandBuffer, *src_buffer_state, src_buffer_loc, vuid);
+    skip |= ValidateMemoryIsBoundToBuffer(commandBuffer, src_buffer_state, src_buffer_loc, vuid);
     vuid = is_2 ? "VUID-VkCopyBufferInfo2-dstBuffer-00121" : "VUID-vkCmdCopyBuffer-dstBuffer-00121";
-    skip |= ValidateMemoryIsBoundToBuffer(commandBuffer, *dst_buffer_state, dst_buffer_loc, vuid);
+    skip |= ValidateMemoryIsBoundToBuffer(commandBuffer, dst_buffer_state, dst_buffer_loc, vuid);
 
     // Validate that SRC & DST buffers have correct usage flags set
     vuid = is_2 ? "VUID-VkCopyBufferInfo2-srcBuffer-00118" : "VUID-vkCmdCopyBuffer-srcBuffer-00118";
-    skip |= ValidateBufferUsageFlags(LogObjectList(commandBuffer, srcBuffer), *src_buffer_state, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                                     true, vuid, src_buffer_loc);
+    skip |= ValidateBufferUsageFlags(LogObjectList(commandBuffer, src_buffer_state.Handle()), src_buffer_state,
+                                     VK_BUFFER_USAGE_TRANSFER_SRC_BIT, true, vuid, src_buffer_loc);
     vuid = is_2 ? "VUID-VkCopyBufferInfo2-dstBuffer-00120" : "VUID-vkCmdCopyBuffer-dstBuffer-00120";
-    skip |= ValidateBufferUsageFlags(LogObjectList(commandBuffer, dstBuffer), *dst_buffer_state, VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-                                     true, vuid, dst_buffer_loc);
+    skip |= ValidateBufferUsageFlags(LogObjectList(commandBuffer, dst_buffer_state.Handle()), dst_buffer_state,
+                                     VK_BUFFER_USAGE_TRANSFER_DST_BIT, true, vuid, dst_buffer_loc);
 
-    skip |= ValidateCmd(cb_state, loc);
-    skip |= ValidateCmdCopyBufferBounds(commandBuffer, *src_buffer_state, *dst_buffer_state, regionCount, pRegions, loc);
+    skip |= ValidateCmdCopyBufferBounds(commandBuffer, src_buffer_state, dst_buffer_state, regionCount, pRegions, loc);
 
     vuid = is_2 ? "VUID-vkCmdCopyBuffer2-commandBuffer-01822" : "VUID-vkCmdCopyBuffer-commandBuffer-01822";
-    skip |= ValidateProtectedBuffer(cb_state, *src_buffer_state, src_buffer_loc, vuid);
+    skip |= ValidateProtectedBuffer(cb_state, src_buffer_state, src_buffer_loc, vuid);
     vuid = is_2 ? "VUID-vkCmdCopyBuffer2-commandBuffer-01823" : "VUID-vkCmdCopyBuffer-commandBuffer-01823";
-    skip |= ValidateProtectedBuffer(cb_state, *dst_buffer_state, dst_buffer_loc, vuid);
+    skip |= ValidateProtectedBuffer(cb_state, dst_buffer_state, dst_buffer_loc, vuid);
     vuid = is_2 ? "VUID-vkCmdCopyBuffer2-commandBuffer-01824" : "VUID-vkCmdCopyBuffer-commandBuffer-01824";
-    skip |= ValidateUnprotectedBuffer(cb_state, *dst_buffer_state, dst_buffer_loc, vuid);
+    skip |= ValidateUnprotectedBuffer(cb_state, dst_buffer_state, dst_buffer_loc, vuid);
+
+    return skip;
+}
+
+template <typename RegionType>
+bool CoreChecks::ValidateCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount,
+                                       const RegionType *pRegions, const Location &loc) const {
+    bool skip = false;
+    auto cb_state_ptr = GetRead<vvl::CommandBuffer>(commandBuffer);
+    auto src_buffer_state = Get<vvl::Buffer>(srcBuffer);
+    auto dst_buffer_state = Get<vvl::Buffer>(dstBuffer);
+    if (!cb_state_ptr || !src_buffer_state || !dst_buffer_state) {
+        return skip;
+    }
+    const vvl::CommandBuffer &cb_state = *cb_state_ptr;
+
+    skip |= ValidateCmd(cb_state, loc);
+    // Otherwise the record time copies the parameters and DeferCmdCopyBufferResources checks them later
+    if (!enabled[deferred_command_validation]) {
+        skip |= ValidateCmdCopyBufferResources(cb_state, *src_buffer_state, *dst_buffer_state, regionCount, pRegions, loc);
+    }
 
     return skip;
 }
@@ -1873,10 +1951,30 @@ void CoreChecks::RecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer src
     }
 }
 
+template <typename RegionType>
+void CoreChecks::DeferCmdCopyBufferResources(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
+                                             uint32_t regionCount, const RegionType *pRegions, const Location &loc) {
+    if (!enabled[deferred_command_validation]) return;
+    auto cb_state_ptr = Get<vvl::CommandBuffer>(commandBuffer);
+    auto src_buffer_state = Get<vvl::Buffer>(srcBuffer);
+    auto dst_buffer_state = Get<vvl::Buffer>(dstBuffer);
+    if (!cb_state_ptr || !src_buffer_state || !dst_buffer_state) return;
+
+    // The regions and the location point to application and stack memory that is gone once the command returns
+    std::vector<RegionType> regions(pRegions, pRegions + regionCount);
+    cb_state_ptr->deferred_validations.emplace_back(
+        [this, src_buffer_state, dst_buffer_state, regions = std::move(regions), loc_capture = vvl::LocationCapture(loc)](
+            const ValidationStateTracker &, const vvl::CommandBuffer &cb_state) {
+            return ValidateCmdCopyBufferResources(cb_state, *src_buffer_state, *dst_buffer_state,
+                                                  static_cast<uint32_t>(regions.size()), regions.data(), loc_capture.Get());
+        });
+}
+
 void CoreChecks::PreCallRecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
                                             uint32_t regionCount, const VkBufferCopy *pRegions, const RecordObject &record_obj) {
     const Location loc(Func::vkCmdCopyBuffer);
     RecordCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions, loc);
+    DeferCmdCopyBufferResources(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions, record_obj.location);
 }
 
 void CoreChecks::PreCallRecordCmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2KHR *pCopyBufferInfo,
@@ -1884,6 +1982,9 @@ void CoreChecks::PreCallRecordCmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, c
     const Location loc(Func::vkCmdCopyBuffer2KHR);
     RecordCmdCopyBuffer(commandBuffer, pCopyBufferInfo->srcBuffer, pCopyBufferInfo->dstBuffer, pCopyBufferInfo->regionCount,
                         pCopyBufferInfo->pRegions, loc);
+    DeferCmdCopyBufferResources(commandBuffer, pCopyBufferInfo->srcBuffer, pCopyBufferInfo->dstBuffer,
+                                pCopyBufferInfo->regionCount, pCopyBufferInfo->pRegions,
+                                record_obj.location.dot(Field::pCopyBufferInfo));
 }
 
 void CoreChecks::PreCallRecordCmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2 *pCopyBufferInfo,
@@ -1891,6 +1992,9 @@ void CoreChecks::PreCallRecordCmdCopyBuffer2(VkCommandBuffer commandBuffer, cons
     const Location loc(Func::vkCmdCopyBuffer2);
     RecordCmdCopyBuffer(commandBuffer, pCopyBufferInfo->srcBuffer, pCopyBufferInfo->dstBuffer, pCopyBufferInfo->regionCount,
                         pCopyBufferInfo->pRegions, loc);
+    DeferCmdCopyBufferResources(commandBuffer, pCopyBufferInfo->srcBuffer, pCopyBufferInfo->dstBuffer,
+                                pCopyBufferInfo->regionCount, pCopyBufferInfo->pRegions,
+                                record_obj.location.dot(Field::pCopyBufferInfo));
 }
 
 template <typename T>
@@ -2413,6 +2517,38 @@ bool CoreChecks::UsageHostTransferCheck(const vvl::Image &image_state, bool has_
     return skip;
 }
 
+// Streaming host image copies often split a single subresource into many regions. All regions of a call expect the same
+// layout, so the current layout only needs to be checked for the first region naming each distinct subresource.
+class DistinctSubresourceLayers {
+  public:
+    explicit DistinctSubresourceLayers(uint32_t region_count) { seen_.reserve(region_count); }
+
+    // Returns false if the same subresource layers were already inserted
+    bool Insert(const VkImageSubresourceLayers &layers) {
+        return seen_.insert(Key{layers.aspectMask, layers.mipLevel, layers.baseArrayLayer, layers.layerCount}).second;
+    }
+
+  private:
+    struct Key {
+        VkImageAspectFlags aspect_mask;
+        uint32_t mip_level;
+        uint32_t base_array_layer;
+        uint32_t layer_count;
+        bool operator==(const Key &rhs) const {
+            return aspect_mask == rhs.aspect_mask && mip_level == rhs.mip_level && base_array_layer == rhs.base_array_layer &&
+                   layer_count == rhs.layer_count;
+        }
+    };
+    struct KeyHash {
+        size_t operator()(const Key &key) const {
+            hash_util::HashCombiner hc;
+            hc << key.aspect_mask << key.mip_level << key.base_array_layer << key.layer_count;
+            return hc.Value();
+        }
+    };
+    vvl::unordered_set<Key, KeyHash> seen_;
+};
+
 template <typename T>
 VkImageLayout GetImageLayout(T data) {
     return VK_IMAGE_LAYOUT_UNDEFINED;
@@ -2488,6 +2624,7 @@ bool CoreChecks::ValidateMemoryImageCopyCommon(InfoPointer info_ptr, const Locat
     bool check_memcpy = (info_ptr->flags & VK_HOST_IMAGE_COPY_MEMCPY_EXT);
     bool has_stencil = false;
     bool has_non_stencil = false;
+    DistinctSubresourceLayers layout_checked_subresources(regionCount);
     for (uint32_t i = 0; i < regionCount; i++) {
         const Location region_loc = loc.dot(Field::pRegions, i);
         const Location subresource_loc = region_loc.dot(Field::imageSubresource);
@@ -2532,9 +2669,11 @@ bool CoreChecks::ValidateMemoryImageCopyCommon(InfoPointer info_ptr, const Locat
             }
         }
 
-        Field field = from_image ? Field::srcImageLayout : Field::dstImageLayout;
-        skip |= ValidateHostCopyCurrentLayout(image_layout, region.imageSubresource, i, *image_state, region_loc.dot(field),
-                                              source_or_destination, image_layout_vuid);
+        if (layout_checked_subresources.Insert(region.imageSubresource)) {
+            Field field = from_image ? Field::srcImageLayout : Field::dstImageLayout;
+            skip |= ValidateHostCopyCurrentLayout(image_layout, region.imageSubresource, i, *image_state, region_loc.dot(field),
+                                                  source_or_destination, image_layout_vuid);
+        }
     }
 
     const char *vuid_09111 =
@@ -2548,11 +2687,9 @@ bool CoreChecks::ValidateMemoryImageCopyCommon(InfoPointer info_ptr, const Locat
     const auto &memory_states = image_state->GetBoundMemoryStates();
     for (const auto &state : memory_states) {
         // Image and host memory can't overlap unless the image memory is mapped
-        if (state->mapped_range.size != 0) {
-            const uint64_t mapped_size = (state->mapped_range.size == VK_WHOLE_SIZE)
-                                             ? state->allocate_info.allocationSize
-                                             : (state->mapped_range.offset + state->mapped_range.size);
-            const void *mapped_end = static_cast<char *>(state->p_driver_data) + mapped_size;
+        const vvl::DeviceMemory::MappedRange mapped = state->GetMappedRange();
+        if (mapped.IsMapped()) {
+            const void *mapped_end = static_cast<char *>(state->p_driver_data) + mapped.end;
             for (uint32_t i = 0; i < regionCount; i++) {
                 const auto region = info_ptr->pRegions[i];
                 auto element_size = vkuFormatElementSize(image_state->create_info.format);
@@ -2784,6 +2921,8 @@ bool CoreChecks::PreCallValidateCopyImageToImageEXT(VkDevice device, const VkCop
 
     bool has_stencil = false;
     bool has_non_stencil = false;
+    DistinctSubresourceLayers layout_checked_src_subresources(regionCount);
+    DistinctSubresourceLayers layout_checked_dst_subresources(regionCount);
     for (uint32_t i = 0; i < regionCount; i++) {
         const Location region_loc = loc.dot(Field::pRegions, i);
         const auto &region = info_ptr->pRegions[i];
@@ -2803,12 +2942,16 @@ bool CoreChecks::PreCallValidateCopyImageToImageEXT(VkDevice device, const VkCop
             has_non_stencil = true;
         }
 
-        skip |= ValidateHostCopyCurrentLayout(info_ptr->srcImageLayout, region.srcSubresource, i, *src_image_state,
-                                              region_loc.dot(Field::srcImageLayout), "source",
-                                              "VUID-VkCopyImageToImageInfoEXT-srcImageLayout-09070");
-        skip |= ValidateHostCopyCurrentLayout(info_ptr->dstImageLayout, region.dstSubresource, i, *dst_image_state,
-                                              region_loc.dot(Field::dstImageLayout), "destination",
-                                              "VUID-VkCopyImageToImageInfoEXT-dstImageLayout-09071");
+        if (layout_checked_src_subresources.Insert(region.srcSubresource)) {
+            skip |= ValidateHostCopyCurrentLayout(info_ptr->srcImageLayout, region.srcSubresource, i, *src_image_state,
+                                                  region_loc.dot(Field::srcImageLayout), "source",
+                                                  "VUID-VkCopyImageToImageInfoEXT-srcImageLayout-09070");
+        }
+        if (layout_checked_dst_subresources.Insert(region.dstSubresource)) {
+            skip |= ValidateHostCopyCurrentLayout(info_ptr->dstImageLayout, region.dstSubresource, i, *dst_image_state,
+                                                  region_loc.dot(Field::dstImageLayout), "destination",
+                                                  "VUID-VkCopyImageToImageInfoEXT-dstImageLayout-09071");
+        }
     }
 
     skip |= UsageHostTransferCheck(*src_image_state, has_stencil, has_non_stencil, "VUID-VkCopyImageToImageInfoEXT-srcImage-09111",
@@ -211,7 +211,7 @@ bool CoreChecks::ValidateCmdBindDescriptorSets(const vvl::CommandBuffer &cb_stat
     bool skip = false;
     const bool is_2 = loc.function != Func::vkCmdBindDescriptorSets;
 
-    auto pipeline_layout = Get<vvl::PipelineLayout>(layout);
+    auto pipeline_layout = GetBorrowed<vvl::PipelineLayout>(layout);
     if (!pipeline_layout) return skip;  // dynamicPipelineLayout feature
 
     // Track total count of dynamic descriptor types to make sure we have an offset for each one
@@ -219,7 +219,7 @@ bool CoreChecks::ValidateCmdBindDescriptorSets(const vvl::CommandBuffer &cb_stat
 
     for (uint32_t set_idx = 0; set_idx < setCount; set_idx++) {
         const Location set_loc = loc.dot(Field::pDescriptorSets, set_idx);
-        if (auto descriptor_set = Get<vvl::DescriptorSet>(pDescriptorSets[set_idx])) {
+        if (auto descriptor_set = GetBorrowed<vvl::DescriptorSet>(pDescriptorSets[set_idx])) {
             // Verify that set being bound is compatible with overlapping setLayout of pipelineLayout
             std::string error_string = "";
             if (!VerifySetLayoutCompatibility(*descriptor_set, pipeline_layout->set_layouts, pipeline_layout->Handle(),
@@ -917,11 +917,11 @@ bool CoreChecks::VerifyUpdateConsistency(const DescriptorSet &set, uint32_t bind
 }
 
 // Validate Copy update
-bool CoreChecks::ValidateCopyUpdate(const VkCopyDescriptorSet &update, const Location &copy_loc) const {
+bool CoreChecks::ValidateCopyUpdate(const VkCopyDescriptorSet &update, const DescriptorSet &src_set_state,
+                                    const DescriptorSet &dst_set_state, const Location &copy_loc) const {
     bool skip = false;
-    const auto src_set = Get<vvl::DescriptorSet>(update.srcSet);
-    const auto dst_set = Get<vvl::DescriptorSet>(update.dstSet);
-    if (!src_set || !dst_set) return skip;
+    const DescriptorSet *src_set = &src_set_state;
+    const DescriptorSet *dst_set = &dst_set_state;
 
     const auto *dst_layout = dst_set->GetLayout().get();
     const auto *src_layout = src_set->GetLayout().get();
@@ -1377,6 +1377,34 @@ bool CoreChecks::ValidateImageUpdate(const vvl::ImageView &view_state, VkImageLa
     return skip;
 }
 
+// The descriptor sets of one vkUpdateDescriptorSets call. Large calls mostly write many bindings of the same few sets, the
+// last two sets looked up are kept so consecutive writes to a set, or copies between two sets, find its state once. The
+// guard keeps every set that was found alive until the end of the call.
+class UpdatedDescriptorSets {
+  public:
+    explicit UpdatedDescriptorSets(const CoreChecks &core) : core_(core) {}
+
+    const vvl::DescriptorSet *Get(VkDescriptorSet handle) {
+        for (uint32_t i = 0; i < 2; ++i) {
+            if (handles_[i] == handle && handle != VK_NULL_HANDLE) {
+                return sets_[i];
+            }
+        }
+        const vvl::DescriptorSet *set = core_.GetBorrowed<vvl::DescriptorSet>(handle).get();
+        handles_[next_] = handle;
+        sets_[next_] = set;
+        next_ ^= 1;
+        return set;
+    }
+
+  private:
+    const CoreChecks &core_;
+    vvl::EpochGuard guard_;
+    VkDescriptorSet handles_[2] = {VK_NULL_HANDLE, VK_NULL_HANDLE};
+    const vvl::DescriptorSet *sets_[2] = {nullptr, nullptr};
+    uint32_t next_ = 0;
+};
+
 // This is a helper function that iterates over a set of Write and Copy updates, pulls the DescriptorSet* for updated
 //  sets, and then calls their respective Validate[Write|Copy]Update functions.
 // If the update hits an issue for which the callback returns "true", meaning that the call down the chain should
@@ -1386,11 +1414,12 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t descriptorWriteCount, con
                                               uint32_t descriptorCopyCount, const VkCopyDescriptorSet *pDescriptorCopies,
                                               const Location &loc) const {
     bool skip = false;
+    UpdatedDescriptorSets sets(*this);
     // Validate Write updates
     for (uint32_t i = 0; i < descriptorWriteCount; i++) {
         const Location write_loc = loc.dot(Field::pDescriptorWrites, i);
         auto dst_set = pDescriptorWrites[i].dstSet;
-        if (const auto set_node = Get<vvl::DescriptorSet>(dst_set)) {
+        if (const auto *set_node = sets.Get(dst_set)) {
             skip |= ValidateWriteUpdate(*set_node, pDescriptorWrites[i], write_loc, false);
         }
 
@@ -1398,7 +1427,7 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t descriptorWriteCount, con
             vku::FindStructInPNextChain<VkWriteDescriptorSetAccelerationStructureKHR>(pDescriptorWrites[i].pNext);
         if (acceleration_structure_khr) {
             for (uint32_t j = 0; j < acceleration_structure_khr->accelerationStructureCount; ++j) {
-                auto as_state = Get<vvl::AccelerationStructureKHR>(acceleration_structure_khr->pAccelerationStructures[j]);
+                auto as_state = GetBorrowed<vvl::AccelerationStructureKHR>(acceleration_structure_khr->pAccelerationStructures[j]);
                 if (as_state && (as_state->create_info.sType == VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR &&
                                  (as_state->create_info.type != VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR &&
                                   as_state->create_info.type != VK_ACCELERATION_STRUCTURE_TYPE_GENERIC_KHR))) {
@@ -1415,7 +1444,7 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t descriptorWriteCount, con
             vku::FindStructInPNextChain<VkWriteDescriptorSetAccelerationStructureNV>(pDescriptorWrites[i].pNext);
         if (acceleration_structure_nv) {
             for (uint32_t j = 0; j < acceleration_structure_nv->accelerationStructureCount; ++j) {
-                auto as_state = Get<vvl::AccelerationStructureNV>(acceleration_structure_nv->pAccelerationStructures[j]);
+                auto as_state = GetBorrowed<vvl::AccelerationStructureNV>(acceleration_structure_nv->pAccelerationStructures[j]);
                 if (as_state && (as_state->create_info.sType == VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_NV &&
                                  as_state->create_info.info.type != VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_NV)) {
                     const LogObjectList objlist(dst_set, as_state->Handle());
@@ -1430,7 +1459,11 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t descriptorWriteCount, con
 
     for (uint32_t i = 0; i < descriptorCopyCount; ++i) {
         const Location copy_loc = loc.dot(Field::pDescriptorCopies, i);
-        skip |= ValidateCopyUpdate(pDescriptorCopies[i], copy_loc);
+        const auto *src_set = sets.Get(pDescriptorCopies[i].srcSet);
+        const auto *dst_set = sets.Get(pDescriptorCopies[i].dstSet);
+        if (src_set && dst_set) {
+            skip |= ValidateCopyUpdate(pDescriptorCopies[i], *src_set, *dst_set, copy_loc);
+        }
     }
     return skip;
 }
@@ -1466,6 +1499,7 @@ vvl::DecodedTemplateUpdate::DecodedTemplateUpdate(const ValidationStateTracker &
             if (dst_array_element >= binding_count) {
                 dst_array_element = 0;
                 binding_being_updated = ds_layout_state->GetNextValidBinding(binding_being_updated);
+                binding_count = ds_layout_state->GetDescriptorCountFromBinding(binding_being_updated);
             }
 
             write_entry.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
@@ -1602,7 +1636,7 @@ bool CoreChecks::ValidateBufferUpdate(const VkDescriptorBufferInfo &buffer_info,
                                       const Location &buffer_info_loc) const {
     bool skip = false;
     // Invalid handles should be caught by the object tracker, but lets make sure not to crash anyways.
-    const auto buffer_state = Get<vvl::Buffer>(buffer_info.buffer);
+    const auto buffer_state = GetBorrowed<vvl::Buffer>(buffer_info.buffer);
     if (!buffer_state) return skip;
 
     skip |= ValidateMemoryIsBoundToBuffer(device, *buffer_state, buffer_info_loc.dot(Field::buffer),
@@ -1723,7 +1757,7 @@ bool CoreChecks::VerifyCopyUpdateContents(const VkCopyDescriptorSet &update, con
                 // Validate image
                 auto image_view = img_samp_desc.GetImageView();
                 auto image_layout = img_samp_desc.GetImageLayout();
-                if (auto iv_state = Get<vvl::ImageView>(image_view)) {
+                if (auto iv_state = GetBorrowed<vvl::ImageView>(image_view)) {
                     skip |= ValidateImageUpdate(*iv_state, image_layout, src_type, copy_loc);
                 }
             }
@@ -1736,7 +1770,7 @@ bool CoreChecks::VerifyCopyUpdateContents(const VkCopyDescriptorSet &update, con
                 auto img_desc = static_cast<const ImageDescriptor &>(*src_iter);
                 auto image_view = img_desc.GetImageView();
                 auto image_layout = img_desc.GetImageLayout();
-                if (auto iv_state = Get<vvl::ImageView>(image_view)) {
+                if (auto iv_state = GetBorrowed<vvl::ImageView>(image_view)) {
                     skip |= ValidateImageUpdate(*iv_state, image_layout, src_type, copy_loc);
                 }
             }
@@ -1748,14 +1782,14 @@ bool CoreChecks::VerifyCopyUpdateContents(const VkCopyDescriptorSet &update, con
                 if (!src_iter.updated()) continue;
                 auto buffer_view = static_cast<const TexelDescriptor &>(*src_iter).GetBufferView();
                 if (buffer_view) {
-                    auto bv_state = device_data->Get<vvl::BufferView>(buffer_view);
+                    auto bv_state = device_data->GetBorrowed<vvl::BufferView>(buffer_view);
                     if (!bv_state) {
                         const LogObjectList objlist(update.srcSet);
                         skip |= LogError("VUID-VkWriteDescriptorSet-descriptorType-02994", objlist, copy_loc,
                                          "Attempted copy update to texel buffer descriptor with invalid buffer view (%s).",
                                          FormatHandle(buffer_view).c_str());
                     } else {
-                        if (auto buffer_state = Get<vvl::Buffer>(bv_state->create_info.buffer)) {
+                        if (auto buffer_state = GetBorrowed<vvl::Buffer>(bv_state->create_info.buffer)) {
                             skip |= ValidateBufferUsage(*buffer_state, src_type, copy_loc);
                         }
                     }
@@ -1974,7 +2008,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet &dst_set, const V
                 }
                 auto image_layout = update.pImageInfo[di].imageLayout;
                 auto sampler = update.pImageInfo[di].sampler;
-                auto iv_state = Get<vvl::ImageView>(image_view);
+                auto iv_state = GetBorrowed<vvl::ImageView>(image_view);
                 if (!iv_state) continue;
 
                 const auto *image_state = iv_state->image_state.get();
@@ -1982,7 +2016,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet &dst_set, const V
 
                 if (IsExtEnabled(device_extensions.vk_khr_sampler_ycbcr_conversion)) {
                     if (desc.IsImmutableSampler()) {
-                        auto sampler_state = Get<vvl::Sampler>(desc.GetSampler());
+                        auto sampler_state = GetBorrowed<vvl::Sampler>(desc.GetSampler());
                         if (iv_state && sampler_state) {
                             if (iv_state->samplerConversion != sampler_state->samplerConversion) {
                                 const LogObjectList objlist(update.dstSet, desc.GetSampler(), iv_state->Handle());
@@ -2019,7 +2053,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet &dst_set, const V
                 }
 
                 // Verify portability
-                auto sampler_state = Get<vvl::Sampler>(sampler);
+                auto sampler_state = GetBorrowed<vvl::Sampler>(sampler);
                 if (sampler_state) {
                     if (IsExtEnabled(device_extensions.vk_khr_portability_subset)) {
                         if ((VK_FALSE == enabled_features.mutableComparisonSamplers) &&
@@ -2058,7 +2092,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet &dst_set, const V
             for (uint32_t di = 0; di < update.descriptorCount; ++di) {
                 const VkImageView image_view = update.pImageInfo[di].imageView;
                 auto image_layout = update.pImageInfo[di].imageLayout;
-                if (auto iv_state = Get<vvl::ImageView>(image_view)) {
+                if (auto iv_state = GetBorrowed<vvl::ImageView>(image_view)) {
                     skip |=
                         ValidateImageUpdate(*iv_state, image_layout, update.descriptorType, write_loc.dot(Field::pImageInfo, di));
                 }
@@ -2072,7 +2106,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet &dst_set, const V
                 if (buffer_view == VK_NULL_HANDLE) {
                     continue;
                 }
-                auto bv_state = Get<vvl::BufferView>(buffer_view);
+                auto bv_state = GetBorrowed<vvl::BufferView>(buffer_view);
                 if (!bv_state) {
                     skip |= LogError("VUID-VkWriteDescriptorSet-descriptorType-02994", device, write_loc,
                                      "Attempted write update to texel buffer descriptor with invalid buffer view (%s).",
@@ -2080,7 +2114,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet &dst_set, const V
                     break;
                 }
                 auto buffer = bv_state->create_info.buffer;
-                auto buffer_state = Get<vvl::Buffer>(buffer);
+                auto buffer_state = GetBorrowed<vvl::Buffer>(buffer);
                 // Verify that buffer underlying the view hasn't been destroyed prematurely
                 if (!buffer_state) {
                     skip |= LogError("VUID-VkWriteDescriptorSet-descriptorType-02994", device, write_loc,
@@ -2111,7 +2145,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet &dst_set, const V
             const auto *acc_info = vku::FindStructInPNextChain<VkWriteDescriptorSetAccelerationStructureNV>(update.pNext);
             for (uint32_t di = 0; di < update.descriptorCount; ++di) {
                 VkAccelerationStructureNV as = acc_info->pAccelerationStructures[di];
-                auto as_state = Get<vvl::AccelerationStructureNV>(as);
+                auto as_state = GetBorrowed<vvl::AccelerationStructureNV>(as);
                 // nullDescriptor feature allows this to be VK_NULL_HANDLE
                 if (as_state) {
                     skip |= VerifyBoundMemoryIsValid(
@@ -2159,6 +2193,14 @@ bool CoreChecks::ValidateCmdSetDescriptorBufferOffsets(const vvl::CommandBuffer
         setCount = std::min(setCount, static_cast<uint32_t>(pipeline_layout->set_layouts.size()));
     }
 
+    // The offsets found valid before are only valid for the same buffer device addresses
+    auto &validated = cb_state.validated_descriptor_buffer_offsets;
+    const uint32_t address_ranges_version = GetBufferAddressRangesVersion();
+    if (validated.address_ranges_version != address_ranges_version) {
+        validated.offsets.clear();
+        validated.address_ranges_version = address_ranges_version;
+    }
+
     for (uint32_t i = 0; i < setCount; i++) {
         const uint32_t bufferIndex = pBufferIndices[i];
         const VkDeviceAddress offset = pOffsets[i];
@@ -2178,9 +2220,11 @@ bool CoreChecks::ValidateCmdSetDescriptorBufferOffsets(const vvl::CommandBuffer
 
         if (bufferIndex < cb_state.descriptor_buffer_binding_info.size()) {
             const VkDeviceAddress start = cb_state.descriptor_buffer_binding_info[bufferIndex].address;
-            const auto buffer_states = GetBuffersByAddress(start);
-
-            if (!buffer_states.empty()) {
+            vvl::CommandBuffer::ValidatedDescriptorBufferOffsets::Key validated_key{start, offset, set_layout};
+            if (validated.offsets.find(validated_key) != validated.offsets.end()) {
+                valid_buffer = true;
+                valid_binding = true;
+            } else if (const auto buffer_states = GetBuffersByAddress(start); !buffer_states.empty()) {
                 const auto buffer_state_starts = GetBuffersByAddress(start + offset);
 
                 if (!buffer_state_starts.empty()) {
@@ -2226,6 +2270,7 @@ bool CoreChecks::ValidateCmdSetDescriptorBufferOffsets(const vvl::CommandBuffer
                         const auto buffer_state_ends = GetBuffersByAddress(start + offset + setLayoutSize - 1);
                         if (!buffer_state_ends.empty()) {
                             valid_binding = true;
+                            validated.offsets.emplace(std::move(validated_key));
                         }
                     }
                 }
@@ -2959,7 +3004,7 @@ bool CoreChecks::ValidateGetDescriptorDataSize(const VkDescriptorGetInfoEXT &des
                                  phys_dev_ext_props.descriptor_buffer_props.combinedImageSamplerDescriptorSize, data_size);
             }
         } else {
-            const auto image_view_state = Get<vvl::ImageView>(combined_image_sampler->imageView);
+            const auto image_view_state = GetBorrowed<vvl::ImageView>(combined_image_sampler->imageView);
             if (image_view_state && image_view_state->samplerConversion != VK_NULL_HANDLE) {
                 auto image_info = image_view_state->image_state->create_info;
                 VkPhysicalDeviceImageFormatInfo2 image_format_info = vku::InitStructHelper();
@@ -2986,7 +3031,7 @@ bool CoreChecks::ValidateGetDescriptorDataSize(const VkDescriptorGetInfoEXT &des
         }
 
         if (combined_image_sampler->sampler != VK_NULL_HANDLE) {
-            const auto sampler_state = Get<vvl::Sampler>(combined_image_sampler->sampler);
+            const auto sampler_state = GetBorrowed<vvl::Sampler>(combined_image_sampler->sampler);
             if (sampler_state && (0 != (sampler_state->create_info.flags & VK_SAMPLER_CREATE_SUBSAMPLED_BIT_EXT))) {
                 size = phys_dev_ext_props.descriptor_buffer_density_props.combinedImageSamplerDensityMapDescriptorSize;
                 struct_name = Struct::VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT;
@@ -3027,13 +3072,13 @@ bool CoreChecks::PreCallValidateGetDescriptorEXT(VkDevice device, const VkDescri
             break;
         case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
             data_field = Field::pCombinedImageSampler;
-            if (Get<vvl::Sampler>(pDescriptorInfo->data.pCombinedImageSampler->sampler).get() == nullptr) {
+            if (GetBorrowed<vvl::Sampler>(pDescriptorInfo->data.pCombinedImageSampler->sampler).get() == nullptr) {
                 skip |= LogError("VUID-VkDescriptorGetInfoEXT-type-08019", device, descriptor_info_loc.dot(Field::type),
                                  "is VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, but "
                                  "pCombinedImageSampler->sampler is not a valid sampler.");
             }
             if ((pDescriptorInfo->data.pCombinedImageSampler->imageView != VK_NULL_HANDLE) &&
-                (Get<vvl::ImageView>(pDescriptorInfo->data.pCombinedImageSampler->imageView).get() == nullptr)) {
+                (GetBorrowed<vvl::ImageView>(pDescriptorInfo->data.pCombinedImageSampler->imageView).get() == nullptr)) {
                 skip |= LogError("VUID-VkDescriptorGetInfoEXT-type-08020", device, descriptor_info_loc.dot(Field::type),
                                  "is VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, but "
                                  "pCombinedImageSampler->imageView is not a valid image view.");
@@ -3041,7 +3086,7 @@ bool CoreChecks::PreCallValidateGetDescriptorEXT(VkDevice device, const VkDescri
             break;
         case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
             data_field = Field::pInputAttachmentImage;
-            if (Get<vvl::ImageView>(pDescriptorInfo->data.pInputAttachmentImage->imageView).get() == nullptr) {
+            if (GetBorrowed<vvl::ImageView>(pDescriptorInfo->data.pInputAttachmentImage->imageView).get() == nullptr) {
                 skip |= LogError("VUID-VkDescriptorGetInfoEXT-type-08021", device, descriptor_info_loc.dot(Field::type),
                                  "is VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT, but "
                                  "pInputAttachmentImage->imageView is not valid image view.");
@@ -3050,7 +3095,7 @@ bool CoreChecks::PreCallValidateGetDescriptorEXT(VkDevice device, const VkDescri
         case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
             data_field = Field::pSampledImage;
             if (pDescriptorInfo->data.pSampledImage && (pDescriptorInfo->data.pSampledImage->imageView != VK_NULL_HANDLE) &&
-                (Get<vvl::ImageView>(pDescriptorInfo->data.pSampledImage->imageView).get() == nullptr)) {
+                (GetBorrowed<vvl::ImageView>(pDescriptorInfo->data.pSampledImage->imageView).get() == nullptr)) {
                 skip |= LogError("VUID-VkDescriptorGetInfoEXT-type-08022", device, descriptor_info_loc.dot(Field::type),
                                  "is VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, but "
                                  "pSampledImage->imageView is not a valid image view.");
@@ -3059,7 +3104,7 @@ bool CoreChecks::PreCallValidateGetDescriptorEXT(VkDevice device, const VkDescri
         case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
             data_field = Field::pStorageImage;
             if (pDescriptorInfo->data.pStorageImage && (pDescriptorInfo->data.pStorageImage->imageView != VK_NULL_HANDLE) &&
-                (Get<vvl::ImageView>(pDescriptorInfo->data.pStorageImage->imageView).get() == nullptr)) {
+                (GetBorrowed<vvl::ImageView>(pDescriptorInfo->data.pStorageImage->imageView).get() == nullptr)) {
                 skip |= LogError("VUID-VkDescriptorGetInfoEXT-type-08023", device, descriptor_info_loc.dot(Field::type),
                                  "is VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, but "
                                  "pStorageImage->imageView is not a valid image view.");
@@ -3121,7 +3166,7 @@ bool CoreChecks::PreCallValidateGetDescriptorEXT(VkDevice device, const VkDescri
             data_field = Field::accelerationStructure;
             if (pDescriptorInfo->data.accelerationStructure) {
                 const VkAccelerationStructureNV as = (VkAccelerationStructureNV)pDescriptorInfo->data.accelerationStructure;
-                auto as_state = Get<vvl::AccelerationStructureNV>(as);
+                auto as_state = GetBorrowed<vvl::AccelerationStructureNV>(as);
 
                 if (!as_state) {
                     skip |= LogError("VUID-VkDescriptorGetInfoEXT-type-08029", device, descriptor_info_loc.dot(Field::type),
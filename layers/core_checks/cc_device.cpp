@@ -19,11 +19,14 @@
  * This file deals with anything related to Phyiscal Devices, Logical Devices, or Device Queues Families, Device Masks, etc
  */
 
+#include <cstdio>
 #include <fstream>
 #include <vector>
 
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
 #include <unistd.h>
+#elif defined(_WIN32)
+#include <process.h>
 #endif
 
 #include <vulkan/vk_enum_string_helper.h>
@@ -436,6 +439,15 @@ bool CoreChecks::PreCallValidateCreateDevice(VkPhysicalDevice gpu, const VkDevic
     return skip;
 }
 
+static bool ReadValidationCacheFile(const std::string &path, std::vector<char> &data) {
+    std::ifstream read_file(path.c_str(), std::ios::in | std::ios::binary);
+    if (!read_file) {
+        return false;
+    }
+    std::copy(std::istreambuf_iterator<char>(read_file), {}, std::back_inserter(data));
+    return true;
+}
+
 void CoreChecks::CreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Location &loc) {
     // The state tracker sets up the device state
     StateTracker::CreateDevice(pCreateInfo, loc);
@@ -448,22 +460,34 @@ void CoreChecks::CreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Locat
             cb_state->SetImageViewInitialLayout(iv_state, layout);
         });
 
+    // spirv-val results only hold for the same target environment and options, they are part of the validation cache keys
+    {
+        spvtools::ValidatorOptions options;
+        const uint32_t options_mask = AdjustValidatorOptions(device_extensions, enabled_features, options);
+        const spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
+        spirv_validation_seed = (static_cast<uint64_t>(spirv_environment) << 32) | options_mask;
+    }
+    if (worker_pool) {
+        shader_validation_pool_ = worker_pool;
+    } else if (shader_validation_threads > 0) {
+        shader_validation_pool_ = std::make_shared<vvl::WorkerPool>(shader_validation_threads);
+    }
+
     // Allocate shader validation cache
     if (!disabled[shader_validation_caching] && !disabled[shader_validation] && !core_validation_cache) {
-        auto tmp_path = GetTempFilePath();
-        validation_cache_path = tmp_path + "/shader_validation_cache";
+        if (!shader_validation_cache_path.empty()) {
+            validation_cache_path = shader_validation_cache_path;
+        } else {
+            auto tmp_path = GetTempFilePath();
+            validation_cache_path = tmp_path + "/shader_validation_cache";
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
-        validation_cache_path += "-" + std::to_string(getuid());
+            validation_cache_path += "-" + std::to_string(getuid());
 #endif
-        validation_cache_path += ".bin";
+            validation_cache_path += ".bin";
+        }
 
         std::vector<char> validation_cache_data;
-        std::ifstream read_file(validation_cache_path.c_str(), std::ios::in | std::ios::binary);
-
-        if (read_file) {
-            std::copy(std::istreambuf_iterator<char>(read_file), {}, std::back_inserter(validation_cache_data));
-            read_file.close();
-        } else {
+        if (!ReadValidationCacheFile(validation_cache_path, validation_cache_data)) {
             LogInfo("WARNING-cache-file-error", device, loc,
                     "Cannot open shader validation cache at %s for reading (it may not exist yet)", validation_cache_path.c_str());
         }
@@ -487,6 +511,20 @@ void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationC
         size_t validation_cache_size = 0;
         void *validation_cache_data = nullptr;
 
+        // Other processes sharing the file may have written it since it was read, keep their results too
+        if (validation_cache_path.size() > 0) {
+            std::vector<char> file_data;
+            if (ReadValidationCacheFile(validation_cache_path, file_data)) {
+                VkValidationCacheCreateInfoEXT file_cache_ci = vku::InitStructHelper();
+                file_cache_ci.initialDataSize = file_data.size();
+                file_cache_ci.pInitialData = file_data.data();
+                VkValidationCacheEXT file_cache = VK_NULL_HANDLE;
+                CoreLayerCreateValidationCacheEXT(device, &file_cache_ci, nullptr, &file_cache);
+                CastFromHandle<ValidationCache *>(core_validation_cache)->Merge(CastFromHandle<ValidationCache *>(file_cache));
+                CoreLayerDestroyValidationCacheEXT(device, file_cache, nullptr);
+            }
+        }
+
         CoreLayerGetValidationCacheDataEXT(device, core_validation_cache, &validation_cache_size, nullptr);
 
         validation_cache_data = (char *)malloc(sizeof(char) * validation_cache_size);
@@ -505,13 +543,31 @@ void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationC
         }
 
         if (validation_cache_path.size() > 0) {
-            std::ofstream write_file(validation_cache_path.c_str(), std::ios::out | std::ios::binary);
+            // Write a file of our own and rename it over the cache, so processes reading the cache meanwhile never see a
+            // partially written file
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+            const std::string write_path = validation_cache_path + "." + std::to_string(getpid()) + ".tmp";
+#elif defined(_WIN32)
+            const std::string write_path = validation_cache_path + "." + std::to_string(_getpid()) + ".tmp";
+#else
+            const std::string write_path = validation_cache_path + ".tmp";
+#endif
+            std::ofstream write_file(write_path.c_str(), std::ios::out | std::ios::binary);
             if (write_file) {
                 write_file.write(static_cast<char *>(validation_cache_data), validation_cache_size);
                 write_file.close();
+                if (std::rename(write_path.c_str(), validation_cache_path.c_str()) != 0) {
+                    // Windows does not rename over an existing file
+                    std::remove(validation_cache_path.c_str());
+                    if (std::rename(write_path.c_str(), validation_cache_path.c_str()) != 0) {
+                        std::remove(write_path.c_str());
+                        LogInfo("WARNING-cache-write-error", device, loc, "Cannot replace shader validation cache at %s",
+                                validation_cache_path.c_str());
+                    }
+                }
             } else {
                 LogInfo("WARNING-cache-write-error", device, loc, "Cannot open shader validation cache at %s for writing",
-                        validation_cache_path.c_str());
+                        write_path.c_str());
             }
         }
         free(validation_cache_data);
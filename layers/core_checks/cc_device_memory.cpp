@@ -1367,85 +1367,87 @@ bool CoreChecks::PreCallValidateUnmapMemory2KHR(VkDevice device, const VkMemoryU
     return skip;
 }
 
-bool CoreChecks::ValidateMemoryIsMapped(uint32_t mem_range_count, const VkMappedMemoryRange *mem_ranges,
-                                        const ErrorObject &error_obj) const {
+bool CoreChecks::ValidateMappedMemoryRanges(uint32_t mem_range_count, const VkMappedMemoryRange *mem_ranges,
+                                            const ErrorObject &error_obj) const {
     bool skip = false;
-    for (uint32_t i = 0; i < mem_range_count; ++i) {
-        const Location memory_range_loc = error_obj.location.dot(Field::pMemoryRanges, i);
-        auto mem_info = Get<vvl::DeviceMemory>(mem_ranges[i].memory);
-        if (!mem_info) continue;
-        // Makes sure the memory is already mapped
-        if (mem_info->mapped_range.size == 0) {
-            skip |= LogError("VUID-VkMappedMemoryRange-memory-00684", mem_ranges[i].memory, memory_range_loc,
-                             "Attempting to use memory (%s) that is not currently host mapped.",
-                             FormatHandle(mem_ranges[i].memory).c_str());
-        }
+    const uint64_t atom_size = phys_dev_props.limits.nonCoherentAtomSize;
 
-        if (mem_ranges[i].size == VK_WHOLE_SIZE) {
-            if (mem_info->mapped_range.offset > mem_ranges[i].offset) {
-                skip |= LogError("VUID-VkMappedMemoryRange-size-00686", mem_ranges[i].memory, memory_range_loc.dot(Field::offset),
-                                 "(%" PRIu64 ") is less than the mapped memory offset (%" PRIu64 ") (and size is VK_WHOLE_SIZE).",
-                                 mem_ranges[i].offset, mem_info->mapped_range.offset);
-            }
-        } else {
-            if (mem_info->mapped_range.offset > mem_ranges[i].offset) {
-                skip |=
-                    LogError("VUID-VkMappedMemoryRange-size-00685", mem_ranges[i].memory, memory_range_loc.dot(Field::offset),
-                             "(%" PRIu64 ") is less than the mapped memory offset (%" PRIu64 ") (and size is not VK_WHOLE_SIZE).",
-                             mem_ranges[i].offset, mem_info->mapped_range.offset);
-            }
-            const uint64_t data_end = (mem_info->mapped_range.size == VK_WHOLE_SIZE)
-                                          ? mem_info->allocate_info.allocationSize
-                                          : (mem_info->mapped_range.offset + mem_info->mapped_range.size);
-            if ((data_end < (mem_ranges[i].offset + mem_ranges[i].size))) {
-                skip |= LogError("VUID-VkMappedMemoryRange-size-00685", mem_ranges[i].memory, memory_range_loc,
-                                 "size (%" PRIu64 ") plus offset (%" PRIu64
-                                 ") "
-                                 "exceed the Memory Object's upper-bound (%" PRIu64 ").",
-                                 mem_ranges[i].size, mem_ranges[i].offset, data_end);
-            }
-        }
-    }
-    return skip;
-}
+    // Upload allocators flush many small ranges of a few memory objects at once, so each memory is only looked up once
+    // per call and its mapped range copied out for all of its ranges
+    vvl::unordered_map<VkDeviceMemory, std::optional<vvl::DeviceMemory::MappedRange>> mapped_ranges;
+    VkDeviceMemory last_memory = VK_NULL_HANDLE;
+    const std::optional<vvl::DeviceMemory::MappedRange> *last_mapped = nullptr;
 
-bool CoreChecks::ValidateMappedMemoryRangeDeviceLimits(uint32_t mem_range_count, const VkMappedMemoryRange *mem_ranges,
-                                                       const ErrorObject &error_obj) const {
-    bool skip = false;
     for (uint32_t i = 0; i < mem_range_count; ++i) {
+        const VkMappedMemoryRange &range = mem_ranges[i];
         const Location memory_range_loc = error_obj.location.dot(Field::pMemoryRanges, i);
-        const uint64_t atom_size = phys_dev_props.limits.nonCoherentAtomSize;
-        const VkDeviceSize offset = mem_ranges[i].offset;
-        const VkDeviceSize size = mem_ranges[i].size;
+        const VkDeviceSize offset = range.offset;
+        const VkDeviceSize size = range.size;
 
         if (SafeModulo(offset, atom_size) != 0) {
-            skip |= LogError("VUID-VkMappedMemoryRange-offset-00687", mem_ranges->memory, memory_range_loc.dot(Field::offset),
+            skip |= LogError("VUID-VkMappedMemoryRange-offset-00687", range.memory, memory_range_loc.dot(Field::offset),
                              "(%" PRIu64 ") is not a multiple of VkPhysicalDeviceLimits::nonCoherentAtomSize (%" PRIu64 ").",
                              offset, atom_size);
         }
-        auto mem_info = Get<vvl::DeviceMemory>(mem_ranges[i].memory);
-        if (!mem_info) continue;
 
-        const auto allocation_size = mem_info->allocate_info.allocationSize;
+        if (!last_mapped || range.memory != last_memory) {
+            auto [it, inserted] = mapped_ranges.try_emplace(range.memory);
+            if (inserted) {
+                if (auto mem_info = Get<vvl::DeviceMemory>(range.memory)) {
+                    it->second = mem_info->GetMappedRange();
+                }
+            }
+            last_memory = range.memory;
+            last_mapped = &it->second;
+        }
+        if (!last_mapped->has_value()) continue;
+        const vvl::DeviceMemory::MappedRange &mapped = last_mapped->value();
+
         if (size == VK_WHOLE_SIZE) {
-            const auto mapping_offset = mem_info->mapped_range.offset;
-            const auto mapping_size = mem_info->mapped_range.size;
-            const auto mapping_end = ((mapping_size == VK_WHOLE_SIZE) ? allocation_size : mapping_offset + mapping_size);
-            if (SafeModulo(mapping_end, atom_size) != 0 && mapping_end != allocation_size) {
-                skip |= LogError("VUID-VkMappedMemoryRange-size-01389", mem_ranges->memory, memory_range_loc.dot(Field::size),
+            if (SafeModulo(mapped.end, atom_size) != 0 && mapped.end != mapped.allocation_size) {
+                skip |= LogError("VUID-VkMappedMemoryRange-size-01389", range.memory, memory_range_loc.dot(Field::size),
                                  "is VK_WHOLE_SIZE and the mapping end (%" PRIu64 " = %" PRIu64 " + %" PRIu64
                                  ") not a multiple of VkPhysicalDeviceLimits::nonCoherentAtomSize (%" PRIu64
                                  ") and not equal to the end of the memory object (%" PRIu64 ").",
-                                 mapping_end, mapping_offset, mapping_size, atom_size, allocation_size);
+                                 mapped.end, mapped.offset, mapped.size, atom_size, mapped.allocation_size);
             }
         } else {
             const auto range_end = size + offset;
-            if (range_end != allocation_size && SafeModulo(size, atom_size) != 0) {
-                skip |= LogError("VUID-VkMappedMemoryRange-size-01390", mem_ranges->memory, memory_range_loc.dot(Field::size),
+            if (range_end != mapped.allocation_size && SafeModulo(size, atom_size) != 0) {
+                skip |= LogError("VUID-VkMappedMemoryRange-size-01390", range.memory, memory_range_loc.dot(Field::size),
                                  "(%" PRIu64 ") is not a multiple of VkPhysicalDeviceLimits::nonCoherentAtomSize (%" PRIu64
                                  ") and offset + size (%" PRIu64 " + %" PRIu64 " = %" PRIu64
                                  ") not equal to the memory size (%" PRIu64 ").",
-                                 size, atom_size, offset, size, range_end, allocation_size);
+                                 size, atom_size, offset, size, range_end, mapped.allocation_size);
+            }
+        }
+
+        // Makes sure the memory is already mapped
+        if (!mapped.IsMapped()) {
+            skip |= LogError("VUID-VkMappedMemoryRange-memory-00684", range.memory, memory_range_loc,
+                             "Attempting to use memory (%s) that is not currently host mapped.",
+                             FormatHandle(range.memory).c_str());
+        }
+
+        if (size == VK_WHOLE_SIZE) {
+            if (mapped.offset > offset) {
+                skip |= LogError("VUID-VkMappedMemoryRange-size-00686", range.memory, memory_range_loc.dot(Field::offset),
+                                 "(%" PRIu64 ") is less than the mapped memory offset (%" PRIu64 ") (and size is VK_WHOLE_SIZE).",
+                                 offset, mapped.offset);
+            }
+        } else {
+            if (mapped.offset > offset) {
+                skip |=
+                    LogError("VUID-VkMappedMemoryRange-size-00685", range.memory, memory_range_loc.dot(Field::offset),
+                             "(%" PRIu64 ") is less than the mapped memory offset (%" PRIu64 ") (and size is not VK_WHOLE_SIZE).",
+                             offset, mapped.offset);
+            }
+            if (mapped.end < (offset + size)) {
+                skip |= LogError("VUID-VkMappedMemoryRange-size-00685", range.memory, memory_range_loc,
+                                 "size (%" PRIu64 ") plus offset (%" PRIu64
+                                 ") "
+                                 "exceed the Memory Object's upper-bound (%" PRIu64 ").",
+                                 size, offset, mapped.end);
             }
         }
     }
@@ -1455,19 +1457,13 @@ bool CoreChecks::ValidateMappedMemoryRangeDeviceLimits(uint32_t mem_range_count,
 bool CoreChecks::PreCallValidateFlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount,
                                                         const VkMappedMemoryRange *pMemoryRanges,
                                                         const ErrorObject &error_obj) const {
-    bool skip = false;
-    skip |= ValidateMappedMemoryRangeDeviceLimits(memoryRangeCount, pMemoryRanges, error_obj);
-    skip |= ValidateMemoryIsMapped(memoryRangeCount, pMemoryRanges, error_obj);
-    return skip;
+    return ValidateMappedMemoryRanges(memoryRangeCount, pMemoryRanges, error_obj);
 }
 
 bool CoreChecks::PreCallValidateInvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount,
                                                              const VkMappedMemoryRange *pMemoryRanges,
                                                              const ErrorObject &error_obj) const {
-    bool skip = false;
-    skip |= ValidateMappedMemoryRangeDeviceLimits(memoryRangeCount, pMemoryRanges, error_obj);
-    skip |= ValidateMemoryIsMapped(memoryRangeCount, pMemoryRanges, error_obj);
-    return skip;
+    return ValidateMappedMemoryRanges(memoryRangeCount, pMemoryRanges, error_obj);
 }
 
 bool CoreChecks::PreCallValidateGetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory, VkDeviceSize *pCommittedMem,
@@ -30,11 +30,15 @@
 using vvl::DrawDispatchVuid;
 using vvl::GetDrawDispatchVuid;
 
+// Either allows drawing with no index buffer bound
+static constexpr DeviceFeatureBits kNullIndexBufferFeatures =
+    MakeDeviceFeatureBits({DeviceFeature::maintenance6, DeviceFeature::nullDescriptor});
+
 bool CoreChecks::ValidateGraphicsIndexedCmd(const vvl::CommandBuffer &cb_state, const Location &loc) const {
     bool skip = false;
     const DrawDispatchVuid &vuid = GetDrawDispatchVuid(loc.function);
-    const auto buffer_state = Get<vvl::Buffer>(cb_state.index_buffer_binding.buffer);
-    if (!buffer_state && !enabled_features.maintenance6 && !enabled_features.nullDescriptor) {
+    const auto buffer_state = GetBorrowed<vvl::Buffer>(cb_state.index_buffer_binding.buffer);
+    if (!buffer_state && !enabled_features.IsAnyEnabled(kNullIndexBufferFeatures)) {
         skip |= LogError(vuid.index_binding_07312, cb_state.GetObjectList(VK_PIPELINE_BIND_POINT_GRAPHICS), loc,
                          "Index buffer object has not been bound to this command buffer.");
     }
@@ -137,8 +141,10 @@ bool CoreChecks::ValidateMeshShaderStage(const vvl::CommandBuffer &cb_state, con
                          "bound pipeline are %s.",
                          string_VkShaderStageFlags(pipeline_state->active_shaders).c_str());
     }
+    // Entered once for the loop, the borrows in it are then only a thread local counter increment
+    vvl::EpochGuard epoch_guard;
     for (const auto &query : cb_state.activeQueries) {
-        const auto query_pool_state = Get<vvl::QueryPool>(query.pool);
+        const auto query_pool_state = GetBorrowed<vvl::QueryPool>(query.pool);
         if (!query_pool_state) continue;
         if (query_pool_state->create_info.queryType == VK_QUERY_TYPE_TRANSFORM_FEEDBACK_STREAM_EXT) {
             skip |= LogError(vuid.xfb_queries_07074, cb_state.Handle(), loc, "Query with type %s is active.",
@@ -205,7 +211,7 @@ bool CoreChecks::ValidateCmdDrawIndexedBufferSize(const vvl::CommandBuffer &cb_s
         return skip;
     }
     const auto &index_buffer_binding = cb_state.index_buffer_binding;
-    if (const auto buffer_state = Get<vvl::Buffer>(index_buffer_binding.buffer)) {
+    if (const auto buffer_state = GetBorrowed<vvl::Buffer>(index_buffer_binding.buffer)) {
         const uint32_t index_size = GetIndexAlignment(index_buffer_binding.index_type);
         // This doesn't exactly match the pseudocode of the VUID, but the binding size is the *bound* size, such that the offset
         // has already been accounted for (subtracted from the buffer size), and is consistent with the use of
@@ -278,13 +284,23 @@ bool CoreChecks::PreCallValidateCmdDrawMultiIndexedEXT(VkCommandBuffer commandBu
     if (drawCount != 0 && !pIndexInfo) {
         skip |= LogError("VUID-vkCmdDrawMultiIndexedEXT-drawCount-04940", cb_state.GetObjectList(VK_PIPELINE_BIND_POINT_GRAPHICS),
                          error_obj.location.dot(Field::drawCount), "is %" PRIu32 " but pIndexInfo is NULL.", drawCount);
-    } else {
+    } else if (drawCount != 0 && !enabled_features.robustBufferAccess2) {
+        // Reduce the draws to the furthest index any of them reads first, the draws only need to be checked one by one to
+        // report the ones that go past the end of the bound index buffer
         const auto info_bytes = reinterpret_cast<const char *>(pIndexInfo);
+        uint64_t max_index_end = 0;
         for (uint32_t i = 0; i < drawCount; i++) {
             const auto info_ptr = reinterpret_cast<const VkMultiDrawIndexedInfoEXT *>(info_bytes + i * stride);
-            skip |= ValidateCmdDrawIndexedBufferSize(cb_state, info_ptr->indexCount, info_ptr->firstIndex,
-                                                     error_obj.location.dot(Field::pIndexInfo, i),
-                                                     "VUID-vkCmdDrawMultiIndexedEXT-robustBufferAccess2-07825");
+            max_index_end = std::max(max_index_end, uint64_t(info_ptr->firstIndex) + info_ptr->indexCount);
+        }
+        const auto &index_buffer_binding = cb_state.index_buffer_binding;
+        if (max_index_end * GetIndexAlignment(index_buffer_binding.index_type) > index_buffer_binding.size) {
+            for (uint32_t i = 0; i < drawCount; i++) {
+                const auto info_ptr = reinterpret_cast<const VkMultiDrawIndexedInfoEXT *>(info_bytes + i * stride);
+                skip |= ValidateCmdDrawIndexedBufferSize(cb_state, info_ptr->indexCount, info_ptr->firstIndex,
+                                                         error_obj.location.dot(Field::pIndexInfo, i),
+                                                         "VUID-vkCmdDrawMultiIndexedEXT-robustBufferAccess2-07825");
+            }
         }
     }
     return skip;
@@ -298,7 +314,7 @@ bool CoreChecks::PreCallValidateCmdDrawIndirect(VkCommandBuffer commandBuffer, V
     if (skip) return skip;  // basic validation failed, might have null pointers
 
     skip |= ValidateActionState(cb_state, VK_PIPELINE_BIND_POINT_GRAPHICS, error_obj.location);
-    auto buffer_state = Get<vvl::Buffer>(buffer);
+    auto buffer_state = GetBorrowed<vvl::Buffer>(buffer);
     if (!buffer_state) return skip;
     skip |= ValidateIndirectCmd(cb_state, *buffer_state, error_obj.location);
     skip |= ValidateVTGShaderStages(cb_state, error_obj.location);
@@ -347,7 +363,7 @@ bool CoreChecks::PreCallValidateCmdDrawIndexedIndirect(VkCommandBuffer commandBu
 
     skip |= ValidateGraphicsIndexedCmd(cb_state, error_obj.location);
     skip |= ValidateActionState(cb_state, VK_PIPELINE_BIND_POINT_GRAPHICS, error_obj.location);
-    auto buffer_state = Get<vvl::Buffer>(buffer);
+    auto buffer_state = GetBorrowed<vvl::Buffer>(buffer);
     if (!buffer_state) return skip;
     skip |= ValidateIndirectCmd(cb_state, *buffer_state, error_obj.location);
     skip |= ValidateVTGShaderStages(cb_state, error_obj.location);
@@ -519,7 +535,7 @@ bool CoreChecks::PreCallValidateCmdDispatchIndirect(VkCommandBuffer commandBuffe
     if (skip) return skip;  // basic validation failed, might have null pointers
 
     skip |= ValidateActionState(cb_state, VK_PIPELINE_BIND_POINT_COMPUTE, error_obj.location);
-    auto buffer_state = Get<vvl::Buffer>(buffer);
+    auto buffer_state = GetBorrowed<vvl::Buffer>(buffer);
     if (!buffer_state) return skip;
     skip |= ValidateIndirectCmd(cb_state, *buffer_state, error_obj.location);
     if (offset & 3) {
@@ -562,7 +578,7 @@ bool CoreChecks::PreCallValidateCmdDrawIndirectCount(VkCommandBuffer commandBuff
                          "Starting in Vulkan 1.2 the VkPhysicalDeviceVulkan12Features::drawIndirectCount must be enabled to "
                          "call this command.");
     }
-    auto buffer_state = Get<vvl::Buffer>(buffer);
+    auto buffer_state = GetBorrowed<vvl::Buffer>(buffer);
     if (!buffer_state) return skip;
     skip |= ValidateCmdDrawStrideWithStruct(cb_state, "VUID-vkCmdDrawIndirectCount-stride-03110", stride,
                                             Struct::VkDrawIndirectCommand, sizeof(VkDrawIndirectCommand), error_obj.location);
@@ -574,7 +590,7 @@ bool CoreChecks::PreCallValidateCmdDrawIndirectCount(VkCommandBuffer commandBuff
 
     skip |= ValidateActionState(cb_state, VK_PIPELINE_BIND_POINT_GRAPHICS, error_obj.location);
     skip |= ValidateIndirectCmd(cb_state, *buffer_state, error_obj.location);
-    auto count_buffer_state = Get<vvl::Buffer>(countBuffer);
+    auto count_buffer_state = GetBorrowed<vvl::Buffer>(countBuffer);
     if (!count_buffer_state) return skip;
     skip |= ValidateIndirectCountCmd(cb_state, *count_buffer_state, countBufferOffset, error_obj.location);
     skip |= ValidateVTGShaderStages(cb_state, error_obj.location);
@@ -616,7 +632,7 @@ bool CoreChecks::PreCallValidateCmdDrawIndexedIndirectCount(VkCommandBuffer comm
     skip |= ValidateCmdDrawStrideWithStruct(cb_state, "VUID-vkCmdDrawIndexedIndirectCount-stride-03142", stride,
                                             Struct::VkDrawIndexedIndirectCommand, sizeof(VkDrawIndexedIndirectCommand),
                                             error_obj.location);
-    auto buffer_state = Get<vvl::Buffer>(buffer);
+    auto buffer_state = GetBorrowed<vvl::Buffer>(buffer);
     if (!buffer_state) return skip;
     if (maxDrawCount > 1) {
         skip |= ValidateCmdDrawStrideWithBuffer(cb_state, "VUID-vkCmdDrawIndexedIndirectCount-maxDrawCount-03143", stride,
@@ -627,7 +643,7 @@ bool CoreChecks::PreCallValidateCmdDrawIndexedIndirectCount(VkCommandBuffer comm
     skip |= ValidateGraphicsIndexedCmd(cb_state, error_obj.location);
     skip |= ValidateActionState(cb_state, VK_PIPELINE_BIND_POINT_GRAPHICS, error_obj.location);
     skip |= ValidateIndirectCmd(cb_state, *buffer_state, error_obj.location);
-    auto count_buffer_state = Get<vvl::Buffer>(countBuffer);
+    auto count_buffer_state = GetBorrowed<vvl::Buffer>(countBuffer);
     if (!count_buffer_state) return skip;
     skip |= ValidateIndirectCountCmd(cb_state, *count_buffer_state, countBufferOffset, error_obj.location);
     skip |= ValidateVTGShaderStages(cb_state, error_obj.location);
@@ -688,7 +704,7 @@ bool CoreChecks::PreCallValidateCmdDrawIndirectByteCountEXT(VkCommandBuffer comm
 
     skip |= ValidateCmdDrawInstance(cb_state, instanceCount, firstInstance, error_obj.location);
     skip |= ValidateActionState(cb_state, VK_PIPELINE_BIND_POINT_GRAPHICS, error_obj.location);
-    auto counter_buffer_state = Get<vvl::Buffer>(counterBuffer);
+    auto counter_buffer_state = GetBorrowed<vvl::Buffer>(counterBuffer);
     skip |= ValidateIndirectCmd(cb_state, *counter_buffer_state, error_obj.location);
     skip |= ValidateVTGShaderStages(cb_state, error_obj.location);
     return skip;
@@ -800,7 +816,7 @@ bool CoreChecks::PreCallValidateCmdTraceRaysNV(VkCommandBuffer commandBuffer, Vk
     }
 
     skip |= ValidateActionState(cb_state, VK_PIPELINE_BIND_POINT_RAY_TRACING_NV, error_obj.location);
-    auto callable_shader_buffer_state = Get<vvl::Buffer>(callableShaderBindingTableBuffer);
+    auto callable_shader_buffer_state = GetBorrowed<vvl::Buffer>(callableShaderBindingTableBuffer);
     if (callable_shader_buffer_state && callableShaderBindingOffset >= callable_shader_buffer_state->create_info.size) {
         LogObjectList objlist = cb_state.GetObjectList(VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR);
         objlist.add(callableShaderBindingTableBuffer);
@@ -809,7 +825,7 @@ bool CoreChecks::PreCallValidateCmdTraceRaysNV(VkCommandBuffer commandBuffer, Vk
                          "%" PRIu64 " must be less than the size of callableShaderBindingTableBuffer %" PRIu64 " .",
                          callableShaderBindingOffset, callable_shader_buffer_state->create_info.size);
     }
-    auto hit_shader_buffer_state = Get<vvl::Buffer>(hitShaderBindingTableBuffer);
+    auto hit_shader_buffer_state = GetBorrowed<vvl::Buffer>(hitShaderBindingTableBuffer);
     if (hit_shader_buffer_state && hitShaderBindingOffset >= hit_shader_buffer_state->create_info.size) {
         LogObjectList objlist = cb_state.GetObjectList(VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR);
         objlist.add(hitShaderBindingTableBuffer);
@@ -818,7 +834,7 @@ bool CoreChecks::PreCallValidateCmdTraceRaysNV(VkCommandBuffer commandBuffer, Vk
                          "%" PRIu64 " must be less than the size of hitShaderBindingTableBuffer %" PRIu64 " .",
                          hitShaderBindingOffset, hit_shader_buffer_state->create_info.size);
     }
-    auto miss_shader_buffer_state = Get<vvl::Buffer>(missShaderBindingTableBuffer);
+    auto miss_shader_buffer_state = GetBorrowed<vvl::Buffer>(missShaderBindingTableBuffer);
     if (miss_shader_buffer_state && missShaderBindingOffset >= miss_shader_buffer_state->create_info.size) {
         LogObjectList objlist = cb_state.GetObjectList(VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR);
         objlist.add(missShaderBindingTableBuffer);
@@ -827,7 +843,7 @@ bool CoreChecks::PreCallValidateCmdTraceRaysNV(VkCommandBuffer commandBuffer, Vk
                          "%" PRIu64 " must be less than the size of missShaderBindingTableBuffer %" PRIu64 " .",
                          missShaderBindingOffset, miss_shader_buffer_state->create_info.size);
     }
-    auto raygen_shader_buffer_state = Get<vvl::Buffer>(raygenShaderBindingTableBuffer);
+    auto raygen_shader_buffer_state = GetBorrowed<vvl::Buffer>(raygenShaderBindingTableBuffer);
     if (raygenShaderBindingOffset >= raygen_shader_buffer_state->create_info.size) {
         LogObjectList objlist = cb_state.GetObjectList(VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR);
         objlist.add(raygenShaderBindingTableBuffer);
@@ -1283,7 +1299,7 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectNV(VkCommandBuffer comma
     if (skip) return skip;  // basic validation failed, might have null pointers
 
     skip |= ValidateActionState(cb_state, VK_PIPELINE_BIND_POINT_GRAPHICS, error_obj.location);
-    auto buffer_state = Get<vvl::Buffer>(buffer);
+    auto buffer_state = GetBorrowed<vvl::Buffer>(buffer);
     if (!buffer_state) return skip;
     skip |= ValidateIndirectCmd(cb_state, *buffer_state, error_obj.location);
 
@@ -1345,8 +1361,8 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectCountNV(VkCommandBuffer
     }
 
     skip |= ValidateActionState(cb_state, VK_PIPELINE_BIND_POINT_GRAPHICS, error_obj.location);
-    auto buffer_state = Get<vvl::Buffer>(buffer);
-    auto count_buffer_state = Get<vvl::Buffer>(countBuffer);
+    auto buffer_state = GetBorrowed<vvl::Buffer>(buffer);
+    auto count_buffer_state = GetBorrowed<vvl::Buffer>(countBuffer);
     if (!buffer_state || !count_buffer_state) return skip;
     skip |= ValidateIndirectCmd(cb_state, *buffer_state, error_obj.location);
     skip |= ValidateIndirectCountCmd(cb_state, *count_buffer_state, countBufferOffset, error_obj.location);
@@ -1434,7 +1450,7 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectEXT(VkCommandBuffer comm
     if (skip) return skip;  // basic validation failed, might have null pointers
 
     skip |= ValidateActionState(cb_state, VK_PIPELINE_BIND_POINT_GRAPHICS, error_obj.location);
-    auto buffer_state = Get<vvl::Buffer>(buffer);
+    auto buffer_state = GetBorrowed<vvl::Buffer>(buffer);
     if (!buffer_state) return skip;
     skip |= ValidateIndirectCmd(cb_state, *buffer_state, error_obj.location);
 
@@ -1484,8 +1500,8 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer
     if (skip) return skip;  // basic validation failed, might have null pointers
 
     skip |= ValidateActionState(cb_state, VK_PIPELINE_BIND_POINT_GRAPHICS, error_obj.location);
-    auto buffer_state = Get<vvl::Buffer>(buffer);
-    auto count_buffer_state = Get<vvl::Buffer>(countBuffer);
+    auto buffer_state = GetBorrowed<vvl::Buffer>(buffer);
+    auto count_buffer_state = GetBorrowed<vvl::Buffer>(countBuffer);
     if (!buffer_state || !count_buffer_state) return skip;
     skip |= ValidateIndirectCmd(cb_state, *buffer_state, error_obj.location);
     skip |= ValidateMemoryIsBoundToBuffer(commandBuffer, *count_buffer_state, error_obj.location.dot(Field::countBuffer),
@@ -1506,6 +1522,25 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer
     return skip;
 }
 
+// The draw time validation of image descriptors reads the image layouts and attachments of the command buffer
+static bool IsDrawStateCommandBufferDependent(const vvl::DescriptorSet &descriptor_set, const BindingVariableMap &bindings) {
+    for (const auto &binding_pair : bindings) {
+        const auto *binding = descriptor_set.GetBinding(binding_pair.first);
+        if (!binding) {
+            continue;
+        }
+        switch (binding->descriptor_class) {
+            case vvl::DescriptorClass::ImageSampler:
+            case vvl::DescriptorClass::Image:
+            case vvl::DescriptorClass::Mutable:
+                return true;
+            default:
+                break;
+        }
+    }
+    return false;
+}
+
 // Action command == vkCmdDraw*, vkCmdDispatch*, vkCmdTraceRays*
 // This is the main logic shared by all action commands
 bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const VkPipelineBindPoint bind_point,
@@ -1518,7 +1553,50 @@ bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const V
 
     bool skip = false;
 
-    if (!last_pipeline || !last_pipeline->VkHandle()) {
+    // Nothing but the descriptor sets changed since the same command last passed this validation, the checks not looking
+    // at descriptors would pass again. With nothing changed at all, the set bindings are still compatible as well.
+    const auto &validated = cb_state.validated_action_state[lv_bind_point];
+    const bool same_command = validated.command == loc.function;
+    const bool state_validated = same_command && (validated.dirty & ~vvl::CommandBuffer::kActionStateDescriptorSets) == 0;
+    const bool bindings_validated = same_command && validated.dirty == 0;
+    const uint64_t error_count = debug_report->error_message_count.load(std::memory_order_relaxed);
+
+    // Validate the draw-time state for this descriptor set
+    // We can skip validating the descriptor set if "nothing" has changed since the last validation without error: same set
+    // contents, same "pipeline state" (binding_req_map of the same pipeline or shader object) and dynamic offsets, and for
+    // sets using images the same command buffer recording without image layout changes. The results are stored on the set,
+    // so other command buffers binding it skip the sets not using images as well.
+    const auto validate_set_contents = [&](uint32_t set_index, const BindingVariableMap &binding_req_map,
+                                           vvl::StateObject::IdType requirements_id) {
+        const auto &set_info = last_bound_state.per_set[set_index];
+        const auto *descriptor_set = set_info.bound_descriptor_set.get();
+        assert(descriptor_set);
+        vvl::DescriptorSet::ValidatedDrawState validated_state;
+        validated_state.change_count = descriptor_set->GetChangeCount();
+        validated_state.requirements_id = requirements_id;
+        validated_state.set_index = set_index;
+        validated_state.dynamic_offsets_hash = hash_util::HashCombiner().Combine(set_info.dynamicOffsets).Value();
+        validated_state.unprotected = cb_state.unprotected;
+        validated_state.recording_id = cb_state.recording_id;
+        validated_state.image_layout_change_count = disabled[image_layout_validation] ? 0 : cb_state.image_layout_change_count;
+        if (descriptor_set->IsDrawStateValidated(validated_state)) {
+            return false;
+        }
+
+        const uint64_t set_error_count = debug_report->error_message_count.load(std::memory_order_relaxed);
+        const bool set_skip =
+            ValidateDrawState(*descriptor_set, set_index, binding_req_map, set_info.dynamicOffsets, cb_state, loc, vuid);
+        if (debug_report->error_message_count.load(std::memory_order_relaxed) == set_error_count) {
+            if (!IsDrawStateCommandBufferDependent(*descriptor_set, binding_req_map)) {
+                validated_state.recording_id = 0;
+                validated_state.image_layout_change_count = 0;
+            }
+            descriptor_set->SetDrawStateValidated(validated_state);
+        }
+        return set_skip;
+    };
+
+    if (!state_validated && (!last_pipeline || !last_pipeline->VkHandle())) {
         if (enabled_features.shaderObject == VK_FALSE) {
             return LogError(vuid.pipeline_bound_08606, cb_state.GetObjectList(bind_point), loc,
                             "A valid %s pipeline must be bound with vkCmdBindPipeline before calling this command.",
@@ -1531,28 +1609,48 @@ bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const V
         }
     }
 
-    if (bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
-        skip |= ValidateDrawDynamicState(last_bound_state, loc);
-        skip |= ValidatePipelineDrawtimeState(last_bound_state, loc);
+    if (!state_validated) {
+        if (bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
+            skip |= ValidateDrawDynamicState(last_bound_state, loc);
+            skip |= ValidatePipelineDrawtimeState(last_bound_state, loc);
 
-        if (enabled_features.shaderObject && !has_last_pipeline) {
-            skip |= ValidateShaderObjectDrawtimeState(last_bound_state, loc);
-        }
+            if (enabled_features.shaderObject && !has_last_pipeline) {
+                skip |= ValidateShaderObjectDrawtimeState(last_bound_state, loc);
+            }
 
-        if (cb_state.activeFramebuffer && has_last_pipeline) {
-            skip |= ValidateCmdDrawFramebuffer(cb_state, *last_pipeline, vuid, loc);
-        }
-    } else if (bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR) {
-        skip |= ValidateRayTracingDynamicStateSetStatus(last_bound_state, loc);
-        if (!cb_state.unprotected) {
-            skip |= LogError(vuid.ray_query_protected_cb_03635, cb_state.GetObjectList(bind_point), loc,
-                             "called in a protected command buffer.");
+            if (cb_state.activeFramebuffer && has_last_pipeline) {
+                skip |= ValidateCmdDrawFramebuffer(cb_state, *last_pipeline, vuid, loc);
+            }
+        } else if (bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR) {
+            skip |= ValidateRayTracingDynamicStateSetStatus(last_bound_state, loc);
+            if (!cb_state.unprotected) {
+                skip |= LogError(vuid.ray_query_protected_cb_03635, cb_state.GetObjectList(bind_point), loc,
+                                 "called in a protected command buffer.");
+            }
         }
     }
 
     const vvl::Pipeline *pipeline = last_pipeline;
     // Now complete other state checks
-    if (pipeline) {
+    if (bindings_validated) {
+        // The same sets are bound and were found compatible, only their contents can have changed
+        if (pipeline) {
+            if (!pipeline->descriptor_buffer_mode) {
+                for (const auto &set_binding_pair : pipeline->active_slots) {
+                    skip |= validate_set_contents(set_binding_pair.first, set_binding_pair.second, pipeline->GetId());
+                }
+            }
+        } else if (cb_state.descriptor_buffer_binding_info.empty()) {
+            for (const auto &shader_state : last_bound_state.shader_object_states) {
+                if (!shader_state) {
+                    continue;
+                }
+                for (const auto &set_binding_pair : shader_state->active_slots) {
+                    skip |= validate_set_contents(set_binding_pair.first, set_binding_pair.second, shader_state->GetId());
+                }
+            }
+        }
+    } else if (pipeline) {
         for (const auto &ds : last_bound_state.per_set) {
             // TODO - This currently implicitly is checking for VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT being set
             if (pipeline->descriptor_buffer_mode) {
@@ -1627,28 +1725,7 @@ bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const V
                                          FormatHandle(set_handle).c_str(), set_index, FormatHandle(*pipeline_layout).c_str(),
                                          error_string.c_str());
                     } else {  // Valid set is bound and layout compatible, validate that it's updated
-                        // Pull the set node
-                        const auto *descriptor_set = set_info.bound_descriptor_set.get();
-                        assert(descriptor_set);
-                        // Validate the draw-time state for this descriptor set
-                        // We can skip validating the descriptor set if "nothing" has changed since the last validation.
-                        // Same set, no image layout changes, and same "pipeline state" (binding_req_map). If there are
-                        // any dynamic descriptors, always revalidate rather than caching the values. We currently only
-                        // apply this optimization if IsManyDescriptors is true, to avoid the overhead of copying the
-                        // binding_req_map which could potentially be expensive.
-                        bool need_validate =
-                            // Revalidate each time if the set has dynamic offsets
-                            set_info.dynamicOffsets.size() > 0 ||
-                            // Revalidate if descriptor set (or contents) has changed
-                            set_info.validated_set != descriptor_set ||
-                            set_info.validated_set_change_count != descriptor_set->GetChangeCount() ||
-                            (!disabled[image_layout_validation] &&
-                             set_info.validated_set_image_layout_change_count != cb_state.image_layout_change_count);
-
-                        if (need_validate) {
-                            skip |= ValidateDrawState(*descriptor_set, set_index, set_binding_pair.second, set_info.dynamicOffsets, cb_state,
-                                                      loc, vuid);
-                        }
+                        skip |= validate_set_contents(set_index, set_binding_pair.second, pipeline->GetId());
                     }
                 }
             }
@@ -1701,110 +1778,103 @@ bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const V
                                          FormatHandle(set_handle).c_str(), set_index, FormatHandle(shader_state->Handle()).c_str(),
                                          error_string.c_str());
                     } else {  // Valid set is bound and layout compatible, validate that it's updated
-                        // Pull the set node
-                        const auto *descriptor_set = set_info.bound_descriptor_set.get();
-                        assert(descriptor_set);
-                        // Validate the draw-time state for this descriptor set
-                        // We can skip validating the descriptor set if "nothing" has changed since the last validation.
-                        // Same set, no image layout changes, and same "pipeline state" (binding_req_map). If there are
-                        // any dynamic descriptors, always revalidate rather than caching the values.
-                        bool need_validate =
-                            // Revalidate each time if the set has dynamic offsets
-                            set_info.dynamicOffsets.size() > 0 ||
-                            // Revalidate if descriptor set (or contents) has changed
-                            set_info.validated_set != descriptor_set ||
-                            set_info.validated_set_change_count != descriptor_set->GetChangeCount() ||
-                            (!disabled[image_layout_validation] &&
-                             set_info.validated_set_image_layout_change_count != cb_state.image_layout_change_count);
-
-                        if (need_validate) {
-                            skip |= ValidateDrawState(*descriptor_set, set_index, set_binding_pair.second, set_info.dynamicOffsets, cb_state,
-                                                      loc, vuid);
-                        }
+                        skip |= validate_set_contents(set_index, set_binding_pair.second, shader_state->GetId());
                     }
                 }
             }
         }
     }
 
-    // Verify if push constants have been set
-    // NOTE: Currently not checking whether active push constants are compatible with the active pipeline, nor whether the
-    //       "life times" of push constants are correct.
-    //       Discussion on validity of these checks can be found at https://gitlab.khronos.org/vulkan/vulkan/-/issues/2602.
-    if (pipeline) {
-        auto const &pipeline_layout = pipeline->PipelineLayoutState();
-        if (!cb_state.push_constant_data_ranges || (pipeline_layout->push_constant_ranges == cb_state.push_constant_data_ranges)) {
-            for (const auto &stage : pipeline->stage_states) {
-                if (!stage.entrypoint || !stage.entrypoint->push_constant_variable) {
-                    continue;  // no static push constant in shader
-                }
+    if (!state_validated) {
+        // Verify if push constants have been set
+        // NOTE: Currently not checking whether active push constants are compatible with the active pipeline, nor whether the
+        //       "life times" of push constants are correct.
+        //       Discussion on validity of these checks can be found at https://gitlab.khronos.org/vulkan/vulkan/-/issues/2602.
+        if (pipeline) {
+            auto const &pipeline_layout = pipeline->PipelineLayoutState();
+            if (!cb_state.push_constant_data_ranges ||
+                (pipeline_layout->push_constant_ranges == cb_state.push_constant_data_ranges)) {
+                for (const auto &stage : pipeline->stage_states) {
+                    if (!stage.entrypoint || !stage.entrypoint->push_constant_variable) {
+                        continue;  // no static push constant in shader
+                    }
 
-                // Edge case where if the shader is using push constants statically and there never was a vkCmdPushConstants
-                if (!cb_state.push_constant_data_ranges && !enabled_features.maintenance4) {
-                    const LogObjectList objlist(cb_state.Handle(), pipeline_layout->Handle(), pipeline->Handle());
-                    skip |= LogError(vuid.push_constants_set_08602, objlist, loc,
-                                     "Shader in %s uses push-constant statically but vkCmdPushConstants was not called yet for "
-                                     "pipeline layout %s.",
-                                     string_VkShaderStageFlags(stage.GetStage()).c_str(),
-                                     FormatHandle(pipeline_layout->Handle()).c_str());
+                    // Edge case where if the shader is using push constants statically and there never was a vkCmdPushConstants
+                    if (!cb_state.push_constant_data_ranges && !enabled_features.maintenance4) {
+                        const LogObjectList objlist(cb_state.Handle(), pipeline_layout->Handle(), pipeline->Handle());
+                        skip |= LogError(vuid.push_constants_set_08602, objlist, loc,
+                                         "Shader in %s uses push-constant statically but vkCmdPushConstants was not called yet for "
+                                         "pipeline layout %s.",
+                                         string_VkShaderStageFlags(stage.GetStage()).c_str(),
+                                         FormatHandle(pipeline_layout->Handle()).c_str());
+                    }
                 }
             }
-        }
-    } else {
-        if (!cb_state.push_constant_data_ranges) {
-            for (const auto &stage : last_bound_state.shader_object_states) {
-                if (!stage || !stage->entrypoint || !stage->entrypoint->push_constant_variable) {
-                    continue;
-                }
-                // Edge case where if the shader is using push constants statically and there never was a vkCmdPushConstants
-                if (!cb_state.push_constant_data_ranges && !enabled_features.maintenance4) {
-                    const LogObjectList objlist(cb_state.Handle(), stage->Handle());
-                    skip |= LogError(vuid.push_constants_set_08602, objlist, loc,
-                                     "Shader in %s uses push-constant statically but vkCmdPushConstants was not called yet.",
-                                     string_VkShaderStageFlags(stage->create_info.stage).c_str());
+        } else {
+            if (!cb_state.push_constant_data_ranges) {
+                for (const auto &stage : last_bound_state.shader_object_states) {
+                    if (!stage || !stage->entrypoint || !stage->entrypoint->push_constant_variable) {
+                        continue;
+                    }
+                    // Edge case where if the shader is using push constants statically and there never was a vkCmdPushConstants
+                    if (!cb_state.push_constant_data_ranges && !enabled_features.maintenance4) {
+                        const LogObjectList objlist(cb_state.Handle(), stage->Handle());
+                        skip |= LogError(vuid.push_constants_set_08602, objlist, loc,
+                                         "Shader in %s uses push-constant statically but vkCmdPushConstants was not called yet.",
+                                         string_VkShaderStageFlags(stage->create_info.stage).c_str());
+                    }
                 }
             }
         }
-    }
 
-    if (pipeline) {
-        if ((pipeline->create_info_shaders & (VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT |
-                                              VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT | VK_SHADER_STAGE_GEOMETRY_BIT)) != 0) {
-            for (const auto &query : cb_state.activeQueries) {
-                const auto query_pool_state = Get<vvl::QueryPool>(query.pool);
-                if (query_pool_state && query_pool_state->create_info.queryType == VK_QUERY_TYPE_MESH_PRIMITIVES_GENERATED_EXT) {
-                    const LogObjectList objlist(cb_state.Handle(), query.pool);
-                    skip |= LogError(vuid.mesh_shader_queries_07073, objlist, loc,
-                                     "Query (slot %" PRIu32 ") with type VK_QUERY_TYPE_MESH_PRIMITIVES_GENERATED_EXT is active.",
-                                     query.slot);
+        if (pipeline) {
+            if ((pipeline->create_info_shaders &
+                 (VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT |
+                  VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT | VK_SHADER_STAGE_GEOMETRY_BIT)) != 0) {
+                vvl::EpochGuard epoch_guard;
+                for (const auto &query : cb_state.activeQueries) {
+                    const auto query_pool_state = GetBorrowed<vvl::QueryPool>(query.pool);
+                    if (query_pool_state &&
+                        query_pool_state->create_info.queryType == VK_QUERY_TYPE_MESH_PRIMITIVES_GENERATED_EXT) {
+                        const LogObjectList objlist(cb_state.Handle(), query.pool);
+                        skip |= LogError(vuid.mesh_shader_queries_07073, objlist, loc,
+                                         "Query (slot %" PRIu32
+                                         ") with type VK_QUERY_TYPE_MESH_PRIMITIVES_GENERATED_EXT is active.",
+                                         query.slot);
+                    }
                 }
             }
         }
-    }
 
-    if (!cb_state.unprotected) {
-        if (pipeline) {
-            for (const auto &stage : pipeline->stage_states) {
-                // Stage may not have SPIR-V data (e.g. due to the use of shader module identifier or in Vulkan SC)
-                if (!stage.spirv_state) continue;
-
-                if (stage.spirv_state->HasCapability(spv::CapabilityRayQueryKHR)) {
-                    skip |= LogError(vuid.ray_query_04617, cb_state.GetObjectList(bind_point), loc,
-                                     "Shader in %s uses OpCapability RayQueryKHR but the command buffer is protected.",
-                                     string_VkShaderStageFlags(stage.GetStage()).c_str());
+        if (!cb_state.unprotected) {
+            if (pipeline) {
+                for (const auto &stage : pipeline->stage_states) {
+                    // Stage may not have SPIR-V data (e.g. due to the use of shader module identifier or in Vulkan SC)
+                    if (!stage.spirv_state) continue;
+
+                    if (stage.spirv_state->HasCapability(spv::CapabilityRayQueryKHR)) {
+                        skip |= LogError(vuid.ray_query_04617, cb_state.GetObjectList(bind_point), loc,
+                                         "Shader in %s uses OpCapability RayQueryKHR but the command buffer is protected.",
+                                         string_VkShaderStageFlags(stage.GetStage()).c_str());
+                    }
                 }
-            }
-        } else {
-            for (const auto &stage : last_bound_state.shader_object_states) {
-                if (stage && stage->spirv->HasCapability(spv::CapabilityRayQueryKHR)) {
-                    skip |= LogError(vuid.ray_query_04617, cb_state.GetObjectList(bind_point), loc,
-                                     "Shader in %s uses OpCapability RayQueryKHR but the command buffer is protected.",
-                                     string_VkShaderStageFlags(stage->create_info.stage).c_str());
+            } else {
+                for (const auto &stage : last_bound_state.shader_object_states) {
+                    if (stage && stage->spirv->HasCapability(spv::CapabilityRayQueryKHR)) {
+                        skip |= LogError(vuid.ray_query_04617, cb_state.GetObjectList(bind_point), loc,
+                                         "Shader in %s uses OpCapability RayQueryKHR but the command buffer is protected.",
+                                         string_VkShaderStageFlags(stage->create_info.stage).c_str());
+                    }
                 }
             }
         }
     }
 
+    // Only a clean validation is remembered, the callback return value does not tell if an error was found
+    if (!bindings_validated && debug_report->error_message_count.load(std::memory_order_relaxed) == error_count) {
+        cb_state.validated_action_state[lv_bind_point] = {loc.function, 0};
+    }
+
     return skip;
 }
 
@@ -167,6 +167,41 @@ bool CoreChecks::ValidateImageAlignmentControlCreateInfo(const VkImageCreateInfo
     return skip;
 }
 
+// Returns false if the pNext chain of |format_info| has a struct that is not part of the key of the cached queries
+static bool GetImageFormatQuery(const VkPhysicalDeviceImageFormatInfo2 &format_info, bool properties2,
+                                vvl::PhysicalDevice::ImageFormatQuery &query) {
+    query.properties2 = properties2;
+    query.format = format_info.format;
+    query.type = format_info.type;
+    query.tiling = format_info.tiling;
+    query.usage = format_info.usage;
+    query.flags = format_info.flags;
+    if (!properties2) {
+        return true;
+    }
+    for (auto *next = static_cast<const VkBaseInStructure *>(format_info.pNext); next; next = next->pNext) {
+        switch (next->sType) {
+            case VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO:
+                query.stencil_usage = reinterpret_cast<const VkImageStencilUsageCreateInfo *>(next)->stencilUsage;
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO:
+                query.external_handle_type = reinterpret_cast<const VkPhysicalDeviceExternalImageFormatInfo *>(next)->handleType;
+                break;
+            case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO: {
+                auto *format_list = reinterpret_cast<const VkImageFormatListCreateInfo *>(next);
+                if (format_list->pViewFormats) {
+                    query.view_formats.assign(format_list->pViewFormats,
+                                              format_list->pViewFormats + format_list->viewFormatCount);
+                }
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
 bool CoreChecks::PreCallValidateCreateImage(VkDevice device, const VkImageCreateInfo *pCreateInfo,
                                             const VkAllocationCallbacks *pAllocator, VkImage *pImage,
                                             const ErrorObject &error_obj) const {
@@ -254,12 +289,25 @@ bool CoreChecks::PreCallValidateCreateImage(VkDevice device, const VkImageCreate
     // Exit early if any thing is not succesful
     VkResult result = VK_SUCCESS;
     if (pCreateInfo->tiling != VK_IMAGE_TILING_DRM_FORMAT_MODIFIER_EXT) {
-        if (IsExtEnabled(device_extensions.vk_khr_get_physical_device_properties2)) {
-            result = DispatchGetPhysicalDeviceImageFormatProperties2(physical_device, &image_format_info, &image_format_properties);
+        const bool properties2 = IsExtEnabled(device_extensions.vk_khr_get_physical_device_properties2);
+        vvl::PhysicalDevice::ImageFormatQuery query;
+        vvl::PhysicalDevice::ImageFormatQueryResult query_result;
+        const bool cacheable = GetImageFormatQuery(image_format_info, properties2, query);
+        if (cacheable && physical_device_state->FindImageFormatQuery(query, query_result)) {
+            result = query_result.result;
+            image_format_properties.imageFormatProperties = query_result.properties;
         } else {
-            result = DispatchGetPhysicalDeviceImageFormatProperties(physical_device, pCreateInfo->format, pCreateInfo->imageType,
-                                                                    pCreateInfo->tiling, pCreateInfo->usage, pCreateInfo->flags,
-                                                                    &image_format_properties.imageFormatProperties);
+            if (properties2) {
+                result =
+                    DispatchGetPhysicalDeviceImageFormatProperties2(physical_device, &image_format_info, &image_format_properties);
+            } else {
+                result = DispatchGetPhysicalDeviceImageFormatProperties(
+                    physical_device, pCreateInfo->format, pCreateInfo->imageType, pCreateInfo->tiling, pCreateInfo->usage,
+                    pCreateInfo->flags, &image_format_properties.imageFormatProperties);
+            }
+            if (cacheable) {
+                physical_device_state->AddImageFormatQuery(query, {result, image_format_properties.imageFormatProperties});
+            }
         }
 
         // 1. vkGetPhysicalDeviceImageFormatProperties[2] only success code is VK_SUCCESS
@@ -212,6 +212,29 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const vvl::Comm
         // Note: don't know if it would matter
         // if (global_map->empty() && overlay_map->empty()) // skip this next loop...;
 
+        // Earlier command buffers of the submission did not change the image, and the global layouts did not change since
+        // the initial layouts last matched them
+        const auto &cb_subres_map = *layout_map_entry.second.map;
+        const uint64_t global_generation = global_map->Generation();
+        const bool overlay_empty = overlay_map->empty();
+        if (overlay_empty && cb_subres_map.IsValidatedAgainst(global_generation)) {
+            sparse_container::splice(*overlay_map, layout_map, GlobalLayoutUpdater());
+            continue;
+        }
+
+        // The whole image is in a single layout both in the command buffer and globally, that layout is all there is to check.
+        // Anything else, including layouts that only match per aspect, goes through the loop below.
+        if (cb_subres_map.IsUniform() && overlay_empty && global_map->size() == 1 &&
+            global_map->begin()->first == layout_map.begin()->first) {
+            const VkImageLayout initial_layout = layout_map.begin()->second.initial_layout;
+            if (initial_layout == VK_IMAGE_LAYOUT_UNDEFINED || initial_layout == global_map->begin()->second) {
+                cb_subres_map.SetValidatedAgainst(global_generation);
+                sparse_container::splice(*overlay_map, layout_map, GlobalLayoutUpdater());
+                continue;
+            }
+        }
+
+        bool mismatch = false;
         auto pos = layout_map.begin();
         const auto end = layout_map.end();
         sparse_container::parallel_iterator<const GlobalImageLayoutRangeMap> current_layout(*overlay_map, *global_map,
@@ -238,6 +261,7 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const vvl::Comm
                 const auto aspect_mask = image_state->subresource_encoder.Decode(intersected_range.begin).aspectMask;
                 const bool matches = ImageLayoutMatches(aspect_mask, image_layout, initial_layout);
                 if (!matches) {
+                    mismatch = true;
                     // We can report all the errors for the intersected range directly
                     for (auto index : sparse_container::range_view<decltype(intersected_range)>(intersected_range)) {
                         const auto subresource = image_state->subresource_encoder.Decode(index);
@@ -260,6 +284,9 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const vvl::Comm
                 }
             }
         }
+        if (overlay_empty && !mismatch) {
+            cb_subres_map.SetValidatedAgainst(global_generation);
+        }
         // Update all layout set operations (which will be a subset of the initial_layouts)
         sparse_container::splice(*overlay_map, layout_map, GlobalLayoutUpdater());
     }
@@ -273,7 +300,10 @@ void CoreChecks::UpdateCmdBufImageLayouts(const vvl::CommandBuffer &cb_state) {
         const auto image_state = Get<vvl::Image>(image);
         if (image_state && image_state->GetId() == layout_map_entry.second.id && layout_map_entry.second.map) {
             auto guard = image_state->layout_range_map->WriteLock();
-            sparse_container::splice(*image_state->layout_range_map, layout_map_entry.second.map->GetLayoutMap(), GlobalLayoutUpdater());
+            if (sparse_container::splice(*image_state->layout_range_map, layout_map_entry.second.map->GetLayoutMap(),
+                                         GlobalLayoutUpdater())) {
+                image_state->layout_range_map->SetChanged();
+            }
         }
     }
 }
@@ -472,7 +502,7 @@ bool CoreChecks::ValidateRenderPassStencilLayoutAgainstFramebufferImageUsage(VkI
 
 bool CoreChecks::VerifyFramebufferAndRenderPassLayouts(const vvl::CommandBuffer &cb_state, const VkRenderPassBeginInfo &begin_info,
                                                        const vvl::RenderPass &render_pass_state,
-                                                       const vvl::Framebuffer &framebuffer_state,
+                                                       const vvl::Framebuffer &framebuffer_state, bool usage_validated,
                                                        const Location &rp_begin_loc) const {
     bool skip = false;
     const auto *render_pass_info = render_pass_state.create_info.ptr();
@@ -601,6 +631,10 @@ bool CoreChecks::VerifyFramebufferAndRenderPassLayouts(const vvl::CommandBuffer
                     return subres_skip;
                 });
         }
+        // The image layouts above depend on the command buffer, the usage checks below only on the framebuffer
+        if (usage_validated) {
+            continue;
+        }
         skip |= ValidateRenderPassLayoutAgainstFramebufferImageUsage(
             attachment_initial_layout, *view_state, framebuffer, render_pass, i, rp_loc, attachment_loc.dot(Field::initialLayout));
 
@@ -617,6 +651,10 @@ bool CoreChecks::VerifyFramebufferAndRenderPassLayouts(const vvl::CommandBuffer
         }
     }
 
+    if (usage_validated) {
+        return skip;
+    }
+
     for (uint32_t j = 0; j < render_pass_info->subpassCount; ++j) {
         const Location subpass_loc = rp_create_info.dot(Field::pSubpasses, j);
         auto &subpass = render_pass_info->pSubpasses[j];
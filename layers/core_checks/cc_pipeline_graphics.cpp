@@ -42,6 +42,29 @@ bool CoreChecks::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipel
     bool skip = StateTracker::PreCallValidateCreateGraphicsPipelines(device, pipelineCache, count, pCreateInfos, pAllocator,
                                                                      pPipelines, error_obj, pipeline_states, chassis_state);
 
+    SpecializePipelineStages(pipeline_states);
+
+    // The pipelines only read their own state and the one of the objects they use, so with several create infos they are
+    // validated on the shader validation threads. Their messages are delivered in create info order, the output is the same
+    // as validating them one after the other.
+    if (shader_validation_pool_ && count > 1) {
+        DebugReport::OrderedMessages pipeline_messages(*debug_report, count);
+        std::vector<uint8_t> pipeline_skip(count, 0);
+        shader_validation_pool_->ParallelFor(count, [&](uint32_t i) {
+            pipeline_messages.Capture(i, [&]() {
+                const Location create_info_loc = error_obj.location.dot(Field::pCreateInfos, i);
+                bool pipeline_skip_i = ValidateGraphicsPipeline(*pipeline_states[i].get(), create_info_loc);
+                pipeline_skip_i |= ValidateGraphicsPipelineDerivatives(pipeline_states, i, create_info_loc);
+                pipeline_skip[i] = pipeline_skip_i;
+            });
+        });
+        for (uint32_t i = 0; i < count; i++) {
+            skip |= pipeline_skip[i] != 0;
+        }
+        skip |= pipeline_messages.Deliver();
+        return skip;
+    }
+
     for (uint32_t i = 0; i < count; i++) {
         const Location create_info_loc = error_obj.location.dot(Field::pCreateInfos, i);
         skip |= ValidateGraphicsPipeline(*pipeline_states[i].get(), create_info_loc);
@@ -1342,7 +1365,8 @@ bool CoreChecks::ValidateGraphicsPipelineInputAssemblyState(const vvl::Pipeline
 
     // if vertex_input_state is not set, will be null
     const auto *ia_state = pipeline.InputAssemblyState();
-    if (ia_state) {
+    // The input assembly state of a linked vertex input library was validated when the library was created
+    if (ia_state && pipeline.OwnsSubState(pipeline.vertex_input_state)) {
         const VkPrimitiveTopology topology = ia_state->topology;
         if ((ia_state->primitiveRestartEnable == VK_TRUE) &&
             IsValueIn(topology, {VK_PRIMITIVE_TOPOLOGY_POINT_LIST, VK_PRIMITIVE_TOPOLOGY_LINE_LIST,
@@ -1376,9 +1400,16 @@ bool CoreChecks::ValidateGraphicsPipelineInputAssemblyState(const vvl::Pipeline
                              "topology is %s and tessellationShader feature was not enabled.",
                              string_VkPrimitiveTopology(topology));
         }
+    }
 
+    // pre_raster has rasterization state and tessellation stage, vertex input has topology
+    // Both are needed for these checks, when linking they are only validated again if they come from different libraries
+    const bool validate_with_pre_raster =
+        pipeline.pre_raster_state && pipeline.vertex_input_state &&
+        !pipeline.SubStatesLinkedFromSameLibrary(pipeline.vertex_input_state, pipeline.pre_raster_state);
+    if (ia_state && validate_with_pre_raster) {
+        const VkPrimitiveTopology topology = ia_state->topology;
         if (!phys_dev_ext_props.conservative_rasterization_props.conservativePointAndLineRasterization &&
-            pipeline.vertex_input_state && pipeline.pre_raster_state &&
             (pipeline.create_info_shaders & VK_SHADER_STAGE_GEOMETRY_BIT) == 0 &&
             IsValueIn(topology,
                       {VK_PRIMITIVE_TOPOLOGY_POINT_LIST, VK_PRIMITIVE_TOPOLOGY_LINE_LIST, VK_PRIMITIVE_TOPOLOGY_LINE_STRIP})) {
@@ -1404,9 +1435,7 @@ bool CoreChecks::ValidateGraphicsPipelineInputAssemblyState(const vvl::Pipeline
 
     const bool ignore_topology = pipeline.IsDynamic(VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY) &&
                                  phys_dev_ext_props.extended_dynamic_state3_props.dynamicPrimitiveTopologyUnrestricted;
-    // pre_raster has tessellation stage, vertex input has topology
-    // Both are needed for these checks
-    if (!ignore_topology && pipeline.pre_raster_state && pipeline.vertex_input_state) {
+    if (!ignore_topology && validate_with_pre_raster) {
         // Either both or neither TC/TE shaders should be defined
         const bool has_control = (pipeline.active_shaders & VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT) != 0;
         const bool has_eval = (pipeline.active_shaders & VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT) != 0;
@@ -1678,7 +1707,8 @@ bool CoreChecks::ValidateGraphicsPipelineColorBlendState(const vvl::Pipeline &pi
     bool skip = false;
     const Location color_loc = create_info_loc.dot(Field::pColorBlendState);
     const auto color_blend_state = pipeline.ColorBlendState();
-    if (!color_blend_state) {
+    // The color blend state of a linked fragment output library was validated when the library was created
+    if (!color_blend_state || !pipeline.OwnsSubState(pipeline.fragment_output_state)) {
         return skip;
     }
     const auto &rp_state = pipeline.RenderPassState();
@@ -3223,12 +3253,12 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LastBound &last_bound_state
     // Verify vertex & index buffer for unprotected command buffer.
     // Because vertex & index buffer is read only, it doesn't need to care protected command buffer case.
     if (enabled_features.protectedMemory == VK_TRUE) {
-        for (const auto &vertex_buffer_binding : cb_state.current_vertex_buffer_binding_info) {
-            if (const auto buffer_state = Get<vvl::Buffer>(vertex_buffer_binding.second.buffer)) {
+        cb_state.current_vertex_buffer_binding_info.ForEach([&](uint32_t, const vvl::VertexBufferBinding &vertex_buffer_binding) {
+            if (const auto buffer_state = Get<vvl::Buffer>(vertex_buffer_binding.buffer)) {
                 skip |= ValidateProtectedBuffer(cb_state, *buffer_state, loc, vuid.unprotected_command_buffer_02707,
                                                 "Buffer is vertex buffer");
             }
-        }
+        });
 
         if (const auto buffer_state = Get<vvl::Buffer>(cb_state.index_buffer_binding.buffer)) {
             skip |= ValidateProtectedBuffer(cb_state, *buffer_state, loc, vuid.unprotected_command_buffer_02707,
@@ -3243,29 +3273,30 @@ bool CoreChecks::ValidatePipelineDrawtimeState(const LastBound &last_bound_state
             bound_pipeline_bindings.insert(description.binding);
         }
 
-        for (const auto &vertex_buffer_binding : cb_state.current_vertex_buffer_binding_info) {
+        const auto &vertex_buffer_bindings = cb_state.current_vertex_buffer_binding_info;
+        vertex_buffer_bindings.ForEach([&](uint32_t binding, const vvl::VertexBufferBinding &vertex_buffer_binding) {
             // Only validate the bindings from the last bound pipeline (unlesss it used VK_DYNAMIC_STATE_VERTEX_INPUT_EXT)
             if (!pipeline->IsDynamic(VK_DYNAMIC_STATE_VERTEX_INPUT_EXT) &&
-                bound_pipeline_bindings.find(vertex_buffer_binding.first) == bound_pipeline_bindings.end()) {
-                continue;
+                bound_pipeline_bindings.find(binding) == bound_pipeline_bindings.end()) {
+                return;
             }
 
-            if (vertex_buffer_binding.second.buffer == VK_NULL_HANDLE) {
+            if (vertex_buffer_binding.buffer == VK_NULL_HANDLE) {
                 if (!enabled_features.nullDescriptor) {
                     const LogObjectList objlist(cb_state.Handle(), pipeline->Handle());
                     skip |= LogError(vuid.vertex_binding_null_04008, objlist, loc,
                                      "Vertex binding %" PRIu32
                                      " is VK_NULL_HANDLE. (Most likely you forgot to call vkCmdBindVertexBuffers)",
-                                     vertex_buffer_binding.first);
+                                     binding);
                 }
-            } else if (!Get<vvl::Buffer>(vertex_buffer_binding.second.buffer)) {
+            } else if (!Get<vvl::Buffer>(vertex_buffer_binding.buffer)) {
                 const LogObjectList objlist(cb_state.Handle(), pipeline->Handle());
                 skip |=
                     LogError(vuid.vertex_binding_04007, objlist, loc,
                              "Vertex binding %" PRIu32 " is not a valid VkBuffer. (Check the buffer set in vkCmdBindVertexBuffers)",
-                             vertex_buffer_binding.first);
+                             binding);
             }
-        }
+        });
 
         skip |= ValidateVertexAttribute(cb_state, *pipeline, loc, vuid);
     }
@@ -3414,6 +3445,26 @@ bool CoreChecks::ValidateShaderObjectDrawtimeState(const LastBound &last_bound_s
     const vvl::CommandBuffer &cb_state = last_bound_state.cb_state;
     const LogObjectList objlist(cb_state.Handle());
     const vvl::DrawDispatchVuid &vuid = vvl::GetDrawDispatchVuid(loc.function);
+    const bool mesh_draw = loc.function == Func::vkCmdDrawMeshTasksNV || loc.function == Func::vkCmdDrawMeshTasksIndirectNV ||
+                           loc.function == Func::vkCmdDrawMeshTasksIndirectCountNV ||
+                           loc.function == Func::vkCmdDrawMeshTasksEXT || loc.function == Func::vkCmdDrawMeshTasksIndirectEXT ||
+                           loc.function == Func::vkCmdDrawMeshTasksIndirectCountEXT;
+
+    // The checks only depend on the bound shaders (and the enabled features), a combination that passed passes again
+    using ValidatedKey = vvl::CommandBuffer::ValidatedShaderObjects::Key;
+    ValidatedKey validated_key{};
+    validated_key.mesh_draw = mesh_draw;
+    for (uint32_t stage = 0; stage < kShaderObjectStageCount; ++stage) {
+        if (last_bound_state.shader_object_bound[stage]) {
+            const auto *shader_state = last_bound_state.shader_object_states[stage];
+            validated_key.ids[stage] = shader_state ? shader_state->GetId() : ValidatedKey::kNullShader;
+        }
+    }
+    auto &validated_combinations = cb_state.validated_shader_objects.combinations;
+    if (validated_combinations.find(validated_key) != validated_combinations.end()) {
+        return skip;
+    }
+    const uint64_t error_count = debug_report->error_message_count.load(std::memory_order_relaxed);
 
     if (!last_bound_state.IsValidShaderOrNullBound(ShaderObjectStage::VERTEX)) {
         skip |= LogError(vuid.vertex_shader_08684, objlist, loc,
@@ -3612,10 +3663,13 @@ bool CoreChecks::ValidateShaderObjectDrawtimeState(const LastBound &last_bound_s
         }
     }
 
-    if (loc.function != Func::vkCmdDrawMeshTasksNV && loc.function != Func::vkCmdDrawMeshTasksIndirectNV &&
-        loc.function != Func::vkCmdDrawMeshTasksIndirectCountNV && loc.function != Func::vkCmdDrawMeshTasksEXT &&
-        loc.function != Func::vkCmdDrawMeshTasksIndirectEXT && loc.function != Func::vkCmdDrawMeshTasksIndirectCountEXT) {
-        ValidateShaderObjectGraphicsDrawtimeState(last_bound_state, loc);
+    if (!mesh_draw) {
+        skip |= ValidateShaderObjectGraphicsDrawtimeState(last_bound_state, loc);
+    }
+
+    // Only a clean validation is remembered, the callback return value does not tell if an error was found
+    if (debug_report->error_message_count.load(std::memory_order_relaxed) == error_count) {
+        validated_combinations.emplace(validated_key);
     }
 
     return skip;
@@ -4407,21 +4461,21 @@ bool CoreChecks::ValidateVertexAttribute(const vvl::CommandBuffer &cb_state, con
         const auto &attribute_description = vertex_attribute_descriptions[i];
         const uint32_t vertex_binding = attribute_description.binding;
 
-        const auto &vertex_binding_map_it = cb_state.current_vertex_buffer_binding_info.find(vertex_binding);
-        if (vertex_binding_map_it == cb_state.current_vertex_buffer_binding_info.cend()) {
+        const vvl::VertexBufferBinding *vertex_buffer_binding = cb_state.current_vertex_buffer_binding_info.Find(vertex_binding);
+        if (!vertex_buffer_binding) {
             const LogObjectList objlist(cb_state.Handle(), pipeline.Handle());
             skip |=
                 LogError(vuid.vertex_binding_attribute_02721, objlist, loc,
                          "pVertexAttributeDescriptions[%" PRIu32 "].binding (%" PRIu32 ") is an invalid value.", vertex_binding, i);
             break;
-        } else if (vertex_binding_map_it->second.buffer == VK_NULL_HANDLE && !enabled_features.nullDescriptor) {
+        } else if (vertex_buffer_binding->buffer == VK_NULL_HANDLE && !enabled_features.nullDescriptor) {
             const LogObjectList objlist(cb_state.Handle(), pipeline.Handle());
             skip |= LogError(vuid.vertex_binding_attribute_02721, objlist, loc,
                              "pVertexAttributeDescriptions[%" PRIu32 "].binding (%" PRIu32 ") points to a VK_NULL_HANDLE buffer.",
                              vertex_binding, i);
             break;
         }
-        auto const buffer_state = Get<vvl::Buffer>(vertex_binding_map_it->second.buffer);
+        auto const buffer_state = Get<vvl::Buffer>(vertex_buffer_binding->buffer);
         if (!buffer_state) {
             const LogObjectList objlist(cb_state.Handle(), pipeline.Handle());
             skip |= LogError(vuid.vertex_binding_attribute_02721, objlist, loc,
@@ -4432,7 +4486,7 @@ bool CoreChecks::ValidateVertexAttribute(const vvl::CommandBuffer &cb_state, con
 
         const VkDeviceSize attribute_offset = attribute_description.offset;
         const VkFormat attribute_format = attribute_description.format;
-        const VkDeviceSize vertex_buffer_stride = vertex_binding_map_it->second.stride;
+        const VkDeviceSize vertex_buffer_stride = vertex_buffer_binding->stride;
         if (pipeline.IsDynamic(VK_DYNAMIC_STATE_VERTEX_INPUT_BINDING_STRIDE_EXT)) {
             const VkDeviceSize attribute_binding_extent = attribute_offset + vkuFormatElementSize(attribute_format);
             if (vertex_buffer_stride != 0 && vertex_buffer_stride < attribute_binding_extent) {
@@ -4444,7 +4498,7 @@ bool CoreChecks::ValidateVertexAttribute(const vvl::CommandBuffer &cb_state, con
                                  vertex_binding, vertex_buffer_stride, loc.StringFunc(), i, attribute_binding_extent);
             }
         }
-        const VkDeviceSize vertex_buffer_offset = vertex_binding_map_it->second.offset;
+        const VkDeviceSize vertex_buffer_offset = vertex_buffer_binding->offset;
 
         // Use 1 as vertex/instance index to use buffer stride as well
         const VkDeviceSize attrib_address = vertex_buffer_offset + vertex_buffer_stride + attribute_offset;
@@ -35,10 +35,11 @@ struct CommandBufferSubmitState {
     const vvl::Queue *queue_state;
     QFOTransferCBScoreboards<QFOImageTransferBarrier> qfo_image_scoreboards;
     QFOTransferCBScoreboards<QFOBufferTransferBarrier> qfo_buffer_scoreboards;
-    std::vector<VkCommandBuffer> current_cmds;
+    // Number of times each command buffer was seen so far in the submission
+    vvl::unordered_map<VkCommandBuffer, uint32_t> current_cmd_counts;
     GlobalImageLayoutMap overlay_image_layout_map;
-    std::vector<std::string> cmdbuf_label_stack;
-    std::string last_closed_cmdbuf_label;
+    std::vector<std::string_view> cmdbuf_label_stack;
+    std::string_view last_closed_cmdbuf_label;
     bool found_unbalanced_cmdbuf_label;
 
     // The "local" prefix is about tracking state within a *single* queue submission
@@ -59,11 +60,9 @@ struct CommandBufferSubmitState {
     bool Validate(const Location &loc, const vvl::CommandBuffer &cb_state, uint32_t perf_pass) {
         bool skip = false;
         skip |= core.ValidateCmdBufImageLayouts(loc, cb_state, overlay_image_layout_map);
-        const VkCommandBuffer cmd = cb_state.VkHandle();
-        current_cmds.push_back(cmd);
-        skip |= core.ValidatePrimaryCommandBufferState(
-            loc, cb_state, static_cast<uint32_t>(std::count(current_cmds.begin(), current_cmds.end(), cmd)), &qfo_image_scoreboards,
-            &qfo_buffer_scoreboards);
+        const uint32_t current_submit_count = ++current_cmd_counts[cb_state.VkHandle()];
+        skip |= core.ValidatePrimaryCommandBufferState(loc, cb_state, current_submit_count, &qfo_image_scoreboards,
+                                                       &qfo_buffer_scoreboards);
         skip |= core.ValidateQueueFamilyIndices(loc, cb_state, *queue_state);
         skip |= ValidateCmdBufLabelMatching(loc, cb_state);
 
@@ -124,8 +123,9 @@ private:
             if (last_closed_cmdbuf_label.empty()) {
                 previous_debug_region = "There are no previous debug regions before the invalid command.";
             } else {
-                previous_debug_region =
-                    std::string("The previous debug region before the invalid command is '") + last_closed_cmdbuf_label + "'.";
+                previous_debug_region = "The previous debug region before the invalid command is '";
+                previous_debug_region += last_closed_cmdbuf_label;
+                previous_debug_region += "'.";
             }
             skip |= core.LogError("VUID-vkCmdEndDebugUtilsLabelEXT-commandBuffer-01912", cb_state.Handle(), loc,
                                   "(%s) contains vkCmdEndDebugUtilsLabelEXT that does not have a matching "
@@ -157,11 +157,45 @@ bool CoreChecks::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount,
         uint32_t perf_pass = perf_submit ? perf_submit->counterPassIndex : 0;
 
         const Location submit_loc = error_obj.location.dot(Struct::VkSubmitInfo, Field::pSubmits, submit_idx);
+
+        bool protected_submit = false;
+
+        auto protected_submit_info = vku::FindStructInPNextChain<VkProtectedSubmitInfo>(submit.pNext);
+        if (protected_submit_info) {
+            protected_submit = protected_submit_info->protectedSubmit == VK_TRUE;
+            if ((protected_submit == true) && ((queue_state->flags & VK_DEVICE_QUEUE_CREATE_PROTECTED_BIT) == 0)) {
+                skip |= LogError("VUID-vkQueueSubmit-queue-06448", queue, submit_loc,
+                                 "contains a protected submission to %s which was not created with "
+                                 "VK_DEVICE_QUEUE_CREATE_PROTECTED_BIT",
+                                 FormatHandle(queue).c_str());
+            }
+        }
+
+        // Each command buffer is fetched and locked once, for all of its checks
         bool suspended_render_pass_instance = false;
         for (uint32_t i = 0; i < submit.commandBufferCount; i++) {
+            ApplyDeferredInvalidations(submit.pCommandBuffers[i]);
             auto cb_state = GetRead<vvl::CommandBuffer>(submit.pCommandBuffers[i]);
             if (cb_state) {
-                skip |= cb_submit_state.Validate(submit_loc.dot(Field::pCommandBuffers, i), *cb_state, perf_pass);
+                const Location cb_loc = submit_loc.dot(Field::pCommandBuffers, i);
+                skip |= cb_submit_state.Validate(cb_loc, *cb_state, perf_pass);
+
+                // Make sure command buffers are all protected or unprotected
+                if ((cb_state->unprotected == true) && (protected_submit == true)) {
+                    const LogObjectList objlist(cb_state->Handle(), queue);
+                    skip |= LogError("VUID-VkSubmitInfo-pNext-04148", objlist, cb_loc,
+                                     "(%s) is unprotected while queue %s pSubmits[%u] has "
+                                     "VkProtectedSubmitInfo:protectedSubmit set to VK_TRUE",
+                                     FormatHandle(cb_state->Handle()).c_str(), FormatHandle(queue).c_str(), submit_idx);
+                }
+                if ((cb_state->unprotected == false) && (protected_submit == false)) {
+                    const LogObjectList objlist(cb_state->Handle(), queue);
+                    skip |= LogError("VUID-VkSubmitInfo-pNext-04120", objlist, cb_loc,
+                                     "(%s) is protected while queue %s pSubmits[%u] has %s",
+                                     FormatHandle(cb_state->Handle()).c_str(), FormatHandle(queue).c_str(), submit_idx,
+                                     protected_submit_info ? "VkProtectedSubmitInfo:protectedSubmit set to VK_FALSE"
+                                                           : "no VkProtectedSubmitInfo in the pNext chain");
+                }
 
                 // Validate flags for dynamic rendering
                 if (suspended_render_pass_instance && cb_state->hasRenderPassInstance && !cb_state->resumesRenderPassInstance) {
@@ -172,9 +206,8 @@ bool CoreChecks::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount,
                 }
                 if (cb_state->resumesRenderPassInstance) {
                     if (!suspended_render_pass_instance) {
-                        skip |=
-                            LogError("VUID-VkSubmitInfo-pCommandBuffers-06193", queue, submit_loc.dot(Field::pCommandBuffers, i),
-                                     "resumes a render pass instance, but there is no suspended render pass instance.");
+                        skip |= LogError("VUID-VkSubmitInfo-pCommandBuffers-06193", queue, cb_loc,
+                                         "resumes a render pass instance, but there is no suspended render pass instance.");
                     }
                     suspended_render_pass_instance = false;
                 }
@@ -218,42 +251,6 @@ bool CoreChecks::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount,
                                  chained_device_group_struct->commandBufferCount, submit.commandBufferCount);
             }
         }
-
-        bool protected_submit = false;
-
-        auto protected_submit_info = vku::FindStructInPNextChain<VkProtectedSubmitInfo>(submit.pNext);
-        if (protected_submit_info) {
-            protected_submit = protected_submit_info->protectedSubmit == VK_TRUE;
-            if ((protected_submit == true) && ((queue_state->flags & VK_DEVICE_QUEUE_CREATE_PROTECTED_BIT) == 0)) {
-                skip |= LogError("VUID-vkQueueSubmit-queue-06448", queue, submit_loc,
-                                 "contains a protected submission to %s which was not created with "
-                                 "VK_DEVICE_QUEUE_CREATE_PROTECTED_BIT",
-                                 FormatHandle(queue).c_str());
-            }
-        }
-
-        // Make sure command buffers are all protected or unprotected
-        for (uint32_t i = 0; i < submit.commandBufferCount; i++) {
-            const Location cb_loc = submit_loc.dot(Field::pCommandBuffers, i);
-            auto cb_state = GetRead<vvl::CommandBuffer>(submit.pCommandBuffers[i]);
-            if (cb_state) {
-                if ((cb_state->unprotected == true) && (protected_submit == true)) {
-                    const LogObjectList objlist(cb_state->Handle(), queue);
-                    skip |= LogError("VUID-VkSubmitInfo-pNext-04148", objlist, cb_loc,
-                                     "(%s) is unprotected while queue %s pSubmits[%u] has "
-                                     "VkProtectedSubmitInfo:protectedSubmit set to VK_TRUE",
-                                     FormatHandle(cb_state->Handle()).c_str(), FormatHandle(queue).c_str(), submit_idx);
-                }
-                if ((cb_state->unprotected == false) && (protected_submit == false)) {
-                    const LogObjectList objlist(cb_state->Handle(), queue);
-                    skip |= LogError("VUID-VkSubmitInfo-pNext-04120", objlist, cb_loc,
-                                     "(%s) is protected while queue %s pSubmits[%u] has %s",
-                                     FormatHandle(cb_state->Handle()).c_str(), FormatHandle(queue).c_str(), submit_idx,
-                                     protected_submit_info ? "VkProtectedSubmitInfo:protectedSubmit set to VK_FALSE"
-                                                           : "no VkProtectedSubmitInfo in the pNext chain");
-                }
-            }
-        }
     }
 
     return skip;
@@ -337,9 +334,6 @@ bool CoreChecks::ValidateQueueSubmit2(VkQueue queue, uint32_t submitCount, const
         bool suspended_render_pass_instance = false;
         for (uint32_t i = 0; i < submit.commandBufferInfoCount; i++) {
             const Location info_loc = submit_loc.dot(Struct::VkCommandBufferSubmitInfo, Field::pCommandBufferInfos, i);
-            auto cb_state = GetRead<vvl::CommandBuffer>(submit.pCommandBufferInfos[i].commandBuffer);
-            skip |= cb_submit_state.Validate(info_loc.dot(Field::commandBuffer), *cb_state, perf_pass);
-
             {
                 const LogObjectList objlist(queue);
                 skip |= ValidateDeviceMaskToPhysicalDeviceCount(submit.pCommandBufferInfos[i].deviceMask, queue,
@@ -347,7 +341,12 @@ bool CoreChecks::ValidateQueueSubmit2(VkQueue queue, uint32_t submitCount, const
                                                                 "VUID-VkCommandBufferSubmitInfo-deviceMask-03891");
             }
 
+            // Each command buffer is fetched and locked once, for all of its checks
+            ApplyDeferredInvalidations(submit.pCommandBufferInfos[i].commandBuffer);
+            auto cb_state = GetRead<vvl::CommandBuffer>(submit.pCommandBufferInfos[i].commandBuffer);
             if (cb_state != nullptr) {
+                skip |= cb_submit_state.Validate(info_loc.dot(Field::commandBuffer), *cb_state, perf_pass);
+
                 // Make sure command buffers are all protected or unprotected
                 if ((cb_state->unprotected == true) && (protected_submit == true)) {
                     const LogObjectList objlist(cb_state->Handle(), queue);
@@ -591,6 +590,12 @@ bool CoreChecks::ValidatePrimaryCommandBufferState(
     // Track in-use for resources off of primary and any secondary CBs
     bool skip = false;
 
+    // The errors of the deferred validations are all reported before the submit goes down the chain
+    cb_state.WaitDeferredValidations();
+    for (const auto *sub_cb : cb_state.linkedCommandBuffers) {
+        sub_cb->WaitDeferredValidations();
+    }
+
     if (cb_state.IsSeconary()) {
         const auto &vuid = GetQueueSubmitVUID(loc, SubmitError::kSecondaryCmdInSubmit);
         skip |= LogError(vuid, cb_state.Handle(), loc, "Command buffer %s must be allocated with VK_COMMAND_BUFFER_LEVEL_PRIMARY.",
@@ -21,6 +21,8 @@
 #include <assert.h>
 #include <sstream>
 #include <string>
+#include <tuple>
+#include <vector>
 
 #include <vulkan/vk_enum_string_helper.h>
 #include "generated/chassis.h"
@@ -146,71 +148,153 @@ bool CoreChecks::PreCallValidateGetAccelerationStructureHandleNV(VkDevice device
     return skip;
 }
 
-bool CoreChecks::ValidateAccelerationStructuresMemoryAlisasing(const LogObjectList &objlist, uint32_t infoCount,
-                                                               const VkAccelerationStructureBuildGeometryInfoKHR *pInfos,
-                                                               uint32_t info_i, const ErrorObject &error_obj) const {
-    using sparse_container::range;
+namespace {
+// Range of device memory bound to one of the resources used by a build of a vkBuildAccelerationStructuresKHR-like call
+struct BuildMemoryRange {
+    enum class Role : uint8_t { Dst, Src, Scratch };
+
+    VkDeviceMemory memory;
+    sparse_container::range<VkDeviceSize> range;
+    uint32_t info_i;
+    Role role;
+};
+
+void AddBuildMemoryRanges(std::vector<BuildMemoryRange> &ranges, const vvl::Bindable &resource,
+                          const sparse_container::range<VkDeviceSize> &resource_range, uint32_t info_i,
+                          BuildMemoryRange::Role role) {
+    for (const auto &[memory, memory_ranges] : resource.GetBoundMemoryRange(resource_range)) {
+        for (const auto &memory_range : memory_ranges) {
+            ranges.push_back({memory, memory_range, info_i, role});
+        }
+    }
+}
 
-    bool skip = false;
-    const VkAccelerationStructureBuildGeometryInfoKHR &info = pInfos[info_i];
-    const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
-    const auto src_as_state = Get<vvl::AccelerationStructureKHR>(info.srcAccelerationStructure);
-    const auto dst_as_state = Get<vvl::AccelerationStructureKHR>(info.dstAccelerationStructure);
+// Uses the same resource range as ValidateAccelStructsMemoryDoNotOverlap
+void AddBuildMemoryRanges(std::vector<BuildMemoryRange> &ranges, const vvl::AccelerationStructureKHR &accel_struct,
+                          uint32_t info_i, BuildMemoryRange::Role role) {
+    const sparse_container::range<VkDeviceSize> range(accel_struct.create_info.offset, accel_struct.create_info.size);
+    AddBuildMemoryRanges(ranges, *accel_struct.buffer_state, range, info_i, role);
+}
 
-    const bool info_in_mode_update = info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
+// Calls func(a, b) for every pair of ranges of the same memory that may intersect.
+// The ranges are sorted by memory and start, and a sweep over them keeps the ranges that can still intersect the next one, so
+// pairs that are far apart are never compared. The pairs found are a superset of the intersecting ones, the caller is
+// expected to run the precise overlap check on them.
+template <typename Func>
+void ForEachIntersectingBuildMemoryRange(std::vector<BuildMemoryRange> &ranges, Func &&func) {
+    std::sort(ranges.begin(), ranges.end(), [](const BuildMemoryRange &a, const BuildMemoryRange &b) {
+        if (a.memory != b.memory) {
+            return HandleToUint64(a.memory) < HandleToUint64(b.memory);
+        }
+        return a.range.begin < b.range.begin;
+    });
 
-    if (info_in_mode_update && info.srcAccelerationStructure != info.dstAccelerationStructure && src_as_state && dst_as_state) {
-        const char *vuid = error_obj.location.function == Func::vkCmdBuildAccelerationStructuresKHR
-                               ? "VUID-vkCmdBuildAccelerationStructuresKHR-pInfos-03668"
-                           : error_obj.location.function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
-                               ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-pInfos-03668"
-                               : "VUID-vkBuildAccelerationStructuresKHR-pInfos-03668";
-        skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *src_as_state,
-                                                       info_i_loc.dot(Field::srcAccelerationStructure), *dst_as_state,
-                                                       info_i_loc.dot(Field::dstAccelerationStructure), vuid);
+    std::vector<const BuildMemoryRange *> active;
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        const BuildMemoryRange &range = ranges[i];
+        if (i > 0 && ranges[i - 1].memory != range.memory) {
+            active.clear();
+        }
+        // A range sorted before this one intersects it only if it ends past its start, or if both start at the same offset
+        const VkDeviceSize begin = range.range.begin;
+        active.erase(std::remove_if(active.begin(), active.end(),
+                                    [begin](const BuildMemoryRange *other) {
+                                        return other->range.end <= begin && other->range.begin != begin;
+                                    }),
+                     active.end());
+        for (const BuildMemoryRange *other : active) {
+            func(*other, range);
+        }
+        active.push_back(&range);
     }
+}
+}  // namespace
 
-    // Loop on other acceleration structure builds info.
-    // Given that comparisons are commutative, only need to consider elements after info_i
-    assert(infoCount > info_i);
-    for (auto [other_info_j, other_info] : vvl::enumerate(pInfos + info_i + 1, infoCount - (info_i + 1))) {
-        // Validate that scratch buffer's memory does not overlap destination acceleration structure's memory, or source
-        // acceleration structure's memory if build mode is update, or other scratch buffers' memory.
-        // Here validation is pessimistic: if one buffer associated to pInfos[other_info_j].scratchData.deviceAddress has an
-        // overlap, an error will be logged.
+bool CoreChecks::ValidateAccelerationStructuresMemoryAlisasing(const LogObjectList &objlist, uint32_t infoCount,
+                                                               const VkAccelerationStructureBuildGeometryInfoKHR *pInfos,
+                                                               const ErrorObject &error_obj) const {
+    using Role = BuildMemoryRange::Role;
 
-        const Location other_info_j_loc = error_obj.location.dot(Field::pInfos, other_info_j);
+    bool skip = false;
+    const char *src_dst_vuid = error_obj.location.function == Func::vkCmdBuildAccelerationStructuresKHR
+                                   ? "VUID-vkCmdBuildAccelerationStructuresKHR-pInfos-03668"
+                               : error_obj.location.function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
+                                   ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-pInfos-03668"
+                                   : "VUID-vkBuildAccelerationStructuresKHR-pInfos-03668";
+    const char *dst_other_src_vuid = error_obj.location.function == Func::vkCmdBuildAccelerationStructuresKHR
+                                         ? "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03701"
+                                     : error_obj.location.function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
+                                         ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-dstAccelerationStructure-03701"
+                                         : "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03701";
+    const char *dst_other_dst_vuid = error_obj.location.function == Func::vkCmdBuildAccelerationStructuresKHR
+                                         ? "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03702"
+                                     : error_obj.location.function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
+                                         ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-dstAccelerationStructure-03702"
+                                         : "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03702";
+
+    // Fetch the states and the memory ranges of every build once, instead of once per pair of builds
+    std::vector<std::shared_ptr<const vvl::AccelerationStructureKHR>> src_as_states(infoCount);
+    std::vector<std::shared_ptr<const vvl::AccelerationStructureKHR>> dst_as_states(infoCount);
+    std::vector<BuildMemoryRange> memory_ranges;
+    for (uint32_t info_i = 0; info_i < infoCount; ++info_i) {
+        const VkAccelerationStructureBuildGeometryInfoKHR &info = pInfos[info_i];
+        const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
+        const auto &src_as_state = src_as_states[info_i] = Get<vvl::AccelerationStructureKHR>(info.srcAccelerationStructure);
+        const auto &dst_as_state = dst_as_states[info_i] = Get<vvl::AccelerationStructureKHR>(info.dstAccelerationStructure);
+
+        const bool info_in_mode_update = info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
+
+        if (info_in_mode_update && info.srcAccelerationStructure != info.dstAccelerationStructure && src_as_state &&
+            dst_as_state) {
+            skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *src_as_state,
+                                                           info_i_loc.dot(Field::srcAccelerationStructure), *dst_as_state,
+                                                           info_i_loc.dot(Field::dstAccelerationStructure), src_dst_vuid);
+        }
 
-        const auto other_dst_as_state = Get<vvl::AccelerationStructureKHR>(other_info->dstAccelerationStructure);
-        const auto other_src_as_state = Get<vvl::AccelerationStructureKHR>(other_info->srcAccelerationStructure);
-
-        // Validate destination acceleration structure's memory is not overlapped by another source acceleration structure's
-        // memory that is going to be updated by this cmd
-        if (dst_as_state && other_src_as_state) {
-            if (other_info->mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR) {
-                const char *vuid = error_obj.location.function == Func::vkCmdBuildAccelerationStructuresKHR
-                                       ? "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03701"
-                                   : error_obj.location.function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
-                                       ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-dstAccelerationStructure-03701"
-                                       : "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03701";
-
-                skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *dst_as_state,
-                                                               info_i_loc.dot(Field::dstAccelerationStructure), *other_src_as_state,
-                                                               other_info_j_loc.dot(Field::srcAccelerationStructure), vuid);
-            }
+        if (dst_as_state && dst_as_state->buffer_state) {
+            AddBuildMemoryRanges(memory_ranges, *dst_as_state, info_i, Role::Dst);
+        }
+        // Only source acceleration structures that are going to be updated are checked against other destinations
+        if (info_in_mode_update && src_as_state && src_as_state->buffer_state) {
+            AddBuildMemoryRanges(memory_ranges, *src_as_state, info_i, Role::Src);
         }
+    }
 
-        // Validate that there is no destination acceleration structures' memory overlaps
-        if (dst_as_state && other_dst_as_state) {
-            const char *vuid = error_obj.location.function == Func::vkCmdBuildAccelerationStructuresKHR
-                                   ? "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03702"
-                               : error_obj.location.function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
-                                   ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-dstAccelerationStructure-03702"
-                                   : "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03702";
+    // Pairs (info_i, other_info_j, other role) to check, with info_i < other_info_j. The destination of pInfos[info_i] is
+    // checked against the destination, or the updated source, of pInfos[other_info_j].
+    std::vector<std::tuple<uint32_t, uint32_t, Role>> overlap_candidates;
+    ForEachIntersectingBuildMemoryRange(memory_ranges, [&overlap_candidates](const BuildMemoryRange &a, const BuildMemoryRange &b) {
+        const BuildMemoryRange &first = a.info_i < b.info_i ? a : b;
+        const BuildMemoryRange &second = a.info_i < b.info_i ? b : a;
+        if (first.info_i != second.info_i && first.role == Role::Dst) {
+            overlap_candidates.emplace_back(first.info_i, second.info_i, second.role);
+        }
+    });
+    std::sort(overlap_candidates.begin(), overlap_candidates.end(), [](const auto &a, const auto &b) {
+        // Report the errors of a pair in the order they were checked before candidates were gathered
+        return std::make_tuple(std::get<0>(a), std::get<1>(a), std::get<2>(a) != Role::Src) <
+               std::make_tuple(std::get<0>(b), std::get<1>(b), std::get<2>(b) != Role::Src);
+    });
+    overlap_candidates.erase(std::unique(overlap_candidates.begin(), overlap_candidates.end()), overlap_candidates.end());
 
-            skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *dst_as_state,
-                                                           info_i_loc.dot(Field::dstAccelerationStructure), *other_dst_as_state,
-                                                           other_info_j_loc.dot(Field::dstAccelerationStructure), vuid);
+    for (const auto &[info_i, other_info_j, other_role] : overlap_candidates) {
+        const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
+        const Location other_info_j_loc = error_obj.location.dot(Field::pInfos, other_info_j);
+        if (other_role == Role::Src) {
+            // Validate destination acceleration structure's memory is not overlapped by another source acceleration
+            // structure's memory that is going to be updated by this cmd
+            skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *dst_as_states[info_i],
+                                                           info_i_loc.dot(Field::dstAccelerationStructure),
+                                                           *src_as_states[other_info_j],
+                                                           other_info_j_loc.dot(Field::srcAccelerationStructure),
+                                                           dst_other_src_vuid);
+        } else {
+            // Validate that there is no destination acceleration structures' memory overlaps
+            skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *dst_as_states[info_i],
+                                                           info_i_loc.dot(Field::dstAccelerationStructure),
+                                                           *dst_as_states[other_info_j],
+                                                           other_info_j_loc.dot(Field::dstAccelerationStructure),
+                                                           dst_other_dst_vuid);
         }
     }
 
@@ -218,65 +302,101 @@ bool CoreChecks::ValidateAccelerationStructuresMemoryAlisasing(const LogObjectLi
 }
 
 bool CoreChecks::ValidateAccelerationStructuresDeviceScratchBufferMemoryAlisasing(
-    const LogObjectList &objlist, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR *pInfos, uint32_t info_i,
-    const VkAccelerationStructureBuildRangeInfoKHR *range_infos, const ErrorObject &error_obj) const {
-    using sparse_container::range;
+    const LogObjectList &objlist, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR *pInfos,
+    const VkAccelerationStructureBuildRangeInfoKHR *const *ppBuildRangeInfos, const ErrorObject &error_obj) const {
+    using Role = BuildMemoryRange::Role;
 
     bool skip = false;
-    const VkAccelerationStructureBuildGeometryInfoKHR &info = pInfos[info_i];
-    const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
-    const auto src_as_state = Get<vvl::AccelerationStructureKHR>(info.srcAccelerationStructure);
-    const auto dst_as_state = Get<vvl::AccelerationStructureKHR>(info.dstAccelerationStructure);
     const rt::BuildType rt_build_type =
         error_obj.location.function == Func::vkBuildAccelerationStructuresKHR ? rt::BuildType::Host : rt::BuildType::Device;
 
-    const bool info_in_mode_update = info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
+    struct BuildScratch {
+        std::shared_ptr<const vvl::AccelerationStructureKHR> src_as_state;
+        std::shared_ptr<const vvl::AccelerationStructureKHR> dst_as_state;
+        vvl::span<vvl::Buffer *const> scratches;
+        VkDeviceSize assumed_scratch_size = 0;
+    };
 
-    // Cannot compute scratch buffer size from the CPU with indirect calls,
-    // so cannot perform validation
-    vvl::span<vvl::Buffer *const> info_scratches = GetBuffersByAddress(info.scratchData.deviceAddress);
-    const VkDeviceSize assumed_scratch_size = rt::ComputeScratchSize(rt_build_type, device, info, range_infos);
+    // Compute the scratch size of every build once, it queries the driver for the build sizes
+    std::vector<BuildScratch> builds(infoCount);
+    std::vector<BuildMemoryRange> memory_ranges;
+    for (uint32_t info_i = 0; info_i < infoCount; ++info_i) {
+        const VkAccelerationStructureBuildGeometryInfoKHR &info = pInfos[info_i];
+        const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
+        BuildScratch &build = builds[info_i];
+        build.src_as_state = Get<vvl::AccelerationStructureKHR>(info.srcAccelerationStructure);
+        build.dst_as_state = Get<vvl::AccelerationStructureKHR>(info.dstAccelerationStructure);
+
+        const bool info_in_mode_update = info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
+
+        // Cannot compute scratch buffer size from the CPU with indirect calls,
+        // so cannot perform validation
+        build.scratches = GetBuffersByAddress(info.scratchData.deviceAddress);
+        build.assumed_scratch_size = rt::ComputeScratchSize(rt_build_type, device, info, ppBuildRangeInfos[info_i]);
+
+        if (build.dst_as_state) {
+            vvl::span<vvl::Buffer *const> dummy(nullptr, 0);
+            skip |= ValidateScratchMemoryNoOverlap(
+                error_obj.location, objlist, build.scratches, info.scratchData.deviceAddress, build.assumed_scratch_size,
+                info_i_loc.dot(Field::scratchData).dot(Field::deviceAddress),
+                info_in_mode_update ? build.src_as_state.get() : nullptr, info_i_loc.dot(Field::srcAccelerationStructure),
+                *build.dst_as_state, info_i_loc.dot(Field::dstAccelerationStructure), dummy, 0, 0, nullptr);
+        }
 
-    if (dst_as_state) {
-        vvl::span<vvl::Buffer *const> dummy(nullptr, 0);
-        skip |= ValidateScratchMemoryNoOverlap(error_obj.location, objlist, info_scratches, info.scratchData.deviceAddress,
-                                               assumed_scratch_size, info_i_loc.dot(Field::scratchData).dot(Field::deviceAddress),
-                                               info_in_mode_update ? src_as_state.get() : nullptr,
-                                               info_i_loc.dot(Field::srcAccelerationStructure), *dst_as_state,
-                                               info_i_loc.dot(Field::dstAccelerationStructure), dummy, 0, 0, nullptr);
-    }
-
-    // Loop on other acceleration structure builds info.
-    // Given that comparisons are commutative, only need to consider elements after info_i
-    assert(infoCount > info_i);
-    for (auto [other_info_j, other_info] : vvl::enumerate(pInfos + info_i + 1, infoCount - (info_i + 1))) {
+        for (vvl::Buffer *const scratch : build.scratches) {
+            const VkDeviceSize scratch_offset = info.scratchData.deviceAddress - scratch->deviceAddress;
+            const sparse_container::range<VkDeviceSize> scratch_range(scratch_offset, scratch_offset + build.assumed_scratch_size);
+            AddBuildMemoryRanges(memory_ranges, *scratch, scratch_range, info_i, Role::Scratch);
+        }
+        if (build.dst_as_state && build.dst_as_state->buffer_state) {
+            AddBuildMemoryRanges(memory_ranges, *build.dst_as_state, info_i, Role::Dst);
+        }
+        if (info_in_mode_update && build.src_as_state && build.src_as_state->buffer_state) {
+            AddBuildMemoryRanges(memory_ranges, *build.src_as_state, info_i, Role::Src);
+        }
+    }
+
+    // Pairs (info_i, other_info_j), with info_i < other_info_j, where the scratch memory of pInfos[info_i] may overlap the
+    // destination, the updated source or the scratch memory of pInfos[other_info_j]
+    std::vector<std::pair<uint32_t, uint32_t>> overlap_candidates;
+    ForEachIntersectingBuildMemoryRange(memory_ranges, [&overlap_candidates](const BuildMemoryRange &a, const BuildMemoryRange &b) {
+        const BuildMemoryRange &first = a.info_i < b.info_i ? a : b;
+        const BuildMemoryRange &second = a.info_i < b.info_i ? b : a;
+        if (first.info_i != second.info_i && first.role == Role::Scratch) {
+            overlap_candidates.emplace_back(first.info_i, second.info_i);
+        }
+    });
+    std::sort(overlap_candidates.begin(), overlap_candidates.end());
+    overlap_candidates.erase(std::unique(overlap_candidates.begin(), overlap_candidates.end()), overlap_candidates.end());
+
+    for (const auto &[info_i, other_info_j] : overlap_candidates) {
         // Validate that scratch buffer's memory does not overlap destination acceleration structure's memory, or source
         // acceleration structure's memory if build mode is update, or other scratch buffers' memory.
         // Here validation is pessimistic: if one buffer associated to pInfos[other_info_j].scratchData.deviceAddress has an
         // overlap, an error will be logged.
+        const BuildScratch &build = builds[info_i];
+        const BuildScratch &other_build = builds[other_info_j];
+        if (!other_build.dst_as_state) {
+            continue;
+        }
 
-        const Location other_info_j_loc = error_obj.location.dot(Field::pInfos, other_info_j + info_i + 1);
-
-        const auto other_dst_as_state = Get<vvl::AccelerationStructureKHR>(other_info->dstAccelerationStructure);
-        const auto other_src_as_state = Get<vvl::AccelerationStructureKHR>(other_info->srcAccelerationStructure);
-
-        const bool other_info_in_update_mode = other_info->mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
+        const VkAccelerationStructureBuildGeometryInfoKHR &info = pInfos[info_i];
+        const VkAccelerationStructureBuildGeometryInfoKHR &other_info = pInfos[other_info_j];
+        const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
+        const Location other_info_j_loc = error_obj.location.dot(Field::pInfos, other_info_j);
 
-        if (other_dst_as_state) {
-            auto other_info_scratches = GetBuffersByAddress(other_info->scratchData.deviceAddress);
-            const VkDeviceSize assumed_other_scratch_size = rt::ComputeScratchSize(rt_build_type, device, *other_info, range_infos);
+        const bool other_info_in_update_mode = other_info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
 
-            const Location other_scratch_loc = other_info_j_loc.dot(Field::scratchData);
-            const Location other_scratch_address_loc = other_scratch_loc.dot(Field::deviceAddress);
+        const Location other_scratch_loc = other_info_j_loc.dot(Field::scratchData);
+        const Location other_scratch_address_loc = other_scratch_loc.dot(Field::deviceAddress);
 
-            skip |= ValidateScratchMemoryNoOverlap(
-                error_obj.location, objlist, info_scratches, info.scratchData.deviceAddress, assumed_scratch_size,
-                info_i_loc.dot(Field::scratchData).dot(Field::deviceAddress),
-                other_info_in_update_mode ? other_src_as_state.get() : nullptr,
-                other_info_j_loc.dot(Field::srcAccelerationStructure), *other_dst_as_state,
-                other_info_j_loc.dot(Field::dstAccelerationStructure), other_info_scratches, other_info->scratchData.deviceAddress,
-                assumed_other_scratch_size, &other_scratch_address_loc);
-        }
+        skip |= ValidateScratchMemoryNoOverlap(
+            error_obj.location, objlist, build.scratches, info.scratchData.deviceAddress, build.assumed_scratch_size,
+            info_i_loc.dot(Field::scratchData).dot(Field::deviceAddress),
+            other_info_in_update_mode ? other_build.src_as_state.get() : nullptr,
+            other_info_j_loc.dot(Field::srcAccelerationStructure), *other_build.dst_as_state,
+            other_info_j_loc.dot(Field::dstAccelerationStructure), other_build.scratches, other_info.scratchData.deviceAddress,
+            other_build.assumed_scratch_size, &other_scratch_address_loc);
     }
 
     return skip;
@@ -901,12 +1021,12 @@ bool CoreChecks::PreCallValidateCmdBuildAccelerationStructuresKHR(
         skip |= CommonBuildAccelerationStructureValidation(*info, info_loc, commandBuffer);
 
         skip |= ValidateAccelerationBuffers(commandBuffer, info_i, *info, ppBuildRangeInfos[info_i], info_loc);
+    }
 
-        skip |= ValidateAccelerationStructuresMemoryAlisasing(commandBuffer, infoCount, pInfos, info_i, error_obj);
+    skip |= ValidateAccelerationStructuresMemoryAlisasing(commandBuffer, infoCount, pInfos, error_obj);
 
-        skip |= ValidateAccelerationStructuresDeviceScratchBufferMemoryAlisasing(commandBuffer, infoCount, pInfos, info_i,
-                                                                                 ppBuildRangeInfos[info_i], error_obj);
-    }
+    skip |= ValidateAccelerationStructuresDeviceScratchBufferMemoryAlisasing(commandBuffer, infoCount, pInfos, ppBuildRangeInfos,
+                                                                             error_obj);
 
     return skip;
 }
@@ -976,35 +1096,6 @@ bool CoreChecks::PreCallValidateBuildAccelerationStructuresKHR(
             }
         }
 
-        skip |= ValidateAccelerationStructuresMemoryAlisasing(LogObjectList(), infoCount, pInfos, info_i, error_obj);
-        const VkDeviceSize scratch_i_size = rt::ComputeScratchSize(rt::BuildType::Host, device, *info, ppBuildRangeInfos[info_i]);
-        auto scratch_i_host_addr = reinterpret_cast<uint64_t>(info->scratchData.hostAddress);
-        const sparse_container::range<uint64_t> scratch_addr_range(scratch_i_host_addr, scratch_i_host_addr + scratch_i_size);
-
-        assert(infoCount > info_i);
-        for (auto [other_info_j, other_info] : vvl::enumerate(pInfos + info_i + 1, infoCount - (info_i + 1))) {
-            const Location other_info_j_loc = error_obj.location.dot(Field::pInfos, other_info_j + info_i + 1);
-            const VkDeviceSize other_scratch_size =
-                rt::ComputeScratchSize(rt::BuildType::Host, device, *other_info, ppBuildRangeInfos[other_info_j]);
-            auto other_scratch_host_addr = reinterpret_cast<uint64_t>(other_info->scratchData.hostAddress);
-            const sparse_container::range<uint64_t> other_scratch_addr_range(other_scratch_host_addr,
-                                                                             other_scratch_host_addr + other_scratch_size);
-
-            if (scratch_addr_range.intersects(other_scratch_addr_range)) {
-                std::string info_i_scratch_str = info_loc.dot(Field::scratchData).Fields();
-                std::string other_info_j_scratch_str = other_info_j_loc.dot(Field::scratchData).Fields();
-                skip |= LogError(
-                    "VUID-vkBuildAccelerationStructuresKHR-scratchData-03704", device, info_loc.dot(Field::scratchData),
-                    "overlaps with %s on host address range %s.\n"
-                    "%s.hostAddress is %p and assumed scratch size is %" PRIu64
-                    ".\n"
-                    "%s.hostAddress is %p and assumed scratch size is %" PRIu64 ".",
-                    other_info_j_scratch_str.c_str(), string_range_hex(scratch_addr_range & other_scratch_addr_range).c_str(),
-                    info_i_scratch_str.c_str(), info->scratchData.hostAddress, scratch_i_size, other_info_j_scratch_str.c_str(),
-                    other_info->scratchData.hostAddress, other_scratch_size);
-            }
-        }
-
         skip |= CommonBuildAccelerationStructureValidation(*info, info_loc, LogObjectList());
 
         for (uint32_t geom_i = 0; geom_i < info->geometryCount; ++geom_i) {
@@ -1092,6 +1183,56 @@ bool CoreChecks::PreCallValidateBuildAccelerationStructuresKHR(
             }
         }
     }
+
+    skip |= ValidateAccelerationStructuresMemoryAlisasing(LogObjectList(), infoCount, pInfos, error_obj);
+
+    // Host scratch memory is checked the same way as device memory, all the host addresses being seen as one memory
+    std::vector<VkDeviceSize> scratch_sizes(infoCount);
+    std::vector<BuildMemoryRange> scratch_ranges;
+    scratch_ranges.reserve(infoCount);
+    for (uint32_t info_i = 0; info_i < infoCount; ++info_i) {
+        scratch_sizes[info_i] = rt::ComputeScratchSize(rt::BuildType::Host, device, pInfos[info_i], ppBuildRangeInfos[info_i]);
+        const auto scratch_host_addr = reinterpret_cast<uint64_t>(pInfos[info_i].scratchData.hostAddress);
+        scratch_ranges.push_back({VK_NULL_HANDLE,
+                                  {scratch_host_addr, scratch_host_addr + scratch_sizes[info_i]},
+                                  info_i,
+                                  BuildMemoryRange::Role::Scratch});
+    }
+    std::vector<std::pair<uint32_t, uint32_t>> overlap_candidates;
+    ForEachIntersectingBuildMemoryRange(scratch_ranges,
+                                        [&overlap_candidates](const BuildMemoryRange &a, const BuildMemoryRange &b) {
+                                            overlap_candidates.emplace_back(std::min(a.info_i, b.info_i),
+                                                                            std::max(a.info_i, b.info_i));
+                                        });
+    std::sort(overlap_candidates.begin(), overlap_candidates.end());
+
+    for (const auto &[info_i, other_info_j] : overlap_candidates) {
+        const VkAccelerationStructureBuildGeometryInfoKHR &info = pInfos[info_i];
+        const VkAccelerationStructureBuildGeometryInfoKHR &other_info = pInfos[other_info_j];
+        const Location info_loc = error_obj.location.dot(Field::pInfos, info_i);
+        const Location other_info_j_loc = error_obj.location.dot(Field::pInfos, other_info_j);
+        const VkDeviceSize scratch_i_size = scratch_sizes[info_i];
+        const VkDeviceSize other_scratch_size = scratch_sizes[other_info_j];
+        auto scratch_i_host_addr = reinterpret_cast<uint64_t>(info.scratchData.hostAddress);
+        const sparse_container::range<uint64_t> scratch_addr_range(scratch_i_host_addr, scratch_i_host_addr + scratch_i_size);
+        auto other_scratch_host_addr = reinterpret_cast<uint64_t>(other_info.scratchData.hostAddress);
+        const sparse_container::range<uint64_t> other_scratch_addr_range(other_scratch_host_addr,
+                                                                         other_scratch_host_addr + other_scratch_size);
+
+        if (scratch_addr_range.intersects(other_scratch_addr_range)) {
+            std::string info_i_scratch_str = info_loc.dot(Field::scratchData).Fields();
+            std::string other_info_j_scratch_str = other_info_j_loc.dot(Field::scratchData).Fields();
+            skip |= LogError("VUID-vkBuildAccelerationStructuresKHR-scratchData-03704", device, info_loc.dot(Field::scratchData),
+                             "overlaps with %s on host address range %s.\n"
+                             "%s.hostAddress is %p and assumed scratch size is %" PRIu64
+                             ".\n"
+                             "%s.hostAddress is %p and assumed scratch size is %" PRIu64 ".",
+                             other_info_j_scratch_str.c_str(),
+                             string_range_hex(scratch_addr_range & other_scratch_addr_range).c_str(), info_i_scratch_str.c_str(),
+                             info.scratchData.hostAddress, scratch_i_size, other_info_j_scratch_str.c_str(),
+                             other_info.scratchData.hostAddress, other_scratch_size);
+        }
+    }
     return skip;
 }
 
@@ -1148,12 +1289,12 @@ bool CoreChecks::PreCallValidateCmdBuildAccelerationStructuresIndirectKHR(VkComm
             }
         }
 
-        skip |= ValidateAccelerationStructuresMemoryAlisasing(commandBuffer, infoCount, pInfos, info_i, error_obj);
-
         skip |= CommonBuildAccelerationStructureValidation(*info, info_loc, commandBuffer);
 
         skip |= ValidateAccelerationBuffers(commandBuffer, info_i, *info, nullptr, info_loc);
     }
+
+    skip |= ValidateAccelerationStructuresMemoryAlisasing(commandBuffer, infoCount, pInfos, error_obj);
     return skip;
 }
 
@@ -555,10 +555,19 @@ bool CoreChecks::ValidateCmdBeginRenderPass(VkCommandBuffer commandBuffer, const
     skip |= VerifyFramebufferAndRenderPassImageViews(*pRenderPassBegin, rp_begin_loc);
     skip |= VerifyRenderAreaBounds(*pRenderPassBegin, rp_begin_loc);
 
-    skip |= VerifyFramebufferAndRenderPassLayouts(cb_state, *pRenderPassBegin, *rp_state, *fb_state, rp_begin_loc);
-    if (fb_state->rp_state->VkHandle() != rp_state->VkHandle()) {
-        skip |= ValidateRenderPassCompatibility(rp_state->Handle(), *rp_state, fb_state->Handle(), *fb_state->rp_state,
-                                                error_obj.location, "VUID-VkRenderPassBeginInfo-renderPass-00904");
+    // The same render pass and framebuffer are usually begun over and over, only the checks against the command buffer
+    // image layouts are repeated once the pair passed
+    const bool pair_validated = fb_state->IsRenderPassValidated(rp_state->GetId());
+    const uint64_t error_count = debug_report->error_message_count.load(std::memory_order_relaxed);
+    skip |= VerifyFramebufferAndRenderPassLayouts(cb_state, *pRenderPassBegin, *rp_state, *fb_state, pair_validated, rp_begin_loc);
+    if (!pair_validated) {
+        if (fb_state->rp_state->VkHandle() != rp_state->VkHandle()) {
+            skip |= ValidateRenderPassCompatibility(rp_state->Handle(), *rp_state, fb_state->Handle(), *fb_state->rp_state,
+                                                    error_obj.location, "VUID-VkRenderPassBeginInfo-renderPass-00904");
+        }
+        if (debug_report->error_message_count.load(std::memory_order_relaxed) == error_count) {
+            fb_state->SetRenderPassValidated(rp_state->GetId());
+        }
     }
 
     auto device_group_begin_info = vku::FindStructInPNextChain<VkDeviceGroupRenderPassBeginInfo>(pRenderPassBegin->pNext);
@@ -25,6 +25,7 @@
 #include <vulkan/vk_enum_string_helper.h>
 #include "core_validation.h"
 #include "generated/spirv_grammar_helper.h"
+#include "utils/hash_util.h"
 #include "utils/shader_utils.h"
 #include "state_tracker/shader_module.h"
 #include "state_tracker/render_pass_state.h"
@@ -442,7 +443,7 @@ bool CoreChecks::ValidateShaderStageInputOutputLimits(const spirv::Module &modul
 
 bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer, const spirv::EntryPoint &producer_entrypoint,
                                                 const spirv::Module &consumer, const spirv::EntryPoint &consumer_entrypoint,
-                                                const Location &create_info_loc) const {
+                                                const Location &create_info_loc, bool &output_not_consumed) const {
     bool skip = false;
 
     if (producer_entrypoint.has_passthrough) {
@@ -553,6 +554,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer, c
                 // The values will be undefined, but still legal
                 // Don't give any warning if maintenance4 with vectors
                 if (!enabled_features.maintenance4 && (output_var->base_type.Opcode() != spv::OpTypeVector)) {
+                    output_not_consumed = true;
                     const LogObjectList objlist(producer.handle(), consumer.handle());
                     skip |= LogPerformanceWarning("WARNING-Shader-OutputNotConsumed", objlist, create_info_loc,
                                                   "(SPIR-V Interface) %s declared to output location %" PRIu32 " Component %" PRIu32
@@ -635,6 +637,32 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer, c
     return skip;
 }
 
+static uint64_t InterfaceMatchKey(const spirv::EntryPoint *producer_entrypoint, const spirv::EntryPoint *consumer_entrypoint) {
+    hash_util::HashCombiner hc;
+    hc << producer_entrypoint << consumer_entrypoint;
+    return hc.Value();
+}
+
+bool CoreChecks::IsInterfaceMatchCached(const spirv::EntryPoint &producer_entrypoint,
+                                        const spirv::EntryPoint &consumer_entrypoint) const {
+    ReadLockGuard guard(interface_match_cache_lock_);
+    auto it = interface_match_cache_.find(InterfaceMatchKey(&producer_entrypoint, &consumer_entrypoint));
+    if (it == interface_match_cache_.end()) {
+        return false;
+    }
+    return it->second.producer.lock().get() == &producer_entrypoint && it->second.consumer.lock().get() == &consumer_entrypoint;
+}
+
+void CoreChecks::CacheInterfaceMatch(const std::shared_ptr<const spirv::EntryPoint> &producer_entrypoint,
+                                     const std::shared_ptr<const spirv::EntryPoint> &consumer_entrypoint) const {
+    WriteLockGuard guard(interface_match_cache_lock_);
+    if (interface_match_cache_.size() >= kInterfaceMatchCacheSize) {
+        interface_match_cache_.clear();
+    }
+    interface_match_cache_[InterfaceMatchKey(producer_entrypoint.get(), consumer_entrypoint.get())] = {producer_entrypoint,
+                                                                                                       consumer_entrypoint};
+}
+
 bool CoreChecks::ValidateFsOutputsAgainstRenderPass(const spirv::Module &module_state, const spirv::EntryPoint &entrypoint,
                                                     const vvl::Pipeline &pipeline, uint32_t subpass_index,
                                                     const Location &create_info_loc) const {
@@ -850,13 +878,16 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const vvl::Pipeline &pipeli
     // if the shader stages are no good individually, cross-stage validation is pointless.
     if (skip) return true;
 
+    // When linking, only the interfaces between sub states from different libraries are validated again
     if (pipeline.vertex_input_state && vertex_stage && vertex_stage->entrypoint && vertex_stage->spirv_state &&
-        !pipeline.IsDynamic(VK_DYNAMIC_STATE_VERTEX_INPUT_EXT)) {
+        !pipeline.IsDynamic(VK_DYNAMIC_STATE_VERTEX_INPUT_EXT) &&
+        !pipeline.SubStatesLinkedFromSameLibrary(pipeline.vertex_input_state, pipeline.pre_raster_state)) {
         skip |=
             ValidateInterfaceVertexInput(pipeline, *vertex_stage->spirv_state.get(), *vertex_stage->entrypoint, create_info_loc);
     }
 
-    if (pipeline.fragment_shader_state && fragment_stage && fragment_stage->entrypoint && fragment_stage->spirv_state) {
+    if (pipeline.fragment_shader_state && fragment_stage && fragment_stage->entrypoint && fragment_stage->spirv_state &&
+        !pipeline.SubStatesLinkedFromSameLibrary(pipeline.fragment_shader_state, pipeline.fragment_output_state)) {
         skip |= ValidateInterfaceFragmentOutput(pipeline, *fragment_stage->spirv_state.get(), *fragment_stage->entrypoint,
                                                 create_info_loc);
     }
@@ -872,9 +903,27 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const vvl::Pipeline &pipeli
         if (&producer == fragment_stage) {
             break;
         }
+        // The pre-raster stages come from a single library, they were matched together when it was created
+        const bool same_library =
+            (&consumer == fragment_stage)
+                ? pipeline.SubStatesLinkedFromSameLibrary(pipeline.pre_raster_state, pipeline.fragment_shader_state)
+                : ((producer.GetStage() | consumer.GetStage()) & ~pipeline.linking_shaders) == 0;
+        if (same_library) {
+            continue;
+        }
         if (consumer_spirv && producer_spirv && consumer.entrypoint && producer.entrypoint) {
+            // Pipelines are often created from the same few pairs of shaders, only match the slots of a pair again if the
+            // last time reported something
+            if (IsInterfaceMatchCached(*producer.entrypoint, *consumer.entrypoint)) {
+                continue;
+            }
+            const uint64_t error_count = debug_report->error_message_count.load(std::memory_order_relaxed);
+            bool output_not_consumed = false;
             skip |= ValidateInterfaceBetweenStages(*producer_spirv.get(), *producer.entrypoint, *consumer_spirv.get(),
-                                                   *consumer.entrypoint, create_info_loc);
+                                                   *consumer.entrypoint, create_info_loc, output_not_consumed);
+            if (!output_not_consumed && error_count == debug_report->error_message_count.load(std::memory_order_relaxed)) {
+                CacheInterfaceMatch(producer.entrypoint, consumer.entrypoint);
+            }
         }
     }
 
@@ -270,12 +270,35 @@ bool CoreChecks::PreCallValidateCreateShadersEXT(VkDevice device, uint32_t creat
     bool tese_linked_point_mode = false;
     uint32_t tesc_linked_spacing = 0u;
     uint32_t tese_linked_spacing = 0u;
+
+    // With several create infos spirv-val runs for all of them on the shader validation threads first, the results are still
+    // reported in order
+    ValidationCache* cache = CastFromHandle<ValidationCache*>(core_validation_cache);
+    std::vector<spv_result_t> spirv_results;
+    std::vector<std::string> spirv_errors;
+    if (shader_validation_pool_ && createInfoCount > 1) {
+        spirv_results.resize(createInfoCount, SPV_SUCCESS);
+        spirv_errors.resize(createInfoCount);
+        shader_validation_pool_->ParallelFor(createInfoCount, [&](uint32_t i) {
+            if (pCreateInfos[i].codeType == VK_SHADER_CODE_TYPE_SPIRV_EXT) {
+                const spv_const_binary_t binary{static_cast<const uint32_t*>(pCreateInfos[i].pCode),
+                                                pCreateInfos[i].codeSize / sizeof(uint32_t)};
+                spirv_results[i] = SpirvValidate(binary, cache, spirv_errors[i]);
+            }
+        });
+    }
+
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         if (pCreateInfos[i].codeType == VK_SHADER_CODE_TYPE_SPIRV_EXT) {
             const Location create_info_loc = error_obj.location.dot(Field::pCreateInfos, i);
 
-            spv_const_binary_t binary{static_cast<const uint32_t*>(pCreateInfos[i].pCode), pCreateInfos[i].codeSize / sizeof(uint32_t)};
-            skip |= RunSpirvValidation(binary, create_info_loc);
+            if (!spirv_results.empty()) {
+                skip |= ReportSpirvValidation(spirv_results[i], spirv_errors[i], create_info_loc);
+            } else {
+                spv_const_binary_t binary{static_cast<const uint32_t*>(pCreateInfos[i].pCode),
+                                          pCreateInfos[i].codeSize / sizeof(uint32_t)};
+                skip |= RunSpirvValidation(binary, create_info_loc, cache);
+            }
 
             const StageCreateInfo stage_create_info(pCreateInfos[i]);
             const auto spirv =
@@ -2144,6 +2144,180 @@ bool CoreChecks::ValidateShaderTileImage(const spirv::Module &module_state, cons
     return skip;
 }
 
+// Returns an entry with constantID kInvalidValue if spec_id is not in the map
+static VkSpecializationMapEntry FindSpecializationMapEntry(const vku::safe_VkSpecializationInfo &specialization_info,
+                                                           uint32_t spec_id) {
+    for (uint32_t i = 0; i < specialization_info.mapEntryCount; i++) {
+        if (specialization_info.pMapEntries[i].constantID == spec_id) {
+            return specialization_info.pMapEntries[i];
+        }
+    }
+    return {spirv::kInvalidValue, 0, 0};
+}
+
+// Identifies what the specialization result depends on: the code, the entrypoint and the specialization info
+static uint64_t SpecializationKey(const PipelineStageState &stage_state) {
+    const spirv::Module &module_state = *stage_state.spirv_state;
+    const spirv::EntryPoint &entrypoint = *stage_state.entrypoint;
+    uint64_t key = hash_util::ShaderValidationHash(entrypoint.name.data(), entrypoint.name.size(), entrypoint.stage);
+    if (const auto *specialization_info = stage_state.GetSpecializationInfo()) {
+        if (specialization_info->pMapEntries) {
+            key = hash_util::ShaderValidationHash(specialization_info->pMapEntries,
+                                                  specialization_info->mapEntryCount * sizeof(VkSpecializationMapEntry), key);
+        }
+        if (specialization_info->pData) {
+            key = hash_util::ShaderValidationHash(specialization_info->pData, specialization_info->dataSize, key);
+        }
+    }
+    return hash_util::ShaderValidationHash(module_state.words_.data(), module_state.words_.size() * sizeof(uint32_t), key);
+}
+
+std::shared_ptr<const SpecializedSpirv> CoreChecks::SpecializeShaderStage(const PipelineStageState &stage_state) const {
+    const uint64_t key = SpecializationKey(stage_state);
+    {
+        ReadLockGuard guard(specialization_cache_lock_);
+        auto it = specialization_cache_.find(key);
+        if (it != specialization_cache_.end()) {
+            return it->second;
+        }
+    }
+
+    std::shared_ptr<const SpecializedSpirv> specialized = ApplySpecializationConstants(stage_state);
+
+    WriteLockGuard guard(specialization_cache_lock_);
+    if (specialization_cache_.size() >= kSpecializationCacheSize) {
+        specialization_cache_.clear();
+    }
+    specialization_cache_.emplace(key, specialized);
+    return specialized;
+}
+
+std::shared_ptr<const SpecializedSpirv> CoreChecks::ApplySpecializationConstants(const PipelineStageState &stage_state) const {
+    auto specialized = std::make_shared<SpecializedSpirv>();
+    const spirv::Module &module_state = *stage_state.spirv_state.get();
+    const spirv::EntryPoint &entrypoint = *stage_state.entrypoint;
+
+    // both spirv-opt and spirv-val will use the same flags
+    spvtools::ValidatorOptions options;
+    AdjustValidatorOptions(device_extensions, enabled_features, options);
+
+    // keep the messages if the optimizer fails, they are reported with the stage
+    spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
+    spvtools::Optimizer optimizer(spirv_environment);
+    optimizer.SetMessageConsumer([&specialized](spv_message_level_t level, const char *source, const spv_position_t &position,
+                                                const char *message) { specialized->optimizer_messages.emplace_back(message); });
+
+    // The app might be using the default spec constant values, but if they pass values at runtime to the pipeline then need to
+    // use those values to apply to the spec constants
+    auto const &specialization_info = stage_state.GetSpecializationInfo();
+    if (specialization_info != nullptr && specialization_info->mapEntryCount > 0 && specialization_info->pMapEntries != nullptr) {
+        // Gather the specialization-constant values.
+        auto const &specialization_data = reinterpret_cast<uint8_t const *>(specialization_info->pData);
+        std::unordered_map<uint32_t, std::vector<uint32_t>> id_value_map;  // note: this must be std:: to work with spvtools
+        id_value_map.reserve(specialization_info->mapEntryCount);
+
+        for (const auto &itr : module_state.static_data_.id_to_spec_id) {
+            const VkSpecializationMapEntry map_entry = FindSpecializationMapEntry(*specialization_info, itr.second);
+            // "If a constantID value is not a specialization constant ID used in the shader, that map entry does not affect the
+            // behavior of the pipeline."
+            if (map_entry.constantID == spirv::kInvalidValue) {
+                continue;
+            }
+
+            if ((map_entry.offset + map_entry.size) <= specialization_info->dataSize) {
+                // Allocate enough room for ceil(map_entry.size / 4) to store entries
+                std::vector<uint32_t> entry_data((map_entry.size + 4 - 1) / 4, 0);
+                uint8_t *out_p = reinterpret_cast<uint8_t *>(entry_data.data());
+                const uint8_t *const start_in_p = specialization_data + map_entry.offset;
+                const uint8_t *const end_in_p = start_in_p + map_entry.size;
+
+                std::copy(start_in_p, end_in_p, out_p);
+                id_value_map.emplace(map_entry.constantID, std::move(entry_data));
+            }
+        }
+
+        // This pass takes the runtime spec const values and applies it into the SPIR-V
+        // will turn a spec constant like
+        //     OpSpecConstant %uint 1
+        // to a use the value passed in instead (for example if the value is 32) so now it looks like
+        //     OpSpecConstant %uint 32
+        optimizer.RegisterPass(spvtools::CreateSetSpecConstantDefaultValuePass(id_value_map));
+    }
+
+    // This pass will turn OpSpecConstant into a OpConstant (also OpSpecConstantTrue/OpSpecConstantFalse)
+    optimizer.RegisterPass(spvtools::CreateFreezeSpecConstantValuePass());
+    // Using the new frozen OpConstant all OpSpecConstantComposite can be resolved turning them into OpConstantComposite
+    // This is need incase a shdaer looks like:
+    //
+    //     layout(constant_id = 0) const uint x = 64;
+    //     shared uint arr[x > 64 ? 64 : x];
+    //
+    // this will generate branch/switch statements that we want to leverage spirv-opt to apply to make parsing easier
+    optimizer.RegisterPass(spvtools::CreateFoldSpecConstantOpAndCompositePass());
+
+    // Apply the specialization-constant values and revalidate the shader module is valid.
+    std::vector<uint32_t> specialized_spirv;
+    specialized->optimized =
+        optimizer.Run(module_state.words_.data(), module_state.words_.size(), &specialized_spirv, options, true);
+    if (!specialized->optimized) {
+        return specialized;
+    }
+
+    spv_const_binary_t binary{specialized_spirv.data(), specialized_spirv.size()};
+    spv_diagnostic diag = nullptr;
+    specialized->validation_result = spvValidateWithOptions(GetThreadSpirvContext(spirv_environment), options, &binary, &diag);
+    if (specialized->validation_result != SPV_SUCCESS) {
+        specialized->validation_error = diag && diag->error ? diag->error : "(no error text)";
+    }
+    spvDiagnosticDestroy(diag);
+
+    // The new optimized SPIR-V will NOT match the original spirv::Module object parsing, so a new spirv::Module
+    // object is needed. This an issue due to each pipeline being able to reuse the same shader module but with different
+    // spec constant values.
+    spirv::Module spec_mod(vvl::make_span<const uint32_t>(specialized_spirv.data(), specialized_spirv.size()));
+
+    // According to https://github.com/KhronosGroup/Vulkan-Docs/issues/1671 anything labeled as "static use" (such as if an
+    // input is used or not) don't have to be checked post spec constants freezing since the device compiler is not
+    // guaranteed to run things such as dead-code elimination. The following checks are things that don't follow under
+    // "static use" rules and need to be validated still.
+
+    const auto spec_entrypoint = spec_mod.FindEntrypoint(entrypoint.name.c_str(), entrypoint.stage);
+    assert(spec_entrypoint);  // spirv-opt won't change Entrypoint Name/stage
+
+    spec_mod.FindLocalSize(*spec_entrypoint, specialized->local_size_x, specialized->local_size_y, specialized->local_size_z);
+
+    specialized->total_workgroup_shared_memory = spec_mod.CalculateWorkgroupSharedMemory();
+    return specialized;
+}
+
+void CoreChecks::SpecializePipelineStages(const PipelineStates &pipeline_states) const {
+    if (!shader_validation_pool_) {
+        return;
+    }
+    std::vector<const PipelineStageState *> stages;
+    for (const auto &pipeline : pipeline_states) {
+        if (!pipeline || pipeline->uses_shader_module_id) {
+            continue;
+        }
+        for (const auto &stage_state : pipeline->stage_states) {
+            // Stages of linked libraries were validated with the library
+            if ((stage_state.GetStage() & pipeline->linking_shaders) != 0) {
+                continue;
+            }
+            if (stage_state.spirv_state && stage_state.entrypoint &&
+                stage_state.spirv_state->static_data_.has_specialization_constants) {
+                stages.emplace_back(&stage_state);
+            }
+        }
+    }
+    if (stages.size() < 2) {
+        return;
+    }
+    shader_validation_pool_->ParallelFor(static_cast<uint32_t>(stages.size()), [this, &stages](uint32_t i) {
+        stages[i]->specialized = SpecializeShaderStage(*stages[i]);
+    });
+}
+
 // Function to get the VkPipelineShaderStageCreateInfo from the various pipeline types
 bool CoreChecks::ValidatePipelineShaderStage(const StageCreateInfo &stage_create_info, const PipelineStageState &stage_state,
                                              const Location &loc) const {
@@ -2174,6 +2348,10 @@ bool CoreChecks::ValidatePipelineShaderStage(const StageCreateInfo &stage_create
     const spirv::Module &module_state = *stage_state.spirv_state.get();
     const spirv::EntryPoint &entrypoint = *stage_state.entrypoint;
 
+    if (const spirv::StatelessData *stateless_data = module_state.TakeDeferredStatelessData()) {
+        skip |= ValidateSpirvStateless(module_state, *stateless_data, loc);
+    }
+
     // to prevent const_cast on pipeline object, just store here as not needed outside function anyway
     uint32_t local_size_x = 0;
     uint32_t local_size_y = 0;
@@ -2182,45 +2360,13 @@ bool CoreChecks::ValidatePipelineShaderStage(const StageCreateInfo &stage_create
 
     // If specialization-constant instructions are present in the shader, the specializations should be applied.
     if (module_state.static_data_.has_specialization_constants) {
-        // both spirv-opt and spirv-val will use the same flags
-        spvtools::ValidatorOptions options;
-        AdjustValidatorOptions(device_extensions, enabled_features, options);
-
-        // setup the call back if the optimizer fails
-        spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
-        spvtools::Optimizer optimizer(spirv_environment);
-        spvtools::MessageConsumer consumer = [&skip, &module_state, &stage, loc, this](
-                                                 spv_message_level_t level, const char *source, const spv_position_t &position,
-                                                 const char *message) {
-            skip |= LogError("VUID-VkPipelineShaderStageCreateInfo-module-parameter", device, loc,
-                             "%s failed in spirv-opt because it does not contain valid spirv for stage %s. %s",
-                             FormatHandle(module_state.handle()).c_str(), string_VkShaderStageFlagBits(stage), message);
-        };
-        optimizer.SetMessageConsumer(consumer);
-
-        // The app might be using the default spec constant values, but if they pass values at runtime to the pipeline then need to
-        // use those values to apply to the spec constants
         auto const &specialization_info = stage_state.GetSpecializationInfo();
         if (specialization_info != nullptr && specialization_info->mapEntryCount > 0 &&
             specialization_info->pMapEntries != nullptr) {
-            // Gather the specialization-constant values.
-            auto const &specialization_data = reinterpret_cast<uint8_t const *>(specialization_info->pData);
-            std::unordered_map<uint32_t, std::vector<uint32_t>> id_value_map;  // note: this must be std:: to work with spvtools
-            id_value_map.reserve(specialization_info->mapEntryCount);
-
             // spirv-val makes sure every OpSpecConstant has a OpDecoration.
             for (const auto &itr : module_state.static_data_.id_to_spec_id) {
                 const uint32_t spec_id = itr.second;
-                VkSpecializationMapEntry map_entry = {spirv::kInvalidValue, 0, 0};
-                for (uint32_t i = 0; i < specialization_info->mapEntryCount; i++) {
-                    if (specialization_info->pMapEntries[i].constantID == spec_id) {
-                        map_entry = specialization_info->pMapEntries[i];
-                        break;
-                    }
-                }
-
-                // "If a constantID value is not a specialization constant ID used in the shader, that map entry does not affect the
-                // behavior of the pipeline."
+                const VkSpecializationMapEntry map_entry = FindSpecializationMapEntry(*specialization_info, spec_id);
                 if (map_entry.constantID == spirv::kInvalidValue) {
                     continue;
                 }
@@ -2259,75 +2405,33 @@ bool CoreChecks::ValidatePipelineShaderStage(const StageCreateInfo &stage_create
                                      map_entry.constantID, spec_id, map_entry.size, FormatHandle(module_state.handle()).c_str(),
                                      spec_const_size);
                 }
-
-                if ((map_entry.offset + map_entry.size) <= specialization_info->dataSize) {
-                    // Allocate enough room for ceil(map_entry.size / 4) to store entries
-                    std::vector<uint32_t> entry_data((map_entry.size + 4 - 1) / 4, 0);
-                    uint8_t *out_p = reinterpret_cast<uint8_t *>(entry_data.data());
-                    const uint8_t *const start_in_p = specialization_data + map_entry.offset;
-                    const uint8_t *const end_in_p = start_in_p + map_entry.size;
-
-                    std::copy(start_in_p, end_in_p, out_p);
-                    id_value_map.emplace(map_entry.constantID, std::move(entry_data));
-                }
             }
+        }
 
-            // This pass takes the runtime spec const values and applies it into the SPIR-V
-            // will turn a spec constant like
-            //     OpSpecConstant %uint 1
-            // to a use the value passed in instead (for example if the value is 32) so now it looks like
-            //     OpSpecConstant %uint 32
-            optimizer.RegisterPass(spvtools::CreateSetSpecConstantDefaultValuePass(id_value_map));
+        // Already done if the stages of the call were specialized in parallel
+        std::shared_ptr<const SpecializedSpirv> specialized = stage_state.specialized;
+        if (!specialized) {
+            specialized = SpecializeShaderStage(stage_state);
         }
 
-        // This pass will turn OpSpecConstant into a OpConstant (also OpSpecConstantTrue/OpSpecConstantFalse)
-        optimizer.RegisterPass(spvtools::CreateFreezeSpecConstantValuePass());
-        // Using the new frozen OpConstant all OpSpecConstantComposite can be resolved turning them into OpConstantComposite
-        // This is need incase a shdaer looks like:
-        //
-        //     layout(constant_id = 0) const uint x = 64;
-        //     shared uint arr[x > 64 ? 64 : x];
-        //
-        // this will generate branch/switch statements that we want to leverage spirv-opt to apply to make parsing easier
-        optimizer.RegisterPass(spvtools::CreateFoldSpecConstantOpAndCompositePass());
-
-        // Apply the specialization-constant values and revalidate the shader module is valid.
-        std::vector<uint32_t> specialized_spirv;
-        auto const optimized =
-            optimizer.Run(module_state.words_.data(), module_state.words_.size(), &specialized_spirv, options, true);
-        if (optimized) {
-            spv_context ctx = spvContextCreate(spirv_environment);
-            spv_const_binary_t binary{specialized_spirv.data(), specialized_spirv.size()};
-            spv_diagnostic diag = nullptr;
-            auto const spv_valid = spvValidateWithOptions(ctx, options, &binary, &diag);
-            if (spv_valid != SPV_SUCCESS) {
+        for (const auto &message : specialized->optimizer_messages) {
+            skip |= LogError("VUID-VkPipelineShaderStageCreateInfo-module-parameter", device, loc,
+                             "%s failed in spirv-opt because it does not contain valid spirv for stage %s. %s",
+                             FormatHandle(module_state.handle()).c_str(), string_VkShaderStageFlagBits(stage), message.c_str());
+        }
+        if (specialized->optimized) {
+            if (specialized->validation_result != SPV_SUCCESS) {
                 const char *vuid = stage_create_info.pipeline ? "VUID-VkPipelineShaderStageCreateInfo-pSpecializationInfo-06849"
                                                               : "VUID-VkShaderCreateInfoEXT-pCode-08460";
                 std::string name = stage_create_info.pipeline ? FormatHandle(module_state.handle()) : "shader object";
                 skip |= LogError(vuid, device, loc,
                                  "After specialization was applied, %s produces a spirv-val error (stage %s):\n%s", name.c_str(),
-                                 string_VkShaderStageFlagBits(stage), diag && diag->error ? diag->error : "(no error text)");
+                                 string_VkShaderStageFlagBits(stage), specialized->validation_error.c_str());
             }
-
-            // The new optimized SPIR-V will NOT match the original spirv::Module object parsing, so a new spirv::Module
-            // object is needed. This an issue due to each pipeline being able to reuse the same shader module but with different
-            // spec constant values.
-            spirv::Module spec_mod(vvl::make_span<const uint32_t>(specialized_spirv.data(), specialized_spirv.size()));
-
-            // According to https://github.com/KhronosGroup/Vulkan-Docs/issues/1671 anything labeled as "static use" (such as if an
-            // input is used or not) don't have to be checked post spec constants freezing since the device compiler is not
-            // guaranteed to run things such as dead-code elimination. The following checks are things that don't follow under
-            // "static use" rules and need to be validated still.
-
-            const auto spec_entrypoint = spec_mod.FindEntrypoint(entrypoint.name.c_str(), entrypoint.stage);
-            assert(spec_entrypoint);  // spirv-opt won't change Entrypoint Name/stage
-
-            spec_mod.FindLocalSize(*spec_entrypoint, local_size_x, local_size_y, local_size_z);
-
-            total_workgroup_shared_memory = spec_mod.CalculateWorkgroupSharedMemory();
-
-            spvDiagnosticDestroy(diag);
-            spvContextDestroy(ctx);
+            local_size_x = specialized->local_size_x;
+            local_size_y = specialized->local_size_y;
+            local_size_z = specialized->local_size_z;
+            total_workgroup_shared_memory = specialized->total_workgroup_shared_memory;
         } else {
             // Should never get here, but better then asserting
             const char *vuid = stage_create_info.pipeline ? "VUID-VkPipelineShaderStageCreateInfo-pSpecializationInfo-06849"
@@ -2344,14 +2448,20 @@ bool CoreChecks::ValidatePipelineShaderStage(const StageCreateInfo &stage_create
 
     // Validate descriptor set layout against what the entrypoint actually uses
 
+    if (!entrypoint.static_stage_checks_passed.load(std::memory_order_acquire)) {
+        const uint64_t error_count = debug_report->error_message_count.load(std::memory_order_relaxed);
+        skip |= ValidateShaderStageStatic(module_state, entrypoint, stage_create_info, loc);
+        if (debug_report->error_message_count.load(std::memory_order_relaxed) == error_count) {
+            entrypoint.static_stage_checks_passed.store(true, std::memory_order_release);
+        }
+    }
+
     if (enabled_features.transformFeedback) {
         skip |= ValidateTransformFeedbackPipeline(module_state, entrypoint, stage_create_info, loc);
     }
     skip |= ValidateShaderTileImage(module_state, entrypoint, stage_create_info, stage, loc);
-    skip |= ValidateImageWrite(module_state, loc);
     skip |= ValidatePipelineExecutionModes(module_state, entrypoint, stage, stage_create_info, loc);
     skip |= ValidatePointSizeShaderState(stage_create_info, module_state, entrypoint, stage, loc);
-    skip |= ValidateBuiltinLimits(module_state, entrypoint, stage_create_info, loc);
     skip |= ValidatePrimitiveTopology(module_state, entrypoint, stage_create_info, loc);
     if (enabled_features.cooperativeMatrix) {
         skip |= ValidateCooperativeMatrix(module_state, entrypoint, stage_state, local_size_x, loc);
@@ -2403,7 +2513,10 @@ bool CoreChecks::ValidatePipelineShaderStage(const StageCreateInfo &stage_create
             skip |= ValidateRequiredSubgroupSize(module_state, stage_state, *required_subgroup_size_features, invocations,
                                                  local_size_x, local_size_y, local_size_z, loc);
         }
-        skip |= ValidateWorkgroupSharedMemory(module_state, stage, total_workgroup_shared_memory, loc);
+        // Without specialization constants it only depends on the module, see ValidateShaderStageStatic
+        if (module_state.static_data_.has_specialization_constants) {
+            skip |= ValidateWorkgroupSharedMemory(module_state, stage, total_workgroup_shared_memory, loc);
+        }
     }
 
     // Validate Push Constants use
@@ -2423,6 +2536,22 @@ bool CoreChecks::ValidatePipelineShaderStage(const StageCreateInfo &stage_create
     return skip;
 }
 
+// The checks of a stage that depend on nothing but the entry point and the device: not on the pipeline (other than for picking
+// the VUID) and not on the specialization. Once they passed for an entry point, the other pipelines using it skip them.
+bool CoreChecks::ValidateShaderStageStatic(const spirv::Module &module_state, const spirv::EntryPoint &entrypoint,
+                                           const StageCreateInfo &stage_create_info, const Location &loc) const {
+    bool skip = false;
+    skip |= ValidateImageWrite(module_state, loc);
+    skip |= ValidateBuiltinLimits(module_state, entrypoint, stage_create_info, loc);
+
+    const VkShaderStageFlagBits stage = entrypoint.stage;
+    if (!module_state.static_data_.has_specialization_constants &&
+        (stage == VK_SHADER_STAGE_COMPUTE_BIT || stage == VK_SHADER_STAGE_TASK_BIT_EXT || stage == VK_SHADER_STAGE_MESH_BIT_EXT)) {
+        skip |= ValidateWorkgroupSharedMemory(module_state, stage, 0, loc);
+    }
+    return skip;
+}
+
 uint32_t CoreChecks::CalcShaderStageCount(const vvl::Pipeline &pipeline, VkShaderStageFlagBits stageBit) const {
     uint32_t total = 0;
     for (const auto &stage_ci : pipeline.shader_stages_ci) {
@@ -2487,7 +2616,16 @@ void CoreChecks::PreCallRecordCreateShaderModule(VkDevice device, const VkShader
     // This is on the stack, we don't have to worry about threading hazards and this could be moved and used const_cast
     ValidationStateTracker::PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, record_obj,
                                                             chassis_state);
-    chassis_state.skip |= ValidateSpirvStateless(*chassis_state.module_state, chassis_state.stateless_data, record_obj.location);
+    // A deferred module is checked by the first pipeline using it, in ValidatePipelineShaderStage. The module can also share
+    // its code with a module that passed the checks already.
+    const spirv::Module &module_state = *chassis_state.module_state;
+    if (!module_state.IsParseDeferred() && !module_state.shared_data_->stateless_checks_passed.load(std::memory_order_acquire)) {
+        const uint64_t error_count = debug_report->error_message_count.load(std::memory_order_relaxed);
+        chassis_state.skip |= ValidateSpirvStateless(module_state, chassis_state.stateless_data, record_obj.location);
+        if (debug_report->error_message_count.load(std::memory_order_relaxed) == error_count) {
+            module_state.shared_data_->stateless_checks_passed.store(true, std::memory_order_release);
+        }
+    }
 }
 
 void CoreChecks::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createInfoCount, const VkShaderCreateInfoEXT *pCreateInfos,
@@ -2503,34 +2641,53 @@ void CoreChecks::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createI
     }
 }
 
-bool CoreChecks::RunSpirvValidation(spv_const_binary_t &binary, const Location &loc) const {
-    bool skip = false;
+spv_result_t CoreChecks::SpirvValidate(const spv_const_binary_t &binary, ValidationCache *cache, std::string &error) const {
+    uint64_t hash = 0;
+    if (cache) {
+        hash = hash_util::ShaderValidationHash(binary.code, binary.wordCount * sizeof(uint32_t), spirv_validation_seed);
+        if (cache->Contains(hash)) {
+            return SPV_SUCCESS;
+        }
+    }
+
     // Use SPIRV-Tools validator to try and catch any issues with the module itself. If specialization constants are present,
     // the default values will be used during validation.
     spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
-    spv_context ctx = spvContextCreate(spirv_environment);
     spv_diagnostic diag = nullptr;
     spvtools::ValidatorOptions options;
     AdjustValidatorOptions(device_extensions, enabled_features, options);
-    const spv_result_t spv_valid = spvValidateWithOptions(ctx, options, &binary, &diag);
+    const spv_result_t spv_valid = spvValidateWithOptions(GetThreadSpirvContext(spirv_environment), options, &binary, &diag);
     if (spv_valid != SPV_SUCCESS) {
+        error = diag && diag->error ? diag->error : "(no error text)";
+    }
+    spvDiagnosticDestroy(diag);
+
+    if (spv_valid == SPV_SUCCESS && cache) {
+        cache->Insert(hash);
+    }
+    return spv_valid;
+}
+
+bool CoreChecks::ReportSpirvValidation(spv_result_t result, const std::string &error, const Location &loc) const {
+    bool skip = false;
+    if (result != SPV_SUCCESS) {
         const char *vuid = loc.function == Func::vkCreateShaderModule ? "VUID-VkShaderModuleCreateInfo-pCode-08737"
                                                                       : "VUID-VkShaderCreateInfoEXT-pCode-08737";
-        if (spv_valid == SPV_WARNING) {
-            skip |= LogWarning(vuid, device, loc.dot(Field::pCode), "(spirv-val produced a warning):\n%s",
-                               diag && diag->error ? diag->error : "(no error text)");
+        if (result == SPV_WARNING) {
+            skip |= LogWarning(vuid, device, loc.dot(Field::pCode), "(spirv-val produced a warning):\n%s", error.c_str());
         } else {
-            skip |= LogError(vuid, device, loc.dot(Field::pCode), "(spirv-val produced an error):\n%s",
-                             diag && diag->error ? diag->error : "(no error text)");
+            skip |= LogError(vuid, device, loc.dot(Field::pCode), "(spirv-val produced an error):\n%s", error.c_str());
         }
     }
-
-    spvDiagnosticDestroy(diag);
-    spvContextDestroy(ctx);
-
     return skip;
 }
 
+bool CoreChecks::RunSpirvValidation(const spv_const_binary_t &binary, const Location &loc, ValidationCache *cache) const {
+    std::string error;
+    const spv_result_t result = SpirvValidate(binary, cache, error);
+    return ReportSpirvValidation(result, error, loc);
+}
+
 bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
                                                    const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
                                                    const ErrorObject &error_obj) const {
@@ -2557,23 +2714,13 @@ bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShad
     }
 
     ValidationCache *cache = GetValidationCacheInfo(pCreateInfo);
-    uint32_t hash = 0;
     // If app isn't using a shader validation cache, use the default one from CoreChecks
     if (!cache) {
         cache = CastFromHandle<ValidationCache *>(core_validation_cache);
     }
-    if (cache) {
-        hash = hash_util::ShaderHash(pCreateInfo->pCode, pCreateInfo->codeSize);
-        if (cache->Contains(hash)) {
-            return false;
-        }
-    }
 
     spv_const_binary_t binary{pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t)};
-    skip |= RunSpirvValidation(binary, create_info_loc);
-    if (!skip && cache) {
-        cache->Insert(hash);
-    }
+    skip |= RunSpirvValidation(binary, create_info_loc, cache);
 
     return skip;
 }
@@ -2910,7 +3057,8 @@ bool CoreChecks::ValidateSpirvStateless(const spirv::Module &module_state, const
         skip |= ValidateTransformFeedbackDecorations(module_state, loc);
     }
 
-    const bool has_pipeline = loc.function == Func::vkCreateShaderModule;
+    // Deferred shader modules are checked when creating a pipeline
+    const bool has_pipeline = loc.function != Func::vkCreateShadersEXT;
     // The following tries to limit the number of passes through the shader module.
     // It save a good amount of memory and complex state tracking to just check these in a 2nd pass
     for (const spirv::Instruction &insn : module_state.GetInstructions()) {
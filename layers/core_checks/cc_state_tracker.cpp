@@ -57,5 +57,5 @@ void core::CommandBuffer::RecordWaitEvents(vvl::Func command, uint32_t eventCoun
 std::shared_ptr<vvl::CommandBuffer> CoreChecks::CreateCmdBufferState(VkCommandBuffer handle,
                                                                      const VkCommandBufferAllocateInfo* create_info,
                                                                      const vvl::CommandPool* pool) {
-    return std::static_pointer_cast<vvl::CommandBuffer>(std::make_shared<core::CommandBuffer>(*this, handle, create_info, pool));
+    return std::static_pointer_cast<vvl::CommandBuffer>(vvl::MakeState<core::CommandBuffer>(*this, handle, create_info, pool));
 }
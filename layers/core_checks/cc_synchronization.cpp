@@ -1863,9 +1863,9 @@ void CoreChecks::RecordBarrierValidationInfo(const Location &loc, vvl::CommandBu
                                              QFOTransferBarrierSets<TransferBarrier> &barrier_sets) {
     if (IsTransferOp(barrier)) {
         if (cb_state.IsReleaseOp(barrier) && !IsQueueFamilyExternal(barrier.dstQueueFamilyIndex)) {
-            barrier_sets.release.emplace(barrier);
+            barrier_sets.release.Insert(barrier);
         } else if (cb_state.IsAcquireOp(barrier) && !IsQueueFamilyExternal(barrier.srcQueueFamilyIndex)) {
-            barrier_sets.acquire.emplace(barrier);
+            barrier_sets.acquire.Insert(barrier);
         }
     }
 
@@ -1924,22 +1924,38 @@ void CoreChecks::RecordBarriers(Func func_name, vvl::CommandBuffer &cb_state, co
     }
 }
 
-template <typename TransferBarrier, typename Scoreboard>
+template <typename TransferBarrier>
 bool CoreChecks::ValidateAndUpdateQFOScoreboard(const vvl::CommandBuffer &cb_state, const char *operation,
-                                                const TransferBarrier &barrier, Scoreboard *scoreboard, const Location &loc) const {
-    // Record to the scoreboard or report that we have a duplication
+                                                const QFOTransferBarrierList<TransferBarrier> &barriers,
+                                                QFOTransferCBScoreboard<TransferBarrier> *scoreboard, const Location &loc) const {
+    // Merge the sorted barriers into the scoreboard in one pass, reporting the ones that are already there
     bool skip = false;
-    auto inserted = scoreboard->emplace(barrier, &cb_state);
-    if (!inserted.second && inserted.first->second != &cb_state) {
-        // This is a duplication (but don't report duplicates from the same CB, as we do that at record time
-        const LogObjectList objlist(cb_state.Handle(), barrier.handle, inserted.first->second->Handle());
-        skip |= LogWarning(TransferBarrier::DuplicateQFOInSubmit(), objlist, loc,
-                           "%s %s queue ownership of %s (%s), from srcQueueFamilyIndex %" PRIu32 " to dstQueueFamilyIndex %" PRIu32
-                           " duplicates existing barrier submitted in this batch from %s.",
-                           TransferBarrier::BarrierName(), operation, TransferBarrier::HandleName(),
-                           FormatHandle(barrier.handle).c_str(), barrier.srcQueueFamilyIndex, barrier.dstQueueFamilyIndex,
-                           FormatHandle(inserted.first->second->Handle()).c_str());
+    QFOTransferCBScoreboard<TransferBarrier> merged;
+    merged.reserve(scoreboard->size() + barriers.size());
+    auto board_it = scoreboard->cbegin();
+    for (const TransferBarrier &barrier : barriers) {
+        for (; board_it != scoreboard->cend() && board_it->first < barrier; ++board_it) {
+            merged.emplace_back(*board_it);
+        }
+        if (board_it != scoreboard->cend() && !(barrier < board_it->first)) {
+            // This is a duplication (but don't report duplicates from the same CB, as we do that at record time
+            // The entry already on the scoreboard is kept, the next barrier copies it to the merged one
+            if (board_it->second != &cb_state) {
+                const LogObjectList objlist(cb_state.Handle(), barrier.handle, board_it->second->Handle());
+                skip |= LogWarning(TransferBarrier::DuplicateQFOInSubmit(), objlist, loc,
+                                   "%s %s queue ownership of %s (%s), from srcQueueFamilyIndex %" PRIu32
+                                   " to dstQueueFamilyIndex %" PRIu32
+                                   " duplicates existing barrier submitted in this batch from %s.",
+                                   TransferBarrier::BarrierName(), operation, TransferBarrier::HandleName(),
+                                   FormatHandle(barrier.handle).c_str(), barrier.srcQueueFamilyIndex, barrier.dstQueueFamilyIndex,
+                                   FormatHandle(board_it->second->Handle()).c_str());
+            }
+            continue;
+        }
+        merged.emplace_back(barrier, &cb_state);
     }
+    merged.insert(merged.end(), board_it, scoreboard->cend());
+    *scoreboard = std::move(merged);
     return skip;
 }
 
@@ -1950,16 +1966,25 @@ bool CoreChecks::ValidateQueuedQFOTransferBarriers(const vvl::CommandBuffer &cb_
                                                    const Location &loc) const {
     bool skip = false;
     const auto &cb_barriers = cb_state.GetQFOBarrierSets(TransferBarrier());
+    // The barriers are sorted in vkEndCommandBuffer, submitting a command buffer that was not ended is already an error
+    if (!cb_barriers.release.IsSorted() || !cb_barriers.acquire.IsSorted()) {
+        return skip;
+    }
     const char *barrier_name = TransferBarrier::BarrierName();
     const char *handle_name = TransferBarrier::HandleName();
+    using BarrierIterator = typename QFOTransferBarrierList<TransferBarrier>::const_iterator;
     // No release should have an extant duplicate (WARNING)
-    for (const auto &release : cb_barriers.release) {
-        // Check the global pending release barriers
-        const auto set_it = global_release_barriers.find(release.handle);
-        if (set_it != global_release_barriers.cend()) {
-            const QFOTransferBarrierSet<TransferBarrier> &set_for_handle = set_it->second;
-            const auto found = set_for_handle.find(release);
-            if (found != set_for_handle.cend()) {
+    ForEachQFOTransferHandle(cb_barriers.release, [&](const typename TransferBarrier::HandleType handle, BarrierIterator first,
+                                                      BarrierIterator last) {
+        // Check the global pending release barriers, once for all the releases of the resource
+        const auto set_it = global_release_barriers.find(handle);
+        if (set_it == global_release_barriers.cend()) {
+            return;
+        }
+        const QFOTransferBarrierList<TransferBarrier> &list_for_handle = set_it->second;
+        for (; first != last; ++first) {
+            const TransferBarrier *found = list_for_handle.Find(*first);
+            if (found) {
                 skip |= LogWarning(TransferBarrier::DuplicateQFOSubmitted(), cb_state.Handle(), loc,
                                    "%s releasing queue ownership of %s (%s), from srcQueueFamilyIndex %" PRIu32
                                    " to dstQueueFamilyIndex %" PRIu32
@@ -1968,25 +1993,26 @@ bool CoreChecks::ValidateQueuedQFOTransferBarriers(const vvl::CommandBuffer &cb_
                                    found->dstQueueFamilyIndex);
             }
         }
-        skip |= ValidateAndUpdateQFOScoreboard(cb_state, "releasing", release, &scoreboards->release, loc);
-    }
+    });
+    skip |= ValidateAndUpdateQFOScoreboard(cb_state, "releasing", cb_barriers.release, &scoreboards->release, loc);
     // Each acquire must have a matching release (ERROR)
-    for (const auto &acquire : cb_barriers.acquire) {
-        const auto set_it = global_release_barriers.find(acquire.handle);
-        bool matching_release_found = false;
-        if (set_it != global_release_barriers.cend()) {
-            const QFOTransferBarrierSet<TransferBarrier> &set_for_handle = set_it->second;
-            matching_release_found = set_for_handle.find(acquire) != set_for_handle.cend();
-        }
-        if (!matching_release_found) {
-            skip |= LogError(TransferBarrier::MissingQFOReleaseInSubmit(), cb_state.Handle(), loc,
-                             "in submitted command buffer %s acquiring ownership of %s (%s), from srcQueueFamilyIndex %" PRIu32
-                             " to dstQueueFamilyIndex %" PRIu32 " has no matching release barrier queued for execution.",
-                             barrier_name, handle_name, FormatHandle(acquire.handle).c_str(), acquire.srcQueueFamilyIndex,
-                             acquire.dstQueueFamilyIndex);
-        }
-        skip |= ValidateAndUpdateQFOScoreboard(cb_state, "acquiring", acquire, &scoreboards->acquire, loc);
-    }
+    ForEachQFOTransferHandle(cb_barriers.acquire, [&](const typename TransferBarrier::HandleType handle, BarrierIterator first,
+                                                      BarrierIterator last) {
+        const auto set_it = global_release_barriers.find(handle);
+        const QFOTransferBarrierList<TransferBarrier> *list_for_handle =
+            (set_it != global_release_barriers.cend()) ? &set_it->second : nullptr;
+        for (; first != last; ++first) {
+            const TransferBarrier &acquire = *first;
+            if (!list_for_handle || !list_for_handle->Find(acquire)) {
+                skip |= LogError(TransferBarrier::MissingQFOReleaseInSubmit(), cb_state.Handle(), loc,
+                                 "in submitted command buffer %s acquiring ownership of %s (%s), from srcQueueFamilyIndex %" PRIu32
+                                 " to dstQueueFamilyIndex %" PRIu32 " has no matching release barrier queued for execution.",
+                                 barrier_name, handle_name, FormatHandle(acquire.handle).c_str(), acquire.srcQueueFamilyIndex,
+                                 acquire.dstQueueFamilyIndex);
+            }
+        }
+    });
+    skip |= ValidateAndUpdateQFOScoreboard(cb_state, "acquiring", cb_barriers.acquire, &scoreboards->acquire, loc);
     return skip;
 }
 
@@ -2005,32 +2031,39 @@ bool CoreChecks::ValidateQueuedQFOTransfers(const vvl::CommandBuffer &cb_state,
 template <typename TransferBarrier>
 void RecordQueuedQFOTransferBarriers(QFOTransferBarrierSets<TransferBarrier> &cb_barriers,
                                      GlobalQFOTransferBarrierMap<TransferBarrier> &global_release_barriers) {
-    // Add release barriers from this submit to the global map
-    for (const auto &release : cb_barriers.release) {
+    using BarrierIterator = typename QFOTransferBarrierList<TransferBarrier>::const_iterator;
+    // Add release barriers from this submit to the global map, with one update per resource
+    ForEachQFOTransferHandle(cb_barriers.release, [&global_release_barriers](const typename TransferBarrier::HandleType handle,
+                                                                             BarrierIterator first, BarrierIterator last) {
         // the global barrier list is mapped by resource handle to allow cleanup on resource destruction
         // NOTE: vvl::concurrent_ordered_map::find() makes a thread safe copy of the result, so we must
         // copy back after updating.
-        auto iter = global_release_barriers.find(release.handle);
-        iter->second.insert(release);
-        global_release_barriers.insert_or_assign(release.handle, iter->second);
-    }
+        auto iter = global_release_barriers.find(handle);
+        for (; first != last; ++first) {
+            iter->second.Insert(*first);
+        }
+        global_release_barriers.insert_or_assign(handle, iter->second);
+    });
 
     // Erase acquired barriers from this submit from the global map -- essentially marking releases as consumed
-    for (const auto &acquire : cb_barriers.acquire) {
+    ForEachQFOTransferHandle(cb_barriers.acquire, [&global_release_barriers](const typename TransferBarrier::HandleType handle,
+                                                                             BarrierIterator first, BarrierIterator last) {
         // NOTE: We're not using [] because we don't want to create entries for missing releases
-        auto set_it = global_release_barriers.find(acquire.handle);
+        auto set_it = global_release_barriers.find(handle);
         if (set_it != global_release_barriers.end()) {
-            QFOTransferBarrierSet<TransferBarrier> &set_for_handle = set_it->second;
-            set_for_handle.erase(acquire);
-            if (set_for_handle.empty()) {  // Clean up empty sets
-                global_release_barriers.erase(acquire.handle);
+            QFOTransferBarrierList<TransferBarrier> &list_for_handle = set_it->second;
+            for (; first != last; ++first) {
+                list_for_handle.Erase(*first);
+            }
+            if (list_for_handle.empty()) {  // Clean up empty lists
+                global_release_barriers.erase(handle);
             } else {
                 // NOTE: vvl::concurrent_ordered_map::find() makes a thread safe copy of the result, so we must
                 // copy back after updating.
-                global_release_barriers.insert_or_assign(acquire.handle, set_for_handle);
+                global_release_barriers.insert_or_assign(handle, list_for_handle);
             }
         }
-    }
+    });
 }
 
 void CoreChecks::RecordQueuedQFOTransfers(vvl::CommandBuffer &cb_state) {
@@ -2051,17 +2084,11 @@ bool CoreChecks::ValidateQFOTransferBarrierUniqueness(const Location &barrier_lo
     }
     const TransferBarrier *barrier_record = nullptr;
     if (cb_state.IsReleaseOp(barrier) && !IsQueueFamilyExternal(barrier.dstQueueFamilyIndex)) {
-        const auto found = barrier_sets.release.find(barrier);
-        if (found != barrier_sets.release.cend()) {
-            barrier_record = &(*found);
-            transfer_type = "releasing";
-        }
+        barrier_record = barrier_sets.release.Find(barrier);
+        transfer_type = "releasing";
     } else if (cb_state.IsAcquireOp(barrier) && !IsQueueFamilyExternal(barrier.srcQueueFamilyIndex)) {
-        const auto found = barrier_sets.acquire.find(barrier);
-        if (found != barrier_sets.acquire.cend()) {
-            barrier_record = &(*found);
-            transfer_type = "acquiring";
-        }
+        barrier_record = barrier_sets.acquire.Find(barrier);
+        transfer_type = "acquiring";
     }
     if (barrier_record != nullptr) {
         skip |= LogWarning(TransferBarrier::DuplicateQFOInCB(), cb_state.Handle(), barrier_loc,
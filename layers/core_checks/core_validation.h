@@ -25,6 +25,7 @@
 #include "error_message/error_location.h"
 #include "error_message/record_object.h"
 #include "containers/qfo_transfer.h"
+#include "utils/worker_pool.h"
 
 typedef vvl::unordered_map<const vvl::Image*, std::optional<GlobalImageLayoutRangeMap>> GlobalImageLayoutMap;
 
@@ -55,6 +56,24 @@ class CoreChecks : public ValidationStateTracker {
     GlobalQFOTransferBarrierMap<QFOBufferTransferBarrier> qfo_release_buffer_barrier_map;
     VkValidationCacheEXT core_validation_cache = VK_NULL_HANDLE;
     std::string validation_cache_path;
+    // Seeds the validation cache hashes with the spirv-val target environment and options of the device
+    uint64_t spirv_validation_seed = 0;
+    // The layer wide worker_pool, or with only the shader_validation_threads setting set a pool of its own. Null otherwise.
+    std::shared_ptr<vvl::WorkerPool> shader_validation_pool_;
+    // Results of SpecializeShaderStage, engines create many pipelines from a module with a few specializations. Cleared
+    // when full, most apps never get there.
+    static constexpr size_t kSpecializationCacheSize = 4096;
+    mutable std::shared_mutex specialization_cache_lock_;
+    mutable vvl::unordered_map<uint64_t, std::shared_ptr<const SpecializedSpirv>> specialization_cache_;
+    // Producer and consumer entry points that passed ValidateInterfaceBetweenStages without reporting anything, the check
+    // only depends on the two entry points. The weak_ptrs detect an entry point freed and another one at the same address.
+    struct InterfaceMatch {
+        std::weak_ptr<const spirv::EntryPoint> producer;
+        std::weak_ptr<const spirv::EntryPoint> consumer;
+    };
+    static constexpr size_t kInterfaceMatchCacheSize = 4096;
+    mutable std::shared_mutex interface_match_cache_lock_;
+    mutable vvl::unordered_map<uint64_t, InterfaceMatch> interface_match_cache_;
 
     CoreChecks() { container_type = LayerObjectTypeCoreValidation; }
 
@@ -206,10 +225,8 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateGraphicsPipelineBindPoint(const vvl::CommandBuffer& cb_state, const vvl::Pipeline& pipeline,
                                            const Location& loc) const;
     bool ValidatePipelineBindPoint(const vvl::CommandBuffer& cb_state, VkPipelineBindPoint bind_point, const Location& loc) const;
-    bool ValidateMemoryIsMapped(uint32_t mem_range_count, const VkMappedMemoryRange* mem_ranges,
-                                const ErrorObject& error_obj) const;
-    bool ValidateMappedMemoryRangeDeviceLimits(uint32_t mem_range_count, const VkMappedMemoryRange* mem_ranges,
-                                               const ErrorObject& error_obj) const;
+    bool ValidateMappedMemoryRanges(uint32_t mem_range_count, const VkMappedMemoryRange* mem_ranges,
+                                    const ErrorObject& error_obj) const;
     bool ValidateSecondaryCommandBufferState(const vvl::CommandBuffer& cb_state, const vvl::CommandBuffer& sub_cb_state,
                                              const Location& cb_loc) const;
     bool ValidateInheritanceInfoFramebuffer(VkCommandBuffer primaryBuffer, const vvl::CommandBuffer& cb_state,
@@ -454,9 +471,10 @@ class CoreChecks : public ValidationStateTracker {
                                     QFOTransferCBScoreboards<QFOBufferTransferBarrier>* qfo_buffer_scoreboards,
                                     const Location& loc) const;
 
-    template <typename Barrier, typename Scoreboard>
-    bool ValidateAndUpdateQFOScoreboard(const vvl::CommandBuffer& cb_state, const char* operation, const Barrier& barrier,
-                                        Scoreboard* scoreboard, const Location& loc) const;
+    template <typename TransferBarrier>
+    bool ValidateAndUpdateQFOScoreboard(const vvl::CommandBuffer& cb_state, const char* operation,
+                                        const QFOTransferBarrierList<TransferBarrier>& barriers,
+                                        QFOTransferCBScoreboard<TransferBarrier>* scoreboard, const Location& loc) const;
     template <typename Barrier, typename TransferBarrier>
     void RecordBarrierValidationInfo(const Location& loc, vvl::CommandBuffer& cb_state, const Barrier& barrier,
                                      QFOTransferBarrierSets<TransferBarrier>& barrier_sets);
@@ -508,7 +526,8 @@ class CoreChecks : public ValidationStateTracker {
 
     // Validate contents of a CopyUpdate
     using DescriptorSet = vvl::DescriptorSet;
-    bool ValidateCopyUpdate(const VkCopyDescriptorSet& update, const Location& copy_loc) const;
+    bool ValidateCopyUpdate(const VkCopyDescriptorSet& update, const DescriptorSet& src_set, const DescriptorSet& dst_set,
+                            const Location& copy_loc) const;
     bool VerifyCopyUpdateContents(const VkCopyDescriptorSet& update, const DescriptorSet& src_set, VkDescriptorType src_type,
                                   uint32_t src_index, const DescriptorSet& dst_set, VkDescriptorType dst_type, uint32_t dst_index,
                                   const Location& copy_loc) const;
@@ -588,7 +607,18 @@ class CoreChecks : public ValidationStateTracker {
     void PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createInfoCount, const VkShaderCreateInfoEXT* pCreateInfos,
                                        const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders,
                                        const RecordObject& record_obj, chassis::ShaderObject& chassis_state) override;
-    bool RunSpirvValidation(spv_const_binary_t& binary, const Location& loc) const;
+    // Runs spirv-val without reporting anything, so it can run on any thread. Modules found in the cache are not validated
+    // again, valid ones are added to it.
+    spv_result_t SpirvValidate(const spv_const_binary_t& binary, ValidationCache* cache, std::string& error) const;
+    bool ReportSpirvValidation(spv_result_t result, const std::string& error, const Location& loc) const;
+    bool RunSpirvValidation(const spv_const_binary_t& binary, const Location& loc, ValidationCache* cache) const;
+    // Applies the specialization constants of the stage and validates the result, without reporting anything. The result
+    // is shared by all the stages with the same code, entrypoint and specialization info.
+    std::shared_ptr<const SpecializedSpirv> SpecializeShaderStage(const PipelineStageState& stage_state) const;
+    std::shared_ptr<const SpecializedSpirv> ApplySpecializationConstants(const PipelineStageState& stage_state) const;
+    // Specializes the stages of the pipelines of a call on the shader validation threads, ValidatePipelineShaderStage then
+    // only reports the results
+    void SpecializePipelineStages(const PipelineStates& pipeline_states) const;
     bool ValidateSpirvStateless(const spirv::Module& module_state, const spirv::StatelessData& stateless_data,
                                 const Location& loc) const;
     bool PreCallValidateCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
@@ -596,6 +626,8 @@ class CoreChecks : public ValidationStateTracker {
                                            const ErrorObject& error_obj) const override;
     bool ValidatePipelineShaderStage(const StageCreateInfo& stage_create_info, const PipelineStageState& stage_state,
                                      const Location& loc) const;
+    bool ValidateShaderStageStatic(const spirv::Module& module_state, const spirv::EntryPoint& entrypoint,
+                                   const StageCreateInfo& stage_create_info, const Location& loc) const;
     bool ValidatePointSizeShaderState(const StageCreateInfo& create_info, const spirv::Module& module_state,
                                       const spirv::EntryPoint& entrypoint, VkShaderStageFlagBits stage, const Location& loc) const;
     bool ValidatePrimitiveRateShaderState(const StageCreateInfo& create_info, const spirv::Module& module_state,
@@ -654,7 +686,10 @@ class CoreChecks : public ValidationStateTracker {
                                  const Location& loc) const;
     bool ValidateInterfaceBetweenStages(const spirv::Module& producer, const spirv::EntryPoint& producer_entrypoint,
                                         const spirv::Module& consumer, const spirv::EntryPoint& consumer_entrypoint,
-                                        const Location& create_info_loc) const;
+                                        const Location& create_info_loc, bool& output_not_consumed) const;
+    bool IsInterfaceMatchCached(const spirv::EntryPoint& producer_entrypoint, const spirv::EntryPoint& consumer_entrypoint) const;
+    void CacheInterfaceMatch(const std::shared_ptr<const spirv::EntryPoint>& producer_entrypoint,
+                             const std::shared_ptr<const spirv::EntryPoint>& consumer_entrypoint) const;
     bool ValidateFsOutputsAgainstRenderPass(const spirv::Module& module_state, const spirv::EntryPoint& entrypoint,
                                             const vvl::Pipeline& pipeline, uint32_t subpass_index,
                                             const Location& create_info_loc) const;
@@ -804,7 +839,7 @@ class CoreChecks : public ValidationStateTracker {
 
     bool VerifyFramebufferAndRenderPassLayouts(const vvl::CommandBuffer& cb_state, const VkRenderPassBeginInfo& begin_info,
                                                const vvl::RenderPass& render_pass_state, const vvl::Framebuffer& framebuffer_state,
-                                               const Location& rp_begin_loc) const;
+                                               bool usage_validated, const Location& rp_begin_loc) const;
     void RecordCmdBeginRenderPassLayouts(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
                                          const VkSubpassContents contents);
     void TransitionAttachmentRefLayout(vvl::CommandBuffer& cb_state, const vku::safe_VkAttachmentReference2& ref);
@@ -1002,6 +1037,10 @@ class CoreChecks : public ValidationStateTracker {
                                     const RecordObject& record_obj) override;
 
     template <typename RegionType>
+    bool ValidateCmdCopyBufferResources(const vvl::CommandBuffer& cb_state, const vvl::Buffer& src_buffer_state,
+                                        const vvl::Buffer& dst_buffer_state, uint32_t regionCount, const RegionType* pRegions,
+                                        const Location& loc) const;
+    template <typename RegionType>
     bool ValidateCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount,
                                const RegionType* pRegions, const Location& loc) const;
 
@@ -1017,6 +1056,9 @@ class CoreChecks : public ValidationStateTracker {
     template <typename RegionType>
     void RecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount,
                              const RegionType* pRegions, const Location& loc);
+    template <typename RegionType>
+    void DeferCmdCopyBufferResources(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount,
+                                     const RegionType* pRegions, const Location& loc);
     void PreCallRecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount,
                                     const VkBufferCopy* pRegions, const RecordObject& record_obj) override;
     void PreCallRecordCmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2KHR* pCopyBufferInfo,
@@ -1366,6 +1408,7 @@ class CoreChecks : public ValidationStateTracker {
     bool PreCallValidateCmdEndRenderingKHR(VkCommandBuffer commandBuffer, const ErrorObject& error_obj) const override;
     bool PreCallValidateCmdEndRendering(VkCommandBuffer commandBuffer, const ErrorObject& error_obj) const override;
     bool PreCallValidateEndCommandBuffer(VkCommandBuffer commandBuffer, const ErrorObject& error_obj) const override;
+    void PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, const RecordObject& record_obj) override;
     bool PreCallValidateResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags,
                                            const ErrorObject& error_obj) const override;
     bool PreCallValidateCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline,
@@ -1424,12 +1467,13 @@ class CoreChecks : public ValidationStateTracker {
                                      const Location& info_loc) const;
     bool CommonBuildAccelerationStructureValidation(const VkAccelerationStructureBuildGeometryInfoKHR& info,
                                                     const Location& info_loc, LogObjectList object_list) const;
+    // Validate that the memory of the acceleration structures built by a call does not alias, for all pInfos at once
     bool ValidateAccelerationStructuresMemoryAlisasing(const LogObjectList& objlist, uint32_t infoCount,
-                                                       const VkAccelerationStructureBuildGeometryInfoKHR* pInfos, uint32_t info_i,
+                                                       const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
                                                        const ErrorObject& error_obj) const;
     bool ValidateAccelerationStructuresDeviceScratchBufferMemoryAlisasing(
         const LogObjectList& objlist, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
-        uint32_t info_i, const VkAccelerationStructureBuildRangeInfoKHR* range_infos, const ErrorObject& error_obj) const;
+        const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos, const ErrorObject& error_obj) const;
     bool PreCallValidateCmdBuildAccelerationStructuresKHR(VkCommandBuffer commandBuffer, uint32_t infoCount,
                                                           const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
                                                           const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos,
@@ -114,7 +114,7 @@ bool vvl::DescriptorValidator::ValidateBinding(const DescriptorBindingInfo &bind
         case DescriptorClass::ImageSampler: {
             auto &imgs_binding = static_cast<vvl::ImageSamplerBinding &>(binding);
             for (auto index : indices) {
-                auto &descriptor = imgs_binding.descriptors[index];
+                const auto &descriptor = std::as_const(imgs_binding.descriptors)[index];
                 descriptor.UpdateDrawState(&dev_state, &cb_state);
             }
             skip |= ValidateDescriptors(binding_info, imgs_binding, indices);
@@ -123,7 +123,7 @@ bool vvl::DescriptorValidator::ValidateBinding(const DescriptorBindingInfo &bind
         case DescriptorClass::Image: {
             auto &img_binding = static_cast<vvl::ImageBinding &>(binding);
             for (auto index : indices) {
-                auto &descriptor = img_binding.descriptors[index];
+                const auto &descriptor = std::as_const(img_binding.descriptors)[index];
                 descriptor.UpdateDrawState(&dev_state, &cb_state);
             }
             skip |= ValidateDescriptors(binding_info, img_binding, indices);
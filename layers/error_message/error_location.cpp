@@ -19,7 +19,10 @@
 #include "utils/vk_layer_utils.h"
 #include <map>
 
-void Location::AppendFields(std::ostream& out) const {
+// Deep enough for any Location chain the layers build
+static constexpr size_t kLocationTextSize = 1024;
+
+void Location::AppendFields(vvl::TextBuffer& out) const {
     if (prev) {
         // When apply a .dot(sub_index) we duplicate the field item
         // Instead of dealing with partial non-const Location, just do the check here
@@ -30,31 +33,35 @@ void Location::AppendFields(std::ostream& out) const {
 
         // check if need connector from last item
         if (prev_loc.structure != vvl::Struct::Empty || prev_loc.field != vvl::Field::Empty) {
-            out << ((prev_loc.index == kNoIndex && IsFieldPointer(prev_loc.field)) ? "->" : ".");
+            out.Append((prev_loc.index == kNoIndex && IsFieldPointer(prev_loc.field)) ? "->" : ".");
         }
     }
     if (isPNext && structure != vvl::Struct::Empty) {
-        out << "pNext<" << vvl::String(structure) << (field != vvl::Field::Empty ? ">." : ">");
+        out.Append("pNext<").Append(vvl::String(structure)).Append(field != vvl::Field::Empty ? ">." : ">");
     }
     if (field != vvl::Field::Empty) {
-        out << vvl::String(field);
+        out.Append(vvl::String(field));
         if (index != kNoIndex) {
-            out << "[" << index << "]";
+            out.Append('[').AppendUint(index).Append(']');
         }
     }
 }
 
+void Location::AppendMessage(vvl::TextBuffer& out) const {
+    out.Append(StringFunc()).Append("(): ");
+    AppendFields(out);
+}
+
 std::string Location::Fields() const {
-    std::stringstream out;
+    vvl::StackTextBuffer<kLocationTextSize> out;
     AppendFields(out);
-    return out.str();
+    return std::string(out.view());
 }
 
 std::string Location::Message() const {
-    std::stringstream out;
-    out << StringFunc() << "(): ";
-    AppendFields(out);
-    return out.str();
+    vvl::StackTextBuffer<kLocationTextSize> out;
+    AppendMessage(out);
+    return std::string(out.view());
 }
 
 namespace vvl {
@@ -82,6 +89,11 @@ LocationCapture::LocationCapture(LocationCapture&& other)
     }
 }
 
+void LocationCapture::Reset(const Location& loc) {
+    capture.clear();
+    Capture(loc, 1);
+}
+
 const Location* LocationCapture::Capture(const Location& loc, CaptureStore::size_type depth) {
     const Location* prev_capture = nullptr;
     if (loc.prev) {
@@ -25,6 +25,7 @@
 #include "logging.h"
 #include "containers/custom_containers.h"
 #include "chassis/chassis_handle_data.h"
+#include "utils/text_buffer.h"
 
 // Holds the 'Location' of where the code is inside a function/struct/etc
 // see docs/error_object.md for more details
@@ -36,7 +37,7 @@ struct Location {
 
     const vvl::Struct structure;
     const vvl::Field field;
-    const uint32_t index;  // optional index if checking an array.
+    uint32_t index;        // optional index if checking an array. Not const, a loop can update it for each element.
     const bool isPNext;    // will print the struct is from a 'pNext` chain
     const Location* prev;
 
@@ -47,7 +48,10 @@ struct Location {
     Location(const Location& prev_loc, vvl::Struct s, vvl::Field f, uint32_t i, bool p)
         : function(prev_loc.function), structure(s), field(f), index(i), isPNext(p), prev(&prev_loc) {}
 
-    void AppendFields(std::ostream &out) const;
+    // Write into a fixed size buffer and never allocate, ex. with a vvl::StackTextBuffer. Fields() and Message() are
+    // the same text as a std::string.
+    void AppendFields(vvl::TextBuffer &out) const;
+    void AppendMessage(vvl::TextBuffer &out) const;
     std::string Fields() const;
     std::string Message() const;
 
@@ -115,6 +119,9 @@ struct LocationCapture {
     LocationCapture(const LocationCapture &other);
     LocationCapture(LocationCapture &&other);
 
+    // Captures loc in place of the current location, reusing the storage
+    void Reset(const Location& loc);
+
     const Location& Get() const { return capture.back(); }
 
   protected:
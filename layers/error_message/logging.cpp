@@ -16,8 +16,14 @@
  */
 #include "logging.h"
 
+#include <algorithm>
+#include <condition_variable>
 #include <csignal>
 #include <cstring>
+#include <iterator>
+#include <optional>
+#include <thread>
+#include <vector>
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 #include <debugapi.h>
 #endif
@@ -27,6 +33,8 @@
 #include "generated/vk_validation_error_messages.h"
 #include "error_location.h"
 #include "utils/hash_util.h"
+#include "containers/mpsc_ring.h"
+#include "structured_log.h"
 
 [[maybe_unused]] const char *kVUIDUndefined = "VUID_Undefined";
 
@@ -58,20 +66,44 @@ static inline void DebugReportFlagsToAnnotFlags(VkDebugReportFlagsEXT dr_flags,
     }
 }
 
+// One nibble per severity (the severity bits are 4 bits apart), holding the message types wanted at that severity
+static uint32_t SeverityTypeMask(VkDebugUtilsMessageSeverityFlagsEXT severities, VkDebugUtilsMessageTypeFlagsEXT types) {
+    static_assert(VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT == 0x1000, "The severity bits must be 4 bits apart");
+    static_assert(VK_DEBUG_UTILS_MESSAGE_TYPE_DEVICE_ADDRESS_BINDING_BIT_EXT == 0x8, "The message types must fit a nibble");
+    uint32_t mask = 0;
+    for (uint32_t shift = 0; shift <= 12; shift += 4) {
+        if (severities & (1u << shift)) {
+            mask |= (types & 0xfu) << shift;
+        }
+    }
+    return mask;
+}
+
 void DebugReport::SetDebugUtilsSeverityFlags(std::vector<VkLayerDbgFunctionState> &callbacks) {
-    // For all callback in list, return their complete set of severities and modes
+    // Rebuilt from scratch so removing a callback also stops the messages only it wanted. Default callbacks are only
+    // called when there are no other callbacks, same as in DeliverMessage.
+    bool use_default_callbacks = true;
+    for (const auto &item : callbacks) {
+        use_default_callbacks &= item.IsDefault();
+    }
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    if (force_default_log_callback) {
+        use_default_callbacks = true;
+    }
+#endif
+    uint32_t mask = 0;
     for (const auto &item : callbacks) {
+        if (item.IsDefault() && !use_default_callbacks) continue;
         if (item.IsUtils()) {
-            active_severities |= item.debug_utils_msg_flags;
-            active_types |= item.debug_utils_msg_type;
+            mask |= SeverityTypeMask(item.debug_utils_msg_flags, item.debug_utils_msg_type);
         } else {
             VkFlags severities = 0;
             VkFlags types = 0;
             DebugReportFlagsToAnnotFlags(item.debug_report_msg_flags, &severities, &types);
-            active_severities |= severities;
-            active_types |= types;
+            mask |= SeverityTypeMask(severities, types);
         }
     }
+    active_callback_mask.store(mask, std::memory_order_relaxed);
 }
 
 void DebugReport::RemoveDebugUtilsCallback(uint64_t callback) {
@@ -90,39 +122,139 @@ void DebugReport::RemoveDebugUtilsCallback(uint64_t callback) {
     SetDebugUtilsSeverityFlags(callbacks);
 }
 
-// Returns TRUE if the number of times this message has been logged is over the set limit
-bool DebugReport::UpdateLogMsgCounts(int32_t vuid_hash) const {
-    auto vuid_count_it = duplicate_message_count_map.find(vuid_hash);
-    if (vuid_count_it == duplicate_message_count_map.end()) {
-        duplicate_message_count_map.emplace(vuid_hash, 1);
+// vuid_spec_text is generated sorted by VUID, strcmp order
+static const vuid_spec_text_pair *FindVuidSpecText(std::string_view vuid) {
+    const auto end = std::end(vuid_spec_text);
+    const auto less = [](const vuid_spec_text_pair &entry, std::string_view value) { return std::string_view(entry.vuid) < value; };
+    const auto it = std::lower_bound(std::begin(vuid_spec_text), end, vuid, less);
+    return (it != end && std::string_view(it->vuid) == vuid) ? it : nullptr;
+}
+
+static constexpr uint32_t MessageCountTableCapacity(size_t count) {
+    uint32_t capacity = 1;
+    while (capacity < count) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+// Number of times each message was logged, looked up without a lock or allocation on every message.
+//
+// Open addressed table of 64 bit slots holding (message id << 32 | count), an empty slot is 0 and a used slot has a count
+// of at least 1. Slots are claimed with a CAS and never freed, so a key never moves once it is found. The set of VUIDs is
+// closed (plus a few hand written ids), the table is sized to stay well under half full even if every one of them is hit.
+class DebugReport::MessageCountTable {
+  public:
+    // Returns TRUE if the message was already logged |limit| times, otherwise counts it
+    bool CountAndCheckLimit(uint32_t message_id, uint32_t limit) {
+        const uint64_t key = uint64_t(message_id) << 32;
+        // The message id is already a hash, only mix the upper bits in since the index uses the lowest ones
+        uint32_t index = (message_id ^ (message_id >> 16)) & kMask;
+        for (uint32_t probe = 0; probe < kCapacity; ++probe, index = (index + 1) & kMask) {
+            std::atomic<uint64_t> &slot = slots_[index];
+            uint64_t value = slot.load(std::memory_order_relaxed);
+            while (true) {
+                if (value == 0) {
+                    if (slot.compare_exchange_weak(value, key | 1, std::memory_order_relaxed)) {
+                        return false;
+                    }
+                    continue;
+                }
+                if ((value & ~kCountMask) != key) {
+                    break;
+                }
+                if ((value & kCountMask) >= limit) {
+                    return true;
+                }
+                if (slot.compare_exchange_weak(value, value + 1, std::memory_order_relaxed)) {
+                    return false;
+                }
+            }
+        }
+        // Every slot is taken by another message, which the sizing below rules out in practice. Not counting the message
+        // only means it is never suppressed.
         return false;
-    } else {
-        if (vuid_count_it->second >= duplicate_message_limit) {
+    }
+
+  private:
+    static constexpr uint64_t kCountMask = 0xffffffff;
+    static constexpr uint32_t kCapacity = MessageCountTableCapacity(2 * std::size(vuid_spec_text) + 1024);
+    static constexpr uint32_t kMask = kCapacity - 1;
+
+    std::atomic<uint64_t> slots_[kCapacity]{};
+};
+
+// splitmix64 finalizer
+static inline uint64_t MixBits(uint64_t value) {
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ull;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebull;
+    value ^= value >> 31;
+    return value;
+}
+
+// Approximate number of times each (message, primary object) pair was logged, in a fixed amount of memory whatever the
+// number of objects the application creates.
+//
+// Count-min sketch: a pair has one counter in each row and its count is the smallest of them. Collisions can only make
+// that estimate too high, so a pair may be suppressed before reaching the limit, but is never reported more often than the
+// limit. Only the counters holding the minimum are incremented (conservative update), which keeps the overestimation low.
+class DebugReport::ObjectMessageSketch {
+  public:
+    // Returns TRUE if the pair was already logged |limit| times, otherwise counts it
+    bool CountAndCheckLimit(uint32_t message_id, uint64_t handle, uint32_t limit) {
+        const uint64_t key = MixBits((uint64_t(message_id) << 32) ^ MixBits(handle));
+        std::atomic<uint32_t> *counters[kRows];
+        uint32_t values[kRows];
+        uint32_t estimate = UINT32_MAX;
+        for (uint32_t row = 0; row < kRows; ++row) {
+            // Each row uses a different 16 bit slice of the key
+            const uint32_t column = static_cast<uint32_t>(key >> (row * 16)) & kColumnMask;
+            counters[row] = &counters_[row * kColumns + column];
+            values[row] = counters[row]->load(std::memory_order_relaxed);
+            estimate = std::min(estimate, values[row]);
+        }
+        if (estimate >= limit) {
             return true;
-        } else {
-            vuid_count_it->second++;
-            return false;
         }
+        for (uint32_t row = 0; row < kRows; ++row) {
+            // A failed exchange means another thread counted the same counter, which already raised it past the estimate
+            if (values[row] == estimate) {
+                counters[row]->compare_exchange_strong(values[row], estimate + 1, std::memory_order_relaxed);
+            }
+        }
+        return false;
     }
+
+  private:
+    static constexpr uint32_t kRows = 4;
+    static constexpr uint32_t kColumns = 1 << 14;
+    static constexpr uint32_t kColumnMask = kColumns - 1;
+
+    std::atomic<uint32_t> counters_[kRows * kColumns]{};
+};
+
+// Returns TRUE if the number of times this message has been logged is over the set limit
+bool DebugReport::UpdateLogMsgCounts(uint32_t vuid_hash, const LogObjectList &objects) const {
+    if (duplicate_message_limit_per_object) {
+        // Only allocated when used, it is 256 KiB
+        std::call_once(object_message_counts_once, [this]() { object_message_counts = std::make_unique<ObjectMessageSketch>(); });
+        const uint64_t handle = objects.object_list.empty() ? 0 : objects.object_list[0].handle;
+        return object_message_counts->CountAndCheckLimit(vuid_hash, handle, duplicate_message_limit);
+    }
+    return duplicate_message_counts->CountAndCheckLimit(vuid_hash, duplicate_message_limit);
 }
 
-bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, const char *message, const char *text_vuid) const {
-    bool bail = false;
-    std::vector<VkDebugUtilsLabelEXT> queue_labels;
-    std::vector<VkDebugUtilsLabelEXT> cmd_buf_labels;
+DebugMessage DebugReport::ComposeMessage(VkFlags msg_flags, const LogObjectList &objects, const char *message,
+                                         const char *text_vuid) const {
+    DebugMessage out;
+    out.msg_flags = msg_flags;
 
     // Convert the info to the VK_EXT_debug_utils format
-    VkDebugUtilsMessageTypeFlagsEXT types;
-    VkDebugUtilsMessageSeverityFlagsEXT severity;
-    DebugReportFlagsToAnnotFlags(msg_flags, &severity, &types);
-
-    std::vector<std::string> object_labels;
-    // Ensures that push_back will not reallocate, thereby providing pointer
-    // stability for pushed strings.
-    object_labels.reserve(objects.object_list.size());
+    DebugReportFlagsToAnnotFlags(msg_flags, &out.severity, &out.types);
 
-    std::vector<VkDebugUtilsObjectNameInfoEXT> object_name_infos;
-    object_name_infos.reserve(objects.object_list.size());
+    out.objects.reserve(objects.object_list.size());
     for (uint32_t i = 0; i < objects.object_list.size(); i++) {
         // If only one VkDevice was created, it is just noise to print it out in the error message.
         // Also avoid printing unknown objects, likely if new function is calling error with null LogObjectList
@@ -131,102 +263,141 @@ bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, c
             continue;
         }
 
-        VkDebugUtilsObjectNameInfoEXT object_name_info = vku::InitStructHelper();
-        object_name_info.objectType = ConvertVulkanObjectToCoreObject(objects.object_list[i].type);
-        object_name_info.objectHandle = objects.object_list[i].handle;
-        object_name_info.pObjectName = nullptr;
+        DebugMessage::Object object;
+        object.type = ConvertVulkanObjectToCoreObject(objects.object_list[i].type);
+        object.handle = objects.object_list[i].handle;
 
-        std::string object_label = {};
         // Look for any debug utils or marker names to use for this object
-        // NOTE: the lock (debug_output_mutex) is held by the caller (LogMsg)
-        object_label = GetUtilsObjectNameNoLock(objects.object_list[i].handle);
-        if (object_label.empty()) {
-            object_label = GetMarkerObjectNameNoLock(objects.object_list[i].handle);
-        }
-        if (!object_label.empty()) {
-            object_labels.push_back(std::move(object_label));
-            object_name_info.pObjectName = object_labels.back().c_str();
+        object.name = GetUtilsObjectName(object.handle);
+        if (object.name.empty()) {
+            object.name = GetMarkerObjectName(object.handle);
         }
 
         // If this is a queue, add any queue labels to the callback data.
-        if (VK_OBJECT_TYPE_QUEUE == object_name_info.objectType) {
-            auto label_iter = debug_utils_queue_labels.find(reinterpret_cast<VkQueue>(object_name_info.objectHandle));
+        if (VK_OBJECT_TYPE_QUEUE == object.type) {
+            auto label_iter = debug_utils_queue_labels.find(reinterpret_cast<VkQueue>(object.handle));
             if (label_iter != debug_utils_queue_labels.end()) {
-                auto found_queue_labels = label_iter->second->Export();
-                queue_labels.insert(queue_labels.end(), found_queue_labels.begin(), found_queue_labels.end());
+                for (const auto &label : label_iter->second->Export()) {
+                    out.queue_labels.emplace_back(&label);
+                }
             }
             // If this is a command buffer, add any command buffer labels to the callback data.
-        } else if (VK_OBJECT_TYPE_COMMAND_BUFFER == object_name_info.objectType) {
-            auto label_iter = debug_utils_cmd_buffer_labels.find(reinterpret_cast<VkCommandBuffer>(object_name_info.objectHandle));
+        } else if (VK_OBJECT_TYPE_COMMAND_BUFFER == object.type) {
+            auto label_iter = debug_utils_cmd_buffer_labels.find(reinterpret_cast<VkCommandBuffer>(object.handle));
             if (label_iter != debug_utils_cmd_buffer_labels.end()) {
-                auto found_cmd_buf_labels = label_iter->second->Export();
-                cmd_buf_labels.insert(cmd_buf_labels.end(), found_cmd_buf_labels.begin(), found_cmd_buf_labels.end());
+                for (const auto &label : label_iter->second->Export()) {
+                    out.cmd_buf_labels.emplace_back(&label);
+                }
             }
         }
 
-        object_name_infos.push_back(object_name_info);
+        out.objects.emplace_back(std::move(object));
     }
 
-    const uint32_t message_id_number = text_vuid ? hash_util::VuidHash(text_vuid) : 0U;
-
-    VkDebugUtilsMessengerCallbackDataEXT callback_data = vku::InitStructHelper();
-    callback_data.flags = 0;
-    callback_data.pMessageIdName = text_vuid;
-    callback_data.messageIdNumber = vvl_bit_cast<int32_t>(message_id_number);
-    callback_data.pMessage = nullptr;
-    callback_data.queueLabelCount = static_cast<uint32_t>(queue_labels.size());
-    callback_data.pQueueLabels = queue_labels.empty() ? nullptr : queue_labels.data();
-    callback_data.cmdBufLabelCount = static_cast<uint32_t>(cmd_buf_labels.size());
-    callback_data.pCmdBufLabels = cmd_buf_labels.empty() ? nullptr : cmd_buf_labels.data();
-    callback_data.objectCount = static_cast<uint32_t>(object_name_infos.size());
-    callback_data.pObjects = object_name_infos.data();
-
-    std::ostringstream oss;
+    out.has_vuid = text_vuid != nullptr;
+    if (out.has_vuid) {
+        out.vuid = text_vuid;
+    }
+    out.message_id_number = text_vuid ? hash_util::VuidHash(text_vuid) : 0U;
 
+    // The header and object list are built on the stack, the text is then allocated once
+    const auto write_header = [&](vvl::TextBuffer &header) {
 #if defined(BUILD_SELF_VVL)
-    oss << "Self ";
+        header.Append("Self ");
 #endif
 
-    if (message_format_settings.display_application_name && !message_format_settings.application_name.empty()) {
-        oss << "[AppName: " << message_format_settings.application_name << "] ";
-    }
+        if (message_format_settings.display_application_name && !message_format_settings.application_name.empty()) {
+            header.Append("[AppName: ").Append(message_format_settings.application_name).Append("] ");
+        }
 
-    if (msg_flags & kErrorBit) {
-        oss << "Validation Error: ";
-    } else if (msg_flags & kWarningBit) {
-        oss << "Validation Warning: ";
-    } else if (msg_flags & kPerformanceWarningBit) {
-        oss << "Validation Performance Warning: ";
-    } else if (msg_flags & kInformationBit) {
-        oss << "Validation Information: ";
-    } else if (msg_flags & kVerboseBit) {
-        oss << "Verbose Information: ";
-    }
-
-    if (text_vuid != nullptr) {
-        oss << "[ " << text_vuid << " ] ";
-    }
-    uint32_t index = 0;
-    for (const auto &src_object : object_name_infos) {
-        if (0 != src_object.objectHandle) {
-            oss << "Object " << index++ << ": handle = 0x" << std::hex << src_object.objectHandle;
-            if (src_object.pObjectName) {
-                oss << ", name = " << src_object.pObjectName << ", type = ";
+        if (msg_flags & kErrorBit) {
+            header.Append("Validation Error: ");
+        } else if (msg_flags & kWarningBit) {
+            header.Append("Validation Warning: ");
+        } else if (msg_flags & kPerformanceWarningBit) {
+            header.Append("Validation Performance Warning: ");
+        } else if (msg_flags & kInformationBit) {
+            header.Append("Validation Information: ");
+        } else if (msg_flags & kVerboseBit) {
+            header.Append("Verbose Information: ");
+        }
+
+        if (text_vuid != nullptr) {
+            header.Append("[ ").Append(text_vuid).Append(" ] ");
+        }
+        uint32_t index = 0;
+        for (const auto &src_object : out.objects) {
+            header.Append("Object ").AppendUint(index++);
+            if (0 != src_object.handle) {
+                header.Append(": handle = ").AppendHex(src_object.handle);
+                if (!src_object.name.empty()) {
+                    header.Append(", name = ").Append(src_object.name);
+                }
+                header.Append(", type = ");
             } else {
-                oss << ", type = ";
+                header.Append(": VK_NULL_HANDLE, type = ");
             }
-            oss << string_VkObjectType(src_object.objectType) << "; ";
-        } else {
-            oss << "Object " << index++ << ": VK_NULL_HANDLE, type = " << string_VkObjectType(src_object.objectType) << "; ";
+            header.Append(string_VkObjectType(src_object.type)).Append("; ");
         }
+        header.Append("| MessageID = ").AppendHex(out.message_id_number).Append(" | ");
+    };
+    vvl::StackTextBuffer<2048> stack_header;
+    write_header(stack_header);
+    std::vector<char> heap_storage;
+    std::optional<vvl::TextBuffer> heap_header;
+    if (stack_header.Truncated()) {
+        // Object names can be long, a header that does not fit is written again in a buffer of the size it needs
+        heap_storage.resize(stack_header.RequiredSize() + 1);
+        heap_header.emplace(heap_storage.data(), heap_storage.size());
+        write_header(*heap_header);
     }
-    oss << "| MessageID = 0x" << std::hex << message_id_number << " | " << message;
-    std::string composite = oss.str();
+    const std::string_view header = heap_header ? heap_header->view() : stack_header.view();
+
+    const std::string_view message_text(message);
+    out.text.reserve(header.size() + message_text.size());
+    out.text.append(header).append(message_text);
+    return out;
+}
+
+bool DebugReport::DeliverMessage(const DebugMessage &message, const std::vector<VkLayerDbgFunctionState> &callbacks) const {
+    bool bail = false;
+
+    std::vector<VkDebugUtilsObjectNameInfoEXT> object_name_infos;
+    object_name_infos.reserve(message.objects.size());
+    for (const auto &object : message.objects) {
+        VkDebugUtilsObjectNameInfoEXT object_name_info = vku::InitStructHelper();
+        object_name_info.objectType = object.type;
+        object_name_info.objectHandle = object.handle;
+        object_name_info.pObjectName = object.name.empty() ? nullptr : object.name.data();
+        object_name_infos.push_back(object_name_info);
+    }
+    std::vector<VkDebugUtilsLabelEXT> queue_labels;
+    queue_labels.reserve(message.queue_labels.size());
+    for (const auto &label : message.queue_labels) {
+        queue_labels.push_back(label.Export());
+    }
+    std::vector<VkDebugUtilsLabelEXT> cmd_buf_labels;
+    cmd_buf_labels.reserve(message.cmd_buf_labels.size());
+    for (const auto &label : message.cmd_buf_labels) {
+        cmd_buf_labels.push_back(label.Export());
+    }
+
+    VkDebugUtilsMessengerCallbackDataEXT callback_data = vku::InitStructHelper();
+    callback_data.flags = 0;
+    callback_data.pMessageIdName = message.has_vuid ? message.vuid.c_str() : nullptr;
+    callback_data.messageIdNumber = vvl_bit_cast<int32_t>(message.message_id_number);
+    // Formatted once by ComposeMessage, shared by every callback
+    callback_data.pMessage = message.text.c_str();
+    callback_data.queueLabelCount = static_cast<uint32_t>(queue_labels.size());
+    callback_data.pQueueLabels = queue_labels.empty() ? nullptr : queue_labels.data();
+    callback_data.cmdBufLabelCount = static_cast<uint32_t>(cmd_buf_labels.size());
+    callback_data.pCmdBufLabels = cmd_buf_labels.empty() ? nullptr : cmd_buf_labels.data();
+    callback_data.objectCount = static_cast<uint32_t>(object_name_infos.size());
+    callback_data.pObjects = object_name_infos.data();
 
-    const auto callback_list = &debug_callback_list;
     // We only output to default callbacks if there are no non-default callbacks
     bool use_default_callbacks = true;
-    for (const auto &current_callback : *callback_list) {
+    for (const auto &current_callback : callbacks) {
         use_default_callbacks &= current_callback.IsDefault();
     }
 
@@ -237,19 +408,19 @@ bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, c
 #endif
 
     const char *layer_prefix = "Validation";
-    for (const auto &current_callback : *callback_list) {
+    for (const auto &current_callback : callbacks) {
         // Skip callback if it's a default callback and there are non-default callbacks present
         if (current_callback.IsDefault() && !use_default_callbacks) continue;
 
         // VK_EXT_debug_utils callback
-        if (current_callback.IsUtils() && (current_callback.debug_utils_msg_flags & severity) &&
-            (current_callback.debug_utils_msg_type & types)) {
-            callback_data.pMessage = composite.c_str();
-            if (current_callback.debug_utils_callback_function_ptr(static_cast<VkDebugUtilsMessageSeverityFlagBitsEXT>(severity),
-                                                                   types, &callback_data, current_callback.pUserData)) {
+        if (current_callback.IsUtils() && (current_callback.debug_utils_msg_flags & message.severity) &&
+            (current_callback.debug_utils_msg_type & message.types)) {
+            if (current_callback.debug_utils_callback_function_ptr(
+                    static_cast<VkDebugUtilsMessageSeverityFlagBitsEXT>(message.severity), message.types, &callback_data,
+                    current_callback.pUserData)) {
                 bail = true;
             }
-        } else if (!current_callback.IsUtils() && (current_callback.debug_report_msg_flags & msg_flags)) {
+        } else if (!current_callback.IsUtils() && (current_callback.debug_report_msg_flags & message.msg_flags)) {
             // VK_EXT_debug_report callback (deprecated)
             if (object_name_infos.empty()) {
                 VkDebugUtilsObjectNameInfoEXT null_object_name = {VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT, nullptr,
@@ -258,8 +429,8 @@ bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, c
                 object_name_infos.emplace_back(null_object_name);
             }
             if (current_callback.debug_report_callback_function_ptr(
-                    msg_flags, ConvertCoreObjectToDebugReportObject(object_name_infos[0].objectType),
-                    object_name_infos[0].objectHandle, message_id_number, 0, layer_prefix, composite.c_str(),
+                    message.msg_flags, ConvertCoreObjectToDebugReportObject(object_name_infos[0].objectType),
+                    object_name_infos[0].objectHandle, message.message_id_number, 0, layer_prefix, message.text.c_str(),
                     current_callback.pUserData)) {
                 bail = true;
             }
@@ -268,56 +439,198 @@ bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, c
     return bail;
 }
 
-void DebugReport::SetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo) {
+// Delivers the messages queued by LogMsg to the callbacks from a dedicated thread
+//
+// LogMsg still filters and formats the message under debug_output_mutex, but the (application owned, possibly slow)
+// callbacks are called without it, so validating threads only wait for each other for the formatting. Messages are pushed
+// into a lock-free ring, the delivery thread only sleeps on a condition variable when the ring is empty.
+class DebugReport::AsyncDelivery {
+  public:
+    explicit AsyncDelivery(DebugReport &debug_report) : debug_report_(debug_report), ring_(kRingCapacity) {
+        thread_ = std::thread(&AsyncDelivery::ThreadFunc, this);
+    }
+
+    ~AsyncDelivery() {
+        {
+            std::lock_guard<std::mutex> guard(wake_mutex_);
+            exit_ = true;
+        }
+        wake_cv_.notify_one();
+        thread_.join();
+    }
+
+    bool IsDeliveryThread() const { return std::this_thread::get_id() == thread_.get_id(); }
+
+    void Push(DebugMessage &&message) {
+        pushed_.fetch_add(1);
+        while (!ring_.TryPush(std::move(message))) {
+            // The delivery thread is behind, wait for it to free a slot
+            Wake();
+            std::this_thread::yield();
+        }
+        Wake();
+    }
+
+    void Flush() {
+        const uint64_t target = pushed_.load();
+        std::unique_lock<std::mutex> guard(wake_mutex_);
+        ++flush_waiters_;
+        flushed_cv_.wait(guard, [this, target]() { return delivered_.load() >= target; });
+        --flush_waiters_;
+    }
+
+    // Held while the delivery thread calls the callbacks
+    std::mutex callback_mutex;
+
+  private:
+    static constexpr size_t kRingCapacity = 1024;
+
+    void Wake() {
+        // Pairs with the fence in ThreadFunc, either the delivery thread sees the message or this sees it sleeping
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping_.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> guard(wake_mutex_);
+            wake_cv_.notify_one();
+        }
+    }
+
+    void ThreadFunc() {
+        DebugMessage message;
+        while (true) {
+            if (ring_.TryPop(message)) {
+                {
+                    std::lock_guard<std::mutex> callback_guard(callback_mutex);
+                    std::vector<VkLayerDbgFunctionState> callbacks;
+                    {
+                        std::lock_guard<std::mutex> guard(debug_report_.debug_output_mutex);
+                        callbacks = debug_report_.debug_callback_list;
+                    }
+                    debug_report_.DeliverMessage(message, callbacks);
+                }
+                delivered_.fetch_add(1);
+                if (flush_waiters_.load() > 0) {
+                    std::lock_guard<std::mutex> guard(wake_mutex_);
+                    flushed_cv_.notify_all();
+                }
+                continue;
+            }
+
+            std::unique_lock<std::mutex> guard(wake_mutex_);
+            if (exit_) {
+                return;
+            }
+            sleeping_.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            wake_cv_.wait(guard, [this]() { return exit_ || !ring_.Empty(); });
+            sleeping_.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    DebugReport &debug_report_;
+    vvl::MpscRing<DebugMessage> ring_;
+    std::thread thread_;
+
+    std::atomic<uint64_t> pushed_{0};
+    std::atomic<uint64_t> delivered_{0};
+    std::atomic<bool> sleeping_{false};
+
+    // Protects exit_ and the sleep of the delivery thread, flush waiters wait under it
+    std::mutex wake_mutex_;
+    std::condition_variable wake_cv_;
+    std::condition_variable flushed_cv_;
+    bool exit_ = false;
+    std::atomic<uint32_t> flush_waiters_{0};
+};
+
+DebugReport::DebugReport() : duplicate_message_counts(std::make_unique<MessageCountTable>()) {}
+
+// Messages still queued are delivered before the instance goes away
+DebugReport::~DebugReport() = default;
+
+// The delivery is started by the first message and lives as long as the DebugReport, so the pointer can be used after
+// debug_output_mutex is released
+DebugReport::AsyncDelivery *DebugReport::GetAsyncDelivery() const {
     std::unique_lock<std::mutex> lock(debug_output_mutex);
+    return async_delivery.get();
+}
+
+void DebugReport::FlushMessages() {
+    AsyncDelivery *delivery = GetAsyncDelivery();
+    if (delivery && !delivery->IsDeliveryThread()) {
+        delivery->Flush();
+    }
+    if (structured_log) {
+        structured_log->Flush();
+    }
+}
+
+bool DebugReport::OpenStructuredLog(const char *filename, VkDebugUtilsMessageSeverityFlagsEXT severities,
+                                    VkDebugUtilsMessageTypeFlagsEXT types) {
+    structured_log = StructuredLogWriter::Open(filename);
+    if (!structured_log) {
+        return false;
+    }
+    structured_log_severities = severities;
+    structured_log_types = types;
+    return true;
+}
+
+std::unique_lock<std::mutex> DebugReport::FlushAndLockDelivery() {
+    AsyncDelivery *delivery = GetAsyncDelivery();
+    if (!delivery || delivery->IsDeliveryThread()) {
+        return {};
+    }
+    delivery->Flush();
+    return std::unique_lock<std::mutex>(delivery->callback_mutex);
+}
+
+// Names are interned, so renaming an object does not invalidate a view returned for its previous name
+void DebugReport::SetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo) {
     if (pNameInfo->pObjectName) {
-        debug_utils_object_name_map[pNameInfo->objectHandle] = pNameInfo->pObjectName;
+        debug_utils_object_name_map.insert_or_assign(pNameInfo->objectHandle, object_names.Intern(pNameInfo->pObjectName));
     } else {
         debug_utils_object_name_map.erase(pNameInfo->objectHandle);
     }
 }
 
 void DebugReport::SetMarkerObjectName(const VkDebugMarkerObjectNameInfoEXT *pNameInfo) {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
     if (pNameInfo->pObjectName) {
-        debug_object_name_map[pNameInfo->object] = pNameInfo->pObjectName;
+        debug_object_name_map.insert_or_assign(pNameInfo->object, object_names.Intern(pNameInfo->pObjectName));
     } else {
         debug_object_name_map.erase(pNameInfo->object);
     }
 }
 
-// NoLock suffix means that the function itself does not hold debug_output_mutex lock,
-// and it's **mandatory responsibility** of the caller to hold this lock.
-std::string DebugReport::GetUtilsObjectNameNoLock(const uint64_t object) const {
-    std::string label = "";
+std::string_view DebugReport::GetUtilsObjectName(const uint64_t object) const {
     const auto utils_name_iter = debug_utils_object_name_map.find(object);
     if (utils_name_iter != debug_utils_object_name_map.end()) {
-        label = utils_name_iter->second;
+        return utils_name_iter->second;
     }
-    return label;
+    return {};
 }
 
-// NoLock suffix means that the function itself does not hold debug_output_mutex lock,
-// and it's **mandatory responsibility** of the caller to hold this lock.
-std::string DebugReport::GetMarkerObjectNameNoLock(const uint64_t object) const {
-    std::string label = "";
+std::string_view DebugReport::GetMarkerObjectName(const uint64_t object) const {
     const auto marker_name_iter = debug_object_name_map.find(object);
     if (marker_name_iter != debug_object_name_map.end()) {
-        label = marker_name_iter->second;
+        return marker_name_iter->second;
     }
-    return label;
+    return {};
 }
 
 std::string DebugReport::FormatHandle(const char *handle_type_name, uint64_t handle) const {
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
-    std::string handle_name = GetUtilsObjectNameNoLock(handle);
+    std::string_view handle_name = GetUtilsObjectName(handle);
     if (handle_name.empty()) {
-        handle_name = GetMarkerObjectNameNoLock(handle);
+        handle_name = GetMarkerObjectName(handle);
     }
 
-    std::ostringstream str;
-    str << handle_type_name << " 0x" << std::hex << handle << "[" << handle_name.c_str() << "]";
-    return str.str();
+    vvl::StackTextBuffer<24> handle_text;
+    handle_text.Append(' ').AppendHex(handle).Append('[');
+    const std::string_view type_name(handle_type_name);
+
+    std::string str;
+    str.reserve(type_name.size() + handle_text.size() + handle_name.size() + 1);
+    str.append(type_name).append(handle_text.view()).append(handle_name).append("]");
+    return str;
 }
 
 template <typename Map>
@@ -527,9 +840,11 @@ VKAPI_ATTR void DeactivateInstanceDebugCallbacks(DebugReport *debug_report) {
 
 // helper for VUID based filtering. This needs to be separate so it can be called before incurring
 // the cost of sprintf()-ing the err_msg needed by LogMsgLocked().
-bool DebugReport::LogMsgEnabled(std::string_view vuid_text, VkDebugUtilsMessageSeverityFlagsEXT severity,
-                                VkDebugUtilsMessageTypeFlagsEXT type) {
-    if (!(active_severities & severity) || !(active_types & type)) {
+bool DebugReport::LogMsgEnabled(const LogObjectList &objects, std::string_view vuid_text,
+                                VkDebugUtilsMessageSeverityFlagsEXT severity, VkDebugUtilsMessageTypeFlagsEXT type) {
+    const bool to_callbacks = (active_callback_mask.load(std::memory_order_relaxed) & SeverityTypeMask(severity, type)) != 0;
+    const bool to_structured_log = structured_log && (structured_log_severities & severity) && (structured_log_types & type);
+    if (!to_callbacks && !to_structured_log) {
         return false;
     }
     // If message is in filter list, bail out very early
@@ -537,13 +852,22 @@ bool DebugReport::LogMsgEnabled(std::string_view vuid_text, VkDebugUtilsMessageS
     if (filter_message_ids.find(message_id) != filter_message_ids.end()) {
         return false;
     }
-    if ((duplicate_message_limit > 0) && UpdateLogMsgCounts(static_cast<int32_t>(message_id))) {
+    if ((duplicate_message_limit > 0) && UpdateLogMsgCounts(message_id, objects)) {
         // Count for this particular message is over the limit, ignore it
         return false;
     }
     return true;
 }
 
+bool DebugReport::LogStructuredMsg(const LogObjectList &objects, const Location *loc, std::string_view vuid_text,
+                                   VkDebugUtilsMessageSeverityFlagsEXT severity, VkDebugUtilsMessageTypeFlagsEXT type) {
+    if ((structured_log_severities & severity) && (structured_log_types & type)) {
+        structured_log->Write(hash_util::VuidHash(vuid_text), severity, vuid_text, objects.object_list.data(),
+                              objects.object_list.size(), loc);
+    }
+    return (active_callback_mask.load(std::memory_order_relaxed) & SeverityTypeMask(severity, type)) != 0;
+}
+
 bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const Location *loc, std::string_view vuid_text,
                          const char *format, va_list argptr) {
     assert(*(vuid_text.data() + vuid_text.size()) == '\0');
@@ -551,12 +875,19 @@ bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const
     VkDebugUtilsMessageSeverityFlagsEXT severity;
     VkDebugUtilsMessageTypeFlagsEXT type;
 
+    if (msg_flags & kErrorBit) {
+        error_message_count.fetch_add(1, std::memory_order_relaxed);
+    }
     DebugReportFlagsToAnnotFlags(msg_flags, &severity, &type);
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
-    // Avoid logging cost if msg is to be ignored
-    if (!LogMsgEnabled(vuid_text, severity, type)) {
+    // Avoid logging cost if msg is to be ignored, without contending with other threads for the lock
+    if (!LogMsgEnabled(objects, vuid_text, severity, type)) {
+        return false;
+    }
+    if (structured_log && !LogStructuredMsg(objects, loc, vuid_text, severity, type)) {
+        // Only the structured log wanted the message, which does not need the text
         return false;
     }
+    std::unique_lock<std::mutex> lock(debug_output_mutex);
 
     // Best guess at an upper bound for message length. At least some of the extra space
     // should get used to store the VUID URL and text in the common case, without additional allocations.
@@ -590,24 +921,52 @@ bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const
         str_plus_spec_text.resize(result);
     }
 
+    return EmitMessage(msg_flags, objects, loc, vuid_text, str_plus_spec_text, lock);
+}
+
+bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const Location *loc, std::string_view vuid_text,
+                         const MessageFormatter &formatter) {
+    assert(*(vuid_text.data() + vuid_text.size()) == '\0');
+
+    VkDebugUtilsMessageSeverityFlagsEXT severity;
+    VkDebugUtilsMessageTypeFlagsEXT type;
+
+    if (msg_flags & kErrorBit) {
+        error_message_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    DebugReportFlagsToAnnotFlags(msg_flags, &severity, &type);
+    if (!LogMsgEnabled(objects, vuid_text, severity, type)) {
+        return false;
+    }
+    if (structured_log && !LogStructuredMsg(objects, loc, vuid_text, severity, type)) {
+        return false;
+    }
+    // Formatting stays outside of debug_output_mutex, so the text of concurrent messages is built in parallel
+    std::string str_plus_spec_text = formatter();
+    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    return EmitMessage(msg_flags, objects, loc, vuid_text, str_plus_spec_text, lock);
+}
+
+// Innermost MessageCapture of the thread
+static thread_local DebugReport::MessageCapture *thread_message_capture = nullptr;
+
+bool DebugReport::EmitMessage(VkFlags msg_flags, const LogObjectList &objects, const Location *loc, std::string_view vuid_text,
+                              std::string &str_plus_spec_text, std::unique_lock<std::mutex> &lock) {
     // TODO - make Location a reference once old LogError is gone
     if (loc) {
-        str_plus_spec_text = loc->Message() + " " + str_plus_spec_text;
+        vvl::StackTextBuffer<1024> location_text;
+        loc->AppendMessage(location_text);
+        location_text.Append(' ');
+        str_plus_spec_text.insert(0, location_text.view());
     }
 
     // Append the spec error text to the error message, unless it contains a word treated as special
     if ((vuid_text.find("VUID-") != std::string::npos)) {
-        // Linear search makes no assumptions about the layout of the string table. This is not fast, but it does not need to be at
-        // this point in the error reporting path
-        uint32_t num_vuids = sizeof(vuid_spec_text) / sizeof(vuid_spec_text_pair);
         const char *spec_text = nullptr;
         std::string spec_type;
-        for (uint32_t i = 0; i < num_vuids; i++) {
-            if (0 == strncmp(vuid_text.data(), vuid_spec_text[i].vuid, vuid_text.size())) {
-                spec_text = vuid_spec_text[i].spec_text;
-                spec_type = vuid_spec_text[i].url_id;
-                break;
-            }
+        if (const vuid_spec_text_pair *entry = FindVuidSpecText(vuid_text)) {
+            spec_text = entry->spec_text;
+            spec_type = entry->url_id;
         }
 
         // Construct and append the specification text and link to the appropriate version of the spec
@@ -653,7 +1012,45 @@ bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const
         }
     }
 
-    return DebugLogMsg(msg_flags, objects, str_plus_spec_text.c_str(), vuid_text.data());
+    DebugMessage message = ComposeMessage(msg_flags, objects, str_plus_spec_text.c_str(), vuid_text.data());
+
+    if (thread_message_capture && &thread_message_capture->debug_report_ == this) {
+        lock.unlock();
+        thread_message_capture->messages.emplace_back(std::move(message));
+        return false;
+    }
+    return DeliverOrQueueMessage(std::move(message), lock);
+}
+
+DebugReport::MessageCapture::MessageCapture(const DebugReport &debug_report)
+    : debug_report_(debug_report), previous_(thread_message_capture) {
+    thread_message_capture = this;
+}
+
+DebugReport::MessageCapture::~MessageCapture() { thread_message_capture = previous_; }
+
+bool DebugReport::DeliverCapturedMessages(std::vector<DebugMessage> &messages) {
+    bool skip = false;
+    for (DebugMessage &message : messages) {
+        std::unique_lock<std::mutex> lock(debug_output_mutex);
+        skip |= DeliverOrQueueMessage(std::move(message), lock);
+    }
+    messages.clear();
+    return skip;
+}
+
+bool DebugReport::DeliverOrQueueMessage(DebugMessage &&message, std::unique_lock<std::mutex> &lock) {
+    // A message logged from inside a callback run by the delivery thread is delivered right away, queuing it could wait
+    // forever on a full ring that only this thread drains
+    if (async_message_delivery && !(async_delivery && async_delivery->IsDeliveryThread())) {
+        if (!async_delivery) {
+            async_delivery = std::make_unique<AsyncDelivery>(*this);
+        }
+        lock.unlock();
+        async_delivery->Push(std::move(message));
+        return false;
+    }
+    return DeliverMessage(message, debug_callback_list);
 }
 
 VKAPI_ATTR VkBool32 VKAPI_CALL MessengerBreakCallback([[maybe_unused]] VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
@@ -18,17 +18,21 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstdarg>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 #include <vulkan/utility/vk_struct_helper.hpp>
 
 #include "vk_layer_config.h"
 #include "containers/custom_containers.h"
+#include "containers/string_pool.h"
 #include "generated/vk_layer_dispatch_table.h"
 #include "generated/vk_object_types.h"
 
@@ -178,14 +182,54 @@ class TypedHandleWrapper {
 };
 
 struct Location;
+class StructuredLogWriter;
 
 struct MessageFormatSettings {
     bool display_application_name = false;
     std::string application_name;
 };
 
+// Everything needed to call the debug callbacks for one message, owned so it can be delivered after LogMsg returns
+struct DebugMessage {
+    struct Object {
+        VkObjectType type;
+        uint64_t handle;
+        std::string_view name;  // Interned in DebugReport::object_names, null terminated
+    };
+    VkFlags msg_flags = 0;
+    VkDebugUtilsMessageSeverityFlagsEXT severity = 0;
+    VkDebugUtilsMessageTypeFlagsEXT types = 0;
+    std::string vuid;
+    bool has_vuid = false;
+    uint32_t message_id_number = 0;
+    std::string text;
+    std::vector<Object> objects;
+    std::vector<LoggingLabel> queue_labels;
+    std::vector<LoggingLabel> cmd_buf_labels;
+};
+
+// Non-owning reference to a callable that builds the text of a message. LogMsg only calls it once the message is known to
+// be delivered, so the string building and FormatHandle() calls of a filtered or over the duplicate limit message are
+// never paid for. The callable must outlive the LogMsg call and is invoked without debug_output_mutex held.
+class MessageFormatter {
+  public:
+    template <typename Func, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Func>, MessageFormatter> &&
+                                                        std::is_invocable_r_v<std::string, const Func &>>>
+    MessageFormatter(const Func &func)
+        : callable_(&func), invoke_([](const void *callable) -> std::string { return (*static_cast<const Func *>(callable))(); }) {}
+
+    std::string operator()() const { return invoke_(callable_); }
+
+  private:
+    const void *callable_;
+    std::string (*invoke_)(const void *);
+};
+
 class DebugReport {
   public:
+    DebugReport();
+    ~DebugReport();
+
     std::vector<VkLayerDbgFunctionState> debug_callback_list;
     // We use unordered_set to use trivial hashing for filter_message_ids as we already store hashed values
     vvl::unordered_set<uint32_t> filter_message_ids{};
@@ -193,15 +237,29 @@ class DebugReport {
     // the layers to continue this pattern, but also allows them to use/change this specific member for synchronization purposes.
     mutable std::mutex debug_output_mutex;
     uint32_t duplicate_message_limit = 0;
+    // When set, duplicate_message_limit applies to each (VUID, first object of the message) pair instead of each VUID
+    bool duplicate_message_limit_per_object = false;
     const void *instance_pnext_chain{};
     bool force_default_log_callback{false};
     uint32_t device_created = 0;
     MessageFormatSettings message_format_settings;
+    // When set, LogMsg queues the messages and a dedicated thread calls the callbacks, the value a callback returns is
+    // ignored in that mode
+    bool async_message_delivery = false;
+    // Error messages logged so far, counted before any filtering. The value a callback returns only says if the call is
+    // skipped, a check comparing the count before and after it ran can tell whether it found an error.
+    std::atomic<uint64_t> error_message_count{0};
+
+    // Also writes the messages of the given severities and types as binary records to |filename|, see StructuredLogWriter.
+    // Must be called before any message is logged, returns false if the file cannot be opened.
+    bool OpenStructuredLog(const char *filename, VkDebugUtilsMessageSeverityFlagsEXT severities,
+                           VkDebugUtilsMessageTypeFlagsEXT types);
 
     void SetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo);
     void SetMarkerObjectName(const VkDebugMarkerObjectNameInfoEXT *pNameInfo);
-    std::string GetUtilsObjectNameNoLock(const uint64_t object) const;
-    std::string GetMarkerObjectNameNoLock(const uint64_t object) const;
+    // Do not need debug_output_mutex. The views stay valid for the lifetime of the DebugReport, even if the object is renamed.
+    std::string_view GetUtilsObjectName(const uint64_t object) const;
+    std::string_view GetMarkerObjectName(const uint64_t object) const;
 
     void SetDebugUtilsSeverityFlags(std::vector<VkLayerDbgFunctionState> &callbacks);
     void RemoveDebugUtilsCallback(uint64_t callback);
@@ -221,6 +279,8 @@ class DebugReport {
 
     bool LogMsg(VkFlags msg_flags, const LogObjectList &objects, const Location *loc, std::string_view vuid_text,
                 const char *format, va_list argptr);
+    bool LogMsg(VkFlags msg_flags, const LogObjectList &objects, const Location *loc, std::string_view vuid_text,
+                const MessageFormatter &formatter);
 
     void BeginQueueDebugUtilsLabel(VkQueue queue, const VkDebugUtilsLabelEXT *label_info);
     void EndQueueDebugUtilsLabel(VkQueue queue);
@@ -232,20 +292,105 @@ class DebugReport {
     void ResetCmdDebugUtilsLabel(VkCommandBuffer command_buffer);
     void EraseCmdDebugUtilsLabel(VkCommandBuffer command_buffer);
 
+    // While alive, the messages of this DebugReport logged by the thread that created it are kept in |messages| instead of
+    // delivered, so checks running on worker threads can have their messages delivered in a deterministic order by the
+    // calling thread with DeliverCapturedMessages. Like with async_message_delivery, LogMsg returns false for them.
+    class MessageCapture {
+      public:
+        explicit MessageCapture(const DebugReport &debug_report);
+        ~MessageCapture();
+        MessageCapture(const MessageCapture &) = delete;
+        MessageCapture &operator=(const MessageCapture &) = delete;
+
+        std::vector<DebugMessage> messages;
+
+      private:
+        friend class DebugReport;
+        const DebugReport &debug_report_;
+        MessageCapture *previous_;
+    };
+    // Hands the messages to the callbacks in order, as LogMsg would have, and returns if the call should be skipped
+    bool DeliverCapturedMessages(std::vector<DebugMessage> &messages);
+
+    // Messages of work split into tasks that can run on any thread and in any order. Capture(task, func) keeps what func
+    // logs on its thread apart for |task|, Deliver() then hands them to the callbacks in task order, so the output is the
+    // same as running the tasks one after the other.
+    class OrderedMessages {
+      public:
+        OrderedMessages(DebugReport &debug_report, uint32_t task_count) : debug_report_(debug_report), messages_(task_count) {}
+
+        template <typename Func>
+        void Capture(uint32_t task, const Func &func) {
+            MessageCapture capture(debug_report_);
+            func();
+            messages_[task] = std::move(capture.messages);
+        }
+        // Returns if the call should be skipped
+        bool Deliver() {
+            bool skip = false;
+            for (auto &task_messages : messages_) {
+                skip |= debug_report_.DeliverCapturedMessages(task_messages);
+            }
+            return skip;
+        }
+
+      private:
+        DebugReport &debug_report_;
+        std::vector<std::vector<DebugMessage>> messages_;
+    };
+
+    // Returns once the messages queued for asynchronous delivery so far have been handed to the callbacks, and the
+    // structured log records written so far are in the file
+    void FlushMessages();
+    // Same as FlushMessages, the returned lock also keeps the delivery thread from calling any callback until released.
+    // Must be taken before debug_output_mutex.
+    std::unique_lock<std::mutex> FlushAndLockDelivery();
+
   private:
-    bool UpdateLogMsgCounts(int32_t vuid_hash) const;
-    bool DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, const char *message, const char *text_vuid) const;
-    bool LogMsgEnabled(std::string_view vuid_text, VkDebugUtilsMessageSeverityFlagsEXT severity,
+    class AsyncDelivery;
+    AsyncDelivery *GetAsyncDelivery() const;
+
+    class MessageCountTable;
+    class ObjectMessageSketch;
+
+    bool UpdateLogMsgCounts(uint32_t vuid_hash, const LogObjectList &objects) const;
+    // NOTE: debug_output_mutex must be held
+    DebugMessage ComposeMessage(VkFlags msg_flags, const LogObjectList &objects, const char *message, const char *text_vuid) const;
+    // callbacks is debug_callback_list, or a copy of it taken by the delivery thread
+    bool DeliverMessage(const DebugMessage &message, const std::vector<VkLayerDbgFunctionState> &callbacks) const;
+    // Does not need debug_output_mutex
+    bool LogMsgEnabled(const LogObjectList &objects, std::string_view vuid_text, VkDebugUtilsMessageSeverityFlagsEXT severity,
                        VkDebugUtilsMessageTypeFlagsEXT type);
-
-    VkDebugUtilsMessageSeverityFlagsEXT active_severities{0};
-    VkDebugUtilsMessageTypeFlagsEXT active_types{0};
-    mutable vvl::unordered_map<uint32_t, uint32_t> duplicate_message_count_map{};
+    // Writes the structured log record of an enabled message, returns false if no callback wants the message either
+    bool LogStructuredMsg(const LogObjectList &objects, const Location *loc, std::string_view vuid_text,
+                          VkDebugUtilsMessageSeverityFlagsEXT severity, VkDebugUtilsMessageTypeFlagsEXT type);
+    // Appends the location and spec text to an already enabled message and hands it to the callbacks.
+    // NOTE: lock must hold debug_output_mutex, it may be released before returning
+    bool EmitMessage(VkFlags msg_flags, const LogObjectList &objects, const Location *loc, std::string_view vuid_text,
+                     std::string &str_plus_spec_text, std::unique_lock<std::mutex> &lock);
+    // Queues the message for the delivery thread or calls the callbacks.
+    // NOTE: lock must hold debug_output_mutex, it may be released before returning
+    bool DeliverOrQueueMessage(DebugMessage &&message, std::unique_lock<std::mutex> &lock);
+
+    // Union of the severity x type pairs the callbacks that would be called want (see SeverityTypeMask), so a message no
+    // callback wants is dropped with a single load. Written under debug_output_mutex, read without it.
+    std::atomic<uint32_t> active_callback_mask{0};
+    std::unique_ptr<MessageCountTable> duplicate_message_counts;
+    mutable std::once_flag object_message_counts_once;
+    mutable std::unique_ptr<ObjectMessageSketch> object_message_counts;
 
     vvl::unordered_map<VkQueue, std::unique_ptr<LoggingLabelState>> debug_utils_queue_labels;
     vvl::unordered_map<VkCommandBuffer, std::unique_ptr<LoggingLabelState>> debug_utils_cmd_buffer_labels;
-    vvl::unordered_map<uint64_t, std::string> debug_object_name_map;
-    vvl::unordered_map<uint64_t, std::string> debug_utils_object_name_map;
+    // Objects are often named from worker threads, the names are looked up by every FormatHandle()
+    vvl::StringPool object_names;
+    vvl::concurrent_unordered_map<uint64_t, std::string_view, 4> debug_object_name_map;
+    vvl::concurrent_unordered_map<uint64_t, std::string_view, 4> debug_utils_object_name_map;
+
+    std::unique_ptr<AsyncDelivery> async_delivery;
+
+    std::unique_ptr<StructuredLogWriter> structured_log;
+    VkDebugUtilsMessageSeverityFlagsEXT structured_log_severities{0};
+    VkDebugUtilsMessageTypeFlagsEXT structured_log_types{0};
 };
 
 template DebugReport *GetLayerDataPtr<DebugReport>(void *data_key, std::unordered_map<void *, DebugReport *> &data_map);
@@ -260,6 +405,8 @@ VKAPI_ATTR VkResult LayerCreateReportCallback(DebugReport *debug_report, bool de
 
 template <typename T>
 static inline void LayerDestroyCallback(DebugReport *debug_report, T callback) {
+    // A callback must not be called once destroyed, including for messages queued for asynchronous delivery
+    auto delivery_lock = debug_report->FlushAndLockDelivery();
     std::unique_lock<std::mutex> lock(debug_report->debug_output_mutex);
     debug_report->RemoveDebugUtilsCallback(CastToUint64(callback));
 }
@@ -0,0 +1,134 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "structured_log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <thread>
+
+#include "error_location.h"
+#include "containers/custom_containers.h"
+
+namespace {
+
+struct RecordHeader {
+    uint32_t size;
+    uint32_t message_id;
+    uint64_t timestamp_ns;
+    uint64_t thread_id;
+    uint16_t severity;
+    uint16_t object_count;
+    uint16_t location_count;
+    uint16_t vuid_length;
+};
+static_assert(sizeof(RecordHeader) == 32, "The record layout is part of the file format");
+static_assert(sizeof(StructuredLogWriter::ObjectRecord) == 16, "The record layout is part of the file format");
+static_assert(sizeof(StructuredLogWriter::LocationRecord) == 20, "The record layout is part of the file format");
+
+template <typename T>
+void Append(std::vector<uint8_t> &buffer, const T &value) {
+    const auto *bytes = reinterpret_cast<const uint8_t *>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+}  // namespace
+
+std::unique_ptr<StructuredLogWriter> StructuredLogWriter::Open(const char *filename) {
+    FILE *file = fopen(filename, "ab");
+    if (!file) {
+        return nullptr;
+    }
+    // Records are already batched in buffer_
+    setvbuf(file, nullptr, _IONBF, 0);
+    std::unique_ptr<StructuredLogWriter> writer(new StructuredLogWriter(file));
+    if (fseek(file, 0, SEEK_END) == 0 && ftell(file) == 0) {
+        Append(writer->buffer_, kMagic);
+        Append(writer->buffer_, kVersion);
+    }
+    return writer;
+}
+
+StructuredLogWriter::StructuredLogWriter(FILE *file) : file_(file) { buffer_.reserve(kBufferSize); }
+
+StructuredLogWriter::~StructuredLogWriter() {
+    FlushLocked();
+    fclose(file_);
+}
+
+void StructuredLogWriter::Write(uint32_t message_id, VkDebugUtilsMessageSeverityFlagsEXT severity, std::string_view vuid,
+                                const VulkanTypedHandle *objects, uint32_t object_count, const Location *loc) {
+    // Taken before the lock, the timestamp is the time the message was logged and not the time it got its turn
+    const auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch());
+
+    small_vector<const Location *, 8, uint32_t> chain;
+    for (const Location *level = loc; level; level = level->prev) {
+        chain.emplace_back(level);
+    }
+
+    RecordHeader header{};
+    header.message_id = message_id;
+    header.timestamp_ns = static_cast<uint64_t>(timestamp.count());
+    header.thread_id = static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+    header.severity = static_cast<uint16_t>(severity);
+    header.object_count = static_cast<uint16_t>(std::min<uint32_t>(object_count, UINT16_MAX));
+    header.location_count = static_cast<uint16_t>(std::min<uint32_t>(chain.size(), UINT16_MAX));
+    header.vuid_length = static_cast<uint16_t>(std::min<size_t>(vuid.size(), UINT16_MAX));
+    const size_t payload_size = sizeof(RecordHeader) + header.object_count * sizeof(ObjectRecord) +
+                                header.location_count * sizeof(LocationRecord) + header.vuid_length;
+    const size_t record_size = (payload_size + 7) & ~size_t(7);
+    header.size = static_cast<uint32_t>(record_size);
+
+    std::lock_guard<std::mutex> guard(lock_);
+    if (buffer_.size() + record_size > kBufferSize) {
+        FlushLocked();
+    }
+
+    Append(buffer_, header);
+    for (uint32_t i = 0; i < header.object_count; ++i) {
+        ObjectRecord object{};
+        object.type = ConvertVulkanObjectToCoreObject(objects[i].type);
+        object.handle = objects[i].handle;
+        Append(buffer_, object);
+    }
+    // chain is innermost first
+    for (uint32_t i = header.location_count; i > 0; --i) {
+        const Location &level = *chain[i - 1];
+        LocationRecord location{};
+        location.function = static_cast<uint32_t>(level.function);
+        location.structure = static_cast<uint32_t>(level.structure);
+        location.field = static_cast<uint32_t>(level.field);
+        location.index = level.index;
+        location.is_pnext = level.isPNext ? 1 : 0;
+        Append(buffer_, location);
+    }
+    buffer_.insert(buffer_.end(), vuid.data(), vuid.data() + header.vuid_length);
+    buffer_.resize(buffer_.size() + (record_size - payload_size), 0);
+}
+
+void StructuredLogWriter::Flush() {
+    std::lock_guard<std::mutex> guard(lock_);
+    FlushLocked();
+}
+
+void StructuredLogWriter::FlushLocked() {
+    if (!buffer_.empty()) {
+        fwrite(buffer_.data(), 1, buffer_.size(), file_);
+        buffer_.clear();
+    }
+}
@@ -0,0 +1,88 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include "generated/vk_object_types.h"
+
+struct Location;
+
+// Append-only writer of fixed layout binary records, one per message, for runs where formatting the text of every message
+// costs too much. Nothing is formatted: a record holds the message id, the VUID, the object handles and the Location chain
+// as the vvl::Func/Struct/Field enum values. scripts/decode_structured_log.py turns a file back into readable JSON lines.
+//
+// All values are little endian. The file starts with kMagic and kVersion (uint32_t each), followed by records:
+//
+//   uint32_t size                   whole record, including this field, multiple of 8
+//   uint32_t message_id             hash_util::VuidHash() of the VUID
+//   uint64_t timestamp_ns           system clock, since the epoch
+//   uint64_t thread_id              hash of the std::thread::id that logged the message
+//   uint16_t severity               VkDebugUtilsMessageSeverityFlagBitsEXT
+//   uint16_t object_count
+//   uint16_t location_count
+//   uint16_t vuid_length
+//   ObjectRecord objects[object_count]
+//   LocationRecord locations[location_count]   outermost (the API call) first
+//   char vuid[vuid_length]                      not null terminated, padded with zeros to the record size
+class StructuredLogWriter {
+  public:
+    static constexpr uint32_t kMagic = 0x424c5656;  // "VVLB"
+    static constexpr uint32_t kVersion = 1;
+
+    struct ObjectRecord {
+        uint32_t type;  // VkObjectType
+        uint32_t reserved;
+        uint64_t handle;
+    };
+
+    struct LocationRecord {
+        uint32_t function;   // vvl::Func
+        uint32_t structure;  // vvl::Struct
+        uint32_t field;      // vvl::Field
+        uint32_t index;      // Location::kNoIndex if not an array element
+        uint32_t is_pnext;
+    };
+
+    // Returns nullptr if the file cannot be opened. An existing file is appended to.
+    static std::unique_ptr<StructuredLogWriter> Open(const char *filename);
+
+    StructuredLogWriter(const StructuredLogWriter &) = delete;
+    StructuredLogWriter &operator=(const StructuredLogWriter &) = delete;
+    ~StructuredLogWriter();
+
+    // Thread safe, only copies into the buffer unless it is full
+    void Write(uint32_t message_id, VkDebugUtilsMessageSeverityFlagsEXT severity, std::string_view vuid,
+               const VulkanTypedHandle *objects, uint32_t object_count, const Location *loc);
+    void Flush();
+
+  private:
+    static constexpr size_t kBufferSize = 64 * 1024;
+
+    explicit StructuredLogWriter(FILE *file);
+    // NOTE: lock_ must be held
+    void FlushLocked();
+
+    std::mutex lock_;
+    FILE *file_;
+    std::vector<uint8_t> buffer_;
+};
@@ -32,6 +32,16 @@ void debug_printf::Validator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo
     output_buffer_byte_size = printf_settings.buffer_size;
     verbose = printf_settings.verbose;
     use_stdout = printf_settings.to_stdout;
+    deduplicate = printf_settings.deduplicate;
+    max_messages = printf_settings.max_messages;
+    if (!printf_settings.output_file.empty()) {
+        output_sink = std::make_unique<OutputSink>(printf_settings.output_file);
+        if (!output_sink->IsOpen()) {
+            LogWarning("WARNING-DEBUG-PRINTF", device, loc, "Could not open %s, Debug Printf messages are reported as usual.",
+                       printf_settings.output_file.c_str());
+            output_sink.reset();
+        }
+    }
 
     // This option was published when Debug PrintF came out, leave to not break people's flow
     // Deprecated right after the 1.3.280 SDK release
@@ -61,6 +71,66 @@ void debug_printf::Validator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo
     }
 }
 
+void debug_printf::Validator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
+                                                         const RecordObject &record_obj) {
+    BaseClass::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
+    // Waits for the messages of the last submits to be written
+    output_sink.reset();
+}
+
+debug_printf::OutputSink::OutputSink(const std::string &filename) {
+    if (filename == "stdout") {
+        stream_ = &std::cout;
+    } else {
+        file_.open(filename, std::ios::out | std::ios::trunc);
+        if (!file_.is_open()) {
+            return;
+        }
+        stream_ = &file_;
+    }
+    thread_ = std::thread(&OutputSink::Run, this);
+}
+
+debug_printf::OutputSink::~OutputSink() {
+    if (thread_.joinable()) {
+        {
+            std::lock_guard<std::mutex> guard(lock_);
+            exit_ = true;
+        }
+        pending_cv_.notify_one();
+        thread_.join();
+    }
+}
+
+void debug_printf::OutputSink::Write(std::string &&messages) {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (pending_.empty()) {
+            pending_ = std::move(messages);
+        } else {
+            pending_ += messages;
+        }
+    }
+    pending_cv_.notify_one();
+}
+
+void debug_printf::OutputSink::Run() {
+    std::string messages;
+    std::unique_lock<std::mutex> guard(lock_);
+    while (true) {
+        pending_cv_.wait(guard, [this]() { return exit_ || !pending_.empty(); });
+        if (pending_.empty()) {
+            break;  // exiting with everything written
+        }
+        messages.clear();
+        std::swap(messages, pending_);
+        guard.unlock();
+        stream_->write(messages.data(), messages.size());
+        stream_->flush();
+        guard.lock();
+    }
+}
+
 // Free the device memory and descriptor set associated with a command buffer.
 void debug_printf::Validator::DestroyBuffer(BufferInfo &buffer_info) {
     vmaDestroyBuffer(vmaAllocator, buffer_info.output_mem_block.buffer, buffer_info.output_mem_block.allocation);
@@ -246,12 +316,33 @@ std::vector<debug_printf::Substring> debug_printf::Validator::ParseFormatString(
             begin = pos + 1;
         }
     }
+
+    // Resolve here what doesn't depend on the printed values, instead of for every record
+    for (Substring &substring : parsed_strings) {
+        if (substring.needs_value) {
+            const char *const long_strings[] = {"%ul", "%lu", "%lx"};
+            for (const char *long_string : long_strings) {
+                const size_t long_pos = substring.string.find(long_string);
+                if (long_pos != std::string::npos) {
+                    substring.string.replace(long_pos + 1, 2, long_string[2] == 'u' ? PRIu64 : PRIx64);
+                    substring.is_64_bit = true;
+                    break;
+                }
+            }
+        } else {
+            // Only the %% escapes are left in substrings without a value
+            for (size_t escape_pos = substring.string.find("%%"); escape_pos != std::string::npos;
+                 escape_pos = substring.string.find("%%", escape_pos + 1)) {
+                substring.string.erase(escape_pos, 1);
+            }
+        }
+    }
     return parsed_strings;
 }
 
-std::string debug_printf::Validator::FindFormatString(const std::vector<spirv::Instruction> &instructions, uint32_t string_id) {
+std::string debug_printf::Validator::FindFormatString(const spirv::RawInstructionRange &instructions, uint32_t string_id) {
     std::string format_string;
-    for (const spirv::Instruction &insn : instructions) {
+    for (const spirv::RawInstruction insn : instructions) {
         if (insn.Opcode() == spv::OpString && insn.Word(1) == string_id) {
             format_string = insn.GetAsString(2);
             break;
@@ -260,6 +351,56 @@ std::string debug_printf::Validator::FindFormatString(const std::vector<spirv::I
     return format_string;
 }
 
+std::shared_ptr<const debug_printf::FormatProgram> debug_printf::Validator::FindFormatProgram(uint32_t shader_id,
+                                                                                           uint32_t string_id) const {
+    ReadLockGuard guard(format_programs_lock_);
+    if (auto shader_it = format_programs_.find(shader_id); shader_it != format_programs_.end()) {
+        if (auto it = shader_it->second.find(string_id); it != shader_it->second.end()) {
+            return it->second;
+        }
+    }
+    return nullptr;
+}
+
+std::shared_ptr<const debug_printf::FormatProgram> debug_printf::Validator::AddFormatProgram(
+    uint32_t shader_id, uint32_t string_id, const spirv::RawInstructionRange &instructions) {
+    auto format_program = std::make_shared<const FormatProgram>(ParseFormatString(FindFormatString(instructions, string_id)));
+    WriteLockGuard guard(format_programs_lock_);
+    // Another queue may have parsed the same string in the meantime, keep the first one
+    return format_programs_[shader_id].emplace(string_id, std::move(format_program)).first->second;
+}
+
+void debug_printf::Validator::RemoveFormatPrograms(const std::vector<uint32_t> &shader_ids) {
+    WriteLockGuard guard(format_programs_lock_);
+    for (uint32_t shader_id : shader_ids) {
+        format_programs_.erase(shader_id);
+    }
+}
+
+void debug_printf::Validator::PreCallRecordDestroyShaderEXT(VkDevice device, VkShaderEXT shader,
+                                                            const VkAllocationCallbacks *pAllocator,
+                                                            const RecordObject &record_obj) {
+    std::vector<uint32_t> shader_ids;
+    for (const auto &entry :
+         shader_map.snapshot([shader](const GpuAssistedShaderTracker &entry) { return entry.shader_object == shader; })) {
+        shader_ids.push_back(entry.first);
+    }
+    RemoveFormatPrograms(shader_ids);
+    BaseClass::PreCallRecordDestroyShaderEXT(device, shader, pAllocator, record_obj);
+}
+
+void debug_printf::Validator::PreCallRecordDestroyPipeline(VkDevice device, VkPipeline pipeline,
+                                                           const VkAllocationCallbacks *pAllocator,
+                                                           const RecordObject &record_obj) {
+    std::vector<uint32_t> shader_ids;
+    for (const auto &entry :
+         shader_map.snapshot([pipeline](const GpuAssistedShaderTracker &entry) { return entry.pipeline == pipeline; })) {
+        shader_ids.push_back(entry.first);
+    }
+    RemoveFormatPrograms(shader_ids);
+    BaseClass::PreCallRecordDestroyPipeline(device, pipeline, pAllocator, record_obj);
+}
+
 // GCC and clang don't like using variables as format strings in sprintf.
 // #pragma GCC is recognized by both compilers
 #if defined(__GNUC__) || defined(__clang__)
@@ -267,6 +408,25 @@ std::string debug_printf::Validator::FindFormatString(const std::vector<spirv::I
 #pragma GCC diagnostic ignored "-Wformat-security"
 #endif
 
+// Prints a single value to the end of the message, through a stack buffer unless the value is printed unusually long
+template <typename T>
+static void AppendFormatted(std::string &message, const char *format, T value) {
+    char buffer[256];
+    const int needed = std::snprintf(buffer, sizeof(buffer), format, value);
+    if (needed < 0) {
+        return;
+    }
+    if (static_cast<size_t>(needed) < sizeof(buffer)) {
+        message.append(buffer, needed);
+    } else {
+        const size_t offset = message.size();
+        // +1 for null terminator
+        message.resize(offset + needed + 1);
+        std::snprintf(&message[offset], needed + 1, format, value);
+        message.resize(offset + needed);
+    }
+}
+
 void debug_printf::Validator::AnalyzeAndGenerateMessage(VkCommandBuffer command_buffer, VkQueue queue, BufferInfo &buffer_info,
                                                         uint32_t operation_index, uint32_t *const debug_output_buffer,
                                                         const Location &loc) {
@@ -281,116 +441,124 @@ void debug_printf::Validator::AnalyzeAndGenerateMessage(VkCommandBuffer command_
     uint32_t expect = debug_output_buffer[1];
     if (!expect) return;
 
+    // Reused by all the records, so that formatting doesn't allocate once the message is as long as the longest one
+    std::string shader_message;
+    // With an output sink, the messages of the whole buffer are handed over in a single write
+    std::string sink_messages;
+    // Identical messages are only reported once and the ones over the limit are only counted
+    vvl::unordered_set<OutputRecordWords, hash_util::HasHashMember<OutputRecordWords>> reported_records;
+    uint32_t reported_count = 0;
+    uint32_t duplicate_count = 0;
+    uint32_t over_limit_count = 0;
     uint32_t index = spvtools::kDebugOutputDataOffset;
     while (debug_output_buffer[index]) {
-        std::stringstream shader_message;
+        const uint32_t record_index = index;
+        index += debug_output_buffer[record_index];
+        if (deduplicate &&
+            !reported_records.insert({&debug_output_buffer[record_index + 1], debug_output_buffer[record_index] - 1}).second) {
+            ++duplicate_count;
+            continue;
+        }
+        if (max_messages != 0 && reported_count == max_messages) {
+            ++over_limit_count;
+            continue;
+        }
+        ++reported_count;
+
         VkShaderModule shader_module_handle = VK_NULL_HANDLE;
         VkPipeline pipeline_handle = VK_NULL_HANDLE;
         VkShaderEXT shader_object_handle = VK_NULL_HANDLE;
-        vvl::span<const uint32_t> instrumented_spirv;
-
-        OutputRecord *debug_record = reinterpret_cast<OutputRecord *>(&debug_output_buffer[index]);
-        // Lookup the VkShaderModule handle and SPIR-V code used to create the shader, using the unique shader ID value returned
-        // by the instrumented shader.
-        auto it = shader_map.find(debug_record->shader_id);
-        if (it != shader_map.end()) {
-            shader_module_handle = it->second.shader_module;
-            pipeline_handle = it->second.pipeline;
-            shader_object_handle = it->second.shader_object;
-            instrumented_spirv = it->second.instrumented_spirv;
-        }
-        assert(instrumented_spirv.size() != 0);
-        std::vector<spirv::Instruction> instructions;
-        spirv::GenerateInstructions(instrumented_spirv, instructions);
-
-        // Search through the shader source for the printf format string for this invocation
-        const std::string format_string = FindFormatString(instructions, debug_record->format_string_id);
-        // Break the format string into strings with 1 or 0 value
-        auto format_substrings = ParseFormatString(format_string);
-        void *values = static_cast<void *>(&debug_record->values);
-        // Sprintf each format substring into a temporary string then add that to the message
-        for (auto &substring : format_substrings) {
-            std::string temp_string;
-            size_t needed = 0;
-            std::vector<std::string> format_strings = {"%ul", "%lu", "%lx"};
-            size_t ul_pos = 0;
-            bool print_hex = true;
-            for (const auto &ul_string : format_strings) {
-                ul_pos = substring.string.find(ul_string);
-                if (ul_pos != std::string::npos) {
-                    if (ul_string == "%lu") print_hex = false;
-                    break;
-                }
+        std::vector<uint32_t> instrumented_spirv;
+
+        OutputRecord *debug_record = reinterpret_cast<OutputRecord *>(&debug_output_buffer[record_index]);
+        // The format string is only searched and parsed for the first record printing it, the SPIR-V of the shader is then
+        // only needed for the verbose messages
+        auto format_program = FindFormatProgram(debug_record->shader_id, debug_record->format_string_id);
+        if (!format_program || verbose) {
+            // Lookup the VkShaderModule handle and SPIR-V code used to create the shader, using the unique shader ID value
+            // returned by the instrumented shader.
+            auto it = shader_map.find(debug_record->shader_id);
+            if (it != shader_map.end()) {
+                shader_module_handle = it->second.shader_module;
+                pipeline_handle = it->second.pipeline;
+                shader_object_handle = it->second.shader_object;
+                instrumented_spirv = std::move(it->second.instrumented_spirv);
             }
-            if (ul_pos != std::string::npos) {
-                // Unsigned 64 bit value
-                substring.longval = *static_cast<uint64_t *>(values);
-                values = static_cast<uint64_t *>(values) + 1;
-                if (print_hex) {
-                    substring.string.replace(ul_pos + 1, 2, PRIx64);
-                } else {
-                    substring.string.replace(ul_pos + 1, 2, PRIu64);
-                }
-                // +1 for null terminator
-                needed = std::snprintf(nullptr, 0, substring.string.c_str(), substring.longval) + 1;
-                temp_string.resize(needed);
-                std::snprintf(&temp_string[0], needed, substring.string.c_str(), substring.longval);
+            assert(instrumented_spirv.size() != 0);
+        }
+        const spirv::RawInstructionRange instructions(instrumented_spirv);
+        if (!format_program) {
+            format_program = AddFormatProgram(debug_record->shader_id, debug_record->format_string_id, instructions);
+        }
+
+        shader_message.clear();
+        const uint32_t *values = &debug_record->values;
+        for (const Substring &substring : *format_program) {
+            if (!substring.needs_value) {
+                shader_message += substring.string;
+            } else if (substring.is_64_bit) {
+                uint64_t value;
+                std::memcpy(&value, values, sizeof(value));
+                AppendFormatted(shader_message, substring.string.c_str(), value);
+                values += 2;
             } else {
-                if (substring.needs_value) {
-                    switch (substring.type) {
-                        case varunsigned:
-                            // +1 for null terminator
-                            needed = std::snprintf(nullptr, 0, substring.string.c_str(), *static_cast<uint32_t *>(values)) + 1;
-                            temp_string.resize(needed);
-                            std::snprintf(&temp_string[0], needed, substring.string.c_str(), *static_cast<uint32_t *>(values));
-                            break;
-
-                        case varsigned:
-                            needed = std::snprintf(nullptr, 0, substring.string.c_str(), *static_cast<int32_t *>(values)) + 1;
-                            temp_string.resize(needed);
-                            std::snprintf(&temp_string[0], needed, substring.string.c_str(), *static_cast<int32_t *>(values));
-                            break;
-
-                        case varfloat:
-                            needed = std::snprintf(nullptr, 0, substring.string.c_str(), *static_cast<float *>(values)) + 1;
-                            temp_string.resize(needed);
-                            std::snprintf(&temp_string[0], needed, substring.string.c_str(), *static_cast<float *>(values));
-                            break;
-                    }
-                    values = static_cast<uint32_t *>(values) + 1;
-                } else {
-                    needed = std::snprintf(nullptr, 0, substring.string.c_str()) + 1;
-                    temp_string.resize(needed);
-                    std::snprintf(&temp_string[0], needed, substring.string.c_str());
+                switch (substring.type) {
+                    case varunsigned:
+                        AppendFormatted(shader_message, substring.string.c_str(), *values);
+                        break;
+                    case varsigned:
+                        AppendFormatted(shader_message, substring.string.c_str(), *reinterpret_cast<const int32_t *>(values));
+                        break;
+                    case varfloat:
+                        AppendFormatted(shader_message, substring.string.c_str(), *reinterpret_cast<const float *>(values));
+                        break;
                 }
+                values += 1;
             }
-            shader_message << temp_string.c_str();
         }
 
         if (verbose) {
             std::string common_message;
             std::string filename_message;
             std::string source_message;
-            UtilGenerateCommonMessage(debug_report, command_buffer, &debug_output_buffer[index], shader_module_handle,
+            UtilGenerateCommonMessage(debug_report, command_buffer, &debug_output_buffer[record_index], shader_module_handle,
                                       pipeline_handle, shader_object_handle, buffer_info.pipeline_bind_point, operation_index,
                                       common_message);
-            UtilGenerateSourceMessages(instructions, &debug_output_buffer[index], true, filename_message, source_message);
-            if (use_stdout) {
+            UtilGenerateSourceMessages(instructions, &debug_output_buffer[record_index], true, filename_message, source_message);
+            if (output_sink) {
+                sink_messages += "WARNING-DEBUG-PRINTF ";
+                sink_messages += common_message;
+                sink_messages += ' ';
+                sink_messages += shader_message;
+                sink_messages += ' ';
+                sink_messages += filename_message;
+                sink_messages += ' ';
+                sink_messages += source_message;
+            } else if (use_stdout) {
                 std::cout << "WARNING-DEBUG-PRINTF " << common_message.c_str() << " "
-                          << shader_message.str().c_str() << " " << filename_message.c_str() << " " << source_message.c_str();
+                          << shader_message.c_str() << " " << filename_message.c_str() << " " << source_message.c_str();
             } else {
                 LogInfo("WARNING-DEBUG-PRINTF", queue, loc, "%s %s %s%s", common_message.c_str(),
-                        shader_message.str().c_str(), filename_message.c_str(), source_message.c_str());
+                        shader_message.c_str(), filename_message.c_str(), source_message.c_str());
             }
         } else {
-            if (use_stdout) {
-                std::cout << shader_message.str();
+            if (output_sink) {
+                sink_messages += shader_message;
+            } else if (use_stdout) {
+                std::cout << shader_message;
             } else {
                 // Don't let LogInfo process any '%'s in the string
-                LogInfo("WARNING-DEBUG-PRINTF", queue, loc, "%s", shader_message.str().c_str());
+                LogInfo("WARNING-DEBUG-PRINTF", queue, loc, "%s", shader_message.c_str());
             }
         }
-        index += debug_record->size;
+    }
+    if (!sink_messages.empty()) {
+        output_sink->Write(std::move(sink_messages));
+    }
+    if (duplicate_count != 0 || over_limit_count != 0) {
+        LogInfo("WARNING-DEBUG-PRINTF", queue, loc,
+                "%" PRIu32 " duplicate and %" PRIu32 " over the limit Debug Printf messages of a command were not reported.",
+                duplicate_count, over_limit_count);
     }
     if ((index - spvtools::kDebugOutputDataOffset) != expect) {
         LogWarning("WARNING-DEBUG-PRINTF", queue, loc,
@@ -716,7 +884,7 @@ std::shared_ptr<vvl::CommandBuffer> debug_printf::Validator::CreateCmdBufferStat
                                                                                   const VkCommandBufferAllocateInfo *pCreateInfo,
                                                                                   const vvl::CommandPool *pool) {
     return std::static_pointer_cast<vvl::CommandBuffer>(
-        std::make_shared<debug_printf::CommandBuffer>(*this, handle, pCreateInfo, pool));
+        vvl::MakeState<debug_printf::CommandBuffer>(*this, handle, pCreateInfo, pool));
 }
 
 debug_printf::CommandBuffer::CommandBuffer(debug_printf::Validator &dp, VkCommandBuffer handle,
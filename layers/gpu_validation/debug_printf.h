@@ -17,9 +17,15 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
 #include "gpu_validation/gpu_state_tracker.h"
 #include "gpu_validation/gpu_shader_instrumentor.h"
 #include "gpu_validation/gpu_error_message.h"
+#include "utils/hash_util.h"
 
 namespace debug_printf {
 
@@ -45,9 +51,13 @@ struct Substring {
     std::string string;
     bool needs_value;
     vartype type;
-    uint64_t longval = 0;
+    bool is_64_bit = false;
 };
 
+// A printf format string broken once into the substrings printing at most one value each. The 64 bit specifiers are already
+// rewritten for the host and the literal substrings are unescaped, so they are appended to the message as is.
+using FormatProgram = std::vector<Substring>;
+
 struct OutputRecord {
     uint32_t size;
     uint32_t shader_id;
@@ -56,6 +66,44 @@ struct OutputRecord {
     uint32_t values;
 };
 
+// The words of an output record after its size, the same for all the invocations printing the same message
+struct OutputRecordWords {
+    const uint32_t* words;
+    uint32_t count;
+
+    bool operator==(const OutputRecordWords& other) const {
+        return count == other.count && std::equal(words, words + count, other.words);
+    }
+    size_t hash() const { return hash_util::HashCombiner().Combine(words, words + count).Value(); }
+};
+
+// Writes the Debug Printf messages to a file, or to stdout, from a background thread. The messages of an output buffer are
+// handed over all at once, so reading the buffers neither waits for the writes nor goes through the debug callbacks.
+class OutputSink {
+  public:
+    // "stdout" writes to the standard output
+    explicit OutputSink(const std::string& filename);
+    // Writes the messages still pending
+    ~OutputSink();
+    OutputSink(const OutputSink&) = delete;
+    OutputSink& operator=(const OutputSink&) = delete;
+
+    bool IsOpen() const { return stream_ != nullptr; }
+    void Write(std::string&& messages);
+
+  private:
+    void Run();
+
+    std::ofstream file_;
+    std::ostream* stream_ = nullptr;
+
+    std::mutex lock_;
+    std::condition_variable pending_cv_;
+    std::string pending_;
+    bool exit_ = false;
+    std::thread thread_;
+};
+
 class CommandBuffer : public gpu_tracker::CommandBuffer {
   public:
     std::vector<BufferInfo> buffer_infos;
@@ -90,6 +138,8 @@ class Validator : public GpuShaderInstrumentor {
     void ReportSetupProblemPrintF(LogObjectList objlist, const Location& loc, const char* const specific_message,
                                   bool vma_fail) const;
     void CreateDevice(const VkDeviceCreateInfo* pCreateInfo, const Location& loc) override;
+    void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator,
+                                    const RecordObject& record_obj) override;
     bool InstrumentShader(const vvl::span<const uint32_t>& input, std::vector<uint32_t>& instrumented_spirv,
                           uint32_t unique_shader_id, const Location& loc) override;
     void PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
@@ -98,8 +148,16 @@ class Validator : public GpuShaderInstrumentor {
     void PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createInfoCount, const VkShaderCreateInfoEXT* pCreateInfos,
                                        const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders,
                                        const RecordObject& record_obj, chassis::ShaderObject& chassis_state) override;
+    void PreCallRecordDestroyShaderEXT(VkDevice device, VkShaderEXT shader, const VkAllocationCallbacks* pAllocator,
+                                       const RecordObject& record_obj) override;
+    void PreCallRecordDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator,
+                                      const RecordObject& record_obj) override;
     std::vector<Substring> ParseFormatString(const std::string& format_string);
-    std::string FindFormatString(const std::vector<spirv::Instruction>& instructions, uint32_t string_id);
+    std::string FindFormatString(const spirv::RawInstructionRange& instructions, uint32_t string_id);
+    std::shared_ptr<const FormatProgram> FindFormatProgram(uint32_t shader_id, uint32_t string_id) const;
+    std::shared_ptr<const FormatProgram> AddFormatProgram(uint32_t shader_id, uint32_t string_id,
+                                                          const spirv::RawInstructionRange& instructions);
+    void RemoveFormatPrograms(const std::vector<uint32_t>& shader_ids);
     void AnalyzeAndGenerateMessage(VkCommandBuffer command_buffer, VkQueue queue, BufferInfo& buffer_info, uint32_t operation_index,
                                    uint32_t* const debug_output_buffer, const Location& loc);
     void PreCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex,
@@ -188,5 +246,12 @@ class Validator : public GpuShaderInstrumentor {
   private:
     bool verbose = false;
     bool use_stdout = false;
+    bool deduplicate = false;
+    uint32_t max_messages = 0;
+    std::unique_ptr<OutputSink> output_sink;
+
+    // Format programs of the strings printed so far, by shader id and then OpString id
+    mutable std::shared_mutex format_programs_lock_;
+    vvl::unordered_map<uint32_t, vvl::unordered_map<uint32_t, std::shared_ptr<const FormatProgram>>> format_programs_;
 };
 }  // namespace debug_printf
@@ -256,21 +256,54 @@ static glsl::DescriptorState GetInData(const vvl::MutableDescriptor &desc) {
     return glsl::DescriptorState(desc_class, glsl::kDebugInputBindlessSkipId, vvl::kU32Max);
 }
 
+// Fill the states of the [begin, end) array elements of a binding, data points to the state of its first element
 template <typename Binding>
-void FillBindingInData(const Binding &binding, glsl::DescriptorState *data, uint32_t &index) {
-    for (uint32_t di = 0; di < binding.count; di++) {
+void FillBindingInData(const Binding &binding, uint32_t begin, uint32_t end, glsl::DescriptorState *data) {
+    for (uint32_t di = begin; di < end; di++) {
         if (!binding.updated[di]) {
-            data[index++] = glsl::DescriptorState();
+            data[di] = glsl::DescriptorState();
         } else {
-            data[index++] = GetInData(binding.descriptors[di]);
+            data[di] = GetInData(binding.descriptors[di]);
         }
     }
 }
 
 // Inline Uniforms are currently treated as a single descriptor. Writes to any offsets cause the whole range to be valid.
 template <>
-void FillBindingInData(const vvl::InlineUniformBinding &binding, glsl::DescriptorState *data, uint32_t &index) {
-    data[index++] = glsl::DescriptorState(DescriptorClass::InlineUniform, glsl::kDebugInputBindlessSkipId, vvl::kU32Max);
+void FillBindingInData(const vvl::InlineUniformBinding &binding, uint32_t begin, uint32_t end, glsl::DescriptorState *data) {
+    data[0] = glsl::DescriptorState(DescriptorClass::InlineUniform, glsl::kDebugInputBindlessSkipId, vvl::kU32Max);
+}
+
+static void FillBindingStates(const vvl::DescriptorBinding &binding, uint32_t begin, uint32_t end,
+                              glsl::DescriptorState *data) {
+    switch (binding.descriptor_class) {
+        case DescriptorClass::InlineUniform:
+            FillBindingInData(static_cast<const vvl::InlineUniformBinding &>(binding), begin, end, data);
+            break;
+        case DescriptorClass::GeneralBuffer:
+            FillBindingInData(static_cast<const vvl::BufferBinding &>(binding), begin, end, data);
+            break;
+        case DescriptorClass::TexelBuffer:
+            FillBindingInData(static_cast<const vvl::TexelBinding &>(binding), begin, end, data);
+            break;
+        case DescriptorClass::Mutable:
+            FillBindingInData(static_cast<const vvl::MutableBinding &>(binding), begin, end, data);
+            break;
+        case DescriptorClass::PlainSampler:
+            FillBindingInData(static_cast<const vvl::SamplerBinding &>(binding), begin, end, data);
+            break;
+        case DescriptorClass::ImageSampler:
+            FillBindingInData(static_cast<const vvl::ImageSamplerBinding &>(binding), begin, end, data);
+            break;
+        case DescriptorClass::Image:
+            FillBindingInData(static_cast<const vvl::ImageBinding &>(binding), begin, end, data);
+            break;
+        case DescriptorClass::AccelerationStructure:
+            FillBindingInData(static_cast<const vvl::AccelerationStructureBinding &>(binding), begin, end, data);
+            break;
+        default:
+            assert(false);
+    }
 }
 
 std::shared_ptr<DescriptorSet::State> DescriptorSet::GetCurrentState() {
@@ -280,77 +313,100 @@ std::shared_ptr<DescriptorSet::State> DescriptorSet::GetCurrentState() {
     if (last_used_state_ && last_used_state_->version == cur_version) {
         return last_used_state_;
     }
-    auto next_state = std::make_shared<State>();
-    next_state->set = VkHandle();
-    next_state->version = cur_version;
-    next_state->allocator = gv_dev->vmaAllocator;
 
-    uint32_t descriptor_count = 0;  // Number of descriptors, including all array elements
-    if (GetBindingCount() > 0) {
-        for (const auto &binding : *this) {
+    // Range of host_state_ that changed since the last version
+    uint32_t changed_begin = 0;
+    uint32_t changed_end = 0;
+    if (host_state_.empty()) {
+        uint32_t descriptor_count = 0;  // Number of descriptors, including all array elements
+        binding_state_start_.resize(bindings_.size());
+        for (uint32_t i = 0; i < bindings_.size(); i++) {
+            binding_state_start_[i] = descriptor_count;
             // Shader instrumentation is tracking inline uniform blocks as scalars. Don't try to validate inline uniform
             // blocks
-            if (binding->type == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT) {
+            if (bindings_[i]->type == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT) {
                 descriptor_count++;
             } else {
-                descriptor_count += binding->count;
+                descriptor_count += bindings_[i]->count;
+            }
+        }
+        if (descriptor_count == 0) {
+            // no descriptors case, return a dummy state object
+            auto next_state = std::make_shared<State>();
+            next_state->set = VkHandle();
+            next_state->version = cur_version;
+            next_state->allocator = gv_dev->vmaAllocator;
+            last_used_state_ = next_state;
+            return last_used_state_;
+        }
+        host_state_.resize(descriptor_count);
+        dirty_ranges_.assign(bindings_.size(), DirtyRange{});
+        for (uint32_t i = 0; i < bindings_.size(); i++) {
+            FillBindingStates(*bindings_[i], 0, bindings_[i]->count, host_state_.data() + binding_state_start_[i]);
+        }
+        changed_end = descriptor_count;
+    } else {
+        changed_begin = static_cast<uint32_t>(host_state_.size());
+        for (uint32_t i = 0; i < bindings_.size(); i++) {
+            DirtyRange &range = dirty_ranges_[i];
+            if (range.begin >= range.end) {
+                continue;
             }
+            const uint32_t binding_start = binding_state_start_[i];
+            FillBindingStates(*bindings_[i], range.begin, range.end, host_state_.data() + binding_start);
+            changed_begin = std::min(changed_begin, binding_start + range.begin);
+            changed_end = std::max(changed_end, binding_start + range.end);
+            range = DirtyRange{};
         }
+        changed_begin = std::min(changed_begin, changed_end);
     }
-    if (descriptor_count == 0) {
-        // no descriptors case, return a dummy state object
-        last_used_state_ = next_state;
+
+    const VkDeviceSize state_offset = changed_begin * sizeof(glsl::DescriptorState);
+    const VkDeviceSize state_size = (changed_end - changed_begin) * sizeof(glsl::DescriptorState);
+    VkResult result = VK_SUCCESS;
+
+    // Command buffers keep the states they were recorded with alive until they are reset. When none of them references the
+    // last state anymore, the GPU cannot be reading it and only the descriptors that changed need to be uploaded to it.
+    if (last_used_state_ && last_used_state_.use_count() == 1 && last_used_state_->allocation) {
+        if (state_size > 0) {
+            glsl::DescriptorState *data{nullptr};
+            result = vmaMapMemory(last_used_state_->allocator, last_used_state_->allocation, reinterpret_cast<void **>(&data));
+            assert(result == VK_SUCCESS);
+            memcpy(data + changed_begin, host_state_.data() + changed_begin, static_cast<size_t>(state_size));
+            result = vmaFlushAllocation(last_used_state_->allocator, last_used_state_->allocation, state_offset, state_size);
+            // No good way to handle this error, we should still try to unmap.
+            assert(result == VK_SUCCESS);
+            vmaUnmapMemory(last_used_state_->allocator, last_used_state_->allocation);
+        }
+        last_used_state_->version = cur_version;
         return last_used_state_;
     }
 
+    auto next_state = std::make_shared<State>();
+    next_state->set = VkHandle();
+    next_state->version = cur_version;
+    next_state->allocator = gv_dev->vmaAllocator;
+
     VkBufferCreateInfo buffer_info = vku::InitStruct<VkBufferCreateInfo>();
-    buffer_info.size = descriptor_count * sizeof(glsl::DescriptorState);
+    buffer_info.size = host_state_.size() * sizeof(glsl::DescriptorState);
     buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
 
     // The descriptor state buffer can be very large (4mb+ in some games). Allocating it as HOST_CACHED
     // and manually flushing it at the end of the state updates is faster than using HOST_COHERENT.
     VmaAllocationCreateInfo alloc_info{};
     alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
-    VkResult result =
-        vmaCreateBuffer(next_state->allocator, &buffer_info, &alloc_info, &next_state->buffer, &next_state->allocation, nullptr);
+    result = vmaCreateBuffer(next_state->allocator, &buffer_info, &alloc_info, &next_state->buffer, &next_state->allocation,
+                             nullptr);
     if (result != VK_SUCCESS) {
+        // The last state does not match host_state_ anymore, it must not be updated in place
+        last_used_state_.reset();
         return nullptr;
     }
     glsl::DescriptorState *data{nullptr};
     result = vmaMapMemory(next_state->allocator, next_state->allocation, reinterpret_cast<void **>(&data));
     assert(result == VK_SUCCESS);
-    uint32_t index = 0;
-    for (uint32_t i = 0; i < bindings_.size(); i++) {
-        const auto &binding = *bindings_[i];
-        switch (binding.descriptor_class) {
-            case DescriptorClass::InlineUniform:
-                FillBindingInData(static_cast<const vvl::InlineUniformBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::GeneralBuffer:
-                FillBindingInData(static_cast<const vvl::BufferBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::TexelBuffer:
-                FillBindingInData(static_cast<const vvl::TexelBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::Mutable:
-                FillBindingInData(static_cast<const vvl::MutableBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::PlainSampler:
-                FillBindingInData(static_cast<const vvl::SamplerBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::ImageSampler:
-                FillBindingInData(static_cast<const vvl::ImageSamplerBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::Image:
-                FillBindingInData(static_cast<const vvl::ImageBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::AccelerationStructure:
-                FillBindingInData(static_cast<const vvl::AccelerationStructureBinding &>(binding), data, index);
-                break;
-            default:
-                assert(false);
-        }
-    }
+    memcpy(data, host_state_.data(), static_cast<size_t>(buffer_info.size));
+
     VkBufferDeviceAddressInfo buffer_device_address_info = vku::InitStructHelper();
     buffer_device_address_info.buffer = next_state->buffer;
 
@@ -475,18 +531,67 @@ std::map<uint32_t, std::vector<uint32_t>> DescriptorSet::State::UsedDescriptors(
 
 DescriptorSet::State::~State() { vmaDestroyBuffer(allocator, buffer, allocation); }
 
+void DescriptorSet::MarkDirty(uint32_t binding, uint32_t array_element, uint32_t descriptor_count) {
+    auto guard = Lock();
+    // Until the first state is built, every descriptor is filled anyway
+    if (host_state_.empty()) {
+        return;
+    }
+    uint32_t index = GetLayout()->GetIndexFromBinding(binding);
+    uint32_t remaining = descriptor_count;
+    uint32_t begin = array_element;
+    for (; remaining > 0 && index < bindings_.size(); index++, begin = 0) {
+        const auto &dst_binding = *bindings_[index];
+        // The state of an inline uniform block does not depend on its contents, and its update count is in bytes
+        if (dst_binding.type == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT) {
+            break;
+        }
+        if (begin >= dst_binding.count) {
+            continue;
+        }
+        const uint32_t end = begin + std::min(remaining, dst_binding.count - begin);
+        DirtyRange &range = dirty_ranges_[index];
+        if (range.begin >= range.end) {
+            range = {begin, end};
+        } else {
+            range.begin = std::min(range.begin, begin);
+            range.end = std::max(range.end, end);
+        }
+        remaining -= end - begin;
+    }
+}
+
 void DescriptorSet::PerformPushDescriptorsUpdate(uint32_t write_count, const VkWriteDescriptorSet *write_descs) {
+    // The writes go through PerformWriteUpdate, which marks the descriptors they touch
     vvl::DescriptorSet::PerformPushDescriptorsUpdate(write_count, write_descs);
     current_version_++;
 }
 
+void DescriptorSet::ResetPushDescriptors() {
+    vvl::DescriptorSet::ResetPushDescriptors();
+    for (const auto &binding : bindings_) {
+        MarkDirty(binding->binding, 0, binding->count);
+    }
+    current_version_++;
+}
+
 void DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorSet &write_desc) {
     vvl::DescriptorSet::PerformWriteUpdate(write_desc);
+    MarkDirty(write_desc.dstBinding, write_desc.dstArrayElement, write_desc.descriptorCount);
+    current_version_++;
+}
+
+void DescriptorSet::PerformTemplateUpdate(const vvl::DescriptorUpdateTemplate &template_state, const void *p_data) {
+    vvl::DescriptorSet::PerformTemplateUpdate(template_state, p_data);
+    for (const auto &run : template_state.update_runs) {
+        MarkDirty(run.binding, run.array_element, run.descriptor_count);
+    }
     current_version_++;
 }
 
 void DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet &copy_desc, const vvl::DescriptorSet &src_set) {
     vvl::DescriptorSet::PerformCopyUpdate(copy_desc, src_set);
+    MarkDirty(copy_desc.dstBinding, copy_desc.dstArrayElement, copy_desc.descriptorCount);
     current_version_++;
 }
 
@@ -504,6 +609,7 @@ DescriptorHeap::DescriptorHeap(Validator &gpu_dev, uint32_t max_descriptors)
 
     VmaAllocationCreateInfo alloc_info{};
     alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    alloc_info.pool = gpu_dev.persistent_buffer_pool;
     [[maybe_unused]] VkResult result;
     result = vmaCreateBuffer(allocator_, &buffer_info, &alloc_info, &buffer_, &allocation_, nullptr);
     assert(result == VK_SUCCESS);
@@ -25,6 +25,9 @@
 namespace gpuav {
 
 class Validator;
+namespace glsl {
+struct DescriptorState;
+}  // namespace glsl
 
 class DescriptorSet : public vvl::DescriptorSet {
   public:
@@ -47,7 +50,9 @@ class DescriptorSet : public vvl::DescriptorSet {
     };
     void PerformPushDescriptorsUpdate(uint32_t write_count, const VkWriteDescriptorSet *write_descs) override;
     void PerformWriteUpdate(const VkWriteDescriptorSet &) override;
+    void PerformTemplateUpdate(const vvl::DescriptorUpdateTemplate &template_state, const void *p_data) override;
     void PerformCopyUpdate(const VkCopyDescriptorSet &, const vvl::DescriptorSet &) override;
+    void ResetPushDescriptors() override;
 
     VkDeviceAddress GetLayoutState();
     std::shared_ptr<State> GetCurrentState();
@@ -62,10 +67,23 @@ class DescriptorSet : public vvl::DescriptorSet {
         VkBuffer buffer{VK_NULL_HANDLE};
         VkDeviceAddress device_addr{0};
     };
+    // Range of array elements of a binding, empty when begin >= end
+    struct DirtyRange {
+        uint32_t begin{0};
+        uint32_t end{0};
+    };
     std::lock_guard<std::mutex> Lock() const { return std::lock_guard<std::mutex>(state_lock_); }
+    // Record the descriptors touched by an update, starting at binding/array_element and rolling over to the next
+    // bindings like the update itself
+    void MarkDirty(uint32_t binding, uint32_t array_element, uint32_t descriptor_count);
 
     Layout layout_;
     std::atomic<uint32_t> current_version_{0};
+    // Host copy of the descriptor state of the last version, laid out like the state buffers. Only the dirty ranges are
+    // refreshed when a new version is needed, instead of walking every descriptor of the set again.
+    std::vector<glsl::DescriptorState> host_state_;
+    std::vector<uint32_t> binding_state_start_;  // index of the first descriptor of each binding in host_state_
+    std::vector<DirtyRange> dirty_ranges_;       // per binding index, descriptors updated since host_state_ was refreshed
     std::shared_ptr<State> last_used_state_;
     std::shared_ptr<State> output_state_;
     mutable std::mutex state_lock_;
@@ -119,11 +119,8 @@ static void GenerateStageMessage(const uint32_t *error_record, std::string &msg)
     msg = strm.str();
 }
 
-// The lock (debug_output_mutex) is held by the caller (UtilGenerateCommonMessage),
-// because the latter has code paths that make multiple calls of this function,
-// and all such calls have to access the same debug reporting state to ensure consistency of output information.
-static std::string LookupDebugUtilsNameNoLock(const DebugReport *debug_report, const uint64_t object) {
-    auto object_label = debug_report->GetUtilsObjectNameNoLock(object);
+static std::string LookupDebugUtilsName(const DebugReport *debug_report, const uint64_t object) {
+    std::string object_label(debug_report->GetUtilsObjectName(object));
     if (object_label != "") {
         object_label = "(" + object_label + ")";
     }
@@ -138,15 +135,13 @@ void UtilGenerateCommonMessage(const DebugReport *debug_report, const VkCommandB
     using namespace spvtools;
     std::ostringstream strm;
     if (shader_module_handle == VK_NULL_HANDLE && shader_object_handle == VK_NULL_HANDLE) {
-        std::unique_lock<std::mutex> lock(debug_report->debug_output_mutex);
         strm << std::hex << std::showbase << "Internal Error: Unable to locate information for shader used in command buffer "
-             << LookupDebugUtilsNameNoLock(debug_report, HandleToUint64(commandBuffer)) << "(" << HandleToUint64(commandBuffer)
+             << LookupDebugUtilsName(debug_report, HandleToUint64(commandBuffer)) << "(" << HandleToUint64(commandBuffer)
              << "). ";
         assert(true);
     } else {
-        std::unique_lock<std::mutex> lock(debug_report->debug_output_mutex);
         strm << std::hex << std::showbase << "Command buffer "
-             << LookupDebugUtilsNameNoLock(debug_report, HandleToUint64(commandBuffer)) << "(" << HandleToUint64(commandBuffer)
+             << LookupDebugUtilsName(debug_report, HandleToUint64(commandBuffer)) << "(" << HandleToUint64(commandBuffer)
              << "). ";
         if (pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
             strm << "Draw ";
@@ -160,13 +155,13 @@ void UtilGenerateCommonMessage(const DebugReport *debug_report, const VkCommandB
         }
         if (shader_module_handle) {
             strm << "Index " << operation_index << ". "
-                 << "Pipeline " << LookupDebugUtilsNameNoLock(debug_report, HandleToUint64(pipeline_handle)) << "("
+                 << "Pipeline " << LookupDebugUtilsName(debug_report, HandleToUint64(pipeline_handle)) << "("
                  << HandleToUint64(pipeline_handle) << "). "
-                 << "Shader Module " << LookupDebugUtilsNameNoLock(debug_report, HandleToUint64(shader_module_handle)) << "("
+                 << "Shader Module " << LookupDebugUtilsName(debug_report, HandleToUint64(shader_module_handle)) << "("
                  << HandleToUint64(shader_module_handle) << "). ";
         } else {
             strm << "Index " << operation_index << ". "
-                 << "Shader Object " << LookupDebugUtilsNameNoLock(debug_report, HandleToUint64(shader_object_handle)) << "("
+                 << "Shader Object " << LookupDebugUtilsName(debug_report, HandleToUint64(shader_object_handle)) << "("
                  << HandleToUint64(shader_object_handle) << "). ";
         }
     }
@@ -177,10 +172,10 @@ void UtilGenerateCommonMessage(const DebugReport *debug_report, const VkCommandB
 
 // Read the contents of the SPIR-V OpSource instruction and any following continuation instructions.
 // Split the single string into a vector of strings, one for each line, for easier processing.
-static void ReadOpSource(const std::vector<spirv::Instruction> &instructions, const uint32_t reported_file_id,
+static void ReadOpSource(const spirv::RawInstructionRange &instructions, const uint32_t reported_file_id,
                          std::vector<std::string> &opsource_lines) {
-    for (size_t i = 0; i < instructions.size(); i++) {
-        const spirv::Instruction &insn = instructions[i];
+    for (auto it = instructions.begin(); it != instructions.end(); ++it) {
+        const spirv::RawInstruction insn = *it;
         if ((insn.Opcode() == spv::OpSource) && (insn.Length() >= 5) && (insn.Word(3) == reported_file_id)) {
             std::istringstream in_stream;
             std::string cur_line;
@@ -189,8 +184,8 @@ static void ReadOpSource(const std::vector<spirv::Instruction> &instructions, co
                 opsource_lines.push_back(cur_line);
             }
 
-            for (size_t k = i + 1; k < instructions.size(); k++) {
-                const spirv::Instruction &continue_insn = instructions[k];
+            for (++it; it != instructions.end(); ++it) {
+                const spirv::RawInstruction continue_insn = *it;
                 if (continue_insn.Opcode() != spv::OpSourceContinued) {
                     break;
                 }
@@ -250,7 +245,7 @@ static bool GetLineAndFilename(const std::string &string, uint32_t *linenumber,
 
 // Extract the filename, line number, and column number from the correct OpLine and build a message string from it.
 // Scan the source (from OpSource) to find the line of source at the reported line number and place it in another message string.
-void UtilGenerateSourceMessages(const std::vector<spirv::Instruction> &instructions, const uint32_t *error_record, bool from_printf,
+void UtilGenerateSourceMessages(const spirv::RawInstructionRange &instructions, const uint32_t *error_record, bool from_printf,
                                 std::string &filename_msg, std::string &source_msg) {
     using namespace spvtools;
     if (instructions.empty()) {
@@ -266,7 +261,7 @@ void UtilGenerateSourceMessages(const std::vector<spirv::Instruction> &instructi
     uint32_t reported_file_id = 0;
     uint32_t reported_line_number = 0;
     uint32_t reported_column_number = 0;
-    for (const spirv::Instruction &insn : instructions) {
+    for (const spirv::RawInstruction insn : instructions) {
         if (insn.Opcode() == spv::OpLine) {
             reported_file_id = insn.Word(1);
             reported_line_number = insn.Word(2);
@@ -291,7 +286,7 @@ void UtilGenerateSourceMessages(const std::vector<spirv::Instruction> &instructi
             prefix = "Shader validation error occurred ";
         }
 
-        for (const spirv::Instruction &insn : instructions) {
+        for (const spirv::RawInstruction insn : instructions) {
             if (insn.Opcode() == spv::OpString && insn.Length() >= 3 && insn.Word(1) == reported_file_id) {
                 found_opstring = true;
                 reported_filename = insn.GetAsString(2);
@@ -602,8 +597,7 @@ bool Validator::AnalyzeAndGenerateMessage(VkCommandBuffer cmd_buffer, VkQueue qu
             instrumented_spirv = it->second.instrumented_spirv;
         }
 
-        std::vector<spirv::Instruction> instructions;
-        spirv::GenerateInstructions(instrumented_spirv, instructions);
+        const spirv::RawInstructionRange instructions(instrumented_spirv);
 
         std::string stage_message;
         std::string common_message;
@@ -628,14 +622,17 @@ bool Validator::AnalyzeAndGenerateMessage(VkCommandBuffer cmd_buffer, VkQueue qu
     return error_found;
 }
 
-bool CommandResources::LogValidationMessage(Validator &validator, VkQueue queue, VkCommandBuffer cmd_buffer,
+bool CommandResources::LogValidationMessage(Validator &validator, VkQueue queue, const CommandBuffer &cmd_buffer,
                                             uint32_t *output_buffer_begin, const uint32_t operation_index,
                                             const LogObjectList &objlist) {
-    const DescBindingInfo *di_info = desc_binding_index != vvl::kU32Max ? &(*desc_binding_list)[desc_binding_index] : nullptr;
+    // The sets are only resolved from the references the binds recorded now that there may be an error to report
+    const std::vector<DescSetState> descriptor_sets =
+        desc_binding_index != vvl::kU32Max
+            ? cmd_buffer.ResolveDescriptorSets(cmd_buffer.di_input_buffer_list[desc_binding_index])
+            : std::vector<DescSetState>();
     const Location loc(command);
-    bool error_logged =
-        validator.AnalyzeAndGenerateMessage(cmd_buffer, queue, *this, operation_index, output_buffer_begin,
-                                            di_info ? di_info->descriptor_set_buffers : std::vector<DescSetState>(), loc);
+    bool error_logged = validator.AnalyzeAndGenerateMessage(cmd_buffer.VkHandle(), queue, *this, operation_index,
+                                                            output_buffer_begin, descriptor_sets, loc);
 
     if (!error_logged) {
         error_logged = LogCustomValidationMessage(validator, output_buffer_begin, operation_index, objlist);
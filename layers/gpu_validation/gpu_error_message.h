@@ -18,12 +18,12 @@
 #include "generated/chassis.h"
 
 namespace spirv {
-class Instruction;
+class RawInstructionRange;
 }  // namespace spirv
 
 void UtilGenerateCommonMessage(const DebugReport *debug_report, const VkCommandBuffer commandBuffer, const uint32_t *debug_record,
                                const VkShaderModule shader_module_handle, const VkPipeline pipeline_handle,
                                const VkShaderEXT shader_object_handle, const VkPipelineBindPoint pipeline_bind_point,
                                const uint32_t operation_index, std::string &msg);
-void UtilGenerateSourceMessages(const std::vector<spirv::Instruction> &instructions, const uint32_t *debug_record, bool from_printf,
+void UtilGenerateSourceMessages(const spirv::RawInstructionRange &instructions, const uint32_t *debug_record, bool from_printf,
                                 std::string &filename_msg, std::string &source_msg);
@@ -89,7 +89,9 @@ void Validator::UpdateCmdBufImageLayouts(const vvl::CommandBuffer &cb_state) {
         auto image_state = Get<vvl::Image>(image);
         if (image_state && image_state->GetId() == layout_map_entry.second.id) {
             auto guard = image_state->layout_range_map->WriteLock();
-            sparse_container::splice(*image_state->layout_range_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
+            if (sparse_container::splice(*image_state->layout_range_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater())) {
+                image_state->layout_range_map->SetChanged();
+            }
         }
     }
 }
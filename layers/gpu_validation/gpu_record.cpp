@@ -16,7 +16,9 @@
  */
 
 #include <cmath>
+#include <cstring>
 #include <fstream>
+#include <vector>
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
 #include <unistd.h>
 #endif
@@ -108,12 +110,34 @@ void Validator::PreCallRecordDestroyRenderPass(VkDevice device, VkRenderPass ren
     BaseClass::PreCallRecordDestroyRenderPass(device, renderPass, pAllocator, record_obj);
 }
 
+void Validator::PostCallRecordBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo *pBeginInfo,
+                                                 const RecordObject &record_obj) {
+    BaseClass::PostCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, record_obj);
+    if (!gpuav_settings.report_overhead || aborted || record_obj.result != VK_SUCCESS) {
+        return;
+    }
+    if (auto cb_state = GetWrite<CommandBuffer>(commandBuffer)) {
+        cb_state->BeginOverheadTiming(record_obj.location);
+    }
+}
+
+void Validator::PreCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, const RecordObject &record_obj) {
+    BaseClass::PreCallRecordEndCommandBuffer(commandBuffer, record_obj);
+    if (!gpuav_settings.report_overhead || aborted) {
+        return;
+    }
+    if (auto cb_state = GetWrite<CommandBuffer>(commandBuffer)) {
+        cb_state->EndOverheadTiming();
+    }
+}
+
 // Create the instrumented shader data to provide to the driver.
 void Validator::PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
                                                 const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
                                                 const RecordObject &record_obj, chassis::CreateShaderModule &chassis_state) {
     BaseClass::PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, record_obj, chassis_state);
     if (gpuav_settings.select_instrumented_shaders && !CheckForGpuAvEnabled(pCreateInfo->pNext)) return;
+    if (!IsShaderSelected(vvl::make_span(pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t)))) return;
     uint32_t shader_id;
     if (gpuav_settings.cache_instrumented_shaders) {
         const uint32_t shader_hash = hash_util::ShaderHash(pCreateInfo->pCode, pCreateInfo->codeSize);
@@ -144,6 +168,10 @@ void Validator::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createIn
                                              chassis_state);
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         if (gpuav_settings.select_instrumented_shaders && !CheckForGpuAvEnabled(pCreateInfos[i].pNext)) continue;
+        if (!IsShaderSelected(vvl::make_span(static_cast<const uint32_t *>(pCreateInfos[i].pCode),
+                                             pCreateInfos[i].codeSize / sizeof(uint32_t)))) {
+            continue;
+        }
         if (gpuav_settings.cache_instrumented_shaders) {
             const uint32_t shader_hash = hash_util::ShaderHash(pCreateInfos[i].pCode, pCreateInfos[i].codeSize);
             if (CheckForCachedInstrumentedShader(i, chassis_state.unique_shader_ids[i], chassis_state)) {
@@ -171,11 +199,40 @@ void Validator::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createIn
 // Clean up device-related resources
 void Validator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
                                            const RecordObject &record_obj) {
+    if (gpuav_settings.report_memory_usage && vmaAllocator) {
+        ReportMemoryUsage(record_obj.location);
+    }
+    if (gpuav_settings.report_overhead) {
+        ReportOverhead(record_obj.location);
+    }
     desc_heap.reset();
+    // Command buffers still allocated release their resources when the state tracker destroys them, after this
+    cmd_buffer_resources_pool.Destroy(*this);
     for (auto &[key, shared_resources] : shared_validation_resources_map) {
         shared_resources->Destroy(*this);
     }
 
+    if (internal_pipeline_cache != VK_NULL_HANDLE) {
+        // Only written when pipelines missing from the file were compiled, the data then grew
+        size_t data_size = 0;
+        std::vector<char> data;
+        if (DispatchGetPipelineCacheData(device, internal_pipeline_cache, &data_size, nullptr) == VK_SUCCESS &&
+            data_size != internal_pipeline_cache_loaded_size) {
+            const InternalPipelineCacheHeader header(phys_dev_props);
+            data.resize(sizeof(header) + data_size);
+            std::memcpy(data.data(), reinterpret_cast<const char *>(&header), sizeof(header));
+            if (DispatchGetPipelineCacheData(device, internal_pipeline_cache, &data_size, data.data() + sizeof(header)) ==
+                VK_SUCCESS) {
+                std::ofstream file_stream(internal_pipeline_cache_path, std::ofstream::out | std::ofstream::binary);
+                if (file_stream) {
+                    file_stream.write(data.data(), sizeof(header) + data_size);
+                }
+            }
+        }
+        DispatchDestroyPipelineCache(device, internal_pipeline_cache, nullptr);
+        internal_pipeline_cache = VK_NULL_HANDLE;
+    }
+
     if (gpuav_settings.cache_instrumented_shaders && !instrumented_shaders.empty()) {
         std::ofstream file_stream(instrumented_shader_cache_path, std::ofstream::out | std::ofstream::binary);
         if (file_stream) {
@@ -358,8 +415,7 @@ void Validator::PreCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t ver
 
     CommandResources cmd_resources =
         AllocateActionCommandResources(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, record_obj.location);
-    auto cmd_resources_ptr = std::make_unique<CommandResources>(cmd_resources);
-    StoreCommandResources(commandBuffer, std::move(cmd_resources_ptr), record_obj.location);
+    StoreCommandResources(commandBuffer, cmd_resources, record_obj.location);
 }
 
 void Validator::PreCallRecordCmdDrawMultiEXT(VkCommandBuffer commandBuffer, uint32_t drawCount,
@@ -370,8 +426,7 @@ void Validator::PreCallRecordCmdDrawMultiEXT(VkCommandBuffer commandBuffer, uint
     for (uint32_t i = 0; i < drawCount; i++) {
         CommandResources cmd_resources =
             AllocateActionCommandResources(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, record_obj.location);
-        auto cmd_resources_ptr = std::make_unique<CommandResources>(cmd_resources);
-        StoreCommandResources(commandBuffer, std::move(cmd_resources_ptr), record_obj.location);
+        StoreCommandResources(commandBuffer, cmd_resources, record_obj.location);
     }
 }
 
@@ -382,8 +437,7 @@ void Validator::PreCallRecordCmdDrawIndexed(VkCommandBuffer commandBuffer, uint3
                                            record_obj);
     CommandResources cmd_resources =
         AllocateActionCommandResources(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, record_obj.location);
-    auto cmd_resources_ptr = std::make_unique<CommandResources>(cmd_resources);
-    StoreCommandResources(commandBuffer, std::move(cmd_resources_ptr), record_obj.location);
+    StoreCommandResources(commandBuffer, cmd_resources, record_obj.location);
 }
 
 void Validator::PreCallRecordCmdDrawMultiIndexedEXT(VkCommandBuffer commandBuffer, uint32_t drawCount,
@@ -395,8 +449,7 @@ void Validator::PreCallRecordCmdDrawMultiIndexedEXT(VkCommandBuffer commandBuffe
     for (uint32_t i = 0; i < drawCount; i++) {
         CommandResources cmd_resources =
             AllocateActionCommandResources(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, record_obj.location);
-        auto cmd_resources_ptr = std::make_unique<CommandResources>(cmd_resources);
-        StoreCommandResources(commandBuffer, std::move(cmd_resources_ptr), record_obj.location);
+        StoreCommandResources(commandBuffer, cmd_resources, record_obj.location);
     }
 }
 
@@ -444,8 +497,7 @@ void Validator::PreCallRecordCmdDrawIndirectByteCountEXT(VkCommandBuffer command
                                                         counterBufferOffset, counterOffset, vertexStride, record_obj);
     CommandResources cmd_resources =
         AllocateActionCommandResources(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, record_obj.location);
-    auto cmd_resources_ptr = std::make_unique<CommandResources>(cmd_resources);
-    StoreCommandResources(commandBuffer, std::move(cmd_resources_ptr), record_obj.location);
+    StoreCommandResources(commandBuffer, cmd_resources, record_obj.location);
 }
 
 void Validator::PreCallRecordCmdDrawIndexedIndirectCountKHR(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
@@ -472,8 +524,7 @@ void Validator::PreCallRecordCmdDrawMeshTasksNV(VkCommandBuffer commandBuffer, u
     ValidationStateTracker::PreCallRecordCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask, record_obj);
     CommandResources cmd_resources =
         AllocateActionCommandResources(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, record_obj.location);
-    auto cmd_resources_ptr = std::make_unique<CommandResources>(cmd_resources);
-    StoreCommandResources(commandBuffer, std::move(cmd_resources_ptr), record_obj.location);
+    StoreCommandResources(commandBuffer, cmd_resources, record_obj.location);
 }
 
 void Validator::PreCallRecordCmdDrawMeshTasksIndirectNV(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
@@ -500,8 +551,7 @@ void Validator::PreCallRecordCmdDrawMeshTasksEXT(VkCommandBuffer commandBuffer,
     BaseClass::PreCallRecordCmdDrawMeshTasksEXT(commandBuffer, groupCountX, groupCountY, groupCountZ, record_obj);
     CommandResources cmd_resources =
         AllocateActionCommandResources(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, record_obj.location);
-    auto cmd_resources_ptr = std::make_unique<CommandResources>(cmd_resources);
-    StoreCommandResources(commandBuffer, std::move(cmd_resources_ptr), record_obj.location);
+    StoreCommandResources(commandBuffer, cmd_resources, record_obj.location);
 }
 
 void Validator::PreCallRecordCmdDrawMeshTasksIndirectEXT(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
@@ -528,8 +578,7 @@ void Validator::PreCallRecordCmdDispatch(VkCommandBuffer commandBuffer, uint32_t
     BaseClass::PreCallRecordCmdDispatch(commandBuffer, x, y, z, record_obj);
     CommandResources cmd_resources =
         AllocateActionCommandResources(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, record_obj.location);
-    auto cmd_resources_ptr = std::make_unique<CommandResources>(cmd_resources);
-    StoreCommandResources(commandBuffer, std::move(cmd_resources_ptr), record_obj.location);
+    StoreCommandResources(commandBuffer, cmd_resources, record_obj.location);
 }
 
 void Validator::PreCallRecordCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
@@ -548,8 +597,7 @@ void Validator::PreCallRecordCmdDispatchBase(VkCommandBuffer commandBuffer, uint
 
     CommandResources cmd_resources =
         AllocateActionCommandResources(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, record_obj.location);
-    auto cmd_resources_ptr = std::make_unique<CommandResources>(cmd_resources);
-    StoreCommandResources(commandBuffer, std::move(cmd_resources_ptr), record_obj.location);
+    StoreCommandResources(commandBuffer, cmd_resources, record_obj.location);
 }
 
 void Validator::PreCallRecordCmdDispatchBaseKHR(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY,
@@ -574,8 +622,7 @@ void Validator::PreCallRecordCmdTraceRaysNV(VkCommandBuffer commandBuffer, VkBuf
 
     CommandResources cmd_resources =
         AllocateActionCommandResources(commandBuffer, VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR, record_obj.location);
-    auto cmd_resources_ptr = std::make_unique<CommandResources>(cmd_resources);
-    StoreCommandResources(commandBuffer, std::move(cmd_resources_ptr), record_obj.location);
+    StoreCommandResources(commandBuffer, cmd_resources, record_obj.location);
 }
 
 void Validator::PreCallRecordCmdTraceRaysKHR(VkCommandBuffer commandBuffer,
@@ -589,8 +636,7 @@ void Validator::PreCallRecordCmdTraceRaysKHR(VkCommandBuffer commandBuffer,
 
     CommandResources cmd_resources =
         AllocateActionCommandResources(commandBuffer, VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR, record_obj.location);
-    auto cmd_resources_ptr = std::make_unique<CommandResources>(cmd_resources);
-    StoreCommandResources(commandBuffer, std::move(cmd_resources_ptr), record_obj.location);
+    StoreCommandResources(commandBuffer, cmd_resources, record_obj.location);
 }
 
 void Validator::PreCallRecordCmdTraceRaysIndirectKHR(VkCommandBuffer commandBuffer,
@@ -613,8 +659,7 @@ void Validator::PreCallRecordCmdTraceRaysIndirect2KHR(VkCommandBuffer commandBuf
 
     CommandResources cmd_resources =
         AllocateActionCommandResources(commandBuffer, VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR, record_obj.location);
-    auto cmd_resources_ptr = std::make_unique<CommandResources>(cmd_resources);
-    StoreCommandResources(commandBuffer, std::move(cmd_resources_ptr), record_obj.location);
+    StoreCommandResources(commandBuffer, cmd_resources, record_obj.location);
 }
 
 }  // namespace gpuav
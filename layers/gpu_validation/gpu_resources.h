@@ -17,11 +17,18 @@
 
 #pragma once
 
+#include <array>
+#include <memory>
+#include <mutex>
+#include <typeinfo>
+#include <vector>
+
+#include "utils/hash_util.h"
 #include "vma/vma.h"
 
 namespace gpuav {
 class Validator;
-struct DescBindingInfo;
+class CommandBuffer;
 
 struct DeviceMemoryBlock {
     VkBuffer buffer = VK_NULL_HANDLE;
@@ -36,6 +43,60 @@ struct DeviceMemoryBlock {
     bool IsNull() { return buffer == VK_NULL_HANDLE; }
 };
 
+// Resources every command buffer needs to be validated. Creating them takes several VMA allocations and a descriptor set
+// allocation, so they are recycled through CommandBufferResourcesPool instead of being destroyed with the command buffer.
+struct CommandBufferResources {
+    // Buffer storing GPU-AV errors
+    DeviceMemoryBlock error_output_buffer = {};
+    // Buffer storing an error count per validated commands.
+    // Used to limit the number of errors a single command can emit.
+    DeviceMemoryBlock cmd_errors_counts_buffer = {};
+    // Both buffers are host coherent and stay mapped as long as the resources live
+    uint32_t *error_output_buffer_ptr = nullptr;
+    uint32_t *cmd_errors_counts_buffer_ptr = nullptr;
+    // Buffer storing a snapshot of buffer device address ranges
+    DeviceMemoryBlock bda_ranges_snapshot = {};
+    // Bindings: {error output buffer, action index, resource index, commands errors counts buffer}
+    VkDescriptorSet validation_cmd_desc_set = VK_NULL_HANDLE;
+    VkDescriptorPool validation_cmd_desc_pool = VK_NULL_HANDLE;
+
+    static VkDeviceSize GetCmdErrorsCountsBufferByteSize() { return 8192 * sizeof(uint32_t); }
+    static VkDeviceSize GetBdaRangesBufferByteSize(const Validator &validator);
+
+    void ClearCmdErrorsCountsBuffer() const;
+    void Destroy(Validator &validator);
+};
+
+// Device wide pool of CommandBufferResources. A command buffer acquires its resources when it is allocated or reset, and
+// releases them when it is reset or destroyed, which is only allowed once its submissions are retired.
+// Released resources are handed out as they are: processing a submission already clears the error output and errors
+// counts buffers, and a command buffer always updates its BDA ranges snapshot before its first submission.
+class CommandBufferResourcesPool {
+  public:
+    // Return false if the resources could not be created, GPU-AV is then aborted
+    [[nodiscard]] bool Acquire(Validator &validator, CommandBufferResources &out_resources, const Location &loc);
+    void Release(Validator &validator, CommandBufferResources &resources);
+    // Destroys the pooled resources and the descriptor set layouts, resources released afterwards are destroyed right away
+    void Destroy(Validator &validator);
+
+    // Only valid once resources have been acquired
+    VkDescriptorSetLayout GetInstrumentationDescriptorSetLayout() const { return instrumentation_desc_set_layout_; }
+    VkDescriptorSetLayout GetValidationCmdDescriptorSetLayout() const { return validation_cmd_desc_set_layout_; }
+
+  private:
+    [[nodiscard]] bool CreateDescriptorSetLayouts(Validator &validator, const Location &loc);
+    [[nodiscard]] bool CreateResources(Validator &validator, CommandBufferResources &out_resources, const Location &loc);
+
+    // Resources released past this count are destroyed, so that a burst of command buffers does not hold onto memory
+    static constexpr size_t kMaxFreeResources = 256;
+
+    std::mutex lock_;
+    std::vector<CommandBufferResources> free_resources_;
+    VkDescriptorSetLayout instrumentation_desc_set_layout_ = VK_NULL_HANDLE;
+    VkDescriptorSetLayout validation_cmd_desc_set_layout_ = VK_NULL_HANDLE;
+    bool destroyed_ = false;
+};
+
 // Every recorded action command needs the validation resources listed in this function
 // If adding validation for a new command reveals the need to allocate specific resources for it, create a new class that derives
 // from this one
@@ -48,7 +109,7 @@ class CommandResources {
     CommandResources &operator=(const CommandResources &) = default;
 
     // Return iff an error was logged
-    bool LogValidationMessage(Validator &validator, VkQueue queue, VkCommandBuffer cmd_buffer, uint32_t *error_record,
+    bool LogValidationMessage(Validator &validator, VkQueue queue, const CommandBuffer &cmd_buffer, uint32_t *error_record,
                               const uint32_t operation_index, const LogObjectList &objlist);
     // Return iff an error was logged
     virtual bool LogCustomValidationMessage(Validator &validator, const uint32_t *error_record, const uint32_t operation_index,
@@ -67,8 +128,53 @@ class CommandResources {
     bool uses_robustness = false;  // Only used in AnalyseAndeGenerateMessages, to output using LogWarning instead of LogError. It needs to be removed
     bool uses_shader_object = false;       // Some VU are dependent if used with pipeline or shader object
     vvl::Func command = vvl::Func::Empty;  // Should probably use Location instead
-    uint32_t desc_binding_index = vvl::kU32Max;// desc_binding is only used to help generate an error message
-    std::vector<DescBindingInfo> *desc_binding_list = nullptr;
+    uint32_t desc_binding_index = vvl::kU32Max;// CommandBuffer::di_input_buffer_list index, only used to generate error messages
+};
+
+// Resources of the validated commands of a command buffer, indexed by the resource index the validation shaders write in
+// error records. Nearly all commands only need CommandResources, those are stored by value in chunks that are kept across
+// command buffer resets, so recording them does not allocate. Resources of the other commands stay heap allocated.
+class CommandResourcesList {
+  public:
+    void Add(const CommandResources &resources) {
+        if (plain_count_ == chunks_.size() * kChunkSize) {
+            chunks_.emplace_back(std::make_unique<std::array<CommandResources, kChunkSize>>());
+        }
+        (*chunks_[plain_count_ / kChunkSize])[plain_count_ % kChunkSize] = resources;
+        entries_.emplace_back(plain_count_++);
+    }
+    void Add(std::unique_ptr<CommandResources> resources) {
+        if (!resources) return;
+        if (typeid(*resources) == typeid(CommandResources)) {
+            Add(*resources);
+            return;
+        }
+        entries_.emplace_back(kDerivedBit | static_cast<uint32_t>(derived_.size()));
+        derived_.emplace_back(std::move(resources));
+    }
+
+    size_t size() const { return entries_.size(); }
+    bool empty() const { return entries_.empty(); }
+    CommandResources &operator[](size_t index) {
+        const uint32_t entry = entries_[index];
+        if (entry & kDerivedBit) {
+            return *derived_[entry & ~kDerivedBit];
+        }
+        return (*chunks_[entry / kChunkSize])[entry % kChunkSize];
+    }
+
+    // Destroys all the resources and empties the list, the chunks are kept for the next recording
+    void Destroy(Validator &validator);
+
+  private:
+    static constexpr uint32_t kChunkSize = 64;
+    static constexpr uint32_t kDerivedBit = 1u << 31;
+
+    // Index in the chunks, or in derived_ if kDerivedBit is set
+    std::vector<uint32_t> entries_;
+    std::vector<std::unique_ptr<std::array<CommandResources, kChunkSize>>> chunks_;
+    uint32_t plain_count_ = 0;
+    std::vector<std::unique_ptr<CommandResources>> derived_;
 };
 
 struct SharedValidationResources {
@@ -94,6 +200,17 @@ class PreDrawResources : public CommandResources {
     bool LogCustomValidationMessage(Validator &validator, const uint32_t *error_record, const uint32_t operation_index,
                                     const LogObjectList &objlist);
 
+    // Buffers bound by the descriptor set of a validation draw
+    struct BufferDescSetKey {
+        VkBuffer indirect_buffer = VK_NULL_HANDLE;
+        VkBuffer count_buffer = VK_NULL_HANDLE;
+
+        bool operator==(const BufferDescSetKey &other) const {
+            return indirect_buffer == other.indirect_buffer && count_buffer == other.count_buffer;
+        }
+        size_t hash() const { return hash_util::HashCombiner().Combine(indirect_buffer).Combine(count_buffer).Value(); }
+    };
+
     struct SharedResources : SharedValidationResources {
         VkShaderModule shader_module = VK_NULL_HANDLE;
         VkDescriptorSetLayout ds_layout = VK_NULL_HANDLE;
@@ -18,17 +18,26 @@
 #pragma once
 // Default values for those settings should match layers/VkLayer_khronos_validation.json.in
 
+#include <cstring>
+#include <string>
+#include <vector>
+#include <vulkan/vulkan.h>
 #include "generated/gpu_inst_shader_hash.h"
 
 struct GpuAVSettings {
     bool shader_instrumentation_enabled = true;
     bool validate_descriptors = true;
     bool warn_on_robust_oob = true;
+    bool elide_static_descriptor_checks = false;
     bool validate_bda = true;
     uint32_t max_bda_in_use = 10000;
     bool validate_ray_query = true;
     bool cache_instrumented_shaders = true;
     bool select_instrumented_shaders = false;
+    // Filters restricting shader instrumentation, a shader is instrumented if it passes all the filters that are set
+    std::vector<uint32_t> instrumented_shader_hashes;   // hash_util::ShaderHash of the SPIR-V, the shader id in the dumps
+    std::vector<std::string> instrumented_shader_names;  // debug name of one of the shader modules of the pipeline
+    uint32_t instrumented_shader_sampling_rate = 0;      // instrument 1 shader in N, 0 and 1 instrument all of them
 
     bool buffers_validation_enabled = true;
     bool validate_indirect_draws_buffers = true;
@@ -37,6 +46,10 @@ struct GpuAVSettings {
     bool validate_buffer_copies = true;
 
     bool vma_linear_output = true;
+    uint32_t memory_budget = 0;  // In MiB, per memory heap used by GPU-AV, 0 for no limit
+    bool report_memory_usage = false;
+    bool overlapped_error_readback = false;
+    bool report_overhead = false;
 
     bool debug_validate_instrumented_shaders = false;
     bool debug_dump_instrumented_shaders = false;
@@ -46,11 +59,18 @@ struct GpuAVSettings {
     void DisableShaderInstrumentationAndOptions() {
         validate_descriptors = false;
         warn_on_robust_oob = false;
+        elide_static_descriptor_checks = false;
         validate_bda = false;
         validate_ray_query = false;
         // Because of those 2 settings, cannot really have an "enabled" parameter to pass to this method
         cache_instrumented_shaders = false;
         select_instrumented_shaders = false;
+        instrumented_shader_hashes.clear();
+        instrumented_shader_names.clear();
+        instrumented_shader_sampling_rate = 0;
+    }
+    bool HasInstrumentedShaderFilters() const {
+        return !instrumented_shader_hashes.empty() || !instrumented_shader_names.empty() || instrumented_shader_sampling_rate > 1;
     }
     bool IsBufferValidationEnabled() const {
         return validate_indirect_draws_buffers || validate_indirect_dispatches_buffers || validate_indirect_trace_rays_buffers ||
@@ -65,15 +85,48 @@ struct GpuAVSettings {
 };
 
 #pragma pack(push, 1)
+// Header of the instrumented shader cache file, a cache written with other settings or by another version of the layer
+// (the instrumentation passes may have changed) is ignored. Only the settings changing the instrumented code are part of
+// it, the shader filters only decide which shaders are instrumented.
 struct ShaderCacheHash {
-    ShaderCacheHash(const GpuAVSettings& gpuav_settings) : gpuav_settings(gpuav_settings) {}
-    GpuAVSettings gpuav_settings{};
+    ShaderCacheHash(const GpuAVSettings& gpuav_settings)
+        : validate_descriptors(gpuav_settings.validate_descriptors),
+          warn_on_robust_oob(gpuav_settings.warn_on_robust_oob),
+          elide_static_descriptor_checks(gpuav_settings.elide_static_descriptor_checks),
+          validate_bda(gpuav_settings.validate_bda),
+          max_bda_in_use(gpuav_settings.max_bda_in_use),
+          validate_ray_query(gpuav_settings.validate_ray_query) {}
+    bool validate_descriptors;
+    bool warn_on_robust_oob;
+    bool elide_static_descriptor_checks;
+    bool validate_bda;
+    uint32_t max_bda_in_use;
+    bool validate_ray_query;
+    const char inst_shader_git_hash[sizeof(INST_SHADER_GIT_HASH)] = INST_SHADER_GIT_HASH;
+    const uint32_t layer_version = VK_HEADER_VERSION_COMPLETE;
+};
+
+// Header of the internal pipeline cache file. VkPipelineCache data written by another driver, or for other internal
+// validation shaders, is dropped before it reaches the driver.
+struct InternalPipelineCacheHeader {
+    InternalPipelineCacheHeader(const VkPhysicalDeviceProperties& props)
+        : vendor_id(props.vendorID), device_id(props.deviceID), driver_version(props.driverVersion) {
+        std::memcpy(pipeline_cache_uuid, props.pipelineCacheUUID, VK_UUID_SIZE);
+    }
+    uint32_t vendor_id;
+    uint32_t device_id;
+    uint32_t driver_version;
+    uint8_t pipeline_cache_uuid[VK_UUID_SIZE];
     const char inst_shader_git_hash[sizeof(INST_SHADER_GIT_HASH)] = INST_SHADER_GIT_HASH;
+    const uint32_t layer_version = VK_HEADER_VERSION_COMPLETE;
 };
 #pragma pack(pop)
 
 struct DebugPrintfSettings {
     bool to_stdout = false;
     bool verbose = false;
+    bool deduplicate = false;
     uint32_t buffer_size = 1024;
+    uint32_t max_messages = 0;  // Per action command, 0 for no limit
+    std::string output_file;    // Empty to report the messages through the debug callbacks
 };
\ No newline at end of file
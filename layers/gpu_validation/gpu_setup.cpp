@@ -16,6 +16,7 @@
  */
 
 #include <cmath>
+#include <cstring>
 #include <fstream>
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
 #include <unistd.h>
@@ -42,41 +43,96 @@
 
 namespace gpuav {
 
+// Reads the shaders of a cache file written by PreCallRecordDestroyDevice. The file is ignored if it was written with other
+// settings or by another version of the layer, and reading stops at the first shader that doesn't fit in the file.
+static void LoadInstrumentedShaderCache(
+    const GpuAVSettings &gpuav_settings, const std::vector<char> &file_data,
+    vvl::unordered_map<uint32_t, std::pair<size_t, std::vector<uint32_t>>> &instrumented_shaders) {
+    const ShaderCacheHash shader_cache_hash(gpuav_settings);
+    size_t offset = sizeof(shader_cache_hash) + sizeof(uint32_t);
+    if (file_data.size() < offset ||
+        std::memcmp(file_data.data(), reinterpret_cast<const char *>(&shader_cache_hash), sizeof(shader_cache_hash)) != 0) {
+        return;
+    }
+    uint32_t num_shaders = 0;
+    std::memcpy(&num_shaders, file_data.data() + sizeof(shader_cache_hash), sizeof(uint32_t));
+    instrumented_shaders.reserve(num_shaders);
+    for (uint32_t i = 0; i < num_shaders; ++i) {
+        uint32_t hash = 0;
+        uint32_t shader_length = 0;
+        if (file_data.size() - offset < 2 * sizeof(uint32_t)) {
+            return;
+        }
+        std::memcpy(&hash, file_data.data() + offset, sizeof(uint32_t));
+        std::memcpy(&shader_length, file_data.data() + offset + sizeof(uint32_t), sizeof(uint32_t));
+        offset += 2 * sizeof(uint32_t);
+        if ((file_data.size() - offset) / sizeof(uint32_t) < shader_length) {
+            return;
+        }
+        std::vector<uint32_t> shader_code(shader_length);
+        std::memcpy(shader_code.data(), file_data.data() + offset, shader_length * sizeof(uint32_t));
+        offset += shader_length * sizeof(uint32_t);
+        instrumented_shaders.emplace(hash, std::make_pair(shader_length, std::move(shader_code)));
+    }
+}
+
+// The GPU-AV caches are shared by all the processes of the user, in the temp directory like the shader validation cache
+static std::string GetCacheFilePath(const char *name) {
+    std::string path = GetTempFilePath() + "/" + name;
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+    path += "-" + std::to_string(getuid());
+#endif
+    path += ".bin";
+    return path;
+}
+
+static bool ReadCacheFile(const std::string &path, std::vector<char> &file_data) {
+    // The whole file is read at once, a title can have tens of thousands of shaders in it
+    std::ifstream file_stream(path, std::ifstream::in | std::ifstream::binary | std::ifstream::ate);
+    if (!file_stream) {
+        return false;
+    }
+    const std::streamoff file_size = file_stream.tellg();
+    file_data.resize(file_size > 0 ? static_cast<size_t>(file_size) : 0);
+    file_stream.seekg(0);
+    return static_cast<bool>(file_stream.read(file_data.data(), file_data.size()));
+}
+
 std::shared_ptr<vvl::Buffer> Validator::CreateBufferState(VkBuffer handle, const VkBufferCreateInfo *pCreateInfo) {
-    return std::make_shared<Buffer>(*this, handle, pCreateInfo, *desc_heap);
+    return vvl::MakeState<Buffer>(*this, handle, pCreateInfo, *desc_heap);
 }
 
 std::shared_ptr<vvl::BufferView> Validator::CreateBufferViewState(const std::shared_ptr<vvl::Buffer> &bf, VkBufferView bv,
                                                                   const VkBufferViewCreateInfo *ci,
                                                                   VkFormatFeatureFlags2KHR buf_ff) {
-    return std::make_shared<BufferView>(bf, bv, ci, buf_ff, *desc_heap);
+    return vvl::MakeState<BufferView>(bf, bv, ci, buf_ff, *desc_heap);
 }
 
 std::shared_ptr<vvl::ImageView> Validator::CreateImageViewState(const std::shared_ptr<vvl::Image> &image_state, VkImageView iv,
                                                                 const VkImageViewCreateInfo *ci, VkFormatFeatureFlags2KHR ff,
                                                                 const VkFilterCubicImageViewImageFormatPropertiesEXT &cubic_props) {
-    return std::make_shared<ImageView>(image_state, iv, ci, ff, cubic_props, *desc_heap);
+    return vvl::MakeState<ImageView>(image_state, iv, ci, ff, cubic_props, *desc_heap);
 }
 
 std::shared_ptr<vvl::Sampler> Validator::CreateSamplerState(VkSampler s, const VkSamplerCreateInfo *ci) {
-    return std::make_shared<Sampler>(s, ci, *desc_heap);
+    return vvl::MakeState<Sampler>(s, ci, *desc_heap);
 }
 
 std::shared_ptr<vvl::DescriptorSet> Validator::CreateDescriptorSet(VkDescriptorSet set, vvl::DescriptorPool *pool,
                                                                    const std::shared_ptr<vvl::DescriptorSetLayout const> &layout,
                                                                    uint32_t variable_count) {
-    return std::static_pointer_cast<vvl::DescriptorSet>(std::make_shared<DescriptorSet>(set, pool, layout, variable_count, this));
+    return std::static_pointer_cast<vvl::DescriptorSet>(vvl::MakeState<DescriptorSet>(set, pool, layout, variable_count, this));
 }
 
 std::shared_ptr<vvl::CommandBuffer> Validator::CreateCmdBufferState(VkCommandBuffer handle,
                                                                     const VkCommandBufferAllocateInfo *pCreateInfo,
                                                                     const vvl::CommandPool *pool) {
-    return std::static_pointer_cast<vvl::CommandBuffer>(std::make_shared<CommandBuffer>(*this, handle, pCreateInfo, pool));
+    return std::static_pointer_cast<vvl::CommandBuffer>(vvl::MakeState<CommandBuffer>(*this, handle, pCreateInfo, pool));
 }
 
 std::shared_ptr<vvl::Queue> Validator::CreateQueue(VkQueue q, uint32_t index, VkDeviceQueueCreateFlags flags,
                                                    const VkQueueFamilyProperties &queueFamilyProperties) {
-    return std::static_pointer_cast<vvl::Queue>(std::make_shared<Queue>(*this, q, index, flags, queueFamilyProperties));
+    return std::static_pointer_cast<vvl::Queue>(vvl::MakeState<Queue>(*this, q, index, flags, queueFamilyProperties));
 }
 
 // Perform initializations that can be done at Create Device time.
@@ -185,6 +241,35 @@ void Validator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Locati
                    "attempted");
     }
 
+    // Device lifetime allocations (descriptor heap, command indices) get their own pool, they are never freed before the
+    // device is destroyed and would otherwise pin blocks of the per command buffer pool
+    {
+        VkBufferCreateInfo persistent_buffer_create_info = vku::InitStructHelper();
+        persistent_buffer_create_info.size = glsl::kErrorBufferByteSize;
+        persistent_buffer_create_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+        if (force_buffer_device_address) {
+            persistent_buffer_create_info.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+        }
+        VmaAllocationCreateInfo persistent_alloc_create_info = {};
+        persistent_alloc_create_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+        uint32_t persistent_mem_type_index;
+        VkResult result = vmaFindMemoryTypeIndexForBufferInfo(vmaAllocator, &persistent_buffer_create_info,
+                                                              &persistent_alloc_create_info, &persistent_mem_type_index);
+        if (result != VK_SUCCESS) {
+            ReportSetupProblem(device, loc, "Unable to find memory type index");
+            aborted = true;
+            return;
+        }
+        VmaPoolCreateInfo persistent_pool_create_info = {};
+        persistent_pool_create_info.memoryTypeIndex = persistent_mem_type_index;
+        result = vmaCreatePool(vmaAllocator, &persistent_pool_create_info, &persistent_buffer_pool);
+        if (result != VK_SUCCESS) {
+            ReportSetupProblem(device, loc, "Unable to create VMA memory pool");
+            aborted = true;
+            return;
+        }
+    }
+
     if (gpuav_settings.validate_descriptors) {
         VkPhysicalDeviceDescriptorIndexingProperties desc_indexing_props = vku::InitStructHelper();
         VkPhysicalDeviceProperties2 props2 = vku::InitStructHelper(&desc_indexing_props);
@@ -226,33 +311,28 @@ void Validator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Locati
     }
 
     if (gpuav_settings.cache_instrumented_shaders) {
-        auto tmp_path = GetTempFilePath();
-        instrumented_shader_cache_path = tmp_path + "/instrumented_shader_cache";
-#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
-        instrumented_shader_cache_path += "-" + std::to_string(getuid());
-#endif
-        instrumented_shader_cache_path += ".bin";
-
-        std::ifstream file_stream(instrumented_shader_cache_path, std::ifstream::in | std::ifstream::binary);
-        if (file_stream) {
-            ShaderCacheHash shader_cache_hash(gpuav_settings);
-            char inst_shader_hash[sizeof(shader_cache_hash)];
-            file_stream.read(inst_shader_hash, sizeof(inst_shader_hash));
-            if (std::memcmp(inst_shader_hash, reinterpret_cast<char *>(&shader_cache_hash), sizeof(shader_cache_hash)) == 0) {
-                uint32_t num_shaders = 0;
-                file_stream.read(reinterpret_cast<char *>(&num_shaders), sizeof(uint32_t));
-                for (uint32_t i = 0; i < num_shaders; ++i) {
-                    uint32_t hash;
-                    uint32_t shader_length;
-                    std::vector<uint32_t> shader_code;
-                    file_stream.read(reinterpret_cast<char *>(&hash), sizeof(uint32_t));
-                    file_stream.read(reinterpret_cast<char *>(&shader_length), sizeof(uint32_t));
-                    shader_code.resize(shader_length);
-                    file_stream.read(reinterpret_cast<char *>(shader_code.data()), 4 * shader_length);
-                    instrumented_shaders.emplace(hash, std::make_pair(shader_length, std::move(shader_code)));
-                }
-            }
-            file_stream.close();
+        instrumented_shader_cache_path = GetCacheFilePath("instrumented_shader_cache");
+        std::vector<char> file_data;
+        if (ReadCacheFile(instrumented_shader_cache_path, file_data)) {
+            LoadInstrumentedShaderCache(gpuav_settings, file_data, instrumented_shaders);
+        }
+
+        // The internal validation pipelines are the same for every application, the driver only compiles them once per
+        // driver version. Their cache is written back by PreCallRecordDestroyDevice.
+        internal_pipeline_cache_path = GetCacheFilePath("gpuav_pipeline_cache");
+        file_data.clear();
+        const InternalPipelineCacheHeader header(phys_dev_props);
+        VkPipelineCacheCreateInfo pipeline_cache_ci = vku::InitStructHelper();
+        if (ReadCacheFile(internal_pipeline_cache_path, file_data) && file_data.size() > sizeof(header) &&
+            std::memcmp(file_data.data(), reinterpret_cast<const char *>(&header), sizeof(header)) == 0) {
+            pipeline_cache_ci.initialDataSize = file_data.size() - sizeof(header);
+            pipeline_cache_ci.pInitialData = file_data.data() + sizeof(header);
+        }
+        if (DispatchCreatePipelineCache(device, &pipeline_cache_ci, nullptr, &internal_pipeline_cache) == VK_SUCCESS) {
+            internal_pipeline_cache_loaded_size = pipeline_cache_ci.initialDataSize;
+        } else {
+            // The pipelines are still created, only without a cache
+            internal_pipeline_cache = VK_NULL_HANDLE;
         }
     }
 
@@ -262,8 +342,8 @@ void Validator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Locati
         buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
         buffer_info.size = cst::indices_count * sizeof(uint32_t);
         VmaAllocationCreateInfo alloc_info = {};
-        assert(output_buffer_pool);
-        alloc_info.pool = output_buffer_pool;
+        assert(persistent_buffer_pool);
+        alloc_info.pool = persistent_buffer_pool;
         alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
         result =
             vmaCreateBuffer(vmaAllocator, &buffer_info, &alloc_info, &indices_buffer.buffer, &indices_buffer.allocation, nullptr);
@@ -455,6 +535,265 @@ void RestorablePipelineState::Restore(VkCommandBuffer command_buffer) const {
     }
 }
 
+VkDeviceSize CommandBufferResources::GetBdaRangesBufferByteSize(const Validator &validator) {
+    return (1                                              // 1 QWORD for the number of address ranges
+            + 2 * validator.gpuav_settings.max_bda_in_use  // 2 QWORDS per address range
+            ) *
+           8;
+}
+
+void CommandBufferResources::ClearCmdErrorsCountsBuffer() const {
+    assert(cmd_errors_counts_buffer_ptr);
+    std::memset(cmd_errors_counts_buffer_ptr, 0, static_cast<size_t>(GetCmdErrorsCountsBufferByteSize()));
+}
+
+void CommandBufferResources::Destroy(Validator &validator) {
+    if (error_output_buffer_ptr) {
+        vmaUnmapMemory(validator.vmaAllocator, error_output_buffer.allocation);
+        error_output_buffer_ptr = nullptr;
+    }
+    if (cmd_errors_counts_buffer_ptr) {
+        vmaUnmapMemory(validator.vmaAllocator, cmd_errors_counts_buffer.allocation);
+        cmd_errors_counts_buffer_ptr = nullptr;
+    }
+    error_output_buffer.Destroy(validator.vmaAllocator);
+    cmd_errors_counts_buffer.Destroy(validator.vmaAllocator);
+    bda_ranges_snapshot.Destroy(validator.vmaAllocator);
+    if (validation_cmd_desc_set != VK_NULL_HANDLE) {
+        validator.desc_set_manager->PutBackDescriptorSet(validation_cmd_desc_pool, validation_cmd_desc_set);
+        validation_cmd_desc_set = VK_NULL_HANDLE;
+        validation_cmd_desc_pool = VK_NULL_HANDLE;
+    }
+}
+
+bool CommandBufferResourcesPool::Acquire(Validator &validator, CommandBufferResources &out_resources, const Location &loc) {
+    std::unique_lock<std::mutex> guard(lock_);
+    if (!free_resources_.empty()) {
+        out_resources = free_resources_.back();
+        free_resources_.pop_back();
+        return true;
+    }
+    if (!CreateDescriptorSetLayouts(validator, loc)) {
+        return false;
+    }
+    guard.unlock();
+
+    if (!CreateResources(validator, out_resources, loc)) {
+        out_resources.Destroy(validator);
+        return false;
+    }
+    return true;
+}
+
+void CommandBufferResourcesPool::Release(Validator &validator, CommandBufferResources &resources) {
+    if (resources.error_output_buffer.IsNull()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (!destroyed_ && !validator.aborted && free_resources_.size() < kMaxFreeResources) {
+            free_resources_.emplace_back(resources);
+            resources = {};
+            return;
+        }
+    }
+    resources.Destroy(validator);
+}
+
+void CommandBufferResourcesPool::Destroy(Validator &validator) {
+    std::lock_guard<std::mutex> guard(lock_);
+    for (CommandBufferResources &resources : free_resources_) {
+        resources.Destroy(validator);
+    }
+    free_resources_.clear();
+    // Descriptor sets allocated with the layouts can still be freed once they are destroyed
+    if (instrumentation_desc_set_layout_ != VK_NULL_HANDLE) {
+        DispatchDestroyDescriptorSetLayout(validator.device, instrumentation_desc_set_layout_, nullptr);
+        instrumentation_desc_set_layout_ = VK_NULL_HANDLE;
+    }
+    if (validation_cmd_desc_set_layout_ != VK_NULL_HANDLE) {
+        DispatchDestroyDescriptorSetLayout(validator.device, validation_cmd_desc_set_layout_, nullptr);
+        validation_cmd_desc_set_layout_ = VK_NULL_HANDLE;
+    }
+    destroyed_ = true;
+}
+
+static const std::array<VkDescriptorSetLayoutBinding, 4> kValidationCmdBindings = {{
+    // Error output buffer
+    {glsl::kBindingDiagErrorBuffer, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+    // Buffer holding action command index in command buffer
+    {glsl::kBindingDiagActionIndex, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1, VK_SHADER_STAGE_ALL, nullptr},
+    // Buffer holding a resource index from the per command buffer command resources list
+    {glsl::kBindingDiagCmdResourceIndex, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1, VK_SHADER_STAGE_ALL, nullptr},
+    // Commands errors counts buffer
+    {glsl::kBindingDiagCmdErrorsCount, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+}};
+
+bool CommandBufferResourcesPool::CreateDescriptorSetLayouts(Validator &validator, const Location &loc) {
+    // Instrumentation descriptor set layout
+    if (instrumentation_desc_set_layout_ == VK_NULL_HANDLE) {
+        assert(!validator.validation_bindings_.empty());
+        VkDescriptorSetLayoutCreateInfo instrumentation_desc_set_layout_ci = vku::InitStructHelper();
+        instrumentation_desc_set_layout_ci.bindingCount = static_cast<uint32_t>(validator.validation_bindings_.size());
+        instrumentation_desc_set_layout_ci.pBindings = validator.validation_bindings_.data();
+        VkResult result = DispatchCreateDescriptorSetLayout(validator.device, &instrumentation_desc_set_layout_ci, nullptr,
+                                                            &instrumentation_desc_set_layout_);
+        if (result != VK_SUCCESS) {
+            validator.ReportSetupProblem(validator.device, loc,
+                                         "Unable to create instrumentation descriptor set layout. Aborting GPU-AV");
+            validator.aborted = true;
+            return false;
+        }
+    }
+
+    // Validation commands common descriptor set layout
+    if (validation_cmd_desc_set_layout_ == VK_NULL_HANDLE) {
+        VkDescriptorSetLayoutCreateInfo validation_cmd_desc_set_layout_ci = vku::InitStructHelper();
+        validation_cmd_desc_set_layout_ci.bindingCount = static_cast<uint32_t>(kValidationCmdBindings.size());
+        validation_cmd_desc_set_layout_ci.pBindings = kValidationCmdBindings.data();
+        VkResult result = DispatchCreateDescriptorSetLayout(validator.device, &validation_cmd_desc_set_layout_ci, nullptr,
+                                                            &validation_cmd_desc_set_layout_);
+        if (result != VK_SUCCESS) {
+            validator.ReportSetupProblem(validator.device, loc,
+                                         "Unable to create descriptor set layout used for validation commands. Aborting GPU-AV");
+            validator.aborted = true;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CommandBufferResourcesPool::CreateResources(Validator &validator, CommandBufferResources &out_resources,
+                                                 const Location &loc) {
+    // Error output buffer
+    if (!validator.AllocateOutputMem(out_resources.error_output_buffer, loc)) {
+        return false;
+    }
+    VkResult result = vmaMapMemory(validator.vmaAllocator, out_resources.error_output_buffer.allocation,
+                                   reinterpret_cast<void **>(&out_resources.error_output_buffer_ptr));
+    if (result != VK_SUCCESS) {
+        out_resources.error_output_buffer_ptr = nullptr;
+        validator.ReportSetupProblem(validator.device, loc,
+                                     "Unable to map device memory allocated for error output buffer. Device could become unstable.",
+                                     true);
+        validator.aborted = true;
+        return false;
+    }
+
+    // Commands errors counts buffer
+    {
+        VkBufferCreateInfo buffer_info = vku::InitStructHelper();
+        buffer_info.size = CommandBufferResources::GetCmdErrorsCountsBufferByteSize();
+        buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+        VmaAllocationCreateInfo alloc_info = {};
+        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+        alloc_info.pool = validator.output_buffer_pool;
+        result = vmaCreateBuffer(validator.vmaAllocator, &buffer_info, &alloc_info, &out_resources.cmd_errors_counts_buffer.buffer,
+                                 &out_resources.cmd_errors_counts_buffer.allocation, nullptr);
+        if (result != VK_SUCCESS) {
+            validator.ReportSetupProblem(
+                validator.device, loc,
+                "Unable to allocate device memory for commands errors counts buffer. Device could become unstable.", true);
+            validator.aborted = true;
+            return false;
+        }
+
+        result = vmaMapMemory(validator.vmaAllocator, out_resources.cmd_errors_counts_buffer.allocation,
+                              reinterpret_cast<void **>(&out_resources.cmd_errors_counts_buffer_ptr));
+        if (result != VK_SUCCESS) {
+            out_resources.cmd_errors_counts_buffer_ptr = nullptr;
+            validator.ReportSetupProblem(
+                validator.device, loc,
+                "Unable to map device memory for commands errors counts buffer. Device could become unstable.", true);
+            validator.aborted = true;
+            return false;
+        }
+        out_resources.ClearCmdErrorsCountsBuffer();
+    }
+
+    // BDA snapshot
+    if (validator.gpuav_settings.validate_bda) {
+        VkBufferCreateInfo buffer_info = vku::InitStructHelper();
+        buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+        VmaAllocationCreateInfo alloc_info = {};
+        buffer_info.size = CommandBufferResources::GetBdaRangesBufferByteSize(validator);
+        // This buffer could be very large if an application uses many buffers. Allocating it as HOST_CACHED
+        // and manually flushing it at the end of the state updates is faster than using HOST_COHERENT.
+        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+        result = vmaCreateBuffer(validator.vmaAllocator, &buffer_info, &alloc_info, &out_resources.bda_ranges_snapshot.buffer,
+                                 &out_resources.bda_ranges_snapshot.allocation, nullptr);
+        if (result != VK_SUCCESS) {
+            validator.ReportSetupProblem(
+                validator.device, loc,
+                "Unable to allocate device memory for buffer device address data. Device could become unstable.", true);
+            validator.aborted = true;
+            return false;
+        }
+    }
+
+    // Validation commands common descriptor set, it only references buffers living as long as the resources
+    {
+        result = validator.desc_set_manager->GetDescriptorSet(
+            &out_resources.validation_cmd_desc_pool, validation_cmd_desc_set_layout_, &out_resources.validation_cmd_desc_set);
+        if (result != VK_SUCCESS) {
+            validator.ReportSetupProblem(validator.device, loc,
+                                         "Unable to create descriptor set used for validation commands. Aborting GPU-AV");
+            validator.aborted = true;
+            return false;
+        }
+
+        std::array<VkWriteDescriptorSet, 4> validation_cmd_descriptor_writes = {};
+        assert(kValidationCmdBindings.size() == validation_cmd_descriptor_writes.size());
+
+        VkDescriptorBufferInfo error_output_buffer_desc_info = {};
+
+        assert(out_resources.error_output_buffer.buffer != VK_NULL_HANDLE);
+        error_output_buffer_desc_info.buffer = out_resources.error_output_buffer.buffer;
+        error_output_buffer_desc_info.offset = 0;
+        error_output_buffer_desc_info.range = VK_WHOLE_SIZE;
+
+        validation_cmd_descriptor_writes[0] = vku::InitStructHelper();
+        validation_cmd_descriptor_writes[0].dstBinding = glsl::kBindingDiagErrorBuffer;
+        validation_cmd_descriptor_writes[0].descriptorCount = 1;
+        validation_cmd_descriptor_writes[0].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        validation_cmd_descriptor_writes[0].pBufferInfo = &error_output_buffer_desc_info;
+        validation_cmd_descriptor_writes[0].dstSet = out_resources.validation_cmd_desc_set;
+
+        VkDescriptorBufferInfo cmd_indices_buffer_desc_info = {};
+
+        assert(validator.indices_buffer.buffer != VK_NULL_HANDLE);
+        cmd_indices_buffer_desc_info.buffer = validator.indices_buffer.buffer;
+        cmd_indices_buffer_desc_info.offset = 0;
+        cmd_indices_buffer_desc_info.range = sizeof(uint32_t);
+
+        validation_cmd_descriptor_writes[1] = vku::InitStructHelper();
+        validation_cmd_descriptor_writes[1].dstBinding = glsl::kBindingDiagActionIndex;
+        validation_cmd_descriptor_writes[1].descriptorCount = 1;
+        validation_cmd_descriptor_writes[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+        validation_cmd_descriptor_writes[1].pBufferInfo = &cmd_indices_buffer_desc_info;
+        validation_cmd_descriptor_writes[1].dstSet = out_resources.validation_cmd_desc_set;
+
+        validation_cmd_descriptor_writes[2] = validation_cmd_descriptor_writes[1];
+        validation_cmd_descriptor_writes[2].dstBinding = glsl::kBindingDiagCmdResourceIndex;
+
+        VkDescriptorBufferInfo cmd_errors_count_buffer_desc_info = {};
+        cmd_errors_count_buffer_desc_info.buffer = out_resources.cmd_errors_counts_buffer.buffer;
+        cmd_errors_count_buffer_desc_info.offset = 0;
+        cmd_errors_count_buffer_desc_info.range = VK_WHOLE_SIZE;
+
+        validation_cmd_descriptor_writes[3] = vku::InitStructHelper();
+        validation_cmd_descriptor_writes[3].dstBinding = glsl::kBindingDiagCmdErrorsCount;
+        validation_cmd_descriptor_writes[3].descriptorCount = 1;
+        validation_cmd_descriptor_writes[3].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        validation_cmd_descriptor_writes[3].pBufferInfo = &cmd_errors_count_buffer_desc_info;
+        validation_cmd_descriptor_writes[3].dstSet = out_resources.validation_cmd_desc_set;
+
+        DispatchUpdateDescriptorSets(validator.device, static_cast<uint32_t>(validation_cmd_descriptor_writes.size()),
+                                     validation_cmd_descriptor_writes.data(), 0, nullptr);
+    }
+    return true;
+}
+
 void CommandResources::Destroy(Validator &validator) {
     if (instrumentation_desc_set != VK_NULL_HANDLE) {
         validator.desc_set_manager->PutBackDescriptorSet(instrumentation_desc_pool, instrumentation_desc_set);
@@ -463,6 +802,18 @@ void CommandResources::Destroy(Validator &validator) {
     }
 }
 
+void CommandResourcesList::Destroy(Validator &validator) {
+    for (uint32_t i = 0; i < plain_count_; ++i) {
+        (*chunks_[i / kChunkSize])[i % kChunkSize].CommandResources::Destroy(validator);
+    }
+    for (auto &resources : derived_) {
+        resources->Destroy(validator);
+    }
+    entries_.clear();
+    plain_count_ = 0;
+    derived_.clear();
+}
+
 void PreDrawResources::Destroy(Validator &validator) {
     if (buffer_desc_set != VK_NULL_HANDLE) {
         validator.desc_set_manager->PutBackDescriptorSet(desc_pool, buffer_desc_set);
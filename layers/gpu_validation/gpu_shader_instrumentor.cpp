@@ -196,8 +196,18 @@ static VKAPI_ATTR void VKAPI_CALL gpuVkCmdCopyBuffer(VkCommandBuffer commandBuff
     DispatchCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
 }
 
+// The device memory blocks of the layer resources are counted in the GpuAssisted statistics of the layer allocator
+static VKAPI_ATTR void VKAPI_CALL gpuVmaAllocateDeviceMemory(VmaAllocator, uint32_t, VkDeviceMemory, VkDeviceSize size, void *) {
+    vvl::TrackAllocation(static_cast<size_t>(size), vvl::AllocationSubsystem::GpuAssisted);
+}
+
+static VKAPI_ATTR void VKAPI_CALL gpuVmaFreeDeviceMemory(VmaAllocator, uint32_t, VkDeviceMemory, VkDeviceSize size, void *) {
+    vvl::UntrackAllocation(static_cast<size_t>(size), vvl::AllocationSubsystem::GpuAssisted);
+}
+
+// heap_size_limit is applied to each memory heap, 0 for no limit
 VkResult UtilInitializeVma(VkInstance instance, VkPhysicalDevice physical_device, VkDevice device, bool use_buffer_device_address,
-                           VmaAllocator *pAllocator) {
+                           VkDeviceSize heap_size_limit, VmaAllocator *pAllocator) {
     VmaVulkanFunctions functions;
     VmaAllocatorCreateInfo allocator_info = {};
     allocator_info.instance = instance;
@@ -208,6 +218,15 @@ VkResult UtilInitializeVma(VkInstance instance, VkPhysicalDevice physical_device
         allocator_info.flags |= VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT;
     }
 
+    // The allocator is only used for the layer resources, so its heap limits are the layer memory budget
+    std::vector<VkDeviceSize> heap_size_limits;
+    if (heap_size_limit != 0) {
+        VkPhysicalDeviceMemoryProperties memory_props;
+        DispatchGetPhysicalDeviceMemoryProperties(physical_device, &memory_props);
+        heap_size_limits.resize(memory_props.memoryHeapCount, heap_size_limit);
+        allocator_info.pHeapSizeLimit = heap_size_limits.data();
+    }
+
     functions.vkGetInstanceProcAddr = static_cast<PFN_vkGetInstanceProcAddr>(gpuVkGetInstanceProcAddr);
     functions.vkGetDeviceProcAddr = static_cast<PFN_vkGetDeviceProcAddr>(gpuVkGetDeviceProcAddr);
     functions.vkGetPhysicalDeviceProperties = static_cast<PFN_vkGetPhysicalDeviceProperties>(gpuVkGetPhysicalDeviceProperties);
@@ -230,6 +249,9 @@ VkResult UtilInitializeVma(VkInstance instance, VkPhysicalDevice physical_device
     functions.vkCmdCopyBuffer = static_cast<PFN_vkCmdCopyBuffer>(gpuVkCmdCopyBuffer);
     allocator_info.pVulkanFunctions = &functions;
 
+    static const VmaDeviceMemoryCallbacks device_memory_callbacks = {gpuVmaAllocateDeviceMemory, gpuVmaFreeDeviceMemory, nullptr};
+    allocator_info.pDeviceMemoryCallbacks = &device_memory_callbacks;
+
     return vmaCreateAllocator(&allocator_info, pAllocator);
 }
 
@@ -395,7 +417,9 @@ void GpuShaderInstrumentor::CreateDevice(const VkDeviceCreateInfo *pCreateInfo,
 
     desc_set_bind_index = adjusted_max_desc_sets - 1;
 
-    VkResult result = UtilInitializeVma(instance, physical_device, device, force_buffer_device_address, &vmaAllocator);
+    const VkDeviceSize heap_size_limit = VkDeviceSize(gpuav_settings.memory_budget) * 1024 * 1024;
+    VkResult result =
+        UtilInitializeVma(instance, physical_device, device, force_buffer_device_address, heap_size_limit, &vmaAllocator);
     if (result != VK_SUCCESS) {
         ReportSetupProblem(device, loc, "Could not initialize VMA", true);
         aborted = true;
@@ -473,6 +497,9 @@ void GpuShaderInstrumentor::PreCallRecordDestroyDevice(VkDevice device, const Vk
     if (output_buffer_pool) {
         vmaDestroyPool(vmaAllocator, output_buffer_pool);
     }
+    if (persistent_buffer_pool) {
+        vmaDestroyPool(vmaAllocator, persistent_buffer_pool);
+    }
     if (vmaAllocator) {
         vmaDestroyAllocator(vmaAllocator);
     }
@@ -758,6 +785,26 @@ VkShaderModule GetShaderModule(const VkComputePipelineCreateInfo &create_info, V
     return create_info.stage.module;
 }
 
+// Destroy the non-instrumented shader modules PreCallRecordPipelineCreations put in place of the instrumented ones
+template <typename CreateInfo>
+void DestroyReplacedShaderModules(VkDevice device, const CreateInfo &create_info, const CreateInfo &modified_create_info,
+                                  const VkAllocationCallbacks *pAllocator) {
+    for (uint32_t i = 0; i < create_info.stageCount; ++i) {
+        if (modified_create_info.pStages[i].module != create_info.pStages[i].module) {
+            DispatchDestroyShaderModule(device, modified_create_info.pStages[i].module, pAllocator);
+        }
+    }
+}
+
+template <>
+void DestroyReplacedShaderModules(VkDevice device, const VkComputePipelineCreateInfo &create_info,
+                                  const VkComputePipelineCreateInfo &modified_create_info,
+                                  const VkAllocationCallbacks *pAllocator) {
+    if (modified_create_info.stage.module != create_info.stage.module) {
+        DispatchDestroyShaderModule(device, modified_create_info.stage.module, pAllocator);
+    }
+}
+
 template <typename SafeType>
 void SetShaderModule(SafeType &create_info, const vku::safe_VkPipelineShaderStageCreateInfo &stage_info,
                      VkShaderModule shader_module, uint32_t stage_ci_index) {
@@ -802,6 +849,44 @@ bool GpuShaderInstrumentor::CheckForGpuAvEnabled(const void *pNext) {
     return false;
 }
 
+bool GpuShaderInstrumentor::IsShaderSelected(vvl::span<const uint32_t> spirv) {
+    if (!gpuav_settings.instrumented_shader_hashes.empty()) {
+        const uint32_t shader_hash = hash_util::ShaderHash(spirv.data(), spirv.size() * sizeof(uint32_t));
+        const auto &hashes = gpuav_settings.instrumented_shader_hashes;
+        if (std::find(hashes.begin(), hashes.end(), shader_hash) == hashes.end()) {
+            return false;
+        }
+    }
+    if (gpuav_settings.instrumented_shader_sampling_rate > 1) {
+        return sampled_shader_count_.fetch_add(1) % gpuav_settings.instrumented_shader_sampling_rate == 0;
+    }
+    return true;
+}
+
+bool GpuShaderInstrumentor::IsPipelineSelected(const vvl::Pipeline &pipeline) const {
+    const auto &names = gpuav_settings.instrumented_shader_names;
+    if (names.empty()) {
+        return true;
+    }
+    for (const auto &stage_state : pipeline.stage_states) {
+        std::string_view name;
+        if (stage_state.module_state && stage_state.module_state->Handle()) {
+            name = debug_report->GetUtilsObjectName(HandleToUint64(stage_state.module_state->VkHandle()));
+        } else if (stage_state.pipeline_create_info) {
+            // Shader modules defined at pipeline creation can be named in the pNext of the stage
+            const auto *name_info =
+                vku::FindStructInPNextChain<VkDebugUtilsObjectNameInfoEXT>(stage_state.pipeline_create_info->pNext);
+            if (name_info && name_info->pObjectName) {
+                name = name_info->pObjectName;
+            }
+        }
+        if (!name.empty() && std::find(names.begin(), names.end(), name) != names.end()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 // Examine the pipelines to see if they use the debug descriptor set binding index.
 // If any do, create new non-instrumented shader modules and use them to replace the instrumented
 // shaders in the pipeline.  Return the (possibly) modified create infos to the caller.
@@ -811,8 +896,21 @@ void GpuShaderInstrumentor::PreCallRecordPipelineCreations(uint32_t count, const
                                                            PipelineStates &pipeline_states,
                                                            std::vector<SafeCreateInfo> *new_pipeline_create_infos,
                                                            const RecordObject &record_obj, ChassisState &chassis_state) {
+    // Shaders of pipeline libraries that are defined at pipeline creation and still need to be instrumented
+    struct InstrumentationJob {
+        uint32_t pipeline = 0;
+        VkShaderStageFlagBits stage = VK_SHADER_STAGE_ALL;
+        std::shared_ptr<vvl::ShaderModule> module_state;
+        uint32_t unique_shader_id = 0;
+        bool cached = false;
+        bool pass = false;
+        std::vector<uint32_t> instrumented_spirv;
+    };
+    std::vector<InstrumentationJob> jobs;
+
     // Walk through all the pipelines, make a copy of each and flag each pipeline that contains a shader that uses the debug
     // descriptor set index.
+    new_pipeline_create_infos->reserve(count);
     for (uint32_t pipeline = 0; pipeline < count; ++pipeline) {
         const auto &pipe = pipeline_states[pipeline];
         // NOTE: since these are "safe" CreateInfos, this will create a deep copy via the safe copy constructor
@@ -828,6 +926,11 @@ void GpuShaderInstrumentor::PreCallRecordPipelineCreations(uint32_t count, const
         if (pipeline_layout && pipeline_layout->set_layouts.size() >= adjusted_max_desc_sets) {
             replace_shaders = true;
         }
+        // The pipeline is not in the instrumented shader names, its shader modules might have been instrumented when they were
+        // created before the names were known
+        if (!IsPipelineSelected(*pipe)) {
+            replace_shaders = true;
+        }
 
         if (replace_shaders) {
             for (uint32_t i = 0; i < static_cast<uint32_t>(pipe->stage_states.size()); ++i) {
@@ -863,54 +966,81 @@ void GpuShaderInstrumentor::PreCallRecordPipelineCreations(uint32_t count, const
                         // Now find the corresponding VkShaderModuleCreateInfo
                         auto &stage_ci =
                             GetShaderStageCI<SafeCreateInfo, vku::safe_VkPipelineShaderStageCreateInfo>(new_pipeline_ci, stage);
-                        // We're modifying the copied, safe create info, which is ok to be non-const
-                        auto sm_ci = const_cast<vku::safe_VkShaderModuleCreateInfo *>(
-                            reinterpret_cast<const vku::safe_VkShaderModuleCreateInfo *>(
-                                vku::FindStructInPNextChain<VkShaderModuleCreateInfo>(stage_ci.pNext)));
+                        // The code is replaced once all the shaders of the call are instrumented
+                        const auto *sm_ci = vku::FindStructInPNextChain<VkShaderModuleCreateInfo>(stage_ci.pNext);
                         if (gpuav_settings.select_instrumented_shaders && sm_ci && !CheckForGpuAvEnabled(sm_ci->pNext)) continue;
-                        uint32_t unique_shader_id = 0;
-                        bool cached = false;
-                        bool pass = false;
-                        std::vector<uint32_t> instrumented_spirv;
+                        if (!IsShaderSelected(module_state->spirv->words_)) continue;
+                        InstrumentationJob &job = jobs.emplace_back();
+                        job.pipeline = pipeline;
+                        job.stage = stage;
+                        job.module_state = module_state;
                         if (gpuav_settings.cache_instrumented_shaders) {
-                            unique_shader_id =
-                                hash_util::ShaderHash(module_state->spirv->words_.data(), module_state->spirv->words_.size());
-                            auto it = instrumented_shaders.find(unique_shader_id);
+                            job.unique_shader_id =
+                                hash_util::ShaderHash(module_state->spirv->words_.data(),
+                                                      module_state->spirv->words_.size() * sizeof(uint32_t));
+                            auto it = instrumented_shaders.find(job.unique_shader_id);
                             if (it != instrumented_shaders.end()) {
-                                instrumented_spirv = it->second.second;
-                                cached = true;
+                                job.instrumented_spirv = it->second.second;
+                                job.cached = true;
                             }
                         } else {
-                            unique_shader_id = unique_shader_module_id++;
+                            job.unique_shader_id = unique_shader_module_id++;
                         }
-                        if (!cached) {
-                            pass = InstrumentShader(module_state->spirv->words_, instrumented_spirv, unique_shader_id,
-                                                    record_obj.location);
-                        }
-                        if (cached || pass) {
-                            module_state->gpu_validation_shader_id = unique_shader_id;
-                            // Now we need to update the shader code in VkShaderModuleCreateInfo
-                            // module_state->Handle() == VK_NULL_HANDLE should imply sm_ci != nullptr, but checking here anyway
-                            if (sm_ci) {
-                                sm_ci->SetCode(instrumented_spirv);
-                            }
-                            if (gpuav_settings.cache_instrumented_shaders && !cached) {
-                                instrumented_shaders.emplace(unique_shader_id,
-                                                             std::make_pair(instrumented_spirv.size(), instrumented_spirv));
-                            }
-                        }
-
-                        chassis_state.shader_unique_id_maps[pipeline][stage] = unique_shader_id;
                     }
                 }
             }
         }
         new_pipeline_create_infos->push_back(std::move(new_pipeline_ci));
     }
+
+    // The shaders are instrumented independently from each other, with several of them the instrumentation passes run on the
+    // shader validation threads
+    const auto instrument = [this, &jobs, &record_obj](uint32_t i) {
+        InstrumentationJob &job = jobs[i];
+        if (!job.cached) {
+            job.pass = InstrumentShader(job.module_state->spirv->words_, job.instrumented_spirv, job.unique_shader_id,
+                                        record_obj.location);
+        }
+    };
+    if (jobs.size() > 1 && (worker_pool || shader_validation_threads > 0)) {
+        // The threads are only started once there is something for them to do, many devices never create such pipelines
+        std::call_once(instrumentation_pool_once_, [this]() {
+            instrumentation_pool_ = worker_pool ? worker_pool : std::make_shared<vvl::WorkerPool>(shader_validation_threads);
+        });
+        instrumentation_pool_->ParallelFor(static_cast<uint32_t>(jobs.size()), instrument);
+    } else {
+        for (uint32_t i = 0; i < static_cast<uint32_t>(jobs.size()); ++i) {
+            instrument(i);
+        }
+    }
+
+    for (InstrumentationJob &job : jobs) {
+        if (job.cached || job.pass) {
+            job.module_state->gpu_validation_shader_id = job.unique_shader_id;
+            // Now we need to update the shader code in VkShaderModuleCreateInfo
+            // module_state->Handle() == VK_NULL_HANDLE should imply sm_ci != nullptr, but checking here anyway
+            auto &stage_ci = GetShaderStageCI<SafeCreateInfo, vku::safe_VkPipelineShaderStageCreateInfo>(
+                (*new_pipeline_create_infos)[job.pipeline], job.stage);
+            // We're modifying the copied, safe create info, which is ok to be non-const
+            auto sm_ci = const_cast<vku::safe_VkShaderModuleCreateInfo *>(
+                reinterpret_cast<const vku::safe_VkShaderModuleCreateInfo *>(
+                    vku::FindStructInPNextChain<VkShaderModuleCreateInfo>(stage_ci.pNext)));
+            if (sm_ci) {
+                sm_ci->SetCode(job.instrumented_spirv);
+            }
+            if (gpuav_settings.cache_instrumented_shaders && !job.cached) {
+                instrumented_shaders.emplace(job.unique_shader_id,
+                                             std::make_pair(job.instrumented_spirv.size(), std::move(job.instrumented_spirv)));
+            }
+        }
+
+        chassis_state.shader_unique_id_maps[job.pipeline][job.stage] = job.unique_shader_id;
+    }
 }
 // For every pipeline:
 // - For every shader in a pipeline:
-//   - If the shader had to be replaced in PreCallRecord (because the pipeline is using the debug desc set index):
+//   - If the shader had to be replaced in PreCallRecord (because the pipeline is using the debug desc set index, or is not
+//     selected by the instrumented shader names):
 //     - Destroy it since it has been bound into the pipeline by now.  This is our only chance to delete it.
 //   - Track the shader in the shader_map
 //   - Save the shader binary if it contains debug code
@@ -919,22 +1049,16 @@ void GpuShaderInstrumentor::PostCallRecordPipelineCreations(const uint32_t count
                                                             const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                             const SafeCreateInfo &modified_create_infos) {
     for (uint32_t pipeline = 0; pipeline < count; ++pipeline) {
+        auto *modified_ci = reinterpret_cast<const CreateInfo *>(modified_create_infos[pipeline].ptr());
+        DestroyReplacedShaderModules(device, pCreateInfos[pipeline], *modified_ci, pAllocator);
+
         auto pipeline_state = Get<vvl::Pipeline>(pPipelines[pipeline]);
         if (!pipeline_state) continue;
 
         if (!pipeline_state->stage_states.empty() && !(pipeline_state->create_flags & VK_PIPELINE_CREATE_LIBRARY_BIT_KHR)) {
-            const auto pipeline_layout = pipeline_state->PipelineLayoutState();
             for (auto &stage_state : pipeline_state->stage_states) {
                 auto &module_state = stage_state.module_state;
 
-                if (pipeline_state->active_slots.find(desc_set_bind_index) != pipeline_state->active_slots.end() ||
-                    (pipeline_layout->set_layouts.size() >= adjusted_max_desc_sets)) {
-                    auto *modified_ci = reinterpret_cast<const CreateInfo *>(modified_create_infos[pipeline].ptr());
-                    auto uninstrumented_module = GetShaderModule(*modified_ci, stage_state.GetStage());
-                    assert(uninstrumented_module != module_state->VkHandle());
-                    DispatchDestroyShaderModule(device, uninstrumented_module, pAllocator);
-                }
-
                 std::vector<unsigned int> code;
                 // Save the shader binary
                 // The core_validation ShaderModule tracker saves the binary too, but discards it when the ShaderModule
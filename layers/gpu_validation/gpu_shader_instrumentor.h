@@ -15,9 +15,13 @@
  * limitations under the License.
  */
 #pragma once
+
+#include <mutex>
+
 #include "generated/chassis.h"
 #include "gpu_validation/gpu_resources.h"
 #include "gpu_validation/gpu_state_tracker.h"
+#include "utils/worker_pool.h"
 #include "vma/vma.h"
 
 class DescriptorSetManager {
@@ -141,6 +145,8 @@ class GpuShaderInstrumentor : public ValidationStateTracker {
     void ReportSetupProblem(LogObjectList objlist, const Location &loc, const char *const specific_message,
                             bool vma_fail = false) const;
     bool CheckForGpuAvEnabled(const void *pNext);
+    // Whether the shader passes the instrumented shader hash and sampling rate filters of the settings
+    bool IsShaderSelected(vvl::span<const uint32_t> spirv);
 
   protected:
     std::shared_ptr<vvl::Queue> CreateQueue(VkQueue q, uint32_t index, VkDeviceQueueCreateFlags flags,
@@ -160,6 +166,9 @@ class GpuShaderInstrumentor : public ValidationStateTracker {
     virtual bool InstrumentShader(const vvl::span<const uint32_t> &input, std::vector<uint32_t> &instrumented_spirv,
                                   uint32_t unique_shader_id, const Location &loc) = 0;
 
+    // Whether one of the shader modules of the pipeline has a name of the instrumented shader names setting
+    bool IsPipelineSelected(const vvl::Pipeline &pipeline) const;
+
     VkDescriptorSetLayout GetDebugDescriptorSetLayout() { return debug_desc_layout_; }
     VkPipelineLayout GetDebugPipelineLayout() { return debug_pipeline_layout_; }
 
@@ -175,10 +184,17 @@ class GpuShaderInstrumentor : public ValidationStateTracker {
     uint32_t output_buffer_byte_size = 0;
     uint32_t desc_set_bind_index = 0;
     VmaAllocator vmaAllocator = {};
+    // Per command buffer allocations, recycled as command buffers are reset
     VmaPool output_buffer_pool = VK_NULL_HANDLE;
+    // Allocations living as long as the device, kept apart so they do not fragment the output buffer pool
+    VmaPool persistent_buffer_pool = VK_NULL_HANDLE;
     std::unique_ptr<DescriptorSetManager> desc_set_manager;
     vvl::concurrent_unordered_map<uint32_t, GpuAssistedShaderTracker> shader_map;
     std::vector<VkDescriptorSetLayoutBinding> validation_bindings_;
+    // The layer wide worker_pool, or with only shader_validation_threads set a pool of its own started when the first
+    // pipelines with several shaders are instrumented. Null otherwise.
+    std::shared_ptr<vvl::WorkerPool> instrumentation_pool_;
+    std::once_flag instrumentation_pool_once_;
 
     gpuav::DeviceMemoryBlock indices_buffer{};
 
@@ -189,4 +205,6 @@ class GpuShaderInstrumentor : public ValidationStateTracker {
     // These are objects used to inject our descriptor set into the command buffer
     VkDescriptorSetLayout debug_desc_layout_ = VK_NULL_HANDLE;
     VkPipelineLayout debug_pipeline_layout_ = VK_NULL_HANDLE;
+    // Number of shaders that went through the sampling rate filter
+    std::atomic<uint32_t> sampled_shader_count_{0};
 };
@@ -29,6 +29,7 @@ Queue::Queue(GpuShaderInstrumentor &shader_instrumentor, VkQueue q, uint32_t ind
     : vvl::Queue(shader_instrumentor, q, index, flags, queueFamilyProperties), shader_instrumentor_(shader_instrumentor) {}
 
 Queue::~Queue() {
+    StopReadbackThread();
     if (barrier_command_buffer_) {
         DispatchFreeCommandBuffers(shader_instrumentor_.device, barrier_command_pool_, 1, &barrier_command_buffer_);
         barrier_command_buffer_ = VK_NULL_HANDLE;
@@ -43,9 +44,15 @@ Queue::~Queue() {
     }
 }
 
+void Queue::Destroy() {
+    StopReadbackThread();
+    vvl::Queue::Destroy();
+}
+
 // Submit a memory barrier on graphics queues.
 // Lazy-create and record the needed command buffer.
-void Queue::SubmitBarrier(const Location &loc, uint64_t seq) {
+// Return true if the barrier was submitted, barrier_sem_ then reaches seq when the batch is complete
+bool Queue::SubmitBarrier(const Location &loc, uint64_t seq) {
     if (barrier_command_pool_ == VK_NULL_HANDLE) {
         VkResult result = VK_SUCCESS;
 
@@ -55,7 +62,7 @@ void Queue::SubmitBarrier(const Location &loc, uint64_t seq) {
         if (result != VK_SUCCESS) {
             shader_instrumentor_.ReportSetupProblem(vvl::Queue::VkHandle(), loc, "Unable to create command pool for barrier CB.");
             barrier_command_pool_ = VK_NULL_HANDLE;
-            return;
+            return false;
         }
 
         VkCommandBufferAllocateInfo buffer_alloc_info = vku::InitStructHelper();
@@ -68,7 +75,7 @@ void Queue::SubmitBarrier(const Location &loc, uint64_t seq) {
             DispatchDestroyCommandPool(shader_instrumentor_.device, barrier_command_pool_, nullptr);
             barrier_command_pool_ = VK_NULL_HANDLE;
             barrier_command_buffer_ = VK_NULL_HANDLE;
-            return;
+            return false;
         }
 
         VkSemaphoreTypeCreateInfoKHR semaphore_type_create_info = vku::InitStructHelper();
@@ -83,7 +90,7 @@ void Queue::SubmitBarrier(const Location &loc, uint64_t seq) {
             DispatchDestroyCommandPool(shader_instrumentor_.device, barrier_command_pool_, nullptr);
             barrier_command_pool_ = VK_NULL_HANDLE;
             barrier_command_buffer_ = VK_NULL_HANDLE;
-            return;
+            return false;
         }
 
         // Hook up command buffer dispatch
@@ -115,13 +122,18 @@ void Queue::SubmitBarrier(const Location &loc, uint64_t seq) {
         submit_info.signalSemaphoreCount = 1;
         submit_info.pSignalSemaphores = &barrier_sem_;
 
-        DispatchQueueSubmit(vvl::Queue::VkHandle(), 1, &submit_info, VK_NULL_HANDLE);
+        return DispatchQueueSubmit(vvl::Queue::VkHandle(), 1, &submit_info, VK_NULL_HANDLE) == VK_SUCCESS;
     }
+    return false;
 }
 
-uint64_t Queue::PreSubmit(std::vector<vvl::QueueSubmission> &&submissions) {
+uint64_t Queue::PreSubmit(SubmissionBatch &&submissions) {
+    const bool overlapped_readback = shader_instrumentor_.gpuav_settings.overlapped_error_readback;
     for (const auto &submission : submissions) {
-        for (auto &cb : submission.cbs) {
+        if (overlapped_readback) {
+            readback_cbs_.insert(readback_cbs_.end(), submission->cbs.begin(), submission->cbs.end());
+        }
+        for (auto &cb : submission->cbs) {
             auto gpu_cb = std::static_pointer_cast<CommandBuffer>(cb);
             auto guard = gpu_cb->ReadLock();
             gpu_cb->PreProcess();
@@ -139,14 +151,91 @@ void Queue::PostSubmit(vvl::QueueSubmission &submission) {
     vvl::Queue::PostSubmit(submission);
     if (submission.end_batch) {
         auto loc = submission.loc.Get();
-        SubmitBarrier(loc, submission.seq);
+        const bool barrier_submitted = SubmitBarrier(loc, submission.seq);
+        if (shader_instrumentor_.gpuav_settings.overlapped_error_readback) {
+            // Without the barrier nothing signals barrier_sem_, the batch is then post processed when it is retired
+            if (barrier_submitted && !readback_cbs_.empty()) {
+                std::unique_lock<std::mutex> guard(readback_lock_);
+                readback_batches_.emplace_back(ReadbackBatch{submission.seq, submission.loc, std::move(readback_cbs_)});
+                readback_seqs_.insert(submission.seq);
+                if (!readback_thread_) {
+                    readback_thread_ = std::make_unique<std::thread>(&Queue::ReadbackThreadFunc, this);
+                }
+                readback_cond_.notify_one();
+            }
+            readback_cbs_.clear();
+        }
+    }
+}
+
+void Queue::ReadbackThreadFunc() {
+    while (true) {
+        std::unique_lock<std::mutex> guard(readback_lock_);
+        readback_cond_.wait(guard, [this] { return readback_exit_ || !readback_batches_.empty(); });
+        if (readback_exit_) {
+            return;
+        }
+        ReadbackBatch batch(std::move(readback_batches_.front()));
+        readback_batches_.pop_front();
+        guard.unlock();
+
+        // Short timeout so that the thread can see readback_exit_ if the batch never completes
+        VkSemaphoreWaitInfo wait_info = vku::InitStructHelper();
+        wait_info.semaphoreCount = 1;
+        wait_info.pSemaphores = &barrier_sem_;
+        wait_info.pValues = &batch.seq;
+        VkResult result = VK_TIMEOUT;
+        while (result == VK_TIMEOUT && !readback_exit_) {
+            result = DispatchWaitSemaphoresKHR(shader_instrumentor_.device, &wait_info, 100000000);
+        }
+
+        if (result == VK_SUCCESS) {
+            const Location &loc = batch.loc.Get();
+            for (auto &cb : batch.cbs) {
+                auto gpu_cb = std::static_pointer_cast<CommandBuffer>(cb);
+                auto cb_guard = gpu_cb->WriteLock();
+                gpu_cb->PostProcess(VkHandle(), loc);
+                for (auto *secondary_cb : gpu_cb->linkedCommandBuffers) {
+                    auto *secondary_gpu_cb = static_cast<CommandBuffer *>(secondary_cb);
+                    auto secondary_guard = secondary_gpu_cb->WriteLock();
+                    secondary_gpu_cb->PostProcess(VkHandle(), loc);
+                }
+            }
+        }
+
+        guard.lock();
+        readback_done_seq_ = batch.seq;
+        readback_cond_.notify_all();
     }
 }
 
+void Queue::StopReadbackThread() {
+    {
+        std::unique_lock<std::mutex> guard(readback_lock_);
+        readback_exit_ = true;
+        readback_cond_.notify_all();
+    }
+    if (readback_thread_ && readback_thread_->joinable()) {
+        readback_thread_->join();
+    }
+    readback_thread_.reset();
+}
+
 void Queue::Retire(vvl::QueueSubmission &submission) {
     vvl::Queue::Retire(submission);
     retiring_.emplace_back(submission.cbs);
     if (submission.end_batch) {
+        {
+            std::unique_lock<std::mutex> guard(readback_lock_);
+            if (readback_seqs_.erase(submission.seq) != 0) {
+                // The command buffers can be reset once the submission is retired, their results must be read before
+                readback_cond_.wait(guard, [this, &submission] { return readback_exit_ || readback_done_seq_ >= submission.seq; });
+                guard.unlock();
+                retiring_.clear();
+                return;
+            }
+        }
+
         VkSemaphoreWaitInfo wait_info = vku::InitStructHelper();
         wait_info.semaphoreCount = 1;
         wait_info.pSemaphores = &barrier_sem_;
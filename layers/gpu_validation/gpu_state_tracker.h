@@ -27,11 +27,12 @@ class Queue : public vvl::Queue {
     Queue(GpuShaderInstrumentor &shader_instrumentor_, VkQueue q, uint32_t index, VkDeviceQueueCreateFlags flags,
           const VkQueueFamilyProperties &queueFamilyProperties);
     virtual ~Queue();
+    void Destroy() override;
 
   protected:
-    uint64_t PreSubmit(std::vector<vvl::QueueSubmission> &&submissions) override;
+    uint64_t PreSubmit(SubmissionBatch &&submissions) override;
     void PostSubmit(vvl::QueueSubmission &) override;
-    void SubmitBarrier(const Location &loc, uint64_t seq);
+    bool SubmitBarrier(const Location &loc, uint64_t seq);
     void Retire(vvl::QueueSubmission &) override;
 
     GpuShaderInstrumentor &shader_instrumentor_;
@@ -39,6 +40,26 @@ class Queue : public vvl::Queue {
     VkCommandBuffer barrier_command_buffer_{VK_NULL_HANDLE};
     VkSemaphore barrier_sem_{VK_NULL_HANDLE};
     std::deque<std::vector<std::shared_ptr<vvl::CommandBuffer>>> retiring_;
+
+  private:
+    // With the overlapped_error_readback setting, the command buffers of a batch are post processed by a queue owned thread
+    // as soon as barrier_sem_ reaches the seq of the batch, instead of when the application waits on the submission.
+    struct ReadbackBatch {
+        uint64_t seq;
+        LocationCapture loc;
+        std::vector<std::shared_ptr<vvl::CommandBuffer>> cbs;
+    };
+    void ReadbackThreadFunc();
+    void StopReadbackThread();
+
+    std::vector<std::shared_ptr<vvl::CommandBuffer>> readback_cbs_;  // command buffers of the batch being submitted
+    std::mutex readback_lock_;
+    std::condition_variable readback_cond_;
+    std::deque<ReadbackBatch> readback_batches_;
+    vvl::unordered_set<uint64_t> readback_seqs_;  // batches given to the readback thread and not retired yet
+    uint64_t readback_done_seq_{0};
+    std::atomic<bool> readback_exit_{false};
+    std::unique_ptr<std::thread> readback_thread_;
 };
 
 class CommandBuffer : public vvl::CommandBuffer {
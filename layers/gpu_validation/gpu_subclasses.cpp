@@ -19,6 +19,8 @@
 #include "gpu_validation.h"
 #include "gpu_vuids.h"
 #include "drawdispatch/descriptor_validator.h"
+#include "state_tracker/device_state.h"
+#include "state_tracker/render_pass_state.h"
 #include "spirv-tools/instrument.hpp"
 #include "gpu_shaders/gpu_error_header.h"
 #include "gpu_validation/gpu_constants.h"
@@ -129,164 +131,82 @@ CommandBuffer::CommandBuffer(Validator &gpuav, VkCommandBuffer handle, const VkC
 }
 
 void CommandBuffer::AllocateResources() {
-    using Func = vvl::Func;
-
     auto gpuav = static_cast<Validator *>(&dev_data);
+    assert(resources_.error_output_buffer.IsNull());
+    // On failure GPU-AV is aborted, and the command buffer is left without resources
+    (void)gpuav->cmd_buffer_resources_pool.Acquire(*gpuav, resources_, Location(vvl::Func::vkAllocateCommandBuffers));
+}
 
-    VkResult result = VK_SUCCESS;
+VkDescriptorSetLayout CommandBuffer::GetInstrumentationDescriptorSetLayout() const {
+    auto gpuav = static_cast<const Validator *>(&dev_data);
+    const VkDescriptorSetLayout layout = gpuav->cmd_buffer_resources_pool.GetInstrumentationDescriptorSetLayout();
+    assert(layout != VK_NULL_HANDLE);
+    return layout;
+}
 
-    // Instrumentation descriptor set layout
-    if (instrumentation_desc_set_layout_ == VK_NULL_HANDLE) {
-        assert(!gpuav->validation_bindings_.empty());
-        VkDescriptorSetLayoutCreateInfo instrumentation_desc_set_layout_ci = vku::InitStructHelper();
-        instrumentation_desc_set_layout_ci.bindingCount = static_cast<uint32_t>(gpuav->validation_bindings_.size());
-        instrumentation_desc_set_layout_ci.pBindings = gpuav->validation_bindings_.data();
-        result = DispatchCreateDescriptorSetLayout(gpuav->device, &instrumentation_desc_set_layout_ci, nullptr,
-                                                   &instrumentation_desc_set_layout_);
-        if (result != VK_SUCCESS) {
-            gpuav->ReportSetupProblem(gpuav->device, Location(Func::vkAllocateCommandBuffers),
-                                      "Unable to create instrumentation descriptor set layout. Aborting GPU-AV");
-            gpuav->aborted = true;
-            return;
+std::shared_ptr<DescriptorSet::State> BoundDescSet::FindVersion(uint32_t version) const {
+    // The binds of a command buffer mostly refer to the last versions
+    for (auto it = history.rbegin(); it != history.rend(); ++it) {
+        if ((*it)->version == version) {
+            return *it;
         }
     }
+    return nullptr;
+}
 
-    // Error output buffer
-    if (!gpuav->AllocateOutputMem(error_output_buffer_, Location(Func::vkAllocateCommandBuffers))) {
-        return;
+DescSetRef CommandBuffer::RecordDescriptorSet(uint32_t num, const std::shared_ptr<DescriptorSet> &set) {
+    auto [it, inserted] = bound_desc_set_indices.emplace(set.get(), static_cast<uint32_t>(bound_desc_sets.size()));
+    if (inserted) {
+        BoundDescSet &bound_set = bound_desc_sets.emplace_back();
+        bound_set.state = set;
     }
+    return DescSetRef{num, it->second, vvl::kU32Max};
+}
 
-    // Commands errors counts buffer
-    {
-        VkBufferCreateInfo buffer_info = vku::InitStructHelper();
-        buffer_info.size = GetCmdErrorsCountsBufferByteSize();
-        buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-        VmaAllocationCreateInfo alloc_info = {};
-        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-        alloc_info.pool = gpuav->output_buffer_pool;
-        result = vmaCreateBuffer(gpuav->vmaAllocator, &buffer_info, &alloc_info, &cmd_errors_counts_buffer_.buffer,
-                                 &cmd_errors_counts_buffer_.allocation, nullptr);
-        if (result != VK_SUCCESS) {
-            gpuav->ReportSetupProblem(
-                gpuav->device, Location(Func::vkAllocateCommandBuffers),
-                "Unable to allocate device memory for commands errors counts buffer. Device could become unstable.", true);
-            gpuav->aborted = true;
-            return;
-        }
-
-        ClearCmdErrorsCountsBuffer();
-        if (gpuav->aborted) {
-            return;
-        }
+const DescriptorSet::State *CommandBuffer::TakeDescriptorSetState(DescSetRef &ref) {
+    BoundDescSet &bound_set = bound_desc_sets[ref.bound_set];
+    if (!bound_set.output_state) {
+        bound_set.output_state = bound_set.state->GetOutputState();
     }
-
-    // BDA snapshot
-    if (gpuav->gpuav_settings.validate_bda) {
-        VkBufferCreateInfo buffer_info = vku::InitStructHelper();
-        buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-        VmaAllocationCreateInfo alloc_info = {};
-        buffer_info.size = GetBdaRangesBufferByteSize();
-        // This buffer could be very large if an application uses many buffers. Allocating it as HOST_CACHED
-        // and manually flushing it at the end of the state updates is faster than using HOST_COHERENT.
-        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
-        result = vmaCreateBuffer(gpuav->vmaAllocator, &buffer_info, &alloc_info, &bda_ranges_snapshot_.buffer,
-                                 &bda_ranges_snapshot_.allocation, nullptr);
-        if (result != VK_SUCCESS) {
-            gpuav->ReportSetupProblem(
-                gpuav->device, Location(Func::vkAllocateCommandBuffers),
-                "Unable to allocate device memory for buffer device address data. Device could become unstable.", true);
-            gpuav->aborted = true;
-            return;
-        }
+    std::shared_ptr<DescriptorSet::State> state = bound_set.state->GetCurrentState();
+    if (!state) {
+        return nullptr;
+    }
+    ref.version = state->version;
+    // Binding an unchanged set again returns the same state
+    if (bound_set.history.empty() || bound_set.history.back() != state) {
+        bound_set.history.emplace_back(std::move(state));
     }
+    return bound_set.history.back().get();
+}
 
-    // Update validation commands common descriptor set
-    {
-        const std::vector<VkDescriptorSetLayoutBinding> validation_cmd_bindings = {
-            // Error output buffer
-            {glsl::kBindingDiagErrorBuffer, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
-            // Buffer holding action command index in command buffer
-            {glsl::kBindingDiagActionIndex, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1, VK_SHADER_STAGE_ALL, nullptr},
-            // Buffer holding a resource index from the per command buffer command resources list
-            {glsl::kBindingDiagCmdResourceIndex, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1, VK_SHADER_STAGE_ALL, nullptr},
-            // Commands errors counts buffer
-            {glsl::kBindingDiagCmdErrorsCount, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
-        };
-
-        if (validation_cmd_desc_set_layout_ == VK_NULL_HANDLE) {
-            VkDescriptorSetLayoutCreateInfo validation_cmd_desc_set_layout_ci = vku::InitStructHelper();
-            validation_cmd_desc_set_layout_ci.bindingCount = static_cast<uint32_t>(validation_cmd_bindings.size());
-            validation_cmd_desc_set_layout_ci.pBindings = validation_cmd_bindings.data();
-            result = DispatchCreateDescriptorSetLayout(gpuav->device, &validation_cmd_desc_set_layout_ci, nullptr,
-                                                       &validation_cmd_desc_set_layout_);
-            if (result != VK_SUCCESS) {
-                gpuav->ReportSetupProblem(gpuav->device, Location(Func::vkAllocateCommandBuffers),
-                                          "Unable to create descriptor set layout used for validation commands. Aborting GPU-AV");
-                gpuav->aborted = true;
-                return;
+std::vector<DescSetState> CommandBuffer::ResolveDescriptorSets(const DescBindingInfo &di_info) const {
+    std::vector<DescSetState> descriptor_sets;
+    descriptor_sets.reserve(di_info.descriptor_sets.size());
+    for (const DescSetRef &ref : di_info.descriptor_sets) {
+        const BoundDescSet &bound_set = GetBoundDescSet(ref);
+        DescSetState &set_state = descriptor_sets.emplace_back();
+        set_state.num = ref.num;
+        set_state.state = bound_set.state;
+        if (di_info.pipeline) {
+            auto slot = di_info.pipeline->active_slots.find(ref.num);
+            if (slot != di_info.pipeline->active_slots.end()) {
+                set_state.binding_req = slot->second;
             }
         }
-
-        assert(validation_cmd_desc_pool_ == VK_NULL_HANDLE);
-        assert(validation_cmd_desc_set_ == VK_NULL_HANDLE);
-        result = gpuav->desc_set_manager->GetDescriptorSet(&validation_cmd_desc_pool_, validation_cmd_desc_set_layout_,
-                                                           &validation_cmd_desc_set_);
-        if (result != VK_SUCCESS) {
-            gpuav->ReportSetupProblem(gpuav->device, Location(Func::vkAllocateCommandBuffers),
-                                      "Unable to create descriptor set used for validation commands. Aborting GPU-AV");
-            gpuav->aborted = true;
-            return;
+        if (ref.version != vvl::kU32Max) {
+            set_state.gpu_state = bound_set.FindVersion(ref.version);
         }
-
-        std::array<VkWriteDescriptorSet, 4> validation_cmd_descriptor_writes = {};
-        assert(validation_cmd_bindings.size() == validation_cmd_descriptor_writes.size());
-
-        VkDescriptorBufferInfo error_output_buffer_desc_info = {};
-
-        assert(error_output_buffer_.buffer != VK_NULL_HANDLE);
-        error_output_buffer_desc_info.buffer = error_output_buffer_.buffer;
-        error_output_buffer_desc_info.offset = 0;
-        error_output_buffer_desc_info.range = VK_WHOLE_SIZE;
-
-        validation_cmd_descriptor_writes[0] = vku::InitStructHelper();
-        validation_cmd_descriptor_writes[0].dstBinding = glsl::kBindingDiagErrorBuffer;
-        validation_cmd_descriptor_writes[0].descriptorCount = 1;
-        validation_cmd_descriptor_writes[0].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-        validation_cmd_descriptor_writes[0].pBufferInfo = &error_output_buffer_desc_info;
-        validation_cmd_descriptor_writes[0].dstSet = GetValidationCmdCommonDescriptorSet();
-
-        VkDescriptorBufferInfo cmd_indices_buffer_desc_info = {};
-
-        assert(error_output_buffer_.buffer != VK_NULL_HANDLE);
-        cmd_indices_buffer_desc_info.buffer = gpuav->indices_buffer.buffer;
-        cmd_indices_buffer_desc_info.offset = 0;
-        cmd_indices_buffer_desc_info.range = sizeof(uint32_t);
-
-        validation_cmd_descriptor_writes[1] = vku::InitStructHelper();
-        validation_cmd_descriptor_writes[1].dstBinding = glsl::kBindingDiagActionIndex;
-        validation_cmd_descriptor_writes[1].descriptorCount = 1;
-        validation_cmd_descriptor_writes[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
-        validation_cmd_descriptor_writes[1].pBufferInfo = &cmd_indices_buffer_desc_info;
-        validation_cmd_descriptor_writes[1].dstSet = GetValidationCmdCommonDescriptorSet();
-
-        validation_cmd_descriptor_writes[2] = validation_cmd_descriptor_writes[1];
-        validation_cmd_descriptor_writes[2].dstBinding = glsl::kBindingDiagCmdResourceIndex;
-
-        VkDescriptorBufferInfo cmd_errors_count_buffer_desc_info = {};
-        cmd_errors_count_buffer_desc_info.buffer = GetCmdErrorsCountsBuffer();
-        cmd_errors_count_buffer_desc_info.offset = 0;
-        cmd_errors_count_buffer_desc_info.range = VK_WHOLE_SIZE;
-
-        validation_cmd_descriptor_writes[3] = vku::InitStructHelper();
-        validation_cmd_descriptor_writes[3].dstBinding = glsl::kBindingDiagCmdErrorsCount;
-        validation_cmd_descriptor_writes[3].descriptorCount = 1;
-        validation_cmd_descriptor_writes[3].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-        validation_cmd_descriptor_writes[3].pBufferInfo = &cmd_errors_count_buffer_desc_info;
-        validation_cmd_descriptor_writes[3].dstSet = GetValidationCmdCommonDescriptorSet();
-
-        DispatchUpdateDescriptorSets(gpuav->device, static_cast<uint32_t>(validation_cmd_descriptor_writes.size()),
-                                     validation_cmd_descriptor_writes.data(), 0, NULL);
+        set_state.output_state = bound_set.output_state;
     }
+    return descriptor_sets;
+}
+
+VkDescriptorSetLayout CommandBuffer::GetValidationCmdCommonDescriptorSetLayout() const {
+    auto gpuav = static_cast<const Validator *>(&dev_data);
+    const VkDescriptorSetLayout layout = gpuav->cmd_buffer_resources_pool.GetValidationCmdDescriptorSetLayout();
+    assert(layout != VK_NULL_HANDLE);
+    return layout;
 }
 
 bool CommandBuffer::UpdateBdaRangesBuffer() {
@@ -300,8 +220,9 @@ bool CommandBuffer::UpdateBdaRangesBuffer() {
     // Update buffer device address table
     // ---
     VkDeviceAddress *bda_table_ptr = nullptr;
-    assert(bda_ranges_snapshot_.allocation);
-    VkResult result = vmaMapMemory(gpuav->vmaAllocator, bda_ranges_snapshot_.allocation, reinterpret_cast<void **>(&bda_table_ptr));
+    assert(resources_.bda_ranges_snapshot.allocation);
+    VkResult result =
+        vmaMapMemory(gpuav->vmaAllocator, resources_.bda_ranges_snapshot.allocation, reinterpret_cast<void **>(&bda_table_ptr));
     assert(result == VK_SUCCESS);
     if (result != VK_SUCCESS) {
         if (result != VK_SUCCESS) {
@@ -321,11 +242,13 @@ bool CommandBuffer::UpdateBdaRangesBuffer() {
     // QWord 4 | Range 2 end
     // QWord 5 | ...
 
+    const VkDeviceSize bda_ranges_buffer_byte_size = CommandBufferResources::GetBdaRangesBufferByteSize(*gpuav);
     const size_t max_recordable_ranges =
-        static_cast<size_t>((GetBdaRangesBufferByteSize() - sizeof(uint64_t)) / (2 * sizeof(VkDeviceAddress)));
+        static_cast<size_t>((bda_ranges_buffer_byte_size - sizeof(uint64_t)) / (2 * sizeof(VkDeviceAddress)));
     auto bda_ranges = reinterpret_cast<ValidationStateTracker::BufferAddressRange *>(bda_table_ptr + 1);
+    uint32_t ranges_version = 0;
     const auto [ranges_to_update_count, total_address_ranges_count] =
-        gpuav->GetBufferAddressRanges(bda_ranges, max_recordable_ranges);
+        gpuav->CopyBufferAddressRanges(bda_ranges, max_recordable_ranges, ranges_version);
     bda_table_ptr[0] = ranges_to_update_count;
 
     if (total_address_ranges_count > size_t(gpuav->gpuav_settings.max_bda_in_use)) {
@@ -339,28 +262,25 @@ bool CommandBuffer::UpdateBdaRangesBuffer() {
 
     // Post update cleanups
     // ---
-    // Flush the BDA buffer before un-mapping so that the new state is visible to the GPU
-    result = vmaFlushAllocation(gpuav->vmaAllocator, bda_ranges_snapshot_.allocation, 0, VK_WHOLE_SIZE);
-    vmaUnmapMemory(gpuav->vmaAllocator, bda_ranges_snapshot_.allocation);
-    bda_ranges_snapshot_version_ = gpuav->buffer_device_address_ranges_version;
+    // Flush the written part of the BDA buffer before un-mapping so that the new state is visible to the GPU
+    const VkDeviceSize written_byte_size = (1 + 2 * ranges_to_update_count) * sizeof(VkDeviceAddress);
+    result = vmaFlushAllocation(gpuav->vmaAllocator, resources_.bda_ranges_snapshot.allocation, 0, written_byte_size);
+    vmaUnmapMemory(gpuav->vmaAllocator, resources_.bda_ranges_snapshot.allocation);
+    bda_ranges_snapshot_version_ = ranges_version;
 
     return true;
 }
 
-VkDeviceSize CommandBuffer::GetBdaRangesBufferByteSize() const {
-    auto gpuav = static_cast<Validator *>(&dev_data);
-    return (1                                           // 1 QWORD for the number of address ranges
-            + 2 * gpuav->gpuav_settings.max_bda_in_use  // 2 QWORDS per address range
-            ) *
-           8;
-}
-
 CommandBuffer::~CommandBuffer() { Destroy(); }
 
 void CommandBuffer::Destroy() {
     {
         auto guard = WriteLock();
         ResetCBState();
+        if (overhead_query_pool_ != VK_NULL_HANDLE) {
+            DispatchDestroyQueryPool(state_.device, overhead_query_pool_, nullptr);
+            overhead_query_pool_ = VK_NULL_HANDLE;
+        }
     }
     vvl::CommandBuffer::Destroy();
 }
@@ -378,53 +298,104 @@ void CommandBuffer::ResetCBState() {
     auto gpuav = static_cast<Validator *>(&dev_data);
     // Free the device memory and descriptor set(s) associated with a command buffer.
 
-    for (auto &cmd_info : per_command_resources) {
-        cmd_info->Destroy(*gpuav);
-    }
-    per_command_resources.clear();
+    per_command_resources.Destroy(*gpuav);
+    pre_draw_buffer_desc_sets.clear();
 
     for (auto &buffer_info : di_input_buffer_list) {
         vmaDestroyBuffer(gpuav->vmaAllocator, buffer_info.bindless_state_buffer, buffer_info.bindless_state_buffer_allocation);
     }
     di_input_buffer_list.clear();
+    bound_desc_sets.clear();
+    bound_desc_set_indices.clear();
     current_bindless_buffer = VK_NULL_HANDLE;
 
-    error_output_buffer_.Destroy(gpuav->vmaAllocator);
-    cmd_errors_counts_buffer_.Destroy(gpuav->vmaAllocator);
-    bda_ranges_snapshot_.Destroy(gpuav->vmaAllocator);
+    gpuav->cmd_buffer_resources_pool.Release(*gpuav, resources_);
+    // The snapshot of the next resources has to be updated, even if they are the same
     bda_ranges_snapshot_version_ = 0;
 
-    gpuav->desc_set_manager->PutBackDescriptorSet(validation_cmd_desc_pool_, validation_cmd_desc_set_);
-    validation_cmd_desc_pool_ = VK_NULL_HANDLE;
-    validation_cmd_desc_set_ = VK_NULL_HANDLE;
+    draw_index = compute_index = trace_rays_index = 0;
 
-    if (instrumentation_desc_set_layout_ != VK_NULL_HANDLE) {
-        DispatchDestroyDescriptorSetLayout(gpuav->device, instrumentation_desc_set_layout_, nullptr);
-        instrumentation_desc_set_layout_ = VK_NULL_HANDLE;
+    timed_pipelines_.clear();
+    overhead_timing_ended_ = false;
+}
+
+void CommandBuffer::ClearCmdErrorsCountsBuffer() const { resources_.ClearCmdErrorsCountsBuffer(); }
+
+void CommandBuffer::BeginOverheadTiming(const Location &loc) {
+    // A secondary command buffer can begin inside a render pass, where its queries cannot be reset
+    if (!IsPrimary()) {
+        return;
+    }
+    const auto &queue_family_props = state_.physical_device_state->queue_family_properties;
+    const uint32_t queue_family_index = command_pool->queueFamilyIndex;
+    if (queue_family_index >= queue_family_props.size() || queue_family_props[queue_family_index].timestampValidBits == 0) {
+        return;
     }
 
-    if (validation_cmd_desc_set_layout_ != VK_NULL_HANDLE) {
-        DispatchDestroyDescriptorSetLayout(gpuav->device, validation_cmd_desc_set_layout_, nullptr);
-        validation_cmd_desc_set_layout_ = VK_NULL_HANDLE;
+    if (overhead_query_pool_ == VK_NULL_HANDLE) {
+        VkQueryPoolCreateInfo query_pool_ci = vku::InitStructHelper();
+        query_pool_ci.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        query_pool_ci.queryCount = kMaxOverheadTimestamps;
+        VkResult result = DispatchCreateQueryPool(state_.device, &query_pool_ci, nullptr, &overhead_query_pool_);
+        if (result != VK_SUCCESS) {
+            state_.ReportSetupProblem(VkHandle(), loc, "Unable to create the query pool timing the validated commands.");
+            overhead_query_pool_ = VK_NULL_HANDLE;
+            return;
+        }
     }
+    DispatchCmdResetQueryPool(VkHandle(), overhead_query_pool_, 0, kMaxOverheadTimestamps);
+}
 
-    draw_index = compute_index = trace_rays_index = 0;
+void CommandBuffer::TimeActionCommand(VkPipeline pipeline) {
+    if (overhead_query_pool_ == VK_NULL_HANDLE || overhead_timing_ended_) {
+        return;
+    }
+    if (!timed_pipelines_.empty() && timed_pipelines_.back() == pipeline) {
+        return;
+    }
+    // The last timestamp is kept for the end of the command buffer, the last range then lasts until the end
+    if (timed_pipelines_.size() + 1 >= kMaxOverheadTimestamps) {
+        return;
+    }
+    // With multiview, a timestamp uses one query per view
+    if (activeRenderPass && activeRenderPass->has_multiview_enabled) {
+        return;
+    }
+    DispatchCmdWriteTimestamp(VkHandle(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, overhead_query_pool_,
+                              static_cast<uint32_t>(timed_pipelines_.size()));
+    timed_pipelines_.emplace_back(pipeline);
 }
 
-void CommandBuffer::ClearCmdErrorsCountsBuffer() const {
-    auto gpuav = static_cast<Validator *>(&dev_data);
-    uint32_t *cmd_errors_counts_buffer_ptr = nullptr;
-    VkResult result = vmaMapMemory(gpuav->vmaAllocator, cmd_errors_counts_buffer_.allocation,
-                                   reinterpret_cast<void **>(&cmd_errors_counts_buffer_ptr));
+void CommandBuffer::EndOverheadTiming() {
+    if (overhead_query_pool_ == VK_NULL_HANDLE || timed_pipelines_.empty() || overhead_timing_ended_) {
+        return;
+    }
+    DispatchCmdWriteTimestamp(VkHandle(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, overhead_query_pool_,
+                              static_cast<uint32_t>(timed_pipelines_.size()));
+    overhead_timing_ended_ = true;
+}
+
+void CommandBuffer::ReadOverheadTimestamps() {
+    if (!overhead_timing_ended_) {
+        return;
+    }
+    const uint32_t timestamp_count = static_cast<uint32_t>(timed_pipelines_.size()) + 1;
+    std::vector<uint64_t> timestamps(timestamp_count);
+    VkResult result = DispatchGetQueryPoolResults(state_.device, overhead_query_pool_, 0, timestamp_count,
+                                                  timestamp_count * sizeof(uint64_t), timestamps.data(), sizeof(uint64_t),
+                                                  VK_QUERY_RESULT_64_BIT);
     if (result != VK_SUCCESS) {
-        gpuav->ReportSetupProblem(gpuav->device, Location(vvl::Func::vkAllocateCommandBuffers),
-                                  "Unable to map device memory for commands errors counts buffer. Device could become unstable.",
-                                  true);
-        gpuav->aborted = true;
         return;
     }
-    std::memset(cmd_errors_counts_buffer_ptr, 0, static_cast<size_t>(GetCmdErrorsCountsBufferByteSize()));
-    vmaUnmapMemory(gpuav->vmaAllocator, cmd_errors_counts_buffer_.allocation);
+    const double timestamp_period = state_.phys_dev_props.limits.timestampPeriod;
+    for (size_t i = 0; i < timed_pipelines_.size(); ++i) {
+        // Timestamps with less than 64 valid bits can wrap, such a range is skipped
+        if (timestamps[i + 1] < timestamps[i]) {
+            continue;
+        }
+        const auto time_ns = static_cast<uint64_t>(double(timestamps[i + 1] - timestamps[i]) * timestamp_period);
+        state_.AddPipelineGpuTime(timed_pipelines_[i], time_ns);
+    }
 }
 
 bool CommandBuffer::PreProcess() {
@@ -436,7 +407,7 @@ bool CommandBuffer::PreProcess() {
     return !per_command_resources.empty() || has_build_as_cmd;
 }
 
-bool CommandBuffer::NeedsPostProcess() { return !error_output_buffer_.IsNull(); }
+bool CommandBuffer::NeedsPostProcess() { return !resources_.error_output_buffer.IsNull(); }
 
 // For the given command buffer, map its debug data buffers and read their contents for analysis.
 void CommandBuffer::PostProcess(VkQueue queue, const Location &loc) {
@@ -446,55 +417,55 @@ void CommandBuffer::PostProcess(VkQueue queue, const Location &loc) {
     if (!NeedsPostProcess()) {
         return;
     }
+    auto span = dev_data.TraceSpan("GpuAssisted", "PostProcess");
+
+    ReadOverheadTimestamps();
 
     auto gpuav = static_cast<Validator *>(&dev_data);
     bool error_found = false;
-    uint32_t *error_output_buffer_ptr = nullptr;
-    VkResult result =
-        vmaMapMemory(gpuav->vmaAllocator, error_output_buffer_.allocation, reinterpret_cast<void **>(&error_output_buffer_ptr));
-    assert(result == VK_SUCCESS);
-    if (result == VK_SUCCESS) {
-        // The second word in the debug output buffer is the number of words that would have
-        // been written by the shader instrumentation, if there was enough room in the buffer we provided.
-        // The number of words actually written by the shaders is determined by the size of the buffer
-        // we provide via the descriptor. So, we process only the number of words that can fit in the
-        // buffer.
-        const uint32_t total_words = error_output_buffer_ptr[cst::stream_output_size_offset];
-        // A zero here means that the shader instrumentation didn't write anything.
-        if (total_words != 0) {
-            uint32_t *const error_records_start = &error_output_buffer_ptr[cst::stream_output_data_offset];
-            assert(gpuav->output_buffer_byte_size > cst::stream_output_data_offset);
-            uint32_t *const error_records_end =
-                error_output_buffer_ptr + (gpuav->output_buffer_byte_size - cst::stream_output_data_offset);
-
-            uint32_t *error_record = error_records_start;
-            uint32_t record_size = error_record[glsl::kHeaderErrorRecordSizeOffset];
-            assert(record_size == glsl::kErrorRecordSize);
-
-            while (record_size > 0 && (error_record + record_size) <= error_records_end) {
-                const uint32_t resource_index = error_record[glsl::kHeaderCommandResourceIdOffset];
-                assert(resource_index < per_command_resources.size());
-                auto &cmd_info = per_command_resources[resource_index];
-                const LogObjectList objlist(queue, VkHandle());
-                cmd_info->LogValidationMessage(*gpuav, queue, VkHandle(), error_record, cmd_info->operation_index, objlist);
-
-                // Next record
-                error_record += record_size;
-                record_size = error_record[glsl::kHeaderErrorRecordSizeOffset];
-            }
-
-            // Clear the written size and any error messages. Note that this preserves the first word, which contains flags.
-            assert(gpuav->output_buffer_byte_size > cst::stream_output_data_offset);
-            memset(&error_output_buffer_ptr[cst::stream_output_data_offset], 0,
-                   gpuav->output_buffer_byte_size - cst::stream_output_data_offset * sizeof(uint32_t));
+    // The error output buffer is persistently mapped and host coherent
+    uint32_t *const error_output_buffer_ptr = resources_.error_output_buffer_ptr;
+    assert(error_output_buffer_ptr);
+    // The second word in the debug output buffer is the number of words that would have
+    // been written by the shader instrumentation, if there was enough room in the buffer we provided.
+    // The number of words actually written by the shaders is determined by the size of the buffer
+    // we provide via the descriptor. So, we process only the number of words that can fit in the
+    // buffer.
+    // Errors are only written by instrumented or validation commands, which all have command resources. Without any, the
+    // output buffer is not even read.
+    const uint32_t total_words =
+        per_command_resources.empty() ? 0 : error_output_buffer_ptr[cst::stream_output_size_offset];
+    // A zero here means that the shader instrumentation didn't write anything, and that no command errors count was
+    // incremented either, so there is nothing to read or clear.
+    if (total_words != 0) {
+        uint32_t *const error_records_start = &error_output_buffer_ptr[cst::stream_output_data_offset];
+        assert(gpuav->output_buffer_byte_size > cst::stream_output_data_offset);
+        uint32_t *const error_records_end = error_output_buffer_ptr + gpuav->output_buffer_byte_size / sizeof(uint32_t);
+
+        uint32_t *error_record = error_records_start;
+        uint32_t record_size = error_record[glsl::kHeaderErrorRecordSizeOffset];
+        assert(record_size == glsl::kErrorRecordSize);
+
+        while (record_size > 0 && (error_record + record_size) <= error_records_end) {
+            const uint32_t resource_index = error_record[glsl::kHeaderCommandResourceIdOffset];
+            assert(resource_index < per_command_resources.size());
+            CommandResources &cmd_info = per_command_resources[resource_index];
+            const LogObjectList objlist(queue, VkHandle());
+            cmd_info.LogValidationMessage(*gpuav, queue, *this, error_record, cmd_info.operation_index, objlist);
+
+            // Next record
+            error_record += record_size;
+            record_size = error_record < error_records_end ? error_record[glsl::kHeaderErrorRecordSizeOffset] : 0;
         }
+
+        // Clear the written size and the error records that were written. Note that this preserves the first word, which
+        // contains flags.
+        const size_t written_words =
+            std::min(static_cast<size_t>(total_words), static_cast<size_t>(error_records_end - error_records_start));
+        std::memset(error_records_start, 0, written_words * sizeof(uint32_t));
         error_output_buffer_ptr[cst::stream_output_size_offset] = 0;
-        vmaUnmapMemory(gpuav->vmaAllocator, error_output_buffer_.allocation);
-    }
 
-    ClearCmdErrorsCountsBuffer();
-    if (gpuav->aborted) {
-        return;
+        ClearCmdErrorsCountsBuffer();
     }
 
     // If instrumentation found an error, skip post processing. Errors detected by instrumentation are usually
@@ -507,8 +478,9 @@ void CommandBuffer::PostProcess(VkQueue queue, const Location &loc) {
         for (auto &di_info : di_input_buffer_list) {
             Location draw_loc(vvl::Func::vkCmdDraw);
             // For each descriptor set ...
-            for (uint32_t i = 0;  i < di_info.descriptor_set_buffers.size(); i++) {
-                auto &set = di_info.descriptor_set_buffers[i];
+            for (uint32_t i = 0;  i < di_info.descriptor_sets.size(); i++) {
+                const DescSetRef &ref = di_info.descriptor_sets[i];
+                const BoundDescSet &set = GetBoundDescSet(ref);
                 if (validated_desc_sets.count(set.state->VkHandle()) > 0) {
                     // TODO - If you share two VkDescriptorSet across two different sets in the SPIR-V, we are not going to be
                     // validating the 2nd instance of it
@@ -517,17 +489,26 @@ void CommandBuffer::PostProcess(VkQueue queue, const Location &loc) {
                 validated_desc_sets.emplace(set.state->VkHandle());
                 assert(set.output_state);
 
+                const BindingVariableMap *binding_req = nullptr;
+                if (di_info.pipeline) {
+                    auto slot = di_info.pipeline->active_slots.find(ref.num);
+                    if (slot != di_info.pipeline->active_slots.end()) {
+                        binding_req = &slot->second;
+                    }
+                }
+
                 vvl::DescriptorValidator context(state_, *this, *set.state, i, VK_NULL_HANDLE /*framebuffer*/, draw_loc);
                 const uint32_t shader_set = glsl::kDescriptorSetWrittenMask | i;
                 auto used_descs = set.output_state->UsedDescriptors(*set.state, shader_set);
                 // For each used binding ...
                 for (const auto &u : used_descs) {
-                    auto iter = set.binding_req.find(u.first);
                     vvl::DescriptorBindingInfo binding_info;
                     binding_info.first = u.first;
-                    while (iter != set.binding_req.end() && iter->first == u.first) {
-                        binding_info.second.emplace_back(iter->second);
-                        ++iter;
+                    if (binding_req) {
+                        for (auto iter = binding_req->find(u.first); iter != binding_req->end() && iter->first == u.first;
+                             ++iter) {
+                            binding_info.second.emplace_back(iter->second);
+                        }
                     }
                     context.ValidateBinding(binding_info, u.second);
                 }
@@ -541,11 +522,14 @@ void CommandBuffer::PostProcess(VkQueue queue, const Location &loc) {
 Queue::Queue(Validator &state, VkQueue q, uint32_t index, VkDeviceQueueCreateFlags flags, const VkQueueFamilyProperties &qfp)
     : gpu_tracker::Queue(state, q, index, flags, qfp) {}
 
-uint64_t Queue::PreSubmit(std::vector<vvl::QueueSubmission> &&submissions) {
+uint64_t Queue::PreSubmit(SubmissionBatch &&submissions) {
     auto &gpuav = static_cast<Validator &>(shader_instrumentor_);
     if (gpuav.aborted) {
         return 0;
     }
+    if (gpuav.gpuav_settings.report_memory_usage) {
+        gpuav.UpdatePeakMemoryUsage();
+    }
     return gpu_tracker::Queue::PreSubmit(std::move(submissions));
 }
 
@@ -38,6 +38,7 @@ namespace gpuav {
 
 class Validator;
 
+// Descriptor set of a vkCmdBindDescriptorSets() as it was bound, only built when an error has to be reported
 struct DescSetState {
     uint32_t num;
     std::shared_ptr<DescriptorSet> state;
@@ -49,12 +50,33 @@ struct DescSetState {
     std::shared_ptr<DescriptorSet::State> output_state;
 };
 
+// Descriptor set bound by a command buffer, shared by all the binds of the set
+struct BoundDescSet {
+    std::shared_ptr<DescriptorSet> state;
+    std::shared_ptr<DescriptorSet::State> output_state;
+    // The versions of the set the command buffer was bound with, oldest first. Holding them keeps the state buffers the GPU
+    // reads alive until the command buffer is reset.
+    std::vector<std::shared_ptr<DescriptorSet::State>> history;
+
+    std::shared_ptr<DescriptorSet::State> FindVersion(uint32_t version) const;
+};
+
+// What a vkCmdBindDescriptorSets() records of each of its sets
+struct DescSetRef {
+    uint32_t num;
+    uint32_t bound_set;  // index in CommandBuffer::bound_desc_sets
+    // Version of the state of the set the GPU reads, kU32Max for update-after-bind sets until the command buffer is submitted
+    uint32_t version;
+};
+
 struct DescBindingInfo {
     VkBuffer bindless_state_buffer;
     VmaAllocation bindless_state_buffer_allocation;
-    // Hold a buffer for each descriptor set
+    // Pipeline bound with the sets, its active slots are the bindings they are validated against. Null if the sets are
+    // bound before any pipeline.
+    std::shared_ptr<const vvl::Pipeline> pipeline;
     // Note: The index here is from vkCmdBindDescriptorSets::firstSet
-    std::vector<DescSetState> descriptor_set_buffers;
+    std::vector<DescSetRef> descriptor_sets;
 };
 
 // Used for draws/dispatch/traceRays indirect
@@ -71,11 +93,17 @@ struct CmdIndirectState {
 class CommandBuffer : public gpu_tracker::CommandBuffer {
   public:
     // per validated command state
-    std::vector<std::unique_ptr<CommandResources>> per_command_resources;
+    CommandResourcesList per_command_resources;
     // per vkCmdBindDescriptorSet() state
     std::vector<DescBindingInfo> di_input_buffer_list;
+    std::vector<BoundDescSet> bound_desc_sets;
+    vvl::unordered_map<const DescriptorSet *, uint32_t> bound_desc_set_indices;
     VkBuffer current_bindless_buffer = VK_NULL_HANDLE;
     uint32_t draw_index = 0, compute_index = 0, trace_rays_index = 0;
+    // Descriptor sets of the pre draw validation, shared by the validation draws reading the same buffers. Each set is owned
+    // by the PreDrawResources of the first draw using it.
+    using PreDrawDescSetKey = PreDrawResources::BufferDescSetKey;
+    vvl::unordered_map<PreDrawDescSetKey, VkDescriptorSet, hash_util::HasHashMember<PreDrawDescSetKey>> pre_draw_buffer_desc_sets;
 
     CommandBuffer(Validator &gpuav, VkCommandBuffer handle, const VkCommandBufferAllocateInfo *pCreateInfo,
                   const vvl::CommandPool *pool);
@@ -84,40 +112,48 @@ class CommandBuffer : public gpu_tracker::CommandBuffer {
     bool PreProcess() final;
     void PostProcess(VkQueue queue, const Location &loc) final;
 
-    const VkDescriptorSetLayout &GetInstrumentationDescriptorSetLayout() const {
-        assert(instrumentation_desc_set_layout_ != VK_NULL_HANDLE);
-        return instrumentation_desc_set_layout_;
-    }
+    VkDescriptorSetLayout GetInstrumentationDescriptorSetLayout() const;
+
+    // The reference does not have a version until TakeDescriptorSetState(), which is deferred to the submission for
+    // update-after-bind sets
+    DescSetRef RecordDescriptorSet(uint32_t num, const std::shared_ptr<DescriptorSet> &set);
+    // Returns the current state of the set, now kept by the command buffer, or null if it could not be created
+    const DescriptorSet::State *TakeDescriptorSetState(DescSetRef &ref);
+    const BoundDescSet &GetBoundDescSet(const DescSetRef &ref) const { return bound_desc_sets[ref.bound_set]; }
+    std::vector<DescSetState> ResolveDescriptorSets(const DescBindingInfo &di_info) const;
 
     // Bindings: {error output buffer}
     const VkDescriptorSet &GetValidationCmdCommonDescriptorSet() const {
-        assert(validation_cmd_desc_set_ != VK_NULL_HANDLE);
-        return validation_cmd_desc_set_;
+        assert(resources_.validation_cmd_desc_set != VK_NULL_HANDLE);
+        return resources_.validation_cmd_desc_set;
     }
 
-    const VkDescriptorSetLayout &GetValidationCmdCommonDescriptorSetLayout() const {
-        assert(validation_cmd_desc_set_layout_ != VK_NULL_HANDLE);
-        return validation_cmd_desc_set_layout_;
-    }
+    VkDescriptorSetLayout GetValidationCmdCommonDescriptorSetLayout() const;
 
     uint32_t GetValidationErrorBufferDescSetIndex() const { return 0; }
 
     const VkBuffer &GetErrorOutputBuffer() const {
-        assert(error_output_buffer_.buffer != VK_NULL_HANDLE);
-        return error_output_buffer_.buffer;
+        assert(resources_.error_output_buffer.buffer != VK_NULL_HANDLE);
+        return resources_.error_output_buffer.buffer;
     }
 
-    VkDeviceSize GetCmdErrorsCountsBufferByteSize() const { return 8192 * sizeof(uint32_t); }
+    VkDeviceSize GetCmdErrorsCountsBufferByteSize() const { return CommandBufferResources::GetCmdErrorsCountsBufferByteSize(); }
 
     const VkBuffer &GetCmdErrorsCountsBuffer() const {
-        assert(cmd_errors_counts_buffer_.buffer != VK_NULL_HANDLE);
-        return cmd_errors_counts_buffer_.buffer;
+        assert(resources_.cmd_errors_counts_buffer.buffer != VK_NULL_HANDLE);
+        return resources_.cmd_errors_counts_buffer.buffer;
     }
 
-    const DeviceMemoryBlock &GetBdaRangesSnapshot() const { return bda_ranges_snapshot_; }
+    const DeviceMemoryBlock &GetBdaRangesSnapshot() const { return resources_.bda_ranges_snapshot; }
 
     void ClearCmdErrorsCountsBuffer() const;
 
+    // With the report_overhead setting, the consecutive action commands of a primary command buffer using the same pipeline
+    // form a range timed on the GPU. A timestamp is written before the first command of each range and at the end.
+    void BeginOverheadTiming(const Location& loc);
+    void TimeActionCommand(VkPipeline pipeline);
+    void EndOverheadTiming();
+
     void Destroy() final;
     void Reset() final;
 
@@ -125,26 +161,20 @@ class CommandBuffer : public gpu_tracker::CommandBuffer {
     void AllocateResources();
     void ResetCBState();
     bool NeedsPostProcess();
+    void ReadOverheadTimestamps();
 
-    VkDeviceSize GetBdaRangesBufferByteSize() const;
     [[nodiscard]] bool UpdateBdaRangesBuffer();
 
     Validator &state_;
 
-    VkDescriptorSetLayout instrumentation_desc_set_layout_ = VK_NULL_HANDLE;
-
-    VkDescriptorSetLayout validation_cmd_desc_set_layout_ = VK_NULL_HANDLE;
-    VkDescriptorSet validation_cmd_desc_set_ = VK_NULL_HANDLE;
-    VkDescriptorPool validation_cmd_desc_pool_ = VK_NULL_HANDLE;
-
-    // Buffer storing GPU-AV errors
-    DeviceMemoryBlock error_output_buffer_ = {};
-    // Buffer storing an error count per validated commands.
-    // Used to limit the number of errors a single command can emit.
-    DeviceMemoryBlock cmd_errors_counts_buffer_ = {};
-    // Buffer storing a snapshot of buffer device address ranges
-    DeviceMemoryBlock bda_ranges_snapshot_ = {};
+    // Acquired from Validator::cmd_buffer_resources_pool
+    CommandBufferResources resources_ = {};
     uint32_t bda_ranges_snapshot_version_ = 0;
+
+    static constexpr uint32_t kMaxOverheadTimestamps = 256;
+    VkQueryPool overhead_query_pool_ = VK_NULL_HANDLE;
+    std::vector<VkPipeline> timed_pipelines_;  // Pipeline of the range starting at each timestamp
+    bool overhead_timing_ended_ = false;
 };
 
 class Queue : public gpu_tracker::Queue {
@@ -152,7 +182,7 @@ class Queue : public gpu_tracker::Queue {
     Queue(Validator &state, VkQueue q, uint32_t index, VkDeviceQueueCreateFlags flags, const VkQueueFamilyProperties &qfp);
 
   protected:
-    uint64_t PreSubmit(std::vector<vvl::QueueSubmission> &&submissions) override;
+    uint64_t PreSubmit(SubmissionBatch &&submissions) override;
 };
 
 class Buffer : public vvl::Buffer {
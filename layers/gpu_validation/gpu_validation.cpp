@@ -15,8 +15,12 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cmath>
 #include <fstream>
+#include <iomanip>
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
 #include <unistd.h>
 #endif
@@ -106,10 +110,22 @@ static bool GpuValidateShader(const vvl::span<const uint32_t> &input, bool SetRe
 }
 
 // Call the SPIR-V Optimizer to run the instrumentation pass on the shader.
+// Number of instructions of a SPIR-V binary. The instructions start after the 5 words of the header, the word count of each
+// instruction is in the high 16 bits of its first word.
+static uint32_t CountSpirvInstructions(const uint32_t *words, size_t word_count) {
+    uint32_t instruction_count = 0;
+    for (size_t i = 5; i < word_count; i += std::max(words[i] >> 16, 1u)) {
+        instruction_count++;
+    }
+    return instruction_count;
+}
+
 bool Validator::InstrumentShader(const vvl::span<const uint32_t> &input, std::vector<uint32_t> &instrumented_spirv,
                                  const uint32_t unique_shader_id, const Location &loc) {
     if (aborted) return false;
     if (input[0] != spv::MagicNumber) return false;
+    auto span = TraceSpan("GpuAssisted", "InstrumentShader");
+    const auto start_time = std::chrono::steady_clock::now();
 
     const spvtools::MessageConsumer gpu_console_message_consumer =
         [this, loc](spv_message_level_t level, const char *, const spv_position_t &position, const char *message) -> void {
@@ -144,16 +160,12 @@ bool Validator::InstrumentShader(const vvl::span<const uint32_t> &input, std::ve
     spirv::Module module(binaries[0], unique_shader_id, desc_set_bind_index);
 
     // If descriptor indexing is enabled, enable length checks and updated descriptor checks
-    if (gpuav_settings.validate_descriptors) {
-        module.RunPassBindlessDescriptor();
-    }
-
-    if (gpuav_settings.validate_bda) {
-        module.RunPassBufferDeviceAddress();
-    }
-
-    if (gpuav_settings.validate_ray_query) {
-        module.RunPassRayQuery();
+    module.RunPasses(gpuav_settings.validate_descriptors, gpuav_settings.validate_bda, gpuav_settings.validate_ray_query,
+                     gpuav_settings.elide_static_descriptor_checks);
+    if (module.elided_descriptor_checks_ != 0) {
+        LogInfo("WARNING-GPU-Assisted-Validation", device, loc,
+                "%" PRIu32 " descriptor checks of shader %" PRIu32 " were elided, their descriptor index is in bounds.",
+                module.elided_descriptor_checks_, unique_shader_id);
     }
 
     for (const auto info : module.link_info_) {
@@ -205,6 +217,16 @@ bool Validator::InstrumentShader(const vvl::span<const uint32_t> &input, std::ve
         }
     }
 
+    if (gpuav_settings.report_overhead) {
+        ShaderOverhead overhead;
+        overhead.original_instruction_count = CountSpirvInstructions(input.data(), input.size());
+        overhead.instrumented_instruction_count = CountSpirvInstructions(instrumented_spirv.data(), instrumented_spirv.size());
+        overhead.instrumentation_time_ns = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time).count());
+        std::lock_guard<std::mutex> guard(overhead_lock_);
+        shader_overheads_[unique_shader_id] = overhead;
+    }
+
     return true;
 }
 
@@ -238,16 +260,15 @@ void Validator::UpdateInstrumentationBuffer(CommandBuffer *cb_node) {
         result = vmaMapMemory(vmaAllocator, cmd_info.bindless_state_buffer_allocation, reinterpret_cast<void **>(&bindless_state));
         assert(result == VK_SUCCESS);
         assert(bindless_state->global_state == desc_heap->GetDeviceAddress());
-        for (size_t i = 0; i < cmd_info.descriptor_set_buffers.size(); i++) {
-            auto &set_buffer = cmd_info.descriptor_set_buffers[i];
-            bindless_state->desc_sets[i].layout_data = set_buffer.state->GetLayoutState();
-            if (!set_buffer.gpu_state) {
-                set_buffer.gpu_state = set_buffer.state->GetCurrentState();
-                bindless_state->desc_sets[i].in_data = set_buffer.gpu_state->device_addr;
-            }
-            if (!set_buffer.output_state) {
-                set_buffer.output_state = set_buffer.state->GetOutputState();
-                bindless_state->desc_sets[i].out_data = set_buffer.output_state->device_addr;
+        for (size_t i = 0; i < cmd_info.descriptor_sets.size(); i++) {
+            DescSetRef &ref = cmd_info.descriptor_sets[i];
+            bindless_state->desc_sets[i].layout_data = cb_node->GetBoundDescSet(ref).state->GetLayoutState();
+            // Only the update-after-bind sets are left without a version when they are bound
+            if (ref.version == vvl::kU32Max) {
+                if (const DescriptorSet::State *gpu_state = cb_node->TakeDescriptorSetState(ref)) {
+                    bindless_state->desc_sets[i].in_data = gpu_state->device_addr;
+                }
+                bindless_state->desc_sets[i].out_data = cb_node->GetBoundDescSet(ref).output_state->device_addr;
             }
         }
         vmaUnmapMemory(vmaAllocator, cmd_info.bindless_state_buffer_allocation);
@@ -279,23 +300,10 @@ void Validator::UpdateBoundPipeline(VkCommandBuffer commandBuffer, VkPipelineBin
         return;
     }
 
-    // Update the last vkCmdBindDescriptorSet with the new pipeline
-    auto &descriptor_set_buffers = cb_node->di_input_buffer_list.back().descriptor_set_buffers;
-
-    // If the user calls vkCmdBindDescriptorSet::firstSet to a non-zero value, these indexes don't line up
-    size_t update_index = 0;
-    for (uint32_t i = 0; i < last_bound.per_set.size(); i++) {
-        if (last_bound.per_set[i].bound_descriptor_set) {
-            auto slot = last_bound.pipeline_state->active_slots.find(i);
-            if (slot != last_bound.pipeline_state->active_slots.end()) {
-                if (update_index >= descriptor_set_buffers.size()) {
-                    // TODO - Hit crash running with Dota2, this shouldn't happen, need to look into
-                    continue;
-                }
-                descriptor_set_buffers[update_index++].binding_req = slot->second;
-            }
-        }
-    }
+    // Update the last vkCmdBindDescriptorSet with the new pipeline, the bindings of its sets are looked up by set number
+    // in its active slots when they are validated
+    cb_node->di_input_buffer_list.back().pipeline =
+        std::static_pointer_cast<const vvl::Pipeline>(last_bound.pipeline_state->shared_from_this());
 }
 
 void Validator::UpdateBoundDescriptors(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, const Location &loc) {
@@ -319,7 +327,7 @@ void Validator::UpdateBoundDescriptors(VkCommandBuffer commandBuffer, VkPipeline
         buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
         VmaAllocationCreateInfo alloc_info = {};
         alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-        alloc_info.pool = VK_NULL_HANDLE;
+        alloc_info.pool = output_buffer_pool;
         DescBindingInfo di_buffers = {};
 
         // Allocate buffer for device addresses of the input buffer for each descriptor set.  This is the buffer written to each
@@ -343,6 +351,13 @@ void Validator::UpdateBoundDescriptors(VkCommandBuffer commandBuffer, VkPipeline
         cb_node->current_bindless_buffer = di_buffers.bindless_state_buffer;
 
         bindless_state->global_state = desc_heap->GetDeviceAddress();
+        // The pipeline might not have been bound yet, it will be set when it is
+        if (last_bound.pipeline_state) {
+            di_buffers.pipeline = std::static_pointer_cast<const vvl::Pipeline>(last_bound.pipeline_state->shared_from_this());
+        }
+        // Only a reference to the set and its version is kept per bind, the states themselves are shared by all the binds of
+        // the command buffer
+        di_buffers.descriptor_sets.reserve(number_of_sets);
         for (uint32_t i = 0; i < last_bound.per_set.size(); i++) {
             const auto &s = last_bound.per_set[i];
             auto set = s.bound_descriptor_set;
@@ -350,28 +365,20 @@ void Validator::UpdateBoundDescriptors(VkCommandBuffer commandBuffer, VkPipeline
                 continue;
             }
             if (gpuav_settings.validate_descriptors) {
-                DescSetState desc_set_state;
-                desc_set_state.num = i;
-                desc_set_state.state = std::static_pointer_cast<DescriptorSet>(set);
-                bindless_state->desc_sets[i].layout_data = desc_set_state.state->GetLayoutState();
-                // The pipeline might not have been bound yet, so will need to update binding_req later
-                if (last_bound.pipeline_state) {
-                    auto slot = last_bound.pipeline_state->active_slots.find(i);
-                    if (slot != last_bound.pipeline_state->active_slots.end()) {
-                        desc_set_state.binding_req = slot->second;
+                auto desc_set = std::static_pointer_cast<DescriptorSet>(set);
+                DescSetRef ref = cb_node->RecordDescriptorSet(i, desc_set);
+                bindless_state->desc_sets[i].layout_data = desc_set->GetLayoutState();
+                if (!desc_set->IsUpdateAfterBind()) {
+                    if (const DescriptorSet::State *gpu_state = cb_node->TakeDescriptorSetState(ref)) {
+                        bindless_state->desc_sets[i].in_data = gpu_state->device_addr;
                     }
+                    bindless_state->desc_sets[i].out_data = cb_node->GetBoundDescSet(ref).output_state->device_addr;
                 }
-                if (!desc_set_state.state->IsUpdateAfterBind()) {
-                    desc_set_state.gpu_state = desc_set_state.state->GetCurrentState();
-                    bindless_state->desc_sets[i].in_data = desc_set_state.gpu_state->device_addr;
-                    desc_set_state.output_state = desc_set_state.state->GetOutputState();
-                    bindless_state->desc_sets[i].out_data = desc_set_state.output_state->device_addr;
-                }
-                di_buffers.descriptor_set_buffers.emplace_back(std::move(desc_set_state));
+                di_buffers.descriptor_sets.emplace_back(ref);
             }
         }
-        cb_node->di_input_buffer_list.emplace_back(di_buffers);
         vmaUnmapMemory(vmaAllocator, di_buffers.bindless_state_buffer_allocation);
+        cb_node->di_input_buffer_list.emplace_back(std::move(di_buffers));
     }
 }
 
@@ -411,6 +418,10 @@ CommandResources Validator::AllocateActionCommandResources(const LockedSharedPtr
         return CommandResources();
     }
 
+    if (gpuav_settings.report_overhead) {
+        cmd_buffer->TimeActionCommand(pipeline_state ? pipeline_state->VkHandle() : VK_NULL_HANDLE);
+    }
+
     VkDescriptorSet instrumentation_desc_set = VK_NULL_HANDLE;
     VkDescriptorPool instrumentation_desc_pool = VK_NULL_HANDLE;
     VkResult result = desc_set_manager->GetDescriptorSet(
@@ -583,7 +594,6 @@ CommandResources Validator::AllocateActionCommandResources(const LockedSharedPtr
     cmd_resources.uses_shader_object = pipeline_state == nullptr;
     cmd_resources.command = loc.function;
     cmd_resources.desc_binding_index = di_buf_index;
-    cmd_resources.desc_binding_list = &cmd_buffer->di_input_buffer_list;
     return cmd_resources;
 }
 
@@ -599,6 +609,133 @@ CommandResources Validator::AllocateActionCommandResources(VkCommandBuffer cmd_b
     return AllocateActionCommandResources(cb_node, bind_point, loc, indirect_state);
 }
 
+std::pair<size_t, size_t> Validator::CopyBufferAddressRanges(BufferAddressRange *out_ranges, size_t out_ranges_size,
+                                                             uint32_t &out_version) {
+    const auto copy_cache = [&]() -> std::pair<size_t, size_t> {
+        const size_t written_count = std::min(out_ranges_size, bda_ranges_cache_.size());
+        std::copy_n(bda_ranges_cache_.data(), written_count, out_ranges);
+        out_version = bda_ranges_cache_version_;
+        return {written_count, bda_ranges_cache_.size()};
+    };
+    {
+        ReadLockGuard guard(bda_ranges_cache_lock_);
+        if (bda_ranges_cache_version_ == buffer_device_address_ranges_version) {
+            return copy_cache();
+        }
+    }
+    WriteLockGuard guard(bda_ranges_cache_lock_);
+    // Another command buffer may have rebuilt the cache in the meantime
+    if (bda_ranges_cache_version_ != buffer_device_address_ranges_version) {
+        bda_ranges_cache_version_ = GetBufferAddressRanges(bda_ranges_cache_);
+    }
+    return copy_cache();
+}
+
+void Validator::UpdatePeakMemoryUsage() {
+    const VkPhysicalDeviceMemoryProperties *memory_props = nullptr;
+    vmaGetMemoryProperties(vmaAllocator, &memory_props);
+    std::array<VmaBudget, VK_MAX_MEMORY_HEAPS> budgets;
+    vmaGetHeapBudgets(vmaAllocator, budgets.data());
+    VkDeviceSize usage = 0;
+    for (uint32_t heap_i = 0; heap_i < memory_props->memoryHeapCount; ++heap_i) {
+        usage += budgets[heap_i].statistics.blockBytes;
+    }
+    VkDeviceSize peak = peak_memory_usage_.load();
+    while (usage > peak && !peak_memory_usage_.compare_exchange_weak(peak, usage)) {
+    }
+}
+
+void Validator::ReportMemoryUsage(const Location &loc) {
+    UpdatePeakMemoryUsage();
+    VmaStatistics persistent_stats = {};
+    if (persistent_buffer_pool) {
+        vmaGetPoolStatistics(vmaAllocator, persistent_buffer_pool, &persistent_stats);
+    }
+    VmaStatistics output_stats = {};
+    if (output_buffer_pool) {
+        vmaGetPoolStatistics(vmaAllocator, output_buffer_pool, &output_stats);
+    }
+    const uint64_t budget = uint64_t(gpuav_settings.memory_budget) * 1024 * 1024;
+    LogInfo("WARNING-GPU-Assisted-Validation", device, loc,
+            "GPU-AV device memory usage: peak of %" PRIu64 " bytes (budget per heap: %s). At device destruction, the persistent "
+            "pool holds %" PRIu32 " allocations in %" PRIu64 " bytes and the command buffer pool holds %" PRIu32
+            " allocations in %" PRIu64 " bytes.",
+            uint64_t(peak_memory_usage_.load()), budget ? std::to_string(budget).c_str() : "none",
+            persistent_stats.allocationCount, uint64_t(persistent_stats.blockBytes), output_stats.allocationCount,
+            uint64_t(output_stats.blockBytes));
+}
+
+void Validator::AddPipelineGpuTime(VkPipeline pipeline, uint64_t time_ns) {
+    std::lock_guard<std::mutex> guard(overhead_lock_);
+    auto [it, inserted] = pipeline_gpu_times_.try_emplace(pipeline);
+    PipelineGpuTime &gpu_time = it->second;
+    if (inserted) {
+        gpu_time.name = pipeline != VK_NULL_HANDLE ? FormatHandle(pipeline) : "Shader objects";
+        if (pipeline != VK_NULL_HANDLE) {
+            for (const auto &[shader_id, tracker] : shader_map.snapshot(
+                     [pipeline](const GpuAssistedShaderTracker &entry) { return entry.pipeline == pipeline; })) {
+                gpu_time.shader_ids.emplace_back(shader_id);
+            }
+        }
+    }
+    gpu_time.time_ns += time_ns;
+    gpu_time.range_count++;
+}
+
+void Validator::ReportOverhead(const Location &loc) {
+    std::lock_guard<std::mutex> guard(overhead_lock_);
+    if (pipeline_gpu_times_.empty() && shader_overheads_.empty()) {
+        return;
+    }
+
+    std::vector<const PipelineGpuTime *> sorted_gpu_times;
+    sorted_gpu_times.reserve(pipeline_gpu_times_.size());
+    for (const auto &[pipeline, gpu_time] : pipeline_gpu_times_) {
+        sorted_gpu_times.emplace_back(&gpu_time);
+    }
+    std::sort(sorted_gpu_times.begin(), sorted_gpu_times.end(),
+              [](const PipelineGpuTime *lhs, const PipelineGpuTime *rhs) { return lhs->time_ns > rhs->time_ns; });
+
+    vvl::unordered_set<uint32_t> reported_shaders;
+    std::ostringstream strm;
+    strm << std::fixed << std::setprecision(3);
+    const auto print_shader = [&](uint32_t shader_id) {
+        auto it = shader_overheads_.find(shader_id);
+        if (it == shader_overheads_.end()) {
+            // Loaded from the instrumented shader cache, it was not instrumented by this run
+            strm << "\n    Shader " << shader_id << ": no instrumentation data";
+            return;
+        }
+        const ShaderOverhead &overhead = it->second;
+        strm << "\n    Shader " << shader_id << ": " << overhead.original_instruction_count << " -> "
+             << overhead.instrumented_instruction_count << " instructions, instrumented in "
+             << double(overhead.instrumentation_time_ns) / 1e6 << " ms";
+        reported_shaders.insert(shader_id);
+    };
+
+    strm << "GPU-AV overhead, pipelines sorted by GPU time of their validated commands:";
+    for (const PipelineGpuTime *gpu_time : sorted_gpu_times) {
+        strm << "\n" << gpu_time->name << ": " << double(gpu_time->time_ns) / 1e6 << " ms of GPU time in "
+             << gpu_time->range_count << " command ranges";
+        for (uint32_t shader_id : gpu_time->shader_ids) {
+            print_shader(shader_id);
+        }
+    }
+    bool header_printed = false;
+    for (const auto &[shader_id, overhead] : shader_overheads_) {
+        if (reported_shaders.count(shader_id) != 0) {
+            continue;
+        }
+        if (!header_printed) {
+            strm << "\nInstrumented shaders of pipelines that were not timed:";
+            header_printed = true;
+        }
+        print_shader(shader_id);
+    }
+
+    LogInfo("WARNING-GPU-Assisted-Validation", device, loc, "%s", strm.str().c_str());
+}
+
 bool Validator::AllocateOutputMem(DeviceMemoryBlock &output_mem, const Location &loc) {
     VkBufferCreateInfo buffer_info = vku::InitStructHelper();
     buffer_info.size = output_buffer_byte_size;
@@ -657,60 +794,11 @@ std::unique_ptr<CommandResources> Validator::AllocatePreDrawIndirectValidationRe
         const auto *pipeline_state = last_bound.pipeline_state;
         const bool use_shader_objects = pipeline_state == nullptr;
 
-        PreDrawResources::SharedResources *shared_resources =
-            GetSharedDrawIndirectValidationResources(cb_node->GetValidationCmdCommonDescriptorSetLayout(), use_shader_objects, loc);
-        if (!shared_resources) {
-            return nullptr;
-        }
-
         draw_resources->indirect_buffer = indirect_buffer;
         draw_resources->indirect_buffer_offset = indirect_offset;
         draw_resources->indirect_buffer_stride = stride;
 
-        VkPipeline validation_pipeline = VK_NULL_HANDLE;
-        if (!use_shader_objects) {
-            validation_pipeline = GetDrawValidationPipeline(*shared_resources, cb_node->activeRenderPass.get()->VkHandle(), loc);
-            if (validation_pipeline == VK_NULL_HANDLE) {
-                ReportSetupProblem(cmd_buffer, loc, "Could not find or create a pipeline. Aborting GPU-AV");
-                aborted = true;
-                return nullptr;
-            }
-        }
-        VkResult result = VK_SUCCESS;
-        result = desc_set_manager->GetDescriptorSet(&draw_resources->desc_pool, shared_resources->ds_layout,
-                                                    &draw_resources->buffer_desc_set);
-        if (result != VK_SUCCESS) {
-            ReportSetupProblem(cmd_buffer, loc, "Unable to allocate descriptor set. Aborting GPU-AV");
-            aborted = true;
-            return nullptr;
-        }
-
-        std::vector<VkDescriptorBufferInfo> buffer_infos;
-        buffer_infos.emplace_back(VkDescriptorBufferInfo{indirect_buffer, 0, VK_WHOLE_SIZE});
-        if (count_buffer) {
-            buffer_infos.emplace_back(VkDescriptorBufferInfo{count_buffer, 0, VK_WHOLE_SIZE});
-        }
-
-        std::vector<VkWriteDescriptorSet> desc_writes{};
-        for (size_t i = 0; i < buffer_infos.size(); ++i) {
-            VkWriteDescriptorSet &desc_write = desc_writes.emplace_back();
-            desc_write = vku::InitStructHelper();
-            desc_write.dstBinding = uint32_t(i);
-            desc_write.descriptorCount = 1;
-            desc_write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-            desc_write.pBufferInfo = &buffer_infos[i];
-            desc_write.dstSet = draw_resources->buffer_desc_set;
-        }
-        DispatchUpdateDescriptorSets(device, static_cast<uint32_t>(desc_writes.size()), desc_writes.data(), 0, NULL);
-
-        // Insert a draw that can examine some device memory right before the draw we're validating (Pre Draw Validation)
-        //
-        // NOTE that this validation does not attempt to abort invalid api calls as most other validation does. A crash
-        // or DEVICE_LOST resulting from the invalid call will prevent preceeding validation errors from being reported.
-
-        // Save current graphics pipeline state
         const vvl::Func command = loc.function;
-        RestorablePipelineState restorable_state(*cb_node, VK_PIPELINE_BIND_POINT_GRAPHICS);
         const bool is_mesh_call =
             (command == Func::vkCmdDrawMeshTasksIndirectCountEXT || command == Func::vkCmdDrawMeshTasksIndirectCountNV ||
              command == Func::vkCmdDrawMeshTasksIndirectEXT || command == Func::vkCmdDrawMeshTasksIndirectNV);
@@ -796,6 +884,73 @@ std::unique_ptr<CommandResources> Validator::AllocatePreDrawIndirectValidationRe
             }
         }
 
+        // The validation draw does not check anything for this command (ex. a vkCmdDrawIndirect with drawIndirectFirstInstance
+        // enabled), don't record it
+        if (push_constants[0] == 0) {
+            CommandResources cmd_resources = AllocateActionCommandResources(cb_node, VK_PIPELINE_BIND_POINT_GRAPHICS, loc);
+            return std::make_unique<CommandResources>(cmd_resources);
+        }
+
+        PreDrawResources::SharedResources *shared_resources =
+            GetSharedDrawIndirectValidationResources(cb_node->GetValidationCmdCommonDescriptorSetLayout(), use_shader_objects, loc);
+        if (!shared_resources) {
+            return nullptr;
+        }
+
+        VkPipeline validation_pipeline = VK_NULL_HANDLE;
+        if (!use_shader_objects) {
+            validation_pipeline = GetDrawValidationPipeline(*shared_resources, cb_node->activeRenderPass.get()->VkHandle(), loc);
+            if (validation_pipeline == VK_NULL_HANDLE) {
+                ReportSetupProblem(cmd_buffer, loc, "Could not find or create a pipeline. Aborting GPU-AV");
+                aborted = true;
+                return nullptr;
+            }
+        }
+
+        // The validation draws of the command buffer reading the same buffers share their descriptor set, it is owned by the
+        // resources of the first one
+        const PreDrawResources::BufferDescSetKey desc_set_key{indirect_buffer, count_buffer};
+        VkDescriptorSet buffer_desc_set = VK_NULL_HANDLE;
+        if (auto it = cb_node->pre_draw_buffer_desc_sets.find(desc_set_key); it != cb_node->pre_draw_buffer_desc_sets.end()) {
+            buffer_desc_set = it->second;
+        } else {
+            VkResult result = desc_set_manager->GetDescriptorSet(&draw_resources->desc_pool, shared_resources->ds_layout,
+                                                                 &draw_resources->buffer_desc_set);
+            if (result != VK_SUCCESS) {
+                ReportSetupProblem(cmd_buffer, loc, "Unable to allocate descriptor set. Aborting GPU-AV");
+                aborted = true;
+                return nullptr;
+            }
+            buffer_desc_set = draw_resources->buffer_desc_set;
+
+            std::vector<VkDescriptorBufferInfo> buffer_infos;
+            buffer_infos.emplace_back(VkDescriptorBufferInfo{indirect_buffer, 0, VK_WHOLE_SIZE});
+            if (count_buffer) {
+                buffer_infos.emplace_back(VkDescriptorBufferInfo{count_buffer, 0, VK_WHOLE_SIZE});
+            }
+
+            std::vector<VkWriteDescriptorSet> desc_writes{};
+            for (size_t i = 0; i < buffer_infos.size(); ++i) {
+                VkWriteDescriptorSet &desc_write = desc_writes.emplace_back();
+                desc_write = vku::InitStructHelper();
+                desc_write.dstBinding = uint32_t(i);
+                desc_write.descriptorCount = 1;
+                desc_write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                desc_write.pBufferInfo = &buffer_infos[i];
+                desc_write.dstSet = buffer_desc_set;
+            }
+            DispatchUpdateDescriptorSets(device, static_cast<uint32_t>(desc_writes.size()), desc_writes.data(), 0, NULL);
+            cb_node->pre_draw_buffer_desc_sets.emplace(desc_set_key, buffer_desc_set);
+        }
+
+        // Insert a draw that can examine some device memory right before the draw we're validating (Pre Draw Validation)
+        //
+        // NOTE that this validation does not attempt to abort invalid api calls as most other validation does. A crash
+        // or DEVICE_LOST resulting from the invalid call will prevent preceeding validation errors from being reported.
+
+        // Save current graphics pipeline state
+        RestorablePipelineState restorable_state(*cb_node, VK_PIPELINE_BIND_POINT_GRAPHICS);
+
         // Insert diagnostic draw
         if (use_shader_objects) {
             VkShaderStageFlagBits stage = VK_SHADER_STAGE_VERTEX_BIT;
@@ -809,7 +964,7 @@ std::unique_ptr<CommandResources> Validator::AllocatePreDrawIndirectValidationRe
         BindDiagnosticCallsCommonDescSet(cb_node, VK_PIPELINE_BIND_POINT_GRAPHICS, shared_resources->pipeline_layout,
                                          cb_node->draw_index, static_cast<uint32_t>(cb_node->per_command_resources.size()));
         DispatchCmdBindDescriptorSets(cmd_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, shared_resources->pipeline_layout,
-                                      glsl::kDiagPerCmdDescriptorSet, 1, &draw_resources->buffer_desc_set, 0, nullptr);
+                                      glsl::kDiagPerCmdDescriptorSet, 1, &buffer_desc_set, 0, nullptr);
         DispatchCmdDraw(cmd_buffer, 3, 1, 0, 0);
 
         CommandResources cmd_resources = AllocateActionCommandResources(cb_node, VK_PIPELINE_BIND_POINT_GRAPHICS, loc);
@@ -1099,7 +1254,8 @@ PreDispatchResources::SharedResources *Validator::GetSharedDispatchIndirectValid
         pipeline_ci.stage = pipeline_stage_ci;
         pipeline_ci.layout = shared_resources->pipeline_layout;
 
-        result = DispatchCreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipeline_ci, nullptr, &shared_resources->pipeline);
+        result =
+            DispatchCreateComputePipelines(device, internal_pipeline_cache, 1, &pipeline_ci, nullptr, &shared_resources->pipeline);
 
         DispatchDestroyShaderModule(device, validation_shader, nullptr);
 
@@ -1253,8 +1409,8 @@ PreTraceRaysResources::SharedResources *Validator::GetSharedTraceRaysValidationR
     rt_pipeline_create_info.pGroups = &raygen_group_ci;
     rt_pipeline_create_info.maxPipelineRayRecursionDepth = 1;
     rt_pipeline_create_info.layout = shared_resources->pipeline_layout;
-    result = DispatchCreateRayTracingPipelinesKHR(device, VK_NULL_HANDLE, VK_NULL_HANDLE, 1, &rt_pipeline_create_info, nullptr,
-                                                  &shared_resources->pipeline);
+    result = DispatchCreateRayTracingPipelinesKHR(device, VK_NULL_HANDLE, internal_pipeline_cache, 1, &rt_pipeline_create_info,
+                                                  nullptr, &shared_resources->pipeline);
 
     DispatchDestroyShaderModule(device, validation_shader, nullptr);
 
@@ -1642,7 +1798,7 @@ PreCopyBufferToImageResources::SharedResources *Validator::GetSharedCopyBufferTo
     pipeline_ci.stage = pipeline_stage_ci;
     pipeline_ci.layout = shared_resources->pipeline_layout;
 
-    result = DispatchCreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipeline_ci, nullptr, &shared_resources->pipeline);
+    result = DispatchCreateComputePipelines(device, internal_pipeline_cache, 1, &pipeline_ci, nullptr, &shared_resources->pipeline);
     if (result != VK_SUCCESS) {
         ReportSetupProblem(device, loc, "Failed to create compute pipeline for copy buffer to image validation. Aborting GPU-AV.");
     }
@@ -1694,7 +1850,8 @@ VkPipeline Validator::GetDrawValidationPipeline(PreDrawResources::SharedResource
     pipeline_ci.stageCount = 1;
     pipeline_ci.pStages = &pipeline_stage_ci;
 
-    VkResult result = DispatchCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipeline_ci, nullptr, &validation_pipeline);
+    VkResult result =
+        DispatchCreateGraphicsPipelines(device, internal_pipeline_cache, 1, &pipeline_ci, nullptr, &validation_pipeline);
     if (result != VK_SUCCESS) {
         ReportSetupProblem(device, loc, "Unable to create graphics pipeline. Aborting GPU-AV");
         aborted = true;
@@ -1717,7 +1874,21 @@ void Validator::StoreCommandResources(const VkCommandBuffer cmd_buffer, std::uni
         return;
     }
 
-    cb_node->per_command_resources.emplace_back(std::move(command_resources));
+    cb_node->per_command_resources.Add(std::move(command_resources));
+}
+
+void Validator::StoreCommandResources(const VkCommandBuffer cmd_buffer, const CommandResources &command_resources,
+                                      const Location &loc) {
+    if (aborted) return;
+
+    auto cb_node = GetWrite<CommandBuffer>(cmd_buffer);
+    if (!cb_node) {
+        ReportSetupProblem(cmd_buffer, loc, "Unrecognized command buffer");
+        aborted = true;
+        return;
+    }
+
+    cb_node->per_command_resources.Add(command_resources);
 }
 
 }  // namespace gpuav
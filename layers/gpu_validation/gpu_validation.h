@@ -131,6 +131,22 @@ class Validator : public GpuShaderInstrumentor {
     // Allocate memory for the output block that the gpu will use to return any error information
     [[nodiscard]] bool AllocateOutputMem(DeviceMemoryBlock& output_mem, const Location& loc);
 
+    // Per command buffer resources, recycled between command buffers
+    CommandBufferResourcesPool cmd_buffer_resources_pool;
+
+    // Record the memory allocated by GPU-AV if it is the highest seen so far, only used by the report_memory_usage setting
+    void UpdatePeakMemoryUsage();
+    void ReportMemoryUsage(const Location& loc);
+
+    // Only used by the report_overhead setting
+    void AddPipelineGpuTime(VkPipeline pipeline, uint64_t time_ns);
+    void ReportOverhead(const Location& loc);
+
+    // Copy the buffer device address ranges, sorted from low to high, in out_ranges.
+    // Return a count pair, {written addresses count, total address ranges count}, and the version of the copied ranges.
+    [[nodiscard]] std::pair<size_t, size_t> CopyBufferAddressRanges(BufferAddressRange* out_ranges, size_t out_ranges_size,
+                                                                    uint32_t& out_version);
+
     [[nodiscard]] std::unique_ptr<CommandResources> AllocatePreDrawIndirectValidationResources(
         const Location& loc, VkCommandBuffer cmd_buffer, VkBuffer indirect_buffer, VkDeviceSize indirect_offset,
         uint32_t draw_count, VkBuffer count_buffer, VkDeviceSize count_buffer_offset, uint32_t stride);
@@ -161,6 +177,7 @@ class Validator : public GpuShaderInstrumentor {
 
     void StoreCommandResources(const VkCommandBuffer cmd_buffer, std::unique_ptr<CommandResources> command_resources,
                                const Location& loc);
+    void StoreCommandResources(const VkCommandBuffer cmd_buffer, const CommandResources& command_resources, const Location& loc);
 
     using TypeInfoRef = std::reference_wrapper<const std::type_info>;
     struct Hasher {
@@ -218,6 +235,9 @@ class Validator : public GpuShaderInstrumentor {
                                    chassis::CreateBuffer& chassis_state) override;
     void PreCallRecordDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator,
                                         const RecordObject& record_obj) override;
+    void PostCallRecordBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo,
+                                          const RecordObject& record_obj) override;
+    void PreCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, const RecordObject& record_obj) override;
 
     void PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                          const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule,
@@ -486,10 +506,39 @@ class Validator : public GpuShaderInstrumentor {
 
     VkBool32 shaderInt64 = false;
     std::string instrumented_shader_cache_path{};
+    // Driver pipeline cache of the internal validation pipelines, kept on disk next to the instrumented shader cache
+    VkPipelineCache internal_pipeline_cache = VK_NULL_HANDLE;
+    std::string internal_pipeline_cache_path{};
+    size_t internal_pipeline_cache_loaded_size = 0;
 
     bool bda_validation_possible = false;
 
     std::optional<DescriptorHeap> desc_heap{};  // optional only to defer construction
+
+    // Flat copy of the buffer device address ranges shared by all the command buffers updating their snapshot, so that the
+    // address map is only walked once per buffer_device_address_ranges_version
+    mutable std::shared_mutex bda_ranges_cache_lock_;
+    std::vector<BufferAddressRange> bda_ranges_cache_;
+    uint32_t bda_ranges_cache_version_ = 0;
+
+    std::atomic<VkDeviceSize> peak_memory_usage_{0};
+
+    // Cost of the instrumentation of each shader and GPU time of each pipeline, gathered with the report_overhead setting
+    struct ShaderOverhead {
+        uint32_t original_instruction_count = 0;
+        uint32_t instrumented_instruction_count = 0;
+        uint64_t instrumentation_time_ns = 0;
+    };
+    struct PipelineGpuTime {
+        uint64_t time_ns = 0;
+        uint32_t range_count = 0;
+        // Gathered when the pipeline is first timed, the pipeline may be destroyed before the report
+        std::string name;
+        std::vector<uint32_t> shader_ids;
+    };
+    std::mutex overhead_lock_;
+    vvl::unordered_map<uint32_t, ShaderOverhead> shader_overheads_;  // Key is the unique shader id
+    vvl::unordered_map<VkPipeline, PipelineGpuTime> pipeline_gpu_times_;  // VK_NULL_HANDLE for shader objects
 };
 
 struct RestorablePipelineState {
@@ -214,7 +214,67 @@ uint32_t BindlessDescriptorPass::GetLastByte(BasicBlock& block) {
     return new_sum_id;
 }
 
+// The checks made in a block are still valid in the merge block it was split into, as it is dominated by it
+static uint32_t GetMergeBlockLabel(const BasicBlock& block) {
+    if (block.instructions_.size() < 2) {
+        return 0;
+    }
+    const Instruction& merge_inst = **std::prev(block.instructions_.end(), 2);
+    return merge_inst.Opcode() == spv::OpSelectionMerge ? merge_inst.Word(1) : 0;
+}
+
 uint32_t BindlessDescriptorPass::CreateFunctionCall(BasicBlock& block) {
+    const uint32_t opcode = target_instruction_->Opcode();
+    const bool texel_access =
+        image_inst_ && (opcode == spv::OpImageRead || opcode == spv::OpImageFetch || opcode == spv::OpImageWrite);
+
+    if (image_inst_ && !texel_access) {
+        // if not a direct read/write/fetch, will be a OpSampledImage
+        // "All OpSampledImage instructions must be in the same block in which their Result <id> are consumed"
+        // the simple way around this is to add a OpCopyObject to be consumed by the target instruction
+        uint32_t image_id = target_instruction_->Operand(0);
+        const Instruction* sampled_image_inst = block.function_.FindInstruction(image_id);
+        // TODO - Add tests to understand what else can be here other then OpSampledImage
+        if (sampled_image_inst->Opcode() == spv::OpSampledImage) {
+            const uint32_t type_id = sampled_image_inst->TypeId();
+            const uint32_t copy_id = module_.TakeNextId();
+            const_cast<Instruction*>(target_instruction_)->ReplaceOperandId(image_id, copy_id);
+
+            // incase the OpSampledImage is shared, copy the previous OpCopyObject
+            auto copied = copy_object_map_.find(image_id);
+            if (copied != copy_object_map_.end()) {
+                image_id = copied->second;
+                block.CreateInstruction(spv::OpCopyObject, {type_id, copy_id, image_id});
+            } else {
+                copy_object_map_.emplace(image_id, copy_id);
+                // slower, but need to guarantee it is placed after a OpSampledImage
+                block.function_.CreateInstruction(spv::OpCopyObject, {type_id, copy_id, image_id}, image_id);
+            }
+        }
+    }
+
+    // An access to the same descriptor and offset as an earlier check of the block gets the same result, so that result is
+    // reused instead of calling the check function again. Reads and writes are kept apart to still report both.
+    if (!checked_block_ || block.GetLabelId() != GetMergeBlockLabel(*checked_block_)) {
+        block_checks_.clear();
+    }
+    checked_block_ = &block;
+
+    const bool is_write = opcode == spv::OpStore || opcode == spv::OpImageWrite;
+    std::vector<uint32_t> check_key = {is_write ? 1u : 0u, texel_access ? target_instruction_->Operand(1) : 0u};
+    if (access_chain_inst_->Opcode() == spv::OpAccessChain) {
+        check_key.push_back(access_chain_inst_->TypeId());
+        for (uint32_t i = 3; i < access_chain_inst_->Length(); i++) {
+            check_key.push_back(access_chain_inst_->Word(i));
+        }
+    } else {
+        check_key.push_back(access_chain_inst_->ResultId());
+    }
+    auto check_it = block_checks_.find(check_key);
+    if (check_it != block_checks_.end()) {
+        return check_it->second;
+    }
+
     // Add any debug information to pass into the function call
     const uint32_t stage_info_id = GetStageInfo(block.function_);
     const uint32_t inst_position = target_instruction_->position_index_;
@@ -224,53 +284,27 @@ uint32_t BindlessDescriptorPass::CreateFunctionCall(BasicBlock& block) {
     const Constant& binding_constant = module_.type_manager_.GetConstantUInt32(descriptor_binding_);
     const uint32_t descriptor_index_id = CastToUint32(descriptor_index_id_, block);  // might be int32
 
-    if (image_inst_) {
+    if (texel_access) {
         // Get Texel buffer offset
-        const uint32_t opcode = target_instruction_->Opcode();
-        if (opcode == spv::OpImageRead || opcode == spv::OpImageFetch || opcode == spv::OpImageWrite) {
-            const uint32_t image_operand_position = OpcodeImageOperandsPosition(opcode);
-            if (target_instruction_->Length() > image_operand_position) {
-                const uint32_t image_operand_word = target_instruction_->Word(image_operand_position);
-                if ((image_operand_word & (spv::ImageOperandsConstOffsetMask | spv::ImageOperandsOffsetMask)) != 0) {
-                    // TODO - Add support if there are image operands (like offset)
-                }
+        const uint32_t image_operand_position = OpcodeImageOperandsPosition(opcode);
+        if (target_instruction_->Length() > image_operand_position) {
+            const uint32_t image_operand_word = target_instruction_->Word(image_operand_position);
+            if ((image_operand_word & (spv::ImageOperandsConstOffsetMask | spv::ImageOperandsOffsetMask)) != 0) {
+                // TODO - Add support if there are image operands (like offset)
             }
+        }
 
-            const Type* image_type = module_.type_manager_.FindTypeById(image_inst_->TypeId());
-            const uint32_t dim = image_type->inst_.Operand(1);
-            if (dim == spv::DimBuffer) {
-                const uint32_t depth = image_type->inst_.Operand(2);
-                const uint32_t arrayed = image_type->inst_.Operand(3);
-                const uint32_t ms = image_type->inst_.Operand(4);
-                if (depth == 0 && arrayed == 0 && ms == 0) {
-                    descriptor_offset_id_ = CastToUint32(target_instruction_->Operand(1), block);
-                }
-            }
-        } else {
-            // if not a direct read/write/fetch, will be a OpSampledImage
-            // "All OpSampledImage instructions must be in the same block in which their Result <id> are consumed"
-            // the simple way around this is to add a OpCopyObject to be consumed by the target instruction
-            uint32_t image_id = target_instruction_->Operand(0);
-            const Instruction* sampled_image_inst = block.function_.FindInstruction(image_id);
-            // TODO - Add tests to understand what else can be here other then OpSampledImage
-            if (sampled_image_inst->Opcode() == spv::OpSampledImage) {
-                const uint32_t type_id = sampled_image_inst->TypeId();
-                const uint32_t copy_id = module_.TakeNextId();
-                const_cast<Instruction*>(target_instruction_)->ReplaceOperandId(image_id, copy_id);
-
-                // incase the OpSampledImage is shared, copy the previous OpCopyObject
-                auto copied = copy_object_map_.find(image_id);
-                if (copied != copy_object_map_.end()) {
-                    image_id = copied->second;
-                    block.CreateInstruction(spv::OpCopyObject, {type_id, copy_id, image_id});
-                } else {
-                    copy_object_map_.emplace(image_id, copy_id);
-                    // slower, but need to guarantee it is placed after a OpSampledImage
-                    block.function_.CreateInstruction(spv::OpCopyObject, {type_id, copy_id, image_id}, image_id);
-                }
+        const Type* image_type = module_.type_manager_.FindTypeById(image_inst_->TypeId());
+        const uint32_t dim = image_type->inst_.Operand(1);
+        if (dim == spv::DimBuffer) {
+            const uint32_t depth = image_type->inst_.Operand(2);
+            const uint32_t arrayed = image_type->inst_.Operand(3);
+            const uint32_t ms = image_type->inst_.Operand(4);
+            if (depth == 0 && arrayed == 0 && ms == 0) {
+                descriptor_offset_id_ = CastToUint32(target_instruction_->Operand(1), block);
             }
         }
-    } else {
+    } else if (!image_inst_) {
         // For now, only do bounds check for non-aggregate types
         // TODO - Do bounds check for aggregate loads and stores
         assert(access_chain_inst_ && var_inst_);
@@ -294,6 +328,7 @@ uint32_t BindlessDescriptorPass::CreateFunctionCall(BasicBlock& block) {
                             {bool_type, function_result, function_def, inst_position_constant.Id(), stage_info_id,
                              set_constant.Id(), binding_constant.Id(), descriptor_index_id, descriptor_offset_id_});
 
+    block_checks_.emplace(std::move(check_key), function_result);
     return function_result;
 }
 
@@ -308,6 +343,82 @@ void BindlessDescriptorPass::Reset() {
     descriptor_offset_id_ = 0;
 }
 
+// Only integer OpConstant are known, a OpSpecConstant can still be changed when creating the pipeline
+bool BindlessDescriptorPass::FindConstantValue(uint32_t id, uint32_t& value) const {
+    const Constant* constant = module_.type_manager_.FindConstantById(id);
+    if (!constant || constant->type_.spv_type_ != SpvType::kInt) {
+        return false;
+    }
+    if (constant->inst_.Opcode() == spv::OpConstantNull) {
+        value = 0;
+        return true;
+    }
+    // 64-bit values that do not fit in 32 bits are never in bounds
+    if (constant->inst_.Opcode() != spv::OpConstant || (constant->inst_.Length() > 4 && constant->inst_.Word(4) != 0)) {
+        return false;
+    }
+    value = constant->inst_.Word(3);
+    return true;
+}
+
+// A simple range analysis of the index, it is either a constant or masked by a constant
+bool BindlessDescriptorPass::IsIndexInBounds(const Function& function, uint32_t index_id, uint32_t array_length) const {
+    uint32_t value = 0;
+    if (FindConstantValue(index_id, value)) {
+        return value < array_length;
+    }
+
+    const Instruction* index_inst = function.FindInstruction(index_id);
+    if (!index_inst) {
+        return false;
+    }
+    switch (index_inst->Opcode()) {
+        case spv::OpBitwiseAnd:
+            // (index & mask) <= mask
+            return (FindConstantValue(index_inst->Operand(0), value) && value < array_length) ||
+                   (FindConstantValue(index_inst->Operand(1), value) && value < array_length);
+        case spv::OpUMod:
+            // (index % divisor) < divisor
+            return FindConstantValue(index_inst->Operand(1), value) && value != 0 && value <= array_length;
+        default:
+            break;
+    }
+    return false;
+}
+
+// The descriptorCount of the binding in the pipeline layout is at least the size of the array in the shader, so an index proven
+// in bounds of the SPIR-V array type never fails the bounds check. The other checks of the access (uninitialized or destroyed
+// descriptors) are left to the draw time validation, only the accesses without a byte offset to check are skipped.
+bool BindlessDescriptorPass::IsStaticallyValid(const Function& function) const {
+    if (image_inst_) {
+        const uint32_t opcode = target_instruction_->Opcode();
+        if (opcode == spv::OpImageRead || opcode == spv::OpImageFetch || opcode == spv::OpImageWrite) {
+            const Type* image_type = module_.type_manager_.FindTypeById(image_inst_->TypeId());
+            if (!image_type || image_type->inst_.Operand(1) == spv::DimBuffer) {
+                return false;  // texel offset
+            }
+        }
+    } else {
+        const Type* pointer_type = module_.type_manager_.FindTypeById(access_chain_inst_->TypeId());
+        const Type* pointee_type = module_.type_manager_.FindTypeById(pointer_type->inst_.Word(3));
+        if (!pointee_type || (pointee_type->spv_type_ != SpvType::kArray && pointee_type->spv_type_ != SpvType::kRuntimeArray &&
+                              pointee_type->spv_type_ != SpvType::kStruct)) {
+            return false;  // byte offset
+        }
+    }
+
+    const Type* pointer_type = module_.type_manager_.FindTypeById(var_inst_->TypeId());
+    const Type* descriptor_type = module_.type_manager_.FindTypeById(pointer_type->inst_.Word(3));
+    if (descriptor_type->spv_type_ == SpvType::kRuntimeArray) {
+        return false;
+    }
+    uint32_t array_length = 1;
+    if (descriptor_type->spv_type_ == SpvType::kArray && !FindConstantValue(descriptor_type->inst_.Operand(1), array_length)) {
+        return false;
+    }
+    return IsIndexInBounds(function, descriptor_index_id_, array_length);
+}
+
 bool BindlessDescriptorPass::AnalyzeInstruction(const Function& function, const Instruction& inst) {
     const uint32_t opcode = inst.Opcode();
 
@@ -422,6 +533,12 @@ bool BindlessDescriptorPass::AnalyzeInstruction(const Function& function, const
     // Save information to be used to make the Function
     target_instruction_ = &inst;
 
+    if (elide_static_checks_ && IsStaticallyValid(function)) {
+        elided_checks_count_++;
+        Reset();
+        return false;
+    }
+
     return true;
 }
 
@@ -15,6 +15,8 @@
 #pragma once
 
 #include <stdint.h>
+#include <map>
+#include <vector>
 #include "pass.h"
 
 namespace gpuav {
@@ -30,15 +32,27 @@ struct BasicBlock;
 // enabled, that the descriptor has been initialized. If the reference is
 // invalid, a record is written to the debug output buffer (if space allows)
 // and a null value is returned.
+// If |elide_static_checks| is set, the image accesses and the whole buffer accesses (that have no byte offset to check) through
+// a descriptor index proven in bounds of the descriptor array are not instrumented.
 class BindlessDescriptorPass : public Pass {
   public:
-    BindlessDescriptorPass(Module& module) : Pass(module) {}
+    BindlessDescriptorPass(Module& module, bool elide_static_checks = false)
+        : Pass(module), elide_static_checks_(elide_static_checks) {}
+
+    uint32_t ElidedChecksCount() const { return elided_checks_count_; }
 
   private:
     bool AnalyzeInstruction(const Function& function, const Instruction& inst) final;
     uint32_t CreateFunctionCall(BasicBlock& block) final;
     void Reset() final;
 
+    bool FindConstantValue(uint32_t id, uint32_t& value) const;
+    bool IsIndexInBounds(const Function& function, uint32_t index_id, uint32_t array_length) const;
+    bool IsStaticallyValid(const Function& function) const;
+
+    const bool elide_static_checks_;
+    uint32_t elided_checks_count_ = 0;
+
     uint32_t FindTypeByteSize(uint32_t type_id, uint32_t matrix_stride = 0, bool col_major = false, bool in_matrix = false);
     uint32_t GetLastByte(BasicBlock& block);
 
@@ -57,6 +71,11 @@ class BindlessDescriptorPass : public Pass {
 
     // < original ID, new CopyObject ID >
     vvl::unordered_map<uint32_t, uint32_t> copy_object_map_;
+
+    // Checks made in |checked_block_| and the blocks it was split from
+    // < descriptor access (write, texel, access chain operands), OpFunctionCall result ID >
+    std::map<std::vector<uint32_t>, uint32_t> block_checks_;
+    const BasicBlock* checked_block_ = nullptr;
 };
 
 }  // namespace spirv
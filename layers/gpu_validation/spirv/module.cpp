@@ -209,6 +209,29 @@ void Module::RunPassRayQuery() {
     pass.Run();
 }
 
+void Module::RunPasses(bool bindless_descriptor, bool buffer_device_address, bool ray_query,
+                       bool elide_static_descriptor_checks) {
+    BindlessDescriptorPass bindless_descriptor_pass(*this, elide_static_descriptor_checks);
+    BufferDeviceAddressPass buffer_device_address_pass(*this);
+    RayQueryPass ray_query_pass(*this);
+
+    // Same order as when running them one at a time
+    std::vector<Pass*> passes;
+    if (bindless_descriptor) {
+        passes.push_back(&bindless_descriptor_pass);
+    }
+    if (buffer_device_address) {
+        passes.push_back(&buffer_device_address_pass);
+    }
+    if (ray_query) {
+        passes.push_back(&ray_query_pass);
+    }
+    if (!passes.empty()) {
+        Pass::Run(*this, passes);
+    }
+    elided_descriptor_checks_ = bindless_descriptor_pass.ElidedChecksCount();
+}
+
 uint32_t Module::TakeNextId() {
     // SPIR-V limit.
     assert(header_.bound < 0x3FFFFF);
@@ -73,6 +73,10 @@ class Module {
     void RunPassBindlessDescriptor();
     void RunPassBufferDeviceAddress();
     void RunPassRayQuery();
+    // Runs the enabled passes together, walking the functions only once
+    void RunPasses(bool bindless_descriptor, bool buffer_device_address, bool ray_query, bool elide_static_descriptor_checks);
+    // Number of descriptor accesses RunPasses did not instrument because they were proven valid
+    uint32_t elided_descriptor_checks_ = 0;
 
     // Helpers
     bool HasCapability(spv::Capability capability);
@@ -358,19 +358,38 @@ BasicBlockIt Pass::InjectFunctionCheck(Function* function, BasicBlockIt block_it
     return block_it;
 }
 
-void Pass::Run() {
-    for (const auto& function : module_.functions_) {
+void Pass::Run() { Run(module_, {this}); }
+
+// Each instruction is offered to the passes in order, the first one wanting to check it injects its function check. The valid and
+// invalid blocks of the check (holding the instruction and its replacement) are then only offered to the passes after that one,
+// which are the passes that would have seen them when running the passes one at a time.
+void Pass::Run(Module& module, const std::vector<Pass*>& passes) {
+    for (const auto& function : module.functions_) {
+        size_t later_passes_begin = 0;
+        uint32_t later_passes_block_count = 0;
         for (auto block_it = function->blocks_.begin(); block_it != function->blocks_.end(); ++block_it) {
+            size_t passes_begin = 0;
+            if (later_passes_block_count != 0) {
+                passes_begin = later_passes_begin;
+                later_passes_block_count--;
+            }
             if ((*block_it)->loop_header_) {
                 continue;  // Currently can't properly handle injecting CFG logic into a loop header block
             }
             auto& block_instructions = (*block_it)->instructions_;
             for (auto inst_it = block_instructions.begin(); inst_it != block_instructions.end(); ++inst_it) {
-                if (AnalyzeInstruction(*(function.get()), *(inst_it->get()))) {
-                    block_it = InjectFunctionCheck(function.get(), block_it, inst_it);
+                size_t pass_index = passes_begin;
+                while (pass_index < passes.size() &&
+                       !passes[pass_index]->AnalyzeInstruction(*(function.get()), *(inst_it->get()))) {
+                    pass_index++;
+                }
+                if (pass_index != passes.size()) {
+                    block_it = passes[pass_index]->InjectFunctionCheck(function.get(), block_it, inst_it);
 
-                    // will start searching again from newly split merge block
-                    block_it--;
+                    // will start searching again from the valid block, right after the original block
+                    block_it = std::prev(block_it, 3);
+                    later_passes_begin = pass_index + 1;
+                    later_passes_block_count = 2;
                     break;
                 }
             }
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <vector>
 #include <spirv/unified1/spirv.hpp>
 #include "function_basic_block.h"
 
@@ -29,6 +30,8 @@ struct BasicBlock;
 class Pass {
   public:
     void Run();
+    // Runs several passes in a single walk over the functions, offering each instruction to all of them
+    static void Run(Module& module, const std::vector<Pass*>& passes);
 
     // Finds (and creates if needed) decoration and returns the OpVariable it points to
     const Variable& GetBuiltinVariable(uint32_t built_in);
@@ -14,6 +14,7 @@
  */
 
 #include "type_manager.h"
+#include <algorithm>
 #include "module.h"
 
 namespace gpuav {
@@ -43,11 +44,20 @@ const Type* Variable::PointerType(TypeManager& type_manager_) const {
     return type_manager_.FindTypeById(type_id);
 }
 
+template <typename T>
+void TypeManager::SetById(std::vector<const T*>& id_to_object, uint32_t id, const T* object) {
+    if (id >= id_to_object.size()) {
+        // Sized from the bound once, only the ids taken while instrumenting grow it afterwards
+        id_to_object.resize(std::max(id + 1, module_.header_.bound), nullptr);
+    }
+    id_to_object[id] = object;
+}
+
 const Type& TypeManager::AddType(std::unique_ptr<Instruction> new_inst, SpvType spv_type) {
     const auto& inst = module_.types_values_constants_.emplace_back(std::move(new_inst));
 
-    id_to_type_[inst->ResultId()] = std::make_unique<Type>(spv_type, *inst);
-    const Type* new_type = id_to_type_[inst->ResultId()].get();
+    const Type* new_type = &types_.emplace_back(spv_type, *inst);
+    SetById(id_to_type_, inst->ResultId(), new_type);
 
     switch (spv_type) {
         case SpvType::kVoid:
@@ -108,10 +118,7 @@ const Type& TypeManager::AddType(std::unique_ptr<Instruction> new_inst, SpvType
     return *new_type;
 }
 
-const Type* TypeManager::FindTypeById(uint32_t id) const {
-    auto type = id_to_type_.find(id);
-    return (type == id_to_type_.end()) ? nullptr : type->second.get();
-}
+const Type* TypeManager::FindTypeById(uint32_t id) const { return FindById(id_to_type_, id); }
 
 const Type& TypeManager::GetTypeVoid() {
     if (void_type) {
@@ -333,7 +340,7 @@ const Type& TypeManager::GetTypePointerBuiltInInput(spv::BuiltIn built_in) {
         }
         default: {
             assert(false && "unhandled builtin");
-            return *(id_to_type_.begin()->second);
+            return types_.front();
         }
     }
 }
@@ -392,44 +399,33 @@ uint32_t TypeManager::TypeLength(const Type& type) {
 const Constant& TypeManager::AddConstant(std::unique_ptr<Instruction> new_inst, const Type& type) {
     const auto& inst = module_.types_values_constants_.emplace_back(std::move(new_inst));
 
-    id_to_constant_[inst->ResultId()] = std::make_unique<Constant>(type, *inst);
-    const Constant* new_constant = id_to_constant_[inst->ResultId()].get();
+    const Constant* new_constant = &constants_.emplace_back(type, *inst);
+    SetById(id_to_constant_, inst->ResultId(), new_constant);
 
     if (inst->Opcode() == spv::OpConstant) {
         if (type.inst_.Opcode() == spv::OpTypeInt && type.inst_.Word(2) == 32) {
-            int_32bit_constants_.push_back(new_constant);
+            int_32bit_constants_.emplace(ConstantKey(type.Id(), inst->Word(3)), new_constant);
         } else if (type.inst_.Opcode() == spv::OpTypeFloat && type.inst_.Word(2) == 32) {
-            float_32bit_constants_.push_back(new_constant);
+            float_32bit_constants_.emplace(ConstantKey(type.Id(), inst->Word(3)), new_constant);
         }
     } else if (inst->Opcode() == spv::OpConstantNull) {
-        null_constants_.push_back(new_constant);
+        null_constants_.emplace(type.Id(), new_constant);
     }
 
     return *new_constant;
 }
 
 const Constant* TypeManager::FindConstantInt32(uint32_t type_id, uint32_t value) const {
-    for (const auto constant : int_32bit_constants_) {
-        if (constant->type_.Id() == type_id && value == constant->inst_.Word(3)) {
-            return constant;
-        }
-    }
-    return nullptr;
+    auto constant = int_32bit_constants_.find(ConstantKey(type_id, value));
+    return (constant == int_32bit_constants_.end()) ? nullptr : constant->second;
 }
 
 const Constant* TypeManager::FindConstantFloat32(uint32_t type_id, uint32_t value) const {
-    for (const auto constant : float_32bit_constants_) {
-        if (constant->type_.Id() == type_id && value == constant->inst_.Word(3)) {
-            return constant;
-        }
-    }
-    return nullptr;
+    auto constant = float_32bit_constants_.find(ConstantKey(type_id, value));
+    return (constant == float_32bit_constants_.end()) ? nullptr : constant->second;
 }
 
-const Constant* TypeManager::FindConstantById(uint32_t id) const {
-    auto constant = id_to_constant_.find(id);
-    return (constant == id_to_constant_.end()) ? nullptr : constant->second.get();
-}
+const Constant* TypeManager::FindConstantById(uint32_t id) const { return FindById(id_to_constant_, id); }
 
 const Constant& TypeManager::CreateConstantUInt32(uint32_t value) {
     const Type& type = GetTypeInt(32, 0);
@@ -491,10 +487,8 @@ const Constant& TypeManager::GetConstantZeroVec3() {
 }
 
 const Constant& TypeManager::GetConstantNull(const Type& type) {
-    for (const auto& constant : null_constants_) {
-        if (constant->type_.Id() == type.Id()) {
-            return *constant;
-        }
+    if (auto constant = null_constants_.find(type.Id()); constant != null_constants_.end()) {
+        return *constant->second;
     }
 
     const uint32_t constant_id = module_.TakeNextId();
@@ -506,8 +500,8 @@ const Constant& TypeManager::GetConstantNull(const Type& type) {
 const Variable& TypeManager::AddVariable(std::unique_ptr<Instruction> new_inst, const Type& type) {
     const auto& inst = module_.types_values_constants_.emplace_back(std::move(new_inst));
 
-    id_to_variable_[inst->ResultId()] = std::make_unique<Variable>(type, *inst);
-    const Variable* new_variable = id_to_variable_[inst->ResultId()].get();
+    const Variable* new_variable = &variables_.emplace_back(type, *inst);
+    SetById(id_to_variable_, inst->ResultId(), new_variable);
 
     if (new_variable->StorageClass() == spv::StorageClassInput) {
         input_variables_.push_back(new_variable);
@@ -518,10 +512,7 @@ const Variable& TypeManager::AddVariable(std::unique_ptr<Instruction> new_inst,
     return *new_variable;
 }
 
-const Variable* TypeManager::FindVariableById(uint32_t id) const {
-    auto variable = id_to_variable_.find(id);
-    return (variable == id_to_variable_.end()) ? nullptr : variable->second.get();
-}
+const Variable* TypeManager::FindVariableById(uint32_t id) const { return FindById(id_to_variable_, id); }
 
 }  // namespace spirv
 }  // namespace gpuav
\ No newline at end of file
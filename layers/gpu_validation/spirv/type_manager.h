@@ -14,6 +14,7 @@
  */
 #pragma once
 
+#include <deque>
 #include <vector>
 #include <list>
 #include "instruction.h"
@@ -130,11 +131,24 @@ class TypeManager {
   private:
     Module& module_;
 
+    template <typename T>
+    static const T* FindById(const std::vector<const T*>& id_to_object, uint32_t id) {
+        return id < id_to_object.size() ? id_to_object[id] : nullptr;
+    }
+    template <typename T>
+    void SetById(std::vector<const T*>& id_to_object, uint32_t id, const T* object);
+
+    // The objects are kept in deques so they are allocated in blocks and never move while more are added
+    std::deque<Type> types_;
+    std::deque<Constant> constants_;
+    std::deque<Variable> variables_;
+
     // Currently we don't worry about duplicated types. If duplicate types are added from the original SPIR-V, we just use the first
     // one we fine. We should only be adding a new object because it currently doesn't exists.
-    vvl::unordered_map<uint32_t, std::unique_ptr<Type>> id_to_type_;
-    vvl::unordered_map<uint32_t, std::unique_ptr<Constant>> id_to_constant_;
-    vvl::unordered_map<uint32_t, std::unique_ptr<Variable>> id_to_variable_;
+    // Indexed by result id, they grow to the module bound so all the lookups are a single load.
+    std::vector<const Type*> id_to_type_;
+    std::vector<const Constant*> id_to_constant_;
+    std::vector<const Variable*> id_to_variable_;
 
     // Create faster lookups for specific types
     // some types are base types and only will be one
@@ -155,11 +169,14 @@ class TypeManager {
     std::vector<const Type*> forward_pointer_types_;
     std::vector<const Type*> function_types_;
 
-    std::vector<const Constant*> int_32bit_constants_;
-    std::vector<const Constant*> float_32bit_constants_;
+    // Keyed by the type id in the upper bits and the value in the lower bits, keeping the first constant found
+    static uint64_t ConstantKey(uint32_t type_id, uint32_t value) { return (uint64_t(type_id) << 32) | value; }
+    vvl::unordered_map<uint64_t, const Constant*> int_32bit_constants_;
+    vvl::unordered_map<uint64_t, const Constant*> float_32bit_constants_;
     const Constant* uint_32bit_zero_constants_ = nullptr;
     const Constant* float_32bit_zero_constants_ = nullptr;
-    std::vector<const Constant*> null_constants_;
+    // By type id
+    vvl::unordered_map<uint32_t, const Constant*> null_constants_;
 
     std::vector<const Variable*> input_variables_;
     std::vector<const Variable*> output_variables_;
@@ -21,7 +21,12 @@
 #include <vulkan/layer/vk_layer_settings.hpp>
 
 #include "gpu_validation/gpu_settings.h"
+#include "sync/sync_settings.h"
 #include "error_message/logging.h"
+#include "generated/error_location_helper.h"
+#include "vk_layer_config.h"
+
+#include <mutex>
 
 // Include new / delete overrides if using mimalloc. This needs to be include exactly once in a file that is
 // part of the VVL but not the layer utils library.
@@ -42,42 +47,73 @@ const char *VK_LAYER_VALIDATE_BEST_PRACTICES_ARM = "validate_best_practices_arm"
 const char *VK_LAYER_VALIDATE_BEST_PRACTICES_AMD = "validate_best_practices_amd";
 const char *VK_LAYER_VALIDATE_BEST_PRACTICES_IMG = "validate_best_practices_img";
 const char *VK_LAYER_VALIDATE_BEST_PRACTICES_NVIDIA = "validate_best_practices_nvidia";
+const char *VK_LAYER_VALIDATE_BEST_PRACTICES_DEFERRED_VENDOR_CHECKS = "validate_best_practices_deferred_vendor_checks";
 const char *VK_LAYER_VALIDATE_SYNC = "validate_sync";
 const char *VK_LAYER_VALIDATE_GPU_BASED = "validate_gpu_based";
 
 const char *VK_LAYER_DISABLES = "disables";
 const char *VK_LAYER_STATELESS_PARAM = "stateless_param";
 const char *VK_LAYER_THREAD_SAFETY = "thread_safety";
+const char *VK_LAYER_THREAD_SAFETY_OWNED_COMMAND_BUFFERS = "thread_safety_owned_command_buffers";
 const char *VK_LAYER_VALIDATE_CORE = "validate_core";
 const char *VK_LAYER_CHECK_COMMAND_BUFFER = "check_command_buffer";
 const char *VK_LAYER_CHECK_OBJECT_IN_USE = "check_object_in_use";
 const char *VK_LAYER_CHECK_QUERY = "check_query";
 const char *VK_LAYER_CHECK_IMAGE_LAYOUT = "check_image_layout";
 const char *VK_LAYER_UNIQUE_HANDLES = "unique_handles";
+const char *VK_LAYER_UNIQUE_HANDLES_SLAB = "unique_handles_slab";
 const char *VK_LAYER_OBJECT_LIFETIME = "object_lifetime";
+const char *VK_LAYER_OBJECT_LIFETIME_HANDLE_SETS = "object_lifetime_handle_sets";
 const char *VK_LAYER_CHECK_SHADERS = "check_shaders";
 const char *VK_LAYER_CHECK_SHADERS_CACHING = "check_shaders_caching";
+const char *VK_LAYER_CHECK_SHADERS_DEFERRED_PARSING = "check_shaders_deferred_parsing";
+const char *VK_LAYER_CHECK_COMMAND_BUFFER_DEFERRED = "check_command_buffer_deferred";
 const char *VK_LAYER_VALIDATE_SYNC_QUEUE_SUBMIT = "sync_queue_submit";
+const char *VK_LAYER_SYNCVAL_SUBMIT_TIME_VALIDATION_THREADS = "syncval_submit_time_validation_threads";
+const char *VK_LAYER_SYNCVAL_HISTORY_MEMORY_BUDGET = "syncval_history_memory_budget";
+const char *VK_LAYER_SYNCVAL_COARSE_BUFFER_TRACKING = "syncval_coarse_buffer_tracking";
 
 const char *VK_LAYER_MESSAGE_ID_FILTER = "message_id_filter";
 const char *VK_LAYER_CUSTOM_STYPE_LIST = "custom_stype_list";
 const char *VK_LAYER_DUPLICATE_MESSAGE_LIMIT = "duplicate_message_limit";
+const char *VK_LAYER_DUPLICATE_MESSAGE_LIMIT_SCOPE = "duplicate_message_limit_scope";
+const char *VK_LAYER_MESSAGE_DELIVERY = "message_delivery";
 const char *VK_LAYER_FINE_GRAINED_LOCKING = "fine_grained_locking";
+const char *VK_LAYER_CALL_PROFILE_FILE = "call_profile_file";
+const char *VK_LAYER_TRACE_FILE = "trace_file";
+const char *VK_LAYER_QUEUE_RETIRE_THREADS = "queue_retire_threads";
+const char *VK_LAYER_SHADER_VALIDATION_CACHE_PATH = "shader_validation_cache_path";
+const char *VK_LAYER_SHADER_VALIDATION_THREADS = "shader_validation_threads";
+const char *VK_LAYER_WORKER_THREADS = "worker_threads";
+const char *VK_LAYER_WORKER_THREAD_AFFINITY = "worker_thread_affinity";
+const char *VK_LAYER_FRAME_SAMPLING_INTERVAL = "frame_sampling_interval";
+const char *VK_LAYER_FRAME_SAMPLING_TIME_BUDGET = "frame_sampling_time_budget";
+const char *VK_LAYER_SKIP_VALIDATE_ENTRY_POINTS = "skip_validate_entry_points";
+const char *VK_LAYER_ALLOCATOR = "allocator";
+const char *VK_LAYER_ALLOCATION_STATISTICS = "allocation_statistics";
+const char *VK_LAYER_ALLOCATION_STATISTICS_PERIOD = "allocation_statistics_period";
 
 const char *VK_LAYER_PRINTF_TO_STDOUT = "printf_to_stdout";
 const char *VK_LAYER_PRINTF_VERBOSE = "printf_verbose";
 const char *VK_LAYER_PRINTF_BUFFER_SIZE = "printf_buffer_size";
+const char *VK_LAYER_PRINTF_DEDUPLICATE = "printf_deduplicate";
+const char *VK_LAYER_PRINTF_MAX_MESSAGES = "printf_max_messages";
+const char *VK_LAYER_PRINTF_OUTPUT_FILE = "printf_output_file";
 
 // GPU-AV
 // ---
 const char *VK_LAYER_GPUAV_SHADER_INSTRUMENTATION = "gpuav_shader_instrumentation";
 const char *VK_LAYER_GPUAV_VALIDATE_DESCRIPTORS = "gpuav_descriptor_checks";
 const char *VK_LAYER_GPUAV_WARN_ON_ROBUST_OOB = "gpuav_warn_on_robust_oob";
+const char *VK_LAYER_GPUAV_ELIDE_STATIC_DESCRIPTOR_CHECKS = "gpuav_elide_static_descriptor_checks";
 const char *VK_LAYER_GPUAV_BUFFER_ADDRESS_OOB = "gpuav_buffer_address_oob";
 const char *VK_LAYER_GPUAV_MAX_BUFFER_DEVICE_ADDRESS_BUFFERS = "gpuav_max_buffer_device_addresses";
 const char *VK_LAYER_GPUAV_VALIDATE_RAY_QUERY = "gpuav_validate_ray_query";
 const char *VK_LAYER_GPUAV_CACHE_INSTRUMENTED_SHADERS = "gpuav_cache_instrumented_shaders";
 const char *VK_LAYER_GPUAV_SELECT_INSTRUMENTED_SHADERS = "gpuav_select_instrumented_shaders";
+const char *VK_LAYER_GPUAV_INSTRUMENTED_SHADER_HASHES = "gpuav_instrumented_shader_hashes";
+const char *VK_LAYER_GPUAV_INSTRUMENTED_SHADER_NAMES = "gpuav_instrumented_shader_names";
+const char *VK_LAYER_GPUAV_INSTRUMENTED_SHADER_SAMPLING_RATE = "gpuav_instrumented_shader_sampling_rate";
 
 const char *VK_LAYER_GPUAV_BUFFERS_VALIDATION = "gpuav_buffers_validation";
 const char *VK_LAYER_GPUAV_VALIDATE_INDIRECT_DRAWS_BUFFERS = "gpuav_indirect_draws_buffers";
@@ -87,6 +123,10 @@ const char *VK_LAYER_GPUAV_VALIDATE_BUFFER_COPIES = "gpuav_buffer_copies";
 
 const char *VK_LAYER_GPUAV_RESERVE_BINDING_SLOT = "gpuav_reserve_binding_slot";
 const char *VK_LAYER_GPUAV_VMA_LINEAR_OUTPUT = "gpuav_vma_linear_output";
+const char *VK_LAYER_GPUAV_MEMORY_BUDGET = "gpuav_memory_budget";
+const char *VK_LAYER_GPUAV_REPORT_MEMORY_USAGE = "gpuav_report_memory_usage";
+const char *VK_LAYER_GPUAV_OVERLAPPED_ERROR_READBACK = "gpuav_overlapped_error_readback";
+const char *VK_LAYER_GPUAV_REPORT_OVERHEAD = "gpuav_report_overhead";
 
 const char *VK_LAYER_GPUAV_DEBUG_VALIDATE_INSTRUMENTED_SHADERS = "gpuav_debug_validate_instrumented_shaders";
 const char *VK_LAYER_GPUAV_DEBUG_DUMP_INSTRUMENTED_SHADERS = "gpuav_debug_dump_instrumented_shaders";
@@ -379,16 +419,8 @@ static const char *GetDefaultPrefix() {
     return "LAYER";
 #endif
 }
-#endif
-// Process enables and disables set though the vk_layer_settings.txt config file or through an environment variable
-void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
-    // When compiling a build for self validation, ProcessConfigAndEnvSettings immediately returns,
-    // so that the layer always defaults to the standard validation options we want,
-    // and does not try to process option coming from the VVL we are debugging
-#if defined(BUILD_SELF_VVL)
-    (void)settings_data;
-    return;
-#else
+
+static void ParseConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     // If not cleared, garbage has been seen in some Android run effecting the error message
     custom_stype_info.clear();
 
@@ -420,6 +452,114 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_FINE_GRAINED_LOCKING, *settings_data->fine_grained_locking);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_CALL_PROFILE_FILE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_CALL_PROFILE_FILE, *settings_data->call_profile_file);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_TRACE_FILE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_TRACE_FILE, *settings_data->trace_file);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_QUEUE_RETIRE_THREADS)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_QUEUE_RETIRE_THREADS, *settings_data->queue_retire_threads);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SHADER_VALIDATION_CACHE_PATH)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SHADER_VALIDATION_CACHE_PATH,
+                                *settings_data->shader_validation_cache_path);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SHADER_VALIDATION_THREADS)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SHADER_VALIDATION_THREADS, *settings_data->shader_validation_threads);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_WORKER_THREADS)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_WORKER_THREADS, *settings_data->worker_threads);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_WORKER_THREAD_AFFINITY)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_WORKER_THREAD_AFFINITY, *settings_data->worker_thread_affinity);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_FRAME_SAMPLING_INTERVAL)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_FRAME_SAMPLING_INTERVAL, *settings_data->frame_sampling_interval);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_FRAME_SAMPLING_TIME_BUDGET)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_FRAME_SAMPLING_TIME_BUDGET,
+                                *settings_data->frame_sampling_time_budget);
+    }
+
+    // Entry points whose PreCallValidate is not dispatched, turned into a table indexed by vvl::Func
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SKIP_VALIDATE_ENTRY_POINTS)) {
+        std::vector<std::string> entry_points;
+        vkuGetLayerSettingValues(layer_setting_set, VK_LAYER_SKIP_VALIDATE_ENTRY_POINTS, entry_points);
+        vvl::unordered_map<std::string, uint32_t> func_ids;
+        for (uint32_t func_id = 1; func_id < vvl::kFuncCount; ++func_id) {
+            func_ids.emplace(vvl::String(static_cast<vvl::Func>(func_id)), func_id);
+        }
+        std::vector<bool> &skipped_validate_calls = *settings_data->skipped_validate_calls;
+        for (const std::string &entry_point : entry_points) {
+            const auto it = func_ids.find(entry_point);
+            if (it == func_ids.end()) {
+                printf("Validation Setting Warning - %s lists %s, which is not a Vulkan entry point\n",
+                       VK_LAYER_SKIP_VALIDATE_ENTRY_POINTS, entry_point.c_str());
+                continue;
+            }
+            skipped_validate_calls.resize(vvl::kFuncCount, false);
+            skipped_validate_calls[it->second] = true;
+        }
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_ALLOCATOR)) {
+        std::string setting_value;
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_ALLOCATOR, setting_value);
+        if (setting_value == "MIMALLOC") {
+            *settings_data->allocator_kind = vvl::AllocatorKind::Mimalloc;
+        } else if (setting_value == "THREAD_ARENA") {
+            *settings_data->allocator_kind = vvl::AllocatorKind::ThreadArena;
+        } else {
+            *settings_data->allocator_kind = vvl::AllocatorKind::System;
+        }
+        if (!vvl::IsAllocatorAvailable(*settings_data->allocator_kind)) {
+            printf("Validation Setting Warning - %s was set to %s, which this build does not include, SYSTEM is used instead\n",
+                   VK_LAYER_ALLOCATOR, setting_value.c_str());
+            *settings_data->allocator_kind = vvl::AllocatorKind::System;
+        }
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_ALLOCATION_STATISTICS)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_ALLOCATION_STATISTICS, *settings_data->allocation_statistics);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_ALLOCATION_STATISTICS_PERIOD)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_ALLOCATION_STATISTICS_PERIOD,
+                                *settings_data->allocation_statistics_period);
+    }
+
+    // Unique handles are looked up by every call, this picks the lock-free scheme for them
+    SetValidationSetting(layer_setting_set, settings_data->enables, unique_handles_slab, VK_LAYER_UNIQUE_HANDLES_SLAB);
+
+    // Every handle parameter is looked up by object lifetime validation, this picks the lock-free scheme for them
+    SetValidationSetting(layer_setting_set, settings_data->enables, object_lifetime_handle_sets,
+                         VK_LAYER_OBJECT_LIFETIME_HANDLE_SETS);
+
+    // Command buffers recorded by a single thread skip most of the thread safety tracking
+    SetValidationSetting(layer_setting_set, settings_data->enables, thread_safety_owned_command_buffers,
+                         VK_LAYER_THREAD_SAFETY_OWNED_COMMAND_BUFFERS);
+
+    // Vendor state machines updated by replaying the recorded commands at vkEndCommandBuffer
+    SetValidationSetting(layer_setting_set, settings_data->enables, best_practices_deferred_vendor_checks,
+                         VK_LAYER_VALIDATE_BEST_PRACTICES_DEFERRED_VENDOR_CHECKS);
+
+    // Shader modules only parsed when a pipeline uses them
+    SetValidationSetting(layer_setting_set, settings_data->enables, deferred_shader_module_parsing,
+                         VK_LAYER_CHECK_SHADERS_DEFERRED_PARSING);
+
+    // Resource checks of the recorded commands run after vkEndCommandBuffer
+    SetValidationSetting(layer_setting_set, settings_data->enables, deferred_command_validation,
+                         VK_LAYER_CHECK_COMMAND_BUFFER_DEFERRED);
+
     // Message ID Filtering
     std::vector<std::string> message_id_filter;
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_MESSAGE_ID_FILTER)) {
@@ -437,6 +577,12 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         }
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_DUPLICATE_MESSAGE_LIMIT_SCOPE)) {
+        std::string setting_value;
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_DUPLICATE_MESSAGE_LIMIT_SCOPE, setting_value);
+        *settings_data->duplicate_message_limit_per_object = setting_value == "VUID_AND_OBJECT";
+    }
+
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_CUSTOM_STYPE_LIST)) {
         vkuGetLayerSettingValues(layer_setting_set, VK_LAYER_CUSTOM_STYPE_LIST, custom_stype_info);
     }
@@ -454,6 +600,34 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PRINTF_BUFFER_SIZE, printf_settings.buffer_size);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_PRINTF_DEDUPLICATE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PRINTF_DEDUPLICATE, printf_settings.deduplicate);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_PRINTF_MAX_MESSAGES)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PRINTF_MAX_MESSAGES, printf_settings.max_messages);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_PRINTF_OUTPUT_FILE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PRINTF_OUTPUT_FILE, printf_settings.output_file);
+    }
+
+    SyncValSettings &syncval_settings = *settings_data->syncval_settings;
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SYNCVAL_SUBMIT_TIME_VALIDATION_THREADS)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SYNCVAL_SUBMIT_TIME_VALIDATION_THREADS,
+                                syncval_settings.submit_time_validation_threads);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SYNCVAL_HISTORY_MEMORY_BUDGET)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SYNCVAL_HISTORY_MEMORY_BUDGET,
+                                syncval_settings.history_memory_budget_mb);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SYNCVAL_COARSE_BUFFER_TRACKING)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SYNCVAL_COARSE_BUFFER_TRACKING,
+                                syncval_settings.coarse_buffer_tracking);
+    }
+
     GpuAVSettings &gpuav_settings = *settings_data->gpuav_settings;
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_SHADER_INSTRUMENTATION)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_SHADER_INSTRUMENTATION,
@@ -474,6 +648,11 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                    DEPRECATED_GPUAV_WARN_ON_ROBUST_OOB, VK_LAYER_GPUAV_WARN_ON_ROBUST_OOB);
         }
 
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_ELIDE_STATIC_DESCRIPTOR_CHECKS)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_ELIDE_STATIC_DESCRIPTOR_CHECKS,
+                                    gpuav_settings.elide_static_descriptor_checks);
+        }
+
         if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_BUFFER_ADDRESS_OOB)) {
             vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_BUFFER_ADDRESS_OOB, gpuav_settings.validate_bda);
         }
@@ -506,6 +685,30 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                    DEPRECATED_GPUAV_SELECT_INSTRUMENTED_SHADERS, VK_LAYER_GPUAV_SELECT_INSTRUMENTED_SHADERS);
         }
 
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_INSTRUMENTED_SHADER_HASHES)) {
+            std::vector<std::string> shader_hashes;
+            vkuGetLayerSettingValues(layer_setting_set, VK_LAYER_GPUAV_INSTRUMENTED_SHADER_HASHES, shader_hashes);
+            for (const std::string &shader_hash : shader_hashes) {
+                // Decimal like the ids of the dumped shaders, or hexadecimal with a 0x prefix
+                char *end = nullptr;
+                const unsigned long value = std::strtoul(shader_hash.c_str(), &end, 0);
+                if (shader_hash.empty() || *end != '\0') {
+                    printf("Validation Setting Warning - %s has an invalid shader hash \"%s\", it is ignored\n",
+                           VK_LAYER_GPUAV_INSTRUMENTED_SHADER_HASHES, shader_hash.c_str());
+                    continue;
+                }
+                gpuav_settings.instrumented_shader_hashes.emplace_back(static_cast<uint32_t>(value));
+            }
+        }
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_INSTRUMENTED_SHADER_NAMES)) {
+            vkuGetLayerSettingValues(layer_setting_set, VK_LAYER_GPUAV_INSTRUMENTED_SHADER_NAMES,
+                                     gpuav_settings.instrumented_shader_names);
+        }
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_INSTRUMENTED_SHADER_SAMPLING_RATE)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_INSTRUMENTED_SHADER_SAMPLING_RATE,
+                                    gpuav_settings.instrumented_shader_sampling_rate);
+        }
+
         // No need to enable shader instrumentation options is no instrumentation is done
         if (!gpuav_settings.IsShaderInstrumentationEnabled()) {
             gpuav_settings.DisableShaderInstrumentationAndOptions();
@@ -559,6 +762,23 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                VK_LAYER_GPUAV_VMA_LINEAR_OUTPUT);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_MEMORY_BUDGET)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_MEMORY_BUDGET, gpuav_settings.memory_budget);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_REPORT_MEMORY_USAGE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_REPORT_MEMORY_USAGE, gpuav_settings.report_memory_usage);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_OVERLAPPED_ERROR_READBACK)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_OVERLAPPED_ERROR_READBACK,
+                                gpuav_settings.overlapped_error_readback);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_REPORT_OVERHEAD)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_REPORT_OVERHEAD, gpuav_settings.report_overhead);
+    }
+
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_DEBUG_VALIDATE_INSTRUMENTED_SHADERS)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_DEBUG_VALIDATE_INSTRUMENTED_SHADERS,
                                 gpuav_settings.debug_validate_instrumented_shaders);
@@ -569,8 +789,10 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                                 gpuav_settings.debug_dump_instrumented_shaders);
     }
 
-    if (gpuav_settings.debug_validate_instrumented_shaders || gpuav_settings.debug_dump_instrumented_shaders) {
-        // When debugging instrumented shaders, if it is cached, it will never get to the InstrumentShader() call
+    if (gpuav_settings.debug_validate_instrumented_shaders || gpuav_settings.debug_dump_instrumented_shaders ||
+        gpuav_settings.report_overhead) {
+        // When debugging instrumented shaders or measuring their instrumentation, if it is cached, it will never get to the
+        // InstrumentShader() call
         gpuav_settings.cache_instrumented_shaders = false;
     }
 
@@ -578,10 +800,11 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_MESSAGE_FORMAT_DISPLAY_APPLICATION_NAME,
                                 settings_data->message_format_settings->display_application_name);
     }
-    // Grab application name here while we have access to it and know if to save it or not
-    if (settings_data->message_format_settings->display_application_name) {
-        settings_data->message_format_settings->application_name =
-            settings_data->create_info->pApplicationInfo ? settings_data->create_info->pApplicationInfo->pApplicationName : "";
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_MESSAGE_DELIVERY)) {
+        std::string setting_value;
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_MESSAGE_DELIVERY, setting_value);
+        *settings_data->async_message_delivery = setting_value == "ASYNC";
     }
 
     const auto *validation_features_ext = vku::FindStructInPNextChain<VkValidationFeaturesEXT>(settings_data->create_info);
@@ -633,5 +856,222 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     }
 
     vkuDestroyLayerSettingSet(layer_setting_set, nullptr);
+}
+
+static void AppendToKey(std::string &key, const void *data, size_t size) {
+    key.append(reinterpret_cast<const char *>(data), size);
+}
+
+static void AppendToKey(std::string &key, const char *str) {
+    if (str) {
+        key.append(str);
+    }
+    key.push_back('\0');
+}
+
+// Everything the settings depend on besides the defaults: the settings file, the VK_ environment variables and the
+// structures of the VkInstanceCreateInfo pNext chain read by ParseConfigAndEnvSettings. Returns false when the settings
+// can't be fingerprinted, and have to be parsed every time.
+static bool GetSettingsCacheKey(const VkInstanceCreateInfo *create_info, std::string &key) {
+#if defined(__ANDROID__)
+    // Settings are read from system properties, there is no cheap way to know they did not change
+    (void)create_info;
+    (void)key;
+    return false;
+#else
+    key = GetLayerSettingsFileStamp();
+    key.push_back('\0');
+    key += GetEnvironmentStamp("VK_");
+    key.push_back('\0');
+
+    for (auto *p = reinterpret_cast<const VkBaseInStructure *>(create_info->pNext); p; p = p->pNext) {
+        switch (p->sType) {
+            case VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT: {
+                const auto *layer_settings = reinterpret_cast<const VkLayerSettingsCreateInfoEXT *>(p);
+                AppendToKey(key, &p->sType, sizeof(p->sType));
+                for (uint32_t i = 0; i < layer_settings->settingCount; ++i) {
+                    const VkLayerSettingEXT &setting = layer_settings->pSettings[i];
+                    AppendToKey(key, setting.pLayerName);
+                    AppendToKey(key, setting.pSettingName);
+                    AppendToKey(key, &setting.type, sizeof(setting.type));
+                    AppendToKey(key, &setting.valueCount, sizeof(setting.valueCount));
+                    size_t value_size = 0;
+                    switch (setting.type) {
+                        case VK_LAYER_SETTING_TYPE_BOOL32_EXT:
+                        case VK_LAYER_SETTING_TYPE_INT32_EXT:
+                        case VK_LAYER_SETTING_TYPE_UINT32_EXT:
+                        case VK_LAYER_SETTING_TYPE_FLOAT32_EXT:
+                            value_size = sizeof(uint32_t);
+                            break;
+                        case VK_LAYER_SETTING_TYPE_INT64_EXT:
+                        case VK_LAYER_SETTING_TYPE_UINT64_EXT:
+                        case VK_LAYER_SETTING_TYPE_FLOAT64_EXT:
+                            value_size = sizeof(uint64_t);
+                            break;
+                        case VK_LAYER_SETTING_TYPE_STRING_EXT:
+                            for (uint32_t j = 0; j < setting.valueCount; ++j) {
+                                AppendToKey(key, static_cast<const char *const *>(setting.pValues)[j]);
+                            }
+                            break;
+                        default:
+                            return false;
+                    }
+                    if (value_size != 0 && setting.pValues) {
+                        AppendToKey(key, setting.pValues, value_size * setting.valueCount);
+                    }
+                }
+                break;
+            }
+            case VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT: {
+                const auto *features = reinterpret_cast<const VkValidationFeaturesEXT *>(p);
+                AppendToKey(key, &p->sType, sizeof(p->sType));
+                AppendToKey(key, &features->enabledValidationFeatureCount, sizeof(uint32_t));
+                AppendToKey(key, features->pEnabledValidationFeatures,
+                            features->enabledValidationFeatureCount * sizeof(VkValidationFeatureEnableEXT));
+                AppendToKey(key, &features->disabledValidationFeatureCount, sizeof(uint32_t));
+                AppendToKey(key, features->pDisabledValidationFeatures,
+                            features->disabledValidationFeatureCount * sizeof(VkValidationFeatureDisableEXT));
+                break;
+            }
+            case VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT: {
+                const auto *flags = reinterpret_cast<const VkValidationFlagsEXT *>(p);
+                AppendToKey(key, &p->sType, sizeof(p->sType));
+                AppendToKey(key, &flags->disabledValidationCheckCount, sizeof(uint32_t));
+                AppendToKey(key, flags->pDisabledValidationChecks,
+                            flags->disabledValidationCheckCount * sizeof(VkValidationCheckEXT));
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    return true;
+#endif
+}
+
+// Output of ParseConfigAndEnvSettings for one cache key
+struct ParsedSettings {
+    CHECK_ENABLED enables;
+    CHECK_DISABLED disables;
+    vvl::unordered_set<uint32_t> message_filter_list;
+    uint32_t duplicate_message_limit;
+    bool duplicate_message_limit_per_object;
+    bool display_application_name;
+    bool async_message_delivery;
+    bool fine_grained_locking;
+    GpuAVSettings gpuav_settings;
+    DebugPrintfSettings printf_settings;
+    SyncValSettings syncval_settings;
+    std::string call_profile_file;
+    std::string trace_file;
+    uint32_t queue_retire_threads;
+    std::string shader_validation_cache_path;
+    uint32_t shader_validation_threads;
+    uint32_t worker_threads;
+    bool worker_thread_affinity;
+    uint32_t frame_sampling_interval;
+    uint32_t frame_sampling_time_budget;
+    std::vector<bool> skipped_validate_calls;
+    vvl::AllocatorKind allocator_kind;
+    bool allocation_statistics;
+    uint32_t allocation_statistics_period;
+    std::vector<std::pair<uint32_t, uint32_t>> custom_stype_info;
+
+    explicit ParsedSettings(const ConfigAndEnvSettings &settings_data)
+        : enables(settings_data.enables),
+          disables(settings_data.disables),
+          message_filter_list(settings_data.message_filter_list),
+          duplicate_message_limit(*settings_data.duplicate_message_limit),
+          duplicate_message_limit_per_object(*settings_data.duplicate_message_limit_per_object),
+          display_application_name(settings_data.message_format_settings->display_application_name),
+          async_message_delivery(*settings_data.async_message_delivery),
+          fine_grained_locking(*settings_data.fine_grained_locking),
+          gpuav_settings(*settings_data.gpuav_settings),
+          printf_settings(*settings_data.printf_settings),
+          syncval_settings(*settings_data.syncval_settings),
+          call_profile_file(*settings_data.call_profile_file),
+          trace_file(*settings_data.trace_file),
+          queue_retire_threads(*settings_data.queue_retire_threads),
+          shader_validation_cache_path(*settings_data.shader_validation_cache_path),
+          shader_validation_threads(*settings_data.shader_validation_threads),
+          worker_threads(*settings_data.worker_threads),
+          worker_thread_affinity(*settings_data.worker_thread_affinity),
+          frame_sampling_interval(*settings_data.frame_sampling_interval),
+          frame_sampling_time_budget(*settings_data.frame_sampling_time_budget),
+          skipped_validate_calls(*settings_data.skipped_validate_calls),
+          allocator_kind(*settings_data.allocator_kind),
+          allocation_statistics(*settings_data.allocation_statistics),
+          allocation_statistics_period(*settings_data.allocation_statistics_period),
+          custom_stype_info(::custom_stype_info) {}
+
+    void CopyTo(ConfigAndEnvSettings &settings_data) const {
+        settings_data.enables = enables;
+        settings_data.disables = disables;
+        settings_data.message_filter_list = message_filter_list;
+        *settings_data.duplicate_message_limit = duplicate_message_limit;
+        *settings_data.duplicate_message_limit_per_object = duplicate_message_limit_per_object;
+        settings_data.message_format_settings->display_application_name = display_application_name;
+        *settings_data.async_message_delivery = async_message_delivery;
+        *settings_data.fine_grained_locking = fine_grained_locking;
+        *settings_data.gpuav_settings = gpuav_settings;
+        *settings_data.printf_settings = printf_settings;
+        *settings_data.syncval_settings = syncval_settings;
+        *settings_data.call_profile_file = call_profile_file;
+        *settings_data.trace_file = trace_file;
+        *settings_data.queue_retire_threads = queue_retire_threads;
+        *settings_data.shader_validation_cache_path = shader_validation_cache_path;
+        *settings_data.shader_validation_threads = shader_validation_threads;
+        *settings_data.worker_threads = worker_threads;
+        *settings_data.worker_thread_affinity = worker_thread_affinity;
+        *settings_data.frame_sampling_interval = frame_sampling_interval;
+        *settings_data.frame_sampling_time_budget = frame_sampling_time_budget;
+        *settings_data.skipped_validate_calls = skipped_validate_calls;
+        *settings_data.allocator_kind = allocator_kind;
+        *settings_data.allocation_statistics = allocation_statistics;
+        *settings_data.allocation_statistics_period = allocation_statistics_period;
+        ::custom_stype_info = custom_stype_info;
+    }
+};
+#endif
+
+// Process enables and disables set though the vk_layer_settings.txt config file or through an environment variable
+//
+// Parsing goes through every setting of the file and of the environment, processes creating many instances keep the
+// result of each settings file, environment and VkInstanceCreateInfo pNext chain they were created with.
+void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
+    // When compiling a build for self validation, ProcessConfigAndEnvSettings immediately returns,
+    // so that the layer always defaults to the standard validation options we want,
+    // and does not try to process option coming from the VVL we are debugging
+#if defined(BUILD_SELF_VVL)
+    (void)settings_data;
+    return;
+#else
+    // Only a handful of configurations are expected, the cache is dropped if a process goes through many more
+    constexpr size_t kMaxCachedSettings = 64;
+    static std::mutex settings_cache_lock;
+    static vvl::unordered_map<std::string, ParsedSettings> settings_cache;
+
+    std::string key;
+    if (!GetSettingsCacheKey(settings_data->create_info, key)) {
+        ParseConfigAndEnvSettings(settings_data);
+    } else {
+        std::lock_guard<std::mutex> guard(settings_cache_lock);
+        auto it = settings_cache.find(key);
+        if (it != settings_cache.end()) {
+            it->second.CopyTo(*settings_data);
+        } else {
+            ParseConfigAndEnvSettings(settings_data);
+            if (settings_cache.size() >= kMaxCachedSettings) {
+                settings_cache.clear();
+            }
+            settings_cache.emplace(std::move(key), ParsedSettings(*settings_data));
+        }
+    }
+
+    // Grab application name here while we have access to it and know if to save it or not
+    if (settings_data->message_format_settings->display_application_name) {
+        settings_data->message_format_settings->application_name =
+            settings_data->create_info->pApplicationInfo ? settings_data->create_info->pApplicationInfo->pApplicationName : "";
+    }
 #endif
 }
@@ -79,6 +79,12 @@ enum EnableFlags {
     vendor_specific_nvidia,
     debug_printf_validation,
     sync_validation,
+    unique_handles_slab,
+    deferred_shader_module_parsing,
+    object_lifetime_handle_sets,
+    thread_safety_owned_command_buffers,
+    best_practices_deferred_vendor_checks,
+    deferred_command_validation,
     // Insert new enables above this line
     kMaxEnableFlags,
 };
@@ -90,6 +96,7 @@ using CHECK_ENABLED = std::array<bool, kMaxEnableFlags>;
 
 struct GpuAVSettings;
 struct DebugPrintfSettings;
+struct SyncValSettings;
 struct MessageFormatSettings;
 struct ConfigAndEnvSettings {
     const char *layer_description;
@@ -98,10 +105,26 @@ struct ConfigAndEnvSettings {
     CHECK_DISABLED &disables;
     vvl::unordered_set<uint32_t> &message_filter_list;
     uint32_t *duplicate_message_limit;
+    bool *duplicate_message_limit_per_object;
     MessageFormatSettings *message_format_settings;
+    bool *async_message_delivery;
     bool *fine_grained_locking;
     GpuAVSettings *gpuav_settings;
     DebugPrintfSettings *printf_settings;
+    SyncValSettings *syncval_settings;
+    std::string *call_profile_file;
+    std::string *trace_file;
+    uint32_t *queue_retire_threads;
+    std::string *shader_validation_cache_path;
+    uint32_t *shader_validation_threads;
+    uint32_t *worker_threads;
+    bool *worker_thread_affinity;
+    uint32_t *frame_sampling_interval;
+    uint32_t *frame_sampling_time_budget;
+    std::vector<bool> *skipped_validate_calls;
+    vvl::AllocatorKind *allocator_kind;
+    bool *allocation_statistics;
+    uint32_t *allocation_statistics_period;
 };
 
 static const vvl::unordered_map<std::string, VkValidationFeatureDisableEXT> VkValFeatureDisableLookup = {
@@ -172,6 +195,12 @@ static const std::vector<std::string> EnableFlagNameHelper = {
     "VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_NVIDIA",                      // vendor_specific_nvidia,
     "VK_VALIDATION_FEATURE_ENABLE_DEBUG_PRINTF_EXT",                       // debug_printf,
     "VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION",             // sync_validation,
+    "VALIDATION_CHECK_ENABLE_UNIQUE_HANDLES_SLAB",                         // unique_handles_slab,
+    "VALIDATION_CHECK_ENABLE_DEFERRED_SHADER_MODULE_PARSING",              // deferred_shader_module_parsing,
+    "VALIDATION_CHECK_ENABLE_OBJECT_LIFETIME_HANDLE_SETS",                 // object_lifetime_handle_sets,
+    "VALIDATION_CHECK_ENABLE_THREAD_SAFETY_OWNED_COMMAND_BUFFERS",         // thread_safety_owned_command_buffers,
+    "VALIDATION_CHECK_ENABLE_BEST_PRACTICES_DEFERRED_VENDOR_CHECKS",       // best_practices_deferred_vendor_checks,
+    "VALIDATION_CHECK_ENABLE_DEFERRED_COMMAND_VALIDATION",                 // deferred_command_validation,
 };
 
 void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data);
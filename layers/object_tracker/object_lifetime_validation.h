@@ -16,6 +16,9 @@
  * limitations under the License.
  */
 
+#include "containers/handle_set.h"
+#include "containers/sharded_counter.h"
+
 extern uint64_t object_track_index;
 
 // Object Status -- used to track state of individual objects
@@ -31,9 +34,14 @@ struct ObjTrackState {
     VulkanObjectType object_type;                                  // Object type identifier
     ObjectStatusFlags status;                                      // Object state
     uint64_t parent_object;                                        // Parent object
-    std::unique_ptr<vvl::unordered_set<uint64_t> > child_objects;  // Child objects (used for VkDescriptorPool only)
+    std::unique_ptr<vvl::unordered_set<uint64_t> > child_objects;  // Child objects (used for VkDescriptorPool and VkCommandPool)
 };
 
+// Counted in the ObjectLifetimes statistics of the layer allocator
+inline std::shared_ptr<ObjTrackState> MakeObjTrackState() {
+    return vvl::AllocateShared<ObjTrackState, vvl::AllocationSubsystem::ObjectLifetimes>();
+}
+
 typedef vvl::concurrent_unordered_map<uint64_t, std::shared_ptr<ObjTrackState>, 6> object_map_type;
 // Used for GPL and we know there are at most only 4 libraries that should be used
 typedef vvl::concurrent_unordered_map<uint64_t, small_vector<std::shared_ptr<ObjTrackState>, 4>, 6> object_list_map_type;
@@ -54,22 +62,27 @@ class ObjectLifetimes : public ValidationObject {
     WriteLockGuard WriteSharedLock() { return WriteLockGuard(object_lifetime_mutex); }
     ReadLockGuard ReadSharedLock() const { return ReadLockGuard(object_lifetime_mutex); }
 
-    std::atomic<uint64_t> num_objects[kVulkanObjectTypeMax + 1];
-    std::atomic<uint64_t> num_total_objects;
+    // Every create and destroy updates them, from any thread
+    vvl::ShardedCounterArray<uint64_t, kVulkanObjectTypeMax + 1> num_objects;
     // Vector of unordered_maps per object type to hold ObjTrackState info
     object_map_type object_map[kVulkanObjectTypeMax + 1];
     // Special-case map for swapchain images
     object_map_type swapchain_image_map;
     object_list_map_type linked_graphics_pipeline_map;
+    // With the object_lifetime_handle_sets setting, the handles of object_map are also kept in per type sets that
+    // TracksObject() reads without locking. The ObjTrackState are still needed for the parent, pool and allocator checks.
+    std::unique_ptr<vvl::ConcurrentHandleSet[]> live_handles;
 
     void *device_createinfo_pnext;
     bool null_descriptor_enabled;
 
     // Constructor for object lifetime tracking
-    ObjectLifetimes() : num_objects{}, num_total_objects(0), device_createinfo_pnext(nullptr), null_descriptor_enabled(false) {
+    ObjectLifetimes() : device_createinfo_pnext(nullptr), null_descriptor_enabled(false) {
         container_type = LayerObjectTypeObjectTracker;
     }
     ~ObjectLifetimes() {
+        // Another ObjectLifetimes may be allocated at the same address
+        InvalidateTrackedObjectCaches();
         if (device_createinfo_pnext) {
             vku::FreePnextChain(device_createinfo_pnext);
         }
@@ -80,6 +93,9 @@ class ObjectLifetimes : public ValidationObject {
                       std::shared_ptr<ObjTrackState> pNode) {
         uint64_t object_handle = HandleToUint64(object);
         const bool inserted = map.insert(object_handle, pNode);
+        if (inserted && live_handles && &map == &object_map[object_type]) {
+            live_handles[object_type].Insert(object_handle);
+        }
         if (!inserted) {
             // The object should not already exist. If we couldn't add it to the map, there was probably
             // a race condition in the app. Report an error and move on.
@@ -101,11 +117,14 @@ class ObjectLifetimes : public ValidationObject {
                                      const Location &loc) const;
 
     void DestroyUndestroyedObjects(VulkanObjectType object_type);
+    void InitLiveHandleSets();
 
     void CreateQueue(VkQueue vkObj, const Location &loc);
-    void AllocateCommandBuffer(const VkCommandPool command_pool, const VkCommandBuffer command_buffer, VkCommandBufferLevel level,
-                               const Location &loc);
-    void AllocateDescriptorSet(VkDescriptorPool descriptor_pool, VkDescriptorSet descriptor_set, const Location &loc);
+    // Objects allocated from a pool by one call. The live handle set and the children of the pool are updated once for the
+    // whole array, which is the |array_field| parameter of the call.
+    template <typename T1>
+    void AllocatePoolObjects(VulkanObjectType object_type, VulkanObjectType pool_type, uint64_t pool, const T1 *objects,
+                             uint32_t count, const Location &loc, vvl::Field array_field);
     void AllocateDisplayKHR(VkPhysicalDevice physical_device, VkDisplayKHR display, const Location &loc);
     void CreateSwapchainImageObject(VkImage swapchain_image, VkSwapchainKHR swapchain, const Location &loc);
     void DestroyLeakedInstanceObjects();
@@ -122,6 +141,9 @@ class ObjectLifetimes : public ValidationObject {
                                         const VkAccelerationStructureBuildGeometryInfoKHR *infos, const Location &loc) const;
 
     bool TracksObject(uint64_t object_handle, VulkanObjectType object_type) const;
+    bool TracksObjectCached(uint64_t object_handle, VulkanObjectType object_type) const;
+    // Must be called whenever a tracked object is removed, so TracksObjectCached() does not return stale results
+    static void InvalidateTrackedObjectCaches();
     bool CheckObjectValidity(uint64_t object_handle, VulkanObjectType object_type, const char *invalid_handle_vuid,
                              const char *wrong_parent_vuid, const Location &loc, VulkanObjectType parent_type) const;
     bool CheckPipelineObjectValidity(uint64_t object_handle, const char *invalid_handle_vuid, const Location &loc) const;
@@ -141,22 +163,22 @@ class ObjectLifetimes : public ValidationObject {
         uint64_t object_handle = HandleToUint64(object);
         const bool custom_allocator = (pAllocator != nullptr);
         if (!object_map[object_type].contains(object_handle)) {
-            auto pNewObjNode = std::make_shared<ObjTrackState>();
+            auto pNewObjNode = MakeObjTrackState();
             pNewObjNode->object_type = object_type;
             pNewObjNode->status = custom_allocator ? OBJSTATUS_CUSTOM_ALLOCATOR : OBJSTATUS_NONE;
             pNewObjNode->handle = object_handle;
 
             InsertObject(object_map[object_type], object, object_type, loc, pNewObjNode);
-            num_objects[object_type]++;
-            num_total_objects++;
+            num_objects.Add(object_type, 1);
 
-            if (object_type == kVulkanObjectTypeDescriptorPool) {
+            if (object_type == kVulkanObjectTypeDescriptorPool || object_type == kVulkanObjectTypeCommandPool) {
                 pNewObjNode->child_objects.reset(new vvl::unordered_set<uint64_t>);
             }
         }
     }
 
     void DestroyObjectSilently(uint64_t object, VulkanObjectType object_type);
+    void DestroyPoolChildren(ObjTrackState &pool_node, VulkanObjectType child_type);
 
     template <typename T1>
     void RecordDestroyObject(T1 object_handle, VulkanObjectType object_type) {
@@ -21,8 +21,37 @@
 #include "object_lifetime_validation.h"
 #include "generated/layer_chassis_dispatch.h"
 
+#include <array>
+
 uint64_t object_track_index = 0;
 
+// Bumped each time objects are removed from any ObjectLifetimes, which drops the per thread caches below
+static std::atomic<uint64_t> tracked_object_cache_epoch{0};
+
+// The same pipeline layouts, descriptor sets and buffers are usually validated many times in a row while recording a
+// command buffer. Each thread remembers the last handles the ObjectLifetimes found, until an object is destroyed. Creating
+// objects does not invalidate anything, a handle that was tracked stays tracked until it is destroyed.
+struct TrackedObjectCache {
+    static constexpr uint32_t kSize = 32;
+    struct Entry {
+        uint64_t handle;
+        VulkanObjectType object_type;
+    };
+
+    const ObjectLifetimes *owner = nullptr;
+    uint64_t epoch = 0;
+    std::array<Entry, kSize> entries{};
+
+    static uint32_t Slot(uint64_t handle, VulkanObjectType object_type) {
+        const uint64_t hash = (handle ^ (uint64_t(object_type) << 56)) * 0x9e3779b97f4a7c15ULL;
+        return static_cast<uint32_t>(hash >> 59);
+    }
+};
+static_assert(TrackedObjectCache::kSize == 32, "Slot() returns the top 5 bits of the hash");
+static thread_local TrackedObjectCache tracked_object_cache;
+
+void ObjectLifetimes::InvalidateTrackedObjectCaches() { tracked_object_cache_epoch.fetch_add(1, std::memory_order_acq_rel); }
+
 VulkanTypedHandle ObjTrackStateTypedHandle(const ObjTrackState &track_state) {
     // TODO: Unify Typed Handle representation (i.e. VulkanTypedHandle everywhere there are handle/type pairs)
     VulkanTypedHandle typed_handle;
@@ -33,7 +62,11 @@ VulkanTypedHandle ObjTrackStateTypedHandle(const ObjTrackState &track_state) {
 
 bool ObjectLifetimes::TracksObject(uint64_t object_handle, VulkanObjectType object_type) const {
     // Look for object in object map
-    if (object_map[object_type].contains(object_handle)) {
+    if (live_handles) {
+        if (live_handles[object_type].Contains(object_handle)) {
+            return true;
+        }
+    } else if (object_map[object_type].contains(object_handle)) {
         return true;
     }
     // If object is an image, also look for it in the swapchain image map
@@ -43,12 +76,32 @@ bool ObjectLifetimes::TracksObject(uint64_t object_handle, VulkanObjectType obje
     return false;
 }
 
+bool ObjectLifetimes::TracksObjectCached(uint64_t object_handle, VulkanObjectType object_type) const {
+    auto &cache = tracked_object_cache;
+    // Read before the lookup: if the object is destroyed after it was found, the entry is dropped by the next call
+    const uint64_t epoch = tracked_object_cache_epoch.load(std::memory_order_acquire);
+    if (cache.owner != this || cache.epoch != epoch) {
+        cache.owner = this;
+        cache.epoch = epoch;
+        cache.entries.fill({0, kVulkanObjectTypeUnknown});
+    }
+    auto &entry = cache.entries[TrackedObjectCache::Slot(object_handle, object_type)];
+    if (entry.handle == object_handle && entry.object_type == object_type && object_handle != 0) {
+        return true;
+    }
+    if (!TracksObject(object_handle, object_type)) {
+        return false;
+    }
+    entry = {object_handle, object_type};
+    return true;
+}
+
 bool ObjectLifetimes::CheckObjectValidity(uint64_t object_handle, VulkanObjectType object_type, const char *invalid_handle_vuid,
                                           const char *wrong_parent_vuid, const Location &loc, VulkanObjectType parent_type) const {
     constexpr bool skip = false;
 
     // If this instance of lifetime validation tracks the object, report success
-    if (TracksObject(object_handle, object_type)) {
+    if (TracksObjectCached(object_handle, object_type)) {
         // special case if for pipeline if using GPL
         // If destroying, even if the child libraries are gone, the user still a way to remove the bad parent pipeline library
         if (object_type == kVulkanObjectTypePipeline && loc.function != Func::vkDestroyPipeline) {
@@ -152,12 +205,34 @@ void ObjectLifetimes::DestroyObjectSilently(uint64_t object, VulkanObjectType ob
 
         return;
     }
-    assert(num_total_objects > 0);
+    if (live_handles) {
+        live_handles[object_type].Erase(object);
+    }
+    InvalidateTrackedObjectCaches();
+    assert(num_objects.Load(item->second->object_type) > 0);
+    num_objects.Subtract(item->second->object_type, 1);
+}
 
-    num_total_objects--;
-    assert(num_objects[item->second->object_type] > 0);
+// Removes all the objects allocated from a pool, without looking at the other objects of the same type. The caller holds the
+// write lock.
+void ObjectLifetimes::DestroyPoolChildren(ObjTrackState &pool_node, VulkanObjectType child_type) {
+    uint64_t destroyed_count = 0;
+    for (const uint64_t child : *pool_node.child_objects) {
+        // Children freed with the wrong pool are already gone
+        if (object_map[child_type].pop(child) != object_map[child_type].end()) {
+            if (live_handles) {
+                live_handles[child_type].Erase(child);
+            }
+            ++destroyed_count;
+        }
+    }
+    pool_node.child_objects->clear();
+    if (destroyed_count > 0) {
+        InvalidateTrackedObjectCaches();
+    }
 
-    num_objects[item->second->object_type]--;
+    assert(num_objects.Load(child_type) >= destroyed_count);
+    num_objects.Subtract(child_type, destroyed_count);
 }
 
 // Destroy memRef lists and free all memory
@@ -166,12 +241,24 @@ void ObjectLifetimes::DestroyQueueDataStructures() {
     auto snapshot = object_map[kVulkanObjectTypeQueue].snapshot();
     for (const auto &queue : snapshot) {
         uint32_t obj_index = queue.second->object_type;
-        assert(num_total_objects > 0);
-        num_total_objects--;
-        assert(num_objects[obj_index] > 0);
-        num_objects[obj_index]--;
+        assert(num_objects.Load(obj_index) > 0);
+        num_objects.Subtract(obj_index, 1);
         object_map[kVulkanObjectTypeQueue].erase(queue.first);
+        if (live_handles) {
+            live_handles[kVulkanObjectTypeQueue].Erase(queue.first);
+        }
     }
+    InvalidateTrackedObjectCaches();
+}
+
+void ObjectLifetimes::InitLiveHandleSets() {
+    auto sets = std::make_unique<vvl::ConcurrentHandleSet[]>(kVulkanObjectTypeMax + 1);
+    for (uint32_t object_type = 0; object_type <= kVulkanObjectTypeMax; ++object_type) {
+        for (const auto &item : object_map[object_type].snapshot()) {
+            sets[object_type].Insert(item.first);
+        }
+    }
+    live_handles = std::move(sets);
 }
 
 void ObjectLifetimes::DestroyUndestroyedObjects(VulkanObjectType object_type) {
@@ -188,16 +275,41 @@ bool ObjectLifetimes::ValidateAnonymousObject(uint64_t object, VkObjectType core
     return CheckObjectValidity(object, object_type, invalid_handle_vuid, wrong_parent_vuid, loc, kVulkanObjectTypeDevice);
 }
 
-void ObjectLifetimes::AllocateCommandBuffer(const VkCommandPool command_pool, const VkCommandBuffer command_buffer,
-                                            VkCommandBufferLevel level, const Location &loc) {
-    auto new_obj_node = std::make_shared<ObjTrackState>();
-    new_obj_node->object_type = kVulkanObjectTypeCommandBuffer;
-    new_obj_node->handle = HandleToUint64(command_buffer);
-    new_obj_node->parent_object = HandleToUint64(command_pool);
+template <typename T1>
+void ObjectLifetimes::AllocatePoolObjects(VulkanObjectType object_type, VulkanObjectType pool_type, uint64_t pool,
+                                          const T1 *objects, uint32_t count, const Location &loc, vvl::Field array_field) {
+    small_vector<uint64_t, 32> inserted_handles;
+    inserted_handles.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        auto new_obj_node = MakeObjTrackState();
+        new_obj_node->object_type = object_type;
+        new_obj_node->status = OBJSTATUS_NONE;
+        new_obj_node->handle = HandleToUint64(objects[i]);
+        new_obj_node->parent_object = pool;
+        if (object_map[object_type].insert(new_obj_node->handle, new_obj_node)) {
+            inserted_handles.emplace_back(new_obj_node->handle);
+        } else {
+            // See InsertObject()
+            (void)LogError("UNASSIGNED-ObjectTracker-Insert", objects[i], loc.dot(array_field, i),
+                           "Couldn't insert %s Object 0x%" PRIxLEAST64
+                           ", already existed. This should not happen and may indicate a "
+                           "race condition in the application.",
+                           string_VulkanObjectType(object_type), new_obj_node->handle);
+        }
+    }
+    if (live_handles) {
+        live_handles[object_type].InsertBatch(inserted_handles.data(), inserted_handles.size());
+    }
+    num_objects.Add(object_type, count);
 
-    InsertObject(object_map[kVulkanObjectTypeCommandBuffer], command_buffer, kVulkanObjectTypeCommandBuffer, loc, new_obj_node);
-    num_objects[kVulkanObjectTypeCommandBuffer]++;
-    num_total_objects++;
+    auto itr = object_map[pool_type].find(pool);
+    if (itr != object_map[pool_type].end()) {
+        auto &child_objects = *itr->second->child_objects;
+        child_objects.reserve(child_objects.size() + count);
+        for (uint32_t i = 0; i < count; ++i) {
+            child_objects.insert(HandleToUint64(objects[i]));
+        }
+    }
 }
 
 bool ObjectLifetimes::ValidateCommandBuffer(VkCommandPool command_pool, VkCommandBuffer command_buffer, const Location &loc) const {
@@ -222,22 +334,6 @@ bool ObjectLifetimes::ValidateCommandBuffer(VkCommandPool command_pool, VkComman
     return skip;
 }
 
-void ObjectLifetimes::AllocateDescriptorSet(VkDescriptorPool descriptor_pool, VkDescriptorSet descriptor_set, const Location &loc) {
-    auto new_obj_node = std::make_shared<ObjTrackState>();
-    new_obj_node->object_type = kVulkanObjectTypeDescriptorSet;
-    new_obj_node->status = OBJSTATUS_NONE;
-    new_obj_node->handle = HandleToUint64(descriptor_set);
-    new_obj_node->parent_object = HandleToUint64(descriptor_pool);
-    InsertObject(object_map[kVulkanObjectTypeDescriptorSet], descriptor_set, kVulkanObjectTypeDescriptorSet, loc, new_obj_node);
-    num_objects[kVulkanObjectTypeDescriptorSet]++;
-    num_total_objects++;
-
-    auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptor_pool));
-    if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        itr->second->child_objects->insert(HandleToUint64(descriptor_set));
-    }
-}
-
 bool ObjectLifetimes::ValidateDescriptorSet(VkDescriptorPool descriptor_pool, VkDescriptorSet descriptor_set,
                                             const Location &loc) const {
     bool skip = false;
@@ -400,10 +496,9 @@ void ObjectLifetimes::CreateQueue(VkQueue vkObj, const Location &loc) {
     std::shared_ptr<ObjTrackState> p_obj_node = NULL;
     auto queue_item = object_map[kVulkanObjectTypeQueue].find(HandleToUint64(vkObj));
     if (queue_item == object_map[kVulkanObjectTypeQueue].end()) {
-        p_obj_node = std::make_shared<ObjTrackState>();
+        p_obj_node = MakeObjTrackState();
         InsertObject(object_map[kVulkanObjectTypeQueue], vkObj, kVulkanObjectTypeQueue, loc, p_obj_node);
-        num_objects[kVulkanObjectTypeQueue]++;
-        num_total_objects++;
+        num_objects.Add(kVulkanObjectTypeQueue, 1);
     } else {
         p_obj_node = queue_item->second;
     }
@@ -414,7 +509,7 @@ void ObjectLifetimes::CreateQueue(VkQueue vkObj, const Location &loc) {
 
 void ObjectLifetimes::CreateSwapchainImageObject(VkImage swapchain_image, VkSwapchainKHR swapchain, const Location &loc) {
     if (!swapchain_image_map.contains(HandleToUint64(swapchain_image))) {
-        auto new_obj_node = std::make_shared<ObjTrackState>();
+        auto new_obj_node = MakeObjTrackState();
         new_obj_node->object_type = kVulkanObjectTypeImage;
         new_obj_node->status = OBJSTATUS_NONE;
         new_obj_node->handle = HandleToUint64(swapchain_image);
@@ -607,11 +702,7 @@ void ObjectLifetimes::PreCallRecordResetDescriptorPool(VkDevice device, VkDescri
     // our descriptorSet map.
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet);
-        }
-        pool_node->child_objects->clear();
+        DestroyPoolChildren(*itr->second, kVulkanObjectTypeDescriptorSet);
     }
 }
 
@@ -736,6 +827,9 @@ void ObjectLifetimes::PostCallRecordCreateDevice(VkPhysicalDevice physicalDevice
     const auto *robustness2_features =
         vku::FindStructInPNextChain<VkPhysicalDeviceRobustness2FeaturesEXT>(object_tracking->device_createinfo_pnext);
     object_tracking->null_descriptor_enabled = robustness2_features && robustness2_features->nullDescriptor;
+    if (object_tracking->enabled[object_lifetime_handle_sets]) {
+        object_tracking->InitLiveHandleSets();
+    }
 }
 
 bool ObjectLifetimes::PreCallValidateAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *pAllocateInfo,
@@ -752,10 +846,9 @@ bool ObjectLifetimes::PreCallValidateAllocateCommandBuffers(VkDevice device, con
 void ObjectLifetimes::PostCallRecordAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *pAllocateInfo,
                                                            VkCommandBuffer *pCommandBuffers, const RecordObject &record_obj) {
     if (record_obj.result < VK_SUCCESS) return;
-    for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; i++) {
-        AllocateCommandBuffer(pAllocateInfo->commandPool, pCommandBuffers[i], pAllocateInfo->level,
-                              record_obj.location.dot(Field::pCommandBuffers, i));
-    }
+    auto lock = WriteSharedLock();
+    AllocatePoolObjects(kVulkanObjectTypeCommandBuffer, kVulkanObjectTypeCommandPool, HandleToUint64(pAllocateInfo->commandPool),
+                        pCommandBuffers, pAllocateInfo->commandBufferCount, record_obj.location, Field::pCommandBuffers);
 }
 
 bool ObjectLifetimes::PreCallValidateAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo *pAllocateInfo,
@@ -780,10 +873,9 @@ void ObjectLifetimes::PostCallRecordAllocateDescriptorSets(VkDevice device, cons
                                                            VkDescriptorSet *pDescriptorSets, const RecordObject &record_obj) {
     if (record_obj.result < VK_SUCCESS) return;
     auto lock = WriteSharedLock();
-    for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; i++) {
-        AllocateDescriptorSet(pAllocateInfo->descriptorPool, pDescriptorSets[i],
-                              record_obj.location.dot(Field::pDescriptorSets, i));
-    }
+    AllocatePoolObjects(kVulkanObjectTypeDescriptorSet, kVulkanObjectTypeDescriptorPool,
+                        HandleToUint64(pAllocateInfo->descriptorPool), pDescriptorSets, pAllocateInfo->descriptorSetCount,
+                        record_obj.location, Field::pDescriptorSets);
 }
 
 bool ObjectLifetimes::PreCallValidateFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
@@ -807,8 +899,17 @@ bool ObjectLifetimes::PreCallValidateFreeCommandBuffers(VkDevice device, VkComma
 
 void ObjectLifetimes::PreCallRecordFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
                                                       const VkCommandBuffer *pCommandBuffers, const RecordObject &record_obj) {
+    auto lock = WriteSharedLock();
+    std::shared_ptr<ObjTrackState> pool_node = nullptr;
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(commandPool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end()) {
+        pool_node = itr->second;
+    }
     for (uint32_t i = 0; i < commandBufferCount; i++) {
         RecordDestroyObject(pCommandBuffers[i], kVulkanObjectTypeCommandBuffer);
+        if (pool_node) {
+            pool_node->child_objects->erase(HandleToUint64(pCommandBuffers[i]));
+        }
     }
 }
 
@@ -821,6 +922,7 @@ void ObjectLifetimes::PreCallRecordDestroySwapchainKHR(VkDevice device, VkSwapch
     for (const auto &itr : snapshot) {
         swapchain_image_map.erase(itr.first);
     }
+    InvalidateTrackedObjectCaches();
 }
 
 bool ObjectLifetimes::PreCallValidateFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool,
@@ -889,11 +991,7 @@ void ObjectLifetimes::PreCallRecordDestroyDescriptorPool(VkDevice device, VkDesc
     auto lock = WriteSharedLock();
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet);
-        }
-        pool_node->child_objects->clear();
+        DestroyPoolChildren(*itr->second, kVulkanObjectTypeDescriptorSet);
     }
     RecordDestroyObject(descriptorPool, kVulkanObjectTypeDescriptorPool);
 }
@@ -901,6 +999,7 @@ void ObjectLifetimes::PreCallRecordDestroyDescriptorPool(VkDevice device, VkDesc
 bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
                                                         const VkAllocationCallbacks *pAllocator,
                                                         const ErrorObject &error_obj) const {
+    auto lock = ReadSharedLock();
     bool skip = false;
     // Checked by chassis: device: "VUID-vkDestroyCommandPool-device-parameter"
 
@@ -908,13 +1007,14 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
     skip |= ValidateObject(commandPool, kVulkanObjectTypeCommandPool, true, "VUID-vkDestroyCommandPool-commandPool-parameter",
                            "VUID-vkDestroyCommandPool-commandPool-parent", command_pool_loc);
 
-    auto snapshot = object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](const std::shared_ptr<ObjTrackState> &pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
-    for (const auto &itr : snapshot) {
-        auto node = itr.second;
-        skip |= ValidateCommandBuffer(commandPool, reinterpret_cast<VkCommandBuffer>(itr.first), command_pool_loc);
-        skip |= ValidateDestroyObject(reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer, nullptr,
-                                      kVUIDUndefined, kVUIDUndefined, error_obj.location);
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(commandPool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end()) {
+        auto pool_node = itr->second;
+        for (auto command_buffer : *pool_node->child_objects) {
+            skip |= ValidateCommandBuffer(commandPool, reinterpret_cast<VkCommandBuffer>(command_buffer), command_pool_loc);
+            skip |= ValidateDestroyObject(reinterpret_cast<VkCommandBuffer>(command_buffer), kVulkanObjectTypeCommandBuffer,
+                                          nullptr, kVUIDUndefined, kVUIDUndefined, error_obj.location);
+        }
     }
     skip |=
         ValidateDestroyObject(commandPool, kVulkanObjectTypeCommandPool, pAllocator, "VUID-vkDestroyCommandPool-commandPool-00042",
@@ -924,11 +1024,11 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
 
 void ObjectLifetimes::PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
                                                       const VkAllocationCallbacks *pAllocator, const RecordObject &record_obj) {
-    auto snapshot = object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](const std::shared_ptr<ObjTrackState> &pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
+    auto lock = WriteSharedLock();
     // A CommandPool's cmd buffers are implicitly deleted when pool is deleted. Remove this pool's cmdBuffers from cmd buffer map.
-    for (const auto &itr : snapshot) {
-        RecordDestroyObject(reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer);
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(commandPool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end()) {
+        DestroyPoolChildren(*itr->second, kVulkanObjectTypeCommandBuffer);
     }
     RecordDestroyObject(commandPool, kVulkanObjectTypeCommandPool);
 }
@@ -963,14 +1063,13 @@ void ObjectLifetimes::PostCallRecordGetPhysicalDeviceQueueFamilyProperties2KHR(V
 void ObjectLifetimes::AllocateDisplayKHR(VkPhysicalDevice physical_device, VkDisplayKHR display, const Location &loc) {
     auto iter = object_map[kVulkanObjectTypeDisplayKHR].find(HandleToUint64(display));
     if (iter == object_map[kVulkanObjectTypeDisplayKHR].end()) {
-        auto new_obj_node = std::make_shared<ObjTrackState>();
+        auto new_obj_node = MakeObjTrackState();
         new_obj_node->status = OBJSTATUS_NONE;
         new_obj_node->object_type = kVulkanObjectTypeDisplayKHR;
         new_obj_node->handle = HandleToUint64(display);
         new_obj_node->parent_object = HandleToUint64(physical_device);
         InsertObject(object_map[kVulkanObjectTypeDisplayKHR], display, kVulkanObjectTypeDisplayKHR, loc, new_obj_node);
-        num_objects[kVulkanObjectTypeDisplayKHR]++;
-        num_total_objects++;
+        num_objects.Add(kVulkanObjectTypeDisplayKHR, 1);
     }
 }
 
@@ -26,10 +26,19 @@ static VkExternalMemoryHandleTypeFlags GetExternalHandleTypes(const VkBufferCrea
     return external_memory_info ? external_memory_info->handleTypes : 0;
 }
 
-static VkMemoryRequirements GetMemoryRequirements(ValidationStateTracker &dev_data, VkBuffer buffer) {
-    VkMemoryRequirements result{};
-    DispatchGetBufferMemoryRequirements(dev_data.device, buffer, &result);
-    return result;
+static VkMemoryRequirements GetMemoryRequirements(ValidationStateTracker &dev_data, VkBuffer buffer,
+                                                  const VkBufferCreateInfo &create_info) {
+    vvl::MemoryRequirementsCache::Key key;
+    const bool cacheable = dev_data.enabled_features.maintenance4 && vvl::MemoryRequirementsCache::GetKey(create_info, key);
+    vvl::MemoryRequirementsCache::Requirements result{};
+    if (cacheable && dev_data.memory_requirements_cache_.Find(key, result)) {
+        return result[0];
+    }
+    DispatchGetBufferMemoryRequirements(dev_data.device, buffer, &result[0]);
+    if (cacheable) {
+        dev_data.memory_requirements_cache_.Add(key, result);
+    }
+    return result[0];
 }
 
 static VkBufferUsageFlags2KHR GetBufferUsageFlags(const VkBufferCreateInfo &create_info) {
@@ -59,7 +68,7 @@ Buffer::Buffer(ValidationStateTracker &dev_data, VkBuffer handle, const VkBuffer
                (pCreateInfo->flags & VK_BUFFER_CREATE_PROTECTED_BIT) == 0, GetExternalHandleTypes(pCreateInfo)),
       safe_create_info(pCreateInfo),
       create_info(*safe_create_info.ptr()),
-      requirements(GetMemoryRequirements(dev_data, handle)),
+      requirements(GetMemoryRequirements(dev_data, handle, *pCreateInfo)),
       usage(GetBufferUsageFlags(create_info)),
       supported_video_profiles(dev_data.video_profile_cache_.Get(
           dev_data.physical_device, vku::FindStructInPNextChain<VkVideoProfileListInfoKHR>(pCreateInfo->pNext))) {
@@ -167,8 +167,9 @@ const vvl::ImageView *CommandBuffer::GetActiveAttachmentImageViewState(uint32_t
 
 void CommandBuffer::AddChild(std::shared_ptr<StateObject> &child_node) {
     assert(child_node);
-    if (child_node->AddParent(this)) {
-        object_bindings.insert(child_node);
+    // AddParent() cannot tell if this command buffer was already a parent, object_bindings can
+    if (object_bindings.insert(child_node).second) {
+        child_node->AddParent(this);
     }
 }
 
@@ -178,15 +179,35 @@ void CommandBuffer::RemoveChild(std::shared_ptr<StateObject> &child_node) {
     object_bindings.erase(child_node);
 }
 
+// Containers keep their storage when cleared, so a command buffer recorded again with similar content does not allocate.
+// Clearing an empty std::unordered_map still writes all of its buckets, so that is skipped.
+template <typename Container>
+static void ClearIfUsed(Container &container) {
+    if (!container.empty()) {
+        container.clear();
+    }
+}
+
+static uint64_t NextRecordingId() {
+    static std::atomic<uint64_t> next_recording_id{1};
+    return next_recording_id.fetch_add(1, std::memory_order_relaxed);
+}
+
 // Reset the command buffer state
 // Maintain the createInfo and set state to CB_NEW, but clear all other state
 void CommandBuffer::ResetCBState() {
+    defer_invalidations_.store(false, std::memory_order_release);
+    // The deferred validations read the state being reset
+    WaitDeferredValidations();
+    deferred_validation_tasks.reset();
+    deferred_validations.clear();
+
     // Remove object bindings
     for (const auto &obj : object_bindings) {
         obj->RemoveParent(this);
     }
-    object_bindings.clear();
-    broken_bindings.clear();
+    ClearIfUsed(object_bindings);
+    ClearIfUsed(broken_bindings);
 
     // Reset CB state (note that createInfo is not cleared)
     memset(&beginInfo, 0, sizeof(VkCommandBufferBeginInfo));
@@ -202,12 +223,13 @@ void CommandBuffer::ResetCBState() {
     command_count = 0;
     submitCount = 0;
     image_layout_change_count = 1;  // Start at 1. 0 is insert value for validation cache versions, s.t. new == dirty
+    recording_id = NextRecordingId();
     dynamic_state_status.cb.reset();
     dynamic_state_status.pipeline.reset();
     dynamic_state_status.rtx_stack_size_cb = false;
     dynamic_state_status.rtx_stack_size_pipeline = false;
     dynamic_state_value.reset();
-    inheritedViewportDepths.clear();
+    ClearIfUsed(inheritedViewportDepths);
     usedViewportScissorCount = 0;
     pipelineStaticViewportCount = 0;
     pipelineStaticScissorCount = 0;
@@ -222,29 +244,46 @@ void CommandBuffer::ResetCBState() {
     usedDynamicViewportCount = false;
     usedDynamicScissorCount = false;
     dirtyStaticState = false;
+    validated_action_state.fill(ValidatedActionState{});
+    ClearIfUsed(validated_descriptor_buffer_offsets.offsets);
+    ClearIfUsed(validated_shader_objects.combinations);
 
-    active_render_pass_begin_info = vku::safe_VkRenderPassBeginInfo();
+    if (reset_dirty_mask_ & kResetRenderPass) {
+        active_render_pass_begin_info = vku::safe_VkRenderPassBeginInfo();
+        active_attachments.clear();
+        active_subpasses.clear();
+        ClearIfUsed(active_color_attachments_index);
+    }
     activeRenderPass = nullptr;
     attachment_source = AttachmentSource::Empty;
-    active_attachments.clear();
-    active_subpasses.clear();
-    active_color_attachments_index.clear();
     has_render_pass_striped = false;
     striped_count = 0;
     activeSubpassContents = VK_SUBPASS_CONTENTS_INLINE;
     SetActiveSubpass(0);
     rendering_attachments.Reset();
-    waitedEvents.clear();
+    ClearIfUsed(waitedEvents);
     events.clear();
     writeEventsBeforeWait.clear();
-    activeQueries.clear();
-    startedQueries.clear();
-    renderPassQueries.clear();
-    image_layout_map.clear();
-    aliased_image_layout_map.clear();
-    current_vertex_buffer_binding_info.clear();
+    ClearIfUsed(activeQueries);
+    ClearIfUsed(startedQueries);
+    ClearIfUsed(renderPassQueries);
+
+    // Only the previous recording is kept, the maps of images it did not use again are released
+    ClearIfUsed(layout_map_pool_);
+    for (auto &entry : image_layout_map) {
+        // Maps of aliasing images are shared with aliased_image_layout_map, so they are never pooled. The image itself
+        // might be gone already and must not be looked at, the id check on reuse guarantees it is alive.
+        if (entry.second.map && entry.second.map.use_count() == 1) {
+            entry.second.map->Clear();
+            layout_map_pool_.emplace(entry.first, std::move(entry.second));
+        }
+    }
+    ClearIfUsed(image_layout_map);
+    ClearIfUsed(aliased_image_layout_map);
+    ClearIfUsed(pending_secondary_layouts_);
+    ClearIfUsed(current_vertex_buffer_binding_info);
     primaryCommandBuffer = VK_NULL_HANDLE;
-    linkedCommandBuffers.clear();
+    ClearIfUsed(linkedCommandBuffers);
     queue_submit_functions.clear();
     queue_submit_functions_after_render_pass.clear();
     cmd_execute_commands_functions.clear();
@@ -254,6 +293,16 @@ void CommandBuffer::ResetCBState() {
     for (auto &item : lastBound) {
         item.Reset();
     }
+    // The sets still held elsewhere are given up, like the bound push descriptor sets were before the pool
+    for (auto it = push_descriptor_set_pool_.begin(); it != push_descriptor_set_pool_.end();) {
+        if (it->second.use_count() == 1) {
+            it->second->ResetPushDescriptors();
+            ++it;
+        } else {
+            it->second->Destroy();
+            it = push_descriptor_set_pool_.erase(it);
+        }
+    }
     activeFramebuffer = VK_NULL_HANDLE;
     index_buffer_binding.reset();
 
@@ -261,22 +310,27 @@ void CommandBuffer::ResetCBState() {
     qfo_transfer_buffer_barriers.Reset();
 
     // Clean up video specific states
-    bound_video_session = nullptr;
-    bound_video_session_parameters = nullptr;
-    bound_video_picture_resources.clear();
+    if (reset_dirty_mask_ & kResetVideo) {
+        bound_video_session = nullptr;
+        bound_video_session_parameters = nullptr;
+        ClearIfUsed(bound_video_picture_resources);
+    }
     video_encode_quality_level.reset();
-    video_session_updates.clear();
-
-    // Clean up the label data
-    debug_label.Reset();
-    label_stack_depth_ = 0;
-    label_commands_.clear();
+    ClearIfUsed(video_session_updates);
 
     transform_feedback_active = false;
     transform_feedback_buffers_bound = 0;
 
     // Clean up the label data
-    dev_data.debug_report->ResetCmdDebugUtilsLabel(VkHandle());
+    if (reset_dirty_mask_ & kResetLabels) {
+        debug_label.Reset();
+        label_stack_depth_ = 0;
+        label_commands_.clear();
+        // Takes the lock of the debug output
+        dev_data.debug_report->ResetCmdDebugUtilsLabel(VkHandle());
+    }
+
+    reset_dirty_mask_ = 0;
 }
 
 void CommandBuffer::Reset() {
@@ -314,6 +368,7 @@ void CommandBuffer::ResetPushConstantDataIfIncompatible(const vvl::PipelineLayou
     }
 
     push_constant_data_ranges = pipeline_layout_state->push_constant_ranges;
+    DirtyActionState(kActionStatePushConstants);
     push_constant_data.clear();
     uint32_t size_needed = 0;
     for (const auto &push_constant_range : *push_constant_data_ranges) {
@@ -329,6 +384,8 @@ void CommandBuffer::Destroy() {
     {
         auto guard = WriteLock();
         ResetCBState();
+        layout_map_pool_.clear();
+        push_descriptor_set_pool_.clear();
     }
     StateObject::Destroy();
 }
@@ -337,6 +394,7 @@ void CommandBuffer::NotifyInvalidate(const StateObject::NodeList &invalid_nodes,
     {
         auto guard = WriteLock();
         assert(!invalid_nodes.empty());
+        DirtyActionState(kActionStateAll);
         // Save all of the vulkan handles between the command buffer and the now invalid node
         LogObjectList log_list;
         for (auto &obj : invalid_nodes) {
@@ -361,6 +419,7 @@ void CommandBuffer::NotifyInvalidate(const StateObject::NodeList &invalid_nodes,
                 case kVulkanObjectTypeImage:
                     if (unlink) {
                         image_layout_map.erase(obj->Handle().Cast<VkImage>());
+                        pending_secondary_layouts_.erase(obj->Handle().Cast<VkImage>());
                     }
                     break;
                 default:
@@ -379,10 +438,63 @@ void CommandBuffer::NotifyInvalidate(const StateObject::NodeList &invalid_nodes,
     StateObject::NotifyInvalidate(invalid_nodes, unlink);
 }
 
-const CommandBuffer::ImageLayoutMap &CommandBuffer::GetImageSubresourceLayoutMap() const { return image_layout_map; }
+bool CommandBuffer::DefersInvalidate(const StateObject::NodeList &invalid_nodes) const {
+    // Commands recorded after an object became invalid report it right away. The primaries of secondary command buffers
+    // are only reached through the secondaries, which don't defer.
+    if (!IsPrimary() || !defer_invalidations_.load(std::memory_order_acquire)) {
+        return false;
+    }
+    // Derived command buffers record the destroyed events when they are notified
+    for (const auto &node : invalid_nodes) {
+        if (node->Type() == kVulkanObjectTypeEvent) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void CommandBuffer::ApplyDeferredInvalidations() {
+    const uint64_t generation = StateObject::CurrentInvalidateGeneration();
+    if (!defer_invalidations_.load(std::memory_order_acquire) ||
+        checked_invalidate_generation_.load(std::memory_order_acquire) == generation) {
+        return;
+    }
+    StateObject::NodeList invalid_nodes;
+    {
+        auto guard = WriteLock();
+        const uint64_t checked_generation = checked_invalidate_generation_.exchange(generation, std::memory_order_acq_rel);
+        for (const auto &obj : object_bindings) {
+            if (obj->InvalidatedGeneration() > checked_generation) {
+                invalid_nodes.emplace_back(obj);
+            }
+        }
+    }
+    if (invalid_nodes.empty()) {
+        return;
+    }
+    // The validations deferred at End() read the state changed here
+    WaitDeferredValidations();
+    // Each one on its own, the chain of objects that led to it is not known anymore. A secondary command buffer is only
+    // invalidated when destroyed or reset, like the notification from it the link is removed.
+    for (const auto &obj : invalid_nodes) {
+        const bool unlink = obj->Destroyed() || obj->Type() == kVulkanObjectTypeCommandBuffer;
+        NotifyInvalidate(StateObject::NodeList{obj}, unlink);
+    }
+}
+
+// The merges of the const accessors only happen while this command buffer is recorded, which the application synchronizes
+const CommandBuffer::ImageLayoutMap &CommandBuffer::GetImageSubresourceLayoutMap() const {
+    if (!pending_secondary_layouts_.empty()) {
+        const_cast<CommandBuffer *>(this)->MergeAllSecondaryLayouts();
+    }
+    return image_layout_map;
+}
 
 // The const variant only need the image as it is the key for the map
 std::shared_ptr<const ImageSubresourceLayoutMap> CommandBuffer::GetImageSubresourceLayoutMap(VkImage image) const {
+    if (!pending_secondary_layouts_.empty()) {
+        const_cast<CommandBuffer *>(this)->MergeSecondaryLayouts(image);
+    }
     auto it = image_layout_map.find(image);
     if (it == image_layout_map.cend()) {
         return nullptr;
@@ -396,6 +508,9 @@ std::shared_ptr<ImageSubresourceLayoutMap> CommandBuffer::GetImageSubresourceLay
     if (image_state.Destroyed() || !image_state.layout_range_map) {
         return nullptr;
     }
+    if (!pending_secondary_layouts_.empty()) {
+        MergeSecondaryLayouts(image_state.VkHandle());
+    }
     auto iter = image_layout_map.find(image_state.VkHandle());
     if (iter != image_layout_map.end() && image_state.GetId() == iter->second.id) {
         return iter->second.map;
@@ -419,7 +534,14 @@ std::shared_ptr<ImageSubresourceLayoutMap> CommandBuffer::GetImageSubresourceLay
         }
 
     } else {
-        layout_map = std::make_shared<ImageSubresourceLayoutMap>(image_state);
+        // The same images are usually used again when a command buffer is recorded again
+        auto pooled = layout_map_pool_.find(image_state.VkHandle());
+        if (pooled != layout_map_pool_.end() && pooled->second.id == image_state.GetId()) {
+            layout_map = std::move(pooled->second.map);
+            layout_map_pool_.erase(pooled);
+        } else {
+            layout_map = std::make_shared<ImageSubresourceLayoutMap>(image_state);
+        }
     }
     if (iter != image_layout_map.end()) {
         // overwrite the stale entry
@@ -432,8 +554,42 @@ std::shared_ptr<ImageSubresourceLayoutMap> CommandBuffer::GetImageSubresourceLay
     return layout_map;
 }
 
+void CommandBuffer::MergeSecondaryLayouts(VkImage image) {
+    auto pending = pending_secondary_layouts_.find(image);
+    if (pending == pending_secondary_layouts_.end()) {
+        return;
+    }
+    // Taken out first, looking the image up below must not merge it again
+    const auto layout_states = std::move(pending->second);
+    pending_secondary_layouts_.erase(pending);
+
+    const auto image_state = dev_data.Get<vvl::Image>(image);
+    if (!image_state || image_state->Destroyed()) {
+        return;
+    }
+    std::shared_ptr<ImageSubresourceLayoutMap> cb_subres_map;
+    for (const LayoutState &layout_state : layout_states) {
+        if (image_state->GetId() != layout_state.id) {
+            continue;
+        }
+        if (!cb_subres_map) {
+            cb_subres_map = GetImageSubresourceLayoutMap(*image_state);
+            if (!cb_subres_map) {
+                return;
+            }
+        }
+        cb_subres_map->UpdateFrom(*layout_state.map);
+    }
+}
+
+void CommandBuffer::MergeAllSecondaryLayouts() {
+    while (!pending_secondary_layouts_.empty()) {
+        MergeSecondaryLayouts(pending_secondary_layouts_.begin()->first);
+    }
+}
+
 static bool SetQueryState(const QueryObject &object, QueryState value, QueryMap *localQueryToStateMap) {
-    (*localQueryToStateMap)[object] = value;
+    localQueryToStateMap->Set(object, value);
     return false;
 }
 
@@ -479,7 +635,7 @@ static bool SetQueryStateMulti(VkQueryPool queryPool, uint32_t firstQuery, uint3
                                QueryMap *localQueryToStateMap) {
     for (uint32_t i = 0; i < queryCount; i++) {
         QueryObject query_obj = {queryPool, firstQuery + i, perfPass};
-        (*localQueryToStateMap)[query_obj] = value;
+        localQueryToStateMap->Set(query_obj, value);
     }
     return false;
 }
@@ -581,6 +737,7 @@ void CommandBuffer::UpdateAttachmentsView(const VkRenderPassBeginInfo *pRenderPa
 
 void CommandBuffer::BeginRenderPass(Func command, const VkRenderPassBeginInfo *pRenderPassBegin, const VkSubpassContents contents) {
     RecordCmd(command);
+    reset_dirty_mask_ |= kResetRenderPass;
     activeFramebuffer = dev_data.Get<vvl::Framebuffer>(pRenderPassBegin->framebuffer);
     activeRenderPass = dev_data.Get<vvl::RenderPass>(pRenderPassBegin->renderPass);
     active_render_pass_begin_info = vku::safe_VkRenderPassBeginInfo(pRenderPassBegin);
@@ -658,6 +815,7 @@ void CommandBuffer::EndRenderPass(Func command) {
 
 void CommandBuffer::BeginRendering(Func command, const VkRenderingInfo *pRenderingInfo) {
     RecordCmd(command);
+    reset_dirty_mask_ |= kResetRenderPass;
     activeRenderPass = std::make_shared<vvl::RenderPass>(pRenderingInfo, true);
     renderPassQueries.clear();
 
@@ -751,6 +909,7 @@ void CommandBuffer::EndRendering(Func command) {
 
 void CommandBuffer::BeginVideoCoding(const VkVideoBeginCodingInfoKHR *pBeginInfo) {
     RecordCmd(Func::vkCmdBeginVideoCodingKHR);
+    reset_dirty_mask_ |= kResetVideo;
     bound_video_session = dev_data.Get<vvl::VideoSession>(pBeginInfo->videoSession);
     bound_video_session_parameters = dev_data.Get<vvl::VideoSessionParameters>(pBeginInfo->videoSessionParameters);
 
@@ -977,6 +1136,7 @@ void CommandBuffer::Begin(const VkCommandBufferBeginInfo *pBeginInfo) {
         beginInfo.pInheritanceInfo = &inheritanceInfo;
         // If we are a secondary command-buffer and inheriting.  Update the items we should inherit.
         if (beginInfo.flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT) {
+            reset_dirty_mask_ |= kResetRenderPass;
             if (beginInfo.pInheritanceInfo->renderPass) {
                 activeRenderPass = dev_data.Get<vvl::RenderPass>(beginInfo.pInheritanceInfo->renderPass);
                 SetActiveSubpass(beginInfo.pInheritanceInfo->subpass);
@@ -1028,8 +1188,15 @@ void CommandBuffer::Begin(const VkCommandBufferBeginInfo *pBeginInfo) {
 }
 
 void CommandBuffer::End(VkResult result) {
+    // Submit time validation reads image_layout_map directly
+    MergeAllSecondaryLayouts();
+    // Submit time validation merges the QFO transfers of the whole command buffer in one pass, which needs them sorted
+    qfo_transfer_buffer_barriers.Sort();
+    qfo_transfer_image_barriers.Sort();
     if (VK_SUCCESS == result) {
         state = CbState::Recorded;
+        checked_invalidate_generation_.store(StateObject::CurrentInvalidateGeneration(), std::memory_order_release);
+        defer_invalidations_.store(true, std::memory_order_release);
     }
 }
 
@@ -1050,15 +1217,10 @@ void CommandBuffer::ExecuteCommands(vvl::span<const VkCommandBuffer> secondary_c
         // NOTE: The update/population of the image_layout_map is done in CoreChecks, but for other classes derived from
         // ValidationStateTracker these maps will be empty, so leaving the propagation in the the state tracker should be a no-op
         // for those other classes.
+        // The maps are only referenced here and merged when the primary uses the image again or ends, so an image written by
+        // many secondaries is looked up once instead of once per secondary.
         for (const auto &sub_layout_map_entry : sub_cb_state->image_layout_map) {
-            const auto image_state = dev_data.Get<vvl::Image>(sub_layout_map_entry.first);
-            if (!image_state || image_state->Destroyed() || image_state->GetId() != sub_layout_map_entry.second.id) {
-                continue;
-            }
-            auto cb_subres_map = GetImageSubresourceLayoutMap(*image_state);
-            if (cb_subres_map) {
-                cb_subres_map->UpdateFrom(*sub_layout_map_entry.second.map);
-            }
+            pending_secondary_layouts_[sub_layout_map_entry.first].emplace_back(sub_layout_map_entry.second);
         }
 
         sub_cb_state->primaryCommandBuffer = VkHandle();
@@ -1077,15 +1239,34 @@ void CommandBuffer::ExecuteCommands(vvl::span<const VkCommandBuffer> secondary_c
             }
             return skip;
         });
-        for (auto &function : sub_cb_state->eventUpdates) {
-            eventUpdates.push_back(function);
-        }
-        for (auto &event : sub_cb_state->events) {
-            events.push_back(event);
-        }
-        for (auto &function : sub_cb_state->queue_submit_functions) {
-            queue_submit_functions.push_back(function);
-        }
+        // The event updates and queue submit functions of the secondary are run from its own lists the same way, instead of
+        // being copied into the primary for every execution. Event updates index the events of the command buffer they were
+        // recorded in, so they get the secondary.
+        eventUpdates.emplace_back([sub_command_buffer](CommandBuffer &cb_state_arg, bool do_validate,
+                                                       EventToStageMap &local_event_signal_info, VkQueue waiting_queue,
+                                                       const Location &loc) {
+            bool skip = false;
+            auto sub_cb_state_arg = cb_state_arg.dev_data.GetWrite<CommandBuffer>(sub_command_buffer);
+            if (!sub_cb_state_arg) {
+                return skip;
+            }
+            for (auto &function : sub_cb_state_arg->eventUpdates) {
+                skip |= function(*sub_cb_state_arg, do_validate, local_event_signal_info, waiting_queue, loc);
+            }
+            return skip;
+        });
+        queue_submit_functions.emplace_back([sub_command_buffer](const ValidationStateTracker &device_data,
+                                                                 const vvl::Queue &queue_state, const CommandBuffer &cb_state_arg) {
+            bool skip = false;
+            auto sub_cb_state_arg = device_data.GetRead<CommandBuffer>(sub_command_buffer);
+            if (!sub_cb_state_arg) {
+                return skip;
+            }
+            for (auto &function : sub_cb_state_arg->queue_submit_functions) {
+                skip |= function(device_data, queue_state, cb_state_arg);
+            }
+            return skip;
+        });
 
         // State is trashed after executing secondary command buffers.
         // Importantly, this function runs after CoreChecks::PreCallValidateCmdExecuteCommands.
@@ -1109,6 +1290,7 @@ void CommandBuffer::ExecuteCommands(vvl::span<const VkCommandBuffer> secondary_c
             hasRenderPassInstance |= sub_cb_state->hasRenderPassInstance;
         }
 
+        reset_dirty_mask_ |= kResetLabels;
         label_stack_depth_ += sub_cb_state->label_stack_depth_;
         label_commands_.insert(label_commands_.end(), sub_cb_state->label_commands_.begin(), sub_cb_state->label_commands_.end());
     }
@@ -1130,7 +1312,7 @@ void CommandBuffer::PushDescriptorSetState(VkPipelineBindPoint pipelineBindPoint
     auto &push_descriptor_set = last_bound.push_descriptor_set;
     // If we are disturbing the current push_desriptor_set clear it
     if (!push_descriptor_set || !IsBoundSetCompat(set, last_bound, pipeline_layout)) {
-        last_bound.UnbindAndResetPushDescriptorSet(dev_data.CreateDescriptorSet(VK_NULL_HANDLE, nullptr, dsl, 0));
+        last_bound.UnbindAndResetPushDescriptorSet(GetPushDescriptorSet(dsl));
     }
 
     UpdateLastBoundDescriptorSets(pipelineBindPoint, pipeline_layout, set, 1, nullptr, push_descriptor_set, 0, nullptr);
@@ -1140,6 +1322,24 @@ void CommandBuffer::PushDescriptorSetState(VkPipelineBindPoint pipelineBindPoint
     push_descriptor_set->PerformPushDescriptorsUpdate(descriptorWriteCount, pDescriptorWrites);
 }
 
+std::shared_ptr<vvl::DescriptorSet> CommandBuffer::GetPushDescriptorSet(
+    const std::shared_ptr<const vvl::DescriptorSetLayout> &dsl) {
+    auto &pooled = push_descriptor_set_pool_[dsl.get()];
+    if (pooled && pooled.use_count() == 1 && !pooled->Destroyed()) {
+        // Only the bindings written by the previous pushes are created again
+        pooled->ResetPushDescriptors();
+        return pooled;
+    }
+    // Still bound to another bind point, or referenced by state recorded for a command; replace it in the pool
+    pooled = dev_data.CreateDescriptorSet(VK_NULL_HANDLE, nullptr, dsl, 0);
+    return pooled;
+}
+
+bool CommandBuffer::IsPooledPushDescriptorSet(const vvl::DescriptorSet &descriptor_set) const {
+    auto it = push_descriptor_set_pool_.find(descriptor_set.GetLayout().get());
+    return it != push_descriptor_set_pool_.end() && it->second.get() == &descriptor_set;
+}
+
 // Generic function to handle state update for all CmdDraw* type functions
 void CommandBuffer::UpdateDrawCmd(Func command) {
     has_draw_cmd = true;
@@ -1160,7 +1360,8 @@ void CommandBuffer::UpdateTraceRayCmd(Func command) {
 
 // Generic function to handle state update for all Provoking functions calls (draw/dispatch/traceray/etc)
 void CommandBuffer::UpdatePipelineState(Func command, const VkPipelineBindPoint bind_point) {
-    RecordCmd(command);
+    // Not RecordCmd(), action commands keep the validated action state of the command buffer clean
+    command_count++;
 
     const auto lv_bind_point = ConvertToLvlBindPoint(bind_point);
     auto &last_bound = lastBound[lv_bind_point];
@@ -1242,6 +1443,7 @@ void CommandBuffer::UpdateLastBoundDescriptorSets(VkPipelineBindPoint pipeline_b
                                                   std::shared_ptr<vvl::DescriptorSet> &push_descriptor_set,
                                                   uint32_t dynamic_offset_count, const uint32_t *p_dynamic_offsets) {
     assert((pDescriptorSets == nullptr) ^ (push_descriptor_set == nullptr));
+    DirtyActionState(kActionStateDescriptorSets);
 
     uint32_t required_size = first_set + set_count;
     const uint32_t last_binding_index = required_size - 1;
@@ -1324,6 +1526,7 @@ void CommandBuffer::UpdateLastBoundDescriptorBuffers(VkPipelineBindPoint pipelin
                                                      const vvl::PipelineLayout &pipeline_layout, uint32_t first_set,
                                                      uint32_t set_count, const uint32_t *buffer_indicies,
                                                      const VkDeviceSize *buffer_offsets) {
+    DirtyActionState(kActionStateDescriptorSets);
     uint32_t required_size = first_set + set_count;
     const uint32_t last_binding_index = required_size - 1;
     assert(last_binding_index < pipeline_layout.set_compat_ids.size());
@@ -1443,10 +1646,35 @@ void CommandBuffer::SetImageViewLayout(const vvl::ImageView &view_state, VkImage
     }
 }
 
-void CommandBuffer::RecordCmd(Func command) { command_count++; }
+void CommandBuffer::RecordCmd(Func command) {
+    command_count++;
+
+    switch (command) {
+        case Func::vkCmdBindPipeline:
+            DirtyActionState(kActionStatePipeline);
+            break;
+        case Func::vkCmdBindDescriptorSets:
+        case Func::vkCmdBindDescriptorSets2KHR:
+            DirtyActionState(kActionStateDescriptorSets);
+            break;
+        case Func::vkCmdBindVertexBuffers:
+        case Func::vkCmdBindVertexBuffers2:
+        case Func::vkCmdBindVertexBuffers2EXT:
+            DirtyActionState(kActionStateVertexInput);
+            break;
+        case Func::vkCmdPushConstants:
+        case Func::vkCmdPushConstants2KHR:
+            DirtyActionState(kActionStatePushConstants);
+            break;
+        default:
+            DirtyActionState(kActionStateAll);
+            break;
+    }
+}
 
 void CommandBuffer::RecordStateCmd(Func command, CBDynamicState state) {
-    RecordCmd(command);
+    command_count++;
+    DirtyActionState(kActionStateDynamicState);
     RecordDynamicState(state);
 
     vvl::Pipeline *pipeline = GetCurrentPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS);
@@ -1589,11 +1817,15 @@ void CommandBuffer::Submit(VkQueue queue, uint32_t perf_submit_pass, const Locat
         for (auto &function : queryUpdates) {
             function(*this, /*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
         }
-        for (const auto &query_state_pair : local_query_to_state_map) {
-            auto query_pool_state = dev_data.Get<vvl::QueryPool>(query_state_pair.first.pool);
-            if (!query_pool_state) continue;
-            query_pool_state->SetQueryState(query_state_pair.first.slot, query_state_pair.first.perf_pass, query_state_pair.second);
-        }
+        std::shared_ptr<vvl::QueryPool> query_pool_state;
+        local_query_to_state_map.ForEach([&](const QueryObject &query_obj, QueryState state) {
+            if (!query_pool_state || query_pool_state->VkHandle() != query_obj.pool) {
+                query_pool_state = dev_data.Get<vvl::QueryPool>(query_obj.pool);
+            }
+            if (query_pool_state) {
+                query_pool_state->SetQueryState(query_obj.slot, query_obj.perf_pass, state);
+            }
+        });
     }
 
     // Update vvl::Event with src_stage from the last recorded SetEvent.
@@ -1634,13 +1866,18 @@ void CommandBuffer::Retire(uint32_t perf_submit_pass, const std::function<bool(c
         function(*this, /*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
     }
 
-    for (const auto &query_state_pair : local_query_to_state_map) {
-        if (query_state_pair.second == QUERYSTATE_ENDED && !is_query_updated_after(query_state_pair.first)) {
-            auto query_pool_state = dev_data.Get<vvl::QueryPool>(query_state_pair.first.pool);
-            if (!query_pool_state) continue;
-            query_pool_state->SetQueryState(query_state_pair.first.slot, query_state_pair.first.perf_pass, QUERYSTATE_AVAILABLE);
+    std::shared_ptr<vvl::QueryPool> query_pool_state;
+    local_query_to_state_map.ForEach([&](const QueryObject &query_obj, QueryState state) {
+        if (state != QUERYSTATE_ENDED || is_query_updated_after(query_obj)) {
+            return;
         }
-    }
+        if (!query_pool_state || query_pool_state->VkHandle() != query_obj.pool) {
+            query_pool_state = dev_data.Get<vvl::QueryPool>(query_obj.pool);
+        }
+        if (query_pool_state) {
+            query_pool_state->SetQueryState(query_obj.slot, query_obj.perf_pass, QUERYSTATE_AVAILABLE);
+        }
+    });
 }
 
 uint32_t CommandBuffer::GetDynamicColorAttachmentCount() const {
@@ -1707,6 +1944,7 @@ void CommandBuffer::BindShader(VkShaderStageFlagBits shader_stage, vvl::ShaderOb
     const auto stage_index = static_cast<uint32_t>(ConvertToShaderObjectStage(shader_stage));
     lastBoundState.shader_object_bound[stage_index] = true;
     lastBoundState.shader_object_states[stage_index] = shader_object_state;
+    DirtyActionState(kActionStatePipeline);
 }
 
 void CommandBuffer::UnbindResources() {
@@ -1727,6 +1965,7 @@ void CommandBuffer::UnbindResources() {
 
     // Pipeline and descriptor sets
     lastBound[BindPoint_Graphics].Reset();
+    DirtyActionState(kActionStateAll);
 }
 
 LogObjectList CommandBuffer::GetObjectList(VkShaderStageFlagBits stage) const {
@@ -1799,17 +2038,25 @@ void CommandBuffer::GetCurrentPipelineAndDesriptorSets(VkPipelineBindPoint pipel
 }
 
 void CommandBuffer::BeginLabel(const char *label_name) {
+    reset_dirty_mask_ |= kResetLabels;
     ++label_stack_depth_;
-    label_commands_.push_back(LabelCommand{true, label_name});
+    label_commands_.push_back(LabelCommand{true, dev_data.label_names_.Intern(label_name)});
 }
 
 void CommandBuffer::EndLabel() {
+    reset_dirty_mask_ |= kResetLabels;
     --label_stack_depth_;
-    label_commands_.push_back(LabelCommand{false, std::string()});
+    label_commands_.push_back(LabelCommand{false, {}});
+}
+
+void CommandBuffer::InsertLabel(const VkDebugUtilsLabelEXT *label_info) {
+    reset_dirty_mask_ |= kResetLabels;
+    // Squirrel away an easily accessible copy.
+    debug_label = LoggingLabel(label_info);
 }
 
 void CommandBuffer::ReplayLabelCommands(const vvl::span<const LabelCommand> &label_commands,
-                                        std::vector<std::string> &label_stack) {
+                                        std::vector<std::string_view> &label_stack) {
     for (const LabelCommand &command : label_commands) {
         if (command.begin) {
             label_stack.push_back(command.label_name.empty() ? "(empty label)" : command.label_name);
@@ -1824,7 +2071,7 @@ void CommandBuffer::ReplayLabelCommands(const vvl::span<const LabelCommand> &lab
 }
 
 std::string CommandBuffer::GetDebugRegionName(const std::vector<LabelCommand> &label_commands, uint32_t label_command_index,
-                                              const std::vector<std::string> &initial_label_stack) {
+                                              const std::vector<std::string_view> &initial_label_stack) {
     assert(label_command_index < label_commands.size());
 
     auto commands_to_replay = vvl::make_span(label_commands.data(), label_command_index + 1);
@@ -1832,7 +2079,7 @@ std::string CommandBuffer::GetDebugRegionName(const std::vector<LabelCommand> &l
     vvl::CommandBuffer::ReplayLabelCommands(commands_to_replay, label_stack);
 
     std::string debug_region;
-    for (const std::string &label_name : label_stack) {
+    for (const std::string_view label_name : label_stack) {
         if (!debug_region.empty()) {
             debug_region += "::";
         }
@@ -26,6 +26,10 @@
 #include "state_tracker/vertex_index_buffer_state.h"
 #include "containers/qfo_transfer.h"
 #include "containers/custom_containers.h"
+#include "containers/deferred_call_list.h"
+#include "containers/dense_handle_map.h"
+#include "containers/monotonic_arena.h"
+#include "utils/worker_pool.h"
 #include "generated/dynamic_state_helper.h"
 
 class CoreChecks;
@@ -168,7 +172,8 @@ class CommandBuffer : public RefcountedStateObject {
         StateObject::IdType id;
         std::shared_ptr<ImageSubresourceLayoutMap> map;
     };
-    using ImageLayoutMap = vvl::unordered_map<VkImage, LayoutState>;
+    // A command buffer uses a handful of images, stored densely they are walked and cleared without touching a hash table
+    using ImageLayoutMap = vvl::DenseHandleMap<VkImage, LayoutState>;
     using AliasedLayoutMap = vvl::unordered_map<const GlobalImageLayoutRangeMap *, std::shared_ptr<ImageSubresourceLayoutMap>>;
 
     VkCommandBufferAllocateInfo allocate_info;
@@ -194,6 +199,7 @@ class CommandBuffer : public RefcountedStateObject {
     uint64_t submitCount;    // Number of times CB has been submitted
     typedef uint64_t ImageLayoutUpdateCount;
     ImageLayoutUpdateCount image_layout_change_count;  // The sequence number for changes to image layout (for cached validation)
+    uint64_t recording_id;  // Unique for each recording of any command buffer, never 0 (for cached validation)
 
     // Track status of all vkCmdSet* calls, if 1, means it was set
     struct DynamicStateStatus {
@@ -355,6 +361,30 @@ class CommandBuffer : public RefcountedStateObject {
     // Store last bound state for Gfx & Compute pipeline bind points
     std::array<LastBound, BindPoint_Count> lastBound;  // index is LvlBindPoint.
 
+    // Groups of state read by the draw/dispatch/trace rays time validation, marked dirty by the commands changing them
+    enum ActionStateBits : uint32_t {
+        kActionStatePipeline = 1 << 0,        // bound pipeline or shader objects
+        kActionStateDescriptorSets = 1 << 1,  // bound descriptor sets and descriptor buffers
+        kActionStateVertexInput = 1 << 2,     // bound vertex and index buffers
+        kActionStateDynamicState = 1 << 3,    // vkCmdSet* state
+        kActionStatePushConstants = 1 << 4,   // push constant data and ranges
+        kActionStateAll = ~0u,                // any other command, ex. render pass, query or secondary command buffer changes
+    };
+    // Last action command that passed the draw time validation of a bind point, and the state changed by the commands
+    // recorded since. A clean dirty mask for the same command means the checks would pass again, ignoring the contents of
+    // the descriptor sets which have their own cache in LastBound. Written by the (const) validation, which like the
+    // recording requires the command buffer to be externally synchronized.
+    struct ValidatedActionState {
+        Func command = Func::Empty;
+        uint32_t dirty = kActionStateAll;
+    };
+    mutable std::array<ValidatedActionState, BindPoint_Count> validated_action_state;  // index is LvlBindPoint.
+    void DirtyActionState(uint32_t bits) {
+        for (auto &validated : validated_action_state) {
+            validated.dirty |= bits;
+        }
+    }
+
     // Use the casting boilerplate from StateObject to implement the derived shared_from_this
     std::shared_ptr<const CommandBuffer> shared_from_this() const { return SharedFromThisImpl(this); }
     std::shared_ptr<CommandBuffer> shared_from_this() { return SharedFromThisImpl(this); }
@@ -450,30 +480,46 @@ class CommandBuffer : public RefcountedStateObject {
     ImageLayoutMap image_layout_map;
     AliasedLayoutMap aliased_image_layout_map;  // storage for potentially aliased images
 
-    vvl::unordered_map<uint32_t, vvl::VertexBufferBinding> current_vertex_buffer_binding_info;
+    vvl::VertexBufferBindings current_vertex_buffer_binding_info;
     vvl::IndexBufferBinding index_buffer_binding;
 
     VkCommandBuffer primaryCommandBuffer;
     // If primary, the secondary command buffers we will call.
     vvl::unordered_set<CommandBuffer *> linkedCommandBuffers;
+    // Storage of the callables of the deferred call lists below, reused when the command buffer is recorded again.
+    // NOTE: Must be declared before the lists
+    MonotonicArena deferred_call_arena;
     // Validation functions run at primary CB queue submit time
-    using QueueCallback = std::function<bool(const ValidationStateTracker &device_data, const class vvl::Queue &queue_state,
-                                             const CommandBuffer &cb_state)>;
-    std::vector<QueueCallback> queue_submit_functions;
+    using QueueCallbacks = DeferredCallList<bool(const ValidationStateTracker &device_data, const class vvl::Queue &queue_state,
+                                                 const CommandBuffer &cb_state)>;
+    QueueCallbacks queue_submit_functions{&deferred_call_arena};
     // Used by some layers to defer actions until vkCmdEndRenderPass time.
     // Layers using this are responsible for inserting the callbacks into queue_submit_functions.
-    std::vector<QueueCallback> queue_submit_functions_after_render_pass;
+    QueueCallbacks queue_submit_functions_after_render_pass{&deferred_call_arena};
     // Validation functions run when secondary CB is executed in primary
-    std::vector<std::function<bool(const CommandBuffer &secondary, const CommandBuffer *primary, const vvl::Framebuffer *)>>
-        cmd_execute_commands_functions;
-
-    using EventCallback = std::function<bool(CommandBuffer &cb_state, bool do_validate, EventToStageMap &local_event_signal_info,
-                                             VkQueue waiting_queue, const Location &loc)>;
-    std::vector<EventCallback> eventUpdates;
-
-    std::vector<std::function<bool(CommandBuffer &cb_state, bool do_validate, VkQueryPool &firstPerfQueryPool,
-                                   uint32_t perfQueryPass, QueryMap *localQueryToStateMap)>>
-        queryUpdates;
+    DeferredCallList<bool(const CommandBuffer &secondary, const CommandBuffer *primary, const vvl::Framebuffer *)>
+        cmd_execute_commands_functions{&deferred_call_arena};
+
+    using EventCallbacks = DeferredCallList<bool(CommandBuffer &cb_state, bool do_validate,
+                                                 EventToStageMap &local_event_signal_info, VkQueue waiting_queue,
+                                                 const Location &loc)>;
+    EventCallbacks eventUpdates{&deferred_call_arena};
+
+    DeferredCallList<bool(CommandBuffer &cb_state, bool do_validate, VkQueryPool &firstPerfQueryPool, uint32_t perfQueryPass,
+                          QueryMap *localQueryToStateMap)>
+        queryUpdates{&deferred_call_arena};
+    // Checks of the recorded commands that only read the command parameters and immutable object state, run after
+    // vkEndCommandBuffer with the deferred_command_validation setting. They capture what they use.
+    DeferredCallList<bool(const ValidationStateTracker &device_data, const CommandBuffer &cb_state)> deferred_validations{
+        &deferred_call_arena};
+    // Runs deferred_validations on the worker pool, null when they ran on the thread that ended the command buffer
+    std::unique_ptr<vvl::WorkerPool::TaskGroup> deferred_validation_tasks;
+    // Returns once the deferred_validations have run, their messages are then all reported
+    void WaitDeferredValidations() const {
+        if (deferred_validation_tasks) {
+            deferred_validation_tasks->Wait();
+        }
+    }
     bool performance_lock_acquired = false;
     bool performance_lock_released = false;
 
@@ -498,6 +544,53 @@ class CommandBuffer : public RefcountedStateObject {
     bool conditional_rendering_inside_render_pass{false};
     uint32_t conditional_rendering_subpass{0};
     std::vector<VkDescriptorBufferBindingInfoEXT> descriptor_buffer_binding_info;
+    // Set offsets into the bound descriptor buffers that passed the address range checks of vkCmdSetDescriptorBufferOffsetsEXT,
+    // for the buffer device addresses of address_ranges_version. Bindless renderers set the same few offsets for every draw.
+    // Written by the (const) validation like validated_action_state, cleared when descriptor buffers are bound.
+    struct ValidatedDescriptorBufferOffsets {
+        struct Key {
+            VkDeviceAddress address;
+            VkDeviceSize offset;
+            // Keeps the layout alive, so another layout cannot take its address
+            std::shared_ptr<const vvl::DescriptorSetLayout> set_layout;
+
+            bool operator==(const Key &other) const {
+                return address == other.address && offset == other.offset && set_layout == other.set_layout;
+            }
+            struct Hash {
+                size_t operator()(const Key &key) const {
+                    hash_util::HashCombiner hc;
+                    hc << key.address << key.offset << key.set_layout.get();
+                    return hc.Value();
+                }
+            };
+        };
+        vvl::unordered_set<Key, Key::Hash> offsets;
+        uint32_t address_ranges_version = 0;
+    };
+    mutable ValidatedDescriptorBufferOffsets validated_descriptor_buffer_offsets;
+    // Combinations of bound shader objects that passed the shader object checks of the draw time validation. Those only look
+    // at the bound shaders and at the kind of draw, so a dynamic state change between draws does not need to repeat them.
+    // Written by the (const) validation like validated_action_state.
+    struct ValidatedShaderObjects {
+        struct Key {
+            // 0 for the stages no shader was bound to, kNullShader for the stages bound to VK_NULL_HANDLE
+            static constexpr vvl::StateObject::IdType kNullShader = ~vvl::StateObject::IdType(0);
+            std::array<vvl::StateObject::IdType, kShaderObjectStageCount> ids;
+            bool mesh_draw;
+
+            bool operator==(const Key &other) const { return ids == other.ids && mesh_draw == other.mesh_draw; }
+            struct Hash {
+                size_t operator()(const Key &key) const {
+                    hash_util::HashCombiner hc;
+                    hc.Combine(key.ids.cbegin(), key.ids.cend()) << key.mesh_draw;
+                    return hc.Value();
+                }
+            };
+        };
+        vvl::unordered_set<Key, Key::Hash> combinations;
+    };
+    mutable ValidatedShaderObjects validated_shader_objects;
 
     mutable std::shared_mutex lock;
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock); }
@@ -568,6 +661,10 @@ class CommandBuffer : public RefcountedStateObject {
 
     void Begin(const VkCommandBufferBeginInfo *pBeginInfo);
     void End(VkResult result);
+    // Once recorded, a primary command buffer is not notified when its bound objects are destroyed or updated. This looks
+    // for the objects invalidated since the last call and handles them like NotifyInvalidate() would have, it must be
+    // called before a submission of the command buffer is validated or recorded. Does not take the lock if nothing changed.
+    void ApplyDeferredInvalidations();
 
     void BeginQuery(const QueryObject &query_obj);
     void EndQuery(const QueryObject &query_obj);
@@ -602,6 +699,8 @@ class CommandBuffer : public RefcountedStateObject {
 
     void PushDescriptorSetState(VkPipelineBindPoint pipelineBindPoint, const vvl::PipelineLayout &pipeline_layout, uint32_t set,
                                 uint32_t descriptorWriteCount, const VkWriteDescriptorSet *pDescriptorWrites);
+    // Pooled push descriptor sets are kept alive by the command buffer, once unbound they are reset instead of destroyed
+    bool IsPooledPushDescriptorSet(const vvl::DescriptorSet &descriptor_set) const;
 
     void UpdateDrawCmd(Func command);
     void UpdateDispatchCmd(Func command);
@@ -651,6 +750,7 @@ class CommandBuffer : public RefcountedStateObject {
 
     inline void BindPipeline(LvlBindPoint bind_point, vvl::Pipeline *pipe_state) {
         lastBound[bind_point].pipeline_state = pipe_state;
+        DirtyActionState(kActionStatePipeline);
     }
     void BindShader(VkShaderStageFlagBits shader_stage, vvl::ShaderObject *shader_object_state);
 
@@ -658,24 +758,49 @@ class CommandBuffer : public RefcountedStateObject {
     bool IsSeconary() const { return allocate_info.level == VK_COMMAND_BUFFER_LEVEL_SECONDARY; }
     void BeginLabel(const char *label_name);
     void EndLabel();
+    void InsertLabel(const VkDebugUtilsLabelEXT *label_info);
     int LabelStackDepth() const { return label_stack_depth_; }
 
     struct LabelCommand {
-        bool begin = false;      // vkCmdBeginDebugUtilsLabelEXT or vkCmdEndDebugUtilsLabelEXT
-        std::string label_name;  // used when begin == true
+        bool begin = false;           // vkCmdBeginDebugUtilsLabelEXT or vkCmdEndDebugUtilsLabelEXT
+        std::string_view label_name;  // used when begin == true, interned in ValidationStateTracker::label_names_
     };
     const std::vector<LabelCommand> &GetLabelCommands() const { return label_commands_; }
 
     // Applies label commands to the label_stack: for "begin label" command it pushes
     // a label on the stack, and for the "end label" command it removes the top label.
-    static void ReplayLabelCommands(const vvl::span<const LabelCommand> &label_commands, std::vector<std::string> &label_stack);
+    static void ReplayLabelCommands(const vvl::span<const LabelCommand> &label_commands,
+                                    std::vector<std::string_view> &label_stack);
     // Computes debug region by replaying given commands on top initial label stack.
     static std::string GetDebugRegionName(const std::vector<LabelCommand> &label_commands, uint32_t label_command_index,
-                                          const std::vector<std::string> &initial_label_stack = {});
+                                          const std::vector<std::string_view> &initial_label_stack = {});
 
   private:
     void ResetCBState();
 
+    // Groups of state that ResetCBState() only resets when the recording since the previous reset touched them.
+    // Containers filled by the validation objects directly are not tracked here, they are only cleared when not empty.
+    enum ResetBits : uint32_t {
+        kResetRenderPass = 1 << 0,  // render pass begin info and attachments
+        kResetVideo = 1 << 1,       // bound video session and picture resources
+        kResetLabels = 1 << 2,      // debug utils labels, including the ones tracked by DebugReport
+    };
+    // Everything is dirty until the first reset
+    uint32_t reset_dirty_mask_ = ~0u;
+
+    // Layout maps the previous recording used only by itself, cleared and reused for the same image by the next recording
+    ImageLayoutMap layout_map_pool_;
+    // Layout maps of the executed secondaries not merged into image_layout_map yet, in execution order. An image is merged
+    // when this command buffer looks it up again, the remaining ones at vkEndCommandBuffer.
+    vvl::DenseHandleMap<VkImage, small_vector<LayoutState, 1>> pending_secondary_layouts_;
+    void MergeSecondaryLayouts(VkImage image);
+    void MergeAllSecondaryLayouts();
+
+    // One push descriptor set per layout, reset and bound again when only this command buffer holds it, so changing the
+    // push descriptor layout back and forth does not allocate a set each time. Kept from one recording to the next.
+    vvl::unordered_map<const vvl::DescriptorSetLayout *, std::shared_ptr<vvl::DescriptorSet>> push_descriptor_set_pool_;
+    std::shared_ptr<vvl::DescriptorSet> GetPushDescriptorSet(const std::shared_ptr<const vvl::DescriptorSetLayout> &dsl);
+
     // Keep track of how many CmdBeginDebugUtilsLabelEXT calls have been made without a matching CmdEndDebugUtilsLabelEXT.
     // Negative value for a secondary command buffer indicates invalid state.
     // Negative value for a primary command buffer is allowed. Validation is done at submit time accross all command buffers.
@@ -688,8 +813,13 @@ class CommandBuffer : public RefcountedStateObject {
     // or std::nullopt
     std::optional<VkSampleCountFlagBits> active_subpass_sample_count_;
 
+    // Set by End(), the objects invalidated with a later generation are looked for by ApplyDeferredInvalidations()
+    std::atomic<bool> defer_invalidations_{false};
+    std::atomic<uint64_t> checked_invalidate_generation_{0};
+
   protected:
     void NotifyInvalidate(const StateObject::NodeList &invalid_nodes, bool unlink) override;
+    bool DefersInvalidate(const StateObject::NodeList &invalid_nodes) const override;
     void UpdateAttachmentsView(const VkRenderPassBeginInfo *pRenderPassBegin);
     void EnqueueUpdateVideoInlineQueries(const VkVideoInlineQueryInfoKHR &query_info);
     void UnbindResources();
@@ -24,6 +24,9 @@
 #include "state_tracker/sampler_state.h"
 #include "state_tracker/shader_module.h"
 
+#include <algorithm>
+#include <vulkan/utility/vk_struct_helper.hpp>
+
 static vvl::DescriptorPool::TypeCountMap GetMaxTypeCounts(const VkDescriptorPoolCreateInfo *create_info) {
     vvl::DescriptorPool::TypeCountMap counts;
     // Collect maximums per descriptor type.
@@ -123,6 +126,57 @@ void vvl::DescriptorPool::Destroy() {
     StateObject::Destroy();
 }
 
+using UpdateRun = vvl::DescriptorUpdateTemplate::UpdateRun;
+
+static std::vector<UpdateRun> BuildUpdateRuns(const VkDescriptorUpdateTemplateCreateInfo &create_info,
+                                              const vvl::DescriptorSetLayout *layout) {
+    std::vector<UpdateRun> runs;
+    if (!layout || create_info.templateType != VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET) {
+        return runs;
+    }
+    runs.reserve(create_info.descriptorUpdateEntryCount);
+    for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
+        const auto &entry = create_info.pDescriptorUpdateEntries[i];
+        if (entry.descriptorCount == 0) {
+            continue;
+        }
+        if (entry.descriptorType == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK) {
+            // descriptorCount is the size in bytes of a single write
+            runs.emplace_back(UpdateRun{i, entry.dstBinding, entry.dstArrayElement, entry.descriptorCount, entry.offset});
+            continue;
+        }
+        uint32_t binding = entry.dstBinding;
+        uint32_t array_element = entry.dstArrayElement;
+        size_t offset = entry.offset;
+        uint32_t remaining = entry.descriptorCount;
+        while (remaining > 0) {
+            const uint32_t binding_count = layout->GetDescriptorCountFromBinding(binding);
+            if (array_element >= binding_count) {
+                if (binding >= layout->GetMaxBinding()) {
+                    break;
+                }
+                array_element = 0;
+                binding = layout->GetNextValidBinding(binding);
+                continue;
+            }
+            const uint32_t count = std::min(remaining, binding_count - array_element);
+            runs.emplace_back(UpdateRun{i, binding, array_element, count, offset});
+            remaining -= count;
+            array_element += count;
+            offset += count * entry.stride;
+        }
+    }
+    return runs;
+}
+
+vvl::DescriptorUpdateTemplate::DescriptorUpdateTemplate(VkDescriptorUpdateTemplate handle,
+                                                        const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo,
+                                                        const DescriptorSetLayout *layout)
+    : StateObject(handle, kVulkanObjectTypeDescriptorUpdateTemplate),
+      safe_create_info(pCreateInfo),
+      create_info(*safe_create_info.ptr()),
+      update_runs(BuildUpdateRuns(create_info, layout)) {}
+
 // ExtendedBinding collects a VkDescriptorSetLayoutBinding and any extended
 // state that comes from a different array/structure so they can stay together
 // while being sorted by binding number.
@@ -246,23 +300,23 @@ vvl::DescriptorSetLayoutDef::DescriptorSetLayoutDef(const VkDescriptorSetLayoutC
     }
 
     // Store the create info in the sorted order from above
-    uint32_t index = 0;
     binding_count_ = static_cast<uint32_t>(sorted_bindings.size());
     bindings_.reserve(binding_count_);
     binding_flags_.reserve(binding_count_);
-    binding_to_index_map_.reserve(binding_count_);
+    binding_numbers_.reserve(binding_count_);
+    types_.reserve(binding_count_);
+    descriptor_counts_.reserve(binding_count_);
+    stage_flags_.reserve(binding_count_);
     for (const auto &input_binding : sorted_bindings) {
-        // Add to binding and map, s.t. it is robust to invalid duplication of binding_num
-        const auto binding_num = input_binding.layout_binding->binding;
-        binding_to_index_map_[binding_num] = index++;
         bindings_.emplace_back(input_binding.layout_binding);
         auto &binding_info = bindings_.back();
         binding_flags_.emplace_back(input_binding.binding_flags);
+        binding_numbers_.emplace_back(binding_info.binding);
+        types_.emplace_back(binding_info.descriptorType);
+        descriptor_counts_.emplace_back(binding_info.descriptorCount);
+        stage_flags_.emplace_back(binding_info.stageFlags);
 
         descriptor_count_ += binding_info.descriptorCount;
-        if (binding_info.descriptorCount > 0) {
-            non_empty_bindings_.insert(binding_num);
-        }
 
         if (IsDynamicDescriptor(binding_info.descriptorType)) {
             dynamic_descriptor_count_ += binding_info.descriptorCount;
@@ -279,33 +333,47 @@ vvl::DescriptorSetLayoutDef::DescriptorSetLayoutDef(const VkDescriptorSetLayoutC
     }
     assert(bindings_.size() == binding_count_);
     assert(binding_flags_.size() == binding_count_);
+
+    // The set sorted the bindings and removed the duplicated binding numbers, so the indices are in binding number order
+    // Binding numbers are usually dense, a table is not used if more than 3/4 of it would be holes
+    if (binding_count_ > 0 && binding_numbers_.back() < 4 * binding_count_ + 16) {
+        binding_to_index_.resize(binding_numbers_.back() + 1, binding_count_);
+        for (uint32_t i = 0; i < binding_count_; ++i) {
+            binding_to_index_[binding_numbers_[i]] = i;
+        }
+    } else {
+        sparse_binding_to_index_.reserve(binding_count_);
+        for (uint32_t i = 0; i < binding_count_; ++i) {
+            sparse_binding_to_index_[binding_numbers_[i]] = i;
+        }
+    }
+    next_non_empty_index_.resize(binding_count_ + 1, binding_count_);
+    for (uint32_t i = binding_count_; i-- > 0;) {
+        next_non_empty_index_[i] = descriptor_counts_[i] > 0 ? i : next_non_empty_index_[i + 1];
+    }
+
     uint32_t global_index = 0;
     global_index_range_.reserve(binding_count_);
     // Vector order is finalized so build vectors of descriptors and dynamic offsets by binding index
     for (uint32_t i = 0; i < binding_count_; ++i) {
-        auto final_index = global_index + bindings_[i].descriptorCount;
+        auto final_index = global_index + descriptor_counts_[i];
         global_index_range_.emplace_back(global_index, final_index);
         global_index = final_index;
     }
 }
 
 size_t vvl::DescriptorSetLayoutDef::hash() const {
-    hash_util::HashCombiner hc;
-    hc << flags_;
-    hc.Combine(bindings_);
-    hc.Combine(binding_flags_);
-    return hc.Value();
+    hash_util::BulkHasher hasher;
+    hasher << flags_ << bindings_.size();
+    for (const auto &binding : bindings_) {
+        hasher << binding;
+    }
+    hasher.Add(binding_flags_.data(), binding_flags_.size());
+    return hasher.Value();
 }
 //
 
-// Return valid index or "end" i.e. binding_count_;
 // The asserts in "Get" are reduced to the set where no valid answer(like null or 0) could be given
-// Common code for all binding lookups.
-uint32_t vvl::DescriptorSetLayoutDef::GetIndexFromBinding(uint32_t binding) const {
-    const auto &bi_itr = binding_to_index_map_.find(binding);
-    if (bi_itr != binding_to_index_map_.cend()) return bi_itr->second;
-    return GetBindingCount();
-}
 VkDescriptorSetLayoutBinding const *vvl::DescriptorSetLayoutDef::GetDescriptorSetLayoutBindingPtrFromIndex(
     const uint32_t index) const {
     if (index >= bindings_.size()) return nullptr;
@@ -313,13 +381,13 @@ VkDescriptorSetLayoutBinding const *vvl::DescriptorSetLayoutDef::GetDescriptorSe
 }
 // Return descriptorCount for given index, 0 if index is unavailable
 uint32_t vvl::DescriptorSetLayoutDef::GetDescriptorCountFromIndex(const uint32_t index) const {
-    if (index >= bindings_.size()) return 0;
-    return bindings_[index].descriptorCount;
+    if (index >= binding_count_) return 0;
+    return descriptor_counts_[index];
 }
 // For the given index, return descriptorType
 VkDescriptorType vvl::DescriptorSetLayoutDef::GetTypeFromIndex(const uint32_t index) const {
-    assert(index < bindings_.size());
-    if (index < bindings_.size()) return bindings_[index].descriptorType;
+    assert(index < binding_count_);
+    if (index < binding_count_) return types_[index];
     return VK_DESCRIPTOR_TYPE_MAX_ENUM;
 }
 // Return binding flags for given index, 0 if index is unavailable
@@ -344,9 +412,10 @@ const vvl::IndexRange &vvl::DescriptorSetLayoutDef::GetGlobalIndexRangeFromBindi
 
 // Move to next valid binding having a non-zero binding count
 uint32_t vvl::DescriptorSetLayoutDef::GetNextValidBinding(const uint32_t binding) const {
-    auto it = non_empty_bindings_.upper_bound(binding);
-    assert(it != non_empty_bindings_.cend());
-    if (it != non_empty_bindings_.cend()) return *it;
+    const auto next = std::upper_bound(binding_numbers_.begin(), binding_numbers_.end(), binding);
+    const uint32_t index = next_non_empty_index_[static_cast<uint32_t>(next - binding_numbers_.begin())];
+    assert(index < binding_count_);
+    if (index < binding_count_) return binding_numbers_[index];
     return GetMaxBinding() + 1;
 }
 // For given index, return ptr to ImmutableSampler array
@@ -422,86 +491,74 @@ vvl::DescriptorSet::DescriptorSet(const VkDescriptorSet handle, vvl::DescriptorP
     auto binding_count = layout_->GetBindingCount();
     bindings_.reserve(binding_count);
     bindings_store_.resize(binding_count);
-    auto free_binding = bindings_store_.data();
     for (uint32_t i = 0; i < binding_count; ++i) {
-        auto create_info = layout_->GetDescriptorSetLayoutBindingPtrFromIndex(i);
-        assert(create_info);
-        uint32_t descriptor_count = create_info->descriptorCount;
-        auto flags = layout_->GetDescriptorBindingFlagsFromIndex(i);
-        if (flags & VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT) {
-            descriptor_count = variable_count;
-        }
-        auto type = layout_->GetTypeFromIndex(i);
-        auto descriptor_class = DescriptorTypeToClass(type);
-        switch (descriptor_class) {
-            case DescriptorClass::PlainSampler: {
-                auto binding = MakeBinding<SamplerBinding>(free_binding++, *create_info, descriptor_count, flags);
-                auto immut = layout_->GetImmutableSamplerPtrFromIndex(i);
-                if (immut) {
-                    for (uint32_t di = 0; di < descriptor_count; ++di) {
-                        auto sampler = state_data->GetConstCastShared<vvl::Sampler>(immut[di]);
-                        if (sampler) {
-                            some_update_ = true;  // Immutable samplers are updated at creation
-                            binding->updated[di] = true;
-                            binding->descriptors[di].SetSamplerState(std::move(sampler));
-                        }
-                    }
-                }
-                bindings_.push_back(std::move(binding));
-                break;
+        bindings_.push_back(CreateBinding(i));
+        if (IsDynamicDescriptor(bindings_.back()->type)) {
+            for (uint32_t di = 0; di < bindings_.back()->count; ++di) {
+                dynamic_offset_idx_to_descriptor_list_.push_back({i, di});
             }
-            case DescriptorClass::ImageSampler: {
-                auto binding = MakeBinding<ImageSamplerBinding>(free_binding++, *create_info, descriptor_count, flags);
-                auto immut = layout_->GetImmutableSamplerPtrFromIndex(i);
-                if (immut) {
-                    for (uint32_t di = 0; di < descriptor_count; ++di) {
-                        auto sampler = state_data->GetConstCastShared<vvl::Sampler>(immut[di]);
-                        if (sampler) {
-                            some_update_ = true;  // Immutable samplers are updated at creation
-                            binding->updated[di] = true;
-                            binding->descriptors[di].SetSamplerState(std::move(sampler));
-                        }
+        }
+    }
+}
+
+vvl::DescriptorSet::BindingPtr vvl::DescriptorSet::CreateBinding(uint32_t index) {
+    auto *location = &bindings_store_[index];
+    auto create_info = layout_->GetDescriptorSetLayoutBindingPtrFromIndex(index);
+    assert(create_info);
+    uint32_t descriptor_count = create_info->descriptorCount;
+    auto flags = layout_->GetDescriptorBindingFlagsFromIndex(index);
+    if (flags & VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT) {
+        descriptor_count = variable_count_;
+    }
+    auto type = layout_->GetTypeFromIndex(index);
+    auto descriptor_class = DescriptorTypeToClass(type);
+    switch (descriptor_class) {
+        case DescriptorClass::PlainSampler: {
+            auto binding = MakeBinding<SamplerBinding>(location, *create_info, descriptor_count, flags);
+            auto immut = layout_->GetImmutableSamplerPtrFromIndex(index);
+            if (immut) {
+                for (uint32_t di = 0; di < descriptor_count; ++di) {
+                    auto sampler = state_data_->GetConstCastShared<vvl::Sampler>(immut[di]);
+                    if (sampler) {
+                        some_update_ = true;  // Immutable samplers are updated at creation
+                        binding->updated[di] = true;
+                        binding->descriptors[di].SetSamplerState(std::move(sampler));
                     }
                 }
-                bindings_.push_back(std::move(binding));
-                break;
             }
-            // ImageDescriptors
-            case DescriptorClass::Image: {
-                bindings_.push_back(MakeBinding<ImageBinding>(free_binding++, *create_info, descriptor_count, flags));
-                break;
-            }
-            case DescriptorClass::TexelBuffer: {
-                bindings_.push_back(MakeBinding<TexelBinding>(free_binding++, *create_info, descriptor_count, flags));
-                break;
-            }
-            case DescriptorClass::GeneralBuffer: {
-                auto binding = MakeBinding<BufferBinding>(free_binding++, *create_info, descriptor_count, flags);
-                if (IsDynamicDescriptor(type)) {
-                    for (uint32_t di = 0; di < descriptor_count; ++di) {
-                        dynamic_offset_idx_to_descriptor_list_.push_back({i, di});
+            return binding;
+        }
+        case DescriptorClass::ImageSampler: {
+            auto binding = MakeBinding<ImageSamplerBinding>(location, *create_info, descriptor_count, flags);
+            auto immut = layout_->GetImmutableSamplerPtrFromIndex(index);
+            if (immut) {
+                for (uint32_t di = 0; di < descriptor_count; ++di) {
+                    auto sampler = state_data_->GetConstCastShared<vvl::Sampler>(immut[di]);
+                    if (sampler) {
+                        some_update_ = true;  // Immutable samplers are updated at creation
+                        binding->updated[di] = true;
+                        binding->descriptors[di].SetSamplerState(std::move(sampler));
                     }
                 }
-                bindings_.push_back(std::move(binding));
-                break;
             }
-            case DescriptorClass::InlineUniform: {
-                bindings_.push_back(MakeBinding<InlineUniformBinding>(free_binding++, *create_info, descriptor_count, flags));
-                break;
-            }
-            case DescriptorClass::AccelerationStructure: {
-                bindings_.push_back(
-                    MakeBinding<AccelerationStructureBinding>(free_binding++, *create_info, descriptor_count, flags));
-                break;
-            }
-            case DescriptorClass::Mutable: {
-                bindings_.push_back(MakeBinding<MutableBinding>(free_binding++, *create_info, descriptor_count, flags));
-                break;
-            }
-            default:
-                assert(0);  // Bad descriptor type specified
-                break;
+            return binding;
         }
+        // ImageDescriptors
+        case DescriptorClass::Image:
+            return MakeBinding<ImageBinding>(location, *create_info, descriptor_count, flags);
+        case DescriptorClass::TexelBuffer:
+            return MakeBinding<TexelBinding>(location, *create_info, descriptor_count, flags);
+        case DescriptorClass::GeneralBuffer:
+            return MakeBinding<BufferBinding>(location, *create_info, descriptor_count, flags);
+        case DescriptorClass::InlineUniform:
+            return MakeBinding<InlineUniformBinding>(location, *create_info, descriptor_count, flags);
+        case DescriptorClass::AccelerationStructure:
+            return MakeBinding<AccelerationStructureBinding>(location, *create_info, descriptor_count, flags);
+        case DescriptorClass::Mutable:
+            return MakeBinding<MutableBinding>(location, *create_info, descriptor_count, flags);
+        default:
+            assert(0);  // Bad descriptor type specified
+            return nullptr;
     }
 }
 
@@ -517,6 +574,47 @@ void vvl::DescriptorSet::NotifyInvalidate(const NodeList &invalid_nodes, bool un
     for (auto &binding : bindings_) {
         binding->NotifyInvalidate(invalid_nodes, unlink);
     }
+    // A resource used by the descriptors went away without an update of the set
+    std::lock_guard<std::mutex> guard(validated_draw_state_lock_);
+    validated_draw_state_count_ = 0;
+}
+
+static bool SameValidatedSetState(const vvl::DescriptorSet::ValidatedDrawState &a,
+                                  const vvl::DescriptorSet::ValidatedDrawState &b) {
+    return a.change_count == b.change_count && a.requirements_id == b.requirements_id && a.set_index == b.set_index &&
+           a.dynamic_offsets_hash == b.dynamic_offsets_hash && a.unprotected == b.unprotected;
+}
+
+bool vvl::DescriptorSet::IsDrawStateValidated(const ValidatedDrawState &state) const {
+    std::lock_guard<std::mutex> guard(validated_draw_state_lock_);
+    for (uint32_t i = 0; i < validated_draw_state_count_; ++i) {
+        const ValidatedDrawState &validated = validated_draw_states_[i];
+        if (SameValidatedSetState(validated, state) &&
+            (validated.recording_id == 0 || (validated.recording_id == state.recording_id &&
+                                             validated.image_layout_change_count == state.image_layout_change_count))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void vvl::DescriptorSet::SetDrawStateValidated(const ValidatedDrawState &state) const {
+    std::lock_guard<std::mutex> guard(validated_draw_state_lock_);
+    for (uint32_t i = 0; i < validated_draw_state_count_; ++i) {
+        ValidatedDrawState &validated = validated_draw_states_[i];
+        if (SameValidatedSetState(validated, state) &&
+            (validated.recording_id == 0 || validated.recording_id == state.recording_id)) {
+            // Same recording with newer image layouts, or the result does not depend on the command buffer anymore
+            validated = state;
+            return;
+        }
+    }
+    if (validated_draw_state_count_ < kValidatedDrawStateCount) {
+        validated_draw_states_[validated_draw_state_count_++] = state;
+    } else {
+        validated_draw_states_[validated_draw_state_next_] = state;
+        validated_draw_state_next_ = (validated_draw_state_next_ + 1) % kValidatedDrawStateCount;
+    }
 }
 
 void vvl::DescriptorSet::Destroy() {
@@ -525,6 +623,36 @@ void vvl::DescriptorSet::Destroy() {
     }
     StateObject::Destroy();
 }
+
+void vvl::DescriptorSet::ResetPushDescriptors() {
+    assert(IsPushDescriptor());
+    bool updated = false;
+    for (uint32_t i = 0; i < bindings_.size(); ++i) {
+        auto &binding = bindings_[i];
+        bool written = false;
+        for (uint32_t di = 0; di < binding->count && !written; ++di) {
+            written = binding->updated[di];
+        }
+        // Plain immutable samplers cannot be written, their binding is as created
+        if (!written || (binding->descriptor_class == DescriptorClass::PlainSampler && binding->has_immutable_samplers)) {
+            updated |= written;
+            continue;
+        }
+        binding->RemoveParent(this);
+        binding.reset();
+        binding = CreateBinding(i);
+        binding->AddParent(this);
+        for (uint32_t di = 0; di < binding->count && !updated; ++di) {
+            updated = binding->updated[di];
+        }
+    }
+    some_update_ = updated;
+    ++change_count_;
+    push_descriptor_set_writes.clear();
+    std::lock_guard<std::mutex> guard(validated_draw_state_lock_);
+    validated_draw_state_count_ = 0;
+}
+
 // Loop through the write updates to do for a push descriptor set, ignoring dstSet
 void vvl::DescriptorSet::PerformPushDescriptorsUpdate(uint32_t write_count, const VkWriteDescriptorSet *write_descs) {
     assert(IsPushDescriptor());
@@ -565,6 +693,72 @@ void vvl::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorSet &update)
         Invalidate(false);
     }
 }
+void vvl::DescriptorSet::PerformTemplateUpdate(const DescriptorUpdateTemplate &template_state, const void *p_data) {
+    bool invalidate = false;
+    for (const auto &run : template_state.update_runs) {
+        const auto &entry = template_state.create_info.pDescriptorUpdateEntries[run.entry_index];
+        const uint8_t *data = static_cast<const uint8_t *>(p_data) + run.offset;
+
+        // A single descriptor write pointing in pData, like the ones of DecodedTemplateUpdate
+        VkWriteDescriptorSet write = vku::InitStructHelper();
+        write.dstSet = VkHandle();
+        write.dstBinding = run.binding;
+        write.dstArrayElement = run.array_element;
+        write.descriptorCount = 1;
+        write.descriptorType = entry.descriptorType;
+        VkWriteDescriptorSetAccelerationStructureKHR acc_info_khr = vku::InitStructHelper();
+        VkWriteDescriptorSetAccelerationStructureNV acc_info_nv = vku::InitStructHelper();
+        acc_info_khr.accelerationStructureCount = 1;
+        acc_info_nv.accelerationStructureCount = 1;
+        if (entry.descriptorType == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK) {
+            VkWriteDescriptorSetInlineUniformBlock inline_info = vku::InitStructHelper();
+            inline_info.dataSize = run.descriptor_count;
+            inline_info.pData = data;
+            write.pNext = &inline_info;
+            write.descriptorCount = run.descriptor_count;
+            PerformWriteUpdate(write);
+            continue;
+        } else if (entry.descriptorType == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR) {
+            write.pNext = &acc_info_khr;
+        } else if (entry.descriptorType == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV) {
+            write.pNext = &acc_info_nv;
+        }
+
+        auto iter = FindDescriptor(run.binding, run.array_element);
+        assert(!iter.AtEnd());
+        const bool is_bindless = iter.CurrentBinding().IsBindless();
+        if (!(iter.CurrentBinding().binding_flags &
+              (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT))) {
+            invalidate = true;
+        }
+        // The run does not leave the binding, no need to check the consistency of the next ones
+        for (uint32_t i = 0; i < run.descriptor_count && !iter.AtEnd(); ++i, ++iter, data += entry.stride) {
+            switch (DescriptorTypeToClass(entry.descriptorType)) {
+                case DescriptorClass::GeneralBuffer:
+                    write.pBufferInfo = reinterpret_cast<const VkDescriptorBufferInfo *>(data);
+                    break;
+                case DescriptorClass::TexelBuffer:
+                    write.pTexelBufferView = reinterpret_cast<const VkBufferView *>(data);
+                    break;
+                case DescriptorClass::AccelerationStructure:
+                    acc_info_khr.pAccelerationStructures = reinterpret_cast<const VkAccelerationStructureKHR *>(data);
+                    acc_info_nv.pAccelerationStructures = reinterpret_cast<const VkAccelerationStructureNV *>(data);
+                    break;
+                default:
+                    write.pImageInfo = reinterpret_cast<const VkDescriptorImageInfo *>(data);
+                    break;
+            }
+            iter->WriteUpdate(*this, *state_data_, write, 0, is_bindless);
+            iter.updated(true);
+        }
+        some_update_ = true;
+        change_count_ += run.descriptor_count;
+    }
+    if (invalidate && !IsPushDescriptor()) {
+        Invalidate(false);
+    }
+}
+
 // Perform Copy update
 void vvl::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet &update, const DescriptorSet &src_set) {
     auto src_iter = src_set.FindDescriptor(update.srcBinding, update.srcArrayElement);
@@ -619,21 +813,21 @@ void vvl::DescriptorSet::UpdateDrawState(ValidationStateTracker *device_data, vv
         }
         switch (binding->descriptor_class) {
             case DescriptorClass::Image: {
-                auto *image_binding = static_cast<ImageBinding *>(binding);
+                const auto *image_binding = static_cast<const ImageBinding *>(binding);
                 for (uint32_t i = 0; i < image_binding->count; ++i) {
                     image_binding->descriptors[i].UpdateDrawState(device_data, cb_state);
                 }
                 break;
             }
             case DescriptorClass::ImageSampler: {
-                auto *image_binding = static_cast<ImageSamplerBinding *>(binding);
+                const auto *image_binding = static_cast<const ImageSamplerBinding *>(binding);
                 for (uint32_t i = 0; i < image_binding->count; ++i) {
                     image_binding->descriptors[i].UpdateDrawState(device_data, cb_state);
                 }
                 break;
             }
             case DescriptorClass::Mutable: {
-                auto *mutable_binding = static_cast<MutableBinding *>(binding);
+                const auto *mutable_binding = static_cast<const MutableBinding *>(binding);
                 for (uint32_t i = 0; i < mutable_binding->count; ++i) {
                     mutable_binding->descriptors[i].UpdateDrawState(device_data, cb_state);
                 }
@@ -786,7 +980,7 @@ void vvl::ImageDescriptor::CopyUpdate(DescriptorSet &set_state, const Validation
     UpdateKnownValidView(is_bindless);
 }
 
-void vvl::ImageDescriptor::UpdateDrawState(ValidationStateTracker *dev_data, vvl::CommandBuffer *cb_state) {
+void vvl::ImageDescriptor::UpdateDrawState(ValidationStateTracker *dev_data, vvl::CommandBuffer *cb_state) const {
     // Add binding for image
     auto iv_state = GetImageViewState();
     if (iv_state) {
@@ -1167,7 +1361,7 @@ void vvl::MutableDescriptor::SetDescriptorType(VkDescriptorType src_type, const
     }
 }
 
-void vvl::MutableDescriptor::UpdateDrawState(ValidationStateTracker *dev_data, vvl::CommandBuffer *cb_state) {
+void vvl::MutableDescriptor::UpdateDrawState(ValidationStateTracker *dev_data, vvl::CommandBuffer *cb_state) const {
     auto active_class = DescriptorTypeToClass(active_descriptor_type_);
     if (active_class == DescriptorClass::Image || active_class == DescriptorClass::ImageSampler) {
         if (image_view_state_) {
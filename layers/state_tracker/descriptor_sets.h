@@ -18,13 +18,16 @@
 
 #pragma once
 
+#include "containers/cow_chunked_array.h"
 #include "state_tracker/state_object.h"
 #include "utils/hash_vk_types.h"
 #include "utils/vk_layer_utils.h"
 #include "utils/shader_utils.h"
 #include "generated/vk_object_types.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
+#include <array>
 #include <map>
+#include <mutex>
 #include <set>
 #include <vector>
 
@@ -36,6 +39,7 @@ struct DeviceExtensions;
 namespace vvl {
 class Sampler;
 class DescriptorSet;
+class DescriptorSetLayout;
 class CommandBuffer;
 class ImageView;
 class Buffer;
@@ -96,13 +100,26 @@ class DescriptorPool : public StateObject {
 
 class DescriptorUpdateTemplate : public StateObject {
   public:
+    // Descriptors of one update entry that are in the same binding, the array elements of an entry can roll over to the
+    // next bindings
+    struct UpdateRun {
+        uint32_t entry_index;
+        uint32_t binding;
+        uint32_t array_element;
+        uint32_t descriptor_count;
+        // Of the first descriptor in pData, the next ones are stride bytes apart
+        size_t offset;
+    };
+
     const vku::safe_VkDescriptorUpdateTemplateCreateInfo safe_create_info;
     const VkDescriptorUpdateTemplateCreateInfo &create_info;
+    // Resolved at creation from the descriptorSetLayout, so an update writes the descriptors directly instead of going
+    // through a DecodedTemplateUpdate. Empty for push descriptor templates, their layout is only known at update time.
+    const std::vector<UpdateRun> update_runs;
 
-    DescriptorUpdateTemplate(VkDescriptorUpdateTemplate handle, const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo)
-        : StateObject(handle, kVulkanObjectTypeDescriptorUpdateTemplate),
-          safe_create_info(pCreateInfo),
-          create_info(*safe_create_info.ptr()) {}
+    // layout is null for push descriptor templates
+    DescriptorUpdateTemplate(VkDescriptorUpdateTemplate handle, const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo,
+                             const DescriptorSetLayout *layout);
 
     VkDescriptorUpdateTemplate VkHandle() const { return handle_.Cast<VkDescriptorUpdateTemplate>(); };
 };
@@ -164,12 +181,19 @@ class DescriptorSetLayoutDef {
     // For a given binding, return the number of descriptors in that binding and all successive bindings
     uint32_t GetBindingCount() const { return binding_count_; };
     // Return true if given binding is present in this layout
-    bool HasBinding(const uint32_t binding) const { return binding_to_index_map_.count(binding) > 0; };
-    // Return true if binding 1 beyond given exists and has same type, stageFlags & immutable sampler use
-    uint32_t GetIndexFromBinding(uint32_t binding) const;
+    bool HasBinding(const uint32_t binding) const { return GetIndexFromBinding(binding) < binding_count_; };
+    // Return valid index or "end" i.e. binding_count_
+    uint32_t GetIndexFromBinding(uint32_t binding) const {
+        if (!binding_to_index_.empty()) {
+            return binding < binding_to_index_.size() ? binding_to_index_[binding] : binding_count_;
+        }
+        const auto it = sparse_binding_to_index_.find(binding);
+        return it != sparse_binding_to_index_.end() ? it->second : binding_count_;
+    }
     // Various Get functions that can either be passed a binding#, which will
     //  be automatically translated into the appropriate index, or the index# can be passed in directly
-    uint32_t GetMaxBinding() const { return bindings_[bindings_.size() - 1].binding; }
+    uint32_t GetMaxBinding() const { return binding_numbers_.back(); }
+    uint32_t GetBindingFromIndex(const uint32_t index) const { return binding_numbers_[index]; }
     VkDescriptorSetLayoutBinding const *GetDescriptorSetLayoutBindingPtrFromIndex(const uint32_t) const;
     VkDescriptorSetLayoutBinding const *GetDescriptorSetLayoutBindingPtrFromBinding(uint32_t binding) const {
         return GetDescriptorSetLayoutBindingPtrFromIndex(GetIndexFromBinding(binding));
@@ -186,6 +210,13 @@ class DescriptorSetLayoutDef {
     }
     VkDescriptorType GetTypeFromIndex(const uint32_t) const;
     VkDescriptorType GetTypeFromBinding(const uint32_t binding) const { return GetTypeFromIndex(GetIndexFromBinding(binding)); }
+    // Return stageFlags for given index, 0 if index is unavailable
+    VkShaderStageFlags GetStageFlagsFromIndex(const uint32_t index) const {
+        return index < binding_count_ ? stage_flags_[index] : 0;
+    }
+    VkShaderStageFlags GetStageFlagsFromBinding(const uint32_t binding) const {
+        return GetStageFlagsFromIndex(GetIndexFromBinding(binding));
+    }
 
     VkDescriptorBindingFlags GetDescriptorBindingFlagsFromIndex(const uint32_t) const;
     VkDescriptorBindingFlags GetDescriptorBindingFlagsFromBinding(const uint32_t binding) const {
@@ -219,9 +250,19 @@ class DescriptorSetLayoutDef {
     // List of mutable types for each binding: [binding][mutable type]
     std::vector<std::vector<VkDescriptorType>> mutable_types_;
 
-    // Convenience data structures for rapid lookup of various descriptor set layout properties
-    std::set<uint32_t> non_empty_bindings_;  // Containing non-emtpy bindings in numerical order
-    vvl::unordered_map<uint32_t, uint32_t> binding_to_index_map_;
+    // Convenience data structures for rapid lookup of various descriptor set layout properties. The fields of bindings_
+    // that are read at draw time are also kept in one array each, indexed like bindings_.
+    std::vector<uint32_t> binding_numbers_;  // In numerical order
+    std::vector<VkDescriptorType> types_;
+    std::vector<uint32_t> descriptor_counts_;
+    std::vector<VkShaderStageFlags> stage_flags_;
+    // For each index, the first index at or after it with a non-zero descriptor count, binding_count_ if there is none.
+    // Has an extra entry for binding_count_.
+    std::vector<uint32_t> next_non_empty_index_;
+    // Binding number to index, the entries of the numbers between bindings are binding_count_. When the binding numbers
+    // are too sparse for a table, it is empty and sparse_binding_to_index_ is used instead.
+    std::vector<uint32_t> binding_to_index_;
+    vvl::unordered_map<uint32_t, uint32_t> sparse_binding_to_index_;
     // The following map allows an non-iterative lookup of a binding from a global index...
     std::vector<IndexRange> global_index_range_;  // range is exclusive of .end
 
@@ -438,7 +479,7 @@ class ImageDescriptor : public Descriptor {
                      bool is_bindless) override;
     void CopyUpdate(DescriptorSet &set_state, const ValidationStateTracker &dev_data, const Descriptor &, bool is_bindless,
                     VkDescriptorType type) override;
-    void UpdateDrawState(ValidationStateTracker *, vvl::CommandBuffer *cb_state);
+    void UpdateDrawState(ValidationStateTracker *, vvl::CommandBuffer *cb_state) const;
     VkImageView GetImageView() const;
     const vvl::ImageView *GetImageViewState() const { return image_view_state_.get(); }
     vvl::ImageView *GetImageViewState() { return image_view_state_.get(); }
@@ -601,7 +642,7 @@ class MutableDescriptor : public Descriptor {
         return acc_khr != VK_NULL_HANDLE;
     }
 
-    void UpdateDrawState(ValidationStateTracker *, vvl::CommandBuffer *cb_state);
+    void UpdateDrawState(ValidationStateTracker *, vvl::CommandBuffer *cb_state) const;
 
     bool AddParent(StateObject *state_object) override;
     void RemoveParent(StateObject *state_object) override;
@@ -702,6 +743,7 @@ class DescriptorBindingImpl : public DescriptorBinding {
 
     const Descriptor *GetDescriptor(const uint32_t index) const override { return index < count ? &descriptors[index] : nullptr; }
 
+    // NOTE: Allocates the chunk of the descriptor, use the const version to only read it
     Descriptor *GetDescriptor(const uint32_t index) override { return index < count ? &descriptors[index] : nullptr; }
 
     template <typename Fn>
@@ -735,7 +777,8 @@ class DescriptorBindingImpl : public DescriptorBinding {
         }
     }
 
-    small_vector<T, 1, uint32_t> descriptors;
+    // Chunks of descriptors that were never written are not allocated, see CowChunkedArray
+    CowChunkedArray<T> descriptors;
 };
 
 using SamplerBinding = DescriptorBindingImpl<SamplerDescriptor>;
@@ -813,6 +856,8 @@ class DescriptorSet : public StateObject {
     virtual void PerformWriteUpdate(const VkWriteDescriptorSet &);
     // Perform a CopyUpdate whose contents were just validated using ValidateCopyUpdate
     virtual void PerformCopyUpdate(const VkCopyDescriptorSet &, const DescriptorSet &src_set);
+    // Perform the update_runs of a template, same result as the writes of a DecodedTemplateUpdate
+    virtual void PerformTemplateUpdate(const DescriptorUpdateTemplate &template_state, const void *p_data);
 
     const std::shared_ptr<DescriptorSetLayout const> &GetLayout() const { return layout_; };
     VkDescriptorSetLayout GetDescriptorSetLayout() const { return layout_->VkHandle(); }
@@ -880,7 +925,26 @@ class DescriptorSet : public StateObject {
     }
     uint64_t GetChangeCount() const { return change_count_; }
 
+    // What a draw time validation of this set that found no error depended on, see CoreChecks::ValidateActionState.
+    // The results are kept on the set so all the command buffers binding it share them.
+    struct ValidatedDrawState {
+        uint64_t change_count;
+        StateObject::IdType requirements_id;  // pipeline or shader object the binding requirements are from
+        uint32_t set_index;
+        uint64_t dynamic_offsets_hash;
+        bool unprotected;
+        // Command buffer recording and image layout version for bindings whose validation looks at the command buffer
+        // (image layouts, attachments), both 0 when the result only depends on the set
+        uint64_t recording_id;
+        uint64_t image_layout_change_count;
+    };
+    bool IsDrawStateValidated(const ValidatedDrawState &state) const;
+    void SetDrawStateValidated(const ValidatedDrawState &state) const;
+
     const std::vector<vku::safe_VkWriteDescriptorSet> &GetWrites() const { return push_descriptor_set_writes; }
+    // Puts a push descriptor set back in the state of a new one, so it can be reused for another push with the same layout.
+    // Only the bindings that were written are created again.
+    virtual void ResetPushDescriptors();
 
     void Destroy() override;
 
@@ -990,6 +1054,9 @@ class DescriptorSet : public StateObject {
         uint8_t data[sizeof(AnyBinding)];
     };
 
+    // Default descriptors of the binding at index, in its backing store
+    BindingPtr CreateBinding(uint32_t index);
+
     template <typename T>
     std::unique_ptr<T, BindingDeleter> MakeBinding(BindingBackingStore *location, const VkDescriptorSetLayoutBinding &create_info,
                                                    uint32_t descriptor_count, VkDescriptorBindingFlags flags) {
@@ -1013,6 +1080,14 @@ class DescriptorSet : public StateObject {
     // If this descriptor set is a push descriptor set, the descriptor
     // set writes that were last pushed.
     std::vector<vku::safe_VkWriteDescriptorSet> push_descriptor_set_writes;
+
+  private:
+    // Replaced round robin, a few entries cover the pipelines drawing with the set in a frame
+    static constexpr uint32_t kValidatedDrawStateCount = 8;
+    mutable std::mutex validated_draw_state_lock_;
+    mutable std::array<ValidatedDrawState, kValidatedDrawStateCount> validated_draw_states_;
+    mutable uint32_t validated_draw_state_count_ = 0;
+    mutable uint32_t validated_draw_state_next_ = 0;
 };
 
 }  // namespace vvl
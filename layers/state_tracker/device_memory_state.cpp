@@ -19,9 +19,13 @@
 #include "state_tracker/device_memory_state.h"
 #include "state_tracker/image_state.h"
 
+#include <algorithm>
+#include <numeric>
+
 using MemoryRange = vvl::BindableMemoryTracker::MemoryRange;
 using BoundMemoryRange = vvl::BindableMemoryTracker::BoundMemoryRange;
 using DeviceMemoryState = vvl::BindableMemoryTracker::DeviceMemoryState;
+using MemoryBinds = vvl::BindableMemoryTracker::MemoryBinds;
 
 // It is allowed to export memory into the handles of different types,
 // that's why we use set of flags (VkExternalMemoryHandleTypeFlags)
@@ -104,14 +108,61 @@ DeviceMemory::DeviceMemory(VkDeviceMemory handle, const VkMemoryAllocateInfo *pA
       p_driver_data(nullptr),
       fake_base_address(fake_address) {
 }
+
+// The ranges already in the map are split at the bounds of the new one and get the resource appended, gaps get a new entry
+struct BoundResourceInfillUpdateOps {
+    using Map = DeviceMemory::BoundResourceMap;
+    using Iterator = typename Map::iterator;
+    using Value = typename Map::value_type;
+    using Mapped = typename Map::mapped_type;
+    using Range = typename Map::key_type;
+    void infill(Map &map, const Iterator &pos, const Range &infill_range) const { map.insert(pos, Value(infill_range, {bound})); }
+    void update(const Iterator &pos) const { pos->second.emplace_back(bound); }
+    const DeviceMemory::BoundResource &bound;
+};
+
+void DeviceMemory::AddBoundResource(StateObject *resource, const sparse_container::range<VkDeviceSize> &range) {
+    if (range.empty()) return;
+
+    auto guard = WriteLockGuard{bound_resources_lock_};
+    BoundResourceInfillUpdateOps ops{{resource, range}};
+    sparse_container::infill_update_range(bound_resources_, range, ops);
+}
+
+void DeviceMemory::RemoveBoundResource(StateObject *resource, const sparse_container::range<VkDeviceSize> &range) {
+    if (range.empty()) return;
+
+    auto guard = WriteLockGuard{bound_resources_lock_};
+    bound_resources_.erase_range_or_touch(range, [resource](auto &resources) {
+        auto found_it = std::find_if(resources.begin(), resources.end(),
+                                     [resource](const BoundResource &bound) { return bound.resource == resource; });
+        assert(found_it != resources.end());
+        if (found_it == resources.end()) return false;
+        // Remove the entry when this was the last resource in it, else remove the resource from the list
+        if (resources.size() == 1) return true;
+        std::swap(*found_it, resources.back());
+        resources.resize(resources.size() - 1);
+        return false;
+    });
+}
 }  // namespace vvl
 
 void vvl::BindableLinearMemoryTracker::BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &mem_state,
                                              VkDeviceSize memory_offset, VkDeviceSize resource_offset, VkDeviceSize size) {
     if (!mem_state) return;
 
+    // Only one bind is valid, but the stale index entry of an invalid rebind must not outlive the resource
+    RemoveBoundResources(parent);
     mem_state->AddParent(parent);
     binding_ = {mem_state, memory_offset, 0u};
+    size_ = size;
+    mem_state->AddBoundResource(parent, {memory_offset, memory_offset + size});
+}
+
+void vvl::BindableLinearMemoryTracker::RemoveBoundResources(StateObject *parent) {
+    if (binding_.memory_state) {
+        binding_.memory_state->RemoveBoundResource(parent, {binding_.memory_offset, binding_.memory_offset + size_});
+    }
 }
 
 DeviceMemoryState vvl::BindableLinearMemoryTracker::GetBoundMemoryStates() const {
@@ -172,6 +223,65 @@ void vvl::BindableSparseMemoryTracker::BindMemory(StateObject *parent, std::shar
     }
 }
 
+// A sparse resource is usually bound page by page, so a single vkQueueBindSparse can hold thousands of binds that only describe
+// a few contiguous ranges. When none of the binds overlap, the order they are applied in does not matter and they are sorted by
+// resource offset. Neighbouring binds that map contiguous pages of the same memory are then merged into a single range.
+static void CoalesceMemoryBinds(MemoryBinds &binds) {
+    if (binds.size() < 2) return;
+
+    auto by_resource_offset = [&binds](size_t a, size_t b) { return binds[a].resource_offset < binds[b].resource_offset; };
+    std::vector<size_t> order(binds.size());
+    std::iota(order.begin(), order.end(), 0);
+    if (!std::is_sorted(order.begin(), order.end(), by_resource_offset)) {
+        std::stable_sort(order.begin(), order.end(), by_resource_offset);
+        bool overlapping = false;
+        for (size_t i = 1; i < order.size() && !overlapping; ++i) {
+            const auto &prev = binds[order[i - 1]];
+            overlapping = prev.resource_offset + prev.size > binds[order[i]].resource_offset;
+        }
+        if (!overlapping) {
+            MemoryBinds sorted;
+            sorted.reserve(binds.size());
+            for (size_t index : order) {
+                sorted.emplace_back(std::move(binds[index]));
+            }
+            binds.swap(sorted);
+        }
+    }
+
+    size_t last = 0;
+    for (size_t i = 1; i < binds.size(); ++i) {
+        auto &merged = binds[last];
+        auto &bind = binds[i];
+        const bool contiguous = merged.memory_state == bind.memory_state &&
+                                merged.resource_offset + merged.size == bind.resource_offset &&
+                                (!bind.memory_state || merged.memory_offset + merged.size == bind.memory_offset);
+        if (contiguous) {
+            merged.size += bind.size;
+        } else if (++last != i) {
+            binds[last] = std::move(bind);
+        }
+    }
+    binds.resize(last + 1);
+}
+
+void vvl::BindableSparseMemoryTracker::BindMemories(StateObject *parent, MemoryBinds &binds) {
+    CoalesceMemoryBinds(binds);
+
+    auto guard = WriteLockGuard{binding_lock_};
+
+    for (auto &value_pair : binding_map_) {
+        if (value_pair.second.memory_state) value_pair.second.memory_state->RemoveParent(parent);
+    }
+    for (auto &bind : binds) {
+        MEM_BINDING memory_data{bind.memory_state, bind.memory_offset, bind.resource_offset};
+        binding_map_.overwrite_range(BindingMap::value_type{{bind.resource_offset, bind.resource_offset + bind.size}, memory_data});
+    }
+    for (auto &value_pair : binding_map_) {
+        if (value_pair.second.memory_state) value_pair.second.memory_state->AddParent(parent);
+    }
+}
+
 BoundMemoryRange vvl::BindableSparseMemoryTracker::GetBoundMemoryRange(const MemoryRange &range) const {
     BoundMemoryRange mem_ranges;
     auto guard = ReadLockGuard{binding_lock_};
@@ -238,8 +348,21 @@ void vvl::BindableMultiplanarMemoryTracker::BindMemory(StateObject *parent, std:
     if (!mem_state) return;
 
     assert(resource_offset < planes_.size());
+    auto &plane = planes_[static_cast<size_t>(resource_offset)];
+    if (const auto &old_mem_state = plane.binding.memory_state) {
+        old_mem_state->RemoveBoundResource(parent, {plane.binding.memory_offset, plane.binding.memory_offset + plane.size});
+    }
     mem_state->AddParent(parent);
-    planes_[static_cast<size_t>(resource_offset)].binding = {mem_state, memory_offset, 0u};
+    plane.binding = {mem_state, memory_offset, 0u};
+    mem_state->AddBoundResource(parent, {memory_offset, memory_offset + plane.size});
+}
+
+void vvl::BindableMultiplanarMemoryTracker::RemoveBoundResources(StateObject *parent) {
+    for (const auto &plane : planes_) {
+        if (const auto &mem_state = plane.binding.memory_state) {
+            mem_state->RemoveBoundResource(parent, {plane.binding.memory_offset, plane.binding.memory_offset + plane.size});
+        }
+    }
 }
 
 // range needs to be between [0, planes_[0].size + planes_[1].size + planes_[2].size)
@@ -318,3 +441,99 @@ void vvl::Bindable::CacheInvalidMemory() const {
     }
 }
 
+
+static void AddSharing(VkSharingMode sharing_mode, uint32_t queue_family_index_count, const uint32_t *queue_family_indices,
+                       vvl::MemoryRequirementsCache::Key &key) {
+    key.words.emplace_back(sharing_mode);
+    if (sharing_mode == VK_SHARING_MODE_CONCURRENT && queue_family_indices) {
+        key.words.emplace_back(queue_family_index_count);
+        for (uint32_t i = 0; i < queue_family_index_count; ++i) {
+            key.words.emplace_back(queue_family_indices[i]);
+        }
+    }
+}
+
+bool vvl::MemoryRequirementsCache::GetKey(const VkBufferCreateInfo &create_info, Key &key) {
+    key.words.clear();
+    key.words.emplace_back(VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO);
+    key.words.emplace_back(create_info.flags);
+    key.words.emplace_back(create_info.size);
+    key.words.emplace_back(create_info.usage);
+    AddSharing(create_info.sharingMode, create_info.queueFamilyIndexCount, create_info.pQueueFamilyIndices, key);
+    for (auto *next = static_cast<const VkBaseInStructure *>(create_info.pNext); next; next = next->pNext) {
+        key.words.emplace_back(next->sType);
+        switch (next->sType) {
+            case VK_STRUCTURE_TYPE_BUFFER_USAGE_FLAGS_2_CREATE_INFO_KHR:
+                key.words.emplace_back(reinterpret_cast<const VkBufferUsageFlags2CreateInfoKHR *>(next)->usage);
+                break;
+            case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO:
+                key.words.emplace_back(reinterpret_cast<const VkExternalMemoryBufferCreateInfo *>(next)->handleTypes);
+                break;
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+bool vvl::MemoryRequirementsCache::GetKey(const VkImageCreateInfo &create_info, Key &key) {
+    // The driver picks the modifier of the image, another image can get another one
+    if (create_info.tiling == VK_IMAGE_TILING_DRM_FORMAT_MODIFIER_EXT) {
+        return false;
+    }
+    key.words.clear();
+    key.words.emplace_back(VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO);
+    key.words.emplace_back(create_info.flags);
+    key.words.emplace_back(create_info.imageType);
+    key.words.emplace_back(create_info.format);
+    key.words.emplace_back(create_info.extent.width);
+    key.words.emplace_back(create_info.extent.height);
+    key.words.emplace_back(create_info.extent.depth);
+    key.words.emplace_back(create_info.mipLevels);
+    key.words.emplace_back(create_info.arrayLayers);
+    key.words.emplace_back(create_info.samples);
+    key.words.emplace_back(create_info.tiling);
+    key.words.emplace_back(create_info.usage);
+    key.words.emplace_back(create_info.initialLayout);
+    AddSharing(create_info.sharingMode, create_info.queueFamilyIndexCount, create_info.pQueueFamilyIndices, key);
+    for (auto *next = static_cast<const VkBaseInStructure *>(create_info.pNext); next; next = next->pNext) {
+        key.words.emplace_back(next->sType);
+        switch (next->sType) {
+            case VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO:
+                key.words.emplace_back(reinterpret_cast<const VkImageStencilUsageCreateInfo *>(next)->stencilUsage);
+                break;
+            case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO:
+                key.words.emplace_back(reinterpret_cast<const VkExternalMemoryImageCreateInfo *>(next)->handleTypes);
+                break;
+            case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO: {
+                auto *format_list = reinterpret_cast<const VkImageFormatListCreateInfo *>(next);
+                const uint32_t count = format_list->pViewFormats ? format_list->viewFormatCount : 0;
+                key.words.emplace_back(count);
+                for (uint32_t i = 0; i < count; ++i) {
+                    key.words.emplace_back(format_list->pViewFormats[i]);
+                }
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+bool vvl::MemoryRequirementsCache::Find(const Key &key, Requirements &out) const {
+    std::shared_lock<std::shared_mutex> guard(lock_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        return false;
+    }
+    out = it->second;
+    return true;
+}
+
+void vvl::MemoryRequirementsCache::Add(const Key &key, const Requirements &requirements) {
+    std::unique_lock<std::shared_mutex> guard(lock_);
+    if (entries_.size() < kMaxEntries) {
+        entries_.emplace(key, requirements);
+    }
+}
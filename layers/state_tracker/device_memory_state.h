@@ -19,8 +19,13 @@
 #pragma once
 #include "state_tracker/state_object.h"
 #include "containers/range_vector.h"
+#include "utils/hash_util.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
 
+#include <algorithm>
+#include <array>
+#include <shared_mutex>
+
 namespace vvl {
 struct MemRange {
     VkDeviceSize offset = 0;
@@ -84,6 +89,56 @@ class DeviceMemory : public StateObject {
     bool IsDedicatedImage() const { return GetDedicatedImage() != VK_NULL_HANDLE; }
 
     VkDeviceMemory VkHandle() const { return handle_.Cast<VkDeviceMemory>(); }
+
+    // The mapped range with VK_WHOLE_SIZE resolved against the allocation. Copied out once by the checks that look at it for
+    // many ranges of the same memory, ex. the VkMappedMemoryRange of a flush.
+    struct MappedRange {
+        VkDeviceSize offset = 0;
+        VkDeviceSize size = 0;  // As given to vkMapMemory, 0 when the memory is not mapped
+        VkDeviceSize end = 0;
+        VkDeviceSize allocation_size = 0;
+        bool IsMapped() const { return size != 0; }
+    };
+    MappedRange GetMappedRange() const {
+        const VkDeviceSize end = (mapped_range.size == VK_WHOLE_SIZE) ? allocate_info.allocationSize
+                                                                       : mapped_range.offset + mapped_range.size;
+        return {mapped_range.offset, mapped_range.size, end, allocate_info.allocationSize};
+    }
+
+    // A resource bound to a range of this memory by vkBind*Memory
+    struct BoundResource {
+        StateObject *resource;
+        sparse_container::range<VkDeviceSize> range;
+    };
+    // Keeps the resources bound to a single range of this memory, so the resources overlapping a range can be found without
+    // walking every binding of a heavily suballocated memory. Sparse bindings are not indexed.
+    void AddBoundResource(StateObject *resource, const sparse_container::range<VkDeviceSize> &range);
+    void RemoveBoundResource(StateObject *resource, const sparse_container::range<VkDeviceSize> &range);
+
+    // Calls pred once for every indexed resource bound to memory overlapping range, until pred returns true.
+    // pred is called with the index locked, the resources cannot be destroyed while it runs, but it must not bind memory.
+    template <typename UnaryPredicate>
+    bool AnyBoundResourceOf(const sparse_container::range<VkDeviceSize> &range, const UnaryPredicate &pred) const {
+        auto guard = ReadLockGuard{bound_resources_lock_};
+        const auto bounds = bound_resources_.bounds(range);
+        for (auto it = bounds.begin; it != bounds.end; ++it) {
+            const auto &[segment, resources] = *it;
+            for (const BoundResource &bound : resources) {
+                // A resource is stored in each segment it covers, only report it from the first one in range
+                if (segment.includes(std::max(range.begin, bound.range.begin)) && pred(bound)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Overlapping bindings split the ranges, each segment lists the resources covering all of it
+    using BoundResourceMap = sparse_container::range_map<VkDeviceSize, small_vector<BoundResource, 1, size_t>>;
+
+  private:
+    BoundResourceMap bound_resources_;
+    mutable std::shared_mutex bound_resources_lock_;
 };
 
 // Generic memory binding struct to track objects bound to objects
@@ -112,6 +167,25 @@ class BindableMemoryTracker {
 
     virtual void BindMemory(StateObject *, std::shared_ptr<vvl::DeviceMemory> &, VkDeviceSize, VkDeviceSize, VkDeviceSize) = 0;
 
+    // A single bind of a vkQueueBindSparse call, a null memory_state unbinds the range
+    struct MemoryBind {
+        std::shared_ptr<vvl::DeviceMemory> memory_state;
+        VkDeviceSize memory_offset;
+        VkDeviceSize resource_offset;
+        VkDeviceSize size;
+    };
+    using MemoryBinds = std::vector<MemoryBind>;
+
+    // Applies the binds as if BindMemory was called for each of them in order. The binds may be reordered or merged.
+    virtual void BindMemories(StateObject *parent, MemoryBinds &binds) {
+        for (auto &bind : binds) {
+            BindMemory(parent, bind.memory_state, bind.memory_offset, bind.resource_offset, bind.size);
+        }
+    }
+
+    // Removes the parent from the bound resource index of the memory it was bound to
+    virtual void RemoveBoundResources(StateObject *parent) {}
+
     virtual BoundMemoryRange GetBoundMemoryRange(const MemoryRange &) const = 0;
     virtual DeviceMemoryState GetBoundMemoryStates() const = 0;
 };
@@ -147,12 +221,14 @@ class BindableLinearMemoryTracker : public BindableMemoryTracker {
 
     void BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &mem_state, VkDeviceSize memory_offset,
                     VkDeviceSize resource_offset, VkDeviceSize size) override;
+    void RemoveBoundResources(StateObject *parent) override;
 
     BoundMemoryRange GetBoundMemoryRange(const MemoryRange &range) const override;
     DeviceMemoryState GetBoundMemoryStates() const override;
 
   private:
     MEM_BINDING binding_;
+    VkDeviceSize size_ = 0;
 };
 
 // Sparse bindable memory tracker
@@ -171,6 +247,9 @@ class BindableSparseMemoryTracker : public BindableMemoryTracker {
     void BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &mem_state, VkDeviceSize memory_offset,
                     VkDeviceSize resource_offset, VkDeviceSize size) override;
 
+    // Takes the lock and relinks the parent once for all the binds, and merges binds of contiguous pages into one range
+    void BindMemories(StateObject *parent, MemoryBinds &binds) override;
+
     BoundMemoryRange GetBoundMemoryRange(const MemoryRange &range) const override;
 
     DeviceMemoryState GetBoundMemoryStates() const override;
@@ -197,6 +276,7 @@ class BindableMultiplanarMemoryTracker : public BindableMemoryTracker {
 
     void BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &mem_state, VkDeviceSize memory_offset,
                     VkDeviceSize resource_offset, VkDeviceSize size) override;
+    void RemoveBoundResources(StateObject *parent) override;
 
     BoundMemoryRange GetBoundMemoryRange(const MemoryRange &range) const override;
 
@@ -229,6 +309,7 @@ class Bindable : public StateObject {
     }
 
     void Destroy() override {
+        memory_tracker_->RemoveBoundResources(this);
         for (auto &state : memory_tracker_->GetBoundMemoryStates()) {
             state->RemoveParent(this);
         }
@@ -279,6 +360,10 @@ class Bindable : public StateObject {
         memory_tracker_->BindMemory(parent, mem, memory_offset, resource_offset, mem_size);
     }
 
+    void BindMemories(StateObject *parent, BindableMemoryTracker::MemoryBinds &binds) {
+        memory_tracker_->BindMemories(parent, binds);
+    }
+
     bool HasFullRangeBound() const { return memory_tracker_->HasFullRangeBound(); }
 
     std::pair<VkDeviceMemory, BindableMemoryTracker::MemoryRange> GetResourceMemoryOverlap(
@@ -318,4 +403,33 @@ class Bindable : public StateObject {
     mutable bool need_to_recache_invalid_memory_ = false;
     BindableMemoryTracker *memory_tracker_;
 };
+
+// Memory requirements of the buffers and images created with the same create info. With maintenance4 the driver must return
+// the same requirements for them (see vkGetDeviceBufferMemoryRequirements), so only the first resource created with a
+// create info queries its requirements. Create infos chaining pNext structs that are not part of the key are not cached.
+class MemoryRequirementsCache {
+  public:
+    // One per plane of a disjoint image, buffers only use the first one
+    using Requirements = std::array<VkMemoryRequirements, 3>;
+
+    struct Key {
+        small_vector<uint64_t, 32> words;
+        bool operator==(const Key &rhs) const { return words == rhs.words; }
+        size_t hash() const { return hash_util::HashCombiner().Combine(words.begin(), words.end()).Value(); }
+    };
+
+    // Return false if the create info can not be cached
+    static bool GetKey(const VkBufferCreateInfo &create_info, Key &key);
+    static bool GetKey(const VkImageCreateInfo &create_info, Key &key);
+
+    bool Find(const Key &key, Requirements &out) const;
+    void Add(const Key &key, const Requirements &requirements);
+
+  private:
+    // Bounded for the applications that create resources with ever changing parameters
+    static constexpr size_t kMaxEntries = 4096;
+
+    mutable std::shared_mutex lock_;
+    unordered_map<Key, Requirements, hash_util::HasHashMember<Key>> entries_;
+};
 }  // namespace vvl
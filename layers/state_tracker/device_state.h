@@ -19,7 +19,9 @@
 #pragma once
 #include "state_tracker/state_object.h"
 #include "generated/layer_chassis_dispatch.h"
+#include "utils/hash_util.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
+#include <shared_mutex>
 #include <vector>
 
 class QueueFamilyPerfCounters {
@@ -55,7 +57,60 @@ class PhysicalDevice : public StateObject {
 
     VkPhysicalDevice VkHandle() const { return handle_.Cast<VkPhysicalDevice>(); }
 
+    // Parameters of a vkGetPhysicalDeviceImageFormatProperties[2] query of vkCreateImage. Only the pNext structs with a
+    // member here are part of the key, queries chaining any other struct are not cached.
+    struct ImageFormatQuery {
+        bool properties2 = false;  // vkGetPhysicalDeviceImageFormatProperties2 was called, the pNext members apply
+        VkFormat format = VK_FORMAT_UNDEFINED;
+        VkImageType type = VK_IMAGE_TYPE_1D;
+        VkImageTiling tiling = VK_IMAGE_TILING_OPTIMAL;
+        VkImageUsageFlags usage = 0;
+        VkImageCreateFlags flags = 0;
+        VkImageUsageFlags stencil_usage = 0;                         // VkImageStencilUsageCreateInfo
+        VkExternalMemoryHandleTypeFlagBits external_handle_type{};   // VkPhysicalDeviceExternalImageFormatInfo
+        std::vector<VkFormat> view_formats;                          // VkImageFormatListCreateInfo
+
+        bool operator==(const ImageFormatQuery &rhs) const {
+            return properties2 == rhs.properties2 && format == rhs.format && type == rhs.type && tiling == rhs.tiling &&
+                   usage == rhs.usage && flags == rhs.flags && stencil_usage == rhs.stencil_usage &&
+                   external_handle_type == rhs.external_handle_type && view_formats == rhs.view_formats;
+        }
+        size_t hash() const {
+            hash_util::HashCombiner hc;
+            hc << properties2 << format << type << tiling << usage << flags << stencil_usage << external_handle_type;
+            hc.Combine(view_formats);
+            return hc.Value();
+        }
+    };
+    struct ImageFormatQueryResult {
+        VkResult result;
+        VkImageFormatProperties properties;
+    };
+
+    // The driver answers the same for the same parameters, so the result is only queried for the first image created with
+    // them. Returns false if the query was not made yet.
+    bool FindImageFormatQuery(const ImageFormatQuery &query, ImageFormatQueryResult &out) const {
+        std::shared_lock<std::shared_mutex> guard(image_format_queries_lock_);
+        auto it = image_format_queries_.find(query);
+        if (it == image_format_queries_.end()) {
+            return false;
+        }
+        out = it->second;
+        return true;
+    }
+    void AddImageFormatQuery(const ImageFormatQuery &query, const ImageFormatQueryResult &result) {
+        std::unique_lock<std::shared_mutex> guard(image_format_queries_lock_);
+        // Bounded for the applications that create images with ever changing parameters
+        if (image_format_queries_.size() < kMaxImageFormatQueries) {
+            image_format_queries_.emplace(query, result);
+        }
+    }
+
   private:
+    static constexpr size_t kMaxImageFormatQueries = 4096;
+    mutable std::shared_mutex image_format_queries_lock_;
+    unordered_map<ImageFormatQuery, ImageFormatQueryResult, hash_util::HasHashMember<ImageFormatQuery>> image_format_queries_;
+
     const std::vector<VkQueueFamilyProperties> GetQueueFamilyProps(VkPhysicalDevice phys_dev) {
         std::vector<VkQueueFamilyProperties> result;
         uint32_t count;
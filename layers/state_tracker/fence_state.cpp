@@ -44,7 +44,8 @@ bool vvl::Fence::IsPresentSyncSwapchainChanged(const std::shared_ptr<vvl::Swapch
 
 // Called from a non-queue operation, such as vkWaitForFences()|
 void vvl::Fence::NotifyAndWait(const Location &loc) {
-    std::shared_future<void> waiter;
+    WaitList::Waiter waiter;
+    bool waiting = false;
     PresentSync present_sync;
     {
         // Hold the lock only while updating members, but not
@@ -53,10 +54,11 @@ void vvl::Fence::NotifyAndWait(const Location &loc) {
         if (state_ == kInflight) {
             if (queue_) {
                 queue_->Notify(seq_);
-                waiter = waiter_;
+                waiters_.Add(waiter);
+                waiting = true;
             } else {
                 state_ = kRetired;
-                completed_.set_value();
+                waiters_.WakeAll();
                 queue_ = nullptr;
                 seq_ = 0;
             }
@@ -64,13 +66,14 @@ void vvl::Fence::NotifyAndWait(const Location &loc) {
             present_sync_ = PresentSync{};
         }
     }
-    if (waiter.valid()) {
-        auto result = waiter.wait_until(GetCondWaitTimeout());
-        if (result != std::future_status::ready) {
+    if (waiting) {
+        if (!waiter.WaitUntil(GetCondWaitTimeout())) {
             dev_data_.LogError(
                 "INTERNAL-ERROR-VkFence-state-timeout", Handle(), loc,
                 "The Validation Layers hit a timeout waiting for fence state to update (this is most likely a validation bug).");
         }
+        auto guard = WriteLock();
+        waiters_.Remove(waiter);
     }
     for (const auto &submission : present_sync.submissions) {
         submission.queue->NotifyAndWait(loc, submission.seq);
@@ -82,7 +85,7 @@ void vvl::Fence::Retire() {
     auto guard = WriteLock();
     if (state_ == kInflight) {
         state_ = kRetired;
-        completed_.set_value();
+        waiters_.WakeAll();
         queue_ = nullptr;
         seq_ = 0;
     }
@@ -100,8 +103,8 @@ void vvl::Fence::Reset() {
         imported_handle_type_.reset();
     }
     state_ = kUnsignaled;
-    completed_ = std::promise<void>();
-    waiter_ = std::shared_future<void>(completed_.get_future());
+    // Threads still waiting waited for the signal that was reset, they are not left waiting for the next one
+    waiters_.WakeAll();
     present_sync_ = PresentSync{};
 }
 
@@ -129,8 +132,7 @@ void vvl::Fence::Export(VkExternalFenceHandleTypeFlagBits handle_type) {
             imported_handle_type_.reset();
         }
         state_ = kUnsignaled;
-        completed_ = std::promise<void>();
-        waiter_ = std::shared_future<void>(completed_.get_future());
+        waiters_.WakeAll();
     }
 }
 
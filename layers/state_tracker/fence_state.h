@@ -21,8 +21,8 @@
 
 #include "state_tracker/state_object.h"
 #include "state_tracker/submission_reference.h"
-#include <future>
 #include <mutex>
+#include "utils/wait_list.h"
 
 class ValidationStateTracker;
 
@@ -56,8 +56,6 @@ class Fence : public RefcountedStateObject {
           flags(pCreateInfo->flags),
           exportHandleTypes(GetExportHandleTypes(pCreateInfo)),
           state_((pCreateInfo->flags & VK_FENCE_CREATE_SIGNALED_BIT) ? kRetired : kUnsignaled),
-          completed_(),
-          waiter_(completed_.get_future()),
           dev_data_(dev) {}
 
     VkFence VkHandle() const { return handle_.Cast<VkFence>(); }
@@ -112,8 +110,8 @@ class Fence : public RefcountedStateObject {
     enum Scope scope_{kInternal};
     std::optional<VkExternalFenceHandleTypeFlagBits> imported_handle_type_;  // has value when scope is not kInternal
     mutable std::shared_mutex lock_;
-    std::promise<void> completed_;
-    std::shared_future<void> waiter_;
+    // Host threads waiting for the fence to retire, all woken by a retire or a reset
+    WaitList waiters_;
     PresentSync present_sync_;
     ValidationStateTracker &dev_data_;
 };
@@ -94,6 +94,32 @@ ImageSubresourceLayoutMap::ImageSubresourceLayoutMap(const vvl::Image& image_sta
       layouts_(encoder_.SubresourceCount()),
       initial_layout_states_() {}
 
+bool ImageSubresourceLayoutMap::IsWholeImage(const VkImageSubresourceRange& range) const {
+    const auto& limits = encoder_.Limits();
+    return range.aspectMask == encoder_.AspectMask() && range.baseMipLevel == 0 && range.levelCount == limits.mipLevel &&
+           range.baseArrayLayer == 0 && range.layerCount == limits.arrayLayer;
+}
+
+bool ImageSubresourceLayoutMap::SetWholeImageLayout(const vvl::CommandBuffer& cb_state, const LayoutEntry& new_entry,
+                                                    const vvl::ImageView* view_state, bool& updated_current) {
+    if (layouts_.empty()) {
+        // Same as the fill of UpdateLayoutStateImpl, for a single range
+        initial_layout_states_.emplace_back(cb_state, view_state);
+        LayoutEntry entry = new_entry;
+        entry.state = &initial_layout_states_.back();
+        layouts_.insert(layouts_.end(), std::make_pair(IndexRange(0, encoder_.SubresourceCount()), entry));
+        updated_current = true;
+        return true;
+    }
+    if (!IsUniform()) {
+        return false;
+    }
+    auto& entry = layouts_.begin()->second;
+    assert(entry.state != nullptr);
+    updated_current = entry.CurrentWillChange(new_entry.current_layout) && entry.Update(new_entry);
+    return true;
+}
+
 // Use the unwrapped maps from the BothMap in the actual implementation
 template <typename LayoutMap>
 static bool SetSubresourceRangeLayoutImpl(LayoutMap& layouts, InitialLayoutStates& initial_layout_states, RangeGenerator& range_gen,
@@ -114,6 +140,11 @@ bool ImageSubresourceLayoutMap::SetSubresourceRangeLayout(const vvl::CommandBuff
     }
     if (!InRange(range)) return false;  // Don't even try to track bogus subreources
 
+    bool updated = false;
+    if (IsWholeImage(range) && SetWholeImageLayout(cb_state, LayoutEntry(expected_layout, layout), nullptr, updated)) {
+        return updated;
+    }
+
     RangeGenerator range_gen(encoder_, range);
     if (layouts_.SmallMode()) {
         return SetSubresourceRangeLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout,
@@ -141,6 +172,11 @@ void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const vvl::Comm
                                                                  const VkImageSubresourceRange& range, VkImageLayout layout) {
     if (!InRange(range)) return;  // Don't even try to track bogus subreources
 
+    bool updated = false;
+    if (IsWholeImage(range) && SetWholeImageLayout(cb_state, LayoutEntry(layout), nullptr, updated)) {
+        return;
+    }
+
     RangeGenerator range_gen(encoder_, range);
     if (layouts_.SmallMode()) {
         SetSubresourceRangeInitialLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout, nullptr);
@@ -153,6 +189,12 @@ void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const vvl::Comm
 // Unwrap the BothMaps entry here as this is a performance hotspot.
 void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const vvl::CommandBuffer& cb_state, VkImageLayout layout,
                                                                  const vvl::ImageView& view_state) {
+    bool updated = false;
+    if (IsWholeImage(view_state.normalized_subresource_range) &&
+        SetWholeImageLayout(cb_state, LayoutEntry(layout), &view_state, updated)) {
+        return;
+    }
+
     RangeGenerator range_gen(view_state.range_generator);
     if (layouts_.SmallMode()) {
         SetSubresourceRangeInitialLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout,
@@ -20,8 +20,9 @@
  */
 #pragma once
 
-#include <functional>
+#include <atomic>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "containers/range_vector.h"
@@ -57,7 +58,6 @@ struct InitialLayoutState {
 
 class ImageSubresourceLayoutMap {
   public:
-    typedef std::function<bool(const VkImageSubresource&, VkImageLayout, VkImageLayout)> Callback;
 
     struct SubresourceLayout {
         VkImageSubresource subresource;
@@ -125,8 +125,20 @@ class ImageSubresourceLayoutMap {
     const LayoutMap& GetLayoutMap() const { return layouts_; }
     ImageSubresourceLayoutMap(const vvl::Image& image_state);
     ~ImageSubresourceLayoutMap() {}
+    // Back to the state of a new map for the same image, so it can be reused by the next recording
+    void Clear() {
+        layouts_.clear();
+        initial_layout_states_.clear();
+        validated_generation_.store(0, std::memory_order_relaxed);
+    }
     const vvl::Image* GetImageView() const { return &image_state_; };
 
+    // True when a single entry covers the whole image, ex. when every transition was done on all the subresources. The
+    // updates and lookups of the whole image then skip the range generation, until a partial transition splits it.
+    bool IsUniform() const {
+        return layouts_.size() == 1 && layouts_.begin()->first == IndexRange(0, encoder_.SubresourceCount());
+    }
+
     // This looks a bit ponderous but kAspectCount is a compile time constant
     VkImageSubresource Decode(IndexType index) const {
         const auto subres = encoder_.Decode(index);
@@ -141,16 +153,25 @@ class ImageSubresourceLayoutMap {
         return RangeGenerator();
     }
 
-    bool AnyInRange(const VkImageSubresourceRange& normalized_range,
-                    std::function<bool(const RangeType& range, const LayoutEntry& state)>&& func) const {
-        return AnyInRange(RangeGen(normalized_range), std::move(func));
+    // func is called as bool(const RangeType& range, const LayoutEntry& state) for each entry intersecting the range, until it
+    // returns true. It is a template parameter so the lambdas of the callers are inlined instead of going through std::function.
+    template <typename Fn>
+    bool AnyInRange(const VkImageSubresourceRange& normalized_range, Fn&& func) const {
+        return AnyInRange(RangeGen(normalized_range), std::forward<Fn>(func));
     }
 
-    bool AnyInRange(const RangeGenerator& gen, std::function<bool(const RangeType& range, const LayoutEntry& state)>&& func) const {
-        return AnyInRange(RangeGenerator(gen), std::move(func));
+    template <typename Fn>
+    bool AnyInRange(const RangeGenerator& gen, Fn&& func) const {
+        return AnyInRange(RangeGenerator(gen), std::forward<Fn>(func));
     }
 
-    bool AnyInRange(RangeGenerator&& gen, std::function<bool(const RangeType& range, const LayoutEntry& state)>&& func) const {
+    template <typename Fn>
+    bool AnyInRange(RangeGenerator&& gen, Fn&& func) const {
+        if (IsUniform()) {
+            // Every range of gen intersects the single entry
+            const auto& entry = *layouts_.begin();
+            return gen->non_empty() && func(entry.first, entry.second);
+        }
         for (; gen->non_empty(); ++gen) {
             for (auto pos = layouts_.lower_bound(*gen); (pos != layouts_.end()) && (gen->intersects(pos->first)); ++pos) {
                 if (func(pos->first, pos->second)) {
@@ -164,26 +185,65 @@ class ImageSubresourceLayoutMap {
   protected:
     bool InRange(const VkImageSubresource& subres) const { return encoder_.InRange(subres); }
     bool InRange(const VkImageSubresourceRange& range) const { return encoder_.InRange(range); }
+    bool IsWholeImage(const VkImageSubresourceRange& range) const;
+    // Whole image updates of an empty or uniform map, returns false if the map has to go through the range generator
+    bool SetWholeImageLayout(const vvl::CommandBuffer& cb_state, const LayoutEntry& new_entry, const vvl::ImageView* view_state,
+                             bool& updated_current);
+
+    // Generation of the global layout map the initial layouts were last checked against without a mismatch, so a command
+    // buffer submitted again with no layout change of the image in between does not compare them again. The map is only
+    // modified while recording, which starts from Clear().
+    bool IsValidatedAgainst(uint64_t generation) const {
+        return validated_generation_.load(std::memory_order_relaxed) == generation;
+    }
+    void SetValidatedAgainst(uint64_t generation) const { validated_generation_.store(generation, std::memory_order_relaxed); }
 
   private:
     const vvl::Image& image_state_;
     const Encoder& encoder_;
     LayoutMap layouts_;
     InitialLayoutStates initial_layout_states_;
+    // 0 is never the generation of a global map
+    mutable std::atomic<uint64_t> validated_generation_{0};
 };
 }  // namespace image_layout_map
 
-class GlobalImageLayoutRangeMap : public subresource_adapter::BothRangeMap<VkImageLayout, 16> {
+class GlobalImageLayoutRangeMap
+    : public subresource_adapter::BothRangeMap<VkImageLayout, 16,
+                                               sparse_container::hot_range_map<subresource_adapter::IndexType, VkImageLayout>> {
   public:
     using RangeGenerator = image_layout_map::RangeGenerator;
     using RangeType = key_type;
 
-    GlobalImageLayoutRangeMap(index_type index) : BothRangeMap<VkImageLayout, 16>(index) {}
+    GlobalImageLayoutRangeMap(index_type index) : BothRangeMap(index), generation_(NextGeneration()) {}
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
-    bool AnyInRange(RangeGenerator& gen, std::function<bool(const key_type& range, const mapped_type& state)>&& func) const;
+    // func is called as bool(const key_type& range, const mapped_type& state), see ImageSubresourceLayoutMap::AnyInRange
+    template <typename Fn>
+    bool AnyInRange(RangeGenerator& gen, Fn&& func) const {
+        for (; gen->non_empty(); ++gen) {
+            for (auto pos = lower_bound(*gen); (pos != end()) && (gen->intersects(pos->first)); ++pos) {
+                if (func(pos->first, pos->second)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Changes each time a layout of the map changes. Generations come from a single counter, so two maps never share
+    // one and a generation seen for a destroyed map cannot match the map allocated in its place.
+    uint64_t Generation() const { return generation_.load(std::memory_order_relaxed); }
+    // NOTE: The write lock must be held
+    void SetChanged() { generation_.store(NextGeneration(), std::memory_order_relaxed); }
 
   private:
+    static uint64_t NextGeneration() {
+        static std::atomic<uint64_t> next_generation{1};
+        return next_generation.fetch_add(1, std::memory_order_relaxed);
+    }
+
     mutable std::shared_mutex lock_;
+    std::atomic<uint64_t> generation_;
 };
\ No newline at end of file
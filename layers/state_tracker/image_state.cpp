@@ -96,10 +96,17 @@ static VkSwapchainKHR GetSwapchain(const VkImageCreateInfo *pCreateInfo) {
 
 static vvl::Image::MemoryReqs GetMemoryRequirements(const ValidationStateTracker &dev_data, VkImage img,
                                                     const VkImageCreateInfo *create_info, bool disjoint, bool is_external_ahb) {
+    static_assert(std::is_same_v<vvl::Image::MemoryReqs, vvl::MemoryRequirementsCache::Requirements>);
     vvl::Image::MemoryReqs result{};
     // Record the memory requirements in case they won't be queried
     // External AHB memory can't be queried until after memory is bound
     if (!is_external_ahb) {
+        vvl::MemoryRequirementsCache::Key key;
+        const bool cacheable =
+            dev_data.enabled_features.maintenance4 && vvl::MemoryRequirementsCache::GetKey(*create_info, key);
+        if (cacheable && dev_data.memory_requirements_cache_.Find(key, result)) {
+            return result;
+        }
         if (disjoint == false) {
             DispatchGetImageMemoryRequirements(dev_data.device, img, &result[0]);
         } else {
@@ -130,6 +137,9 @@ static vvl::Image::MemoryReqs GetMemoryRequirements(const ValidationStateTracker
                 result[i] = mem_reqs2.memoryRequirements;
             }
         }
+        if (cacheable) {
+            dev_data.memory_requirements_cache_.Add(key, result);
+        }
     }
     return result;
 }
@@ -244,8 +254,7 @@ Image::Image(const ValidationStateTracker &dev_data, VkImage img, const VkImageC
       store_device_as_workaround(dev_data.device),  // TODO REMOVE WHEN encoder can be const
       supported_video_profiles(dev_data.video_profile_cache_.Get(
           dev_data.physical_device, vku::FindStructInPNextChain<VkVideoProfileListInfoKHR>(pCreateInfo->pNext))) {
-    fragment_encoder =
-        std::unique_ptr<const subresource_adapter::ImageRangeEncoder>(new subresource_adapter::ImageRangeEncoder(*this));
+    fragment_encoder = dev_data.image_range_encoder_cache_.Get(*this);
 
     tracker_.emplace<BindableNoMemoryTracker>(requirements.data());
     SetMemoryTracker(&std::get<BindableNoMemoryTracker>(tracker_));
@@ -359,8 +368,12 @@ void Image::SetImageLayout(const VkImageSubresourceRange &range, VkImageLayout l
     using sparse_container::value_precedence;
     GlobalImageLayoutRangeMap::RangeGenerator range_gen(subresource_encoder, NormalizeSubresourceRange(range));
     auto guard = layout_range_map->WriteLock();
+    bool updated = false;
     for (; range_gen->non_empty(); ++range_gen) {
-        update_range_value(*layout_range_map, *range_gen, layout, value_precedence::prefer_source);
+        updated |= update_range_value(*layout_range_map, *range_gen, layout, value_precedence::prefer_source);
+    }
+    if (updated) {
+        layout_range_map->SetChanged();
     }
 }
 
@@ -875,15 +888,3 @@ std::vector<VkPresentModeKHR> Surface::GetCompatibleModes(VkPhysicalDevice phys_
 }
 
 }  // namespace vvl
-
-bool GlobalImageLayoutRangeMap::AnyInRange(RangeGenerator &gen,
-                                           std::function<bool(const key_type &range, const mapped_type &state)> &&func) const {
-    for (; gen->non_empty(); ++gen) {
-        for (auto pos = lower_bound(*gen); (pos != end()) && (gen->intersects(pos->first)); ++pos) {
-            if (func(pos->first, pos->second)) {
-                return true;
-            }
-        }
-    }
-    return false;
-}
@@ -119,7 +119,7 @@ class Image : public Bindable {
 #endif  // VK_USE_PLATFORM_METAL
 
     const image_layout_map::Encoder subresource_encoder;                             // Subresource resolution encoder
-    std::unique_ptr<const subresource_adapter::ImageRangeEncoder> fragment_encoder;  // Fragment resolution encoder
+    std::shared_ptr<const subresource_adapter::ImageRangeEncoder> fragment_encoder;  // Fragment resolution encoder, shared
     const VkDevice store_device_as_workaround;                                       // TODO REMOVE WHEN encoder can be const
 
     std::shared_ptr<GlobalImageLayoutRangeMap> layout_range_map;
@@ -243,6 +243,16 @@ class Image : public Bindable {
 
     template <typename UnaryPredicate>
     bool AnyImageAliasOf(const UnaryPredicate &pred) const {
+        // A compatible alias is bound at the same offset of the same memory, so only the images bound over that offset have
+        // to be looked at, not every resource suballocated from the memory
+        if (const auto *binding = Binding()) {
+            return binding->memory_state->AnyBoundResourceOf(
+                {binding->memory_offset, binding->memory_offset + 1}, [this, &pred](const DeviceMemory::BoundResource &bound) {
+                    if (bound.resource->Type() != kVulkanObjectTypeImage) return false;
+                    auto other_image = static_cast<const Image *>(bound.resource);
+                    return (other_image != this) && other_image->IsCompatibleAliasing(this) && pred(*other_image);
+                });
+        }
         // Look for another aliasing image and
         // ObjectBindings() is thread safe since returns by value, and once
         // the weak_ptr is successfully locked, the other image state won't
@@ -30,14 +30,14 @@ static PipelineLayoutCompatDict pipeline_layout_compat_dict;
 static PushConstantRangesDict push_constant_ranges_dict;
 
 size_t PipelineLayoutCompatDef::hash() const {
-    hash_util::HashCombiner hc;
+    hash_util::BulkHasher hasher;
     // The set number is integral to the CompatDef's distinctiveness
-    hc << set << push_constant_ranges.get();
+    hasher << set << push_constant_ranges.get();
     const auto &descriptor_set_layouts = *set_layouts_id.get();
     for (uint32_t i = 0; i <= set; i++) {
-        hc << descriptor_set_layouts[i].get();
+        hasher << descriptor_set_layouts[i].get();
     }
-    return hc.Value();
+    return hasher.Value();
 }
 
 bool PipelineLayoutCompatDef::operator==(const PipelineLayoutCompatDef &other) const {
@@ -826,7 +826,9 @@ void LastBound::Reset() {
     pipeline_layout = VK_NULL_HANDLE;
     if (push_descriptor_set) {
         cb_state.RemoveChild(push_descriptor_set);
-        push_descriptor_set->Destroy();
+        if (!cb_state.IsPooledPushDescriptorSet(*push_descriptor_set)) {
+            push_descriptor_set->Destroy();
+        }
     }
     push_descriptor_set.reset();
     per_set.clear();
@@ -222,6 +222,14 @@ class Pipeline : public StateObject {
     // TODO - This could probably just be a check to VkGraphicsPipelineLibraryCreateInfoEXT::flags
     bool OwnsSubState(const std::shared_ptr<PipelineSubState> sub_state) const { return sub_state && (&sub_state->parent == this); }
 
+    // Used to know if two sub states come from the same library being linked in, the constraints between them were already
+    // validated when that library was created. Only the constraints between sub states of different libraries (or of this
+    // pipeline) need to be validated when linking.
+    bool SubStatesLinkedFromSameLibrary(const std::shared_ptr<PipelineSubState> &sub_state_a,
+                                        const std::shared_ptr<PipelineSubState> &sub_state_b) const {
+        return sub_state_a && sub_state_b && !OwnsSubState(sub_state_a) && (&sub_state_a->parent == &sub_state_b->parent);
+    }
+
     const std::shared_ptr<const vvl::RenderPass> RenderPassState() const {
         // TODO A render pass object is required for all of these sub-states. Which one should be used for an "executable pipeline"?
         if (fragment_output_state && fragment_output_state->rp_state) {
@@ -657,7 +665,8 @@ struct LastBound {
         std::vector<uint32_t> dynamicOffsets;
         PipelineLayoutCompatId compat_id_for_set{0};
 
-        // Cache most recently validated descriptor state for ValidateActionState/UpdateDrawState
+        // Cache most recently recorded descriptor state for UpdatePipelineState/UpdateDrawState, the validation results are
+        // cached on the DescriptorSet
         const vvl::DescriptorSet *validated_set{nullptr};
         uint64_t validated_set_change_count{~0ULL};
         uint64_t validated_set_image_layout_change_count{~0ULL};
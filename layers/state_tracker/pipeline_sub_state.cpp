@@ -19,6 +19,11 @@
 #include "state_tracker/pipeline_state.h"
 #include "state_tracker/shader_module.h"
 
+#include <cstring>
+#include <type_traits>
+
+#include "utils/hash_util.h"
+
 VkPipelineLayoutCreateFlags PipelineSubState::PipelineLayoutCreateFlags() const {
     const auto layout_state = parent.PipelineLayoutState();
     return (layout_state) ? layout_state->CreateFlags() : static_cast<VkPipelineLayoutCreateFlags>(0);
@@ -143,32 +148,127 @@ PreRasterState::PreRasterState(const vvl::Pipeline &p, const ValidationStateTrac
     }
 }
 
-std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
+namespace {
+
+// A state block and the words of its content, the key it is interned by. Only blocks without a pNext chain are interned, so
+// the key covers everything in them.
+template <typename SafeState>
+struct StateBlockDef {
+    std::vector<uint32_t> key;
+    SafeState state;
+
+    size_t hash() const { return hash_util::HashCombiner().Combine(key.cbegin(), key.cend()).Value(); }
+    bool operator==(const StateBlockDef &rhs) const { return key == rhs.key; }
+};
+
+uint32_t FloatBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+// The plain and safe create infos have the same members
+template <typename CreateInfo>
+void AppendKey(std::vector<uint32_t> &key, const CreateInfo &cbs, const VkPipelineColorBlendStateCreateInfo *) {
+    key.insert(key.end(), {cbs.flags, cbs.logicOpEnable, static_cast<uint32_t>(cbs.logicOp), cbs.attachmentCount,
+                           cbs.pAttachments ? 1u : 0u});
+    if (cbs.pAttachments) {
+        for (uint32_t i = 0; i < cbs.attachmentCount; ++i) {
+            const auto &attachment = cbs.pAttachments[i];
+            key.insert(key.end(),
+                       {attachment.blendEnable, static_cast<uint32_t>(attachment.srcColorBlendFactor),
+                        static_cast<uint32_t>(attachment.dstColorBlendFactor), static_cast<uint32_t>(attachment.colorBlendOp),
+                        static_cast<uint32_t>(attachment.srcAlphaBlendFactor),
+                        static_cast<uint32_t>(attachment.dstAlphaBlendFactor), static_cast<uint32_t>(attachment.alphaBlendOp),
+                        attachment.colorWriteMask});
+        }
+    }
+    for (const float constant : cbs.blendConstants) {
+        key.push_back(FloatBits(constant));
+    }
+}
+
+template <typename CreateInfo>
+void AppendKey(std::vector<uint32_t> &key, const CreateInfo &ms, const VkPipelineMultisampleStateCreateInfo *) {
+    key.insert(key.end(), {ms.flags, static_cast<uint32_t>(ms.rasterizationSamples), ms.sampleShadingEnable,
+                           FloatBits(ms.minSampleShading), ms.alphaToCoverageEnable, ms.alphaToOneEnable,
+                           ms.pSampleMask ? 1u : 0u});
+    if (ms.pSampleMask) {
+        const uint32_t mask_count = (static_cast<uint32_t>(ms.rasterizationSamples) + 31) / 32;
+        key.insert(key.end(), ms.pSampleMask, ms.pSampleMask + mask_count);
+    }
+}
+
+void AppendKey(std::vector<uint32_t> &key, const VkStencilOpState &stencil) {
+    key.insert(key.end(), {static_cast<uint32_t>(stencil.failOp), static_cast<uint32_t>(stencil.passOp),
+                           static_cast<uint32_t>(stencil.depthFailOp), static_cast<uint32_t>(stencil.compareOp),
+                           stencil.compareMask, stencil.writeMask, stencil.reference});
+}
+
+template <typename CreateInfo>
+void AppendKey(std::vector<uint32_t> &key, const CreateInfo &ds, const VkPipelineDepthStencilStateCreateInfo *) {
+    key.insert(key.end(), {ds.flags, ds.depthTestEnable, ds.depthWriteEnable, static_cast<uint32_t>(ds.depthCompareOp),
+                           ds.depthBoundsTestEnable, ds.stencilTestEnable, FloatBits(ds.minDepthBounds),
+                           FloatBits(ds.maxDepthBounds)});
+    AppendKey(key, ds.front);
+    AppendKey(key, ds.back);
+}
+
+template <typename SafeState, typename CreateInfo>
+SafeState ToSafeState(const CreateInfo &state) {
+    if constexpr (std::is_same_v<CreateInfo, SafeState>) {
+        return state;
+    } else {
+        return SafeState(&state);
+    }
+}
+
+template <typename SafeState>
+using StateBlockDict = hash_util::Dictionary<StateBlockDef<SafeState>, hash_util::HasHashMember<StateBlockDef<SafeState>>>;
+
+// Shared by all devices, like the descriptor set layouts
+template <typename SafeState>
+StateBlockDict<SafeState> &GetStateBlockDict() {
+    static StateBlockDict<SafeState> dict;
+    return dict;
+}
+
+template <typename SafeState, typename VkState, typename CreateInfo>
+std::shared_ptr<const SafeState> InternStateBlock(const CreateInfo &create_info) {
+    if (create_info.pNext) {
+        return std::make_shared<const SafeState>(ToSafeState<SafeState>(create_info));
+    }
+    StateBlockDef<SafeState> def{{}, ToSafeState<SafeState>(create_info)};
+    AppendKey(def.key, create_info, static_cast<const VkState *>(nullptr));
+    auto interned = GetStateBlockDict<SafeState>().LookUp(std::move(def));
+    return std::shared_ptr<const SafeState>(interned, &interned->state);
+}
+
+}  // namespace
+
+std::shared_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
     const vku::safe_VkPipelineColorBlendStateCreateInfo &cbs) {
-    // This is needlessly copied here. Might better to make this a plain pointer, with an optional "backing unique_ptr"
-    return std::make_unique<const vku::safe_VkPipelineColorBlendStateCreateInfo>(cbs);
+    return InternStateBlock<vku::safe_VkPipelineColorBlendStateCreateInfo, VkPipelineColorBlendStateCreateInfo>(cbs);
 }
-std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
+std::shared_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
     const VkPipelineColorBlendStateCreateInfo &cbs) {
-    return std::make_unique<const vku::safe_VkPipelineColorBlendStateCreateInfo>(&cbs);
+    return InternStateBlock<vku::safe_VkPipelineColorBlendStateCreateInfo, VkPipelineColorBlendStateCreateInfo>(cbs);
 }
-std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
+std::shared_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
     const vku::safe_VkPipelineMultisampleStateCreateInfo &cbs) {
-    // This is needlessly copied here. Might better to make this a plain pointer, with an optional "backing unique_ptr"
-    return std::make_unique<const vku::safe_VkPipelineMultisampleStateCreateInfo>(cbs);
+    return InternStateBlock<vku::safe_VkPipelineMultisampleStateCreateInfo, VkPipelineMultisampleStateCreateInfo>(cbs);
 }
-std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
+std::shared_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
     const VkPipelineMultisampleStateCreateInfo &cbs) {
-    return std::make_unique<const vku::safe_VkPipelineMultisampleStateCreateInfo>(&cbs);
+    return InternStateBlock<vku::safe_VkPipelineMultisampleStateCreateInfo, VkPipelineMultisampleStateCreateInfo>(cbs);
 }
-std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
+std::shared_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
     const vku::safe_VkPipelineDepthStencilStateCreateInfo &cbs) {
-    // This is needlessly copied here. Might better to make this a plain pointer, with an optional "backing unique_ptr"
-    return std::make_unique<const vku::safe_VkPipelineDepthStencilStateCreateInfo>(cbs);
+    return InternStateBlock<vku::safe_VkPipelineDepthStencilStateCreateInfo, VkPipelineDepthStencilStateCreateInfo>(cbs);
 }
-std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
+std::shared_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
     const VkPipelineDepthStencilStateCreateInfo &cbs) {
-    return std::make_unique<const vku::safe_VkPipelineDepthStencilStateCreateInfo>(&cbs);
+    return InternStateBlock<vku::safe_VkPipelineDepthStencilStateCreateInfo, VkPipelineDepthStencilStateCreateInfo>(cbs);
 }
 std::unique_ptr<const vku::safe_VkPipelineShaderStageCreateInfo> ToShaderStageCI(
     const vku::safe_VkPipelineShaderStageCreateInfo &cbs) {
@@ -94,17 +94,18 @@ struct PreRasterState : public PipelineSubState {
                                                    *task_shader_ci = nullptr, *mesh_shader_ci = nullptr;
 };
 
-std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
+// Pipelines with identical color blend, multisample or depth stencil states share one copy of it
+std::shared_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
     const vku::safe_VkPipelineColorBlendStateCreateInfo &cbs);
-std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
+std::shared_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
     const VkPipelineColorBlendStateCreateInfo &cbs);
-std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
+std::shared_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
     const vku::safe_VkPipelineMultisampleStateCreateInfo &cbs);
-std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
+std::shared_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
     const VkPipelineMultisampleStateCreateInfo &cbs);
-std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
+std::shared_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
     const vku::safe_VkPipelineDepthStencilStateCreateInfo &cbs);
-std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
+std::shared_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
     const VkPipelineDepthStencilStateCreateInfo &cbs);
 std::unique_ptr<const vku::safe_VkPipelineShaderStageCreateInfo> ToShaderStageCI(
     const vku::safe_VkPipelineShaderStageCreateInfo &cbs);
@@ -133,8 +134,8 @@ struct FragmentShaderState : public PipelineSubState {
     uint32_t subpass = 0;
 
     std::shared_ptr<const vvl::PipelineLayout> pipeline_layout;
-    std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ms_state;
-    std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ds_state;
+    std::shared_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ms_state;
+    std::shared_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ds_state;
 
     std::shared_ptr<const vvl::ShaderModule> fragment_shader;
     std::unique_ptr<const vku::safe_VkPipelineShaderStageCreateInfo> fragment_shader_ci;
@@ -200,8 +201,8 @@ struct FragmentOutputState : public PipelineSubState {
     std::shared_ptr<const vvl::RenderPass> rp_state;
     uint32_t subpass = 0;
 
-    std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> color_blend_state;
-    std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ms_state;
+    std::shared_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> color_blend_state;
+    std::shared_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ms_state;
 
     AttachmentStateVector attachment_states;
 
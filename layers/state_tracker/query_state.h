@@ -154,7 +154,76 @@ inline bool operator==(const QueryObject &query1, const QueryObject &query2) {
     return ((query1.pool == query2.pool) && (query1.slot == query2.slot) && (query1.perf_pass == query2.perf_pass));
 }
 
-typedef std::map<QueryObject, QueryState> QueryMap;
+// Query states set by the command buffers of a submission. Kept in dense arrays per pool and performance pass, indexed by
+// slot, with the list of the queries set for iterating over them. A submission uses only a few pools.
+class QueryMap {
+  public:
+    void Set(const QueryObject &query, QueryState state) {
+        const uint32_t pool_index = GetPoolIndex(query.pool, query.perf_pass);
+        auto &states = pools_[pool_index].states;
+        if (query.slot >= states.size()) {
+            states.resize(query.slot + 1, kUnset);
+        }
+        if (states[query.slot] == kUnset) {
+            set_queries_.emplace_back(pool_index, query.slot);
+        }
+        states[query.slot] = static_cast<uint8_t>(state);
+    }
+
+    // QUERYSTATE_UNKNOWN if the query was not set
+    QueryState Get(const QueryObject &query) const {
+        for (const PoolStates &pool_states : pools_) {
+            if (pool_states.pool == query.pool && pool_states.perf_pass == query.perf_pass) {
+                if (query.slot < pool_states.states.size() && pool_states.states[query.slot] != kUnset) {
+                    return static_cast<QueryState>(pool_states.states[query.slot]);
+                }
+                break;
+            }
+        }
+        return QUERYSTATE_UNKNOWN;
+    }
+
+    // Calls fn(const QueryObject &, QueryState) for every query set, in the order they were first set
+    template <typename Fn>
+    void ForEach(Fn &&fn) const {
+        for (const auto &set_query : set_queries_) {
+            const PoolStates &pool_states = pools_[set_query.first];
+            fn(QueryObject(pool_states.pool, set_query.second, 0, pool_states.perf_pass),
+               static_cast<QueryState>(pool_states.states[set_query.second]));
+        }
+    }
+
+  private:
+    static constexpr uint8_t kUnset = 0xff;
+
+    struct PoolStates {
+        VkQueryPool pool;
+        uint32_t perf_pass;
+        std::vector<uint8_t> states;
+    };
+
+    uint32_t GetPoolIndex(VkQueryPool pool, uint32_t perf_pass) {
+        // Consecutive updates are almost always for the same pool
+        if (last_pool_index_ < pools_.size() && pools_[last_pool_index_].pool == pool &&
+            pools_[last_pool_index_].perf_pass == perf_pass) {
+            return last_pool_index_;
+        }
+        for (uint32_t i = 0; i < pools_.size(); ++i) {
+            if (pools_[i].pool == pool && pools_[i].perf_pass == perf_pass) {
+                last_pool_index_ = i;
+                return i;
+            }
+        }
+        last_pool_index_ = static_cast<uint32_t>(pools_.size());
+        pools_.emplace_back(PoolStates{pool, perf_pass, {}});
+        return last_pool_index_;
+    }
+
+    small_vector<PoolStates, 2, uint32_t> pools_;
+    // Index in pools_ and slot
+    std::vector<std::pair<uint32_t, uint32_t>> set_queries_;
+    uint32_t last_pool_index_ = 0;
+};
 
 enum QueryResultType {
     QUERYRESULT_UNKNOWN,
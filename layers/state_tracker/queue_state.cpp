@@ -18,6 +18,7 @@
  */
 #include "state_tracker/queue_state.h"
 #include "state_tracker/cmd_buffer_state.h"
+#include "state_tracker/state_tracker.h"
 
 void vvl::QueueSubmission::BeginUse() {
     for (auto &wait : wait_semaphores) {
@@ -49,12 +50,94 @@ void vvl::QueueSubmission::EndUse() {
     }
 }
 
-uint64_t vvl::Queue::PreSubmit(std::vector<vvl::QueueSubmission> &&submissions) {
+void vvl::QueueSubmission::Clear() {
+    end_batch = false;
+    cbs.clear();
+    wait_semaphores.clear();
+    signal_semaphores.clear();
+    fence.reset();
+    seq = 0;
+    perf_submit_pass = 0;
+}
+
+void vvl::QueueSubmission::Reset(const Location &loc_) { loc.Reset(loc_); }
+
+vvl::QueueRetirePool::QueueRetirePool(uint32_t thread_count) {
+    threads_.reserve(thread_count);
+    for (uint32_t i = 0; i < thread_count; ++i) {
+        threads_.emplace_back(&QueueRetirePool::WorkerLoop, this);
+    }
+}
+
+vvl::QueueRetirePool::~QueueRetirePool() {
+    {
+        std::unique_lock<std::mutex> guard(lock_);
+        // The queues are destroyed first, none of them can still be posted
+        assert(posted_.empty());
+        exit_ = true;
+    }
+    cond_.notify_all();
+    for (auto &thread : threads_) {
+        thread.join();
+    }
+}
+
+void vvl::QueueRetirePool::Post(Queue &queue) {
+    {
+        std::unique_lock<std::mutex> guard(lock_);
+        posted_.push_back(&queue);
+    }
+    cond_.notify_one();
+}
+
+void vvl::QueueRetirePool::WorkerLoop() {
+    while (true) {
+        Queue *queue = nullptr;
+        {
+            std::unique_lock<std::mutex> guard(lock_);
+            cond_.wait(guard, [this] { return exit_ || !posted_.empty(); });
+            if (exit_) {
+                return;
+            }
+            queue = posted_.front();
+            posted_.pop_front();
+        }
+        queue->RetireReady();
+    }
+}
+
+vvl::Queue::Queue(ValidationStateTracker &dev_data, VkQueue handle, uint32_t index, VkDeviceQueueCreateFlags flags,
+                  const VkQueueFamilyProperties &queueFamilyProperties)
+    : StateObject(handle, kVulkanObjectTypeQueue),
+      queueFamilyIndex(index),
+      flags(flags),
+      queueFamilyProperties(queueFamilyProperties),
+      dev_data_(dev_data),
+      retire_pool_(dev_data.GetQueueRetirePool()) {}
+
+std::unique_ptr<vvl::QueueSubmission> vvl::Queue::AcquireSubmission(const Location &loc) {
+    std::unique_ptr<QueueSubmission> submission;
+    {
+        auto guard = Lock();
+        if (!free_submissions_.empty()) {
+            submission = std::move(free_submissions_.back());
+            free_submissions_.pop_back();
+        }
+    }
+    if (!submission) {
+        return std::make_unique<QueueSubmission>(loc);
+    }
+    submission->Reset(loc);
+    return submission;
+}
+
+uint64_t vvl::Queue::PreSubmit(SubmissionBatch &&submissions) {
     if (!submissions.empty()) {
-        submissions.back().end_batch = true;
+        submissions.back()->end_batch = true;
     }
     uint64_t retire_early_seq = 0;
-    for (auto &submission : submissions) {
+    for (auto &submission_ptr : submissions) {
+        auto &submission = *submission_ptr;
         for (auto &cb_state : submission.cbs) {
             auto cb_guard = cb_state->WriteLock();
             for (auto *secondary_cmd_buffer : cb_state->linkedCommandBuffers) {
@@ -64,7 +147,7 @@ uint64_t vvl::Queue::PreSubmit(std::vector<vvl::QueueSubmission> &&submissions)
             cb_state->IncrementResources();
             cb_state->Submit(VkHandle(), submission.perf_submit_pass, submission.loc.Get());
         }
-        // seq_ is atomic so we don't need a lock until updating the deque below.
+        // seq_ is atomic so we don't need a lock until updating submissions_ below.
         // Note that this relies on the external synchonization requirements for the
         // VkQueue
         submission.seq = ++seq_;
@@ -84,8 +167,8 @@ uint64_t vvl::Queue::PreSubmit(std::vector<vvl::QueueSubmission> &&submissions)
         }
         {
             auto guard = Lock();
-            submissions_.emplace_back(std::move(submission));
-            if (!thread_) {
+            submissions_.emplace_back(std::move(submission_ptr));
+            if (!thread_ && !retire_pool_) {
                 thread_ = std::make_unique<std::thread>(&Queue::ThreadFunc, this);
             }
         }
@@ -101,25 +184,35 @@ void vvl::Queue::Notify(uint64_t until_seq) {
     if (request_seq_ < until_seq) {
         request_seq_ = until_seq;
     }
-    cond_.notify_one();
+    if (!retire_pool_) {
+        cond_.notify_one();
+        return;
+    }
+    if (retire_scheduled_) {
+        retire_wake_ = true;
+    } else if (!exit_thread_ && !submissions_.empty() && submissions_.front()->seq <= request_seq_) {
+        retire_scheduled_ = true;
+        guard.unlock();
+        retire_pool_->Post(*this);
+    }
 }
 
 void vvl::Queue::Wait(const Location &loc, uint64_t until_seq) {
-    std::shared_future<void> waiter;
+    bool retired = false;
     {
         auto guard = Lock();
         if (until_seq == kU64Max) {
             until_seq = seq_.load();
         }
-        if (submissions_.empty() || until_seq < submissions_.begin()->seq) {
+        // Submissions are popped in order once retired
+        const auto is_retired = [this, until_seq]() { return submissions_.empty() || until_seq < submissions_.front()->seq; };
+        if (is_retired()) {
             return;
         }
-        uint64_t index = until_seq - submissions_.begin()->seq;
-        assert(index < submissions_.size());
-        waiter = submissions_[static_cast<size_t>(index)].waiter;
+        assert(until_seq - submissions_.front()->seq < submissions_.size());
+        retired = retired_cond_.wait_until(guard, GetCondWaitTimeout(), is_retired);
     }
-    auto wait_status = waiter.wait_until(GetCondWaitTimeout());
-    if (wait_status != std::future_status::ready) {
+    if (!retired) {
         dev_data_.LogError(
             "INTERNAL-ERROR-VkQueue-state-timeout", Handle(), loc,
             "The Validation Layers hit a timeout waiting for queue state to update (this is most likely a validation bug)."
@@ -140,6 +233,8 @@ void vvl::Queue::Destroy() {
         exit_thread_ = true;
         cond_.notify_all();
         dead_thread = std::move(thread_);
+        // A worker of the retire pool can still be running the queue, it stops at its next batch
+        cond_.wait(guard, [this] { return !retire_scheduled_; });
     }
     if (dead_thread && dead_thread->joinable()) {
         dead_thread->join();
@@ -151,48 +246,72 @@ void vvl::Queue::Destroy() {
 void vvl::Queue::PostSubmit() {
     auto guard = Lock();
     if (!submissions_.empty()) {
-        PostSubmit(submissions_.back());
+        PostSubmit(*submissions_.back());
     }
 }
 
-vvl::QueueSubmission *vvl::Queue::NextSubmission() {
-    QueueSubmission *result = nullptr;
-    // Find if the next submission is ready so that the thread function doesn't need to worry
-    // about locking.
+bool vvl::Queue::NextRetireBatch() {
     auto guard = Lock();
-    while (!exit_thread_ && (submissions_.empty() || request_seq_ < submissions_.front().seq)) {
+    while (!exit_thread_ && (submissions_.empty() || request_seq_ < submissions_.front()->seq)) {
         // The queue thread must wait forever if nothing is happening, until we tell it to exit
         cond_.wait(guard);
     }
-    if (!exit_thread_) {
-        result = &submissions_.front();
-        // NOTE: the submission must remain on the dequeue until we're done processing it so that
-        // anyone waiting for it can find the correct waiter
+    if (exit_thread_) {
+        return false;
     }
-    return result;
+    GatherRetireBatch();
+    return true;
 }
 
-void vvl::Queue::Retire(QueueSubmission &submission) {
-    auto is_query_updated_after = [this](const QueryObject &query_object) {
-        auto guard = this->Lock();
-        bool first = true;
-        for (const auto &submission : this->submissions_) {
-            // The current submission is still on the deque, so skip it
-            if (first) {
-                first = false;
-                continue;
-            }
-            for (const auto &next_cb_state : submission.cbs) {
-                if (query_object.perf_pass != submission.perf_submit_pass) {
-                    continue;
-                }
-                if (next_cb_state->UpdatesQuery(query_object)) {
-                    return true;
-                }
+void vvl::Queue::GatherRetireBatch() {
+    auto &batch = retire_batch_;
+    assert(batch.submissions.empty());
+    // NOTE: the submissions must remain in submissions_ until we're done processing them, anyone waiting for them
+    // returns once they are erased
+    for (auto &submission : submissions_) {
+        if (submission->seq > request_seq_ || batch.submissions.size() == kMaxRetireBatch) {
+            break;
+        }
+        batch.submissions.emplace_back(submission.get());
+    }
+}
+
+bool vvl::Queue::IsQueryUpdatedAfter(const QueryObject &query_object) {
+    auto &batch = retire_batch_;
+    if (!batch.later_gathered) {
+        // Submissions are only erased by the thread retiring the queue, pointers to them stay valid
+        auto guard = Lock();
+        for (size_t i = batch.submissions.size(); i < submissions_.size(); ++i) {
+            batch.later.emplace_back(submissions_[i].get());
+        }
+        batch.later_gathered = true;
+    }
+    auto updates_query = [&query_object](const QueueSubmission &submission) {
+        if (query_object.perf_pass != submission.perf_submit_pass) {
+            return false;
+        }
+        for (const auto &next_cb_state : submission.cbs) {
+            if (next_cb_state->UpdatesQuery(query_object)) {
+                return true;
             }
         }
         return false;
     };
+    for (size_t i = batch.current + 1; i < batch.submissions.size(); ++i) {
+        if (updates_query(*batch.submissions[i])) {
+            return true;
+        }
+    }
+    for (const auto *submission : batch.later) {
+        if (updates_query(*submission)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void vvl::Queue::Retire(QueueSubmission &submission) {
+    auto is_query_updated_after = [this](const QueryObject &query_object) { return IsQueryUpdatedAfter(query_object); };
     submission.EndUse();
     for (auto &wait : submission.wait_semaphores) {
         wait.semaphore->Retire(this, submission.loc.Get(), wait.payload);
@@ -213,25 +332,83 @@ void vvl::Queue::Retire(QueueSubmission &submission) {
     }
 }
 
+void vvl::Queue::RetireBatch() {
+    auto span = dev_data_.TraceSpan("Queue", "RetireBatch");
+    auto &batch = retire_batch_;
+    // Semaphores and fences are still retired in submission order, a submission can wait on a signal of the previous one
+    for (batch.current = 0; batch.current < batch.submissions.size(); ++batch.current) {
+        Retire(*batch.submissions[batch.current]);
+    }
+    {
+        auto guard = Lock();
+        const size_t count = batch.submissions.size();
+        for (size_t i = 0; i < count && free_submissions_.size() < kMaxFreeSubmissions; ++i) {
+            // Cleared under the lock, the objects are released like when the submission was destroyed here
+            submissions_[i]->Clear();
+            free_submissions_.emplace_back(std::move(submissions_[i]));
+        }
+        submissions_.erase(submissions_.begin(), submissions_.begin() + count);
+    }
+    batch.submissions.clear();
+    batch.later.clear();
+    batch.later_gathered = false;
+    // wake up anyone waiting for these submissions to be retired
+    retired_cond_.notify_all();
+}
+
 void vvl::Queue::ThreadFunc() {
-    QueueSubmission *submission = nullptr;
+    // Roll this queue forward, one batch of ready submissions at a time.
+    while (NextRetireBatch()) {
+        RetireBatch();
+    }
+}
 
-    // Roll this queue forward, one submission at a time.
-    while (true) {
-        submission = NextSubmission();
-        if (submission == nullptr) {
-            break;
+bool vvl::Queue::CanRetire(const QueueSubmission &submission) {
+    for (const auto &wait : submission.wait_semaphores) {
+        if (!wait.semaphore->CanRetire(this, wait.payload)) {
+            return false;
         }
-        Retire(*submission);
-        // wake up anyone waiting for this submission to be retired
+    }
+    return true;
+}
+
+void vvl::Queue::RetireReady() {
+    auto &batch = retire_batch_;
+    while (true) {
         {
-            std::promise<void> completed;
-            {
-                auto guard = Lock();
-                completed = std::move(submission->completed);
-                submissions_.pop_front();
+            auto guard = Lock();
+            // Notify() calls from here on are seen by the checks below
+            retire_wake_ = false;
+            if (!exit_thread_) {
+                GatherRetireBatch();
             }
-            completed.set_value();
+            if (batch.submissions.empty()) {
+                retire_scheduled_ = false;
+                cond_.notify_all();
+                return;
+            }
+        }
+        // Semaphores are checked without the queue lock, their retirement notifies queues while holding their own lock
+        size_t ready = 0;
+        while (ready < batch.submissions.size() && CanRetire(*batch.submissions[ready])) {
+            ++ready;
+        }
+        const bool full = batch.submissions.size() == kMaxRetireBatch;
+        batch.submissions.resize(ready);
+        if (ready == 0) {
+            auto guard = Lock();
+            if (retire_wake_ || exit_thread_) {
+                continue;
+            }
+            retire_scheduled_ = false;
+            cond_.notify_all();
+            return;
+        }
+        RetireBatch();
+        if (full && ready == kMaxRetireBatch) {
+            // Stays scheduled, back at the end of the pool queue so the other queues get to run
+            retire_pool_->Post(*this);
+            return;
         }
     }
 }
@@ -22,12 +22,15 @@
 #include "state_tracker/semaphore_state.h"
 #include <condition_variable>
 #include <deque>
-#include <future>
+#include <memory>
+#include <string_view>
 #include <thread>
 #include <vector>
+#include "containers/custom_containers.h"
 #include "error_message/error_location.h"
 
 class ValidationStateTracker;
+struct QueryObject;
 
 namespace vvl {
 
@@ -40,7 +43,9 @@ struct QueueSubmission {
         std::shared_ptr<Semaphore> semaphore;
         uint64_t payload{0};
     };
-    QueueSubmission(const Location &loc_) : loc(loc_), completed(), waiter(completed.get_future()) {}
+    QueueSubmission(const Location &loc_) : loc(loc_) {}
+    QueueSubmission(const QueueSubmission &) = delete;
+    QueueSubmission &operator=(const QueueSubmission &) = delete;
 
     bool end_batch{false};
     std::vector<std::shared_ptr<vvl::CommandBuffer>> cbs;
@@ -50,8 +55,6 @@ struct QueueSubmission {
     LocationCapture loc;
     uint64_t seq{0};
     uint32_t perf_submit_pass{0};
-    std::promise<void> completed;
-    std::shared_future<void> waiter;
 
     void AddCommandBuffer(std::shared_ptr<vvl::CommandBuffer> &&cb_state) { cbs.emplace_back(std::move(cb_state)); }
 
@@ -67,6 +70,9 @@ struct QueueSubmission {
 
     void EndUse();
     void BeginUse();
+    // Releases the objects of a retired submission, the vectors keep their capacity for the next Reset()
+    void Clear();
+    void Reset(const Location &loc_);
 };
 
 // This timeout is for all queue threads to update their state after we know
@@ -76,23 +82,52 @@ static inline std::chrono::time_point<std::chrono::steady_clock> GetCondWaitTime
     return std::chrono::steady_clock::now() + std::chrono::seconds(10);
 }
 
+// Threads shared by all the queues of a device to retire their submissions, used instead of a thread per queue when the
+// queue_retire_threads setting is not 0.
+//
+// A queue is posted when it is notified and has a submission to retire. The worker that picks it up retires the
+// submissions that are ready as one batch of up to kMaxRetireBatch, before letting the other queues run. A submission that waits
+// on a semaphore signaled by another queue or by the host does not block the worker: the queue is put aside and posted
+// again by the Notify() that follows the signal retirement.
+class QueueRetirePool {
+  public:
+    explicit QueueRetirePool(uint32_t thread_count);
+    ~QueueRetirePool();
+    QueueRetirePool(const QueueRetirePool &) = delete;
+    QueueRetirePool &operator=(const QueueRetirePool &) = delete;
+
+    // NOTE: A queue is posted again only after its worker returned, see Queue::retire_scheduled_
+    void Post(Queue &queue);
+
+  private:
+    void WorkerLoop();
+
+    std::vector<std::thread> threads_;
+    std::mutex lock_;
+    std::condition_variable cond_;
+    std::deque<Queue *> posted_;
+    bool exit_{false};
+};
+
 class Queue: public StateObject {
   public:
     Queue(ValidationStateTracker &dev_data, VkQueue handle, uint32_t index, VkDeviceQueueCreateFlags flags,
-          const VkQueueFamilyProperties &queueFamilyProperties)
-        : StateObject(handle, kVulkanObjectTypeQueue),
-          queueFamilyIndex(index),
-          flags(flags),
-          queueFamilyProperties(queueFamilyProperties),
-          dev_data_(dev_data) {}
+          const VkQueueFamilyProperties &queueFamilyProperties);
 
     ~Queue() { Destroy(); }
     void Destroy() override;
 
     VkQueue VkHandle() const { return handle_.Cast<VkQueue>(); }
 
+    // A vkQueueSubmit() and the like rarely have more than a few batches
+    using SubmissionBatch = small_vector<std::unique_ptr<QueueSubmission>, 4>;
+
+    // Returns a submission retired by this queue if there is one, so steady state submits allocate nothing.
+    // Access relies on the external synchronization of the VkQueue, like PreSubmit().
+    std::unique_ptr<QueueSubmission> AcquireSubmission(const Location &loc);
+
     // called from the various PreCallRecordQueueSubmit() methods
-    virtual uint64_t PreSubmit(std::vector<QueueSubmission> &&submissions);
+    virtual uint64_t PreSubmit(SubmissionBatch &&submissions);
     // called from the various PostCallRecordQueueSubmit() methods
     void PostSubmit();
 
@@ -113,11 +148,12 @@ class Queue: public StateObject {
 
     // Track command buffer label stack accross all command buffers submitted to this queue.
     // Access to this variable relies on external queue synchronization.
-    std::vector<std::string> cmdbuf_label_stack;
+    // The names are interned by the state tracker, see CommandBuffer::LabelCommand.
+    std::vector<std::string_view> cmdbuf_label_stack;
 
     // Track the last closed label. It is used in the error messages to help locate unbalanced vkCmdEndDebugUtilsLabelEXT command.
     // Access to this variable relies on external queue synchronization.
-    std::string last_closed_cmdbuf_label;
+    std::string_view last_closed_cmdbuf_label;
 
     // Stop per-queue label tracking after the first label mismatch error.
     // Access to this variable relies on external queue synchronization.
@@ -125,26 +161,65 @@ class Queue: public StateObject {
   protected:
     // called from the various PostCallRecordQueueSubmit() methods
     virtual void PostSubmit(QueueSubmission &submission) {}
-    // called when the worker thread decides a submissions has finished executing
+    // called when the worker thread decides a submissions has finished executing, for each submission of a retire batch
     virtual void Retire(QueueSubmission &submission);
 
   private:
+    friend class QueueRetirePool;
     using LockGuard = std::unique_lock<std::mutex>;
+
+    // Most submissions retired by a thread that wakes up are retired together, ex. all the frames in flight when
+    // waiting for the device to be idle
+    static constexpr uint32_t kMaxRetireBatch = 64;
+    // Retired submissions kept for reuse, more than the frames in flight of most applications
+    static constexpr size_t kMaxFreeSubmissions = 64;
+
+    // The submissions at the front of submissions_ being retired. Only accessed by the thread retiring the queue.
+    struct RetireBatchState {
+        std::vector<QueueSubmission *> submissions;
+        size_t current = 0;
+        // The submissions queued after the batch, gathered the first time a query needs them
+        bool later_gathered = false;
+        std::vector<const QueueSubmission *> later;
+    };
+
     void ThreadFunc();
-    QueueSubmission *NextSubmission();
+    // Returns false when the thread must exit
+    bool NextRetireBatch();
+    // NOTE: lock_ must be held
+    void GatherRetireBatch();
+    // Retires the submissions of retire_batch_, then pops them and wakes up anyone waiting for them under a single lock
+    void RetireBatch();
+    bool IsQueryUpdatedAfter(const QueryObject &query_object);
+    // Run by the workers of the retire pool
+    void RetireReady();
+    // False if a wait of the submission still depends on another queue or on the host
+    bool CanRetire(const QueueSubmission &submission);
     LockGuard Lock() const { return LockGuard(lock_); }
 
     ValidationStateTracker &dev_data_;
+    // Null when the queue has its own thread
+    QueueRetirePool *const retire_pool_;
+    RetireBatchState retire_batch_;
 
     // state related to submitting to the queue, all data members must
     // be accessed with lock_ held
     std::unique_ptr<std::thread> thread_;
-    std::deque<QueueSubmission> submissions_;
+    // In submission order. The submissions themselves are never moved, so the retire batch can refer to them without the
+    // lock, and a retired batch is erased from the front at once, which only moves the pointers of the pending ones.
+    std::vector<std::unique_ptr<QueueSubmission>> submissions_;
+    std::vector<std::unique_ptr<QueueSubmission>> free_submissions_;
     std::atomic<uint64_t> seq_{0};
     uint64_t request_seq_{0};
     bool exit_thread_{false};
+    // Retire pool only: the queue is posted or a worker is running it
+    bool retire_scheduled_{false};
+    // Retire pool only: Notify() was called while a worker was running the queue
+    bool retire_wake_{false};
     mutable std::mutex lock_;
-    // condition to wake up the queue's thread
+    // condition to wake up the queue's thread, or with the retire pool to signal that retire_scheduled_ was cleared
     std::condition_variable cond_;
+    // condition to wake up the threads in Wait(), signaled when submissions are popped
+    std::condition_variable retired_cond_;
 };
 } // namespace vvl
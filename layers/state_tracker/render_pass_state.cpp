@@ -20,6 +20,7 @@
 #include "state_tracker/render_pass_state.h"
 #include "utils/convert_utils.h"
 #include "state_tracker/image_state.h"
+#include "utils/hash_util.h"
 
 static const VkImageLayout kInvalidLayout = VK_IMAGE_LAYOUT_MAX_ENUM;
 
@@ -54,14 +55,14 @@ static VkSubpassDependency2 ImplicitDependencyToExternal(uint32_t subpass) {
                                         0};
     return to_external;
 }
-// NOTE: The functions below are only called from the vvl::RenderPass constructor, and use const_cast<> to set up
-// members that never change after construction is finished.
-static void RecordRenderPassDAG(const VkRenderPassCreateInfo2 *pCreateInfo, vvl::RenderPass *render_pass) {
-    auto &subpass_to_node = const_cast<vvl::RenderPass::DAGNodeVec &>(render_pass->subpass_to_node);
+// NOTE: The functions below are only called from the vvl::RenderPassAnalysis constructor, the analysis never changes
+// after construction is finished.
+static void RecordRenderPassDAG(const VkRenderPassCreateInfo2 *pCreateInfo, vvl::RenderPassAnalysis *analysis) {
+    auto &subpass_to_node = analysis->subpass_to_node;
     subpass_to_node.resize(pCreateInfo->subpassCount);
-    auto &self_dependencies = const_cast<vvl::RenderPass::SelfDepVec &>(render_pass->self_dependencies);
+    auto &self_dependencies = analysis->self_dependencies;
     self_dependencies.resize(pCreateInfo->subpassCount);
-    auto &subpass_dependencies = const_cast<vvl::RenderPass::SubpassGraphVec &>(render_pass->subpass_dependencies);
+    auto &subpass_dependencies = analysis->subpass_dependencies;
     subpass_dependencies.resize(pCreateInfo->subpassCount);
 
     for (uint32_t i = 0; i < pCreateInfo->subpassCount; ++i) {
@@ -136,22 +137,22 @@ static void RecordRenderPassDAG(const VkRenderPassCreateInfo2 *pCreateInfo, vvl:
 }
 
 struct AttachmentTracker {  // This is really only of local interest, but a bit big for a lambda
-    vvl::RenderPass *const rp;
-    vvl::RenderPass::SubpassVec &first;
-    vvl::RenderPass::FirstIsTransitionVec &first_is_transition;
-    vvl::RenderPass::SubpassVec &last;
-    vvl::RenderPass::TransitionVec &subpass_transitions;
-    vvl::RenderPass::FirstReadMap &first_read;
+    vvl::RenderPassAnalysis *const rp;
+    vvl::RenderPassAnalysis::SubpassVec &first;
+    vvl::RenderPassAnalysis::FirstIsTransitionVec &first_is_transition;
+    vvl::RenderPassAnalysis::SubpassVec &last;
+    vvl::RenderPassAnalysis::TransitionVec &subpass_transitions;
+    vvl::RenderPassAnalysis::FirstReadMap &first_read;
     const uint32_t attachment_count;
     std::vector<VkImageLayout> attachment_layout;
     std::vector<std::vector<VkImageLayout>> subpass_attachment_layout;
-    explicit AttachmentTracker(vvl::RenderPass *render_pass)
-        : rp(render_pass),
-          first(const_cast<vvl::RenderPass::SubpassVec &>(rp->attachment_first_subpass)),
-          first_is_transition(const_cast<vvl::RenderPass::FirstIsTransitionVec &>(rp->attachment_first_is_transition)),
-          last(const_cast<vvl::RenderPass::SubpassVec &>(rp->attachment_last_subpass)),
-          subpass_transitions(const_cast<vvl::RenderPass::TransitionVec &>(rp->subpass_transitions)),
-          first_read(const_cast<vvl::RenderPass::FirstReadMap &>(rp->attachment_first_read)),
+    explicit AttachmentTracker(vvl::RenderPassAnalysis *analysis)
+        : rp(analysis),
+          first(rp->attachment_first_subpass),
+          first_is_transition(rp->attachment_first_is_transition),
+          last(rp->attachment_last_subpass),
+          subpass_transitions(rp->subpass_transitions),
+          first_read(rp->attachment_first_read),
           attachment_count(rp->create_info.attachmentCount),
           attachment_layout(),
           subpass_attachment_layout() {
@@ -244,12 +245,12 @@ struct AttachmentTracker {  // This is really only of local interest, but a bit
     }
 };
 
-static void InitRenderPassState(vvl::RenderPass *render_pass) {
-    auto create_info = render_pass->create_info.ptr();
+static void InitRenderPassState(vvl::RenderPassAnalysis *analysis) {
+    auto create_info = analysis->create_info.ptr();
 
-    RecordRenderPassDAG(create_info, render_pass);
+    RecordRenderPassDAG(create_info, analysis);
 
-    AttachmentTracker attachment_tracker(render_pass);
+    AttachmentTracker attachment_tracker(analysis);
 
     for (uint32_t subpass_index = 0; subpass_index < create_info->subpassCount; ++subpass_index) {
         const VkSubpassDescription2 &subpass = create_info->pSubpasses[subpass_index];
@@ -262,35 +263,125 @@ static void InitRenderPassState(vvl::RenderPass *render_pass) {
         // From the spec
         // If the VkSubpassDescription2::viewMask member of any element of pSubpasses is not zero, multiview functionality is
         // considered to be enabled for this render pass.
-        (*const_cast<bool *>(&render_pass->has_multiview_enabled)) |= (subpass.viewMask != 0);
+        analysis->has_multiview_enabled |= (subpass.viewMask != 0);
     }
     attachment_tracker.FinalTransitions();
 }
 
 namespace vvl {
 
-RenderPass::RenderPass(VkRenderPass handle, VkRenderPassCreateInfo2 const *pCreateInfo)
-    : StateObject(handle, kVulkanObjectTypeRenderPass),
-      use_dynamic_rendering(false),
-      use_dynamic_rendering_inherited(false),
-      has_multiview_enabled(false),
-      create_info(pCreateInfo) {
+RenderPassAnalysis::RenderPassAnalysis(const VkRenderPassCreateInfo2 &rp_create_info) : create_info(&rp_create_info) {
     InitRenderPassState(this);
 }
 
-static vku::safe_VkRenderPassCreateInfo2 ConvertCreateInfo(const VkRenderPassCreateInfo &create_info) {
-    vku::safe_VkRenderPassCreateInfo2 create_info_2 = ConvertVkRenderPassCreateInfoToV2KHR(create_info);
-    return create_info_2;
+std::shared_ptr<const RenderPassAnalysis> RenderPassAnalysis::Empty() {
+    static const std::shared_ptr<const RenderPassAnalysis> empty = std::make_shared<const RenderPassAnalysis>();
+    return empty;
 }
 
-RenderPass::RenderPass(VkRenderPass handle, VkRenderPassCreateInfo const *pCreateInfo)
+template <typename... Values>
+static void AddWords(std::vector<uint32_t> &words, Values... values) {
+    (words.push_back(static_cast<uint32_t>(values)), ...);
+}
+
+static bool AddToKey(const VkAttachmentReference2 *refs, uint32_t count, std::vector<uint32_t> &words) {
+    words.push_back(refs ? 1 : 0);
+    for (uint32_t i = 0; refs && i < count; ++i) {
+        if (refs[i].pNext) {
+            return false;
+        }
+        AddWords(words, refs[i].attachment, refs[i].layout, refs[i].aspectMask);
+    }
+    return true;
+}
+
+bool RenderPassAnalysisCache::MakeKey(const VkRenderPassCreateInfo2 &create_info, Key &key) {
+    if (create_info.pNext) {
+        return false;
+    }
+    auto &words = key.words;
+    AddWords(words, create_info.flags, create_info.attachmentCount, create_info.subpassCount, create_info.dependencyCount,
+             create_info.correlatedViewMaskCount);
+    for (uint32_t i = 0; i < create_info.attachmentCount; ++i) {
+        const VkAttachmentDescription2 &attachment = create_info.pAttachments[i];
+        if (attachment.pNext) {
+            return false;
+        }
+        AddWords(words, attachment.flags, attachment.format, attachment.samples, attachment.loadOp, attachment.storeOp,
+                 attachment.stencilLoadOp, attachment.stencilStoreOp, attachment.initialLayout, attachment.finalLayout);
+    }
+    for (uint32_t i = 0; i < create_info.subpassCount; ++i) {
+        const VkSubpassDescription2 &subpass = create_info.pSubpasses[i];
+        if (subpass.pNext) {
+            return false;
+        }
+        AddWords(words, subpass.flags, subpass.pipelineBindPoint, subpass.viewMask, subpass.inputAttachmentCount,
+                 subpass.colorAttachmentCount, subpass.preserveAttachmentCount);
+        if (!AddToKey(subpass.pInputAttachments, subpass.inputAttachmentCount, words) ||
+            !AddToKey(subpass.pColorAttachments, subpass.colorAttachmentCount, words) ||
+            !AddToKey(subpass.pResolveAttachments, subpass.colorAttachmentCount, words) ||
+            !AddToKey(subpass.pDepthStencilAttachment, 1, words)) {
+            return false;
+        }
+        if (subpass.pPreserveAttachments) {
+            words.insert(words.end(), subpass.pPreserveAttachments, subpass.pPreserveAttachments + subpass.preserveAttachmentCount);
+        }
+    }
+    for (uint32_t i = 0; i < create_info.dependencyCount; ++i) {
+        const VkSubpassDependency2 &dependency = create_info.pDependencies[i];
+        if (dependency.pNext) {
+            return false;
+        }
+        AddWords(words, dependency.srcSubpass, dependency.dstSubpass, dependency.srcStageMask, dependency.dstStageMask,
+                 dependency.srcAccessMask, dependency.dstAccessMask, dependency.dependencyFlags, dependency.viewOffset);
+    }
+    if (create_info.pCorrelatedViewMasks) {
+        words.insert(words.end(), create_info.pCorrelatedViewMasks,
+                     create_info.pCorrelatedViewMasks + create_info.correlatedViewMaskCount);
+    }
+    return true;
+}
+
+size_t RenderPassAnalysisCache::Key::Hash::operator()(const Key &key) const {
+    hash_util::HashCombiner hc;
+    hc << key.words;
+    return hc.Value();
+}
+
+std::shared_ptr<const RenderPassAnalysis> RenderPassAnalysisCache::Get(const VkRenderPassCreateInfo2 &create_info) {
+    Key key;
+    if (!MakeKey(create_info, key)) {
+        return std::make_shared<const RenderPassAnalysis>(create_info);
+    }
+
+    std::lock_guard<std::mutex> guard(lock_);
+    auto &entry = entries_[std::move(key)];
+    std::shared_ptr<const RenderPassAnalysis> analysis = entry.lock();
+    if (!analysis) {
+        analysis = std::make_shared<const RenderPassAnalysis>(create_info);
+        entry = analysis;
+        if (entries_.size() >= sweep_size_) {
+            for (auto it = entries_.begin(); it != entries_.end();) {
+                it = it->second.expired() ? entries_.erase(it) : std::next(it);
+            }
+            sweep_size_ = std::max(kMinSweepSize, entries_.size() * 2);
+        }
+    }
+    return analysis;
+}
+
+RenderPass::RenderPass(VkRenderPass handle, std::shared_ptr<const RenderPassAnalysis> &&shared_analysis)
     : StateObject(handle, kVulkanObjectTypeRenderPass),
       use_dynamic_rendering(false),
       use_dynamic_rendering_inherited(false),
-      has_multiview_enabled(false),
-      create_info(ConvertCreateInfo(*pCreateInfo)) {
-    InitRenderPassState(this);
-}
+      has_multiview_enabled(shared_analysis->has_multiview_enabled),
+      analysis(std::move(shared_analysis)) {}
+
+RenderPass::RenderPass(VkRenderPass handle, VkRenderPassCreateInfo2 const *pCreateInfo)
+    : RenderPass(handle, std::make_shared<const RenderPassAnalysis>(*pCreateInfo)) {}
+
+RenderPass::RenderPass(VkRenderPass handle, VkRenderPassCreateInfo const *pCreateInfo)
+    : RenderPass(handle, std::make_shared<const RenderPassAnalysis>(*ConvertVkRenderPassCreateInfoToV2KHR(*pCreateInfo).ptr())) {}
 
 const VkPipelineRenderingCreateInfo VkPipelineRenderingCreateInfo_default = {
     VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO, nullptr, 0, 0, nullptr, VK_FORMAT_UNDEFINED, VK_FORMAT_UNDEFINED};
@@ -303,7 +394,8 @@ RenderPass::RenderPass(VkPipelineRenderingCreateInfo const *pPipelineRenderingCr
       rasterization_enabled(rasterization_enabled),
       dynamic_pipeline_rendering_create_info((pPipelineRenderingCreateInfo && rasterization_enabled)
                                                  ? pPipelineRenderingCreateInfo
-                                                 : &VkPipelineRenderingCreateInfo_default) {}
+                                                 : &VkPipelineRenderingCreateInfo_default),
+      analysis(RenderPassAnalysis::Empty()) {}
 
 bool RenderPass::UsesColorAttachment(uint32_t subpass_num) const {
     bool result = false;
@@ -397,14 +489,16 @@ RenderPass::RenderPass(VkRenderingInfo const *pRenderingInfo, bool rasterization
       use_dynamic_rendering_inherited(false),
       has_multiview_enabled(false),
       rasterization_enabled(rasterization_enabled),
-      dynamic_rendering_begin_rendering_info((pRenderingInfo && rasterization_enabled) ? pRenderingInfo : nullptr) {}
+      dynamic_rendering_begin_rendering_info((pRenderingInfo && rasterization_enabled) ? pRenderingInfo : nullptr),
+      analysis(RenderPassAnalysis::Empty()) {}
 
 RenderPass::RenderPass(VkCommandBufferInheritanceRenderingInfo const *pInheritanceRenderingInfo)
     : StateObject(static_cast<VkRenderPass>(VK_NULL_HANDLE), kVulkanObjectTypeRenderPass),
       use_dynamic_rendering(false),
       use_dynamic_rendering_inherited(true),
       has_multiview_enabled(false),
-      inheritance_rendering_info(pInheritanceRenderingInfo) {}
+      inheritance_rendering_info(pInheritanceRenderingInfo),
+      analysis(RenderPassAnalysis::Empty()) {}
 
 Framebuffer::Framebuffer(VkFramebuffer handle, const VkFramebufferCreateInfo *pCreateInfo, std::shared_ptr<RenderPass> &&rpstate,
                          std::vector<std::shared_ptr<vvl::ImageView>> &&attachments)
@@ -429,4 +523,42 @@ void Framebuffer::Destroy() {
     StateObject::Destroy();
 }
 
+void Framebuffer::NotifyInvalidate(const NodeList &invalid_nodes, bool unlink) {
+    StateObject::NotifyInvalidate(invalid_nodes, unlink);
+    // An attachment (or the image or swapchain behind it) went away
+    std::lock_guard<std::mutex> guard(validated_render_pass_lock_);
+    validated_render_pass_count_ = 0;
+}
+
+bool Framebuffer::IsRenderPassValidated(StateObject::IdType render_pass_id) const {
+    if (create_info.flags & VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT) {
+        return false;
+    }
+    std::lock_guard<std::mutex> guard(validated_render_pass_lock_);
+    for (uint32_t i = 0; i < validated_render_pass_count_; ++i) {
+        if (validated_render_passes_[i] == render_pass_id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Framebuffer::SetRenderPassValidated(StateObject::IdType render_pass_id) const {
+    if (create_info.flags & VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(validated_render_pass_lock_);
+    for (uint32_t i = 0; i < validated_render_pass_count_; ++i) {
+        if (validated_render_passes_[i] == render_pass_id) {
+            return;
+        }
+    }
+    if (validated_render_pass_count_ < kValidatedRenderPassCount) {
+        validated_render_passes_[validated_render_pass_count_++] = render_pass_id;
+    } else {
+        validated_render_passes_[validated_render_pass_next_] = render_pass_id;
+        validated_render_pass_next_ = (validated_render_pass_next_ + 1) % kValidatedRenderPassCount;
+    }
+}
+
 }  // namespace vvl
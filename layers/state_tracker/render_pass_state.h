@@ -19,6 +19,9 @@
 #pragma once
 #include "state_tracker/state_object.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
+#include <array>
+#include <memory>
+#include <mutex>
 
 namespace vvl {
 class ImageView;
@@ -60,8 +63,11 @@ struct SubpassLayout {
 
 namespace vvl {
 
-class RenderPass : public StateObject {
-  public:
+// Everything derived from the create info of a render pass: the subpass dependency graph, the first and last use of the
+// attachments and the layout transitions of each subpass. It only depends on the create info, so the render passes created
+// with identical create infos share one (see RenderPassAnalysisCache). The graph points into the copy of the create info
+// kept here, never into the one of a render pass.
+struct RenderPassAnalysis {
     struct AttachmentTransition {
         uint32_t prev_pass;
         uint32_t attachment;
@@ -70,30 +76,90 @@ class RenderPass : public StateObject {
         AttachmentTransition(uint32_t prev_pass_, uint32_t attachment_, VkImageLayout old_layout_, VkImageLayout new_layout_)
             : prev_pass(prev_pass_), attachment(attachment_), old_layout(old_layout_), new_layout(new_layout_) {}
     };
-    const bool use_dynamic_rendering;
-    const bool use_dynamic_rendering_inherited;
-    const bool has_multiview_enabled;
-    const bool rasterization_enabled{true};
-    const vku::safe_VkRenderingInfo dynamic_rendering_begin_rendering_info;
-    const vku::safe_VkPipelineRenderingCreateInfo dynamic_pipeline_rendering_create_info;
-    const vku::safe_VkCommandBufferInheritanceRenderingInfo inheritance_rendering_info;
-    const vku::safe_VkRenderPassCreateInfo2 create_info;
     using SubpassVec = std::vector<uint32_t>;
     using SelfDepVec = std::vector<SubpassVec>;
-    const std::vector<SubpassVec> self_dependencies;
     using DAGNodeVec = std::vector<DAGNode>;
-    const DAGNodeVec subpass_to_node;
     using FirstReadMap = vvl::unordered_map<uint32_t, bool>;
-    const FirstReadMap attachment_first_read;
-    const SubpassVec attachment_first_subpass;
-    const SubpassVec attachment_last_subpass;
     using FirstIsTransitionVec = std::vector<bool>;
-    const FirstIsTransitionVec attachment_first_is_transition;
     using SubpassGraphVec = std::vector<SubpassDependencyGraphNode>;
-    const SubpassGraphVec subpass_dependencies;
     using TransitionVec = std::vector<std::vector<AttachmentTransition>>;
-    const TransitionVec subpass_transitions;
 
+    vku::safe_VkRenderPassCreateInfo2 create_info;
+    bool has_multiview_enabled = false;
+    SelfDepVec self_dependencies;
+    DAGNodeVec subpass_to_node;
+    FirstReadMap attachment_first_read;
+    SubpassVec attachment_first_subpass;
+    SubpassVec attachment_last_subpass;
+    FirstIsTransitionVec attachment_first_is_transition;
+    SubpassGraphVec subpass_dependencies;
+    TransitionVec subpass_transitions;
+
+    RenderPassAnalysis() = default;
+    explicit RenderPassAnalysis(const VkRenderPassCreateInfo2 &rp_create_info);
+    // The one of the dynamic rendering passes, with no subpass and no attachment
+    static std::shared_ptr<const RenderPassAnalysis> Empty();
+    RenderPassAnalysis(const RenderPassAnalysis &) = delete;
+    RenderPassAnalysis &operator=(const RenderPassAnalysis &) = delete;
+};
+
+// Hash-conses the analyses of the render passes of a device by their create info. Entries do not keep an analysis alive,
+// it goes away with the last render pass using it. Create infos with a pNext chain anywhere are not shared, they are rare
+// and comparing the chains would cost more than the analysis.
+class RenderPassAnalysisCache {
+  public:
+    std::shared_ptr<const RenderPassAnalysis> Get(const VkRenderPassCreateInfo2 &create_info);
+
+  private:
+    // Every field of the create info the analysis or the validation of the render pass reads, in a fixed order
+    struct Key {
+        std::vector<uint32_t> words;
+
+        bool operator==(const Key &other) const { return words == other.words; }
+        struct Hash {
+            size_t operator()(const Key &key) const;
+        };
+    };
+    static bool MakeKey(const VkRenderPassCreateInfo2 &create_info, Key &key);
+    // Expired entries are removed when the map grows past this size
+    static constexpr size_t kMinSweepSize = 64;
+
+    std::mutex lock_;
+    vvl::unordered_map<Key, std::weak_ptr<const RenderPassAnalysis>, Key::Hash> entries_;
+    size_t sweep_size_ = kMinSweepSize;
+};
+
+class RenderPass : public StateObject {
+  public:
+    using AttachmentTransition = RenderPassAnalysis::AttachmentTransition;
+    using SubpassVec = RenderPassAnalysis::SubpassVec;
+    using SelfDepVec = RenderPassAnalysis::SelfDepVec;
+    using DAGNodeVec = RenderPassAnalysis::DAGNodeVec;
+    using FirstReadMap = RenderPassAnalysis::FirstReadMap;
+    using FirstIsTransitionVec = RenderPassAnalysis::FirstIsTransitionVec;
+    using SubpassGraphVec = RenderPassAnalysis::SubpassGraphVec;
+    using TransitionVec = RenderPassAnalysis::TransitionVec;
+
+    const bool use_dynamic_rendering;
+    const bool use_dynamic_rendering_inherited;
+    const bool has_multiview_enabled;
+    const bool rasterization_enabled{true};
+    const vku::safe_VkRenderingInfo dynamic_rendering_begin_rendering_info;
+    const vku::safe_VkPipelineRenderingCreateInfo dynamic_pipeline_rendering_create_info;
+    const vku::safe_VkCommandBufferInheritanceRenderingInfo inheritance_rendering_info;
+    // Possibly shared with other render passes, the members below are views of it
+    const std::shared_ptr<const RenderPassAnalysis> analysis;
+    const vku::safe_VkRenderPassCreateInfo2 &create_info{analysis->create_info};
+    const SelfDepVec &self_dependencies{analysis->self_dependencies};
+    const DAGNodeVec &subpass_to_node{analysis->subpass_to_node};
+    const FirstReadMap &attachment_first_read{analysis->attachment_first_read};
+    const SubpassVec &attachment_first_subpass{analysis->attachment_first_subpass};
+    const SubpassVec &attachment_last_subpass{analysis->attachment_last_subpass};
+    const FirstIsTransitionVec &attachment_first_is_transition{analysis->attachment_first_is_transition};
+    const SubpassGraphVec &subpass_dependencies{analysis->subpass_dependencies};
+    const TransitionVec &subpass_transitions{analysis->subpass_transitions};
+
+    RenderPass(VkRenderPass handle, std::shared_ptr<const RenderPassAnalysis> &&shared_analysis);
     RenderPass(VkRenderPass handle, VkRenderPassCreateInfo2 const *pCreateInfo);
     RenderPass(VkRenderPass handle, VkRenderPassCreateInfo const *pCreateInfo);
 
@@ -130,6 +196,21 @@ class Framebuffer : public StateObject {
     virtual ~Framebuffer() { Destroy(); }
 
     void Destroy() override;
+    void NotifyInvalidate(const NodeList &invalid_nodes, bool unlink) override;
+
+    // Render passes that were begun with this framebuffer without any error from the checks that only depend on the pair
+    // (attachment usage against the render pass layouts, render pass compatibility). Render pass ids are never reused, so
+    // the entry of a destroyed render pass can not match anymore. Imageless framebuffers take their attachments from
+    // vkCmdBeginRenderPass and are never cached.
+    bool IsRenderPassValidated(StateObject::IdType render_pass_id) const;
+    void SetRenderPassValidated(StateObject::IdType render_pass_id) const;
+
+  private:
+    static constexpr uint32_t kValidatedRenderPassCount = 4;
+    mutable std::mutex validated_render_pass_lock_;
+    mutable std::array<StateObject::IdType, kValidatedRenderPassCount> validated_render_passes_;
+    mutable uint32_t validated_render_pass_count_ = 0;
+    mutable uint32_t validated_render_pass_next_ = 0;
 };
 
 }  // namespace vvl
@@ -31,6 +31,51 @@ void vvl::Semaphore::TimePoint::Notify() const {
     }
 }
 
+vvl::Semaphore::Timeline::const_iterator vvl::Semaphore::Timeline::LowerBound(uint64_t payload) const {
+    return std::lower_bound(begin(), end(), payload,
+                            [](const value_type &point, uint64_t payload) { return point.first < payload; });
+}
+
+vvl::Semaphore::Timeline::const_iterator vvl::Semaphore::Timeline::find(uint64_t payload) const {
+    // Mostly the last enqueued or the oldest payload
+    if (empty() || payload > points_.back().first) {
+        return end();
+    }
+    const auto pos = LowerBound(payload);
+    return (pos != end() && pos->first == payload) ? pos : end();
+}
+
+vvl::Semaphore::Timeline::iterator vvl::Semaphore::Timeline::find(uint64_t payload) {
+    const auto pos = static_cast<const Timeline &>(*this).find(payload);
+    return points_.begin() + (pos - points_.cbegin());
+}
+
+vvl::Semaphore::TimePoint &vvl::Semaphore::Timeline::operator[](uint64_t payload) {
+    if (empty() || payload > points_.back().first) {
+        points_.emplace_back(std::piecewise_construct, std::forward_as_tuple(payload), std::forward_as_tuple());
+        return points_.back().second;
+    }
+    auto pos = points_.begin() + (LowerBound(payload) - points_.cbegin());
+    if (pos->first != payload) {
+        pos = points_.emplace(pos, std::piecewise_construct, std::forward_as_tuple(payload), std::forward_as_tuple());
+    }
+    return pos->second;
+}
+
+void vvl::Semaphore::Timeline::pop_front() {
+    assert(!empty());
+    ++front_;
+    if (front_ == points_.size()) {
+        // Keeps the capacity for the next payloads
+        points_.clear();
+        front_ = 0;
+    } else if (front_ >= 64 && front_ * 2 >= points_.size()) {
+        // Only reached while many payloads are pending, the retired ones are dropped in one go
+        points_.erase(points_.begin(), points_.begin() + front_);
+        front_ = 0;
+    }
+}
+
 vvl::Semaphore::Semaphore(ValidationStateTracker &dev, VkSemaphore handle, const VkSemaphoreTypeCreateInfo *type_create_info,
                           const VkSemaphoreCreateInfo *pCreateInfo)
     : RefcountedStateObject(handle, kVulkanObjectTypeSemaphore),
@@ -231,20 +276,24 @@ void vvl::Semaphore::Retire(vvl::Queue *current_queue, const Location &loc, uint
         for (auto &wait_submit : timepoint.wait_submits) {
             completed_ = SemOp(kWait, wait_submit, payload);
         }
-        timepoint.completed.set_value();
-        timeline_.erase(timeline_.begin());
+        waiters_.Wake(payload);
+        // Waiting queues that could not retire yet (see CanRetire()) are picked up again
+        for (auto &wait_submit : timepoint.wait_submits) {
+            if (wait_submit.queue && wait_submit.queue != current_queue) {
+                wait_submit.queue->Notify(wait_submit.seq);
+            }
+        }
+        timeline_.pop_front();
         if (scope_ == kExternalTemporary) {
             scope_ = kInternal;
             imported_handle_type_.reset();
         }
     } else {
         // Wait for some other queue or a host operation to retire
-        assert(timepoint.waiter.valid());
-        // the current timepoint should get destroyed while we're waiting, so copy out the waiter.
-        auto waiter = timepoint.waiter;
+        WaitList::Waiter waiter(payload);
+        waiters_.Add(waiter);
         guard.unlock();
-        auto result = waiter.wait_until(GetCondWaitTimeout());
-        if (result != std::future_status::ready) {
+        if (!waiter.WaitUntil(GetCondWaitTimeout())) {
             dev_data_.LogError("INTERNAL-ERROR-VkSemaphore-state-timeout", Handle(), loc,
                                "The Validation Layers hit a timeout waiting for timeline semaphore state to update (this is most "
                                "likely a validation bug)."
@@ -252,40 +301,56 @@ void vvl::Semaphore::Retire(vvl::Queue *current_queue, const Location &loc, uint
                                completed_.payload, payload);
         }
         guard.lock();
+        waiters_.Remove(waiter);
     }
 }
 
-std::shared_future<void> vvl::Semaphore::Wait(uint64_t payload) {
-    auto guard = WriteLock();
+bool vvl::Semaphore::CanRetire(vvl::Queue *current_queue, uint64_t payload) {
+    auto guard = ReadLock();
     if (payload <= completed_.payload) {
-        std::promise<void> already_done;
-        auto result = already_done.get_future();
-        already_done.set_value();
-        return result;
+        return true;
     }
-
-    auto it = timeline_.find(payload);
-    if (it == timeline_.end()) {
-        it = timeline_.emplace(payload, TimePoint{}).first;
+    auto pos = timeline_.find(payload);
+    if (pos == timeline_.end()) {
+        return true;
+    }
+    const auto &timepoint = pos->second;
+    // Same cases as the retire_here of Retire()
+    if (timepoint.signal_submit) {
+        if (timepoint.signal_submit->queue == current_queue) {
+            return true;
+        }
+        if (timepoint.signal_submit->queue) {
+            timepoint.signal_submit->queue->Notify(timepoint.signal_submit->seq);
+        }
+        return false;
     }
-    auto &timepoint = it->second;
-    timepoint.wait_submits.emplace_back(SubmissionReference{});
-    return timepoint.waiter;
+    return timepoint.acquire_command || scope_ != kInternal;
 }
 
 void vvl::Semaphore::NotifyAndWait(const Location &loc, uint64_t payload) {
     if (scope_ == kInternal) {
         Notify(payload);
-        auto waiter = Wait(payload);
+        WaitList::Waiter waiter(payload);
+        {
+            auto guard = WriteLock();
+            if (payload <= completed_.payload) {
+                return;
+            }
+            timeline_[payload].wait_submits.emplace_back(SubmissionReference{});
+            waiters_.Add(waiter);
+        }
         dev_data_.BeginBlockingOperation();
-        auto result = waiter.wait_until(GetCondWaitTimeout());
+        const bool woken = waiter.WaitUntil(GetCondWaitTimeout());
         dev_data_.EndBlockingOperation();
-        if (result != std::future_status::ready) {
+        if (!woken) {
             dev_data_.LogError("UNASSIGNED-VkSemaphore-state-timeout", Handle(), loc,
                                "Timeout waiting for timeline semaphore state to update. This is most likely a validation bug."
                                " completed_.payload=%" PRIu64 " wait_payload=%" PRIu64,
                                completed_.payload, payload);
         }
+        auto guard = WriteLock();
+        waiters_.Remove(waiter);
     } else {
         // For external timeline semaphores we should bump the completed payload to whatever the driver
         // tells us. That value may originate from an external process that imported the semaphore and
@@ -19,11 +19,12 @@
 #pragma once
 #include "state_tracker/state_object.h"
 #include "state_tracker/submission_reference.h"
-#include <future>
 #include <map>
 #include <mutex>
+#include <vector>
 #include "containers/custom_containers.h"
 #include "error_message/error_location.h"
+#include "utils/wait_list.h"
 
 class ValidationStateTracker;
 
@@ -61,10 +62,7 @@ class Semaphore : public RefcountedStateObject {
         std::optional<SubmissionReference> signal_submit;
         small_vector<SubmissionReference, 1, uint32_t> wait_submits;
         std::optional<Func> acquire_command;
-        std::promise<void> completed;
-        std::shared_future<void> waiter;
 
-        TimePoint() : completed(), waiter(completed.get_future()) {}
         bool HasSignaler() const { return signal_submit.has_value() || acquire_command.has_value(); }
         bool HasWaiters() const { return !wait_submits.empty(); }
         void Notify() const;
@@ -89,6 +87,9 @@ class Semaphore : public RefcountedStateObject {
 
     // Remove completed operations and signal any waiters. This should only be called by Queue
     void Retire(Queue *current_queue, const Location &loc, uint64_t payload);
+    // True if Retire() of the payload would not have to wait for another queue or for the host. If it would, notifies the
+    // queue that signals it, the waiting queues are notified again once the signal is retired.
+    bool CanRetire(Queue *current_queue, uint64_t payload);
 
     // Look for most recent / highest payload operation that matches
     std::optional<SemOp> LastOp(
@@ -129,7 +130,36 @@ class Semaphore : public RefcountedStateObject {
     // Signal queue(s) that need to retire because a wait on this payload has finished
     void Notify(uint64_t payload);
 
-    std::shared_future<void> Wait(uint64_t payload);
+    // Pending time points ordered by payload. Payloads are almost always enqueued in increasing order and retired from the
+    // front, so they are kept in a vector with a moving front: enqueue and retire are O(1) amortized and reuse the storage,
+    // lookups are a binary search. A payload enqueued out of order is inserted in place.
+    class Timeline {
+      public:
+        using value_type = std::pair<uint64_t, TimePoint>;
+        using iterator = std::vector<value_type>::iterator;
+        using const_iterator = std::vector<value_type>::const_iterator;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        bool empty() const { return front_ == points_.size(); }
+        iterator begin() { return points_.begin() + front_; }
+        iterator end() { return points_.end(); }
+        const_iterator begin() const { return points_.cbegin() + front_; }
+        const_iterator end() const { return points_.cend(); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+        iterator find(uint64_t payload);
+        const_iterator find(uint64_t payload) const;
+        // Time point of the payload, default constructed if there is none yet
+        TimePoint &operator[](uint64_t payload);
+        void pop_front();
+
+      private:
+        const_iterator LowerBound(uint64_t payload) const;
+
+        std::vector<value_type> points_;
+        size_t front_ = 0;
+    };
 
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
@@ -146,7 +176,9 @@ class Semaphore : public RefcountedStateObject {
     // Set of pending operations ordered by payload.
     // Timeline operations can be added in any order and multiple wait operations
     // can use the same payload value.
-    std::map<uint64_t, TimePoint> timeline_;
+    Timeline timeline_;
+    // Host threads and queues waiting for a payload to retire
+    WaitList waiters_;
     mutable std::shared_mutex lock_;
     ValidationStateTracker &dev_data_;
 };
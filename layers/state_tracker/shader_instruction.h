@@ -105,6 +105,64 @@ class Instruction {
 #endif
 };
 
-void GenerateInstructions(const vvl::span<const uint32_t>& spirv, std::vector<spirv::Instruction>& instructions);
+// View of a single SPIR-V instruction in place in the module words, nothing is copied.
+// Only has the accessors that don't need to know the instruction layout, for that use Instruction.
+class RawInstruction {
+  public:
+    explicit RawInstruction(const uint32_t* words) : words_(words) {}
+
+    uint32_t Word(uint32_t index) const { return words_[index]; }
+
+    uint32_t Length() const { return words_[0] >> 16; }
+
+    uint32_t Opcode() const { return words_[0] & 0x0ffffu; }
+
+    char const* GetAsString(uint32_t operand) const {
+        assert(operand < Length());
+        return (char const*)&words_[operand];
+    }
+
+  private:
+    const uint32_t* words_;
+};
+
+// All post SPIR-V processing we do is just needing to inspect single instructions without knowledge of the rest of the module,
+// in a forward pass. It is very wasteful (both time and memory) to create an entire spirv::Module object, or even a vector of
+// Instruction, for this. The instructions are decoded on the fly while iterating.
+class RawInstructionRange {
+  public:
+    class Iterator {
+      public:
+        Iterator(const uint32_t* it, const uint32_t* end) : it_(it), end_(end) {}
+
+        RawInstruction operator*() const { return RawInstruction(it_); }
+
+        Iterator& operator++() {
+            const uint32_t length = RawInstruction(it_).Length();
+            // A malformed length stops the iteration, rather not report the SPIR-V debug info than read out of bounds
+            it_ = (length == 0 || length > static_cast<size_t>(end_ - it_)) ? end_ : it_ + length;
+            return *this;
+        }
+
+        bool operator==(const Iterator& other) const { return it_ == other.it_; }
+        bool operator!=(const Iterator& other) const { return it_ != other.it_; }
+
+      private:
+        const uint32_t* it_;
+        const uint32_t* end_;
+    };
+
+    // The 5 words of the module header are skipped
+    explicit RawInstructionRange(const vvl::span<const uint32_t>& spirv)
+        : begin_(spirv.size() > 5 ? spirv.data() + 5 : nullptr), end_(spirv.size() > 5 ? spirv.data() + spirv.size() : nullptr) {}
+
+    Iterator begin() const { return Iterator(begin_, end_); }
+    Iterator end() const { return Iterator(end_, end_); }
+    bool empty() const { return begin_ == end_; }
+
+  private:
+    const uint32_t* begin_;
+    const uint32_t* end_;
+};
 
 }  // namespace spirv
\ No newline at end of file
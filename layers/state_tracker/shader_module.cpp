@@ -18,6 +18,7 @@
 #include <sstream>
 #include <string>
 #include <queue>
+#include <algorithm>
 
 #include "state_tracker/pipeline_state.h"
 #include "state_tracker/descriptor_sets.h"
@@ -792,9 +793,17 @@ std::optional<VkPrimitiveTopology> Module::GetTopology(const EntryPoint& entrypo
     return result;
 }
 
-Module::StaticData::StaticData(const Module& module_state, StatelessData* stateless_data) {
+void Module::StaticData::Parse(const Module& module_state, StatelessData* stateless_data) {
     // Parse the words first so we have instruction class objects to use
     {
+        // Count the instructions first so they are all placed in a single allocation that is never grown or copied
+        size_t instruction_count = 0;
+        for (size_t offset = 5; offset < module_state.words_.size(); ++instruction_count) {
+            const uint32_t length = module_state.words_[offset] >> 16;
+            offset += std::max(length, 1u);
+        }
+        instructions.reserve(instruction_count);
+
         std::vector<uint32_t>::const_iterator it = module_state.words_.cbegin();
         it += 5;  // skip first 5 word of header
         while (it != module_state.words_.cend()) {
@@ -813,9 +822,26 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
             instructions.emplace_back(insn);
             it += insn.Length();
         }
-        instructions.shrink_to_fit();
     }
 
+    // Every <id> is below the bound in the header, so the id tables can be allocated once. The bound is not validated yet,
+    // so it is capped by the module size and the tables still grow if an id is out of it.
+    const uint32_t id_bound = module_state.words_.size() > 3
+                                  ? static_cast<uint32_t>(std::min<size_t>(module_state.words_[3], module_state.words_.size()))
+                                  : 0;
+    definitions.resize(id_bound, nullptr);
+    decoration_index.resize(id_bound, 0);
+    auto get_decoration_set = [this](uint32_t id) -> DecorationSet& {
+        if (id >= decoration_index.size()) {
+            decoration_index.resize(id + 1, 0);
+        }
+        if (decoration_index[id] == 0) {
+            decoration_sets.emplace_back();
+            decoration_index[id] = static_cast<uint32_t>(decoration_sets.size());
+        }
+        return decoration_sets[decoration_index[id] - 1];
+    };
+
     // These have their own object class, but need entire module parsed first
     std::vector<const Instruction*> entry_point_instructions;
     std::vector<const Instruction*> type_struct_instructions;
@@ -834,6 +860,9 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
         // Build definition list
         const uint32_t result_id = insn.ResultId();
         if (result_id != 0) {
+            if (result_id >= definitions.size()) {
+                definitions.resize(result_id + 1, nullptr);
+            }
             definitions[result_id] = &insn;
         }
 
@@ -851,7 +880,7 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
             // Decorations
             case spv::OpDecorate: {
                 const uint32_t target_id = insn.Word(1);
-                decorations[target_id].Add(insn.Word(2), insn.Length() > 3u ? insn.Word(3) : 0u);
+                get_decoration_set(target_id).Add(insn.Word(2), insn.Length() > 3u ? insn.Word(3) : 0u);
                 decoration_inst.push_back(&insn);
                 if (insn.Word(2) == spv::DecorationBuiltIn) {
                     builtin_decoration_inst.push_back(&insn);
@@ -862,7 +891,8 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
             case spv::OpMemberDecorate: {
                 const uint32_t target_id = insn.Word(1);
                 const uint32_t member_index = insn.Word(2);
-                decorations[target_id].member_decorations[member_index].Add(insn.Word(3), insn.Length() > 4u ? insn.Word(4) : 0u);
+                DecorationSet& decoration_set = get_decoration_set(target_id);
+                decoration_set.member_decorations[member_index].Add(insn.Word(3), insn.Length() > 4u ? insn.Word(4) : 0u);
                 member_decoration_inst.push_back(&insn);
                 if (insn.Word(3) == spv::DecorationBuiltIn) {
                     builtin_decoration_inst.push_back(&insn);
@@ -1112,6 +1142,10 @@ Module::StaticData::StaticData(const Module& module_state, StatelessData* statel
     for (const auto& insn : entry_point_instructions) {
         entry_points.emplace_back(std::make_shared<EntryPoint>(module_state, *insn, image_access_map, access_chain_map));
     }
+
+    tracked_bytes = instructions.capacity() * sizeof(Instruction) + definitions.capacity() * sizeof(const Instruction*) +
+                    decoration_index.capacity() * sizeof(uint32_t) + decoration_sets.capacity() * sizeof(DecorationSet);
+    vvl::TrackAllocation(tracked_bytes, vvl::AllocationSubsystem::ShaderModules);
 }
 
 std::string Module::GetDecorations(uint32_t id) const {
@@ -1251,7 +1285,22 @@ std::string Module::DescribeVariable(uint32_t id) const {
     return ss.str();
 }
 
+void Module::EnsureParsed() const {
+    if (shared_data_->parse_deferred) {
+        std::call_once(shared_data_->parse_once, [this]() { static_data_.Parse(*this, &shared_data_->stateless_data); });
+    }
+}
+
+const StatelessData* Module::TakeDeferredStatelessData() const {
+    if (!shared_data_->parse_deferred || shared_data_->deferred_stateless_data_taken.exchange(true)) {
+        return nullptr;
+    }
+    EnsureParsed();
+    return &shared_data_->stateless_data;
+}
+
 std::shared_ptr<const EntryPoint> Module::FindEntrypoint(char const* name, VkShaderStageFlagBits stageBits) const {
+    EnsureParsed();
     for (const auto& entry_point : static_data_.entry_points) {
         if (entry_point->name.compare(name) == 0 && entry_point->stage == stageBits) {
             return entry_point;
@@ -17,9 +17,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include "state_tracker/shader_instruction.h"
@@ -471,6 +474,10 @@ struct EntryPoint {
     bool has_passthrough{false};
     bool has_alpha_to_coverage_variable{false};  // only for Fragment shaders
 
+    // Set once the checks of the stage that depend on nothing but the entry point and the device passed without errors,
+    // later pipelines and shader objects using the entry point skip them (see CoreChecks::ValidateShaderStageStatic)
+    mutable std::atomic<bool> static_stage_checks_passed{false};
+
     EntryPoint(const Module &module_state, const Instruction &entrypoint_insn, const ImageAccessMap &image_access_map,
                const AccessChainVariableMap &access_chain_map);
 
@@ -508,18 +515,31 @@ struct Module {
     // The goal of this struct is to move everything that is ready only into here
     struct StaticData {
         StaticData() = default;
-        StaticData(const Module &module_state, StatelessData *stateless_data = nullptr);
-        StaticData &operator=(StaticData &&) = default;
-        StaticData(StaticData &&) = default;
+        StaticData(const StaticData &) = delete;
+        StaticData &operator=(const StaticData &) = delete;
+        ~StaticData() {
+            if (tracked_bytes != 0) {
+                vvl::UntrackAllocation(tracked_bytes, vvl::AllocationSubsystem::ShaderModules);
+            }
+        }
+        // Builds the data in place, as the parse already uses the Module accessors for the parts it has filled
+        void Parse(const Module &module_state, StatelessData *stateless_data);
+
+        // Heap memory of the instruction tables, counted in the ShaderModules statistics of the layer allocator once parsed
+        size_t tracked_bytes = 0;
 
         // List of all instructions in the order they appear in the binary
         std::vector<Instruction> instructions;
         // Instructions that can be referenced by Ids
         // A mapping of <id> to the first word of its def. this is useful because walking type
         // trees, constant expressions, etc requires jumping all over the instruction stream.
-        vvl::unordered_map<uint32_t, const Instruction *> definitions;
+        // Indexed by <id> and sized from the header bound, ids without a definition are null.
+        std::vector<const Instruction *> definitions;
 
-        vvl::unordered_map<uint32_t, DecorationSet> decorations;
+        // Indexed by <id>, holds the index + 1 of its set in decoration_sets (0 when the id has no decorations).
+        // Only a small part of the ids are decorated, so the sets themselves are kept packed.
+        std::vector<uint32_t> decoration_index;
+        std::vector<DecorationSet> decoration_sets;
         DecorationSet empty_decoration;  // all zero values, allows use to return a reference and not a copy each time
 
         // Execution Modes are tied to a Function <id>, multiple EntryPoints can point to the same Funciton <id>
@@ -583,26 +603,72 @@ struct Module {
         vvl::unordered_map<uint32_t, std::vector<uint32_t>> func_parameter_map;
     };
 
+    // The words of a SPIR-V binary and their parse. Modules created from identical binaries share it, so the parse and
+    // its validation are done once while each Module keeps its own handle for the error messages.
+    struct SharedData {
+        SharedData(const uint32_t *pCode, size_t word_count, bool parse_deferred)
+            : words(pCode, pCode + word_count), parse_deferred(parse_deferred) {
+            vvl::TrackAllocation(words.capacity() * sizeof(uint32_t), vvl::AllocationSubsystem::ShaderModules);
+        }
+        ~SharedData() { vvl::UntrackAllocation(words.capacity() * sizeof(uint32_t), vvl::AllocationSubsystem::ShaderModules); }
+
+        const std::vector<uint32_t> words;
+        // Only written by Parse, which for a deferred module runs once in EnsureParsed
+        StaticData static_data;
+        // Filled by the parse of a module created with StatelessData
+        StatelessData stateless_data;
+
+        const bool parse_deferred;
+        std::once_flag parse_once;
+        std::atomic<bool> deferred_stateless_data_taken{false};
+        // Set once the stateless checks passed without errors, later modules of the same binary skip them
+        std::atomic<bool> stateless_checks_passed{false};
+    };
+    const std::shared_ptr<SharedData> shared_data_;
+
     // This is the SPIR-V module data content
-    const std::vector<uint32_t> words_;
+    const std::vector<uint32_t> &words_;
 
-    const StaticData static_data_;
+    StaticData &static_data_;
 
     // Hold a handle so error message can know where the SPIR-V was from (VkShaderModule or VkShaderEXT)
     VulkanTypedHandle handle_;                            // Will be updated once its known its valid SPIR-V
     VulkanTypedHandle handle() const { return handle_; }  // matches normal convention to get handle
 
     // Used for when modifying the SPIR-V (spirv-opt, GPU-AV instrumentation, etc) and need reparse it for VVL validaiton
-    Module(vvl::span<const uint32_t> code) : words_(code.begin(), code.end()), static_data_(*this) {}
+    Module(vvl::span<const uint32_t> code) : Module(code.size() * sizeof(uint32_t), code.data()) {}
 
     // StatelessData is a pointer as we have cases were we don't need it and simpler to just null check the few cases that use it
     Module(size_t codeSize, const uint32_t *pCode, StatelessData *stateless_data = nullptr)
-        : words_(pCode, pCode + codeSize / sizeof(uint32_t)), static_data_(*this, stateless_data) {}
+        : shared_data_(std::make_shared<SharedData>(pCode, codeSize / sizeof(uint32_t), false)),
+          words_(shared_data_->words),
+          static_data_(shared_data_->static_data) {
+        static_data_.Parse(*this, stateless_data ? &shared_data_->stateless_data : nullptr);
+        if (stateless_data) {
+            *stateless_data = shared_data_->stateless_data;
+        }
+    }
+
+    // Only copies the words, StaticData is parsed by the first EnsureParsed call. Used for modules that are created long
+    // before a pipeline uses them, the module must not have group decorations as they need to be flattened first.
+    struct DeferParse {};
+    Module(size_t codeSize, const uint32_t *pCode, DeferParse)
+        : shared_data_(std::make_shared<SharedData>(pCode, codeSize / sizeof(uint32_t), true)),
+          words_(shared_data_->words),
+          static_data_(shared_data_->static_data) {}
+
+    // New module of a binary that was already parsed (or deferred) for another module
+    explicit Module(std::shared_ptr<SharedData> shared_data)
+        : shared_data_(std::move(shared_data)), words_(shared_data_->words), static_data_(shared_data_->static_data) {}
+
+    bool IsParseDeferred() const { return shared_data_->parse_deferred; }
+    // Parses a deferred module, FindEntrypoint calls it as every pipeline and shader looks up its entrypoint first
+    void EnsureParsed() const;
+    // The stateless checks of a deferred module are done by the first pipeline using it, only the first caller gets the data
+    const StatelessData *TakeDeferredStatelessData() const;
 
     const Instruction *FindDef(uint32_t id) const {
-        auto it = static_data_.definitions.find(id);
-        if (it == static_data_.definitions.end()) return nullptr;
-        return it->second;
+        return id < static_data_.definitions.size() ? static_data_.definitions[id] : nullptr;
     }
 
     const std::vector<Instruction> &GetInstructions() const { return static_data_.instructions; }
@@ -612,8 +678,8 @@ struct Module {
 
     const DecorationSet &GetDecorationSet(uint32_t id) const {
         // return the actual decorations for this id, or a default empty set.
-        const auto it = static_data_.decorations.find(id);
-        return (it != static_data_.decorations.end()) ? it->second : static_data_.empty_decoration;
+        const uint32_t index = id < static_data_.decoration_index.size() ? static_data_.decoration_index[id] : 0;
+        return index != 0 ? static_data_.decoration_sets[index - 1] : static_data_.empty_decoration;
     }
 
     const ExecutionModeSet &GetExecutionModeSet(uint32_t function_id) const {
@@ -17,40 +17,112 @@
  * limitations under the License.
  */
 #include "state_tracker/state_object.h"
+#include "containers/node_pool_allocator.h"
 
-vvl::StateObject::~StateObject() { Destroy(); }
+std::atomic<uint64_t> vvl::StateObject::invalidate_generation_{0};
+
+vvl::StateObject::~StateObject() {
+    Destroy();
+    // Links queued after the last Invalidate()
+    for (PendingParent *pending = pending_parents_.load(std::memory_order_acquire); pending;) {
+        PendingParent *next = pending->next;
+        DeletePendingParent(pending);
+        pending = next;
+    }
+}
 
 void vvl::StateObject::Destroy() {
     Invalidate();
     destroyed_ = true;
 }
 
+vvl::StateObject::PendingParent* vvl::StateObject::NewPendingParent(const VulkanTypedHandle& handle,
+                                                                    std::weak_ptr<StateObject>&& node, bool add) {
+    void* storage = NodePoolAllocator<PendingParent>().allocate(1);
+    return new (storage) PendingParent{handle, std::move(node), add, nullptr};
+}
+
+void vvl::StateObject::DeletePendingParent(PendingParent* pending) {
+    pending->~PendingParent();
+    NodePoolAllocator<PendingParent>().deallocate(pending, 1);
+}
+
+void vvl::StateObject::PushPendingParent(PendingParent* pending) {
+    pending->next = pending_parents_.load(std::memory_order_relaxed);
+    while (!pending_parents_.compare_exchange_weak(pending->next, pending, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+    // Compact from time to time, so objects that are linked often but rarely read do not accumulate queued calls.
+    // Only if nobody else holds the lock, writers never wait.
+    if (pending_parent_count_.fetch_add(1, std::memory_order_relaxed) + 1 >= kMaxPendingParents && tree_lock_.try_lock()) {
+        ApplyPendingParents();
+        tree_lock_.unlock();
+    }
+}
+
+void vvl::StateObject::ApplyPendingParents() const {
+    PendingParent* pending = pending_parents_.exchange(nullptr, std::memory_order_acquire);
+    // Reverse to apply the calls in the order they were pushed
+    PendingParent* oldest = nullptr;
+    uint32_t count = 0;
+    while (pending) {
+        PendingParent* next = pending->next;
+        pending->next = oldest;
+        oldest = pending;
+        pending = next;
+        ++count;
+    }
+    pending_parent_count_.fetch_sub(count, std::memory_order_relaxed);
+    while (oldest) {
+        PendingParent* next = oldest->next;
+        if (oldest->add) {
+            parent_nodes_.emplace(oldest->handle, std::move(oldest->node));
+        } else {
+            parent_nodes_.erase(oldest->handle);
+        }
+        DeletePendingParent(oldest);
+        oldest = next;
+    }
+}
+
+template <typename Fn>
+void vvl::StateObject::ReadParents(Fn&& fn) const {
+    if (pending_parents_.load(std::memory_order_acquire)) {
+        WriteLockGuard guard(tree_lock_);
+        ApplyPendingParents();
+        fn(parent_nodes_);
+    } else {
+        ReadLockGuard guard(tree_lock_);
+        fn(parent_nodes_);
+    }
+}
+
 const VulkanTypedHandle* vvl::StateObject::InUse() const {
     // NOTE: for performance reasons, this method calls up the tree
     // with the read lock held.
-    auto guard = ReadLockTree();
-    for (auto& item : parent_nodes_) {
-        auto node = item.second.lock();
-        if (!node) {
-            continue;
-        }
-        if (node->InUse()) {
-            return &node->Handle();
+    const VulkanTypedHandle* result = nullptr;
+    ReadParents([&result](const NodeMap& parents) {
+        for (auto& item : parents) {
+            auto node = item.second.lock();
+            if (!node) {
+                continue;
+            }
+            if (node->InUse()) {
+                result = &node->Handle();
+                return;
+            }
         }
-    }
-    return nullptr;
+    });
+    return result;
 }
 
 bool vvl::StateObject::AddParent(StateObject* parent_node) {
-    auto guard = WriteLockTree();
-    auto result = parent_nodes_.emplace(parent_node->Handle(), std::weak_ptr<StateObject>(parent_node->shared_from_this()));
-    return result.second;
+    PushPendingParent(NewPendingParent(parent_node->Handle(), parent_node->shared_from_this(), true));
+    return true;
 }
 
 void vvl::StateObject::RemoveParent(StateObject* parent_node) {
     assert(parent_node);
-    auto guard = WriteLockTree();
-    parent_nodes_.erase(parent_node->Handle());
+    PushPendingParent(NewPendingParent(parent_node->Handle(), std::weak_ptr<StateObject>(), false));
 }
 
 // copy the current set of parents so that we don't need to hold the lock
@@ -58,22 +130,24 @@ void vvl::StateObject::RemoveParent(StateObject* parent_node) {
 vvl::StateObject::NodeMap vvl::StateObject::GetParentsForInvalidate(bool unlink) {
     NodeMap result;
     if (unlink) {
-        auto guard = WriteLockTree();
+        WriteLockGuard guard(tree_lock_);
+        ApplyPendingParents();
         result = std::move(parent_nodes_);
         parent_nodes_.clear();
     } else {
-        auto guard = ReadLockTree();
-        result = parent_nodes_;
+        ReadParents([&result](const NodeMap& parents) { result = parents; });
     }
     return result;
 }
 
 vvl::StateObject::NodeMap vvl::StateObject::ObjectBindings() const {
-    auto guard = ReadLockTree();
-    return parent_nodes_;
+    NodeMap result;
+    ReadParents([&result](const NodeMap& parents) { result = parents; });
+    return result;
 }
 
 void vvl::StateObject::Invalidate(bool unlink) {
+    invalidate_generation_.fetch_add(1, std::memory_order_acq_rel);
     NodeList empty;
     // We do not want to call the virtual method here because any special handling
     // in an overriden NotifyInvalidate() is for when a child node has become invalid.
@@ -83,6 +157,8 @@ void vvl::StateObject::Invalidate(bool unlink) {
 }
 
 void vvl::StateObject::NotifyInvalidate(const NodeList& invalid_nodes, bool unlink) {
+    // At least the generation of the Invalidate() call that got here
+    invalidated_generation_.store(invalidate_generation_.load(std::memory_order_acquire), std::memory_order_release);
     auto current_parents = GetParentsForInvalidate(unlink);
     if (current_parents.empty()) {
         return;
@@ -92,7 +168,7 @@ void vvl::StateObject::NotifyInvalidate(const NodeList& invalid_nodes, bool unli
     up_nodes.emplace_back(shared_from_this());
     for (auto& item : current_parents) {
         auto node = item.second.lock();
-        if (node && !node->Destroyed()) {
+        if (node && !node->Destroyed() && !node->DefersInvalidate(up_nodes)) {
             node->NotifyInvalidate(up_nodes, unlink);
         }
     }
@@ -36,9 +36,16 @@ struct hash<VulkanTypedHandle> {
 }  // namespace std
 
 namespace vvl {
+
+// std::make_shared<> for state objects, they come from the layer allocator and are counted in its StateTracker statistics
+template <typename T, typename... Args>
+std::shared_ptr<T> MakeState(Args &&...args) {
+    return AllocateShared<T, AllocationSubsystem::StateTracker>(std::forward<Args>(args)...);
+}
+
 // inheriting from enable_shared_from_this<> adds a method, shared_from_this(), which
 // returns a shared_ptr version of the current object. It requires the object to
-// be created with std::make_shared<> and it MUST NOT be used from the constructor
+// be created with std::make_shared<> or MakeState<> and it MUST NOT be used from the constructor
 class StateObject: public std::enable_shared_from_this<StateObject>, public TypedHandleWrapper {
   public:
     // Parent nodes are stored as weak_ptrs to avoid cyclic memory dependencies.
@@ -86,6 +93,10 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
 
     virtual const VulkanTypedHandle* InUse() const;
 
+    // Neither takes the tree lock, so many threads can link the same popular child (ex. an image view used by thousands of
+    // descriptor sets) without waiting for each other. The calls are queued with a lock-free push and applied in order
+    // by the next thread that reads the parents, or by the writer that finds kMaxPendingParents queued.
+    // AddParent() cannot tell if the link already existed, it returns true unless the parent cannot be added at all.
     virtual bool AddParent(StateObject *parent_node);
     virtual void RemoveParent(StateObject *parent_node);
 
@@ -96,6 +107,12 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
     // Helper to let objects examine their immediate parents without holding the tree lock.
     NodeMap ObjectBindings() const;
 
+    // Invalidate() calls of all the objects so far. The parents that defer their notifications compare it with
+    // InvalidatedGeneration() of their children to find the invalid ones.
+    static uint64_t CurrentInvalidateGeneration() { return invalidate_generation_.load(std::memory_order_acquire); }
+    // Value of CurrentInvalidateGeneration() when this object was last invalidated, directly or through a child, 0 if never
+    uint64_t InvalidatedGeneration() const { return invalidated_generation_.load(std::memory_order_acquire); }
+
   protected:
     template <typename Derived, typename Shared = std::shared_ptr<Derived>>
     static Shared SharedFromThisImpl(Derived *derived) {
@@ -107,6 +124,11 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
     // Called recursively for every parent object of something that has become invalid
     virtual void NotifyInvalidate(const NodeList &invalid_nodes, bool unlink);
 
+    // Parents returning true are skipped by the NotifyInvalidate() calls of their invalid children and must look for them
+    // with InvalidatedGeneration() instead. It lets an object used by thousands of recorded command buffers be destroyed
+    // without taking the lock of each of them.
+    virtual bool DefersInvalidate(const NodeList &invalid_nodes) const { return false; }
+
     // returns a copy of the current set of parents so that they can be walked
     // without the tree lock held. If unlink == true, parent_nodes_ is also cleared.
     NodeMap GetParentsForInvalidate(bool unlink);
@@ -116,14 +138,37 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
     std::atomic<bool> destroyed_;
     IdType id_;
   private:
-    ReadLockGuard ReadLockTree() const { return ReadLockGuard(tree_lock_); }
-    WriteLockGuard WriteLockTree() { return WriteLockGuard(tree_lock_); }
+    static constexpr uint32_t kMaxPendingParents = 64;
+
+    // A queued AddParent or RemoveParent call
+    struct PendingParent {
+        VulkanTypedHandle handle;
+        std::weak_ptr<StateObject> node;
+        bool add;
+        PendingParent *next;
+    };
+
+    // Nodes come from a NodePool since AddParent() is on the bind hot path
+    static PendingParent *NewPendingParent(const VulkanTypedHandle &handle, std::weak_ptr<StateObject> &&node, bool add);
+    static void DeletePendingParent(PendingParent *pending);
+    void PushPendingParent(PendingParent *pending);
+    // NOTE: tree_lock_ must be held for writing
+    void ApplyPendingParents() const;
+    // Calls fn with parent_nodes_ up to date and tree_lock_ held
+    template <typename Fn>
+    void ReadParents(Fn &&fn) const;
 
     // Set of immediate parent nodes for this object. For an in-use object, the
     // parent nodes should form a tree with the root being a command buffer.
-    NodeMap parent_nodes_;
+    mutable NodeMap parent_nodes_;
+    // AddParent/RemoveParent calls not applied to parent_nodes_ yet, newest first
+    mutable std::atomic<PendingParent *> pending_parents_{nullptr};
+    mutable std::atomic<uint32_t> pending_parent_count_{0};
     // Lock guarding parent_nodes_, this lock MUST NOT be used for other purposes.
     mutable std::shared_mutex tree_lock_;
+
+    static std::atomic<uint64_t> invalidate_generation_;
+    std::atomic<uint64_t> invalidated_generation_{0};
 };
 
 class RefcountedStateObject : public StateObject {
@@ -30,6 +30,7 @@
 #include "generated/state_tracker_helper.h"
 #include "state_tracker/state_tracker.h"
 #include "utils/shader_utils.h"
+#include "utils/convert_utils.h"
 #include "sync/sync_utils.h"
 #include "state_tracker/image_state.h"
 #include "state_tracker/buffer_state.h"
@@ -144,12 +145,17 @@ VkFormatFeatureFlags2KHR ValidationStateTracker::GetExternalFormatFeaturesANDROI
 
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 
-VkFormatFeatureFlags2KHR GetImageFormatFeatures(VkPhysicalDevice physical_device, bool has_format_feature2, bool has_drm_modifiers,
-                                                VkDevice device, VkImage image, VkFormat format, VkImageTiling tiling) {
-    VkFormatFeatureFlags2KHR format_features = 0;
+const ValidationStateTracker::FormatFeatures &ValidationStateTracker::GetFormatFeatures(VkFormat format) const {
+    {
+        ReadLockGuard guard(format_features_cache_lock_);
+        auto it = format_features_cache_.find(format);
+        if (it != format_features_cache_.end()) {
+            return it->second;
+        }
+    }
 
-    // Add feature support according to Image Format Features (vkspec.html#resources-image-format-features)
-    // if format is AHB external format then the features are already set
+    FormatFeatures features;
+    const bool has_drm_modifiers = IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier);
     if (has_format_feature2) {
         VkDrmFormatModifierPropertiesList2EXT fmt_drm_props = vku::InitStructHelper();
         auto fmt_props_3 = vku::InitStruct<VkFormatProperties3KHR>(has_drm_modifiers ? &fmt_drm_props : nullptr);
@@ -157,71 +163,80 @@ VkFormatFeatureFlags2KHR GetImageFormatFeatures(VkPhysicalDevice physical_device
 
         DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
 
-        fmt_props_3.linearTilingFeatures |= fmt_props_2.formatProperties.linearTilingFeatures;
-        fmt_props_3.optimalTilingFeatures |= fmt_props_2.formatProperties.optimalTilingFeatures;
-        fmt_props_3.bufferFeatures |= fmt_props_2.formatProperties.bufferFeatures;
-
-        if (tiling == VK_IMAGE_TILING_DRM_FORMAT_MODIFIER_EXT) {
-            VkImageDrmFormatModifierPropertiesEXT drm_format_props = vku::InitStructHelper();
-
-            // Find the image modifier
-            DispatchGetImageDrmFormatModifierPropertiesEXT(device, image, &drm_format_props);
-
-            std::vector<VkDrmFormatModifierProperties2EXT> drm_mod_props;
-            drm_mod_props.resize(fmt_drm_props.drmFormatModifierCount);
-            fmt_drm_props.pDrmFormatModifierProperties = &drm_mod_props[0];
+        features.linear_tiling = fmt_props_3.linearTilingFeatures | fmt_props_2.formatProperties.linearTilingFeatures;
+        features.optimal_tiling = fmt_props_3.optimalTilingFeatures | fmt_props_2.formatProperties.optimalTilingFeatures;
+        features.buffer = fmt_props_3.bufferFeatures | fmt_props_2.formatProperties.bufferFeatures;
 
+        if (has_drm_modifiers && fmt_drm_props.drmFormatModifierCount > 0) {
+            std::vector<VkDrmFormatModifierProperties2EXT> drm_properties(fmt_drm_props.drmFormatModifierCount);
+            fmt_drm_props.pDrmFormatModifierProperties = drm_properties.data();
             // Second query to have all the modifiers filled
             DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
 
-            // Look for the image modifier in the list
             for (uint32_t i = 0; i < fmt_drm_props.drmFormatModifierCount; i++) {
-                if (fmt_drm_props.pDrmFormatModifierProperties[i].drmFormatModifier == drm_format_props.drmFormatModifier) {
-                    format_features = fmt_drm_props.pDrmFormatModifierProperties[i].drmFormatModifierTilingFeatures;
-                    break;
-                }
-            }
-        } else {
-            format_features =
-                (tiling == VK_IMAGE_TILING_LINEAR) ? fmt_props_3.linearTilingFeatures : fmt_props_3.optimalTilingFeatures;
-        }
-    } else if (tiling == VK_IMAGE_TILING_DRM_FORMAT_MODIFIER_EXT) {
-        VkImageDrmFormatModifierPropertiesEXT drm_format_properties = vku::InitStructHelper();
-        DispatchGetImageDrmFormatModifierPropertiesEXT(device, image, &drm_format_properties);
-
-        VkFormatProperties2 format_properties_2 = vku::InitStructHelper();
-        VkDrmFormatModifierPropertiesListEXT drm_properties_list = vku::InitStructHelper();
-        format_properties_2.pNext = (void *)&drm_properties_list;
-        DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &format_properties_2);
-        std::vector<VkDrmFormatModifierPropertiesEXT> drm_properties;
-        drm_properties.resize(drm_properties_list.drmFormatModifierCount);
-        drm_properties_list.pDrmFormatModifierProperties = &drm_properties[0];
-        DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &format_properties_2);
-
-        for (uint32_t i = 0; i < drm_properties_list.drmFormatModifierCount; i++) {
-            if (drm_properties_list.pDrmFormatModifierProperties[i].drmFormatModifier == drm_format_properties.drmFormatModifier) {
-                format_features = drm_properties_list.pDrmFormatModifierProperties[i].drmFormatModifierTilingFeatures;
-                break;
+                features.drm_format_modifiers.emplace_back(drm_properties[i].drmFormatModifier,
+                                                           drm_properties[i].drmFormatModifierTilingFeatures);
             }
         }
     } else {
         VkFormatProperties format_properties;
         DispatchGetPhysicalDeviceFormatProperties(physical_device, format, &format_properties);
-        format_features =
-            (tiling == VK_IMAGE_TILING_LINEAR) ? format_properties.linearTilingFeatures : format_properties.optimalTilingFeatures;
+        features.linear_tiling = format_properties.linearTilingFeatures;
+        features.optimal_tiling = format_properties.optimalTilingFeatures;
+        features.buffer = format_properties.bufferFeatures;
+
+        if (has_drm_modifiers) {
+            VkDrmFormatModifierPropertiesListEXT fmt_drm_props = vku::InitStructHelper();
+            VkFormatProperties2 fmt_props_2 = vku::InitStructHelper(&fmt_drm_props);
+            DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
+
+            std::vector<VkDrmFormatModifierPropertiesEXT> drm_properties(fmt_drm_props.drmFormatModifierCount);
+            fmt_drm_props.pDrmFormatModifierProperties = drm_properties.data();
+            DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
+
+            for (uint32_t i = 0; i < fmt_drm_props.drmFormatModifierCount; i++) {
+                features.drm_format_modifiers.emplace_back(drm_properties[i].drmFormatModifier,
+                                                           drm_properties[i].drmFormatModifierTilingFeatures);
+            }
+        }
     }
-    return format_features;
+
+    // Another thread may have queried the same format meanwhile, the properties it found are the same
+    WriteLockGuard guard(format_features_cache_lock_);
+    return format_features_cache_.emplace(format, std::move(features)).first->second;
+}
+
+VkFormatFeatureFlags2KHR ValidationStateTracker::GetImageFormatFeatures(VkImage image, VkFormat format,
+                                                                        VkImageTiling tiling) const {
+    // Add feature support according to Image Format Features (vkspec.html#resources-image-format-features)
+    // if format is AHB external format then the features are already set
+    const FormatFeatures &features = GetFormatFeatures(format);
+    if (tiling == VK_IMAGE_TILING_DRM_FORMAT_MODIFIER_EXT) {
+        VkImageDrmFormatModifierPropertiesEXT drm_format_props = vku::InitStructHelper();
+
+        // Find the image modifier
+        DispatchGetImageDrmFormatModifierPropertiesEXT(device, image, &drm_format_props);
+
+        // Look for the image modifier in the list
+        for (const auto &[drm_format_modifier, tiling_features] : features.drm_format_modifiers) {
+            if (drm_format_modifier == drm_format_props.drmFormatModifier) {
+                return tiling_features;
+            }
+        }
+        return 0;
+    }
+    return (tiling == VK_IMAGE_TILING_LINEAR) ? features.linear_tiling : features.optimal_tiling;
 }
 
 std::shared_ptr<vvl::Image> ValidationStateTracker::CreateImageState(VkImage handle, const VkImageCreateInfo *pCreateInfo,
                                                                      VkFormatFeatureFlags2KHR features) {
-    return std::make_shared<vvl::Image>(*this, handle, pCreateInfo, features);
+    return vvl::MakeState<vvl::Image>(*this, handle, pCreateInfo, features);
 }
 
 std::shared_ptr<vvl::Image> ValidationStateTracker::CreateImageState(VkImage handle, const VkImageCreateInfo *pCreateInfo,
                                                                      VkSwapchainKHR swapchain, uint32_t swapchain_index,
                                                                      VkFormatFeatureFlags2KHR features) {
-    return std::make_shared<vvl::Image>(*this, handle, pCreateInfo, swapchain, swapchain_index, features);
+    return vvl::MakeState<vvl::Image>(*this, handle, pCreateInfo, swapchain, swapchain_index, features);
 }
 
 void ValidationStateTracker::PostCallRecordCreateImage(VkDevice device, const VkImageCreateInfo *pCreateInfo,
@@ -233,9 +248,7 @@ void ValidationStateTracker::PostCallRecordCreateImage(VkDevice device, const Vk
         format_features = GetExternalFormatFeaturesANDROID(pCreateInfo->pNext);
     }
     if (format_features == 0) {
-        format_features = GetImageFormatFeatures(physical_device, has_format_feature2,
-                                                 IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier), device, *pImage,
-                                                 pCreateInfo->format, pCreateInfo->tiling);
+        format_features = GetImageFormatFeatures(*pImage, pCreateInfo->format, pCreateInfo->tiling);
     }
     Add(CreateImageState(*pImage, pCreateInfo, format_features));
 }
@@ -352,6 +365,7 @@ struct BufferAddressInfillUpdateOps {
     using Range = typename Map::key_type;
     void infill(Map &map, const Iterator &pos, const Range &infill_range) const {
         map.insert(pos, Value(infill_range, insert_value));
+        changed = true;
     }
     void update(const Iterator &pos) const {
         auto &current_buffer_list = pos->second;
@@ -362,13 +376,44 @@ struct BufferAddressInfillUpdateOps {
                 current_buffer_list.reserve(current_buffer_list.capacity() * 2);
             }
             current_buffer_list.emplace_back(insert_value[0]);
+            changed = true;
         }
     }
     const Mapped &insert_value;
+    mutable bool changed = false;
 };
 
+void ValidationStateTracker::PublishBufferAddressSnapshot() {
+    auto snapshot = std::make_shared<BufferAddressSnapshot>();
+    // Every snapshot has other ranges or buffers than the previous one, including the ones published when a buffer is destroyed
+    snapshot->version = ++buffer_device_address_ranges_version;
+    snapshot->entries.reserve(buffer_address_map_.size());
+
+    // Both are sorted by address, the buffer lists of the ranges that did not change are shared with the previous snapshot
+    static const std::vector<BufferAddressSnapshot::Entry> no_entries;
+    const auto &previous_entries = buffer_address_snapshot_ ? buffer_address_snapshot_->entries : no_entries;
+    auto previous_it = previous_entries.begin();
+    for (const auto &[address_range, buffers] : buffer_address_map_) {
+        while (previous_it != previous_entries.end() && previous_it->range.begin < address_range.begin) {
+            ++previous_it;
+        }
+        if (previous_it != previous_entries.end() && previous_it->range == address_range && *previous_it->buffers == buffers) {
+            snapshot->entries.emplace_back(*previous_it);
+        } else {
+            snapshot->entries.push_back({address_range, std::make_shared<BufferAddressMapStore>(buffers)});
+        }
+    }
+
+    buffer_address_snapshot_ptr_.store(snapshot.get(), std::memory_order_release);
+    if (buffer_address_snapshot_) {
+        // Lookups that already loaded the previous snapshot can still be searching it
+        retired_states_.Retire(std::move(buffer_address_snapshot_));
+    }
+    buffer_address_snapshot_ = std::move(snapshot);
+}
+
 std::shared_ptr<vvl::Buffer> ValidationStateTracker::CreateBufferState(VkBuffer handle, const VkBufferCreateInfo *pCreateInfo) {
-    return std::make_shared<vvl::Buffer>(*this, handle, pCreateInfo);
+    return vvl::MakeState<vvl::Buffer>(*this, handle, pCreateInfo);
 }
 
 void ValidationStateTracker::PostCallRecordCreateBuffer(VkDevice device, const VkBufferCreateInfo *pCreateInfo,
@@ -388,6 +433,7 @@ void ValidationStateTracker::PostCallRecordCreateBuffer(VkDevice device, const V
 
             BufferAddressInfillUpdateOps ops{{buffer_state.get()}};
             sparse_container::infill_update_range(buffer_address_map_, address_range, ops);
+            PublishBufferAddressSnapshot();
         }
 
         const VkBufferUsageFlags descriptor_buffer_usages =
@@ -410,7 +456,7 @@ std::shared_ptr<vvl::BufferView> ValidationStateTracker::CreateBufferViewState(c
                                                                                VkBufferView handle,
                                                                                const VkBufferViewCreateInfo *pCreateInfo,
                                                                                VkFormatFeatureFlags2KHR format_features) {
-    return std::make_shared<vvl::BufferView>(buffer, handle, pCreateInfo, format_features);
+    return vvl::MakeState<vvl::BufferView>(buffer, handle, pCreateInfo, format_features);
 }
 
 void ValidationStateTracker::PostCallRecordCreateBufferView(VkDevice device, const VkBufferViewCreateInfo *pCreateInfo,
@@ -420,17 +466,7 @@ void ValidationStateTracker::PostCallRecordCreateBufferView(VkDevice device, con
 
     auto buffer_state = Get<vvl::Buffer>(pCreateInfo->buffer);
 
-    VkFormatFeatureFlags2KHR buffer_features;
-    if (has_format_feature2) {
-        VkFormatProperties3KHR fmt_props_3 = vku::InitStructHelper();
-        VkFormatProperties2 fmt_props_2 = vku::InitStructHelper(&fmt_props_3);
-        DispatchGetPhysicalDeviceFormatProperties2(physical_device, pCreateInfo->format, &fmt_props_2);
-        buffer_features = fmt_props_3.bufferFeatures | fmt_props_2.formatProperties.bufferFeatures;
-    } else {
-        VkFormatProperties format_properties;
-        DispatchGetPhysicalDeviceFormatProperties(physical_device, pCreateInfo->format, &format_properties);
-        buffer_features = format_properties.bufferFeatures;
-    }
+    const VkFormatFeatureFlags2KHR buffer_features = GetFormatFeatures(pCreateInfo->format).buffer;
 
     Add(CreateBufferViewState(buffer_state, *pView, pCreateInfo, buffer_features));
 }
@@ -438,7 +474,7 @@ void ValidationStateTracker::PostCallRecordCreateBufferView(VkDevice device, con
 std::shared_ptr<vvl::ImageView> ValidationStateTracker::CreateImageViewState(
     const std::shared_ptr<vvl::Image> &image_state, VkImageView handle, const VkImageViewCreateInfo *pCreateInfo,
     VkFormatFeatureFlags2KHR format_features, const VkFilterCubicImageViewImageFormatPropertiesEXT &cubic_props) {
-    return std::make_shared<vvl::ImageView>(image_state, handle, pCreateInfo, format_features, cubic_props);
+    return vvl::MakeState<vvl::ImageView>(image_state, handle, pCreateInfo, format_features, cubic_props);
 }
 
 void ValidationStateTracker::PostCallRecordCreateImageView(VkDevice device, const VkImageViewCreateInfo *pCreateInfo,
@@ -452,9 +488,7 @@ void ValidationStateTracker::PostCallRecordCreateImageView(VkDevice device, cons
         // The ImageView uses same Image's format feature since they share same AHB
         format_features = image_state->format_features;
     } else {
-        format_features = GetImageFormatFeatures(physical_device, has_format_feature2,
-                                                 IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier), device,
-                                                 image_state->VkHandle(), pCreateInfo->format, image_state->create_info.tiling);
+        format_features = GetImageFormatFeatures(image_state->VkHandle(), pCreateInfo->format, image_state->create_info.tiling);
     }
 
     // filter_cubic_props is used in CmdDraw validation. But it takes a lot of performance if it does in CmdDraw.
@@ -550,6 +584,7 @@ void ValidationStateTracker::PreCallRecordDestroyBuffer(VkDevice device, VkBuffe
 
                 return false;
             });
+            PublishBufferAddressSnapshot();
         }
     }
     Destroy<vvl::Buffer>(buffer);
@@ -627,51 +662,11 @@ VkFormatFeatureFlags2KHR ValidationStateTracker::GetPotentialFormatFeatures(VkFo
     VkFormatFeatureFlags2KHR format_features = 0;
 
     if (format != VK_FORMAT_UNDEFINED) {
-        if (has_format_feature2) {
-            VkDrmFormatModifierPropertiesList2EXT fmt_drm_props = vku::InitStructHelper();
-            auto fmt_props_3 = vku::InitStruct<VkFormatProperties3KHR>(
-                IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier) ? &fmt_drm_props : nullptr);
-            VkFormatProperties2 fmt_props_2 = vku::InitStructHelper(&fmt_props_3);
-
-            DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
-
-            format_features |= fmt_props_2.formatProperties.linearTilingFeatures;
-            format_features |= fmt_props_2.formatProperties.optimalTilingFeatures;
-
-            format_features |= fmt_props_3.linearTilingFeatures;
-            format_features |= fmt_props_3.optimalTilingFeatures;
-
-            if (IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier)) {
-                std::vector<VkDrmFormatModifierProperties2EXT> drm_properties;
-                drm_properties.resize(fmt_drm_props.drmFormatModifierCount);
-                fmt_drm_props.pDrmFormatModifierProperties = drm_properties.data();
-                DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
-
-                for (uint32_t i = 0; i < fmt_drm_props.drmFormatModifierCount; i++) {
-                    format_features |= fmt_drm_props.pDrmFormatModifierProperties[i].drmFormatModifierTilingFeatures;
-                }
-            }
-        } else {
-            VkFormatProperties format_properties;
-            DispatchGetPhysicalDeviceFormatProperties(physical_device, format, &format_properties);
-            format_features |= format_properties.linearTilingFeatures;
-            format_features |= format_properties.optimalTilingFeatures;
-
-            if (IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier)) {
-                VkDrmFormatModifierPropertiesListEXT fmt_drm_props = vku::InitStructHelper();
-                VkFormatProperties2 fmt_props_2 = vku::InitStructHelper(&fmt_drm_props);
-
-                DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
-
-                std::vector<VkDrmFormatModifierPropertiesEXT> drm_properties;
-                drm_properties.resize(fmt_drm_props.drmFormatModifierCount);
-                fmt_drm_props.pDrmFormatModifierProperties = drm_properties.data();
-                DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
-
-                for (uint32_t i = 0; i < fmt_drm_props.drmFormatModifierCount; i++) {
-                    format_features |= fmt_drm_props.pDrmFormatModifierProperties[i].drmFormatModifierTilingFeatures;
-                }
-            }
+        const FormatFeatures &features = GetFormatFeatures(format);
+        format_features |= features.linear_tiling;
+        format_features |= features.optimal_tiling;
+        for (const auto &drm_format_modifier : features.drm_format_modifiers) {
+            format_features |= drm_format_modifier.second;
         }
     }
 
@@ -697,12 +692,48 @@ void ValidationStateTracker::PostCallRecordCreateDevice(VkPhysicalDevice gpu, co
 
 std::shared_ptr<vvl::Queue> ValidationStateTracker::CreateQueue(VkQueue handle, uint32_t index, VkDeviceQueueCreateFlags flags,
                                                                 const VkQueueFamilyProperties &queueFamilyProperties) {
-    return std::make_shared<vvl::Queue>(*this, handle, index, flags, queueFamilyProperties);
+    return vvl::MakeState<vvl::Queue>(*this, handle, index, flags, queueFamilyProperties);
+}
+
+void ValidationStateTracker::UseSlabIdStateMaps() {
+    acceleration_structure_nv_map_.UseSlabIds();
+    render_pass_map_.UseSlabIds();
+    descriptor_set_layout_map_.UseSlabIds();
+    sampler_map_.UseSlabIds();
+    image_view_map_.UseSlabIds();
+    image_map_.UseSlabIds();
+    buffer_view_map_.UseSlabIds();
+    buffer_map_.UseSlabIds();
+    pipeline_cache_map_.UseSlabIds();
+    pipeline_map_.UseSlabIds();
+    shader_object_map_.UseSlabIds();
+    mem_obj_map_.UseSlabIds();
+    frame_buffer_map_.UseSlabIds();
+    shader_module_map_.UseSlabIds();
+    desc_template_map_.UseSlabIds();
+    swapchain_map_.UseSlabIds();
+    descriptor_pool_map_.UseSlabIds();
+    descriptor_set_map_.UseSlabIds();
+    command_pool_map_.UseSlabIds();
+    pipeline_layout_map_.UseSlabIds();
+    fence_map_.UseSlabIds();
+    query_pool_map_.UseSlabIds();
+    semaphore_map_.UseSlabIds();
+    event_map_.UseSlabIds();
+    sampler_ycbcr_conversion_map_.UseSlabIds();
+    video_session_map_.UseSlabIds();
+    video_session_parameters_map_.UseSlabIds();
+    acceleration_structure_khr_map_.UseSlabIds();
 }
 
 void ValidationStateTracker::CreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Location &loc) {
     GetEnabledDeviceFeatures(pCreateInfo, &enabled_features, api_version);
 
+    // The application only sees slab ids for wrapped non-dispatchable handles, they index the state maps directly
+    if (wrap_handles && enabled[unique_handles_slab]) {
+        UseSlabIdStateMaps();
+    }
+
     const auto *device_group_ci = vku::FindStructInPNextChain<VkDeviceGroupDeviceCreateInfo>(pCreateInfo->pNext);
     if (device_group_ci) {
         physical_device_count = device_group_ci->physicalDeviceCount;
@@ -1105,6 +1136,14 @@ void ValidationStateTracker::PreCallRecordDestroyDevice(VkDevice device, const V
         entry.second->Destroy();
     }
     queue_map_.clear();
+    queue_retire_pool.reset();
+    retired_states_.ReleaseAll();
+}
+
+void ValidationStateTracker::ApplyDeferredInvalidations(VkCommandBuffer command_buffer) const {
+    if (auto cb_state = GetConstCastShared<vvl::CommandBuffer>(command_buffer)) {
+        cb_state->ApplyDeferredInvalidations();
+    }
 }
 
 void ValidationStateTracker::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
@@ -1113,17 +1152,17 @@ void ValidationStateTracker::PreCallRecordQueueSubmit(VkQueue queue, uint32_t su
 
     uint64_t early_retire_seq = 0;
 
-    std::vector<vvl::QueueSubmission> submissions;
+    vvl::Queue::SubmissionBatch submissions;
     submissions.reserve(submitCount);
     if (submitCount == 0) {
-        vvl::QueueSubmission submission(record_obj.location);
-        submission.AddFence(Get<vvl::Fence>(fence));
+        auto submission = queue_state->AcquireSubmission(record_obj.location);
+        submission->AddFence(Get<vvl::Fence>(fence));
         submissions.emplace_back(std::move(submission));
     }
     // Now process each individual submit
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         Location submit_loc = record_obj.location.dot(vvl::Field::pSubmits, submit_idx);
-        vvl::QueueSubmission submission(submit_loc);
+        auto submission = queue_state->AcquireSubmission(submit_loc);
         const VkSubmitInfo *submit = &pSubmits[submit_idx];
         auto *timeline_semaphore_submit = vku::FindStructInPNextChain<VkTimelineSemaphoreSubmitInfo>(submit->pNext);
         for (uint32_t i = 0; i < submit->waitSemaphoreCount; ++i) {
@@ -1132,7 +1171,7 @@ void ValidationStateTracker::PreCallRecordQueueSubmit(VkQueue queue, uint32_t su
                 (i < timeline_semaphore_submit->waitSemaphoreValueCount)) {
                 value = timeline_semaphore_submit->pWaitSemaphoreValues[i];
             }
-            submission.AddWaitSemaphore(Get<vvl::Semaphore>(submit->pWaitSemaphores[i]), value);
+            submission->AddWaitSemaphore(Get<vvl::Semaphore>(submit->pWaitSemaphores[i]), value);
         }
 
         for (uint32_t i = 0; i < submit->signalSemaphoreCount; ++i) {
@@ -1141,20 +1180,21 @@ void ValidationStateTracker::PreCallRecordQueueSubmit(VkQueue queue, uint32_t su
                 (i < timeline_semaphore_submit->signalSemaphoreValueCount)) {
                 value = timeline_semaphore_submit->pSignalSemaphoreValues[i];
             }
-            submission.AddSignalSemaphore(Get<vvl::Semaphore>(submit->pSignalSemaphores[i]), value);
+            submission->AddSignalSemaphore(Get<vvl::Semaphore>(submit->pSignalSemaphores[i]), value);
         }
 
         const auto perf_submit = vku::FindStructInPNextChain<VkPerformanceQuerySubmitInfoKHR>(submit->pNext);
-        submission.perf_submit_pass = perf_submit ? perf_submit->counterPassIndex : 0;
+        submission->perf_submit_pass = perf_submit ? perf_submit->counterPassIndex : 0;
 
         for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
             auto cb_state = Get<vvl::CommandBuffer>(submit->pCommandBuffers[i]);
             if (cb_state) {
-                submission.AddCommandBuffer(std::move(cb_state));
+                cb_state->ApplyDeferredInvalidations();
+                submission->AddCommandBuffer(std::move(cb_state));
             }
         }
         if (submit_idx == (submitCount - 1) && fence != VK_NULL_HANDLE) {
-            submission.AddFence(Get<vvl::Fence>(fence));
+            submission->AddFence(Get<vvl::Fence>(fence));
         }
         submissions.emplace_back(std::move(submission));
     }
@@ -1205,36 +1245,40 @@ void ValidationStateTracker::PreCallRecordQueueSubmit2(VkQueue queue, uint32_t s
                                                        VkFence fence, const RecordObject &record_obj) {
     auto queue_state = Get<vvl::Queue>(queue);
     uint64_t early_retire_seq = 0;
-    std::vector<vvl::QueueSubmission> submissions;
+    vvl::Queue::SubmissionBatch submissions;
     submissions.reserve(submitCount);
     if (submitCount == 0) {
-        vvl::QueueSubmission submission(record_obj.location);
-        submission.AddFence(Get<vvl::Fence>(fence));
+        auto submission = queue_state->AcquireSubmission(record_obj.location);
+        submission->AddFence(Get<vvl::Fence>(fence));
         submissions.emplace_back(std::move(submission));
     }
 
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         Location submit_loc = record_obj.location.dot(vvl::Field::pSubmits, submit_idx);
-        vvl::QueueSubmission submission(submit_loc);
+        auto submission = queue_state->AcquireSubmission(submit_loc);
         const VkSubmitInfo2KHR *submit = &pSubmits[submit_idx];
         for (uint32_t i = 0; i < submit->waitSemaphoreInfoCount; ++i) {
             const auto &sem_info = submit->pWaitSemaphoreInfos[i];
             auto semaphore = Get<vvl::Semaphore>(sem_info.semaphore);
             const uint64_t value = (semaphore->type == VK_SEMAPHORE_TYPE_BINARY) ? 0 : sem_info.value;
-            submission.AddWaitSemaphore(std::move(semaphore), value);
+            submission->AddWaitSemaphore(std::move(semaphore), value);
         }
         for (uint32_t i = 0; i < submit->signalSemaphoreInfoCount; ++i) {
             const auto &sem_info = submit->pSignalSemaphoreInfos[i];
-            submission.AddSignalSemaphore(Get<vvl::Semaphore>(sem_info.semaphore), sem_info.value);
+            submission->AddSignalSemaphore(Get<vvl::Semaphore>(sem_info.semaphore), sem_info.value);
         }
         const auto perf_submit = vku::FindStructInPNextChain<VkPerformanceQuerySubmitInfoKHR>(submit->pNext);
-        submission.perf_submit_pass = perf_submit ? perf_submit->counterPassIndex : 0;
+        submission->perf_submit_pass = perf_submit ? perf_submit->counterPassIndex : 0;
 
         for (uint32_t i = 0; i < submit->commandBufferInfoCount; i++) {
-            submission.AddCommandBuffer(GetWrite<vvl::CommandBuffer>(submit->pCommandBufferInfos[i].commandBuffer));
+            auto cb_state = Get<vvl::CommandBuffer>(submit->pCommandBufferInfos[i].commandBuffer);
+            if (cb_state) {
+                cb_state->ApplyDeferredInvalidations();
+            }
+            submission->AddCommandBuffer(std::move(cb_state));
         }
         if (submit_idx == (submitCount - 1)) {
-            submission.AddFence(Get<vvl::Fence>(fence));
+            submission->AddFence(Get<vvl::Fence>(fence));
         }
         submissions.emplace_back(std::move(submission));
     }
@@ -1315,77 +1359,94 @@ void ValidationStateTracker::PreCallRecordQueueBindSparse(VkQueue queue, uint32_
 
     uint64_t early_retire_seq = 0;
 
-    std::vector<vvl::QueueSubmission> submissions;
+    // Consecutive binds usually come from the same allocation, only look it up when the handle changes
+    VkDeviceMemory last_memory = VK_NULL_HANDLE;
+    std::shared_ptr<vvl::DeviceMemory> last_mem_state;
+    auto get_memory = [this, &last_memory, &last_mem_state](VkDeviceMemory memory) {
+        if (memory != last_memory) {
+            last_memory = memory;
+            last_mem_state = Get<vvl::DeviceMemory>(memory);
+        }
+        return last_mem_state;
+    };
+    vvl::BindableMemoryTracker::MemoryBinds memory_binds;
+
+    vvl::Queue::SubmissionBatch submissions;
     submissions.reserve(bindInfoCount);
     for (uint32_t bind_idx = 0; bind_idx < bindInfoCount; ++bind_idx) {
         const VkBindSparseInfo &bind_info = pBindInfo[bind_idx];
         // Track objects tied to memory
+        // The binds of each resource are applied as one batch, sparse resources are often bound one page at a time
         for (uint32_t j = 0; j < bind_info.bufferBindCount; j++) {
-            for (uint32_t k = 0; k < bind_info.pBufferBinds[j].bindCount; k++) {
-                auto sparse_binding = bind_info.pBufferBinds[j].pBinds[k];
-                auto buffer_state = Get<vvl::Buffer>(bind_info.pBufferBinds[j].buffer);
-                auto mem_state = Get<vvl::DeviceMemory>(sparse_binding.memory);
-                if (buffer_state) {
-                    buffer_state->BindMemory(buffer_state.get(), mem_state, sparse_binding.memoryOffset,
-                                             sparse_binding.resourceOffset, sparse_binding.size);
-                }
+            const VkSparseBufferMemoryBindInfo &buffer_bind = bind_info.pBufferBinds[j];
+            auto buffer_state = Get<vvl::Buffer>(buffer_bind.buffer);
+            if (!buffer_state || buffer_bind.bindCount == 0) continue;
+            memory_binds.clear();
+            for (uint32_t k = 0; k < buffer_bind.bindCount; k++) {
+                const VkSparseMemoryBind &sparse_binding = buffer_bind.pBinds[k];
+                memory_binds.emplace_back(vvl::BindableMemoryTracker::MemoryBind{
+                    get_memory(sparse_binding.memory), sparse_binding.memoryOffset, sparse_binding.resourceOffset,
+                    sparse_binding.size});
             }
+            buffer_state->BindMemories(buffer_state.get(), memory_binds);
         }
         for (uint32_t j = 0; j < bind_info.imageOpaqueBindCount; j++) {
-            for (uint32_t k = 0; k < bind_info.pImageOpaqueBinds[j].bindCount; k++) {
-                auto sparse_binding = bind_info.pImageOpaqueBinds[j].pBinds[k];
-                auto image_state = Get<vvl::Image>(bind_info.pImageOpaqueBinds[j].image);
-                auto mem_state = Get<vvl::DeviceMemory>(sparse_binding.memory);
-                if (image_state) {
-                    // An Android special image cannot get VkSubresourceLayout until the image binds a memory.
-                    // See: VUID-vkGetImageSubresourceLayout-image-09432
-                    if (!image_state->fragment_encoder) {
-                        image_state->fragment_encoder =
-                            std::make_unique<const subresource_adapter::ImageRangeEncoder>(*image_state);
-                    }
-                    image_state->BindMemory(image_state.get(), mem_state, sparse_binding.memoryOffset,
-                                            sparse_binding.resourceOffset, sparse_binding.size);
-                }
+            const VkSparseImageOpaqueMemoryBindInfo &image_opaque_bind = bind_info.pImageOpaqueBinds[j];
+            auto image_state = Get<vvl::Image>(image_opaque_bind.image);
+            if (!image_state || image_opaque_bind.bindCount == 0) continue;
+            // An Android special image cannot get VkSubresourceLayout until the image binds a memory.
+            // See: VUID-vkGetImageSubresourceLayout-image-09432
+            if (!image_state->fragment_encoder) {
+                image_state->fragment_encoder = image_range_encoder_cache_.Get(*image_state);
             }
+            memory_binds.clear();
+            for (uint32_t k = 0; k < image_opaque_bind.bindCount; k++) {
+                const VkSparseMemoryBind &sparse_binding = image_opaque_bind.pBinds[k];
+                memory_binds.emplace_back(vvl::BindableMemoryTracker::MemoryBind{
+                    get_memory(sparse_binding.memory), sparse_binding.memoryOffset, sparse_binding.resourceOffset,
+                    sparse_binding.size});
+            }
+            image_state->BindMemories(image_state.get(), memory_binds);
         }
         for (uint32_t j = 0; j < bind_info.imageBindCount; j++) {
-            for (uint32_t k = 0; k < bind_info.pImageBinds[j].bindCount; k++) {
-                auto sparse_binding = bind_info.pImageBinds[j].pBinds[k];
+            const VkSparseImageMemoryBindInfo &image_bind = bind_info.pImageBinds[j];
+            auto image_state = Get<vvl::Image>(image_bind.image);
+            if (!image_state || image_bind.bindCount == 0) continue;
+            // An Android special image cannot get VkSubresourceLayout until the image binds a memory.
+            // See: VUID-vkGetImageSubresourceLayout-image-09432
+            if (!image_state->fragment_encoder) {
+                image_state->fragment_encoder = image_range_encoder_cache_.Get(*image_state);
+            }
+            memory_binds.clear();
+            for (uint32_t k = 0; k < image_bind.bindCount; k++) {
+                const VkSparseImageMemoryBind &sparse_binding = image_bind.pBinds[k];
                 // TODO: This size is broken for non-opaque bindings, need to update to comprehend full sparse binding data
                 VkDeviceSize size = sparse_binding.extent.depth * sparse_binding.extent.height * sparse_binding.extent.width * 4;
                 VkDeviceSize offset = sparse_binding.offset.z * sparse_binding.offset.y * sparse_binding.offset.x * 4;
-                auto image_state = Get<vvl::Image>(bind_info.pImageBinds[j].image);
-                auto mem_state = Get<vvl::DeviceMemory>(sparse_binding.memory);
-                if (image_state) {
-                    // An Android special image cannot get VkSubresourceLayout until the image binds a memory.
-                    // See: VUID-vkGetImageSubresourceLayout-image-09432
-                    if (!image_state->fragment_encoder) {
-                        image_state->fragment_encoder =
-                            std::make_unique<const subresource_adapter::ImageRangeEncoder>(*image_state);
-                    }
-                    image_state->BindMemory(image_state.get(), mem_state, sparse_binding.memoryOffset, offset, size);
-                }
+                memory_binds.emplace_back(vvl::BindableMemoryTracker::MemoryBind{get_memory(sparse_binding.memory),
+                                                                                 sparse_binding.memoryOffset, offset, size});
             }
+            image_state->BindMemories(image_state.get(), memory_binds);
         }
         auto timeline_info = vku::FindStructInPNextChain<VkTimelineSemaphoreSubmitInfo>(bind_info.pNext);
         Location submit_loc = record_obj.location.dot(vvl::Field::pBindInfo, bind_idx);
-        vvl::QueueSubmission submission(submit_loc);
+        auto submission = queue_state->AcquireSubmission(submit_loc);
         for (uint32_t i = 0; i < bind_info.waitSemaphoreCount; ++i) {
             uint64_t payload = 0;
             if (timeline_info && i < timeline_info->waitSemaphoreValueCount) {
                 payload = timeline_info->pWaitSemaphoreValues[i];
             }
-            submission.AddWaitSemaphore(Get<vvl::Semaphore>(bind_info.pWaitSemaphores[i]), payload);
+            submission->AddWaitSemaphore(Get<vvl::Semaphore>(bind_info.pWaitSemaphores[i]), payload);
         }
         for (uint32_t i = 0; i < bind_info.signalSemaphoreCount; ++i) {
             uint64_t payload = 0;
             if (timeline_info && i < timeline_info->signalSemaphoreValueCount) {
                 payload = timeline_info->pSignalSemaphoreValues[i];
             }
-            submission.AddSignalSemaphore(Get<vvl::Semaphore>(bind_info.pSignalSemaphores[i]), payload);
+            submission->AddSignalSemaphore(Get<vvl::Semaphore>(bind_info.pSignalSemaphores[i]), payload);
         }
         if (bind_idx == (bindInfoCount - 1)) {
-            submission.AddFence(Get<vvl::Fence>(fence));
+            submission->AddFence(Get<vvl::Fence>(fence));
         }
         submissions.emplace_back(std::move(submission));
     }
@@ -1407,7 +1468,7 @@ void ValidationStateTracker::PostCallRecordCreateSemaphore(VkDevice device, cons
                                                            const VkAllocationCallbacks *pAllocator, VkSemaphore *pSemaphore,
                                                            const RecordObject &record_obj) {
     if (VK_SUCCESS != record_obj.result) return;
-    Add(std::make_shared<vvl::Semaphore>(*this, *pSemaphore, pCreateInfo));
+    Add(vvl::MakeState<vvl::Semaphore>(*this, *pSemaphore, pCreateInfo));
 }
 
 void ValidationStateTracker::RecordImportSemaphoreState(VkSemaphore semaphore, VkExternalSemaphoreHandleTypeFlagBits handle_type,
@@ -1774,7 +1835,7 @@ void ValidationStateTracker::PreCallRecordFreeCommandBuffers(VkDevice device, Vk
 std::shared_ptr<vvl::CommandPool> ValidationStateTracker::CreateCommandPoolState(VkCommandPool handle,
                                                                                  const VkCommandPoolCreateInfo *pCreateInfo) {
     auto queue_flags = physical_device_state->queue_family_properties[pCreateInfo->queueFamilyIndex].queueFlags;
-    return std::make_shared<vvl::CommandPool>(*this, handle, pCreateInfo, queue_flags);
+    return vvl::MakeState<vvl::CommandPool>(*this, handle, pCreateInfo, queue_flags);
 }
 
 void ValidationStateTracker::PostCallRecordCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo *pCreateInfo,
@@ -1824,7 +1885,7 @@ void ValidationStateTracker::PostCallRecordCreateQueryPool(VkDevice device, cons
         }
     }
 
-    Add(std::make_shared<vvl::QueryPool>(
+    Add(vvl::MakeState<vvl::QueryPool>(
         *pQueryPool, pCreateInfo, index_count, perf_queue_family_index, n_perf_pass, has_cb, has_rb,
         video_profile_cache_.Get(physical_device, vku::FindStructInPNextChain<VkVideoProfileInfoKHR>(pCreateInfo->pNext)),
         video_encode_feedback_flags));
@@ -1872,12 +1933,12 @@ void ValidationStateTracker::PostCallRecordCreateFence(VkDevice device, const Vk
                                                        const VkAllocationCallbacks *pAllocator, VkFence *pFence,
                                                        const RecordObject &record_obj) {
     if (VK_SUCCESS != record_obj.result) return;
-    Add(std::make_shared<vvl::Fence>(*this, *pFence, pCreateInfo));
+    Add(vvl::MakeState<vvl::Fence>(*this, *pFence, pCreateInfo));
 }
 
 std::shared_ptr<vvl::PipelineCache> ValidationStateTracker::CreatePipelineCacheState(
     VkPipelineCache handle, const VkPipelineCacheCreateInfo *pCreateInfo) const {
-    return std::make_shared<vvl::PipelineCache>(handle, pCreateInfo);
+    return vvl::MakeState<vvl::PipelineCache>(handle, pCreateInfo);
 }
 
 void ValidationStateTracker::PostCallRecordCreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo *pCreateInfo,
@@ -1897,8 +1958,8 @@ std::shared_ptr<vvl::Pipeline> ValidationStateTracker::CreateGraphicsPipelineSta
     const VkGraphicsPipelineCreateInfo *pCreateInfo, std::shared_ptr<const vvl::PipelineCache> pipeline_cache,
     std::shared_ptr<const vvl::RenderPass> &&render_pass, std::shared_ptr<const vvl::PipelineLayout> &&layout,
     ShaderModuleUniqueIds *shader_unique_id_map) const {
-    return std::make_shared<vvl::Pipeline>(*this, pCreateInfo, std::move(pipeline_cache), std::move(render_pass), std::move(layout),
-                                           shader_unique_id_map);
+    return vvl::MakeState<vvl::Pipeline>(*this, pCreateInfo, std::move(pipeline_cache), std::move(render_pass), std::move(layout),
+                                         shader_unique_id_map);
 }
 
 bool ValidationStateTracker::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
@@ -1922,7 +1983,7 @@ bool ValidationStateTracker::PreCallValidateCreateGraphicsPipelines(VkDevice dev
             const bool rasterization_enabled = vvl::Pipeline::EnablesRasterizationStates(*this, create_info);
             const bool has_fragment_output_state =
                 vvl::Pipeline::ContainsSubState(this, create_info, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT);
-            render_pass = std::make_shared<vvl::RenderPass>(dynamic_rendering, rasterization_enabled && has_fragment_output_state);
+            render_pass = vvl::MakeState<vvl::RenderPass>(dynamic_rendering, rasterization_enabled && has_fragment_output_state);
         } else {
             const bool is_graphics_lib = GetGraphicsLibType(create_info) != static_cast<VkGraphicsPipelineLibraryFlagsEXT>(0);
             const bool has_link_info = vku::FindStructInPNextChain<VkPipelineLibraryCreateInfoKHR>(create_info.pNext) != nullptr;
@@ -1957,7 +2018,7 @@ void ValidationStateTracker::PostCallRecordCreateGraphicsPipelines(VkDevice devi
 std::shared_ptr<vvl::Pipeline> ValidationStateTracker::CreateComputePipelineState(
     const VkComputePipelineCreateInfo *pCreateInfo, std::shared_ptr<const vvl::PipelineCache> pipeline_cache,
     std::shared_ptr<const vvl::PipelineLayout> &&layout) const {
-    return std::make_shared<vvl::Pipeline>(*this, pCreateInfo, std::move(pipeline_cache), std::move(layout));
+    return vvl::MakeState<vvl::Pipeline>(*this, pCreateInfo, std::move(pipeline_cache), std::move(layout));
 }
 
 bool ValidationStateTracker::PreCallValidateCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
@@ -1993,7 +2054,7 @@ void ValidationStateTracker::PostCallRecordCreateComputePipelines(VkDevice devic
 std::shared_ptr<vvl::Pipeline> ValidationStateTracker::CreateRayTracingPipelineState(
     const VkRayTracingPipelineCreateInfoNV *pCreateInfo, std::shared_ptr<const vvl::PipelineCache> pipeline_cache,
     std::shared_ptr<const vvl::PipelineLayout> &&layout) const {
-    return std::make_shared<vvl::Pipeline>(*this, pCreateInfo, std::move(pipeline_cache), std::move(layout));
+    return vvl::MakeState<vvl::Pipeline>(*this, pCreateInfo, std::move(pipeline_cache), std::move(layout));
 }
 
 bool ValidationStateTracker::PreCallValidateCreateRayTracingPipelinesNV(
@@ -2027,7 +2088,7 @@ void ValidationStateTracker::PostCallRecordCreateRayTracingPipelinesNV(
 std::shared_ptr<vvl::Pipeline> ValidationStateTracker::CreateRayTracingPipelineState(
     const VkRayTracingPipelineCreateInfoKHR *pCreateInfo, std::shared_ptr<const vvl::PipelineCache> pipeline_cache,
     std::shared_ptr<const vvl::PipelineLayout> &&layout) const {
-    return std::make_shared<vvl::Pipeline>(*this, pCreateInfo, std::move(pipeline_cache), std::move(layout));
+    return vvl::MakeState<vvl::Pipeline>(*this, pCreateInfo, std::move(pipeline_cache), std::move(layout));
 }
 
 bool ValidationStateTracker::PreCallValidateCreateRayTracingPipelinesKHR(
@@ -2081,7 +2142,7 @@ void ValidationStateTracker::PostCallRecordCreateRayTracingPipelinesKHR(
 }
 
 std::shared_ptr<vvl::Sampler> ValidationStateTracker::CreateSamplerState(VkSampler handle, const VkSamplerCreateInfo *pCreateInfo) {
-    return std::make_shared<vvl::Sampler>(handle, pCreateInfo);
+    return vvl::MakeState<vvl::Sampler>(handle, pCreateInfo);
 }
 
 void ValidationStateTracker::PostCallRecordCreateSampler(VkDevice device, const VkSamplerCreateInfo *pCreateInfo,
@@ -2100,7 +2161,7 @@ void ValidationStateTracker::PostCallRecordCreateDescriptorSetLayout(VkDevice de
                                                                      VkDescriptorSetLayout *pSetLayout,
                                                                      const RecordObject &record_obj) {
     if (VK_SUCCESS != record_obj.result) return;
-    Add(std::make_shared<vvl::DescriptorSetLayout>(pCreateInfo, *pSetLayout));
+    Add(vvl::MakeState<vvl::DescriptorSetLayout>(pCreateInfo, *pSetLayout));
 }
 
 void ValidationStateTracker::PostCallRecordGetDescriptorSetLayoutSizeEXT(VkDevice device, VkDescriptorSetLayout layout,
@@ -2115,18 +2176,18 @@ void ValidationStateTracker::PostCallRecordCreatePipelineLayout(VkDevice device,
                                                                 const VkAllocationCallbacks *pAllocator,
                                                                 VkPipelineLayout *pPipelineLayout, const RecordObject &record_obj) {
     if (VK_SUCCESS != record_obj.result) return;
-    Add(std::make_shared<vvl::PipelineLayout>(*this, *pPipelineLayout, pCreateInfo));
+    Add(vvl::MakeState<vvl::PipelineLayout>(*this, *pPipelineLayout, pCreateInfo));
 }
 
 std::shared_ptr<vvl::DescriptorPool> ValidationStateTracker::CreateDescriptorPoolState(
     VkDescriptorPool handle, const VkDescriptorPoolCreateInfo *pCreateInfo) {
-    return std::make_shared<vvl::DescriptorPool>(*this, handle, pCreateInfo);
+    return vvl::MakeState<vvl::DescriptorPool>(*this, handle, pCreateInfo);
 }
 
 std::shared_ptr<vvl::DescriptorSet> ValidationStateTracker::CreateDescriptorSet(
     VkDescriptorSet handle, vvl::DescriptorPool *pool, const std::shared_ptr<vvl::DescriptorSetLayout const> &layout,
     uint32_t variable_count) {
-    return std::make_shared<vvl::DescriptorSet>(handle, pool, layout, variable_count, this);
+    return vvl::MakeState<vvl::DescriptorSet>(handle, pool, layout, variable_count, this);
 }
 
 void ValidationStateTracker::PostCallRecordCreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo *pCreateInfo,
@@ -2404,7 +2465,7 @@ void ValidationStateTracker::PostCallRecordCmdSetViewportShadingRatePaletteNV(Vk
 
 std::shared_ptr<vvl::AccelerationStructureNV> ValidationStateTracker::CreateAccelerationStructureState(
     VkAccelerationStructureNV handle, const VkAccelerationStructureCreateInfoNV *pCreateInfo) {
-    return std::make_shared<vvl::AccelerationStructureNV>(device, handle, pCreateInfo);
+    return vvl::MakeState<vvl::AccelerationStructureNV>(device, handle, pCreateInfo);
 }
 
 void ValidationStateTracker::PostCallRecordCreateAccelerationStructureNV(VkDevice device,
@@ -2419,7 +2480,7 @@ void ValidationStateTracker::PostCallRecordCreateAccelerationStructureNV(VkDevic
 std::shared_ptr<vvl::AccelerationStructureKHR> ValidationStateTracker::CreateAccelerationStructureState(
     VkAccelerationStructureKHR handle, const VkAccelerationStructureCreateInfoKHR *pCreateInfo,
     std::shared_ptr<vvl::Buffer> &&buf_state) {
-    return std::make_shared<vvl::AccelerationStructureKHR>(handle, pCreateInfo, std::move(buf_state));
+    return vvl::MakeState<vvl::AccelerationStructureKHR>(handle, pCreateInfo, std::move(buf_state));
 }
 
 void ValidationStateTracker::PostCallRecordCreateAccelerationStructureKHR(VkDevice device,
@@ -2808,6 +2869,8 @@ void ValidationStateTracker::PreCallRecordCmdBindDescriptorBuffersEXT(VkCommandB
     auto cb_state = Get<vvl::CommandBuffer>(commandBuffer);
 
     cb_state->descriptor_buffer_binding_info.resize(bufferCount);
+    cb_state->DirtyActionState(vvl::CommandBuffer::kActionStateDescriptorSets);
+    cb_state->validated_descriptor_buffer_offsets.offsets.clear();
 
     std::copy(pBindingInfos, pBindingInfos + bufferCount, cb_state->descriptor_buffer_binding_info.data());
 }
@@ -2890,6 +2953,7 @@ void ValidationStateTracker::PreCallRecordCmdBindIndexBuffer(VkCommandBuffer com
     // Using this function is the same as passing in VK_WHOLE_SIZE
     VkDeviceSize buffer_size = vvl::Buffer::ComputeSize(buffer_state, offset, VK_WHOLE_SIZE);
     cb_state->index_buffer_binding = vvl::IndexBufferBinding(buffer, buffer_size, offset, indexType);
+    cb_state->DirtyActionState(vvl::CommandBuffer::kActionStateVertexInput);
 
     // Add binding for this index buffer to this commandbuffer
     if (!disabled[command_buffer_state] && buffer) {
@@ -2908,6 +2972,7 @@ void ValidationStateTracker::PreCallRecordCmdBindIndexBuffer2KHR(VkCommandBuffer
     auto buffer_state = Get<vvl::Buffer>(buffer);
     VkDeviceSize buffer_size = vvl::Buffer::ComputeSize(buffer_state, offset, size);
     cb_state->index_buffer_binding = vvl::IndexBufferBinding(buffer, buffer_size, offset, indexType);
+    cb_state->DirtyActionState(vvl::CommandBuffer::kActionStateVertexInput);
 
     // Add binding for this index buffer to this commandbuffer
     if (!disabled[command_buffer_state] && buffer) {
@@ -3161,7 +3226,7 @@ void ValidationStateTracker::PostCallRecordCreateVideoSessionKHR(VkDevice device
     if (VK_SUCCESS != record_obj.result) return;
 
     auto profile_desc = video_profile_cache_.Get(physical_device, pCreateInfo->pVideoProfile);
-    Add(std::make_shared<vvl::VideoSession>(*this, *pVideoSession, pCreateInfo, std::move(profile_desc)));
+    Add(vvl::MakeState<vvl::VideoSession>(*this, *pVideoSession, pCreateInfo, std::move(profile_desc)));
 }
 
 void ValidationStateTracker::PostCallRecordGetVideoSessionMemoryRequirementsKHR(
@@ -3208,7 +3273,7 @@ void ValidationStateTracker::PostCallRecordCreateVideoSessionParametersKHR(VkDev
                                                                            const RecordObject &record_obj) {
     if (VK_SUCCESS != record_obj.result) return;
 
-    Add(std::make_shared<vvl::VideoSessionParameters>(
+    Add(vvl::MakeState<vvl::VideoSessionParameters>(
         *pVideoSessionParameters, pCreateInfo, Get<vvl::VideoSession>(pCreateInfo->videoSession),
         Get<vvl::VideoSessionParameters>(pCreateInfo->videoSessionParametersTemplate)));
 }
@@ -3243,15 +3308,16 @@ void ValidationStateTracker::PostCallRecordCreateFramebuffer(VkDevice device, co
         }
     }
 
-    Add(std::make_shared<vvl::Framebuffer>(*pFramebuffer, pCreateInfo, Get<vvl::RenderPass>(pCreateInfo->renderPass),
-                                           std::move(views)));
+    Add(vvl::MakeState<vvl::Framebuffer>(*pFramebuffer, pCreateInfo, Get<vvl::RenderPass>(pCreateInfo->renderPass),
+                                         std::move(views)));
 }
 
 void ValidationStateTracker::PostCallRecordCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo *pCreateInfo,
                                                             const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass,
                                                             const RecordObject &record_obj) {
     if (VK_SUCCESS != record_obj.result) return;
-    Add(std::make_shared<vvl::RenderPass>(*pRenderPass, pCreateInfo));
+    const vku::safe_VkRenderPassCreateInfo2 create_info_2 = ConvertVkRenderPassCreateInfoToV2KHR(*pCreateInfo);
+    Add(vvl::MakeState<vvl::RenderPass>(*pRenderPass, render_pass_analysis_cache_.Get(*create_info_2.ptr())));
 }
 
 void ValidationStateTracker::PostCallRecordCreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateInfo2 *pCreateInfo,
@@ -3265,7 +3331,7 @@ void ValidationStateTracker::PostCallRecordCreateRenderPass2(VkDevice device, co
                                                              const RecordObject &record_obj) {
     if (VK_SUCCESS != record_obj.result) return;
 
-    Add(std::make_shared<vvl::RenderPass>(*pRenderPass, pCreateInfo));
+    Add(vvl::MakeState<vvl::RenderPass>(*pRenderPass, render_pass_analysis_cache_.Get(*pCreateInfo)));
 }
 
 void ValidationStateTracker::PreCallRecordCmdBeginRenderPass(VkCommandBuffer commandBuffer,
@@ -3445,8 +3511,7 @@ void ValidationStateTracker::UpdateBindImageMemoryState(const VkBindImageMemoryI
     if (image_state) {
         // An Android sepcial image cannot get VkSubresourceLayout until the image binds a memory.
         // See: VUID-vkGetImageSubresourceLayout-image-09432
-        image_state->fragment_encoder =
-            std::unique_ptr<const subresource_adapter::ImageRangeEncoder>(new subresource_adapter::ImageRangeEncoder(*image_state));
+        image_state->fragment_encoder = image_range_encoder_cache_.Get(*image_state);
         const auto swapchain_info = vku::FindStructInPNextChain<VkBindImageMemorySwapchainInfoKHR>(bindInfo.pNext);
         if (swapchain_info) {
             auto swapchain = Get<vvl::Swapchain>(swapchain_info->swapchain);
@@ -3650,7 +3715,7 @@ void ValidationStateTracker::PostCallRecordCreateEvent(VkDevice device, const Vk
                                                        const VkAllocationCallbacks *pAllocator, VkEvent *pEvent,
                                                        const RecordObject &record_obj) {
     if (VK_SUCCESS != record_obj.result) return;
-    Add(std::make_shared<vvl::Event>(*pEvent, pCreateInfo));
+    Add(vvl::MakeState<vvl::Event>(*pEvent, pCreateInfo));
 }
 
 void ValidationStateTracker::RecordCreateSwapchainState(VkResult result, const VkSwapchainCreateInfoKHR *pCreateInfo,
@@ -3682,9 +3747,7 @@ void ValidationStateTracker::RecordCreateSwapchainState(VkResult result, const V
             swapchain->images.resize(swapchain_image_count);
             const auto &image_ci = swapchain->image_create_info;
             for (uint32_t i = 0; i < swapchain_image_count; ++i) {
-                auto format_features = GetImageFormatFeatures(physical_device, has_format_feature2,
-                                                              IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier),
-                                                              device, swapchain_images[i], image_ci.format, image_ci.tiling);
+                auto format_features = GetImageFormatFeatures(swapchain_images[i], image_ci.format, image_ci.tiling);
                 auto image_state = CreateImageState(swapchain_images[i], image_ci.ptr(), swapchain->VkHandle(), i, format_features);
                 image_state->SetSwapchain(swapchain, i);
                 image_state->SetInitialLayoutMap();
@@ -3724,7 +3787,7 @@ void ValidationStateTracker::PostCallRecordCreateDisplayModeKHR(VkPhysicalDevice
                                                                 const RecordObject &record_obj) {
     if (VK_SUCCESS != record_obj.result) return;
     if (!pMode) return;
-    Add(std::make_shared<vvl::DisplayMode>(*pMode, physicalDevice));
+    Add(vvl::MakeState<vvl::DisplayMode>(*pMode, physicalDevice));
 }
 
 void ValidationStateTracker::PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo,
@@ -3752,8 +3815,8 @@ void ValidationStateTracker::PostCallRecordQueuePresentKHR(VkQueue queue, const
 
     auto queue_state = Get<vvl::Queue>(queue);
     Location submit_loc = record_obj.location.dot(vvl::Field::pPresentInfo);
-    std::vector<vvl::QueueSubmission> submissions;
-    submissions.emplace_back(submit_loc);
+    vvl::Queue::SubmissionBatch submissions;
+    submissions.emplace_back(queue_state->AcquireSubmission(submit_loc));
     vvl::PresentSync present_sync;
     for (uint32_t i = 0; i < pPresentInfo->waitSemaphoreCount; ++i) {
         auto semaphore_state = Get<vvl::Semaphore>(pPresentInfo->pWaitSemaphores[i]);
@@ -3761,7 +3824,7 @@ void ValidationStateTracker::PostCallRecordQueuePresentKHR(VkQueue queue, const
             if (auto submission = semaphore_state->GetPendingBinarySignalSubmission()) {
                 present_sync.submissions.emplace_back(submission.value());
             }
-            submissions[0].AddWaitSemaphore(std::move(semaphore_state), 0);
+            submissions[0]->AddWaitSemaphore(std::move(semaphore_state), 0);
         }
     }
 
@@ -3855,7 +3918,7 @@ void ValidationStateTracker::PostCallRecordAcquireNextImage2KHR(VkDevice device,
 }
 
 std::shared_ptr<vvl::PhysicalDevice> ValidationStateTracker::CreatePhysicalDeviceState(VkPhysicalDevice handle) {
-    return std::make_shared<vvl::PhysicalDevice>(handle);
+    return vvl::MakeState<vvl::PhysicalDevice>(handle);
 }
 
 void ValidationStateTracker::PostCallRecordCreateInstance(const VkInstanceCreateInfo *pCreateInfo,
@@ -3926,7 +3989,7 @@ void ValidationStateTracker::PreCallRecordDestroySurfaceKHR(VkInstance instance,
     Destroy<vvl::Surface>(surface);
 }
 
-void ValidationStateTracker::RecordVulkanSurface(VkSurfaceKHR *pSurface) { Add(std::make_shared<vvl::Surface>(*pSurface)); }
+void ValidationStateTracker::RecordVulkanSurface(VkSurfaceKHR *pSurface) { Add(vvl::MakeState<vvl::Surface>(*pSurface)); }
 
 void ValidationStateTracker::PostCallRecordCreateDisplayPlaneSurfaceKHR(VkInstance instance,
                                                                         const VkDisplaySurfaceCreateInfoKHR *pCreateInfo,
@@ -4203,8 +4266,7 @@ void ValidationStateTracker::PreCallRecordCmdInsertDebugUtilsLabelEXT(VkCommandB
 
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
     cb_state->RecordCmd(record_obj.location.function);
-    // Squirrel away an easily accessible copy.
-    cb_state->debug_label = LoggingLabel(pLabelInfo);
+    cb_state->InsertLabel(pLabelInfo);
 }
 
 void ValidationStateTracker::RecordEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCounters(VkPhysicalDevice physicalDevice,
@@ -4262,7 +4324,8 @@ void ValidationStateTracker::PostCallRecordCreateDescriptorUpdateTemplate(VkDevi
                                                                           VkDescriptorUpdateTemplate *pDescriptorUpdateTemplate,
                                                                           const RecordObject &record_obj) {
     if (VK_SUCCESS != record_obj.result) return;
-    Add(std::make_shared<vvl::DescriptorUpdateTemplate>(*pDescriptorUpdateTemplate, pCreateInfo));
+    auto layout = Get<vvl::DescriptorSetLayout>(pCreateInfo->descriptorSetLayout);
+    Add(vvl::MakeState<vvl::DescriptorUpdateTemplate>(*pDescriptorUpdateTemplate, pCreateInfo, layout.get()));
 }
 
 void ValidationStateTracker::PostCallRecordCreateDescriptorUpdateTemplateKHR(
@@ -4430,7 +4493,7 @@ void ValidationStateTracker::PostCallRecordCreateSamplerYcbcrConversion(VkDevice
         format_features = GetExternalFormatFeaturesANDROID(pCreateInfo->pNext);
     }
 
-    Add(std::make_shared<vvl::SamplerYcbcrConversion>(*pYcbcrConversion, pCreateInfo, format_features));
+    Add(vvl::MakeState<vvl::SamplerYcbcrConversion>(*pYcbcrConversion, pCreateInfo, format_features));
 }
 
 void ValidationStateTracker::PostCallRecordCreateSamplerYcbcrConversionKHR(VkDevice device,
@@ -4484,10 +4547,10 @@ void ValidationStateTracker::PostCallRecordResetQueryPool(VkDevice device, VkQue
 void ValidationStateTracker::PerformUpdateDescriptorSetsWithTemplateKHR(VkDescriptorSet descriptorSet,
                                                                         const vvl::DescriptorUpdateTemplate *template_state,
                                                                         const void *pData) {
-    // Translate the templated update into a normal update for validation...
-    vvl::DecodedTemplateUpdate decoded_update(*this, descriptorSet, template_state, pData);
-    PerformUpdateDescriptorSets(static_cast<uint32_t>(decoded_update.desc_writes.size()), decoded_update.desc_writes.data(), 0,
-                                NULL);
+    // The template was resolved against its layout at creation, no need to decode it in VkWriteDescriptorSet
+    if (auto set_state = Get<vvl::DescriptorSet>(descriptorSet)) {
+        set_state->PerformTemplateUpdate(*template_state, pData);
+    }
 }
 
 // Update the common AllocateDescriptorSetsData
@@ -4744,6 +4807,45 @@ void ValidationStateTracker::PostCallRecordCmdTraceRaysIndirect2KHR(VkCommandBuf
     cb_state->UpdateTraceRayCmd(record_obj.location.function);
 }
 
+// Only walks the opcodes, a module with group decorations needs them flattened before it is parsed
+static bool HasGroupDecorations(const uint32_t *code, size_t word_count) {
+    for (size_t offset = 5; offset < word_count;) {
+        const uint32_t opcode = code[offset] & 0xFFFFu;
+        if (opcode == spv::OpGroupDecorate || opcode == spv::OpDecorationGroup || opcode == spv::OpGroupMemberDecorate) {
+            return true;
+        }
+        offset += std::max(code[offset] >> 16, 1u);
+    }
+    return false;
+}
+
+std::shared_ptr<spirv::Module> ValidationStateTracker::FindSharedSpirv(uint64_t code_hash, const uint32_t *code,
+                                                                       size_t word_count) {
+    std::lock_guard<std::mutex> guard(shared_spirv_lock_);
+    auto it = shared_spirv_map_.find(code_hash);
+    if (it == shared_spirv_map_.end()) {
+        return nullptr;
+    }
+    std::shared_ptr<spirv::Module> module_state = it->second.lock();
+    if (!module_state || !std::equal(code, code + word_count, module_state->words_.begin(), module_state->words_.end())) {
+        return nullptr;
+    }
+    auto new_module_state = std::make_shared<spirv::Module>(module_state->shared_data_);
+    it->second = new_module_state;
+    return new_module_state;
+}
+
+void ValidationStateTracker::AddSharedSpirv(uint64_t code_hash, const std::shared_ptr<spirv::Module> &module_state) {
+    std::lock_guard<std::mutex> guard(shared_spirv_lock_);
+    shared_spirv_map_[code_hash] = module_state;
+    if (shared_spirv_map_.size() >= shared_spirv_sweep_size_) {
+        for (auto it = shared_spirv_map_.begin(); it != shared_spirv_map_.end();) {
+            it = it->second.expired() ? shared_spirv_map_.erase(it) : std::next(it);
+        }
+        shared_spirv_sweep_size_ = std::max(kMinSharedSpirvSweepSize, shared_spirv_map_.size() * 2);
+    }
+}
+
 void ValidationStateTracker::PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
                                                              const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
                                                              const RecordObject &record_obj,
@@ -4752,8 +4854,31 @@ void ValidationStateTracker::PreCallRecordCreateShaderModule(VkDevice device, co
         return;
     }
 
+    const size_t word_count = pCreateInfo->codeSize / sizeof(uint32_t);
+    const uint64_t code_hash = hash_util::ShaderValidationHash(pCreateInfo->pCode, word_count * sizeof(uint32_t), 0);
+    if (auto module_state = FindSharedSpirv(code_hash, pCreateInfo->pCode, word_count)) {
+        // Same code as a live module, the parse is not done again
+        if (!module_state->IsParseDeferred()) {
+            chassis_state.stateless_data = module_state->shared_data_->stateless_data;
+        }
+        chassis_state.module_state = std::move(module_state);
+        return;
+    }
+
+    if (enabled[deferred_shader_module_parsing] && !HasGroupDecorations(pCreateInfo->pCode, word_count)) {
+        // The module is parsed by the first pipeline using it
+        chassis_state.module_state =
+            std::make_shared<spirv::Module>(pCreateInfo->codeSize, pCreateInfo->pCode, spirv::Module::DeferParse{});
+        AddSharedSpirv(code_hash, chassis_state.module_state);
+        return;
+    }
+
     chassis_state.module_state =
         std::make_shared<spirv::Module>(pCreateInfo->codeSize, pCreateInfo->pCode, &chassis_state.stateless_data);
+    if (!chassis_state.stateless_data.has_group_decoration) {
+        AddSharedSpirv(code_hash, chassis_state.module_state);
+        return;
+    }
     if (chassis_state.module_state && chassis_state.stateless_data.has_group_decoration) {
         spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
         spvtools::Optimizer optimizer(spirv_environment);
@@ -4794,7 +4919,7 @@ void ValidationStateTracker::PostCallRecordCreateShaderModule(VkDevice device, c
                                                               VkShaderModule *pShaderModule, const RecordObject &record_obj,
                                                               chassis::CreateShaderModule &chassis_state) {
     if (VK_SUCCESS != record_obj.result) return;
-    Add(std::make_shared<vvl::ShaderModule>(*pShaderModule, chassis_state.module_state, chassis_state.unique_shader_id));
+    Add(vvl::MakeState<vvl::ShaderModule>(*pShaderModule, chassis_state.module_state, chassis_state.unique_shader_id));
 }
 
 void ValidationStateTracker::PostCallRecordCreateShadersEXT(VkDevice device, uint32_t createInfoCount,
@@ -4804,8 +4929,8 @@ void ValidationStateTracker::PostCallRecordCreateShadersEXT(VkDevice device, uin
     if (VK_SUCCESS != record_obj.result) return;
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         if (pShaders[i] != VK_NULL_HANDLE) {
-            Add(std::make_shared<vvl::ShaderObject>(*this, pCreateInfos[i], pShaders[i], chassis_state.module_states[i],
-                                                    createInfoCount, pShaders, chassis_state.unique_shader_ids[i]));
+            Add(vvl::MakeState<vvl::ShaderObject>(*this, pCreateInfos[i], pShaders[i], chassis_state.module_states[i],
+                                                  createInfoCount, pShaders, chassis_state.unique_shader_ids[i]));
         }
     }
 }
@@ -5171,6 +5296,7 @@ void ValidationStateTracker::PostCallRecordCmdSetFragmentShadingRateKHR(VkComman
 void ValidationStateTracker::PostCallRecordCmdSetRenderingAttachmentLocationsKHR(
     VkCommandBuffer commandBuffer, const VkRenderingAttachmentLocationInfoKHR *pLocationInfo, const RecordObject &record_obj) {
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
+    cb_state->DirtyActionState(vvl::CommandBuffer::kActionStateAll);
 
     cb_state->rendering_attachments.set_color_locations = true;
     cb_state->rendering_attachments.color_locations.resize(pLocationInfo->colorAttachmentCount);
@@ -5182,6 +5308,7 @@ void ValidationStateTracker::PostCallRecordCmdSetRenderingAttachmentLocationsKHR
 void ValidationStateTracker::PostCallRecordCmdSetRenderingInputAttachmentIndicesKHR(VkCommandBuffer commandBuffer,
     const VkRenderingInputAttachmentIndexInfoKHR* pLocationInfo, const RecordObject& record_obj) {
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
+    cb_state->DirtyActionState(vvl::CommandBuffer::kActionStateAll);
 
     cb_state->rendering_attachments.set_color_indexes = true;
     cb_state->rendering_attachments.color_indexes.resize(pLocationInfo->colorAttachmentCount);
@@ -5558,7 +5685,7 @@ void ValidationStateTracker::PostCallRecordGetShaderModuleCreateInfoIdentifierEX
                                                                                   VkShaderModuleIdentifierEXT *pIdentifier,
                                                                                   const RecordObject &record_obj) {
     WriteLockGuard guard(shader_identifier_map_lock_);
-    shader_identifier_map_.emplace(*pIdentifier, std::make_shared<vvl::ShaderModule>(0));
+    shader_identifier_map_.emplace(*pIdentifier, vvl::MakeState<vvl::ShaderModule>(0));
 }
 
 void ValidationStateTracker::PreCallRecordCmdBindShadersEXT(VkCommandBuffer commandBuffer, uint32_t stageCount,
@@ -5583,7 +5710,10 @@ void ValidationStateTracker::PostCallRecordGetBufferDeviceAddress(VkDevice devic
 
         BufferAddressInfillUpdateOps ops{{buffer_state.get()}};
         sparse_container::infill_update_range(buffer_address_map_, address_range, ops);
-        buffer_device_address_ranges_version++;
+        // Applications can query the address of a buffer many times, only a new range or buffer needs a new snapshot
+        if (ops.changed) {
+            PublishBufferAddressSnapshot();
+        }
     }
 }
 
@@ -5599,20 +5729,20 @@ void ValidationStateTracker::PostCallRecordGetBufferDeviceAddressEXT(VkDevice de
 
 std::shared_ptr<vvl::Swapchain> ValidationStateTracker::CreateSwapchainState(const VkSwapchainCreateInfoKHR *pCreateInfo,
                                                                              VkSwapchainKHR handle) {
-    return std::make_shared<vvl::Swapchain>(*this, pCreateInfo, handle);
+    return vvl::MakeState<vvl::Swapchain>(*this, pCreateInfo, handle);
 }
 
 std::shared_ptr<vvl::CommandBuffer> ValidationStateTracker::CreateCmdBufferState(VkCommandBuffer handle,
                                                                                  const VkCommandBufferAllocateInfo *pAllocateInfo,
                                                                                  const vvl::CommandPool *pool) {
-    return std::make_shared<vvl::CommandBuffer>(*this, handle, pAllocateInfo, pool);
+    return vvl::MakeState<vvl::CommandBuffer>(*this, handle, pAllocateInfo, pool);
 }
 
 std::shared_ptr<vvl::DeviceMemory> ValidationStateTracker::CreateDeviceMemoryState(
     VkDeviceMemory handle, const VkMemoryAllocateInfo *pAllocateInfo, uint64_t fake_address, const VkMemoryType &memory_type,
     const VkMemoryHeap &memory_heap, std::optional<vvl::DedicatedBinding> &&dedicated_binding, uint32_t physical_device_count) {
-    return std::make_shared<vvl::DeviceMemory>(handle, pAllocateInfo, fake_address, memory_type, memory_heap,
-                                               std::move(dedicated_binding), physical_device_count);
+    return vvl::MakeState<vvl::DeviceMemory>(handle, pAllocateInfo, fake_address, memory_type, memory_heap,
+                                             std::move(dedicated_binding), physical_device_count);
 }
 
 void ValidationStateTracker::PostCallRecordCmdBindTransformFeedbackBuffersEXT(VkCommandBuffer commandBuffer, uint32_t firstBinding,
@@ -5622,6 +5752,7 @@ void ValidationStateTracker::PostCallRecordCmdBindTransformFeedbackBuffersEXT(Vk
                                                                               const RecordObject &record_obj) {
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
     cb_state->transform_feedback_buffers_bound = bindingCount;
+    cb_state->DirtyActionState(vvl::CommandBuffer::kActionStateAll);
 }
 
 void ValidationStateTracker::PreCallRecordLatencySleepNV(VkDevice device, VkSwapchainKHR swapchain,
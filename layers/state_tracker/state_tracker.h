@@ -22,13 +22,20 @@
 #include "generated/chassis.h"
 #include "utils/hash_vk_types.h"
 #include "state_tracker/video_session_state.h"
+#include "state_tracker/render_pass_state.h"
 #include "generated/layer_chassis_dispatch.h"
 #include "generated/state_tracker_helper.h"
 #include "error_message/logging.h"
 #include "containers/custom_containers.h"
+#include "containers/sharded_counter.h"
+#include "containers/slab_state_map.h"
+#include "containers/string_pool.h"
+#include "utils/epoch.h"
 #include "utils/android_ndk_types.h"
 #include "containers/range_vector.h"
+#include "containers/subresource_adapter.h"
 #include <vulkan/utility/vk_struct_helper.hpp>
+#include <algorithm>
 #include <atomic>
 #include <functional>
 #include <memory>
@@ -42,6 +49,7 @@ class DescriptorSet;
 class DescriptorSetLayout;
 class DescriptorUpdateTemplate;
 class Queue;
+class QueueRetirePool;
 class Semaphore;
 class Buffer;
 class BufferView;
@@ -71,6 +79,10 @@ struct ShaderModule;
 struct ShaderObject;
 }  // namespace vvl
 
+namespace spirv {
+struct Module;
+}  // namespace spirv
+
 namespace chassis {
 struct CreateShaderModule;
 }  // namespace chassis
@@ -80,7 +92,7 @@ struct CreateShaderModule;
 using ShaderModuleUniqueIds = std::unordered_map<VkShaderStageFlagBits, uint32_t>;
 
 #define VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, instance_scope)        \
-    vvl::concurrent_unordered_map<handle_type, std::shared_ptr<state_type>> map_member;               \
+    vvl::SlabStateMap<handle_type, std::shared_ptr<state_type>> map_member;                           \
     template <typename Dummy>                                                                         \
     struct MapTraits<state_type, Dummy> {                                                             \
         static constexpr bool kInstanceScope = instance_scope;                                        \
@@ -280,7 +292,7 @@ class ValidationStateTracker : public ValidationObject {
     void Add(std::shared_ptr<State>&& state_object) {
         auto& map = GetStateMap<State>();
         auto handle = state_object->Handle().template Cast<HandleType>();
-        state_object->SetId(object_id_++);
+        state_object->SetId(vvl::BlockIdGenerator<vvl::StateObject::IdType>::Next());
         // Finish setting up the object node tree, which cannot be done from the state object contructors
         // due to use of shared_from_this()
         state_object->LinkChildNodes();
@@ -293,6 +305,8 @@ class ValidationStateTracker : public ValidationObject {
         auto iter = map.pop(handle);
         if (iter != map.end()) {
             iter->second->Destroy();
+            // Other threads may still use the state through GetBorrowed()
+            retired_states_.Retire(std::move(iter->second));
         }
     }
 
@@ -358,6 +372,16 @@ class ValidationStateTracker : public ValidationObject {
         return std::static_pointer_cast<State>(std::move(found_it->second));
     }
 
+    // For checks that only read the state during the call: no reference is taken, the state is kept alive by the epoch
+    // guard held by the returned object instead, even if another thread destroys the handle meanwhile. Nothing that
+    // outlives the call may keep the pointer, use Get() for that.
+    template <typename State, typename Traits = typename state_object::Traits<State>>
+    vvl::Borrowed<const State> GetBorrowed(typename Traits::HandleType handle) const {
+        vvl::EpochGuard guard;
+        const auto* state = static_cast<const State*>(GetStateMap<State>().FindBorrowed(handle));
+        return vvl::Borrowed<const State>(state, std::move(guard));
+    }
+
     // GetRead() and GetWrite() return an already locked state object. Currently this is only supported by
     // vvl::CommandBuffer, because it has public ReadLock() and WriteLock() methods.
     // NOTE: Calling base class hook methods with a vvl::CommandBuffer lock held will lead to deadlock. Instead,
@@ -399,6 +423,9 @@ class ValidationStateTracker : public ValidationObject {
         return found_it->second;
     }
 
+    // For the validation of a submission, before the command buffer is locked (see CommandBuffer::ApplyDeferredInvalidations)
+    void ApplyDeferredInvalidations(VkCommandBuffer command_buffer) const;
+
     // From the spec:
     // If multiple VkBuffer objects are bound to overlapping ranges of VkDeviceMemory, implementations may return
     // address ranges which overlap. In this case, it is ambiguous which VkBuffer is associated with any given
@@ -408,37 +435,50 @@ class ValidationStateTracker : public ValidationObject {
     // more efficient to store them using raw pointers. It is safe to do so (at time of writing) because those raw pointers come
     // from shared ones created when the buffer is first recorded, and they are removed from buffer_address_map_ at BufferDestroy
     // time
+    // Lookups do not take buffer_address_lock_: they search the last published snapshot of buffer_address_map_, kept alive
+    // by an epoch guard while it is searched.
     vvl::span<vvl::Buffer*> GetBuffersByAddress(VkDeviceAddress address) {
-        ReadLockGuard guard(buffer_address_lock_);
-        auto found_it = buffer_address_map_.find(address);
-        if (found_it == buffer_address_map_.end()) {
-            return vvl::make_span<vvl::Buffer*>(nullptr, static_cast<size_t>(0));
+        vvl::EpochGuard guard;
+        const BufferAddressSnapshot* snapshot = buffer_address_snapshot_ptr_.load(std::memory_order_acquire);
+        if (BufferAddressMapStore* buffers = snapshot ? snapshot->Find(address) : nullptr) {
+            return vvl::make_span<vvl::Buffer*>(buffers->data(), buffers->size());
         }
-        return found_it->second;
+        return vvl::make_span<vvl::Buffer*>(nullptr, static_cast<size_t>(0));
     }
 
     vvl::span<vvl::Buffer* const> GetBuffersByAddress(VkDeviceAddress address) const {
-        ReadLockGuard guard(buffer_address_lock_);
-        auto found_it = buffer_address_map_.find(address);
-        if (found_it == buffer_address_map_.end()) {
-            return vvl::make_span<vvl::Buffer* const>(nullptr, static_cast<size_t>(0));
+        vvl::EpochGuard guard;
+        const BufferAddressSnapshot* snapshot = buffer_address_snapshot_ptr_.load(std::memory_order_acquire);
+        if (const BufferAddressMapStore* buffers = snapshot ? snapshot->Find(address) : nullptr) {
+            return vvl::make_span<vvl::Buffer* const>(buffers->data(), buffers->size());
         }
-        return found_it->second;
+        return vvl::make_span<vvl::Buffer* const>(nullptr, static_cast<size_t>(0));
     }
 
-    // Return a count pair, {written addresses count, total address ranges count}
+    // Write all the address ranges, sorted from low to high, in out_ranges.
+    // Return the buffer_device_address_ranges_version they correspond to.
     using BufferAddressRange = sparse_container::range<VkDeviceAddress>;
-    [[nodiscard]] std::pair<size_t, size_t> GetBufferAddressRanges(BufferAddressRange* ranges, size_t ranges_size) const {
-        ReadLockGuard guard(buffer_address_lock_);
+    uint32_t GetBufferAddressRanges(std::vector<BufferAddressRange>& out_ranges) const {
+        vvl::EpochGuard guard;
+        const BufferAddressSnapshot* snapshot = buffer_address_snapshot_ptr_.load(std::memory_order_acquire);
 
-        size_t written_count = 0;
-        for (const auto& [address_range, buffers] : buffer_address_map_) {
-            if (written_count == ranges_size) {
-                break;
-            }
-            ranges[written_count++] = address_range;
+        out_ranges.clear();
+        if (!snapshot) {
+            return 0;
         }
-        return {written_count, buffer_address_map_.size()};
+        out_ranges.reserve(snapshot->entries.size());
+        for (const auto& entry : snapshot->entries) {
+            out_ranges.emplace_back(entry.range);
+        }
+        return snapshot->version;
+    }
+
+    // Changes whenever a buffer with a device address is added or removed, results derived from GetBuffersByAddress() can be
+    // cached for a version
+    uint32_t GetBufferAddressRangesVersion() const {
+        vvl::EpochGuard guard;
+        const BufferAddressSnapshot* snapshot = buffer_address_snapshot_ptr_.load(std::memory_order_acquire);
+        return snapshot ? snapshot->version : 0;
     }
 
     using SetImageViewInitialLayoutCallback = std::function<void(vvl::CommandBuffer*, const vvl::ImageView&, VkImageLayout)>;
@@ -476,6 +516,8 @@ class ValidationStateTracker : public ValidationObject {
 
     virtual std::shared_ptr<vvl::Queue> CreateQueue(VkQueue handle, uint32_t queue_family_index, VkDeviceQueueCreateFlags flags,
                                                     const VkQueueFamilyProperties& queueFamilyProperties);
+    // Null when each queue retires its submissions on its own thread
+    vvl::QueueRetirePool* GetQueueRetirePool() const { return queue_retire_pool.get(); }
 
     void PostCallRecordGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue,
                                       const RecordObject& record_obj) override;
@@ -1453,6 +1495,18 @@ class ValidationStateTracker : public ValidationObject {
     std::vector<std::shared_ptr<const vvl::ImageView>> GetAttachmentViews(const VkRenderPassBeginInfo& rp_begin,
                                                                           const vvl::Framebuffer& fb_state) const;
 
+    // Format features reported by the physical device, including the VkFormatProperties3 flags when supported, and the
+    // tiling features of each DRM format modifier when VK_EXT_image_drm_format_modifier is enabled
+    struct FormatFeatures {
+        VkFormatFeatureFlags2KHR linear_tiling = 0;
+        VkFormatFeatureFlags2KHR optimal_tiling = 0;
+        VkFormatFeatureFlags2KHR buffer = 0;
+        // < drmFormatModifier, drmFormatModifierTilingFeatures >
+        std::vector<std::pair<uint64_t, VkFormatFeatureFlags2KHR>> drm_format_modifiers;
+    };
+    // The driver is only queried the first time each format is used
+    const FormatFeatures& GetFormatFeatures(VkFormat format) const;
+    VkFormatFeatureFlags2KHR GetImageFormatFeatures(VkImage image, VkFormat format, VkImageTiling tiling) const;
     VkFormatFeatureFlags2KHR GetPotentialFormatFeatures(VkFormat format) const;
     void PerformUpdateDescriptorSetsWithTemplateKHR(VkDescriptorSet descriptorSet,
                                                     const vvl::DescriptorUpdateTemplate* template_state, const void* pData);
@@ -1864,10 +1918,39 @@ class ValidationStateTracker : public ValidationObject {
     uint32_t buffer_device_address_ranges_version = 0;
 
     mutable vvl::VideoProfileDesc::Cache video_profile_cache_;
+    mutable vvl::MemoryRequirementsCache memory_requirements_cache_;
+    mutable subresource_adapter::ImageRangeEncoderCache image_range_encoder_cache_;
+    // Engines create the same render passes over and over (ex. one per material or per swapchain image)
+    vvl::RenderPassAnalysisCache render_pass_analysis_cache_;
+    // Names of the debug labels of all the command buffers. Interned, so recording a label and replaying the labels of a
+    // submission copy no strings: most engines reuse a small set of names every frame.
+    vvl::StringPool label_names_;
 
     using BufferAddressMapStore = small_vector<vvl::Buffer*, 1, size_t>;
     using BufferAddressRangeMap = sparse_container::range_map<VkDeviceAddress, BufferAddressMapStore>;
 
+    // Immutable copy of buffer_address_map_, as a sorted array that can be binary searched without a lock.
+    // The buffer list of a range is shared with the previous snapshot when it did not change, so a span returned by
+    // GetBuffersByAddress() stays valid as long as the buffers of its range are not modified, like with the map itself.
+    struct BufferAddressSnapshot {
+        struct Entry {
+            BufferAddressRange range;
+            std::shared_ptr<BufferAddressMapStore> buffers;
+        };
+        std::vector<Entry> entries;
+        uint32_t version = 0;
+
+        BufferAddressMapStore* Find(VkDeviceAddress address) const {
+            auto it = std::upper_bound(entries.begin(), entries.end(), address,
+                                       [](VkDeviceAddress value, const Entry& entry) { return value < entry.range.begin; });
+            if (it == entries.begin()) {
+                return nullptr;
+            }
+            --it;
+            return it->range.includes(address) ? it->buffers.get() : nullptr;
+        }
+    };
+
   protected:
     // tracks which queue family index were used when creating the device for quick lookup
     vvl::unordered_set<uint32_t> queue_family_index_set;
@@ -1880,8 +1963,17 @@ class ValidationStateTracker : public ValidationObject {
     };
     std::vector<DeviceQueueInfo> device_queue_info_list;
     // If vkGetBufferDeviceAddress is called, keep track of buffer <-> address mapping.
+    // buffer_address_lock_ only serializes the updates, which publish a new snapshot of the map for the lookups.
     BufferAddressRangeMap buffer_address_map_;
     mutable std::shared_mutex buffer_address_lock_;
+    std::shared_ptr<BufferAddressSnapshot> buffer_address_snapshot_;
+    std::atomic<const BufferAddressSnapshot*> buffer_address_snapshot_ptr_{nullptr};
+    // Must be called with buffer_address_lock_ held, after buffer_address_map_ was modified
+    void PublishBufferAddressSnapshot();
+
+    // < format, features >, filled by GetFormatFeatures, entries are never removed so references to them stay valid
+    mutable vvl::unordered_map<VkFormat, FormatFeatures> format_features_cache_;
+    mutable std::shared_mutex format_features_cache_lock_;
 
     // < external format, features >
     vvl::concurrent_unordered_map<uint64_t, VkFormatFeatureFlags2KHR> ahb_ext_formats_map;
@@ -1896,6 +1988,16 @@ class ValidationStateTracker : public ValidationObject {
     vvl::unordered_map<VkShaderModuleIdentifierEXT, std::shared_ptr<vvl::ShaderModule>> shader_identifier_map_;
     mutable std::shared_mutex shader_identifier_map_lock_;
 
+    // Identical SPIR-V binaries share their words and parse (spirv::Module::SharedData), this finds the live module of a
+    // code hash. An entry lives as long as the last module created from it, expired entries are removed when the map
+    // grows past shared_spirv_sweep_size_.
+    std::shared_ptr<spirv::Module> FindSharedSpirv(uint64_t code_hash, const uint32_t *code, size_t word_count);
+    void AddSharedSpirv(uint64_t code_hash, const std::shared_ptr<spirv::Module> &module_state);
+    static constexpr size_t kMinSharedSpirvSweepSize = 64;
+    vvl::unordered_map<uint64_t, std::weak_ptr<spirv::Module>> shared_spirv_map_;
+    size_t shared_spirv_sweep_size_ = kMinSharedSpirvSweepSize;
+    std::mutex shared_spirv_lock_;
+
     // If vkGetMemoryFdKHR is called, keep track of fd handle -> allocation info
     vvl::unordered_map<int, ExternalOpaqueInfo> fd_handle_map_;
     mutable std::shared_mutex fd_handle_map_lock_;
@@ -1907,6 +2009,9 @@ class ValidationStateTracker : public ValidationObject {
 #endif
 
   private:
+    // Declared before the maps, as the state objects destroyed with the maps can retire others
+    vvl::EpochRetireList retired_states_;
+
     VALSTATETRACK_MAP_AND_TRAITS(VkQueue, vvl::Queue, queue_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkAccelerationStructureNV, vvl::AccelerationStructureNV, acceleration_structure_nv_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkRenderPass, vvl::RenderPass, render_pass_map_)
@@ -1941,7 +2046,9 @@ class ValidationStateTracker : public ValidationObject {
     VALSTATETRACK_MAP_AND_TRAITS_INSTANCE_SCOPE(VkDisplayModeKHR, vvl::DisplayMode, display_mode_map_)
     VALSTATETRACK_MAP_AND_TRAITS_INSTANCE_SCOPE(VkPhysicalDevice, vvl::PhysicalDevice, physical_device_map_)
 
-    std::atomic<vvl::StateObject::IdType> object_id_{1}; // 0 is an invalid id
+    // Switches the maps of the wrapped non-dispatchable handles to slot indexing, see vvl::SlabStateMap
+    void UseSlabIdStateMaps();
+
 
     // Simple base address allocator allow allow VkDeviceMemory allocations to appear to exist in a common address space.
     // At 256GB allocated/sec  ( > 8GB at 30Hz), will overflow in just over 2 years
@@ -19,7 +19,11 @@
  */
 #pragma once
 
+#include <array>
+
 #include "vulkan/vulkan.h"
+#include "containers/custom_containers.h"
+#include "containers/fixed_bitset.h"
 
 namespace vvl {
 class Buffer;
@@ -35,6 +39,57 @@ struct VertexBufferBinding {
     void reset() { *this = VertexBufferBinding(); }
 };
 
+// The vertex buffer bindings of a command buffer, indexed by binding number with a mask of the bindings that were set, so
+// the draw time validation walks the set bits instead of hashing each binding. Binding numbers are below
+// maxVertexInputBindings, which is 32 on most implementations, the higher ones go to a map.
+class VertexBufferBindings {
+  public:
+    static constexpr uint32_t kInlineBindings = 32;
+
+    // Like std::unordered_map::operator[], a binding that was not set starts out as a default VertexBufferBinding
+    VertexBufferBinding &operator[](uint32_t binding) {
+        if (binding >= kInlineBindings) {
+            return high_bindings_[binding];
+        }
+        if (!set_mask_.test(binding)) {
+            set_mask_.set(binding);
+            bindings_[binding].reset();
+        }
+        return bindings_[binding];
+    }
+
+    // nullptr if the binding was not set
+    const VertexBufferBinding *Find(uint32_t binding) const {
+        if (binding >= kInlineBindings) {
+            auto it = high_bindings_.find(binding);
+            return it != high_bindings_.end() ? &it->second : nullptr;
+        }
+        return set_mask_.test(binding) ? &bindings_[binding] : nullptr;
+    }
+
+    bool empty() const { return set_mask_.none() && high_bindings_.empty(); }
+    void clear() {
+        set_mask_.reset();
+        if (!high_bindings_.empty()) {
+            high_bindings_.clear();
+        }
+    }
+
+    // Calls func(uint32_t binding, const VertexBufferBinding &) for each binding that was set
+    template <typename Func>
+    void ForEach(Func &&func) const {
+        set_mask_.ForEachSetBit([&](size_t binding) { func(static_cast<uint32_t>(binding), bindings_[binding]); });
+        for (const auto &entry : high_bindings_) {
+            func(entry.first, entry.second);
+        }
+    }
+
+  private:
+    std::array<VertexBufferBinding, kInlineBindings> bindings_;
+    FixedBitset<64> set_mask_;
+    vvl::unordered_map<uint32_t, VertexBufferBinding> high_bindings_;
+};
+
 struct IndexBufferBinding {
     VkBuffer buffer;  // VK_NULL_HANDLE is valid if using nullDescriptor
     VkDeviceSize size;
@@ -329,8 +329,7 @@ void VideoSessionDeviceState::Reset() {
     initialized_ = true;
     for (size_t i = 0; i < is_active_.size(); ++i) {
         is_active_[i] = false;
-        all_pictures_[i].clear();
-        pictures_per_id_[i].clear();
+        pictures_[i] = {};
     }
     encode_.quality_level = 0;
     encode_.rate_control_state = VideoEncodeRateControlState();
@@ -341,57 +340,38 @@ void VideoSessionDeviceState::Activate(int32_t slot_index, const VideoPictureID
 
     is_active_[slot_index] = true;
 
-    if (picture_id.IsFrame()) {
+    auto &pictures = pictures_[slot_index];
+    const uint32_t kind = GetPictureKind(picture_id);
+    if (kind == kFrame) {
         // If slot is activated with a frame then it overrides all previous pictures
-        all_pictures_[slot_index].clear();
-        pictures_per_id_[slot_index].clear();
+        pictures = {};
     }
-
-    auto prev_res_it = pictures_per_id_[slot_index].find(picture_id);
-    if (prev_res_it != pictures_per_id_[slot_index].end()) {
-        // If we replace an existing picture then remove it
-        all_pictures_[slot_index].erase(prev_res_it->second);
-    }
-
-    all_pictures_[slot_index].insert(res);
-    pictures_per_id_[slot_index][picture_id] = res;
+    pictures[kind] = res;
 }
 
 void VideoSessionDeviceState::Invalidate(int32_t slot_index, const VideoPictureID &picture_id) {
     assert(!picture_id.IsBothFields());
 
-    bool previous_is_frame = pictures_per_id_[slot_index].find(VideoPictureID::Frame()) != pictures_per_id_[slot_index].end();
-    if (picture_id.IsFrame() || previous_is_frame) {
+    auto &pictures = pictures_[slot_index];
+    const uint32_t kind = GetPictureKind(picture_id);
+    if (kind == kFrame || pictures[kFrame]) {
         // If invalidation happens due to a non-reference setup frame then it invalidates all previous pictures
         // Also invalidate all if the previous picture reference was a frame (e.g. a field invalidates a previous frame)
-        all_pictures_[slot_index].clear();
-        pictures_per_id_[slot_index].clear();
+        pictures = {};
     } else {
-        // Invalidate any existing picture reference with the specified id by removing it
-        auto prev_res_it = pictures_per_id_[slot_index].find(picture_id);
-        if (prev_res_it != pictures_per_id_[slot_index].end()) {
-            VideoPictureResource res = prev_res_it->second;
-            pictures_per_id_[slot_index].erase(picture_id);
-            // Check if there are any more references to the previous resource
-            auto other_ref_it = std::find_if(std::begin(pictures_per_id_[slot_index]), std::end(pictures_per_id_[slot_index]),
-                                             [&res](const auto &it) { return it.second == res; });
-            if (other_ref_it == pictures_per_id_[slot_index].end()) {
-                // If there are no remaining references to the resource, remove it
-                all_pictures_[slot_index].erase(res);
-            }
-        }
+        // Invalidate any existing picture reference with the specified id
+        pictures[kind] = {};
     }
 
     // If there are no remaining picture references then deactivate the slot
-    if (pictures_per_id_[slot_index].empty()) {
+    if (std::none_of(pictures.begin(), pictures.end(), [](const VideoPictureResource &picture) { return bool(picture); })) {
         is_active_[slot_index] = false;
     }
 }
 
 void VideoSessionDeviceState::Deactivate(int32_t slot_index) {
     is_active_[slot_index] = false;
-    all_pictures_[slot_index].clear();
-    pictures_per_id_[slot_index].clear();
+    pictures_[slot_index] = {};
 }
 
 class RateControlStateMismatchRecorder {
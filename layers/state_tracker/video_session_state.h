@@ -18,6 +18,8 @@
 #include "state_tracker/state_object.h"
 #include "utils/hash_util.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
+#include <algorithm>
+#include <array>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -422,20 +424,20 @@ class VideoSessionDeviceState {
     VideoSessionDeviceState(uint32_t reference_slot_count = 0)
         : initialized_(false),
           is_active_(reference_slot_count, false),
-          all_pictures_(reference_slot_count),
-          pictures_per_id_(reference_slot_count),
+          pictures_(reference_slot_count),
           encode_() {}
 
     bool IsInitialized() const { return initialized_; }
     bool IsSlotActive(int32_t slot_index) const { return is_active_[slot_index]; }
 
     bool IsSlotPicture(int32_t slot_index, const VideoPictureResource &res) const {
-        return all_pictures_[slot_index].find(res) != all_pictures_[slot_index].end();
+        const auto &pictures = pictures_[slot_index];
+        return res && std::find(pictures.begin(), pictures.end(), res) != pictures.end();
     }
 
     bool IsSlotPicture(int32_t slot_index, const VideoPictureID &picture_id, const VideoPictureResource &res) const {
-        auto it = pictures_per_id_[slot_index].find(picture_id);
-        return it != pictures_per_id_[slot_index].end() && it->second == res;
+        const uint32_t kind = GetPictureKind(picture_id);
+        return kind < kPictureKindCount && pictures_[slot_index][kind] && pictures_[slot_index][kind] == res;
     }
 
     uint32_t GetEncodeQualityLevel() const { return encode_.quality_level; }
@@ -455,10 +457,21 @@ class VideoSessionDeviceState {
                                   const vku::safe_VkVideoBeginCodingInfoKHR &begin_info, const Location &loc) const;
 
   private:
+    // A DPB slot holds either a frame or a picture per field, so the pictures of a slot are stored by kind instead of in
+    // hashed containers. This keeps the lookups to a few comparisons, and the copy made for each submission flat.
+    enum PictureKind : uint32_t { kFrame, kTopField, kBottomField, kPictureKindCount };
+    using SlotPictures = std::array<VideoPictureResource, kPictureKindCount>;
+
+    static uint32_t GetPictureKind(const VideoPictureID &picture_id) {
+        if (picture_id.IsFrame()) return kFrame;
+        if (picture_id.IsTopField()) return kTopField;
+        if (picture_id.IsBottomField()) return kBottomField;
+        return kPictureKindCount;
+    }
+
     bool initialized_;
     std::vector<bool> is_active_;
-    std::vector<VideoPictureResources> all_pictures_;
-    std::vector<unordered_map<VideoPictureID, VideoPictureResource, VideoPictureID::hash>> pictures_per_id_;
+    std::vector<SlotPictures> pictures_;
 
     struct {
         uint32_t quality_level{0};
@@ -19,6 +19,8 @@
 #include "stateless/stateless_validation.h"
 #include "generated/enum_flag_bits.h"
 
+#include <cstring>
+
 ReadLockGuard StatelessValidation::ReadLock() const { return ReadLockGuard(validation_object_mutex, std::defer_lock); }
 WriteLockGuard StatelessValidation::WriteLock() { return WriteLockGuard(validation_object_mutex, std::defer_lock); }
 
@@ -647,6 +649,25 @@ bool StatelessValidation::ValidateViewport(const VkViewport &viewport, VkCommand
     return skip;
 }
 
+// Applications commonly set the same viewport for every index, so a viewport that is bitwise identical to the previous one
+// that passed validation is known to be valid and is not checked again. Invalid viewports are always re-checked so each
+// index still reports its own errors.
+bool StatelessValidation::ValidateViewportArray(uint32_t viewportCount, const VkViewport *pViewports, VkCommandBuffer object,
+                                                const Location &loc) const {
+    bool skip = false;
+    const VkViewport *last_valid_viewport = nullptr;
+    for (uint32_t viewport_i = 0; viewport_i < viewportCount; ++viewport_i) {
+        const auto &viewport = pViewports[viewport_i];  // will crash on invalid ptr
+        if (last_valid_viewport && std::memcmp(last_valid_viewport, &viewport, sizeof(VkViewport)) == 0) {
+            continue;
+        }
+        const bool viewport_skip = ValidateViewport(viewport, object, loc.dot(Field::pViewports, viewport_i));
+        last_valid_viewport = viewport_skip ? nullptr : &viewport;
+        skip |= viewport_skip;
+    }
+    return skip;
+}
+
 bool StatelessValidation::manual_PreCallValidateFreeCommandBuffers(VkDevice device, VkCommandPool commandPool,
                                                                    uint32_t commandBufferCount,
                                                                    const VkCommandBuffer *pCommandBuffers,
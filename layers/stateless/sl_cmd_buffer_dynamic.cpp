@@ -42,10 +42,7 @@ bool StatelessValidation::manual_PreCallValidateCmdSetViewportWithCount(VkComman
     }
 
     if (pViewports) {
-        for (uint32_t viewport_i = 0; viewport_i < viewportCount; ++viewport_i) {
-            const auto &viewport = pViewports[viewport_i];  // will crash on invalid ptr
-            skip |= ValidateViewport(viewport, commandBuffer, error_obj.location.dot(Field::pViewports, viewport_i));
-        }
+        skip |= ValidateViewportArray(viewportCount, pViewports, commandBuffer, error_obj.location);
     }
 
     return skip;
@@ -492,10 +489,7 @@ bool StatelessValidation::manual_PreCallValidateCmdSetViewport(VkCommandBuffer c
     }
 
     if (pViewports) {
-        for (uint32_t viewport_i = 0; viewport_i < viewportCount; ++viewport_i) {
-            const auto &viewport = pViewports[viewport_i];  // will crash on invalid ptr
-            skip |= ValidateViewport(viewport, commandBuffer, error_obj.location.dot(Field::pViewports, viewport_i));
-        }
+        skip |= ValidateViewportArray(viewportCount, pViewports, commandBuffer, error_obj.location);
     }
 
     return skip;
@@ -322,6 +322,7 @@ void StatelessValidation::PostCallRecordCreateDevice(VkPhysicalDevice physicalDe
 
     // Parmeter validation also uses extension data
     stateless_validation->device_extensions = this->device_extensions;
+    stateless_validation->InitValidEnumTables();
 
     VkPhysicalDeviceProperties device_properties = {};
     // Need to get instance and do a getlayerdata call...
@@ -117,7 +117,7 @@ static VkStringErrorFlags ValidateVkString(const int max_length, const char *utf
 }
 
 static const int kMaxParamCheckerStringLength = 256;
-bool StatelessValidation::ValidateString(const Location &loc, const std::string &vuid, const char *validateString) const {
+bool StatelessValidation::ValidateString(const Location &loc, const char *vuid, const char *validateString) const {
     bool skip = false;
 
     VkStringErrorFlags result = ValidateVkString(kMaxParamCheckerStringLength, validateString);
@@ -132,7 +132,7 @@ bool StatelessValidation::ValidateString(const Location &loc, const std::string
     return skip;
 }
 
-bool StatelessValidation::ValidateNotZero(bool is_zero, const std::string &vuid, const Location &loc) const {
+bool StatelessValidation::ValidateNotZero(bool is_zero, const char *vuid, const Location &loc) const {
     bool skip = false;
     if (is_zero) {
         skip |= LogError(vuid, device, loc, "is zero.");
@@ -149,7 +149,7 @@ bool StatelessValidation::ValidateNotZero(bool is_zero, const std::string &vuid,
  * @param value Pointer to validate.
  * @return Boolean value indicating that the call should be skipped.
  */
-bool StatelessValidation::ValidateRequiredPointer(const Location &loc, const void *value, const std::string &vuid) const {
+bool StatelessValidation::ValidateRequiredPointer(const Location &loc, const void *value, const char *vuid) const {
     bool skip = false;
 
     if (value == nullptr) {
@@ -216,8 +216,8 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
     bool skip = false;
 
     if (next != nullptr) {
-        vvl::unordered_set<const void *> cycle_check;
-        vvl::unordered_set<VkStructureType, vvl::hash<int>> unique_stype_check;
+        // Chains are short, a linear search on the stack beats hashing into a set allocated on every call
+        small_vector<VkStructureType, 16, uint32_t> unique_stype_check;
         const char *disclaimer =
             "This error is based on the Valid Usage documentation for version %" PRIu32
             " of the Vulkan header.  It is possible that "
@@ -237,13 +237,15 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
             while (current != nullptr) {
                 if ((loc.function != Func::vkCreateInstance || (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
                     (loc.function != Func::vkCreateDevice || (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
-                    std::string type_name = string_VkStructureType(current->sType);
-                    if (unique_stype_check.find(current->sType) != unique_stype_check.end() && !IsDuplicatePnext(current->sType)) {
+                    if (std::find(unique_stype_check.begin(), unique_stype_check.end(), current->sType) !=
+                            unique_stype_check.end() &&
+                        !IsDuplicatePnext(current->sType)) {
                         // stype_vuid will only be null if there are no listed pNext and will hit disclaimer check
                         skip |= LogError(stype_vuid, device, pNext_loc,
-                                         "chain contains duplicate structure types: %s appears multiple times.", type_name.c_str());
+                                         "chain contains duplicate structure types: %s appears multiple times.",
+                                         string_VkStructureType(current->sType));
                     } else {
-                        unique_stype_check.insert(current->sType);
+                        unique_stype_check.emplace_back(current->sType);
                     }
 
                     // Search custom stype list -- if sType found, skip this entirely
@@ -256,8 +258,9 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
                     }
                     if (!custom) {
                         if (std::find(start, end, current->sType) == end) {
+                            const char *type_name = string_VkStructureType(current->sType);
                             // String returned by string_VkStructureType for an unrecognized type.
-                            if (type_name.compare("Unhandled VkStructureType") == 0) {
+                            if (strcmp(type_name, "Unhandled VkStructureType") == 0) {
                                 std::string message = "chain includes a structure with unknown VkStructureType (%" PRIu32 "). ";
                                 message += disclaimer;
                                 skip |= LogError(pnext_vuid, device, pNext_loc, message.c_str(), current->sType, header_version,
@@ -265,7 +268,7 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
                             } else {
                                 std::string message = "chain includes a structure with unexpected VkStructureType %s. ";
                                 message += disclaimer;
-                                skip |= LogError(pnext_vuid, device, pNext_loc, message.c_str(), type_name.c_str(), header_version,
+                                skip |= LogError(pnext_vuid, device, pNext_loc, message.c_str(), type_name, header_version,
                                                  pNext_loc.Fields().c_str());
                             }
                         }
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <bitset>
 #include <vulkan/utility/vk_struct_helper.hpp>
 #include "sync/sync_utils.h"
 #include "utils/vk_layer_utils.h"
@@ -85,9 +86,9 @@ class StatelessValidation : public ValidationObject {
         }
     }
 
-    bool ValidateNotZero(bool is_zero, const std::string &vuid, const Location &loc) const;
+    bool ValidateNotZero(bool is_zero, const char *vuid, const Location &loc) const;
 
-    bool ValidateRequiredPointer(const Location &loc, const void *value, const std::string &vuid) const;
+    bool ValidateRequiredPointer(const Location &loc, const void *value, const char *vuid) const;
 
     template <typename T1, typename T2>
     bool ValidateArray(const Location &count_loc, const Location &array_loc, T1 count, const T2 *array, bool countRequired,
@@ -399,6 +400,7 @@ class StatelessValidation : public ValidationObject {
     template <typename T>
     bool ValidateRangedEnum(const Location &loc, vvl::Enum name, T value, const char *vuid) const {
         bool skip = false;
+        if (IsValidEnumTableValue(name, value)) return skip;
         ValidValue result = IsValidEnumValue(value);
 
         if (result == ValidValue::NotFound) {
@@ -448,6 +450,7 @@ class StatelessValidation : public ValidationObject {
                                   array_required_vuid);
         } else {
             for (uint32_t i = 0; i < count; ++i) {
+                if (IsValidEnumTableValue(name, array[i])) continue;
                 ValidValue result = IsValidEnumValue(array[i]);
                 if (result == ValidValue::NotFound) {
                     skip |= LogError(array_required_vuid, device, array_loc.dot(i),
@@ -491,6 +494,29 @@ class StatelessValidation : public ValidationObject {
     template <typename T>
     vvl::Extensions GetEnumExtensions(T value) const;
 
+    // Bit N of valid_enum_tables[name] is set when the value N of the enum is valid with the enabled device extensions.
+    // Only the core token block is covered, extension added tokens start at 1,000,000,000.
+    static constexpr uint32_t kValidEnumTableSize = 256;
+    std::vector<std::bitset<kValidEnumTableSize>> valid_enum_tables;
+    void InitValidEnumTables();
+    template <typename T>
+    void InitValidEnumTable(vvl::Enum name) {
+        const auto index = static_cast<size_t>(name);
+        if (index >= valid_enum_tables.size()) {
+            valid_enum_tables.resize(index + 1);
+        }
+        for (uint32_t value = 0; value < kValidEnumTableSize; ++value) {
+            valid_enum_tables[index][value] = IsValidEnumValue(static_cast<T>(value)) == ValidValue::Valid;
+        }
+    }
+    // False only means the value needs the full IsValidEnumValue check
+    template <typename T>
+    bool IsValidEnumTableValue(vvl::Enum name, T value) const {
+        const auto index = static_cast<size_t>(name);
+        const auto raw_value = static_cast<uint32_t>(value);
+        return raw_value < kValidEnumTableSize && index < valid_enum_tables.size() && valid_enum_tables[index][raw_value];
+    }
+
     // VkFlags values don't have a way overload, so need to use vvl::FlagBitmask
     vvl::Extensions IsValidFlagValue(vvl::FlagBitmask flag_bitmask, VkFlags value, const DeviceExtensions &device_extensions) const;
     vvl::Extensions IsValidFlag64Value(vvl::FlagBitmask flag_bitmask, VkFlags64 value,
@@ -533,7 +559,7 @@ class StatelessValidation : public ValidationObject {
                                                      VkPhysicalDeviceGroupProperties *pPhysicalDeviceGroupProperties,
                                                      const RecordObject &record_obj) override;
 
-    bool ValidateString(const Location &loc, const std::string &vuid, const char *validateString) const;
+    bool ValidateString(const Location &loc, const char *vuid, const char *validateString) const;
 
     bool ValidateCoarseSampleOrderCustomNV(const VkCoarseSampleOrderCustomNV &order, const Location &order_loc) const;
 
@@ -579,6 +605,8 @@ class StatelessValidation : public ValidationObject {
                                                                   const ErrorObject &error_obj) const;
 
     bool ValidateViewport(const VkViewport &viewport, VkCommandBuffer object, const Location &loc) const;
+    bool ValidateViewportArray(uint32_t viewportCount, const VkViewport *pViewports, VkCommandBuffer object,
+                               const Location &loc) const;
 
     bool manual_PreCallValidateCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo *pCreateInfo,
                                                     const VkAllocationCallbacks *pAllocator, VkPipelineLayout *pPipelineLayout,
@@ -15,15 +15,20 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cinttypes>
 #include "state_tracker/buffer_state.h"
 #include "state_tracker/video_session_state.h"
 #include "state_tracker/render_pass_state.h"
 #include "sync/sync_access_context.h"
 #include "sync/sync_image.h"
+#include "utils/worker_pool.h"
 
 bool SimpleBinding(const vvl::Bindable &bindable) { return !bindable.sparse && bindable.Binding(); }
 VkDeviceSize ResourceBaseAddress(const vvl::Buffer &buffer) { return buffer.GetFakeBaseAddress(); }
+ResourceAccessRange BufferAccessRange(const vvl::Buffer &buffer, const ResourceAccessRange &range) {
+    return static_cast<const syncval_state::BufferState &>(buffer).MakeAccessRange(range);
+}
 
 class HazardDetector {
     const SyncStageAccessInfoType &usage_info_;
@@ -73,7 +78,9 @@ class HazardDetectFirstUse {
 
 AccessContext::AccessContext(uint32_t subpass, VkQueueFlags queue_flags,
                              const std::vector<SubpassDependencyGraphNode> &dependencies,
-                             const std::vector<AccessContext> &contexts, const AccessContext *external_context) {
+                             const std::vector<AccessContext> &contexts, const AccessContext *external_context)
+    // Subpass contexts live as long as the context they are nested in, so they can share its allocator
+    : access_state_map_(external_context ? external_context->GetAllocator() : ResourceAccessRangeMapAllocator()) {
     Reset();
     const auto &subpass_dep = dependencies[subpass];
     const bool has_barrier_from_external = subpass_dep.barrier_from_external.size() > 0U;
@@ -105,6 +112,8 @@ AccessContext::AccessContext(uint32_t subpass, VkQueueFlags queue_flags,
 
 template <typename NormalizeOp>
 void AccessContext::Trim(NormalizeOp &&normalize) {
+    first_use_index_.Clear();
+    ApplyDeferredGlobalBarriers();
     ForAll(std::forward<NormalizeOp>(normalize));
     sparse_container::consolidate(access_state_map_);
 }
@@ -122,6 +131,12 @@ void AccessContext::TrimAndClearFirstAccess() {
     Trim(normalize);
 }
 
+void AccessContext::Consolidate() {
+    first_use_index_.Clear();
+    ApplyDeferredGlobalBarriers();
+    sparse_container::consolidate(access_state_map_);
+}
+
 void AccessContext::AddReferencedTags(ResourceUsageTagSet &used) const {
     auto gather = [&used](const ResourceAccessRangeMap::value_type &access) { access.second.GatherReferencedTags(used); };
     ConstForAll(gather);
@@ -142,6 +157,7 @@ void AccessContext::ConstForAll(Action &&action) const {
 }
 
 void AccessContext::ResolveFromContext(const AccessContext &from) {
+    ApplyDeferredGlobalBarriers();
     const NoopBarrierAction noop_barrier;
     from.ResolveAccessRange(kFullRange, noop_barrier, &access_state_map_, nullptr);
 }
@@ -176,15 +192,16 @@ void AccessContext::ResolvePreviousAccesses() {
     ResourceAccessState default_state;
     if (!prev_.size()) return;  // If no previous contexts, nothing to do
 
+    ApplyDeferredGlobalBarriers();
     ResolvePreviousAccess(kFullRange, &access_state_map_, &default_state);
 }
 
 void AccessContext::UpdateAccessState(const vvl::Buffer &buffer, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
                                       const ResourceAccessRange &range, const ResourceUsageTag tag) {
     if (!SimpleBinding(buffer)) return;
-    const auto base_address = ResourceBaseAddress(buffer);
-    UpdateMemoryAccessStateFunctor action(*this, current_usage, ordering_rule, tag);
-    UpdateMemoryAccessRangeState(access_state_map_, action, range + base_address);
+    UpdateMemoryAccessStateFunctor update_action(*this, current_usage, ordering_rule, tag);
+    const ApplyDeferredBarriersAction<UpdateMemoryAccessStateFunctor> action{*this, update_action};
+    UpdateMemoryAccessRangeState(access_state_map_, action, BufferAccessRange(buffer, range));
 }
 
 void AccessContext::UpdateAccessState(const ImageState &image, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
@@ -211,6 +228,12 @@ void AccessContext::UpdateAccessState(const ImageViewState &image_view, SyncStag
 
 void AccessContext::UpdateAccessState(const ImageViewState &image_view, SyncStageAccessIndex current_usage,
                                       SyncOrdering ordering_rule, ResourceUsageTag tag) {
+    if (image_view.HasFullViewRanges()) {
+        auto range_gen = image_view.MakeFullViewRangeListGen();
+        UpdateMemoryAccessStateFunctor action(*this, current_usage, ordering_rule, tag);
+        UpdateMemoryAccessState(action, range_gen);
+        return;
+    }
     // Get is const, and will be copied in callee
     UpdateAccessState(image_view.GetFullViewImageRangeGen(), current_usage, ordering_rule, tag);
 }
@@ -247,6 +270,7 @@ void AccessContext::UpdateAccessState(const ImageRangeGen &range_gen, SyncStageA
 }
 
 void AccessContext::ResolveChildContexts(const std::vector<AccessContext> &contexts) {
+    ApplyDeferredGlobalBarriers();
     for (uint32_t subpass_index = 0; subpass_index < contexts.size(); subpass_index++) {
         auto &context = contexts[subpass_index];
         ApplyTrackbackStackAction barrier_action(context.GetDstExternalTrackBack().barriers);
@@ -254,9 +278,43 @@ void AccessContext::ResolveChildContexts(const std::vector<AccessContext> &conte
     }
 }
 
+void AccessContext::DeferGlobalBarriers(QueueId queue_id, const std::vector<SyncBarrier> &barriers, ResourceUsageTag tag) {
+    if (deferred_barriers_.size() >= kMaxDeferredGlobalBarriers) {
+        ApplyDeferredGlobalBarriers();
+    }
+    deferred_barriers_.emplace_back(DeferredGlobalBarrier{queue_id, tag, barriers});
+}
+
+void AccessContext::ApplyDeferredGlobalBarriers() {
+    if (deferred_barriers_.empty()) return;
+    for (auto &access : access_state_map_) {
+        ApplyDeferredGlobalBarriers(access.second);
+    }
+    deferred_barriers_begin_ = DeferredBarriersEnd();
+    deferred_barriers_.clear();
+}
+
+// Same effect as the eager ApplyBarrierOpsFunctor walk the barriers would have done when recorded, with resolve
+void AccessContext::ApplyDeferredGlobalBarriers(ResourceAccessState &access) const {
+    const uint32_t end_seq = DeferredBarriersEnd();
+    for (uint32_t seq = std::max(access.DeferredBarrierSeq(), deferred_barriers_begin_); seq < end_seq; ++seq) {
+        const DeferredGlobalBarrier &deferred = deferred_barriers_[seq - deferred_barriers_begin_];
+        ResourceAccessState::QueueScopeOps scope(deferred.queue_id);
+        for (const SyncBarrier &barrier : deferred.barriers) {
+            access.ApplyBarrier(scope, barrier, false);
+        }
+        access.ApplyPendingBarriers(deferred.tag);
+    }
+    access.SetDeferredBarrierSeq(end_seq);
+}
+
 // Caller must ensure that lifespan of this is less than the lifespan of from
 void AccessContext::ImportAsyncContexts(const AccessContext &from) {
     async_.insert(async_.end(), from.async_.begin(), from.async_.end());
+    if (from.async_frontier_) {
+        assert(!async_frontier_ || async_frontier_ == from.async_frontier_);
+        async_frontier_ = from.async_frontier_;
+    }
 }
 
 // Suitable only for *subpass* access contexts
@@ -281,16 +339,54 @@ HazardResult AccessContext::DetectSubpassTransitionHazard(const TrackBack &track
 
 void AccessContext::AddAsyncContext(const AccessContext *context, ResourceUsageTag tag, QueueId queue_id) {
     if (context) {
-        async_.emplace_back(*context, tag, queue_id);
+        if (!async_frontier_) {
+            async_frontier_ = std::make_shared<AsyncFrontier>();
+        } else if (async_frontier_.use_count() > 1) {
+            // Don't change the frontier under the contexts that imported it
+            async_frontier_ = std::make_shared<AsyncFrontier>(*async_frontier_);
+        }
+        async_frontier_->Add(context->GetAccessStateMap(), tag, queue_id);
+    }
+}
+
+void AsyncFrontier::Add(const ResourceAccessRangeMap &map, ResourceUsageTag start_tag, QueueId queue_id) {
+    const auto source_index = static_cast<uint32_t>(sources_.size());
+    sources_.emplace_back(Source{start_tag, queue_id});
+
+    std::vector<Entry> added;
+    for (auto pos = map.cbegin(); pos != map.cend(); ++pos) {
+        if (pos->second.HasAsyncAccess(start_tag, queue_id)) {
+            added.emplace_back(Entry{pos->first, pos, source_index});
+        }
+    }
+    if (added.empty()) return;
+
+    std::vector<Entry> merged;
+    merged.reserve(entries_.size() + added.size());
+    std::merge(entries_.begin(), entries_.end(), added.begin(), added.end(), std::back_inserter(merged),
+               [](const Entry &a, const Entry &b) { return a.range.begin < b.range.begin; });
+    entries_ = std::move(merged);
+
+    max_end_.resize(entries_.size());
+    ResourceAddress max_end = 0;
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        max_end = std::max(max_end, entries_[i].range.end);
+        max_end_[i] = max_end;
     }
 }
 
 HazardResult AccessContext::DetectHazard(const vvl::Buffer &buffer, SyncStageAccessIndex usage_index,
                                          const ResourceAccessRange &range) const {
     if (!SimpleBinding(buffer)) return HazardResult();
-    const auto base_address = ResourceBaseAddress(buffer);
     HazardDetector detector(usage_index);
-    return DetectHazardRange(detector, (range + base_address), DetectOptions::kDetectAll);
+    HazardResult hazard = DetectHazardRange(detector, BufferAccessRange(buffer, range), DetectOptions::kDetectAll);
+    const auto &buffer_state = static_cast<const syncval_state::BufferState &>(buffer);
+    if (hazard.IsHazard() && buffer_state.IsCoarselyTracked()) {
+        // The hazard may come from an access to another part of the buffer, check again with the exact range
+        buffer_state.PromoteToPreciseTracking();
+        hazard = DetectHazardRange(detector, BufferAccessRange(buffer, range), DetectOptions::kDetectAll);
+    }
+    return hazard;
 }
 
 template <typename Detector>
@@ -328,8 +424,12 @@ HazardResult AccessContext::DetectHazard(const ImageState &image, SyncStageAcces
 }
 
 HazardResult AccessContext::DetectHazard(const ImageViewState &image_view, SyncStageAccessIndex current_usage) const {
-    // Get is const, but callee will copy
     HazardDetector detector(current_usage);
+    if (image_view.HasFullViewRanges()) {
+        auto range_gen = image_view.MakeFullViewRangeListGen();
+        return DetectHazardGeneratedRanges(detector, range_gen, DetectOptions::kDetectAll);
+    }
+    // Get is const, but callee will copy
     return DetectHazardGeneratedRanges(detector, image_view.GetFullViewImageRangeGen(), DetectOptions::kDetectAll);
 }
 
@@ -519,7 +619,13 @@ ResourceAccessRangeMap::iterator AccessContext::UpdateMemoryAccessStateFunctor::
     // this is only called on gaps, and never returns a gap.
     ResourceAccessState default_state;
     context.ResolvePreviousAccess(range, accesses, &default_state);
-    return accesses->lower_bound(range);
+    // Barriers don't cross context boundaries, so the imported states must not see the global barriers already deferred
+    const auto inserted = accesses->lower_bound(range);
+    const uint32_t end_seq = context.DeferredBarriersEnd();
+    for (auto pos = inserted; pos != accesses->end() && pos->first.begin < range.end; ++pos) {
+        pos->second.SetDeferredBarrierSeq(end_seq);
+    }
+    return inserted;
 }
 void AccessContext::UpdateMemoryAccessStateFunctor::operator()(const ResourceAccessRangeMap::iterator &pos) const {
     auto &access_state = pos->second;
@@ -529,19 +635,109 @@ void AccessContext::UpdateMemoryAccessStateFunctor::operator()(const ResourceAcc
 // This is called with the *recorded* command buffers access context, with the *active* access context pass in, againsts which
 // hazards will be detected
 HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
-                                                 const AccessContext &access_context) const {
+                                                 const AccessContext &access_context, vvl::WorkerPool *worker_pool) const {
+    // Below this many entries, handing the work to other threads costs more than the detection itself
+    constexpr size_t kMinEntriesPerChunk = 64;
+
     HazardResult hazard;
-    for (const auto &recorded_access : access_state_map_) {
-        // Cull any entries not in the current tag range
-        if (!recorded_access.second.FirstAccessInTagRange(tag_range)) continue;
-        HazardDetectFirstUse detector(recorded_access.second, queue_id, tag_range);
-        hazard = access_context.DetectHazardRange(detector, recorded_access.first, DetectOptions::kDetectAll);
-        if (hazard.IsHazard()) break;
+    const FirstUseIndex::Entries *indexed = first_use_index_.Find(tag_range);
+    const size_t candidate_count = indexed ? indexed->size() : access_state_map_.size();
+    if (!worker_pool || worker_pool->GetThreadCount() == 0 || candidate_count < 2 * kMinEntriesPerChunk) {
+        auto detect = [&](const ResourceAccessRangeMap::value_type &recorded_access) {
+            // Cull any entries not in the current tag range
+            if (!recorded_access.second.FirstAccessInTagRange(tag_range)) return false;
+            HazardDetectFirstUse detector(recorded_access.second, queue_id, tag_range);
+            hazard = access_context.DetectHazardRange(detector, recorded_access.first, DetectOptions::kDetectAll);
+            return hazard.IsHazard();
+        };
+        if (indexed) {
+            for (const auto &pos : *indexed) {
+                if (detect(*pos)) break;
+            }
+        } else {
+            for (const auto &recorded_access : access_state_map_) {
+                if (detect(recorded_access)) break;
+            }
+        }
+        return hazard;
+    }
+
+    // Detection only reads the recorded and the active contexts, so the entries can be checked from any thread. The entries
+    // are split in chunks in map order, and the first hazard of the lowest chunk that has one is the hazard the serial
+    // loop would have found. Chunks after a chunk with a hazard stop early since their result is not needed.
+    std::vector<ResourceAccessRangeMap::const_iterator> first_uses;
+    first_uses.reserve(candidate_count);
+    if (indexed) {
+        for (const auto &pos : *indexed) {
+            if (pos->second.FirstAccessInTagRange(tag_range)) {
+                first_uses.emplace_back(pos);
+            }
+        }
+    } else {
+        for (auto pos = access_state_map_.cbegin(); pos != access_state_map_.cend(); ++pos) {
+            if (pos->second.FirstAccessInTagRange(tag_range)) {
+                first_uses.emplace_back(pos);
+            }
+        }
     }
 
+    const size_t max_chunks = 4 * (size_t(worker_pool->GetThreadCount()) + 1);
+    const uint32_t chunk_count =
+        static_cast<uint32_t>(std::min(max_chunks, (first_uses.size() + kMinEntriesPerChunk - 1) / kMinEntriesPerChunk));
+    std::vector<HazardResult> chunk_hazards(chunk_count);
+    std::atomic<uint32_t> first_hazard_chunk{chunk_count};
+
+    worker_pool->ParallelFor(chunk_count, [&](uint32_t chunk) {
+        const size_t chunk_begin = first_uses.size() * chunk / chunk_count;
+        const size_t chunk_end = first_uses.size() * (chunk + 1) / chunk_count;
+        for (size_t i = chunk_begin; i < chunk_end; ++i) {
+            if (first_hazard_chunk.load(std::memory_order_relaxed) < chunk) return;
+            const auto &recorded_access = *first_uses[i];
+            HazardDetectFirstUse detector(recorded_access.second, queue_id, tag_range);
+            HazardResult chunk_hazard =
+                access_context.DetectHazardRange(detector, recorded_access.first, DetectOptions::kDetectAll);
+            if (chunk_hazard.IsHazard()) {
+                chunk_hazards[chunk] = std::move(chunk_hazard);
+                uint32_t current = first_hazard_chunk.load(std::memory_order_relaxed);
+                while (chunk < current && !first_hazard_chunk.compare_exchange_weak(current, chunk, std::memory_order_relaxed)) {
+                }
+                return;
+            }
+        }
+    });
+
+    // ParallelFor returning orders the writes of chunk_hazards before this read
+    const uint32_t hazard_chunk = first_hazard_chunk.load(std::memory_order_relaxed);
+    if (hazard_chunk < chunk_count) {
+        hazard = std::move(chunk_hazards[hazard_chunk]);
+    }
     return hazard;
 }
 
+void FirstUseIndex::Build(const ResourceAccessRangeMap &map, std::vector<ResourceUsageTag> &&segment_begins) {
+    assert(!segment_begins.empty() && segment_begins.front() == 0);
+    segment_begins_ = std::move(segment_begins);
+    segments_.assign(segment_begins_.size(), Entries());
+    for (auto pos = map.cbegin(); pos != map.cend(); ++pos) {
+        const ResourceUsageRange first_tags = pos->second.FirstAccessTagRange();
+        if (!first_tags.non_empty()) continue;
+        auto segment = static_cast<size_t>(
+            std::upper_bound(segment_begins_.begin(), segment_begins_.end(), first_tags.begin) - segment_begins_.begin() - 1);
+        for (; segment < segment_begins_.size() && segment_begins_[segment] < first_tags.end; ++segment) {
+            segments_[segment].emplace_back(pos);
+        }
+    }
+}
+
+const FirstUseIndex::Entries *FirstUseIndex::Find(const ResourceUsageRange &tag_range) const {
+    if (segment_begins_.empty()) return nullptr;
+    const auto segment = static_cast<size_t>(
+        std::upper_bound(segment_begins_.begin(), segment_begins_.end(), tag_range.begin) - segment_begins_.begin() - 1);
+    const bool last_segment = (segment + 1) == segment_begins_.size();
+    if (!last_segment && tag_range.end > segment_begins_[segment + 1]) return nullptr;
+    return &segments_[segment];
+}
+
 // For RenderPass time validation this is "start tag", for QueueSubmit, this is the earliest
 // unsynchronized tag for the Queue being tested against (max synchrononous + 1, perhaps)
 ResourceUsageTag AccessContext::AsyncReference::StartTag() const { return (tag_ == kInvalidTag) ? context_->StartTag() : tag_; }
@@ -17,6 +17,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+
 #include "sync/sync_common.h"
 #include "sync/sync_access_state.h"
 
@@ -28,6 +32,7 @@ class VideoSession;
 class VideoPictureResource;
 class Bindable;
 class Event;
+class WorkerPool;
 }  // namespace vvl
 
 namespace syncval_state {
@@ -36,6 +41,8 @@ class ImageViewState;
 }  // namespace syncval_state
 bool SimpleBinding(const vvl::Bindable &bindable);
 VkDeviceSize ResourceBaseAddress(const vvl::Buffer &buffer);
+// The global address range tracked for the |range| of |buffer|, all of the buffer when it is coarsely tracked
+ResourceAccessRange BufferAccessRange(const vvl::Buffer &buffer, const ResourceAccessRange &range);
 
 // ForEachEntryInRangesUntil -- Execute Action for each map entry in the generated ranges until it returns true
 //
@@ -244,6 +251,61 @@ class AttachmentViewGen {
 
 using AttachmentViewGenVector = std::vector<AttachmentViewGen>;
 
+// Lists the access map entries with first accesses in each tag segment of a recorded command buffer, where the segments
+// are split at the tags of the sync ops. Replaying the command buffer detects first use hazards one segment at a time, and
+// with the index each segment only walks its own entries instead of the whole map. The index refers into the map it was
+// built from, so copies of the owning context start out without one.
+class FirstUseIndex {
+  public:
+    using Entries = std::vector<ResourceAccessRangeMap::const_iterator>;
+    FirstUseIndex() = default;
+    FirstUseIndex(const FirstUseIndex &) {}
+    FirstUseIndex &operator=(const FirstUseIndex &) {
+        Clear();
+        return *this;
+    }
+
+    // |segment_begins| is sorted and starts with 0, the last segment extends to the end of the tag space
+    void Build(const ResourceAccessRangeMap &map, std::vector<ResourceUsageTag> &&segment_begins);
+    void Clear() {
+        segment_begins_.clear();
+        segments_.clear();
+    }
+    // The entries, in map order, that can have first accesses in |tag_range|. Null when there is no index or the range
+    // isn't within a single segment.
+    const Entries *Find(const ResourceUsageRange &tag_range) const;
+
+  private:
+    std::vector<ResourceUsageTag> segment_begins_;
+    std::vector<Entries> segments_;
+};
+
+// The accesses of the queue batches running asynchronously to a submission that can still race with it. Only the entries
+// with an access from the batch queue at or after the batch start tag are kept, merged across batches in address order,
+// so a hazard check does one lookup instead of walking the map of every async batch.
+class AsyncFrontier {
+  public:
+    // |map| must not change while the frontier is in use. Deferred global barriers don't touch the tags and queues
+    // checked for async hazards, so they needn't be applied first.
+    void Add(const ResourceAccessRangeMap &map, ResourceUsageTag start_tag, QueueId queue_id);
+    template <typename Detector, typename RangeGen>
+    HazardResult DetectHazard(const Detector &detector, RangeGen range_gen) const;
+
+  private:
+    struct Source {
+        ResourceUsageTag start_tag;
+        QueueId queue_id;
+    };
+    struct Entry {
+        ResourceAccessRange range;
+        ResourceAccessRangeMap::const_iterator pos;
+        uint32_t source_index;
+    };
+    std::vector<Source> sources_;
+    std::vector<Entry> entries_;             // Sorted by range.begin, entries of different sources can overlap
+    std::vector<ResourceAddress> max_end_;  // max_end_[i] is the largest range.end of entries_[0..i]
+};
+
 class AccessContext {
   public:
     using ImageState = syncval_state::ImageState;
@@ -284,18 +346,24 @@ class AccessContext {
                                           const VkImageSubresourceRange &subresource_range, DetectOptions options) const;
     HazardResult DetectSubpassTransitionHazard(const TrackBack &track_back, const AttachmentViewGen &attach_view) const;
 
-    HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
-                                      const AccessContext &access_context) const;
+    // With a worker pool, large recorded contexts are split in chunks of entries that are checked concurrently. The result
+    // is the same hazard the serial search reports.
+    HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range, const AccessContext &access_context,
+                                      vvl::WorkerPool *worker_pool = nullptr) const;
 
     const TrackBack &GetDstExternalTrackBack() const { return dst_external_; }
     void Reset() {
         prev_.clear();
         prev_by_subpass_.clear();
         async_.clear();
+        async_frontier_.reset();
         src_external_ = nullptr;
         dst_external_ = TrackBack();
         start_tag_ = ResourceUsageTag();
         access_state_map_.clear();
+        deferred_barriers_.clear();
+        deferred_barriers_begin_ = 0;
+        first_use_index_.Clear();
     }
 
     void ResolvePreviousAccesses();
@@ -330,23 +398,41 @@ class AccessContext {
     void ResolveChildContexts(const std::vector<AccessContext> &contexts);
 
     void ImportAsyncContexts(const AccessContext &from);
-    void ClearAsyncContexts() { async_.clear(); }
+    void ClearAsyncContexts() {
+        async_.clear();
+        async_frontier_.reset();
+    }
     template <typename Action>
     void ApplyUpdateAction(const AttachmentViewGen &view_gen, AttachmentViewGen::Gen gen_type, const Action &action);
     template <typename Action>
     void ApplyToContext(const Action &barrier_action);
 
+    // Global memory barriers recorded into a command buffer are kept in a log, and each access state applies the ones it
+    // hasn't seen yet when it is next read, written, or resolved. Copying the states out of the context applies them too.
+    void DeferGlobalBarriers(QueueId queue_id, const std::vector<SyncBarrier> &barriers, ResourceUsageTag tag);
+    void ApplyDeferredGlobalBarriers();
+
     AccessContext(uint32_t subpass, VkQueueFlags queue_flags, const std::vector<SubpassDependencyGraphNode> &dependencies,
                   const std::vector<AccessContext> &contexts, const AccessContext *external_context);
 
     AccessContext() { Reset(); }
+    // The access state map uses |allocator|, copies of the context use the default allocator
+    explicit AccessContext(const ResourceAccessRangeMapAllocator &allocator) : access_state_map_(allocator) { Reset(); }
     AccessContext(const AccessContext &copy_from) = default;
     void Trim();
     void TrimAndClearFirstAccess();
+    // Merges adjacent ranges holding equal access states, keeping the first accesses. Copies and clears over many
+    // subresources leave runs of identical states behind, and every later copy of the context would duplicate them.
+    void Consolidate();
+    // Only for contexts that won't change anymore, see FirstUseIndex
+    void BuildFirstUseIndex(std::vector<ResourceUsageTag> &&segment_begins) {
+        first_use_index_.Build(access_state_map_, std::move(segment_begins));
+    }
     void AddReferencedTags(ResourceUsageTagSet &referenced) const;
 
     ResourceAccessRangeMap &GetAccessStateMap() { return access_state_map_; }
     const ResourceAccessRangeMap &GetAccessStateMap() const { return access_state_map_; }
+    ResourceAccessRangeMapAllocator GetAllocator() const { return access_state_map_.get_implementation_map().get_allocator(); }
     const TrackBack *GetTrackBackFromSubpass(uint32_t subpass) const {
         if (subpass == VK_SUBPASS_EXTERNAL) {
             return src_external_;
@@ -392,6 +478,33 @@ class AccessContext {
     template <typename Action>
     static void UpdateMemoryAccessRangeState(ResourceAccessRangeMap &accesses, Action &action, const ResourceAccessRange &range);
 
+    struct DeferredGlobalBarrier {
+        QueueId queue_id;
+        ResourceUsageTag tag;
+        std::vector<SyncBarrier> barriers;
+    };
+    // Above this many deferred barriers they are applied to the whole map, which bounds the log and the catch up work
+    static constexpr size_t kMaxDeferredGlobalBarriers = 64;
+    uint32_t DeferredBarriersEnd() const { return deferred_barriers_begin_ + static_cast<uint32_t>(deferred_barriers_.size()); }
+    void ApplyDeferredGlobalBarriers(ResourceAccessState &access) const;
+    template <typename RangeGen>
+    void ApplyDeferredGlobalBarriers(const RangeGen &range_gen) const;
+
+    // Brings each state up to date with the deferred global barriers before the wrapped update action is applied
+    template <typename Action>
+    struct ApplyDeferredBarriersAction {
+        using Iterator = ResourceAccessRangeMap::iterator;
+        Iterator Infill(ResourceAccessRangeMap *accesses, const Iterator &pos, const ResourceAccessRange &range) const {
+            return action.Infill(accesses, pos, range);
+        }
+        void operator()(const Iterator &pos) const {
+            context.ApplyDeferredGlobalBarriers(pos->second);
+            action(pos);
+        }
+        const AccessContext &context;
+        const Action &action;
+    };
+
     struct UpdateMemoryAccessStateFunctor {
         using Iterator = ResourceAccessRangeMap::iterator;
         Iterator Infill(ResourceAccessRangeMap *accesses, const Iterator &pos, const ResourceAccessRange &range) const;
@@ -454,11 +567,17 @@ class AccessContext {
     template <typename Detector>
     HazardResult DetectPreviousHazard(Detector &detector, const ResourceAccessRange &range) const;
 
-    ResourceAccessRangeMap access_state_map_;
+    // Mutable as hazard detection applies the deferred global barriers to the states it reads
+    mutable ResourceAccessRangeMap access_state_map_;
+    std::vector<DeferredGlobalBarrier> deferred_barriers_;
+    uint32_t deferred_barriers_begin_;  // Sequence number of deferred_barriers_.front()
+    FirstUseIndex first_use_index_;
     std::vector<TrackBack> prev_;
     std::vector<TrackBack *> prev_by_subpass_;
     // These contexts *must* have the same lifespan as this context, or be cleared, before the referenced contexts can expire
     std::vector<AsyncReference> async_;
+    // The async queue batches added by AddAsyncContext, shared with the contexts importing them
+    std::shared_ptr<AsyncFrontier> async_frontier_;
     TrackBack *src_external_;
     TrackBack dst_external_;
     ResourceUsageTag start_tag_;
@@ -492,6 +611,7 @@ struct ActionToOpsAdapter {
 template <typename Action>
 void AccessContext::ApplyToContext(const Action &barrier_action) {
     // Note: Barriers do *not* cross context boundaries, applying to accessess within.... (at least for renderpass subpasses)
+    ApplyDeferredGlobalBarriers();
     UpdateMemoryAccessRangeState(access_state_map_, barrier_action, kFullRange);
 }
 
@@ -503,9 +623,23 @@ void AccessContext::UpdateMemoryAccessRangeState(ResourceAccessRangeMap &accesse
 }
 
 template <typename Action, typename RangeGen>
-void AccessContext::UpdateMemoryAccessState(const Action &action, RangeGen &range_gen) {
-    ActionToOpsAdapter<Action> ops{action};
-    infill_update_rangegen(access_state_map_, range_gen, ops);
+void AccessContext::UpdateMemoryAccessState(const Action &update_action, RangeGen &range_gen) {
+    const ApplyDeferredBarriersAction<Action> action{*this, update_action};
+    ActionToOpsAdapter<ApplyDeferredBarriersAction<Action>> ops{action};
+    if constexpr (std::is_same_v<RangeGen, ImageRangeGen>) {
+        // Image ranges are taken a batch at a time, with the contiguous ones merged by the generator
+        constexpr uint32_t kBatchSize = 16;
+        ResourceAccessRange ranges[kBatchSize];
+        auto pos = access_state_map_.lower_bound(*range_gen);
+        for (uint32_t count = range_gen.NextRanges(ranges, kBatchSize); count > 0;
+             count = range_gen.NextRanges(ranges, kBatchSize)) {
+            for (uint32_t i = 0; i < count; ++i) {
+                pos = infill_update_range(access_state_map_, pos, ranges[i], ops);
+            }
+        }
+    } else {
+        infill_update_rangegen(access_state_map_, range_gen, ops);
+    }
 }
 
 template <typename Action>
@@ -517,12 +651,42 @@ void AccessContext::ApplyUpdateAction(const AttachmentViewGen &view_gen, Attachm
     }
 }
 
+template <typename Detector, typename RangeGen>
+HazardResult AsyncFrontier::DetectHazard(const Detector &detector, RangeGen range_gen) const {
+    HazardResult hazard;
+    // Walking the async contexts one by one reports the first hazard in address order of the first context that has one
+    uint32_t hazard_source = std::numeric_limits<uint32_t>::max();
+    ResourceAddress hazard_address = std::numeric_limits<ResourceAddress>::max();
+    for (; range_gen->non_empty(); ++range_gen) {
+        const auto range = *range_gen;
+        // The first entry that can reach into the range, max_end_ is non decreasing
+        auto index = static_cast<size_t>(std::upper_bound(max_end_.begin(), max_end_.end(), range.begin) - max_end_.begin());
+        for (; index < entries_.size() && entries_[index].range.begin < range.end; ++index) {
+            const Entry &entry = entries_[index];
+            if (entry.range.end <= range.begin) continue;
+            if (entry.source_index > hazard_source ||
+                (entry.source_index == hazard_source && entry.range.begin >= hazard_address)) {
+                continue;
+            }
+            const Source &source = sources_[entry.source_index];
+            HazardResult entry_hazard = detector.DetectAsync(entry.pos, source.start_tag, source.queue_id);
+            if (entry_hazard.IsHazard()) {
+                hazard = std::move(entry_hazard);
+                hazard_source = entry.source_index;
+                hazard_address = entry.range.begin;
+            }
+        }
+    }
+    return hazard;
+}
+
 // A non recursive range walker for the asynchronous contexts (those we have no barriers with)
 template <typename Detector, typename RangeGen>
 HazardResult AccessContext::DetectAsyncHazard(const Detector &detector, const RangeGen &const_range_gen, ResourceUsageTag async_tag,
                                               QueueId async_queue_id) const {
     using RangeType = typename RangeGen::RangeType;
     using ConstIterator = ResourceAccessRangeMap::const_iterator;
+    ApplyDeferredGlobalBarriers(const_range_gen);
     RangeGen range_gen(const_range_gen);
 
     HazardResult hazard;
@@ -598,6 +762,8 @@ void AccessContext::ResolveAccessRange(const ResourceAccessRange &range, Barrier
         if (current->pos_B->valid) {
             const auto &src_pos = current->pos_B->lower_bound;
             ResourceAccessState access(src_pos->second);  // intentional copy
+            ApplyDeferredGlobalBarriers(access);
+            access.SetDeferredBarrierSeq(0);  // Sequence numbers are local to the context
             barrier_action(&access);
             if (current->pos_A->valid) {
                 const auto trimmed = sparse_container::split(current->pos_A->lower_bound, *resolve_map, current_range);
@@ -664,9 +830,14 @@ HazardResult AccessContext::DetectHazardGeneratedRanges(Detector &detector, Rang
             hazard = async_ref.Context().DetectAsyncHazard(detector, range_gen, async_ref.StartTag(), async_ref.GetQueueId());
             if (hazard.IsHazard()) return hazard;
         }
+        if (async_frontier_) {
+            hazard = async_frontier_->DetectHazard(detector, range_gen);
+            if (hazard.IsHazard()) return hazard;
+        }
     }
 
     const bool detect_prev = (static_cast<uint32_t>(options) & DetectOptions::kDetectPrevious) != 0;
+    ApplyDeferredGlobalBarriers(range_gen);
 
     using RangeType = typename RangeGen::RangeType;
     using ConstIterator = ResourceAccessRangeMap::const_iterator;
@@ -695,6 +866,7 @@ HazardResult AccessContext::DetectPreviousHazard(Detector &detector, const Resou
 
 template <typename Predicate>
 void AccessContext::EraseIf(Predicate &&pred) {
+    ApplyDeferredGlobalBarriers();
     // Note: Don't forward, we don't want r-values moved, since we're going to make multiple calls.
     vvl::EraseIf(access_state_map_, pred);
 }
@@ -702,17 +874,38 @@ void AccessContext::EraseIf(Predicate &&pred) {
 template <typename ResolveOp>
 void AccessContext::ResolveFromContext(ResolveOp &&resolve_op, const AccessContext &from_context,
                                        const ResourceAccessState *infill_state, bool recur_to_infill) {
+    ApplyDeferredGlobalBarriers();
     from_context.ResolveAccessRange(kFullRange, resolve_op, &access_state_map_, infill_state, recur_to_infill);
 }
 
 template <typename ResolveOp, typename RangeGenerator>
 void AccessContext::ResolveFromContext(ResolveOp &&resolve_op, const AccessContext &from_context, RangeGenerator range_gen,
                                        const ResourceAccessState *infill_state, bool recur_to_infill) {
+    ApplyDeferredGlobalBarriers();
     for (; range_gen->non_empty(); ++range_gen) {
         from_context.ResolveAccessRange(*range_gen, resolve_op, &access_state_map_, infill_state, recur_to_infill);
     }
 }
 
+template <typename RangeGen>
+void AccessContext::ApplyDeferredGlobalBarriers(const RangeGen &const_range_gen) const {
+    if (deferred_barriers_.empty()) return;
+
+    RangeGen range_gen(const_range_gen);
+    auto pos = access_state_map_.lower_bound(*range_gen);
+    const auto end = access_state_map_.end();
+    for (; range_gen->non_empty() && pos != end; ++range_gen) {
+        const auto range = *range_gen;
+        if (pos->first.strictly_less(range)) {
+            pos = access_state_map_.lower_bound(range);
+        }
+        // An entry spanning into the next range was already brought up to date, and pos is past it
+        for (; pos != end && pos->first.begin < range.end; ++pos) {
+            ApplyDeferredGlobalBarriers(pos->second);
+        }
+    }
+}
+
 template <typename BarrierAction>
 void AccessContext::ResolvePreviousAccessStack(const ResourceAccessRange &range, ResourceAccessRangeMap *descent_map,
                                                const ResourceAccessState *infill_state,
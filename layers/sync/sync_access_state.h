@@ -17,6 +17,7 @@
 
 #pragma once
 #include "sync/sync_common.h"
+#include "containers/monotonic_arena.h"
 
 class ResourceAccessState;
 class ResourceAccessWriteState;
@@ -208,7 +209,7 @@ class ResourceAccessWriteState {
     }
     bool WriteInChain(VkPipelineStageFlags2KHR src_exec_scope) const;
     bool WriteInScope(const SyncStageAccessFlags &src_access_scope) const;
-    bool WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope, SyncStageAccessFlags src_access_scope) const;
+    bool WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope, const SyncStageAccessFlags &src_access_scope) const;
     bool WriteInQueueSourceScopeOrChain(QueueId queue, VkPipelineStageFlags2KHR src_exec_scope,
                                         const SyncStageAccessFlags &src_access_scope) const;
 
@@ -268,24 +269,29 @@ class ResourceAccessState : public SyncStageAccess {
     // given the only the second execution scope creates a dependency chain, we have to track each,
     // but only up to one per pipeline stage (as another read from the *same* stage become more recent,
     // and applicable one for hazard detection
+    //
+    // Each read state records exactly one stage/access, so the access is kept as its index rather than as a full
+    // SyncStageAccessFlags mask. The read states are copied on every split of the access map, and the index is packed
+    // next to the queue id so that each read state is 24 bytes smaller.
     struct ReadState {
         VkPipelineStageFlags2KHR stage;        // The stage of this read
-        SyncStageAccessFlags access;           // TODO: Change to FlagBits when we have a None bit enum
-                                               // TODO: Revisit whether this needs to support multiple reads per stage
         VkPipelineStageFlags2KHR barriers;     // all applicable barriered stages
         VkPipelineStageFlags2KHR sync_stages;  // reads known to have happened after this
         ResourceUsageTag tag;
-        QueueId queue;
         VkPipelineStageFlags2KHR pending_dep_chain;  // Should be zero except during barrier application
                                                      // Excluded from comparison
+        QueueId queue;
+        // TODO: Revisit whether this needs to support multiple reads per stage
+        SyncStageAccessIndex access_index;
         ReadState() = default;
-        ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessFlags access_, VkPipelineStageFlags2KHR barriers_,
+        ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_index_, VkPipelineStageFlags2KHR barriers_,
                   ResourceUsageTag tag_);
         bool operator==(const ReadState &rhs) const {
-            return (stage == rhs.stage) && (access == rhs.access) && (barriers == rhs.barriers) &&
+            return (stage == rhs.stage) && (access_index == rhs.access_index) && (barriers == rhs.barriers) &&
                    (sync_stages == rhs.sync_stages) && (tag == rhs.tag) && (queue == rhs.queue) &&
                    (pending_dep_chain == rhs.pending_dep_chain);
         }
+        const SyncStageAccessInfoType &Access() const { return SyncStageAccess::UsageInfo(access_index); }
         void Normalize() { pending_dep_chain = VK_PIPELINE_STAGE_2_NONE; }
         bool IsReadBarrierHazard(VkPipelineStageFlags2KHR src_exec_scope) const {
             // If the read stage is not in the src sync scope
@@ -317,7 +323,7 @@ class ResourceAccessState : public SyncStageAccess {
         }
 
         bool operator!=(const ReadState &rhs) const { return !(*this == rhs); }
-        void Set(VkPipelineStageFlags2KHR stage_, const SyncStageAccessFlags &access_, VkPipelineStageFlags2KHR barriers_,
+        void Set(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_index_, VkPipelineStageFlags2KHR barriers_,
                  ResourceUsageTag tag_);
         bool ReadInScopeOrChain(VkPipelineStageFlags2 exec_scope) const { return (exec_scope & (stage | barriers)) != 0; }
         bool ReadInQueueScopeOrChain(QueueId queue, VkPipelineStageFlags2 exec_scope) const;
@@ -391,11 +397,18 @@ class ResourceAccessState : public SyncStageAccess {
     bool ApplyPredicatedWait(Predicate &predicate);
 
     bool FirstAccessInTagRange(const ResourceUsageRange &tag_range) const;
+    // The tags from the first to the last of the first accesses, empty when there are none
+    ResourceUsageRange FirstAccessTagRange() const;
+    // Whether there is a last access from |queue_id| at or after |start_tag|, only those can be asynchronous hazards
+    bool HasAsyncAccess(ResourceUsageTag start_tag, QueueId queue_id) const;
 
     void OffsetTag(ResourceUsageTag offset);
     ResourceAccessState();
 
     bool HasPendingState() const { return (0 != pending_layout_transition) || (last_write && last_write->HasPendingState()); }
+    // Sequence number of the first deferred global barrier of the owning AccessContext not yet applied to this state
+    uint32_t DeferredBarrierSeq() const { return deferred_barrier_seq_; }
+    void SetDeferredBarrierSeq(uint32_t seq) { deferred_barrier_seq_ = seq; }
     bool HasWriteOp() const { return last_write.has_value(); }
     SyncStageAccessIndex LastWriteOp() const { return last_write.has_value() ? last_write->Index() : SYNC_ACCESS_INDEX_NONE; }
     bool IsLastWriteOp(SyncStageAccessIndex usage_index) const { return LastWriteOp() == usage_index; }
@@ -421,7 +434,7 @@ class ResourceAccessState : public SyncStageAccess {
 
     bool IsWriteBarrierHazard(QueueId queue_id, VkPipelineStageFlags2KHR src_exec_scope,
                               const SyncStageAccessFlags &src_access_scope) const;
-    bool WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope, SyncStageAccessFlags src_access_scope) const;
+    bool WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope, const SyncStageAccessFlags &src_access_scope) const;
     bool WriteInQueueSourceScopeOrChain(QueueId queue, VkPipelineStageFlags2KHR src_exec_scope,
                                         const SyncStageAccessFlags &src_access_scope) const;
     bool WriteInEventScope(VkPipelineStageFlags2KHR src_exec_scope, const SyncStageAccessFlags &src_access_scope,
@@ -519,10 +532,22 @@ class ResourceAccessState : public SyncStageAccess {
     OrderingBarrier first_write_layout_ordering_;
     bool first_access_closed_;
 
+    uint32_t deferred_barrier_seq_;
+
     static OrderingBarriers kOrderingRules;
 };
 using ResourceAccessStateFunction = std::function<void(ResourceAccessState *)>;
-using ResourceAccessRangeMap = sparse_container::range_map<ResourceAddress, ResourceAccessState>;
+// Command buffer access contexts draw the map nodes from the arena of the command buffer, see CommandBufferAccessContext.
+// The other nodes are counted in the SyncValidation statistics of the layer allocator.
+using ResourceAccessRangeMapValue = std::pair<const ResourceAccessRange, ResourceAccessState>;
+using ResourceAccessRangeMapAllocator =
+    vvl::ArenaAllocator<ResourceAccessRangeMapValue,
+                        vvl::TrackedAllocator<ResourceAccessRangeMapValue, vvl::AllocationSubsystem::SyncValidation,
+                                              sparse_container::hot_range_map_allocator<ResourceAccessRangeMapValue>>>;
+using ResourceAccessRangeMap =
+    sparse_container::range_map<ResourceAddress, ResourceAccessState, ResourceAccessRange,
+                                std::map<ResourceAccessRange, ResourceAccessState, std::less<ResourceAccessRange>,
+                                         ResourceAccessRangeMapAllocator>>;
 using ResourceRangeMergeIterator = sparse_container::parallel_iterator<ResourceAccessRangeMap, const ResourceAccessRangeMap>;
 
 // Apply the memory barrier without updating the existing barriers.  The execution barrier
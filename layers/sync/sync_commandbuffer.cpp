@@ -24,6 +24,7 @@
 #include "state_tracker/buffer_state.h"
 #include "state_tracker/render_pass_state.h"
 #include "state_tracker/shader_module.h"
+#include "utils/hash_util.h"
 
 SyncStageAccessIndex GetSyncStageAccessIndexsByDescriptorSet(VkDescriptorType descriptor_type,
                                                              const spirv::ResourceInterfaceVariable &variable,
@@ -82,7 +83,8 @@ CommandBufferAccessContext::CommandBufferAccessContext(const SyncValidator *sync
       command_number_(0),
       subcommand_number_(0),
       reset_count_(0),
-      cb_access_context_(),
+      arena_(),
+      cb_access_context_(ResourceAccessRangeMapAllocator(&arena_)),
       current_context_(&cb_access_context_),
       events_context_(),
       render_pass_contexts_(),
@@ -123,6 +125,7 @@ void CommandBufferAccessContext::Reset() {
     subcommand_number_ = 0;
     reset_count_++;
     command_handles_.clear();
+    ClearReportedHazards();
     cb_access_context_.Reset();
     render_pass_contexts_.clear();
     current_context_ = &cb_access_context_;
@@ -131,6 +134,26 @@ void CommandBufferAccessContext::Reset() {
     dynamic_rendering_info_.reset();
 }
 
+void CommandBufferAccessContext::RecordEndCommandBuffer() {
+    // Every submission and vkCmdExecuteCommands copies the access map, so merge the equal entries left by copies and clears
+    cb_access_context_.Consolidate();
+
+    // Replay detects the first use hazards between the sync ops, and at the tag of each sync op for its layout transitions
+    std::vector<ResourceUsageTag> segment_begins = {0};
+    for (const auto &sync_op : sync_ops_) {
+        if (sync_op.tag > segment_begins.back()) {
+            segment_begins.emplace_back(sync_op.tag);
+        }
+        segment_begins.emplace_back(sync_op.tag + 1);
+    }
+    for (auto &rp_context : render_pass_contexts_) {
+        for (auto &subpass_context : rp_context->GetContexts()) {
+            subpass_context.BuildFirstUseIndex(std::vector<ResourceUsageTag>(segment_begins));
+        }
+    }
+    cb_access_context_.BuildFirstUseIndex(std::move(segment_begins));
+}
+
 std::string CommandBufferAccessContext::FormatUsage(const ResourceUsageTag tag) const {
     if (tag >= access_log_->size()) return std::string();
 
@@ -171,10 +194,11 @@ bool CommandBufferAccessContext::ValidateBeginRendering(const ErrorObject &error
         if (hazard.IsHazard()) {
             LogObjectList obj_list(cb_state_->Handle(), attachment.view->Handle());
             Location loc = attachment.GetLocation(error_obj.location, i);
-            skip |= sync_state_->LogError(string_SyncHazardVUID(hazard.Hazard()), obj_list, loc.dot(vvl::Field::imageView),
-                                          "(%s), with loadOp %s. Access info %s.",
-                                          sync_state_->FormatHandle(attachment.view->Handle()).c_str(),
-                                          string_VkAttachmentLoadOp(attachment.info.loadOp), FormatHazard(hazard).c_str());
+            skip |= LogHazard(hazard, obj_list, loc.dot(vvl::Field::imageView), [&]() {
+                return FormatHazardMessage("(%s), with loadOp %s. Access info %s.",
+                                           sync_state_->FormatHandle(attachment.view->Handle()).c_str(),
+                                           string_VkAttachmentLoadOp(attachment.info.loadOp), FormatHazard(hazard).c_str());
+            });
             if (skip) break;
         }
     }
@@ -213,10 +237,11 @@ bool CommandBufferAccessContext::ValidateEndRendering(const ErrorObject &error_o
         auto report_resolve_hazard = [this](const HazardResult &hazard, const Location &loc, const VulkanTypedHandle image_handle,
                                             const VkResolveModeFlagBits resolve_mode) {
             LogObjectList obj_list(cb_state_->Handle(), image_handle);
-            return sync_state_->LogError(string_SyncHazardVUID(hazard.Hazard()), obj_list, loc,
-                                         "(%s), during resolve with resolveMode %s. Access info %s.",
-                                         sync_state_->FormatHandle(image_handle).c_str(),
-                                         string_VkResolveModeFlagBits(resolve_mode), FormatHazard(hazard).c_str());
+            return LogHazard(hazard, obj_list, loc, [&]() {
+                return FormatHazardMessage("(%s), during resolve with resolveMode %s. Access info %s.",
+                                           sync_state_->FormatHandle(image_handle).c_str(),
+                                           string_VkResolveModeFlagBits(resolve_mode), FormatHazard(hazard).c_str());
+            });
         };
 
         for (uint32_t i = 0; i < attachment_count && !skip; i++) {
@@ -250,10 +275,12 @@ bool CommandBufferAccessContext::ValidateEndRendering(const ErrorObject &error_o
                     const VulkanTypedHandle image_handle = attachment.view->Handle();
                     LogObjectList obj_list(cb_state_->Handle(), image_handle);
                     Location loc = attachment.GetLocation(error_obj.location, i);
-                    skip |= sync_state_->LogError(
-                        string_SyncHazardVUID(hazard.Hazard()), obj_list, loc.dot(vvl::Field::imageView),
-                        "(%s), during store with storeOp %s. Access info %s.", sync_state_->FormatHandle(image_handle).c_str(),
-                        string_VkAttachmentStoreOp(attachment.info.storeOp), FormatHazard(hazard).c_str());
+                    skip |= LogHazard(hazard, obj_list, loc.dot(vvl::Field::imageView), [&]() {
+                        return FormatHazardMessage("(%s), during store with storeOp %s. Access info %s.",
+                                                   sync_state_->FormatHandle(image_handle).c_str(),
+                                                   string_VkAttachmentStoreOp(attachment.info.storeOp),
+                                                   FormatHazard(hazard).c_str());
+                    });
                 }
             }
         }
@@ -365,16 +392,18 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                         }
 
                         if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
-                            skip |= sync_state_->LogError(
-                                string_SyncHazardVUID(hazard.Hazard()), img_view_state->Handle(), loc,
-                                "Hazard %s for %s, in %s, and %s, %s, type: %s, imageLayout: %s, binding #%" PRIu32
-                                ", index %" PRIu32 ". Access info %s.",
-                                string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(img_view_state->Handle()).c_str(),
-                                sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
-                                sync_state_->FormatHandle(pipe->Handle()).c_str(),
-                                sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
-                                string_VkDescriptorType(descriptor_type), string_VkImageLayout(image_layout),
-                                variable.decorations.binding, index, FormatHazard(hazard).c_str());
+                            skip |= LogHazard(hazard, img_view_state->Handle(), loc, [&]() {
+                                return FormatHazardMessage("Hazard %s for %s, in %s, and %s, %s, type: %s, imageLayout: %s, "
+                                                           "binding #%" PRIu32 ", index %" PRIu32 ". Access info %s.",
+                                                           string_SyncHazard(hazard.Hazard()),
+                                                           sync_state_->FormatHandle(img_view_state->Handle()).c_str(),
+                                                           sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
+                                                           sync_state_->FormatHandle(pipe->Handle()).c_str(),
+                                                           sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
+                                                           string_VkDescriptorType(descriptor_type),
+                                                           string_VkImageLayout(image_layout), variable.decorations.binding, index,
+                                                           FormatHazard(hazard).c_str());
+                            });
                         }
                         break;
                     }
@@ -388,15 +417,16 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                         const ResourceAccessRange range = MakeRange(*buf_view_state);
                         auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
                         if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
-                            skip |= sync_state_->LogError(
-                                string_SyncHazardVUID(hazard.Hazard()), buf_view_state->Handle(), loc,
-                                "Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
-                                string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(buf_view_state->Handle()).c_str(),
-                                sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
-                                sync_state_->FormatHandle(pipe->Handle()).c_str(),
-                                sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
-                                string_VkDescriptorType(descriptor_type), variable.decorations.binding, index,
-                                FormatHazard(hazard).c_str());
+                            skip |= LogHazard(hazard, buf_view_state->Handle(), loc, [&]() {
+                                return FormatHazardMessage("Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. "
+                                                           "Access info %s.", string_SyncHazard(hazard.Hazard()),
+                                                           sync_state_->FormatHandle(buf_view_state->Handle()).c_str(),
+                                                           sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
+                                                           sync_state_->FormatHandle(pipe->Handle()).c_str(),
+                                                           sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
+                                                           string_VkDescriptorType(descriptor_type), variable.decorations.binding,
+                                                           index, FormatHazard(hazard).c_str());
+                            });
                         }
                         break;
                     }
@@ -410,15 +440,16 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                             MakeRange(*buf_state, buffer_descriptor->GetOffset(), buffer_descriptor->GetRange());
                         auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
                         if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
-                            skip |= sync_state_->LogError(
-                                string_SyncHazardVUID(hazard.Hazard()), buf_state->Handle(), loc,
-                                "Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
-                                string_SyncHazard(hazard.Hazard()), sync_state_->FormatHandle(buf_state->Handle()).c_str(),
-                                sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
-                                sync_state_->FormatHandle(pipe->Handle()).c_str(),
-                                sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
-                                string_VkDescriptorType(descriptor_type), variable.decorations.binding, index,
-                                FormatHazard(hazard).c_str());
+                            skip |= LogHazard(hazard, buf_state->Handle(), loc, [&]() {
+                                return FormatHazardMessage("Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. "
+                                                           "Access info %s.", string_SyncHazard(hazard.Hazard()),
+                                                           sync_state_->FormatHandle(buf_state->Handle()).c_str(),
+                                                           sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
+                                                           sync_state_->FormatHandle(pipe->Handle()).c_str(),
+                                                           sync_state_->FormatHandle(descriptor_set->Handle()).c_str(),
+                                                           string_VkDescriptorType(descriptor_type), variable.decorations.binding,
+                                                           index, FormatHazard(hazard).c_str());
+                            });
                         }
                         break;
                     }
@@ -540,13 +571,12 @@ bool CommandBufferAccessContext::ValidateDrawVertex(const std::optional<uint32_t
     // TODO - doesn't consider dynamic vertex binding input
     // https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/5281
     const auto &binding_buffers = cb_state_->current_vertex_buffer_binding_info;
-    const auto &binding_buffers_size = binding_buffers.size();
     const auto &binding_descriptions_size = pipe->vertex_input_state->binding_descriptions.size();
 
     for (size_t i = 0; i < binding_descriptions_size; ++i) {
         const auto &binding_description = pipe->vertex_input_state->binding_descriptions[i];
-        if (binding_description.binding < binding_buffers_size) {
-            const auto &binding_buffer = binding_buffers.at(binding_description.binding);
+        if (const auto *binding_buffer_ptr = binding_buffers.Find(binding_description.binding)) {
+            const auto &binding_buffer = *binding_buffer_ptr;
 
             const auto buf_state = sync_state_->Get<vvl::Buffer>(binding_buffer.buffer);
             if (!buf_state) continue;  // also skips if using nullDescriptor
@@ -554,10 +584,12 @@ bool CommandBufferAccessContext::ValidateDrawVertex(const std::optional<uint32_t
             const ResourceAccessRange range = MakeRange(binding_buffer, firstVertex, vertexCount, binding_description.stride);
             auto hazard = current_context_->DetectHazard(*buf_state, SYNC_VERTEX_ATTRIBUTE_INPUT_VERTEX_ATTRIBUTE_READ, range);
             if (hazard.IsHazard()) {
-                skip |= sync_state_->LogError(string_SyncHazardVUID(hazard.Hazard()), buf_state->Handle(), loc,
-                                              "Hazard %s for vertex %s in %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
-                                              sync_state_->FormatHandle(buf_state->Handle()).c_str(),
-                                              sync_state_->FormatHandle(cb_state_->Handle()).c_str(), FormatHazard(hazard).c_str());
+                skip |= LogHazard(hazard, buf_state->Handle(), loc, [&]() {
+                    return FormatHazardMessage("Hazard %s for vertex %s in %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
+                                               sync_state_->FormatHandle(buf_state->Handle()).c_str(),
+                                               sync_state_->FormatHandle(cb_state_->Handle()).c_str(),
+                                               FormatHazard(hazard).c_str());
+                });
             }
         }
     }
@@ -573,13 +605,12 @@ void CommandBufferAccessContext::RecordDrawVertex(const std::optional<uint32_t>
     // TODO - doesn't consider dynamic vertex binding input
     // https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/5281
     const auto &binding_buffers = cb_state_->current_vertex_buffer_binding_info;
-    const auto &binding_buffers_size = binding_buffers.size();
     const auto &binding_descriptions_size = pipe->vertex_input_state->binding_descriptions.size();
 
     for (size_t i = 0; i < binding_descriptions_size; ++i) {
         const auto &binding_description = pipe->vertex_input_state->binding_descriptions[i];
-        if (binding_description.binding < binding_buffers_size) {
-            const auto &binding_buffer = binding_buffers.at(binding_description.binding);
+        if (const auto *binding_buffer_ptr = binding_buffers.Find(binding_description.binding)) {
+            const auto &binding_buffer = *binding_buffer_ptr;
 
             const auto buf_state = sync_state_->Get<vvl::Buffer>(binding_buffer.buffer);
             if (!buf_state) continue;  // also skips if using nullDescriptor
@@ -603,10 +634,11 @@ bool CommandBufferAccessContext::ValidateDrawVertexIndex(const std::optional<uin
 
     auto hazard = current_context_->DetectHazard(*index_buf_state, SYNC_INDEX_INPUT_INDEX_READ, range);
     if (hazard.IsHazard()) {
-        skip |= sync_state_->LogError(string_SyncHazardVUID(hazard.Hazard()), index_buf_state->Handle(), loc,
-                                      "Hazard %s for index %s in %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
-                                      sync_state_->FormatHandle(index_buf_state->Handle()).c_str(),
-                                      sync_state_->FormatHandle(cb_state_->Handle()).c_str(), FormatHazard(hazard).c_str());
+        skip |= LogHazard(hazard, index_buf_state->Handle(), loc, [&]() {
+            return FormatHazardMessage("Hazard %s for index %s in %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
+                                       sync_state_->FormatHandle(index_buf_state->Handle()).c_str(),
+                                       sync_state_->FormatHandle(cb_state_->Handle()).c_str(), FormatHazard(hazard).c_str());
+        });
     }
 
     // TODO: For now, we detect the whole vertex buffer. Index buffer could be changed until SubmitQueue.
@@ -668,9 +700,10 @@ bool CommandBufferAccessContext::ValidateDrawDynamicRenderingAttachment(const Lo
         if (hazard.IsHazard()) {
             LogObjectList obj_list(cb_state_->Handle(), attachment.view->Handle());
             Location loc = attachment.GetLocation(location, output_location);
-            skip |= sync_state_->LogError(string_SyncHazardVUID(hazard.Hazard()), obj_list, loc.dot(vvl::Field::imageView),
-                                          "(%s). Access info %s.", sync_state_->FormatHandle(attachment.view->Handle()).c_str(),
-                                          FormatHazard(hazard).c_str());
+            skip |= LogHazard(hazard, obj_list, loc.dot(vvl::Field::imageView), [&]() {
+                return FormatHazardMessage("(%s). Access info %s.", sync_state_->FormatHandle(attachment.view->Handle()).c_str(),
+                                           FormatHazard(hazard).c_str());
+            });
         }
     }
 
@@ -692,9 +725,11 @@ bool CommandBufferAccessContext::ValidateDrawDynamicRenderingAttachment(const Lo
             if (hazard.IsHazard()) {
                 LogObjectList obj_list(cb_state_->Handle(), attachment.view->Handle());
                 Location loc = attachment.GetLocation(location);
-                skip |= sync_state_->LogError(string_SyncHazardVUID(hazard.Hazard()), obj_list, loc.dot(vvl::Field::imageView),
-                                              "(%s). Access info %s.", sync_state_->FormatHandle(attachment.view->Handle()).c_str(),
-                                              FormatHazard(hazard).c_str());
+                skip |= LogHazard(hazard, obj_list, loc.dot(vvl::Field::imageView), [&]() {
+                    return FormatHazardMessage("(%s). Access info %s.",
+                                               sync_state_->FormatHandle(attachment.view->Handle()).c_str(),
+                                               FormatHazard(hazard).c_str());
+                });
             }
         }
     }
@@ -787,13 +822,14 @@ QueueId CommandBufferAccessContext::GetQueueId() const { return kQueueIdInvalid;
 
 ResourceUsageTag CommandBufferAccessContext::RecordBeginRenderPass(
     vvl::Func command, const vvl::RenderPass &rp_state, const VkRect2D &render_area,
-    const std::vector<const syncval_state::ImageViewState *> &attachment_views) {
+    std::shared_ptr<const AttachmentViewGenVector> attachment_views) {
     // Create an access context the current renderpass.
     const auto barrier_tag = NextCommandTag(command, NamedHandle("renderpass", rp_state.Handle()),
                                             ResourceUsageRecord::SubcommandType::kSubpassTransition);
     const auto load_tag = NextSubcommandTag(command, ResourceUsageRecord::SubcommandType::kLoadOp);
     render_pass_contexts_.emplace_back(
-        std::make_unique<RenderPassAccessContext>(rp_state, render_area, GetQueueFlags(), attachment_views, &cb_access_context_));
+        std::make_unique<RenderPassAccessContext>(rp_state, render_area, GetQueueFlags(), std::move(attachment_views),
+                                                  &cb_access_context_));
     current_renderpass_context_ = render_pass_contexts_.back().get();
     current_renderpass_context_->RecordBeginRenderPass(barrier_tag, load_tag);
     current_context_ = &current_renderpass_context_->CurrentContext();
@@ -947,10 +983,11 @@ bool CommandBufferAccessContext::ValidateClearAttachment(const Location &loc, co
             SYNC_COLOR_ATTACHMENT_OUTPUT_COLOR_ATTACHMENT_WRITE, SyncOrdering::kColorAttachment);
         if (hazard.IsHazard()) {
             const LogObjectList objlist(cb_state_->Handle(), info.view->Handle());
-            skip |= sync_state_->LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, loc,
-                                          "Hazard %s while clearing color attachment%s. Access info %s.",
-                                          string_SyncHazard(hazard.Hazard()), info.GetSubpassAttachmentText().c_str(),
-                                          FormatHazard(hazard).c_str());
+            skip |= LogHazard(hazard, objlist, loc, [&]() {
+                return FormatHazardMessage("Hazard %s while clearing color attachment%s. Access info %s.",
+                                           string_SyncHazard(hazard.Hazard()), info.GetSubpassAttachmentText().c_str(),
+                                           FormatHazard(hazard).c_str());
+            });
         }
     }
 
@@ -968,10 +1005,11 @@ bool CommandBufferAccessContext::ValidateClearAttachment(const Location &loc, co
 
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(cb_state_->Handle(), info.view->Handle());
-                skip |= sync_state_->LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, loc,
-                                              "Hazard %s when clearing %s aspect of depth-stencil attachment%s. Access info %s.",
-                                              string_SyncHazard(hazard.Hazard()), string_VkImageAspectFlagBits(aspect),
-                                              info.GetSubpassAttachmentText().c_str(), FormatHazard(hazard).c_str());
+                skip |= LogHazard(hazard, objlist, loc, [&]() {
+                    return FormatHazardMessage("Hazard %s when clearing %s aspect of depth-stencil attachment%s. Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), string_VkImageAspectFlagBits(aspect),
+                                               info.GetSubpassAttachmentText().c_str(), FormatHazard(hazard).c_str());
+                });
             }
         }
     }
@@ -1010,10 +1048,9 @@ void CommandBufferAccessContext::RecordClearAttachment(ResourceUsageTag tag, con
 // VK_SYNCVAL_DEBUG_CMDBUF_PATTERN: (optional, empty string by default) pattern to match command buffer debug name
 void CommandBufferAccessContext::CheckCommandTagDebugCheckpoint() {
     auto get_cmdbuf_name = [](const DebugReport &debug_report, uint64_t cmdbuf_handle) {
-        std::unique_lock<std::mutex> lock(debug_report.debug_output_mutex);
-        std::string object_name = debug_report.GetUtilsObjectNameNoLock(cmdbuf_handle);
+        std::string object_name(debug_report.GetUtilsObjectName(cmdbuf_handle));
         if (object_name.empty()) {
-            object_name = debug_report.GetMarkerObjectNameNoLock(cmdbuf_handle);
+            object_name = debug_report.GetMarkerObjectName(cmdbuf_handle);
         }
         vvl::ToLower(object_name);
         return object_name;
@@ -1051,14 +1088,8 @@ static bool IsHazardVsRead(SyncHazard hazard) {
 
 static const SyncStageAccessInfoType *SyncStageAccessInfoFromMask(SyncStageAccessFlags flags) {
     // Return the info for the first bit found
-    const SyncStageAccessInfoType *info = nullptr;
-    for (size_t i = 0; i < flags.size(); i++) {
-        if (flags.test(i)) {
-            info = &syncStageAccessInfoByStageAccessIndex()[i];
-            break;
-        }
-    }
-    return info;
+    const size_t index = flags.FindFirst();
+    return index < syncStageAccessInfoByStageAccessIndex().size() ? &syncStageAccessInfoByStageAccessIndex()[index] : nullptr;
 }
 
 static std::string string_SyncStageAccessFlags(const SyncStageAccessFlags &flags, const char *sep = "|") {
@@ -1066,15 +1097,15 @@ static std::string string_SyncStageAccessFlags(const SyncStageAccessFlags &flags
     if (flags.none()) {
         out_str = "0";
     } else {
-        for (size_t i = 0; i < syncStageAccessInfoByStageAccessIndex().size(); i++) {
-            const auto &info = syncStageAccessInfoByStageAccessIndex()[i];
-            if ((flags & info.stage_access_bit).any()) {
+        const auto &infos = syncStageAccessInfoByStageAccessIndex();
+        flags.ForEachSetBit([&](size_t index) {
+            if (index < infos.size() && infos[index].stage_access_bit.any()) {
                 if (!out_str.empty()) {
                     out_str.append(sep);
                 }
-                out_str.append(info.name);
+                out_str.append(infos[index].name);
             }
-        }
+        });
         if (out_str.length() == 0) {
             out_str.append("Unhandled SyncStageAccess");
         }
@@ -1100,7 +1131,7 @@ std::ostream &operator<<(std::ostream &out, const SyncNodeFormatter &formatter)
 std::ostream &operator<<(std::ostream &out, const NamedHandle::FormatterState &formatter) {
     const NamedHandle &handle = formatter.that;
     bool labeled = false;
-    if (!handle.name.empty()) {
+    if (handle.name && *handle.name) {
         out << handle.name;
         labeled = true;
     }
@@ -1186,6 +1217,32 @@ std::string SyncValidationInfo::FormatHazard(const HazardResult &hazard) const {
     return out.str();
 }
 
+bool SyncValidationInfo::IsReportedHazard(const HazardResult &hazard, const LogObjectList &objlist) const {
+    const HazardResult::HazardState &state = hazard.State();
+    hash_util::HashCombiner hc;
+    for (const VulkanTypedHandle &object : objlist.object_list) {
+        hc << object.handle << object.type;
+    }
+    hc << state.hazard << state.usage_index << state.tag;
+    // The usage indices of the prior access, two prior accesses of the same command are different hazards
+    state.prior_access.ForEachSetBit([&hc](size_t prior_index) { hc << prior_index; });
+    const uint64_t key = std::max<uint64_t>(hc.Value(), 1);
+    uint64_t &slot = reported_hazards_[key % kReportedHazardSlots];
+    if (slot == key) {
+        return true;
+    }
+    slot = key;
+    return false;
+}
+
+bool SyncValidationInfo::LogHazard(const HazardResult &hazard, const LogObjectList &objlist, const Location &loc,
+                                   const MessageFormatter &formatter) const {
+    if (IsReportedHazard(hazard, objlist)) {
+        return false;
+    }
+    return GetSyncState().LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, loc, formatter);
+}
+
 syncval_state::CommandBuffer::CommandBuffer(SyncValidator &dev, VkCommandBuffer handle,
                                             const VkCommandBufferAllocateInfo *pCreateInfo, const vvl::CommandPool *pool)
     : vvl::CommandBuffer(dev, handle, pCreateInfo, pool), access_context(dev, this) {}
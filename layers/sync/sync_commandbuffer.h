@@ -82,7 +82,8 @@ struct FormatterImpl {
 
 struct NamedHandle {
     const static size_t kInvalidIndex = std::numeric_limits<size_t>::max();
-    std::string name;
+    // Always a string literal, every command and subcommand record carries (and copies) its handles
+    const char *name = nullptr;
     VulkanTypedHandle handle;
     size_t index = kInvalidIndex;
 
@@ -93,11 +94,9 @@ struct NamedHandle {
     NamedHandle() = default;
     NamedHandle(const NamedHandle &other) = default;
     NamedHandle(NamedHandle &&other) = default;
-    NamedHandle(const std::string &name_, const VulkanTypedHandle &handle_, size_t index_ = kInvalidIndex)
-        : name(name_), handle(handle_), index(index_) {}
     NamedHandle(const char *name_, const VulkanTypedHandle &handle_, size_t index_ = kInvalidIndex)
         : name(name_), handle(handle_), index(index_) {}
-    NamedHandle(const VulkanTypedHandle &handle_) : name(), handle(handle_) {}
+    NamedHandle(const VulkanTypedHandle &handle_) : handle(handle_) {}
     NamedHandle &operator=(const NamedHandle &other) = default;
     NamedHandle &operator=(NamedHandle &&other) = default;
 
@@ -140,9 +139,9 @@ struct ResourceCmdUsageRecord {
     // plain pointer as a shared pointer is held by the context storing this record
     const vvl::CommandBuffer *cb_state = nullptr;
     Count reset_count;
-    NamedHandleVector handles;
-
     uint32_t label_command_index = vvl::kU32Max;
+
+    NamedHandleVector handles;
 };
 
 struct DebugNameProvider;
@@ -186,7 +185,9 @@ struct DebugNameProvider {
 // TODO: determine where to draw the design split for tag tracking (is there anything command to Queues and CB's)
 class CommandExecutionContext : public SyncValidationInfo {
   public:
-    using AccessLog = std::vector<ResourceUsageRecord>;
+    // Counted in the SyncValidation statistics of the layer allocator
+    using AccessLog =
+        std::vector<ResourceUsageRecord, vvl::TrackedAllocator<ResourceUsageRecord, vvl::AllocationSubsystem::SyncValidation>>;
     using CommandBufferSet = std::vector<std::shared_ptr<const vvl::CommandBuffer>>;
     CommandExecutionContext() : SyncValidationInfo(nullptr) {}
     CommandExecutionContext(const SyncValidator *sync_validator) : SyncValidationInfo(sync_validator) {}
@@ -282,6 +283,8 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     }
 
     void Reset();
+    // The recorded accesses are only read from here on, possibly by several submissions at once
+    void RecordEndCommandBuffer();
 
     std::string FormatUsage(ResourceUsageTag tag) const override;
     std::string FormatUsage(const char *usage_string,
@@ -295,7 +298,7 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     RenderPassAccessContext *GetCurrentRenderPassContext() { return current_renderpass_context_; }
     const RenderPassAccessContext *GetCurrentRenderPassContext() const { return current_renderpass_context_; }
     ResourceUsageTag RecordBeginRenderPass(vvl::Func command, const vvl::RenderPass &rp_state, const VkRect2D &render_area,
-                                           const std::vector<const syncval_state::ImageViewState *> &attachment_views);
+                                           std::shared_ptr<const AttachmentViewGenVector> attachment_views);
 
     bool ValidateBeginRendering(const ErrorObject &error_obj, syncval_state::BeginRenderingCmdState &cmd_state) const;
     void RecordBeginRendering(syncval_state::BeginRenderingCmdState &cmd_state, const RecordObject &record_obj);
@@ -395,6 +398,10 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     uint32_t reset_count_;
     NamedHandleVector command_handles_;
 
+    // Backs the access state maps of cb_access_context_ and of the render pass subpass contexts. Reset() returns their
+    // nodes to the arena and re-recording reuses them instead of going to the heap for every node.
+    // Declared before the contexts as it must outlive them.
+    vvl::MonotonicArena arena_;
     AccessContext cb_access_context_;
     AccessContext *current_context_;
     SyncEventsContext events_context_;
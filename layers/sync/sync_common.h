@@ -15,6 +15,8 @@
  * limitations under the License.
  */
 #pragma once
+#include <array>
+
 #include "error_message/error_location.h"
 #include "containers/subresource_adapter.h"
 #include "containers/range_vector.h"
@@ -36,6 +38,8 @@ class Swapchain;
 
 class HazardResult;
 class SyncValidator;
+class MessageFormatter;
+struct LogObjectList;
 
 using ImageRangeGen = subresource_adapter::ImageRangeGenerator;
 
@@ -82,8 +86,25 @@ class SyncValidationInfo {
     std::string FormatHazard(const HazardResult& hazard) const;
     virtual std::string FormatUsage(ResourceUsageTag tag) const = 0;
 
+    // Reports a hazard found by this context. Broken content can find the same hazard over and over, ex. every draw of a
+    // frame reading an image that was written without a barrier, so a hazard this context already reported is dropped, and
+    // |formatter| (which usually calls FormatHazard) only runs once the message is known to be delivered.
+    bool LogHazard(const HazardResult& hazard, const LogObjectList& objlist, const Location& loc,
+                   const MessageFormatter& formatter) const;
+
   protected:
+    // Hazards are the same when they have the same objects in the message, hazard type, usage, and usage and tag of the
+    // prior access.
+    // Direct mapped like CachedInsertSet, so an evicted hazard is reported again.
+    bool IsReportedHazard(const HazardResult& hazard, const LogObjectList& objlist) const;
+    void ClearReportedHazards() { reported_hazards_.fill(0); }
+
     const SyncValidator* sync_state_;
+
+  private:
+    static constexpr size_t kReportedHazardSlots = 64;
+    // Hashes of the reported hazards, 0 is an empty slot. Contexts are externally synchronized like their command buffers.
+    mutable std::array<uint64_t, kReportedHazardSlots> reported_hazards_{};
 };
 
 
@@ -168,6 +189,28 @@ class SingleRangeGenerator {
     KeyType current_;
 };
 
+// A range generator over ranges computed ahead of time, ex. the ranges of an image view computed at creation. The ranges
+// must outlive the generator.
+template <typename KeyType>
+class RangeListGenerator {
+  public:
+    using RangeType = KeyType;
+    RangeListGenerator(const KeyType *begin, const KeyType *end)
+        : pos_(begin), end_(end), current_(begin != end ? *begin : KeyType()) {}
+    const KeyType &operator*() const { return current_; }
+    const KeyType *operator->() const { return &current_; }
+    RangeListGenerator &operator++() {
+        ++pos_;
+        current_ = (pos_ != end_) ? *pos_ : KeyType();
+        return *this;
+    }
+
+  private:
+    const KeyType *pos_;
+    const KeyType *end_;
+    KeyType current_;
+};
+
 template <typename Map>
 typename Map::mapped_type GetMapped(const Map &map, const typename Map::key_type &key) {
     auto it = map.find(key);
@@ -16,11 +16,30 @@
  */
 #pragma once
 
+#include <atomic>
+
 #include "sync/sync_submit.h"
+#include "state_tracker/buffer_state.h"
 #include "state_tracker/image_state.h"
 
 namespace syncval_state {
 
+class BufferState : public vvl::Buffer {
+  public:
+    BufferState(ValidationStateTracker &dev_data, VkBuffer handle, const VkBufferCreateInfo *pCreateInfo, bool coarse_tracking)
+        : vvl::Buffer(dev_data, handle, pCreateInfo), coarse_tracking_(coarse_tracking) {}
+
+    // With coarse tracking every access to the buffer is tracked as an access to all of it
+    bool IsCoarselyTracked() const { return coarse_tracking_.load(std::memory_order_relaxed); }
+    // Switches to exact ranges, once a hazard found for the whole buffer may come from accesses to other parts of it
+    void PromoteToPreciseTracking() const { coarse_tracking_.store(false, std::memory_order_relaxed); }
+    // The global address range tracked for |range| of the buffer
+    ResourceAccessRange MakeAccessRange(const ResourceAccessRange &range) const;
+
+  private:
+    mutable std::atomic<bool> coarse_tracking_;
+};
+
 class ImageState : public vvl::Image {
   public:
     ImageState(const ValidationStateTracker &dev_data, VkImage handle, const VkImageCreateInfo *pCreateInfo,
@@ -54,11 +73,23 @@ class ImageViewState : public vvl::ImageView {
     const ImageState *GetImageState() const { return static_cast<const syncval_state::ImageState *>(image_state.get()); }
     ImageRangeGen MakeImageRangeGen(const VkOffset3D &offset, const VkExtent3D &extent, VkImageAspectFlags aspect_mask = 0) const;
     const ImageRangeGen &GetFullViewImageRangeGen() const { return view_range_gen; }
+    // The ranges of view_range_gen, walked once at creation so the per draw accesses of descriptors do not go through the
+    // generator again. False when the view has too many ranges to keep them, GetFullViewImageRangeGen() is used then.
+    bool HasFullViewRanges() const { return has_full_view_ranges_; }
+    RangeListGenerator<ResourceAccessRange> MakeFullViewRangeListGen() const {
+        const ResourceAccessRange *begin = full_view_ranges_.data();
+        return RangeListGenerator<ResourceAccessRange>(begin, begin + full_view_ranges_.size());
+    }
 
   protected:
     ImageRangeGen MakeImageRangeGen() const;
     // All data members needs for MakeImageRangeGen() must be set before initializing view_range_gen... i.e. above this line.
     const ImageRangeGen view_range_gen;
+
+  private:
+    static constexpr uint32_t kMaxFullViewRanges = 64;
+    std::vector<ResourceAccessRange> full_view_ranges_;
+    bool has_full_view_ranges_ = false;
 };
 
 class Swapchain : public vvl::Swapchain {
@@ -89,7 +89,7 @@ class MapRangesRangeGenerator {
     typename RangeMap::const_iterator map_pos_;
     KeyType current_;
 };
-using EventSimpleRangeGenerator = MapRangesRangeGenerator<AccessContext::ScopeMap>;
+using EventSimpleRangeGenerator = MapRangesRangeGenerator<EventScopeRanges>;
 
 // Generate the ranges that are the intersection of the RangeGen ranges and the entries in the FilterMap
 // Templated to allow for different Range generators or map sources...
@@ -192,7 +192,7 @@ class FilteredGeneratorGenerator {
     KeyType current_;
 };
 
-using EventImageRangeGenerator = FilteredGeneratorGenerator<AccessContext::ScopeMap, subresource_adapter::ImageRangeGenerator>;
+using EventImageRangeGenerator = FilteredGeneratorGenerator<EventScopeRanges, subresource_adapter::ImageRangeGenerator>;
 
 SyncOpBarriers::SyncOpBarriers(vvl::Func command, const SyncValidator &sync_state, VkQueueFlags queue_flags,
                                VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask,
@@ -272,11 +272,12 @@ bool SyncOpPipelineBarrier::Validate(const CommandBufferAccessContext &cb_contex
             // PHASE1 TODO -- add tag information to log msg when useful.
             const Location loc(command_);
             const auto &sync_state = cb_context.GetSyncState();
-            skip |= sync_state.LogError(string_SyncHazardVUID(hazard.Hazard()), image_state->Handle(), loc,
-                                        "Hazard %s for image barrier %" PRIu32 " %s. Access info %s.",
-                                        string_SyncHazard(hazard.Hazard()), image_barrier.index,
-                                        sync_state.FormatHandle(image_state->Handle()).c_str(),
-                                        cb_context.FormatHazard(hazard).c_str());
+            skip |= cb_context.LogHazard(hazard, image_state->Handle(), loc, [&]() {
+                return FormatHazardMessage("Hazard %s for image barrier %" PRIu32 " %s. Access info %s.",
+                                           string_SyncHazard(hazard.Hazard()), image_barrier.index,
+                                           sync_state.FormatHandle(image_state->Handle()).c_str(),
+                                           cb_context.FormatHazard(hazard).c_str());
+            });
         }
     }
     return skip;
@@ -304,8 +305,7 @@ struct SyncOpPipelineBarrierFunctorFactory {
 
     BufferRange MakeRangeGen(const vvl::Buffer &buffer, const ResourceAccessRange &range) const {
         if (!SimpleBinding(buffer)) return ResourceAccessRange();
-        const auto base_address = ResourceBaseAddress(buffer);
-        return (range + base_address);
+        return BufferAccessRange(buffer, range);
     }
     ImageRange MakeRangeGen(const ImageState &image, const VkImageSubresourceRange &subresource_range) const {
         return image.MakeImageRangeGen(subresource_range, false);
@@ -337,6 +337,19 @@ void SyncOpBarriers::ApplyGlobalBarriers(const Barriers &barriers, const Functor
     access_context->UpdateMemoryAccessState(barriers_functor, range_gen);
 }
 
+template <typename Barriers, typename FunctorFactory>
+void SyncOpBarriers::ResolvePendingBarriers(const Barriers &barriers, const FunctorFactory &factory, const ResourceUsageTag tag,
+                                            AccessContext *access_context) {
+    ResolvePendingBarrierFunctor resolve_action(tag);
+    for (const auto &barrier : barriers) {
+        const auto *state = barrier.GetState();
+        if (state) {
+            auto range_gen = factory.MakeRangeGen(*state, barrier.Range());
+            access_context->UpdateMemoryAccessState(resolve_action, range_gen);
+        }
+    }
+}
+
 ResourceUsageTag SyncOpPipelineBarrier::Record(CommandBufferAccessContext *cb_context) {
     const auto tag = cb_context->NextCommandTag(command_);
     for (const auto &barrier_set : barriers_) {
@@ -363,7 +376,19 @@ void SyncOpPipelineBarrier::ReplayRecord(CommandExecutionContext &exec_context,
     const auto queue_id = exec_context.GetQueueId();
     ApplyBarriers(barrier_set.buffer_memory_barriers, factory, queue_id, exec_tag, access_context);
     ApplyBarriers(barrier_set.image_memory_barriers, factory, queue_id, exec_tag, access_context);
-    ApplyGlobalBarriers(barrier_set.memory_barriers, factory, queue_id, exec_tag, access_context);
+    if (barrier_set.memory_barriers.empty()) {
+        // Without a global barrier the pending state is confined to the barrier resources, so resolve just those ranges
+        // instead of walking every resource in the access map
+        ResolvePendingBarriers(barrier_set.buffer_memory_barriers, factory, exec_tag, access_context);
+        ResolvePendingBarriers(barrier_set.image_memory_barriers, factory, exec_tag, access_context);
+    } else if (queue_id == kQueueIdInvalid && barrier_set.buffer_memory_barriers.empty() &&
+               barrier_set.image_memory_barriers.empty()) {
+        // At record time the global barriers are only applied to the access states when they are next used. Submit time
+        // contexts are read from other queues, and a barrier set with resource barriers needs its pending state resolved now.
+        access_context->DeferGlobalBarriers(queue_id, barrier_set.memory_barriers, exec_tag);
+    } else {
+        ApplyGlobalBarriers(barrier_set.memory_barriers, factory, queue_id, exec_tag, access_context);
+    }
     if (barrier_set.single_exec_scope) {
         events_context->ApplyBarrier(barrier_set.src_exec_scope, barrier_set.dst_exec_scope, exec_tag);
     } else {
@@ -648,11 +673,12 @@ bool SyncOpWaitEvents::DoValidate(const CommandExecutionContext &exec_context, c
                     *image_state, subresource_range, sync_event->scope.exec_scope, src_access_scope, queue_id,
                     sync_event->FirstScope(), sync_event->first_scope_tag, AccessContext::DetectOptions::kDetectAll);
                 if (hazard.IsHazard()) {
-                    skip |= sync_state.LogError(string_SyncHazardVUID(hazard.Hazard()), image_state->Handle(), loc,
-                                                "Hazard %s for image barrier %" PRIu32 " %s. Access info %s.",
-                                                string_SyncHazard(hazard.Hazard()), image_memory_barrier.index,
-                                                sync_state.FormatHandle(image_state->Handle()).c_str(),
-                                                exec_context.FormatHazard(hazard).c_str());
+                    skip |= exec_context.LogHazard(hazard, image_state->Handle(), loc, [&]() {
+                        return FormatHazardMessage("Hazard %s for image barrier %" PRIu32 " %s. Access info %s.",
+                                                   string_SyncHazard(hazard.Hazard()), image_memory_barrier.index,
+                                                   sync_state.FormatHandle(image_state->Handle()).c_str(),
+                                                   exec_context.FormatHazard(hazard).c_str());
+                    });
                     break;
                 }
             }
@@ -714,18 +740,17 @@ struct SyncOpWaitEventsFunctorFactory {
     }
 
     BufferRange MakeRangeGen(const vvl::Buffer &buffer, const ResourceAccessRange &range_arg) const {
-        const auto base_address = ResourceBaseAddress(buffer);
-        ResourceAccessRange range = SimpleBinding(buffer) ? (range_arg + base_address) : ResourceAccessRange();
-        EventSimpleRangeGenerator filtered_range_gen(sync_event->FirstScope(), range);
+        ResourceAccessRange range = SimpleBinding(buffer) ? BufferAccessRange(buffer, range_arg) : ResourceAccessRange();
+        EventSimpleRangeGenerator filtered_range_gen(sync_event->FirstScopeRanges(), range);
         return filtered_range_gen;
     }
     ImageRange MakeRangeGen(const ImageState &image, const VkImageSubresourceRange &subresource_range) const {
         ImageRangeGen image_range_gen = image.MakeImageRangeGen(subresource_range, false);
-        EventImageRangeGenerator filtered_range_gen(sync_event->FirstScope(), image_range_gen);
+        EventImageRangeGenerator filtered_range_gen(sync_event->FirstScopeRanges(), image_range_gen);
 
         return filtered_range_gen;
     }
-    GlobalRange MakeGlobalRangeGen() const { return EventSimpleRangeGenerator(sync_event->FirstScope(), kFullRange); }
+    GlobalRange MakeGlobalRangeGen() const { return EventSimpleRangeGenerator(sync_event->FirstScopeRanges(), kFullRange); }
     SyncOpWaitEventsFunctorFactory(SyncEventState *sync_event_) : sync_event(sync_event_) { assert(sync_event); }
     SyncEventState *sync_event;
 };
@@ -888,7 +913,10 @@ SyncOpSetEvent::SyncOpSetEvent(vvl::Func command, const SyncValidator &sync_stat
     //       access context (include barrier state for chaining) won't necessarily contain the needed information at Wait
     //       or Submit time reference.
     if (access_context) {
-        recorded_context_ = std::make_shared<const AccessContext>(*access_context);
+        // The snapshot is used as a plain scope map, so it can't hold deferred barriers
+        auto recorded_context = std::make_shared<AccessContext>(*access_context);
+        recorded_context->ApplyDeferredGlobalBarriers();
+        recorded_context_ = std::move(recorded_context);
     }
 }
 
@@ -900,7 +928,10 @@ SyncOpSetEvent::SyncOpSetEvent(vvl::Func command, const SyncValidator &sync_stat
       src_exec_scope_(SyncExecScope::MakeSrc(queue_flags, sync_utils::GetGlobalStageMasks(dep_info).src)),
       dep_info_(new vku::safe_VkDependencyInfo(&dep_info)) {
     if (access_context) {
-        recorded_context_ = std::make_shared<const AccessContext>(*access_context);
+        // The snapshot is used as a plain scope map, so it can't hold deferred barriers
+        auto recorded_context = std::make_shared<AccessContext>(*access_context);
+        recorded_context->ApplyDeferredGlobalBarriers();
+        recorded_context_ = std::move(recorded_context);
     }
 }
 
@@ -1023,6 +1054,7 @@ void SyncOpSetEvent::DoRecord(QueueId queue_id, ResourceUsageTag tag, const std:
 
         // Save the shared_ptr to copy of the access_context present at set time (sent us by the caller)
         sync_event->first_scope = access_context;
+        sync_event->first_scope_ranges = std::make_shared<EventScopeRanges>(access_context->GetAccessStateMap());
         sync_event->unsynchronized_set = vvl::Func::Empty;
         sync_event->first_scope_tag = tag;
     }
@@ -1048,11 +1080,15 @@ SyncOpBeginRenderPass::SyncOpBeginRenderPass(vvl::Func command, const SyncValida
             for (const auto &attachment : shared_attachments_) {
                 attachments_.emplace_back(static_cast<const syncval_state::ImageViewState *>(attachment.get()));
             }
+            attachment_view_gens_ = sync_state.GetAttachmentViewGens(*fb_state, renderpass_begin_info_.renderArea, attachments_);
         }
         if (pSubpassBeginInfo) {
             subpass_begin_info_ = vku::safe_VkSubpassBeginInfo(pSubpassBeginInfo);
         }
     }
+    if (!attachment_view_gens_) {
+        attachment_view_gens_ = std::make_shared<const AttachmentViewGenVector>();
+    }
 }
 
 bool SyncOpBeginRenderPass::Validate(const CommandBufferAccessContext &cb_context) const {
@@ -1075,11 +1111,10 @@ bool SyncOpBeginRenderPass::Validate(const CommandBufferAccessContext &cb_contex
     if (attachments_.empty()) return skip;
     const auto &render_area = renderpass_begin_info_.renderArea;
 
-    // Since the isn't a valid RenderPassAccessContext until Record, needs to create the view/generator list... we could limit this
-    // by predicating on whether subpass 0 uses the attachment if it is too expensive to create the full list redundantly here.
-    // More broadly we could look at thread specific state shared between Validate and Record as is done for other heavyweight
-    // operations (though it's currently a messy approach)
-    AttachmentViewGenVector view_gens = RenderPassAccessContext::CreateAttachmentViewGen(render_area, attachments_);
+    // Since the isn't a valid RenderPassAccessContext until Record, the view/generator list built by the constructor is
+    // used here and then handed over to the RenderPassAccessContext
+    assert(attachment_view_gens_);
+    const AttachmentViewGenVector &view_gens = *attachment_view_gens_;
     skip |= RenderPassAccessContext::ValidateLayoutTransitions(cb_context, temp_context, rp_state, render_area, subpass, view_gens,
                                                                command_);
 
@@ -1097,7 +1132,7 @@ ResourceUsageTag SyncOpBeginRenderPass::Record(CommandBufferAccessContext *cb_co
     assert(rp_state_.get());
     if (nullptr == rp_state_.get()) return cb_context->NextCommandTag(command_);
     const ResourceUsageTag begin_tag =
-        cb_context->RecordBeginRenderPass(command_, *rp_state_.get(), renderpass_begin_info_.renderArea, attachments_);
+        cb_context->RecordBeginRenderPass(command_, *rp_state_.get(), renderpass_begin_info_.renderArea, attachment_view_gens_);
 
     // Note: this state update must be after RecordBeginRenderPass as there is no current render pass until that function runs
     rp_context_ = cb_context->GetCurrentRenderPassContext();
@@ -1229,19 +1264,23 @@ bool ReplayState::DetectFirstUseHazard(const ResourceUsageRange &first_use_range
         HazardResult hazard;
         // We're allowing for the Replay(Validate|Record) to modify the exec_context (e.g. for Renderpass operations), so
         // we need to fetch the current access context each time
+        const SyncValidator &sync_state = exec_context_.GetSyncState();
+        vvl::WorkerPool *worker_pool =
+            (exec_context_.Type() == CommandExecutionContext::kSubmitted) ? sync_state.GetSubmitWorkerPool() : nullptr;
         hazard = GetRecordedAccessContext()->DetectFirstUseHazard(exec_context_.GetQueueId(), first_use_range,
-                                                                  *exec_context_.GetCurrentAccessContext());
+                                                                  *exec_context_.GetCurrentAccessContext(), worker_pool);
 
         if (hazard.IsHazard()) {
-            const SyncValidator &sync_state = exec_context_.GetSyncState();
             const auto handle = exec_context_.Handle();
             const VkCommandBuffer recorded_handle = recorded_context_.GetCBState().VkHandle();
-            skip |= sync_state.LogError(
-                string_SyncHazardVUID(hazard.Hazard()), handle, error_obj_.location,
-                "Hazard %s for entry %" PRIu32 ", %s, %s access info %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
-                index_, sync_state.FormatHandle(recorded_handle).c_str(), exec_context_.ExecutionTypeString(),
-                recorded_context_.FormatUsage(exec_context_.ExecutionUsageString(), *hazard.RecordedAccess()).c_str(),
-                exec_context_.FormatHazard(hazard).c_str());
+            skip |= exec_context_.LogHazard(hazard, handle, error_obj_.location, [&]() {
+                const std::string recorded_usage =
+                    recorded_context_.FormatUsage(exec_context_.ExecutionUsageString(), *hazard.RecordedAccess());
+                return FormatHazardMessage("Hazard %s for entry %" PRIu32 ", %s, %s access info %s. Access info %s.",
+                                           string_SyncHazard(hazard.Hazard()), index_,
+                                           sync_state.FormatHandle(recorded_handle).c_str(), exec_context_.ExecutionTypeString(),
+                                           recorded_usage.c_str(), exec_context_.FormatHazard(hazard).c_str());
+            });
         }
     }
     return skip;
@@ -1352,8 +1391,24 @@ SyncEventState::SyncEventState(const SyncEventState::EventPointer &event_state)
     destroyed = (event.get() == nullptr) || event_state->Destroyed();
 }
 
+EventScopeRanges::EventScopeRanges(const AccessContext::ScopeMap &scope_map) {
+    for (const auto &entry : scope_map) {
+        if (!ranges_.empty() && ranges_.back().first.end == entry.first.begin) {
+            ranges_.back().first.end = entry.first.end;
+        } else {
+            ranges_.emplace_back(value_type{entry.first});
+        }
+    }
+}
+
+EventScopeRanges::const_iterator EventScopeRanges::lower_bound(const ResourceAccessRange &range) const {
+    return std::partition_point(ranges_.cbegin(), ranges_.cend(),
+                                [&range](const value_type &value) { return value.first.end <= range.begin; });
+}
+
 void SyncEventState::ResetFirstScope() {
     first_scope.reset();
+    first_scope_ranges.reset();
     scope = SyncExecScope();
     first_scope_tag = 0;
 }
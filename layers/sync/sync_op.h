@@ -32,6 +32,29 @@ class CommandBuffer;
 
 using SyncMemoryBarrier = SyncBarrier;
 
+// The address ranges accessed in the first scope of an event, with adjacent map entries coalesced. Computed once when the
+// scope is set, so waits filter their barriers against a short sorted vector instead of walking the scope map.
+// Exposes the subset of the range map interface used by the event range generators.
+class EventScopeRanges {
+  public:
+    using key_type = ResourceAccessRange;
+    struct value_type {
+        ResourceAccessRange first;
+    };
+    using const_iterator = std::vector<value_type>::const_iterator;
+
+    EventScopeRanges() = default;
+    explicit EventScopeRanges(const AccessContext::ScopeMap &scope_map);
+
+    const_iterator cbegin() const { return ranges_.cbegin(); }
+    const_iterator cend() const { return ranges_.cend(); }
+    // The first range not strictly less than |range|, as for the range map
+    const_iterator lower_bound(const ResourceAccessRange &range) const;
+
+  private:
+    std::vector<value_type> ranges_;
+};
+
 struct SyncEventState {
     enum IgnoreReason { NotIgnored = 0, ResetWaitRace, Reset2WaitRace, SetRace, MissingStageBits, SetVsWait2, MissingSetEvent };
     using EventPointer = std::shared_ptr<const vvl::Event>;
@@ -44,6 +67,7 @@ struct SyncEventState {
     ResourceUsageTag first_scope_tag;
     bool destroyed;
     std::shared_ptr<const AccessContext> first_scope;
+    std::shared_ptr<const EventScopeRanges> first_scope_ranges;
 
     SyncEventState()
         : event(),
@@ -62,6 +86,7 @@ struct SyncEventState {
 
     void ResetFirstScope();
     const AccessContext::ScopeMap &FirstScope() const { return first_scope->GetAccessStateMap(); }
+    const EventScopeRanges &FirstScopeRanges() const { return *first_scope_ranges; }
     IgnoreReason IsIgnoredByWait(vvl::Func command, VkPipelineStageFlags2KHR srcStageMask) const;
     bool HasBarrier(VkPipelineStageFlags2KHR stageMask, VkPipelineStageFlags2KHR exec_scope) const;
     void AddReferencedTags(ResourceUsageTagSet &referenced) const;
@@ -180,6 +205,10 @@ class SyncOpBarriers : public SyncOpBase {
     template <typename Barriers, typename FunctorFactory>
     static void ApplyGlobalBarriers(const Barriers &barriers, const FunctorFactory &factory, QueueId queue_id, ResourceUsageTag tag,
                                     AccessContext *access_context);
+    // Resolves the pending state only within the ranges of the given resource barriers
+    template <typename Barriers, typename FunctorFactory>
+    static void ResolvePendingBarriers(const Barriers &barriers, const FunctorFactory &factory, ResourceUsageTag tag,
+                                       AccessContext *access_context);
 
     SyncOpBarriers(vvl::Func command, const SyncValidator &sync_state, VkQueueFlags queue_flags, VkPipelineStageFlags srcStageMask,
                    VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount,
@@ -322,6 +351,7 @@ class SyncOpBeginRenderPass : public SyncOpBase {
     vku::safe_VkSubpassBeginInfo subpass_begin_info_;
     std::vector<std::shared_ptr<const vvl::ImageView>> shared_attachments_;
     std::vector<const syncval_state::ImageViewState *> attachments_;
+    std::shared_ptr<const AttachmentViewGenVector> attachment_view_gens_;
     std::shared_ptr<const vvl::RenderPass> rp_state_;
     const RenderPassAccessContext *rp_context_;
 };
@@ -34,11 +34,12 @@ class ValidateResolveAction {
         hazard = context_.DetectHazard(view_gen, gen_type, current_usage, ordering_rule);
         if (hazard.IsHazard()) {
             const Location loc(command_);
-            skip_ |= val_info_.GetSyncState().LogError(string_SyncHazardVUID(hazard.Hazard()), render_pass_, loc,
-                                                       "Hazard %s in subpass %" PRIu32 "during %s %s, from attachment %" PRIu32
-                                                       " to resolve attachment %" PRIu32 ". Access info %s.",
-                                                       string_SyncHazard(hazard.Hazard()), subpass_, aspect_name, attachment_name,
-                                                       src_at, dst_at, val_info_.FormatHazard(hazard).c_str());
+            skip_ |= val_info_.LogHazard(hazard, render_pass_, loc, [&]() {
+                return FormatHazardMessage("Hazard %s in subpass %" PRIu32 "during %s %s, from attachment %" PRIu32
+                                           " to resolve attachment %" PRIu32 ". Access info %s.",
+                                           string_SyncHazard(hazard.Hazard()), subpass_, aspect_name, attachment_name, src_at,
+                                           dst_at, val_info_.FormatHazard(hazard).c_str());
+            });
         }
     }
     // Providing a mechanism for the constructing caller to get the result of the validation
@@ -162,12 +163,13 @@ bool RenderPassAccessContext::ValidateLayoutTransitions(const SyncValidationInfo
                     string_SyncHazard(hazard.Hazard()), subpass, transition.attachment, string_VkImageLayout(transition.old_layout),
                     string_VkImageLayout(transition.new_layout), transition.prev_pass);
             } else {
-                skip |= val_info.GetSyncState().LogError(
-                    string_SyncHazardVUID(hazard.Hazard()), rp_state.Handle(), loc,
-                    "Hazard %s in subpass %" PRIu32 " for attachment %" PRIu32
-                    " image layout transition (old_layout: %s, new_layout: %s). Access info %s.",
-                    string_SyncHazard(hazard.Hazard()), subpass, transition.attachment, string_VkImageLayout(transition.old_layout),
-                    string_VkImageLayout(transition.new_layout), val_info.FormatHazard(hazard).c_str());
+                skip |= val_info.LogHazard(hazard, rp_state.Handle(), loc, [&]() {
+                    return FormatHazardMessage("Hazard %s in subpass %" PRIu32 " for attachment %" PRIu32
+                                               " image layout transition (old_layout: %s, new_layout: %s). Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), subpass, transition.attachment,
+                                               string_VkImageLayout(transition.old_layout),
+                                               string_VkImageLayout(transition.new_layout), val_info.FormatHazard(hazard).c_str());
+                });
             }
         }
     }
@@ -232,11 +234,12 @@ bool RenderPassAccessContext::ValidateLoadOperation(const SyncValidationInfo &va
                                                 " aspect %s during load with loadOp %s.",
                                                 string_SyncHazard(hazard.Hazard()), subpass, i, aspect, load_op_string);
                 } else {
-                    skip |= sync_state.LogError(string_SyncHazardVUID(hazard.Hazard()), rp_state.Handle(), loc,
-                                                "Hazard %s in subpass %" PRIu32 " for attachment %" PRIu32
-                                                " aspect %s during load with loadOp %s. Access info %s.",
-                                                string_SyncHazard(hazard.Hazard()), subpass, i, aspect, load_op_string,
-                                                val_info.FormatHazard(hazard).c_str());
+                    skip |= val_info.LogHazard(hazard, rp_state.Handle(), loc, [&]() {
+                        return FormatHazardMessage("Hazard %s in subpass %" PRIu32 " for attachment %" PRIu32
+                                                   " aspect %s during load with loadOp %s. Access info %s.",
+                                                   string_SyncHazard(hazard.Hazard()), subpass, i, aspect, load_op_string,
+                                                   val_info.FormatHazard(hazard).c_str());
+                    });
                 }
             }
         }
@@ -254,7 +257,7 @@ bool RenderPassAccessContext::ValidateStoreOperation(const SyncValidationInfo &v
 
     for (uint32_t i = 0; i < rp_state_->create_info.attachmentCount; i++) {
         if (current_subpass_ == rp_state_->attachment_last_subpass[i]) {
-            const AttachmentViewGen &view_gen = attachment_views_[i];
+            const AttachmentViewGen &view_gen = AttachmentViews()[i];
             if (!view_gen.IsValid()) continue;
             const auto &ci = attachment_ci[i];
 
@@ -295,11 +298,12 @@ bool RenderPassAccessContext::ValidateStoreOperation(const SyncValidationInfo &v
                 const char *const op_type_string = checked_stencil ? "stencilStoreOp" : "storeOp";
                 const char *const store_op_string = string_VkAttachmentStoreOp(checked_stencil ? ci.stencilStoreOp : ci.storeOp);
                 const Location loc(command);
-                skip |= val_info.GetSyncState().LogError(string_SyncHazardVUID(hazard.Hazard()), rp_state_->Handle(), loc,
-                                                         "Hazard %s in subpass %" PRIu32 " for attachment %" PRIu32
-                                                         " %s aspect during store with %s %s. Access info %s",
-                                                         string_SyncHazard(hazard.Hazard()), current_subpass_, i, aspect,
-                                                         op_type_string, store_op_string, val_info.FormatHazard(hazard).c_str());
+                skip |= val_info.LogHazard(hazard, rp_state_->Handle(), loc, [&]() {
+                    return FormatHazardMessage("Hazard %s in subpass %" PRIu32 " for attachment %" PRIu32
+                                               " %s aspect during store with %s %s. Access info %s",
+                                               string_SyncHazard(hazard.Hazard()), current_subpass_, i, aspect, op_type_string,
+                                               store_op_string, val_info.FormatHazard(hazard).c_str());
+                });
             }
         }
     }
@@ -400,7 +404,7 @@ void ResolveOperation(Action &action, const vvl::RenderPass &rp_state, const Att
 
 bool RenderPassAccessContext::ValidateResolveOperations(const SyncValidationInfo &val_info, vvl::Func command) const {
     ValidateResolveAction validate_action(rp_state_->VkHandle(), current_subpass_, CurrentContext(), val_info, command);
-    ResolveOperation(validate_action, *rp_state_, attachment_views_, current_subpass_);
+    ResolveOperation(validate_action, *rp_state_, AttachmentViews(), current_subpass_);
     return validate_action.GetSkip();
 }
 
@@ -505,7 +509,7 @@ bool RenderPassAccessContext::ValidateDrawSubpassAttachment(const CommandExecuti
                 subpass.pColorAttachments[location].attachment == VK_ATTACHMENT_UNUSED) {
                 continue;
             }
-            const AttachmentViewGen &view_gen = attachment_views_[subpass.pColorAttachments[location].attachment];
+            const AttachmentViewGen &view_gen = AttachmentViews()[subpass.pColorAttachments[location].attachment];
             if (!view_gen.IsValid()) continue;
             HazardResult hazard =
                 current_context.DetectHazard(view_gen, AttachmentViewGen::Gen::kRenderArea,
@@ -513,11 +517,12 @@ bool RenderPassAccessContext::ValidateDrawSubpassAttachment(const CommandExecuti
             if (hazard.IsHazard()) {
                 const VkImageView view_handle = view_gen.GetViewState()->VkHandle();
                 const Location loc(command);
-                skip |= sync_state.LogError(string_SyncHazardVUID(hazard.Hazard()), view_handle, loc,
-                                            "Hazard %s for %s in %s, Subpass #%d, and pColorAttachments #%d. Access info %s.",
-                                            string_SyncHazard(hazard.Hazard()), sync_state.FormatHandle(view_handle).c_str(),
-                                            sync_state.FormatHandle(cmd_buffer).c_str(), cmd_buffer.GetActiveSubpass(), location,
-                                            exec_context.FormatHazard(hazard).c_str());
+                skip |= exec_context.LogHazard(hazard, view_handle, loc, [&]() {
+                    return FormatHazardMessage("Hazard %s for %s in %s, Subpass #%d, and pColorAttachments #%d. Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), sync_state.FormatHandle(view_handle).c_str(),
+                                               sync_state.FormatHandle(cmd_buffer).c_str(), cmd_buffer.GetActiveSubpass(), location,
+                                               exec_context.FormatHazard(hazard).c_str());
+                });
             }
         }
     }
@@ -527,8 +532,8 @@ bool RenderPassAccessContext::ValidateDrawSubpassAttachment(const CommandExecuti
     const auto ds_state = pipe->DepthStencilState();
     const uint32_t depth_stencil_attachment = GetSubpassDepthStencilAttachmentIndex(ds_state, subpass.pDepthStencilAttachment);
 
-    if ((depth_stencil_attachment != VK_ATTACHMENT_UNUSED) && attachment_views_[depth_stencil_attachment].IsValid()) {
-        const AttachmentViewGen &view_gen = attachment_views_[depth_stencil_attachment];
+    if ((depth_stencil_attachment != VK_ATTACHMENT_UNUSED) && AttachmentViews()[depth_stencil_attachment].IsValid()) {
+        const AttachmentViewGen &view_gen = AttachmentViews()[depth_stencil_attachment];
         const vvl::ImageView &view_state = *view_gen.GetViewState();
         const VkImageLayout ds_layout = subpass.pDepthStencilAttachment->layout;
         const VkFormat ds_format = view_state.create_info.format;
@@ -546,12 +551,13 @@ bool RenderPassAccessContext::ValidateDrawSubpassAttachment(const CommandExecuti
                                                                SyncOrdering::kDepthStencilAttachment);
             if (hazard.IsHazard()) {
                 const Location loc(command);
-                skip |= sync_state.LogError(
-                    string_SyncHazardVUID(hazard.Hazard()), view_state.Handle(), loc,
-                    "Hazard %s for %s in %s, Subpass #%d, and depth part of pDepthStencilAttachment. Access info %s.",
-                    string_SyncHazard(hazard.Hazard()), sync_state.FormatHandle(view_state).c_str(),
-                    sync_state.FormatHandle(cmd_buffer).c_str(), cmd_buffer.GetActiveSubpass(),
-                    exec_context.FormatHazard(hazard).c_str());
+                skip |= exec_context.LogHazard(hazard, view_state.Handle(), loc, [&]() {
+                    return FormatHazardMessage("Hazard %s for %s in %s, Subpass #%d, and depth part of pDepthStencilAttachment. "
+                                               "Access info %s.", string_SyncHazard(hazard.Hazard()),
+                                               sync_state.FormatHandle(view_state).c_str(),
+                                               sync_state.FormatHandle(cmd_buffer).c_str(), cmd_buffer.GetActiveSubpass(),
+                                               exec_context.FormatHazard(hazard).c_str());
+                });
             }
         }
         if (stencil_write) {
@@ -560,12 +566,13 @@ bool RenderPassAccessContext::ValidateDrawSubpassAttachment(const CommandExecuti
                                                                SyncOrdering::kDepthStencilAttachment);
             if (hazard.IsHazard()) {
                 const Location loc(command);
-                skip |= sync_state.LogError(
-                    string_SyncHazardVUID(hazard.Hazard()), view_state.Handle(), loc,
-                    "Hazard %s for %s in %s, Subpass #%d, and stencil part of pDepthStencilAttachment. Access info %s.",
-                    string_SyncHazard(hazard.Hazard()), sync_state.FormatHandle(view_state).c_str(),
-                    sync_state.FormatHandle(cmd_buffer).c_str(), cmd_buffer.GetActiveSubpass(),
-                    exec_context.FormatHazard(hazard).c_str());
+                skip |= exec_context.LogHazard(hazard, view_state.Handle(), loc, [&]() {
+                    return FormatHazardMessage("Hazard %s for %s in %s, Subpass #%d, and stencil part of pDepthStencilAttachment. "
+                                               "Access info %s.", string_SyncHazard(hazard.Hazard()),
+                                               sync_state.FormatHandle(view_state).c_str(),
+                                               sync_state.FormatHandle(cmd_buffer).c_str(), cmd_buffer.GetActiveSubpass(),
+                                               exec_context.FormatHazard(hazard).c_str());
+                });
             }
         }
     }
@@ -595,7 +602,7 @@ void RenderPassAccessContext::RecordDrawSubpassAttachment(const vvl::CommandBuff
                 subpass.pColorAttachments[location].attachment == VK_ATTACHMENT_UNUSED) {
                 continue;
             }
-            const AttachmentViewGen &view_gen = attachment_views_[subpass.pColorAttachments[location].attachment];
+            const AttachmentViewGen &view_gen = AttachmentViews()[subpass.pColorAttachments[location].attachment];
             current_context.UpdateAccessState(view_gen, AttachmentViewGen::Gen::kRenderArea,
                                               SYNC_COLOR_ATTACHMENT_OUTPUT_COLOR_ATTACHMENT_WRITE, SyncOrdering::kColorAttachment,
                                               tag);
@@ -606,8 +613,8 @@ void RenderPassAccessContext::RecordDrawSubpassAttachment(const vvl::CommandBuff
     // PHASE1 TODO: Read operations for both depth and stencil are possible in the future.
     const auto *ds_state = pipe->DepthStencilState();
     const uint32_t depth_stencil_attachment = GetSubpassDepthStencilAttachmentIndex(ds_state, subpass.pDepthStencilAttachment);
-    if ((depth_stencil_attachment != VK_ATTACHMENT_UNUSED) && attachment_views_[depth_stencil_attachment].IsValid()) {
-        const AttachmentViewGen &view_gen = attachment_views_[depth_stencil_attachment];
+    if ((depth_stencil_attachment != VK_ATTACHMENT_UNUSED) && AttachmentViews()[depth_stencil_attachment].IsValid()) {
+        const AttachmentViewGen &view_gen = AttachmentViews()[depth_stencil_attachment];
         const vvl::ImageView &view_state = *view_gen.GetViewState();
         bool depth_write = false, stencil_write = false;
         const bool has_depth = 0 != (view_state.normalized_subresource_range.aspectMask & VK_IMAGE_ASPECT_DEPTH_BIT);
@@ -730,7 +737,7 @@ ClearAttachmentInfo RenderPassAccessContext::GetClearAttachmentInfo(const VkClea
     if (attachment_index == VK_ATTACHMENT_UNUSED) {
         return ClearAttachmentInfo();
     }
-    const syncval_state::ImageViewState *view_state = attachment_views_[attachment_index].GetViewState();
+    const syncval_state::ImageViewState *view_state = AttachmentViews()[attachment_index].GetViewState();
     if (!view_state) {
         return ClearAttachmentInfo();
     }
@@ -750,15 +757,15 @@ bool RenderPassAccessContext::ValidateNextSubpass(const CommandExecutionContext
     }
     const auto &next_context = subpass_contexts_[next_subpass];
     skip |=
-        ValidateLayoutTransitions(exec_context, next_context, *rp_state_, render_area_, next_subpass, attachment_views_, command);
+        ValidateLayoutTransitions(exec_context, next_context, *rp_state_, render_area_, next_subpass, AttachmentViews(), command);
     if (!skip) {
         // To avoid complex (and buggy) duplication of the affect of layout transitions on load operations, we'll record them
         // on a copy of the (empty) next context.
         // Note: The resource access map should be empty so hopefully this copy isn't too horrible from a perf POV.
         AccessContext temp_context(next_context);
-        RecordLayoutTransitions(*rp_state_, next_subpass, attachment_views_, kInvalidTag, temp_context);
+        RecordLayoutTransitions(*rp_state_, next_subpass, AttachmentViews(), kInvalidTag, temp_context);
         skip |=
-            ValidateLoadOperation(exec_context, temp_context, *rp_state_, render_area_, next_subpass, attachment_views_, command);
+            ValidateLoadOperation(exec_context, temp_context, *rp_state_, render_area_, next_subpass, AttachmentViews(), command);
     }
     return skip;
 }
@@ -772,7 +779,7 @@ bool RenderPassAccessContext::ValidateEndRenderPass(const CommandExecutionContex
 }
 
 AccessContext *RenderPassAccessContext::CreateStoreResolveProxy() const {
-    return CreateStoreResolveProxyContext(CurrentContext(), *rp_state_, current_subpass_, attachment_views_);
+    return CreateStoreResolveProxyContext(CurrentContext(), *rp_state_, current_subpass_, AttachmentViews());
 }
 
 bool RenderPassAccessContext::ValidateFinalSubpassLayoutTransitions(const CommandExecutionContext &exec_context,
@@ -789,7 +796,7 @@ bool RenderPassAccessContext::ValidateFinalSubpassLayoutTransitions(const Comman
     // Get them from where there we're hidding in the extra entry.
     const auto &final_transitions = rp_state_->subpass_transitions.back();
     for (const auto &transition : final_transitions) {
-        const auto &view_gen = attachment_views_[transition.attachment];
+        const auto &view_gen = AttachmentViews()[transition.attachment];
         const auto &trackback = subpass_contexts_[transition.prev_pass].GetDstExternalTrackBack();
         assert(trackback.source_subpass);  // Transitions are given implicit transitions if the StateTracker is working correctly
         auto *context = trackback.source_subpass;
@@ -816,13 +823,14 @@ bool RenderPassAccessContext::ValidateFinalSubpassLayoutTransitions(const Comman
                     string_SyncHazard(hazard.Hazard()), transition.prev_pass, transition.attachment,
                     string_VkImageLayout(transition.old_layout), string_VkImageLayout(transition.new_layout));
             } else {
-                skip |= exec_context.GetSyncState().LogError(
-                    string_SyncHazardVUID(hazard.Hazard()), rp_state_->Handle(), loc,
-                    "Hazard %s with last use subpass %" PRIu32 " for attachment %" PRIu32
-                    " final image layout transition (old_layout: %s, new_layout: %s). Access info %s.",
-                    string_SyncHazard(hazard.Hazard()), transition.prev_pass, transition.attachment,
-                    string_VkImageLayout(transition.old_layout), string_VkImageLayout(transition.new_layout),
-                    exec_context.FormatHazard(hazard).c_str());
+                skip |= exec_context.LogHazard(hazard, rp_state_->Handle(), loc, [&]() {
+                    return FormatHazardMessage("Hazard %s with last use subpass %" PRIu32 " for attachment %" PRIu32
+                                               " final image layout transition (old_layout: %s, new_layout: %s). Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), transition.prev_pass, transition.attachment,
+                                               string_VkImageLayout(transition.old_layout),
+                                               string_VkImageLayout(transition.new_layout),
+                                               exec_context.FormatHazard(hazard).c_str());
+                });
             }
         }
     }
@@ -831,7 +839,7 @@ bool RenderPassAccessContext::ValidateFinalSubpassLayoutTransitions(const Comman
 
 void RenderPassAccessContext::RecordLayoutTransitions(const ResourceUsageTag tag) {
     // Add layout transitions...
-    RecordLayoutTransitions(*rp_state_, current_subpass_, attachment_views_, tag, subpass_contexts_[current_subpass_]);
+    RecordLayoutTransitions(*rp_state_, current_subpass_, AttachmentViews(), tag, subpass_contexts_[current_subpass_]);
 }
 
 void RenderPassAccessContext::RecordLoadOperations(const ResourceUsageTag tag) {
@@ -840,7 +848,7 @@ void RenderPassAccessContext::RecordLoadOperations(const ResourceUsageTag tag) {
 
     for (uint32_t i = 0; i < rp_state_->create_info.attachmentCount; i++) {
         if (rp_state_->attachment_first_subpass[i] == current_subpass_) {
-            const AttachmentViewGen &view_gen = attachment_views_[i];
+            const AttachmentViewGen &view_gen = AttachmentViews()[i];
             if (!view_gen.IsValid()) continue;  // UNUSED
 
             const auto &ci = attachment_ci[i];
@@ -886,12 +894,12 @@ AttachmentViewGenVector RenderPassAccessContext::CreateAttachmentViewGen(
 }
 RenderPassAccessContext::RenderPassAccessContext(const vvl::RenderPass &rp_state, const VkRect2D &render_area,
                                                  VkQueueFlags queue_flags,
-                                                 const std::vector<const syncval_state::ImageViewState *> &attachment_views,
+                                                 std::shared_ptr<const AttachmentViewGenVector> attachment_views,
                                                  const AccessContext *external_context)
-    : rp_state_(&rp_state), render_area_(render_area), current_subpass_(0U), attachment_views_() {
+    : rp_state_(&rp_state), render_area_(render_area), current_subpass_(0U), attachment_views_(std::move(attachment_views)) {
+    assert(attachment_views_);
     // Add this for all subpasses here so that they exist during next subpass validation
     InitSubpassContexts(queue_flags, rp_state, external_context, subpass_contexts_);
-    attachment_views_ = CreateAttachmentViewGen(render_area, attachment_views);
 }
 void RenderPassAccessContext::RecordBeginRenderPass(const ResourceUsageTag barrier_tag, const ResourceUsageTag load_tag) {
     assert(0 == current_subpass_);
@@ -905,8 +913,8 @@ void RenderPassAccessContext::RecordBeginRenderPass(const ResourceUsageTag barri
 void RenderPassAccessContext::RecordNextSubpass(const ResourceUsageTag store_tag, const ResourceUsageTag barrier_tag,
                                                 const ResourceUsageTag load_tag) {
     // Resolves are against *prior* subpass context and thus *before* the subpass increment
-    UpdateAttachmentResolveAccess(*rp_state_, attachment_views_, current_subpass_, store_tag, CurrentContext());
-    UpdateAttachmentStoreAccess(*rp_state_, attachment_views_, current_subpass_, store_tag, CurrentContext());
+    UpdateAttachmentResolveAccess(*rp_state_, AttachmentViews(), current_subpass_, store_tag, CurrentContext());
+    UpdateAttachmentStoreAccess(*rp_state_, AttachmentViews(), current_subpass_, store_tag, CurrentContext());
 
     if (current_subpass_ + 1 >= subpass_contexts_.size()) {
         return;
@@ -924,8 +932,8 @@ void RenderPassAccessContext::RecordNextSubpass(const ResourceUsageTag store_tag
 void RenderPassAccessContext::RecordEndRenderPass(AccessContext *external_context, const ResourceUsageTag store_tag,
                                                   const ResourceUsageTag barrier_tag) {
     // Add the resolve and store accesses
-    UpdateAttachmentResolveAccess(*rp_state_, attachment_views_, current_subpass_, store_tag, CurrentContext());
-    UpdateAttachmentStoreAccess(*rp_state_, attachment_views_, current_subpass_, store_tag, CurrentContext());
+    UpdateAttachmentResolveAccess(*rp_state_, AttachmentViews(), current_subpass_, store_tag, CurrentContext());
+    UpdateAttachmentStoreAccess(*rp_state_, AttachmentViews(), current_subpass_, store_tag, CurrentContext());
 
     // Export the accesses from the renderpass...
     external_context->ResolveChildContexts(subpass_contexts_);
@@ -937,7 +945,7 @@ void RenderPassAccessContext::RecordEndRenderPass(AccessContext *external_contex
     //      that had mulitple final layout transistions from mulitple final subpasses.
     const auto &final_transitions = rp_state_->subpass_transitions.back();
     for (const auto &transition : final_transitions) {
-        const AttachmentViewGen &view_gen = attachment_views_[transition.attachment];
+        const AttachmentViewGen &view_gen = AttachmentViews()[transition.attachment];
         const auto &last_trackback = subpass_contexts_[transition.prev_pass].GetDstExternalTrackBack();
         assert(&subpass_contexts_[transition.prev_pass] == last_trackback.source_subpass);
         ApplyBarrierOpsFunctor<PipelineBarrierOp> barrier_action(true /* resolve */, last_trackback.barriers.size(), barrier_tag);
@@ -104,9 +104,10 @@ class RenderPassAccessContext {
     static AttachmentViewGenVector CreateAttachmentViewGen(
         const VkRect2D &render_area, const std::vector<const syncval_state::ImageViewState *> &attachment_views);
     RenderPassAccessContext() : rp_state_(nullptr), render_area_(VkRect2D()), current_subpass_(0) {}
+    // The attachment views are shared with the begin render pass operation that validated them, and with every render
+    // pass instance begun again with the same framebuffer and render area (see SyncValidator::GetAttachmentViewGens)
     RenderPassAccessContext(const vvl::RenderPass &rp_state, const VkRect2D &render_area, VkQueueFlags queue_flags,
-                            const std::vector<const syncval_state::ImageViewState *> &attachment_views,
-                            const AccessContext *external_context);
+                            std::shared_ptr<const AttachmentViewGenVector> attachment_views, const AccessContext *external_context);
 
     static bool ValidateLayoutTransitions(const SyncValidationInfo &val_info, const AccessContext &access_context,
                                           const vvl::RenderPass &rp_state, const VkRect2D &render_area, uint32_t subpass,
@@ -149,14 +150,17 @@ class RenderPassAccessContext {
     AccessContext &CurrentContext() { return subpass_contexts_[current_subpass_]; }
     const AccessContext &CurrentContext() const { return subpass_contexts_[current_subpass_]; }
     const std::vector<AccessContext> &GetContexts() const { return subpass_contexts_; }
+    std::vector<AccessContext> &GetContexts() { return subpass_contexts_; }
     uint32_t GetCurrentSubpass() const { return current_subpass_; }
     const vvl::RenderPass *GetRenderPassState() const { return rp_state_; }
     AccessContext *CreateStoreResolveProxy() const;
 
   private:
+    const AttachmentViewGenVector &AttachmentViews() const { return *attachment_views_; }
+
     const vvl::RenderPass *rp_state_;
     const VkRect2D render_area_;
     uint32_t current_subpass_;
     std::vector<AccessContext> subpass_contexts_;
-    AttachmentViewGenVector attachment_views_;
+    std::shared_ptr<const AttachmentViewGenVector> attachment_views_;
 };
@@ -0,0 +1,31 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+// Default values for those settings should match layers/VkLayer_khronos_validation.json.in
+
+struct SyncValSettings {
+    // Worker threads used by submit time validation, 0 keeps all the work on the submitting thread
+    uint32_t submit_time_validation_threads = 0;
+    // Size in MB above which the command details of the oldest submissions are discarded, 0 keeps everything
+    uint32_t history_memory_budget_mb = 0;
+    // Track buffer accesses at whole buffer granularity, buffers with a hazard found this way switch to exact ranges
+    bool coarse_buffer_tracking = false;
+};
@@ -185,6 +185,11 @@ void QueueBatchContext::Trim() {
 
     // Only conserve AccessLog references that are referenced by used_tags
     batch_log_.Trim(used_tags);
+
+    const uint32_t budget_mb = sync_state_->syncval_settings.history_memory_budget_mb;
+    if (budget_mb > 0) {
+        batch_log_.EvictToBudget(size_t(budget_mb) * 1024 * 1024);
+    }
 }
 
 void QueueBatchContext::ResolveSubmittedCommandBuffer(const AccessContext& recorded_context, ResourceUsageTag offset) {
@@ -250,6 +255,8 @@ void QueueBatchContext::Cleanup() {
     // Clear these after validation and import, not valid after.
     batch_ = BatchAccessLog::BatchRecord();
     command_buffers_.clear();
+    // The async references point into the async batches
+    access_context_.ClearAsyncContexts();
     async_batches_.clear();
     current_label_stack_ = nullptr;
 }
@@ -382,11 +389,12 @@ bool QueueBatchContext::DoQueuePresentValidate(const Location& loc, const Presen
             const auto queue_handle = queue_state_->Handle();
             const auto swap_handle = vvl::StateObject::Handle(presented.swapchain_state.lock());
             const auto image_handle = vvl::StateObject::Handle(presented.image);
-            skip |= sync_state_->LogError(
-                string_SyncHazardVUID(hazard.Hazard()), queue_handle, loc,
-                "Hazard %s for present pSwapchains[%" PRIu32 "] , swapchain %s, image index %" PRIu32 " %s, Access info %s.",
-                string_SyncHazard(hazard.Hazard()), presented.present_index, sync_state_->FormatHandle(swap_handle).c_str(),
-                presented.image_index, sync_state_->FormatHandle(image_handle).c_str(), FormatHazard(hazard).c_str());
+            skip |= LogHazard(hazard, queue_handle, loc, [&]() {
+                return FormatHazardMessage("Hazard %s for present pSwapchains[%" PRIu32 "] , swapchain %s, image index %" PRIu32
+                                           " %s, Access info %s.", string_SyncHazard(hazard.Hazard()), presented.present_index,
+                                           sync_state_->FormatHandle(swap_handle).c_str(), presented.image_index,
+                                           sync_state_->FormatHandle(image_handle).c_str(), FormatHazard(hazard).c_str());
+            });
             if (skip) break;
         }
     }
@@ -424,13 +432,12 @@ void QueueBatchContext::LogAcquireOperation(const PresentedImage& presented, vvl
     access_log->emplace_back(AcquireResourceRecord(presented, tag_range_.begin, command));
 }
 
-void QueueBatchContext::SetupAccessContext(const std::shared_ptr<const QueueBatchContext>& prev, const VkSubmitInfo2& submit_info,
+void QueueBatchContext::SetupAccessContext(const std::shared_ptr<const QueueBatchContext>& prev, const BatchSubmitInfo& submit_info,
                                            SignaledSemaphoresUpdate& signaled_semaphores_update) {
     // Import (resolve) the batches that are waited on, with the semaphore's effective barriers applied
     ConstBatchSet batches_resolved;
-    const uint32_t wait_count = submit_info.waitSemaphoreInfoCount;
-    const VkSemaphoreSubmitInfo* wait_infos = submit_info.pWaitSemaphoreInfos;
-    for (const auto& wait_info : vvl::make_span(wait_infos, wait_count)) {
+    for (uint32_t wait_index = 0; wait_index < submit_info.WaitSemaphoreCount(); ++wait_index) {
+        const VkSemaphoreSubmitInfo wait_info = submit_info.WaitSemaphore(wait_index);
         std::shared_ptr<QueueBatchContext> resolved =
             ResolveOneWaitSemaphore(wait_info.semaphore, wait_info.stageMask, signaled_semaphores_update);
         if (resolved) {
@@ -489,17 +496,16 @@ void QueueBatchContext::CommonSetupAccessContext(const std::shared_ptr<const Que
     }
 }
 
-void QueueBatchContext::SetupCommandBufferInfo(const VkSubmitInfo2& submit_info) {
+void QueueBatchContext::SetupCommandBufferInfo(const BatchSubmitInfo& submit_info) {
     // Create the list of command buffers to submit
-    const uint32_t cb_count = submit_info.commandBufferInfoCount;
-    const VkCommandBufferSubmitInfo* const cb_infos = submit_info.pCommandBufferInfos;
+    const uint32_t cb_count = submit_info.CommandBufferCount();
     command_buffers_.reserve(cb_count);
 
-    for (const auto& cb_info : vvl::make_span(cb_infos, cb_count)) {
-        auto cb_state = sync_state_->Get<syncval_state::CommandBuffer>(cb_info.commandBuffer);
+    for (uint32_t cb_index = 0; cb_index < cb_count; ++cb_index) {
+        auto cb_state = sync_state_->Get<syncval_state::CommandBuffer>(submit_info.CommandBuffer(cb_index));
         if (cb_state) {
             tag_range_.end += cb_state->access_context.GetTagLimit();
-            command_buffers_.emplace_back(static_cast<uint32_t>(&cb_info - cb_infos), std::move(cb_state));
+            command_buffers_.emplace_back(cb_index, std::move(cb_state));
         }
     }
 }
@@ -520,6 +526,8 @@ std::string QueueBatchContext::FormatUsage(ResourceUsageTag tag) const {
 
         // Commandbuffer Usages Information
         out << ", " << record.Formatter(*sync_state_, nullptr, access.debug_name_provider);
+    } else if (batch_log_.IsEvicted(tag)) {
+        out << "usage info discarded to stay within syncval_history_memory_budget, tag: " << tag;
     }
     return out.str();
 }
@@ -545,7 +553,7 @@ void QueueBatchContext::SetupBatchTags() {
     SetTagBias(global_tags.begin);
 }
 
-void QueueBatchContext::SetCurrentLabelStack(std::vector<std::string>* current_label_stack) {
+void QueueBatchContext::SetCurrentLabelStack(std::vector<std::string_view>* current_label_stack) {
     assert(current_label_stack != nullptr);
     this->current_label_stack_ = current_label_stack;
 }
@@ -572,7 +580,7 @@ void QueueBatchContext::SetTagBias(ResourceUsageTag bias) {
 }
 
 bool QueueBatchContext::DoQueueSubmitValidate(const SyncValidator& sync_state, QueueSubmitCmdState& cmd_state,
-                                              const VkSubmitInfo2& batch_info) {
+                                              const BatchSubmitInfo& batch_info) {
     bool skip = false;
 
     //  For each submit in the batch...
@@ -585,6 +593,7 @@ bool QueueBatchContext::DoQueueSubmitValidate(const SyncValidator& sync_state, Q
             batch_.cb_index++;
             continue;
         }
+        auto span = sync_state.TraceSpan("SyncValidation", "ReplayCommandBuffer");
         skip |= ReplayState(*this, cb_access_context, cmd_state.error_obj, cb.index).ValidateFirstUse();
 
         // The barriers have already been applied in ValidatFirstUse
@@ -696,78 +705,61 @@ uint64_t QueueSyncState::ReserveSubmitId() const { return submit_index_.fetch_ad
 
 void QueueSyncState::SetPendingLastBatch(std::shared_ptr<QueueBatchContext>&& last) const { pending_last_batch_ = std::move(last); }
 
-VkSemaphoreSubmitInfo SubmitInfoConverter::BatchStore::WaitSemaphore(const VkSubmitInfo& info, uint32_t index) {
+VkSemaphoreSubmitInfo BatchSubmitInfo::WaitSemaphore(uint32_t index) const {
+    if (info2_) {
+        return info2_->pWaitSemaphoreInfos[index];
+    }
     VkSemaphoreSubmitInfo semaphore_info = vku::InitStructHelper();
-    semaphore_info.semaphore = info.pWaitSemaphores[index];
-    semaphore_info.stageMask = info.pWaitDstStageMask[index];
+    semaphore_info.semaphore = info_->pWaitSemaphores[index];
+    semaphore_info.stageMask = info_->pWaitDstStageMask[index];
     return semaphore_info;
 }
-VkCommandBufferSubmitInfo SubmitInfoConverter::BatchStore::CommandBuffer(const VkSubmitInfo& info, uint32_t index) {
-    VkCommandBufferSubmitInfo cb_info = vku::InitStructHelper();
-    cb_info.commandBuffer = info.pCommandBuffers[index];
-    return cb_info;
-}
 
-VkSemaphoreSubmitInfo SubmitInfoConverter::BatchStore::SignalSemaphore(const VkSubmitInfo& info, uint32_t index,
-                                                                       VkQueueFlags queue_flags) {
+VkSemaphoreSubmitInfo BatchSubmitInfo::SignalSemaphore(uint32_t index) const {
+    if (info2_) {
+        return info2_->pSignalSemaphoreInfos[index];
+    }
     VkSemaphoreSubmitInfo semaphore_info = vku::InitStructHelper();
-    semaphore_info.semaphore = info.pSignalSemaphores[index];
+    semaphore_info.semaphore = info_->pSignalSemaphores[index];
     semaphore_info.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
     return semaphore_info;
 }
 
-SubmitInfoConverter::BatchStore::BatchStore(const VkSubmitInfo& info, VkQueueFlags queue_flags) {
-    info2 = vku::InitStructHelper();
-
-    info2.waitSemaphoreInfoCount = info.waitSemaphoreCount;
-    waits.reserve(info2.waitSemaphoreInfoCount);
-    for (uint32_t i = 0; i < info2.waitSemaphoreInfoCount; ++i) {
-        waits.emplace_back(WaitSemaphore(info, i));
-    }
-    info2.pWaitSemaphoreInfos = waits.data();
-
-    info2.commandBufferInfoCount = info.commandBufferCount;
-    cbs.reserve(info2.commandBufferInfoCount);
-    for (uint32_t i = 0; i < info2.commandBufferInfoCount; ++i) {
-        cbs.emplace_back(CommandBuffer(info, i));
-    }
-    info2.pCommandBufferInfos = cbs.data();
-
-    info2.signalSemaphoreInfoCount = info.signalSemaphoreCount;
-    signals.reserve(info2.signalSemaphoreInfoCount);
-    for (uint32_t i = 0; i < info2.signalSemaphoreInfoCount; ++i) {
-        signals.emplace_back(SignalSemaphore(info, i, queue_flags));
-    }
-    info2.pSignalSemaphoreInfos = signals.data();
-}
-
-SubmitInfoConverter::SubmitInfoConverter(uint32_t count, const VkSubmitInfo* infos, VkQueueFlags queue_flags) {
-    info_store.reserve(count);
-    info2s.reserve(count);
-    for (uint32_t batch = 0; batch < count; ++batch) {
-        info_store.emplace_back(infos[batch], queue_flags);
-        info2s.emplace_back(info_store.back().info2);
-    }
-}
-
 ResourceUsageTag BatchAccessLog::Import(const BatchRecord& batch, const CommandBufferAccessContext& cb_access,
-                                        const std::vector<std::string>& initial_label_stack) {
+                                        const std::vector<std::string_view>& initial_label_stack) {
     ResourceUsageTag bias = batch.bias;
     ResourceUsageTag tag_limit = bias + cb_access.GetTagLimit();
     ResourceUsageRange import_range = {bias, tag_limit};
-    log_map_.insert(std::make_pair(import_range, CBSubmitLog(batch, cb_access, initial_label_stack)));
+    Insert(std::make_pair(import_range, CBSubmitLog(batch, cb_access, initial_label_stack)));
     return tag_limit;
 }
 
 void BatchAccessLog::Import(const BatchAccessLog& other) {
     for (const auto& entry : other.log_map_) {
-        log_map_.insert(entry);
+        Insert(entry);
     }
+    evicted_tag_limit_ = std::max(evicted_tag_limit_, other.evicted_tag_limit_);
 }
 
 void BatchAccessLog::Insert(const BatchRecord& batch, const ResourceUsageRange& range,
                             std::shared_ptr<const CommandExecutionContext::AccessLog> log) {
-    log_map_.insert(std::make_pair(range, CBSubmitLog(batch, nullptr, std::move(log))));
+    Insert(std::make_pair(range, CBSubmitLog(batch, nullptr, std::move(log))));
+}
+
+void BatchAccessLog::Insert(const CBSubmitLogRangeMap::value_type& entry) {
+    // Logs imported from several batches can overlap, only the first copy is kept and counted
+    if (log_map_.insert(entry).second) {
+        bytes_ += entry.second.Bytes();
+    }
+}
+
+BatchAccessLog::CBSubmitLogRangeMap::iterator BatchAccessLog::Erase(CBSubmitLogRangeMap::iterator first,
+                                                                    CBSubmitLogRangeMap::iterator last) {
+    for (auto it = first; it != last; ++it) {
+        assert(bytes_ >= it->second.Bytes());
+        bytes_ -= it->second.Bytes();
+    }
+    return log_map_.erase(first, last);
 }
 
 // Trim: Remove any unreferenced AccessLog ranges from a BatchAccessLog
@@ -800,7 +792,7 @@ void BatchAccessLog::Trim(const ResourceUsageTagSet& used_tags) {
     while (current_map_range != end_map) {
         if (current_tag == end_tag) {
             // We're out of tags, the rest of the map isn't referenced, so erase it
-            current_map_range = log_map_.erase(current_map_range, end_map);
+            current_map_range = Erase(current_map_range, end_map);
         } else {
             auto& range = current_map_range->first;
             const ResourceUsageTag tag = *current_tag;
@@ -812,7 +804,7 @@ void BatchAccessLog::Trim(const ResourceUsageTagSet& used_tags) {
                 // This tag is beyond the current range, delete all ranges between current_map_range,
                 // and the next that includes the tag.  Next is not erased.
                 auto next_used = log_map_.lower_bound(ResourceUsageRange(tag, tag + 1));
-                current_map_range = log_map_.erase(current_map_range, next_used);
+                current_map_range = Erase(current_map_range, next_used);
             } else {
                 // Skip the rest of the tags in this range
                 // If this is end, the next iteration will handle
@@ -825,13 +817,30 @@ void BatchAccessLog::Trim(const ResourceUsageTagSet& used_tags) {
     }
 }
 
+// EvictToBudget: Bound the memory held by the AccessLog history
+//
+// Trim only drops logs that no tag references, and applications that never wait for idle can keep old accesses (and thus
+// their logs) referenced forever. Tags are handed out in submission order, so the first entries of the map are the logs of
+// the oldest submissions. They are dropped first, hazard detection is not affected since it only uses the access contexts,
+// but reports involving the discarded accesses lose their command details.
+void BatchAccessLog::EvictToBudget(size_t budget) {
+    auto last_evicted = log_map_.begin();
+    size_t remaining = bytes_;
+    while (remaining > budget && last_evicted != log_map_.end() && std::next(last_evicted) != log_map_.end()) {
+        remaining -= last_evicted->second.Bytes();
+        evicted_tag_limit_ = std::max(evicted_tag_limit_, last_evicted->first.end);
+        ++last_evicted;
+    }
+    Erase(log_map_.begin(), last_evicted);
+}
+
 BatchAccessLog::AccessRecord BatchAccessLog::operator[](ResourceUsageTag tag) const {
     auto found_log = log_map_.find(tag);
     if (found_log != log_map_.cend()) {
         return found_log->second[tag];
     }
-    // tag not found
-    assert(false);
+    // tag not found, which is only expected when the log was discarded to stay within the memory budget
+    assert(IsEvicted(tag));
     return AccessRecord();
 }
 
@@ -854,12 +863,29 @@ BatchAccessLog::AccessRecord BatchAccessLog::CBSubmitLog::operator[](ResourceUsa
 BatchAccessLog::CBSubmitLog::CBSubmitLog(const BatchRecord& batch,
                                          std::shared_ptr<const CommandExecutionContext::CommandBufferSet> cbs,
                                          std::shared_ptr<const CommandExecutionContext::AccessLog> log)
-    : batch_(batch), cbs_(cbs), log_(log) {}
+    : batch_(batch), cbs_(cbs), log_(log) {
+    bytes_ = ComputeBytes();
+}
 
 BatchAccessLog::CBSubmitLog::CBSubmitLog(const BatchRecord& batch, const CommandBufferAccessContext& cb,
-                                         const std::vector<std::string>& initial_label_stack)
+                                         const std::vector<std::string_view>& initial_label_stack)
     : batch_(batch), cbs_(cb.GetCBReferencesShared()), log_(cb.GetAccessLogShared()), initial_label_stack_(initial_label_stack) {
     label_commands_ = (*cbs_)[0]->GetLabelCommands();  // TODO: when timelines are supported use cbs directly
+    bytes_ = ComputeBytes();
+}
+
+size_t BatchAccessLog::CBSubmitLog::ComputeBytes() const {
+    size_t bytes = sizeof(CBSubmitLog);
+    if (log_) {
+        bytes += log_->capacity() * sizeof(ResourceUsageRecord);
+    }
+    if (cbs_) {
+        bytes += cbs_->capacity() * sizeof(CommandExecutionContext::CommandBufferSet::value_type);
+    }
+    // The label names themselves are interned by the state tracker
+    bytes += initial_label_stack_.capacity() * sizeof(std::string_view);
+    bytes += label_commands_.capacity() * sizeof(vvl::CommandBuffer::LabelCommand);
+    return bytes;
 }
 
 PresentedImage::PresentedImage(const SyncValidator& sync_state, const std::shared_ptr<QueueBatchContext> batch_,
@@ -19,6 +19,7 @@
 #include "sync/sync_commandbuffer.h"
 #include "state_tracker/queue_state.h"
 
+class BatchSubmitInfo;
 struct PresentedImage;
 class QueueBatchContext;
 struct QueueSubmitCmdState;
@@ -153,8 +154,10 @@ class BatchAccessLog {
         CBSubmitLog(const BatchRecord &batch, std::shared_ptr<const CommandExecutionContext::CommandBufferSet> cbs,
                     std::shared_ptr<const CommandExecutionContext::AccessLog> log);
         CBSubmitLog(const BatchRecord &batch, const CommandBufferAccessContext &cb,
-                    const std::vector<std::string> &initial_label_stack);
+                    const std::vector<std::string_view> &initial_label_stack);
         size_t Size() const { return log_->size(); }
+        // Heap memory kept alive by this entry, computed once since the referenced logs are immutable after submit
+        size_t Bytes() const { return bytes_; }
         AccessRecord operator[](ResourceUsageTag tag) const;
 
         // DebugNameProvider
@@ -165,7 +168,7 @@ class BatchAccessLog {
         std::shared_ptr<const CommandExecutionContext::CommandBufferSet> cbs_;
         std::shared_ptr<const CommandExecutionContext::AccessLog> log_;
         // label stack at the point when command buffer is submitted to the queue
-        std::vector<std::string> initial_label_stack_;
+        std::vector<std::string_view> initial_label_stack_;
 
         // TODO: remove this field and use (*cbs_)[0]->GetLabelCommands() directly
         // when timeline semaphore support is implemented.
@@ -176,22 +179,35 @@ class BatchAccessLog {
         // false positives (which is okay for unsupported feeature), but label code can crash.
         // Make a copy of label commands as a temporary protection measure.
         std::vector<vvl::CommandBuffer::LabelCommand> label_commands_;
+        size_t bytes_ = 0;
+
+        size_t ComputeBytes() const;
     };
 
     ResourceUsageTag Import(const BatchRecord &batch, const CommandBufferAccessContext &cb_access,
-                            const std::vector<std::string> &initial_label_stack);
+                            const std::vector<std::string_view> &initial_label_stack);
     void Import(const BatchAccessLog &other);
     void Insert(const BatchRecord &batch, const ResourceUsageRange &range,
                 std::shared_ptr<const CommandExecutionContext::AccessLog> log);
 
     void Trim(const ResourceUsageTagSet &used);
+    // Drops the oldest logs until at most budget bytes are held. The newest log is always kept.
+    void EvictToBudget(size_t budget);
     // AccessRecord lookup is based on global tags
     AccessRecord operator[](ResourceUsageTag tag) const;
+    // True if the log for the tag could have been discarded by EvictToBudget
+    bool IsEvicted(ResourceUsageTag tag) const { return tag < evicted_tag_limit_; }
+    size_t Bytes() const { return bytes_; }
     BatchAccessLog() {}
 
   private:
     using CBSubmitLogRangeMap = sparse_container::range_map<ResourceUsageTag, CBSubmitLog>;
+    void Insert(const CBSubmitLogRangeMap::value_type &entry);
+    CBSubmitLogRangeMap::iterator Erase(CBSubmitLogRangeMap::iterator first, CBSubmitLogRangeMap::iterator last);
+
     CBSubmitLogRangeMap log_map_;
+    size_t bytes_ = 0;
+    ResourceUsageTag evicted_tag_limit_ = 0;
 };
 
 class QueueBatchContext : public CommandExecutionContext {
@@ -252,7 +268,7 @@ class QueueBatchContext : public CommandExecutionContext {
 
     void SetupBatchTags(const ResourceUsageRange &tag_range);
     void SetupBatchTags();
-    void SetCurrentLabelStack(std::vector<std::string>* current_label_stack);
+    void SetCurrentLabelStack(std::vector<std::string_view>* current_label_stack);
     void ResetEventsContext() { events_context_.Clear(); }
     ResourceUsageTag GetTagLimit() const override { return batch_.bias; }
     // begin is the tag bias  / .size() is the number of total records that should eventually be in access_log_
@@ -261,10 +277,10 @@ class QueueBatchContext : public CommandExecutionContext {
 
     void SetTagBias(ResourceUsageTag);
     // For Submit
-    void SetupAccessContext(const std::shared_ptr<const QueueBatchContext> &prev, const VkSubmitInfo2 &submit_info,
+    void SetupAccessContext(const std::shared_ptr<const QueueBatchContext> &prev, const BatchSubmitInfo &submit_info,
                             SignaledSemaphoresUpdate &signaled_semaphores_update);
-    void SetupCommandBufferInfo(const VkSubmitInfo2 &submit_info);
-    bool DoQueueSubmitValidate(const SyncValidator &sync_state, QueueSubmitCmdState &cmd_state, const VkSubmitInfo2 &submit_info);
+    void SetupCommandBufferInfo(const BatchSubmitInfo &submit_info);
+    bool DoQueueSubmitValidate(const SyncValidator &sync_state, QueueSubmitCmdState &cmd_state, const BatchSubmitInfo &submit_info);
     void ResolveSubmittedCommandBuffer(const AccessContext &recorded_context, ResourceUsageTag offset);
 
     // For Present
@@ -315,7 +331,7 @@ class QueueBatchContext : public CommandExecutionContext {
     BatchAccessLog::BatchRecord batch_;  // Holds the cumulative tag bias, and command buffer counts for Import support.
     CommandBuffers command_buffers_;
     ConstBatchSet async_batches_;
-    std::vector<std::string> *current_label_stack_ = nullptr;
+    std::vector<std::string_view> *current_label_stack_ = nullptr;
 };
 
 class QueueSyncState {
@@ -353,31 +369,26 @@ class QueueSyncState {
     QueueId id_;
 };
 
-// The converter needs to be more complex than simply an array of VkSubmitInfo2 structures.
-// In order to convert from Info->Info2, arrays of VkSemaphoreSubmitInfo and VkCommandBufferSubmitInfo
-// structures must be created for the pWaitSemaphoreInfos, pCommandBufferInfos, and pSignalSemaphoreInfos
-// which comprise the converted VkSubmitInfo information. The created VkSubmitInfo2 structure then references the storage
-// of the arrays, which must have a lifespan longer than the conversion, s.t. the ensuing valdation/record operations
-// can reference them.  The resulting VkSubmitInfo2 is then copied into an additional which takes the place of the pSubmits
-// parameter.
-struct SubmitInfoConverter {
-    struct BatchStore {
-        BatchStore(const VkSubmitInfo &info, VkQueueFlags queue_flags);
-
-        static VkSemaphoreSubmitInfo WaitSemaphore(const VkSubmitInfo &info, uint32_t index);
-        static VkCommandBufferSubmitInfo CommandBuffer(const VkSubmitInfo &info, uint32_t index);
-        static VkSemaphoreSubmitInfo SignalSemaphore(const VkSubmitInfo &info, uint32_t index, VkQueueFlags queue_flags);
-
-        std::vector<VkSemaphoreSubmitInfo> waits;
-        std::vector<VkCommandBufferSubmitInfo> cbs;
-        std::vector<VkSemaphoreSubmitInfo> signals;
-        VkSubmitInfo2 info2;
-    };
-
-    SubmitInfoConverter(uint32_t count, const VkSubmitInfo *infos, VkQueueFlags queue_flags);
+// One batch of vkQueueSubmit or vkQueueSubmit2, with the waits, command buffers and signals of a VkSubmitInfo read like the
+// ones of a VkSubmitInfo2. Nothing is copied: the VkSemaphoreSubmitInfo of a VkSubmitInfo batch are made when asked for, so a
+// submit does not allocate arrays of converted structures.
+class BatchSubmitInfo {
+  public:
+    BatchSubmitInfo(const VkSubmitInfo &info) : info_(&info) {}
+    BatchSubmitInfo(const VkSubmitInfo2 &info) : info2_(&info) {}
+
+    uint32_t WaitSemaphoreCount() const { return info2_ ? info2_->waitSemaphoreInfoCount : info_->waitSemaphoreCount; }
+    VkSemaphoreSubmitInfo WaitSemaphore(uint32_t index) const;
+    uint32_t CommandBufferCount() const { return info2_ ? info2_->commandBufferInfoCount : info_->commandBufferCount; }
+    VkCommandBuffer CommandBuffer(uint32_t index) const {
+        return info2_ ? info2_->pCommandBufferInfos[index].commandBuffer : info_->pCommandBuffers[index];
+    }
+    uint32_t SignalSemaphoreCount() const { return info2_ ? info2_->signalSemaphoreInfoCount : info_->signalSemaphoreCount; }
+    VkSemaphoreSubmitInfo SignalSemaphore(uint32_t index) const;
 
-    std::vector<BatchStore> info_store;
-    std::vector<VkSubmitInfo2> info2s;
+  private:
+    const VkSubmitInfo *info_ = nullptr;
+    const VkSubmitInfo2 *info2_ = nullptr;
 };
 
 struct QueueSubmitCmdState {
@@ -16,6 +16,8 @@
  */
 
 #include <algorithm>
+#include <cstdarg>
+#include <cstdio>
 #include <limits>
 #include <memory>
 #include <vector>
@@ -24,6 +26,45 @@
 #include "sync/sync_image.h"
 #include "state_tracker/device_state.h"
 #include "state_tracker/buffer_state.h"
+#include "state_tracker/render_pass_state.h"
+
+std::string FormatHazardMessage(const char *format, ...) {
+    va_list argptr;
+    va_start(argptr, format);
+    va_list arg_copy;
+    va_copy(arg_copy, argptr);
+    std::string message(256, '\0');
+    const int result = vsnprintf(message.data(), message.size(), format, arg_copy);
+    va_end(arg_copy);
+    if (result < 0) {
+        message = "Message generation failure";
+    } else if (static_cast<size_t>(result) < message.size()) {
+        message.resize(result);
+    } else {
+        // The size given to vsnprintf includes the trailing '\0', the result does not
+        message.resize(result + 1);
+        vsnprintf(message.data(), message.size(), format, argptr);
+        message.resize(result);
+    }
+    va_end(argptr);
+    return message;
+}
+
+ReadLockGuard SyncValidator::ReadLock() const {
+    if (fine_grained_locking) {
+        return ReadLockGuard(validation_object_mutex, std::defer_lock);
+    } else {
+        return ReadLockGuard(validation_object_mutex);
+    }
+}
+
+WriteLockGuard SyncValidator::WriteLock() {
+    if (fine_grained_locking) {
+        return WriteLockGuard(validation_object_mutex, std::defer_lock);
+    } else {
+        return WriteLockGuard(validation_object_mutex);
+    }
+}
 
 ResourceUsageRange SyncValidator::ReserveGlobalTagRange(size_t tag_count) const {
     ResourceUsageRange reserve;
@@ -32,6 +73,45 @@ ResourceUsageRange SyncValidator::ReserveGlobalTagRange(size_t tag_count) const
     return reserve;
 }
 
+std::shared_ptr<const AttachmentViewGenVector> SyncValidator::GetAttachmentViewGens(
+    const vvl::Framebuffer &fb_state, const VkRect2D &render_area,
+    const std::vector<const syncval_state::ImageViewState *> &attachments) const {
+    const bool cacheable = (fb_state.create_info.flags & VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT) == 0;
+    auto matches = [&fb_state, &render_area, &attachments](const AttachmentViewGenCacheEntry &entry) {
+        if (!entry.view_gens || entry.framebuffer_id != fb_state.GetId()) return false;
+        if (entry.render_area.offset.x != render_area.offset.x || entry.render_area.offset.y != render_area.offset.y ||
+            entry.render_area.extent.width != render_area.extent.width ||
+            entry.render_area.extent.height != render_area.extent.height) {
+            return false;
+        }
+        // The views are held by the framebuffer, this only guards against a view destroyed while it is still attached
+        const AttachmentViewGenVector &view_gens = *entry.view_gens;
+        if (view_gens.size() != attachments.size()) return false;
+        for (size_t i = 0; i < attachments.size(); ++i) {
+            if (view_gens[i].GetViewState() != attachments[i]) return false;
+        }
+        return true;
+    };
+
+    if (cacheable) {
+        std::lock_guard<std::mutex> guard(attachment_view_gen_cache_lock_);
+        for (const auto &entry : attachment_view_gen_cache_) {
+            if (matches(entry)) {
+                return entry.view_gens;
+            }
+        }
+    }
+
+    auto view_gens =
+        std::make_shared<const AttachmentViewGenVector>(RenderPassAccessContext::CreateAttachmentViewGen(render_area, attachments));
+    if (cacheable) {
+        std::lock_guard<std::mutex> guard(attachment_view_gen_cache_lock_);
+        attachment_view_gen_cache_[attachment_view_gen_cache_next_] = {fb_state.GetId(), render_area, view_gens};
+        attachment_view_gen_cache_next_ = (attachment_view_gen_cache_next_ + 1) % kAttachmentViewGenCacheSize;
+    }
+    return view_gens;
+}
+
 void SyncValidator::UpdateSignaledSemaphores(SignaledSemaphoresUpdate &update,
                                              const std::shared_ptr<QueueBatchContext> &last_batch) {
     // NOTE: All conserved QueueBatchContexts need to have their access logs reset to use the global
@@ -150,7 +230,7 @@ std::shared_ptr<QueueSyncState> SyncValidator::GetQueueSyncStateShared(VkQueue q
 std::shared_ptr<vvl::CommandBuffer> SyncValidator::CreateCmdBufferState(VkCommandBuffer handle,
                                                                         const VkCommandBufferAllocateInfo *pCreateInfo,
                                                                         const vvl::CommandPool *cmd_pool) {
-    auto cb_state = std::make_shared<syncval_state::CommandBuffer>(*this, handle, pCreateInfo, cmd_pool);
+    auto cb_state = vvl::MakeState<syncval_state::CommandBuffer>(*this, handle, pCreateInfo, cmd_pool);
     if (cb_state) {
         cb_state->access_context.SetSelfReference();
     }
@@ -159,23 +239,27 @@ std::shared_ptr<vvl::CommandBuffer> SyncValidator::CreateCmdBufferState(VkComman
 
 std::shared_ptr<vvl::Swapchain> SyncValidator::CreateSwapchainState(const VkSwapchainCreateInfoKHR *create_info,
                                                                     VkSwapchainKHR handle) {
-    return std::static_pointer_cast<vvl::Swapchain>(std::make_shared<syncval_state::Swapchain>(*this, create_info, handle));
+    return std::static_pointer_cast<vvl::Swapchain>(vvl::MakeState<syncval_state::Swapchain>(*this, create_info, handle));
+}
+
+std::shared_ptr<vvl::Buffer> SyncValidator::CreateBufferState(VkBuffer handle, const VkBufferCreateInfo *pCreateInfo) {
+    return vvl::MakeState<syncval_state::BufferState>(*this, handle, pCreateInfo, syncval_settings.coarse_buffer_tracking);
 }
 
 std::shared_ptr<vvl::Image> SyncValidator::CreateImageState(VkImage handle, const VkImageCreateInfo *pCreateInfo,
                                                             VkFormatFeatureFlags2KHR features) {
-    return std::make_shared<ImageState>(*this, handle, pCreateInfo, features);
+    return vvl::MakeState<ImageState>(*this, handle, pCreateInfo, features);
 }
 
 std::shared_ptr<vvl::Image> SyncValidator::CreateImageState(VkImage handle, const VkImageCreateInfo *pCreateInfo,
                                                             VkSwapchainKHR swapchain, uint32_t swapchain_index,
                                                             VkFormatFeatureFlags2KHR features) {
-    return std::make_shared<ImageState>(*this, handle, pCreateInfo, swapchain, swapchain_index, features);
+    return vvl::MakeState<ImageState>(*this, handle, pCreateInfo, swapchain, swapchain_index, features);
 }
 std::shared_ptr<vvl::ImageView> SyncValidator::CreateImageViewState(
     const std::shared_ptr<vvl::Image> &image_state, VkImageView iv, const VkImageViewCreateInfo *ci, VkFormatFeatureFlags2KHR ff,
     const VkFilterCubicImageViewImageFormatPropertiesEXT &cubic_props) {
-    return std::make_shared<ImageViewState>(image_state, iv, ci, ff, cubic_props);
+    return vvl::MakeState<ImageViewState>(image_state, iv, ci, ff, cubic_props);
 }
 
 bool SyncValidator::PreCallValidateCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
@@ -199,10 +283,11 @@ bool SyncValidator::PreCallValidateCmdCopyBuffer(VkCommandBuffer commandBuffer,
             auto hazard = context->DetectHazard(*src_buffer, SYNC_COPY_TRANSFER_READ, src_range);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, srcBuffer);
-                skip |=
-                    LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, error_obj.location,
-                             "Hazard %s for srcBuffer %s, region %" PRIu32 ". Access info %s.", string_SyncHazard(hazard.Hazard()),
-                             FormatHandle(srcBuffer).c_str(), region, cb_context->FormatHazard(hazard).c_str());
+                skip |= cb_context->LogHazard(hazard, objlist, error_obj.location, [&]() {
+                    return FormatHazardMessage("Hazard %s for srcBuffer %s, region %" PRIu32 ". Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), FormatHandle(srcBuffer).c_str(), region,
+                                               cb_context->FormatHazard(hazard).c_str());
+                });
             }
         }
         if (dst_buffer && !skip) {
@@ -210,10 +295,11 @@ bool SyncValidator::PreCallValidateCmdCopyBuffer(VkCommandBuffer commandBuffer,
             auto hazard = context->DetectHazard(*dst_buffer, SYNC_COPY_TRANSFER_WRITE, dst_range);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, dstBuffer);
-                skip |=
-                    LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, error_obj.location,
-                             "Hazard %s for dstBuffer %s, region %" PRIu32 ". Access info %s.", string_SyncHazard(hazard.Hazard()),
-                             FormatHandle(dstBuffer).c_str(), region, cb_context->FormatHazard(hazard).c_str());
+                skip |= cb_context->LogHazard(hazard, objlist, error_obj.location, [&]() {
+                    return FormatHazardMessage("Hazard %s for dstBuffer %s, region %" PRIu32 ". Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), FormatHandle(dstBuffer).c_str(), region,
+                                               cb_context->FormatHazard(hazard).c_str());
+                });
             }
         }
         if (skip) break;
@@ -267,10 +353,11 @@ bool SyncValidator::PreCallValidateCmdCopyBuffer2(VkCommandBuffer commandBuffer,
             if (hazard.IsHazard()) {
                 // TODO -- add tag information to log msg when useful.
                 const LogObjectList objlist(commandBuffer, pCopyBufferInfo->srcBuffer);
-                skip |=
-                    LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, error_obj.location,
-                             "Hazard %s for srcBuffer %s, region %" PRIu32 ". Access info %s.", string_SyncHazard(hazard.Hazard()),
-                             FormatHandle(pCopyBufferInfo->srcBuffer).c_str(), region, cb_context->FormatHazard(hazard).c_str());
+                skip |= cb_context->LogHazard(hazard, objlist, error_obj.location, [&]() {
+                    return FormatHazardMessage("Hazard %s for srcBuffer %s, region %" PRIu32 ". Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), FormatHandle(pCopyBufferInfo->srcBuffer).c_str(),
+                                               region, cb_context->FormatHazard(hazard).c_str());
+                });
             }
         }
         if (dst_buffer && !skip) {
@@ -278,10 +365,11 @@ bool SyncValidator::PreCallValidateCmdCopyBuffer2(VkCommandBuffer commandBuffer,
             auto hazard = context->DetectHazard(*dst_buffer, SYNC_COPY_TRANSFER_WRITE, dst_range);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, pCopyBufferInfo->dstBuffer);
-                skip |=
-                    LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, error_obj.location,
-                             "Hazard %s for dstBuffer %s, region %" PRIu32 ". Access info %s.", string_SyncHazard(hazard.Hazard()),
-                             FormatHandle(pCopyBufferInfo->dstBuffer).c_str(), region, cb_context->FormatHazard(hazard).c_str());
+                skip |= cb_context->LogHazard(hazard, objlist, error_obj.location, [&]() {
+                    return FormatHazardMessage("Hazard %s for dstBuffer %s, region %" PRIu32 ". Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), FormatHandle(pCopyBufferInfo->dstBuffer).c_str(),
+                                               region, cb_context->FormatHazard(hazard).c_str());
+                });
             }
         }
         if (skip) break;
@@ -350,10 +438,11 @@ bool SyncValidator::PreCallValidateCmdCopyImage(VkCommandBuffer commandBuffer, V
                                                 copy_region.extent, false, SYNC_COPY_TRANSFER_READ);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, srcImage);
-                skip |=
-                    LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, error_obj.location,
-                             "Hazard %s for srcImage %s, region %" PRIu32 ". Access info %s.", string_SyncHazard(hazard.Hazard()),
-                             FormatHandle(srcImage).c_str(), region, cb_access_context->FormatHazard(hazard).c_str());
+                skip |= cb_access_context->LogHazard(hazard, objlist, error_obj.location, [&]() {
+                    return FormatHazardMessage("Hazard %s for srcImage %s, region %" PRIu32 ". Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), FormatHandle(srcImage).c_str(), region,
+                                               cb_access_context->FormatHazard(hazard).c_str());
+                });
             }
         }
 
@@ -362,10 +451,11 @@ bool SyncValidator::PreCallValidateCmdCopyImage(VkCommandBuffer commandBuffer, V
                                                 copy_region.extent, false, SYNC_COPY_TRANSFER_WRITE);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, dstImage);
-                skip |=
-                    LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, error_obj.location,
-                             "Hazard %s for dstImage %s, region %" PRIu32 ". Access info %s.", string_SyncHazard(hazard.Hazard()),
-                             FormatHandle(dstImage).c_str(), region, cb_access_context->FormatHazard(hazard).c_str());
+                skip |= cb_access_context->LogHazard(hazard, objlist, error_obj.location, [&]() {
+                    return FormatHazardMessage("Hazard %s for dstImage %s, region %" PRIu32 ". Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), FormatHandle(dstImage).c_str(), region,
+                                               cb_access_context->FormatHazard(hazard).c_str());
+                });
             }
             if (skip) break;
         }
@@ -423,10 +513,11 @@ bool SyncValidator::PreCallValidateCmdCopyImage2(VkCommandBuffer commandBuffer,
                                                 copy_region.extent, false, SYNC_COPY_TRANSFER_READ);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, pCopyImageInfo->srcImage);
-                skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, error_obj.location,
-                                 "Hazard %s for srcImage %s, region %" PRIu32 ". Access info %s.",
-                                 string_SyncHazard(hazard.Hazard()), FormatHandle(pCopyImageInfo->srcImage).c_str(), region,
-                                 cb_access_context->FormatHazard(hazard).c_str());
+                skip |= cb_access_context->LogHazard(hazard, objlist, error_obj.location, [&]() {
+                    return FormatHazardMessage("Hazard %s for srcImage %s, region %" PRIu32 ". Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), FormatHandle(pCopyImageInfo->srcImage).c_str(),
+                                               region, cb_access_context->FormatHazard(hazard).c_str());
+                });
             }
         }
 
@@ -435,10 +526,11 @@ bool SyncValidator::PreCallValidateCmdCopyImage2(VkCommandBuffer commandBuffer,
                                                 copy_region.extent, false, SYNC_COPY_TRANSFER_WRITE);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, pCopyImageInfo->dstImage);
-                skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, error_obj.location,
-                                 "Hazard %s for dstImage %s, region %" PRIu32 ". Access info %s.",
-                                 string_SyncHazard(hazard.Hazard()), FormatHandle(pCopyImageInfo->dstImage).c_str(), region,
-                                 cb_access_context->FormatHazard(hazard).c_str());
+                skip |= cb_access_context->LogHazard(hazard, objlist, error_obj.location, [&]() {
+                    return FormatHazardMessage("Hazard %s for dstImage %s, region %" PRIu32 ". Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), FormatHandle(pCopyImageInfo->dstImage).c_str(),
+                                               region, cb_access_context->FormatHazard(hazard).c_str());
+                });
             }
             if (skip) break;
         }
@@ -584,6 +676,14 @@ void SyncValidator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Lo
     }
     debug_cmdbuf_pattern = GetEnvironment("VK_SYNCVAL_DEBUG_CMDBUF_PATTERN");
     vvl::ToLower(debug_cmdbuf_pattern);
+
+    if (!disabled[sync_validation_queue_submit]) {
+        if (worker_pool) {
+            submit_worker_pool_ = worker_pool;
+        } else if (syncval_settings.submit_time_validation_threads > 0) {
+            submit_worker_pool_ = std::make_shared<vvl::WorkerPool>(syncval_settings.submit_time_validation_threads);
+        }
+    }
 }
 
 bool SyncValidator::ValidateBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
@@ -632,6 +732,14 @@ void SyncValidator::PostCallRecordBeginCommandBuffer(VkCommandBuffer commandBuff
     cb_state->access_context.Reset();
 }
 
+void SyncValidator::PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, const RecordObject &record_obj) {
+    StateTracker::PostCallRecordEndCommandBuffer(commandBuffer, record_obj);
+
+    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    assert(cb_state);
+    cb_state->access_context.RecordEndCommandBuffer();
+}
+
 void SyncValidator::RecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                              const VkSubpassBeginInfo *pSubpassBeginInfo, Func command) {
     auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
@@ -884,10 +992,11 @@ bool SyncValidator::ValidateCmdCopyBufferToImage(VkCommandBuffer commandBuffer,
                 if (hazard.IsHazard()) {
                     // PHASE1 TODO -- add tag information to log msg when useful.
                     const LogObjectList objlist(commandBuffer, srcBuffer);
-                    skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, loc,
-                                     "Hazard %s for srcBuffer %s, region %" PRIu32 ". Access info %s.",
-                                     string_SyncHazard(hazard.Hazard()), FormatHandle(srcBuffer).c_str(), region,
-                                     cb_access_context->FormatHazard(hazard).c_str());
+                    skip |= cb_access_context->LogHazard(hazard, objlist, loc, [&]() {
+                        return FormatHazardMessage("Hazard %s for srcBuffer %s, region %" PRIu32 ". Access info %s.",
+                                                   string_SyncHazard(hazard.Hazard()), FormatHandle(srcBuffer).c_str(), region,
+                                                   cb_access_context->FormatHazard(hazard).c_str());
+                    });
                 }
             }
 
@@ -895,10 +1004,11 @@ bool SyncValidator::ValidateCmdCopyBufferToImage(VkCommandBuffer commandBuffer,
                                            copy_region.imageExtent, false, SYNC_COPY_TRANSFER_WRITE);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, dstImage);
-                skip |=
-                    LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, loc,
-                             "Hazard %s for dstImage %s, region %" PRIu32 ". Access info %s.", string_SyncHazard(hazard.Hazard()),
-                             FormatHandle(dstImage).c_str(), region, cb_access_context->FormatHazard(hazard).c_str());
+                skip |= cb_access_context->LogHazard(hazard, objlist, loc, [&]() {
+                    return FormatHazardMessage("Hazard %s for dstImage %s, region %" PRIu32 ". Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), FormatHandle(dstImage).c_str(), region,
+                                               cb_access_context->FormatHazard(hazard).c_str());
+                });
             }
             if (skip) break;
         }
@@ -1008,10 +1118,11 @@ bool SyncValidator::ValidateCmdCopyImageToBuffer(VkCommandBuffer commandBuffer,
                                                 copy_region.imageExtent, false, SYNC_COPY_TRANSFER_READ);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, srcImage);
-                skip |=
-                    LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, loc,
-                             "Hazard %s for srcImage %s, region %" PRIu32 ". Access info %s.", string_SyncHazard(hazard.Hazard()),
-                             FormatHandle(srcImage).c_str(), region, cb_access_context->FormatHazard(hazard).c_str());
+                skip |= cb_access_context->LogHazard(hazard, objlist, loc, [&]() {
+                    return FormatHazardMessage("Hazard %s for srcImage %s, region %" PRIu32 ". Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), FormatHandle(srcImage).c_str(), region,
+                                               cb_access_context->FormatHazard(hazard).c_str());
+                });
             }
             if (dst_mem) {
                 ResourceAccessRange dst_range = MakeRange(
@@ -1020,10 +1131,11 @@ bool SyncValidator::ValidateCmdCopyImageToBuffer(VkCommandBuffer commandBuffer,
                 hazard = context->DetectHazard(*dst_buffer, SYNC_COPY_TRANSFER_WRITE, dst_range);
                 if (hazard.IsHazard()) {
                     const LogObjectList objlist(commandBuffer, dstBuffer);
-                    skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, loc,
-                                     "Hazard %s for dstBuffer %s, region %" PRIu32 ". Access info %s.",
-                                     string_SyncHazard(hazard.Hazard()), FormatHandle(dstBuffer).c_str(), region,
-                                     cb_access_context->FormatHazard(hazard).c_str());
+                    skip |= cb_access_context->LogHazard(hazard, objlist, loc, [&]() {
+                        return FormatHazardMessage("Hazard %s for dstBuffer %s, region %" PRIu32 ". Access info %s.",
+                                                   string_SyncHazard(hazard.Hazard()), FormatHandle(dstBuffer).c_str(), region,
+                                                   cb_access_context->FormatHazard(hazard).c_str());
+                    });
                 }
             }
         }
@@ -1140,10 +1252,11 @@ bool SyncValidator::ValidateCmdBlitImage(VkCommandBuffer commandBuffer, VkImage
                                                 SYNC_BLIT_TRANSFER_READ);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, srcImage);
-                skip |=
-                    LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, loc,
-                             "Hazard %s for srcImage %s, region %" PRIu32 ". Access info %s.", string_SyncHazard(hazard.Hazard()),
-                             FormatHandle(srcImage).c_str(), region, cb_access_context->FormatHazard(hazard).c_str());
+                skip |= cb_access_context->LogHazard(hazard, objlist, loc, [&]() {
+                    return FormatHazardMessage("Hazard %s for srcImage %s, region %" PRIu32 ". Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), FormatHandle(srcImage).c_str(), region,
+                                               cb_access_context->FormatHazard(hazard).c_str());
+                });
             }
         }
 
@@ -1158,10 +1271,11 @@ bool SyncValidator::ValidateCmdBlitImage(VkCommandBuffer commandBuffer, VkImage
                                                 SYNC_BLIT_TRANSFER_WRITE);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, dstImage);
-                skip |=
-                    LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, loc,
-                             "Hazard %s for dstImage %s, region %" PRIu32 ". Access info %s.", string_SyncHazard(hazard.Hazard()),
-                             FormatHandle(dstImage).c_str(), region, cb_access_context->FormatHazard(hazard).c_str());
+                skip |= cb_access_context->LogHazard(hazard, objlist, loc, [&]() {
+                    return FormatHazardMessage("Hazard %s for dstImage %s, region %" PRIu32 ". Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), FormatHandle(dstImage).c_str(), region,
+                                               cb_access_context->FormatHazard(hazard).c_str());
+                });
             }
             if (skip) break;
         }
@@ -1263,20 +1377,22 @@ bool SyncValidator::ValidateIndirectBuffer(const CommandBufferAccessContext &cb_
         const ResourceAccessRange range = MakeRange(offset, size);
         auto hazard = context.DetectHazard(*buf_state, SYNC_DRAW_INDIRECT_INDIRECT_COMMAND_READ, range);
         if (hazard.IsHazard()) {
-            skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), buf_state->Handle(), loc,
-                             "Hazard %s for indirect %s in %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
-                             FormatHandle(buffer).c_str(), FormatHandle(commandBuffer).c_str(),
-                             cb_context.FormatHazard(hazard).c_str());
+            skip |= cb_context.LogHazard(hazard, buf_state->Handle(), loc, [&]() {
+                return FormatHazardMessage("Hazard %s for indirect %s in %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
+                                           FormatHandle(buffer).c_str(), FormatHandle(commandBuffer).c_str(),
+                                           cb_context.FormatHazard(hazard).c_str());
+            });
         }
     } else {
         for (uint32_t i = 0; i < drawCount; ++i) {
             const ResourceAccessRange range = MakeRange(offset + i * stride, size);
             auto hazard = context.DetectHazard(*buf_state, SYNC_DRAW_INDIRECT_INDIRECT_COMMAND_READ, range);
             if (hazard.IsHazard()) {
-                skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), buf_state->Handle(), loc,
-                                 "Hazard %s for indirect %s in %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
-                                 FormatHandle(buffer).c_str(), FormatHandle(commandBuffer).c_str(),
-                                 cb_context.FormatHazard(hazard).c_str());
+                skip |= cb_context.LogHazard(hazard, buf_state->Handle(), loc, [&]() {
+                    return FormatHazardMessage("Hazard %s for indirect %s in %s. Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), FormatHandle(buffer).c_str(),
+                                               FormatHandle(commandBuffer).c_str(), cb_context.FormatHazard(hazard).c_str());
+                });
                 break;
             }
         }
@@ -1311,10 +1427,11 @@ bool SyncValidator::ValidateCountBuffer(const CommandBufferAccessContext &cb_con
     const ResourceAccessRange range = MakeRange(offset, 4);
     auto hazard = context.DetectHazard(*count_buf_state, SYNC_DRAW_INDIRECT_INDIRECT_COMMAND_READ, range);
     if (hazard.IsHazard()) {
-        skip |=
-            LogError(string_SyncHazardVUID(hazard.Hazard()), count_buf_state->Handle(), loc,
-                     "Hazard %s for countBuffer %s in %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
-                     FormatHandle(buffer).c_str(), FormatHandle(commandBuffer).c_str(), cb_context.FormatHazard(hazard).c_str());
+        skip |= cb_context.LogHazard(hazard, count_buf_state->Handle(), loc, [&]() {
+            return FormatHazardMessage("Hazard %s for countBuffer %s in %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
+                                       FormatHandle(buffer).c_str(), FormatHandle(commandBuffer).c_str(),
+                                       cb_context.FormatHazard(hazard).c_str());
+        });
     }
     return skip;
 }
@@ -1726,9 +1843,11 @@ bool SyncValidator::PreCallValidateCmdClearColorImage(VkCommandBuffer commandBuf
             auto hazard = context->DetectHazard(*image_state, SYNC_CLEAR_TRANSFER_WRITE, range, false);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, image);
-                skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, error_obj.location,
-                                 "Hazard %s for %s, range index %" PRIu32 ". Access info %s.", string_SyncHazard(hazard.Hazard()),
-                                 FormatHandle(image).c_str(), index, cb_access_context->FormatHazard(hazard).c_str());
+                skip |= cb_access_context->LogHazard(hazard, objlist, error_obj.location, [&]() {
+                    return FormatHazardMessage("Hazard %s for %s, range index %" PRIu32 ". Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), FormatHandle(image).c_str(), index,
+                                               cb_access_context->FormatHazard(hazard).c_str());
+                });
             }
         }
     }
@@ -1780,9 +1899,11 @@ bool SyncValidator::PreCallValidateCmdClearDepthStencilImage(VkCommandBuffer com
             auto hazard = context->DetectHazard(*image_state, SYNC_CLEAR_TRANSFER_WRITE, range, false);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, image);
-                skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, error_obj.location,
-                                 "Hazard %s for %s, range index %" PRIu32 ". Access info %s.", string_SyncHazard(hazard.Hazard()),
-                                 FormatHandle(image).c_str(), index, cb_access_context->FormatHazard(hazard).c_str());
+                skip |= cb_access_context->LogHazard(hazard, objlist, error_obj.location, [&]() {
+                    return FormatHazardMessage("Hazard %s for %s, range index %" PRIu32 ". Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), FormatHandle(image).c_str(), index,
+                                               cb_access_context->FormatHazard(hazard).c_str());
+                });
             }
         }
     }
@@ -1866,9 +1987,10 @@ bool SyncValidator::PreCallValidateCmdCopyQueryPoolResults(VkCommandBuffer comma
         auto hazard = context->DetectHazard(*dst_buffer, SYNC_COPY_TRANSFER_WRITE, range);
         if (hazard.IsHazard()) {
             const LogObjectList objlist(commandBuffer, queryPool, dstBuffer);
-            skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, error_obj.location,
-                             "Hazard %s for dstBuffer %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
-                             FormatHandle(dstBuffer).c_str(), cb_access_context->FormatHazard(hazard).c_str());
+            skip |= cb_access_context->LogHazard(hazard, objlist, error_obj.location, [&]() {
+                return FormatHazardMessage("Hazard %s for dstBuffer %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
+                                           FormatHandle(dstBuffer).c_str(), cb_access_context->FormatHazard(hazard).c_str());
+            });
         }
     }
 
@@ -1919,9 +2041,10 @@ bool SyncValidator::PreCallValidateCmdFillBuffer(VkCommandBuffer commandBuffer,
         auto hazard = context->DetectHazard(*dst_buffer, SYNC_CLEAR_TRANSFER_WRITE, range);
         if (hazard.IsHazard()) {
             const LogObjectList objlist(commandBuffer, dstBuffer);
-            skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, error_obj.location,
-                             "Hazard %s for dstBuffer %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
-                             FormatHandle(dstBuffer).c_str(), cb_access_context->FormatHazard(hazard).c_str());
+            skip |= cb_access_context->LogHazard(hazard, objlist, error_obj.location, [&]() {
+                return FormatHazardMessage("Hazard %s for dstBuffer %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
+                                           FormatHandle(dstBuffer).c_str(), cb_access_context->FormatHazard(hazard).c_str());
+            });
         }
     }
     return skip;
@@ -1969,10 +2092,11 @@ bool SyncValidator::PreCallValidateCmdResolveImage(VkCommandBuffer commandBuffer
                                                 resolve_region.srcOffset, resolve_region.extent, false, SYNC_RESOLVE_TRANSFER_READ);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, srcImage);
-                skip |=
-                    LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, error_obj.location,
-                             "Hazard %s for srcImage %s, region %" PRIu32 ". Access info %s.", string_SyncHazard(hazard.Hazard()),
-                             FormatHandle(srcImage).c_str(), region, cb_access_context->FormatHazard(hazard).c_str());
+                skip |= cb_access_context->LogHazard(hazard, objlist, error_obj.location, [&]() {
+                    return FormatHazardMessage("Hazard %s for srcImage %s, region %" PRIu32 ". Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), FormatHandle(srcImage).c_str(), region,
+                                               cb_access_context->FormatHazard(hazard).c_str());
+                });
             }
         }
 
@@ -1982,10 +2106,11 @@ bool SyncValidator::PreCallValidateCmdResolveImage(VkCommandBuffer commandBuffer
                                       resolve_region.extent, false, SYNC_RESOLVE_TRANSFER_WRITE);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, dstImage);
-                skip |=
-                    LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, error_obj.location,
-                             "Hazard %s for dstImage %s, region %" PRIu32 ". Access info %s.", string_SyncHazard(hazard.Hazard()),
-                             FormatHandle(dstImage).c_str(), region, cb_access_context->FormatHazard(hazard).c_str());
+                skip |= cb_access_context->LogHazard(hazard, objlist, error_obj.location, [&]() {
+                    return FormatHazardMessage("Hazard %s for dstImage %s, region %" PRIu32 ". Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), FormatHandle(dstImage).c_str(), region,
+                                               cb_access_context->FormatHazard(hazard).c_str());
+                });
             }
             if (skip) break;
         }
@@ -2049,10 +2174,12 @@ bool SyncValidator::PreCallValidateCmdResolveImage2(VkCommandBuffer commandBuffe
                                                 resolve_region.srcOffset, resolve_region.extent, false, SYNC_RESOLVE_TRANSFER_READ);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, pResolveImageInfo->srcImage);
-                skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, region_loc,
-                                 "Hazard %s for srcImage %s, region %" PRIu32 ". Access info %s.",
-                                 string_SyncHazard(hazard.Hazard()), FormatHandle(pResolveImageInfo->srcImage).c_str(), region,
-                                 cb_access_context->FormatHazard(hazard).c_str());
+                skip |= cb_access_context->LogHazard(hazard, objlist, region_loc, [&]() {
+                    return FormatHazardMessage("Hazard %s for srcImage %s, region %" PRIu32 ". Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()),
+                                               FormatHandle(pResolveImageInfo->srcImage).c_str(), region,
+                                               cb_access_context->FormatHazard(hazard).c_str());
+                });
             }
         }
 
@@ -2062,10 +2189,12 @@ bool SyncValidator::PreCallValidateCmdResolveImage2(VkCommandBuffer commandBuffe
                                       resolve_region.extent, false, SYNC_RESOLVE_TRANSFER_WRITE);
             if (hazard.IsHazard()) {
                 const LogObjectList objlist(commandBuffer, pResolveImageInfo->dstImage);
-                skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, region_loc,
-                                 "Hazard %s for dstImage %s, region %" PRIu32 ". Access info %s.",
-                                 string_SyncHazard(hazard.Hazard()), FormatHandle(pResolveImageInfo->dstImage).c_str(), region,
-                                 cb_access_context->FormatHazard(hazard).c_str());
+                skip |= cb_access_context->LogHazard(hazard, objlist, region_loc, [&]() {
+                    return FormatHazardMessage("Hazard %s for dstImage %s, region %" PRIu32 ". Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()),
+                                               FormatHandle(pResolveImageInfo->dstImage).c_str(), region,
+                                               cb_access_context->FormatHazard(hazard).c_str());
+                });
             }
             if (skip) break;
         }
@@ -2134,9 +2263,10 @@ bool SyncValidator::PreCallValidateCmdUpdateBuffer(VkCommandBuffer commandBuffer
         auto hazard = context->DetectHazard(*dst_buffer, SYNC_CLEAR_TRANSFER_WRITE, range);
         if (hazard.IsHazard()) {
             const LogObjectList objlist(commandBuffer, dstBuffer);
-            skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), objlist, error_obj.location,
-                             "Hazard %s for dstBuffer %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
-                             FormatHandle(dstBuffer).c_str(), cb_access_context->FormatHazard(hazard).c_str());
+            skip |= cb_access_context->LogHazard(hazard, objlist, error_obj.location, [&]() {
+                return FormatHazardMessage("Hazard %s for dstBuffer %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
+                                           FormatHandle(dstBuffer).c_str(), cb_access_context->FormatHazard(hazard).c_str());
+            });
         }
     }
     return skip;
@@ -2181,9 +2311,10 @@ bool SyncValidator::PreCallValidateCmdWriteBufferMarkerAMD(VkCommandBuffer comma
         const ResourceAccessRange range = MakeRange(dstOffset, 4);
         auto hazard = context->DetectHazard(*dst_buffer, SYNC_COPY_TRANSFER_WRITE, range);
         if (hazard.IsHazard()) {
-            skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), dstBuffer, error_obj.location,
-                             "Hazard %s for dstBuffer %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
-                             FormatHandle(dstBuffer).c_str(), cb_access_context->FormatHazard(hazard).c_str());
+            skip |= cb_access_context->LogHazard(hazard, dstBuffer, error_obj.location, [&]() {
+                return FormatHazardMessage("Hazard %s for dstBuffer %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
+                                           FormatHandle(dstBuffer).c_str(), cb_access_context->FormatHazard(hazard).c_str());
+            });
         }
     }
     return skip;
@@ -2232,9 +2363,11 @@ bool SyncValidator::PreCallValidateCmdDecodeVideoKHR(VkCommandBuffer commandBuff
         auto hazard = context->DetectHazard(*src_buffer, SYNC_VIDEO_DECODE_VIDEO_DECODE_READ, src_range);
         if (hazard.IsHazard()) {
             // PHASE1 TODO -- add tag information to log msg when useful.
-            skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), src_buffer->Handle(), decode_info_loc.dot(Field::srcBuffer),
-                             "Hazard %s for bitstream buffer %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
-                             FormatHandle(pDecodeInfo->srcBuffer).c_str(), cb_access_context->FormatHazard(hazard).c_str());
+            skip |= cb_access_context->LogHazard(hazard, src_buffer->Handle(), decode_info_loc.dot(Field::srcBuffer), [&]() {
+                return FormatHazardMessage("Hazard %s for bitstream buffer %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
+                                           FormatHandle(pDecodeInfo->srcBuffer).c_str(),
+                                           cb_access_context->FormatHazard(hazard).c_str());
+            });
         }
     }
 
@@ -2242,9 +2375,11 @@ bool SyncValidator::PreCallValidateCmdDecodeVideoKHR(VkCommandBuffer commandBuff
     if (dst_resource) {
         auto hazard = context->DetectHazard(*vs_state, dst_resource, SYNC_VIDEO_DECODE_VIDEO_DECODE_WRITE);
         if (hazard.IsHazard()) {
-            skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), dst_resource.image_view_state->Handle(),
-                             decode_info_loc.dot(Field::dstPictureResource), "Hazard %s for decode output picture. Access info %s.",
-                             string_SyncHazard(hazard.Hazard()), cb_access_context->FormatHazard(hazard).c_str());
+            const Location hazard_loc = decode_info_loc.dot(Field::dstPictureResource);
+            skip |= cb_access_context->LogHazard(hazard, dst_resource.image_view_state->Handle(), hazard_loc, [&]() {
+                return FormatHazardMessage("Hazard %s for decode output picture. Access info %s.",
+                                           string_SyncHazard(hazard.Hazard()), cb_access_context->FormatHazard(hazard).c_str());
+            });
         }
     }
 
@@ -2253,10 +2388,11 @@ bool SyncValidator::PreCallValidateCmdDecodeVideoKHR(VkCommandBuffer commandBuff
         if (setup_resource && (setup_resource != dst_resource)) {
             auto hazard = context->DetectHazard(*vs_state, setup_resource, SYNC_VIDEO_DECODE_VIDEO_DECODE_WRITE);
             if (hazard.IsHazard()) {
-                skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), setup_resource.image_view_state->Handle(),
-                                 decode_info_loc.dot(Field::pSetupReferenceSlot).dot(Field::pPictureResource),
-                                 "Hazard %s for reconstructed picture. Access info %s.", string_SyncHazard(hazard.Hazard()),
-                                 cb_access_context->FormatHazard(hazard).c_str());
+                const Location hazard_loc = decode_info_loc.dot(Field::pSetupReferenceSlot).dot(Field::pPictureResource);
+                skip |= cb_access_context->LogHazard(hazard, setup_resource.image_view_state->Handle(), hazard_loc, [&]() {
+                    return FormatHazardMessage("Hazard %s for reconstructed picture. Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), cb_access_context->FormatHazard(hazard).c_str());
+                });
             }
         }
     }
@@ -2267,10 +2403,12 @@ bool SyncValidator::PreCallValidateCmdDecodeVideoKHR(VkCommandBuffer commandBuff
             if (reference_resource) {
                 auto hazard = context->DetectHazard(*vs_state, reference_resource, SYNC_VIDEO_DECODE_VIDEO_DECODE_READ);
                 if (hazard.IsHazard()) {
-                    skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), reference_resource.image_view_state->Handle(),
-                                     decode_info_loc.dot(Field::pReferenceSlots, i).dot(Field::pPictureResource),
-                                     "Hazard %s for reference picture #%u. Access info %s.", string_SyncHazard(hazard.Hazard()), i,
-                                     cb_access_context->FormatHazard(hazard).c_str());
+                    const Location hazard_loc = decode_info_loc.dot(Field::pReferenceSlots, i).dot(Field::pPictureResource);
+                    skip |= cb_access_context->LogHazard(hazard, reference_resource.image_view_state->Handle(), hazard_loc, [&]() {
+                        return FormatHazardMessage("Hazard %s for reference picture #%u. Access info %s.",
+                                                   string_SyncHazard(hazard.Hazard()), i,
+                                                   cb_access_context->FormatHazard(hazard).c_str());
+                    });
                 }
             }
         }
@@ -2344,9 +2482,11 @@ bool SyncValidator::PreCallValidateCmdEncodeVideoKHR(VkCommandBuffer commandBuff
         auto hazard = context->DetectHazard(*dst_buffer, SYNC_VIDEO_ENCODE_VIDEO_ENCODE_WRITE, src_range);
         if (hazard.IsHazard()) {
             // PHASE1 TODO -- add tag information to log msg when useful.
-            skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), dst_buffer->Handle(), encode_info_loc.dot(Field::dstBuffer),
-                             "Hazard %s for bitstream buffer %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
-                             FormatHandle(pEncodeInfo->dstBuffer).c_str(), cb_access_context->FormatHazard(hazard).c_str());
+            skip |= cb_access_context->LogHazard(hazard, dst_buffer->Handle(), encode_info_loc.dot(Field::dstBuffer), [&]() {
+                return FormatHazardMessage("Hazard %s for bitstream buffer %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
+                                           FormatHandle(pEncodeInfo->dstBuffer).c_str(),
+                                           cb_access_context->FormatHazard(hazard).c_str());
+            });
         }
     }
 
@@ -2354,9 +2494,11 @@ bool SyncValidator::PreCallValidateCmdEncodeVideoKHR(VkCommandBuffer commandBuff
     if (src_resource) {
         auto hazard = context->DetectHazard(*vs_state, src_resource, SYNC_VIDEO_ENCODE_VIDEO_ENCODE_READ);
         if (hazard.IsHazard()) {
-            skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), src_resource.image_view_state->Handle(),
-                             encode_info_loc.dot(Field::srcPictureResource), "Hazard %s for encode input picture. Access info %s.",
-                             string_SyncHazard(hazard.Hazard()), cb_access_context->FormatHazard(hazard).c_str());
+            const Location hazard_loc = encode_info_loc.dot(Field::srcPictureResource);
+            skip |= cb_access_context->LogHazard(hazard, src_resource.image_view_state->Handle(), hazard_loc, [&]() {
+                return FormatHazardMessage("Hazard %s for encode input picture. Access info %s.",
+                                           string_SyncHazard(hazard.Hazard()), cb_access_context->FormatHazard(hazard).c_str());
+            });
         }
     }
 
@@ -2365,10 +2507,11 @@ bool SyncValidator::PreCallValidateCmdEncodeVideoKHR(VkCommandBuffer commandBuff
         if (setup_resource) {
             auto hazard = context->DetectHazard(*vs_state, setup_resource, SYNC_VIDEO_ENCODE_VIDEO_ENCODE_WRITE);
             if (hazard.IsHazard()) {
-                skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), setup_resource.image_view_state->Handle(),
-                                 encode_info_loc.dot(Field::pSetupReferenceSlot).dot(Field::pPictureResource),
-                                 "Hazard %s for reconstructed picture. Access info %s.", string_SyncHazard(hazard.Hazard()),
-                                 cb_access_context->FormatHazard(hazard).c_str());
+                const Location hazard_loc = encode_info_loc.dot(Field::pSetupReferenceSlot).dot(Field::pPictureResource);
+                skip |= cb_access_context->LogHazard(hazard, setup_resource.image_view_state->Handle(), hazard_loc, [&]() {
+                    return FormatHazardMessage("Hazard %s for reconstructed picture. Access info %s.",
+                                               string_SyncHazard(hazard.Hazard()), cb_access_context->FormatHazard(hazard).c_str());
+                });
             }
         }
     }
@@ -2379,10 +2522,12 @@ bool SyncValidator::PreCallValidateCmdEncodeVideoKHR(VkCommandBuffer commandBuff
             if (reference_resource) {
                 auto hazard = context->DetectHazard(*vs_state, reference_resource, SYNC_VIDEO_ENCODE_VIDEO_ENCODE_READ);
                 if (hazard.IsHazard()) {
-                    skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), reference_resource.image_view_state->Handle(),
-                                     encode_info_loc.dot(Field::pReferenceSlots, i).dot(Field::pPictureResource),
-                                     "Hazard %s for reference picture #%u. Access info %s.", string_SyncHazard(hazard.Hazard()), i,
-                                     cb_access_context->FormatHazard(hazard).c_str());
+                    const Location hazard_loc = encode_info_loc.dot(Field::pReferenceSlots, i).dot(Field::pPictureResource);
+                    skip |= cb_access_context->LogHazard(hazard, reference_resource.image_view_state->Handle(), hazard_loc, [&]() {
+                        return FormatHazardMessage("Hazard %s for reference picture #%u. Access info %s.",
+                                                   string_SyncHazard(hazard.Hazard()), i,
+                                                   cb_access_context->FormatHazard(hazard).c_str());
+                    });
                 }
             }
         }
@@ -2655,9 +2800,10 @@ bool SyncValidator::PreCallValidateCmdWriteBufferMarker2AMD(VkCommandBuffer comm
         const ResourceAccessRange range = MakeRange(dstOffset, 4);
         auto hazard = context->DetectHazard(*dst_buffer, SYNC_COPY_TRANSFER_WRITE, range);
         if (hazard.IsHazard()) {
-            skip |= LogError(string_SyncHazardVUID(hazard.Hazard()), dstBuffer, error_obj.location,
-                             "Hazard %s for dstBuffer %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
-                             FormatHandle(dstBuffer).c_str(), cb_access_context->FormatHazard(hazard).c_str());
+            skip |= cb_access_context->LogHazard(hazard, dstBuffer, error_obj.location, [&]() {
+                return FormatHazardMessage("Hazard %s for dstBuffer %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
+                                           FormatHandle(dstBuffer).c_str(), cb_access_context->FormatHazard(hazard).c_str());
+            });
         }
     }
     return skip;
@@ -2762,6 +2908,7 @@ void SyncValidator::PostCallRecordQueueWaitIdle(VkQueue queue, const RecordObjec
     StateTracker::PostCallRecordQueueWaitIdle(queue, record_obj);
     if ((record_obj.result != VK_SUCCESS) || (disabled[sync_validation_queue_submit]) || (queue == VK_NULL_HANDLE)) return;
 
+    WriteLockGuard guard(queue_state_mutex_);
     const auto queue_state = GetQueueSyncStateShared(queue);
     if (!queue_state) return;  // Invalid queue
     QueueId waited_queue = queue_state->GetQueueId();
@@ -2774,6 +2921,7 @@ void SyncValidator::PostCallRecordQueueWaitIdle(VkQueue queue, const RecordObjec
 void SyncValidator::PostCallRecordDeviceWaitIdle(VkDevice device, const RecordObject &record_obj) {
     StateTracker::PostCallRecordDeviceWaitIdle(device, record_obj);
 
+    WriteLockGuard guard(queue_state_mutex_);
     // We need to treat this a fence waits for all queues... noting that present engine ops will be preserved.
     ForAllQueueBatchContexts(
         [](const std::shared_ptr<QueueBatchContext> &batch) { batch->ApplyTaggedWait(kQueueAny, ResourceUsageRecord::kMaxIndex); });
@@ -2796,6 +2944,7 @@ bool SyncValidator::PreCallValidateQueuePresentKHR(VkQueue queue, const VkPresen
     // Since this early return is above the TlsGuard, the Record phase must also be.
     if (disabled[sync_validation_queue_submit]) return skip;
 
+    ReadLockGuard guard(queue_state_mutex_);
     vvl::TlsGuard<QueuePresentCmdState> cmd_state(&skip, *this);
     cmd_state->queue = GetQueueSyncStateShared(queue);
     if (!cmd_state->queue) return skip;  // Invalid Queue
@@ -2862,6 +3011,7 @@ void SyncValidator::PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresent
     }
 
     // Update the state with the data from the validate phase
+    WriteLockGuard guard(queue_state_mutex_);
     std::shared_ptr<QueueSyncState> queue_state = std::const_pointer_cast<QueueSyncState>(std::move(cmd_state->queue));
     UpdateSignaledSemaphores(cmd_state->signaled_semaphores_update, queue_state->PendingLastBatch());
     for (auto &presented : cmd_state->presented_images) {
@@ -2894,6 +3044,9 @@ void SyncValidator::RecordAcquireNextImageState(VkDevice device, VkSwapchainKHR
     auto swapchain_state = Get<syncval_state::Swapchain>(swapchain);
     if (vvl::StateObject::Invalid(swapchain_state)) return;  // Invalid acquire calls to be caught in CoreCheck/Parameter validation
 
+    // The presented images of the swapchain are updated by present, so they are protected by the queue state lock as well
+    WriteLockGuard guard(queue_state_mutex_);
+
     PresentedImage presented = swapchain_state->MovePresentedImage(*pImageIndex);
     if (presented.Invalid()) return;
 
@@ -2932,19 +3085,18 @@ void SyncValidator::RecordAcquireNextImageState(VkDevice device, VkSwapchainKHR
 
 bool SyncValidator::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
                                                const ErrorObject &error_obj) const {
-    auto queue_state = GetQueueSyncStateShared(queue);
-    if (!bool(queue_state)) return false;
-    SubmitInfoConverter submit_info(submitCount, pSubmits, queue_state->GetQueueFlags());
-    return ValidateQueueSubmit(queue, submitCount, submit_info.info2s.data(), fence, error_obj);
+    return ValidateQueueSubmit(queue, submitCount, pSubmits, fence, error_obj);
 }
 
-bool SyncValidator::ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence,
+template <typename SubmitInfo>
+bool SyncValidator::ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const SubmitInfo *pSubmits, VkFence fence,
                                         const ErrorObject &error_obj) const {
     bool skip = false;
 
     // Since this early return is above the TlsGuard, the Record phase must also be.
     if (disabled[sync_validation_queue_submit]) return skip;
 
+    ReadLockGuard guard(queue_state_mutex_);
     vvl::TlsGuard<QueueSubmitCmdState> cmd_state(&skip, error_obj, *this);
     cmd_state->queue = GetQueueSyncStateShared(queue);
     if (!cmd_state->queue) return skip;  // Invalid Queue
@@ -2961,7 +3113,7 @@ bool SyncValidator::ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, con
     std::shared_ptr<const QueueBatchContext> last_batch = cmd_state->queue->LastBatch();
     std::shared_ptr<QueueBatchContext> batch;
     for (uint32_t batch_idx = 0; batch_idx < submitCount; batch_idx++) {
-        const VkSubmitInfo2 &submit = pSubmits[batch_idx];
+        const BatchSubmitInfo submit(pSubmits[batch_idx]);
         batch = std::make_shared<QueueBatchContext>(*this, *cmd_state->queue, submit_id, batch_idx);
         batch->SetupCommandBufferInfo(submit);
         batch->SetupAccessContext(last_batch, submit, cmd_state->signaled_semaphores_update);
@@ -2976,8 +3128,8 @@ bool SyncValidator::ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, con
         }
 
         // Empty batches could have semaphores, though.
-        for (uint32_t sem_idx = 0; sem_idx < submit.signalSemaphoreInfoCount; ++sem_idx) {
-            const VkSemaphoreSubmitInfo &semaphore_info = submit.pSignalSemaphoreInfos[sem_idx];
+        for (uint32_t sem_idx = 0; sem_idx < submit.SignalSemaphoreCount(); ++sem_idx) {
+            const VkSemaphoreSubmitInfo semaphore_info = submit.SignalSemaphore(sem_idx);
             cmd_state->signaled_semaphores_update.OnSignal(batch, semaphore_info);
         }
         // Unless the previous batch was referenced by a signal, the QueueBatchContext will self destruct, but as
@@ -3012,6 +3164,7 @@ void SyncValidator::RecordQueueSubmit(VkQueue queue, VkFence fence, const Record
     if (VK_SUCCESS != record_obj.result) return;  // dispatched QueueSubmit failed
     if (!cmd_state->queue) return;     // Validation couldn't find a valid queue object
 
+    WriteLockGuard guard(queue_state_mutex_);
     // Don't need to look up the queue state again, but we need a non-const version
     std::shared_ptr<QueueSyncState> queue_state = std::const_pointer_cast<QueueSyncState>(std::move(cmd_state->queue));
     UpdateSignaledSemaphores(cmd_state->signaled_semaphores_update, queue_state->PendingLastBatch());
@@ -3046,6 +3199,7 @@ void SyncValidator::PostCallRecordGetFenceStatus(VkDevice device, VkFence fence,
     if (disabled[sync_validation_queue_submit]) return;
     if (record_obj.result == VK_SUCCESS) {
         // fence is signalled, mark it as waited for
+        WriteLockGuard guard(queue_state_mutex_);
         WaitForFence(fence);
     }
 }
@@ -3056,6 +3210,7 @@ void SyncValidator::PostCallRecordWaitForFences(VkDevice device, uint32_t fenceC
     if (disabled[sync_validation_queue_submit]) return;
     if ((record_obj.result == VK_SUCCESS) && ((VK_TRUE == waitAll) || (1 == fenceCount))) {
         // We can only know the pFences have signal if we waited for all of them, or there was only one of them
+        WriteLockGuard guard(queue_state_mutex_);
         for (uint32_t i = 0; i < fenceCount; i++) {
             WaitForFence(pFences[i]);
         }
@@ -3114,6 +3269,14 @@ void syncval_state::ImageState::SetOpaqueBaseAddress(ValidationStateTracker &dev
     opaque_base_address_ = opaque_base;
 }
 
+ResourceAccessRange syncval_state::BufferState::MakeAccessRange(const ResourceAccessRange &range) const {
+    const VkDeviceSize base_address = GetFakeBaseAddress();
+    if (IsCoarselyTracked()) {
+        return ResourceAccessRange(base_address, base_address + create_info.size);
+    }
+    return range + base_address;
+}
+
 VkDeviceSize syncval_state::ImageState::GetResourceBaseAddress() const {
     if (HasOpaqueMapping()) {
         return GetOpaqueBaseAddress();
@@ -3148,7 +3311,24 @@ ImageRangeGen syncval_state::ImageState::MakeImageRangeGen(const VkImageSubresou
 syncval_state::ImageViewState::ImageViewState(const std::shared_ptr<vvl::Image> &image_state, VkImageView handle,
                                               const VkImageViewCreateInfo *ci, VkFormatFeatureFlags2KHR ff,
                                               const VkFilterCubicImageViewImageFormatPropertiesEXT &cubic_props)
-    : vvl::ImageView(image_state, handle, ci, ff, cubic_props), view_range_gen(MakeImageRangeGen()) {}
+    : vvl::ImageView(image_state, handle, ci, ff, cubic_props), view_range_gen(MakeImageRangeGen()) {
+    // The generator merges the contiguous ranges, ex. the layers of a mip level of a tiled image, so most views need a few
+    ImageRangeGen range_gen(view_range_gen);
+    ResourceAccessRange ranges[kMaxFullViewRanges];
+    uint32_t count = 0;
+    for (uint32_t written = range_gen.NextRanges(ranges, kMaxFullViewRanges); written > 0;
+         written = range_gen.NextRanges(ranges, kMaxFullViewRanges - count)) {
+        full_view_ranges_.insert(full_view_ranges_.end(), ranges, ranges + written);
+        count += written;
+        if (count == kMaxFullViewRanges) {
+            break;
+        }
+    }
+    has_full_view_ranges_ = !range_gen->non_empty();
+    if (!has_full_view_ranges_) {
+        full_view_ranges_ = std::vector<ResourceAccessRange>();
+    }
+}
 
 ImageRangeGen syncval_state::ImageViewState::MakeImageRangeGen() const {
     return GetImageState()->MakeImageRangeGen(normalized_subresource_range, IsDepthSliced());
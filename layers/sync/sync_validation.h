@@ -19,6 +19,7 @@
 
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <vulkan/vulkan.h>
 
@@ -27,12 +28,16 @@
 #include "sync/sync_renderpass.h"
 #include "sync/sync_commandbuffer.h"
 #include "sync/sync_submit.h"
+#include "utils/worker_pool.h"
 
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkImage, syncval_state::ImageState, vvl::Image)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkImageView, syncval_state::ImageViewState, vvl::ImageView)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkCommandBuffer, syncval_state::CommandBuffer, vvl::CommandBuffer)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkSwapchainKHR, syncval_state::Swapchain, vvl::Swapchain)
 
+// printf into a std::string, for the formatters given to SyncValidationInfo::LogHazard
+std::string DECORATE_PRINTF(1, 2) FormatHazardMessage(const char *format, ...);
+
 class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
   public:
     using ImageState = syncval_state::ImageState;
@@ -44,6 +49,9 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
 
     SyncValidator() { container_type = LayerObjectTypeSyncValidation; }
 
+    ReadLockGuard ReadLock() const override;
+    WriteLockGuard WriteLock() override;
+
     // Global tag range for submitted command buffers resource usage logs
     // Started the global tag count at 1 s.t. zero are invalid and ResourceUsageTag normalization can just zero them.
     mutable std::atomic<ResourceUsageTag> tag_limit_{1};  // This is reserved in Validation phase, thus mutable and atomic
@@ -57,6 +65,32 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     using SignaledFences = vvl::unordered_map<VkFence, FenceSyncState>;
     SignaledFences waitable_fences_;
 
+    // With fine grained locking the chassis does not serialize SyncValidator. Command buffer recording only touches
+    // command buffer state, which the application has to externally synchronize, so this only protects the queue batches,
+    // signaled semaphores and waitable fences shared by the queue submit, present, acquire and wait operations.
+    mutable std::shared_mutex queue_state_mutex_;
+
+    // Shares the hazard detection of vkQueueSubmit between threads, the layer wide worker_pool or one of its own. Null unless
+    // enabled by the settings.
+    std::shared_ptr<vvl::WorkerPool> submit_worker_pool_;
+    vvl::WorkerPool *GetSubmitWorkerPool() const { return submit_worker_pool_.get(); }
+
+    // The attachment view generators only depend on the framebuffer attachments and the render area, so the ones of the
+    // last few render pass instances are kept and shared by the render passes begun again with the same pair. Imageless
+    // framebuffers take their attachments from the begin info and are never cached.
+    std::shared_ptr<const AttachmentViewGenVector> GetAttachmentViewGens(
+        const vvl::Framebuffer &fb_state, const VkRect2D &render_area,
+        const std::vector<const syncval_state::ImageViewState *> &attachments) const;
+    struct AttachmentViewGenCacheEntry {
+        vvl::StateObject::IdType framebuffer_id = 0;
+        VkRect2D render_area = {};
+        std::shared_ptr<const AttachmentViewGenVector> view_gens;
+    };
+    static constexpr uint32_t kAttachmentViewGenCacheSize = 16;
+    mutable std::mutex attachment_view_gen_cache_lock_;
+    mutable std::array<AttachmentViewGenCacheEntry, kAttachmentViewGenCacheSize> attachment_view_gen_cache_;
+    mutable uint32_t attachment_view_gen_cache_next_ = 0;
+
     uint32_t debug_command_number = vvl::kU32Max;
     uint32_t debug_reset_count = 1;
     std::string debug_cmdbuf_pattern;
@@ -98,6 +132,7 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
                                                              const vvl::CommandPool *cmd_pool) override;
     std::shared_ptr<vvl::Swapchain> CreateSwapchainState(const VkSwapchainCreateInfoKHR *create_info,
                                                          VkSwapchainKHR swapchain) final;
+    std::shared_ptr<vvl::Buffer> CreateBufferState(VkBuffer handle, const VkBufferCreateInfo *pCreateInfo) final;
     std::shared_ptr<vvl::Image> CreateImageState(VkImage img, const VkImageCreateInfo *pCreateInfo,
                                                  VkFormatFeatureFlags2KHR features) final;
 
@@ -190,6 +225,7 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
 
     void PostCallRecordBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo *pBeginInfo,
                                           const RecordObject &record_obj) override;
+    void PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, const RecordObject &record_obj) override;
 
     void PostCallRecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                           VkSubpassContents contents, const RecordObject &record_obj) override;
@@ -554,7 +590,9 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
                                             const RecordObject &record_obj) override;
     void RecordAcquireNextImageState(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore,
                                      VkFence fence, uint32_t *pImageIndex, const RecordObject &record_obj);
-    bool ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence,
+    // SubmitInfo is VkSubmitInfo or VkSubmitInfo2, the batches are read through BatchSubmitInfo
+    template <typename SubmitInfo>
+    bool ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const SubmitInfo *pSubmits, VkFence fence,
                              const ErrorObject &error_obj) const;
     bool PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
                                     const ErrorObject &error_obj) const override;
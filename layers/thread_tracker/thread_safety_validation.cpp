@@ -19,6 +19,8 @@
 #include "generated/layer_chassis_dispatch.h"  // wrap_handles declaration
 #include "thread_tracker/thread_safety_validation.h"
 
+#include <sstream>
+
 ReadLockGuard ThreadSafety::ReadLock() const { return ReadLockGuard(validation_object_mutex, std::defer_lock); }
 
 WriteLockGuard ThreadSafety::WriteLock() { return WriteLockGuard(validation_object_mutex, std::defer_lock); }
@@ -38,10 +40,12 @@ void ThreadSafety::PostCallRecordAllocateCommandBuffers(VkDevice device, const V
     if (pCommandBuffers) {
         auto lock = WriteLockGuard(thread_safety_lock);
         auto& pool_command_buffers = pool_command_buffers_map[pAllocateInfo->commandPool];
+        pool_command_buffers.reserve(pool_command_buffers.size() + pAllocateInfo->commandBufferCount);
         for (uint32_t index = 0; index < pAllocateInfo->commandBufferCount; index++) {
-            command_pool_map.insert_or_assign(pCommandBuffers[index], pAllocateInfo->commandPool);
+            const auto pool_index = static_cast<uint32_t>(pool_command_buffers.size());
+            command_pool_map.insert_or_assign(pCommandBuffers[index], CommandBufferPool{pAllocateInfo->commandPool, pool_index});
             CreateObject(pCommandBuffers[index]);
-            pool_command_buffers.insert(pCommandBuffers[index]);
+            pool_command_buffers.emplace_back(pCommandBuffers[index]);
         }
     }
 }
@@ -91,16 +95,27 @@ void ThreadSafety::PostCallRecordAllocateDescriptorSets(VkDevice device, const V
     if (VK_SUCCESS == record_obj.result) {
         auto lock = WriteLockGuard(thread_safety_lock);
         auto& pool_descriptor_sets = pool_descriptor_sets_map[pAllocateInfo->descriptorPool];
+        pool_descriptor_sets.reserve(pool_descriptor_sets.size() + pAllocateInfo->descriptorSetCount);
+        // Large allocations usually repeat the same layout, it is only looked up when it changes
+        VkDescriptorSetLayout last_layout = VK_NULL_HANDLE;
+        bool last_found = false;
+        bool last_read_only = false;
         for (uint32_t index0 = 0; index0 < pAllocateInfo->descriptorSetCount; index0++) {
             CreateObject(pDescriptorSets[index0]);
             pool_descriptor_sets.insert(pDescriptorSets[index0]);
 
-            auto iter = dsl_read_only_map.find(pAllocateInfo->pSetLayouts[index0]);
-            if (iter != dsl_read_only_map.end()) {
-                ds_read_only_map.insert_or_assign(pDescriptorSets[index0], iter->second);
-            } else {
-                assert(0 && "descriptor set layout not found");
+            const VkDescriptorSetLayout layout = pAllocateInfo->pSetLayouts[index0];
+            if (!last_found || layout != last_layout) {
+                auto iter = dsl_read_only_map.find(layout);
+                if (iter == dsl_read_only_map.end()) {
+                    assert(0 && "descriptor set layout not found");
+                    continue;
+                }
+                last_layout = layout;
+                last_found = true;
+                last_read_only = iter->second;
             }
+            ds_read_only_map.insert_or_assign(pDescriptorSets[index0], last_read_only);
         }
     }
 }
@@ -218,6 +233,38 @@ bool ThreadSafety::DsReadOnly(VkDescriptorSet set) const {
     return false;
 }
 
+void ThreadSafety::ReportObjectWaitTimes(const Location& loc) const {
+    std::stringstream wait_times;
+    auto report = [&wait_times](const auto& object_counter) {
+        const uint64_t wait_time_ns = object_counter.wait_time_ns.load();
+        if (wait_time_ns != 0) {
+            wait_times << "\n  " << string_VulkanObjectType(object_counter.object_type) << ": " << wait_time_ns / 1000 << "us";
+        }
+    };
+    report(c_VkCommandBuffer);
+    report(c_VkDevice);
+    report(c_VkInstance);
+    report(c_VkQueue);
+    report(c_VkCommandPoolContents);
+#ifdef DISTINCT_NONDISPATCHABLE_HANDLES
+#undef WRAPPER
+#undef WRAPPER_PARENT_INSTANCE
+#define WRAPPER(type) report(c_##type);
+#define WRAPPER_PARENT_INSTANCE(type) report(c_##type);
+#include "generated/thread_safety_counter_bodies.h"
+#undef WRAPPER
+#undef WRAPPER_PARENT_INSTANCE
+#else   // DISTINCT_NONDISPATCHABLE_HANDLES
+    report(c_uint64_t);
+#endif  // DISTINCT_NONDISPATCHABLE_HANDLES
+
+    const std::string message = wait_times.str();
+    if (!message.empty()) {
+        LogInfo("UNASSIGNED-Threading-WaitTime", device, loc,
+                "Time spent waiting for objects used simultaneously by multiple threads:%s", message.c_str());
+    }
+}
+
 void ThreadSafety::PreCallRecordUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount,
                                                      const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount,
                                                      const VkCopyDescriptorSet* pDescriptorCopies, const RecordObject& record_obj) {
@@ -357,7 +404,18 @@ void ThreadSafety::PreCallRecordFreeCommandBuffers(VkDevice device, VkCommandPoo
             StartWriteObject(pCommandBuffers[index], record_obj.location, lockCommandPool);
             FinishWriteObject(pCommandBuffers[index], record_obj.location, lockCommandPool);
             DestroyObject(pCommandBuffers[index]);
-            pool_command_buffers.erase(pCommandBuffers[index]);
+            auto iter = command_pool_map.find(pCommandBuffers[index]);
+            if (iter != command_pool_map.end() && iter->second.pool == commandPool) {
+                // Swap remove, the last command buffer of the pool takes the freed place
+                const uint32_t pool_index = iter->second.index;
+                assert(pool_index < pool_command_buffers.size() && pool_command_buffers[pool_index] == pCommandBuffers[index]);
+                const VkCommandBuffer last = pool_command_buffers.back();
+                if (last != pCommandBuffers[index]) {
+                    pool_command_buffers[pool_index] = last;
+                    command_pool_map.insert_or_assign(last, CommandBufferPool{commandPool, pool_index});
+                }
+                pool_command_buffers.pop_back();
+            }
             command_pool_map.erase(pCommandBuffers[index]);
         }
     }
@@ -481,6 +539,7 @@ void ThreadSafety::PreCallRecordDestroyDevice(VkDevice device, const VkAllocatio
                                               const RecordObject& record_obj) {
     StartWriteObjectParentInstance(device, record_obj.location);
     // Host access to device must be externally synchronized
+    ReportObjectWaitTimes(record_obj.location);
 }
 
 void ThreadSafety::PostCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator,
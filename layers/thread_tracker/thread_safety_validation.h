@@ -18,8 +18,10 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -73,27 +75,69 @@ class alignas(kObjectUserDataAlignment) ObjectUseData {
     WriteReadCount RemoveWriter() {
         int64_t prev = writer_reader_count.fetch_add(-(1LL << 32));
         assert(prev > 0);
+        NotifyWaiters();
         return WriteReadCount(prev);
     }
     WriteReadCount RemoveReader() {
         int64_t prev = writer_reader_count.fetch_add(-1LL);
         assert(prev > 0);
+        NotifyWaiters();
         return WriteReadCount(prev);
     }
     WriteReadCount GetCount() { return WriteReadCount(writer_reader_count); }
 
-    void WaitForObjectIdle(bool is_writer) {
-        // Wait for thread-safe access to object instead of skipping call.
-        while (GetCount().GetReadCount() > (int)(!is_writer) || GetCount().GetWriteCount() > (int)is_writer) {
-            std::this_thread::sleep_for(std::chrono::microseconds(1));
+    // Returns how long the calling thread was blocked
+    std::chrono::nanoseconds WaitForObjectIdle(bool is_writer) {
+        auto is_idle = [this, is_writer]() {
+            const WriteReadCount count = GetCount();
+            return count.GetReadCount() <= (int)(!is_writer) && count.GetWriteCount() <= (int)is_writer;
+        };
+        if (is_idle()) {
+            return {};
         }
+
+        // Wait for thread-safe access to object instead of skipping call.
+        // The waiter is registered before the predicate is checked under the slot mutex, so a Remove*() that does not see
+        // it is guaranteed to have updated the count before the check.
+        const auto start = std::chrono::steady_clock::now();
+        WaitSlot &slot = GetWaitSlot(this);
+        std::unique_lock<std::mutex> lock(slot.mutex);
+        waiter_count.fetch_add(1);
+        slot.cv.wait(lock, is_idle);
+        waiter_count.fetch_sub(1);
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
     }
 
     std::atomic<std::thread::id> thread{};
 
+    // Only used by counter::StartOwnedWrite(). Written with plain stores, concurrent writers at worst reset the count.
+    std::atomic<std::thread::id> owner_thread{};
+    std::atomic<uint32_t> owner_calls{};
+
   private:
+    // Waiting is only done after a threading error, so instead of a mutex and condition variable per object a few shared
+    // ones are picked by address. The cost for the common case is the load of waiter_count in Remove*().
+    struct WaitSlot {
+        std::mutex mutex;
+        std::condition_variable cv;
+    };
+    static WaitSlot &GetWaitSlot(const ObjectUseData *use_data) {
+        static WaitSlot slots[16];
+        return slots[(reinterpret_cast<uintptr_t>(use_data) / kObjectUserDataAlignment) % 16];
+    }
+
+    void NotifyWaiters() {
+        if (waiter_count.load() != 0) {
+            WaitSlot &slot = GetWaitSlot(this);
+            // Taking the mutex makes sure a waiter that already checked the count is blocked in wait() and gets notified
+            { std::lock_guard<std::mutex> guard(slot.mutex); }
+            slot.cv.notify_all();
+        }
+    }
+
     // Need to update write and read counts atomically. Writer in high 32 bits, reader in low 32 bits.
     std::atomic<int64_t> writer_reader_count{};
+    std::atomic<uint32_t> waiter_count{};
 };
 
 template <typename T>
@@ -104,28 +148,132 @@ class counter {
 
     vvl::concurrent_unordered_map<T, std::shared_ptr<ObjectUseData>, 6> object_table;
 
+    // Total time threads were blocked waiting for objects of this type to stop being used by another thread
+    std::atomic<uint64_t> wait_time_ns{0};
+
     void CreateObject(T object) { object_table.insert(object, std::make_shared<ObjectUseData>()); }
 
     void DestroyObject(T object) {
         if (object) {
             object_table.erase(object);
+            // The driver can hand out the same handle for a new object, so no thread can keep using what it cached
+            cache_epoch.fetch_add(1, std::memory_order_acq_rel);
         }
     }
 
-    std::shared_ptr<ObjectUseData> FindObject(T object, const Location& loc) {
+    // The returned pointer is kept alive by the cache of the calling thread until its next FindObject() on this handle type
+    ObjectUseData *FindObject(T object, const Location& loc) {
+        const uint64_t epoch = cache_epoch.load(std::memory_order_acquire);
+        ObjectUseCache &cache = GetThreadCache();
+        if (auto use_data = FindCachedObject(cache, object, epoch)) {
+            return use_data;
+        }
+
         assert(object_table.contains(object));
         auto iter = object_table.find(object);
         if (iter != object_table.end()) {
-            return iter->second;
+            auto &entry = cache.entries[cache.next_entry++ % cache.entries.size()];
+            entry.owner = this;
+            entry.object = object;
+            entry.epoch = epoch;
+            entry.use_data = iter->second;
+            return entry.use_data.get();
         } else {
-            object_data->LogError("UNASSIGNED-Threading-Info", object, loc,
-                                  "Couldn't find %s Object 0x%" PRIxLEAST64
-                                  ". This should not happen and may indicate a bug in the application.",
-                                  string_VulkanObjectType(object_type), (uint64_t)(object));
+            LogObjectNotFound(object, loc);
             return nullptr;
         }
     }
 
+    // With the thread_safety_owned_command_buffers setting. Once the object is written by the same thread kOwnedWriteCalls
+    // times in a row, the writes from that thread only compare the thread id, without changing the use counts, until
+    // another thread uses the object (see ReleaseOwnership()). Returns true if the write is not tracked, then
+    // FinishOwnedWrite() returns true for the matching finish.
+    bool StartOwnedWrite(T object, const Location& loc) {
+        if (object == VK_NULL_HANDLE) {
+            return false;
+        }
+        auto use_data = FindObject(object, loc);
+        if (!use_data) {
+            return false;
+        }
+        const std::thread::id tid = std::this_thread::get_id();
+        if (use_data->owner_thread.load(std::memory_order_relaxed) != tid) {
+            use_data->owner_thread.store(tid, std::memory_order_relaxed);
+            use_data->owner_calls.store(0, std::memory_order_relaxed);
+            return false;
+        }
+        const uint32_t calls = use_data->owner_calls.load(std::memory_order_relaxed);
+        if (calls < kOwnedWriteCalls) {
+            use_data->owner_calls.store(calls + 1, std::memory_order_relaxed);
+            return false;
+        }
+        OwnedWrites &owned = GetOwnedWrites();
+        if (owned.count == owned.objects.size()) {
+            return false;
+        }
+        owned.objects[owned.count++] = {this, object};
+        return true;
+    }
+
+    bool FinishOwnedWrite(T object) {
+        OwnedWrites &owned = GetOwnedWrites();
+        if (owned.count == 0 || owned.objects[owned.count - 1].first != this || owned.objects[owned.count - 1].second != object) {
+            return false;
+        }
+        --owned.count;
+        return true;
+    }
+
+    // The next write goes through the full tracking, whichever thread it comes from
+    void ReleaseOwnership(T object, const Location& loc) {
+        if (object == VK_NULL_HANDLE) {
+            return;
+        }
+        if (auto use_data = FindObject(object, loc)) {
+            use_data->owner_thread.store(std::thread::id(), std::memory_order_relaxed);
+        }
+    }
+
+    // For the arrays of handles of a call, ex. the descriptor sets of vkCmdBindDescriptorSets. The epoch and the thread
+    // cache are fetched once for the whole array, and objects missing from the cache are not added to it, so a long array
+    // does not evict the objects used by every call (the command buffer, the pipeline layout).
+    void StartReadRange(const T *objects, uint32_t count, const Location& loc) {
+        if (!objects) {
+            return;
+        }
+        const std::thread::id tid = std::this_thread::get_id();
+        const uint64_t epoch = cache_epoch.load(std::memory_order_acquire);
+        ObjectUseCache &cache = GetThreadCache();
+        for (uint32_t i = 0; i < count; ++i) {
+            const T object = objects[i];
+            if (object == VK_NULL_HANDLE) {
+                continue;
+            }
+            std::shared_ptr<ObjectUseData> holder;
+            if (auto use_data = FindObjectUncached(cache, object, epoch, holder, loc)) {
+                AddReader(use_data, object, tid, loc);
+            }
+        }
+    }
+
+    void FinishReadRange(const T *objects, uint32_t count, const Location& loc) {
+        if (!objects) {
+            return;
+        }
+        const uint64_t epoch = cache_epoch.load(std::memory_order_acquire);
+        ObjectUseCache &cache = GetThreadCache();
+        for (uint32_t i = 0; i < count; ++i) {
+            const T object = objects[i];
+            if (object == VK_NULL_HANDLE) {
+                continue;
+            }
+            std::shared_ptr<ObjectUseData> holder;
+            if (auto use_data = FindObjectUncached(cache, object, epoch, holder, loc)) {
+                use_data->RemoveReader();
+            }
+        }
+    }
+
     void StartWrite(T object, const Location& loc) {
         if (object == VK_NULL_HANDLE) {
             return;
@@ -184,19 +332,7 @@ class counter {
             return;
         }
 
-        const std::thread::id tid = std::this_thread::get_id();
-        const ObjectUseData::WriteReadCount prev_count = use_data->AddReader();
-        const bool prev_read = prev_count.GetReadCount() != 0;
-        const bool prev_write = prev_count.GetWriteCount() != 0;
-
-        if (!prev_read && !prev_write) {
-            // There is no current use of the object. Record reader thread.
-            use_data->thread = tid;
-        } else if (prev_write && use_data->thread != tid) {
-            HandleErrorOnRead(use_data, object, loc);
-        } else {
-            // There are other readers of the object.
-        }
+        AddReader(use_data, object, std::this_thread::get_id(), loc);
     }
 
     void FinishRead(T object, const Location& loc) {
@@ -215,7 +351,87 @@ class counter {
         object_data = val_obj;
     }
 
+    // Another counter can be created at the same address
+    ~counter() { cache_epoch.fetch_add(1, std::memory_order_acq_rel); }
+
   private:
+    void AddReader(ObjectUseData *use_data, T object, std::thread::id tid, const Location& loc) {
+        const ObjectUseData::WriteReadCount prev_count = use_data->AddReader();
+        const bool prev_read = prev_count.GetReadCount() != 0;
+        const bool prev_write = prev_count.GetWriteCount() != 0;
+
+        if (!prev_read && !prev_write) {
+            // There is no current use of the object. Record reader thread.
+            use_data->thread = tid;
+        } else if (prev_write && use_data->thread != tid) {
+            HandleErrorOnRead(use_data, object, loc);
+        } else {
+            // There are other readers of the object.
+        }
+    }
+
+    void LogObjectNotFound(T object, const Location& loc) {
+        object_data->LogError("UNASSIGNED-Threading-Info", object, loc,
+                              "Couldn't find %s Object 0x%" PRIxLEAST64
+                              ". This should not happen and may indicate a bug in the application.",
+                              string_VulkanObjectType(object_type), (uint64_t)(object));
+    }
+
+    // Most objects are used by one thread at a time (ex. a command buffer being recorded), so each thread keeps the last few
+    // objects it used to skip the object_table lookup and the shared_ptr reference counting. Entries are only valid for
+    // the epoch they were added in, which is bumped by any DestroyObject() of this handle type.
+    struct ObjectUseCache {
+        struct Entry {
+            const counter *owner = nullptr;
+            T object{};
+            uint64_t epoch = 0;
+            std::shared_ptr<ObjectUseData> use_data;
+        };
+        std::array<Entry, 4> entries;
+        uint32_t next_entry = 0;
+    };
+    static ObjectUseCache &GetThreadCache() {
+        static thread_local ObjectUseCache cache;
+        return cache;
+    }
+    static inline std::atomic<uint64_t> cache_epoch{1};
+
+    static constexpr uint32_t kOwnedWriteCalls = 16;
+    // The writes started by StartOwnedWrite() on this thread that are not finished yet, a call writes few objects
+    struct OwnedWrites {
+        std::array<std::pair<const counter *, T>, 4> objects{};
+        uint32_t count = 0;
+    };
+    static OwnedWrites &GetOwnedWrites() {
+        static thread_local OwnedWrites owned;
+        return owned;
+    }
+
+    ObjectUseData *FindCachedObject(const ObjectUseCache &cache, T object, uint64_t epoch) const {
+        for (const auto &entry : cache.entries) {
+            if (entry.object == object && entry.owner == this && entry.epoch == epoch) {
+                return entry.use_data.get();
+            }
+        }
+        return nullptr;
+    }
+
+    // The returned pointer is kept alive by holder, when the object is not in the thread cache
+    ObjectUseData *FindObjectUncached(const ObjectUseCache &cache, T object, uint64_t epoch,
+                                      std::shared_ptr<ObjectUseData> &holder, const Location& loc) {
+        if (auto use_data = FindCachedObject(cache, object, epoch)) {
+            return use_data;
+        }
+        assert(object_table.contains(object));
+        auto iter = object_table.find(object);
+        if (iter == object_table.end()) {
+            LogObjectNotFound(object, loc);
+            return nullptr;
+        }
+        holder = iter->second;
+        return holder.get();
+    }
+
     std::string GetErrorMessage(std::thread::id tid, std::thread::id other_tid) const {
         std::stringstream err_str;
         err_str << "THREADING ERROR : object of type " << string_VulkanObjectType(object_type)
@@ -223,14 +439,14 @@ class counter {
         return err_str.str();
     }
 
-    void HandleErrorOnWrite(const std::shared_ptr<ObjectUseData> &use_data, T object, const Location& loc) {
+    void HandleErrorOnWrite(ObjectUseData *use_data, T object, const Location& loc) {
         const std::thread::id tid = std::this_thread::get_id();
         const std::string error_message = GetErrorMessage(tid, use_data->thread.load(std::memory_order_relaxed));
         const bool skip =
             object_data->LogError("UNASSIGNED-Threading-MultipleThreads-Write", object, loc, "%s", error_message.c_str());
         if (skip) {
             // Wait for thread-safe access to object instead of skipping call.
-            use_data->WaitForObjectIdle(true);
+            wait_time_ns += use_data->WaitForObjectIdle(true).count();
             // There is now no current use of the object. Record writer thread.
             use_data->thread = tid;
         } else {
@@ -239,7 +455,7 @@ class counter {
         }
     }
 
-    void HandleErrorOnRead(const std::shared_ptr<ObjectUseData> &use_data, T object, const Location& loc) {
+    void HandleErrorOnRead(ObjectUseData *use_data, T object, const Location& loc) {
         const std::thread::id tid = std::this_thread::get_id();
         // There is a writer of the object.
         const auto error_message = GetErrorMessage(tid, use_data->thread.load(std::memory_order_relaxed));
@@ -247,7 +463,7 @@ class counter {
             object_data->LogError("UNASSIGNED-Threading-MultipleThreads-Read", object, loc, "%s", error_message.c_str());
         if (skip) {
             // Wait for thread-safe access to object instead of skipping call.
-            use_data->WaitForObjectIdle(false);
+            wait_time_ns += use_data->WaitForObjectIdle(false).count();
             use_data->thread = tid;
         }
     }
@@ -262,8 +478,15 @@ class ThreadSafety : public ValidationObject {
     ReadLockGuard ReadLock() const override;
     WriteLockGuard WriteLock() override;
 
-    vvl::concurrent_unordered_map<VkCommandBuffer, VkCommandPool, 6> command_pool_map;
-    vvl::unordered_map<VkCommandPool, vvl::unordered_set<VkCommandBuffer>> pool_command_buffers_map;
+    // Pool of a command buffer, and where the command buffer is in the list of the pool in pool_command_buffers_map
+    struct CommandBufferPool {
+        VkCommandPool pool;
+        uint32_t index;
+    };
+    vvl::concurrent_unordered_map<VkCommandBuffer, CommandBufferPool, 6> command_pool_map;
+    // Freeing a command buffer moves the last one of the pool to its place, so transient pools that allocate and free hundreds
+    // of command buffers per frame never hash into per pool sets, and destroying a pool walks a vector
+    vvl::unordered_map<VkCommandPool, std::vector<VkCommandBuffer>> pool_command_buffers_map;
     vvl::unordered_map<VkDevice, vvl::unordered_set<VkQueue>> device_queues_map;
 
     // Track per-descriptorsetlayout and per-descriptorset whether read_only is used.
@@ -282,6 +505,9 @@ class ThreadSafety : public ValidationObject {
     vvl::concurrent_unordered_map<VkDescriptorSet, bool, 6> ds_read_only_map;
     bool DsReadOnly(VkDescriptorSet) const;
 
+    // Reports the time spent waiting on objects used simultaneously by multiple threads, if any
+    void ReportObjectWaitTimes(const Location &loc) const;
+
     counter<VkCommandBuffer> c_VkCommandBuffer;
     counter<VkDevice> c_VkDevice;
     counter<VkInstance> c_VkInstance;
@@ -325,6 +551,12 @@ class ThreadSafety : public ValidationObject {
     void FinishWriteObject(type object, const Location& loc) { c_##type.FinishWrite(object, loc); } \
     void StartReadObject(type object, const Location& loc) { c_##type.StartRead(object, loc); }     \
     void FinishReadObject(type object, const Location& loc) { c_##type.FinishRead(object, loc); }   \
+    void StartReadObjects(const type* objects, uint32_t count, const Location& loc) {                 \
+        c_##type.StartReadRange(objects, count, loc);                                                 \
+    }                                                                                                 \
+    void FinishReadObjects(const type* objects, uint32_t count, const Location& loc) {                \
+        c_##type.FinishReadRange(objects, count, loc);                                                \
+    }                                                                                                 \
     void CreateObject(type object) { c_##type.CreateObject(object); }                                 \
     void DestroyObject(type object) { c_##type.DestroyObject(object); }
 
@@ -359,29 +591,38 @@ class ThreadSafety : public ValidationObject {
 
     // VkCommandBuffer needs check for implicit use of command pool
     void StartWriteObject(VkCommandBuffer object, const Location& loc, bool lockPool = true) {
+        if (lockPool && enabled[thread_safety_owned_command_buffers] && c_VkCommandBuffer.StartOwnedWrite(object, loc)) {
+            return;
+        }
         if (lockPool) {
             auto iter = command_pool_map.find(object);
             if (iter != command_pool_map.end()) {
-                VkCommandPool pool = iter->second;
+                VkCommandPool pool = iter->second.pool;
                 StartWriteObject(pool, loc);
             }
         }
         c_VkCommandBuffer.StartWrite(object, loc);
     }
     void FinishWriteObject(VkCommandBuffer object, const Location& loc, bool lockPool = true) {
+        if (lockPool && enabled[thread_safety_owned_command_buffers] && c_VkCommandBuffer.FinishOwnedWrite(object)) {
+            return;
+        }
         c_VkCommandBuffer.FinishWrite(object, loc);
         if (lockPool) {
             auto iter = command_pool_map.find(object);
             if (iter != command_pool_map.end()) {
-                VkCommandPool pool = iter->second;
+                VkCommandPool pool = iter->second.pool;
                 FinishWriteObject(pool, loc);
             }
         }
     }
     void StartReadObject(VkCommandBuffer object, const Location& loc) {
+        if (enabled[thread_safety_owned_command_buffers]) {
+            c_VkCommandBuffer.ReleaseOwnership(object, loc);
+        }
         auto iter = command_pool_map.find(object);
         if (iter != command_pool_map.end()) {
-            VkCommandPool pool = iter->second;
+            VkCommandPool pool = iter->second.pool;
             // We set up a read guard against the "Contents" counter to catch conflict vs. vkResetCommandPool and
             // vkDestroyCommandPool while *not* establishing a read guard against the command pool counter itself to avoid false
             // positive for non-externally sync'd command buffers
@@ -393,10 +634,25 @@ class ThreadSafety : public ValidationObject {
         c_VkCommandBuffer.FinishRead(object, loc);
         auto iter = command_pool_map.find(object);
         if (iter != command_pool_map.end()) {
-            VkCommandPool pool = iter->second;
+            VkCommandPool pool = iter->second.pool;
             c_VkCommandPoolContents.FinishRead(pool, loc);
         }
     }
+    // Each command buffer also guards its pool, so there is nothing to batch
+    void StartReadObjects(const VkCommandBuffer* objects, uint32_t count, const Location& loc) {
+        if (objects) {
+            for (uint32_t i = 0; i < count; ++i) {
+                StartReadObject(objects[i], loc);
+            }
+        }
+    }
+    void FinishReadObjects(const VkCommandBuffer* objects, uint32_t count, const Location& loc) {
+        if (objects) {
+            for (uint32_t i = 0; i < count; ++i) {
+                FinishReadObject(objects[i], loc);
+            }
+        }
+    }
 
     void PostCallRecordGetPhysicalDeviceDisplayPlanePropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t *pPropertyCount,
                                                                   VkDisplayPlanePropertiesKHR *pProperties,
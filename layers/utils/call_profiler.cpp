@@ -0,0 +1,129 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "call_profiler.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <string_view>
+
+namespace vvl {
+
+namespace {
+
+struct ReportEntry {
+    uint32_t object_type;
+    uint32_t function;
+    uint32_t phase;
+    uint64_t calls;
+    uint64_t ticks;
+};
+
+bool EndsWith(const std::string &str, const char *suffix) {
+    const std::string_view suffix_view(suffix);
+    return str.size() >= suffix_view.size() && str.compare(str.size() - suffix_view.size(), suffix_view.size(), suffix) == 0;
+}
+
+}  // namespace
+
+const char *CallProfiler::PhaseName(Phase phase) {
+    switch (phase) {
+        case kPreCallValidate:
+            return "PreCallValidate";
+        case kPreCallRecord:
+            return "PreCallRecord";
+        case kPostCallRecord:
+            return "PostCallRecord";
+        default:
+            return "Unknown";
+    }
+}
+
+CallProfiler::CallProfiler(const std::string &output_file, uint32_t object_type_count)
+    : output_file_(output_file),
+      object_type_count_(object_type_count),
+      object_names_(object_type_count),
+      counters_(new Counter[size_t(object_type_count) * kFuncCount * kPhaseCount]),
+      start_ticks_(ReadTicks()),
+      start_time_(std::chrono::steady_clock::now()) {}
+
+void CallProfiler::SetObjectName(uint32_t object_type, const char *name) {
+    if (object_type < object_type_count_) {
+        object_names_[object_type] = name;
+    }
+}
+
+void CallProfiler::Report(const char *title) const {
+    std::vector<ReportEntry> entries;
+    for (uint32_t object_type = 0; object_type < object_type_count_; ++object_type) {
+        for (uint32_t function = 0; function < kFuncCount; ++function) {
+            for (uint32_t phase = 0; phase < kPhaseCount; ++phase) {
+                const Counter &counter = counters_[(object_type * kFuncCount + function) * kPhaseCount + phase];
+                const uint64_t calls = counter.calls.load(std::memory_order_relaxed);
+                if (calls != 0) {
+                    entries.emplace_back(
+                        ReportEntry{object_type, function, phase, calls, counter.ticks.load(std::memory_order_relaxed)});
+                }
+            }
+        }
+    }
+    std::sort(entries.begin(), entries.end(), [](const ReportEntry &a, const ReportEntry &b) { return a.ticks > b.ticks; });
+
+    // The tick rate is only known after the fact, from how much both clocks advanced since the profiler was created
+    const double elapsed_ns = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time_).count());
+    const uint64_t elapsed_ticks = ReadTicks() - start_ticks_;
+    const double ns_per_tick = elapsed_ticks ? elapsed_ns / static_cast<double>(elapsed_ticks) : 0.0;
+
+    const bool to_stdout = output_file_.empty() || output_file_ == "stdout";
+    FILE *out = to_stdout ? stdout : fopen(output_file_.c_str(), "a");
+    if (!out) {
+        return;
+    }
+
+    const bool csv = !to_stdout && EndsWith(output_file_, ".csv");
+    if (csv) {
+        fprintf(out, "report,object,function,phase,calls,total_ns,average_ns\n");
+    } else {
+        fprintf(out, "Validation call profile: %s\n", title);
+        fprintf(out, "%-24s %-48s %-16s %12s %16s %12s\n", "Object", "Function", "Phase", "Calls", "Total (ns)", "Avg (ns)");
+    }
+    for (const ReportEntry &entry : entries) {
+        const double total_ns = static_cast<double>(entry.ticks) * ns_per_tick;
+        const double average_ns = total_ns / static_cast<double>(entry.calls);
+        const char *object_name = object_names_[entry.object_type].empty() ? "Unknown" : object_names_[entry.object_type].c_str();
+        const char *function_name = String(static_cast<Func>(entry.function));
+        if (csv) {
+            fprintf(out, "%s,%s,%s,%s,%" PRIu64 ",%.0f,%.1f\n", title, object_name, function_name, PhaseName(Phase(entry.phase)),
+                    entry.calls, total_ns, average_ns);
+        } else {
+            fprintf(out, "%-24s %-48s %-16s %12" PRIu64 " %16.0f %12.1f\n", object_name, function_name,
+                    PhaseName(Phase(entry.phase)), entry.calls, total_ns, average_ns);
+        }
+    }
+    if (!csv) {
+        fprintf(out, "\n");
+    }
+
+    if (to_stdout) {
+        fflush(out);
+    } else {
+        fclose(out);
+    }
+}
+
+}  // namespace vvl
@@ -0,0 +1,112 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define VVL_CALL_PROFILER_RDTSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define VVL_CALL_PROFILER_RDTSC
+#endif
+
+#include "generated/error_location_helper.h"
+
+namespace vvl {
+
+// Call counts and time spent by each validation object in each PreCallValidate/PreCallRecord/PostCallRecord entry point,
+// to find out which checks cost the most. Only created when the call_profile_file setting is set, the chassis then wraps
+// every intercept call in a Scope.
+//
+// Time is read from the TSC where available (converted to nanoseconds with the steady clock elapsed over the lifetime of
+// the profiler), so a Scope costs a couple of counter reads and two relaxed atomic adds.
+class CallProfiler {
+  public:
+    enum Phase : uint32_t {
+        kPreCallValidate = 0,
+        kPreCallRecord,
+        kPostCallRecord,
+        kPhaseCount,
+    };
+
+    struct Counter {
+        std::atomic<uint64_t> calls{0};
+        std::atomic<uint64_t> ticks{0};
+    };
+
+    class Scope {
+      public:
+        Scope() = default;
+        explicit Scope(Counter *counter) : counter_(counter), start_(ReadTicks()) {}
+        Scope(Scope &&other) noexcept : counter_(other.counter_), start_(other.start_) { other.counter_ = nullptr; }
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+        ~Scope() {
+            if (counter_) {
+                counter_->ticks.fetch_add(ReadTicks() - start_, std::memory_order_relaxed);
+                counter_->calls.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+      private:
+        Counter *counter_ = nullptr;
+        uint64_t start_ = 0;
+    };
+
+    // object_type_count is the number of object slots, names for them are given with SetObjectName()
+    CallProfiler(const std::string &output_file, uint32_t object_type_count);
+    CallProfiler(const CallProfiler &) = delete;
+    CallProfiler &operator=(const CallProfiler &) = delete;
+
+    void SetObjectName(uint32_t object_type, const char *name);
+
+    Scope Begin(uint32_t object_type, Func function, Phase phase) {
+        return Scope(&counters_[(object_type * kFuncCount + static_cast<uint32_t>(function)) * kPhaseCount + phase]);
+    }
+
+    // Writes every entry with at least one call, most costly first. A file name ending in .csv gets CSV, anything else
+    // (including "stdout") a table. Files are appended to so each device of the process adds its own report.
+    void Report(const char *title) const;
+
+    static const char *PhaseName(Phase phase);
+
+    static uint64_t ReadTicks() {
+#if defined(VVL_CALL_PROFILER_RDTSC)
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+  private:
+    const std::string output_file_;
+    const uint32_t object_type_count_;
+    std::vector<std::string> object_names_;
+    std::unique_ptr<Counter[]> counters_;
+
+    const uint64_t start_ticks_;
+    const std::chrono::steady_clock::time_point start_time_;
+};
+
+}  // namespace vvl
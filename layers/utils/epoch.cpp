@@ -0,0 +1,118 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "epoch.h"
+
+#include <algorithm>
+
+namespace vvl {
+
+// One per thread that ever entered a guard. Readers are never freed, the ones of exited threads are reused.
+struct EpochGuard::Reader {
+    // Epoch the outermost guard started in, 0 outside of any guard
+    std::atomic<uint64_t> epoch{0};
+    std::atomic<bool> in_use{false};
+    uint32_t depth = 0;
+    Reader *next = nullptr;
+};
+
+namespace {
+
+std::atomic<uint64_t> global_epoch{1};
+std::atomic<EpochGuard::Reader *> readers{nullptr};
+
+EpochGuard::Reader *AcquireReader() {
+    for (auto *reader = readers.load(std::memory_order_acquire); reader; reader = reader->next) {
+        bool expected = false;
+        if (!reader->in_use.load(std::memory_order_relaxed) &&
+            reader->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            return reader;
+        }
+    }
+    auto *reader = new EpochGuard::Reader;
+    reader->in_use.store(true, std::memory_order_relaxed);
+    reader->next = readers.load(std::memory_order_relaxed);
+    while (!readers.compare_exchange_weak(reader->next, reader, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+    return reader;
+}
+
+struct ThreadReader {
+    EpochGuard::Reader *reader = AcquireReader();
+    ~ThreadReader() { reader->in_use.store(false, std::memory_order_release); }
+};
+
+EpochGuard::Reader *ThisThreadReader() {
+    thread_local ThreadReader thread_reader;
+    return thread_reader.reader;
+}
+
+// UINT64_MAX if no thread is in a guard
+uint64_t OldestActiveEpoch() {
+    // Pairs with the fence of the EpochGuard constructor: a guard that is not seen here started after the object was
+    // made unreachable, so it cannot have found it
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    uint64_t oldest = UINT64_MAX;
+    for (auto *reader = readers.load(std::memory_order_acquire); reader; reader = reader->next) {
+        const uint64_t epoch = reader->epoch.load(std::memory_order_acquire);
+        if (epoch != 0) {
+            oldest = std::min(oldest, epoch);
+        }
+    }
+    return oldest;
+}
+
+}  // namespace
+
+EpochGuard::EpochGuard() : reader_(ThisThreadReader()) {
+    if (reader_->depth++ == 0) {
+        // Acquire, so that seeing the epoch bumped by a Retire() also means seeing the object it retired as unreachable
+        reader_->epoch.store(global_epoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+EpochGuard::~EpochGuard() {
+    if (reader_ && --reader_->depth == 0) {
+        reader_->epoch.store(0, std::memory_order_release);
+    }
+}
+
+void EpochRetireList::Retire(std::shared_ptr<void> &&object) {
+    const uint64_t epoch = global_epoch.fetch_add(1, std::memory_order_acq_rel);
+    // Released after unlocking, destroying a state object can retire others
+    std::vector<Entry> released;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        entries_.emplace_back(Entry{epoch, std::move(object)});
+        // Guards that started in a later epoch cannot have found the objects retired before it
+        const uint64_t oldest = OldestActiveEpoch();
+        const auto in_use = std::partition(entries_.begin(), entries_.end(),
+                                           [oldest](const Entry &entry) { return entry.epoch >= oldest; });
+        released.assign(std::make_move_iterator(in_use), std::make_move_iterator(entries_.end()));
+        entries_.erase(in_use, entries_.end());
+    }
+}
+
+void EpochRetireList::ReleaseAll() {
+    std::vector<Entry> released;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        released.swap(entries_);
+    }
+}
+
+}  // namespace vvl
@@ -0,0 +1,90 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace vvl {
+
+// Epoch based reclamation, to use objects without holding a reference to them.
+//
+// A thread holding an EpochGuard publishes the global epoch it started in. Objects removed from shared structures are
+// handed to an EpochRetireList instead of being released, tagged with the epoch of their removal, and are only released
+// once every guard that started before the removal has ended. A thread that found an object while in a guard can use
+// it until the guard ends, even if another thread removes it meanwhile.
+//
+// Guards nest: only the outermost one of a thread publishes the epoch, which costs a store and a fence, inner ones are a
+// thread local counter increment.
+class EpochGuard {
+  public:
+    EpochGuard();
+    EpochGuard(EpochGuard &&other) noexcept : reader_(other.reader_) { other.reader_ = nullptr; }
+    EpochGuard(const EpochGuard &) = delete;
+    EpochGuard &operator=(const EpochGuard &) = delete;
+    EpochGuard &operator=(EpochGuard &&) = delete;
+    ~EpochGuard();
+
+    struct Reader;
+
+  private:
+    Reader *reader_;
+};
+
+class EpochRetireList {
+  public:
+    EpochRetireList() = default;
+    EpochRetireList(const EpochRetireList &) = delete;
+    EpochRetireList &operator=(const EpochRetireList &) = delete;
+
+    // The object must already be unreachable for threads that have not found it yet. Also releases the objects retired
+    // earlier that no guard can still use.
+    void Retire(std::shared_ptr<void> &&object);
+    // NOTE: No guard may use any retired object anymore, ex. when destroying the device
+    void ReleaseAll();
+
+  private:
+    struct Entry {
+        uint64_t epoch;
+        std::shared_ptr<void> object;
+    };
+
+    std::mutex lock_;
+    std::vector<Entry> entries_;
+};
+
+// Pointer to a state object that is kept alive by the EpochGuard it holds, instead of by a reference
+template <typename T>
+class Borrowed {
+  public:
+    Borrowed() = default;
+    Borrowed(T *ptr, EpochGuard &&guard) : ptr_(ptr), guard_(std::move(guard)) {}
+
+    T *get() const { return ptr_; }
+    T *operator->() const { return ptr_; }
+    T &operator*() const { return *ptr_; }
+    explicit operator bool() const { return ptr_ != nullptr; }
+
+  private:
+    T *ptr_ = nullptr;
+    EpochGuard guard_;
+};
+
+}  // namespace vvl
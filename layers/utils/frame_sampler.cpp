@@ -0,0 +1,32 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "frame_sampler.h"
+
+namespace vvl {
+
+FrameSampler::FrameSampler(uint32_t interval, uint32_t time_budget_us, Clock clock)
+    : clock_(clock), interval_(interval), time_budget_ns_(static_cast<int64_t>(time_budget_us) * 1000), frame_start_ns_(clock()) {}
+
+void FrameSampler::NextFrame() {
+    // Presents on several queues can race, each one still ends one frame
+    const uint64_t frame_index = frame_index_.fetch_add(1, std::memory_order_relaxed) + 1;
+    frame_start_ns_.store(clock_(), std::memory_order_relaxed);
+    sampled_.store(interval_ <= 1 || frame_index % interval_ == 0, std::memory_order_relaxed);
+}
+
+}  // namespace vvl
@@ -0,0 +1,62 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace vvl {
+
+// Picks the frames whose command buffer recording goes through the expensive validation objects, when the
+// frame_sampling_interval or frame_sampling_time_budget setting is set. Each vkQueuePresentKHR of the device ends a frame.
+//
+// Every interval-th frame is sampled, starting with the first one (0 and 1 sample all of them). With a time budget a sampled
+// frame stops being sampled once time_budget_us have passed since its start, so the cost of a heavy frame is bounded too.
+class FrameSampler {
+  public:
+    // Nanoseconds, the steady clock unless a test gives its own
+    using Clock = int64_t (*)();
+    static int64_t SteadyClock() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    FrameSampler(uint32_t interval, uint32_t time_budget_us, Clock clock = SteadyClock);
+
+    // Called by the chassis after each vkQueuePresentKHR
+    void NextFrame();
+
+    // Read by every vkCmd* call, from any thread
+    bool Sampled() const {
+        if (!sampled_.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        return time_budget_ns_ == 0 || clock_() - frame_start_ns_.load(std::memory_order_relaxed) < time_budget_ns_;
+    }
+
+    uint64_t FrameIndex() const { return frame_index_.load(std::memory_order_relaxed); }
+
+  private:
+    const Clock clock_;
+    const uint32_t interval_;
+    const int64_t time_budget_ns_;
+    std::atomic<uint64_t> frame_index_{0};
+    std::atomic<bool> sampled_{true};
+    std::atomic<int64_t> frame_start_ns_;
+};
+
+}  // namespace vvl
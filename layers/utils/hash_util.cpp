@@ -42,6 +42,12 @@ uint32_t ShaderHash(const void *pCode, const size_t codeSize) {
     return XXH32(pCode, codeSize, seed);
 }
 
+uint64_t ShaderValidationHash(const void *pCode, const size_t codeSize, uint64_t seed) {
+    return XXH3_64bits_withSeed(pCode, codeSize, seed);
+}
+
+uint64_t Hash64(const void *data, size_t size) { return XXH3_64bits(data, size); }
+
 uint64_t DescriptorVariableHash(const void *info, const size_t info_size) {
     constexpr uint64_t seed = 0;
     return XXH64(info, info_size, seed);
@@ -18,11 +18,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
+#include <cstring>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <type_traits>
 #include <vector>
 #include "containers/custom_containers.h"
@@ -98,6 +102,44 @@ class HashCombiner {
     Key combined_;
 };
 
+uint64_t Hash64(const void *data, size_t size);
+
+// Packs the fields of a key and hashes them with a single XXH3 call, for the keys of the canonical dictionaries that are made
+// of many small fields. Only types without padding can be added, so equal keys always pack to the same bytes.
+class BulkHasher {
+  public:
+    template <typename T, typename = std::enable_if_t<std::has_unique_object_representations_v<T>>>
+    BulkHasher &Add(const T *values, size_t count) {
+        const size_t size = count * sizeof(T);
+        if (size == 0) {
+            return *this;
+        }
+        if (heap_.empty() && size_ + size <= inline_.size()) {
+            std::memcpy(inline_.data() + size_, values, size);
+        } else {
+            if (heap_.empty()) {
+                heap_.assign(inline_.begin(), inline_.begin() + size_);
+            }
+            const auto *bytes = reinterpret_cast<const uint8_t *>(values);
+            heap_.insert(heap_.end(), bytes, bytes + size);
+        }
+        size_ += size;
+        return *this;
+    }
+    template <typename T, typename = std::enable_if_t<std::has_unique_object_representations_v<T>>>
+    BulkHasher &operator<<(const T &value) {
+        return Add(&value, 1);
+    }
+
+    size_t Value() const { return static_cast<size_t>(Hash64(heap_.empty() ? inline_.data() : heap_.data(), size_)); }
+
+  private:
+    // Most keys fit, the larger ones move to the heap
+    std::array<uint8_t, 256> inline_;
+    std::vector<uint8_t> heap_;
+    size_t size_ = 0;
+};
+
 // A template to inherit std::hash overloads from when T::hash() is defined
 template <typename T>
 struct HasHashMember {
@@ -120,48 +162,122 @@ struct IsOrderedContainer {
 //       globally unique, invariant, nor repeatable from execution to
 //       execution.
 //
-// The entries of the dictionary are shared_pointers (the contents of
-// which are invariant with resize/insert), with the hash and equality
-// template arguments wrapped in a shared pointer dereferencing
-// function object
+// The entries are weak references kept in shards selected by the hash, so lookups from different threads rarely contend and
+// a value stays canonical only as long as an Id references it. Expired entries are dropped when their bucket gets a new entry
+// and when a shard has doubled in size since it was last swept.
 template <typename T, typename Hasher = vvl::hash<T>, typename KeyEqual = std::equal_to<T>>
 class Dictionary {
   public:
     using Def = T;
     using Id = std::shared_ptr<const Def>;
 
-    // Find the unique entry match the provided value, adding if needed
-    // TODO: segregate lookup from insert, using reader/write locks to reduce contention -- if needed
+    // Find the unique entry match the provided value, adding if needed. Finding an existing entry only takes the read lock
+    // of its shard and does not allocate.
     template <typename U = T>
     Id LookUp(U &&value) {
-        // We create an Id from the value, which will either be retained by dict (if new) or deleted on return (if extant)
-        Id from_input = std::make_shared<T>(std::forward<U>(value));
-
-        // Insert takes care of the "unique" id part by rejecting the insert if a key matching by_value exists, but returning us
-        // the Id of the extant shared_pointer(id->def) instead.
-        // return the value of the Iterator from the <Iterator, bool> pair returned by insert
-        Guard g(lock);  // Dict isn't thread safe, and use is presumed to be multi-threaded
-        return *dict.insert(from_input).first;
+        const T &def = value;
+        const size_t hash = Hasher()(def);
+        Shard &shard = shards_[ShardIndex(hash)];
+        {
+            ReadGuard guard(shard.lock);
+            if (Id found = shard.Find(hash, def)) {
+                return found;
+            }
+        }
+        WriteGuard guard(shard.lock);
+        // Another thread can have added it between the two locks
+        if (Id found = shard.Find(hash, def)) {
+            return found;
+        }
+        Id id = std::make_shared<const T>(std::forward<U>(value));
+        shard.Insert(hash, id);
+        return id;
     }
 
   private:
-    struct HashKeyValue {
-        size_t operator()(const Id &value) const { return Hasher()(*value); }
-    };
-    struct KeyValueEqual {
-        bool operator()(const Id &lhs, const Id &rhs) const { return KeyEqual()(*lhs, *rhs); }
+    using Entries = small_vector<std::weak_ptr<const Def>, 1, uint32_t>;
+    using Lock = std::shared_mutex;
+    using ReadGuard = std::shared_lock<Lock>;
+    using WriteGuard = std::unique_lock<Lock>;
+
+    static constexpr size_t kShardCount = 16;
+    static constexpr size_t kMinSweepSize = 64;
+
+    static size_t ShardIndex(size_t hash) {
+        const uint64_t bits = hash;
+        return static_cast<size_t>((bits ^ (bits >> 16) ^ (bits >> 32)) % kShardCount);
+    }
+
+    // Moves the live entries to the front, returns their count
+    static uint32_t Compact(Entries &entries) {
+        uint32_t live = 0;
+        for (uint32_t i = 0; i < entries.size(); ++i) {
+            if (!entries[i].expired()) {
+                if (live != i) {
+                    entries[live] = std::move(entries[i]);
+                }
+                ++live;
+            }
+        }
+        entries.resize(live);
+        return live;
+    }
+
+    struct Shard {
+        Lock lock;
+        vvl::unordered_map<size_t, Entries> buckets;
+        size_t entry_count = 0;
+        size_t sweep_size = kMinSweepSize;
+
+        Id Find(size_t hash, const T &def) const {
+            auto bucket = buckets.find(hash);
+            if (bucket == buckets.end()) {
+                return nullptr;
+            }
+            for (const auto &entry : bucket->second) {
+                Id id = entry.lock();
+                if (id && KeyEqual()(*id, def)) {
+                    return id;
+                }
+            }
+            return nullptr;
+        }
+
+        void Insert(size_t hash, const Id &id) {
+            Entries &entries = buckets[hash];
+            entry_count -= entries.size() - Compact(entries);
+            entries.emplace_back(id);
+            ++entry_count;
+            if (entry_count >= sweep_size) {
+                Sweep();
+            }
+        }
+
+        void Sweep() {
+            entry_count = 0;
+            for (auto bucket = buckets.begin(); bucket != buckets.end();) {
+                const uint32_t live = Compact(bucket->second);
+                if (live == 0) {
+                    bucket = buckets.erase(bucket);
+                } else {
+                    entry_count += live;
+                    ++bucket;
+                }
+            }
+            sweep_size = std::max(kMinSweepSize, 2 * entry_count);
+        }
     };
-    using Dict = vvl::unordered_set<Id, HashKeyValue, KeyValueEqual>;
-    using Lock = std::mutex;
-    using Guard = std::lock_guard<Lock>;
-    Lock lock;
-    Dict dict;
+    std::array<Shard, kShardCount> shards_;
 };
 
 uint32_t VuidHash(std::string_view vuid);
 
 uint32_t ShaderHash(const void *pCode, const size_t codeSize);
 
+// Key of the shader validation cache, which is shared between devices and processes. seed identifies the spirv-val
+// configuration the result is valid for.
+uint64_t ShaderValidationHash(const void *pCode, const size_t codeSize, uint64_t seed);
+
 uint64_t DescriptorVariableHash(const void *info, const size_t info_size);
 
 }  // namespace hash_util
@@ -43,18 +43,23 @@ static inline bool operator==(const vku::safe_VkDescriptorSetLayoutBinding &lhs,
     return true;
 }
 
+namespace hash_util {
+// In hash_util so it is found next to the operator<< of BulkHasher
+static inline BulkHasher &operator<<(BulkHasher &hasher, const vku::safe_VkDescriptorSetLayoutBinding &value) {
+    hasher << value.binding << value.descriptorType << value.descriptorCount << value.stageFlags;
+    if (value.pImmutableSamplers) {
+        hasher.Add(value.pImmutableSamplers, value.descriptorCount);
+    }
+    return hasher;
+}
+}  // namespace hash_util
+
 namespace std {
 template <>
 struct hash<vku::safe_VkDescriptorSetLayoutBinding> {
     size_t operator()(const vku::safe_VkDescriptorSetLayoutBinding &value) const {
-        hash_util::HashCombiner hc;
-        hc << value.binding << value.descriptorType << value.descriptorCount << value.stageFlags;
-        if (value.pImmutableSamplers) {
-            for (uint32_t samp = 0; samp < value.descriptorCount; samp++) {
-                hc << value.pImmutableSamplers[samp];
-            }
-        }
-        return hc.Value();
+        hash_util::BulkHasher hasher;
+        return (hasher << value).Value();
     }
 };
 }  // namespace std
@@ -68,8 +73,8 @@ namespace std {
 template <>
 struct hash<VkPushConstantRange> {
     size_t operator()(const VkPushConstantRange &value) const {
-        hash_util::HashCombiner hc;
-        return (hc << value.stageFlags << value.offset << value.size).Value();
+        hash_util::BulkHasher hasher;
+        return (hasher << value).Value();
     }
 };
 }  // namespace std
@@ -78,7 +83,11 @@ using PushConstantRanges = std::vector<VkPushConstantRange>;
 
 namespace std {
 template <>
-struct hash<PushConstantRanges> : public hash_util::IsOrderedContainer<PushConstantRanges> {};
+struct hash<PushConstantRanges> {
+    size_t operator()(const PushConstantRanges &value) const {
+        return hash_util::BulkHasher().Add(value.data(), value.size()).Value();
+    }
+};
 }  // namespace std
 
 // VkImageSubresourceRange
@@ -90,9 +99,8 @@ namespace std {
 template <>
 struct hash<VkImageSubresourceRange> {
     size_t operator()(const VkImageSubresourceRange &value) const {
-        hash_util::HashCombiner hc;
-        hc << value.aspectMask << value.baseMipLevel << value.levelCount << value.baseArrayLayer << value.layerCount;
-        return hc.Value();
+        hash_util::BulkHasher hasher;
+        return (hasher << value).Value();
     }
 };
 }  // namespace std
@@ -125,7 +133,9 @@ namespace std {
 template <>
 struct hash<VkShaderModuleIdentifierEXT> {
     size_t operator()(const VkShaderModuleIdentifierEXT &value) const {
-        return hash_util::HashCombiner().Combine(value.identifier, value.identifier + value.identifierSize).Value();
+        // Same bytes as operator== compares
+        const uint32_t size = std::min(VK_MAX_SHADER_MODULE_IDENTIFIER_SIZE_EXT, value.identifierSize);
+        return hash_util::BulkHasher().Add(value.identifier, size).Value();
     }
 };
 }  // namespace std
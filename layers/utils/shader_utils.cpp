@@ -40,14 +40,36 @@ spv_target_env PickSpirvEnv(const APIVersion &api_version, bool spirv_1_4) {
     return SPV_ENV_VULKAN_1_0;
 }
 
+spv_const_context GetThreadSpirvContext(spv_target_env env) {
+    struct ThreadContexts {
+        ~ThreadContexts() {
+            for (auto &context : contexts) {
+                spvContextDestroy(context.second);
+            }
+        }
+        std::vector<std::pair<spv_target_env, spv_context>> contexts;
+    };
+    thread_local ThreadContexts thread_contexts;
+    for (const auto &context : thread_contexts.contexts) {
+        if (context.first == env) {
+            return context.second;
+        }
+    }
+    spv_context context = spvContextCreate(env);
+    thread_contexts.contexts.emplace_back(env, context);
+    return context;
+}
+
 // Some Vulkan extensions/features are just all done in spirv-val behind optional settings
-void AdjustValidatorOptions(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features,
-                            spvtools::ValidatorOptions &options) {
+uint32_t AdjustValidatorOptions(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features,
+                                spvtools::ValidatorOptions &options) {
+    uint32_t options_mask = 0;
     // VK_KHR_relaxed_block_layout never had a feature bit so just enabling the extension allows relaxed layout
     // Was promotoed in Vulkan 1.1 so anyone using Vulkan 1.1 also gets this for free
     if (IsExtEnabled(device_extensions.vk_khr_relaxed_block_layout)) {
         // --relax-block-layout
         options.SetRelaxBlockLayout(true);
+        options_mask |= 1u << 0;
     }
 
     // The rest of the settings are controlled from a feature bit, which are set correctly in the state tracking. Regardless of
@@ -56,22 +78,27 @@ void AdjustValidatorOptions(const DeviceExtensions &device_extensions, const Dev
     if (enabled_features.uniformBufferStandardLayout == VK_TRUE) {
         // --uniform-buffer-standard-layout
         options.SetUniformBufferStandardLayout(true);
+        options_mask |= 1u << 1;
     }
     if (enabled_features.scalarBlockLayout == VK_TRUE) {
         // --scalar-block-layout
         options.SetScalarBlockLayout(true);
+        options_mask |= 1u << 2;
     }
     if (enabled_features.workgroupMemoryExplicitLayoutScalarBlockLayout) {
         // --workgroup-scalar-block-layout
         options.SetWorkgroupScalarBlockLayout(true);
+        options_mask |= 1u << 3;
     }
     if (enabled_features.maintenance4) {
         // --allow-localsizeid
         options.SetAllowLocalSizeId(true);
+        options_mask |= 1u << 4;
     }
 
     // Faster validation without friendly names.
     options.SetFriendlyNames(false);
+    return options_mask;
 }
 
 void GetActiveSlots(ActiveSlotMap &active_slots, const std::shared_ptr<const spirv::EntryPoint> &entrypoint) {
@@ -114,6 +114,19 @@ struct EntryPoint;
 class Instruction;
 }  // namespace spirv
 
+// Outcome of applying the specialization constants of a stage to its module with spirv-opt and validating the result
+struct SpecializedSpirv {
+    bool optimized = false;  // false if spirv-opt failed
+    std::vector<std::string> optimizer_messages;
+    spv_result_t validation_result = SPV_SUCCESS;
+    std::string validation_error;
+    // From the specialized module
+    uint32_t local_size_x = 0;
+    uint32_t local_size_y = 0;
+    uint32_t local_size_z = 0;
+    uint32_t total_workgroup_shared_memory = 0;
+};
+
 struct PipelineStageState {
     // We use this over a spirv::Module because there are times we need to create empty objects
     std::shared_ptr<const vvl::ShaderModule> module_state;
@@ -122,6 +135,9 @@ struct PipelineStageState {
     const vku::safe_VkShaderCreateInfoEXT *shader_object_create_info;
     // If null, means it is an empty object, no SPIR-V backing it
     std::shared_ptr<const spirv::EntryPoint> entrypoint;
+    // Set when the specialization constants were applied before the stage is validated, to do it for several stages in
+    // parallel
+    mutable std::shared_ptr<const SpecializedSpirv> specialized;
 
     PipelineStageState(const vku::safe_VkPipelineShaderStageCreateInfo *pipeline_create_info,
                        const vku::safe_VkShaderCreateInfoEXT *shader_object_create_info,
@@ -153,21 +169,24 @@ class ValidationCache {
         if (data[0] != size) return;
         if (data[1] != VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT) return;
         uint8_t expected_uuid[VK_UUID_SIZE];
-        Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, expected_uuid);
+        GetUuid(expected_uuid);
         if (memcmp(&data[2], expected_uuid, VK_UUID_SIZE) != 0) return;  // different version
 
-        data = (uint32_t const *)(reinterpret_cast<uint8_t const *>(data) + headerSize);
-
+        // The data of the app or of the cache file may not be aligned for the 64-bit hashes
+        const uint8_t *hashes = reinterpret_cast<uint8_t const *>(pCreateInfo->pInitialData);
         auto guard = WriteLock();
-        for (; size < pCreateInfo->initialDataSize; data++, size += sizeof(uint32_t)) {
-            good_shader_hashes_.insert(*data);
+        for (; size + sizeof(uint64_t) <= pCreateInfo->initialDataSize; size += sizeof(uint64_t)) {
+            uint64_t hash;
+            std::memcpy(&hash, hashes + size, sizeof(hash));
+            good_shader_hashes_.insert(hash);
         }
     }
 
     void Write(size_t *pDataSize, void *pData) {
         const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;  // 4 bytes for header size + 4 bytes for version number + UUID
         if (!pData) {
-            *pDataSize = headerSize + good_shader_hashes_.size() * sizeof(uint32_t);
+            auto guard = ReadLock();
+            *pDataSize = headerSize + good_shader_hashes_.size() * sizeof(uint64_t);
             return;
         }
 
@@ -182,14 +201,16 @@ class ValidationCache {
         // Write the header
         *out++ = headerSize;
         *out++ = VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT;
-        Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, reinterpret_cast<uint8_t *>(out));
-        out = (uint32_t *)(reinterpret_cast<uint8_t *>(out) + VK_UUID_SIZE);
+        GetUuid(reinterpret_cast<uint8_t *>(out));
+        uint8_t *hashes = reinterpret_cast<uint8_t *>(pData);
 
         {
             auto guard = ReadLock();
-            for (auto it = good_shader_hashes_.begin(); it != good_shader_hashes_.end() && actualSize < *pDataSize;
-                 it++, out++, actualSize += sizeof(uint32_t)) {
-                *out = *it;
+            for (auto it = good_shader_hashes_.begin();
+                 it != good_shader_hashes_.end() && actualSize + sizeof(uint64_t) <= *pDataSize;
+                 it++, actualSize += sizeof(uint64_t)) {
+                const uint64_t hash = *it;
+                std::memcpy(hashes + actualSize, &hash, sizeof(hash));
             }
         }
 
@@ -207,12 +228,12 @@ class ValidationCache {
         for (auto h : other->good_shader_hashes_) good_shader_hashes_.insert(h);
     }
 
-    bool Contains(uint32_t hash) {
+    bool Contains(uint64_t hash) {
         auto guard = ReadLock();
         return good_shader_hashes_.count(hash) != 0;
     }
 
-    void Insert(uint32_t hash) {
+    void Insert(uint64_t hash) {
         auto guard = WriteLock();
         good_shader_hashes_.insert(hash);
     }
@@ -222,6 +243,15 @@ class ValidationCache {
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
+    // Version of the layout of the data after the header, bumped when it changes
+    static constexpr uint32_t kDataVersion = 2;
+
+    // The UUID depends on the version of spirv-val and of the data layout, so data from other versions is ignored
+    void GetUuid(uint8_t *uuid) {
+        Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, uuid);
+        std::memcpy(uuid + VK_UUID_SIZE - sizeof(kDataVersion), &kDataVersion, sizeof(kDataVersion));
+    }
+
     void Sha1ToVkUuid(const char *sha1_str, uint8_t *uuid) {
         // Convert sha1_str from a hex string to binary. We only need VK_UUID_SIZE bytes of
         // output, so pad with zeroes if the input string is shorter than that, and truncate
@@ -245,14 +275,20 @@ class ValidationCache {
     // we don't store negative results, as we would have to also store what was
     // wrong with them; also, we expect they will get fixed, so we're less
     // likely to see them again.
-    vvl::unordered_set<uint32_t> good_shader_hashes_;
+    // The hashes are hash_util::ShaderValidationHash of the code, seeded with the spirv-val configuration.
+    vvl::unordered_set<uint64_t> good_shader_hashes_;
     mutable std::shared_mutex lock_;
 };
 
 spv_target_env PickSpirvEnv(const APIVersion &api_version, bool spirv_1_4);
 
-void AdjustValidatorOptions(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features,
-                            spvtools::ValidatorOptions &options);
+// A spv_context only holds tables for its target environment, each thread keeps one per environment instead of creating
+// one for every module it validates
+spv_const_context GetThreadSpirvContext(spv_target_env env);
+
+// Returns a mask of the options that were turned on, a spirv-val result only holds for the same options
+uint32_t AdjustValidatorOptions(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features,
+                                spvtools::ValidatorOptions &options);
 
 void GetActiveSlots(ActiveSlotMap &active_slots, const std::shared_ptr<const spirv::EntryPoint> &entrypoint);
 ActiveSlotMap GetActiveSlots(const StageStateVec &stage_states);
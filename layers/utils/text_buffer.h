@@ -0,0 +1,97 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace vvl {
+
+// Appends text to a caller supplied, fixed size buffer, for building short strings (ex. Location::AppendFields) without
+// any allocation. Text that does not fit is dropped, Truncated() tells if that happened and RequiredSize() how much room
+// the whole text needs. The content is always null terminated, so the buffer needs at least one byte.
+class TextBuffer {
+  public:
+    TextBuffer(char *buffer, size_t capacity) : data_(buffer), capacity_(capacity) { data_[0] = '\0'; }
+    TextBuffer(const TextBuffer &) = delete;
+    TextBuffer &operator=(const TextBuffer &) = delete;
+
+    TextBuffer &Append(std::string_view str) {
+        const size_t available = capacity_ - 1 - size_;
+        const size_t count = str.size() < available ? str.size() : available;
+        truncated_ |= count != str.size();
+        required_size_ += str.size();
+        memcpy(data_ + size_, str.data(), count);
+        size_ += count;
+        data_[size_] = '\0';
+        return *this;
+    }
+
+    TextBuffer &Append(char c) { return Append(std::string_view(&c, 1)); }
+
+    TextBuffer &AppendUint(uint64_t value) {
+        char digits[20];
+        size_t count = 0;
+        do {
+            digits[sizeof(digits) - 1 - count++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value != 0);
+        return Append(std::string_view(digits + sizeof(digits) - count, count));
+    }
+
+    // Lower case, prefixed with 0x
+    TextBuffer &AppendHex(uint64_t value) {
+        char digits[18];
+        size_t count = 0;
+        do {
+            digits[sizeof(digits) - 1 - count++] = "0123456789abcdef"[value & 0xf];
+            value >>= 4;
+        } while (value != 0);
+        digits[sizeof(digits) - 1 - count++] = 'x';
+        digits[sizeof(digits) - 1 - count++] = '0';
+        return Append(std::string_view(digits + sizeof(digits) - count, count));
+    }
+
+    const char *c_str() const { return data_; }
+    std::string_view view() const { return std::string_view(data_, size_); }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    bool Truncated() const { return truncated_; }
+    // Size of everything appended so far, including the dropped text (without the null terminator)
+    size_t RequiredSize() const { return required_size_; }
+
+  private:
+    char *data_;
+    size_t capacity_;
+    size_t size_ = 0;
+    size_t required_size_ = 0;
+    bool truncated_ = false;
+};
+
+// TextBuffer with its own storage, meant to live on the stack
+template <size_t N>
+class StackTextBuffer : public TextBuffer {
+  public:
+    StackTextBuffer() : TextBuffer(storage_, N) {}
+
+  private:
+    char storage_[N];
+};
+
+}  // namespace vvl
@@ -0,0 +1,259 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "trace_recorder.h"
+
+#include <cinttypes>
+#include <functional>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__APPLE__)
+#include <pthread.h>
+#include <unistd.h>
+#elif defined(__linux__) || defined(__ANDROID__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace vvl {
+
+namespace {
+
+std::atomic<uint64_t> next_recorder_id{1};
+
+// Recorder and buffer of the last span of this thread, most threads only ever trace one device
+struct ThreadCache {
+    uint64_t recorder_id = 0;
+    void *buffer = nullptr;
+};
+thread_local ThreadCache thread_cache;
+
+uint64_t GetProcessId() {
+#if defined(_WIN32)
+    return GetCurrentProcessId();
+#elif defined(__APPLE__) || defined(__linux__) || defined(__ANDROID__)
+    return static_cast<uint64_t>(getpid());
+#else
+    return 0;
+#endif
+}
+
+// The ids the OS and so the traces of the application use, not std::thread::id
+uint64_t GetOsThreadId() {
+#if defined(_WIN32)
+    return GetCurrentThreadId();
+#elif defined(__APPLE__)
+    uint64_t thread_id = 0;
+    pthread_threadid_np(nullptr, &thread_id);
+    return thread_id;
+#elif defined(__linux__) || defined(__ANDROID__)
+    return static_cast<uint64_t>(syscall(SYS_gettid));
+#else
+    return std::hash<std::thread::id>()(std::this_thread::get_id());
+#endif
+}
+
+// Names come from the layer, this only keeps a stray character from breaking the JSON
+void WriteJsonString(FILE *file, const char *str) {
+    fputc('"', file);
+    for (const char *c = str; *c; ++c) {
+        if (*c == '"' || *c == '\\') {
+            fputc('\\', file);
+        }
+        if (static_cast<unsigned char>(*c) >= 0x20) {
+            fputc(*c, file);
+        }
+    }
+    fputc('"', file);
+}
+
+// trace.json, trace.1.json, trace.2.json...
+std::string IndexedFileName(const std::string &output_file, uint32_t index) {
+    if (index == 0) {
+        return output_file;
+    }
+    const size_t separator = output_file.find_last_of("/\\");
+    const size_t dot = output_file.find_last_of('.');
+    const bool has_extension = dot != std::string::npos && (separator == std::string::npos || dot > separator);
+    const size_t split = has_extension ? dot : output_file.size();
+    return output_file.substr(0, split) + "." + std::to_string(index) + output_file.substr(split);
+}
+
+}  // namespace
+
+TraceRecorder::ThreadBuffer::~ThreadBuffer() {
+    while (read_chunk) {
+        Chunk *next = read_chunk->next.load(std::memory_order_relaxed);
+        delete read_chunk;
+        read_chunk = next;
+    }
+}
+
+std::shared_ptr<TraceRecorder> TraceRecorder::GetShared(const std::string &output_file) {
+    static std::mutex shared_lock;
+    static std::weak_ptr<TraceRecorder> shared_recorder;
+    static uint32_t created_count = 0;
+    std::lock_guard<std::mutex> guard(shared_lock);
+    std::shared_ptr<TraceRecorder> recorder = shared_recorder.lock();
+    if (!recorder) {
+        recorder = std::make_shared<TraceRecorder>(IndexedFileName(output_file, created_count++));
+        shared_recorder = recorder;
+    }
+    return recorder;
+}
+
+TraceRecorder::TraceRecorder(const std::string &output_file)
+    : id_(next_recorder_id.fetch_add(1, std::memory_order_relaxed)), process_id_(GetProcessId()), output_file_(output_file) {
+    file_ = fopen(output_file.c_str(), "w");
+    if (!file_) {
+        return;
+    }
+    // The JSON array format, a trace cut short without its closing bracket still loads
+    fputs("[\n", file_);
+    flush_thread_ = std::thread(&TraceRecorder::FlushLoop, this);
+}
+
+TraceRecorder::~TraceRecorder() {
+    if (flush_thread_.joinable()) {
+        {
+            std::lock_guard<std::mutex> guard(flush_thread_lock_);
+            exit_ = true;
+        }
+        flush_thread_cv_.notify_all();
+        flush_thread_.join();
+    }
+    Flush();
+    if (file_) {
+        fputs("\n]\n", file_);
+        fclose(file_);
+    }
+}
+
+TraceRecorder::ThreadBuffer &TraceRecorder::GetThreadBuffer() {
+    if (thread_cache.recorder_id != id_) {
+        thread_cache.recorder_id = id_;
+        thread_cache.buffer = AddThreadBuffer();
+    }
+    return *static_cast<ThreadBuffer *>(thread_cache.buffer);
+}
+
+TraceRecorder::ThreadBuffer *TraceRecorder::AddThreadBuffer() {
+    const std::thread::id this_thread = std::this_thread::get_id();
+    std::lock_guard<std::mutex> guard(buffers_lock_);
+    // The thread traced on this recorder before, and on another one since
+    for (const auto &[thread, buffer] : buffers_) {
+        if (thread == this_thread) {
+            return buffer.get();
+        }
+    }
+    auto buffer = std::make_unique<ThreadBuffer>();
+    buffer->thread_id = GetOsThreadId();
+    buffer->write_chunk = new Chunk;
+    buffer->read_chunk = buffer->write_chunk;
+    buffers_.emplace_back(this_thread, std::move(buffer));
+    return buffers_.back().second.get();
+}
+
+void TraceRecorder::Add(const Event &event) {
+    if (!file_) {
+        return;
+    }
+    ThreadBuffer &buffer = GetThreadBuffer();
+    Chunk *chunk = buffer.write_chunk;
+    uint32_t index = chunk->count.load(std::memory_order_relaxed);
+    if (index == Chunk::kCapacity) {
+        Chunk *next = new Chunk;
+        chunk->next.store(next, std::memory_order_release);
+        buffer.write_chunk = next;
+        chunk = next;
+        index = 0;
+    }
+    chunk->events[index] = event;
+    // Release, Flush() reads the event once it sees the count
+    chunk->count.store(index + 1, std::memory_order_release);
+}
+
+void TraceRecorder::WriteEvent(const Event &event, uint64_t thread_id) {
+    if (!first_event_) {
+        fputs(",\n", file_);
+    }
+    first_event_ = false;
+    fputs("{\"name\":", file_);
+    WriteJsonString(file_, event.name);
+    fputs(",\"cat\":", file_);
+    WriteJsonString(file_, event.category);
+    // Microseconds, with the nanoseconds as decimals
+    fprintf(file_, ",\"ph\":\"X\",\"ts\":%" PRIu64 ".%03" PRIu64 ",\"dur\":%" PRIu64 ".%03" PRIu64 ",\"pid\":%" PRIu64
+                   ",\"tid\":%" PRIu64,
+            event.start_ns / 1000, event.start_ns % 1000, event.duration_ns / 1000, event.duration_ns % 1000, process_id_,
+            thread_id);
+    if (event.detail) {
+        fputs(",\"args\":{\"detail\":", file_);
+        WriteJsonString(file_, event.detail);
+        fputc('}', file_);
+    }
+    fputc('}', file_);
+}
+
+void TraceRecorder::Flush() {
+    if (!file_) {
+        return;
+    }
+    std::vector<ThreadBuffer *> buffers;
+    {
+        std::lock_guard<std::mutex> guard(buffers_lock_);
+        buffers.reserve(buffers_.size());
+        for (const auto &entry : buffers_) {
+            buffers.emplace_back(entry.second.get());
+        }
+    }
+
+    std::lock_guard<std::mutex> guard(file_lock_);
+    for (ThreadBuffer *buffer : buffers) {
+        while (true) {
+            Chunk *chunk = buffer->read_chunk;
+            const uint32_t count = chunk->count.load(std::memory_order_acquire);
+            for (; buffer->read_index < count; ++buffer->read_index) {
+                WriteEvent(chunk->events[buffer->read_index], buffer->thread_id);
+            }
+            if (count < Chunk::kCapacity) {
+                break;
+            }
+            // A full chunk is freed once the thread has moved on to the next one
+            Chunk *next = chunk->next.load(std::memory_order_acquire);
+            if (!next) {
+                break;
+            }
+            delete chunk;
+            buffer->read_chunk = next;
+            buffer->read_index = 0;
+        }
+    }
+    fflush(file_);
+}
+
+void TraceRecorder::FlushLoop() {
+    std::unique_lock<std::mutex> guard(flush_thread_lock_);
+    while (!flush_thread_cv_.wait_for(guard, kFlushInterval, [this]() { return exit_; })) {
+        guard.unlock();
+        Flush();
+        guard.lock();
+    }
+}
+
+}  // namespace vvl
@@ -0,0 +1,158 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace vvl {
+
+// Timeline of what the layer spends its time on, to be looked at next to the trace of the application. Only created when
+// the trace_file setting is set, the chassis then records a span for each PreCallValidate/PreCallRecord/PostCallRecord
+// call of each validation object, and the validation objects record their own work done outside of the API calls.
+//
+// There is one recorder for the process, held by the instances and shared by all their devices (see GetShared()), so the
+// devices running at the same time write one timeline to one file.
+//
+// Each thread appends its spans to its own buffer, a list of fixed size chunks only written by that thread, so recording
+// takes no lock. The buffers are drained to the file every kFlushInterval by a thread of the recorder, on Flush() and
+// when the recorder is destroyed. The file is a Chrome JSON trace (opens in ui.perfetto.dev and chrome://tracing); times
+// are from the steady clock with the pid and OS thread ids of the process, like in the traces of most engines.
+class TraceRecorder {
+  public:
+    static constexpr std::chrono::milliseconds kFlushInterval{1000};
+
+    // Strings are not copied, they must outlive the recorder (ex. string literals or vvl::String(Func))
+    struct Event {
+        const char *category;
+        const char *name;
+        // Goes to the args of the event when not null
+        const char *detail;
+        uint64_t start_ns;
+        uint64_t duration_ns;
+    };
+
+    class Span {
+      public:
+        Span() = default;
+        Span(TraceRecorder *recorder, const char *category, const char *name, const char *detail)
+            : recorder_(recorder), category_(category), name_(name), detail_(detail), start_ns_(Now()) {}
+        Span(Span &&other) noexcept
+            : recorder_(other.recorder_),
+              category_(other.category_),
+              name_(other.name_),
+              detail_(other.detail_),
+              start_ns_(other.start_ns_) {
+            other.recorder_ = nullptr;
+        }
+        Span(const Span &) = delete;
+        Span &operator=(const Span &) = delete;
+        ~Span() {
+            if (recorder_) {
+                recorder_->Add(Event{category_, name_, detail_, start_ns_, Now() - start_ns_});
+            }
+        }
+
+      private:
+        TraceRecorder *recorder_ = nullptr;
+        const char *category_ = nullptr;
+        const char *name_ = nullptr;
+        const char *detail_ = nullptr;
+        uint64_t start_ns_ = 0;
+    };
+
+    explicit TraceRecorder(const std::string &output_file);
+    TraceRecorder(const TraceRecorder &) = delete;
+    TraceRecorder &operator=(const TraceRecorder &) = delete;
+    ~TraceRecorder();
+
+    // The recorder of the process, created on the first call while none is alive. A recorder created after an earlier one
+    // was destroyed writes to output_file with a ".<index>" suffix before the extension, so it does not truncate the
+    // trace of the earlier one.
+    static std::shared_ptr<TraceRecorder> GetShared(const std::string &output_file);
+
+    // False when the file could not be opened, nothing is recorded then
+    bool IsOpen() const { return file_ != nullptr; }
+    const std::string &GetOutputFile() const { return output_file_; }
+
+    Span Begin(const char *category, const char *name, const char *detail = nullptr) {
+        return Span(this, category, name, detail);
+    }
+    void Add(const Event &event);
+
+    // Writes the spans recorded so far by every thread
+    void Flush();
+
+    static uint64_t Now() {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+  private:
+    struct Chunk {
+        static constexpr uint32_t kCapacity = 1024;
+        Event events[kCapacity];
+        // Events written so far, released by the writing thread after each event
+        std::atomic<uint32_t> count{0};
+        // Set by the writing thread once the chunk is full, the chunk is not written anymore afterwards
+        std::atomic<Chunk *> next{nullptr};
+    };
+
+    struct ThreadBuffer {
+        uint64_t thread_id = 0;
+        // Only used by the thread owning the buffer
+        Chunk *write_chunk = nullptr;
+        // Only used by Flush(), the chunks before it have been written and freed
+        Chunk *read_chunk = nullptr;
+        uint32_t read_index = 0;
+        ~ThreadBuffer();
+    };
+
+    ThreadBuffer &GetThreadBuffer();
+    ThreadBuffer *AddThreadBuffer();
+    void WriteEvent(const Event &event, uint64_t thread_id);
+    void FlushLoop();
+
+    // Distinguishes the recorders in the per thread cache, an address can be reused by a later recorder
+    const uint64_t id_;
+    const uint64_t process_id_;
+    const std::string output_file_;
+
+    // Registering the buffer of a new thread
+    std::mutex buffers_lock_;
+    std::vector<std::pair<std::thread::id, std::unique_ptr<ThreadBuffer>>> buffers_;
+
+    // Writing to the file
+    std::mutex file_lock_;
+    FILE *file_ = nullptr;
+    bool first_event_ = true;
+
+    std::mutex flush_thread_lock_;
+    std::condition_variable flush_thread_cv_;
+    bool exit_ = false;
+    std::thread flush_thread_;
+};
+
+}  // namespace vvl
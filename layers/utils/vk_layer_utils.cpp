@@ -17,6 +17,7 @@
 
 #include "vk_layer_utils.h"
 
+#include <iostream>
 #include <string.h>
 #include <sys/stat.h>
 
@@ -40,9 +41,11 @@ void LayerDebugMessengerActions(DebugReport *debug_report, const char *layer_ide
     std::string report_flags_key = layer_identifier;
     std::string debug_action_key = layer_identifier;
     std::string log_filename_key = layer_identifier;
+    std::string structured_log_filename_key = layer_identifier;
     report_flags_key.append(".report_flags");
     debug_action_key.append(".debug_action");
     log_filename_key.append(".log_filename");
+    structured_log_filename_key.append(".structured_log_filename");
 
     const vvl::unordered_map<std::string, VkFlags> debug_actions_option_definitions = {
         {std::string("VK_DBG_LAYER_ACTION_IGNORE"), VK_DBG_LAYER_ACTION_IGNORE},
@@ -50,6 +53,7 @@ void LayerDebugMessengerActions(DebugReport *debug_report, const char *layer_ide
         {std::string("VK_DBG_LAYER_ACTION_LOG_MSG"), VK_DBG_LAYER_ACTION_LOG_MSG},
         {std::string("VK_DBG_LAYER_ACTION_BREAK"), VK_DBG_LAYER_ACTION_BREAK},
         {std::string("VK_DBG_LAYER_ACTION_DEBUG_OUTPUT"), VK_DBG_LAYER_ACTION_DEBUG_OUTPUT},
+        {std::string("VK_DBG_LAYER_ACTION_LOG_STRUCTURED"), VK_DBG_LAYER_ACTION_LOG_STRUCTURED},
         {std::string("VK_DBG_LAYER_ACTION_DEFAULT"), VK_DBG_LAYER_ACTION_DEFAULT}};
 
     const vvl::unordered_map<std::string, VkFlags> log_msg_type_option_definitions = {{std::string("warn"), kWarningBit},
@@ -91,6 +95,18 @@ void LayerDebugMessengerActions(DebugReport *debug_report, const char *layer_ide
         LayerCreateMessengerCallback(debug_report, default_layer_callback, &dbg_create_info, &messenger);
     }
 
+    // Not a callback, the records are written by LogMsg before any text is formatted
+    if (debug_action & VK_DBG_LAYER_ACTION_LOG_STRUCTURED) {
+        const char *structured_log_filename = getLayerOption(structured_log_filename_key.c_str());
+        if (!debug_report->OpenStructuredLog(structured_log_filename, dbg_create_info.messageSeverity,
+                                             dbg_create_info.messageType)) {
+            std::cout << std::endl
+                      << layer_identifier << " ERROR: Cannot open structured log file " << structured_log_filename
+                      << ", structured logging is disabled" << std::endl
+                      << std::endl;
+        }
+    }
+
     messenger = VK_NULL_HANDLE;
 
     if (debug_action & VK_DBG_LAYER_ACTION_DEBUG_OUTPUT) {
@@ -0,0 +1,85 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "wait_list.h"
+
+#include <condition_variable>
+#include <mutex>
+
+namespace vvl {
+
+// A thread waits for one object at a time, so all of its waiters share its condition variable
+struct WaitList::Parker {
+    std::mutex lock;
+    std::condition_variable cond;
+};
+
+static WaitList::Parker &ThreadParker() {
+    static thread_local WaitList::Parker parker;
+    return parker;
+}
+
+WaitList::Waiter::Waiter(uint64_t value) : value_(value), parker_(ThreadParker()) {}
+
+bool WaitList::Waiter::WaitUntil(const std::chrono::steady_clock::time_point &deadline) {
+    std::unique_lock<std::mutex> guard(parker_.lock);
+    return parker_.cond.wait_until(guard, deadline, [this]() { return woken_; });
+}
+
+void WaitList::Add(Waiter &waiter) {
+    assert(!waiter.linked_);
+    waiter.prev_ = nullptr;
+    waiter.next_ = head_;
+    if (head_) {
+        head_->prev_ = &waiter;
+    }
+    head_ = &waiter;
+    waiter.linked_ = true;
+}
+
+void WaitList::Remove(Waiter &waiter) {
+    if (!waiter.linked_) {
+        return;
+    }
+    if (waiter.prev_) {
+        waiter.prev_->next_ = waiter.next_;
+    } else {
+        head_ = waiter.next_;
+    }
+    if (waiter.next_) {
+        waiter.next_->prev_ = waiter.prev_;
+    }
+    waiter.linked_ = false;
+}
+
+void WaitList::Wake(uint64_t value) {
+    Waiter *waiter = head_;
+    while (waiter) {
+        Waiter *next = waiter->next_;
+        if (waiter->value_ <= value) {
+            Remove(*waiter);
+            // The waiter can go out of scope as soon as the lock is released, it is not touched afterwards. The parker
+            // outlives it, its thread is blocked on it.
+            std::lock_guard<std::mutex> guard(waiter->parker_.lock);
+            waiter->woken_ = true;
+            waiter->parker_.cond.notify_one();
+        }
+        waiter = next;
+    }
+}
+
+}  // namespace vvl
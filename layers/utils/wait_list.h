@@ -0,0 +1,77 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+
+namespace vvl {
+
+// Threads waiting for an object to reach a value, ex. vkWaitSemaphores() waiting for the retirement of a payload.
+//
+// A Waiter lives on the stack of the waiting thread and is linked into the list of the object, so a wait allocates nothing.
+// The thread sleeps on a condition variable of its own, which is thread_local, and Wake() wakes every waiter that is done
+// in a single pass, ex. all the threads waiting for the payloads retired by a submission.
+//
+// NOTE: Add(), Remove() and Wake() must be called with the lock of the object owning the list held. WaitUntil() is called
+// without it, and a waiter that timed out must be removed before it goes out of scope.
+class WaitList {
+  public:
+    struct Parker;
+
+    class Waiter {
+      public:
+        // Woken once the object reaches value
+        explicit Waiter(uint64_t value = 0);
+        ~Waiter() { assert(!linked_); }
+        Waiter(const Waiter &) = delete;
+        Waiter &operator=(const Waiter &) = delete;
+
+        // Returns false if the deadline passed first
+        bool WaitUntil(const std::chrono::steady_clock::time_point &deadline);
+
+      private:
+        friend class WaitList;
+        Waiter *prev_ = nullptr;
+        Waiter *next_ = nullptr;
+        const uint64_t value_;
+        bool linked_ = false;
+        Parker &parker_;
+        // Guarded by the mutex of parker_
+        bool woken_ = false;
+    };
+
+    WaitList() = default;
+    WaitList(const WaitList &) = delete;
+    WaitList &operator=(const WaitList &) = delete;
+    ~WaitList() { assert(!head_); }
+
+    bool Empty() const { return head_ == nullptr; }
+
+    void Add(Waiter &waiter);
+    // Does nothing if the waiter was woken already
+    void Remove(Waiter &waiter);
+    // Wakes and removes the waiters of a value up to value
+    void Wake(uint64_t value);
+    void WakeAll() { Wake(UINT64_MAX); }
+
+  private:
+    Waiter *head_ = nullptr;
+};
+
+}  // namespace vvl
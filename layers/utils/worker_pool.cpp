@@ -0,0 +1,212 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "worker_pool.h"
+
+#include <algorithm>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__) && !defined(__ANDROID__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace vvl {
+
+// Pool and queue of the worker running on this thread
+static thread_local const WorkerPool *thread_pool = nullptr;
+static thread_local uint32_t thread_queue = 0;
+
+static void PinThread(std::thread &thread, uint32_t cpu) {
+#if defined(_WIN32)
+    SetThreadAffinityMask(thread.native_handle(), DWORD_PTR(1) << (cpu % (sizeof(DWORD_PTR) * 8)));
+#elif defined(__linux__) && !defined(__ANDROID__)
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+    pthread_setaffinity_np(thread.native_handle(), sizeof(cpus), &cpus);
+#else
+    (void)thread;
+    (void)cpu;
+#endif
+}
+
+WorkerPool::WorkerPool(uint32_t thread_count, bool pin_threads) {
+    queues_.reserve(thread_count + 1);
+    for (uint32_t i = 0; i <= thread_count; ++i) {
+        queues_.emplace_back(std::make_unique<TaskQueue>());
+    }
+    const uint32_t cpu_count = std::thread::hardware_concurrency();
+    threads_.reserve(thread_count);
+    for (uint32_t i = 0; i < thread_count; ++i) {
+        threads_.emplace_back(&WorkerPool::WorkerLoop, this, i);
+        if (pin_threads && cpu_count > 0) {
+            PinThread(threads_.back(), i % cpu_count);
+        }
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> guard(sleep_lock_);
+        exit_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto &thread : threads_) {
+        thread.join();
+    }
+}
+
+std::shared_ptr<WorkerPool> WorkerPool::GetShared(uint32_t thread_count, bool pin_threads) {
+    static std::mutex shared_lock;
+    static std::weak_ptr<WorkerPool> shared_pool;
+    std::lock_guard<std::mutex> guard(shared_lock);
+    std::shared_ptr<WorkerPool> pool = shared_pool.lock();
+    if (!pool) {
+        pool = std::make_shared<WorkerPool>(thread_count, pin_threads);
+        shared_pool = pool;
+    }
+    return pool;
+}
+
+void WorkerPool::TaskGroup::Run(std::function<void()> &&task) {
+    if (!pool_) {
+        task();
+        return;
+    }
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    pool_->Push(Task{std::move(task), this});
+}
+
+void WorkerPool::TaskGroup::Wait() {
+    if (!pool_) {
+        return;
+    }
+    const uint32_t own_queue = (thread_pool == pool_) ? thread_queue : pool_->GetThreadCount();
+    // Acquire, the writes of the tasks are visible once they are all done
+    while (pending_.load(std::memory_order_acquire) != 0) {
+        if (pool_->RunQueuedTask(own_queue)) {
+            continue;
+        }
+        std::unique_lock<std::mutex> guard(pool_->sleep_lock_);
+        ++pool_->sleeping_waiters_;
+        pool_->done_cv_.wait(guard, [this]() {
+            return pending_.load(std::memory_order_acquire) == 0 || pool_->queued_tasks_.load(std::memory_order_relaxed) != 0;
+        });
+        --pool_->sleeping_waiters_;
+    }
+}
+
+void WorkerPool::ParallelFor(uint32_t count, const std::function<void(uint32_t)> &func) {
+    if (threads_.empty() || count < 2) {
+        for (uint32_t i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    // The indices are handed out one at a time, tasks that start late find less to do
+    std::atomic<uint32_t> next_index{0};
+    const auto run = [&next_index, &func, count]() {
+        for (uint32_t index = next_index.fetch_add(1, std::memory_order_relaxed); index < count;
+             index = next_index.fetch_add(1, std::memory_order_relaxed)) {
+            func(index);
+        }
+    };
+    TaskGroup group(this);
+    const uint32_t helper_count = std::min(count - 1, GetThreadCount());
+    for (uint32_t i = 0; i < helper_count; ++i) {
+        group.Run(run);
+    }
+    run();
+    group.Wait();
+}
+
+void WorkerPool::Push(Task &&task) {
+    const uint32_t own_queue = (thread_pool == this) ? thread_queue : GetThreadCount();
+    // Counted first, a thread that sees the count before the task can be taken only looks once more
+    queued_tasks_.fetch_add(1, std::memory_order_relaxed);
+    {
+        TaskQueue &queue = *queues_[own_queue];
+        std::lock_guard<std::mutex> guard(queue.lock);
+        queue.tasks.emplace_back(std::move(task));
+    }
+    // The lock orders the count before the wait predicates of the sleeping threads
+    bool wake_waiters = false;
+    {
+        std::lock_guard<std::mutex> guard(sleep_lock_);
+        wake_waiters = sleeping_waiters_ != 0;
+    }
+    work_cv_.notify_one();
+    if (wake_waiters) {
+        done_cv_.notify_all();
+    }
+}
+
+bool WorkerPool::RunQueuedTask(uint32_t own_queue) {
+    Task task;
+    bool found = false;
+    {
+        TaskQueue &queue = *queues_[own_queue];
+        std::lock_guard<std::mutex> guard(queue.lock);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            found = true;
+        }
+    }
+    const uint32_t queue_count = static_cast<uint32_t>(queues_.size());
+    for (uint32_t i = 1; !found && i < queue_count; ++i) {
+        TaskQueue &queue = *queues_[(own_queue + i) % queue_count];
+        std::lock_guard<std::mutex> guard(queue.lock);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            found = true;
+        }
+    }
+    if (!found) {
+        return false;
+    }
+    queued_tasks_.fetch_sub(1, std::memory_order_relaxed);
+
+    task.func();
+    // The group can be destroyed as soon as its count is 0, it is not touched afterwards
+    if (task.group->pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<std::mutex> guard(sleep_lock_);
+        done_cv_.notify_all();
+    }
+    return true;
+}
+
+void WorkerPool::WorkerLoop(uint32_t index) {
+    thread_pool = this;
+    thread_queue = index;
+    while (true) {
+        if (RunQueuedTask(index)) {
+            continue;
+        }
+        std::unique_lock<std::mutex> guard(sleep_lock_);
+        work_cv_.wait(guard, [this]() { return exit_ || queued_tasks_.load(std::memory_order_relaxed) != 0; });
+        if (exit_) {
+            return;
+        }
+    }
+}
+
+}  // namespace vvl
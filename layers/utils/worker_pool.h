@@ -0,0 +1,99 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vvl {
+
+// Fixed set of threads for splitting CPU heavy validation work (ex. submit time hazard detection) across cores.
+//
+// Every worker has its own task queue, tasks queued by a worker go to its own queue and the ones queued by other threads to
+// a shared one. Idle workers take the oldest task of the shared queue or of another worker, the newest tasks of a worker
+// stay with it while they are hot in its caches. A thread waiting for tasks runs queued ones meanwhile, so tasks can split
+// their own work further and any number of threads can use the pool at the same time.
+class WorkerPool {
+  public:
+    // With |pin_threads| worker i only runs on CPU i, modulo the CPU count (Linux and Windows only)
+    explicit WorkerPool(uint32_t thread_count, bool pin_threads = false);
+    ~WorkerPool();
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    // The pool of the whole layer, shared by the validation objects of every device. Created by the first call, the
+    // later ones get the same pool whatever their arguments. Destroyed with the last reference.
+    static std::shared_ptr<WorkerPool> GetShared(uint32_t thread_count, bool pin_threads);
+
+    uint32_t GetThreadCount() const { return static_cast<uint32_t>(threads_.size()); }
+
+    // Tasks that can run on any thread of the pool. Wait() returns once every task given to Run() has finished, the waiting
+    // thread runs queued tasks meanwhile. With a null pool or one without threads Run() runs the task right away.
+    class TaskGroup {
+      public:
+        explicit TaskGroup(WorkerPool *pool) : pool_((pool && !pool->threads_.empty()) ? pool : nullptr) {}
+        ~TaskGroup() { Wait(); }
+        TaskGroup(const TaskGroup &) = delete;
+        TaskGroup &operator=(const TaskGroup &) = delete;
+
+        void Run(std::function<void()> &&task);
+        void Wait();
+
+      private:
+        friend class WorkerPool;
+        WorkerPool *pool_;
+        std::atomic<uint32_t> pending_{0};
+    };
+
+    // Calls func(index) exactly once for each index in [0, count), in no particular order and from any thread
+    void ParallelFor(uint32_t count, const std::function<void(uint32_t)> &func);
+
+  private:
+    struct Task {
+        std::function<void()> func;
+        TaskGroup *group;
+    };
+    struct alignas(64) TaskQueue {
+        std::mutex lock;
+        std::deque<Task> tasks;
+    };
+
+    void Push(Task &&task);
+    // Runs one queued task, if there is one. queues_[own_queue] is looked at first, from the newest end.
+    bool RunQueuedTask(uint32_t own_queue);
+    void WorkerLoop(uint32_t index);
+
+    std::vector<std::thread> threads_;
+    // One per worker, the last one is for the tasks queued by the other threads
+    std::vector<std::unique_ptr<TaskQueue>> queues_;
+    std::atomic<uint32_t> queued_tasks_{0};
+
+    std::mutex sleep_lock_;
+    std::condition_variable work_cv_;  // idle workers
+    std::condition_variable done_cv_;  // threads in TaskGroup::Wait()
+    uint32_t sleeping_waiters_ = 0;
+    bool exit_ = false;
+};
+
+}  // namespace vvl
@@ -19,12 +19,14 @@
  **************************************************************************/
 #include "vk_layer_config.h"
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <iostream>
 #include <sstream>
 #include <string>
 #include <charconv>
+#include <vector>
 #include <sys/stat.h>
 
 #include <vulkan/vk_layer.h>
@@ -42,6 +44,12 @@
 #else
 #include <unistd.h>
 #define GetCurrentDir getcwd
+#if defined(__APPLE__)
+// environ is not available to shared libraries on Apple platforms
+#include <crt_externs.h>
+#else
+extern char **environ;
+#endif
 #endif
 
 using std::string;
@@ -53,6 +61,7 @@ class ConfigFile {
 
     const char *GetOption(const string &option);
     void SetOption(const string &option, const string &value);
+    string GetSettingsFileStamp();
     string vk_layer_disables_env_var;
     SettingsFileInfo settings_info{};
 
@@ -123,6 +132,47 @@ void SetEnvironment(const char *variable, const char *value) {
 #endif
 }
 
+std::string GetEnvironmentStamp(const char *prefix) {
+    std::vector<std::string> variables;
+    const size_t prefix_length = strlen(prefix);
+#if defined(_WIN32)
+    char *environment = GetEnvironmentStringsA();
+    if (environment) {
+        for (const char *variable = environment; *variable; variable += strlen(variable) + 1) {
+            if (strncmp(variable, prefix, prefix_length) == 0) {
+                variables.emplace_back(variable);
+            }
+        }
+        FreeEnvironmentStringsA(environment);
+    }
+#elif !defined(__ANDROID__)
+#if defined(__APPLE__)
+    char **environment = *_NSGetEnviron();
+#else
+    char **environment = environ;
+#endif
+    for (char **variable = environment; variable && *variable; ++variable) {
+        if (strncmp(*variable, prefix, prefix_length) == 0) {
+            variables.emplace_back(*variable);
+        }
+    }
+#endif
+    // The order of the environment block changes as variables are set, not the values read from it
+    std::sort(variables.begin(), variables.end());
+    std::string stamp;
+    for (const std::string &variable : variables) {
+        stamp += variable;
+        stamp += '\n';
+    }
+    return stamp;
+}
+
+std::string GetLayerSettingsFileStamp() {
+    // A local ConfigFile so that looking for the file does not change the settings_info of the one that was parsed
+    ConfigFile config;
+    return config.GetSettingsFileStamp();
+}
+
 const char *getLayerOption(const char *option) { return layer_config.GetOption(option); }
 
 const SettingsFileInfo *GetLayerSettingsFileInfo() { return &layer_config.settings_info; }
@@ -197,6 +247,7 @@ ConfigFile::ConfigFile() : file_is_parsed_(false) {
     value_map_["khronos_validation.debug_action"] = "VK_DBG_LAYER_ACTION_DEFAULT,VK_DBG_LAYER_ACTION_LOG_MSG";
 #endif  // WIN32
     value_map_["khronos_validation.log_filename"] = "stdout";
+    value_map_["khronos_validation.structured_log_filename"] = "vvl_log.bin";
     value_map_["khronos_validation.fine_grained_locking"] = "true";
 }
 
@@ -333,6 +384,16 @@ string ConfigFile::FindSettings() {
     return "vk_layer_settings.txt";
 }
 
+string ConfigFile::GetSettingsFileStamp() {
+    const string settings_file = FindSettings();
+    string stamp = settings_file + '\n' + settings_info.location + '\n';
+    struct stat info;
+    if (stat(settings_file.c_str(), &info) == 0) {
+        stamp += std::to_string(static_cast<long long>(info.st_size)) + ' ' + std::to_string(static_cast<long long>(info.st_mtime));
+    }
+    return stamp;
+}
+
 static inline std::string string_trim(const std::string &s) {
     const char *whitespace = " \t\f\v\n\r";
 
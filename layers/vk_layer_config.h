@@ -32,6 +32,13 @@
 
 std::string GetEnvironment(const char *variable);
 
+// All the environment variables starting with prefix, with their values, to know when settings read earlier are out of date.
+// Empty on Android where the settings come from system properties.
+std::string GetEnvironmentStamp(const char *prefix);
+
+// Location, size and modification time of the vk_layer_settings.txt file that would be used now
+std::string GetLayerSettingsFileStamp();
+
 // Not supported on Android
 void SetEnvironment(const char *variable, const char *value);
 
@@ -63,6 +70,7 @@ enum VkLayerDbgActionBits {
     VK_DBG_LAYER_ACTION_LOG_MSG = 0x00000002,
     VK_DBG_LAYER_ACTION_BREAK = 0x00000004,
     VK_DBG_LAYER_ACTION_DEBUG_OUTPUT = 0x00000008,
+    VK_DBG_LAYER_ACTION_LOG_STRUCTURED = 0x00000010,
     VK_DBG_LAYER_ACTION_DEFAULT = 0x40000000,
 };
 using VkLayerDbgActionFlags = VkFlags;
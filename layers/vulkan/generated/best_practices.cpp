@@ -729,6 +729,7 @@ void BestPractices::PostCallRecordBeginCommandBuffer(VkCommandBuffer commandBuff
 
 void BestPractices::PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, const RecordObject& record_obj) {
     ValidationStateTracker::PostCallRecordEndCommandBuffer(commandBuffer, record_obj);
+    ManualPostCallRecordEndCommandBuffer(commandBuffer, record_obj);
 
     if (record_obj.result < VK_SUCCESS) {
         LogErrorCode(record_obj);
@@ -45,6 +45,7 @@
 #include "vk_layer_config.h"
 #include "layer_options.h"
 #include "containers/custom_containers.h"
+#include "containers/slab_id_map.h"
 #include "error_message/logging.h"
 #include "error_message/error_location.h"
 #include "error_message/record_object.h"
@@ -54,6 +55,11 @@
 #include "vk_dispatch_table_helper.h"
 #include "vk_extension_helper.h"
 #include "gpu_validation/gpu_settings.h"
+#include "sync/sync_settings.h"
+#include "utils/call_profiler.h"
+#include "utils/trace_recorder.h"
+#include "utils/frame_sampler.h"
+#include "utils/worker_pool.h"
 
 extern std::atomic<uint64_t> global_unique_id;
 
@@ -84,13 +90,82 @@ struct CreateBuffer;
 namespace vvl {
 struct AllocateDescriptorSetsData;
 class Pipeline;
+class QueueRetirePool;
 }  // namespace vvl
 
 // Because of GPL, we currently create our Pipeline state objects before the PreCallValidate
 // Each chassis layer will need to track its own state
 using PipelineStates = std::vector<std::shared_ptr<vvl::Pipeline>>;
 
-extern vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+// Maps the unique IDs handed out to the application to the actual handles. Accesses are internally synchronized.
+// By default the IDs are hashed sequential numbers stored in a concurrent hash map. With the unique_handles_slab setting,
+// new IDs are slots of a vvl::SlabIdMap instead, so the lookup done for every handle of every call neither hashes nor locks.
+// Both kinds of IDs can be live at the same time, which keeps the setting safe to change between instances.
+class UniqueIdMapping {
+  public:
+    class FindResult {
+      public:
+        FindResult(bool found, uint64_t handle) : result_(found, handle) {}
+        bool operator==(const FindResult& other) const { return result_.first == other.result_.first; }
+        bool operator!=(const FindResult& other) const { return result_.first != other.result_.first; }
+        const std::pair<bool, uint64_t>* operator->() const { return &result_; }
+
+      private:
+        std::pair<bool, uint64_t> result_;
+    };
+
+    void UseSlabIds(bool use_slab_ids) { use_slab_ids_ = use_slab_ids; }
+
+    uint64_t Insert(uint64_t handle) {
+        if (use_slab_ids_) {
+            const uint64_t unique_id = slab_.Insert(handle);
+            if (unique_id != 0) return unique_id;
+            // Every slot is in use, fall back to the hash map
+        }
+        const uint64_t unique_id = HashedUint64::hash(global_unique_id++) & ~vvl::SlabIdMap::kIdTag;
+        hash_map_.insert_or_assign(unique_id, handle);
+        return unique_id;
+    }
+
+    // Writes the ids of handles[0, count) to unique_ids, the slab is locked once for the whole batch
+    void InsertBatch(const uint64_t* handles, uint32_t count, uint64_t* unique_ids) {
+        uint32_t inserted = use_slab_ids_ ? slab_.InsertBatch(handles, count, unique_ids) : 0;
+        for (; inserted < count; ++inserted) {
+            const uint64_t unique_id = HashedUint64::hash(global_unique_id++) & ~vvl::SlabIdMap::kIdTag;
+            hash_map_.insert_or_assign(unique_id, handles[inserted]);
+            unique_ids[inserted] = unique_id;
+        }
+    }
+
+    FindResult find(uint64_t unique_id) const {
+        if (vvl::SlabIdMap::IsSlabId(unique_id)) {
+            const auto handle = slab_.Find(unique_id);
+            return handle ? FindResult(true, *handle) : end();
+        }
+        auto iter = hash_map_.find(unique_id);
+        return iter != hash_map_.end() ? FindResult(true, iter->second) : end();
+    }
+
+    FindResult pop(uint64_t unique_id) {
+        if (vvl::SlabIdMap::IsSlabId(unique_id)) {
+            const auto handle = slab_.Pop(unique_id);
+            return handle ? FindResult(true, *handle) : end();
+        }
+        auto iter = hash_map_.pop(unique_id);
+        return iter != hash_map_.end() ? FindResult(true, iter->second) : end();
+    }
+
+    void erase(uint64_t unique_id) { pop(unique_id); }
+
+    FindResult end() const { return FindResult(false, 0); }
+
+  private:
+    bool use_slab_ids_ = false;
+    vvl::SlabIdMap slab_;
+    vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> hash_map_;
+};
+
+extern UniqueIdMapping unique_id_mapping;
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(VkInstance instance, const char* funcName);
 
@@ -2181,6 +2256,7 @@ enum LayerObjectTypeId {
     LayerObjectTypeSyncValidation,       // Instance or device synchronization validation layer object
     LayerObjectTypeMaxEnum,              // Max enum count
 };
+const char* LayerObjectTypeName(LayerObjectTypeId type_id);
 
 struct TemplateState {
     VkDescriptorUpdateTemplate desc_update_template;
@@ -2198,6 +2274,63 @@ enum class ValidValue {
     NoExtension,  // trying to use a proper value, but the extension is required
 };
 
+class ValidationObject;
+
+// Validation objects to call for each intercept id. The objects of all ids are stored back to back in one array, so
+// dispatching a call reads a single contiguous range instead of a separate allocation per intercepted function.
+class InterceptVectors {
+  public:
+    class Range {
+      public:
+        Range(ValidationObject* const* first, ValidationObject* const* last) : first_(first), last_(last) {}
+        ValidationObject* const* begin() const { return first_; }
+        ValidationObject* const* end() const { return last_; }
+        size_t size() const { return static_cast<size_t>(last_ - first_); }
+        bool empty() const { return first_ == last_; }
+
+      private:
+        ValidationObject* const* first_;
+        ValidationObject* const* last_;
+    };
+
+    Range operator[](size_t id) const { return Range(objects_.data() + offsets_[id], objects_.data() + offsets_[id + 1]); }
+
+    void Assign(const std::vector<std::vector<ValidationObject*>>& lists) {
+        objects_.clear();
+        offsets_.clear();
+        offsets_.reserve(lists.size() + 1);
+        offsets_.push_back(0);
+        for (const auto& list : lists) {
+            objects_.insert(objects_.end(), list.begin(), list.end());
+            offsets_.push_back(static_cast<uint32_t>(objects_.size()));
+        }
+    }
+
+    // Removes an object from the ranges of every intercept id
+    void Erase(const ValidationObject* object) {
+        uint32_t write = 0;
+        uint32_t read = 0;
+        for (size_t id = 0; id + 1 < offsets_.size(); ++id) {
+            const uint32_t end = offsets_[id + 1];
+            offsets_[id] = write;
+            for (; read < end; ++read) {
+                if (objects_[read] != object) {
+                    objects_[write++] = objects_[read];
+                }
+            }
+        }
+        if (!offsets_.empty()) {
+            offsets_.back() = write;
+        }
+        objects_.resize(write);
+    }
+
+  private:
+    std::vector<ValidationObject*> objects_;
+    // offsets_[id] to offsets_[id + 1] is the range of objects for an intercept id
+    std::vector<uint32_t> offsets_;
+};
+
 #if defined(__clang__)
 #define DECORATE_PRINTF(_fmt_argnum, _first_param_num) __attribute__((format(printf, _fmt_argnum, _first_param_num)))
 #elif defined(__GNUC__)
@@ -2215,7 +2348,10 @@ class ValidationObject {
         return debug_report->FormatHandle(std::forward<T>(h));
     }
 
-    std::vector<std::vector<ValidationObject*>> intercept_vectors;
+    InterceptVectors intercept_vectors;
+    // The intercept_vectors without the objects of the sampled validation in the PreCallValidate of the vkCmd* entry points, set
+    // when there is a frame_sampler
+    InterceptVectors unsampled_intercept_vectors;
 
     VkLayerInstanceDispatchTable instance_dispatch_table;
     VkLayerDispatchTable device_dispatch_table;
@@ -2227,6 +2363,27 @@ class ValidationObject {
     bool fine_grained_locking{true};
     GpuAVSettings gpuav_settings = {};
     DebugPrintfSettings printf_settings = {};
+    SyncValSettings syncval_settings = {};
+    std::string call_profile_file;
+    std::string trace_file;
+    // Threads of the pool shared by the queues of a device to retire submissions, 0 for one thread per queue
+    uint32_t queue_retire_threads = 0;
+    // Shader validation cache file of CoreChecks, empty for the default file in the temporary directory
+    std::string shader_validation_cache_path;
+    // Threads of CoreChecks validating the shaders of a call in parallel, 0 validates on the calling thread
+    uint32_t shader_validation_threads = 0;
+    // Threads of the pool shared by the validation objects of all the devices, 0 for no shared pool
+    uint32_t worker_threads = 0;
+    // Pins each thread of the shared pool to one CPU
+    bool worker_thread_affinity = false;
+    // Frames between the ones whose commands are validated by CoreChecks, BestPractices and SyncValidator, 0 or 1 for all
+    uint32_t frame_sampling_interval = 0;
+    // Microseconds of a sampled frame during which the commands are validated, 0 for all of them
+    uint32_t frame_sampling_time_budget = 0;
+    // Indexed by vvl::Func, the PreCallValidate of the set entries is left out of the intercept vectors of the device
+    std::vector<bool> skipped_validate_calls;
+    // Prints the statistics of the layer allocator at vkDestroyDevice and vkDestroyInstance
+    bool allocation_statistics = false;
 
     VkInstance instance = VK_NULL_HANDLE;
     VkPhysicalDevice physical_device = VK_NULL_HANDLE;
@@ -2255,6 +2412,44 @@ class ValidationObject {
     virtual ReadLockGuard ReadLock() const { return ReadLockGuard(validation_object_mutex); }
     virtual WriteLockGuard WriteLock() { return WriteLockGuard(validation_object_mutex); }
 
+    // Objects that do their own locking return deferred guards from ReadLock()/WriteLock(). That choice only depends on
+    // settings known at creation time, so it is resolved once and the chassis skips the virtual call for them afterwards.
+    bool object_lock_required = true;
+    void UpdateObjectLockRequired() { object_lock_required = WriteLock().owns_lock(); }
+    ReadLockGuard ReadLockIfRequired() const { return object_lock_required ? ReadLock() : ReadLockGuard(); }
+    WriteLockGuard WriteLockIfRequired() { return object_lock_required ? WriteLock() : WriteLockGuard(); }
+
+    // Shared by all the objects of a device, null unless the call_profile_file setting is set
+    std::shared_ptr<vvl::CallProfiler> call_profiler;
+    // Shared by all the instances and devices of the process, null unless the trace_file setting is set
+    std::shared_ptr<vvl::TraceRecorder> tracer;
+    struct CallScope {
+        vvl::CallProfiler::Scope profile;
+        vvl::TraceRecorder::Span span;
+    };
+    CallScope ProfileCall(vvl::CallProfiler::Phase phase, vvl::Func function) const {
+        return {call_profiler ? call_profiler->Begin(container_type, function, phase) : vvl::CallProfiler::Scope(),
+                tracer ? tracer->Begin(LayerObjectTypeName(container_type), vvl::String(function),
+                                       vvl::CallProfiler::PhaseName(phase))
+                       : vvl::TraceRecorder::Span()};
+    }
+    // For the work done outside of the API calls, ex. retiring submissions or post processing GPU results
+    vvl::TraceRecorder::Span TraceSpan(const char* category, const char* name) const {
+        return tracer ? tracer->Begin(category, name) : vvl::TraceRecorder::Span();
+    }
+    // Null unless the worker_threads setting is set. The features splitting their work across threads use it instead of
+    // their own threads, the messages of the tasks can be put back in order with DebugReport::OrderedMessages.
+    std::shared_ptr<vvl::WorkerPool> worker_pool;
+    // Null unless the queue_retire_threads setting is set. One per device, the state trackers of all the objects of the
+    // device retire their queues on the same threads.
+    std::shared_ptr<vvl::QueueRetirePool> queue_retire_pool;
+    // Null unless the frame_sampling_interval or frame_sampling_time_budget setting is set, only on the device dispatch object
+    std::shared_ptr<vvl::FrameSampler> frame_sampler;
+    // What the vkCmd* entry points use in place of intercept_vectors for their PreCallValidate
+    InterceptVectors::Range CommandValidateIntercepts(size_t id) const {
+        return (frame_sampler && !frame_sampler->Sampled()) ? unsampled_intercept_vectors[id] : intercept_vectors[id];
+    }
+
     // If the Record phase calls a function that blocks, we might need to release
     // the lock that protects Record itself in order to avoid mutual waiting.
     static thread_local WriteLockGuard* record_guard;
@@ -2272,7 +2467,7 @@ class ValidationObject {
             // reference only one frame of the callstack.
             assert(validation_object->record_guard == nullptr);
 
-            lock = validation_object->WriteLock();
+            lock = validation_object->WriteLockIfRequired();
 
             // Initialize record_guard only when Record is actually protected by the
             // mutex. It's not the case when fine grained locking is enabled.
@@ -2363,6 +2558,22 @@ class ValidationObject {
         return result;
     }
 
+    // The message text is only built by |formatter| once the message is known to be delivered, for messages costly to format
+    bool LogError(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc,
+                  const MessageFormatter& formatter) const {
+        return debug_report->LogMsg(kErrorBit, objlist, &loc, vuid_text, formatter);
+    }
+
+    bool LogWarning(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc,
+                    const MessageFormatter& formatter) const {
+        return debug_report->LogMsg(kWarningBit, objlist, &loc, vuid_text, formatter);
+    }
+
+    bool LogPerformanceWarning(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc,
+                               const MessageFormatter& formatter) const {
+        return debug_report->LogMsg(kPerformanceWarningBit, objlist, &loc, vuid_text, formatter);
+    }
+
     void LogInternalError(std::string_view failure_location, const LogObjectList& obj_list, const Location& loc,
                           std::string_view entrypoint, VkResult err) const {
         const std::string_view err_string = string_VkResult(err);
@@ -2402,13 +2613,31 @@ class ValidationObject {
     template <typename HandleType>
     HandleType WrapNew(HandleType new_created_handle) {
         if (new_created_handle == (HandleType)VK_NULL_HANDLE) return new_created_handle;
-        auto unique_id = global_unique_id++;
-        unique_id = HashedUint64::hash(unique_id);
+        const uint64_t unique_id = unique_id_mapping.Insert(CastToUint64(new_created_handle));
         assert(unique_id != 0);  // can't be 0, otherwise unwrap will apply special rule for VK_NULL_HANDLE
-        unique_id_mapping.insert_or_assign(unique_id, CastToUint64(new_created_handle));
         return (HandleType)unique_id;
     }
 
+    // Wrap an array of newly created handles in place, for the calls that create many objects at once.
+    template <typename HandleType>
+    void WrapNewArray(HandleType* new_created_handles, uint32_t count) {
+        small_vector<uint64_t, 32> handles;
+        handles.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            if (new_created_handles[i] != (HandleType)VK_NULL_HANDLE) {
+                handles.emplace_back(CastToUint64(new_created_handles[i]));
+            }
+        }
+        small_vector<uint64_t, 32> unique_ids(handles.size());
+        unique_id_mapping.InsertBatch(handles.data(), static_cast<uint32_t>(handles.size()), unique_ids.data());
+        uint32_t id_index = 0;
+        for (uint32_t i = 0; i < count; ++i) {
+            if (new_created_handles[i] != (HandleType)VK_NULL_HANDLE) {
+                new_created_handles[i] = (HandleType)unique_ids[id_index++];
+            }
+        }
+    }
+
     // VkDisplayKHR objects are statically created in the driver at VkCreateInstance.
     // They live with the PhyiscalDevice and apps never created/destroy them.
     // Apps needs will query for them and the first time we see it we wrap it
@@ -1711,6 +1711,8 @@ typedef enum InterceptId {
 
 // clang-format off
 void ValidationObject::InitObjectDispatchVectors() {
+    std::vector<std::vector<ValidationObject*>> intercept_lists(InterceptIdCount);
+    std::vector<InterceptId> command_validate_ids;
 
 #define BUILD_DISPATCH_VECTOR(name) \
     init_object_dispatch_vector(InterceptId ## name, \
@@ -1724,18 +1726,29 @@ void ValidationObject::InitObjectDispatchVectors() {
                                 typeid(&debug_printf::Validator::name), \
                                 typeid(&SyncValidator::name));
 
-    auto init_object_dispatch_vector = [this](InterceptId id,
-                                              const std::type_info& vo_typeid,
-                                              const std::type_info& tt_typeid,
-                                              const std::type_info& tpv_typeid,
-                                              const std::type_info& tot_typeid,
-                                              const std::type_info& tcv_typeid,
-                                              const std::type_info& tbp_typeid,
-                                              const std::type_info& tga_typeid,
-                                              const std::type_info& tdp_typeid,
-                                              const std::type_info& tsv_typeid) {
+// Entry points listed by the skip_validate_entry_points setting are left with no PreCallValidate objects
+#define BUILD_VALIDATE_DISPATCH_VECTOR(name) \
+    if (skipped_validate_calls.empty() || !skipped_validate_calls[static_cast<uint32_t>(vvl::Func::vk ## name)]) { \
+        BUILD_DISPATCH_VECTOR(PreCallValidate ## name); \
+    }
+
+// The PreCallValidate of the recording commands, which are left out of the unsampled_intercept_vectors
+#define BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(name) \
+    BUILD_VALIDATE_DISPATCH_VECTOR(name); \
+    command_validate_ids.push_back(InterceptIdPreCallValidate ## name);
+
+    auto init_object_dispatch_vector = [this, &intercept_lists](InterceptId id,
+                                                                const std::type_info& vo_typeid,
+                                                                const std::type_info& tt_typeid,
+                                                                const std::type_info& tpv_typeid,
+                                                                const std::type_info& tot_typeid,
+                                                                const std::type_info& tcv_typeid,
+                                                                const std::type_info& tbp_typeid,
+                                                                const std::type_info& tga_typeid,
+                                                                const std::type_info& tdp_typeid,
+                                                                const std::type_info& tsv_typeid) {
         for (auto item : this->object_dispatch) {
-            auto intercept_vector = &this->intercept_vectors[id];
+            auto intercept_vector = &intercept_lists[id];
             switch (item->container_type) {
             case LayerObjectTypeThreading:
                 if (tt_typeid != vo_typeid) intercept_vector->push_back(item);
@@ -1771,1701 +1784,1717 @@ void ValidationObject::InitObjectDispatchVectors() {
         }
     };
     // clang-format on
-
-    intercept_vectors.resize(InterceptIdCount);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceQueue);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeviceQueue);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceQueue);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceQueue);
-    BUILD_DISPATCH_VECTOR(PreCallValidateQueueSubmit);
+    BUILD_VALIDATE_DISPATCH_VECTOR(QueueSubmit);
     BUILD_DISPATCH_VECTOR(PreCallRecordQueueSubmit);
     BUILD_DISPATCH_VECTOR(PostCallRecordQueueSubmit);
-    BUILD_DISPATCH_VECTOR(PreCallValidateQueueWaitIdle);
+    BUILD_VALIDATE_DISPATCH_VECTOR(QueueWaitIdle);
     BUILD_DISPATCH_VECTOR(PreCallRecordQueueWaitIdle);
     BUILD_DISPATCH_VECTOR(PostCallRecordQueueWaitIdle);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDeviceWaitIdle);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DeviceWaitIdle);
     BUILD_DISPATCH_VECTOR(PreCallRecordDeviceWaitIdle);
     BUILD_DISPATCH_VECTOR(PostCallRecordDeviceWaitIdle);
-    BUILD_DISPATCH_VECTOR(PreCallValidateAllocateMemory);
+    BUILD_VALIDATE_DISPATCH_VECTOR(AllocateMemory);
     BUILD_DISPATCH_VECTOR(PreCallRecordAllocateMemory);
     BUILD_DISPATCH_VECTOR(PostCallRecordAllocateMemory);
-    BUILD_DISPATCH_VECTOR(PreCallValidateFreeMemory);
+    BUILD_VALIDATE_DISPATCH_VECTOR(FreeMemory);
     BUILD_DISPATCH_VECTOR(PreCallRecordFreeMemory);
     BUILD_DISPATCH_VECTOR(PostCallRecordFreeMemory);
-    BUILD_DISPATCH_VECTOR(PreCallValidateMapMemory);
+    BUILD_VALIDATE_DISPATCH_VECTOR(MapMemory);
     BUILD_DISPATCH_VECTOR(PreCallRecordMapMemory);
     BUILD_DISPATCH_VECTOR(PostCallRecordMapMemory);
-    BUILD_DISPATCH_VECTOR(PreCallValidateUnmapMemory);
+    BUILD_VALIDATE_DISPATCH_VECTOR(UnmapMemory);
     BUILD_DISPATCH_VECTOR(PreCallRecordUnmapMemory);
     BUILD_DISPATCH_VECTOR(PostCallRecordUnmapMemory);
-    BUILD_DISPATCH_VECTOR(PreCallValidateFlushMappedMemoryRanges);
+    BUILD_VALIDATE_DISPATCH_VECTOR(FlushMappedMemoryRanges);
     BUILD_DISPATCH_VECTOR(PreCallRecordFlushMappedMemoryRanges);
     BUILD_DISPATCH_VECTOR(PostCallRecordFlushMappedMemoryRanges);
-    BUILD_DISPATCH_VECTOR(PreCallValidateInvalidateMappedMemoryRanges);
+    BUILD_VALIDATE_DISPATCH_VECTOR(InvalidateMappedMemoryRanges);
     BUILD_DISPATCH_VECTOR(PreCallRecordInvalidateMappedMemoryRanges);
     BUILD_DISPATCH_VECTOR(PostCallRecordInvalidateMappedMemoryRanges);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceMemoryCommitment);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeviceMemoryCommitment);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceMemoryCommitment);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceMemoryCommitment);
-    BUILD_DISPATCH_VECTOR(PreCallValidateBindBufferMemory);
+    BUILD_VALIDATE_DISPATCH_VECTOR(BindBufferMemory);
     BUILD_DISPATCH_VECTOR(PreCallRecordBindBufferMemory);
     BUILD_DISPATCH_VECTOR(PostCallRecordBindBufferMemory);
-    BUILD_DISPATCH_VECTOR(PreCallValidateBindImageMemory);
+    BUILD_VALIDATE_DISPATCH_VECTOR(BindImageMemory);
     BUILD_DISPATCH_VECTOR(PreCallRecordBindImageMemory);
     BUILD_DISPATCH_VECTOR(PostCallRecordBindImageMemory);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferMemoryRequirements);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetBufferMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferMemoryRequirements);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageMemoryRequirements);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetImageMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageMemoryRequirements);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageSparseMemoryRequirements);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetImageSparseMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageSparseMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageSparseMemoryRequirements);
-    BUILD_DISPATCH_VECTOR(PreCallValidateQueueBindSparse);
+    BUILD_VALIDATE_DISPATCH_VECTOR(QueueBindSparse);
     BUILD_DISPATCH_VECTOR(PreCallRecordQueueBindSparse);
     BUILD_DISPATCH_VECTOR(PostCallRecordQueueBindSparse);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateFence);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateFence);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateFence);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateFence);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyFence);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyFence);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyFence);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyFence);
-    BUILD_DISPATCH_VECTOR(PreCallValidateResetFences);
+    BUILD_VALIDATE_DISPATCH_VECTOR(ResetFences);
     BUILD_DISPATCH_VECTOR(PreCallRecordResetFences);
     BUILD_DISPATCH_VECTOR(PostCallRecordResetFences);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetFenceStatus);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetFenceStatus);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetFenceStatus);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetFenceStatus);
-    BUILD_DISPATCH_VECTOR(PreCallValidateWaitForFences);
+    BUILD_VALIDATE_DISPATCH_VECTOR(WaitForFences);
     BUILD_DISPATCH_VECTOR(PreCallRecordWaitForFences);
     BUILD_DISPATCH_VECTOR(PostCallRecordWaitForFences);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateSemaphore);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateSemaphore);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateSemaphore);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateSemaphore);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroySemaphore);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroySemaphore);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroySemaphore);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroySemaphore);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateEvent);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateEvent);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateEvent);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateEvent);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyEvent);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyEvent);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyEvent);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyEvent);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetEventStatus);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetEventStatus);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetEventStatus);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetEventStatus);
-    BUILD_DISPATCH_VECTOR(PreCallValidateSetEvent);
+    BUILD_VALIDATE_DISPATCH_VECTOR(SetEvent);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetEvent);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetEvent);
-    BUILD_DISPATCH_VECTOR(PreCallValidateResetEvent);
+    BUILD_VALIDATE_DISPATCH_VECTOR(ResetEvent);
     BUILD_DISPATCH_VECTOR(PreCallRecordResetEvent);
     BUILD_DISPATCH_VECTOR(PostCallRecordResetEvent);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateQueryPool);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateQueryPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateQueryPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateQueryPool);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyQueryPool);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyQueryPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyQueryPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyQueryPool);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetQueryPoolResults);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetQueryPoolResults);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetQueryPoolResults);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetQueryPoolResults);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateBuffer);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateBuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateBuffer);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyBuffer);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyBuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyBuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyBuffer);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateBufferView);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateBufferView);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateBufferView);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateBufferView);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyBufferView);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyBufferView);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyBufferView);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyBufferView);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateImage);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateImage);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateImage);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateImage);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyImage);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyImage);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyImage);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyImage);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageSubresourceLayout);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetImageSubresourceLayout);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageSubresourceLayout);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageSubresourceLayout);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateImageView);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateImageView);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateImageView);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateImageView);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyImageView);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyImageView);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyImageView);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyImageView);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyShaderModule);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyShaderModule);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyShaderModule);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyShaderModule);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreatePipelineCache);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreatePipelineCache);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreatePipelineCache);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreatePipelineCache);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyPipelineCache);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyPipelineCache);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyPipelineCache);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyPipelineCache);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelineCacheData);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetPipelineCacheData);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelineCacheData);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelineCacheData);
-    BUILD_DISPATCH_VECTOR(PreCallValidateMergePipelineCaches);
+    BUILD_VALIDATE_DISPATCH_VECTOR(MergePipelineCaches);
     BUILD_DISPATCH_VECTOR(PreCallRecordMergePipelineCaches);
     BUILD_DISPATCH_VECTOR(PostCallRecordMergePipelineCaches);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyPipeline);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyPipeline);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyPipeline);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyPipeline);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreatePipelineLayout);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreatePipelineLayout);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreatePipelineLayout);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyPipelineLayout);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyPipelineLayout);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyPipelineLayout);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyPipelineLayout);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateSampler);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateSampler);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateSampler);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateSampler);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroySampler);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroySampler);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroySampler);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroySampler);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateDescriptorSetLayout);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateDescriptorSetLayout);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateDescriptorSetLayout);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateDescriptorSetLayout);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDescriptorSetLayout);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyDescriptorSetLayout);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDescriptorSetLayout);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDescriptorSetLayout);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateDescriptorPool);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateDescriptorPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateDescriptorPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateDescriptorPool);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDescriptorPool);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyDescriptorPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDescriptorPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDescriptorPool);
-    BUILD_DISPATCH_VECTOR(PreCallValidateResetDescriptorPool);
+    BUILD_VALIDATE_DISPATCH_VECTOR(ResetDescriptorPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordResetDescriptorPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordResetDescriptorPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordAllocateDescriptorSets);
-    BUILD_DISPATCH_VECTOR(PreCallValidateFreeDescriptorSets);
+    BUILD_VALIDATE_DISPATCH_VECTOR(FreeDescriptorSets);
     BUILD_DISPATCH_VECTOR(PreCallRecordFreeDescriptorSets);
     BUILD_DISPATCH_VECTOR(PostCallRecordFreeDescriptorSets);
-    BUILD_DISPATCH_VECTOR(PreCallValidateUpdateDescriptorSets);
+    BUILD_VALIDATE_DISPATCH_VECTOR(UpdateDescriptorSets);
     BUILD_DISPATCH_VECTOR(PreCallRecordUpdateDescriptorSets);
     BUILD_DISPATCH_VECTOR(PostCallRecordUpdateDescriptorSets);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateFramebuffer);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateFramebuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateFramebuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateFramebuffer);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyFramebuffer);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyFramebuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyFramebuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyFramebuffer);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateRenderPass);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateRenderPass);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateRenderPass);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateRenderPass);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyRenderPass);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyRenderPass);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyRenderPass);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyRenderPass);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetRenderAreaGranularity);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetRenderAreaGranularity);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetRenderAreaGranularity);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetRenderAreaGranularity);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateCommandPool);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateCommandPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateCommandPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateCommandPool);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyCommandPool);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyCommandPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyCommandPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyCommandPool);
-    BUILD_DISPATCH_VECTOR(PreCallValidateResetCommandPool);
+    BUILD_VALIDATE_DISPATCH_VECTOR(ResetCommandPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordResetCommandPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordResetCommandPool);
-    BUILD_DISPATCH_VECTOR(PreCallValidateAllocateCommandBuffers);
+    BUILD_VALIDATE_DISPATCH_VECTOR(AllocateCommandBuffers);
     BUILD_DISPATCH_VECTOR(PreCallRecordAllocateCommandBuffers);
     BUILD_DISPATCH_VECTOR(PostCallRecordAllocateCommandBuffers);
-    BUILD_DISPATCH_VECTOR(PreCallValidateFreeCommandBuffers);
+    BUILD_VALIDATE_DISPATCH_VECTOR(FreeCommandBuffers);
     BUILD_DISPATCH_VECTOR(PreCallRecordFreeCommandBuffers);
     BUILD_DISPATCH_VECTOR(PostCallRecordFreeCommandBuffers);
-    BUILD_DISPATCH_VECTOR(PreCallValidateBeginCommandBuffer);
+    BUILD_VALIDATE_DISPATCH_VECTOR(BeginCommandBuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordBeginCommandBuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordBeginCommandBuffer);
-    BUILD_DISPATCH_VECTOR(PreCallValidateEndCommandBuffer);
+    BUILD_VALIDATE_DISPATCH_VECTOR(EndCommandBuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordEndCommandBuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordEndCommandBuffer);
-    BUILD_DISPATCH_VECTOR(PreCallValidateResetCommandBuffer);
+    BUILD_VALIDATE_DISPATCH_VECTOR(ResetCommandBuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordResetCommandBuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordResetCommandBuffer);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindPipeline);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBindPipeline);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindPipeline);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindPipeline);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewport);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetViewport);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewport);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewport);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetScissor);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetScissor);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetScissor);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetScissor);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetLineWidth);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetLineWidth);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetLineWidth);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetLineWidth);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthBias);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDepthBias);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthBias);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthBias);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetBlendConstants);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetBlendConstants);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetBlendConstants);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetBlendConstants);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthBounds);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDepthBounds);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthBounds);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthBounds);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilCompareMask);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetStencilCompareMask);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilCompareMask);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilCompareMask);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilWriteMask);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetStencilWriteMask);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilWriteMask);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilWriteMask);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilReference);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetStencilReference);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilReference);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilReference);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindDescriptorSets);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBindDescriptorSets);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindDescriptorSets);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindDescriptorSets);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindIndexBuffer);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBindIndexBuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindIndexBuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindIndexBuffer);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindVertexBuffers);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBindVertexBuffers);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindVertexBuffers);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindVertexBuffers);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDraw);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDraw);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDraw);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDraw);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndexed);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDrawIndexed);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndexed);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndexed);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndirect);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDrawIndirect);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndirect);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndirect);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndexedIndirect);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDrawIndexedIndirect);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndexedIndirect);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndexedIndirect);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatch);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDispatch);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatch);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatch);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatchIndirect);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDispatchIndirect);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatchIndirect);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatchIndirect);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyBuffer);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyBuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyBuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyBuffer);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyImage);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyImage);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyImage);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyImage);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBlitImage);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBlitImage);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBlitImage);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBlitImage);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyBufferToImage);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyBufferToImage);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyBufferToImage);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyBufferToImage);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyImageToBuffer);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyImageToBuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyImageToBuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyImageToBuffer);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdUpdateBuffer);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdUpdateBuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdUpdateBuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdUpdateBuffer);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdFillBuffer);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdFillBuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdFillBuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdFillBuffer);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdClearColorImage);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdClearColorImage);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdClearColorImage);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdClearColorImage);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdClearDepthStencilImage);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdClearDepthStencilImage);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdClearDepthStencilImage);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdClearDepthStencilImage);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdClearAttachments);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdClearAttachments);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdClearAttachments);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdClearAttachments);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdResolveImage);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdResolveImage);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdResolveImage);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdResolveImage);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetEvent);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetEvent);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetEvent);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetEvent);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdResetEvent);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdResetEvent);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdResetEvent);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdResetEvent);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdWaitEvents);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdWaitEvents);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWaitEvents);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWaitEvents);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdPipelineBarrier);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdPipelineBarrier);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdPipelineBarrier);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdPipelineBarrier);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginQuery);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBeginQuery);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginQuery);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginQuery);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndQuery);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdEndQuery);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndQuery);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndQuery);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdResetQueryPool);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdResetQueryPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdResetQueryPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdResetQueryPool);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteTimestamp);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdWriteTimestamp);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteTimestamp);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteTimestamp);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyQueryPoolResults);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyQueryPoolResults);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyQueryPoolResults);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyQueryPoolResults);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdPushConstants);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdPushConstants);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdPushConstants);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdPushConstants);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginRenderPass);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBeginRenderPass);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginRenderPass);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginRenderPass);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdNextSubpass);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdNextSubpass);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdNextSubpass);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdNextSubpass);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndRenderPass);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdEndRenderPass);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndRenderPass);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndRenderPass);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdExecuteCommands);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdExecuteCommands);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdExecuteCommands);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdExecuteCommands);
-    BUILD_DISPATCH_VECTOR(PreCallValidateBindBufferMemory2);
+    BUILD_VALIDATE_DISPATCH_VECTOR(BindBufferMemory2);
     BUILD_DISPATCH_VECTOR(PreCallRecordBindBufferMemory2);
     BUILD_DISPATCH_VECTOR(PostCallRecordBindBufferMemory2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateBindImageMemory2);
+    BUILD_VALIDATE_DISPATCH_VECTOR(BindImageMemory2);
     BUILD_DISPATCH_VECTOR(PreCallRecordBindImageMemory2);
     BUILD_DISPATCH_VECTOR(PostCallRecordBindImageMemory2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceGroupPeerMemoryFeatures);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeviceGroupPeerMemoryFeatures);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceGroupPeerMemoryFeatures);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceGroupPeerMemoryFeatures);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDeviceMask);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDeviceMask);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDeviceMask);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDeviceMask);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatchBase);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDispatchBase);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatchBase);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatchBase);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageMemoryRequirements2);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetImageMemoryRequirements2);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageMemoryRequirements2);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageMemoryRequirements2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferMemoryRequirements2);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetBufferMemoryRequirements2);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferMemoryRequirements2);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferMemoryRequirements2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageSparseMemoryRequirements2);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetImageSparseMemoryRequirements2);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageSparseMemoryRequirements2);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageSparseMemoryRequirements2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateTrimCommandPool);
+    BUILD_VALIDATE_DISPATCH_VECTOR(TrimCommandPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordTrimCommandPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordTrimCommandPool);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceQueue2);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeviceQueue2);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceQueue2);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceQueue2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateSamplerYcbcrConversion);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateSamplerYcbcrConversion);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateSamplerYcbcrConversion);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateSamplerYcbcrConversion);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroySamplerYcbcrConversion);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroySamplerYcbcrConversion);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroySamplerYcbcrConversion);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroySamplerYcbcrConversion);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateDescriptorUpdateTemplate);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateDescriptorUpdateTemplate);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateDescriptorUpdateTemplate);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateDescriptorUpdateTemplate);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDescriptorUpdateTemplate);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyDescriptorUpdateTemplate);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDescriptorUpdateTemplate);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDescriptorUpdateTemplate);
-    BUILD_DISPATCH_VECTOR(PreCallValidateUpdateDescriptorSetWithTemplate);
+    BUILD_VALIDATE_DISPATCH_VECTOR(UpdateDescriptorSetWithTemplate);
     BUILD_DISPATCH_VECTOR(PreCallRecordUpdateDescriptorSetWithTemplate);
     BUILD_DISPATCH_VECTOR(PostCallRecordUpdateDescriptorSetWithTemplate);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDescriptorSetLayoutSupport);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDescriptorSetLayoutSupport);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDescriptorSetLayoutSupport);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDescriptorSetLayoutSupport);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndirectCount);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDrawIndirectCount);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndirectCount);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndirectCount);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndexedIndirectCount);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDrawIndexedIndirectCount);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndexedIndirectCount);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndexedIndirectCount);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateRenderPass2);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateRenderPass2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateRenderPass2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateRenderPass2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginRenderPass2);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBeginRenderPass2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginRenderPass2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginRenderPass2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdNextSubpass2);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdNextSubpass2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdNextSubpass2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdNextSubpass2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndRenderPass2);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdEndRenderPass2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndRenderPass2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndRenderPass2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateResetQueryPool);
+    BUILD_VALIDATE_DISPATCH_VECTOR(ResetQueryPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordResetQueryPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordResetQueryPool);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetSemaphoreCounterValue);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetSemaphoreCounterValue);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetSemaphoreCounterValue);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetSemaphoreCounterValue);
-    BUILD_DISPATCH_VECTOR(PreCallValidateWaitSemaphores);
+    BUILD_VALIDATE_DISPATCH_VECTOR(WaitSemaphores);
     BUILD_DISPATCH_VECTOR(PreCallRecordWaitSemaphores);
     BUILD_DISPATCH_VECTOR(PostCallRecordWaitSemaphores);
-    BUILD_DISPATCH_VECTOR(PreCallValidateSignalSemaphore);
+    BUILD_VALIDATE_DISPATCH_VECTOR(SignalSemaphore);
     BUILD_DISPATCH_VECTOR(PreCallRecordSignalSemaphore);
     BUILD_DISPATCH_VECTOR(PostCallRecordSignalSemaphore);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferDeviceAddress);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetBufferDeviceAddress);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferDeviceAddress);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferDeviceAddress);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferOpaqueCaptureAddress);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetBufferOpaqueCaptureAddress);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferOpaqueCaptureAddress);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferOpaqueCaptureAddress);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceMemoryOpaqueCaptureAddress);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeviceMemoryOpaqueCaptureAddress);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceMemoryOpaqueCaptureAddress);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceMemoryOpaqueCaptureAddress);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreatePrivateDataSlot);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreatePrivateDataSlot);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreatePrivateDataSlot);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreatePrivateDataSlot);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyPrivateDataSlot);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyPrivateDataSlot);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyPrivateDataSlot);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyPrivateDataSlot);
-    BUILD_DISPATCH_VECTOR(PreCallValidateSetPrivateData);
+    BUILD_VALIDATE_DISPATCH_VECTOR(SetPrivateData);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetPrivateData);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetPrivateData);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetPrivateData);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetPrivateData);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPrivateData);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPrivateData);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetEvent2);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetEvent2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetEvent2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetEvent2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdResetEvent2);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdResetEvent2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdResetEvent2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdResetEvent2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdWaitEvents2);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdWaitEvents2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWaitEvents2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWaitEvents2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdPipelineBarrier2);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdPipelineBarrier2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdPipelineBarrier2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdPipelineBarrier2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteTimestamp2);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdWriteTimestamp2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteTimestamp2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteTimestamp2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateQueueSubmit2);
+    BUILD_VALIDATE_DISPATCH_VECTOR(QueueSubmit2);
     BUILD_DISPATCH_VECTOR(PreCallRecordQueueSubmit2);
     BUILD_DISPATCH_VECTOR(PostCallRecordQueueSubmit2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyBuffer2);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyBuffer2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyBuffer2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyBuffer2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyImage2);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyImage2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyImage2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyImage2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyBufferToImage2);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyBufferToImage2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyBufferToImage2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyBufferToImage2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyImageToBuffer2);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyImageToBuffer2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyImageToBuffer2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyImageToBuffer2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBlitImage2);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBlitImage2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBlitImage2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBlitImage2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdResolveImage2);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdResolveImage2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdResolveImage2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdResolveImage2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginRendering);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBeginRendering);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginRendering);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginRendering);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndRendering);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdEndRendering);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndRendering);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndRendering);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCullMode);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetCullMode);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCullMode);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCullMode);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetFrontFace);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetFrontFace);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetFrontFace);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetFrontFace);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPrimitiveTopology);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetPrimitiveTopology);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPrimitiveTopology);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPrimitiveTopology);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewportWithCount);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetViewportWithCount);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewportWithCount);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewportWithCount);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetScissorWithCount);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetScissorWithCount);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetScissorWithCount);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetScissorWithCount);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindVertexBuffers2);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBindVertexBuffers2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindVertexBuffers2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindVertexBuffers2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthTestEnable);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDepthTestEnable);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthTestEnable);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthTestEnable);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthWriteEnable);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDepthWriteEnable);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthWriteEnable);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthWriteEnable);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthCompareOp);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDepthCompareOp);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthCompareOp);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthCompareOp);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthBoundsTestEnable);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDepthBoundsTestEnable);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthBoundsTestEnable);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthBoundsTestEnable);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilTestEnable);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetStencilTestEnable);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilTestEnable);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilTestEnable);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilOp);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetStencilOp);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilOp);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilOp);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetRasterizerDiscardEnable);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetRasterizerDiscardEnable);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetRasterizerDiscardEnable);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetRasterizerDiscardEnable);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthBiasEnable);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDepthBiasEnable);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthBiasEnable);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthBiasEnable);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPrimitiveRestartEnable);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetPrimitiveRestartEnable);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPrimitiveRestartEnable);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPrimitiveRestartEnable);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceBufferMemoryRequirements);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeviceBufferMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceBufferMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceBufferMemoryRequirements);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceImageMemoryRequirements);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeviceImageMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceImageMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceImageMemoryRequirements);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceImageSparseMemoryRequirements);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeviceImageSparseMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceImageSparseMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceImageSparseMemoryRequirements);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateSwapchainKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateSwapchainKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateSwapchainKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateSwapchainKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroySwapchainKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroySwapchainKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroySwapchainKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroySwapchainKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetSwapchainImagesKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetSwapchainImagesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetSwapchainImagesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetSwapchainImagesKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateAcquireNextImageKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(AcquireNextImageKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordAcquireNextImageKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordAcquireNextImageKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateQueuePresentKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(QueuePresentKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordQueuePresentKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordQueuePresentKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceGroupPresentCapabilitiesKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeviceGroupPresentCapabilitiesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceGroupPresentCapabilitiesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceGroupPresentCapabilitiesKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceGroupSurfacePresentModesKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeviceGroupSurfacePresentModesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceGroupSurfacePresentModesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceGroupSurfacePresentModesKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateAcquireNextImage2KHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(AcquireNextImage2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordAcquireNextImage2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordAcquireNextImage2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateSharedSwapchainsKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateSharedSwapchainsKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateSharedSwapchainsKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateSharedSwapchainsKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateVideoSessionKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateVideoSessionKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateVideoSessionKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateVideoSessionKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyVideoSessionKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyVideoSessionKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyVideoSessionKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyVideoSessionKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetVideoSessionMemoryRequirementsKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetVideoSessionMemoryRequirementsKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetVideoSessionMemoryRequirementsKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetVideoSessionMemoryRequirementsKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateBindVideoSessionMemoryKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(BindVideoSessionMemoryKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordBindVideoSessionMemoryKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordBindVideoSessionMemoryKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateVideoSessionParametersKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateVideoSessionParametersKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateVideoSessionParametersKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateVideoSessionParametersKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateUpdateVideoSessionParametersKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(UpdateVideoSessionParametersKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordUpdateVideoSessionParametersKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordUpdateVideoSessionParametersKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyVideoSessionParametersKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyVideoSessionParametersKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyVideoSessionParametersKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyVideoSessionParametersKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginVideoCodingKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBeginVideoCodingKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginVideoCodingKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginVideoCodingKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndVideoCodingKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdEndVideoCodingKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndVideoCodingKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndVideoCodingKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdControlVideoCodingKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdControlVideoCodingKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdControlVideoCodingKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdControlVideoCodingKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDecodeVideoKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDecodeVideoKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDecodeVideoKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDecodeVideoKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginRenderingKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBeginRenderingKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginRenderingKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginRenderingKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndRenderingKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdEndRenderingKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndRenderingKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndRenderingKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeviceGroupPeerMemoryFeaturesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDeviceMaskKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDeviceMaskKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDeviceMaskKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDeviceMaskKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatchBaseKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDispatchBaseKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatchBaseKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatchBaseKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateTrimCommandPoolKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(TrimCommandPoolKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordTrimCommandPoolKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordTrimCommandPoolKHR);
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryWin32HandleKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetMemoryWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryWin32HandleKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryWin32HandlePropertiesKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetMemoryWin32HandlePropertiesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryWin32HandlePropertiesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryWin32HandlePropertiesKHR);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryFdKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetMemoryFdKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryFdKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryFdKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryFdPropertiesKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetMemoryFdPropertiesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryFdPropertiesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryFdPropertiesKHR);
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    BUILD_DISPATCH_VECTOR(PreCallValidateImportSemaphoreWin32HandleKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(ImportSemaphoreWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordImportSemaphoreWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordImportSemaphoreWin32HandleKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetSemaphoreWin32HandleKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetSemaphoreWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetSemaphoreWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetSemaphoreWin32HandleKHR);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
-    BUILD_DISPATCH_VECTOR(PreCallValidateImportSemaphoreFdKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(ImportSemaphoreFdKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordImportSemaphoreFdKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordImportSemaphoreFdKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetSemaphoreFdKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetSemaphoreFdKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetSemaphoreFdKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetSemaphoreFdKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdPushDescriptorSetKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdPushDescriptorSetKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdPushDescriptorSetKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdPushDescriptorSetKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdPushDescriptorSetWithTemplateKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdPushDescriptorSetWithTemplateKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdPushDescriptorSetWithTemplateKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdPushDescriptorSetWithTemplateKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateDescriptorUpdateTemplateKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateDescriptorUpdateTemplateKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateDescriptorUpdateTemplateKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateDescriptorUpdateTemplateKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDescriptorUpdateTemplateKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyDescriptorUpdateTemplateKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDescriptorUpdateTemplateKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDescriptorUpdateTemplateKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateUpdateDescriptorSetWithTemplateKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(UpdateDescriptorSetWithTemplateKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordUpdateDescriptorSetWithTemplateKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordUpdateDescriptorSetWithTemplateKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateRenderPass2KHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateRenderPass2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateRenderPass2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateRenderPass2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginRenderPass2KHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBeginRenderPass2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginRenderPass2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginRenderPass2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdNextSubpass2KHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdNextSubpass2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdNextSubpass2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdNextSubpass2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndRenderPass2KHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdEndRenderPass2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndRenderPass2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndRenderPass2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetSwapchainStatusKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetSwapchainStatusKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetSwapchainStatusKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetSwapchainStatusKHR);
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    BUILD_DISPATCH_VECTOR(PreCallValidateImportFenceWin32HandleKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(ImportFenceWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordImportFenceWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordImportFenceWin32HandleKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetFenceWin32HandleKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetFenceWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetFenceWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetFenceWin32HandleKHR);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
-    BUILD_DISPATCH_VECTOR(PreCallValidateImportFenceFdKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(ImportFenceFdKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordImportFenceFdKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordImportFenceFdKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetFenceFdKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetFenceFdKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetFenceFdKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetFenceFdKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateAcquireProfilingLockKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(AcquireProfilingLockKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordAcquireProfilingLockKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordAcquireProfilingLockKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateReleaseProfilingLockKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(ReleaseProfilingLockKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordReleaseProfilingLockKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordReleaseProfilingLockKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageMemoryRequirements2KHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetImageMemoryRequirements2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageMemoryRequirements2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageMemoryRequirements2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferMemoryRequirements2KHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetBufferMemoryRequirements2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferMemoryRequirements2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferMemoryRequirements2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageSparseMemoryRequirements2KHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetImageSparseMemoryRequirements2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageSparseMemoryRequirements2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageSparseMemoryRequirements2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateSamplerYcbcrConversionKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateSamplerYcbcrConversionKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateSamplerYcbcrConversionKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateSamplerYcbcrConversionKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroySamplerYcbcrConversionKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroySamplerYcbcrConversionKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroySamplerYcbcrConversionKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroySamplerYcbcrConversionKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateBindBufferMemory2KHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(BindBufferMemory2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordBindBufferMemory2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordBindBufferMemory2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateBindImageMemory2KHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(BindImageMemory2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordBindImageMemory2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordBindImageMemory2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDescriptorSetLayoutSupportKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDescriptorSetLayoutSupportKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDescriptorSetLayoutSupportKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDescriptorSetLayoutSupportKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndirectCountKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDrawIndirectCountKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndirectCountKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndirectCountKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndexedIndirectCountKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDrawIndexedIndirectCountKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndexedIndirectCountKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndexedIndirectCountKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetSemaphoreCounterValueKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetSemaphoreCounterValueKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetSemaphoreCounterValueKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetSemaphoreCounterValueKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateWaitSemaphoresKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(WaitSemaphoresKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordWaitSemaphoresKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordWaitSemaphoresKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateSignalSemaphoreKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(SignalSemaphoreKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordSignalSemaphoreKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordSignalSemaphoreKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetFragmentShadingRateKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetFragmentShadingRateKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetFragmentShadingRateKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetFragmentShadingRateKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetRenderingAttachmentLocationsKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetRenderingAttachmentLocationsKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetRenderingAttachmentLocationsKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetRenderingAttachmentLocationsKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetRenderingInputAttachmentIndicesKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetRenderingInputAttachmentIndicesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetRenderingInputAttachmentIndicesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetRenderingInputAttachmentIndicesKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateWaitForPresentKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(WaitForPresentKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordWaitForPresentKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordWaitForPresentKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferDeviceAddressKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetBufferDeviceAddressKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferDeviceAddressKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferDeviceAddressKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferOpaqueCaptureAddressKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetBufferOpaqueCaptureAddressKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferOpaqueCaptureAddressKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferOpaqueCaptureAddressKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeviceMemoryOpaqueCaptureAddressKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateDeferredOperationKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateDeferredOperationKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateDeferredOperationKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateDeferredOperationKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDeferredOperationKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyDeferredOperationKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDeferredOperationKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDeferredOperationKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeferredOperationMaxConcurrencyKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeferredOperationMaxConcurrencyKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeferredOperationMaxConcurrencyKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeferredOperationMaxConcurrencyKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeferredOperationResultKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeferredOperationResultKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeferredOperationResultKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeferredOperationResultKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDeferredOperationJoinKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DeferredOperationJoinKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordDeferredOperationJoinKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordDeferredOperationJoinKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelineExecutablePropertiesKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetPipelineExecutablePropertiesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelineExecutablePropertiesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelineExecutablePropertiesKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelineExecutableStatisticsKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetPipelineExecutableStatisticsKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelineExecutableStatisticsKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelineExecutableStatisticsKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelineExecutableInternalRepresentationsKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetPipelineExecutableInternalRepresentationsKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelineExecutableInternalRepresentationsKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelineExecutableInternalRepresentationsKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateMapMemory2KHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(MapMemory2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordMapMemory2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordMapMemory2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateUnmapMemory2KHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(UnmapMemory2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordUnmapMemory2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordUnmapMemory2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetEncodedVideoSessionParametersKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetEncodedVideoSessionParametersKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetEncodedVideoSessionParametersKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetEncodedVideoSessionParametersKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEncodeVideoKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdEncodeVideoKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEncodeVideoKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEncodeVideoKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetEvent2KHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetEvent2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetEvent2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetEvent2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdResetEvent2KHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdResetEvent2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdResetEvent2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdResetEvent2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdWaitEvents2KHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdWaitEvents2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWaitEvents2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWaitEvents2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdPipelineBarrier2KHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdPipelineBarrier2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdPipelineBarrier2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdPipelineBarrier2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteTimestamp2KHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdWriteTimestamp2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteTimestamp2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteTimestamp2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateQueueSubmit2KHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(QueueSubmit2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordQueueSubmit2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordQueueSubmit2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteBufferMarker2AMD);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdWriteBufferMarker2AMD);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteBufferMarker2AMD);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteBufferMarker2AMD);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetQueueCheckpointData2NV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetQueueCheckpointData2NV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetQueueCheckpointData2NV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetQueueCheckpointData2NV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyBuffer2KHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyBuffer2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyBuffer2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyBuffer2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyImage2KHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyImage2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyImage2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyImage2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyBufferToImage2KHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyBufferToImage2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyBufferToImage2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyBufferToImage2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyImageToBuffer2KHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyImageToBuffer2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyImageToBuffer2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyImageToBuffer2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBlitImage2KHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBlitImage2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBlitImage2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBlitImage2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdResolveImage2KHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdResolveImage2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdResolveImage2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdResolveImage2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdTraceRaysIndirect2KHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdTraceRaysIndirect2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdTraceRaysIndirect2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdTraceRaysIndirect2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceBufferMemoryRequirementsKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeviceBufferMemoryRequirementsKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceBufferMemoryRequirementsKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceBufferMemoryRequirementsKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceImageMemoryRequirementsKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeviceImageMemoryRequirementsKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceImageMemoryRequirementsKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceImageMemoryRequirementsKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceImageSparseMemoryRequirementsKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeviceImageSparseMemoryRequirementsKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceImageSparseMemoryRequirementsKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceImageSparseMemoryRequirementsKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindIndexBuffer2KHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBindIndexBuffer2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindIndexBuffer2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindIndexBuffer2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetRenderingAreaGranularityKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetRenderingAreaGranularityKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetRenderingAreaGranularityKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetRenderingAreaGranularityKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceImageSubresourceLayoutKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeviceImageSubresourceLayoutKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceImageSubresourceLayoutKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceImageSubresourceLayoutKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageSubresourceLayout2KHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetImageSubresourceLayout2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageSubresourceLayout2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageSubresourceLayout2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetLineStippleKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetLineStippleKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetLineStippleKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetLineStippleKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetCalibratedTimestampsKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetCalibratedTimestampsKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetCalibratedTimestampsKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetCalibratedTimestampsKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindDescriptorSets2KHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBindDescriptorSets2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindDescriptorSets2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindDescriptorSets2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdPushConstants2KHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdPushConstants2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdPushConstants2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdPushConstants2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdPushDescriptorSet2KHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdPushDescriptorSet2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdPushDescriptorSet2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdPushDescriptorSet2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdPushDescriptorSetWithTemplate2KHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdPushDescriptorSetWithTemplate2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdPushDescriptorSetWithTemplate2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdPushDescriptorSetWithTemplate2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDescriptorBufferOffsets2EXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDescriptorBufferOffsets2EXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDescriptorBufferOffsets2EXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDescriptorBufferOffsets2EXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindDescriptorBufferEmbeddedSamplers2EXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBindDescriptorBufferEmbeddedSamplers2EXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindDescriptorBufferEmbeddedSamplers2EXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindDescriptorBufferEmbeddedSamplers2EXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDebugMarkerSetObjectTagEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DebugMarkerSetObjectTagEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordDebugMarkerSetObjectTagEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordDebugMarkerSetObjectTagEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDebugMarkerSetObjectNameEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DebugMarkerSetObjectNameEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordDebugMarkerSetObjectNameEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordDebugMarkerSetObjectNameEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDebugMarkerBeginEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDebugMarkerBeginEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDebugMarkerBeginEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDebugMarkerBeginEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDebugMarkerEndEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDebugMarkerEndEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDebugMarkerEndEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDebugMarkerEndEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDebugMarkerInsertEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDebugMarkerInsertEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDebugMarkerInsertEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDebugMarkerInsertEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindTransformFeedbackBuffersEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBindTransformFeedbackBuffersEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindTransformFeedbackBuffersEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindTransformFeedbackBuffersEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginTransformFeedbackEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBeginTransformFeedbackEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginTransformFeedbackEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginTransformFeedbackEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndTransformFeedbackEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdEndTransformFeedbackEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndTransformFeedbackEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndTransformFeedbackEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginQueryIndexedEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBeginQueryIndexedEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginQueryIndexedEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginQueryIndexedEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndQueryIndexedEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdEndQueryIndexedEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndQueryIndexedEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndQueryIndexedEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndirectByteCountEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDrawIndirectByteCountEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndirectByteCountEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndirectByteCountEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateCuModuleNVX);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateCuModuleNVX);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateCuModuleNVX);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateCuModuleNVX);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateCuFunctionNVX);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateCuFunctionNVX);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateCuFunctionNVX);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateCuFunctionNVX);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyCuModuleNVX);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyCuModuleNVX);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyCuModuleNVX);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyCuModuleNVX);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyCuFunctionNVX);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyCuFunctionNVX);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyCuFunctionNVX);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyCuFunctionNVX);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCuLaunchKernelNVX);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCuLaunchKernelNVX);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCuLaunchKernelNVX);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCuLaunchKernelNVX);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageViewHandleNVX);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetImageViewHandleNVX);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageViewHandleNVX);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageViewHandleNVX);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageViewAddressNVX);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetImageViewAddressNVX);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageViewAddressNVX);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageViewAddressNVX);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndirectCountAMD);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDrawIndirectCountAMD);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndirectCountAMD);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndirectCountAMD);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndexedIndirectCountAMD);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDrawIndexedIndirectCountAMD);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndexedIndirectCountAMD);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndexedIndirectCountAMD);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetShaderInfoAMD);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetShaderInfoAMD);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetShaderInfoAMD);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetShaderInfoAMD);
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryWin32HandleNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetMemoryWin32HandleNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryWin32HandleNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryWin32HandleNV);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginConditionalRenderingEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBeginConditionalRenderingEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginConditionalRenderingEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginConditionalRenderingEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndConditionalRenderingEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdEndConditionalRenderingEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndConditionalRenderingEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndConditionalRenderingEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewportWScalingNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetViewportWScalingNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewportWScalingNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewportWScalingNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDisplayPowerControlEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DisplayPowerControlEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordDisplayPowerControlEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordDisplayPowerControlEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateRegisterDeviceEventEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(RegisterDeviceEventEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordRegisterDeviceEventEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordRegisterDeviceEventEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateRegisterDisplayEventEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(RegisterDisplayEventEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordRegisterDisplayEventEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordRegisterDisplayEventEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetSwapchainCounterEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetSwapchainCounterEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetSwapchainCounterEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetSwapchainCounterEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetRefreshCycleDurationGOOGLE);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetRefreshCycleDurationGOOGLE);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetRefreshCycleDurationGOOGLE);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetRefreshCycleDurationGOOGLE);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetPastPresentationTimingGOOGLE);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetPastPresentationTimingGOOGLE);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPastPresentationTimingGOOGLE);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPastPresentationTimingGOOGLE);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDiscardRectangleEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDiscardRectangleEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDiscardRectangleEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDiscardRectangleEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDiscardRectangleEnableEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDiscardRectangleEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDiscardRectangleEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDiscardRectangleEnableEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDiscardRectangleModeEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDiscardRectangleModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDiscardRectangleModeEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDiscardRectangleModeEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateSetHdrMetadataEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(SetHdrMetadataEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetHdrMetadataEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetHdrMetadataEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateSetDebugUtilsObjectNameEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(SetDebugUtilsObjectNameEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetDebugUtilsObjectNameEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetDebugUtilsObjectNameEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateSetDebugUtilsObjectTagEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(SetDebugUtilsObjectTagEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetDebugUtilsObjectTagEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetDebugUtilsObjectTagEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateQueueBeginDebugUtilsLabelEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(QueueBeginDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordQueueBeginDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordQueueBeginDebugUtilsLabelEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateQueueEndDebugUtilsLabelEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(QueueEndDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordQueueEndDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordQueueEndDebugUtilsLabelEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateQueueInsertDebugUtilsLabelEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(QueueInsertDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordQueueInsertDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordQueueInsertDebugUtilsLabelEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginDebugUtilsLabelEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBeginDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginDebugUtilsLabelEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndDebugUtilsLabelEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdEndDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndDebugUtilsLabelEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdInsertDebugUtilsLabelEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdInsertDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdInsertDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdInsertDebugUtilsLabelEXT);
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetAndroidHardwareBufferPropertiesANDROID);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetAndroidHardwareBufferPropertiesANDROID);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetAndroidHardwareBufferPropertiesANDROID);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetAndroidHardwareBufferPropertiesANDROID);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryAndroidHardwareBufferANDROID);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetMemoryAndroidHardwareBufferANDROID);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryAndroidHardwareBufferANDROID);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryAndroidHardwareBufferANDROID);
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateExecutionGraphPipelinesAMDX);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateExecutionGraphPipelinesAMDX);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateExecutionGraphPipelinesAMDX);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateExecutionGraphPipelinesAMDX);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetExecutionGraphPipelineScratchSizeAMDX);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetExecutionGraphPipelineScratchSizeAMDX);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetExecutionGraphPipelineScratchSizeAMDX);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetExecutionGraphPipelineScratchSizeAMDX);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetExecutionGraphPipelineNodeIndexAMDX);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetExecutionGraphPipelineNodeIndexAMDX);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetExecutionGraphPipelineNodeIndexAMDX);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetExecutionGraphPipelineNodeIndexAMDX);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdInitializeGraphScratchMemoryAMDX);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdInitializeGraphScratchMemoryAMDX);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdInitializeGraphScratchMemoryAMDX);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdInitializeGraphScratchMemoryAMDX);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatchGraphAMDX);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDispatchGraphAMDX);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatchGraphAMDX);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatchGraphAMDX);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatchGraphIndirectAMDX);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDispatchGraphIndirectAMDX);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatchGraphIndirectAMDX);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatchGraphIndirectAMDX);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatchGraphIndirectCountAMDX);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDispatchGraphIndirectCountAMDX);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatchGraphIndirectCountAMDX);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatchGraphIndirectCountAMDX);
 #endif  // VK_ENABLE_BETA_EXTENSIONS
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetSampleLocationsEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetSampleLocationsEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetSampleLocationsEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetSampleLocationsEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageDrmFormatModifierPropertiesEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetImageDrmFormatModifierPropertiesEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageDrmFormatModifierPropertiesEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageDrmFormatModifierPropertiesEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindShadingRateImageNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBindShadingRateImageNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindShadingRateImageNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindShadingRateImageNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewportShadingRatePaletteNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetViewportShadingRatePaletteNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewportShadingRatePaletteNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewportShadingRatePaletteNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCoarseSampleOrderNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetCoarseSampleOrderNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCoarseSampleOrderNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCoarseSampleOrderNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateAccelerationStructureNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateAccelerationStructureNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateAccelerationStructureNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateAccelerationStructureNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyAccelerationStructureNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyAccelerationStructureNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyAccelerationStructureNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyAccelerationStructureNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetAccelerationStructureMemoryRequirementsNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetAccelerationStructureMemoryRequirementsNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetAccelerationStructureMemoryRequirementsNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetAccelerationStructureMemoryRequirementsNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateBindAccelerationStructureMemoryNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(BindAccelerationStructureMemoryNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordBindAccelerationStructureMemoryNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordBindAccelerationStructureMemoryNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBuildAccelerationStructureNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBuildAccelerationStructureNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBuildAccelerationStructureNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBuildAccelerationStructureNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyAccelerationStructureNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyAccelerationStructureNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyAccelerationStructureNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyAccelerationStructureNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdTraceRaysNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdTraceRaysNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdTraceRaysNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdTraceRaysNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetRayTracingShaderGroupHandlesKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetRayTracingShaderGroupHandlesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetRayTracingShaderGroupHandlesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetRayTracingShaderGroupHandlesKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetRayTracingShaderGroupHandlesNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetRayTracingShaderGroupHandlesNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetRayTracingShaderGroupHandlesNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetRayTracingShaderGroupHandlesNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetAccelerationStructureHandleNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetAccelerationStructureHandleNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetAccelerationStructureHandleNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetAccelerationStructureHandleNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteAccelerationStructuresPropertiesNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdWriteAccelerationStructuresPropertiesNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteAccelerationStructuresPropertiesNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteAccelerationStructuresPropertiesNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCompileDeferredNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CompileDeferredNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCompileDeferredNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCompileDeferredNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryHostPointerPropertiesEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetMemoryHostPointerPropertiesEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryHostPointerPropertiesEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryHostPointerPropertiesEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteBufferMarkerAMD);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdWriteBufferMarkerAMD);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteBufferMarkerAMD);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteBufferMarkerAMD);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetCalibratedTimestampsEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetCalibratedTimestampsEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetCalibratedTimestampsEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetCalibratedTimestampsEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMeshTasksNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDrawMeshTasksNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMeshTasksNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMeshTasksNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMeshTasksIndirectNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDrawMeshTasksIndirectNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMeshTasksIndirectNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMeshTasksIndirectNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMeshTasksIndirectCountNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDrawMeshTasksIndirectCountNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMeshTasksIndirectCountNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMeshTasksIndirectCountNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetExclusiveScissorEnableNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetExclusiveScissorEnableNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetExclusiveScissorEnableNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetExclusiveScissorEnableNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetExclusiveScissorNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetExclusiveScissorNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetExclusiveScissorNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetExclusiveScissorNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCheckpointNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetCheckpointNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCheckpointNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCheckpointNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetQueueCheckpointDataNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetQueueCheckpointDataNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetQueueCheckpointDataNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetQueueCheckpointDataNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateInitializePerformanceApiINTEL);
+    BUILD_VALIDATE_DISPATCH_VECTOR(InitializePerformanceApiINTEL);
     BUILD_DISPATCH_VECTOR(PreCallRecordInitializePerformanceApiINTEL);
     BUILD_DISPATCH_VECTOR(PostCallRecordInitializePerformanceApiINTEL);
-    BUILD_DISPATCH_VECTOR(PreCallValidateUninitializePerformanceApiINTEL);
+    BUILD_VALIDATE_DISPATCH_VECTOR(UninitializePerformanceApiINTEL);
     BUILD_DISPATCH_VECTOR(PreCallRecordUninitializePerformanceApiINTEL);
     BUILD_DISPATCH_VECTOR(PostCallRecordUninitializePerformanceApiINTEL);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPerformanceMarkerINTEL);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetPerformanceMarkerINTEL);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPerformanceMarkerINTEL);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPerformanceMarkerINTEL);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPerformanceStreamMarkerINTEL);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetPerformanceStreamMarkerINTEL);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPerformanceStreamMarkerINTEL);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPerformanceStreamMarkerINTEL);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPerformanceOverrideINTEL);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetPerformanceOverrideINTEL);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPerformanceOverrideINTEL);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPerformanceOverrideINTEL);
-    BUILD_DISPATCH_VECTOR(PreCallValidateAcquirePerformanceConfigurationINTEL);
+    BUILD_VALIDATE_DISPATCH_VECTOR(AcquirePerformanceConfigurationINTEL);
     BUILD_DISPATCH_VECTOR(PreCallRecordAcquirePerformanceConfigurationINTEL);
     BUILD_DISPATCH_VECTOR(PostCallRecordAcquirePerformanceConfigurationINTEL);
-    BUILD_DISPATCH_VECTOR(PreCallValidateReleasePerformanceConfigurationINTEL);
+    BUILD_VALIDATE_DISPATCH_VECTOR(ReleasePerformanceConfigurationINTEL);
     BUILD_DISPATCH_VECTOR(PreCallRecordReleasePerformanceConfigurationINTEL);
     BUILD_DISPATCH_VECTOR(PostCallRecordReleasePerformanceConfigurationINTEL);
-    BUILD_DISPATCH_VECTOR(PreCallValidateQueueSetPerformanceConfigurationINTEL);
+    BUILD_VALIDATE_DISPATCH_VECTOR(QueueSetPerformanceConfigurationINTEL);
     BUILD_DISPATCH_VECTOR(PreCallRecordQueueSetPerformanceConfigurationINTEL);
     BUILD_DISPATCH_VECTOR(PostCallRecordQueueSetPerformanceConfigurationINTEL);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetPerformanceParameterINTEL);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetPerformanceParameterINTEL);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPerformanceParameterINTEL);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPerformanceParameterINTEL);
-    BUILD_DISPATCH_VECTOR(PreCallValidateSetLocalDimmingAMD);
+    BUILD_VALIDATE_DISPATCH_VECTOR(SetLocalDimmingAMD);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetLocalDimmingAMD);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetLocalDimmingAMD);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferDeviceAddressEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetBufferDeviceAddressEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferDeviceAddressEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferDeviceAddressEXT);
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    BUILD_DISPATCH_VECTOR(PreCallValidateAcquireFullScreenExclusiveModeEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(AcquireFullScreenExclusiveModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordAcquireFullScreenExclusiveModeEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordAcquireFullScreenExclusiveModeEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateReleaseFullScreenExclusiveModeEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(ReleaseFullScreenExclusiveModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordReleaseFullScreenExclusiveModeEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordReleaseFullScreenExclusiveModeEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceGroupSurfacePresentModes2EXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeviceGroupSurfacePresentModes2EXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceGroupSurfacePresentModes2EXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceGroupSurfacePresentModes2EXT);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetLineStippleEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetLineStippleEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetLineStippleEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetLineStippleEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateResetQueryPoolEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(ResetQueryPoolEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordResetQueryPoolEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordResetQueryPoolEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCullModeEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetCullModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCullModeEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCullModeEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetFrontFaceEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetFrontFaceEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetFrontFaceEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetFrontFaceEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPrimitiveTopologyEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetPrimitiveTopologyEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPrimitiveTopologyEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPrimitiveTopologyEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewportWithCountEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetViewportWithCountEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewportWithCountEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewportWithCountEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetScissorWithCountEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetScissorWithCountEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetScissorWithCountEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetScissorWithCountEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindVertexBuffers2EXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBindVertexBuffers2EXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindVertexBuffers2EXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindVertexBuffers2EXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthTestEnableEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDepthTestEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthTestEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthTestEnableEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthWriteEnableEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDepthWriteEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthWriteEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthWriteEnableEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthCompareOpEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDepthCompareOpEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthCompareOpEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthCompareOpEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthBoundsTestEnableEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDepthBoundsTestEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthBoundsTestEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthBoundsTestEnableEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilTestEnableEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetStencilTestEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilTestEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilTestEnableEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilOpEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetStencilOpEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilOpEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilOpEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCopyMemoryToImageEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CopyMemoryToImageEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCopyMemoryToImageEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCopyMemoryToImageEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCopyImageToMemoryEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CopyImageToMemoryEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCopyImageToMemoryEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCopyImageToMemoryEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCopyImageToImageEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CopyImageToImageEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCopyImageToImageEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCopyImageToImageEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateTransitionImageLayoutEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(TransitionImageLayoutEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordTransitionImageLayoutEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordTransitionImageLayoutEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageSubresourceLayout2EXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetImageSubresourceLayout2EXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageSubresourceLayout2EXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageSubresourceLayout2EXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateReleaseSwapchainImagesEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(ReleaseSwapchainImagesEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordReleaseSwapchainImagesEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordReleaseSwapchainImagesEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetGeneratedCommandsMemoryRequirementsNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetGeneratedCommandsMemoryRequirementsNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetGeneratedCommandsMemoryRequirementsNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetGeneratedCommandsMemoryRequirementsNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdPreprocessGeneratedCommandsNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdPreprocessGeneratedCommandsNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdPreprocessGeneratedCommandsNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdPreprocessGeneratedCommandsNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdExecuteGeneratedCommandsNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdExecuteGeneratedCommandsNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdExecuteGeneratedCommandsNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdExecuteGeneratedCommandsNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindPipelineShaderGroupNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBindPipelineShaderGroupNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindPipelineShaderGroupNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindPipelineShaderGroupNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateIndirectCommandsLayoutNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateIndirectCommandsLayoutNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateIndirectCommandsLayoutNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateIndirectCommandsLayoutNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyIndirectCommandsLayoutNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyIndirectCommandsLayoutNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyIndirectCommandsLayoutNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyIndirectCommandsLayoutNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthBias2EXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDepthBias2EXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthBias2EXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthBias2EXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreatePrivateDataSlotEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreatePrivateDataSlotEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreatePrivateDataSlotEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreatePrivateDataSlotEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyPrivateDataSlotEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyPrivateDataSlotEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyPrivateDataSlotEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyPrivateDataSlotEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateSetPrivateDataEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(SetPrivateDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetPrivateDataEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetPrivateDataEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetPrivateDataEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetPrivateDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPrivateDataEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPrivateDataEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateCudaModuleNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateCudaModuleNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateCudaModuleNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateCudaModuleNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetCudaModuleCacheNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetCudaModuleCacheNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetCudaModuleCacheNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetCudaModuleCacheNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateCudaFunctionNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateCudaFunctionNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateCudaFunctionNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateCudaFunctionNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyCudaModuleNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyCudaModuleNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyCudaModuleNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyCudaModuleNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyCudaFunctionNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyCudaFunctionNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyCudaFunctionNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyCudaFunctionNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCudaLaunchKernelNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCudaLaunchKernelNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCudaLaunchKernelNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCudaLaunchKernelNV);
 #ifdef VK_USE_PLATFORM_METAL_EXT
-    BUILD_DISPATCH_VECTOR(PreCallValidateExportMetalObjectsEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(ExportMetalObjectsEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordExportMetalObjectsEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordExportMetalObjectsEXT);
 #endif  // VK_USE_PLATFORM_METAL_EXT
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDescriptorSetLayoutSizeEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDescriptorSetLayoutSizeEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDescriptorSetLayoutSizeEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDescriptorSetLayoutSizeEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDescriptorSetLayoutBindingOffsetEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDescriptorSetLayoutBindingOffsetEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDescriptorSetLayoutBindingOffsetEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDescriptorSetLayoutBindingOffsetEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDescriptorEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDescriptorEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDescriptorEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDescriptorEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindDescriptorBuffersEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBindDescriptorBuffersEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindDescriptorBuffersEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindDescriptorBuffersEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDescriptorBufferOffsetsEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDescriptorBufferOffsetsEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDescriptorBufferOffsetsEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDescriptorBufferOffsetsEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindDescriptorBufferEmbeddedSamplersEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBindDescriptorBufferEmbeddedSamplersEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindDescriptorBufferEmbeddedSamplersEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindDescriptorBufferEmbeddedSamplersEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferOpaqueCaptureDescriptorDataEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetBufferOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferOpaqueCaptureDescriptorDataEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageOpaqueCaptureDescriptorDataEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetImageOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageOpaqueCaptureDescriptorDataEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetImageViewOpaqueCaptureDescriptorDataEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetImageViewOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageViewOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageViewOpaqueCaptureDescriptorDataEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetSamplerOpaqueCaptureDescriptorDataEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetSamplerOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetSamplerOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetSamplerOpaqueCaptureDescriptorDataEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetAccelerationStructureOpaqueCaptureDescriptorDataEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetAccelerationStructureOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetAccelerationStructureOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetAccelerationStructureOpaqueCaptureDescriptorDataEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetFragmentShadingRateEnumNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetFragmentShadingRateEnumNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetFragmentShadingRateEnumNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetFragmentShadingRateEnumNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceFaultInfoEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeviceFaultInfoEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceFaultInfoEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceFaultInfoEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetVertexInputEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetVertexInputEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetVertexInputEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetVertexInputEXT);
 #ifdef VK_USE_PLATFORM_FUCHSIA
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryZirconHandleFUCHSIA);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetMemoryZirconHandleFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryZirconHandleFUCHSIA);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryZirconHandleFUCHSIA);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryZirconHandlePropertiesFUCHSIA);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetMemoryZirconHandlePropertiesFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryZirconHandlePropertiesFUCHSIA);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryZirconHandlePropertiesFUCHSIA);
-    BUILD_DISPATCH_VECTOR(PreCallValidateImportSemaphoreZirconHandleFUCHSIA);
+    BUILD_VALIDATE_DISPATCH_VECTOR(ImportSemaphoreZirconHandleFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallRecordImportSemaphoreZirconHandleFUCHSIA);
     BUILD_DISPATCH_VECTOR(PostCallRecordImportSemaphoreZirconHandleFUCHSIA);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetSemaphoreZirconHandleFUCHSIA);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetSemaphoreZirconHandleFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetSemaphoreZirconHandleFUCHSIA);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetSemaphoreZirconHandleFUCHSIA);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateBufferCollectionFUCHSIA);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateBufferCollectionFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateBufferCollectionFUCHSIA);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateBufferCollectionFUCHSIA);
-    BUILD_DISPATCH_VECTOR(PreCallValidateSetBufferCollectionImageConstraintsFUCHSIA);
+    BUILD_VALIDATE_DISPATCH_VECTOR(SetBufferCollectionImageConstraintsFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetBufferCollectionImageConstraintsFUCHSIA);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetBufferCollectionImageConstraintsFUCHSIA);
-    BUILD_DISPATCH_VECTOR(PreCallValidateSetBufferCollectionBufferConstraintsFUCHSIA);
+    BUILD_VALIDATE_DISPATCH_VECTOR(SetBufferCollectionBufferConstraintsFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetBufferCollectionBufferConstraintsFUCHSIA);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetBufferCollectionBufferConstraintsFUCHSIA);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyBufferCollectionFUCHSIA);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyBufferCollectionFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyBufferCollectionFUCHSIA);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyBufferCollectionFUCHSIA);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferCollectionPropertiesFUCHSIA);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetBufferCollectionPropertiesFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferCollectionPropertiesFUCHSIA);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferCollectionPropertiesFUCHSIA);
 #endif  // VK_USE_PLATFORM_FUCHSIA
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSubpassShadingHUAWEI);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSubpassShadingHUAWEI);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSubpassShadingHUAWEI);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSubpassShadingHUAWEI);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindInvocationMaskHUAWEI);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBindInvocationMaskHUAWEI);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindInvocationMaskHUAWEI);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindInvocationMaskHUAWEI);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryRemoteAddressNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetMemoryRemoteAddressNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryRemoteAddressNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryRemoteAddressNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelinePropertiesEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetPipelinePropertiesEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelinePropertiesEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelinePropertiesEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPatchControlPointsEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetPatchControlPointsEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPatchControlPointsEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPatchControlPointsEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetRasterizerDiscardEnableEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetRasterizerDiscardEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetRasterizerDiscardEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetRasterizerDiscardEnableEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthBiasEnableEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDepthBiasEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthBiasEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthBiasEnableEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetLogicOpEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetLogicOpEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetLogicOpEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetLogicOpEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPrimitiveRestartEnableEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetPrimitiveRestartEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPrimitiveRestartEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPrimitiveRestartEnableEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetColorWriteEnableEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetColorWriteEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetColorWriteEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetColorWriteEnableEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMultiEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDrawMultiEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMultiEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMultiEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMultiIndexedEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDrawMultiIndexedEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMultiIndexedEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMultiIndexedEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateMicromapEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateMicromapEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateMicromapEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateMicromapEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyMicromapEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyMicromapEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyMicromapEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyMicromapEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBuildMicromapsEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBuildMicromapsEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBuildMicromapsEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBuildMicromapsEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateBuildMicromapsEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(BuildMicromapsEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordBuildMicromapsEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordBuildMicromapsEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCopyMicromapEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CopyMicromapEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCopyMicromapEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCopyMicromapEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCopyMicromapToMemoryEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CopyMicromapToMemoryEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCopyMicromapToMemoryEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCopyMicromapToMemoryEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCopyMemoryToMicromapEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CopyMemoryToMicromapEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCopyMemoryToMicromapEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCopyMemoryToMicromapEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateWriteMicromapsPropertiesEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(WriteMicromapsPropertiesEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordWriteMicromapsPropertiesEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordWriteMicromapsPropertiesEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyMicromapEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyMicromapEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyMicromapEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyMicromapEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyMicromapToMemoryEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyMicromapToMemoryEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyMicromapToMemoryEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyMicromapToMemoryEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyMemoryToMicromapEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyMemoryToMicromapEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyMemoryToMicromapEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyMemoryToMicromapEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteMicromapsPropertiesEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdWriteMicromapsPropertiesEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteMicromapsPropertiesEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteMicromapsPropertiesEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceMicromapCompatibilityEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeviceMicromapCompatibilityEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceMicromapCompatibilityEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceMicromapCompatibilityEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetMicromapBuildSizesEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetMicromapBuildSizesEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMicromapBuildSizesEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMicromapBuildSizesEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawClusterHUAWEI);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDrawClusterHUAWEI);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawClusterHUAWEI);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawClusterHUAWEI);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawClusterIndirectHUAWEI);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDrawClusterIndirectHUAWEI);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawClusterIndirectHUAWEI);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawClusterIndirectHUAWEI);
-    BUILD_DISPATCH_VECTOR(PreCallValidateSetDeviceMemoryPriorityEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(SetDeviceMemoryPriorityEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetDeviceMemoryPriorityEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetDeviceMemoryPriorityEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDescriptorSetLayoutHostMappingInfoVALVE);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDescriptorSetLayoutHostMappingInfoVALVE);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDescriptorSetLayoutHostMappingInfoVALVE);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDescriptorSetLayoutHostMappingInfoVALVE);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDescriptorSetHostMappingVALVE);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDescriptorSetHostMappingVALVE);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDescriptorSetHostMappingVALVE);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDescriptorSetHostMappingVALVE);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyMemoryIndirectNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyMemoryIndirectNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyMemoryIndirectNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyMemoryIndirectNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyMemoryToImageIndirectNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyMemoryToImageIndirectNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyMemoryToImageIndirectNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyMemoryToImageIndirectNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDecompressMemoryNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDecompressMemoryNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDecompressMemoryNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDecompressMemoryNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDecompressMemoryIndirectCountNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDecompressMemoryIndirectCountNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDecompressMemoryIndirectCountNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDecompressMemoryIndirectCountNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelineIndirectMemoryRequirementsNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetPipelineIndirectMemoryRequirementsNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelineIndirectMemoryRequirementsNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelineIndirectMemoryRequirementsNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdUpdatePipelineIndirectBufferNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdUpdatePipelineIndirectBufferNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdUpdatePipelineIndirectBufferNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdUpdatePipelineIndirectBufferNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelineIndirectDeviceAddressNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetPipelineIndirectDeviceAddressNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelineIndirectDeviceAddressNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelineIndirectDeviceAddressNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthClampEnableEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDepthClampEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthClampEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthClampEnableEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPolygonModeEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetPolygonModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPolygonModeEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPolygonModeEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetRasterizationSamplesEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetRasterizationSamplesEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetRasterizationSamplesEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetRasterizationSamplesEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetSampleMaskEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetSampleMaskEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetSampleMaskEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetSampleMaskEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetAlphaToCoverageEnableEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetAlphaToCoverageEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetAlphaToCoverageEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetAlphaToCoverageEnableEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetAlphaToOneEnableEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetAlphaToOneEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetAlphaToOneEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetAlphaToOneEnableEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetLogicOpEnableEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetLogicOpEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetLogicOpEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetLogicOpEnableEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetColorBlendEnableEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetColorBlendEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetColorBlendEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetColorBlendEnableEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetColorBlendEquationEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetColorBlendEquationEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetColorBlendEquationEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetColorBlendEquationEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetColorWriteMaskEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetColorWriteMaskEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetColorWriteMaskEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetColorWriteMaskEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetTessellationDomainOriginEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetTessellationDomainOriginEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetTessellationDomainOriginEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetTessellationDomainOriginEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetRasterizationStreamEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetRasterizationStreamEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetRasterizationStreamEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetRasterizationStreamEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetConservativeRasterizationModeEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetConservativeRasterizationModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetConservativeRasterizationModeEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetConservativeRasterizationModeEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetExtraPrimitiveOverestimationSizeEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetExtraPrimitiveOverestimationSizeEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetExtraPrimitiveOverestimationSizeEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetExtraPrimitiveOverestimationSizeEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthClipEnableEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDepthClipEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthClipEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthClipEnableEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetSampleLocationsEnableEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetSampleLocationsEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetSampleLocationsEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetSampleLocationsEnableEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetColorBlendAdvancedEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetColorBlendAdvancedEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetColorBlendAdvancedEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetColorBlendAdvancedEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetProvokingVertexModeEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetProvokingVertexModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetProvokingVertexModeEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetProvokingVertexModeEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetLineRasterizationModeEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetLineRasterizationModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetLineRasterizationModeEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetLineRasterizationModeEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetLineStippleEnableEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetLineStippleEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetLineStippleEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetLineStippleEnableEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthClipNegativeOneToOneEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetDepthClipNegativeOneToOneEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthClipNegativeOneToOneEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthClipNegativeOneToOneEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewportWScalingEnableNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetViewportWScalingEnableNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewportWScalingEnableNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewportWScalingEnableNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewportSwizzleNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetViewportSwizzleNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewportSwizzleNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewportSwizzleNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCoverageToColorEnableNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetCoverageToColorEnableNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCoverageToColorEnableNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCoverageToColorEnableNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCoverageToColorLocationNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetCoverageToColorLocationNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCoverageToColorLocationNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCoverageToColorLocationNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCoverageModulationModeNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetCoverageModulationModeNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCoverageModulationModeNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCoverageModulationModeNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCoverageModulationTableEnableNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetCoverageModulationTableEnableNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCoverageModulationTableEnableNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCoverageModulationTableEnableNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCoverageModulationTableNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetCoverageModulationTableNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCoverageModulationTableNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCoverageModulationTableNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetShadingRateImageEnableNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetShadingRateImageEnableNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetShadingRateImageEnableNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetShadingRateImageEnableNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetRepresentativeFragmentTestEnableNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetRepresentativeFragmentTestEnableNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetRepresentativeFragmentTestEnableNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetRepresentativeFragmentTestEnableNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCoverageReductionModeNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetCoverageReductionModeNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCoverageReductionModeNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCoverageReductionModeNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetShaderModuleIdentifierEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetShaderModuleIdentifierEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetShaderModuleIdentifierEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetShaderModuleIdentifierEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetShaderModuleCreateInfoIdentifierEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetShaderModuleCreateInfoIdentifierEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetShaderModuleCreateInfoIdentifierEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetShaderModuleCreateInfoIdentifierEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateOpticalFlowSessionNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateOpticalFlowSessionNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateOpticalFlowSessionNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateOpticalFlowSessionNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyOpticalFlowSessionNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyOpticalFlowSessionNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyOpticalFlowSessionNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyOpticalFlowSessionNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateBindOpticalFlowSessionImageNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(BindOpticalFlowSessionImageNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordBindOpticalFlowSessionImageNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordBindOpticalFlowSessionImageNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdOpticalFlowExecuteNV);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdOpticalFlowExecuteNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdOpticalFlowExecuteNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdOpticalFlowExecuteNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyShaderEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyShaderEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyShaderEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyShaderEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetShaderBinaryDataEXT);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetShaderBinaryDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetShaderBinaryDataEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetShaderBinaryDataEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindShadersEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBindShadersEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindShadersEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindShadersEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetFramebufferTilePropertiesQCOM);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetFramebufferTilePropertiesQCOM);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetFramebufferTilePropertiesQCOM);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetFramebufferTilePropertiesQCOM);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDynamicRenderingTilePropertiesQCOM);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDynamicRenderingTilePropertiesQCOM);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDynamicRenderingTilePropertiesQCOM);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDynamicRenderingTilePropertiesQCOM);
-    BUILD_DISPATCH_VECTOR(PreCallValidateSetLatencySleepModeNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(SetLatencySleepModeNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetLatencySleepModeNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetLatencySleepModeNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateLatencySleepNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(LatencySleepNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordLatencySleepNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordLatencySleepNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateSetLatencyMarkerNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(SetLatencyMarkerNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetLatencyMarkerNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetLatencyMarkerNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetLatencyTimingsNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetLatencyTimingsNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetLatencyTimingsNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetLatencyTimingsNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateQueueNotifyOutOfBandNV);
+    BUILD_VALIDATE_DISPATCH_VECTOR(QueueNotifyOutOfBandNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordQueueNotifyOutOfBandNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordQueueNotifyOutOfBandNV);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetAttachmentFeedbackLoopEnableEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetAttachmentFeedbackLoopEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetAttachmentFeedbackLoopEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetAttachmentFeedbackLoopEnableEXT);
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetScreenBufferPropertiesQNX);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetScreenBufferPropertiesQNX);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetScreenBufferPropertiesQNX);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetScreenBufferPropertiesQNX);
 #endif  // VK_USE_PLATFORM_SCREEN_QNX
-    BUILD_DISPATCH_VECTOR(PreCallValidateCreateAccelerationStructureKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CreateAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateAccelerationStructureKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateDestroyAccelerationStructureKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(DestroyAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyAccelerationStructureKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBuildAccelerationStructuresKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBuildAccelerationStructuresKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBuildAccelerationStructuresKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBuildAccelerationStructuresKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdBuildAccelerationStructuresIndirectKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdBuildAccelerationStructuresIndirectKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBuildAccelerationStructuresIndirectKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBuildAccelerationStructuresIndirectKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateBuildAccelerationStructuresKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(BuildAccelerationStructuresKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordBuildAccelerationStructuresKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordBuildAccelerationStructuresKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCopyAccelerationStructureKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CopyAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCopyAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCopyAccelerationStructureKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCopyAccelerationStructureToMemoryKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CopyAccelerationStructureToMemoryKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCopyAccelerationStructureToMemoryKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCopyAccelerationStructureToMemoryKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCopyMemoryToAccelerationStructureKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(CopyMemoryToAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCopyMemoryToAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCopyMemoryToAccelerationStructureKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateWriteAccelerationStructuresPropertiesKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(WriteAccelerationStructuresPropertiesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordWriteAccelerationStructuresPropertiesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordWriteAccelerationStructuresPropertiesKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyAccelerationStructureKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyAccelerationStructureKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyAccelerationStructureToMemoryKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyAccelerationStructureToMemoryKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyAccelerationStructureToMemoryKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyAccelerationStructureToMemoryKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyMemoryToAccelerationStructureKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdCopyMemoryToAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyMemoryToAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyMemoryToAccelerationStructureKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetAccelerationStructureDeviceAddressKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetAccelerationStructureDeviceAddressKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetAccelerationStructureDeviceAddressKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetAccelerationStructureDeviceAddressKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteAccelerationStructuresPropertiesKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdWriteAccelerationStructuresPropertiesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteAccelerationStructuresPropertiesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteAccelerationStructuresPropertiesKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceAccelerationStructureCompatibilityKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetDeviceAccelerationStructureCompatibilityKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceAccelerationStructureCompatibilityKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceAccelerationStructureCompatibilityKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetAccelerationStructureBuildSizesKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetAccelerationStructureBuildSizesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetAccelerationStructureBuildSizesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetAccelerationStructureBuildSizesKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdTraceRaysKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdTraceRaysKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdTraceRaysKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdTraceRaysKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetRayTracingCaptureReplayShaderGroupHandlesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdTraceRaysIndirectKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdTraceRaysIndirectKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdTraceRaysIndirectKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdTraceRaysIndirectKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateGetRayTracingShaderGroupStackSizeKHR);
+    BUILD_VALIDATE_DISPATCH_VECTOR(GetRayTracingShaderGroupStackSizeKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetRayTracingShaderGroupStackSizeKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetRayTracingShaderGroupStackSizeKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetRayTracingPipelineStackSizeKHR);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdSetRayTracingPipelineStackSizeKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetRayTracingPipelineStackSizeKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetRayTracingPipelineStackSizeKHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMeshTasksEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDrawMeshTasksEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMeshTasksEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMeshTasksEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMeshTasksIndirectEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDrawMeshTasksIndirectEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMeshTasksIndirectEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMeshTasksIndirectEXT);
-    BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMeshTasksIndirectCountEXT);
+    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(CmdDrawMeshTasksIndirectCountEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMeshTasksIndirectCountEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMeshTasksIndirectCountEXT);
+
+    intercept_vectors.Assign(intercept_lists);
+
+    // Between the sampled frames the recording commands are only validated by the objects whose checks are cheap, the state
+    // is still recorded by all of them
+    if (frame_sampler) {
+        for (const InterceptId id : command_validate_ids) {
+            auto& list = intercept_lists[id];
+            list.erase(std::remove_if(list.begin(), list.end(),
+                                      [](const ValidationObject* object) {
+                                          return object->container_type == LayerObjectTypeCoreValidation ||
+                                                 object->container_type == LayerObjectTypeBestPractices ||
+                                                 object->container_type == LayerObjectTypeSyncValidation;
+                                      }),
+                       list.end());
+        }
+        unsampled_intercept_vectors.Assign(intercept_lists);
+    }
 }
 
 // NOLINTEND
@@ -712,6 +712,8 @@ enum class Func {
     vkWriteAccelerationStructuresPropertiesKHR,
     vkWriteMicromapsPropertiesEXT,
 };
+// Number of Func values, including Empty
+constexpr uint32_t kFuncCount = 681;
 
 enum class Struct {
     Empty = 0,
@@ -5023,6 +5025,8 @@ enum class Extension {
     _VK_VALVE_descriptor_set_host_mapping,
     _VK_VALVE_mutable_descriptor_type,
 };
+// Number of Extension values, including Empty
+constexpr uint32_t kExtensionCount = 373;
 
 // Sometimes you know the requirement list doesn't contain any version values
 typedef small_vector<vvl::Extension, 2, size_t> Extensions;
@@ -1597,6 +1597,438 @@ void GetEnabledDeviceFeatures(const VkDeviceCreateInfo *pCreateInfo, DeviceFeatu
     if (api_version >= VK_API_VERSION_1_3) {
         features->texelBufferAlignment = true;
     }
+
+    static constexpr bool DeviceFeatures::*kFeatureMembers[] = {
+        &DeviceFeatures::storageBuffer16BitAccess,
+        &DeviceFeatures::storageInputOutput16,
+        &DeviceFeatures::storagePushConstant16,
+        &DeviceFeatures::uniformAndStorageBuffer16BitAccess,
+        &DeviceFeatures::formatA4B4G4R4,
+        &DeviceFeatures::formatA4R4G4B4,
+        &DeviceFeatures::storageBuffer8BitAccess,
+        &DeviceFeatures::storagePushConstant8,
+        &DeviceFeatures::uniformAndStorageBuffer8BitAccess,
+        &DeviceFeatures::decodeModeSharedExponent,
+        &DeviceFeatures::accelerationStructure,
+        &DeviceFeatures::accelerationStructureCaptureReplay,
+        &DeviceFeatures::accelerationStructureHostCommands,
+        &DeviceFeatures::accelerationStructureIndirectBuild,
+        &DeviceFeatures::descriptorBindingAccelerationStructureUpdateAfterBind,
+        &DeviceFeatures::reportAddressBinding,
+        &DeviceFeatures::amigoProfiling,
+        &DeviceFeatures::attachmentFeedbackLoopDynamicState,
+        &DeviceFeatures::attachmentFeedbackLoopLayout,
+        &DeviceFeatures::advancedBlendCoherentOperations,
+        &DeviceFeatures::borderColorSwizzle,
+        &DeviceFeatures::borderColorSwizzleFromImage,
+        &DeviceFeatures::bufferDeviceAddress,
+        &DeviceFeatures::bufferDeviceAddressCaptureReplay,
+        &DeviceFeatures::bufferDeviceAddressMultiDevice,
+        &DeviceFeatures::bufferDeviceAddressCaptureReplayEXT,
+        &DeviceFeatures::bufferDeviceAddressEXT,
+        &DeviceFeatures::bufferDeviceAddressMultiDeviceEXT,
+        &DeviceFeatures::clustercullingShader,
+        &DeviceFeatures::multiviewClusterCullingShader,
+        &DeviceFeatures::clusterShadingRate,
+        &DeviceFeatures::deviceCoherentMemory,
+        &DeviceFeatures::colorWriteEnable,
+        &DeviceFeatures::computeDerivativeGroupLinear,
+        &DeviceFeatures::computeDerivativeGroupQuads,
+        &DeviceFeatures::conditionalRendering,
+        &DeviceFeatures::inheritedConditionalRendering,
+        &DeviceFeatures::cooperativeMatrix,
+        &DeviceFeatures::cooperativeMatrixRobustBufferAccess,
+        &DeviceFeatures::indirectCopy,
+        &DeviceFeatures::cornerSampledImage,
+        &DeviceFeatures::coverageReductionMode,
+        &DeviceFeatures::cubicRangeClamp,
+        &DeviceFeatures::selectableCubicWeights,
+        &DeviceFeatures::cudaKernelLaunchFeatures,
+        &DeviceFeatures::customBorderColorWithoutFormat,
+        &DeviceFeatures::customBorderColors,
+        &DeviceFeatures::dedicatedAllocationImageAliasing,
+        &DeviceFeatures::depthBiasControl,
+        &DeviceFeatures::depthBiasExact,
+        &DeviceFeatures::floatRepresentation,
+        &DeviceFeatures::leastRepresentableValueForceUnormRepresentation,
+        &DeviceFeatures::depthClampZeroOne,
+        &DeviceFeatures::depthClipControl,
+        &DeviceFeatures::depthClipEnable,
+        &DeviceFeatures::descriptorBuffer,
+        &DeviceFeatures::descriptorBufferCaptureReplay,
+        &DeviceFeatures::descriptorBufferImageLayoutIgnored,
+        &DeviceFeatures::descriptorBufferPushDescriptors,
+        &DeviceFeatures::descriptorBindingPartiallyBound,
+        &DeviceFeatures::descriptorBindingSampledImageUpdateAfterBind,
+        &DeviceFeatures::descriptorBindingStorageBufferUpdateAfterBind,
+        &DeviceFeatures::descriptorBindingStorageImageUpdateAfterBind,
+        &DeviceFeatures::descriptorBindingStorageTexelBufferUpdateAfterBind,
+        &DeviceFeatures::descriptorBindingUniformBufferUpdateAfterBind,
+        &DeviceFeatures::descriptorBindingUniformTexelBufferUpdateAfterBind,
+        &DeviceFeatures::descriptorBindingUpdateUnusedWhilePending,
+        &DeviceFeatures::descriptorBindingVariableDescriptorCount,
+        &DeviceFeatures::runtimeDescriptorArray,
+        &DeviceFeatures::shaderInputAttachmentArrayDynamicIndexing,
+        &DeviceFeatures::shaderInputAttachmentArrayNonUniformIndexing,
+        &DeviceFeatures::shaderSampledImageArrayNonUniformIndexing,
+        &DeviceFeatures::shaderStorageBufferArrayNonUniformIndexing,
+        &DeviceFeatures::shaderStorageImageArrayNonUniformIndexing,
+        &DeviceFeatures::shaderStorageTexelBufferArrayDynamicIndexing,
+        &DeviceFeatures::shaderStorageTexelBufferArrayNonUniformIndexing,
+        &DeviceFeatures::shaderUniformBufferArrayNonUniformIndexing,
+        &DeviceFeatures::shaderUniformTexelBufferArrayDynamicIndexing,
+        &DeviceFeatures::shaderUniformTexelBufferArrayNonUniformIndexing,
+        &DeviceFeatures::descriptorPoolOverallocation,
+        &DeviceFeatures::descriptorSetHostMapping,
+        &DeviceFeatures::deviceGeneratedCompute,
+        &DeviceFeatures::deviceGeneratedComputeCaptureReplay,
+        &DeviceFeatures::deviceGeneratedComputePipelines,
+        &DeviceFeatures::deviceGeneratedCommands,
+        &DeviceFeatures::deviceMemoryReport,
+        &DeviceFeatures::diagnosticsConfig,
+        &DeviceFeatures::displacementMicromap,
+        &DeviceFeatures::dynamicRendering,
+        &DeviceFeatures::dynamicRenderingLocalRead,
+        &DeviceFeatures::dynamicRenderingUnusedAttachments,
+        &DeviceFeatures::exclusiveScissor,
+        &DeviceFeatures::extendedDynamicState2,
+        &DeviceFeatures::extendedDynamicState2LogicOp,
+        &DeviceFeatures::extendedDynamicState2PatchControlPoints,
+        &DeviceFeatures::extendedDynamicState3AlphaToCoverageEnable,
+        &DeviceFeatures::extendedDynamicState3AlphaToOneEnable,
+        &DeviceFeatures::extendedDynamicState3ColorBlendAdvanced,
+        &DeviceFeatures::extendedDynamicState3ColorBlendEnable,
+        &DeviceFeatures::extendedDynamicState3ColorBlendEquation,
+        &DeviceFeatures::extendedDynamicState3ColorWriteMask,
+        &DeviceFeatures::extendedDynamicState3ConservativeRasterizationMode,
+        &DeviceFeatures::extendedDynamicState3CoverageModulationMode,
+        &DeviceFeatures::extendedDynamicState3CoverageModulationTable,
+        &DeviceFeatures::extendedDynamicState3CoverageModulationTableEnable,
+        &DeviceFeatures::extendedDynamicState3CoverageReductionMode,
+        &DeviceFeatures::extendedDynamicState3CoverageToColorEnable,
+        &DeviceFeatures::extendedDynamicState3CoverageToColorLocation,
+        &DeviceFeatures::extendedDynamicState3DepthClampEnable,
+        &DeviceFeatures::extendedDynamicState3DepthClipEnable,
+        &DeviceFeatures::extendedDynamicState3DepthClipNegativeOneToOne,
+        &DeviceFeatures::extendedDynamicState3ExtraPrimitiveOverestimationSize,
+        &DeviceFeatures::extendedDynamicState3LineRasterizationMode,
+        &DeviceFeatures::extendedDynamicState3LineStippleEnable,
+        &DeviceFeatures::extendedDynamicState3LogicOpEnable,
+        &DeviceFeatures::extendedDynamicState3PolygonMode,
+        &DeviceFeatures::extendedDynamicState3ProvokingVertexMode,
+        &DeviceFeatures::extendedDynamicState3RasterizationSamples,
+        &DeviceFeatures::extendedDynamicState3RasterizationStream,
+        &DeviceFeatures::extendedDynamicState3RepresentativeFragmentTestEnable,
+        &DeviceFeatures::extendedDynamicState3SampleLocationsEnable,
+        &DeviceFeatures::extendedDynamicState3SampleMask,
+        &DeviceFeatures::extendedDynamicState3ShadingRateImageEnable,
+        &DeviceFeatures::extendedDynamicState3TessellationDomainOrigin,
+        &DeviceFeatures::extendedDynamicState3ViewportSwizzle,
+        &DeviceFeatures::extendedDynamicState3ViewportWScalingEnable,
+        &DeviceFeatures::extendedDynamicState,
+        &DeviceFeatures::extendedSparseAddressSpace,
+        &DeviceFeatures::externalFormatResolve,
+        &DeviceFeatures::externalMemoryRDMA,
+        &DeviceFeatures::screenBufferImport,
+        &DeviceFeatures::deviceFault,
+        &DeviceFeatures::deviceFaultVendorBinary,
+        &DeviceFeatures::alphaToOne,
+        &DeviceFeatures::depthBiasClamp,
+        &DeviceFeatures::depthBounds,
+        &DeviceFeatures::depthClamp,
+        &DeviceFeatures::drawIndirectFirstInstance,
+        &DeviceFeatures::dualSrcBlend,
+        &DeviceFeatures::fillModeNonSolid,
+        &DeviceFeatures::fragmentStoresAndAtomics,
+        &DeviceFeatures::fullDrawIndexUint32,
+        &DeviceFeatures::geometryShader,
+        &DeviceFeatures::imageCubeArray,
+        &DeviceFeatures::independentBlend,
+        &DeviceFeatures::inheritedQueries,
+        &DeviceFeatures::largePoints,
+        &DeviceFeatures::logicOp,
+        &DeviceFeatures::multiDrawIndirect,
+        &DeviceFeatures::multiViewport,
+        &DeviceFeatures::occlusionQueryPrecise,
+        &DeviceFeatures::pipelineStatisticsQuery,
+        &DeviceFeatures::robustBufferAccess,
+        &DeviceFeatures::sampleRateShading,
+        &DeviceFeatures::samplerAnisotropy,
+        &DeviceFeatures::shaderClipDistance,
+        &DeviceFeatures::shaderCullDistance,
+        &DeviceFeatures::shaderFloat64,
+        &DeviceFeatures::shaderImageGatherExtended,
+        &DeviceFeatures::shaderInt16,
+        &DeviceFeatures::shaderInt64,
+        &DeviceFeatures::shaderResourceMinLod,
+        &DeviceFeatures::shaderResourceResidency,
+        &DeviceFeatures::shaderSampledImageArrayDynamicIndexing,
+        &DeviceFeatures::shaderStorageBufferArrayDynamicIndexing,
+        &DeviceFeatures::shaderStorageImageArrayDynamicIndexing,
+        &DeviceFeatures::shaderStorageImageExtendedFormats,
+        &DeviceFeatures::shaderStorageImageMultisample,
+        &DeviceFeatures::shaderStorageImageReadWithoutFormat,
+        &DeviceFeatures::shaderStorageImageWriteWithoutFormat,
+        &DeviceFeatures::shaderTessellationAndGeometryPointSize,
+        &DeviceFeatures::shaderUniformBufferArrayDynamicIndexing,
+        &DeviceFeatures::sparseBinding,
+        &DeviceFeatures::sparseResidency16Samples,
+        &DeviceFeatures::sparseResidency2Samples,
+        &DeviceFeatures::sparseResidency4Samples,
+        &DeviceFeatures::sparseResidency8Samples,
+        &DeviceFeatures::sparseResidencyAliased,
+        &DeviceFeatures::sparseResidencyBuffer,
+        &DeviceFeatures::sparseResidencyImage2D,
+        &DeviceFeatures::sparseResidencyImage3D,
+        &DeviceFeatures::tessellationShader,
+        &DeviceFeatures::textureCompressionASTC_LDR,
+        &DeviceFeatures::textureCompressionBC,
+        &DeviceFeatures::textureCompressionETC2,
+        &DeviceFeatures::variableMultisampleRate,
+        &DeviceFeatures::vertexPipelineStoresAndAtomics,
+        &DeviceFeatures::wideLines,
+        &DeviceFeatures::fragmentDensityMapDeferred,
+        &DeviceFeatures::fragmentDensityMap,
+        &DeviceFeatures::fragmentDensityMapDynamic,
+        &DeviceFeatures::fragmentDensityMapNonSubsampledImages,
+        &DeviceFeatures::fragmentDensityMapOffset,
+        &DeviceFeatures::fragmentShaderBarycentric,
+        &DeviceFeatures::fragmentShaderPixelInterlock,
+        &DeviceFeatures::fragmentShaderSampleInterlock,
+        &DeviceFeatures::fragmentShaderShadingRateInterlock,
+        &DeviceFeatures::fragmentShadingRateEnums,
+        &DeviceFeatures::noInvocationFragmentShadingRates,
+        &DeviceFeatures::supersampleFragmentShadingRates,
+        &DeviceFeatures::attachmentFragmentShadingRate,
+        &DeviceFeatures::pipelineFragmentShadingRate,
+        &DeviceFeatures::primitiveFragmentShadingRate,
+        &DeviceFeatures::frameBoundary,
+        &DeviceFeatures::globalPriorityQuery,
+        &DeviceFeatures::graphicsPipelineLibrary,
+        &DeviceFeatures::hostImageCopy,
+        &DeviceFeatures::hostQueryReset,
+        &DeviceFeatures::image2DViewOf3D,
+        &DeviceFeatures::sampler2DViewOf3D,
+        &DeviceFeatures::imageAlignmentControl,
+        &DeviceFeatures::imageCompressionControl,
+        &DeviceFeatures::imageCompressionControlSwapchain,
+        &DeviceFeatures::textureBlockMatch2,
+        &DeviceFeatures::textureBlockMatch,
+        &DeviceFeatures::textureBoxFilter,
+        &DeviceFeatures::textureSampleWeighted,
+        &DeviceFeatures::robustImageAccess,
+        &DeviceFeatures::imageSlicedViewOf3D,
+        &DeviceFeatures::minLod,
+        &DeviceFeatures::imagelessFramebuffer,
+        &DeviceFeatures::indexTypeUint8,
+        &DeviceFeatures::inheritedViewportScissor2D,
+        &DeviceFeatures::descriptorBindingInlineUniformBlockUpdateAfterBind,
+        &DeviceFeatures::inlineUniformBlock,
+        &DeviceFeatures::invocationMask,
+        &DeviceFeatures::legacyDithering,
+        &DeviceFeatures::legacyVertexAttributes,
+        &DeviceFeatures::bresenhamLines,
+        &DeviceFeatures::rectangularLines,
+        &DeviceFeatures::smoothLines,
+        &DeviceFeatures::stippledBresenhamLines,
+        &DeviceFeatures::stippledRectangularLines,
+        &DeviceFeatures::stippledSmoothLines,
+        &DeviceFeatures::linearColorAttachment,
+        &DeviceFeatures::maintenance4,
+        &DeviceFeatures::maintenance5,
+        &DeviceFeatures::maintenance6,
+        &DeviceFeatures::memoryMapPlaced,
+        &DeviceFeatures::memoryMapRangePlaced,
+        &DeviceFeatures::memoryUnmapReserve,
+        &DeviceFeatures::memoryDecompression,
+        &DeviceFeatures::memoryPriority,
+        &DeviceFeatures::meshShaderQueries,
+        &DeviceFeatures::multiviewMeshShader,
+        &DeviceFeatures::primitiveFragmentShadingRateMeshShader,
+        &DeviceFeatures::meshShader,
+        &DeviceFeatures::taskShader,
+        &DeviceFeatures::multiDraw,
+        &DeviceFeatures::multisampledRenderToSingleSampled,
+        &DeviceFeatures::multiview,
+        &DeviceFeatures::multiviewGeometryShader,
+        &DeviceFeatures::multiviewTessellationShader,
+        &DeviceFeatures::multiviewPerViewRenderAreas,
+        &DeviceFeatures::multiviewPerViewViewports,
+        &DeviceFeatures::mutableDescriptorType,
+        &DeviceFeatures::nestedCommandBuffer,
+        &DeviceFeatures::nestedCommandBufferRendering,
+        &DeviceFeatures::nestedCommandBufferSimultaneousUse,
+        &DeviceFeatures::nonSeamlessCubeMap,
+        &DeviceFeatures::micromap,
+        &DeviceFeatures::micromapCaptureReplay,
+        &DeviceFeatures::micromapHostCommands,
+        &DeviceFeatures::opticalFlow,
+        &DeviceFeatures::pageableDeviceLocalMemory,
+        &DeviceFeatures::dynamicPipelineLayout,
+        &DeviceFeatures::perStageDescriptorSet,
+        &DeviceFeatures::performanceCounterMultipleQueryPools,
+        &DeviceFeatures::performanceCounterQueryPools,
+        &DeviceFeatures::pipelineCreationCacheControl,
+        &DeviceFeatures::pipelineExecutableInfo,
+        &DeviceFeatures::pipelineLibraryGroupHandles,
+        &DeviceFeatures::pipelinePropertiesIdentifier,
+        &DeviceFeatures::pipelineProtectedAccess,
+        &DeviceFeatures::pipelineRobustness,
+        &DeviceFeatures::constantAlphaColorBlendFactors,
+        &DeviceFeatures::events,
+        &DeviceFeatures::imageView2DOn3DImage,
+        &DeviceFeatures::imageViewFormatReinterpretation,
+        &DeviceFeatures::imageViewFormatSwizzle,
+        &DeviceFeatures::multisampleArrayImage,
+        &DeviceFeatures::mutableComparisonSamplers,
+        &DeviceFeatures::pointPolygons,
+        &DeviceFeatures::samplerMipLodBias,
+        &DeviceFeatures::separateStencilMaskRef,
+        &DeviceFeatures::shaderSampleRateInterpolationFunctions,
+        &DeviceFeatures::tessellationIsolines,
+        &DeviceFeatures::tessellationPointMode,
+        &DeviceFeatures::triangleFans,
+        &DeviceFeatures::vertexAttributeAccessBeyondStride,
+        &DeviceFeatures::presentBarrier,
+        &DeviceFeatures::presentId,
+        &DeviceFeatures::presentWait,
+        &DeviceFeatures::primitiveTopologyListRestart,
+        &DeviceFeatures::primitiveTopologyPatchListRestart,
+        &DeviceFeatures::primitivesGeneratedQuery,
+        &DeviceFeatures::primitivesGeneratedQueryWithNonZeroStreams,
+        &DeviceFeatures::primitivesGeneratedQueryWithRasterizerDiscard,
+        &DeviceFeatures::privateData,
+        &DeviceFeatures::protectedMemory,
+        &DeviceFeatures::provokingVertexLast,
+        &DeviceFeatures::transformFeedbackPreservesProvokingVertex,
+        &DeviceFeatures::formatRgba10x6WithoutYCbCrSampler,
+        &DeviceFeatures::rasterizationOrderColorAttachmentAccess,
+        &DeviceFeatures::rasterizationOrderDepthAttachmentAccess,
+        &DeviceFeatures::rasterizationOrderStencilAttachmentAccess,
+        &DeviceFeatures::shaderRawAccessChains,
+        &DeviceFeatures::rayQuery,
+        &DeviceFeatures::rayTracingInvocationReorder,
+        &DeviceFeatures::rayTracingMaintenance1,
+        &DeviceFeatures::rayTracingPipelineTraceRaysIndirect2,
+        &DeviceFeatures::rayTracingMotionBlur,
+        &DeviceFeatures::rayTracingMotionBlurPipelineTraceRaysIndirect,
+        &DeviceFeatures::rayTracingPipeline,
+        &DeviceFeatures::rayTracingPipelineShaderGroupHandleCaptureReplay,
+        &DeviceFeatures::rayTracingPipelineShaderGroupHandleCaptureReplayMixed,
+        &DeviceFeatures::rayTracingPipelineTraceRaysIndirect,
+        &DeviceFeatures::rayTraversalPrimitiveCulling,
+        &DeviceFeatures::rayTracingPositionFetch,
+        &DeviceFeatures::rayTracingValidation,
+        &DeviceFeatures::relaxedLineRasterization,
+        &DeviceFeatures::renderPassStriped,
+        &DeviceFeatures::representativeFragmentTest,
+        &DeviceFeatures::nullDescriptor,
+        &DeviceFeatures::robustBufferAccess2,
+        &DeviceFeatures::robustImageAccess2,
+        &DeviceFeatures::samplerYcbcrConversion,
+        &DeviceFeatures::scalarBlockLayout,
+        &DeviceFeatures::schedulingControls,
+        &DeviceFeatures::separateDepthStencilLayouts,
+        &DeviceFeatures::shaderFloat16VectorAtomics,
+        &DeviceFeatures::shaderBufferFloat16AtomicAdd,
+        &DeviceFeatures::shaderBufferFloat16AtomicMinMax,
+        &DeviceFeatures::shaderBufferFloat16Atomics,
+        &DeviceFeatures::shaderBufferFloat32AtomicMinMax,
+        &DeviceFeatures::shaderBufferFloat64AtomicMinMax,
+        &DeviceFeatures::shaderImageFloat32AtomicMinMax,
+        &DeviceFeatures::shaderSharedFloat16AtomicAdd,
+        &DeviceFeatures::shaderSharedFloat16AtomicMinMax,
+        &DeviceFeatures::shaderSharedFloat16Atomics,
+        &DeviceFeatures::shaderSharedFloat32AtomicMinMax,
+        &DeviceFeatures::shaderSharedFloat64AtomicMinMax,
+        &DeviceFeatures::sparseImageFloat32AtomicMinMax,
+        &DeviceFeatures::shaderBufferFloat32AtomicAdd,
+        &DeviceFeatures::shaderBufferFloat32Atomics,
+        &DeviceFeatures::shaderBufferFloat64AtomicAdd,
+        &DeviceFeatures::shaderBufferFloat64Atomics,
+        &DeviceFeatures::shaderImageFloat32AtomicAdd,
+        &DeviceFeatures::shaderImageFloat32Atomics,
+        &DeviceFeatures::shaderSharedFloat32AtomicAdd,
+        &DeviceFeatures::shaderSharedFloat32Atomics,
+        &DeviceFeatures::shaderSharedFloat64AtomicAdd,
+        &DeviceFeatures::shaderSharedFloat64Atomics,
+        &DeviceFeatures::sparseImageFloat32AtomicAdd,
+        &DeviceFeatures::sparseImageFloat32Atomics,
+        &DeviceFeatures::shaderBufferInt64Atomics,
+        &DeviceFeatures::shaderSharedInt64Atomics,
+        &DeviceFeatures::shaderDeviceClock,
+        &DeviceFeatures::shaderSubgroupClock,
+        &DeviceFeatures::shaderCoreBuiltins,
+        &DeviceFeatures::shaderDemoteToHelperInvocation,
+        &DeviceFeatures::shaderDrawParameters,
+        &DeviceFeatures::shaderEarlyAndLateFragmentTests,
+        &DeviceFeatures::shaderEnqueue,
+        &DeviceFeatures::shaderExpectAssume,
+        &DeviceFeatures::shaderFloat16,
+        &DeviceFeatures::shaderInt8,
+        &DeviceFeatures::shaderFloatControls2,
+        &DeviceFeatures::shaderImageInt64Atomics,
+        &DeviceFeatures::sparseImageInt64Atomics,
+        &DeviceFeatures::imageFootprint,
+        &DeviceFeatures::shaderIntegerDotProduct,
+        &DeviceFeatures::shaderIntegerFunctions2,
+        &DeviceFeatures::shaderMaximalReconvergence,
+        &DeviceFeatures::shaderModuleIdentifier,
+        &DeviceFeatures::shaderObject,
+        &DeviceFeatures::shaderQuadControl,
+        &DeviceFeatures::shaderSMBuiltins,
+        &DeviceFeatures::shaderSubgroupExtendedTypes,
+        &DeviceFeatures::shaderSubgroupRotate,
+        &DeviceFeatures::shaderSubgroupRotateClustered,
+        &DeviceFeatures::shaderSubgroupUniformControlFlow,
+        &DeviceFeatures::shaderTerminateInvocation,
+        &DeviceFeatures::shaderTileImageColorReadAccess,
+        &DeviceFeatures::shaderTileImageDepthReadAccess,
+        &DeviceFeatures::shaderTileImageStencilReadAccess,
+        &DeviceFeatures::shadingRateCoarseSampleOrder,
+        &DeviceFeatures::shadingRateImage,
+        &DeviceFeatures::computeFullSubgroups,
+        &DeviceFeatures::subgroupSizeControl,
+        &DeviceFeatures::subpassMergeFeedback,
+        &DeviceFeatures::subpassShading,
+        &DeviceFeatures::swapchainMaintenance1,
+        &DeviceFeatures::synchronization2,
+        &DeviceFeatures::texelBufferAlignment,
+        &DeviceFeatures::textureCompressionASTC_HDR,
+        &DeviceFeatures::tileProperties,
+        &DeviceFeatures::timelineSemaphore,
+        &DeviceFeatures::geometryStreams,
+        &DeviceFeatures::transformFeedback,
+        &DeviceFeatures::uniformBufferStandardLayout,
+        &DeviceFeatures::variablePointers,
+        &DeviceFeatures::variablePointersStorageBuffer,
+        &DeviceFeatures::vertexAttributeInstanceRateDivisor,
+        &DeviceFeatures::vertexAttributeInstanceRateZeroDivisor,
+        &DeviceFeatures::vertexInputDynamicState,
+        &DeviceFeatures::videoMaintenance1,
+        &DeviceFeatures::descriptorIndexing,
+        &DeviceFeatures::drawIndirectCount,
+        &DeviceFeatures::samplerFilterMinmax,
+        &DeviceFeatures::samplerMirrorClampToEdge,
+        &DeviceFeatures::shaderOutputLayer,
+        &DeviceFeatures::shaderOutputViewportIndex,
+        &DeviceFeatures::subgroupBroadcastDynamicId,
+        &DeviceFeatures::vulkanMemoryModel,
+        &DeviceFeatures::vulkanMemoryModelAvailabilityVisibilityChains,
+        &DeviceFeatures::vulkanMemoryModelDeviceScope,
+        &DeviceFeatures::shaderZeroInitializeWorkgroupMemory,
+        &DeviceFeatures::workgroupMemoryExplicitLayout,
+        &DeviceFeatures::workgroupMemoryExplicitLayout16BitAccess,
+        &DeviceFeatures::workgroupMemoryExplicitLayout8BitAccess,
+        &DeviceFeatures::workgroupMemoryExplicitLayoutScalarBlockLayout,
+        &DeviceFeatures::ycbcr2plane444Formats,
+        &DeviceFeatures::ycbcrDegamma,
+        &DeviceFeatures::ycbcrImageArrays,
+    };
+    static_assert(std::size(kFeatureMembers) == kDeviceFeatureCount);
+    for (uint32_t i = 0; i < kDeviceFeatureCount; ++i) {
+        features->bits.set(i, features->*kFeatureMembers[i]);
+    }
 }
 
 // NOLINTEND
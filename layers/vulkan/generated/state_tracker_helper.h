@@ -23,6 +23,453 @@
 
 #pragma once
 
+#include <cstdint>
+#include <initializer_list>
+
+#include "containers/fixed_bitset.h"
+
+// One value per member of DeviceFeatures, in the same order
+enum class DeviceFeature : uint16_t {
+    storageBuffer16BitAccess,
+    storageInputOutput16,
+    storagePushConstant16,
+    uniformAndStorageBuffer16BitAccess,
+    formatA4B4G4R4,
+    formatA4R4G4B4,
+    storageBuffer8BitAccess,
+    storagePushConstant8,
+    uniformAndStorageBuffer8BitAccess,
+    decodeModeSharedExponent,
+    accelerationStructure,
+    accelerationStructureCaptureReplay,
+    accelerationStructureHostCommands,
+    accelerationStructureIndirectBuild,
+    descriptorBindingAccelerationStructureUpdateAfterBind,
+    reportAddressBinding,
+    amigoProfiling,
+    attachmentFeedbackLoopDynamicState,
+    attachmentFeedbackLoopLayout,
+    advancedBlendCoherentOperations,
+    borderColorSwizzle,
+    borderColorSwizzleFromImage,
+    bufferDeviceAddress,
+    bufferDeviceAddressCaptureReplay,
+    bufferDeviceAddressMultiDevice,
+    bufferDeviceAddressCaptureReplayEXT,
+    bufferDeviceAddressEXT,
+    bufferDeviceAddressMultiDeviceEXT,
+    clustercullingShader,
+    multiviewClusterCullingShader,
+    clusterShadingRate,
+    deviceCoherentMemory,
+    colorWriteEnable,
+    computeDerivativeGroupLinear,
+    computeDerivativeGroupQuads,
+    conditionalRendering,
+    inheritedConditionalRendering,
+    cooperativeMatrix,
+    cooperativeMatrixRobustBufferAccess,
+    indirectCopy,
+    cornerSampledImage,
+    coverageReductionMode,
+    cubicRangeClamp,
+    selectableCubicWeights,
+    cudaKernelLaunchFeatures,
+    customBorderColorWithoutFormat,
+    customBorderColors,
+    dedicatedAllocationImageAliasing,
+    depthBiasControl,
+    depthBiasExact,
+    floatRepresentation,
+    leastRepresentableValueForceUnormRepresentation,
+    depthClampZeroOne,
+    depthClipControl,
+    depthClipEnable,
+    descriptorBuffer,
+    descriptorBufferCaptureReplay,
+    descriptorBufferImageLayoutIgnored,
+    descriptorBufferPushDescriptors,
+    descriptorBindingPartiallyBound,
+    descriptorBindingSampledImageUpdateAfterBind,
+    descriptorBindingStorageBufferUpdateAfterBind,
+    descriptorBindingStorageImageUpdateAfterBind,
+    descriptorBindingStorageTexelBufferUpdateAfterBind,
+    descriptorBindingUniformBufferUpdateAfterBind,
+    descriptorBindingUniformTexelBufferUpdateAfterBind,
+    descriptorBindingUpdateUnusedWhilePending,
+    descriptorBindingVariableDescriptorCount,
+    runtimeDescriptorArray,
+    shaderInputAttachmentArrayDynamicIndexing,
+    shaderInputAttachmentArrayNonUniformIndexing,
+    shaderSampledImageArrayNonUniformIndexing,
+    shaderStorageBufferArrayNonUniformIndexing,
+    shaderStorageImageArrayNonUniformIndexing,
+    shaderStorageTexelBufferArrayDynamicIndexing,
+    shaderStorageTexelBufferArrayNonUniformIndexing,
+    shaderUniformBufferArrayNonUniformIndexing,
+    shaderUniformTexelBufferArrayDynamicIndexing,
+    shaderUniformTexelBufferArrayNonUniformIndexing,
+    descriptorPoolOverallocation,
+    descriptorSetHostMapping,
+    deviceGeneratedCompute,
+    deviceGeneratedComputeCaptureReplay,
+    deviceGeneratedComputePipelines,
+    deviceGeneratedCommands,
+    deviceMemoryReport,
+    diagnosticsConfig,
+    displacementMicromap,
+    dynamicRendering,
+    dynamicRenderingLocalRead,
+    dynamicRenderingUnusedAttachments,
+    exclusiveScissor,
+    extendedDynamicState2,
+    extendedDynamicState2LogicOp,
+    extendedDynamicState2PatchControlPoints,
+    extendedDynamicState3AlphaToCoverageEnable,
+    extendedDynamicState3AlphaToOneEnable,
+    extendedDynamicState3ColorBlendAdvanced,
+    extendedDynamicState3ColorBlendEnable,
+    extendedDynamicState3ColorBlendEquation,
+    extendedDynamicState3ColorWriteMask,
+    extendedDynamicState3ConservativeRasterizationMode,
+    extendedDynamicState3CoverageModulationMode,
+    extendedDynamicState3CoverageModulationTable,
+    extendedDynamicState3CoverageModulationTableEnable,
+    extendedDynamicState3CoverageReductionMode,
+    extendedDynamicState3CoverageToColorEnable,
+    extendedDynamicState3CoverageToColorLocation,
+    extendedDynamicState3DepthClampEnable,
+    extendedDynamicState3DepthClipEnable,
+    extendedDynamicState3DepthClipNegativeOneToOne,
+    extendedDynamicState3ExtraPrimitiveOverestimationSize,
+    extendedDynamicState3LineRasterizationMode,
+    extendedDynamicState3LineStippleEnable,
+    extendedDynamicState3LogicOpEnable,
+    extendedDynamicState3PolygonMode,
+    extendedDynamicState3ProvokingVertexMode,
+    extendedDynamicState3RasterizationSamples,
+    extendedDynamicState3RasterizationStream,
+    extendedDynamicState3RepresentativeFragmentTestEnable,
+    extendedDynamicState3SampleLocationsEnable,
+    extendedDynamicState3SampleMask,
+    extendedDynamicState3ShadingRateImageEnable,
+    extendedDynamicState3TessellationDomainOrigin,
+    extendedDynamicState3ViewportSwizzle,
+    extendedDynamicState3ViewportWScalingEnable,
+    extendedDynamicState,
+    extendedSparseAddressSpace,
+    externalFormatResolve,
+    externalMemoryRDMA,
+    screenBufferImport,
+    deviceFault,
+    deviceFaultVendorBinary,
+    alphaToOne,
+    depthBiasClamp,
+    depthBounds,
+    depthClamp,
+    drawIndirectFirstInstance,
+    dualSrcBlend,
+    fillModeNonSolid,
+    fragmentStoresAndAtomics,
+    fullDrawIndexUint32,
+    geometryShader,
+    imageCubeArray,
+    independentBlend,
+    inheritedQueries,
+    largePoints,
+    logicOp,
+    multiDrawIndirect,
+    multiViewport,
+    occlusionQueryPrecise,
+    pipelineStatisticsQuery,
+    robustBufferAccess,
+    sampleRateShading,
+    samplerAnisotropy,
+    shaderClipDistance,
+    shaderCullDistance,
+    shaderFloat64,
+    shaderImageGatherExtended,
+    shaderInt16,
+    shaderInt64,
+    shaderResourceMinLod,
+    shaderResourceResidency,
+    shaderSampledImageArrayDynamicIndexing,
+    shaderStorageBufferArrayDynamicIndexing,
+    shaderStorageImageArrayDynamicIndexing,
+    shaderStorageImageExtendedFormats,
+    shaderStorageImageMultisample,
+    shaderStorageImageReadWithoutFormat,
+    shaderStorageImageWriteWithoutFormat,
+    shaderTessellationAndGeometryPointSize,
+    shaderUniformBufferArrayDynamicIndexing,
+    sparseBinding,
+    sparseResidency16Samples,
+    sparseResidency2Samples,
+    sparseResidency4Samples,
+    sparseResidency8Samples,
+    sparseResidencyAliased,
+    sparseResidencyBuffer,
+    sparseResidencyImage2D,
+    sparseResidencyImage3D,
+    tessellationShader,
+    textureCompressionASTC_LDR,
+    textureCompressionBC,
+    textureCompressionETC2,
+    variableMultisampleRate,
+    vertexPipelineStoresAndAtomics,
+    wideLines,
+    fragmentDensityMapDeferred,
+    fragmentDensityMap,
+    fragmentDensityMapDynamic,
+    fragmentDensityMapNonSubsampledImages,
+    fragmentDensityMapOffset,
+    fragmentShaderBarycentric,
+    fragmentShaderPixelInterlock,
+    fragmentShaderSampleInterlock,
+    fragmentShaderShadingRateInterlock,
+    fragmentShadingRateEnums,
+    noInvocationFragmentShadingRates,
+    supersampleFragmentShadingRates,
+    attachmentFragmentShadingRate,
+    pipelineFragmentShadingRate,
+    primitiveFragmentShadingRate,
+    frameBoundary,
+    globalPriorityQuery,
+    graphicsPipelineLibrary,
+    hostImageCopy,
+    hostQueryReset,
+    image2DViewOf3D,
+    sampler2DViewOf3D,
+    imageAlignmentControl,
+    imageCompressionControl,
+    imageCompressionControlSwapchain,
+    textureBlockMatch2,
+    textureBlockMatch,
+    textureBoxFilter,
+    textureSampleWeighted,
+    robustImageAccess,
+    imageSlicedViewOf3D,
+    minLod,
+    imagelessFramebuffer,
+    indexTypeUint8,
+    inheritedViewportScissor2D,
+    descriptorBindingInlineUniformBlockUpdateAfterBind,
+    inlineUniformBlock,
+    invocationMask,
+    legacyDithering,
+    legacyVertexAttributes,
+    bresenhamLines,
+    rectangularLines,
+    smoothLines,
+    stippledBresenhamLines,
+    stippledRectangularLines,
+    stippledSmoothLines,
+    linearColorAttachment,
+    maintenance4,
+    maintenance5,
+    maintenance6,
+    memoryMapPlaced,
+    memoryMapRangePlaced,
+    memoryUnmapReserve,
+    memoryDecompression,
+    memoryPriority,
+    meshShaderQueries,
+    multiviewMeshShader,
+    primitiveFragmentShadingRateMeshShader,
+    meshShader,
+    taskShader,
+    multiDraw,
+    multisampledRenderToSingleSampled,
+    multiview,
+    multiviewGeometryShader,
+    multiviewTessellationShader,
+    multiviewPerViewRenderAreas,
+    multiviewPerViewViewports,
+    mutableDescriptorType,
+    nestedCommandBuffer,
+    nestedCommandBufferRendering,
+    nestedCommandBufferSimultaneousUse,
+    nonSeamlessCubeMap,
+    micromap,
+    micromapCaptureReplay,
+    micromapHostCommands,
+    opticalFlow,
+    pageableDeviceLocalMemory,
+    dynamicPipelineLayout,
+    perStageDescriptorSet,
+    performanceCounterMultipleQueryPools,
+    performanceCounterQueryPools,
+    pipelineCreationCacheControl,
+    pipelineExecutableInfo,
+    pipelineLibraryGroupHandles,
+    pipelinePropertiesIdentifier,
+    pipelineProtectedAccess,
+    pipelineRobustness,
+    constantAlphaColorBlendFactors,
+    events,
+    imageView2DOn3DImage,
+    imageViewFormatReinterpretation,
+    imageViewFormatSwizzle,
+    multisampleArrayImage,
+    mutableComparisonSamplers,
+    pointPolygons,
+    samplerMipLodBias,
+    separateStencilMaskRef,
+    shaderSampleRateInterpolationFunctions,
+    tessellationIsolines,
+    tessellationPointMode,
+    triangleFans,
+    vertexAttributeAccessBeyondStride,
+    presentBarrier,
+    presentId,
+    presentWait,
+    primitiveTopologyListRestart,
+    primitiveTopologyPatchListRestart,
+    primitivesGeneratedQuery,
+    primitivesGeneratedQueryWithNonZeroStreams,
+    primitivesGeneratedQueryWithRasterizerDiscard,
+    privateData,
+    protectedMemory,
+    provokingVertexLast,
+    transformFeedbackPreservesProvokingVertex,
+    formatRgba10x6WithoutYCbCrSampler,
+    rasterizationOrderColorAttachmentAccess,
+    rasterizationOrderDepthAttachmentAccess,
+    rasterizationOrderStencilAttachmentAccess,
+    shaderRawAccessChains,
+    rayQuery,
+    rayTracingInvocationReorder,
+    rayTracingMaintenance1,
+    rayTracingPipelineTraceRaysIndirect2,
+    rayTracingMotionBlur,
+    rayTracingMotionBlurPipelineTraceRaysIndirect,
+    rayTracingPipeline,
+    rayTracingPipelineShaderGroupHandleCaptureReplay,
+    rayTracingPipelineShaderGroupHandleCaptureReplayMixed,
+    rayTracingPipelineTraceRaysIndirect,
+    rayTraversalPrimitiveCulling,
+    rayTracingPositionFetch,
+    rayTracingValidation,
+    relaxedLineRasterization,
+    renderPassStriped,
+    representativeFragmentTest,
+    nullDescriptor,
+    robustBufferAccess2,
+    robustImageAccess2,
+    samplerYcbcrConversion,
+    scalarBlockLayout,
+    schedulingControls,
+    separateDepthStencilLayouts,
+    shaderFloat16VectorAtomics,
+    shaderBufferFloat16AtomicAdd,
+    shaderBufferFloat16AtomicMinMax,
+    shaderBufferFloat16Atomics,
+    shaderBufferFloat32AtomicMinMax,
+    shaderBufferFloat64AtomicMinMax,
+    shaderImageFloat32AtomicMinMax,
+    shaderSharedFloat16AtomicAdd,
+    shaderSharedFloat16AtomicMinMax,
+    shaderSharedFloat16Atomics,
+    shaderSharedFloat32AtomicMinMax,
+    shaderSharedFloat64AtomicMinMax,
+    sparseImageFloat32AtomicMinMax,
+    shaderBufferFloat32AtomicAdd,
+    shaderBufferFloat32Atomics,
+    shaderBufferFloat64AtomicAdd,
+    shaderBufferFloat64Atomics,
+    shaderImageFloat32AtomicAdd,
+    shaderImageFloat32Atomics,
+    shaderSharedFloat32AtomicAdd,
+    shaderSharedFloat32Atomics,
+    shaderSharedFloat64AtomicAdd,
+    shaderSharedFloat64Atomics,
+    sparseImageFloat32AtomicAdd,
+    sparseImageFloat32Atomics,
+    shaderBufferInt64Atomics,
+    shaderSharedInt64Atomics,
+    shaderDeviceClock,
+    shaderSubgroupClock,
+    shaderCoreBuiltins,
+    shaderDemoteToHelperInvocation,
+    shaderDrawParameters,
+    shaderEarlyAndLateFragmentTests,
+    shaderEnqueue,
+    shaderExpectAssume,
+    shaderFloat16,
+    shaderInt8,
+    shaderFloatControls2,
+    shaderImageInt64Atomics,
+    sparseImageInt64Atomics,
+    imageFootprint,
+    shaderIntegerDotProduct,
+    shaderIntegerFunctions2,
+    shaderMaximalReconvergence,
+    shaderModuleIdentifier,
+    shaderObject,
+    shaderQuadControl,
+    shaderSMBuiltins,
+    shaderSubgroupExtendedTypes,
+    shaderSubgroupRotate,
+    shaderSubgroupRotateClustered,
+    shaderSubgroupUniformControlFlow,
+    shaderTerminateInvocation,
+    shaderTileImageColorReadAccess,
+    shaderTileImageDepthReadAccess,
+    shaderTileImageStencilReadAccess,
+    shadingRateCoarseSampleOrder,
+    shadingRateImage,
+    computeFullSubgroups,
+    subgroupSizeControl,
+    subpassMergeFeedback,
+    subpassShading,
+    swapchainMaintenance1,
+    synchronization2,
+    texelBufferAlignment,
+    textureCompressionASTC_HDR,
+    tileProperties,
+    timelineSemaphore,
+    geometryStreams,
+    transformFeedback,
+    uniformBufferStandardLayout,
+    variablePointers,
+    variablePointersStorageBuffer,
+    vertexAttributeInstanceRateDivisor,
+    vertexAttributeInstanceRateZeroDivisor,
+    vertexInputDynamicState,
+    videoMaintenance1,
+    descriptorIndexing,
+    drawIndirectCount,
+    samplerFilterMinmax,
+    samplerMirrorClampToEdge,
+    shaderOutputLayer,
+    shaderOutputViewportIndex,
+    subgroupBroadcastDynamicId,
+    vulkanMemoryModel,
+    vulkanMemoryModelAvailabilityVisibilityChains,
+    vulkanMemoryModelDeviceScope,
+    shaderZeroInitializeWorkgroupMemory,
+    workgroupMemoryExplicitLayout,
+    workgroupMemoryExplicitLayout16BitAccess,
+    workgroupMemoryExplicitLayout8BitAccess,
+    workgroupMemoryExplicitLayoutScalarBlockLayout,
+    ycbcr2plane444Formats,
+    ycbcrDegamma,
+    ycbcrImageArrays,
+};
+// Number of DeviceFeature values
+constexpr uint32_t kDeviceFeatureCount = 425;
+
+// One bit per DeviceFeature, see DeviceFeatures::bits
+using DeviceFeatureBits = vvl::FixedBitset<((kDeviceFeatureCount + 63) / 64) * 64>;
+
+constexpr DeviceFeatureBits MakeDeviceFeatureBits(std::initializer_list<DeviceFeature> features) {
+    DeviceFeatureBits bits;
+    for (const DeviceFeature feature : features) {
+        bits.set(static_cast<size_t>(feature));
+    }
+    return bits;
+}
+
 // Union of all features defined in VkPhysicalDevice*Features* structs
 struct DeviceFeatures {
     // VkPhysicalDevice16BitStorageFeatures, VkPhysicalDeviceVulkan11Features
@@ -875,6 +1322,13 @@ struct DeviceFeatures {
     bool ycbcrDegamma;
     // VkPhysicalDeviceYcbcrImageArraysFeaturesEXT
     bool ycbcrImageArrays;
+
+    // The features above packed in a couple of cache lines. Checks that need several features test them all at once
+    // against a constexpr mask, with one AND per word, ex. enabled_features.IsAnyEnabled(kNullIndexBufferFeatures)
+    DeviceFeatureBits bits;
+
+    bool IsAllEnabled(const DeviceFeatureBits &mask) const { return mask.AndNot(bits).none(); }
+    bool IsAnyEnabled(const DeviceFeatureBits &mask) const { return bits.Intersects(mask); }
 };
 
 void GetEnabledDeviceFeatures(const VkDeviceCreateInfo *pCreateInfo, DeviceFeatures *features, const APIVersion &api_version);
@@ -4751,10 +4751,10 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                                       kVUIDUndefined, "VUID-VkPipelineLayoutCreateInfo-pPushConstantRanges-parameter");
 
                 if (structure->pPushConstantRanges != nullptr) {
+                    [[maybe_unused]] Location pPushConstantRanges_loc = pNext_loc.dot(Field::pPushConstantRanges);
                     for (uint32_t pushConstantRangeIndex = 0; pushConstantRangeIndex < structure->pushConstantRangeCount;
                          ++pushConstantRangeIndex) {
-                        [[maybe_unused]] const Location pPushConstantRanges_loc =
-                            pNext_loc.dot(Field::pPushConstantRanges, pushConstantRangeIndex);
+                        pPushConstantRanges_loc.index = pushConstantRangeIndex;
                         skip |= ValidateFlags(pPushConstantRanges_loc.dot(Field::stageFlags),
                                               vvl::FlagBitmask::VkShaderStageFlagBits, AllVkShaderStageFlagBits,
                                               structure->pPushConstantRanges[pushConstantRangeIndex].stageFlags, kRequiredFlags,
@@ -4832,14 +4832,6 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                 skip |= ValidateArray(pNext_loc.dot(Field::deviceRenderAreaCount), pNext_loc.dot(Field::pDeviceRenderAreas),
                                       structure->deviceRenderAreaCount, &structure->pDeviceRenderAreas, false, true, kVUIDUndefined,
                                       "VUID-VkDeviceGroupRenderPassBeginInfo-pDeviceRenderAreas-parameter");
-
-                if (structure->pDeviceRenderAreas != nullptr) {
-                    for (uint32_t deviceRenderAreaIndex = 0; deviceRenderAreaIndex < structure->deviceRenderAreaCount;
-                         ++deviceRenderAreaIndex) {
-                        [[maybe_unused]] const Location pDeviceRenderAreas_loc =
-                            pNext_loc.dot(Field::pDeviceRenderAreas, deviceRenderAreaIndex);
-                    }
-                }
             }
         } break;
 
@@ -4948,14 +4940,6 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                                       pNext_loc.dot(Field::pSplitInstanceBindRegions), structure->splitInstanceBindRegionCount,
                                       &structure->pSplitInstanceBindRegions, false, true, kVUIDUndefined,
                                       "VUID-VkBindImageMemoryDeviceGroupInfo-pSplitInstanceBindRegions-parameter");
-
-                if (structure->pSplitInstanceBindRegions != nullptr) {
-                    for (uint32_t splitInstanceBindRegionIndex = 0;
-                         splitInstanceBindRegionIndex < structure->splitInstanceBindRegionCount; ++splitInstanceBindRegionIndex) {
-                        [[maybe_unused]] const Location pSplitInstanceBindRegions_loc =
-                            pNext_loc.dot(Field::pSplitInstanceBindRegions, splitInstanceBindRegionIndex);
-                    }
-                }
             }
         } break;
 
@@ -5140,10 +5124,10 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                                       "VUID-VkRenderPassInputAttachmentAspectCreateInfo-pAspectReferences-parameter");
 
                 if (structure->pAspectReferences != nullptr) {
+                    [[maybe_unused]] Location pAspectReferences_loc = pNext_loc.dot(Field::pAspectReferences);
                     for (uint32_t aspectReferenceIndex = 0; aspectReferenceIndex < structure->aspectReferenceCount;
                          ++aspectReferenceIndex) {
-                        [[maybe_unused]] const Location pAspectReferences_loc =
-                            pNext_loc.dot(Field::pAspectReferences, aspectReferenceIndex);
+                        pAspectReferences_loc.index = aspectReferenceIndex;
                         skip |=
                             ValidateFlags(pAspectReferences_loc.dot(Field::aspectMask), vvl::FlagBitmask::VkImageAspectFlagBits,
                                           AllVkImageAspectFlagBits, structure->pAspectReferences[aspectReferenceIndex].aspectMask,
@@ -5677,10 +5661,10 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                     "VUID-VkFramebufferAttachmentsCreateInfo-pAttachmentImageInfos-parameter", kVUIDUndefined);
 
                 if (structure->pAttachmentImageInfos != nullptr) {
+                    [[maybe_unused]] Location pAttachmentImageInfos_loc = pNext_loc.dot(Field::pAttachmentImageInfos);
                     for (uint32_t attachmentImageInfoIndex = 0; attachmentImageInfoIndex < structure->attachmentImageInfoCount;
                          ++attachmentImageInfoIndex) {
-                        [[maybe_unused]] const Location pAttachmentImageInfos_loc =
-                            pNext_loc.dot(Field::pAttachmentImageInfos, attachmentImageInfoIndex);
+                        pAttachmentImageInfos_loc.index = attachmentImageInfoIndex;
                         skip |= ValidateFlags(pAttachmentImageInfos_loc.dot(Field::flags), vvl::FlagBitmask::VkImageCreateFlagBits,
                                               AllVkImageCreateFlagBits,
                                               structure->pAttachmentImageInfos[attachmentImageInfoIndex].flags, kOptionalFlags,
@@ -5858,23 +5842,10 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                     ValidateRequiredPointer(pNext_loc.dot(Field::pPipelineCreationFeedback), structure->pPipelineCreationFeedback,
                                             "VUID-VkPipelineCreationFeedbackCreateInfo-pPipelineCreationFeedback-parameter");
 
-                if (structure->pPipelineCreationFeedback != nullptr) {
-                    [[maybe_unused]] const Location pPipelineCreationFeedback_loc = pNext_loc.dot(Field::pPipelineCreationFeedback);
-                }
-
                 skip |= ValidateArray(
                     pNext_loc.dot(Field::pipelineStageCreationFeedbackCount), pNext_loc.dot(Field::pPipelineStageCreationFeedbacks),
                     structure->pipelineStageCreationFeedbackCount, &structure->pPipelineStageCreationFeedbacks, false, true,
                     kVUIDUndefined, "VUID-VkPipelineCreationFeedbackCreateInfo-pPipelineStageCreationFeedbacks-parameter");
-
-                if (structure->pPipelineStageCreationFeedbacks != nullptr) {
-                    for (uint32_t pipelineStageCreationFeedbackIndex = 0;
-                         pipelineStageCreationFeedbackIndex < structure->pipelineStageCreationFeedbackCount;
-                         ++pipelineStageCreationFeedbackIndex) {
-                        [[maybe_unused]] const Location pPipelineStageCreationFeedbacks_loc =
-                            pNext_loc.dot(Field::pPipelineStageCreationFeedbacks, pipelineStageCreationFeedbackIndex);
-                    }
-                }
             }
         } break;
 
@@ -6152,8 +6123,9 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                     "VUID-VkVideoProfileInfoKHR-sType-sType", "VUID-VkVideoProfileListInfoKHR-pProfiles-parameter", kVUIDUndefined);
 
                 if (structure->pProfiles != nullptr) {
+                    [[maybe_unused]] Location pProfiles_loc = pNext_loc.dot(Field::pProfiles);
                     for (uint32_t profileIndex = 0; profileIndex < structure->profileCount; ++profileIndex) {
-                        [[maybe_unused]] const Location pProfiles_loc = pNext_loc.dot(Field::pProfiles, profileIndex);
+                        pProfiles_loc.index = profileIndex;
                         skip |= ValidateFlags(
                             pProfiles_loc.dot(Field::videoCodecOperation), vvl::FlagBitmask::VkVideoCodecOperationFlagBitsKHR,
                             AllVkVideoCodecOperationFlagBitsKHR, structure->pProfiles[profileIndex].videoCodecOperation,
@@ -6226,10 +6198,6 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                     structure->pParametersAddInfo, VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_ADD_INFO_KHR, false,
                     "VUID-VkVideoEncodeH264SessionParametersCreateInfoKHR-pParametersAddInfo-parameter",
                     "VUID-VkVideoEncodeH264SessionParametersAddInfoKHR-sType-sType");
-
-                if (structure->pParametersAddInfo != nullptr) {
-                    [[maybe_unused]] const Location pParametersAddInfo_loc = pNext_loc.dot(Field::pParametersAddInfo);
-                }
             }
         } break;
 
@@ -6262,10 +6230,10 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                                                 "VUID-VkVideoEncodeH264PictureInfoKHR-naluSliceEntryCount-arraylength");
 
                 if (structure->pNaluSliceEntries != nullptr) {
+                    [[maybe_unused]] Location pNaluSliceEntries_loc = pNext_loc.dot(Field::pNaluSliceEntries);
                     for (uint32_t naluSliceEntryIndex = 0; naluSliceEntryIndex < structure->naluSliceEntryCount;
                          ++naluSliceEntryIndex) {
-                        [[maybe_unused]] const Location pNaluSliceEntries_loc =
-                            pNext_loc.dot(Field::pNaluSliceEntries, naluSliceEntryIndex);
+                        pNaluSliceEntries_loc.index = naluSliceEntryIndex;
                         skip |= ValidateRequiredPointer(pNaluSliceEntries_loc.dot(Field::pStdSliceHeader),
                                                         structure->pNaluSliceEntries[naluSliceEntryIndex].pStdSliceHeader,
                                                         "VUID-VkVideoEncodeH264NaluSliceInfoKHR-pStdSliceHeader-parameter");
@@ -6359,10 +6327,6 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                     structure->pParametersAddInfo, VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_ADD_INFO_KHR, false,
                     "VUID-VkVideoEncodeH265SessionParametersCreateInfoKHR-pParametersAddInfo-parameter",
                     "VUID-VkVideoEncodeH265SessionParametersAddInfoKHR-sType-sType");
-
-                if (structure->pParametersAddInfo != nullptr) {
-                    [[maybe_unused]] const Location pParametersAddInfo_loc = pNext_loc.dot(Field::pParametersAddInfo);
-                }
             }
         } break;
 
@@ -6397,10 +6361,10 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                     "VUID-VkVideoEncodeH265PictureInfoKHR-naluSliceSegmentEntryCount-arraylength");
 
                 if (structure->pNaluSliceSegmentEntries != nullptr) {
+                    [[maybe_unused]] Location pNaluSliceSegmentEntries_loc = pNext_loc.dot(Field::pNaluSliceSegmentEntries);
                     for (uint32_t naluSliceSegmentEntryIndex = 0;
                          naluSliceSegmentEntryIndex < structure->naluSliceSegmentEntryCount; ++naluSliceSegmentEntryIndex) {
-                        [[maybe_unused]] const Location pNaluSliceSegmentEntries_loc =
-                            pNext_loc.dot(Field::pNaluSliceSegmentEntries, naluSliceSegmentEntryIndex);
+                        pNaluSliceSegmentEntries_loc.index = naluSliceSegmentEntryIndex;
                         skip |= ValidateRequiredPointer(
                             pNaluSliceSegmentEntries_loc.dot(Field::pStdSliceSegmentHeader),
                             structure->pNaluSliceSegmentEntries[naluSliceSegmentEntryIndex].pStdSliceSegmentHeader,
@@ -6695,19 +6659,6 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                     ValidateArray(pNext_loc.dot(Field::swapchainCount), pNext_loc.dot(Field::pRegions), structure->swapchainCount,
                                   &structure->pRegions, true, false, "VUID-VkPresentRegionsKHR-swapchainCount-arraylength",
                                   "VUID-VkPresentRegionsKHR-pRegions-parameter");
-
-                if (structure->pRegions != nullptr) {
-                    for (uint32_t swapchainIndex = 0; swapchainIndex < structure->swapchainCount; ++swapchainIndex) {
-                        [[maybe_unused]] const Location pRegions_loc = pNext_loc.dot(Field::pRegions, swapchainIndex);
-                        if (structure->pRegions[swapchainIndex].pRectangles != nullptr) {
-                            for (uint32_t rectangleIndex = 0; rectangleIndex < structure->pRegions[swapchainIndex].rectangleCount;
-                                 ++rectangleIndex) {
-                                [[maybe_unused]] const Location pRectangles_loc =
-                                    pRegions_loc.dot(Field::pRectangles, rectangleIndex);
-                            }
-                        }
-                    }
-                }
             }
         } break;
 
@@ -6969,12 +6920,6 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                                                 structure->pLayers, VK_STRUCTURE_TYPE_VIDEO_ENCODE_RATE_CONTROL_LAYER_INFO_KHR,
                                                 false, true, "VUID-VkVideoEncodeRateControlLayerInfoKHR-sType-sType",
                                                 "VUID-VkVideoEncodeRateControlInfoKHR-pLayers-parameter", kVUIDUndefined);
-
-                if (structure->pLayers != nullptr) {
-                    for (uint32_t layerIndex = 0; layerIndex < structure->layerCount; ++layerIndex) {
-                        [[maybe_unused]] const Location pLayers_loc = pNext_loc.dot(Field::pLayers, layerIndex);
-                    }
-                }
             }
         } break;
 
@@ -7088,14 +7033,6 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                                       structure->vertexBindingDivisorCount, &structure->pVertexBindingDivisors, true, true,
                                       "VUID-VkPipelineVertexInputDivisorStateCreateInfoKHR-vertexBindingDivisorCount-arraylength",
                                       "VUID-VkPipelineVertexInputDivisorStateCreateInfoKHR-pVertexBindingDivisors-parameter");
-
-                if (structure->pVertexBindingDivisors != nullptr) {
-                    for (uint32_t vertexBindingDivisorIndex = 0; vertexBindingDivisorIndex < structure->vertexBindingDivisorCount;
-                         ++vertexBindingDivisorIndex) {
-                        [[maybe_unused]] const Location pVertexBindingDivisors_loc =
-                            pNext_loc.dot(Field::pVertexBindingDivisors, vertexBindingDivisorIndex);
-                    }
-                }
             }
         } break;
 
@@ -7412,12 +7349,6 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                 skip |= ValidateArray(pNext_loc.dot(Field::swapchainCount), pNext_loc.dot(Field::pTimes), structure->swapchainCount,
                                       &structure->pTimes, true, false, "VUID-VkPresentTimesInfoGOOGLE-swapchainCount-arraylength",
                                       "VUID-VkPresentTimesInfoGOOGLE-pTimes-parameter");
-
-                if (structure->pTimes != nullptr) {
-                    for (uint32_t swapchainIndex = 0; swapchainIndex < structure->swapchainCount; ++swapchainIndex) {
-                        [[maybe_unused]] const Location pTimes_loc = pNext_loc.dot(Field::pTimes, swapchainIndex);
-                    }
-                }
             }
         } break;
 
@@ -7440,9 +7371,9 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                                       "VUID-VkPipelineViewportSwizzleStateCreateInfoNV-pViewportSwizzles-parameter");
 
                 if (structure->pViewportSwizzles != nullptr) {
+                    [[maybe_unused]] Location pViewportSwizzles_loc = pNext_loc.dot(Field::pViewportSwizzles);
                     for (uint32_t viewportIndex = 0; viewportIndex < structure->viewportCount; ++viewportIndex) {
-                        [[maybe_unused]] const Location pViewportSwizzles_loc =
-                            pNext_loc.dot(Field::pViewportSwizzles, viewportIndex);
+                        pViewportSwizzles_loc.index = viewportIndex;
                         skip |= ValidateRangedEnum(pViewportSwizzles_loc.dot(Field::x), vvl::Enum::VkViewportCoordinateSwizzleNV,
                                                    structure->pViewportSwizzles[viewportIndex].x,
                                                    "VUID-VkViewportSwizzleNV-x-parameter");
@@ -7603,14 +7534,6 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                 skip |= ValidateArray(pNext_loc.dot(Field::sampleLocationsCount), pNext_loc.dot(Field::pSampleLocations),
                                       structure->sampleLocationsCount, &structure->pSampleLocations, false, true, kVUIDUndefined,
                                       "VUID-VkSampleLocationsInfoEXT-pSampleLocations-parameter");
-
-                if (structure->pSampleLocations != nullptr) {
-                    for (uint32_t sampleLocationsIndex = 0; sampleLocationsIndex < structure->sampleLocationsCount;
-                         ++sampleLocationsIndex) {
-                        [[maybe_unused]] const Location pSampleLocations_loc =
-                            pNext_loc.dot(Field::pSampleLocations, sampleLocationsIndex);
-                    }
-                }
             }
         } break;
 
@@ -7631,11 +7554,12 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                                       "VUID-VkRenderPassSampleLocationsBeginInfoEXT-pAttachmentInitialSampleLocations-parameter");
 
                 if (structure->pAttachmentInitialSampleLocations != nullptr) {
+                    [[maybe_unused]] Location pAttachmentInitialSampleLocations_loc =
+                        pNext_loc.dot(Field::pAttachmentInitialSampleLocations);
                     for (uint32_t attachmentInitialSampleLocationsIndex = 0;
                          attachmentInitialSampleLocationsIndex < structure->attachmentInitialSampleLocationsCount;
                          ++attachmentInitialSampleLocationsIndex) {
-                        [[maybe_unused]] const Location pAttachmentInitialSampleLocations_loc =
-                            pNext_loc.dot(Field::pAttachmentInitialSampleLocations, attachmentInitialSampleLocationsIndex);
+                        pAttachmentInitialSampleLocations_loc.index = attachmentInitialSampleLocationsIndex;
                         skip |=
                             ValidateStructType(pAttachmentInitialSampleLocations_loc.dot(Field::sampleLocationsInfo),
                                                "VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT",
@@ -7655,13 +7579,14 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
                         if (structure->pAttachmentInitialSampleLocations[attachmentInitialSampleLocationsIndex]
                                 .sampleLocationsInfo.pSampleLocations != nullptr) {
+                            [[maybe_unused]] Location pSampleLocations_loc =
+                                pAttachmentInitialSampleLocations_loc.dot(Field::pSampleLocations);
                             for (uint32_t sampleLocationsIndex = 0;
                                  sampleLocationsIndex <
                                  structure->pAttachmentInitialSampleLocations[attachmentInitialSampleLocationsIndex]
                                      .sampleLocationsInfo.sampleLocationsCount;
                                  ++sampleLocationsIndex) {
-                                [[maybe_unused]] const Location pSampleLocations_loc =
-                                    pAttachmentInitialSampleLocations_loc.dot(Field::pSampleLocations, sampleLocationsIndex);
+                                pSampleLocations_loc.index = sampleLocationsIndex;
                             }
                         }
                     }
@@ -7673,11 +7598,11 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                                       "VUID-VkRenderPassSampleLocationsBeginInfoEXT-pPostSubpassSampleLocations-parameter");
 
                 if (structure->pPostSubpassSampleLocations != nullptr) {
+                    [[maybe_unused]] Location pPostSubpassSampleLocations_loc = pNext_loc.dot(Field::pPostSubpassSampleLocations);
                     for (uint32_t postSubpassSampleLocationsIndex = 0;
                          postSubpassSampleLocationsIndex < structure->postSubpassSampleLocationsCount;
                          ++postSubpassSampleLocationsIndex) {
-                        [[maybe_unused]] const Location pPostSubpassSampleLocations_loc =
-                            pNext_loc.dot(Field::pPostSubpassSampleLocations, postSubpassSampleLocationsIndex);
+                        pPostSubpassSampleLocations_loc.index = postSubpassSampleLocationsIndex;
                         skip |= ValidateStructType(
                             pPostSubpassSampleLocations_loc.dot(Field::sampleLocationsInfo),
                             "VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT",
@@ -7696,12 +7621,13 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
                         if (structure->pPostSubpassSampleLocations[postSubpassSampleLocationsIndex]
                                 .sampleLocationsInfo.pSampleLocations != nullptr) {
+                            [[maybe_unused]] Location pSampleLocations_loc =
+                                pPostSubpassSampleLocations_loc.dot(Field::pSampleLocations);
                             for (uint32_t sampleLocationsIndex = 0;
                                  sampleLocationsIndex < structure->pPostSubpassSampleLocations[postSubpassSampleLocationsIndex]
                                                             .sampleLocationsInfo.sampleLocationsCount;
                                  ++sampleLocationsIndex) {
-                                [[maybe_unused]] const Location pSampleLocations_loc =
-                                    pPostSubpassSampleLocations_loc.dot(Field::pSampleLocations, sampleLocationsIndex);
+                                pSampleLocations_loc.index = sampleLocationsIndex;
                             }
                         }
                     }
@@ -7729,14 +7655,6 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                                       structure->sampleLocationsInfo.sampleLocationsCount,
                                       &structure->sampleLocationsInfo.pSampleLocations, false, true, kVUIDUndefined,
                                       "VUID-VkSampleLocationsInfoEXT-pSampleLocations-parameter");
-
-                if (structure->sampleLocationsInfo.pSampleLocations != nullptr) {
-                    for (uint32_t sampleLocationsIndex = 0;
-                         sampleLocationsIndex < structure->sampleLocationsInfo.sampleLocationsCount; ++sampleLocationsIndex) {
-                        [[maybe_unused]] const Location pSampleLocations_loc =
-                            pNext_loc.dot(Field::pSampleLocations, sampleLocationsIndex);
-                    }
-                }
             }
         } break;
 
@@ -7848,14 +7766,6 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                                       structure->drmFormatModifierPlaneCount, &structure->pPlaneLayouts, true, true,
                                       "VUID-VkImageDrmFormatModifierExplicitCreateInfoEXT-drmFormatModifierPlaneCount-arraylength",
                                       "VUID-VkImageDrmFormatModifierExplicitCreateInfoEXT-pPlaneLayouts-parameter");
-
-                if (structure->pPlaneLayouts != nullptr) {
-                    for (uint32_t drmFormatModifierPlaneIndex = 0;
-                         drmFormatModifierPlaneIndex < structure->drmFormatModifierPlaneCount; ++drmFormatModifierPlaneIndex) {
-                        [[maybe_unused]] const Location pPlaneLayouts_loc =
-                            pNext_loc.dot(Field::pPlaneLayouts, drmFormatModifierPlaneIndex);
-                    }
-                }
             }
         } break;
 
@@ -7912,10 +7822,10 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                                   "VUID-VkPipelineViewportCoarseSampleOrderStateCreateInfoNV-pCustomSampleOrders-parameter");
 
                 if (structure->pCustomSampleOrders != nullptr) {
+                    [[maybe_unused]] Location pCustomSampleOrders_loc = pNext_loc.dot(Field::pCustomSampleOrders);
                     for (uint32_t customSampleOrderIndex = 0; customSampleOrderIndex < structure->customSampleOrderCount;
                          ++customSampleOrderIndex) {
-                        [[maybe_unused]] const Location pCustomSampleOrders_loc =
-                            pNext_loc.dot(Field::pCustomSampleOrders, customSampleOrderIndex);
+                        pCustomSampleOrders_loc.index = customSampleOrderIndex;
                         skip |= ValidateRangedEnum(pCustomSampleOrders_loc.dot(Field::shadingRate),
                                                    vvl::Enum::VkShadingRatePaletteEntryNV,
                                                    structure->pCustomSampleOrders[customSampleOrderIndex].shadingRate,
@@ -7927,15 +7837,6 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                                               &structure->pCustomSampleOrders[customSampleOrderIndex].pSampleLocations, true, true,
                                               "VUID-VkCoarseSampleOrderCustomNV-sampleLocationCount-arraylength",
                                               "VUID-VkCoarseSampleOrderCustomNV-pSampleLocations-parameter");
-
-                        if (structure->pCustomSampleOrders[customSampleOrderIndex].pSampleLocations != nullptr) {
-                            for (uint32_t sampleLocationIndex = 0;
-                                 sampleLocationIndex < structure->pCustomSampleOrders[customSampleOrderIndex].sampleLocationCount;
-                                 ++sampleLocationIndex) {
-                                [[maybe_unused]] const Location pSampleLocations_loc =
-                                    pCustomSampleOrders_loc.dot(Field::pSampleLocations, sampleLocationIndex);
-                            }
-                        }
                     }
                 }
             }
@@ -8335,8 +8236,9 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                                             "VUID-VkGraphicsPipelineShaderGroupsCreateInfoNV-pGroups-parameter", kVUIDUndefined);
 
                 if (structure->pGroups != nullptr) {
+                    [[maybe_unused]] Location pGroups_loc = pNext_loc.dot(Field::pGroups);
                     for (uint32_t groupIndex = 0; groupIndex < structure->groupCount; ++groupIndex) {
-                        [[maybe_unused]] const Location pGroups_loc = pNext_loc.dot(Field::pGroups, groupIndex);
+                        pGroups_loc.index = groupIndex;
                         skip |= ValidateStructTypeArray(
                             pGroups_loc.dot(Field::stageCount), pGroups_loc.dot(Field::pStages),
                             "VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO", structure->pGroups[groupIndex].stageCount,
@@ -8346,8 +8248,9 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                             "VUID-VkGraphicsShaderGroupCreateInfoNV-stageCount-arraylength");
 
                         if (structure->pGroups[groupIndex].pStages != nullptr) {
+                            [[maybe_unused]] Location pStages_loc = pGroups_loc.dot(Field::pStages);
                             for (uint32_t stageIndex = 0; stageIndex < structure->pGroups[groupIndex].stageCount; ++stageIndex) {
-                                [[maybe_unused]] const Location pStages_loc = pGroups_loc.dot(Field::pStages, stageIndex);
+                                pStages_loc.index = stageIndex;
                                 skip |= ValidateFlags(pStages_loc.dot(Field::flags),
                                                       vvl::FlagBitmask::VkPipelineShaderStageCreateFlagBits,
                                                       AllVkPipelineShaderStageCreateFlagBits,
@@ -8376,12 +8279,12 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
                                     if (structure->pGroups[groupIndex].pStages[stageIndex].pSpecializationInfo->pMapEntries !=
                                         nullptr) {
+                                        [[maybe_unused]] Location pMapEntries_loc = pSpecializationInfo_loc.dot(Field::pMapEntries);
                                         for (uint32_t mapEntryIndex = 0;
                                              mapEntryIndex <
                                              structure->pGroups[groupIndex].pStages[stageIndex].pSpecializationInfo->mapEntryCount;
                                              ++mapEntryIndex) {
-                                            [[maybe_unused]] const Location pMapEntries_loc =
-                                                pSpecializationInfo_loc.dot(Field::pMapEntries, mapEntryIndex);
+                                            pMapEntries_loc.index = mapEntryIndex;
                                         }
                                     }
 
@@ -8734,11 +8637,11 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                                       "VUID-VkMutableDescriptorTypeCreateInfoEXT-pMutableDescriptorTypeLists-parameter");
 
                 if (structure->pMutableDescriptorTypeLists != nullptr) {
+                    [[maybe_unused]] Location pMutableDescriptorTypeLists_loc = pNext_loc.dot(Field::pMutableDescriptorTypeLists);
                     for (uint32_t mutableDescriptorTypeListIndex = 0;
                          mutableDescriptorTypeListIndex < structure->mutableDescriptorTypeListCount;
                          ++mutableDescriptorTypeListIndex) {
-                        [[maybe_unused]] const Location pMutableDescriptorTypeLists_loc =
-                            pNext_loc.dot(Field::pMutableDescriptorTypeLists, mutableDescriptorTypeListIndex);
+                        pMutableDescriptorTypeLists_loc.index = mutableDescriptorTypeListIndex;
                         skip |= ValidateRangedEnumArray(
                             pMutableDescriptorTypeLists_loc.dot(Field::descriptorTypeCount),
                             pMutableDescriptorTypeLists_loc.dot(Field::pDescriptorTypes), vvl::Enum::VkDescriptorType,
@@ -8928,18 +8831,6 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                     (VkAccelerationStructureTrianglesOpacityMicromapEXT*)header;
                 skip |= ValidateRangedEnum(pNext_loc.dot(Field::indexType), vvl::Enum::VkIndexType, structure->indexType,
                                            "VUID-VkAccelerationStructureTrianglesOpacityMicromapEXT-indexType-parameter");
-
-                if (structure->pUsageCounts != nullptr) {
-                    for (uint32_t usageIndexsIndex = 0; usageIndexsIndex < structure->usageCountsCount; ++usageIndexsIndex) {
-                        [[maybe_unused]] const Location pUsageCounts_loc = pNext_loc.dot(Field::pUsageCounts, usageIndexsIndex);
-                    }
-                }
-
-                if (structure->ppUsageCounts != nullptr) {
-                    for (uint32_t usageIndexsIndex = 0; usageIndexsIndex < structure->usageCountsCount; ++usageIndexsIndex) {
-                        [[maybe_unused]] const Location ppUsageCounts_loc = pNext_loc.dot(Field::ppUsageCounts, usageIndexsIndex);
-                    }
-                }
             }
         } break;
 #ifdef VK_ENABLE_BETA_EXTENSIONS
@@ -8967,18 +8858,6 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
 
                 skip |= ValidateRangedEnum(pNext_loc.dot(Field::indexType), vvl::Enum::VkIndexType, structure->indexType,
                                            "VUID-VkAccelerationStructureTrianglesDisplacementMicromapNV-indexType-parameter");
-
-                if (structure->pUsageCounts != nullptr) {
-                    for (uint32_t usageIndexsIndex = 0; usageIndexsIndex < structure->usageCountsCount; ++usageIndexsIndex) {
-                        [[maybe_unused]] const Location pUsageCounts_loc = pNext_loc.dot(Field::pUsageCounts, usageIndexsIndex);
-                    }
-                }
-
-                if (structure->ppUsageCounts != nullptr) {
-                    for (uint32_t usageIndexsIndex = 0; usageIndexsIndex < structure->usageCountsCount; ++usageIndexsIndex) {
-                        [[maybe_unused]] const Location ppUsageCounts_loc = pNext_loc.dot(Field::ppUsageCounts, usageIndexsIndex);
-                    }
-                }
             }
         } break;
 #endif  // VK_ENABLE_BETA_EXTENSIONS
@@ -9047,12 +8926,6 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                                                 "VUID-VkRenderPassStripeInfoARM-sType-sType",
                                                 "VUID-VkRenderPassStripeBeginInfoARM-pStripeInfos-parameter",
                                                 "VUID-VkRenderPassStripeBeginInfoARM-stripeInfoCount-arraylength");
-
-                if (structure->pStripeInfos != nullptr) {
-                    for (uint32_t stripeInfoIndex = 0; stripeInfoIndex < structure->stripeInfoCount; ++stripeInfoIndex) {
-                        [[maybe_unused]] const Location pStripeInfos_loc = pNext_loc.dot(Field::pStripeInfos, stripeInfoIndex);
-                    }
-                }
             }
         } break;
 
@@ -9074,10 +8947,10 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                                                 "VUID-VkRenderPassStripeSubmitInfoARM-stripeSemaphoreInfoCount-arraylength");
 
                 if (structure->pStripeSemaphoreInfos != nullptr) {
+                    [[maybe_unused]] Location pStripeSemaphoreInfos_loc = pNext_loc.dot(Field::pStripeSemaphoreInfos);
                     for (uint32_t stripeSemaphoreInfoIndex = 0; stripeSemaphoreInfoIndex < structure->stripeSemaphoreInfoCount;
                          ++stripeSemaphoreInfoIndex) {
-                        [[maybe_unused]] const Location pStripeSemaphoreInfos_loc =
-                            pNext_loc.dot(Field::pStripeSemaphoreInfos, stripeSemaphoreInfoIndex);
+                        pStripeSemaphoreInfos_loc.index = stripeSemaphoreInfoIndex;
                         skip |= ValidateRequiredHandle(pStripeSemaphoreInfos_loc.dot(Field::semaphore),
                                                        structure->pStripeSemaphoreInfos[stripeSemaphoreInfoIndex].semaphore);
 
@@ -9104,14 +8977,6 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                                       pNext_loc.dot(Field::pFragmentDensityOffsets), structure->fragmentDensityOffsetCount,
                                       &structure->pFragmentDensityOffsets, false, true, kVUIDUndefined,
                                       "VUID-VkSubpassFragmentDensityMapOffsetEndInfoQCOM-pFragmentDensityOffsets-parameter");
-
-                if (structure->pFragmentDensityOffsets != nullptr) {
-                    for (uint32_t fragmentDensityOffsetIndex = 0;
-                         fragmentDensityOffsetIndex < structure->fragmentDensityOffsetCount; ++fragmentDensityOffsetIndex) {
-                        [[maybe_unused]] const Location pFragmentDensityOffsets_loc =
-                            pNext_loc.dot(Field::pFragmentDensityOffsets, fragmentDensityOffsetIndex);
-                    }
-                }
             }
         } break;
 
@@ -9160,10 +9025,6 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                 VkRenderPassCreationFeedbackCreateInfoEXT* structure = (VkRenderPassCreationFeedbackCreateInfoEXT*)header;
                 skip |= ValidateRequiredPointer(pNext_loc.dot(Field::pRenderPassFeedback), structure->pRenderPassFeedback,
                                                 "VUID-VkRenderPassCreationFeedbackCreateInfoEXT-pRenderPassFeedback-parameter");
-
-                if (structure->pRenderPassFeedback != nullptr) {
-                    [[maybe_unused]] const Location pRenderPassFeedback_loc = pNext_loc.dot(Field::pRenderPassFeedback);
-                }
             }
         } break;
 
@@ -9179,10 +9040,6 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                 VkRenderPassSubpassFeedbackCreateInfoEXT* structure = (VkRenderPassSubpassFeedbackCreateInfoEXT*)header;
                 skip |= ValidateRequiredPointer(pNext_loc.dot(Field::pSubpassFeedback), structure->pSubpassFeedback,
                                                 "VUID-VkRenderPassSubpassFeedbackCreateInfoEXT-pSubpassFeedback-parameter");
-
-                if (structure->pSubpassFeedback != nullptr) {
-                    [[maybe_unused]] const Location pSubpassFeedback_loc = pNext_loc.dot(Field::pSubpassFeedback);
-                }
             }
         } break;
 
@@ -9202,8 +9059,9 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                                                 "VUID-VkDirectDriverLoadingListLUNARG-driverCount-arraylength");
 
                 if (structure->pDrivers != nullptr) {
+                    [[maybe_unused]] Location pDrivers_loc = pNext_loc.dot(Field::pDrivers);
                     for (uint32_t driverIndex = 0; driverIndex < structure->driverCount; ++driverIndex) {
-                        [[maybe_unused]] const Location pDrivers_loc = pNext_loc.dot(Field::pDrivers, driverIndex);
+                        pDrivers_loc.index = driverIndex;
                         skip |= ValidateReservedFlags(pDrivers_loc.dot(Field::flags), structure->pDrivers[driverIndex].flags,
                                                       "VUID-VkDirectDriverLoadingInfoLUNARG-flags-zerobitmask");
                     }
@@ -9275,8 +9133,9 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                                       "VUID-VkLayerSettingsCreateInfoEXT-pSettings-parameter");
 
                 if (structure->pSettings != nullptr) {
+                    [[maybe_unused]] Location pSettings_loc = pNext_loc.dot(Field::pSettings);
                     for (uint32_t settingIndex = 0; settingIndex < structure->settingCount; ++settingIndex) {
-                        [[maybe_unused]] const Location pSettings_loc = pNext_loc.dot(Field::pSettings, settingIndex);
+                        pSettings_loc.index = settingIndex;
                         skip |= ValidateRequiredPointer(pSettings_loc.dot(Field::pLayerName),
                                                         structure->pSettings[settingIndex].pLayerName,
                                                         "VUID-VkLayerSettingEXT-pLayerName-parameter");
@@ -9331,14 +9190,6 @@ bool StatelessValidation::ValidatePnextStructContents(const Location& loc, const
                     ValidateArray(pNext_loc.dot(Field::perViewRenderAreaCount), pNext_loc.dot(Field::pPerViewRenderAreas),
                                   structure->perViewRenderAreaCount, &structure->pPerViewRenderAreas, false, true, kVUIDUndefined,
                                   "VUID-VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM-pPerViewRenderAreas-parameter");
-
-                if (structure->pPerViewRenderAreas != nullptr) {
-                    for (uint32_t perViewRenderAreaIndex = 0; perViewRenderAreaIndex < structure->perViewRenderAreaCount;
-                         ++perViewRenderAreaIndex) {
-                        [[maybe_unused]] const Location pPerViewRenderAreas_loc =
-                            pNext_loc.dot(Field::pPerViewRenderAreas, perViewRenderAreaIndex);
-                    }
-                }
             }
         } break;
 
@@ -9581,10 +9432,6 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceFormatProperties(VkPhy
                                "VUID-vkGetPhysicalDeviceFormatProperties-format-parameter");
     skip |= ValidateRequiredPointer(loc.dot(Field::pFormatProperties), pFormatProperties,
                                     "VUID-vkGetPhysicalDeviceFormatProperties-pFormatProperties-parameter");
-    if (pFormatProperties != nullptr) {
-        [[maybe_unused]] const Location pFormatProperties_loc = loc.dot(Field::pFormatProperties);
-        // No xml-driven validation
-    }
     return skip;
 }
 
@@ -9608,10 +9455,6 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceImageFormatProperties(
                           kOptionalFlags, "VUID-vkGetPhysicalDeviceImageFormatProperties-flags-parameter");
     skip |= ValidateRequiredPointer(loc.dot(Field::pImageFormatProperties), pImageFormatProperties,
                                     "VUID-vkGetPhysicalDeviceImageFormatProperties-pImageFormatProperties-parameter");
-    if (pImageFormatProperties != nullptr) {
-        [[maybe_unused]] const Location pImageFormatProperties_loc = loc.dot(Field::pImageFormatProperties);
-        // No xml-driven validation
-    }
     if (!skip)
         skip |= manual_PreCallValidateGetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags,
                                                                              pImageFormatProperties, error_obj);
@@ -9625,10 +9468,6 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceProperties(VkPhysicalD
     [[maybe_unused]] const Location loc = error_obj.location;
     skip |= ValidateRequiredPointer(loc.dot(Field::pProperties), pProperties,
                                     "VUID-vkGetPhysicalDeviceProperties-pProperties-parameter");
-    if (pProperties != nullptr) {
-        [[maybe_unused]] const Location pProperties_loc = loc.dot(Field::pProperties);
-        // No xml-driven validation
-    }
     return skip;
 }
 
@@ -9642,14 +9481,6 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceQueueFamilyProperties(
                                  pQueueFamilyPropertyCount, &pQueueFamilyProperties, true, false, false,
                                  "VUID-vkGetPhysicalDeviceQueueFamilyProperties-pQueueFamilyPropertyCount-parameter",
                                  kVUIDUndefined, "VUID-vkGetPhysicalDeviceQueueFamilyProperties-pQueueFamilyProperties-parameter");
-    if (pQueueFamilyProperties != nullptr) {
-        for (uint32_t pQueueFamilyPropertyIndex = 0; pQueueFamilyPropertyIndex < *pQueueFamilyPropertyCount;
-             ++pQueueFamilyPropertyIndex) {
-            [[maybe_unused]] const Location pQueueFamilyProperties_loc =
-                loc.dot(Field::pQueueFamilyProperties, pQueueFamilyPropertyIndex);
-            // No xml-driven validation
-        }
-    }
     return skip;
 }
 
@@ -9660,10 +9491,6 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceMemoryProperties(VkPhy
     [[maybe_unused]] const Location loc = error_obj.location;
     skip |= ValidateRequiredPointer(loc.dot(Field::pMemoryProperties), pMemoryProperties,
                                     "VUID-vkGetPhysicalDeviceMemoryProperties-pMemoryProperties-parameter");
-    if (pMemoryProperties != nullptr) {
-        [[maybe_unused]] const Location pMemoryProperties_loc = loc.dot(Field::pMemoryProperties);
-        // No xml-driven validation
-    }
     return skip;
 }
 
@@ -9890,10 +9717,10 @@ bool StatelessValidation::PreCallValidateCreateDevice(VkPhysicalDevice physicalD
             "VUID-VkDeviceCreateInfo-pQueueCreateInfos-parameter", "VUID-VkDeviceCreateInfo-queueCreateInfoCount-arraylength");
 
         if (pCreateInfo->pQueueCreateInfos != nullptr) {
+            [[maybe_unused]] Location pQueueCreateInfos_loc = pCreateInfo_loc.dot(Field::pQueueCreateInfos);
             for (uint32_t queueCreateInfoIndex = 0; queueCreateInfoIndex < pCreateInfo->queueCreateInfoCount;
                  ++queueCreateInfoIndex) {
-                [[maybe_unused]] const Location pQueueCreateInfos_loc =
-                    pCreateInfo_loc.dot(Field::pQueueCreateInfos, queueCreateInfoIndex);
+                pQueueCreateInfos_loc.index = queueCreateInfoIndex;
                 constexpr std::array allowed_structs_VkDeviceQueueCreateInfo = {
                     VK_STRUCTURE_TYPE_DEVICE_QUEUE_GLOBAL_PRIORITY_CREATE_INFO_KHR,
                     VK_STRUCTURE_TYPE_DEVICE_QUEUE_SHADER_CORE_CONTROL_CREATE_INFO_ARM};
@@ -10157,8 +9984,9 @@ bool StatelessValidation::PreCallValidateQueueSubmit(VkQueue queue, uint32_t sub
                                     submitCount, pSubmits, VK_STRUCTURE_TYPE_SUBMIT_INFO, false, true,
                                     "VUID-VkSubmitInfo-sType-sType", "VUID-vkQueueSubmit-pSubmits-parameter", kVUIDUndefined);
     if (pSubmits != nullptr) {
+        [[maybe_unused]] Location pSubmits_loc = loc.dot(Field::pSubmits);
         for (uint32_t submitIndex = 0; submitIndex < submitCount; ++submitIndex) {
-            [[maybe_unused]] const Location pSubmits_loc = loc.dot(Field::pSubmits, submitIndex);
+            pSubmits_loc.index = submitIndex;
             constexpr std::array allowed_structs_VkSubmitInfo = {VK_STRUCTURE_TYPE_AMIGO_PROFILING_SUBMIT_INFO_SEC,
                                                                  VK_STRUCTURE_TYPE_D3D12_FENCE_SUBMIT_INFO_KHR,
                                                                  VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO,
@@ -10334,8 +10162,9 @@ bool StatelessValidation::PreCallValidateFlushMappedMemoryRanges(VkDevice device
         pMemoryRanges, VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE, true, true, "VUID-VkMappedMemoryRange-sType-sType",
         "VUID-vkFlushMappedMemoryRanges-pMemoryRanges-parameter", "VUID-vkFlushMappedMemoryRanges-memoryRangeCount-arraylength");
     if (pMemoryRanges != nullptr) {
+        [[maybe_unused]] Location pMemoryRanges_loc = loc.dot(Field::pMemoryRanges);
         for (uint32_t memoryRangeIndex = 0; memoryRangeIndex < memoryRangeCount; ++memoryRangeIndex) {
-            [[maybe_unused]] const Location pMemoryRanges_loc = loc.dot(Field::pMemoryRanges, memoryRangeIndex);
+            pMemoryRanges_loc.index = memoryRangeIndex;
             skip |= ValidateStructPnext(pMemoryRanges_loc, pMemoryRanges[memoryRangeIndex].pNext, 0, nullptr,
                                         GeneratedVulkanHeaderVersion, "VUID-VkMappedMemoryRange-pNext-pNext", kVUIDUndefined,
                                         VK_NULL_HANDLE, true);
@@ -10357,8 +10186,9 @@ bool StatelessValidation::PreCallValidateInvalidateMappedMemoryRanges(VkDevice d
                                     "VUID-vkInvalidateMappedMemoryRanges-pMemoryRanges-parameter",
                                     "VUID-vkInvalidateMappedMemoryRanges-memoryRangeCount-arraylength");
     if (pMemoryRanges != nullptr) {
+        [[maybe_unused]] Location pMemoryRanges_loc = loc.dot(Field::pMemoryRanges);
         for (uint32_t memoryRangeIndex = 0; memoryRangeIndex < memoryRangeCount; ++memoryRangeIndex) {
-            [[maybe_unused]] const Location pMemoryRanges_loc = loc.dot(Field::pMemoryRanges, memoryRangeIndex);
+            pMemoryRanges_loc.index = memoryRangeIndex;
             skip |= ValidateStructPnext(pMemoryRanges_loc, pMemoryRanges[memoryRangeIndex].pNext, 0, nullptr,
                                         GeneratedVulkanHeaderVersion, "VUID-VkMappedMemoryRange-pNext-pNext", kVUIDUndefined,
                                         VK_NULL_HANDLE, true);
@@ -10406,10 +10236,6 @@ bool StatelessValidation::PreCallValidateGetBufferMemoryRequirements(VkDevice de
     skip |= ValidateRequiredHandle(loc.dot(Field::buffer), buffer);
     skip |= ValidateRequiredPointer(loc.dot(Field::pMemoryRequirements), pMemoryRequirements,
                                     "VUID-vkGetBufferMemoryRequirements-pMemoryRequirements-parameter");
-    if (pMemoryRequirements != nullptr) {
-        [[maybe_unused]] const Location pMemoryRequirements_loc = loc.dot(Field::pMemoryRequirements);
-        // No xml-driven validation
-    }
     return skip;
 }
 
@@ -10421,10 +10247,6 @@ bool StatelessValidation::PreCallValidateGetImageMemoryRequirements(VkDevice dev
     skip |= ValidateRequiredHandle(loc.dot(Field::image), image);
     skip |= ValidateRequiredPointer(loc.dot(Field::pMemoryRequirements), pMemoryRequirements,
                                     "VUID-vkGetImageMemoryRequirements-pMemoryRequirements-parameter");
-    if (pMemoryRequirements != nullptr) {
-        [[maybe_unused]] const Location pMemoryRequirements_loc = loc.dot(Field::pMemoryRequirements);
-        // No xml-driven validation
-    }
     return skip;
 }
 
@@ -10438,14 +10260,6 @@ bool StatelessValidation::PreCallValidateGetImageSparseMemoryRequirements(
                                  pSparseMemoryRequirementCount, &pSparseMemoryRequirements, true, false, false,
                                  "VUID-vkGetImageSparseMemoryRequirements-pSparseMemoryRequirementCount-parameter", kVUIDUndefined,
                                  "VUID-vkGetImageSparseMemoryRequirements-pSparseMemoryRequirements-parameter");
-    if (pSparseMemoryRequirements != nullptr) {
-        for (uint32_t pSparseMemoryRequirementIndex = 0; pSparseMemoryRequirementIndex < *pSparseMemoryRequirementCount;
-             ++pSparseMemoryRequirementIndex) {
-            [[maybe_unused]] const Location pSparseMemoryRequirements_loc =
-                loc.dot(Field::pSparseMemoryRequirements, pSparseMemoryRequirementIndex);
-            // No xml-driven validation
-        }
-    }
     return skip;
 }
 
@@ -10470,12 +10284,6 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceSparseImageFormatPrope
     skip |= ValidatePointerArray(loc.dot(Field::pPropertyCount), loc.dot(Field::pProperties), pPropertyCount, &pProperties, true,
                                  false, false, "VUID-vkGetPhysicalDeviceSparseImageFormatProperties-pPropertyCount-parameter",
                                  kVUIDUndefined, "VUID-vkGetPhysicalDeviceSparseImageFormatProperties-pProperties-parameter");
-    if (pProperties != nullptr) {
-        for (uint32_t pPropertyIndex = 0; pPropertyIndex < *pPropertyCount; ++pPropertyIndex) {
-            [[maybe_unused]] const Location pProperties_loc = loc.dot(Field::pProperties, pPropertyIndex);
-            // No xml-driven validation
-        }
-    }
     return skip;
 }
 
@@ -10488,8 +10296,9 @@ bool StatelessValidation::PreCallValidateQueueBindSparse(VkQueue queue, uint32_t
                                 bindInfoCount, pBindInfo, VK_STRUCTURE_TYPE_BIND_SPARSE_INFO, false, true,
                                 "VUID-VkBindSparseInfo-sType-sType", "VUID-vkQueueBindSparse-pBindInfo-parameter", kVUIDUndefined);
     if (pBindInfo != nullptr) {
+        [[maybe_unused]] Location pBindInfo_loc = loc.dot(Field::pBindInfo);
         for (uint32_t bindInfoIndex = 0; bindInfoIndex < bindInfoCount; ++bindInfoIndex) {
-            [[maybe_unused]] const Location pBindInfo_loc = loc.dot(Field::pBindInfo, bindInfoIndex);
+            pBindInfo_loc.index = bindInfoIndex;
             constexpr std::array allowed_structs_VkBindSparseInfo = {VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO,
                                                                      VK_STRUCTURE_TYPE_FRAME_BOUNDARY_EXT,
                                                                      VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO};
@@ -10508,8 +10317,9 @@ bool StatelessValidation::PreCallValidateQueueBindSparse(VkQueue queue, uint32_t
                                   kVUIDUndefined, "VUID-VkBindSparseInfo-pBufferBinds-parameter");
 
             if (pBindInfo[bindInfoIndex].pBufferBinds != nullptr) {
+                [[maybe_unused]] Location pBufferBinds_loc = pBindInfo_loc.dot(Field::pBufferBinds);
                 for (uint32_t bufferBindIndex = 0; bufferBindIndex < pBindInfo[bindInfoIndex].bufferBindCount; ++bufferBindIndex) {
-                    [[maybe_unused]] const Location pBufferBinds_loc = pBindInfo_loc.dot(Field::pBufferBinds, bufferBindIndex);
+                    pBufferBinds_loc.index = bufferBindIndex;
                     skip |= ValidateRequiredHandle(pBufferBinds_loc.dot(Field::buffer),
                                                    pBindInfo[bindInfoIndex].pBufferBinds[bufferBindIndex].buffer);
 
@@ -10520,9 +10330,10 @@ bool StatelessValidation::PreCallValidateQueueBindSparse(VkQueue queue, uint32_t
                                           "VUID-VkSparseBufferMemoryBindInfo-pBinds-parameter");
 
                     if (pBindInfo[bindInfoIndex].pBufferBinds[bufferBindIndex].pBinds != nullptr) {
+                        [[maybe_unused]] Location pBinds_loc = pBufferBinds_loc.dot(Field::pBinds);
                         for (uint32_t bindIndex = 0; bindIndex < pBindInfo[bindInfoIndex].pBufferBinds[bufferBindIndex].bindCount;
                              ++bindIndex) {
-                            [[maybe_unused]] const Location pBinds_loc = pBufferBinds_loc.dot(Field::pBinds, bindIndex);
+                            pBinds_loc.index = bindIndex;
                             skip |= ValidateFlags(pBinds_loc.dot(Field::flags), vvl::FlagBitmask::VkSparseMemoryBindFlagBits,
                                                   AllVkSparseMemoryBindFlagBits,
                                                   pBindInfo[bindInfoIndex].pBufferBinds[bufferBindIndex].pBinds[bindIndex].flags,
@@ -10537,10 +10348,10 @@ bool StatelessValidation::PreCallValidateQueueBindSparse(VkQueue queue, uint32_t
                                   true, kVUIDUndefined, "VUID-VkBindSparseInfo-pImageOpaqueBinds-parameter");
 
             if (pBindInfo[bindInfoIndex].pImageOpaqueBinds != nullptr) {
+                [[maybe_unused]] Location pImageOpaqueBinds_loc = pBindInfo_loc.dot(Field::pImageOpaqueBinds);
                 for (uint32_t imageOpaqueBindIndex = 0; imageOpaqueBindIndex < pBindInfo[bindInfoIndex].imageOpaqueBindCount;
                      ++imageOpaqueBindIndex) {
-                    [[maybe_unused]] const Location pImageOpaqueBinds_loc =
-                        pBindInfo_loc.dot(Field::pImageOpaqueBinds, imageOpaqueBindIndex);
+                    pImageOpaqueBinds_loc.index = imageOpaqueBindIndex;
                     skip |= ValidateRequiredHandle(pImageOpaqueBinds_loc.dot(Field::image),
                                                    pBindInfo[bindInfoIndex].pImageOpaqueBinds[imageOpaqueBindIndex].image);
 
@@ -10551,9 +10362,10 @@ bool StatelessValidation::PreCallValidateQueueBindSparse(VkQueue queue, uint32_t
                                           "VUID-VkSparseImageOpaqueMemoryBindInfo-pBinds-parameter");
 
                     if (pBindInfo[bindInfoIndex].pImageOpaqueBinds[imageOpaqueBindIndex].pBinds != nullptr) {
+                        [[maybe_unused]] Location pBinds_loc = pImageOpaqueBinds_loc.dot(Field::pBinds);
                         for (uint32_t bindIndex = 0;
                              bindIndex < pBindInfo[bindInfoIndex].pImageOpaqueBinds[imageOpaqueBindIndex].bindCount; ++bindIndex) {
-                            [[maybe_unused]] const Location pBinds_loc = pImageOpaqueBinds_loc.dot(Field::pBinds, bindIndex);
+                            pBinds_loc.index = bindIndex;
                             skip |= ValidateFlags(
                                 pBinds_loc.dot(Field::flags), vvl::FlagBitmask::VkSparseMemoryBindFlagBits,
                                 AllVkSparseMemoryBindFlagBits,
@@ -10569,8 +10381,9 @@ bool StatelessValidation::PreCallValidateQueueBindSparse(VkQueue queue, uint32_t
                                   kVUIDUndefined, "VUID-VkBindSparseInfo-pImageBinds-parameter");
 
             if (pBindInfo[bindInfoIndex].pImageBinds != nullptr) {
+                [[maybe_unused]] Location pImageBinds_loc = pBindInfo_loc.dot(Field::pImageBinds);
                 for (uint32_t imageBindIndex = 0; imageBindIndex < pBindInfo[bindInfoIndex].imageBindCount; ++imageBindIndex) {
-                    [[maybe_unused]] const Location pImageBinds_loc = pBindInfo_loc.dot(Field::pImageBinds, imageBindIndex);
+                    pImageBinds_loc.index = imageBindIndex;
                     skip |= ValidateRequiredHandle(pImageBinds_loc.dot(Field::image),
                                                    pBindInfo[bindInfoIndex].pImageBinds[imageBindIndex].image);
 
@@ -10581,9 +10394,10 @@ bool StatelessValidation::PreCallValidateQueueBindSparse(VkQueue queue, uint32_t
                                           "VUID-VkSparseImageMemoryBindInfo-pBinds-parameter");
 
                     if (pBindInfo[bindInfoIndex].pImageBinds[imageBindIndex].pBinds != nullptr) {
+                        [[maybe_unused]] Location pBinds_loc = pImageBinds_loc.dot(Field::pBinds);
                         for (uint32_t bindIndex = 0; bindIndex < pBindInfo[bindInfoIndex].pImageBinds[imageBindIndex].bindCount;
                              ++bindIndex) {
-                            [[maybe_unused]] const Location pBinds_loc = pImageBinds_loc.dot(Field::pBinds, bindIndex);
+                            pBinds_loc.index = bindIndex;
                             skip |= ValidateFlags(
                                 pBinds_loc.dot(Field::aspectMask), vvl::FlagBitmask::VkImageAspectFlagBits,
                                 AllVkImageAspectFlagBits,
@@ -10591,10 +10405,6 @@ bool StatelessValidation::PreCallValidateQueueBindSparse(VkQueue queue, uint32_t
                                 kRequiredFlags, "VUID-VkImageSubresource-aspectMask-parameter",
                                 "VUID-VkImageSubresource-aspectMask-requiredbitmask");
 
-                            // No xml-driven validation
-
-                            // No xml-driven validation
-
                             skip |= ValidateFlags(pBinds_loc.dot(Field::flags), vvl::FlagBitmask::VkSparseMemoryBindFlagBits,
                                                   AllVkSparseMemoryBindFlagBits,
                                                   pBindInfo[bindInfoIndex].pImageBinds[imageBindIndex].pBinds[bindIndex].flags,
@@ -11251,8 +11061,6 @@ bool StatelessValidation::PreCallValidateCreateImage(VkDevice device, const VkIm
         skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::format), vvl::Enum::VkFormat, pCreateInfo->format,
                                    "VUID-VkImageCreateInfo-format-parameter");
 
-        // No xml-driven validation
-
         skip |= ValidateFlags(pCreateInfo_loc.dot(Field::samples), vvl::FlagBitmask::VkSampleCountFlagBits,
                               AllVkSampleCountFlagBits, pCreateInfo->samples, kRequiredSingleBit,
                               "VUID-VkImageCreateInfo-samples-parameter", "VUID-VkImageCreateInfo-samples-parameter");
@@ -11668,8 +11476,9 @@ bool StatelessValidation::PreCallValidateCreateGraphicsPipelines(VkDevice device
         "VUID-VkGraphicsPipelineCreateInfo-sType-sType", "VUID-vkCreateGraphicsPipelines-pCreateInfos-parameter",
         "VUID-vkCreateGraphicsPipelines-createInfoCount-arraylength");
     if (pCreateInfos != nullptr) {
+        [[maybe_unused]] Location pCreateInfos_loc = loc.dot(Field::pCreateInfos);
         for (uint32_t createInfoIndex = 0; createInfoIndex < createInfoCount; ++createInfoIndex) {
-            [[maybe_unused]] const Location pCreateInfos_loc = loc.dot(Field::pCreateInfos, createInfoIndex);
+            pCreateInfos_loc.index = createInfoIndex;
             constexpr std::array allowed_structs_VkGraphicsPipelineCreateInfo = {
                 VK_STRUCTURE_TYPE_ATTACHMENT_SAMPLE_COUNT_INFO_AMD,
                 VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID,
@@ -11765,8 +11574,9 @@ bool StatelessValidation::PreCallValidateCreateComputePipelines(VkDevice device,
         "VUID-VkComputePipelineCreateInfo-sType-sType", "VUID-vkCreateComputePipelines-pCreateInfos-parameter",
         "VUID-vkCreateComputePipelines-createInfoCount-arraylength");
     if (pCreateInfos != nullptr) {
+        [[maybe_unused]] Location pCreateInfos_loc = loc.dot(Field::pCreateInfos);
         for (uint32_t createInfoIndex = 0; createInfoIndex < createInfoCount; ++createInfoIndex) {
-            [[maybe_unused]] const Location pCreateInfos_loc = loc.dot(Field::pCreateInfos, createInfoIndex);
+            pCreateInfos_loc.index = createInfoIndex;
             constexpr std::array allowed_structs_VkComputePipelineCreateInfo = {
                 VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_INDIRECT_BUFFER_INFO_NV,
                 VK_STRUCTURE_TYPE_PIPELINE_COMPILER_CONTROL_CREATE_INFO_AMD,
@@ -11820,15 +11630,6 @@ bool StatelessValidation::PreCallValidateCreateComputePipelines(VkDevice device,
                                       &pCreateInfos[createInfoIndex].stage.pSpecializationInfo->pMapEntries, false, true,
                                       kVUIDUndefined, "VUID-VkSpecializationInfo-pMapEntries-parameter");
 
-                if (pCreateInfos[createInfoIndex].stage.pSpecializationInfo->pMapEntries != nullptr) {
-                    for (uint32_t mapEntryIndex = 0;
-                         mapEntryIndex < pCreateInfos[createInfoIndex].stage.pSpecializationInfo->mapEntryCount; ++mapEntryIndex) {
-                        [[maybe_unused]] const Location pMapEntries_loc =
-                            pSpecializationInfo_loc.dot(Field::pMapEntries, mapEntryIndex);
-                        // No xml-driven validation
-                    }
-                }
-
                 skip |= ValidateArray(pSpecializationInfo_loc.dot(Field::dataSize), pSpecializationInfo_loc.dot(Field::pData),
                                       pCreateInfos[createInfoIndex].stage.pSpecializationInfo->dataSize,
                                       &pCreateInfos[createInfoIndex].stage.pSpecializationInfo->pData, false, true, kVUIDUndefined,
@@ -11928,10 +11729,10 @@ bool StatelessValidation::PreCallValidateCreatePipelineLayout(VkDevice device, c
                               "VUID-VkPipelineLayoutCreateInfo-pPushConstantRanges-parameter");
 
         if (pCreateInfo->pPushConstantRanges != nullptr) {
+            [[maybe_unused]] Location pPushConstantRanges_loc = pCreateInfo_loc.dot(Field::pPushConstantRanges);
             for (uint32_t pushConstantRangeIndex = 0; pushConstantRangeIndex < pCreateInfo->pushConstantRangeCount;
                  ++pushConstantRangeIndex) {
-                [[maybe_unused]] const Location pPushConstantRanges_loc =
-                    pCreateInfo_loc.dot(Field::pPushConstantRanges, pushConstantRangeIndex);
+                pPushConstantRanges_loc.index = pushConstantRangeIndex;
                 skip |= ValidateFlags(pPushConstantRanges_loc.dot(Field::stageFlags), vvl::FlagBitmask::VkShaderStageFlagBits,
                                       AllVkShaderStageFlagBits, pCreateInfo->pPushConstantRanges[pushConstantRangeIndex].stageFlags,
                                       kRequiredFlags, "VUID-VkPushConstantRange-stageFlags-parameter",
@@ -12148,8 +11949,9 @@ bool StatelessValidation::PreCallValidateCreateDescriptorSetLayout(VkDevice devi
                               "VUID-VkDescriptorSetLayoutCreateInfo-pBindings-parameter");
 
         if (pCreateInfo->pBindings != nullptr) {
+            [[maybe_unused]] Location pBindings_loc = pCreateInfo_loc.dot(Field::pBindings);
             for (uint32_t bindingIndex = 0; bindingIndex < pCreateInfo->bindingCount; ++bindingIndex) {
-                [[maybe_unused]] const Location pBindings_loc = pCreateInfo_loc.dot(Field::pBindings, bindingIndex);
+                pBindings_loc.index = bindingIndex;
                 skip |= ValidateRangedEnum(pBindings_loc.dot(Field::descriptorType), vvl::Enum::VkDescriptorType,
                                            pCreateInfo->pBindings[bindingIndex].descriptorType,
                                            "VUID-VkDescriptorSetLayoutBinding-descriptorType-parameter");
@@ -12249,8 +12051,9 @@ bool StatelessValidation::PreCallValidateCreateDescriptorPool(VkDevice device, c
                               "VUID-VkDescriptorPoolCreateInfo-pPoolSizes-parameter");
 
         if (pCreateInfo->pPoolSizes != nullptr) {
+            [[maybe_unused]] Location pPoolSizes_loc = pCreateInfo_loc.dot(Field::pPoolSizes);
             for (uint32_t poolSizeIndex = 0; poolSizeIndex < pCreateInfo->poolSizeCount; ++poolSizeIndex) {
-                [[maybe_unused]] const Location pPoolSizes_loc = pCreateInfo_loc.dot(Field::pPoolSizes, poolSizeIndex);
+                pPoolSizes_loc.index = poolSizeIndex;
                 skip |= ValidateRangedEnum(pPoolSizes_loc.dot(Field::type), vvl::Enum::VkDescriptorType,
                                            pCreateInfo->pPoolSizes[poolSizeIndex].type, "VUID-VkDescriptorPoolSize-type-parameter");
             }
@@ -12388,8 +12191,9 @@ bool StatelessValidation::PreCallValidateUpdateDescriptorSets(VkDevice device, u
                                     VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET, false, true, "VUID-VkWriteDescriptorSet-sType-sType",
                                     "VUID-vkUpdateDescriptorSets-pDescriptorWrites-parameter", kVUIDUndefined);
     if (pDescriptorWrites != nullptr) {
+        [[maybe_unused]] Location pDescriptorWrites_loc = loc.dot(Field::pDescriptorWrites);
         for (uint32_t descriptorWriteIndex = 0; descriptorWriteIndex < descriptorWriteCount; ++descriptorWriteIndex) {
-            [[maybe_unused]] const Location pDescriptorWrites_loc = loc.dot(Field::pDescriptorWrites, descriptorWriteIndex);
+            pDescriptorWrites_loc.index = descriptorWriteIndex;
             constexpr std::array allowed_structs_VkWriteDescriptorSet = {
                 VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR,
                 VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV,
@@ -12415,8 +12219,9 @@ bool StatelessValidation::PreCallValidateUpdateDescriptorSets(VkDevice device, u
                                     VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET, false, true, "VUID-VkCopyDescriptorSet-sType-sType",
                                     "VUID-vkUpdateDescriptorSets-pDescriptorCopies-parameter", kVUIDUndefined);
     if (pDescriptorCopies != nullptr) {
+        [[maybe_unused]] Location pDescriptorCopies_loc = loc.dot(Field::pDescriptorCopies);
         for (uint32_t descriptorCopyIndex = 0; descriptorCopyIndex < descriptorCopyCount; ++descriptorCopyIndex) {
-            [[maybe_unused]] const Location pDescriptorCopies_loc = loc.dot(Field::pDescriptorCopies, descriptorCopyIndex);
+            pDescriptorCopies_loc.index = descriptorCopyIndex;
             skip |= ValidateStructPnext(pDescriptorCopies_loc, pDescriptorCopies[descriptorCopyIndex].pNext, 0, nullptr,
                                         GeneratedVulkanHeaderVersion, "VUID-VkCopyDescriptorSet-pNext-pNext", kVUIDUndefined,
                                         VK_NULL_HANDLE, true);
@@ -12546,8 +12351,9 @@ bool StatelessValidation::PreCallValidateCreateRenderPass(VkDevice device, const
                               "VUID-VkRenderPassCreateInfo-pAttachments-parameter");
 
         if (pCreateInfo->pAttachments != nullptr) {
+            [[maybe_unused]] Location pAttachments_loc = pCreateInfo_loc.dot(Field::pAttachments);
             for (uint32_t attachmentIndex = 0; attachmentIndex < pCreateInfo->attachmentCount; ++attachmentIndex) {
-                [[maybe_unused]] const Location pAttachments_loc = pCreateInfo_loc.dot(Field::pAttachments, attachmentIndex);
+                pAttachments_loc.index = attachmentIndex;
                 skip |= ValidateFlags(pAttachments_loc.dot(Field::flags), vvl::FlagBitmask::VkAttachmentDescriptionFlagBits,
                                       AllVkAttachmentDescriptionFlagBits, pCreateInfo->pAttachments[attachmentIndex].flags,
                                       kOptionalFlags, "VUID-VkAttachmentDescription-flags-parameter");
@@ -12593,8 +12399,9 @@ bool StatelessValidation::PreCallValidateCreateRenderPass(VkDevice device, const
                               "VUID-VkRenderPassCreateInfo-pSubpasses-parameter");
 
         if (pCreateInfo->pSubpasses != nullptr) {
+            [[maybe_unused]] Location pSubpasses_loc = pCreateInfo_loc.dot(Field::pSubpasses);
             for (uint32_t subpassIndex = 0; subpassIndex < pCreateInfo->subpassCount; ++subpassIndex) {
-                [[maybe_unused]] const Location pSubpasses_loc = pCreateInfo_loc.dot(Field::pSubpasses, subpassIndex);
+                pSubpasses_loc.index = subpassIndex;
                 skip |= ValidateFlags(pSubpasses_loc.dot(Field::flags), vvl::FlagBitmask::VkSubpassDescriptionFlagBits,
                                       AllVkSubpassDescriptionFlagBits, pCreateInfo->pSubpasses[subpassIndex].flags, kOptionalFlags,
                                       "VUID-VkSubpassDescription-flags-parameter");
@@ -12609,11 +12416,11 @@ bool StatelessValidation::PreCallValidateCreateRenderPass(VkDevice device, const
                                       "VUID-VkSubpassDescription-pInputAttachments-parameter");
 
                 if (pCreateInfo->pSubpasses[subpassIndex].pInputAttachments != nullptr) {
+                    [[maybe_unused]] Location pInputAttachments_loc = pSubpasses_loc.dot(Field::pInputAttachments);
                     for (uint32_t inputAttachmentIndex = 0;
                          inputAttachmentIndex < pCreateInfo->pSubpasses[subpassIndex].inputAttachmentCount;
                          ++inputAttachmentIndex) {
-                        [[maybe_unused]] const Location pInputAttachments_loc =
-                            pSubpasses_loc.dot(Field::pInputAttachments, inputAttachmentIndex);
+                        pInputAttachments_loc.index = inputAttachmentIndex;
                         skip |=
                             ValidateRangedEnum(pInputAttachments_loc.dot(Field::layout), vvl::Enum::VkImageLayout,
                                                pCreateInfo->pSubpasses[subpassIndex].pInputAttachments[inputAttachmentIndex].layout,
@@ -12627,11 +12434,11 @@ bool StatelessValidation::PreCallValidateCreateRenderPass(VkDevice device, const
                                       "VUID-VkSubpassDescription-pColorAttachments-parameter");
 
                 if (pCreateInfo->pSubpasses[subpassIndex].pColorAttachments != nullptr) {
+                    [[maybe_unused]] Location pColorAttachments_loc = pSubpasses_loc.dot(Field::pColorAttachments);
                     for (uint32_t colorAttachmentIndex = 0;
                          colorAttachmentIndex < pCreateInfo->pSubpasses[subpassIndex].colorAttachmentCount;
                          ++colorAttachmentIndex) {
-                        [[maybe_unused]] const Location pColorAttachments_loc =
-                            pSubpasses_loc.dot(Field::pColorAttachments, colorAttachmentIndex);
+                        pColorAttachments_loc.index = colorAttachmentIndex;
                         skip |=
                             ValidateRangedEnum(pColorAttachments_loc.dot(Field::layout), vvl::Enum::VkImageLayout,
                                                pCreateInfo->pSubpasses[subpassIndex].pColorAttachments[colorAttachmentIndex].layout,
@@ -12640,11 +12447,11 @@ bool StatelessValidation::PreCallValidateCreateRenderPass(VkDevice device, const
                 }
 
                 if (pCreateInfo->pSubpasses[subpassIndex].pResolveAttachments != nullptr) {
+                    [[maybe_unused]] Location pResolveAttachments_loc = pSubpasses_loc.dot(Field::pResolveAttachments);
                     for (uint32_t colorAttachmentIndex = 0;
                          colorAttachmentIndex < pCreateInfo->pSubpasses[subpassIndex].colorAttachmentCount;
                          ++colorAttachmentIndex) {
-                        [[maybe_unused]] const Location pResolveAttachments_loc =
-                            pSubpasses_loc.dot(Field::pResolveAttachments, colorAttachmentIndex);
+                        pResolveAttachments_loc.index = colorAttachmentIndex;
                         skip |= ValidateRangedEnum(
                             pResolveAttachments_loc.dot(Field::layout), vvl::Enum::VkImageLayout,
                             pCreateInfo->pSubpasses[subpassIndex].pResolveAttachments[colorAttachmentIndex].layout,
@@ -12673,8 +12480,9 @@ bool StatelessValidation::PreCallValidateCreateRenderPass(VkDevice device, const
                               "VUID-VkRenderPassCreateInfo-pDependencies-parameter");
 
         if (pCreateInfo->pDependencies != nullptr) {
+            [[maybe_unused]] Location pDependencies_loc = pCreateInfo_loc.dot(Field::pDependencies);
             for (uint32_t dependencyIndex = 0; dependencyIndex < pCreateInfo->dependencyCount; ++dependencyIndex) {
-                [[maybe_unused]] const Location pDependencies_loc = pCreateInfo_loc.dot(Field::pDependencies, dependencyIndex);
+                pDependencies_loc.index = dependencyIndex;
                 skip |= ValidateFlags(pDependencies_loc.dot(Field::srcStageMask), vvl::FlagBitmask::VkPipelineStageFlagBits,
                                       AllVkPipelineStageFlagBits, pCreateInfo->pDependencies[dependencyIndex].srcStageMask,
                                       kOptionalFlags, "VUID-VkSubpassDependency-srcStageMask-parameter");
@@ -12958,12 +12766,6 @@ bool StatelessValidation::PreCallValidateCmdSetViewport(VkCommandBuffer commandB
     [[maybe_unused]] const Location loc = error_obj.location;
     skip |= ValidateArray(loc.dot(Field::viewportCount), loc.dot(Field::pViewports), viewportCount, &pViewports, true, true,
                           "VUID-vkCmdSetViewport-viewportCount-arraylength", "VUID-vkCmdSetViewport-pViewports-parameter");
-    if (pViewports != nullptr) {
-        for (uint32_t viewportIndex = 0; viewportIndex < viewportCount; ++viewportIndex) {
-            [[maybe_unused]] const Location pViewports_loc = loc.dot(Field::pViewports, viewportIndex);
-            // No xml-driven validation
-        }
-    }
     if (!skip) skip |= manual_PreCallValidateCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports, error_obj);
     return skip;
 }
@@ -12974,14 +12776,6 @@ bool StatelessValidation::PreCallValidateCmdSetScissor(VkCommandBuffer commandBu
     [[maybe_unused]] const Location loc = error_obj.location;
     skip |= ValidateArray(loc.dot(Field::scissorCount), loc.dot(Field::pScissors), scissorCount, &pScissors, true, true,
                           "VUID-vkCmdSetScissor-scissorCount-arraylength", "VUID-vkCmdSetScissor-pScissors-parameter");
-    if (pScissors != nullptr) {
-        for (uint32_t scissorIndex = 0; scissorIndex < scissorCount; ++scissorIndex) {
-            [[maybe_unused]] const Location pScissors_loc = loc.dot(Field::pScissors, scissorIndex);
-            // No xml-driven validation
-
-            // No xml-driven validation
-        }
-    }
     if (!skip) skip |= manual_PreCallValidateCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors, error_obj);
     return skip;
 }
@@ -13152,12 +12946,6 @@ bool StatelessValidation::PreCallValidateCmdCopyBuffer(VkCommandBuffer commandBu
     skip |= ValidateRequiredHandle(loc.dot(Field::dstBuffer), dstBuffer);
     skip |= ValidateArray(loc.dot(Field::regionCount), loc.dot(Field::pRegions), regionCount, &pRegions, true, true,
                           "VUID-vkCmdCopyBuffer-regionCount-arraylength", "VUID-vkCmdCopyBuffer-pRegions-parameter");
-    if (pRegions != nullptr) {
-        for (uint32_t regionIndex = 0; regionIndex < regionCount; ++regionIndex) {
-            [[maybe_unused]] const Location pRegions_loc = loc.dot(Field::pRegions, regionIndex);
-            // No xml-driven validation
-        }
-    }
     if (!skip) skip |= manual_PreCallValidateCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions, error_obj);
     return skip;
 }
@@ -13176,23 +12964,18 @@ bool StatelessValidation::PreCallValidateCmdCopyImage(VkCommandBuffer commandBuf
     skip |= ValidateArray(loc.dot(Field::regionCount), loc.dot(Field::pRegions), regionCount, &pRegions, true, true,
                           "VUID-vkCmdCopyImage-regionCount-arraylength", "VUID-vkCmdCopyImage-pRegions-parameter");
     if (pRegions != nullptr) {
+        [[maybe_unused]] Location pRegions_loc = loc.dot(Field::pRegions);
         for (uint32_t regionIndex = 0; regionIndex < regionCount; ++regionIndex) {
-            [[maybe_unused]] const Location pRegions_loc = loc.dot(Field::pRegions, regionIndex);
+            pRegions_loc.index = regionIndex;
             skip |= ValidateFlags(pRegions_loc.dot(Field::aspectMask), vvl::FlagBitmask::VkImageAspectFlagBits,
                                   AllVkImageAspectFlagBits, pRegions[regionIndex].srcSubresource.aspectMask, kRequiredFlags,
                                   "VUID-VkImageSubresourceLayers-aspectMask-parameter",
                                   "VUID-VkImageSubresourceLayers-aspectMask-requiredbitmask");
 
-            // No xml-driven validation
-
             skip |= ValidateFlags(pRegions_loc.dot(Field::aspectMask), vvl::FlagBitmask::VkImageAspectFlagBits,
                                   AllVkImageAspectFlagBits, pRegions[regionIndex].dstSubresource.aspectMask, kRequiredFlags,
                                   "VUID-VkImageSubresourceLayers-aspectMask-parameter",
                                   "VUID-VkImageSubresourceLayers-aspectMask-requiredbitmask");
-
-            // No xml-driven validation
-
-            // No xml-driven validation
         }
     }
     return skip;
@@ -13213,8 +12996,9 @@ bool StatelessValidation::PreCallValidateCmdBlitImage(VkCommandBuffer commandBuf
     skip |= ValidateArray(loc.dot(Field::regionCount), loc.dot(Field::pRegions), regionCount, &pRegions, true, true,
                           "VUID-vkCmdBlitImage-regionCount-arraylength", "VUID-vkCmdBlitImage-pRegions-parameter");
     if (pRegions != nullptr) {
+        [[maybe_unused]] Location pRegions_loc = loc.dot(Field::pRegions);
         for (uint32_t regionIndex = 0; regionIndex < regionCount; ++regionIndex) {
-            [[maybe_unused]] const Location pRegions_loc = loc.dot(Field::pRegions, regionIndex);
+            pRegions_loc.index = regionIndex;
             skip |= ValidateFlags(pRegions_loc.dot(Field::aspectMask), vvl::FlagBitmask::VkImageAspectFlagBits,
                                   AllVkImageAspectFlagBits, pRegions[regionIndex].srcSubresource.aspectMask, kRequiredFlags,
                                   "VUID-VkImageSubresourceLayers-aspectMask-parameter",
@@ -13243,16 +13027,13 @@ bool StatelessValidation::PreCallValidateCmdCopyBufferToImage(VkCommandBuffer co
     skip |= ValidateArray(loc.dot(Field::regionCount), loc.dot(Field::pRegions), regionCount, &pRegions, true, true,
                           "VUID-vkCmdCopyBufferToImage-regionCount-arraylength", "VUID-vkCmdCopyBufferToImage-pRegions-parameter");
     if (pRegions != nullptr) {
+        [[maybe_unused]] Location pRegions_loc = loc.dot(Field::pRegions);
         for (uint32_t regionIndex = 0; regionIndex < regionCount; ++regionIndex) {
-            [[maybe_unused]] const Location pRegions_loc = loc.dot(Field::pRegions, regionIndex);
+            pRegions_loc.index = regionIndex;
             skip |= ValidateFlags(pRegions_loc.dot(Field::aspectMask), vvl::FlagBitmask::VkImageAspectFlagBits,
                                   AllVkImageAspectFlagBits, pRegions[regionIndex].imageSubresource.aspectMask, kRequiredFlags,
                                   "VUID-VkImageSubresourceLayers-aspectMask-parameter",
                                   "VUID-VkImageSubresourceLayers-aspectMask-requiredbitmask");
-
-            // No xml-driven validation
-
-            // No xml-driven validation
         }
     }
     return skip;
@@ -13271,16 +13052,13 @@ bool StatelessValidation::PreCallValidateCmdCopyImageToBuffer(VkCommandBuffer co
     skip |= ValidateArray(loc.dot(Field::regionCount), loc.dot(Field::pRegions), regionCount, &pRegions, true, true,
                           "VUID-vkCmdCopyImageToBuffer-regionCount-arraylength", "VUID-vkCmdCopyImageToBuffer-pRegions-parameter");
     if (pRegions != nullptr) {
+        [[maybe_unused]] Location pRegions_loc = loc.dot(Field::pRegions);
         for (uint32_t regionIndex = 0; regionIndex < regionCount; ++regionIndex) {
-            [[maybe_unused]] const Location pRegions_loc = loc.dot(Field::pRegions, regionIndex);
+            pRegions_loc.index = regionIndex;
             skip |= ValidateFlags(pRegions_loc.dot(Field::aspectMask), vvl::FlagBitmask::VkImageAspectFlagBits,
                                   AllVkImageAspectFlagBits, pRegions[regionIndex].imageSubresource.aspectMask, kRequiredFlags,
                                   "VUID-VkImageSubresourceLayers-aspectMask-parameter",
                                   "VUID-VkImageSubresourceLayers-aspectMask-requiredbitmask");
-
-            // No xml-driven validation
-
-            // No xml-driven validation
         }
     }
     return skip;
@@ -13319,8 +13097,9 @@ bool StatelessValidation::PreCallValidateCmdClearColorImage(VkCommandBuffer comm
     skip |= ValidateArray(loc.dot(Field::rangeCount), loc.dot(Field::pRanges), rangeCount, &pRanges, true, true,
                           "VUID-vkCmdClearColorImage-rangeCount-arraylength", "VUID-vkCmdClearColorImage-pRanges-parameter");
     if (pRanges != nullptr) {
+        [[maybe_unused]] Location pRanges_loc = loc.dot(Field::pRanges);
         for (uint32_t rangeIndex = 0; rangeIndex < rangeCount; ++rangeIndex) {
-            [[maybe_unused]] const Location pRanges_loc = loc.dot(Field::pRanges, rangeIndex);
+            pRanges_loc.index = rangeIndex;
             skip |=
                 ValidateFlags(pRanges_loc.dot(Field::aspectMask), vvl::FlagBitmask::VkImageAspectFlagBits, AllVkImageAspectFlagBits,
                               pRanges[rangeIndex].aspectMask, kRequiredFlags, "VUID-VkImageSubresourceRange-aspectMask-parameter",
@@ -13344,16 +13123,13 @@ bool StatelessValidation::PreCallValidateCmdClearDepthStencilImage(VkCommandBuff
                                "VUID-vkCmdClearDepthStencilImage-imageLayout-parameter");
     skip |= ValidateRequiredPointer(loc.dot(Field::pDepthStencil), pDepthStencil,
                                     "VUID-vkCmdClearDepthStencilImage-pDepthStencil-parameter");
-    if (pDepthStencil != nullptr) {
-        [[maybe_unused]] const Location pDepthStencil_loc = loc.dot(Field::pDepthStencil);
-        // No xml-driven validation
-    }
     skip |= ValidateArray(loc.dot(Field::rangeCount), loc.dot(Field::pRanges), rangeCount, &pRanges, true, true,
                           "VUID-vkCmdClearDepthStencilImage-rangeCount-arraylength",
                           "VUID-vkCmdClearDepthStencilImage-pRanges-parameter");
     if (pRanges != nullptr) {
+        [[maybe_unused]] Location pRanges_loc = loc.dot(Field::pRanges);
         for (uint32_t rangeIndex = 0; rangeIndex < rangeCount; ++rangeIndex) {
-            [[maybe_unused]] const Location pRanges_loc = loc.dot(Field::pRanges, rangeIndex);
+            pRanges_loc.index = rangeIndex;
             skip |=
                 ValidateFlags(pRanges_loc.dot(Field::aspectMask), vvl::FlagBitmask::VkImageAspectFlagBits, AllVkImageAspectFlagBits,
                               pRanges[rangeIndex].aspectMask, kRequiredFlags, "VUID-VkImageSubresourceRange-aspectMask-parameter",
@@ -13372,8 +13148,9 @@ bool StatelessValidation::PreCallValidateCmdClearAttachments(VkCommandBuffer com
                           "VUID-vkCmdClearAttachments-attachmentCount-arraylength",
                           "VUID-vkCmdClearAttachments-pAttachments-parameter");
     if (pAttachments != nullptr) {
+        [[maybe_unused]] Location pAttachments_loc = loc.dot(Field::pAttachments);
         for (uint32_t attachmentIndex = 0; attachmentIndex < attachmentCount; ++attachmentIndex) {
-            [[maybe_unused]] const Location pAttachments_loc = loc.dot(Field::pAttachments, attachmentIndex);
+            pAttachments_loc.index = attachmentIndex;
             skip |=
                 ValidateFlags(pAttachments_loc.dot(Field::aspectMask), vvl::FlagBitmask::VkImageAspectFlagBits,
                               AllVkImageAspectFlagBits, pAttachments[attachmentIndex].aspectMask, kRequiredFlags,
@@ -13382,14 +13159,6 @@ bool StatelessValidation::PreCallValidateCmdClearAttachments(VkCommandBuffer com
     }
     skip |= ValidateArray(loc.dot(Field::rectCount), loc.dot(Field::pRects), rectCount, &pRects, true, true,
                           "VUID-vkCmdClearAttachments-rectCount-arraylength", "VUID-vkCmdClearAttachments-pRects-parameter");
-    if (pRects != nullptr) {
-        for (uint32_t rectIndex = 0; rectIndex < rectCount; ++rectIndex) {
-            [[maybe_unused]] const Location pRects_loc = loc.dot(Field::pRects, rectIndex);
-            // No xml-driven validation
-
-            // No xml-driven validation
-        }
-    }
     if (!skip)
         skip |=
             manual_PreCallValidateCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects, error_obj);
@@ -13411,23 +13180,18 @@ bool StatelessValidation::PreCallValidateCmdResolveImage(VkCommandBuffer command
     skip |= ValidateArray(loc.dot(Field::regionCount), loc.dot(Field::pRegions), regionCount, &pRegions, true, true,
                           "VUID-vkCmdResolveImage-regionCount-arraylength", "VUID-vkCmdResolveImage-pRegions-parameter");
     if (pRegions != nullptr) {
+        [[maybe_unused]] Location pRegions_loc = loc.dot(Field::pRegions);
         for (uint32_t regionIndex = 0; regionIndex < regionCount; ++regionIndex) {
-            [[maybe_unused]] const Location pRegions_loc = loc.dot(Field::pRegions, regionIndex);
+            pRegions_loc.index = regionIndex;
             skip |= ValidateFlags(pRegions_loc.dot(Field::aspectMask), vvl::FlagBitmask::VkImageAspectFlagBits,
                                   AllVkImageAspectFlagBits, pRegions[regionIndex].srcSubresource.aspectMask, kRequiredFlags,
                                   "VUID-VkImageSubresourceLayers-aspectMask-parameter",
                                   "VUID-VkImageSubresourceLayers-aspectMask-requiredbitmask");
 
-            // No xml-driven validation
-
             skip |= ValidateFlags(pRegions_loc.dot(Field::aspectMask), vvl::FlagBitmask::VkImageAspectFlagBits,
                                   AllVkImageAspectFlagBits, pRegions[regionIndex].dstSubresource.aspectMask, kRequiredFlags,
                                   "VUID-VkImageSubresourceLayers-aspectMask-parameter",
                                   "VUID-VkImageSubresourceLayers-aspectMask-requiredbitmask");
-
-            // No xml-driven validation
-
-            // No xml-driven validation
         }
     }
     return skip;
@@ -13471,8 +13235,9 @@ bool StatelessValidation::PreCallValidateCmdWaitEvents(
                                     VK_STRUCTURE_TYPE_MEMORY_BARRIER, false, true, "VUID-VkMemoryBarrier-sType-sType",
                                     "VUID-vkCmdWaitEvents-pMemoryBarriers-parameter", kVUIDUndefined);
     if (pMemoryBarriers != nullptr) {
+        [[maybe_unused]] Location pMemoryBarriers_loc = loc.dot(Field::pMemoryBarriers);
         for (uint32_t memoryBarrierIndex = 0; memoryBarrierIndex < memoryBarrierCount; ++memoryBarrierIndex) {
-            [[maybe_unused]] const Location pMemoryBarriers_loc = loc.dot(Field::pMemoryBarriers, memoryBarrierIndex);
+            pMemoryBarriers_loc.index = memoryBarrierIndex;
             skip |= ValidateStructPnext(pMemoryBarriers_loc, pMemoryBarriers[memoryBarrierIndex].pNext, 0, nullptr,
                                         GeneratedVulkanHeaderVersion, "VUID-VkMemoryBarrier-pNext-pNext", kVUIDUndefined,
                                         VK_NULL_HANDLE, true);
@@ -13491,10 +13256,10 @@ bool StatelessValidation::PreCallValidateCmdWaitEvents(
                                     VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER, false, true, "VUID-VkBufferMemoryBarrier-sType-sType",
                                     "VUID-vkCmdWaitEvents-pBufferMemoryBarriers-parameter", kVUIDUndefined);
     if (pBufferMemoryBarriers != nullptr) {
+        [[maybe_unused]] Location pBufferMemoryBarriers_loc = loc.dot(Field::pBufferMemoryBarriers);
         for (uint32_t bufferMemoryBarrierIndex = 0; bufferMemoryBarrierIndex < bufferMemoryBarrierCount;
              ++bufferMemoryBarrierIndex) {
-            [[maybe_unused]] const Location pBufferMemoryBarriers_loc =
-                loc.dot(Field::pBufferMemoryBarriers, bufferMemoryBarrierIndex);
+            pBufferMemoryBarriers_loc.index = bufferMemoryBarrierIndex;
             constexpr std::array allowed_structs_VkBufferMemoryBarrier = {VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_ACQUIRE_UNMODIFIED_EXT};
 
             skip |= ValidateStructPnext(pBufferMemoryBarriers_loc, pBufferMemoryBarriers[bufferMemoryBarrierIndex].pNext,
@@ -13511,9 +13276,9 @@ bool StatelessValidation::PreCallValidateCmdWaitEvents(
                                     VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, false, true, "VUID-VkImageMemoryBarrier-sType-sType",
                                     "VUID-vkCmdWaitEvents-pImageMemoryBarriers-parameter", kVUIDUndefined);
     if (pImageMemoryBarriers != nullptr) {
+        [[maybe_unused]] Location pImageMemoryBarriers_loc = loc.dot(Field::pImageMemoryBarriers);
         for (uint32_t imageMemoryBarrierIndex = 0; imageMemoryBarrierIndex < imageMemoryBarrierCount; ++imageMemoryBarrierIndex) {
-            [[maybe_unused]] const Location pImageMemoryBarriers_loc =
-                loc.dot(Field::pImageMemoryBarriers, imageMemoryBarrierIndex);
+            pImageMemoryBarriers_loc.index = imageMemoryBarrierIndex;
             constexpr std::array allowed_structs_VkImageMemoryBarrier = {VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_ACQUIRE_UNMODIFIED_EXT,
                                                                          VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT};
 
@@ -13560,8 +13325,9 @@ bool StatelessValidation::PreCallValidateCmdPipelineBarrier(
                                     VK_STRUCTURE_TYPE_MEMORY_BARRIER, false, true, "VUID-VkMemoryBarrier-sType-sType",
                                     "VUID-vkCmdPipelineBarrier-pMemoryBarriers-parameter", kVUIDUndefined);
     if (pMemoryBarriers != nullptr) {
+        [[maybe_unused]] Location pMemoryBarriers_loc = loc.dot(Field::pMemoryBarriers);
         for (uint32_t memoryBarrierIndex = 0; memoryBarrierIndex < memoryBarrierCount; ++memoryBarrierIndex) {
-            [[maybe_unused]] const Location pMemoryBarriers_loc = loc.dot(Field::pMemoryBarriers, memoryBarrierIndex);
+            pMemoryBarriers_loc.index = memoryBarrierIndex;
             skip |= ValidateStructPnext(pMemoryBarriers_loc, pMemoryBarriers[memoryBarrierIndex].pNext, 0, nullptr,
                                         GeneratedVulkanHeaderVersion, "VUID-VkMemoryBarrier-pNext-pNext", kVUIDUndefined,
                                         VK_NULL_HANDLE, true);
@@ -13580,10 +13346,10 @@ bool StatelessValidation::PreCallValidateCmdPipelineBarrier(
                                     VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER, false, true, "VUID-VkBufferMemoryBarrier-sType-sType",
                                     "VUID-vkCmdPipelineBarrier-pBufferMemoryBarriers-parameter", kVUIDUndefined);
     if (pBufferMemoryBarriers != nullptr) {
+        [[maybe_unused]] Location pBufferMemoryBarriers_loc = loc.dot(Field::pBufferMemoryBarriers);
         for (uint32_t bufferMemoryBarrierIndex = 0; bufferMemoryBarrierIndex < bufferMemoryBarrierCount;
              ++bufferMemoryBarrierIndex) {
-            [[maybe_unused]] const Location pBufferMemoryBarriers_loc =
-                loc.dot(Field::pBufferMemoryBarriers, bufferMemoryBarrierIndex);
+            pBufferMemoryBarriers_loc.index = bufferMemoryBarrierIndex;
             constexpr std::array allowed_structs_VkBufferMemoryBarrier = {VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_ACQUIRE_UNMODIFIED_EXT};
 
             skip |= ValidateStructPnext(pBufferMemoryBarriers_loc, pBufferMemoryBarriers[bufferMemoryBarrierIndex].pNext,
@@ -13600,9 +13366,9 @@ bool StatelessValidation::PreCallValidateCmdPipelineBarrier(
                                     VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, false, true, "VUID-VkImageMemoryBarrier-sType-sType",
                                     "VUID-vkCmdPipelineBarrier-pImageMemoryBarriers-parameter", kVUIDUndefined);
     if (pImageMemoryBarriers != nullptr) {
+        [[maybe_unused]] Location pImageMemoryBarriers_loc = loc.dot(Field::pImageMemoryBarriers);
         for (uint32_t imageMemoryBarrierIndex = 0; imageMemoryBarrierIndex < imageMemoryBarrierCount; ++imageMemoryBarrierIndex) {
-            [[maybe_unused]] const Location pImageMemoryBarriers_loc =
-                loc.dot(Field::pImageMemoryBarriers, imageMemoryBarrierIndex);
+            pImageMemoryBarriers_loc.index = imageMemoryBarrierIndex;
             constexpr std::array allowed_structs_VkImageMemoryBarrier = {VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_ACQUIRE_UNMODIFIED_EXT,
                                                                          VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT};
 
@@ -13724,10 +13490,6 @@ bool StatelessValidation::PreCallValidateCmdBeginRenderPass(VkCommandBuffer comm
         skip |= ValidateRequiredHandle(pRenderPassBegin_loc.dot(Field::renderPass), pRenderPassBegin->renderPass);
 
         skip |= ValidateRequiredHandle(pRenderPassBegin_loc.dot(Field::framebuffer), pRenderPassBegin->framebuffer);
-
-        // No xml-driven validation
-
-        // No xml-driven validation
     }
     skip |= ValidateRangedEnum(loc.dot(Field::contents), vvl::Enum::VkSubpassContents, contents,
                                "VUID-vkCmdBeginRenderPass-contents-parameter");
@@ -13771,8 +13533,9 @@ bool StatelessValidation::PreCallValidateBindBufferMemory2(VkDevice device, uint
         pBindInfos, VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO, true, true, "VUID-VkBindBufferMemoryInfo-sType-sType",
         "VUID-vkBindBufferMemory2-pBindInfos-parameter", "VUID-vkBindBufferMemory2-bindInfoCount-arraylength");
     if (pBindInfos != nullptr) {
+        [[maybe_unused]] Location pBindInfos_loc = loc.dot(Field::pBindInfos);
         for (uint32_t bindInfoIndex = 0; bindInfoIndex < bindInfoCount; ++bindInfoIndex) {
-            [[maybe_unused]] const Location pBindInfos_loc = loc.dot(Field::pBindInfos, bindInfoIndex);
+            pBindInfos_loc.index = bindInfoIndex;
             constexpr std::array allowed_structs_VkBindBufferMemoryInfo = {VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO,
                                                                            VK_STRUCTURE_TYPE_BIND_MEMORY_STATUS_KHR};
 
@@ -13799,8 +13562,9 @@ bool StatelessValidation::PreCallValidateBindImageMemory2(VkDevice device, uint3
         pBindInfos, VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_INFO, true, true, "VUID-VkBindImageMemoryInfo-sType-sType",
         "VUID-vkBindImageMemory2-pBindInfos-parameter", "VUID-vkBindImageMemory2-bindInfoCount-arraylength");
     if (pBindInfos != nullptr) {
+        [[maybe_unused]] Location pBindInfos_loc = loc.dot(Field::pBindInfos);
         for (uint32_t bindInfoIndex = 0; bindInfoIndex < bindInfoCount; ++bindInfoIndex) {
-            [[maybe_unused]] const Location pBindInfos_loc = loc.dot(Field::pBindInfos, bindInfoIndex);
+            pBindInfos_loc.index = bindInfoIndex;
             constexpr std::array allowed_structs_VkBindImageMemoryInfo = {
                 VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO, VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR,
                 VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO, VK_STRUCTURE_TYPE_BIND_MEMORY_STATUS_KHR};
@@ -13859,10 +13623,10 @@ bool StatelessValidation::PreCallValidateEnumeratePhysicalDeviceGroups(
                                     "VUID-vkEnumeratePhysicalDeviceGroups-pPhysicalDeviceGroupProperties-parameter",
                                     "VUID-vkEnumeratePhysicalDeviceGroups-pPhysicalDeviceGroupCount-parameter", kVUIDUndefined);
     if (pPhysicalDeviceGroupProperties != nullptr) {
+        [[maybe_unused]] Location pPhysicalDeviceGroupProperties_loc = loc.dot(Field::pPhysicalDeviceGroupProperties);
         for (uint32_t pPhysicalDeviceGroupIndex = 0; pPhysicalDeviceGroupIndex < *pPhysicalDeviceGroupCount;
              ++pPhysicalDeviceGroupIndex) {
-            [[maybe_unused]] const Location pPhysicalDeviceGroupProperties_loc =
-                loc.dot(Field::pPhysicalDeviceGroupProperties, pPhysicalDeviceGroupIndex);
+            pPhysicalDeviceGroupProperties_loc.index = pPhysicalDeviceGroupIndex;
             skip |= ValidateStructPnext(pPhysicalDeviceGroupProperties_loc,
                                         pPhysicalDeviceGroupProperties[pPhysicalDeviceGroupIndex].pNext, 0, nullptr,
                                         GeneratedVulkanHeaderVersion, "VUID-VkPhysicalDeviceGroupProperties-pNext-pNext",
@@ -13965,10 +13729,10 @@ bool StatelessValidation::PreCallValidateGetImageSparseMemoryRequirements2(
                                 "VUID-vkGetImageSparseMemoryRequirements2-pSparseMemoryRequirements-parameter",
                                 "VUID-vkGetImageSparseMemoryRequirements2-pSparseMemoryRequirementCount-parameter", kVUIDUndefined);
     if (pSparseMemoryRequirements != nullptr) {
+        [[maybe_unused]] Location pSparseMemoryRequirements_loc = loc.dot(Field::pSparseMemoryRequirements);
         for (uint32_t pSparseMemoryRequirementIndex = 0; pSparseMemoryRequirementIndex < *pSparseMemoryRequirementCount;
              ++pSparseMemoryRequirementIndex) {
-            [[maybe_unused]] const Location pSparseMemoryRequirements_loc =
-                loc.dot(Field::pSparseMemoryRequirements, pSparseMemoryRequirementIndex);
+            pSparseMemoryRequirements_loc.index = pSparseMemoryRequirementIndex;
             skip |=
                 ValidateStructPnext(pSparseMemoryRequirements_loc, pSparseMemoryRequirements[pSparseMemoryRequirementIndex].pNext,
                                     0, nullptr, GeneratedVulkanHeaderVersion, "VUID-VkSparseImageMemoryRequirements2-pNext-pNext",
@@ -14226,10 +13990,10 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceQueueFamilyProperties2
         "VUID-vkGetPhysicalDeviceQueueFamilyProperties2-pQueueFamilyProperties-parameter",
         "VUID-vkGetPhysicalDeviceQueueFamilyProperties2-pQueueFamilyPropertyCount-parameter", kVUIDUndefined);
     if (pQueueFamilyProperties != nullptr) {
+        [[maybe_unused]] Location pQueueFamilyProperties_loc = loc.dot(Field::pQueueFamilyProperties);
         for (uint32_t pQueueFamilyPropertyIndex = 0; pQueueFamilyPropertyIndex < *pQueueFamilyPropertyCount;
              ++pQueueFamilyPropertyIndex) {
-            [[maybe_unused]] const Location pQueueFamilyProperties_loc =
-                loc.dot(Field::pQueueFamilyProperties, pQueueFamilyPropertyIndex);
+            pQueueFamilyProperties_loc.index = pQueueFamilyPropertyIndex;
             constexpr std::array allowed_structs_VkQueueFamilyProperties2 = {
                 VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_2_NV, VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_NV,
                 VK_STRUCTURE_TYPE_QUEUE_FAMILY_GLOBAL_PRIORITY_PROPERTIES_KHR,
@@ -14315,8 +14079,9 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceSparseImageFormatPrope
         "VUID-vkGetPhysicalDeviceSparseImageFormatProperties2-pProperties-parameter",
         "VUID-vkGetPhysicalDeviceSparseImageFormatProperties2-pPropertyCount-parameter", kVUIDUndefined);
     if (pProperties != nullptr) {
+        [[maybe_unused]] Location pProperties_loc = loc.dot(Field::pProperties);
         for (uint32_t pPropertyIndex = 0; pPropertyIndex < *pPropertyCount; ++pPropertyIndex) {
-            [[maybe_unused]] const Location pProperties_loc = loc.dot(Field::pProperties, pPropertyIndex);
+            pProperties_loc.index = pPropertyIndex;
             skip |=
                 ValidateStructPnext(pProperties_loc, pProperties[pPropertyIndex].pNext, 0, nullptr, GeneratedVulkanHeaderVersion,
                                     "VUID-VkSparseImageFormatProperties2-pNext-pNext", kVUIDUndefined, physicalDevice, false);
@@ -14499,10 +14264,10 @@ bool StatelessValidation::PreCallValidateCreateDescriptorUpdateTemplate(VkDevice
                               "VUID-VkDescriptorUpdateTemplateCreateInfo-pDescriptorUpdateEntries-parameter");
 
         if (pCreateInfo->pDescriptorUpdateEntries != nullptr) {
+            [[maybe_unused]] Location pDescriptorUpdateEntries_loc = pCreateInfo_loc.dot(Field::pDescriptorUpdateEntries);
             for (uint32_t descriptorUpdateEntryIndex = 0; descriptorUpdateEntryIndex < pCreateInfo->descriptorUpdateEntryCount;
                  ++descriptorUpdateEntryIndex) {
-                [[maybe_unused]] const Location pDescriptorUpdateEntries_loc =
-                    pCreateInfo_loc.dot(Field::pDescriptorUpdateEntries, descriptorUpdateEntryIndex);
+                pDescriptorUpdateEntries_loc.index = descriptorUpdateEntryIndex;
                 skip |= ValidateRangedEnum(pDescriptorUpdateEntries_loc.dot(Field::descriptorType), vvl::Enum::VkDescriptorType,
                                            pCreateInfo->pDescriptorUpdateEntries[descriptorUpdateEntryIndex].descriptorType,
                                            "VUID-VkDescriptorUpdateTemplateEntry-descriptorType-parameter");
@@ -14740,8 +14505,9 @@ bool StatelessValidation::PreCallValidateGetDescriptorSetLayoutSupport(VkDevice
                               "VUID-VkDescriptorSetLayoutCreateInfo-pBindings-parameter");
 
         if (pCreateInfo->pBindings != nullptr) {
+            [[maybe_unused]] Location pBindings_loc = pCreateInfo_loc.dot(Field::pBindings);
             for (uint32_t bindingIndex = 0; bindingIndex < pCreateInfo->bindingCount; ++bindingIndex) {
-                [[maybe_unused]] const Location pBindings_loc = pCreateInfo_loc.dot(Field::pBindings, bindingIndex);
+                pBindings_loc.index = bindingIndex;
                 skip |= ValidateRangedEnum(pBindings_loc.dot(Field::descriptorType), vvl::Enum::VkDescriptorType,
                                            pCreateInfo->pBindings[bindingIndex].descriptorType,
                                            "VUID-VkDescriptorSetLayoutBinding-descriptorType-parameter");
@@ -14818,8 +14584,9 @@ bool StatelessValidation::PreCallValidateCreateRenderPass2(VkDevice device, cons
                                         "VUID-VkRenderPassCreateInfo2-pAttachments-parameter", kVUIDUndefined);
 
         if (pCreateInfo->pAttachments != nullptr) {
+            [[maybe_unused]] Location pAttachments_loc = pCreateInfo_loc.dot(Field::pAttachments);
             for (uint32_t attachmentIndex = 0; attachmentIndex < pCreateInfo->attachmentCount; ++attachmentIndex) {
-                [[maybe_unused]] const Location pAttachments_loc = pCreateInfo_loc.dot(Field::pAttachments, attachmentIndex);
+                pAttachments_loc.index = attachmentIndex;
                 constexpr std::array allowed_structs_VkAttachmentDescription2 = {
                     VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT, VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID};
 
@@ -14875,8 +14642,9 @@ bool StatelessValidation::PreCallValidateCreateRenderPass2(VkDevice device, cons
             "VUID-VkRenderPassCreateInfo2-pSubpasses-parameter", "VUID-VkRenderPassCreateInfo2-subpassCount-arraylength");
 
         if (pCreateInfo->pSubpasses != nullptr) {
+            [[maybe_unused]] Location pSubpasses_loc = pCreateInfo_loc.dot(Field::pSubpasses);
             for (uint32_t subpassIndex = 0; subpassIndex < pCreateInfo->subpassCount; ++subpassIndex) {
-                [[maybe_unused]] const Location pSubpasses_loc = pCreateInfo_loc.dot(Field::pSubpasses, subpassIndex);
+                pSubpasses_loc.index = subpassIndex;
                 constexpr std::array allowed_structs_VkSubpassDescription2 = {
                     VK_STRUCTURE_TYPE_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR,
                     VK_STRUCTURE_TYPE_MULTISAMPLED_RENDER_TO_SINGLE_SAMPLED_INFO_EXT,
@@ -14905,11 +14673,11 @@ bool StatelessValidation::PreCallValidateCreateRenderPass2(VkDevice device, cons
                     kVUIDUndefined);
 
                 if (pCreateInfo->pSubpasses[subpassIndex].pInputAttachments != nullptr) {
+                    [[maybe_unused]] Location pInputAttachments_loc = pSubpasses_loc.dot(Field::pInputAttachments);
                     for (uint32_t inputAttachmentIndex = 0;
                          inputAttachmentIndex < pCreateInfo->pSubpasses[subpassIndex].inputAttachmentCount;
                          ++inputAttachmentIndex) {
-                        [[maybe_unused]] const Location pInputAttachments_loc =
-                            pSubpasses_loc.dot(Field::pInputAttachments, inputAttachmentIndex);
+                        pInputAttachments_loc.index = inputAttachmentIndex;
                         constexpr std::array allowed_structs_VkAttachmentReference2 = {
                             VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT};
 
@@ -14935,11 +14703,11 @@ bool StatelessValidation::PreCallValidateCreateRenderPass2(VkDevice device, cons
                     kVUIDUndefined);
 
                 if (pCreateInfo->pSubpasses[subpassIndex].pColorAttachments != nullptr) {
+                    [[maybe_unused]] Location pColorAttachments_loc = pSubpasses_loc.dot(Field::pColorAttachments);
                     for (uint32_t colorAttachmentIndex = 0;
                          colorAttachmentIndex < pCreateInfo->pSubpasses[subpassIndex].colorAttachmentCount;
                          ++colorAttachmentIndex) {
-                        [[maybe_unused]] const Location pColorAttachments_loc =
-                            pSubpasses_loc.dot(Field::pColorAttachments, colorAttachmentIndex);
+                        pColorAttachments_loc.index = colorAttachmentIndex;
                         constexpr std::array allowed_structs_VkAttachmentReference2 = {
                             VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT};
 
@@ -14965,11 +14733,11 @@ bool StatelessValidation::PreCallValidateCreateRenderPass2(VkDevice device, cons
                     kVUIDUndefined);
 
                 if (pCreateInfo->pSubpasses[subpassIndex].pResolveAttachments != nullptr) {
+                    [[maybe_unused]] Location pResolveAttachments_loc = pSubpasses_loc.dot(Field::pResolveAttachments);
                     for (uint32_t colorAttachmentIndex = 0;
                          colorAttachmentIndex < pCreateInfo->pSubpasses[subpassIndex].colorAttachmentCount;
                          ++colorAttachmentIndex) {
-                        [[maybe_unused]] const Location pResolveAttachments_loc =
-                            pSubpasses_loc.dot(Field::pResolveAttachments, colorAttachmentIndex);
+                        pResolveAttachments_loc.index = colorAttachmentIndex;
                         constexpr std::array allowed_structs_VkAttachmentReference2 = {
                             VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT};
 
@@ -15024,8 +14792,9 @@ bool StatelessValidation::PreCallValidateCreateRenderPass2(VkDevice device, cons
                                         "VUID-VkRenderPassCreateInfo2-pDependencies-parameter", kVUIDUndefined);
 
         if (pCreateInfo->pDependencies != nullptr) {
+            [[maybe_unused]] Location pDependencies_loc = pCreateInfo_loc.dot(Field::pDependencies);
             for (uint32_t dependencyIndex = 0; dependencyIndex < pCreateInfo->dependencyCount; ++dependencyIndex) {
-                [[maybe_unused]] const Location pDependencies_loc = pCreateInfo_loc.dot(Field::pDependencies, dependencyIndex);
+                pDependencies_loc.index = dependencyIndex;
                 constexpr std::array allowed_structs_VkSubpassDependency2 = {VK_STRUCTURE_TYPE_MEMORY_BARRIER_2};
 
                 skip |=
@@ -15125,10 +14894,6 @@ bool StatelessValidation::PreCallValidateCmdBeginRenderPass2(VkCommandBuffer com
         skip |= ValidateRequiredHandle(pRenderPassBegin_loc.dot(Field::renderPass), pRenderPassBegin->renderPass);
 
         skip |= ValidateRequiredHandle(pRenderPassBegin_loc.dot(Field::framebuffer), pRenderPassBegin->framebuffer);
-
-        // No xml-driven validation
-
-        // No xml-driven validation
     }
     skip |= ValidateStructType(loc.dot(Field::pSubpassBeginInfo), "VK_STRUCTURE_TYPE_SUBPASS_BEGIN_INFO", pSubpassBeginInfo,
                                VK_STRUCTURE_TYPE_SUBPASS_BEGIN_INFO, true, "VUID-vkCmdBeginRenderPass2-pSubpassBeginInfo-parameter",
@@ -15326,8 +15091,9 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceToolProperties(VkPhysi
         "VUID-VkPhysicalDeviceToolProperties-sType-sType", "VUID-vkGetPhysicalDeviceToolProperties-pToolProperties-parameter",
         "VUID-vkGetPhysicalDeviceToolProperties-pToolCount-parameter", kVUIDUndefined);
     if (pToolProperties != nullptr) {
+        [[maybe_unused]] Location pToolProperties_loc = loc.dot(Field::pToolProperties);
         for (uint32_t pToolIndex = 0; pToolIndex < *pToolCount; ++pToolIndex) {
-            [[maybe_unused]] const Location pToolProperties_loc = loc.dot(Field::pToolProperties, pToolIndex);
+            pToolProperties_loc.index = pToolIndex;
             skip |= ValidateStructPnext(pToolProperties_loc, pToolProperties[pToolIndex].pNext, 0, nullptr,
                                         GeneratedVulkanHeaderVersion, "VUID-VkPhysicalDeviceToolProperties-pNext-pNext",
                                         kVUIDUndefined, physicalDevice, false);
@@ -15464,9 +15230,9 @@ bool StatelessValidation::PreCallValidateCmdSetEvent2(VkCommandBuffer commandBuf
                                         "VUID-VkDependencyInfo-pMemoryBarriers-parameter", kVUIDUndefined);
 
         if (pDependencyInfo->pMemoryBarriers != nullptr) {
+            [[maybe_unused]] Location pMemoryBarriers_loc = pDependencyInfo_loc.dot(Field::pMemoryBarriers);
             for (uint32_t memoryBarrierIndex = 0; memoryBarrierIndex < pDependencyInfo->memoryBarrierCount; ++memoryBarrierIndex) {
-                [[maybe_unused]] const Location pMemoryBarriers_loc =
-                    pDependencyInfo_loc.dot(Field::pMemoryBarriers, memoryBarrierIndex);
+                pMemoryBarriers_loc.index = memoryBarrierIndex;
                 skip |=
                     ValidateStructPnext(pMemoryBarriers_loc, pDependencyInfo->pMemoryBarriers[memoryBarrierIndex].pNext, 0, nullptr,
                                         GeneratedVulkanHeaderVersion, kVUIDUndefined, kVUIDUndefined, VK_NULL_HANDLE, true);
@@ -15498,10 +15264,10 @@ bool StatelessValidation::PreCallValidateCmdSetEvent2(VkCommandBuffer commandBuf
             "VUID-VkBufferMemoryBarrier2-sType-sType", "VUID-VkDependencyInfo-pBufferMemoryBarriers-parameter", kVUIDUndefined);
 
         if (pDependencyInfo->pBufferMemoryBarriers != nullptr) {
+            [[maybe_unused]] Location pBufferMemoryBarriers_loc = pDependencyInfo_loc.dot(Field::pBufferMemoryBarriers);
             for (uint32_t bufferMemoryBarrierIndex = 0; bufferMemoryBarrierIndex < pDependencyInfo->bufferMemoryBarrierCount;
                  ++bufferMemoryBarrierIndex) {
-                [[maybe_unused]] const Location pBufferMemoryBarriers_loc =
-                    pDependencyInfo_loc.dot(Field::pBufferMemoryBarriers, bufferMemoryBarrierIndex);
+                pBufferMemoryBarriers_loc.index = bufferMemoryBarrierIndex;
                 constexpr std::array allowed_structs_VkBufferMemoryBarrier2 = {
                     VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_ACQUIRE_UNMODIFIED_EXT};
 
@@ -15543,10 +15309,10 @@ bool StatelessValidation::PreCallValidateCmdSetEvent2(VkCommandBuffer commandBuf
             "VUID-VkImageMemoryBarrier2-sType-sType", "VUID-VkDependencyInfo-pImageMemoryBarriers-parameter", kVUIDUndefined);
 
         if (pDependencyInfo->pImageMemoryBarriers != nullptr) {
+            [[maybe_unused]] Location pImageMemoryBarriers_loc = pDependencyInfo_loc.dot(Field::pImageMemoryBarriers);
             for (uint32_t imageMemoryBarrierIndex = 0; imageMemoryBarrierIndex < pDependencyInfo->imageMemoryBarrierCount;
                  ++imageMemoryBarrierIndex) {
-                [[maybe_unused]] const Location pImageMemoryBarriers_loc =
-                    pDependencyInfo_loc.dot(Field::pImageMemoryBarriers, imageMemoryBarrierIndex);
+                pImageMemoryBarriers_loc.index = imageMemoryBarrierIndex;
                 constexpr std::array allowed_structs_VkImageMemoryBarrier2 = {
                     VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_ACQUIRE_UNMODIFIED_EXT, VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT};
 
@@ -15620,8 +15386,9 @@ bool StatelessValidation::PreCallValidateCmdWaitEvents2(VkCommandBuffer commandB
         pDependencyInfos, VK_STRUCTURE_TYPE_DEPENDENCY_INFO, true, true, "VUID-VkDependencyInfo-sType-sType",
         "VUID-vkCmdWaitEvents2-pDependencyInfos-parameter", "VUID-vkCmdWaitEvents2-eventCount-arraylength");
     if (pDependencyInfos != nullptr) {
+        [[maybe_unused]] Location pDependencyInfos_loc = loc.dot(Field::pDependencyInfos);
         for (uint32_t eventIndex = 0; eventIndex < eventCount; ++eventIndex) {
-            [[maybe_unused]] const Location pDependencyInfos_loc = loc.dot(Field::pDependencyInfos, eventIndex);
+            pDependencyInfos_loc.index = eventIndex;
             skip |= ValidateStructPnext(pDependencyInfos_loc, pDependencyInfos[eventIndex].pNext, 0, nullptr,
                                         GeneratedVulkanHeaderVersion, "VUID-VkDependencyInfo-pNext-pNext", kVUIDUndefined,
                                         VK_NULL_HANDLE, true);
@@ -15637,10 +15404,10 @@ bool StatelessValidation::PreCallValidateCmdWaitEvents2(VkCommandBuffer commandB
                 "VUID-VkMemoryBarrier2-sType-sType", "VUID-VkDependencyInfo-pMemoryBarriers-parameter", kVUIDUndefined);
 
             if (pDependencyInfos[eventIndex].pMemoryBarriers != nullptr) {
+                [[maybe_unused]] Location pMemoryBarriers_loc = pDependencyInfos_loc.dot(Field::pMemoryBarriers);
                 for (uint32_t memoryBarrierIndex = 0; memoryBarrierIndex < pDependencyInfos[eventIndex].memoryBarrierCount;
                      ++memoryBarrierIndex) {
-                    [[maybe_unused]] const Location pMemoryBarriers_loc =
-                        pDependencyInfos_loc.dot(Field::pMemoryBarriers, memoryBarrierIndex);
+                    pMemoryBarriers_loc.index = memoryBarrierIndex;
                     skip |= ValidateStructPnext(pMemoryBarriers_loc,
                                                 pDependencyInfos[eventIndex].pMemoryBarriers[memoryBarrierIndex].pNext, 0, nullptr,
                                                 GeneratedVulkanHeaderVersion, kVUIDUndefined, kVUIDUndefined, VK_NULL_HANDLE, true);
@@ -15674,10 +15441,10 @@ bool StatelessValidation::PreCallValidateCmdWaitEvents2(VkCommandBuffer commandB
                 "VUID-VkBufferMemoryBarrier2-sType-sType", "VUID-VkDependencyInfo-pBufferMemoryBarriers-parameter", kVUIDUndefined);
 
             if (pDependencyInfos[eventIndex].pBufferMemoryBarriers != nullptr) {
+                [[maybe_unused]] Location pBufferMemoryBarriers_loc = pDependencyInfos_loc.dot(Field::pBufferMemoryBarriers);
                 for (uint32_t bufferMemoryBarrierIndex = 0;
                      bufferMemoryBarrierIndex < pDependencyInfos[eventIndex].bufferMemoryBarrierCount; ++bufferMemoryBarrierIndex) {
-                    [[maybe_unused]] const Location pBufferMemoryBarriers_loc =
-                        pDependencyInfos_loc.dot(Field::pBufferMemoryBarriers, bufferMemoryBarrierIndex);
+                    pBufferMemoryBarriers_loc.index = bufferMemoryBarrierIndex;
                     constexpr std::array allowed_structs_VkBufferMemoryBarrier2 = {
                         VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_ACQUIRE_UNMODIFIED_EXT};
 
@@ -15723,10 +15490,10 @@ bool StatelessValidation::PreCallValidateCmdWaitEvents2(VkCommandBuffer commandB
                 "VUID-VkImageMemoryBarrier2-sType-sType", "VUID-VkDependencyInfo-pImageMemoryBarriers-parameter", kVUIDUndefined);
 
             if (pDependencyInfos[eventIndex].pImageMemoryBarriers != nullptr) {
+                [[maybe_unused]] Location pImageMemoryBarriers_loc = pDependencyInfos_loc.dot(Field::pImageMemoryBarriers);
                 for (uint32_t imageMemoryBarrierIndex = 0;
                      imageMemoryBarrierIndex < pDependencyInfos[eventIndex].imageMemoryBarrierCount; ++imageMemoryBarrierIndex) {
-                    [[maybe_unused]] const Location pImageMemoryBarriers_loc =
-                        pDependencyInfos_loc.dot(Field::pImageMemoryBarriers, imageMemoryBarrierIndex);
+                    pImageMemoryBarriers_loc.index = imageMemoryBarrierIndex;
                     constexpr std::array allowed_structs_VkImageMemoryBarrier2 = {
                         VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_ACQUIRE_UNMODIFIED_EXT, VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT};
 
@@ -15804,9 +15571,9 @@ bool StatelessValidation::PreCallValidateCmdPipelineBarrier2(VkCommandBuffer com
                                         "VUID-VkDependencyInfo-pMemoryBarriers-parameter", kVUIDUndefined);
 
         if (pDependencyInfo->pMemoryBarriers != nullptr) {
+            [[maybe_unused]] Location pMemoryBarriers_loc = pDependencyInfo_loc.dot(Field::pMemoryBarriers);
             for (uint32_t memoryBarrierIndex = 0; memoryBarrierIndex < pDependencyInfo->memoryBarrierCount; ++memoryBarrierIndex) {
-                [[maybe_unused]] const Location pMemoryBarriers_loc =
-                    pDependencyInfo_loc.dot(Field::pMemoryBarriers, memoryBarrierIndex);
+                pMemoryBarriers_loc.index = memoryBarrierIndex;
                 skip |=
                     ValidateStructPnext(pMemoryBarriers_loc, pDependencyInfo->pMemoryBarriers[memoryBarrierIndex].pNext, 0, nullptr,
                                         GeneratedVulkanHeaderVersion, kVUIDUndefined, kVUIDUndefined, VK_NULL_HANDLE, true);
@@ -15838,10 +15605,10 @@ bool StatelessValidation::PreCallValidateCmdPipelineBarrier2(VkCommandBuffer com
             "VUID-VkBufferMemoryBarrier2-sType-sType", "VUID-VkDependencyInfo-pBufferMemoryBarriers-parameter", kVUIDUndefined);
 
         if (pDependencyInfo->pBufferMemoryBarriers != nullptr) {
+            [[maybe_unused]] Location pBufferMemoryBarriers_loc = pDependencyInfo_loc.dot(Field::pBufferMemoryBarriers);
             for (uint32_t bufferMemoryBarrierIndex = 0; bufferMemoryBarrierIndex < pDependencyInfo->bufferMemoryBarrierCount;
                  ++bufferMemoryBarrierIndex) {
-                [[maybe_unused]] const Location pBufferMemoryBarriers_loc =
-                    pDependencyInfo_loc.dot(Field::pBufferMemoryBarriers, bufferMemoryBarrierIndex);
+                pBufferMemoryBarriers_loc.index = bufferMemoryBarrierIndex;
                 constexpr std::array allowed_structs_VkBufferMemoryBarrier2 = {
                     VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_ACQUIRE_UNMODIFIED_EXT};
 
@@ -15883,10 +15650,10 @@ bool StatelessValidation::PreCallValidateCmdPipelineBarrier2(VkCommandBuffer com
             "VUID-VkImageMemoryBarrier2-sType-sType", "VUID-VkDependencyInfo-pImageMemoryBarriers-parameter", kVUIDUndefined);
 
         if (pDependencyInfo->pImageMemoryBarriers != nullptr) {
+            [[maybe_unused]] Location pImageMemoryBarriers_loc = pDependencyInfo_loc.dot(Field::pImageMemoryBarriers);
             for (uint32_t imageMemoryBarrierIndex = 0; imageMemoryBarrierIndex < pDependencyInfo->imageMemoryBarrierCount;
                  ++imageMemoryBarrierIndex) {
-                [[maybe_unused]] const Location pImageMemoryBarriers_loc =
-                    pDependencyInfo_loc.dot(Field::pImageMemoryBarriers, imageMemoryBarrierIndex);
+                pImageMemoryBarriers_loc.index = imageMemoryBarrierIndex;
                 constexpr std::array allowed_structs_VkImageMemoryBarrier2 = {
                     VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_ACQUIRE_UNMODIFIED_EXT, VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT};
 
@@ -15957,8 +15724,9 @@ bool StatelessValidation::PreCallValidateQueueSubmit2(VkQueue queue, uint32_t su
                                     submitCount, pSubmits, VK_STRUCTURE_TYPE_SUBMIT_INFO_2, false, true,
                                     "VUID-VkSubmitInfo2-sType-sType", "VUID-vkQueueSubmit2-pSubmits-parameter", kVUIDUndefined);
     if (pSubmits != nullptr) {
+        [[maybe_unused]] Location pSubmits_loc = loc.dot(Field::pSubmits);
         for (uint32_t submitIndex = 0; submitIndex < submitCount; ++submitIndex) {
-            [[maybe_unused]] const Location pSubmits_loc = loc.dot(Field::pSubmits, submitIndex);
+            pSubmits_loc.index = submitIndex;
             constexpr std::array allowed_structs_VkSubmitInfo2 = {
                 VK_STRUCTURE_TYPE_FRAME_BOUNDARY_EXT, VK_STRUCTURE_TYPE_LATENCY_SUBMISSION_PRESENT_ID_NV,
                 VK_STRUCTURE_TYPE_PERFORMANCE_QUERY_SUBMIT_INFO_KHR, VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHR,
@@ -15978,10 +15746,10 @@ bool StatelessValidation::PreCallValidateQueueSubmit2(VkQueue queue, uint32_t su
                 "VUID-VkSemaphoreSubmitInfo-sType-sType", "VUID-VkSubmitInfo2-pWaitSemaphoreInfos-parameter", kVUIDUndefined);
 
             if (pSubmits[submitIndex].pWaitSemaphoreInfos != nullptr) {
+                [[maybe_unused]] Location pWaitSemaphoreInfos_loc = pSubmits_loc.dot(Field::pWaitSemaphoreInfos);
                 for (uint32_t waitSemaphoreInfoIndex = 0; waitSemaphoreInfoIndex < pSubmits[submitIndex].waitSemaphoreInfoCount;
                      ++waitSemaphoreInfoIndex) {
-                    [[maybe_unused]] const Location pWaitSemaphoreInfos_loc =
-                        pSubmits_loc.dot(Field::pWaitSemaphoreInfos, waitSemaphoreInfoIndex);
+                    pWaitSemaphoreInfos_loc.index = waitSemaphoreInfoIndex;
                     skip |= ValidateStructPnext(pWaitSemaphoreInfos_loc,
                                                 pSubmits[submitIndex].pWaitSemaphoreInfos[waitSemaphoreInfoIndex].pNext, 0, nullptr,
                                                 GeneratedVulkanHeaderVersion, "VUID-VkSemaphoreSubmitInfo-pNext-pNext",
@@ -16004,10 +15772,10 @@ bool StatelessValidation::PreCallValidateQueueSubmit2(VkQueue queue, uint32_t su
                 "VUID-VkCommandBufferSubmitInfo-sType-sType", "VUID-VkSubmitInfo2-pCommandBufferInfos-parameter", kVUIDUndefined);
 
             if (pSubmits[submitIndex].pCommandBufferInfos != nullptr) {
+                [[maybe_unused]] Location pCommandBufferInfos_loc = pSubmits_loc.dot(Field::pCommandBufferInfos);
                 for (uint32_t commandBufferInfoIndex = 0; commandBufferInfoIndex < pSubmits[submitIndex].commandBufferInfoCount;
                      ++commandBufferInfoIndex) {
-                    [[maybe_unused]] const Location pCommandBufferInfos_loc =
-                        pSubmits_loc.dot(Field::pCommandBufferInfos, commandBufferInfoIndex);
+                    pCommandBufferInfos_loc.index = commandBufferInfoIndex;
                     constexpr std::array allowed_structs_VkCommandBufferSubmitInfo = {
                         VK_STRUCTURE_TYPE_RENDER_PASS_STRIPE_SUBMIT_INFO_ARM};
 
@@ -16029,10 +15797,10 @@ bool StatelessValidation::PreCallValidateQueueSubmit2(VkQueue queue, uint32_t su
                 "VUID-VkSemaphoreSubmitInfo-sType-sType", "VUID-VkSubmitInfo2-pSignalSemaphoreInfos-parameter", kVUIDUndefined);
 
             if (pSubmits[submitIndex].pSignalSemaphoreInfos != nullptr) {
+                [[maybe_unused]] Location pSignalSemaphoreInfos_loc = pSubmits_loc.dot(Field::pSignalSemaphoreInfos);
                 for (uint32_t signalSemaphoreInfoIndex = 0;
                      signalSemaphoreInfoIndex < pSubmits[submitIndex].signalSemaphoreInfoCount; ++signalSemaphoreInfoIndex) {
-                    [[maybe_unused]] const Location pSignalSemaphoreInfos_loc =
-                        pSubmits_loc.dot(Field::pSignalSemaphoreInfos, signalSemaphoreInfoIndex);
+                    pSignalSemaphoreInfos_loc.index = signalSemaphoreInfoIndex;
                     skip |= ValidateStructPnext(pSignalSemaphoreInfos_loc,
                                                 pSubmits[submitIndex].pSignalSemaphoreInfos[signalSemaphoreInfoIndex].pNext, 0,
                                                 nullptr, GeneratedVulkanHeaderVersion, "VUID-VkSemaphoreSubmitInfo-pNext-pNext",
@@ -16075,8 +15843,9 @@ bool StatelessValidation::PreCallValidateCmdCopyBuffer2(VkCommandBuffer commandB
                                     "VUID-VkCopyBufferInfo2-pRegions-parameter", "VUID-VkCopyBufferInfo2-regionCount-arraylength");
 
         if (pCopyBufferInfo->pRegions != nullptr) {
+            [[maybe_unused]] Location pRegions_loc = pCopyBufferInfo_loc.dot(Field::pRegions);
             for (uint32_t regionIndex = 0; regionIndex < pCopyBufferInfo->regionCount; ++regionIndex) {
-                [[maybe_unused]] const Location pRegions_loc = pCopyBufferInfo_loc.dot(Field::pRegions, regionIndex);
+                pRegions_loc.index = regionIndex;
                 skip |= ValidateStructPnext(pRegions_loc, pCopyBufferInfo->pRegions[regionIndex].pNext, 0, nullptr,
                                             GeneratedVulkanHeaderVersion, "VUID-VkBufferCopy2-pNext-pNext", kVUIDUndefined,
                                             VK_NULL_HANDLE, true);
@@ -16116,8 +15885,9 @@ bool StatelessValidation::PreCallValidateCmdCopyImage2(VkCommandBuffer commandBu
                                     "VUID-VkCopyImageInfo2-pRegions-parameter", "VUID-VkCopyImageInfo2-regionCount-arraylength");
 
         if (pCopyImageInfo->pRegions != nullptr) {
+            [[maybe_unused]] Location pRegions_loc = pCopyImageInfo_loc.dot(Field::pRegions);
             for (uint32_t regionIndex = 0; regionIndex < pCopyImageInfo->regionCount; ++regionIndex) {
-                [[maybe_unused]] const Location pRegions_loc = pCopyImageInfo_loc.dot(Field::pRegions, regionIndex);
+                pRegions_loc.index = regionIndex;
                 skip |= ValidateStructPnext(pRegions_loc, pCopyImageInfo->pRegions[regionIndex].pNext, 0, nullptr,
                                             GeneratedVulkanHeaderVersion, "VUID-VkImageCopy2-pNext-pNext", kVUIDUndefined,
                                             VK_NULL_HANDLE, true);
@@ -16127,16 +15897,10 @@ bool StatelessValidation::PreCallValidateCmdCopyImage2(VkCommandBuffer commandBu
                                       kRequiredFlags, "VUID-VkImageSubresourceLayers-aspectMask-parameter",
                                       "VUID-VkImageSubresourceLayers-aspectMask-requiredbitmask");
 
-                // No xml-driven validation
-
                 skip |= ValidateFlags(pRegions_loc.dot(Field::aspectMask), vvl::FlagBitmask::VkImageAspectFlagBits,
                                       AllVkImageAspectFlagBits, pCopyImageInfo->pRegions[regionIndex].dstSubresource.aspectMask,
                                       kRequiredFlags, "VUID-VkImageSubresourceLayers-aspectMask-parameter",
                                       "VUID-VkImageSubresourceLayers-aspectMask-requiredbitmask");
-
-                // No xml-driven validation
-
-                // No xml-driven validation
             }
         }
     }
@@ -16173,8 +15937,9 @@ bool StatelessValidation::PreCallValidateCmdCopyBufferToImage2(VkCommandBuffer c
             "VUID-VkCopyBufferToImageInfo2-pRegions-parameter", "VUID-VkCopyBufferToImageInfo2-regionCount-arraylength");
 
         if (pCopyBufferToImageInfo->pRegions != nullptr) {
+            [[maybe_unused]] Location pRegions_loc = pCopyBufferToImageInfo_loc.dot(Field::pRegions);
             for (uint32_t regionIndex = 0; regionIndex < pCopyBufferToImageInfo->regionCount; ++regionIndex) {
-                [[maybe_unused]] const Location pRegions_loc = pCopyBufferToImageInfo_loc.dot(Field::pRegions, regionIndex);
+                pRegions_loc.index = regionIndex;
                 constexpr std::array allowed_structs_VkBufferImageCopy2 = {VK_STRUCTURE_TYPE_COPY_COMMAND_TRANSFORM_INFO_QCOM};
 
                 skip |= ValidateStructPnext(pRegions_loc, pCopyBufferToImageInfo->pRegions[regionIndex].pNext,
@@ -16187,10 +15952,6 @@ bool StatelessValidation::PreCallValidateCmdCopyBufferToImage2(VkCommandBuffer c
                                       pCopyBufferToImageInfo->pRegions[regionIndex].imageSubresource.aspectMask, kRequiredFlags,
                                       "VUID-VkImageSubresourceLayers-aspectMask-parameter",
                                       "VUID-VkImageSubresourceLayers-aspectMask-requiredbitmask");
-
-                // No xml-driven validation
-
-                // No xml-driven validation
             }
         }
     }
@@ -16227,8 +15988,9 @@ bool StatelessValidation::PreCallValidateCmdCopyImageToBuffer2(VkCommandBuffer c
             "VUID-VkCopyImageToBufferInfo2-pRegions-parameter", "VUID-VkCopyImageToBufferInfo2-regionCount-arraylength");
 
         if (pCopyImageToBufferInfo->pRegions != nullptr) {
+            [[maybe_unused]] Location pRegions_loc = pCopyImageToBufferInfo_loc.dot(Field::pRegions);
             for (uint32_t regionIndex = 0; regionIndex < pCopyImageToBufferInfo->regionCount; ++regionIndex) {
-                [[maybe_unused]] const Location pRegions_loc = pCopyImageToBufferInfo_loc.dot(Field::pRegions, regionIndex);
+                pRegions_loc.index = regionIndex;
                 constexpr std::array allowed_structs_VkBufferImageCopy2 = {VK_STRUCTURE_TYPE_COPY_COMMAND_TRANSFORM_INFO_QCOM};
 
                 skip |= ValidateStructPnext(pRegions_loc, pCopyImageToBufferInfo->pRegions[regionIndex].pNext,
@@ -16241,10 +16003,6 @@ bool StatelessValidation::PreCallValidateCmdCopyImageToBuffer2(VkCommandBuffer c
                                       pCopyImageToBufferInfo->pRegions[regionIndex].imageSubresource.aspectMask, kRequiredFlags,
                                       "VUID-VkImageSubresourceLayers-aspectMask-parameter",
                                       "VUID-VkImageSubresourceLayers-aspectMask-requiredbitmask");
-
-                // No xml-driven validation
-
-                // No xml-driven validation
             }
         }
     }
@@ -16284,8 +16042,9 @@ bool StatelessValidation::PreCallValidateCmdBlitImage2(VkCommandBuffer commandBu
                                     "VUID-VkBlitImageInfo2-pRegions-parameter", "VUID-VkBlitImageInfo2-regionCount-arraylength");
 
         if (pBlitImageInfo->pRegions != nullptr) {
+            [[maybe_unused]] Location pRegions_loc = pBlitImageInfo_loc.dot(Field::pRegions);
             for (uint32_t regionIndex = 0; regionIndex < pBlitImageInfo->regionCount; ++regionIndex) {
-                [[maybe_unused]] const Location pRegions_loc = pBlitImageInfo_loc.dot(Field::pRegions, regionIndex);
+                pRegions_loc.index = regionIndex;
                 constexpr std::array allowed_structs_VkImageBlit2 = {VK_STRUCTURE_TYPE_COPY_COMMAND_TRANSFORM_INFO_QCOM};
 
                 skip |= ValidateStructPnext(pRegions_loc, pBlitImageInfo->pRegions[regionIndex].pNext,
@@ -16341,8 +16100,9 @@ bool StatelessValidation::PreCallValidateCmdResolveImage2(VkCommandBuffer comman
                                         "VUID-VkResolveImageInfo2-regionCount-arraylength");
 
         if (pResolveImageInfo->pRegions != nullptr) {
+            [[maybe_unused]] Location pRegions_loc = pResolveImageInfo_loc.dot(Field::pRegions);
             for (uint32_t regionIndex = 0; regionIndex < pResolveImageInfo->regionCount; ++regionIndex) {
-                [[maybe_unused]] const Location pRegions_loc = pResolveImageInfo_loc.dot(Field::pRegions, regionIndex);
+                pRegions_loc.index = regionIndex;
                 skip |= ValidateStructPnext(pRegions_loc, pResolveImageInfo->pRegions[regionIndex].pNext, 0, nullptr,
                                             GeneratedVulkanHeaderVersion, "VUID-VkImageResolve2-pNext-pNext", kVUIDUndefined,
                                             VK_NULL_HANDLE, true);
@@ -16352,16 +16112,10 @@ bool StatelessValidation::PreCallValidateCmdResolveImage2(VkCommandBuffer comman
                                       kRequiredFlags, "VUID-VkImageSubresourceLayers-aspectMask-parameter",
                                       "VUID-VkImageSubresourceLayers-aspectMask-requiredbitmask");
 
-                // No xml-driven validation
-
                 skip |= ValidateFlags(pRegions_loc.dot(Field::aspectMask), vvl::FlagBitmask::VkImageAspectFlagBits,
                                       AllVkImageAspectFlagBits, pResolveImageInfo->pRegions[regionIndex].dstSubresource.aspectMask,
                                       kRequiredFlags, "VUID-VkImageSubresourceLayers-aspectMask-parameter",
                                       "VUID-VkImageSubresourceLayers-aspectMask-requiredbitmask");
-
-                // No xml-driven validation
-
-                // No xml-driven validation
             }
         }
     }
@@ -16393,10 +16147,6 @@ bool StatelessValidation::PreCallValidateCmdBeginRendering(VkCommandBuffer comma
         skip |= ValidateFlags(pRenderingInfo_loc.dot(Field::flags), vvl::FlagBitmask::VkRenderingFlagBits, AllVkRenderingFlagBits,
                               pRenderingInfo->flags, kOptionalFlags, "VUID-VkRenderingInfo-flags-parameter");
 
-        // No xml-driven validation
-
-        // No xml-driven validation
-
         skip |= ValidateStructTypeArray(
             pRenderingInfo_loc.dot(Field::colorAttachmentCount), pRenderingInfo_loc.dot(Field::pColorAttachments),
             "VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO", pRenderingInfo->colorAttachmentCount, pRenderingInfo->pColorAttachments,
@@ -16404,10 +16154,10 @@ bool StatelessValidation::PreCallValidateCmdBeginRendering(VkCommandBuffer comma
             "VUID-VkRenderingInfo-pColorAttachments-parameter", kVUIDUndefined);
 
         if (pRenderingInfo->pColorAttachments != nullptr) {
+            [[maybe_unused]] Location pColorAttachments_loc = pRenderingInfo_loc.dot(Field::pColorAttachments);
             for (uint32_t colorAttachmentIndex = 0; colorAttachmentIndex < pRenderingInfo->colorAttachmentCount;
                  ++colorAttachmentIndex) {
-                [[maybe_unused]] const Location pColorAttachments_loc =
-                    pRenderingInfo_loc.dot(Field::pColorAttachments, colorAttachmentIndex);
+                pColorAttachments_loc.index = colorAttachmentIndex;
                 skip |= ValidateStructPnext(pColorAttachments_loc, pRenderingInfo->pColorAttachments[colorAttachmentIndex].pNext, 0,
                                             nullptr, GeneratedVulkanHeaderVersion, "VUID-VkRenderingAttachmentInfo-pNext-pNext",
                                             kVUIDUndefined, VK_NULL_HANDLE, true);
@@ -16431,8 +16181,6 @@ bool StatelessValidation::PreCallValidateCmdBeginRendering(VkCommandBuffer comma
                 skip |= ValidateRangedEnum(pColorAttachments_loc.dot(Field::storeOp), vvl::Enum::VkAttachmentStoreOp,
                                            pRenderingInfo->pColorAttachments[colorAttachmentIndex].storeOp,
                                            "VUID-VkRenderingAttachmentInfo-storeOp-parameter");
-
-                // No xml-driven validation
             }
         }
 
@@ -16464,8 +16212,6 @@ bool StatelessValidation::PreCallValidateCmdBeginRendering(VkCommandBuffer comma
             skip |=
                 ValidateRangedEnum(pDepthAttachment_loc.dot(Field::storeOp), vvl::Enum::VkAttachmentStoreOp,
                                    pRenderingInfo->pDepthAttachment->storeOp, "VUID-VkRenderingAttachmentInfo-storeOp-parameter");
-
-            // No xml-driven validation
         }
 
         skip |=
@@ -16498,8 +16244,6 @@ bool StatelessValidation::PreCallValidateCmdBeginRendering(VkCommandBuffer comma
             skip |=
                 ValidateRangedEnum(pStencilAttachment_loc.dot(Field::storeOp), vvl::Enum::VkAttachmentStoreOp,
                                    pRenderingInfo->pStencilAttachment->storeOp, "VUID-VkRenderingAttachmentInfo-storeOp-parameter");
-
-            // No xml-driven validation
         }
     }
     if (!skip) skip |= manual_PreCallValidateCmdBeginRendering(commandBuffer, pRenderingInfo, error_obj);
@@ -16548,12 +16292,6 @@ bool StatelessValidation::PreCallValidateCmdSetViewportWithCount(VkCommandBuffer
     skip |= ValidateArray(loc.dot(Field::viewportCount), loc.dot(Field::pViewports), viewportCount, &pViewports, true, true,
                           "VUID-vkCmdSetViewportWithCount-viewportCount-arraylength",
                           "VUID-vkCmdSetViewportWithCount-pViewports-parameter");
-    if (pViewports != nullptr) {
-        for (uint32_t viewportIndex = 0; viewportIndex < viewportCount; ++viewportIndex) {
-            [[maybe_unused]] const Location pViewports_loc = loc.dot(Field::pViewports, viewportIndex);
-            // No xml-driven validation
-        }
-    }
     if (!skip) skip |= manual_PreCallValidateCmdSetViewportWithCount(commandBuffer, viewportCount, pViewports, error_obj);
     return skip;
 }
@@ -16565,14 +16303,6 @@ bool StatelessValidation::PreCallValidateCmdSetScissorWithCount(VkCommandBuffer
     skip |= ValidateArray(loc.dot(Field::scissorCount), loc.dot(Field::pScissors), scissorCount, &pScissors, true, true,
                           "VUID-vkCmdSetScissorWithCount-scissorCount-arraylength",
                           "VUID-vkCmdSetScissorWithCount-pScissors-parameter");
-    if (pScissors != nullptr) {
-        for (uint32_t scissorIndex = 0; scissorIndex < scissorCount; ++scissorIndex) {
-            [[maybe_unused]] const Location pScissors_loc = loc.dot(Field::pScissors, scissorIndex);
-            // No xml-driven validation
-
-            // No xml-driven validation
-        }
-    }
     if (!skip) skip |= manual_PreCallValidateCmdSetScissorWithCount(commandBuffer, scissorCount, pScissors, error_obj);
     return skip;
 }
@@ -16793,8 +16523,6 @@ bool StatelessValidation::PreCallValidateGetDeviceImageMemoryRequirements(VkDevi
             skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::format), vvl::Enum::VkFormat, pInfo->pCreateInfo->format,
                                        "VUID-VkImageCreateInfo-format-parameter");
 
-            // No xml-driven validation
-
             skip |= ValidateFlags(pCreateInfo_loc.dot(Field::samples), vvl::FlagBitmask::VkSampleCountFlagBits,
                                   AllVkSampleCountFlagBits, pInfo->pCreateInfo->samples, kRequiredSingleBit,
                                   "VUID-VkImageCreateInfo-samples-parameter", "VUID-VkImageCreateInfo-samples-parameter");
@@ -16890,8 +16618,6 @@ bool StatelessValidation::PreCallValidateGetDeviceImageSparseMemoryRequirements(
             skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::format), vvl::Enum::VkFormat, pInfo->pCreateInfo->format,
                                        "VUID-VkImageCreateInfo-format-parameter");
 
-            // No xml-driven validation
-
             skip |= ValidateFlags(pCreateInfo_loc.dot(Field::samples), vvl::FlagBitmask::VkSampleCountFlagBits,
                                   AllVkSampleCountFlagBits, pInfo->pCreateInfo->samples, kRequiredSingleBit,
                                   "VUID-VkImageCreateInfo-samples-parameter", "VUID-VkImageCreateInfo-samples-parameter");
@@ -16921,10 +16647,10 @@ bool StatelessValidation::PreCallValidateGetDeviceImageSparseMemoryRequirements(
                                     "VUID-vkGetDeviceImageSparseMemoryRequirements-pSparseMemoryRequirementCount-parameter",
                                     kVUIDUndefined);
     if (pSparseMemoryRequirements != nullptr) {
+        [[maybe_unused]] Location pSparseMemoryRequirements_loc = loc.dot(Field::pSparseMemoryRequirements);
         for (uint32_t pSparseMemoryRequirementIndex = 0; pSparseMemoryRequirementIndex < *pSparseMemoryRequirementCount;
              ++pSparseMemoryRequirementIndex) {
-            [[maybe_unused]] const Location pSparseMemoryRequirements_loc =
-                loc.dot(Field::pSparseMemoryRequirements, pSparseMemoryRequirementIndex);
+            pSparseMemoryRequirements_loc.index = pSparseMemoryRequirementIndex;
             skip |=
                 ValidateStructPnext(pSparseMemoryRequirements_loc, pSparseMemoryRequirements[pSparseMemoryRequirementIndex].pNext,
                                     0, nullptr, GeneratedVulkanHeaderVersion, "VUID-VkSparseImageMemoryRequirements2-pNext-pNext",
@@ -16994,10 +16720,6 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceSurfaceCapabilitiesKHR
     skip |= ValidateRequiredHandle(loc.dot(Field::surface), surface);
     skip |= ValidateRequiredPointer(loc.dot(Field::pSurfaceCapabilities), pSurfaceCapabilities,
                                     "VUID-vkGetPhysicalDeviceSurfaceCapabilitiesKHR-pSurfaceCapabilities-parameter");
-    if (pSurfaceCapabilities != nullptr) {
-        [[maybe_unused]] const Location pSurfaceCapabilities_loc = loc.dot(Field::pSurfaceCapabilities);
-        // No xml-driven validation
-    }
     return skip;
 }
 
@@ -17012,12 +16734,6 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceSurfaceFormatsKHR(VkPh
                                  &pSurfaceFormats, true, false, false,
                                  "VUID-vkGetPhysicalDeviceSurfaceFormatsKHR-pSurfaceFormatCount-parameter", kVUIDUndefined,
                                  "VUID-vkGetPhysicalDeviceSurfaceFormatsKHR-pSurfaceFormats-parameter");
-    if (pSurfaceFormats != nullptr) {
-        for (uint32_t pSurfaceFormatIndex = 0; pSurfaceFormatIndex < *pSurfaceFormatCount; ++pSurfaceFormatIndex) {
-            [[maybe_unused]] const Location pSurfaceFormats_loc = loc.dot(Field::pSurfaceFormats, pSurfaceFormatIndex);
-            // No xml-driven validation
-        }
-    }
     if (!skip)
         skip |= manual_PreCallValidateGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount,
                                                                          pSurfaceFormats, error_obj);
@@ -17082,8 +16798,6 @@ bool StatelessValidation::PreCallValidateCreateSwapchainKHR(VkDevice device, con
         skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::imageColorSpace), vvl::Enum::VkColorSpaceKHR,
                                    pCreateInfo->imageColorSpace, "VUID-VkSwapchainCreateInfoKHR-imageColorSpace-parameter");
 
-        // No xml-driven validation
-
         skip |=
             ValidateFlags(pCreateInfo_loc.dot(Field::imageUsage), vvl::FlagBitmask::VkImageUsageFlagBits, AllVkImageUsageFlagBits,
                           pCreateInfo->imageUsage, kRequiredFlags, "VUID-VkSwapchainCreateInfoKHR-imageUsage-parameter",
@@ -17319,12 +17033,6 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceDisplayPropertiesKHR(V
     skip |= ValidatePointerArray(loc.dot(Field::pPropertyCount), loc.dot(Field::pProperties), pPropertyCount, &pProperties, true,
                                  false, false, "VUID-vkGetPhysicalDeviceDisplayPropertiesKHR-pPropertyCount-parameter",
                                  kVUIDUndefined, "VUID-vkGetPhysicalDeviceDisplayPropertiesKHR-pProperties-parameter");
-    if (pProperties != nullptr) {
-        for (uint32_t pPropertyIndex = 0; pPropertyIndex < *pPropertyCount; ++pPropertyIndex) {
-            [[maybe_unused]] const Location pProperties_loc = loc.dot(Field::pProperties, pPropertyIndex);
-            // No xml-driven validation
-        }
-    }
     return skip;
 }
 
@@ -17338,12 +17046,6 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceDisplayPlaneProperties
     skip |= ValidatePointerArray(loc.dot(Field::pPropertyCount), loc.dot(Field::pProperties), pPropertyCount, &pProperties, true,
                                  false, false, "VUID-vkGetPhysicalDeviceDisplayPlanePropertiesKHR-pPropertyCount-parameter",
                                  kVUIDUndefined, "VUID-vkGetPhysicalDeviceDisplayPlanePropertiesKHR-pProperties-parameter");
-    if (pProperties != nullptr) {
-        for (uint32_t pPropertyIndex = 0; pPropertyIndex < *pPropertyCount; ++pPropertyIndex) {
-            [[maybe_unused]] const Location pProperties_loc = loc.dot(Field::pProperties, pPropertyIndex);
-            // No xml-driven validation
-        }
-    }
     return skip;
 }
 
@@ -17370,12 +17072,6 @@ bool StatelessValidation::PreCallValidateGetDisplayModePropertiesKHR(VkPhysicalD
     skip |= ValidatePointerArray(loc.dot(Field::pPropertyCount), loc.dot(Field::pProperties), pPropertyCount, &pProperties, true,
                                  false, false, "VUID-vkGetDisplayModePropertiesKHR-pPropertyCount-parameter", kVUIDUndefined,
                                  "VUID-vkGetDisplayModePropertiesKHR-pProperties-parameter");
-    if (pProperties != nullptr) {
-        for (uint32_t pPropertyIndex = 0; pPropertyIndex < *pPropertyCount; ++pPropertyIndex) {
-            [[maybe_unused]] const Location pProperties_loc = loc.dot(Field::pProperties, pPropertyIndex);
-            // No xml-driven validation
-        }
-    }
     return skip;
 }
 
@@ -17397,8 +17093,6 @@ bool StatelessValidation::PreCallValidateCreateDisplayModeKHR(VkPhysicalDevice p
 
         skip |= ValidateReservedFlags(pCreateInfo_loc.dot(Field::flags), pCreateInfo->flags,
                                       "VUID-VkDisplayModeCreateInfoKHR-flags-zerobitmask");
-
-        // No xml-driven validation
     }
     if (pAllocator != nullptr) {
         [[maybe_unused]] const Location pAllocator_loc = loc.dot(Field::pAllocator);
@@ -17441,10 +17135,6 @@ bool StatelessValidation::PreCallValidateGetDisplayPlaneCapabilitiesKHR(VkPhysic
     skip |= ValidateRequiredHandle(loc.dot(Field::mode), mode);
     skip |= ValidateRequiredPointer(loc.dot(Field::pCapabilities), pCapabilities,
                                     "VUID-vkGetDisplayPlaneCapabilitiesKHR-pCapabilities-parameter");
-    if (pCapabilities != nullptr) {
-        [[maybe_unused]] const Location pCapabilities_loc = loc.dot(Field::pCapabilities);
-        // No xml-driven validation
-    }
     return skip;
 }
 
@@ -17478,8 +17168,6 @@ bool StatelessValidation::PreCallValidateCreateDisplayPlaneSurfaceKHR(VkInstance
                               AllVkDisplayPlaneAlphaFlagBitsKHR, pCreateInfo->alphaMode, kRequiredSingleBit,
                               "VUID-VkDisplaySurfaceCreateInfoKHR-alphaMode-parameter",
                               "VUID-VkDisplaySurfaceCreateInfoKHR-alphaMode-parameter");
-
-        // No xml-driven validation
     }
     if (pAllocator != nullptr) {
         [[maybe_unused]] const Location pAllocator_loc = loc.dot(Field::pAllocator);
@@ -17524,8 +17212,9 @@ bool StatelessValidation::PreCallValidateCreateSharedSwapchainsKHR(VkDevice devi
         pCreateInfos, VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR, true, true, "VUID-VkSwapchainCreateInfoKHR-sType-sType",
         "VUID-vkCreateSharedSwapchainsKHR-pCreateInfos-parameter", "VUID-vkCreateSharedSwapchainsKHR-swapchainCount-arraylength");
     if (pCreateInfos != nullptr) {
+        [[maybe_unused]] Location pCreateInfos_loc = loc.dot(Field::pCreateInfos);
         for (uint32_t swapchainIndex = 0; swapchainIndex < swapchainCount; ++swapchainIndex) {
-            [[maybe_unused]] const Location pCreateInfos_loc = loc.dot(Field::pCreateInfos, swapchainIndex);
+            pCreateInfos_loc.index = swapchainIndex;
             constexpr std::array allowed_structs_VkSwapchainCreateInfoKHR = {
                 VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR,
                 VK_STRUCTURE_TYPE_IMAGE_COMPRESSION_CONTROL_EXT,
@@ -17558,8 +17247,6 @@ bool StatelessValidation::PreCallValidateCreateSharedSwapchainsKHR(VkDevice devi
                                        pCreateInfos[swapchainIndex].imageColorSpace,
                                        "VUID-VkSwapchainCreateInfoKHR-imageColorSpace-parameter");
 
-            // No xml-driven validation
-
             skip |= ValidateFlags(pCreateInfos_loc.dot(Field::imageUsage), vvl::FlagBitmask::VkImageUsageFlagBits,
                                   AllVkImageUsageFlagBits, pCreateInfos[swapchainIndex].imageUsage, kRequiredFlags,
                                   "VUID-VkSwapchainCreateInfoKHR-imageUsage-parameter",
@@ -18018,10 +17705,10 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceVideoFormatPropertiesK
         "VUID-vkGetPhysicalDeviceVideoFormatPropertiesKHR-pVideoFormatProperties-parameter",
         "VUID-vkGetPhysicalDeviceVideoFormatPropertiesKHR-pVideoFormatPropertyCount-parameter", kVUIDUndefined);
     if (pVideoFormatProperties != nullptr) {
+        [[maybe_unused]] Location pVideoFormatProperties_loc = loc.dot(Field::pVideoFormatProperties);
         for (uint32_t pVideoFormatPropertyIndex = 0; pVideoFormatPropertyIndex < *pVideoFormatPropertyCount;
              ++pVideoFormatPropertyIndex) {
-            [[maybe_unused]] const Location pVideoFormatProperties_loc =
-                loc.dot(Field::pVideoFormatProperties, pVideoFormatPropertyIndex);
+            pVideoFormatProperties_loc.index = pVideoFormatPropertyIndex;
             skip |= ValidateStructPnext(pVideoFormatProperties_loc, pVideoFormatProperties[pVideoFormatPropertyIndex].pNext, 0,
                                         nullptr, GeneratedVulkanHeaderVersion, "VUID-VkVideoFormatPropertiesKHR-pNext-pNext",
                                         kVUIDUndefined, physicalDevice, false);
@@ -18100,19 +17787,12 @@ bool StatelessValidation::PreCallValidateCreateVideoSessionKHR(VkDevice device,
         skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::pictureFormat), vvl::Enum::VkFormat, pCreateInfo->pictureFormat,
                                    "VUID-VkVideoSessionCreateInfoKHR-pictureFormat-parameter");
 
-        // No xml-driven validation
-
         skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::referencePictureFormat), vvl::Enum::VkFormat,
                                    pCreateInfo->referencePictureFormat,
                                    "VUID-VkVideoSessionCreateInfoKHR-referencePictureFormat-parameter");
 
         skip |= ValidateRequiredPointer(pCreateInfo_loc.dot(Field::pStdHeaderVersion), pCreateInfo->pStdHeaderVersion,
                                         "VUID-VkVideoSessionCreateInfoKHR-pStdHeaderVersion-parameter");
-
-        if (pCreateInfo->pStdHeaderVersion != nullptr) {
-            [[maybe_unused]] const Location pStdHeaderVersion_loc = pCreateInfo_loc.dot(Field::pStdHeaderVersion);
-            // No xml-driven validation
-        }
     }
     if (pAllocator != nullptr) {
         [[maybe_unused]] const Location pAllocator_loc = loc.dot(Field::pAllocator);
@@ -18195,9 +17875,10 @@ bool StatelessValidation::PreCallValidateGetVideoSessionMemoryRequirementsKHR(
                                 "VUID-vkGetVideoSessionMemoryRequirementsKHR-pMemoryRequirements-parameter",
                                 "VUID-vkGetVideoSessionMemoryRequirementsKHR-pMemoryRequirementsCount-parameter", kVUIDUndefined);
     if (pMemoryRequirements != nullptr) {
+        [[maybe_unused]] Location pMemoryRequirements_loc = loc.dot(Field::pMemoryRequirements);
         for (uint32_t pMemoryRequirementsIndex = 0; pMemoryRequirementsIndex < *pMemoryRequirementsCount;
              ++pMemoryRequirementsIndex) {
-            [[maybe_unused]] const Location pMemoryRequirements_loc = loc.dot(Field::pMemoryRequirements, pMemoryRequirementsIndex);
+            pMemoryRequirements_loc.index = pMemoryRequirementsIndex;
             skip |= ValidateStructPnext(pMemoryRequirements_loc, pMemoryRequirements[pMemoryRequirementsIndex].pNext, 0, nullptr,
                                         GeneratedVulkanHeaderVersion, "VUID-VkVideoSessionMemoryRequirementsKHR-pNext-pNext",
                                         kVUIDUndefined, VK_NULL_HANDLE, false);
@@ -18222,10 +17903,10 @@ bool StatelessValidation::PreCallValidateBindVideoSessionMemoryKHR(VkDevice devi
                                     "VUID-vkBindVideoSessionMemoryKHR-pBindSessionMemoryInfos-parameter",
                                     "VUID-vkBindVideoSessionMemoryKHR-bindSessionMemoryInfoCount-arraylength");
     if (pBindSessionMemoryInfos != nullptr) {
+        [[maybe_unused]] Location pBindSessionMemoryInfos_loc = loc.dot(Field::pBindSessionMemoryInfos);
         for (uint32_t bindSessionMemoryInfoIndex = 0; bindSessionMemoryInfoIndex < bindSessionMemoryInfoCount;
              ++bindSessionMemoryInfoIndex) {
-            [[maybe_unused]] const Location pBindSessionMemoryInfos_loc =
-                loc.dot(Field::pBindSessionMemoryInfos, bindSessionMemoryInfoIndex);
+            pBindSessionMemoryInfos_loc.index = bindSessionMemoryInfoIndex;
             skip |= ValidateStructPnext(pBindSessionMemoryInfos_loc, pBindSessionMemoryInfos[bindSessionMemoryInfoIndex].pNext, 0,
                                         nullptr, GeneratedVulkanHeaderVersion, "VUID-VkBindVideoSessionMemoryInfoKHR-pNext-pNext",
                                         kVUIDUndefined, VK_NULL_HANDLE, true);
@@ -18402,9 +18083,9 @@ bool StatelessValidation::PreCallValidateCmdBeginVideoCodingKHR(VkCommandBuffer
                                         "VUID-VkVideoBeginCodingInfoKHR-pReferenceSlots-parameter", kVUIDUndefined);
 
         if (pBeginInfo->pReferenceSlots != nullptr) {
+            [[maybe_unused]] Location pReferenceSlots_loc = pBeginInfo_loc.dot(Field::pReferenceSlots);
             for (uint32_t referenceSlotIndex = 0; referenceSlotIndex < pBeginInfo->referenceSlotCount; ++referenceSlotIndex) {
-                [[maybe_unused]] const Location pReferenceSlots_loc =
-                    pBeginInfo_loc.dot(Field::pReferenceSlots, referenceSlotIndex);
+                pReferenceSlots_loc.index = referenceSlotIndex;
                 constexpr std::array allowed_structs_VkVideoReferenceSlotInfoKHR = {
                     VK_STRUCTURE_TYPE_VIDEO_DECODE_AV1_DPB_SLOT_INFO_KHR, VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_DPB_SLOT_INFO_KHR,
                     VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_DPB_SLOT_INFO_KHR, VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_DPB_SLOT_INFO_KHR,
@@ -18430,10 +18111,6 @@ bool StatelessValidation::PreCallValidateCmdBeginVideoCodingKHR(VkCommandBuffer
                                                 GeneratedVulkanHeaderVersion, "VUID-VkVideoPictureResourceInfoKHR-pNext-pNext",
                                                 kVUIDUndefined, VK_NULL_HANDLE, true);
 
-                    // No xml-driven validation
-
-                    // No xml-driven validation
-
                     skip |=
                         ValidateRequiredHandle(pPictureResource_loc.dot(Field::imageViewBinding),
                                                pBeginInfo->pReferenceSlots[referenceSlotIndex].pPictureResource->imageViewBinding);
@@ -18529,10 +18206,6 @@ bool StatelessValidation::PreCallValidateCmdDecodeVideoKHR(VkCommandBuffer comma
             ValidateStructPnext(pDecodeInfo_loc, pDecodeInfo->dstPictureResource.pNext, 0, nullptr, GeneratedVulkanHeaderVersion,
                                 "VUID-VkVideoPictureResourceInfoKHR-pNext-pNext", kVUIDUndefined, VK_NULL_HANDLE, true);
 
-        // No xml-driven validation
-
-        // No xml-driven validation
-
         skip |=
             ValidateRequiredHandle(pDecodeInfo_loc.dot(Field::imageViewBinding), pDecodeInfo->dstPictureResource.imageViewBinding);
 
@@ -18565,10 +18238,6 @@ bool StatelessValidation::PreCallValidateCmdDecodeVideoKHR(VkCommandBuffer comma
                                             nullptr, GeneratedVulkanHeaderVersion, "VUID-VkVideoPictureResourceInfoKHR-pNext-pNext",
                                             kVUIDUndefined, VK_NULL_HANDLE, true);
 
-                // No xml-driven validation
-
-                // No xml-driven validation
-
                 skip |= ValidateRequiredHandle(pPictureResource_loc.dot(Field::imageViewBinding),
                                                pDecodeInfo->pSetupReferenceSlot->pPictureResource->imageViewBinding);
             }
@@ -18581,9 +18250,9 @@ bool StatelessValidation::PreCallValidateCmdDecodeVideoKHR(VkCommandBuffer comma
                                         "VUID-VkVideoDecodeInfoKHR-pReferenceSlots-parameter", kVUIDUndefined);
 
         if (pDecodeInfo->pReferenceSlots != nullptr) {
+            [[maybe_unused]] Location pReferenceSlots_loc = pDecodeInfo_loc.dot(Field::pReferenceSlots);
             for (uint32_t referenceSlotIndex = 0; referenceSlotIndex < pDecodeInfo->referenceSlotCount; ++referenceSlotIndex) {
-                [[maybe_unused]] const Location pReferenceSlots_loc =
-                    pDecodeInfo_loc.dot(Field::pReferenceSlots, referenceSlotIndex);
+                pReferenceSlots_loc.index = referenceSlotIndex;
                 constexpr std::array allowed_structs_VkVideoReferenceSlotInfoKHR = {
                     VK_STRUCTURE_TYPE_VIDEO_DECODE_AV1_DPB_SLOT_INFO_KHR, VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_DPB_SLOT_INFO_KHR,
                     VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_DPB_SLOT_INFO_KHR, VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_DPB_SLOT_INFO_KHR,
@@ -18609,10 +18278,6 @@ bool StatelessValidation::PreCallValidateCmdDecodeVideoKHR(VkCommandBuffer comma
                         GeneratedVulkanHeaderVersion, "VUID-VkVideoPictureResourceInfoKHR-pNext-pNext", kVUIDUndefined,
                         VK_NULL_HANDLE, true);
 
-                    // No xml-driven validation
-
-                    // No xml-driven validation
-
                     skip |=
                         ValidateRequiredHandle(pPictureResource_loc.dot(Field::imageViewBinding),
                                                pDecodeInfo->pReferenceSlots[referenceSlotIndex].pPictureResource->imageViewBinding);
@@ -19045,8 +18710,9 @@ bool StatelessValidation::PreCallValidateCmdPushDescriptorSetKHR(VkCommandBuffer
                                     "VUID-vkCmdPushDescriptorSetKHR-pDescriptorWrites-parameter",
                                     "VUID-vkCmdPushDescriptorSetKHR-descriptorWriteCount-arraylength");
     if (pDescriptorWrites != nullptr) {
+        [[maybe_unused]] Location pDescriptorWrites_loc = loc.dot(Field::pDescriptorWrites);
         for (uint32_t descriptorWriteIndex = 0; descriptorWriteIndex < descriptorWriteCount; ++descriptorWriteIndex) {
-            [[maybe_unused]] const Location pDescriptorWrites_loc = loc.dot(Field::pDescriptorWrites, descriptorWriteIndex);
+            pDescriptorWrites_loc.index = descriptorWriteIndex;
             constexpr std::array allowed_structs_VkWriteDescriptorSet = {
                 VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR,
                 VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV,
@@ -19314,8 +18980,9 @@ bool StatelessValidation::PreCallValidateEnumeratePhysicalDeviceQueueFamilyPerfo
         "VUID-vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR-pCounters-parameter",
         "VUID-vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR-pCounterCount-parameter", kVUIDUndefined);
     if (pCounters != nullptr) {
+        [[maybe_unused]] Location pCounters_loc = loc.dot(Field::pCounters);
         for (uint32_t pIndexerIndex = 0; pIndexerIndex < *pCounterCount; ++pIndexerIndex) {
-            [[maybe_unused]] const Location pCounters_loc = loc.dot(Field::pCounters, pIndexerIndex);
+            pCounters_loc.index = pIndexerIndex;
             skip |= ValidateStructPnext(pCounters_loc, pCounters[pIndexerIndex].pNext, 0, nullptr, GeneratedVulkanHeaderVersion,
                                         "VUID-VkPerformanceCounterKHR-pNext-pNext", kVUIDUndefined, physicalDevice, false);
         }
@@ -19328,8 +18995,9 @@ bool StatelessValidation::PreCallValidateEnumeratePhysicalDeviceQueueFamilyPerfo
         "VUID-vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR-pCounterDescriptions-parameter",
         "VUID-vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR-pCounterCount-parameter", kVUIDUndefined);
     if (pCounterDescriptions != nullptr) {
+        [[maybe_unused]] Location pCounterDescriptions_loc = loc.dot(Field::pCounterDescriptions);
         for (uint32_t pIndexerIndex = 0; pIndexerIndex < *pCounterCount; ++pIndexerIndex) {
-            [[maybe_unused]] const Location pCounterDescriptions_loc = loc.dot(Field::pCounterDescriptions, pIndexerIndex);
+            pCounterDescriptions_loc.index = pIndexerIndex;
             skip |= ValidateStructPnext(pCounterDescriptions_loc, pCounterDescriptions[pIndexerIndex].pNext, 0, nullptr,
                                         GeneratedVulkanHeaderVersion, "VUID-VkPerformanceCounterDescriptionKHR-pNext-pNext",
                                         kVUIDUndefined, physicalDevice, false);
@@ -19472,8 +19140,9 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceSurfaceFormats2KHR(VkP
         "VUID-VkSurfaceFormat2KHR-sType-sType", "VUID-vkGetPhysicalDeviceSurfaceFormats2KHR-pSurfaceFormats-parameter",
         "VUID-vkGetPhysicalDeviceSurfaceFormats2KHR-pSurfaceFormatCount-parameter", kVUIDUndefined);
     if (pSurfaceFormats != nullptr) {
+        [[maybe_unused]] Location pSurfaceFormats_loc = loc.dot(Field::pSurfaceFormats);
         for (uint32_t pSurfaceFormatIndex = 0; pSurfaceFormatIndex < *pSurfaceFormatCount; ++pSurfaceFormatIndex) {
-            [[maybe_unused]] const Location pSurfaceFormats_loc = loc.dot(Field::pSurfaceFormats, pSurfaceFormatIndex);
+            pSurfaceFormats_loc.index = pSurfaceFormatIndex;
             constexpr std::array allowed_structs_VkSurfaceFormat2KHR = {VK_STRUCTURE_TYPE_IMAGE_COMPRESSION_PROPERTIES_EXT};
 
             skip |= ValidateStructPnext(pSurfaceFormats_loc, pSurfaceFormats[pSurfaceFormatIndex].pNext,
@@ -19502,8 +19171,9 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceDisplayProperties2KHR(
         "VUID-vkGetPhysicalDeviceDisplayProperties2KHR-pProperties-parameter",
         "VUID-vkGetPhysicalDeviceDisplayProperties2KHR-pPropertyCount-parameter", kVUIDUndefined);
     if (pProperties != nullptr) {
+        [[maybe_unused]] Location pProperties_loc = loc.dot(Field::pProperties);
         for (uint32_t pPropertyIndex = 0; pPropertyIndex < *pPropertyCount; ++pPropertyIndex) {
-            [[maybe_unused]] const Location pProperties_loc = loc.dot(Field::pProperties, pPropertyIndex);
+            pProperties_loc.index = pPropertyIndex;
             skip |=
                 ValidateStructPnext(pProperties_loc, pProperties[pPropertyIndex].pNext, 0, nullptr, GeneratedVulkanHeaderVersion,
                                     "VUID-VkDisplayProperties2KHR-pNext-pNext", kVUIDUndefined, physicalDevice, false);
@@ -19526,8 +19196,9 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceDisplayPlaneProperties
         "VUID-VkDisplayPlaneProperties2KHR-sType-sType", "VUID-vkGetPhysicalDeviceDisplayPlaneProperties2KHR-pProperties-parameter",
         "VUID-vkGetPhysicalDeviceDisplayPlaneProperties2KHR-pPropertyCount-parameter", kVUIDUndefined);
     if (pProperties != nullptr) {
+        [[maybe_unused]] Location pProperties_loc = loc.dot(Field::pProperties);
         for (uint32_t pPropertyIndex = 0; pPropertyIndex < *pPropertyCount; ++pPropertyIndex) {
-            [[maybe_unused]] const Location pProperties_loc = loc.dot(Field::pProperties, pPropertyIndex);
+            pProperties_loc.index = pPropertyIndex;
             skip |=
                 ValidateStructPnext(pProperties_loc, pProperties[pPropertyIndex].pNext, 0, nullptr, GeneratedVulkanHeaderVersion,
                                     "VUID-VkDisplayPlaneProperties2KHR-pNext-pNext", kVUIDUndefined, physicalDevice, false);
@@ -19551,8 +19222,9 @@ bool StatelessValidation::PreCallValidateGetDisplayModeProperties2KHR(VkPhysical
         "VUID-VkDisplayModeProperties2KHR-sType-sType", "VUID-vkGetDisplayModeProperties2KHR-pProperties-parameter",
         "VUID-vkGetDisplayModeProperties2KHR-pPropertyCount-parameter", kVUIDUndefined);
     if (pProperties != nullptr) {
+        [[maybe_unused]] Location pProperties_loc = loc.dot(Field::pProperties);
         for (uint32_t pPropertyIndex = 0; pPropertyIndex < *pPropertyCount; ++pPropertyIndex) {
-            [[maybe_unused]] const Location pProperties_loc = loc.dot(Field::pProperties, pPropertyIndex);
+            pProperties_loc.index = pPropertyIndex;
             skip |=
                 ValidateStructPnext(pProperties_loc, pProperties[pPropertyIndex].pNext, 0, nullptr, GeneratedVulkanHeaderVersion,
                                     "VUID-VkDisplayModeProperties2KHR-pNext-pNext", kVUIDUndefined, physicalDevice, false);
@@ -19755,10 +19427,10 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceFragmentShadingRatesKH
                                     "VUID-vkGetPhysicalDeviceFragmentShadingRatesKHR-pFragmentShadingRateCount-parameter",
                                     kVUIDUndefined);
     if (pFragmentShadingRates != nullptr) {
+        [[maybe_unused]] Location pFragmentShadingRates_loc = loc.dot(Field::pFragmentShadingRates);
         for (uint32_t pFragmentShadingRateIndex = 0; pFragmentShadingRateIndex < *pFragmentShadingRateCount;
              ++pFragmentShadingRateIndex) {
-            [[maybe_unused]] const Location pFragmentShadingRates_loc =
-                loc.dot(Field::pFragmentShadingRates, pFragmentShadingRateIndex);
+            pFragmentShadingRates_loc.index = pFragmentShadingRateIndex;
             skip |=
                 ValidateStructPnext(pFragmentShadingRates_loc, pFragmentShadingRates[pFragmentShadingRateIndex].pNext, 0, nullptr,
                                     GeneratedVulkanHeaderVersion, "VUID-VkPhysicalDeviceFragmentShadingRateKHR-pNext-pNext",
@@ -19778,10 +19450,6 @@ bool StatelessValidation::PreCallValidateCmdSetFragmentShadingRateKHR(VkCommandB
         skip |= OutputExtensionError(loc, {vvl::Extension::_VK_KHR_fragment_shading_rate});
     skip |= ValidateRequiredPointer(loc.dot(Field::pFragmentSize), pFragmentSize,
                                     "VUID-vkCmdSetFragmentShadingRateKHR-pFragmentSize-parameter");
-    if (pFragmentSize != nullptr) {
-        [[maybe_unused]] const Location pFragmentSize_loc = loc.dot(Field::pFragmentSize);
-        // No xml-driven validation
-    }
     skip |= ValidateRangedEnumArray(loc, loc.dot(Field::combinerOps), vvl::Enum::VkFragmentShadingRateCombinerOpKHR, 2, combinerOps,
                                     false, true, kVUIDUndefined, "VUID-vkCmdSetFragmentShadingRateKHR-combinerOps-parameter");
     return skip;
@@ -19991,8 +19659,9 @@ bool StatelessValidation::PreCallValidateGetPipelineExecutablePropertiesKHR(VkDe
         "VUID-VkPipelineExecutablePropertiesKHR-sType-sType", "VUID-vkGetPipelineExecutablePropertiesKHR-pProperties-parameter",
         "VUID-vkGetPipelineExecutablePropertiesKHR-pExecutableCount-parameter", kVUIDUndefined);
     if (pProperties != nullptr) {
+        [[maybe_unused]] Location pProperties_loc = loc.dot(Field::pProperties);
         for (uint32_t pExecutableIndex = 0; pExecutableIndex < *pExecutableCount; ++pExecutableIndex) {
-            [[maybe_unused]] const Location pProperties_loc = loc.dot(Field::pProperties, pExecutableIndex);
+            pProperties_loc.index = pExecutableIndex;
             skip |=
                 ValidateStructPnext(pProperties_loc, pProperties[pExecutableIndex].pNext, 0, nullptr, GeneratedVulkanHeaderVersion,
                                     "VUID-VkPipelineExecutablePropertiesKHR-pNext-pNext", kVUIDUndefined, VK_NULL_HANDLE, false);
@@ -20027,8 +19696,9 @@ bool StatelessValidation::PreCallValidateGetPipelineExecutableStatisticsKHR(VkDe
         "VUID-VkPipelineExecutableStatisticKHR-sType-sType", "VUID-vkGetPipelineExecutableStatisticsKHR-pStatistics-parameter",
         "VUID-vkGetPipelineExecutableStatisticsKHR-pStatisticCount-parameter", kVUIDUndefined);
     if (pStatistics != nullptr) {
+        [[maybe_unused]] Location pStatistics_loc = loc.dot(Field::pStatistics);
         for (uint32_t pStatisticIndex = 0; pStatisticIndex < *pStatisticCount; ++pStatisticIndex) {
-            [[maybe_unused]] const Location pStatistics_loc = loc.dot(Field::pStatistics, pStatisticIndex);
+            pStatistics_loc.index = pStatisticIndex;
             skip |=
                 ValidateStructPnext(pStatistics_loc, pStatistics[pStatisticIndex].pNext, 0, nullptr, GeneratedVulkanHeaderVersion,
                                     "VUID-VkPipelineExecutableStatisticKHR-pNext-pNext", kVUIDUndefined, VK_NULL_HANDLE, false);
@@ -20063,10 +19733,10 @@ bool StatelessValidation::PreCallValidateGetPipelineExecutableInternalRepresenta
         "VUID-vkGetPipelineExecutableInternalRepresentationsKHR-pInternalRepresentations-parameter",
         "VUID-vkGetPipelineExecutableInternalRepresentationsKHR-pInternalRepresentationCount-parameter", kVUIDUndefined);
     if (pInternalRepresentations != nullptr) {
+        [[maybe_unused]] Location pInternalRepresentations_loc = loc.dot(Field::pInternalRepresentations);
         for (uint32_t pInternalRepresentationIndex = 0; pInternalRepresentationIndex < *pInternalRepresentationCount;
              ++pInternalRepresentationIndex) {
-            [[maybe_unused]] const Location pInternalRepresentations_loc =
-                loc.dot(Field::pInternalRepresentations, pInternalRepresentationIndex);
+            pInternalRepresentations_loc.index = pInternalRepresentationIndex;
             skip |= ValidateStructPnext(pInternalRepresentations_loc, pInternalRepresentations[pInternalRepresentationIndex].pNext,
                                         0, nullptr, GeneratedVulkanHeaderVersion,
                                         "VUID-VkPipelineExecutableInternalRepresentationKHR-pNext-pNext", kVUIDUndefined,
@@ -20286,10 +19956,6 @@ bool StatelessValidation::PreCallValidateCmdEncodeVideoKHR(VkCommandBuffer comma
             ValidateStructPnext(pEncodeInfo_loc, pEncodeInfo->srcPictureResource.pNext, 0, nullptr, GeneratedVulkanHeaderVersion,
                                 "VUID-VkVideoPictureResourceInfoKHR-pNext-pNext", kVUIDUndefined, VK_NULL_HANDLE, true);
 
-        // No xml-driven validation
-
-        // No xml-driven validation
-
         skip |=
             ValidateRequiredHandle(pEncodeInfo_loc.dot(Field::imageViewBinding), pEncodeInfo->srcPictureResource.imageViewBinding);
 
@@ -20322,10 +19988,6 @@ bool StatelessValidation::PreCallValidateCmdEncodeVideoKHR(VkCommandBuffer comma
                                             nullptr, GeneratedVulkanHeaderVersion, "VUID-VkVideoPictureResourceInfoKHR-pNext-pNext",
                                             kVUIDUndefined, VK_NULL_HANDLE, true);
 
-                // No xml-driven validation
-
-                // No xml-driven validation
-
                 skip |= ValidateRequiredHandle(pPictureResource_loc.dot(Field::imageViewBinding),
                                                pEncodeInfo->pSetupReferenceSlot->pPictureResource->imageViewBinding);
             }
@@ -20338,9 +20000,9 @@ bool StatelessValidation::PreCallValidateCmdEncodeVideoKHR(VkCommandBuffer comma
                                         "VUID-VkVideoEncodeInfoKHR-pReferenceSlots-parameter", kVUIDUndefined);
 
         if (pEncodeInfo->pReferenceSlots != nullptr) {
+            [[maybe_unused]] Location pReferenceSlots_loc = pEncodeInfo_loc.dot(Field::pReferenceSlots);
             for (uint32_t referenceSlotIndex = 0; referenceSlotIndex < pEncodeInfo->referenceSlotCount; ++referenceSlotIndex) {
-                [[maybe_unused]] const Location pReferenceSlots_loc =
-                    pEncodeInfo_loc.dot(Field::pReferenceSlots, referenceSlotIndex);
+                pReferenceSlots_loc.index = referenceSlotIndex;
                 constexpr std::array allowed_structs_VkVideoReferenceSlotInfoKHR = {
                     VK_STRUCTURE_TYPE_VIDEO_DECODE_AV1_DPB_SLOT_INFO_KHR, VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_DPB_SLOT_INFO_KHR,
                     VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_DPB_SLOT_INFO_KHR, VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_DPB_SLOT_INFO_KHR,
@@ -20366,10 +20028,6 @@ bool StatelessValidation::PreCallValidateCmdEncodeVideoKHR(VkCommandBuffer comma
                         GeneratedVulkanHeaderVersion, "VUID-VkVideoPictureResourceInfoKHR-pNext-pNext", kVUIDUndefined,
                         VK_NULL_HANDLE, true);
 
-                    // No xml-driven validation
-
-                    // No xml-driven validation
-
                     skip |=
                         ValidateRequiredHandle(pPictureResource_loc.dot(Field::imageViewBinding),
                                                pEncodeInfo->pReferenceSlots[referenceSlotIndex].pPictureResource->imageViewBinding);
@@ -20470,8 +20128,9 @@ bool StatelessValidation::PreCallValidateGetQueueCheckpointData2NV(VkQueue queue
         "VUID-VkCheckpointData2NV-sType-sType", "VUID-vkGetQueueCheckpointData2NV-pCheckpointData-parameter",
         "VUID-vkGetQueueCheckpointData2NV-pCheckpointDataCount-parameter", kVUIDUndefined);
     if (pCheckpointData != nullptr) {
+        [[maybe_unused]] Location pCheckpointData_loc = loc.dot(Field::pCheckpointData);
         for (uint32_t pCheckpointDataIndex = 0; pCheckpointDataIndex < *pCheckpointDataCount; ++pCheckpointDataIndex) {
-            [[maybe_unused]] const Location pCheckpointData_loc = loc.dot(Field::pCheckpointData, pCheckpointDataIndex);
+            pCheckpointData_loc.index = pCheckpointDataIndex;
             skip |= ValidateStructPnext(pCheckpointData_loc, pCheckpointData[pCheckpointDataIndex].pNext, 0, nullptr,
                                         GeneratedVulkanHeaderVersion, "VUID-VkCheckpointData2NV-pNext-pNext", kVUIDUndefined,
                                         VK_NULL_HANDLE, false);
@@ -20685,8 +20344,6 @@ bool StatelessValidation::PreCallValidateGetDeviceImageSubresourceLayoutKHR(VkDe
             skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::format), vvl::Enum::VkFormat, pInfo->pCreateInfo->format,
                                        "VUID-VkImageCreateInfo-format-parameter");
 
-            // No xml-driven validation
-
             skip |= ValidateFlags(pCreateInfo_loc.dot(Field::samples), vvl::FlagBitmask::VkSampleCountFlagBits,
                                   AllVkSampleCountFlagBits, pInfo->pCreateInfo->samples, kRequiredSingleBit,
                                   "VUID-VkImageCreateInfo-samples-parameter", "VUID-VkImageCreateInfo-samples-parameter");
@@ -20788,8 +20445,9 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceCooperativeMatrixPrope
         "VUID-vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR-pProperties-parameter",
         "VUID-vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR-pPropertyCount-parameter", kVUIDUndefined);
     if (pProperties != nullptr) {
+        [[maybe_unused]] Location pProperties_loc = loc.dot(Field::pProperties);
         for (uint32_t pPropertyIndex = 0; pPropertyIndex < *pPropertyCount; ++pPropertyIndex) {
-            [[maybe_unused]] const Location pProperties_loc = loc.dot(Field::pProperties, pPropertyIndex);
+            pProperties_loc.index = pPropertyIndex;
             skip |=
                 ValidateStructPnext(pProperties_loc, pProperties[pPropertyIndex].pNext, 0, nullptr, GeneratedVulkanHeaderVersion,
                                     "VUID-VkCooperativeMatrixPropertiesKHR-pNext-pNext", kVUIDUndefined, physicalDevice, false);
@@ -20836,8 +20494,9 @@ bool StatelessValidation::PreCallValidateGetCalibratedTimestampsKHR(VkDevice dev
         "VUID-VkCalibratedTimestampInfoKHR-sType-sType", "VUID-vkGetCalibratedTimestampsKHR-pTimestampInfos-parameter",
         "VUID-vkGetCalibratedTimestampsKHR-timestampCount-arraylength");
     if (pTimestampInfos != nullptr) {
+        [[maybe_unused]] Location pTimestampInfos_loc = loc.dot(Field::pTimestampInfos);
         for (uint32_t timestampIndex = 0; timestampIndex < timestampCount; ++timestampIndex) {
-            [[maybe_unused]] const Location pTimestampInfos_loc = loc.dot(Field::pTimestampInfos, timestampIndex);
+            pTimestampInfos_loc.index = timestampIndex;
             skip |= ValidateStructPnext(pTimestampInfos_loc, pTimestampInfos[timestampIndex].pNext, 0, nullptr,
                                         GeneratedVulkanHeaderVersion, "VUID-VkCalibratedTimestampInfoKHR-pNext-pNext",
                                         kVUIDUndefined, VK_NULL_HANDLE, true);
@@ -20954,10 +20613,10 @@ bool StatelessValidation::PreCallValidateCmdPushDescriptorSet2KHR(VkCommandBuffe
             "VUID-VkPushDescriptorSetInfoKHR-descriptorWriteCount-arraylength");
 
         if (pPushDescriptorSetInfo->pDescriptorWrites != nullptr) {
+            [[maybe_unused]] Location pDescriptorWrites_loc = pPushDescriptorSetInfo_loc.dot(Field::pDescriptorWrites);
             for (uint32_t descriptorWriteIndex = 0; descriptorWriteIndex < pPushDescriptorSetInfo->descriptorWriteCount;
                  ++descriptorWriteIndex) {
-                [[maybe_unused]] const Location pDescriptorWrites_loc =
-                    pPushDescriptorSetInfo_loc.dot(Field::pDescriptorWrites, descriptorWriteIndex);
+                pDescriptorWrites_loc.index = descriptorWriteIndex;
                 constexpr std::array allowed_structs_VkWriteDescriptorSet = {
                     VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR,
                     VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV,
@@ -21752,10 +21411,6 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceExternalImageFormatPro
     skip |=
         ValidateRequiredPointer(loc.dot(Field::pExternalImageFormatProperties), pExternalImageFormatProperties,
                                 "VUID-vkGetPhysicalDeviceExternalImageFormatPropertiesNV-pExternalImageFormatProperties-parameter");
-    if (pExternalImageFormatProperties != nullptr) {
-        [[maybe_unused]] const Location pExternalImageFormatProperties_loc = loc.dot(Field::pExternalImageFormatProperties);
-        // No xml-driven validation
-    }
     return skip;
 }
 
@@ -21873,12 +21528,6 @@ bool StatelessValidation::PreCallValidateCmdSetViewportWScalingNV(VkCommandBuffe
     skip |= ValidateArray(loc.dot(Field::viewportCount), loc.dot(Field::pViewportWScalings), viewportCount, &pViewportWScalings,
                           true, true, "VUID-vkCmdSetViewportWScalingNV-viewportCount-arraylength",
                           "VUID-vkCmdSetViewportWScalingNV-pViewportWScalings-parameter");
-    if (pViewportWScalings != nullptr) {
-        for (uint32_t viewportIndex = 0; viewportIndex < viewportCount; ++viewportIndex) {
-            [[maybe_unused]] const Location pViewportWScalings_loc = loc.dot(Field::pViewportWScalings, viewportIndex);
-            // No xml-driven validation
-        }
-    }
     if (!skip)
         skip |= manual_PreCallValidateCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings,
                                                                error_obj);
@@ -22086,10 +21735,6 @@ bool StatelessValidation::PreCallValidateGetRefreshCycleDurationGOOGLE(VkDevice
     skip |= ValidateRequiredHandle(loc.dot(Field::swapchain), swapchain);
     skip |= ValidateRequiredPointer(loc.dot(Field::pDisplayTimingProperties), pDisplayTimingProperties,
                                     "VUID-vkGetRefreshCycleDurationGOOGLE-pDisplayTimingProperties-parameter");
-    if (pDisplayTimingProperties != nullptr) {
-        [[maybe_unused]] const Location pDisplayTimingProperties_loc = loc.dot(Field::pDisplayTimingProperties);
-        // No xml-driven validation
-    }
     return skip;
 }
 
@@ -22106,14 +21751,6 @@ bool StatelessValidation::PreCallValidateGetPastPresentationTimingGOOGLE(VkDevic
                                  pPresentationTimingCount, &pPresentationTimings, true, false, false,
                                  "VUID-vkGetPastPresentationTimingGOOGLE-pPresentationTimingCount-parameter", kVUIDUndefined,
                                  "VUID-vkGetPastPresentationTimingGOOGLE-pPresentationTimings-parameter");
-    if (pPresentationTimings != nullptr) {
-        for (uint32_t pPresentationTimingIndex = 0; pPresentationTimingIndex < *pPresentationTimingCount;
-             ++pPresentationTimingIndex) {
-            [[maybe_unused]] const Location pPresentationTimings_loc =
-                loc.dot(Field::pPresentationTimings, pPresentationTimingIndex);
-            // No xml-driven validation
-        }
-    }
     return skip;
 }
 
@@ -22128,14 +21765,6 @@ bool StatelessValidation::PreCallValidateCmdSetDiscardRectangleEXT(VkCommandBuff
     skip |= ValidateArray(loc.dot(Field::discardRectangleCount), loc.dot(Field::pDiscardRectangles), discardRectangleCount,
                           &pDiscardRectangles, true, true, "VUID-vkCmdSetDiscardRectangleEXT-discardRectangleCount-arraylength",
                           "VUID-vkCmdSetDiscardRectangleEXT-pDiscardRectangles-parameter");
-    if (pDiscardRectangles != nullptr) {
-        for (uint32_t discardRectangleIndex = 0; discardRectangleIndex < discardRectangleCount; ++discardRectangleIndex) {
-            [[maybe_unused]] const Location pDiscardRectangles_loc = loc.dot(Field::pDiscardRectangles, discardRectangleIndex);
-            // No xml-driven validation
-
-            // No xml-driven validation
-        }
-    }
     if (!skip)
         skip |= manual_PreCallValidateCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount,
                                                                 pDiscardRectangles, error_obj);
@@ -22181,8 +21810,9 @@ bool StatelessValidation::PreCallValidateSetHdrMetadataEXT(VkDevice device, uint
                                     "VUID-VkHdrMetadataEXT-sType-sType", "VUID-vkSetHdrMetadataEXT-pMetadata-parameter",
                                     "VUID-vkSetHdrMetadataEXT-swapchainCount-arraylength");
     if (pMetadata != nullptr) {
+        [[maybe_unused]] Location pMetadata_loc = loc.dot(Field::pMetadata);
         for (uint32_t swapchainIndex = 0; swapchainIndex < swapchainCount; ++swapchainIndex) {
-            [[maybe_unused]] const Location pMetadata_loc = loc.dot(Field::pMetadata, swapchainIndex);
+            pMetadata_loc.index = swapchainIndex;
             skip |= ValidateStructPnext(pMetadata_loc, pMetadata[swapchainIndex].pNext, 0, nullptr, GeneratedVulkanHeaderVersion,
                                         "VUID-VkHdrMetadataEXT-pNext-pNext", kVUIDUndefined, VK_NULL_HANDLE, true);
         }
@@ -22580,8 +22210,9 @@ bool StatelessValidation::PreCallValidateSubmitDebugUtilsMessageEXT(VkInstance i
                                         "VUID-VkDebugUtilsMessengerCallbackDataEXT-pQueueLabels-parameter", kVUIDUndefined);
 
         if (pCallbackData->pQueueLabels != nullptr) {
+            [[maybe_unused]] Location pQueueLabels_loc = pCallbackData_loc.dot(Field::pQueueLabels);
             for (uint32_t queueLabelIndex = 0; queueLabelIndex < pCallbackData->queueLabelCount; ++queueLabelIndex) {
-                [[maybe_unused]] const Location pQueueLabels_loc = pCallbackData_loc.dot(Field::pQueueLabels, queueLabelIndex);
+                pQueueLabels_loc.index = queueLabelIndex;
                 skip |= ValidateStructPnext(pQueueLabels_loc, pCallbackData->pQueueLabels[queueLabelIndex].pNext, 0, nullptr,
                                             GeneratedVulkanHeaderVersion, "VUID-VkDebugUtilsLabelEXT-pNext-pNext", kVUIDUndefined,
                                             VK_NULL_HANDLE, true);
@@ -22599,8 +22230,9 @@ bool StatelessValidation::PreCallValidateSubmitDebugUtilsMessageEXT(VkInstance i
                                         "VUID-VkDebugUtilsMessengerCallbackDataEXT-pCmdBufLabels-parameter", kVUIDUndefined);
 
         if (pCallbackData->pCmdBufLabels != nullptr) {
+            [[maybe_unused]] Location pCmdBufLabels_loc = pCallbackData_loc.dot(Field::pCmdBufLabels);
             for (uint32_t cmdBufLabelIndex = 0; cmdBufLabelIndex < pCallbackData->cmdBufLabelCount; ++cmdBufLabelIndex) {
-                [[maybe_unused]] const Location pCmdBufLabels_loc = pCallbackData_loc.dot(Field::pCmdBufLabels, cmdBufLabelIndex);
+                pCmdBufLabels_loc.index = cmdBufLabelIndex;
                 skip |= ValidateStructPnext(pCmdBufLabels_loc, pCallbackData->pCmdBufLabels[cmdBufLabelIndex].pNext, 0, nullptr,
                                             GeneratedVulkanHeaderVersion, "VUID-VkDebugUtilsLabelEXT-pNext-pNext", kVUIDUndefined,
                                             VK_NULL_HANDLE, true);
@@ -22618,8 +22250,9 @@ bool StatelessValidation::PreCallValidateSubmitDebugUtilsMessageEXT(VkInstance i
                                         "VUID-VkDebugUtilsMessengerCallbackDataEXT-pObjects-parameter", kVUIDUndefined);
 
         if (pCallbackData->pObjects != nullptr) {
+            [[maybe_unused]] Location pObjects_loc = pCallbackData_loc.dot(Field::pObjects);
             for (uint32_t objectIndex = 0; objectIndex < pCallbackData->objectCount; ++objectIndex) {
-                [[maybe_unused]] const Location pObjects_loc = pCallbackData_loc.dot(Field::pObjects, objectIndex);
+                pObjects_loc.index = objectIndex;
                 skip |= ValidateStructPnext(pObjects_loc, pCallbackData->pObjects[objectIndex].pNext, 0, nullptr,
                                             GeneratedVulkanHeaderVersion, kVUIDUndefined, kVUIDUndefined, VK_NULL_HANDLE, true);
 
@@ -22703,8 +22336,9 @@ bool StatelessValidation::PreCallValidateCreateExecutionGraphPipelinesAMDX(
                                     "VUID-vkCreateExecutionGraphPipelinesAMDX-pCreateInfos-parameter",
                                     "VUID-vkCreateExecutionGraphPipelinesAMDX-createInfoCount-arraylength");
     if (pCreateInfos != nullptr) {
+        [[maybe_unused]] Location pCreateInfos_loc = loc.dot(Field::pCreateInfos);
         for (uint32_t createInfoIndex = 0; createInfoIndex < createInfoCount; ++createInfoIndex) {
-            [[maybe_unused]] const Location pCreateInfos_loc = loc.dot(Field::pCreateInfos, createInfoIndex);
+            pCreateInfos_loc.index = createInfoIndex;
             constexpr std::array allowed_structs_VkExecutionGraphPipelineCreateInfoAMDX = {
                 VK_STRUCTURE_TYPE_PIPELINE_COMPILER_CONTROL_CREATE_INFO_AMD,
                 VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO};
@@ -22723,8 +22357,9 @@ bool StatelessValidation::PreCallValidateCreateExecutionGraphPipelinesAMDX(
                                             "VUID-VkExecutionGraphPipelineCreateInfoAMDX-pStages-parameter", kVUIDUndefined);
 
             if (pCreateInfos[createInfoIndex].pStages != nullptr) {
+                [[maybe_unused]] Location pStages_loc = pCreateInfos_loc.dot(Field::pStages);
                 for (uint32_t stageIndex = 0; stageIndex < pCreateInfos[createInfoIndex].stageCount; ++stageIndex) {
-                    [[maybe_unused]] const Location pStages_loc = pCreateInfos_loc.dot(Field::pStages, stageIndex);
+                    pStages_loc.index = stageIndex;
                     constexpr std::array allowed_structs_VkPipelineShaderStageCreateInfo = {
                         VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT,
                         VK_STRUCTURE_TYPE_PIPELINE_ROBUSTNESS_CREATE_INFO_EXT,
@@ -22762,17 +22397,6 @@ bool StatelessValidation::PreCallValidateCreateExecutionGraphPipelinesAMDX(
                                               &pCreateInfos[createInfoIndex].pStages[stageIndex].pSpecializationInfo->pMapEntries,
                                               false, true, kVUIDUndefined, "VUID-VkSpecializationInfo-pMapEntries-parameter");
 
-                        if (pCreateInfos[createInfoIndex].pStages[stageIndex].pSpecializationInfo->pMapEntries != nullptr) {
-                            for (uint32_t mapEntryIndex = 0;
-                                 mapEntryIndex <
-                                 pCreateInfos[createInfoIndex].pStages[stageIndex].pSpecializationInfo->mapEntryCount;
-                                 ++mapEntryIndex) {
-                                [[maybe_unused]] const Location pMapEntries_loc =
-                                    pSpecializationInfo_loc.dot(Field::pMapEntries, mapEntryIndex);
-                                // No xml-driven validation
-                            }
-                        }
-
                         skip |=
                             ValidateArray(pSpecializationInfo_loc.dot(Field::dataSize), pSpecializationInfo_loc.dot(Field::pData),
                                           pCreateInfos[createInfoIndex].pStages[stageIndex].pSpecializationInfo->dataSize,
@@ -22888,10 +22512,6 @@ bool StatelessValidation::PreCallValidateCmdDispatchGraphAMDX(VkCommandBuffer co
     if (!IsExtEnabled(device_extensions.vk_amdx_shader_enqueue))
         skip |= OutputExtensionError(loc, {vvl::Extension::_VK_AMDX_shader_enqueue});
     skip |= ValidateRequiredPointer(loc.dot(Field::pCountInfo), pCountInfo, "VUID-vkCmdDispatchGraphAMDX-pCountInfo-parameter");
-    if (pCountInfo != nullptr) {
-        [[maybe_unused]] const Location pCountInfo_loc = loc.dot(Field::pCountInfo);
-        // No xml-driven validation
-    }
     return skip;
 }
 
@@ -22904,10 +22524,6 @@ bool StatelessValidation::PreCallValidateCmdDispatchGraphIndirectAMDX(VkCommandB
         skip |= OutputExtensionError(loc, {vvl::Extension::_VK_AMDX_shader_enqueue});
     skip |=
         ValidateRequiredPointer(loc.dot(Field::pCountInfo), pCountInfo, "VUID-vkCmdDispatchGraphIndirectAMDX-pCountInfo-parameter");
-    if (pCountInfo != nullptr) {
-        [[maybe_unused]] const Location pCountInfo_loc = loc.dot(Field::pCountInfo);
-        // No xml-driven validation
-    }
     return skip;
 }
 
@@ -22939,21 +22555,10 @@ bool StatelessValidation::PreCallValidateCmdSetSampleLocationsEXT(VkCommandBuffe
         skip |= ValidateStructPnext(pSampleLocationsInfo_loc, pSampleLocationsInfo->pNext, 0, nullptr, GeneratedVulkanHeaderVersion,
                                     kVUIDUndefined, kVUIDUndefined, VK_NULL_HANDLE, true);
 
-        // No xml-driven validation
-
         skip |= ValidateArray(pSampleLocationsInfo_loc.dot(Field::sampleLocationsCount),
                               pSampleLocationsInfo_loc.dot(Field::pSampleLocations), pSampleLocationsInfo->sampleLocationsCount,
                               &pSampleLocationsInfo->pSampleLocations, false, true, kVUIDUndefined,
                               "VUID-VkSampleLocationsInfoEXT-pSampleLocations-parameter");
-
-        if (pSampleLocationsInfo->pSampleLocations != nullptr) {
-            for (uint32_t sampleLocationsIndex = 0; sampleLocationsIndex < pSampleLocationsInfo->sampleLocationsCount;
-                 ++sampleLocationsIndex) {
-                [[maybe_unused]] const Location pSampleLocations_loc =
-                    pSampleLocationsInfo_loc.dot(Field::pSampleLocations, sampleLocationsIndex);
-                // No xml-driven validation
-            }
-        }
     }
     return skip;
 }
@@ -23140,8 +22745,9 @@ bool StatelessValidation::PreCallValidateCmdSetViewportShadingRatePaletteNV(VkCo
                           true, true, "VUID-vkCmdSetViewportShadingRatePaletteNV-viewportCount-arraylength",
                           "VUID-vkCmdSetViewportShadingRatePaletteNV-pShadingRatePalettes-parameter");
     if (pShadingRatePalettes != nullptr) {
+        [[maybe_unused]] Location pShadingRatePalettes_loc = loc.dot(Field::pShadingRatePalettes);
         for (uint32_t viewportIndex = 0; viewportIndex < viewportCount; ++viewportIndex) {
-            [[maybe_unused]] const Location pShadingRatePalettes_loc = loc.dot(Field::pShadingRatePalettes, viewportIndex);
+            pShadingRatePalettes_loc.index = viewportIndex;
             skip |= ValidateRangedEnumArray(pShadingRatePalettes_loc.dot(Field::shadingRatePaletteEntryCount),
                                             pShadingRatePalettes_loc.dot(Field::pShadingRatePaletteEntries),
                                             vvl::Enum::VkShadingRatePaletteEntryNV,
@@ -23172,8 +22778,9 @@ bool StatelessValidation::PreCallValidateCmdSetCoarseSampleOrderNV(VkCommandBuff
                           &pCustomSampleOrders, false, true, kVUIDUndefined,
                           "VUID-vkCmdSetCoarseSampleOrderNV-pCustomSampleOrders-parameter");
     if (pCustomSampleOrders != nullptr) {
+        [[maybe_unused]] Location pCustomSampleOrders_loc = loc.dot(Field::pCustomSampleOrders);
         for (uint32_t customSampleOrderIndex = 0; customSampleOrderIndex < customSampleOrderCount; ++customSampleOrderIndex) {
-            [[maybe_unused]] const Location pCustomSampleOrders_loc = loc.dot(Field::pCustomSampleOrders, customSampleOrderIndex);
+            pCustomSampleOrders_loc.index = customSampleOrderIndex;
             skip |= ValidateRangedEnum(pCustomSampleOrders_loc.dot(Field::shadingRate), vvl::Enum::VkShadingRatePaletteEntryNV,
                                        pCustomSampleOrders[customSampleOrderIndex].shadingRate,
                                        "VUID-VkCoarseSampleOrderCustomNV-shadingRate-parameter");
@@ -23184,15 +22791,6 @@ bool StatelessValidation::PreCallValidateCmdSetCoarseSampleOrderNV(VkCommandBuff
                                   &pCustomSampleOrders[customSampleOrderIndex].pSampleLocations, true, true,
                                   "VUID-VkCoarseSampleOrderCustomNV-sampleLocationCount-arraylength",
                                   "VUID-VkCoarseSampleOrderCustomNV-pSampleLocations-parameter");
-
-            if (pCustomSampleOrders[customSampleOrderIndex].pSampleLocations != nullptr) {
-                for (uint32_t sampleLocationIndex = 0;
-                     sampleLocationIndex < pCustomSampleOrders[customSampleOrderIndex].sampleLocationCount; ++sampleLocationIndex) {
-                    [[maybe_unused]] const Location pSampleLocations_loc =
-                        pCustomSampleOrders_loc.dot(Field::pSampleLocations, sampleLocationIndex);
-                    // No xml-driven validation
-                }
-            }
         }
     }
     if (!skip)
@@ -23236,8 +22834,9 @@ bool StatelessValidation::PreCallValidateCreateAccelerationStructureNV(VkDevice
             "VUID-VkGeometryNV-sType-sType", "VUID-VkAccelerationStructureInfoNV-pGeometries-parameter", kVUIDUndefined);
 
         if (pCreateInfo->info.pGeometries != nullptr) {
+            [[maybe_unused]] Location pGeometries_loc = pCreateInfo_loc.dot(Field::pGeometries);
             for (uint32_t geometryIndex = 0; geometryIndex < pCreateInfo->info.geometryCount; ++geometryIndex) {
-                [[maybe_unused]] const Location pGeometries_loc = pCreateInfo_loc.dot(Field::pGeometries, geometryIndex);
+                pGeometries_loc.index = geometryIndex;
                 skip |= ValidateStructPnext(pGeometries_loc, pCreateInfo->info.pGeometries[geometryIndex].pNext, 0, nullptr,
                                             GeneratedVulkanHeaderVersion, "VUID-VkGeometryNV-pNext-pNext", kVUIDUndefined,
                                             VK_NULL_HANDLE, true);
@@ -23384,8 +22983,9 @@ bool StatelessValidation::PreCallValidateBindAccelerationStructureMemoryNV(
         "VUID-VkBindAccelerationStructureMemoryInfoNV-sType-sType", "VUID-vkBindAccelerationStructureMemoryNV-pBindInfos-parameter",
         "VUID-vkBindAccelerationStructureMemoryNV-bindInfoCount-arraylength");
     if (pBindInfos != nullptr) {
+        [[maybe_unused]] Location pBindInfos_loc = loc.dot(Field::pBindInfos);
         for (uint32_t bindInfoIndex = 0; bindInfoIndex < bindInfoCount; ++bindInfoIndex) {
-            [[maybe_unused]] const Location pBindInfos_loc = loc.dot(Field::pBindInfos, bindInfoIndex);
+            pBindInfos_loc.index = bindInfoIndex;
             skip |= ValidateStructPnext(pBindInfos_loc, pBindInfos[bindInfoIndex].pNext, 0, nullptr, GeneratedVulkanHeaderVersion,
                                         "VUID-VkBindAccelerationStructureMemoryInfoNV-pNext-pNext", kVUIDUndefined, VK_NULL_HANDLE,
                                         true);
@@ -23425,8 +23025,9 @@ bool StatelessValidation::PreCallValidateCmdBuildAccelerationStructureNV(
                                         "VUID-VkAccelerationStructureInfoNV-pGeometries-parameter", kVUIDUndefined);
 
         if (pInfo->pGeometries != nullptr) {
+            [[maybe_unused]] Location pGeometries_loc = pInfo_loc.dot(Field::pGeometries);
             for (uint32_t geometryIndex = 0; geometryIndex < pInfo->geometryCount; ++geometryIndex) {
-                [[maybe_unused]] const Location pGeometries_loc = pInfo_loc.dot(Field::pGeometries, geometryIndex);
+                pGeometries_loc.index = geometryIndex;
                 skip |= ValidateStructPnext(pGeometries_loc, pInfo->pGeometries[geometryIndex].pNext, 0, nullptr,
                                             GeneratedVulkanHeaderVersion, "VUID-VkGeometryNV-pNext-pNext", kVUIDUndefined,
                                             VK_NULL_HANDLE, true);
@@ -23517,8 +23118,9 @@ bool StatelessValidation::PreCallValidateCreateRayTracingPipelinesNV(VkDevice de
         "VUID-VkRayTracingPipelineCreateInfoNV-sType-sType", "VUID-vkCreateRayTracingPipelinesNV-pCreateInfos-parameter",
         "VUID-vkCreateRayTracingPipelinesNV-createInfoCount-arraylength");
     if (pCreateInfos != nullptr) {
+        [[maybe_unused]] Location pCreateInfos_loc = loc.dot(Field::pCreateInfos);
         for (uint32_t createInfoIndex = 0; createInfoIndex < createInfoCount; ++createInfoIndex) {
-            [[maybe_unused]] const Location pCreateInfos_loc = loc.dot(Field::pCreateInfos, createInfoIndex);
+            pCreateInfos_loc.index = createInfoIndex;
             constexpr std::array allowed_structs_VkRayTracingPipelineCreateInfoNV = {
                 VK_STRUCTURE_TYPE_PIPELINE_CREATE_FLAGS_2_CREATE_INFO_KHR,
                 VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO};
@@ -23537,8 +23139,9 @@ bool StatelessValidation::PreCallValidateCreateRayTracingPipelinesNV(VkDevice de
                 "VUID-VkRayTracingPipelineCreateInfoNV-stageCount-arraylength");
 
             if (pCreateInfos[createInfoIndex].pStages != nullptr) {
+                [[maybe_unused]] Location pStages_loc = pCreateInfos_loc.dot(Field::pStages);
                 for (uint32_t stageIndex = 0; stageIndex < pCreateInfos[createInfoIndex].stageCount; ++stageIndex) {
-                    [[maybe_unused]] const Location pStages_loc = pCreateInfos_loc.dot(Field::pStages, stageIndex);
+                    pStages_loc.index = stageIndex;
                     constexpr std::array allowed_structs_VkPipelineShaderStageCreateInfo = {
                         VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT,
                         VK_STRUCTURE_TYPE_PIPELINE_ROBUSTNESS_CREATE_INFO_EXT,
@@ -23576,17 +23179,6 @@ bool StatelessValidation::PreCallValidateCreateRayTracingPipelinesNV(VkDevice de
                                               &pCreateInfos[createInfoIndex].pStages[stageIndex].pSpecializationInfo->pMapEntries,
                                               false, true, kVUIDUndefined, "VUID-VkSpecializationInfo-pMapEntries-parameter");
 
-                        if (pCreateInfos[createInfoIndex].pStages[stageIndex].pSpecializationInfo->pMapEntries != nullptr) {
-                            for (uint32_t mapEntryIndex = 0;
-                                 mapEntryIndex <
-                                 pCreateInfos[createInfoIndex].pStages[stageIndex].pSpecializationInfo->mapEntryCount;
-                                 ++mapEntryIndex) {
-                                [[maybe_unused]] const Location pMapEntries_loc =
-                                    pSpecializationInfo_loc.dot(Field::pMapEntries, mapEntryIndex);
-                                // No xml-driven validation
-                            }
-                        }
-
                         skip |=
                             ValidateArray(pSpecializationInfo_loc.dot(Field::dataSize), pSpecializationInfo_loc.dot(Field::pData),
                                           pCreateInfos[createInfoIndex].pStages[stageIndex].pSpecializationInfo->dataSize,
@@ -23604,8 +23196,9 @@ bool StatelessValidation::PreCallValidateCreateRayTracingPipelinesNV(VkDevice de
                 "VUID-VkRayTracingPipelineCreateInfoNV-groupCount-arraylength");
 
             if (pCreateInfos[createInfoIndex].pGroups != nullptr) {
+                [[maybe_unused]] Location pGroups_loc = pCreateInfos_loc.dot(Field::pGroups);
                 for (uint32_t groupIndex = 0; groupIndex < pCreateInfos[createInfoIndex].groupCount; ++groupIndex) {
-                    [[maybe_unused]] const Location pGroups_loc = pCreateInfos_loc.dot(Field::pGroups, groupIndex);
+                    pGroups_loc.index = groupIndex;
                     skip |=
                         ValidateStructPnext(pGroups_loc, pCreateInfos[createInfoIndex].pGroups[groupIndex].pNext, 0, nullptr,
                                             GeneratedVulkanHeaderVersion, "VUID-VkRayTracingShaderGroupCreateInfoNV-pNext-pNext",
@@ -23851,14 +23444,6 @@ bool StatelessValidation::PreCallValidateCmdSetExclusiveScissorNV(VkCommandBuffe
     skip |= ValidateArray(loc.dot(Field::exclusiveScissorCount), loc.dot(Field::pExclusiveScissors), exclusiveScissorCount,
                           &pExclusiveScissors, true, true, "VUID-vkCmdSetExclusiveScissorNV-exclusiveScissorCount-arraylength",
                           "VUID-vkCmdSetExclusiveScissorNV-pExclusiveScissors-parameter");
-    if (pExclusiveScissors != nullptr) {
-        for (uint32_t exclusiveScissorIndex = 0; exclusiveScissorIndex < exclusiveScissorCount; ++exclusiveScissorIndex) {
-            [[maybe_unused]] const Location pExclusiveScissors_loc = loc.dot(Field::pExclusiveScissors, exclusiveScissorIndex);
-            // No xml-driven validation
-
-            // No xml-driven validation
-        }
-    }
     if (!skip)
         skip |= manual_PreCallValidateCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount,
                                                                pExclusiveScissors, error_obj);
@@ -23888,8 +23473,9 @@ bool StatelessValidation::PreCallValidateGetQueueCheckpointDataNV(VkQueue queue,
                                     "VUID-vkGetQueueCheckpointDataNV-pCheckpointData-parameter",
                                     "VUID-vkGetQueueCheckpointDataNV-pCheckpointDataCount-parameter", kVUIDUndefined);
     if (pCheckpointData != nullptr) {
+        [[maybe_unused]] Location pCheckpointData_loc = loc.dot(Field::pCheckpointData);
         for (uint32_t pCheckpointDataIndex = 0; pCheckpointDataIndex < *pCheckpointDataCount; ++pCheckpointDataIndex) {
-            [[maybe_unused]] const Location pCheckpointData_loc = loc.dot(Field::pCheckpointData, pCheckpointDataIndex);
+            pCheckpointData_loc.index = pCheckpointDataIndex;
             skip |= ValidateStructPnext(pCheckpointData_loc, pCheckpointData[pCheckpointDataIndex].pNext, 0, nullptr,
                                         GeneratedVulkanHeaderVersion, "VUID-VkCheckpointDataNV-pNext-pNext", kVUIDUndefined,
                                         VK_NULL_HANDLE, false);
@@ -24045,10 +23631,6 @@ bool StatelessValidation::PreCallValidateGetPerformanceParameterINTEL(VkDevice d
     skip |= ValidateRangedEnum(loc.dot(Field::parameter), vvl::Enum::VkPerformanceParameterTypeINTEL, parameter,
                                "VUID-vkGetPerformanceParameterINTEL-parameter-parameter");
     skip |= ValidateRequiredPointer(loc.dot(Field::pValue), pValue, "VUID-vkGetPerformanceParameterINTEL-pValue-parameter");
-    if (pValue != nullptr) {
-        [[maybe_unused]] const Location pValue_loc = loc.dot(Field::pValue);
-        // No xml-driven validation
-    }
     return skip;
 }
 
@@ -24195,8 +23777,9 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceCooperativeMatrixPrope
         "VUID-vkGetPhysicalDeviceCooperativeMatrixPropertiesNV-pProperties-parameter",
         "VUID-vkGetPhysicalDeviceCooperativeMatrixPropertiesNV-pPropertyCount-parameter", kVUIDUndefined);
     if (pProperties != nullptr) {
+        [[maybe_unused]] Location pProperties_loc = loc.dot(Field::pProperties);
         for (uint32_t pPropertyIndex = 0; pPropertyIndex < *pPropertyCount; ++pPropertyIndex) {
-            [[maybe_unused]] const Location pProperties_loc = loc.dot(Field::pProperties, pPropertyIndex);
+            pProperties_loc.index = pPropertyIndex;
             skip |=
                 ValidateStructPnext(pProperties_loc, pProperties[pPropertyIndex].pNext, 0, nullptr, GeneratedVulkanHeaderVersion,
                                     "VUID-VkCooperativeMatrixPropertiesNV-pNext-pNext", kVUIDUndefined, physicalDevice, false);
@@ -24218,8 +23801,9 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceSupportedFramebufferMi
         "VUID-vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV-pCombinations-parameter",
         "VUID-vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV-pCombinationCount-parameter", kVUIDUndefined);
     if (pCombinations != nullptr) {
+        [[maybe_unused]] Location pCombinations_loc = loc.dot(Field::pCombinations);
         for (uint32_t pCombinationIndex = 0; pCombinationIndex < *pCombinationCount; ++pCombinationIndex) {
-            [[maybe_unused]] const Location pCombinations_loc = loc.dot(Field::pCombinations, pCombinationIndex);
+            pCombinations_loc.index = pCombinationIndex;
             skip |= ValidateStructPnext(pCombinations_loc, pCombinations[pCombinationIndex].pNext, 0, nullptr,
                                         GeneratedVulkanHeaderVersion, "VUID-VkFramebufferMixedSamplesCombinationNV-pNext-pNext",
                                         kVUIDUndefined, physicalDevice, false);
@@ -24511,8 +24095,9 @@ bool StatelessValidation::PreCallValidateCopyMemoryToImageEXT(VkDevice device,
             "VUID-VkCopyMemoryToImageInfoEXT-pRegions-parameter", "VUID-VkCopyMemoryToImageInfoEXT-regionCount-arraylength");
 
         if (pCopyMemoryToImageInfo->pRegions != nullptr) {
+            [[maybe_unused]] Location pRegions_loc = pCopyMemoryToImageInfo_loc.dot(Field::pRegions);
             for (uint32_t regionIndex = 0; regionIndex < pCopyMemoryToImageInfo->regionCount; ++regionIndex) {
-                [[maybe_unused]] const Location pRegions_loc = pCopyMemoryToImageInfo_loc.dot(Field::pRegions, regionIndex);
+                pRegions_loc.index = regionIndex;
                 skip |= ValidateStructPnext(pRegions_loc, pCopyMemoryToImageInfo->pRegions[regionIndex].pNext, 0, nullptr,
                                             GeneratedVulkanHeaderVersion, "VUID-VkMemoryToImageCopyEXT-pNext-pNext", kVUIDUndefined,
                                             VK_NULL_HANDLE, true);
@@ -24526,10 +24111,6 @@ bool StatelessValidation::PreCallValidateCopyMemoryToImageEXT(VkDevice device,
                                       pCopyMemoryToImageInfo->pRegions[regionIndex].imageSubresource.aspectMask, kRequiredFlags,
                                       "VUID-VkImageSubresourceLayers-aspectMask-parameter",
                                       "VUID-VkImageSubresourceLayers-aspectMask-requiredbitmask");
-
-                // No xml-driven validation
-
-                // No xml-driven validation
             }
         }
     }
@@ -24570,8 +24151,9 @@ bool StatelessValidation::PreCallValidateCopyImageToMemoryEXT(VkDevice device,
             "VUID-VkCopyImageToMemoryInfoEXT-pRegions-parameter", "VUID-VkCopyImageToMemoryInfoEXT-regionCount-arraylength");
 
         if (pCopyImageToMemoryInfo->pRegions != nullptr) {
+            [[maybe_unused]] Location pRegions_loc = pCopyImageToMemoryInfo_loc.dot(Field::pRegions);
             for (uint32_t regionIndex = 0; regionIndex < pCopyImageToMemoryInfo->regionCount; ++regionIndex) {
-                [[maybe_unused]] const Location pRegions_loc = pCopyImageToMemoryInfo_loc.dot(Field::pRegions, regionIndex);
+                pRegions_loc.index = regionIndex;
                 skip |= ValidateStructPnext(pRegions_loc, pCopyImageToMemoryInfo->pRegions[regionIndex].pNext, 0, nullptr,
                                             GeneratedVulkanHeaderVersion, "VUID-VkImageToMemoryCopyEXT-pNext-pNext", kVUIDUndefined,
                                             VK_NULL_HANDLE, true);
@@ -24585,10 +24167,6 @@ bool StatelessValidation::PreCallValidateCopyImageToMemoryEXT(VkDevice device,
                                       pCopyImageToMemoryInfo->pRegions[regionIndex].imageSubresource.aspectMask, kRequiredFlags,
                                       "VUID-VkImageSubresourceLayers-aspectMask-parameter",
                                       "VUID-VkImageSubresourceLayers-aspectMask-requiredbitmask");
-
-                // No xml-driven validation
-
-                // No xml-driven validation
             }
         }
     }
@@ -24635,8 +24213,9 @@ bool StatelessValidation::PreCallValidateCopyImageToImageEXT(VkDevice device,
             "VUID-VkCopyImageToImageInfoEXT-pRegions-parameter", "VUID-VkCopyImageToImageInfoEXT-regionCount-arraylength");
 
         if (pCopyImageToImageInfo->pRegions != nullptr) {
+            [[maybe_unused]] Location pRegions_loc = pCopyImageToImageInfo_loc.dot(Field::pRegions);
             for (uint32_t regionIndex = 0; regionIndex < pCopyImageToImageInfo->regionCount; ++regionIndex) {
-                [[maybe_unused]] const Location pRegions_loc = pCopyImageToImageInfo_loc.dot(Field::pRegions, regionIndex);
+                pRegions_loc.index = regionIndex;
                 skip |= ValidateStructPnext(pRegions_loc, pCopyImageToImageInfo->pRegions[regionIndex].pNext, 0, nullptr,
                                             GeneratedVulkanHeaderVersion, "VUID-VkImageCopy2-pNext-pNext", kVUIDUndefined,
                                             VK_NULL_HANDLE, true);
@@ -24647,17 +24226,11 @@ bool StatelessValidation::PreCallValidateCopyImageToImageEXT(VkDevice device,
                                   kRequiredFlags, "VUID-VkImageSubresourceLayers-aspectMask-parameter",
                                   "VUID-VkImageSubresourceLayers-aspectMask-requiredbitmask");
 
-                // No xml-driven validation
-
                 skip |=
                     ValidateFlags(pRegions_loc.dot(Field::aspectMask), vvl::FlagBitmask::VkImageAspectFlagBits,
                                   AllVkImageAspectFlagBits, pCopyImageToImageInfo->pRegions[regionIndex].dstSubresource.aspectMask,
                                   kRequiredFlags, "VUID-VkImageSubresourceLayers-aspectMask-parameter",
                                   "VUID-VkImageSubresourceLayers-aspectMask-requiredbitmask");
-
-                // No xml-driven validation
-
-                // No xml-driven validation
             }
         }
     }
@@ -24677,8 +24250,9 @@ bool StatelessValidation::PreCallValidateTransitionImageLayoutEXT(VkDevice devic
         "VUID-VkHostImageLayoutTransitionInfoEXT-sType-sType", "VUID-vkTransitionImageLayoutEXT-pTransitions-parameter",
         "VUID-vkTransitionImageLayoutEXT-transitionCount-arraylength");
     if (pTransitions != nullptr) {
+        [[maybe_unused]] Location pTransitions_loc = loc.dot(Field::pTransitions);
         for (uint32_t transitionIndex = 0; transitionIndex < transitionCount; ++transitionIndex) {
-            [[maybe_unused]] const Location pTransitions_loc = loc.dot(Field::pTransitions, transitionIndex);
+            pTransitions_loc.index = transitionIndex;
             skip |=
                 ValidateStructPnext(pTransitions_loc, pTransitions[transitionIndex].pNext, 0, nullptr, GeneratedVulkanHeaderVersion,
                                     "VUID-VkHostImageLayoutTransitionInfoEXT-pNext-pNext", kVUIDUndefined, VK_NULL_HANDLE, true);
@@ -24811,8 +24385,9 @@ bool StatelessValidation::PreCallValidateCmdPreprocessGeneratedCommandsNV(VkComm
                               "VUID-VkGeneratedCommandsInfoNV-pStreams-parameter");
 
         if (pGeneratedCommandsInfo->pStreams != nullptr) {
+            [[maybe_unused]] Location pStreams_loc = pGeneratedCommandsInfo_loc.dot(Field::pStreams);
             for (uint32_t streamIndex = 0; streamIndex < pGeneratedCommandsInfo->streamCount; ++streamIndex) {
-                [[maybe_unused]] const Location pStreams_loc = pGeneratedCommandsInfo_loc.dot(Field::pStreams, streamIndex);
+                pStreams_loc.index = streamIndex;
                 skip |=
                     ValidateRequiredHandle(pStreams_loc.dot(Field::buffer), pGeneratedCommandsInfo->pStreams[streamIndex].buffer);
             }
@@ -24855,8 +24430,9 @@ bool StatelessValidation::PreCallValidateCmdExecuteGeneratedCommandsNV(VkCommand
                               "VUID-VkGeneratedCommandsInfoNV-pStreams-parameter");
 
         if (pGeneratedCommandsInfo->pStreams != nullptr) {
+            [[maybe_unused]] Location pStreams_loc = pGeneratedCommandsInfo_loc.dot(Field::pStreams);
             for (uint32_t streamIndex = 0; streamIndex < pGeneratedCommandsInfo->streamCount; ++streamIndex) {
-                [[maybe_unused]] const Location pStreams_loc = pGeneratedCommandsInfo_loc.dot(Field::pStreams, streamIndex);
+                pStreams_loc.index = streamIndex;
                 skip |=
                     ValidateRequiredHandle(pStreams_loc.dot(Field::buffer), pGeneratedCommandsInfo->pStreams[streamIndex].buffer);
             }
@@ -24915,8 +24491,9 @@ bool StatelessValidation::PreCallValidateCreateIndirectCommandsLayoutNV(VkDevice
                                         "VUID-VkIndirectCommandsLayoutCreateInfoNV-tokenCount-arraylength");
 
         if (pCreateInfo->pTokens != nullptr) {
+            [[maybe_unused]] Location pTokens_loc = pCreateInfo_loc.dot(Field::pTokens);
             for (uint32_t tokenIndex = 0; tokenIndex < pCreateInfo->tokenCount; ++tokenIndex) {
-                [[maybe_unused]] const Location pTokens_loc = pCreateInfo_loc.dot(Field::pTokens, tokenIndex);
+                pTokens_loc.index = tokenIndex;
                 skip |= ValidateStructPnext(pTokens_loc, pCreateInfo->pTokens[tokenIndex].pNext, 0, nullptr,
                                             GeneratedVulkanHeaderVersion, "VUID-VkIndirectCommandsLayoutTokenNV-pNext-pNext",
                                             kVUIDUndefined, VK_NULL_HANDLE, true);
@@ -25386,8 +24963,9 @@ bool StatelessValidation::PreCallValidateCmdBindDescriptorBuffersEXT(VkCommandBu
         "VUID-VkDescriptorBufferBindingInfoEXT-sType-sType", "VUID-vkCmdBindDescriptorBuffersEXT-pBindingInfos-parameter",
         "VUID-vkCmdBindDescriptorBuffersEXT-bufferCount-arraylength");
     if (pBindingInfos != nullptr) {
+        [[maybe_unused]] Location pBindingInfos_loc = loc.dot(Field::pBindingInfos);
         for (uint32_t bufferIndex = 0; bufferIndex < bufferCount; ++bufferIndex) {
-            [[maybe_unused]] const Location pBindingInfos_loc = loc.dot(Field::pBindingInfos, bufferIndex);
+            pBindingInfos_loc.index = bufferIndex;
             constexpr std::array allowed_structs_VkDescriptorBufferBindingInfoEXT = {
                 VK_STRUCTURE_TYPE_BUFFER_USAGE_FLAGS_2_CREATE_INFO_KHR,
                 VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_PUSH_DESCRIPTOR_BUFFER_HANDLE_EXT};
@@ -25680,10 +25258,10 @@ bool StatelessValidation::PreCallValidateCmdSetVertexInputEXT(
                                     true, "VUID-VkVertexInputBindingDescription2EXT-sType-sType",
                                     "VUID-vkCmdSetVertexInputEXT-pVertexBindingDescriptions-parameter", kVUIDUndefined);
     if (pVertexBindingDescriptions != nullptr) {
+        [[maybe_unused]] Location pVertexBindingDescriptions_loc = loc.dot(Field::pVertexBindingDescriptions);
         for (uint32_t vertexBindingDescriptionIndex = 0; vertexBindingDescriptionIndex < vertexBindingDescriptionCount;
              ++vertexBindingDescriptionIndex) {
-            [[maybe_unused]] const Location pVertexBindingDescriptions_loc =
-                loc.dot(Field::pVertexBindingDescriptions, vertexBindingDescriptionIndex);
+            pVertexBindingDescriptions_loc.index = vertexBindingDescriptionIndex;
             skip |= ValidateRangedEnum(pVertexBindingDescriptions_loc.dot(Field::inputRate), vvl::Enum::VkVertexInputRate,
                                        pVertexBindingDescriptions[vertexBindingDescriptionIndex].inputRate,
                                        "VUID-VkVertexInputBindingDescription2EXT-inputRate-parameter");
@@ -25695,10 +25273,10 @@ bool StatelessValidation::PreCallValidateCmdSetVertexInputEXT(
                                     true, "VUID-VkVertexInputAttributeDescription2EXT-sType-sType",
                                     "VUID-vkCmdSetVertexInputEXT-pVertexAttributeDescriptions-parameter", kVUIDUndefined);
     if (pVertexAttributeDescriptions != nullptr) {
+        [[maybe_unused]] Location pVertexAttributeDescriptions_loc = loc.dot(Field::pVertexAttributeDescriptions);
         for (uint32_t vertexAttributeDescriptionIndex = 0; vertexAttributeDescriptionIndex < vertexAttributeDescriptionCount;
              ++vertexAttributeDescriptionIndex) {
-            [[maybe_unused]] const Location pVertexAttributeDescriptions_loc =
-                loc.dot(Field::pVertexAttributeDescriptions, vertexAttributeDescriptionIndex);
+            pVertexAttributeDescriptions_loc.index = vertexAttributeDescriptionIndex;
             skip |= ValidateRangedEnum(pVertexAttributeDescriptions_loc.dot(Field::format), vvl::Enum::VkFormat,
                                        pVertexAttributeDescriptions[vertexAttributeDescriptionIndex].format,
                                        "VUID-VkVertexInputAttributeDescription2EXT-format-parameter");
@@ -25903,10 +25481,10 @@ bool StatelessValidation::PreCallValidateSetBufferCollectionImageConstraintsFUCH
             "VUID-VkImageConstraintsInfoFUCHSIA-formatConstraintsCount-arraylength");
 
         if (pImageConstraintsInfo->pFormatConstraints != nullptr) {
+            [[maybe_unused]] Location pFormatConstraints_loc = pImageConstraintsInfo_loc.dot(Field::pFormatConstraints);
             for (uint32_t formatConstraintsIndex = 0; formatConstraintsIndex < pImageConstraintsInfo->formatConstraintsCount;
                  ++formatConstraintsIndex) {
-                [[maybe_unused]] const Location pFormatConstraints_loc =
-                    pImageConstraintsInfo_loc.dot(Field::pFormatConstraints, formatConstraintsIndex);
+                pFormatConstraints_loc.index = formatConstraintsIndex;
                 skip |= ValidateStructPnext(pFormatConstraints_loc,
                                             pImageConstraintsInfo->pFormatConstraints[formatConstraintsIndex].pNext, 0, nullptr,
                                             GeneratedVulkanHeaderVersion, "VUID-VkImageFormatConstraintsInfoFUCHSIA-pNext-pNext",
@@ -25958,8 +25536,6 @@ bool StatelessValidation::PreCallValidateSetBufferCollectionImageConstraintsFUCH
                                            pImageConstraintsInfo->pFormatConstraints[formatConstraintsIndex].imageCreateInfo.format,
                                            "VUID-VkImageCreateInfo-format-parameter");
 
-                // No xml-driven validation
-
                 skip |= ValidateFlags(
                     pFormatConstraints_loc.dot(Field::samples), vvl::FlagBitmask::VkSampleCountFlagBits, AllVkSampleCountFlagBits,
                     pImageConstraintsInfo->pFormatConstraints[formatConstraintsIndex].imageCreateInfo.samples, kRequiredSingleBit,
@@ -26004,11 +25580,11 @@ bool StatelessValidation::PreCallValidateSetBufferCollectionImageConstraintsFUCH
                     "VUID-VkImageFormatConstraintsInfoFUCHSIA-colorSpaceCount-arraylength");
 
                 if (pImageConstraintsInfo->pFormatConstraints[formatConstraintsIndex].pColorSpaces != nullptr) {
+                    [[maybe_unused]] Location pColorSpaces_loc = pFormatConstraints_loc.dot(Field::pColorSpaces);
                     for (uint32_t colorSpaceIndex = 0;
                          colorSpaceIndex < pImageConstraintsInfo->pFormatConstraints[formatConstraintsIndex].colorSpaceCount;
                          ++colorSpaceIndex) {
-                        [[maybe_unused]] const Location pColorSpaces_loc =
-                            pFormatConstraints_loc.dot(Field::pColorSpaces, colorSpaceIndex);
+                        pColorSpaces_loc.index = colorSpaceIndex;
                         skip |= ValidateStructPnext(
                             pColorSpaces_loc,
                             pImageConstraintsInfo->pFormatConstraints[formatConstraintsIndex].pColorSpaces[colorSpaceIndex].pNext,
@@ -26482,8 +26058,9 @@ bool StatelessValidation::PreCallValidateCmdBuildMicromapsEXT(VkCommandBuffer co
                                     "VUID-VkMicromapBuildInfoEXT-sType-sType", "VUID-vkCmdBuildMicromapsEXT-pInfos-parameter",
                                     "VUID-vkCmdBuildMicromapsEXT-infoCount-arraylength");
     if (pInfos != nullptr) {
+        [[maybe_unused]] Location pInfos_loc = loc.dot(Field::pInfos);
         for (uint32_t infoIndex = 0; infoIndex < infoCount; ++infoIndex) {
-            [[maybe_unused]] const Location pInfos_loc = loc.dot(Field::pInfos, infoIndex);
+            pInfos_loc.index = infoIndex;
             skip |= ValidateStructPnext(pInfos_loc, pInfos[infoIndex].pNext, 0, nullptr, GeneratedVulkanHeaderVersion,
                                         "VUID-VkMicromapBuildInfoEXT-pNext-pNext", kVUIDUndefined, VK_NULL_HANDLE, true);
 
@@ -26493,20 +26070,6 @@ bool StatelessValidation::PreCallValidateCmdBuildMicromapsEXT(VkCommandBuffer co
             skip |= ValidateFlags(pInfos_loc.dot(Field::flags), vvl::FlagBitmask::VkBuildMicromapFlagBitsEXT,
                                   AllVkBuildMicromapFlagBitsEXT, pInfos[infoIndex].flags, kOptionalFlags,
                                   "VUID-VkMicromapBuildInfoEXT-flags-parameter");
-
-            if (pInfos[infoIndex].pUsageCounts != nullptr) {
-                for (uint32_t usageIndexsIndex = 0; usageIndexsIndex < pInfos[infoIndex].usageCountsCount; ++usageIndexsIndex) {
-                    [[maybe_unused]] const Location pUsageCounts_loc = pInfos_loc.dot(Field::pUsageCounts, usageIndexsIndex);
-                    // No xml-driven validation
-                }
-            }
-
-            if (pInfos[infoIndex].ppUsageCounts != nullptr) {
-                for (uint32_t usageIndexsIndex = 0; usageIndexsIndex < pInfos[infoIndex].usageCountsCount; ++usageIndexsIndex) {
-                    [[maybe_unused]] const Location ppUsageCounts_loc = pInfos_loc.dot(Field::ppUsageCounts, usageIndexsIndex);
-                    // No xml-driven validation
-                }
-            }
         }
     }
     return skip;
@@ -26524,8 +26087,9 @@ bool StatelessValidation::PreCallValidateBuildMicromapsEXT(VkDevice device, VkDe
                                     "VUID-VkMicromapBuildInfoEXT-sType-sType", "VUID-vkBuildMicromapsEXT-pInfos-parameter",
                                     "VUID-vkBuildMicromapsEXT-infoCount-arraylength");
     if (pInfos != nullptr) {
+        [[maybe_unused]] Location pInfos_loc = loc.dot(Field::pInfos);
         for (uint32_t infoIndex = 0; infoIndex < infoCount; ++infoIndex) {
-            [[maybe_unused]] const Location pInfos_loc = loc.dot(Field::pInfos, infoIndex);
+            pInfos_loc.index = infoIndex;
             skip |= ValidateStructPnext(pInfos_loc, pInfos[infoIndex].pNext, 0, nullptr, GeneratedVulkanHeaderVersion,
                                         "VUID-VkMicromapBuildInfoEXT-pNext-pNext", kVUIDUndefined, VK_NULL_HANDLE, true);
 
@@ -26535,20 +26099,6 @@ bool StatelessValidation::PreCallValidateBuildMicromapsEXT(VkDevice device, VkDe
             skip |= ValidateFlags(pInfos_loc.dot(Field::flags), vvl::FlagBitmask::VkBuildMicromapFlagBitsEXT,
                                   AllVkBuildMicromapFlagBitsEXT, pInfos[infoIndex].flags, kOptionalFlags,
                                   "VUID-VkMicromapBuildInfoEXT-flags-parameter");
-
-            if (pInfos[infoIndex].pUsageCounts != nullptr) {
-                for (uint32_t usageIndexsIndex = 0; usageIndexsIndex < pInfos[infoIndex].usageCountsCount; ++usageIndexsIndex) {
-                    [[maybe_unused]] const Location pUsageCounts_loc = pInfos_loc.dot(Field::pUsageCounts, usageIndexsIndex);
-                    // No xml-driven validation
-                }
-            }
-
-            if (pInfos[infoIndex].ppUsageCounts != nullptr) {
-                for (uint32_t usageIndexsIndex = 0; usageIndexsIndex < pInfos[infoIndex].usageCountsCount; ++usageIndexsIndex) {
-                    [[maybe_unused]] const Location ppUsageCounts_loc = pInfos_loc.dot(Field::ppUsageCounts, usageIndexsIndex);
-                    // No xml-driven validation
-                }
-            }
         }
     }
     return skip;
@@ -26779,20 +26329,6 @@ bool StatelessValidation::PreCallValidateGetMicromapBuildSizesEXT(VkDevice devic
         skip |= ValidateFlags(pBuildInfo_loc.dot(Field::flags), vvl::FlagBitmask::VkBuildMicromapFlagBitsEXT,
                               AllVkBuildMicromapFlagBitsEXT, pBuildInfo->flags, kOptionalFlags,
                               "VUID-VkMicromapBuildInfoEXT-flags-parameter");
-
-        if (pBuildInfo->pUsageCounts != nullptr) {
-            for (uint32_t usageIndexsIndex = 0; usageIndexsIndex < pBuildInfo->usageCountsCount; ++usageIndexsIndex) {
-                [[maybe_unused]] const Location pUsageCounts_loc = pBuildInfo_loc.dot(Field::pUsageCounts, usageIndexsIndex);
-                // No xml-driven validation
-            }
-        }
-
-        if (pBuildInfo->ppUsageCounts != nullptr) {
-            for (uint32_t usageIndexsIndex = 0; usageIndexsIndex < pBuildInfo->usageCountsCount; ++usageIndexsIndex) {
-                [[maybe_unused]] const Location ppUsageCounts_loc = pBuildInfo_loc.dot(Field::ppUsageCounts, usageIndexsIndex);
-                // No xml-driven validation
-            }
-        }
     }
     skip |=
         ValidateStructType(loc.dot(Field::pSizeInfo), "VK_STRUCTURE_TYPE_MICROMAP_BUILD_SIZES_INFO_EXT", pSizeInfo,
@@ -26895,8 +26431,9 @@ bool StatelessValidation::PreCallValidateCmdCopyMemoryToImageIndirectNV(
                           "VUID-vkCmdCopyMemoryToImageIndirectNV-copyCount-arraylength",
                           "VUID-vkCmdCopyMemoryToImageIndirectNV-pImageSubresources-parameter");
     if (pImageSubresources != nullptr) {
+        [[maybe_unused]] Location pImageSubresources_loc = loc.dot(Field::pImageSubresources);
         for (uint32_t copyIndex = 0; copyIndex < copyCount; ++copyIndex) {
-            [[maybe_unused]] const Location pImageSubresources_loc = loc.dot(Field::pImageSubresources, copyIndex);
+            pImageSubresources_loc.index = copyIndex;
             skip |= ValidateFlags(pImageSubresources_loc.dot(Field::aspectMask), vvl::FlagBitmask::VkImageAspectFlagBits,
                                   AllVkImageAspectFlagBits, pImageSubresources[copyIndex].aspectMask, kRequiredFlags,
                                   "VUID-VkImageSubresourceLayers-aspectMask-parameter",
@@ -26917,9 +26454,9 @@ bool StatelessValidation::PreCallValidateCmdDecompressMemoryNV(VkCommandBuffer c
                           &pDecompressMemoryRegions, true, true, "VUID-vkCmdDecompressMemoryNV-decompressRegionCount-arraylength",
                           "VUID-vkCmdDecompressMemoryNV-pDecompressMemoryRegions-parameter");
     if (pDecompressMemoryRegions != nullptr) {
+        [[maybe_unused]] Location pDecompressMemoryRegions_loc = loc.dot(Field::pDecompressMemoryRegions);
         for (uint32_t decompressRegionIndex = 0; decompressRegionIndex < decompressRegionCount; ++decompressRegionIndex) {
-            [[maybe_unused]] const Location pDecompressMemoryRegions_loc =
-                loc.dot(Field::pDecompressMemoryRegions, decompressRegionIndex);
+            pDecompressMemoryRegions_loc.index = decompressRegionIndex;
             skip |= ValidateFlags(pDecompressMemoryRegions_loc.dot(Field::decompressionMethod),
                                   vvl::FlagBitmask::VkMemoryDecompressionMethodFlagBitsNV, AllVkMemoryDecompressionMethodFlagBitsNV,
                                   pDecompressMemoryRegions[decompressRegionIndex].decompressionMethod, kRequiredFlags,
@@ -27006,15 +26543,6 @@ bool StatelessValidation::PreCallValidateGetPipelineIndirectMemoryRequirementsNV
                 pCreateInfo->stage.pSpecializationInfo->mapEntryCount, &pCreateInfo->stage.pSpecializationInfo->pMapEntries, false,
                 true, kVUIDUndefined, "VUID-VkSpecializationInfo-pMapEntries-parameter");
 
-            if (pCreateInfo->stage.pSpecializationInfo->pMapEntries != nullptr) {
-                for (uint32_t mapEntryIndex = 0; mapEntryIndex < pCreateInfo->stage.pSpecializationInfo->mapEntryCount;
-                     ++mapEntryIndex) {
-                    [[maybe_unused]] const Location pMapEntries_loc =
-                        pSpecializationInfo_loc.dot(Field::pMapEntries, mapEntryIndex);
-                    // No xml-driven validation
-                }
-            }
-
             skip |= ValidateArray(pSpecializationInfo_loc.dot(Field::dataSize), pSpecializationInfo_loc.dot(Field::pData),
                                   pCreateInfo->stage.pSpecializationInfo->dataSize, &pCreateInfo->stage.pSpecializationInfo->pData,
                                   false, true, kVUIDUndefined, "VUID-VkSpecializationInfo-pData-parameter");
@@ -27182,8 +26710,9 @@ bool StatelessValidation::PreCallValidateCmdSetColorBlendEquationEXT(VkCommandBu
                           &pColorBlendEquations, true, true, "VUID-vkCmdSetColorBlendEquationEXT-attachmentCount-arraylength",
                           "VUID-vkCmdSetColorBlendEquationEXT-pColorBlendEquations-parameter");
     if (pColorBlendEquations != nullptr) {
+        [[maybe_unused]] Location pColorBlendEquations_loc = loc.dot(Field::pColorBlendEquations);
         for (uint32_t attachmentIndex = 0; attachmentIndex < attachmentCount; ++attachmentIndex) {
-            [[maybe_unused]] const Location pColorBlendEquations_loc = loc.dot(Field::pColorBlendEquations, attachmentIndex);
+            pColorBlendEquations_loc.index = attachmentIndex;
             skip |= ValidateRangedEnum(pColorBlendEquations_loc.dot(Field::srcColorBlendFactor), vvl::Enum::VkBlendFactor,
                                        pColorBlendEquations[attachmentIndex].srcColorBlendFactor,
                                        "VUID-VkColorBlendEquationEXT-srcColorBlendFactor-parameter");
@@ -27306,8 +26835,9 @@ bool StatelessValidation::PreCallValidateCmdSetColorBlendAdvancedEXT(VkCommandBu
                           &pColorBlendAdvanced, true, true, "VUID-vkCmdSetColorBlendAdvancedEXT-attachmentCount-arraylength",
                           "VUID-vkCmdSetColorBlendAdvancedEXT-pColorBlendAdvanced-parameter");
     if (pColorBlendAdvanced != nullptr) {
+        [[maybe_unused]] Location pColorBlendAdvanced_loc = loc.dot(Field::pColorBlendAdvanced);
         for (uint32_t attachmentIndex = 0; attachmentIndex < attachmentCount; ++attachmentIndex) {
-            [[maybe_unused]] const Location pColorBlendAdvanced_loc = loc.dot(Field::pColorBlendAdvanced, attachmentIndex);
+            pColorBlendAdvanced_loc.index = attachmentIndex;
             skip |= ValidateRangedEnum(pColorBlendAdvanced_loc.dot(Field::advancedBlendOp), vvl::Enum::VkBlendOp,
                                        pColorBlendAdvanced[attachmentIndex].advancedBlendOp,
                                        "VUID-VkColorBlendAdvancedEXT-advancedBlendOp-parameter");
@@ -27396,8 +26926,9 @@ bool StatelessValidation::PreCallValidateCmdSetViewportSwizzleNV(VkCommandBuffer
                           true, "VUID-vkCmdSetViewportSwizzleNV-viewportCount-arraylength",
                           "VUID-vkCmdSetViewportSwizzleNV-pViewportSwizzles-parameter");
     if (pViewportSwizzles != nullptr) {
+        [[maybe_unused]] Location pViewportSwizzles_loc = loc.dot(Field::pViewportSwizzles);
         for (uint32_t viewportIndex = 0; viewportIndex < viewportCount; ++viewportIndex) {
-            [[maybe_unused]] const Location pViewportSwizzles_loc = loc.dot(Field::pViewportSwizzles, viewportIndex);
+            pViewportSwizzles_loc.index = viewportIndex;
             skip |= ValidateRangedEnum(pViewportSwizzles_loc.dot(Field::x), vvl::Enum::VkViewportCoordinateSwizzleNV,
                                        pViewportSwizzles[viewportIndex].x, "VUID-VkViewportSwizzleNV-x-parameter");
 
@@ -27587,8 +27118,9 @@ bool StatelessValidation::PreCallValidateGetPhysicalDeviceOpticalFlowImageFormat
                                     "VUID-vkGetPhysicalDeviceOpticalFlowImageFormatsNV-pImageFormatProperties-parameter",
                                     "VUID-vkGetPhysicalDeviceOpticalFlowImageFormatsNV-pFormatCount-parameter", kVUIDUndefined);
     if (pImageFormatProperties != nullptr) {
+        [[maybe_unused]] Location pImageFormatProperties_loc = loc.dot(Field::pImageFormatProperties);
         for (uint32_t pFormatIndex = 0; pFormatIndex < *pFormatCount; ++pFormatIndex) {
-            [[maybe_unused]] const Location pImageFormatProperties_loc = loc.dot(Field::pImageFormatProperties, pFormatIndex);
+            pImageFormatProperties_loc.index = pFormatIndex;
             skip |= ValidateStructPnext(pImageFormatProperties_loc, pImageFormatProperties[pFormatIndex].pNext, 0, nullptr,
                                         GeneratedVulkanHeaderVersion, "VUID-VkOpticalFlowImageFormatPropertiesNV-pNext-pNext",
                                         kVUIDUndefined, physicalDevice, false);
@@ -27751,15 +27283,6 @@ bool StatelessValidation::PreCallValidateCmdOpticalFlowExecuteNV(VkCommandBuffer
         skip |= ValidateArray(pExecuteInfo_loc.dot(Field::regionCount), pExecuteInfo_loc.dot(Field::pRegions),
                               pExecuteInfo->regionCount, &pExecuteInfo->pRegions, false, true, kVUIDUndefined,
                               "VUID-VkOpticalFlowExecuteInfoNV-pRegions-parameter");
-
-        if (pExecuteInfo->pRegions != nullptr) {
-            for (uint32_t regionIndex = 0; regionIndex < pExecuteInfo->regionCount; ++regionIndex) {
-                [[maybe_unused]] const Location pRegions_loc = pExecuteInfo_loc.dot(Field::pRegions, regionIndex);
-                // No xml-driven validation
-
-                // No xml-driven validation
-            }
-        }
     }
     return skip;
 }
@@ -27777,8 +27300,9 @@ bool StatelessValidation::PreCallValidateCreateShadersEXT(VkDevice device, uint3
         pCreateInfos, VK_STRUCTURE_TYPE_SHADER_CREATE_INFO_EXT, true, true, "VUID-VkShaderCreateInfoEXT-sType-sType",
         "VUID-vkCreateShadersEXT-pCreateInfos-parameter", "VUID-vkCreateShadersEXT-createInfoCount-arraylength");
     if (pCreateInfos != nullptr) {
+        [[maybe_unused]] Location pCreateInfos_loc = loc.dot(Field::pCreateInfos);
         for (uint32_t createInfoIndex = 0; createInfoIndex < createInfoCount; ++createInfoIndex) {
-            [[maybe_unused]] const Location pCreateInfos_loc = loc.dot(Field::pCreateInfos, createInfoIndex);
+            pCreateInfos_loc.index = createInfoIndex;
             constexpr std::array allowed_structs_VkShaderCreateInfoEXT = {
                 VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO};
 
@@ -27807,10 +27331,10 @@ bool StatelessValidation::PreCallValidateCreateShadersEXT(VkDevice device, uint3
                                   "VUID-VkShaderCreateInfoEXT-codeSize-arraylength", "VUID-VkShaderCreateInfoEXT-pCode-parameter");
 
             if (pCreateInfos[createInfoIndex].pPushConstantRanges != nullptr) {
+                [[maybe_unused]] Location pPushConstantRanges_loc = pCreateInfos_loc.dot(Field::pPushConstantRanges);
                 for (uint32_t pushConstantRangeIndex = 0;
                      pushConstantRangeIndex < pCreateInfos[createInfoIndex].pushConstantRangeCount; ++pushConstantRangeIndex) {
-                    [[maybe_unused]] const Location pPushConstantRanges_loc =
-                        pCreateInfos_loc.dot(Field::pPushConstantRanges, pushConstantRangeIndex);
+                    pPushConstantRanges_loc.index = pushConstantRangeIndex;
                     skip |= ValidateFlags(pPushConstantRanges_loc.dot(Field::stageFlags), vvl::FlagBitmask::VkShaderStageFlagBits,
                                           AllVkShaderStageFlagBits,
                                           pCreateInfos[createInfoIndex].pPushConstantRanges[pushConstantRangeIndex].stageFlags,
@@ -27827,15 +27351,6 @@ bool StatelessValidation::PreCallValidateCreateShadersEXT(VkDevice device, uint3
                                       &pCreateInfos[createInfoIndex].pSpecializationInfo->pMapEntries, false, true, kVUIDUndefined,
                                       "VUID-VkSpecializationInfo-pMapEntries-parameter");
 
-                if (pCreateInfos[createInfoIndex].pSpecializationInfo->pMapEntries != nullptr) {
-                    for (uint32_t mapEntryIndex = 0;
-                         mapEntryIndex < pCreateInfos[createInfoIndex].pSpecializationInfo->mapEntryCount; ++mapEntryIndex) {
-                        [[maybe_unused]] const Location pMapEntries_loc =
-                            pSpecializationInfo_loc.dot(Field::pMapEntries, mapEntryIndex);
-                        // No xml-driven validation
-                    }
-                }
-
                 skip |= ValidateArray(pSpecializationInfo_loc.dot(Field::dataSize), pSpecializationInfo_loc.dot(Field::pData),
                                       pCreateInfos[createInfoIndex].pSpecializationInfo->dataSize,
                                       &pCreateInfos[createInfoIndex].pSpecializationInfo->pData, false, true, kVUIDUndefined,
@@ -27984,10 +27499,6 @@ bool StatelessValidation::PreCallValidateGetDynamicRenderingTilePropertiesQCOM(V
         skip |= ValidateFlags(pRenderingInfo_loc.dot(Field::flags), vvl::FlagBitmask::VkRenderingFlagBits, AllVkRenderingFlagBits,
                               pRenderingInfo->flags, kOptionalFlags, "VUID-VkRenderingInfo-flags-parameter");
 
-        // No xml-driven validation
-
-        // No xml-driven validation
-
         skip |= ValidateStructTypeArray(
             pRenderingInfo_loc.dot(Field::colorAttachmentCount), pRenderingInfo_loc.dot(Field::pColorAttachments),
             "VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO", pRenderingInfo->colorAttachmentCount, pRenderingInfo->pColorAttachments,
@@ -27995,10 +27506,10 @@ bool StatelessValidation::PreCallValidateGetDynamicRenderingTilePropertiesQCOM(V
             "VUID-VkRenderingInfo-pColorAttachments-parameter", kVUIDUndefined);
 
         if (pRenderingInfo->pColorAttachments != nullptr) {
+            [[maybe_unused]] Location pColorAttachments_loc = pRenderingInfo_loc.dot(Field::pColorAttachments);
             for (uint32_t colorAttachmentIndex = 0; colorAttachmentIndex < pRenderingInfo->colorAttachmentCount;
                  ++colorAttachmentIndex) {
-                [[maybe_unused]] const Location pColorAttachments_loc =
-                    pRenderingInfo_loc.dot(Field::pColorAttachments, colorAttachmentIndex);
+                pColorAttachments_loc.index = colorAttachmentIndex;
                 skip |= ValidateStructPnext(pColorAttachments_loc, pRenderingInfo->pColorAttachments[colorAttachmentIndex].pNext, 0,
                                             nullptr, GeneratedVulkanHeaderVersion, "VUID-VkRenderingAttachmentInfo-pNext-pNext",
                                             kVUIDUndefined, VK_NULL_HANDLE, true);
@@ -28022,8 +27533,6 @@ bool StatelessValidation::PreCallValidateGetDynamicRenderingTilePropertiesQCOM(V
                 skip |= ValidateRangedEnum(pColorAttachments_loc.dot(Field::storeOp), vvl::Enum::VkAttachmentStoreOp,
                                            pRenderingInfo->pColorAttachments[colorAttachmentIndex].storeOp,
                                            "VUID-VkRenderingAttachmentInfo-storeOp-parameter");
-
-                // No xml-driven validation
             }
         }
 
@@ -28055,8 +27564,6 @@ bool StatelessValidation::PreCallValidateGetDynamicRenderingTilePropertiesQCOM(V
             skip |=
                 ValidateRangedEnum(pDepthAttachment_loc.dot(Field::storeOp), vvl::Enum::VkAttachmentStoreOp,
                                    pRenderingInfo->pDepthAttachment->storeOp, "VUID-VkRenderingAttachmentInfo-storeOp-parameter");
-
-            // No xml-driven validation
         }
 
         skip |=
@@ -28089,8 +27596,6 @@ bool StatelessValidation::PreCallValidateGetDynamicRenderingTilePropertiesQCOM(V
             skip |=
                 ValidateRangedEnum(pStencilAttachment_loc.dot(Field::storeOp), vvl::Enum::VkAttachmentStoreOp,
                                    pRenderingInfo->pStencilAttachment->storeOp, "VUID-VkRenderingAttachmentInfo-storeOp-parameter");
-
-            // No xml-driven validation
         }
     }
     skip |= ValidateStructType(
@@ -28346,8 +27851,9 @@ bool StatelessValidation::PreCallValidateCmdBuildAccelerationStructuresKHR(
         "VUID-VkAccelerationStructureBuildGeometryInfoKHR-sType-sType", "VUID-vkCmdBuildAccelerationStructuresKHR-pInfos-parameter",
         "VUID-vkCmdBuildAccelerationStructuresKHR-infoCount-arraylength");
     if (pInfos != nullptr) {
+        [[maybe_unused]] Location pInfos_loc = loc.dot(Field::pInfos);
         for (uint32_t infoIndex = 0; infoIndex < infoCount; ++infoIndex) {
-            [[maybe_unused]] const Location pInfos_loc = loc.dot(Field::pInfos, infoIndex);
+            pInfos_loc.index = infoIndex;
             skip |= ValidateStructPnext(pInfos_loc, pInfos[infoIndex].pNext, 0, nullptr, GeneratedVulkanHeaderVersion,
                                         "VUID-VkAccelerationStructureBuildGeometryInfoKHR-pNext-pNext", kVUIDUndefined,
                                         VK_NULL_HANDLE, true);
@@ -28367,8 +27873,9 @@ bool StatelessValidation::PreCallValidateCmdBuildAccelerationStructuresKHR(
                                         "VUID-VkAccelerationStructureBuildGeometryInfoKHR-pGeometries-parameter", kVUIDUndefined);
 
             if (pInfos[infoIndex].pGeometries != nullptr) {
+                [[maybe_unused]] Location pGeometries_loc = pInfos_loc.dot(Field::pGeometries);
                 for (uint32_t geometryIndex = 0; geometryIndex < pInfos[infoIndex].geometryCount; ++geometryIndex) {
-                    [[maybe_unused]] const Location pGeometries_loc = pInfos_loc.dot(Field::pGeometries, geometryIndex);
+                    pGeometries_loc.index = geometryIndex;
                     skip |= ValidateStructPnext(pGeometries_loc, pInfos[infoIndex].pGeometries[geometryIndex].pNext, 0, nullptr,
                                                 GeneratedVulkanHeaderVersion, "VUID-VkAccelerationStructureGeometryKHR-pNext-pNext",
                                                 kVUIDUndefined, VK_NULL_HANDLE, true);
@@ -28391,8 +27898,9 @@ bool StatelessValidation::PreCallValidateCmdBuildAccelerationStructuresKHR(
                 "VUID-VkAccelerationStructureBuildGeometryInfoKHR-ppGeometries-parameter", kVUIDUndefined);
 
             if (pInfos[infoIndex].ppGeometries != nullptr) {
+                [[maybe_unused]] Location ppGeometries_loc = pInfos_loc.dot(Field::ppGeometries);
                 for (uint32_t geometryIndex = 0; geometryIndex < pInfos[infoIndex].geometryCount; ++geometryIndex) {
-                    [[maybe_unused]] const Location ppGeometries_loc = pInfos_loc.dot(Field::ppGeometries, geometryIndex);
+                    ppGeometries_loc.index = geometryIndex;
                     skip |= ValidateStructPnext(ppGeometries_loc, pInfos[infoIndex].ppGeometries[geometryIndex]->pNext, 0, nullptr,
                                                 GeneratedVulkanHeaderVersion, "VUID-VkAccelerationStructureGeometryKHR-pNext-pNext",
                                                 kVUIDUndefined, VK_NULL_HANDLE, true);
@@ -28411,12 +27919,6 @@ bool StatelessValidation::PreCallValidateCmdBuildAccelerationStructuresKHR(
     skip |= ValidateArray(loc.dot(Field::infoCount), loc.dot(Field::ppBuildRangeInfos), infoCount, &ppBuildRangeInfos, true, true,
                           "VUID-vkCmdBuildAccelerationStructuresKHR-infoCount-arraylength",
                           "VUID-vkCmdBuildAccelerationStructuresKHR-ppBuildRangeInfos-parameter");
-    if (ppBuildRangeInfos != nullptr) {
-        for (uint32_t infoIndex = 0; infoIndex < infoCount; ++infoIndex) {
-            [[maybe_unused]] const Location ppBuildRangeInfos_loc = loc.dot(Field::ppBuildRangeInfos, infoIndex);
-            // No xml-driven validation
-        }
-    }
     if (!skip)
         skip |=
             manual_PreCallValidateCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos, error_obj);
@@ -28438,8 +27940,9 @@ bool StatelessValidation::PreCallValidateCmdBuildAccelerationStructuresIndirectK
                                     "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-pInfos-parameter",
                                     "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-infoCount-arraylength");
     if (pInfos != nullptr) {
+        [[maybe_unused]] Location pInfos_loc = loc.dot(Field::pInfos);
         for (uint32_t infoIndex = 0; infoIndex < infoCount; ++infoIndex) {
-            [[maybe_unused]] const Location pInfos_loc = loc.dot(Field::pInfos, infoIndex);
+            pInfos_loc.index = infoIndex;
             skip |= ValidateStructPnext(pInfos_loc, pInfos[infoIndex].pNext, 0, nullptr, GeneratedVulkanHeaderVersion,
                                         "VUID-VkAccelerationStructureBuildGeometryInfoKHR-pNext-pNext", kVUIDUndefined,
                                         VK_NULL_HANDLE, true);
@@ -28459,8 +27962,9 @@ bool StatelessValidation::PreCallValidateCmdBuildAccelerationStructuresIndirectK
                                         "VUID-VkAccelerationStructureBuildGeometryInfoKHR-pGeometries-parameter", kVUIDUndefined);
 
             if (pInfos[infoIndex].pGeometries != nullptr) {
+                [[maybe_unused]] Location pGeometries_loc = pInfos_loc.dot(Field::pGeometries);
                 for (uint32_t geometryIndex = 0; geometryIndex < pInfos[infoIndex].geometryCount; ++geometryIndex) {
-                    [[maybe_unused]] const Location pGeometries_loc = pInfos_loc.dot(Field::pGeometries, geometryIndex);
+                    pGeometries_loc.index = geometryIndex;
                     skip |= ValidateStructPnext(pGeometries_loc, pInfos[infoIndex].pGeometries[geometryIndex].pNext, 0, nullptr,
                                                 GeneratedVulkanHeaderVersion, "VUID-VkAccelerationStructureGeometryKHR-pNext-pNext",
                                                 kVUIDUndefined, VK_NULL_HANDLE, true);
@@ -28483,8 +27987,9 @@ bool StatelessValidation::PreCallValidateCmdBuildAccelerationStructuresIndirectK
                 "VUID-VkAccelerationStructureBuildGeometryInfoKHR-ppGeometries-parameter", kVUIDUndefined);
 
             if (pInfos[infoIndex].ppGeometries != nullptr) {
+                [[maybe_unused]] Location ppGeometries_loc = pInfos_loc.dot(Field::ppGeometries);
                 for (uint32_t geometryIndex = 0; geometryIndex < pInfos[infoIndex].geometryCount; ++geometryIndex) {
-                    [[maybe_unused]] const Location ppGeometries_loc = pInfos_loc.dot(Field::ppGeometries, geometryIndex);
+                    ppGeometries_loc.index = geometryIndex;
                     skip |= ValidateStructPnext(ppGeometries_loc, pInfos[infoIndex].ppGeometries[geometryIndex]->pNext, 0, nullptr,
                                                 GeneratedVulkanHeaderVersion, "VUID-VkAccelerationStructureGeometryKHR-pNext-pNext",
                                                 kVUIDUndefined, VK_NULL_HANDLE, true);
@@ -28529,8 +28034,9 @@ bool StatelessValidation::PreCallValidateBuildAccelerationStructuresKHR(
         "VUID-VkAccelerationStructureBuildGeometryInfoKHR-sType-sType", "VUID-vkBuildAccelerationStructuresKHR-pInfos-parameter",
         "VUID-vkBuildAccelerationStructuresKHR-infoCount-arraylength");
     if (pInfos != nullptr) {
+        [[maybe_unused]] Location pInfos_loc = loc.dot(Field::pInfos);
         for (uint32_t infoIndex = 0; infoIndex < infoCount; ++infoIndex) {
-            [[maybe_unused]] const Location pInfos_loc = loc.dot(Field::pInfos, infoIndex);
+            pInfos_loc.index = infoIndex;
             skip |= ValidateStructPnext(pInfos_loc, pInfos[infoIndex].pNext, 0, nullptr, GeneratedVulkanHeaderVersion,
                                         "VUID-VkAccelerationStructureBuildGeometryInfoKHR-pNext-pNext", kVUIDUndefined,
                                         VK_NULL_HANDLE, true);
@@ -28550,8 +28056,9 @@ bool StatelessValidation::PreCallValidateBuildAccelerationStructuresKHR(
                                         "VUID-VkAccelerationStructureBuildGeometryInfoKHR-pGeometries-parameter", kVUIDUndefined);
 
             if (pInfos[infoIndex].pGeometries != nullptr) {
+                [[maybe_unused]] Location pGeometries_loc = pInfos_loc.dot(Field::pGeometries);
                 for (uint32_t geometryIndex = 0; geometryIndex < pInfos[infoIndex].geometryCount; ++geometryIndex) {
-                    [[maybe_unused]] const Location pGeometries_loc = pInfos_loc.dot(Field::pGeometries, geometryIndex);
+                    pGeometries_loc.index = geometryIndex;
                     skip |= ValidateStructPnext(pGeometries_loc, pInfos[infoIndex].pGeometries[geometryIndex].pNext, 0, nullptr,
                                                 GeneratedVulkanHeaderVersion, "VUID-VkAccelerationStructureGeometryKHR-pNext-pNext",
                                                 kVUIDUndefined, VK_NULL_HANDLE, true);
@@ -28574,8 +28081,9 @@ bool StatelessValidation::PreCallValidateBuildAccelerationStructuresKHR(
                 "VUID-VkAccelerationStructureBuildGeometryInfoKHR-ppGeometries-parameter", kVUIDUndefined);
 
             if (pInfos[infoIndex].ppGeometries != nullptr) {
+                [[maybe_unused]] Location ppGeometries_loc = pInfos_loc.dot(Field::ppGeometries);
                 for (uint32_t geometryIndex = 0; geometryIndex < pInfos[infoIndex].geometryCount; ++geometryIndex) {
-                    [[maybe_unused]] const Location ppGeometries_loc = pInfos_loc.dot(Field::ppGeometries, geometryIndex);
+                    ppGeometries_loc.index = geometryIndex;
                     skip |= ValidateStructPnext(ppGeometries_loc, pInfos[infoIndex].ppGeometries[geometryIndex]->pNext, 0, nullptr,
                                                 GeneratedVulkanHeaderVersion, "VUID-VkAccelerationStructureGeometryKHR-pNext-pNext",
                                                 kVUIDUndefined, VK_NULL_HANDLE, true);
@@ -28594,12 +28102,6 @@ bool StatelessValidation::PreCallValidateBuildAccelerationStructuresKHR(
     skip |= ValidateArray(loc.dot(Field::infoCount), loc.dot(Field::ppBuildRangeInfos), infoCount, &ppBuildRangeInfos, true, true,
                           "VUID-vkBuildAccelerationStructuresKHR-infoCount-arraylength",
                           "VUID-vkBuildAccelerationStructuresKHR-ppBuildRangeInfos-parameter");
-    if (ppBuildRangeInfos != nullptr) {
-        for (uint32_t infoIndex = 0; infoIndex < infoCount; ++infoIndex) {
-            [[maybe_unused]] const Location ppBuildRangeInfos_loc = loc.dot(Field::ppBuildRangeInfos, infoIndex);
-            // No xml-driven validation
-        }
-    }
     if (!skip)
         skip |= manual_PreCallValidateBuildAccelerationStructuresKHR(device, deferredOperation, infoCount, pInfos,
                                                                      ppBuildRangeInfos, error_obj);
@@ -28883,8 +28385,9 @@ bool StatelessValidation::PreCallValidateGetAccelerationStructureBuildSizesKHR(
                                         "VUID-VkAccelerationStructureBuildGeometryInfoKHR-pGeometries-parameter", kVUIDUndefined);
 
         if (pBuildInfo->pGeometries != nullptr) {
+            [[maybe_unused]] Location pGeometries_loc = pBuildInfo_loc.dot(Field::pGeometries);
             for (uint32_t geometryIndex = 0; geometryIndex < pBuildInfo->geometryCount; ++geometryIndex) {
-                [[maybe_unused]] const Location pGeometries_loc = pBuildInfo_loc.dot(Field::pGeometries, geometryIndex);
+                pGeometries_loc.index = geometryIndex;
                 skip |= ValidateStructPnext(pGeometries_loc, pBuildInfo->pGeometries[geometryIndex].pNext, 0, nullptr,
                                             GeneratedVulkanHeaderVersion, "VUID-VkAccelerationStructureGeometryKHR-pNext-pNext",
                                             kVUIDUndefined, VK_NULL_HANDLE, true);
@@ -28907,8 +28410,9 @@ bool StatelessValidation::PreCallValidateGetAccelerationStructureBuildSizesKHR(
                                                kVUIDUndefined);
 
         if (pBuildInfo->ppGeometries != nullptr) {
+            [[maybe_unused]] Location ppGeometries_loc = pBuildInfo_loc.dot(Field::ppGeometries);
             for (uint32_t geometryIndex = 0; geometryIndex < pBuildInfo->geometryCount; ++geometryIndex) {
-                [[maybe_unused]] const Location ppGeometries_loc = pBuildInfo_loc.dot(Field::ppGeometries, geometryIndex);
+                ppGeometries_loc.index = geometryIndex;
                 skip |= ValidateStructPnext(ppGeometries_loc, pBuildInfo->ppGeometries[geometryIndex]->pNext, 0, nullptr,
                                             GeneratedVulkanHeaderVersion, "VUID-VkAccelerationStructureGeometryKHR-pNext-pNext",
                                             kVUIDUndefined, VK_NULL_HANDLE, true);
@@ -28952,28 +28456,12 @@ bool StatelessValidation::PreCallValidateCmdTraceRaysKHR(VkCommandBuffer command
         skip |= OutputExtensionError(loc, {vvl::Extension::_VK_KHR_ray_tracing_pipeline});
     skip |= ValidateRequiredPointer(loc.dot(Field::pRaygenShaderBindingTable), pRaygenShaderBindingTable,
                                     "VUID-vkCmdTraceRaysKHR-pRaygenShaderBindingTable-parameter");
-    if (pRaygenShaderBindingTable != nullptr) {
-        [[maybe_unused]] const Location pRaygenShaderBindingTable_loc = loc.dot(Field::pRaygenShaderBindingTable);
-        // No xml-driven validation
-    }
     skip |= ValidateRequiredPointer(loc.dot(Field::pMissShaderBindingTable), pMissShaderBindingTable,
                                     "VUID-vkCmdTraceRaysKHR-pMissShaderBindingTable-parameter");
-    if (pMissShaderBindingTable != nullptr) {
-        [[maybe_unused]] const Location pMissShaderBindingTable_loc = loc.dot(Field::pMissShaderBindingTable);
-        // No xml-driven validation
-    }
     skip |= ValidateRequiredPointer(loc.dot(Field::pHitShaderBindingTable), pHitShaderBindingTable,
                                     "VUID-vkCmdTraceRaysKHR-pHitShaderBindingTable-parameter");
-    if (pHitShaderBindingTable != nullptr) {
-        [[maybe_unused]] const Location pHitShaderBindingTable_loc = loc.dot(Field::pHitShaderBindingTable);
-        // No xml-driven validation
-    }
     skip |= ValidateRequiredPointer(loc.dot(Field::pCallableShaderBindingTable), pCallableShaderBindingTable,
                                     "VUID-vkCmdTraceRaysKHR-pCallableShaderBindingTable-parameter");
-    if (pCallableShaderBindingTable != nullptr) {
-        [[maybe_unused]] const Location pCallableShaderBindingTable_loc = loc.dot(Field::pCallableShaderBindingTable);
-        // No xml-driven validation
-    }
     return skip;
 }
 
@@ -28992,8 +28480,9 @@ bool StatelessValidation::PreCallValidateCreateRayTracingPipelinesKHR(VkDevice d
         "VUID-VkRayTracingPipelineCreateInfoKHR-sType-sType", "VUID-vkCreateRayTracingPipelinesKHR-pCreateInfos-parameter",
         "VUID-vkCreateRayTracingPipelinesKHR-createInfoCount-arraylength");
     if (pCreateInfos != nullptr) {
+        [[maybe_unused]] Location pCreateInfos_loc = loc.dot(Field::pCreateInfos);
         for (uint32_t createInfoIndex = 0; createInfoIndex < createInfoCount; ++createInfoIndex) {
-            [[maybe_unused]] const Location pCreateInfos_loc = loc.dot(Field::pCreateInfos, createInfoIndex);
+            pCreateInfos_loc.index = createInfoIndex;
             constexpr std::array allowed_structs_VkRayTracingPipelineCreateInfoKHR = {
                 VK_STRUCTURE_TYPE_PIPELINE_CREATE_FLAGS_2_CREATE_INFO_KHR, VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO,
                 VK_STRUCTURE_TYPE_PIPELINE_ROBUSTNESS_CREATE_INFO_EXT};
@@ -29012,8 +28501,9 @@ bool StatelessValidation::PreCallValidateCreateRayTracingPipelinesKHR(VkDevice d
                                             "VUID-VkRayTracingPipelineCreateInfoKHR-pStages-parameter", kVUIDUndefined);
 
             if (pCreateInfos[createInfoIndex].pStages != nullptr) {
+                [[maybe_unused]] Location pStages_loc = pCreateInfos_loc.dot(Field::pStages);
                 for (uint32_t stageIndex = 0; stageIndex < pCreateInfos[createInfoIndex].stageCount; ++stageIndex) {
-                    [[maybe_unused]] const Location pStages_loc = pCreateInfos_loc.dot(Field::pStages, stageIndex);
+                    pStages_loc.index = stageIndex;
                     constexpr std::array allowed_structs_VkPipelineShaderStageCreateInfo = {
                         VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT,
                         VK_STRUCTURE_TYPE_PIPELINE_ROBUSTNESS_CREATE_INFO_EXT,
@@ -29051,17 +28541,6 @@ bool StatelessValidation::PreCallValidateCreateRayTracingPipelinesKHR(VkDevice d
                                               &pCreateInfos[createInfoIndex].pStages[stageIndex].pSpecializationInfo->pMapEntries,
                                               false, true, kVUIDUndefined, "VUID-VkSpecializationInfo-pMapEntries-parameter");
 
-                        if (pCreateInfos[createInfoIndex].pStages[stageIndex].pSpecializationInfo->pMapEntries != nullptr) {
-                            for (uint32_t mapEntryIndex = 0;
-                                 mapEntryIndex <
-                                 pCreateInfos[createInfoIndex].pStages[stageIndex].pSpecializationInfo->mapEntryCount;
-                                 ++mapEntryIndex) {
-                                [[maybe_unused]] const Location pMapEntries_loc =
-                                    pSpecializationInfo_loc.dot(Field::pMapEntries, mapEntryIndex);
-                                // No xml-driven validation
-                            }
-                        }
-
                         skip |=
                             ValidateArray(pSpecializationInfo_loc.dot(Field::dataSize), pSpecializationInfo_loc.dot(Field::pData),
                                           pCreateInfos[createInfoIndex].pStages[stageIndex].pSpecializationInfo->dataSize,
@@ -29079,8 +28558,9 @@ bool StatelessValidation::PreCallValidateCreateRayTracingPipelinesKHR(VkDevice d
                                             "VUID-VkRayTracingPipelineCreateInfoKHR-pGroups-parameter", kVUIDUndefined);
 
             if (pCreateInfos[createInfoIndex].pGroups != nullptr) {
+                [[maybe_unused]] Location pGroups_loc = pCreateInfos_loc.dot(Field::pGroups);
                 for (uint32_t groupIndex = 0; groupIndex < pCreateInfos[createInfoIndex].groupCount; ++groupIndex) {
-                    [[maybe_unused]] const Location pGroups_loc = pCreateInfos_loc.dot(Field::pGroups, groupIndex);
+                    pGroups_loc.index = groupIndex;
                     skip |=
                         ValidateStructPnext(pGroups_loc, pCreateInfos[createInfoIndex].pGroups[groupIndex].pNext, 0, nullptr,
                                             GeneratedVulkanHeaderVersion, "VUID-VkRayTracingShaderGroupCreateInfoKHR-pNext-pNext",
@@ -29213,28 +28693,12 @@ bool StatelessValidation::PreCallValidateCmdTraceRaysIndirectKHR(VkCommandBuffer
         skip |= OutputExtensionError(loc, {vvl::Extension::_VK_KHR_ray_tracing_pipeline});
     skip |= ValidateRequiredPointer(loc.dot(Field::pRaygenShaderBindingTable), pRaygenShaderBindingTable,
                                     "VUID-vkCmdTraceRaysIndirectKHR-pRaygenShaderBindingTable-parameter");
-    if (pRaygenShaderBindingTable != nullptr) {
-        [[maybe_unused]] const Location pRaygenShaderBindingTable_loc = loc.dot(Field::pRaygenShaderBindingTable);
-        // No xml-driven validation
-    }
     skip |= ValidateRequiredPointer(loc.dot(Field::pMissShaderBindingTable), pMissShaderBindingTable,
                                     "VUID-vkCmdTraceRaysIndirectKHR-pMissShaderBindingTable-parameter");
-    if (pMissShaderBindingTable != nullptr) {
-        [[maybe_unused]] const Location pMissShaderBindingTable_loc = loc.dot(Field::pMissShaderBindingTable);
-        // No xml-driven validation
-    }
     skip |= ValidateRequiredPointer(loc.dot(Field::pHitShaderBindingTable), pHitShaderBindingTable,
                                     "VUID-vkCmdTraceRaysIndirectKHR-pHitShaderBindingTable-parameter");
-    if (pHitShaderBindingTable != nullptr) {
-        [[maybe_unused]] const Location pHitShaderBindingTable_loc = loc.dot(Field::pHitShaderBindingTable);
-        // No xml-driven validation
-    }
     skip |= ValidateRequiredPointer(loc.dot(Field::pCallableShaderBindingTable), pCallableShaderBindingTable,
                                     "VUID-vkCmdTraceRaysIndirectKHR-pCallableShaderBindingTable-parameter");
-    if (pCallableShaderBindingTable != nullptr) {
-        [[maybe_unused]] const Location pCallableShaderBindingTable_loc = loc.dot(Field::pCallableShaderBindingTable);
-        // No xml-driven validation
-    }
     return skip;
 }
 
@@ -29361,10 +28825,10 @@ bool StatelessValidation::ValidatePipelineVertexInputStateCreateInfo(const VkPip
                           "VUID-VkPipelineVertexInputStateCreateInfo-pVertexBindingDescriptions-parameter");
 
     if (info.pVertexBindingDescriptions != nullptr) {
+        [[maybe_unused]] Location pVertexBindingDescriptions_loc = loc.dot(Field::pVertexBindingDescriptions);
         for (uint32_t vertexBindingDescriptionIndex = 0; vertexBindingDescriptionIndex < info.vertexBindingDescriptionCount;
              ++vertexBindingDescriptionIndex) {
-            [[maybe_unused]] const Location pVertexBindingDescriptions_loc =
-                loc.dot(Field::pVertexBindingDescriptions, vertexBindingDescriptionIndex);
+            pVertexBindingDescriptions_loc.index = vertexBindingDescriptionIndex;
             skip |= ValidateRangedEnum(pVertexBindingDescriptions_loc.dot(Field::inputRate), vvl::Enum::VkVertexInputRate,
                                        info.pVertexBindingDescriptions[vertexBindingDescriptionIndex].inputRate,
                                        "VUID-VkVertexInputBindingDescription-inputRate-parameter");
@@ -29376,10 +28840,10 @@ bool StatelessValidation::ValidatePipelineVertexInputStateCreateInfo(const VkPip
                           "VUID-VkPipelineVertexInputStateCreateInfo-pVertexAttributeDescriptions-parameter");
 
     if (info.pVertexAttributeDescriptions != nullptr) {
+        [[maybe_unused]] Location pVertexAttributeDescriptions_loc = loc.dot(Field::pVertexAttributeDescriptions);
         for (uint32_t vertexAttributeDescriptionIndex = 0; vertexAttributeDescriptionIndex < info.vertexAttributeDescriptionCount;
              ++vertexAttributeDescriptionIndex) {
-            [[maybe_unused]] const Location pVertexAttributeDescriptions_loc =
-                loc.dot(Field::pVertexAttributeDescriptions, vertexAttributeDescriptionIndex);
+            pVertexAttributeDescriptions_loc.index = vertexAttributeDescriptionIndex;
             skip |= ValidateRangedEnum(pVertexAttributeDescriptions_loc.dot(Field::format), vvl::Enum::VkFormat,
                                        info.pVertexAttributeDescriptions[vertexAttributeDescriptionIndex].format,
                                        "VUID-VkVertexInputAttributeDescription-format-parameter");
@@ -29446,8 +28910,9 @@ bool StatelessValidation::ValidatePipelineColorBlendStateCreateInfo(const VkPipe
     skip |= ValidateBool32(loc.dot(Field::logicOpEnable), info.logicOpEnable);
 
     if (info.pAttachments != nullptr) {
+        [[maybe_unused]] Location pAttachments_loc = loc.dot(Field::pAttachments);
         for (uint32_t attachmentIndex = 0; attachmentIndex < info.attachmentCount; ++attachmentIndex) {
-            [[maybe_unused]] const Location pAttachments_loc = loc.dot(Field::pAttachments, attachmentIndex);
+            pAttachments_loc.index = attachmentIndex;
             skip |= ValidateBool32(pAttachments_loc.dot(Field::blendEnable), info.pAttachments[attachmentIndex].blendEnable);
 
             skip |= ValidateRangedEnum(pAttachments_loc.dot(Field::srcColorBlendFactor), vvl::Enum::VkBlendFactor,
@@ -2737,7 +2737,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL QueueBindSparse(VkQueue queue, uint32_t bi
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateFence(VkDevice device, const VkFenceCreateInfo* pCreateInfo,
                                                   const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
-    unique_lock_t lock(global_lock);
     *pFence = (VkFence)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -2757,7 +2756,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL WaitForFences(VkDevice device, uint32_t fe
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo,
                                                       const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore) {
-    unique_lock_t lock(global_lock);
     *pSemaphore = (VkSemaphore)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -2767,7 +2765,6 @@ static VKAPI_ATTR void VKAPI_CALL DestroySemaphore(VkDevice device, VkSemaphore
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateEvent(VkDevice device, const VkEventCreateInfo* pCreateInfo,
                                                   const VkAllocationCallbacks* pAllocator, VkEvent* pEvent) {
-    unique_lock_t lock(global_lock);
     *pEvent = (VkEvent)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -2782,7 +2779,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL ResetEvent(VkDevice device, VkEvent event)
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo,
                                                       const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool) {
-    unique_lock_t lock(global_lock);
     *pQueryPool = (VkQueryPool)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -2798,7 +2794,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(VkDevice device, VkQue
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateBufferView(VkDevice device, const VkBufferViewCreateInfo* pCreateInfo,
                                                        const VkAllocationCallbacks* pAllocator, VkBufferView* pView) {
-    unique_lock_t lock(global_lock);
     *pView = (VkBufferView)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -2808,7 +2803,6 @@ static VKAPI_ATTR void VKAPI_CALL DestroyBufferView(VkDevice device, VkBufferVie
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateImageView(VkDevice device, const VkImageViewCreateInfo* pCreateInfo,
                                                       const VkAllocationCallbacks* pAllocator, VkImageView* pView) {
-    unique_lock_t lock(global_lock);
     *pView = (VkImageView)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -2818,7 +2812,6 @@ static VKAPI_ATTR void VKAPI_CALL DestroyImageView(VkDevice device, VkImageView
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                                          const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule) {
-    unique_lock_t lock(global_lock);
     *pShaderModule = (VkShaderModule)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -2829,7 +2822,6 @@ static VKAPI_ATTR void VKAPI_CALL DestroyShaderModule(VkDevice device, VkShaderM
 static VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo,
                                                           const VkAllocationCallbacks* pAllocator,
                                                           VkPipelineCache* pPipelineCache) {
-    unique_lock_t lock(global_lock);
     *pPipelineCache = (VkPipelineCache)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -2851,7 +2843,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, V
                                                               uint32_t createInfoCount,
                                                               const VkGraphicsPipelineCreateInfo* pCreateInfos,
                                                               const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
-    unique_lock_t lock(global_lock);
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         pPipelines[i] = (VkPipeline)global_unique_handle++;
     }
@@ -2862,7 +2853,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(VkDevice device, Vk
                                                              uint32_t createInfoCount,
                                                              const VkComputePipelineCreateInfo* pCreateInfos,
                                                              const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
-    unique_lock_t lock(global_lock);
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         pPipelines[i] = (VkPipeline)global_unique_handle++;
     }
@@ -2874,7 +2864,6 @@ static VKAPI_ATTR void VKAPI_CALL DestroyPipeline(VkDevice device, VkPipeline pi
 static VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo,
                                                            const VkAllocationCallbacks* pAllocator,
                                                            VkPipelineLayout* pPipelineLayout) {
-    unique_lock_t lock(global_lock);
     *pPipelineLayout = (VkPipelineLayout)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -2884,7 +2873,6 @@ static VKAPI_ATTR void VKAPI_CALL DestroyPipelineLayout(VkDevice device, VkPipel
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateSampler(VkDevice device, const VkSamplerCreateInfo* pCreateInfo,
                                                     const VkAllocationCallbacks* pAllocator, VkSampler* pSampler) {
-    unique_lock_t lock(global_lock);
     *pSampler = (VkSampler)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -2894,7 +2882,6 @@ static VKAPI_ATTR void VKAPI_CALL DestroySampler(VkDevice device, VkSampler samp
 static VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo,
                                                                 const VkAllocationCallbacks* pAllocator,
                                                                 VkDescriptorSetLayout* pSetLayout) {
-    unique_lock_t lock(global_lock);
     *pSetLayout = (VkDescriptorSetLayout)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -2905,7 +2892,6 @@ static VKAPI_ATTR void VKAPI_CALL DestroyDescriptorSetLayout(VkDevice device, Vk
 static VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo,
                                                            const VkAllocationCallbacks* pAllocator,
                                                            VkDescriptorPool* pDescriptorPool) {
-    unique_lock_t lock(global_lock);
     *pDescriptorPool = (VkDescriptorPool)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -2920,7 +2906,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL ResetDescriptorPool(VkDevice device, VkDes
 
 static VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo,
                                                              VkDescriptorSet* pDescriptorSets) {
-    unique_lock_t lock(global_lock);
     for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; ++i) {
         pDescriptorSets[i] = (VkDescriptorSet)global_unique_handle++;
     }
@@ -2938,7 +2923,6 @@ static VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSets(VkDevice device, uint32_t
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo* pCreateInfo,
                                                         const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer) {
-    unique_lock_t lock(global_lock);
     *pFramebuffer = (VkFramebuffer)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -2948,7 +2932,6 @@ static VKAPI_ATTR void VKAPI_CALL DestroyFramebuffer(VkDevice device, VkFramebuf
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo,
                                                        const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
-    unique_lock_t lock(global_lock);
     *pRenderPass = (VkRenderPass)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -3142,7 +3125,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversion(VkDevice devi
                                                                    const VkSamplerYcbcrConversionCreateInfo* pCreateInfo,
                                                                    const VkAllocationCallbacks* pAllocator,
                                                                    VkSamplerYcbcrConversion* pYcbcrConversion) {
-    unique_lock_t lock(global_lock);
     *pYcbcrConversion = (VkSamplerYcbcrConversion)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -3154,7 +3136,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplate(VkDevice de
                                                                      const VkDescriptorUpdateTemplateCreateInfo* pCreateInfo,
                                                                      const VkAllocationCallbacks* pAllocator,
                                                                      VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate) {
-    unique_lock_t lock(global_lock);
     *pDescriptorUpdateTemplate = (VkDescriptorUpdateTemplate)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -3177,7 +3158,6 @@ static VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCount(VkCommandBuffer co
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2(VkDevice device, const VkRenderPassCreateInfo2* pCreateInfo,
                                                         const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
-    unique_lock_t lock(global_lock);
     *pRenderPass = (VkRenderPass)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -3222,7 +3202,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolProperties(VkPhysical
 static VKAPI_ATTR VkResult VKAPI_CALL CreatePrivateDataSlot(VkDevice device, const VkPrivateDataSlotCreateInfo* pCreateInfo,
                                                             const VkAllocationCallbacks* pAllocator,
                                                             VkPrivateDataSlot* pPrivateDataSlot) {
-    unique_lock_t lock(global_lock);
     *pPrivateDataSlot = (VkPrivateDataSlot)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -3353,7 +3332,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL GetDisplayModePropertiesKHR(VkPhysicalDevi
 static VKAPI_ATTR VkResult VKAPI_CALL CreateDisplayModeKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display,
                                                            const VkDisplayModeCreateInfoKHR* pCreateInfo,
                                                            const VkAllocationCallbacks* pAllocator, VkDisplayModeKHR* pMode) {
-    unique_lock_t lock(global_lock);
     *pMode = (VkDisplayModeKHR)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -3368,7 +3346,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateDisplayPlaneSurfaceKHR(VkInstance in
                                                                    const VkDisplaySurfaceCreateInfoKHR* pCreateInfo,
                                                                    const VkAllocationCallbacks* pAllocator,
                                                                    VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -3377,7 +3354,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateSharedSwapchainsKHR(VkDevice device,
                                                                 const VkSwapchainCreateInfoKHR* pCreateInfos,
                                                                 const VkAllocationCallbacks* pAllocator,
                                                                 VkSwapchainKHR* pSwapchains) {
-    unique_lock_t lock(global_lock);
     for (uint32_t i = 0; i < swapchainCount; ++i) {
         pSwapchains[i] = (VkSwapchainKHR)global_unique_handle++;
     }
@@ -3387,7 +3363,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateSharedSwapchainsKHR(VkDevice device,
 #ifdef VK_USE_PLATFORM_XLIB_KHR
 static VKAPI_ATTR VkResult VKAPI_CALL CreateXlibSurfaceKHR(VkInstance instance, const VkXlibSurfaceCreateInfoKHR* pCreateInfo,
                                                            const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -3402,7 +3377,6 @@ static VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceXlibPresentationSupportKH
 #ifdef VK_USE_PLATFORM_XCB_KHR
 static VKAPI_ATTR VkResult VKAPI_CALL CreateXcbSurfaceKHR(VkInstance instance, const VkXcbSurfaceCreateInfoKHR* pCreateInfo,
                                                           const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -3418,7 +3392,6 @@ static VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceXcbPresentationSupportKHR
 #ifdef VK_USE_PLATFORM_WAYLAND_KHR
 static VKAPI_ATTR VkResult VKAPI_CALL CreateWaylandSurfaceKHR(VkInstance instance, const VkWaylandSurfaceCreateInfoKHR* pCreateInfo,
                                                               const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -3433,7 +3406,6 @@ static VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceWaylandPresentationSuppor
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
 static VKAPI_ATTR VkResult VKAPI_CALL CreateAndroidSurfaceKHR(VkInstance instance, const VkAndroidSurfaceCreateInfoKHR* pCreateInfo,
                                                               const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -3442,7 +3414,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateAndroidSurfaceKHR(VkInstance instanc
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 static VKAPI_ATTR VkResult VKAPI_CALL CreateWin32SurfaceKHR(VkInstance instance, const VkWin32SurfaceCreateInfoKHR* pCreateInfo,
                                                             const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -3456,7 +3427,6 @@ static VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceWin32PresentationSupportK
 static VKAPI_ATTR VkResult VKAPI_CALL CreateVideoSessionKHR(VkDevice device, const VkVideoSessionCreateInfoKHR* pCreateInfo,
                                                             const VkAllocationCallbacks* pAllocator,
                                                             VkVideoSessionKHR* pVideoSession) {
-    unique_lock_t lock(global_lock);
     *pVideoSession = (VkVideoSessionKHR)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -3474,7 +3444,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateVideoSessionParametersKHR(VkDevice d
                                                                       const VkVideoSessionParametersCreateInfoKHR* pCreateInfo,
                                                                       const VkAllocationCallbacks* pAllocator,
                                                                       VkVideoSessionParametersKHR* pVideoSessionParameters) {
-    unique_lock_t lock(global_lock);
     *pVideoSessionParameters = (VkVideoSessionParametersKHR)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -3811,7 +3780,6 @@ static VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddressKHR(VkD
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateDeferredOperationKHR(VkDevice device, const VkAllocationCallbacks* pAllocator,
                                                                  VkDeferredOperationKHR* pDeferredOperation) {
-    unique_lock_t lock(global_lock);
     *pDeferredOperation = (VkDeferredOperationKHR)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -3988,7 +3956,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateDebugReportCallbackEXT(VkInstance in
                                                                    const VkDebugReportCallbackCreateInfoEXT* pCreateInfo,
                                                                    const VkAllocationCallbacks* pAllocator,
                                                                    VkDebugReportCallbackEXT* pCallback) {
-    unique_lock_t lock(global_lock);
     *pCallback = (VkDebugReportCallbackEXT)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -4042,14 +4009,12 @@ static VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectByteCountEXT(VkCommandBuffer co
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateCuModuleNVX(VkDevice device, const VkCuModuleCreateInfoNVX* pCreateInfo,
                                                         const VkAllocationCallbacks* pAllocator, VkCuModuleNVX* pModule) {
-    unique_lock_t lock(global_lock);
     *pModule = (VkCuModuleNVX)global_unique_handle++;
     return VK_SUCCESS;
 }
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateCuFunctionNVX(VkDevice device, const VkCuFunctionCreateInfoNVX* pCreateInfo,
                                                           const VkAllocationCallbacks* pAllocator, VkCuFunctionNVX* pFunction) {
-    unique_lock_t lock(global_lock);
     *pFunction = (VkCuFunctionNVX)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -4094,7 +4059,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateStreamDescriptorSurfaceGGP(VkInstanc
                                                                        const VkStreamDescriptorSurfaceCreateInfoGGP* pCreateInfo,
                                                                        const VkAllocationCallbacks* pAllocator,
                                                                        VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -4117,7 +4081,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandleNV(VkDevice device, Vk
 #ifdef VK_USE_PLATFORM_VI_NN
 static VKAPI_ATTR VkResult VKAPI_CALL CreateViSurfaceNN(VkInstance instance, const VkViSurfaceCreateInfoNN* pCreateInfo,
                                                         const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -4193,7 +4156,6 @@ static VKAPI_ATTR void VKAPI_CALL SetHdrMetadataEXT(VkDevice device, uint32_t sw
 #ifdef VK_USE_PLATFORM_IOS_MVK
 static VKAPI_ATTR VkResult VKAPI_CALL CreateIOSSurfaceMVK(VkInstance instance, const VkIOSSurfaceCreateInfoMVK* pCreateInfo,
                                                           const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -4202,7 +4164,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateIOSSurfaceMVK(VkInstance instance, c
 #ifdef VK_USE_PLATFORM_MACOS_MVK
 static VKAPI_ATTR VkResult VKAPI_CALL CreateMacOSSurfaceMVK(VkInstance instance, const VkMacOSSurfaceCreateInfoMVK* pCreateInfo,
                                                             const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -4234,7 +4195,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateDebugUtilsMessengerEXT(VkInstance in
                                                                    const VkDebugUtilsMessengerCreateInfoEXT* pCreateInfo,
                                                                    const VkAllocationCallbacks* pAllocator,
                                                                    VkDebugUtilsMessengerEXT* pMessenger) {
-    unique_lock_t lock(global_lock);
     *pMessenger = (VkDebugUtilsMessengerEXT)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -4260,7 +4220,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateExecutionGraphPipelinesAMDX(VkDevice
                                                                         const VkExecutionGraphPipelineCreateInfoAMDX* pCreateInfos,
                                                                         const VkAllocationCallbacks* pAllocator,
                                                                         VkPipeline* pPipelines) {
-    unique_lock_t lock(global_lock);
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         pPipelines[i] = (VkPipeline)global_unique_handle++;
     }
@@ -4300,7 +4259,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL GetImageDrmFormatModifierPropertiesEXT(VkD
 static VKAPI_ATTR VkResult VKAPI_CALL CreateValidationCacheEXT(VkDevice device, const VkValidationCacheCreateInfoEXT* pCreateInfo,
                                                                const VkAllocationCallbacks* pAllocator,
                                                                VkValidationCacheEXT* pValidationCache) {
-    unique_lock_t lock(global_lock);
     *pValidationCache = (VkValidationCacheEXT)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -4334,7 +4292,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureNV(VkDevice dev
                                                                     const VkAccelerationStructureCreateInfoNV* pCreateInfo,
                                                                     const VkAllocationCallbacks* pAllocator,
                                                                     VkAccelerationStructureNV* pAccelerationStructure) {
-    unique_lock_t lock(global_lock);
     *pAccelerationStructure = (VkAccelerationStructureNV)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -4369,7 +4326,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(VkDevice devic
                                                                   uint32_t createInfoCount,
                                                                   const VkRayTracingPipelineCreateInfoNV* pCreateInfos,
                                                                   const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
-    unique_lock_t lock(global_lock);
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         pPipelines[i] = (VkPipeline)global_unique_handle++;
     }
@@ -4487,7 +4443,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateImagePipeSurfaceFUCHSIA(VkInstance i
                                                                     const VkImagePipeSurfaceCreateInfoFUCHSIA* pCreateInfo,
                                                                     const VkAllocationCallbacks* pAllocator,
                                                                     VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -4496,7 +4451,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateImagePipeSurfaceFUCHSIA(VkInstance i
 #ifdef VK_USE_PLATFORM_METAL_EXT
 static VKAPI_ATTR VkResult VKAPI_CALL CreateMetalSurfaceEXT(VkInstance instance, const VkMetalSurfaceCreateInfoEXT* pCreateInfo,
                                                             const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -4548,7 +4502,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupSurfacePresentModes2EXT(VkDe
 static VKAPI_ATTR VkResult VKAPI_CALL CreateHeadlessSurfaceEXT(VkInstance instance,
                                                                const VkHeadlessSurfaceCreateInfoEXT* pCreateInfo,
                                                                const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -4664,7 +4617,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateIndirectCommandsLayoutNV(VkDevice de
                                                                      const VkIndirectCommandsLayoutCreateInfoNV* pCreateInfo,
                                                                      const VkAllocationCallbacks* pAllocator,
                                                                      VkIndirectCommandsLayoutNV* pIndirectCommandsLayout) {
-    unique_lock_t lock(global_lock);
     *pIndirectCommandsLayout = (VkIndirectCommandsLayoutNV)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -4707,7 +4659,6 @@ static VKAPI_ATTR void VKAPI_CALL GetPrivateDataEXT(VkDevice device, VkObjectTyp
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateCudaModuleNV(VkDevice device, const VkCudaModuleCreateInfoNV* pCreateInfo,
                                                          const VkAllocationCallbacks* pAllocator, VkCudaModuleNV* pModule) {
-    unique_lock_t lock(global_lock);
     *pModule = (VkCudaModuleNV)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -4719,7 +4670,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL GetCudaModuleCacheNV(VkDevice device, VkCu
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateCudaFunctionNV(VkDevice device, const VkCudaFunctionCreateInfoNV* pCreateInfo,
                                                            const VkAllocationCallbacks* pAllocator, VkCudaFunctionNV* pFunction) {
-    unique_lock_t lock(global_lock);
     *pFunction = (VkCudaFunctionNV)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -4806,7 +4756,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL GetWinrtDisplayNV(VkPhysicalDevice physica
 static VKAPI_ATTR VkResult VKAPI_CALL CreateDirectFBSurfaceEXT(VkInstance instance,
                                                                const VkDirectFBSurfaceCreateInfoEXT* pCreateInfo,
                                                                const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -4849,7 +4798,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateBufferCollectionFUCHSIA(VkDevice dev
                                                                     const VkBufferCollectionCreateInfoFUCHSIA* pCreateInfo,
                                                                     const VkAllocationCallbacks* pAllocator,
                                                                     VkBufferCollectionFUCHSIA* pCollection) {
-    unique_lock_t lock(global_lock);
     *pCollection = (VkBufferCollectionFUCHSIA)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -4914,7 +4862,6 @@ static VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveRestartEnableEXT(VkCommandBuffe
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
 static VKAPI_ATTR VkResult VKAPI_CALL CreateScreenSurfaceQNX(VkInstance instance, const VkScreenSurfaceCreateInfoQNX* pCreateInfo,
                                                              const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
-    unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -4939,7 +4886,6 @@ static VKAPI_ATTR void VKAPI_CALL CmdDrawMultiIndexedEXT(VkCommandBuffer command
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateMicromapEXT(VkDevice device, const VkMicromapCreateInfoEXT* pCreateInfo,
                                                         const VkAllocationCallbacks* pAllocator, VkMicromapEXT* pMicromap) {
-    unique_lock_t lock(global_lock);
     *pMicromap = (VkMicromapEXT)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -5135,7 +5081,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateOpticalFlowSessionNV(VkDevice device
                                                                  const VkOpticalFlowSessionCreateInfoNV* pCreateInfo,
                                                                  const VkAllocationCallbacks* pAllocator,
                                                                  VkOpticalFlowSessionNV* pSession) {
-    unique_lock_t lock(global_lock);
     *pSession = (VkOpticalFlowSessionNV)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -5155,7 +5100,6 @@ static VKAPI_ATTR void VKAPI_CALL CmdOpticalFlowExecuteNV(VkCommandBuffer comman
 static VKAPI_ATTR VkResult VKAPI_CALL CreateShadersEXT(VkDevice device, uint32_t createInfoCount,
                                                        const VkShaderCreateInfoEXT* pCreateInfos,
                                                        const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders) {
-    unique_lock_t lock(global_lock);
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         pShaders[i] = (VkShaderEXT)global_unique_handle++;
     }
@@ -5214,7 +5158,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureKHR(VkDevice de
                                                                      const VkAccelerationStructureCreateInfoKHR* pCreateInfo,
                                                                      const VkAllocationCallbacks* pAllocator,
                                                                      VkAccelerationStructureKHR* pAccelerationStructure) {
-    unique_lock_t lock(global_lock);
     *pAccelerationStructure = (VkAccelerationStructureKHR)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -5290,7 +5233,6 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(VkDevice devi
                                                                    const VkRayTracingPipelineCreateInfoKHR* pCreateInfos,
                                                                    const VkAllocationCallbacks* pAllocator,
                                                                    VkPipeline* pPipelines) {
-    unique_lock_t lock(global_lock);
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         pPipelines[i] = (VkPipeline)global_unique_handle++;
     }
@@ -363,23 +363,13 @@ void ThreadSafety::PostCallRecordGetFenceStatus(VkDevice device, VkFence fence,
 void ThreadSafety::PreCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll,
                                               uint64_t timeout, const RecordObject& record_obj) {
     StartReadObjectParentInstance(device, record_obj.location);
-
-    if (pFences) {
-        for (uint32_t index = 0; index < fenceCount; index++) {
-            StartReadObject(pFences[index], record_obj.location);
-        }
-    }
+    StartReadObjects(pFences, fenceCount, record_obj.location);
 }
 
 void ThreadSafety::PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll,
                                                uint64_t timeout, const RecordObject& record_obj) {
     FinishReadObjectParentInstance(device, record_obj.location);
-
-    if (pFences) {
-        for (uint32_t index = 0; index < fenceCount; index++) {
-            FinishReadObject(pFences[index], record_obj.location);
-        }
-    }
+    FinishReadObjects(pFences, fenceCount, record_obj.location);
 }
 
 void ThreadSafety::PreCallRecordCreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo,
@@ -728,12 +718,7 @@ void ThreadSafety::PreCallRecordMergePipelineCaches(VkDevice device, VkPipelineC
                                                     const VkPipelineCache* pSrcCaches, const RecordObject& record_obj) {
     StartReadObjectParentInstance(device, record_obj.location);
     StartWriteObject(dstCache, record_obj.location);
-
-    if (pSrcCaches) {
-        for (uint32_t index = 0; index < srcCacheCount; index++) {
-            StartReadObject(pSrcCaches[index], record_obj.location);
-        }
-    }
+    StartReadObjects(pSrcCaches, srcCacheCount, record_obj.location);
     // Host access to dstCache must be externally synchronized
 }
 
@@ -741,12 +726,7 @@ void ThreadSafety::PostCallRecordMergePipelineCaches(VkDevice device, VkPipeline
                                                      const VkPipelineCache* pSrcCaches, const RecordObject& record_obj) {
     FinishReadObjectParentInstance(device, record_obj.location);
     FinishWriteObject(dstCache, record_obj.location);
-
-    if (pSrcCaches) {
-        for (uint32_t index = 0; index < srcCacheCount; index++) {
-            FinishReadObject(pSrcCaches[index], record_obj.location);
-        }
-    }
+    FinishReadObjects(pSrcCaches, srcCacheCount, record_obj.location);
     // Host access to dstCache must be externally synchronized
 }
 
@@ -1139,12 +1119,7 @@ void ThreadSafety::PreCallRecordCmdBindDescriptorSets(VkCommandBuffer commandBuf
                                                       const uint32_t* pDynamicOffsets, const RecordObject& record_obj) {
     StartWriteObject(commandBuffer, record_obj.location);
     StartReadObject(layout, record_obj.location);
-
-    if (pDescriptorSets) {
-        for (uint32_t index = 0; index < descriptorSetCount; index++) {
-            StartReadObject(pDescriptorSets[index], record_obj.location);
-        }
-    }
+    StartReadObjects(pDescriptorSets, descriptorSetCount, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
 
@@ -1154,12 +1129,7 @@ void ThreadSafety::PostCallRecordCmdBindDescriptorSets(VkCommandBuffer commandBu
                                                        const uint32_t* pDynamicOffsets, const RecordObject& record_obj) {
     FinishWriteObject(commandBuffer, record_obj.location);
     FinishReadObject(layout, record_obj.location);
-
-    if (pDescriptorSets) {
-        for (uint32_t index = 0; index < descriptorSetCount; index++) {
-            FinishReadObject(pDescriptorSets[index], record_obj.location);
-        }
-    }
+    FinishReadObjects(pDescriptorSets, descriptorSetCount, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
 
@@ -1181,12 +1151,7 @@ void ThreadSafety::PreCallRecordCmdBindVertexBuffers(VkCommandBuffer commandBuff
                                                      const VkBuffer* pBuffers, const VkDeviceSize* pOffsets,
                                                      const RecordObject& record_obj) {
     StartWriteObject(commandBuffer, record_obj.location);
-
-    if (pBuffers) {
-        for (uint32_t index = 0; index < bindingCount; index++) {
-            StartReadObject(pBuffers[index], record_obj.location);
-        }
-    }
+    StartReadObjects(pBuffers, bindingCount, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
 
@@ -1194,12 +1159,7 @@ void ThreadSafety::PostCallRecordCmdBindVertexBuffers(VkCommandBuffer commandBuf
                                                       const VkBuffer* pBuffers, const VkDeviceSize* pOffsets,
                                                       const RecordObject& record_obj) {
     FinishWriteObject(commandBuffer, record_obj.location);
-
-    if (pBuffers) {
-        for (uint32_t index = 0; index < bindingCount; index++) {
-            FinishReadObject(pBuffers[index], record_obj.location);
-        }
-    }
+    FinishReadObjects(pBuffers, bindingCount, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
 
@@ -1498,12 +1458,7 @@ void ThreadSafety::PreCallRecordCmdWaitEvents(VkCommandBuffer commandBuffer, uin
                                               uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers,
                                               const RecordObject& record_obj) {
     StartWriteObject(commandBuffer, record_obj.location);
-
-    if (pEvents) {
-        for (uint32_t index = 0; index < eventCount; index++) {
-            StartReadObject(pEvents[index], record_obj.location);
-        }
-    }
+    StartReadObjects(pEvents, eventCount, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
 
@@ -1514,12 +1469,7 @@ void ThreadSafety::PostCallRecordCmdWaitEvents(VkCommandBuffer commandBuffer, ui
                                                const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount,
                                                const VkImageMemoryBarrier* pImageMemoryBarriers, const RecordObject& record_obj) {
     FinishWriteObject(commandBuffer, record_obj.location);
-
-    if (pEvents) {
-        for (uint32_t index = 0; index < eventCount; index++) {
-            FinishReadObject(pEvents[index], record_obj.location);
-        }
-    }
+    FinishReadObjects(pEvents, eventCount, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
 
@@ -1670,24 +1620,14 @@ void ThreadSafety::PostCallRecordCmdEndRenderPass(VkCommandBuffer commandBuffer,
 void ThreadSafety::PreCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
                                                    const VkCommandBuffer* pCommandBuffers, const RecordObject& record_obj) {
     StartWriteObject(commandBuffer, record_obj.location);
-
-    if (pCommandBuffers) {
-        for (uint32_t index = 0; index < commandBufferCount; index++) {
-            StartReadObject(pCommandBuffers[index], record_obj.location);
-        }
-    }
+    StartReadObjects(pCommandBuffers, commandBufferCount, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
 
 void ThreadSafety::PostCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
                                                     const VkCommandBuffer* pCommandBuffers, const RecordObject& record_obj) {
     FinishWriteObject(commandBuffer, record_obj.location);
-
-    if (pCommandBuffers) {
-        for (uint32_t index = 0; index < commandBufferCount; index++) {
-            FinishReadObject(pCommandBuffers[index], record_obj.location);
-        }
-    }
+    FinishReadObjects(pCommandBuffers, commandBufferCount, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
 
@@ -2153,24 +2093,14 @@ void ThreadSafety::PostCallRecordCmdResetEvent2(VkCommandBuffer commandBuffer, V
 void ThreadSafety::PreCallRecordCmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents,
                                                const VkDependencyInfo* pDependencyInfos, const RecordObject& record_obj) {
     StartWriteObject(commandBuffer, record_obj.location);
-
-    if (pEvents) {
-        for (uint32_t index = 0; index < eventCount; index++) {
-            StartReadObject(pEvents[index], record_obj.location);
-        }
-    }
+    StartReadObjects(pEvents, eventCount, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
 
 void ThreadSafety::PostCallRecordCmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents,
                                                 const VkDependencyInfo* pDependencyInfos, const RecordObject& record_obj) {
     FinishWriteObject(commandBuffer, record_obj.location);
-
-    if (pEvents) {
-        for (uint32_t index = 0; index < eventCount; index++) {
-            FinishReadObject(pEvents[index], record_obj.location);
-        }
-    }
+    FinishReadObjects(pEvents, eventCount, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
 
@@ -2379,12 +2309,7 @@ void ThreadSafety::PreCallRecordCmdBindVertexBuffers2(VkCommandBuffer commandBuf
                                                       const VkDeviceSize* pSizes, const VkDeviceSize* pStrides,
                                                       const RecordObject& record_obj) {
     StartWriteObject(commandBuffer, record_obj.location);
-
-    if (pBuffers) {
-        for (uint32_t index = 0; index < bindingCount; index++) {
-            StartReadObject(pBuffers[index], record_obj.location);
-        }
-    }
+    StartReadObjects(pBuffers, bindingCount, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
 
@@ -2393,12 +2318,7 @@ void ThreadSafety::PostCallRecordCmdBindVertexBuffers2(VkCommandBuffer commandBu
                                                        const VkDeviceSize* pSizes, const VkDeviceSize* pStrides,
                                                        const RecordObject& record_obj) {
     FinishWriteObject(commandBuffer, record_obj.location);
-
-    if (pBuffers) {
-        for (uint32_t index = 0; index < bindingCount; index++) {
-            FinishReadObject(pBuffers[index], record_obj.location);
-        }
-    }
+    FinishReadObjects(pBuffers, bindingCount, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
 
@@ -2773,12 +2693,7 @@ void ThreadSafety::PreCallRecordCreateSharedSwapchainsKHR(VkDevice device, uint3
             StartWriteObject(pCreateInfos[index].oldSwapchain, record_obj.location);
         }
     }
-
-    if (pSwapchains) {
-        for (uint32_t index = 0; index < swapchainCount; index++) {
-            StartReadObject(pSwapchains[index], record_obj.location);
-        }
-    }
+    StartReadObjects(pSwapchains, swapchainCount, record_obj.location);
     // Host access to pCreateInfos[].surface,pCreateInfos[].oldSwapchain must be externally synchronized
 }
 
@@ -4218,12 +4133,7 @@ void ThreadSafety::PreCallRecordCmdBindTransformFeedbackBuffersEXT(VkCommandBuff
                                                                    const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes,
                                                                    const RecordObject& record_obj) {
     StartWriteObject(commandBuffer, record_obj.location);
-
-    if (pBuffers) {
-        for (uint32_t index = 0; index < bindingCount; index++) {
-            StartReadObject(pBuffers[index], record_obj.location);
-        }
-    }
+    StartReadObjects(pBuffers, bindingCount, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
 
@@ -4232,12 +4142,7 @@ void ThreadSafety::PostCallRecordCmdBindTransformFeedbackBuffersEXT(VkCommandBuf
                                                                     const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes,
                                                                     const RecordObject& record_obj) {
     FinishWriteObject(commandBuffer, record_obj.location);
-
-    if (pBuffers) {
-        for (uint32_t index = 0; index < bindingCount; index++) {
-            FinishReadObject(pBuffers[index], record_obj.location);
-        }
-    }
+    FinishReadObjects(pBuffers, bindingCount, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
 
@@ -4246,12 +4151,7 @@ void ThreadSafety::PreCallRecordCmdBeginTransformFeedbackEXT(VkCommandBuffer com
                                                              const VkDeviceSize* pCounterBufferOffsets,
                                                              const RecordObject& record_obj) {
     StartWriteObject(commandBuffer, record_obj.location);
-
-    if (pCounterBuffers) {
-        for (uint32_t index = 0; index < counterBufferCount; index++) {
-            StartReadObject(pCounterBuffers[index], record_obj.location);
-        }
-    }
+    StartReadObjects(pCounterBuffers, counterBufferCount, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
 
@@ -4260,12 +4160,7 @@ void ThreadSafety::PostCallRecordCmdBeginTransformFeedbackEXT(VkCommandBuffer co
                                                               const VkDeviceSize* pCounterBufferOffsets,
                                                               const RecordObject& record_obj) {
     FinishWriteObject(commandBuffer, record_obj.location);
-
-    if (pCounterBuffers) {
-        for (uint32_t index = 0; index < counterBufferCount; index++) {
-            FinishReadObject(pCounterBuffers[index], record_obj.location);
-        }
-    }
+    FinishReadObjects(pCounterBuffers, counterBufferCount, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
 
@@ -4274,12 +4169,7 @@ void ThreadSafety::PreCallRecordCmdEndTransformFeedbackEXT(VkCommandBuffer comma
                                                            const VkDeviceSize* pCounterBufferOffsets,
                                                            const RecordObject& record_obj) {
     StartWriteObject(commandBuffer, record_obj.location);
-
-    if (pCounterBuffers) {
-        for (uint32_t index = 0; index < counterBufferCount; index++) {
-            StartReadObject(pCounterBuffers[index], record_obj.location);
-        }
-    }
+    StartReadObjects(pCounterBuffers, counterBufferCount, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
 
@@ -4288,12 +4178,7 @@ void ThreadSafety::PostCallRecordCmdEndTransformFeedbackEXT(VkCommandBuffer comm
                                                             const VkDeviceSize* pCounterBufferOffsets,
                                                             const RecordObject& record_obj) {
     FinishWriteObject(commandBuffer, record_obj.location);
-
-    if (pCounterBuffers) {
-        for (uint32_t index = 0; index < counterBufferCount; index++) {
-            FinishReadObject(pCounterBuffers[index], record_obj.location);
-        }
-    }
+    FinishReadObjects(pCounterBuffers, counterBufferCount, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
 
@@ -4717,23 +4602,13 @@ void ThreadSafety::PostCallRecordCmdSetDiscardRectangleModeEXT(VkCommandBuffer c
 void ThreadSafety::PreCallRecordSetHdrMetadataEXT(VkDevice device, uint32_t swapchainCount, const VkSwapchainKHR* pSwapchains,
                                                   const VkHdrMetadataEXT* pMetadata, const RecordObject& record_obj) {
     StartReadObjectParentInstance(device, record_obj.location);
-
-    if (pSwapchains) {
-        for (uint32_t index = 0; index < swapchainCount; index++) {
-            StartReadObject(pSwapchains[index], record_obj.location);
-        }
-    }
+    StartReadObjects(pSwapchains, swapchainCount, record_obj.location);
 }
 
 void ThreadSafety::PostCallRecordSetHdrMetadataEXT(VkDevice device, uint32_t swapchainCount, const VkSwapchainKHR* pSwapchains,
                                                    const VkHdrMetadataEXT* pMetadata, const RecordObject& record_obj) {
     FinishReadObjectParentInstance(device, record_obj.location);
-
-    if (pSwapchains) {
-        for (uint32_t index = 0; index < swapchainCount; index++) {
-            FinishReadObject(pSwapchains[index], record_obj.location);
-        }
-    }
+    FinishReadObjects(pSwapchains, swapchainCount, record_obj.location);
 }
 
 #ifdef VK_USE_PLATFORM_IOS_MVK
@@ -5072,12 +4947,7 @@ void ThreadSafety::PreCallRecordMergeValidationCachesEXT(VkDevice device, VkVali
                                                          const VkValidationCacheEXT* pSrcCaches, const RecordObject& record_obj) {
     StartReadObjectParentInstance(device, record_obj.location);
     StartWriteObject(dstCache, record_obj.location);
-
-    if (pSrcCaches) {
-        for (uint32_t index = 0; index < srcCacheCount; index++) {
-            StartReadObject(pSrcCaches[index], record_obj.location);
-        }
-    }
+    StartReadObjects(pSrcCaches, srcCacheCount, record_obj.location);
     // Host access to dstCache must be externally synchronized
 }
 
@@ -5085,12 +4955,7 @@ void ThreadSafety::PostCallRecordMergeValidationCachesEXT(VkDevice device, VkVal
                                                           const VkValidationCacheEXT* pSrcCaches, const RecordObject& record_obj) {
     FinishReadObjectParentInstance(device, record_obj.location);
     FinishWriteObject(dstCache, record_obj.location);
-
-    if (pSrcCaches) {
-        for (uint32_t index = 0; index < srcCacheCount; index++) {
-            FinishReadObject(pSrcCaches[index], record_obj.location);
-        }
-    }
+    FinishReadObjects(pSrcCaches, srcCacheCount, record_obj.location);
     // Host access to dstCache must be externally synchronized
 }
 
@@ -5358,12 +5223,7 @@ void ThreadSafety::PreCallRecordCmdWriteAccelerationStructuresPropertiesNV(VkCom
                                                                            VkQueryType queryType, VkQueryPool queryPool,
                                                                            uint32_t firstQuery, const RecordObject& record_obj) {
     StartWriteObject(commandBuffer, record_obj.location);
-
-    if (pAccelerationStructures) {
-        for (uint32_t index = 0; index < accelerationStructureCount; index++) {
-            StartReadObject(pAccelerationStructures[index], record_obj.location);
-        }
-    }
+    StartReadObjects(pAccelerationStructures, accelerationStructureCount, record_obj.location);
     StartReadObject(queryPool, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
@@ -5372,12 +5232,7 @@ void ThreadSafety::PostCallRecordCmdWriteAccelerationStructuresPropertiesNV(
     VkCommandBuffer commandBuffer, uint32_t accelerationStructureCount, const VkAccelerationStructureNV* pAccelerationStructures,
     VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery, const RecordObject& record_obj) {
     FinishWriteObject(commandBuffer, record_obj.location);
-
-    if (pAccelerationStructures) {
-        for (uint32_t index = 0; index < accelerationStructureCount; index++) {
-            FinishReadObject(pAccelerationStructures[index], record_obj.location);
-        }
-    }
+    FinishReadObjects(pAccelerationStructures, accelerationStructureCount, record_obj.location);
     FinishReadObject(queryPool, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
@@ -6841,12 +6696,7 @@ void ThreadSafety::PreCallRecordWriteMicromapsPropertiesEXT(VkDevice device, uin
                                                             const VkMicromapEXT* pMicromaps, VkQueryType queryType, size_t dataSize,
                                                             void* pData, size_t stride, const RecordObject& record_obj) {
     StartReadObjectParentInstance(device, record_obj.location);
-
-    if (pMicromaps) {
-        for (uint32_t index = 0; index < micromapCount; index++) {
-            StartReadObject(pMicromaps[index], record_obj.location);
-        }
-    }
+    StartReadObjects(pMicromaps, micromapCount, record_obj.location);
 }
 
 void ThreadSafety::PostCallRecordWriteMicromapsPropertiesEXT(VkDevice device, uint32_t micromapCount,
@@ -6854,12 +6704,7 @@ void ThreadSafety::PostCallRecordWriteMicromapsPropertiesEXT(VkDevice device, ui
                                                              size_t dataSize, void* pData, size_t stride,
                                                              const RecordObject& record_obj) {
     FinishReadObjectParentInstance(device, record_obj.location);
-
-    if (pMicromaps) {
-        for (uint32_t index = 0; index < micromapCount; index++) {
-            FinishReadObject(pMicromaps[index], record_obj.location);
-        }
-    }
+    FinishReadObjects(pMicromaps, micromapCount, record_obj.location);
 }
 
 void ThreadSafety::PreCallRecordCmdCopyMicromapEXT(VkCommandBuffer commandBuffer, const VkCopyMicromapInfoEXT* pInfo,
@@ -6907,12 +6752,7 @@ void ThreadSafety::PreCallRecordCmdWriteMicromapsPropertiesEXT(VkCommandBuffer c
                                                                VkQueryPool queryPool, uint32_t firstQuery,
                                                                const RecordObject& record_obj) {
     StartWriteObject(commandBuffer, record_obj.location);
-
-    if (pMicromaps) {
-        for (uint32_t index = 0; index < micromapCount; index++) {
-            StartReadObject(pMicromaps[index], record_obj.location);
-        }
-    }
+    StartReadObjects(pMicromaps, micromapCount, record_obj.location);
     StartReadObject(queryPool, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
@@ -6922,12 +6762,7 @@ void ThreadSafety::PostCallRecordCmdWriteMicromapsPropertiesEXT(VkCommandBuffer
                                                                 VkQueryPool queryPool, uint32_t firstQuery,
                                                                 const RecordObject& record_obj) {
     FinishWriteObject(commandBuffer, record_obj.location);
-
-    if (pMicromaps) {
-        for (uint32_t index = 0; index < micromapCount; index++) {
-            FinishReadObject(pMicromaps[index], record_obj.location);
-        }
-    }
+    FinishReadObjects(pMicromaps, micromapCount, record_obj.location);
     FinishReadObject(queryPool, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
@@ -7668,12 +7503,7 @@ void ThreadSafety::PreCallRecordCmdBindShadersEXT(VkCommandBuffer commandBuffer,
                                                   const VkShaderStageFlagBits* pStages, const VkShaderEXT* pShaders,
                                                   const RecordObject& record_obj) {
     StartWriteObject(commandBuffer, record_obj.location);
-
-    if (pShaders) {
-        for (uint32_t index = 0; index < stageCount; index++) {
-            StartReadObject(pShaders[index], record_obj.location);
-        }
-    }
+    StartReadObjects(pShaders, stageCount, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
 
@@ -7681,12 +7511,7 @@ void ThreadSafety::PostCallRecordCmdBindShadersEXT(VkCommandBuffer commandBuffer
                                                    const VkShaderStageFlagBits* pStages, const VkShaderEXT* pShaders,
                                                    const RecordObject& record_obj) {
     FinishWriteObject(commandBuffer, record_obj.location);
-
-    if (pShaders) {
-        for (uint32_t index = 0; index < stageCount; index++) {
-            FinishReadObject(pShaders[index], record_obj.location);
-        }
-    }
+    FinishReadObjects(pShaders, stageCount, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
 
@@ -7935,12 +7760,7 @@ void ThreadSafety::PreCallRecordWriteAccelerationStructuresPropertiesKHR(VkDevic
                                                                          VkQueryType queryType, size_t dataSize, void* pData,
                                                                          size_t stride, const RecordObject& record_obj) {
     StartReadObjectParentInstance(device, record_obj.location);
-
-    if (pAccelerationStructures) {
-        for (uint32_t index = 0; index < accelerationStructureCount; index++) {
-            StartReadObject(pAccelerationStructures[index], record_obj.location);
-        }
-    }
+    StartReadObjects(pAccelerationStructures, accelerationStructureCount, record_obj.location);
 }
 
 void ThreadSafety::PostCallRecordWriteAccelerationStructuresPropertiesKHR(VkDevice device, uint32_t accelerationStructureCount,
@@ -7948,12 +7768,7 @@ void ThreadSafety::PostCallRecordWriteAccelerationStructuresPropertiesKHR(VkDevi
                                                                           VkQueryType queryType, size_t dataSize, void* pData,
                                                                           size_t stride, const RecordObject& record_obj) {
     FinishReadObjectParentInstance(device, record_obj.location);
-
-    if (pAccelerationStructures) {
-        for (uint32_t index = 0; index < accelerationStructureCount; index++) {
-            FinishReadObject(pAccelerationStructures[index], record_obj.location);
-        }
-    }
+    FinishReadObjects(pAccelerationStructures, accelerationStructureCount, record_obj.location);
 }
 
 void ThreadSafety::PreCallRecordCmdCopyAccelerationStructureKHR(VkCommandBuffer commandBuffer,
@@ -8014,12 +7829,7 @@ void ThreadSafety::PreCallRecordCmdWriteAccelerationStructuresPropertiesKHR(
     VkCommandBuffer commandBuffer, uint32_t accelerationStructureCount, const VkAccelerationStructureKHR* pAccelerationStructures,
     VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery, const RecordObject& record_obj) {
     StartWriteObject(commandBuffer, record_obj.location);
-
-    if (pAccelerationStructures) {
-        for (uint32_t index = 0; index < accelerationStructureCount; index++) {
-            StartReadObject(pAccelerationStructures[index], record_obj.location);
-        }
-    }
+    StartReadObjects(pAccelerationStructures, accelerationStructureCount, record_obj.location);
     StartReadObject(queryPool, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
@@ -8028,12 +7838,7 @@ void ThreadSafety::PostCallRecordCmdWriteAccelerationStructuresPropertiesKHR(
     VkCommandBuffer commandBuffer, uint32_t accelerationStructureCount, const VkAccelerationStructureKHR* pAccelerationStructures,
     VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery, const RecordObject& record_obj) {
     FinishWriteObject(commandBuffer, record_obj.location);
-
-    if (pAccelerationStructures) {
-        for (uint32_t index = 0; index < accelerationStructureCount; index++) {
-            FinishReadObject(pAccelerationStructures[index], record_obj.location);
-        }
-    }
+    FinishReadObjects(pAccelerationStructures, accelerationStructureCount, record_obj.location);
     FinishReadObject(queryPool, record_obj.location);
     // Host access to commandBuffer must be externally synchronized
 }
@@ -34,6 +34,9 @@
 //
 //  Another key point to consider is being able to tell the user a value is invalid because it "doesn't exist" vs
 //  "forgot to enable an extension" is VERY important
+//
+//  The values of the core token block (below kValidEnumTableSize) are the ones checked the most, so
+//  InitValidEnumTables precomputes them at vkCreateDevice and ValidateRangedEnum only comes here for the others.
 
 template <>
 ValidValue StatelessValidation::IsValidEnumValue(VkPipelineCacheHeaderVersion value) const {
@@ -1998,6 +2001,111 @@ ValidValue StatelessValidation::IsValidEnumValue(VkShaderGroupShaderKHR value) c
     };
 }
 
+void StatelessValidation::InitValidEnumTables() {
+    InitValidEnumTable<VkPipelineCacheHeaderVersion>(vvl::Enum::VkPipelineCacheHeaderVersion);
+    InitValidEnumTable<VkImageLayout>(vvl::Enum::VkImageLayout);
+    InitValidEnumTable<VkObjectType>(vvl::Enum::VkObjectType);
+    InitValidEnumTable<VkFormat>(vvl::Enum::VkFormat);
+    InitValidEnumTable<VkImageTiling>(vvl::Enum::VkImageTiling);
+    InitValidEnumTable<VkImageType>(vvl::Enum::VkImageType);
+    InitValidEnumTable<VkQueryType>(vvl::Enum::VkQueryType);
+    InitValidEnumTable<VkSharingMode>(vvl::Enum::VkSharingMode);
+    InitValidEnumTable<VkComponentSwizzle>(vvl::Enum::VkComponentSwizzle);
+    InitValidEnumTable<VkImageViewType>(vvl::Enum::VkImageViewType);
+    InitValidEnumTable<VkBlendFactor>(vvl::Enum::VkBlendFactor);
+    InitValidEnumTable<VkBlendOp>(vvl::Enum::VkBlendOp);
+    InitValidEnumTable<VkCompareOp>(vvl::Enum::VkCompareOp);
+    InitValidEnumTable<VkDynamicState>(vvl::Enum::VkDynamicState);
+    InitValidEnumTable<VkFrontFace>(vvl::Enum::VkFrontFace);
+    InitValidEnumTable<VkVertexInputRate>(vvl::Enum::VkVertexInputRate);
+    InitValidEnumTable<VkPrimitiveTopology>(vvl::Enum::VkPrimitiveTopology);
+    InitValidEnumTable<VkPolygonMode>(vvl::Enum::VkPolygonMode);
+    InitValidEnumTable<VkStencilOp>(vvl::Enum::VkStencilOp);
+    InitValidEnumTable<VkLogicOp>(vvl::Enum::VkLogicOp);
+    InitValidEnumTable<VkBorderColor>(vvl::Enum::VkBorderColor);
+    InitValidEnumTable<VkFilter>(vvl::Enum::VkFilter);
+    InitValidEnumTable<VkSamplerAddressMode>(vvl::Enum::VkSamplerAddressMode);
+    InitValidEnumTable<VkSamplerMipmapMode>(vvl::Enum::VkSamplerMipmapMode);
+    InitValidEnumTable<VkDescriptorType>(vvl::Enum::VkDescriptorType);
+    InitValidEnumTable<VkAttachmentLoadOp>(vvl::Enum::VkAttachmentLoadOp);
+    InitValidEnumTable<VkAttachmentStoreOp>(vvl::Enum::VkAttachmentStoreOp);
+    InitValidEnumTable<VkPipelineBindPoint>(vvl::Enum::VkPipelineBindPoint);
+    InitValidEnumTable<VkCommandBufferLevel>(vvl::Enum::VkCommandBufferLevel);
+    InitValidEnumTable<VkIndexType>(vvl::Enum::VkIndexType);
+    InitValidEnumTable<VkSubpassContents>(vvl::Enum::VkSubpassContents);
+    InitValidEnumTable<VkTessellationDomainOrigin>(vvl::Enum::VkTessellationDomainOrigin);
+    InitValidEnumTable<VkSamplerYcbcrModelConversion>(vvl::Enum::VkSamplerYcbcrModelConversion);
+    InitValidEnumTable<VkSamplerYcbcrRange>(vvl::Enum::VkSamplerYcbcrRange);
+    InitValidEnumTable<VkChromaLocation>(vvl::Enum::VkChromaLocation);
+    InitValidEnumTable<VkDescriptorUpdateTemplateType>(vvl::Enum::VkDescriptorUpdateTemplateType);
+    InitValidEnumTable<VkSamplerReductionMode>(vvl::Enum::VkSamplerReductionMode);
+    InitValidEnumTable<VkSemaphoreType>(vvl::Enum::VkSemaphoreType);
+    InitValidEnumTable<VkPresentModeKHR>(vvl::Enum::VkPresentModeKHR);
+    InitValidEnumTable<VkColorSpaceKHR>(vvl::Enum::VkColorSpaceKHR);
+    InitValidEnumTable<VkQueueGlobalPriorityKHR>(vvl::Enum::VkQueueGlobalPriorityKHR);
+    InitValidEnumTable<VkFragmentShadingRateCombinerOpKHR>(vvl::Enum::VkFragmentShadingRateCombinerOpKHR);
+    InitValidEnumTable<VkVideoEncodeTuningModeKHR>(vvl::Enum::VkVideoEncodeTuningModeKHR);
+    InitValidEnumTable<VkLineRasterizationModeKHR>(vvl::Enum::VkLineRasterizationModeKHR);
+    InitValidEnumTable<VkTimeDomainKHR>(vvl::Enum::VkTimeDomainKHR);
+    InitValidEnumTable<VkDebugReportObjectTypeEXT>(vvl::Enum::VkDebugReportObjectTypeEXT);
+    InitValidEnumTable<VkRasterizationOrderAMD>(vvl::Enum::VkRasterizationOrderAMD);
+    InitValidEnumTable<VkShaderInfoTypeAMD>(vvl::Enum::VkShaderInfoTypeAMD);
+    InitValidEnumTable<VkValidationCheckEXT>(vvl::Enum::VkValidationCheckEXT);
+    InitValidEnumTable<VkPipelineRobustnessBufferBehaviorEXT>(vvl::Enum::VkPipelineRobustnessBufferBehaviorEXT);
+    InitValidEnumTable<VkPipelineRobustnessImageBehaviorEXT>(vvl::Enum::VkPipelineRobustnessImageBehaviorEXT);
+    InitValidEnumTable<VkDisplayPowerStateEXT>(vvl::Enum::VkDisplayPowerStateEXT);
+    InitValidEnumTable<VkDeviceEventTypeEXT>(vvl::Enum::VkDeviceEventTypeEXT);
+    InitValidEnumTable<VkDisplayEventTypeEXT>(vvl::Enum::VkDisplayEventTypeEXT);
+    InitValidEnumTable<VkViewportCoordinateSwizzleNV>(vvl::Enum::VkViewportCoordinateSwizzleNV);
+    InitValidEnumTable<VkDiscardRectangleModeEXT>(vvl::Enum::VkDiscardRectangleModeEXT);
+    InitValidEnumTable<VkConservativeRasterizationModeEXT>(vvl::Enum::VkConservativeRasterizationModeEXT);
+    InitValidEnumTable<VkBlendOverlapEXT>(vvl::Enum::VkBlendOverlapEXT);
+    InitValidEnumTable<VkCoverageModulationModeNV>(vvl::Enum::VkCoverageModulationModeNV);
+    InitValidEnumTable<VkShadingRatePaletteEntryNV>(vvl::Enum::VkShadingRatePaletteEntryNV);
+    InitValidEnumTable<VkCoarseSampleOrderTypeNV>(vvl::Enum::VkCoarseSampleOrderTypeNV);
+    InitValidEnumTable<VkRayTracingShaderGroupTypeKHR>(vvl::Enum::VkRayTracingShaderGroupTypeKHR);
+    InitValidEnumTable<VkGeometryTypeKHR>(vvl::Enum::VkGeometryTypeKHR);
+    InitValidEnumTable<VkAccelerationStructureTypeKHR>(vvl::Enum::VkAccelerationStructureTypeKHR);
+    InitValidEnumTable<VkCopyAccelerationStructureModeKHR>(vvl::Enum::VkCopyAccelerationStructureModeKHR);
+    InitValidEnumTable<VkAccelerationStructureMemoryRequirementsTypeNV>(vvl::Enum::VkAccelerationStructureMemoryRequirementsTypeNV);
+    InitValidEnumTable<VkMemoryOverallocationBehaviorAMD>(vvl::Enum::VkMemoryOverallocationBehaviorAMD);
+    InitValidEnumTable<VkPerformanceConfigurationTypeINTEL>(vvl::Enum::VkPerformanceConfigurationTypeINTEL);
+    InitValidEnumTable<VkQueryPoolSamplingModeINTEL>(vvl::Enum::VkQueryPoolSamplingModeINTEL);
+    InitValidEnumTable<VkPerformanceOverrideTypeINTEL>(vvl::Enum::VkPerformanceOverrideTypeINTEL);
+    InitValidEnumTable<VkPerformanceParameterTypeINTEL>(vvl::Enum::VkPerformanceParameterTypeINTEL);
+    InitValidEnumTable<VkValidationFeatureEnableEXT>(vvl::Enum::VkValidationFeatureEnableEXT);
+    InitValidEnumTable<VkValidationFeatureDisableEXT>(vvl::Enum::VkValidationFeatureDisableEXT);
+    InitValidEnumTable<VkCoverageReductionModeNV>(vvl::Enum::VkCoverageReductionModeNV);
+    InitValidEnumTable<VkProvokingVertexModeEXT>(vvl::Enum::VkProvokingVertexModeEXT);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    InitValidEnumTable<VkFullScreenExclusiveEXT>(vvl::Enum::VkFullScreenExclusiveEXT);
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+    InitValidEnumTable<VkIndirectCommandsTokenTypeNV>(vvl::Enum::VkIndirectCommandsTokenTypeNV);
+    InitValidEnumTable<VkDepthBiasRepresentationEXT>(vvl::Enum::VkDepthBiasRepresentationEXT);
+    InitValidEnumTable<VkFragmentShadingRateTypeNV>(vvl::Enum::VkFragmentShadingRateTypeNV);
+    InitValidEnumTable<VkFragmentShadingRateNV>(vvl::Enum::VkFragmentShadingRateNV);
+    InitValidEnumTable<VkAccelerationStructureMotionInstanceTypeNV>(vvl::Enum::VkAccelerationStructureMotionInstanceTypeNV);
+    InitValidEnumTable<VkDeviceFaultAddressTypeEXT>(vvl::Enum::VkDeviceFaultAddressTypeEXT);
+    InitValidEnumTable<VkDeviceFaultVendorBinaryHeaderVersionEXT>(vvl::Enum::VkDeviceFaultVendorBinaryHeaderVersionEXT);
+    InitValidEnumTable<VkDeviceAddressBindingTypeEXT>(vvl::Enum::VkDeviceAddressBindingTypeEXT);
+    InitValidEnumTable<VkMicromapTypeEXT>(vvl::Enum::VkMicromapTypeEXT);
+    InitValidEnumTable<VkBuildMicromapModeEXT>(vvl::Enum::VkBuildMicromapModeEXT);
+    InitValidEnumTable<VkCopyMicromapModeEXT>(vvl::Enum::VkCopyMicromapModeEXT);
+    InitValidEnumTable<VkAccelerationStructureCompatibilityKHR>(vvl::Enum::VkAccelerationStructureCompatibilityKHR);
+    InitValidEnumTable<VkAccelerationStructureBuildTypeKHR>(vvl::Enum::VkAccelerationStructureBuildTypeKHR);
+    InitValidEnumTable<VkDirectDriverLoadingModeLUNARG>(vvl::Enum::VkDirectDriverLoadingModeLUNARG);
+    InitValidEnumTable<VkOpticalFlowPerformanceLevelNV>(vvl::Enum::VkOpticalFlowPerformanceLevelNV);
+    InitValidEnumTable<VkOpticalFlowSessionBindingPointNV>(vvl::Enum::VkOpticalFlowSessionBindingPointNV);
+    InitValidEnumTable<VkShaderCodeTypeEXT>(vvl::Enum::VkShaderCodeTypeEXT);
+    InitValidEnumTable<VkLayerSettingTypeEXT>(vvl::Enum::VkLayerSettingTypeEXT);
+    InitValidEnumTable<VkLatencyMarkerNV>(vvl::Enum::VkLatencyMarkerNV);
+    InitValidEnumTable<VkOutOfBandQueueTypeNV>(vvl::Enum::VkOutOfBandQueueTypeNV);
+    InitValidEnumTable<VkBlockMatchWindowCompareModeQCOM>(vvl::Enum::VkBlockMatchWindowCompareModeQCOM);
+    InitValidEnumTable<VkCubicFilterWeightsQCOM>(vvl::Enum::VkCubicFilterWeightsQCOM);
+    InitValidEnumTable<VkBuildAccelerationStructureModeKHR>(vvl::Enum::VkBuildAccelerationStructureModeKHR);
+    InitValidEnumTable<VkShaderGroupShaderKHR>(vvl::Enum::VkShaderGroupShaderKHR);
+}
+
 template <>
 vvl::Extensions StatelessValidation::GetEnumExtensions(VkPipelineCacheHeaderVersion value) const {
     return {};
@@ -613,7 +613,18 @@ APIVersion DeviceExtensions::InitFromDeviceCreateInfo(const InstanceExtensions*
             }
         }
     }
+    SetEnabledBits();
     return api_version;
 }
 
+void DeviceExtensions::SetEnabledBits() {
+    enabled_bits.reset();
+    for (const auto& [extension, info] : InstanceExtensions::GetInfoMap()) {
+        if (IsExtEnabled(this->*(info.state))) enabled_bits.set(static_cast<size_t>(extension));
+    }
+    for (const auto& [extension, info] : DeviceExtensions::GetInfoMap()) {
+        if (IsExtEnabled(this->*(info.state))) enabled_bits.set(static_cast<size_t>(extension));
+    }
+}
+
 // NOLINTEND
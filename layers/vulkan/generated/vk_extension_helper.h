@@ -30,9 +30,11 @@
 #include <array>
 #include <vector>
 #include <cassert>
+#include <initializer_list>
 
 #include <vulkan/vulkan.h>
 #include "containers/custom_containers.h"
+#include "containers/fixed_bitset.h"
 #include "generated/vk_api_version.h"
 #include "generated/error_location_helper.h"
 
@@ -80,6 +82,18 @@ Times to NOT use it
 
 [[maybe_unused]] static bool IsExtEnabledByCreateinfo(ExtEnabled extension) { return (extension == kEnabledByCreateinfo); }
 
+// One bit per vvl::Extension. Checks that need several extensions test them all at once against a constexpr mask,
+// with one AND per word, ex. device_extensions.IsAnyExtEnabled(kLineRasterizationExtensions)
+using ExtensionBits = vvl::FixedBitset<((vvl::kExtensionCount + 63) / 64) * 64>;
+
+constexpr ExtensionBits MakeExtensionBits(std::initializer_list<vvl::Extension> extensions) {
+    ExtensionBits bits;
+    for (const vvl::Extension extension : extensions) {
+        bits.set(static_cast<size_t>(extension));
+    }
+    return bits;
+}
+
 struct InstanceExtensions {
     ExtEnabled vk_feature_version_1_1{kNotEnabled};
     ExtEnabled vk_feature_version_1_2{kNotEnabled};
@@ -614,6 +628,12 @@ struct DeviceExtensions : public InstanceExtensions {
     ExtEnabled vk_khr_ray_query{kNotEnabled};
     ExtEnabled vk_ext_mesh_shader{kNotEnabled};
 
+    // The extensions above and the ones of InstanceExtensions that IsExtEnabled(), set by InitFromDeviceCreateInfo
+    ExtensionBits enabled_bits;
+
+    bool IsAllExtEnabled(const ExtensionBits &mask) const { return mask.AndNot(enabled_bits).none(); }
+    bool IsAnyExtEnabled(const ExtensionBits &mask) const { return enabled_bits.Intersects(mask); }
+
     struct Requirement {
         const ExtEnabled DeviceExtensions::*enabled;
         const char *name;
@@ -1684,6 +1704,9 @@ struct DeviceExtensions : public InstanceExtensions {
 
     APIVersion InitFromDeviceCreateInfo(const InstanceExtensions *instance_extensions, APIVersion requested_api_version,
                                         const VkDeviceCreateInfo *pCreateInfo = nullptr);
+
+  private:
+    void SetEnabledBits();
 };
 
 const InstanceExtensions::Info &GetInstanceVersionMap(const char *version);
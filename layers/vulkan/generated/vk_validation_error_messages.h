@@ -30,6 +30,7 @@ typedef struct _vuid_spec_text_pair {
     const char * url_id;
 } vuid_spec_text_pair;
 
+// Sorted by VUID (strcmp order)
 static const vuid_spec_text_pair vuid_spec_text[] = {
     {"VUID-BaryCoordKHR-BaryCoordKHR-04154", "The BaryCoordKHR decoration must be used only within the Fragment Execution Model", "1.3-extensions"},
     {"VUID-BaryCoordKHR-BaryCoordKHR-04155", "The variable decorated with BaryCoordKHR must be declared using the Input Storage Class", "1.3-extensions"},
@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+# Copyright (c) 2024 The Khronos Group Inc.
+# Copyright (c) 2024 Valve Corporation
+# Copyright (c) 2024 LunarG, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Decodes the files written by the VK_DBG_LAYER_ACTION_LOG_STRUCTURED debug action (see
+# layers/error_message/structured_log.h for the format) into one JSON object per line.
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+MAGIC = 0x424c5656
+SUPPORTED_VERSION = 1
+NO_INDEX = 0xffffffff
+
+HEADER = struct.Struct('<IIQQHHHH')
+OBJECT = struct.Struct('<IIQ')
+LOCATION = struct.Struct('<IIIII')
+
+SEVERITIES = {0x1: 'VERBOSE', 0x10: 'INFO', 0x100: 'WARNING', 0x1000: 'ERROR'}
+
+# helper to define paths relative to the repo root
+def repo_relative(path):
+    return os.path.abspath(os.path.join(os.path.dirname(__file__), '..', path))
+
+# The enums in error_location_helper.h start at Empty = 0 and have no explicit values after it, so the names can be
+# recovered from their order. The header must come from the same build as the layer that wrote the log.
+def load_location_enums(header_path):
+    with open(header_path, encoding='utf-8') as file:
+        text = file.read()
+    enums = {}
+    for name in ['Func', 'Struct', 'Field']:
+        match = re.search(r'enum class ' + name + r' \{(.*?)\};', text, re.DOTALL)
+        if not match:
+            sys.exit(f'Error: enum class {name} not found in {header_path}')
+        values = [value.strip().split('=')[0].strip() for value in match.group(1).split(',')]
+        enums[name] = [value for value in values if value and not value.startswith('//')]
+    return enums
+
+def enum_name(enums, kind, value):
+    names = enums[kind]
+    return names[value] if value < len(names) else f'{kind}({value})'
+
+def format_location(enums, locations):
+    # Close to Location::Message(), ex. "vkCmdPipelineBarrier2(): pDependencyInfo.pImageMemoryBarriers[1].image", except
+    # that "." is also used where the layer prints "->"
+    if not locations:
+        return ''
+    parts = []
+    for i, (_, structure, field, index, is_pnext) in enumerate(locations):
+        # A .dot(index) level repeats the field of the level above, only the indexed one is printed
+        if 0 < i < len(locations) - 1 and locations[i + 1][2] == field and index == NO_INDEX:
+            continue
+        part = ''
+        if is_pnext and structure != 0:
+            part = f'pNext<{enum_name(enums, "Struct", structure)}>'
+        if field != 0:
+            part += ('.' if part else '') + enum_name(enums, 'Field', field)
+            if index != NO_INDEX:
+                part += f'[{index}]'
+        if part:
+            parts.append(part)
+    return enum_name(enums, 'Func', locations[0][0]) + '(): ' + '.'.join(parts)
+
+def decode(log_path, enums, out):
+    with open(log_path, 'rb') as file:
+        data = file.read()
+    if len(data) < 8:
+        sys.exit(f'Error: {log_path} is too small to be a structured log')
+    magic, version = struct.unpack_from('<II', data, 0)
+    if magic != MAGIC:
+        sys.exit(f'Error: {log_path} is not a structured log')
+    if version != SUPPORTED_VERSION:
+        sys.exit(f'Error: {log_path} is version {version}, only version {SUPPORTED_VERSION} is supported')
+
+    offset = 8
+    while offset + HEADER.size <= len(data):
+        (size, message_id, timestamp_ns, thread_id, severity, object_count, location_count,
+         vuid_length) = HEADER.unpack_from(data, offset)
+        if size < HEADER.size or offset + size > len(data):
+            print(f'Warning: truncated record at offset {offset}, stopping', file=sys.stderr)
+            break
+        cursor = offset + HEADER.size
+        objects = []
+        for _ in range(object_count):
+            object_type, _, handle = OBJECT.unpack_from(data, cursor)
+            objects.append({'type': object_type, 'handle': f'0x{handle:x}'})
+            cursor += OBJECT.size
+        locations = []
+        for _ in range(location_count):
+            locations.append(LOCATION.unpack_from(data, cursor))
+            cursor += LOCATION.size
+        vuid = data[cursor:cursor + vuid_length].decode('utf-8', errors='replace')
+
+        record = {
+            'timestamp_ns': timestamp_ns,
+            'thread_id': thread_id,
+            'severity': SEVERITIES.get(severity, str(severity)),
+            'vuid': vuid,
+            'message_id': f'0x{message_id:x}',
+            'objects': objects,
+        }
+        if enums:
+            record['location'] = format_location(enums, locations)
+        else:
+            record['location'] = [{'function': l[0], 'struct': l[1], 'field': l[2], 'index': l[3], 'pnext': bool(l[4])}
+                                  for l in locations]
+        out.write(json.dumps(record) + '\n')
+        offset += size
+
+def main(argv):
+    parser = argparse.ArgumentParser(description='Decode a structured validation log into JSON lines')
+    parser.add_argument('log_file', help='file written by VK_DBG_LAYER_ACTION_LOG_STRUCTURED')
+    parser.add_argument('-location-header', dest='location_header',
+                        default=repo_relative('layers/vulkan/generated/error_location_helper.h'),
+                        help='error_location_helper.h used to name the Location enums (default: the one in this repo)')
+    parser.add_argument('-raw', action='store_true', help='keep the Location enums as numbers')
+    parser.add_argument('-o', dest='output', help='output file (default: stdout)')
+    args = parser.parse_args(argv)
+
+    enums = None if args.raw else load_location_enums(args.location_header)
+    if args.output:
+        with open(args.output, 'w', encoding='utf-8') as out:
+            decode(args.log_file, enums, out)
+    else:
+        decode(args.log_file, enums, sys.stdout)
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -275,6 +275,8 @@ typedef struct _vuid_spec_text_pair {{
     vuid_list.sort()
     minor_version = int(val_json.api_version.split('.')[1])
 
+    # Sorted so the layer can binary search the table
+    out.append('// Sorted by VUID (strcmp order)\n')
     out.append('static const vuid_spec_text_pair vuid_spec_text[] = {\n')
     for vuid in vuid_list:
         db_entry = val_json.vuid_db[vuid][0]
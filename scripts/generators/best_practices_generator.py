@@ -70,6 +70,8 @@ class BestPracticesOutputGenerator(BaseGenerator):
             'vkCreateComputePipelines',
             'vkCmdPipelineBarrier',
             'vkQueueSubmit',
+            # NVIDIA deferred checks
+            'vkEndCommandBuffer',
         ]
 
         self.extension_info = dict()
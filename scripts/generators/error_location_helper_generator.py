@@ -100,6 +100,8 @@ class ErrorLocationHelperOutputGenerator(BaseGenerator):
         for command in sorted(self.vk.commands.values()):
             out.append(f'    {command.name},\n')
         out.append('};\n')
+        out.append('// Number of Func values, including Empty\n')
+        out.append(f'constexpr uint32_t kFuncCount = {len(self.vk.commands) + 1};\n')
 
         out.append('\n')
         out.append('enum class Struct {\n')
@@ -139,6 +141,8 @@ class ErrorLocationHelperOutputGenerator(BaseGenerator):
         for extension in sorted(self.vk.extensions.values(), key=lambda x: x.name):
             out.append(f'    _{extension.name},\n')
         out.append('};\n')
+        out.append('// Number of Extension values, including Empty\n')
+        out.append(f'constexpr uint32_t kExtensionCount = {len(self.vk.extensions) + 1};\n')
 
         out.append('''
 
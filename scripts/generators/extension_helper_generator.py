@@ -133,9 +133,11 @@ class ExtensionHelperOutputGenerator(BaseGenerator):
             #include <array>
             #include <vector>
             #include <cassert>
+            #include <initializer_list>
 
             #include <vulkan/vulkan.h>
             #include "containers/custom_containers.h"
+            #include "containers/fixed_bitset.h"
             #include "generated/vk_api_version.h"
             #include "generated/error_location_helper.h"
 
@@ -182,6 +184,18 @@ class ExtensionHelperOutputGenerator(BaseGenerator):
             [[maybe_unused]] static bool IsExtEnabled(ExtEnabled extension) { return (extension != kNotEnabled); }
 
             [[maybe_unused]] static bool IsExtEnabledByCreateinfo(ExtEnabled extension) { return (extension == kEnabledByCreateinfo); }
+
+            // One bit per vvl::Extension. Checks that need several extensions test them all at once against a constexpr mask,
+            // with one AND per word, ex. device_extensions.IsAnyExtEnabled(kLineRasterizationExtensions)
+            using ExtensionBits = vvl::FixedBitset<((vvl::kExtensionCount + 63) / 64) * 64>;
+
+            constexpr ExtensionBits MakeExtensionBits(std::initializer_list<vvl::Extension> extensions) {
+                ExtensionBits bits;
+                for (const vvl::Extension extension : extensions) {
+                    bits.set(static_cast<size_t>(extension));
+                }
+                return bits;
+            }
             ''')
 
         out.append('\nstruct InstanceExtensions {\n')
@@ -242,6 +256,12 @@ class ExtensionHelperOutputGenerator(BaseGenerator):
         out.extend([f'    ExtEnabled {ext.name.lower()}{{kNotEnabled}};\n' for ext in self.vk.extensions.values() if ext.device])
 
         out.append('''
+            // The extensions above and the ones of InstanceExtensions that IsExtEnabled(), set by InitFromDeviceCreateInfo
+            ExtensionBits enabled_bits;
+
+            bool IsAllExtEnabled(const ExtensionBits &mask) const { return mask.AndNot(enabled_bits).none(); }
+            bool IsAnyExtEnabled(const ExtensionBits &mask) const { return enabled_bits.Intersects(mask); }
+
             struct Requirement {
                 const ExtEnabled DeviceExtensions::*enabled;
                 const char *name;
@@ -288,6 +308,9 @@ class ExtensionHelperOutputGenerator(BaseGenerator):
 
             APIVersion InitFromDeviceCreateInfo(const InstanceExtensions *instance_extensions, APIVersion requested_api_version,
                                                 const VkDeviceCreateInfo *pCreateInfo = nullptr);
+
+            private:
+            void SetEnabledBits();
             };
 
             const InstanceExtensions::Info &GetInstanceVersionMap(const char* version);
@@ -472,8 +495,19 @@ class ExtensionHelperOutputGenerator(BaseGenerator):
                         }
                     }
                 }
+                SetEnabledBits();
                 return api_version;
             }
+
+            void DeviceExtensions::SetEnabledBits() {
+                enabled_bits.reset();
+                for (const auto &[extension, info] : InstanceExtensions::GetInfoMap()) {
+                    if (IsExtEnabled(this->*(info.state))) enabled_bits.set(static_cast<size_t>(extension));
+                }
+                for (const auto &[extension, info] : DeviceExtensions::GetInfoMap()) {
+                    if (IsExtEnabled(this->*(info.state))) enabled_bits.set(static_cast<size_t>(extension));
+                }
+            }
             ''')
 
         self.write(''.join(out))
\ No newline at end of file
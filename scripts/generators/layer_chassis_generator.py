@@ -123,6 +123,8 @@ class APISpecific:
                 return '''
 // clang-format off
 void ValidationObject::InitObjectDispatchVectors() {
+    std::vector<std::vector<ValidationObject*>> intercept_lists(InterceptIdCount);
+    std::vector<InterceptId> command_validate_ids;
 
 #define BUILD_DISPATCH_VECTOR(name) \\
     init_object_dispatch_vector(InterceptId ## name, \\
@@ -136,18 +138,29 @@ void ValidationObject::InitObjectDispatchVectors() {
                                 typeid(&debug_printf::Validator::name), \\
                                 typeid(&SyncValidator::name));
 
-    auto init_object_dispatch_vector = [this](InterceptId id,
-                                              const std::type_info& vo_typeid,
-                                              const std::type_info& tt_typeid,
-                                              const std::type_info& tpv_typeid,
-                                              const std::type_info& tot_typeid,
-                                              const std::type_info& tcv_typeid,
-                                              const std::type_info& tbp_typeid,
-                                              const std::type_info& tga_typeid,
-                                              const std::type_info& tdp_typeid,
-                                              const std::type_info& tsv_typeid) {
+// Entry points listed by the skip_validate_entry_points setting are left with no PreCallValidate objects
+#define BUILD_VALIDATE_DISPATCH_VECTOR(name) \\
+    if (skipped_validate_calls.empty() || !skipped_validate_calls[static_cast<uint32_t>(vvl::Func::vk ## name)]) { \\
+        BUILD_DISPATCH_VECTOR(PreCallValidate ## name); \\
+    }
+
+// The PreCallValidate of the recording commands, which are left out of the unsampled_intercept_vectors
+#define BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR(name) \\
+    BUILD_VALIDATE_DISPATCH_VECTOR(name); \\
+    command_validate_ids.push_back(InterceptIdPreCallValidate ## name);
+
+    auto init_object_dispatch_vector = [this, &intercept_lists](InterceptId id,
+                                                                const std::type_info& vo_typeid,
+                                                                const std::type_info& tt_typeid,
+                                                                const std::type_info& tpv_typeid,
+                                                                const std::type_info& tot_typeid,
+                                                                const std::type_info& tcv_typeid,
+                                                                const std::type_info& tbp_typeid,
+                                                                const std::type_info& tga_typeid,
+                                                                const std::type_info& tdp_typeid,
+                                                                const std::type_info& tsv_typeid) {
         for (auto item : this->object_dispatch) {
-            auto intercept_vector = &this->intercept_vectors[id];
+            auto intercept_vector = &intercept_lists[id];
             switch (item->container_type) {
             case LayerObjectTypeThreading:
                 if (tt_typeid != vo_typeid) intercept_vector->push_back(item);
@@ -183,8 +196,6 @@ void ValidationObject::InitObjectDispatchVectors() {
         }
     };
 // clang-format on
-
-    intercept_vectors.resize(InterceptIdCount);
 '''
 
 
@@ -308,6 +319,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
             #include "vk_layer_config.h"
             #include "layer_options.h"
             #include "containers/custom_containers.h"
+            #include "containers/slab_id_map.h"
             #include "error_message/logging.h"
             #include "error_message/error_location.h"
             #include "error_message/record_object.h"
@@ -317,6 +329,11 @@ class LayerChassisOutputGenerator(BaseGenerator):
             #include "vk_dispatch_table_helper.h"
             #include "vk_extension_helper.h"
             #include "gpu_validation/gpu_settings.h"
+            #include "sync/sync_settings.h"
+            #include "utils/call_profiler.h"
+            #include "utils/trace_recorder.h"
+            #include "utils/frame_sampler.h"
+            #include "utils/worker_pool.h"
 
             extern std::atomic<uint64_t> global_unique_id;
 
@@ -347,13 +364,82 @@ class LayerChassisOutputGenerator(BaseGenerator):
             namespace vvl {
                 struct AllocateDescriptorSetsData;
                 class Pipeline;
+                class QueueRetirePool;
             }  // namespace vvl
 
             // Because of GPL, we currently create our Pipeline state objects before the PreCallValidate
             // Each chassis layer will need to track its own state
             using PipelineStates = std::vector<std::shared_ptr<vvl::Pipeline>>;
 
-            extern vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+            // Maps the unique IDs handed out to the application to the actual handles. Accesses are internally synchronized.
+            // By default the IDs are hashed sequential numbers stored in a concurrent hash map. With the unique_handles_slab setting,
+            // new IDs are slots of a vvl::SlabIdMap instead, so the lookup done for every handle of every call neither hashes nor locks.
+            // Both kinds of IDs can be live at the same time, which keeps the setting safe to change between instances.
+            class UniqueIdMapping {
+              public:
+                class FindResult {
+                  public:
+                    FindResult(bool found, uint64_t handle) : result_(found, handle) {}
+                    bool operator==(const FindResult& other) const { return result_.first == other.result_.first; }
+                    bool operator!=(const FindResult& other) const { return result_.first != other.result_.first; }
+                    const std::pair<bool, uint64_t>* operator->() const { return &result_; }
+
+                  private:
+                    std::pair<bool, uint64_t> result_;
+                };
+
+                void UseSlabIds(bool use_slab_ids) { use_slab_ids_ = use_slab_ids; }
+
+                uint64_t Insert(uint64_t handle) {
+                    if (use_slab_ids_) {
+                        const uint64_t unique_id = slab_.Insert(handle);
+                        if (unique_id != 0) return unique_id;
+                        // Every slot is in use, fall back to the hash map
+                    }
+                    const uint64_t unique_id = HashedUint64::hash(global_unique_id++) & ~vvl::SlabIdMap::kIdTag;
+                    hash_map_.insert_or_assign(unique_id, handle);
+                    return unique_id;
+                }
+
+                // Writes the ids of handles[0, count) to unique_ids, the slab is locked once for the whole batch
+                void InsertBatch(const uint64_t* handles, uint32_t count, uint64_t* unique_ids) {
+                    uint32_t inserted = use_slab_ids_ ? slab_.InsertBatch(handles, count, unique_ids) : 0;
+                    for (; inserted < count; ++inserted) {
+                        const uint64_t unique_id = HashedUint64::hash(global_unique_id++) & ~vvl::SlabIdMap::kIdTag;
+                        hash_map_.insert_or_assign(unique_id, handles[inserted]);
+                        unique_ids[inserted] = unique_id;
+                    }
+                }
+
+                FindResult find(uint64_t unique_id) const {
+                    if (vvl::SlabIdMap::IsSlabId(unique_id)) {
+                        const auto handle = slab_.Find(unique_id);
+                        return handle ? FindResult(true, *handle) : end();
+                    }
+                    auto iter = hash_map_.find(unique_id);
+                    return iter != hash_map_.end() ? FindResult(true, iter->second) : end();
+                }
+
+                FindResult pop(uint64_t unique_id) {
+                    if (vvl::SlabIdMap::IsSlabId(unique_id)) {
+                        const auto handle = slab_.Pop(unique_id);
+                        return handle ? FindResult(true, *handle) : end();
+                    }
+                    auto iter = hash_map_.pop(unique_id);
+                    return iter != hash_map_.end() ? FindResult(true, iter->second) : end();
+                }
+
+                void erase(uint64_t unique_id) { pop(unique_id); }
+
+                FindResult end() const { return FindResult(false, 0); }
+
+              private:
+                bool use_slab_ids_ = false;
+                vvl::SlabIdMap slab_;
+                vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> hash_map_;
+            };
+
+            extern UniqueIdMapping unique_id_mapping;
 
             VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(VkInstance instance, const char* funcName);\n
             ''')
@@ -379,6 +465,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 LayerObjectTypeSyncValidation,       // Instance or device synchronization validation layer object
                 LayerObjectTypeMaxEnum,              // Max enum count
             };
+            const char* LayerObjectTypeName(LayerObjectTypeId type_id);
 
             struct TemplateState {
                 VkDescriptorUpdateTemplate desc_update_template;
@@ -396,6 +483,63 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 NoExtension, // trying to use a proper value, but the extension is required
             };
 
+            class ValidationObject;
+
+            // Validation objects to call for each intercept id. The objects of all ids are stored back to back in one array, so
+            // dispatching a call reads a single contiguous range instead of a separate allocation per intercepted function.
+            class InterceptVectors {
+              public:
+                class Range {
+                  public:
+                    Range(ValidationObject* const* first, ValidationObject* const* last) : first_(first), last_(last) {}
+                    ValidationObject* const* begin() const { return first_; }
+                    ValidationObject* const* end() const { return last_; }
+                    size_t size() const { return static_cast<size_t>(last_ - first_); }
+                    bool empty() const { return first_ == last_; }
+
+                  private:
+                    ValidationObject* const* first_;
+                    ValidationObject* const* last_;
+                };
+
+                Range operator[](size_t id) const { return Range(objects_.data() + offsets_[id], objects_.data() + offsets_[id + 1]); }
+
+                void Assign(const std::vector<std::vector<ValidationObject*>>& lists) {
+                    objects_.clear();
+                    offsets_.clear();
+                    offsets_.reserve(lists.size() + 1);
+                    offsets_.push_back(0);
+                    for (const auto& list : lists) {
+                        objects_.insert(objects_.end(), list.begin(), list.end());
+                        offsets_.push_back(static_cast<uint32_t>(objects_.size()));
+                    }
+                }
+
+                // Removes an object from the ranges of every intercept id
+                void Erase(const ValidationObject* object) {
+                    uint32_t write = 0;
+                    uint32_t read = 0;
+                    for (size_t id = 0; id + 1 < offsets_.size(); ++id) {
+                        const uint32_t end = offsets_[id + 1];
+                        offsets_[id] = write;
+                        for (; read < end; ++read) {
+                            if (objects_[read] != object) {
+                                objects_[write++] = objects_[read];
+                            }
+                        }
+                    }
+                    if (!offsets_.empty()) {
+                        offsets_.back() = write;
+                    }
+                    objects_.resize(write);
+                }
+
+              private:
+                std::vector<ValidationObject*> objects_;
+                // offsets_[id] to offsets_[id + 1] is the range of objects for an intercept id
+                std::vector<uint32_t> offsets_;
+            };
+
             #if defined(__clang__)
             #define DECORATE_PRINTF(_fmt_argnum, _first_param_num) __attribute__((format(printf, _fmt_argnum, _first_param_num)))
             #elif defined(__GNUC__)
@@ -413,7 +557,10 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     return debug_report->FormatHandle(std::forward<T>(h));
                 }
 
-                std::vector<std::vector<ValidationObject*>> intercept_vectors;
+                InterceptVectors intercept_vectors;
+                // The intercept_vectors without the objects of the sampled validation in the PreCallValidate of the vkCmd* entry points, set
+                // when there is a frame_sampler
+                InterceptVectors unsampled_intercept_vectors;
 
                 VkLayerInstanceDispatchTable instance_dispatch_table;
                 VkLayerDispatchTable device_dispatch_table;
@@ -425,6 +572,27 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 bool fine_grained_locking{true};
                 GpuAVSettings gpuav_settings = {};
                 DebugPrintfSettings printf_settings = {};
+                SyncValSettings syncval_settings = {};
+                std::string call_profile_file;
+                std::string trace_file;
+                // Threads of the pool shared by the queues of a device to retire submissions, 0 for one thread per queue
+                uint32_t queue_retire_threads = 0;
+                // Shader validation cache file of CoreChecks, empty for the default file in the temporary directory
+                std::string shader_validation_cache_path;
+                // Threads of CoreChecks validating the shaders of a call in parallel, 0 validates on the calling thread
+                uint32_t shader_validation_threads = 0;
+                // Threads of the pool shared by the validation objects of all the devices, 0 for no shared pool
+                uint32_t worker_threads = 0;
+                // Pins each thread of the shared pool to one CPU
+                bool worker_thread_affinity = false;
+                // Frames between the ones whose commands are validated by CoreChecks, BestPractices and SyncValidator, 0 or 1 for all
+                uint32_t frame_sampling_interval = 0;
+                // Microseconds of a sampled frame during which the commands are validated, 0 for all of them
+                uint32_t frame_sampling_time_budget = 0;
+                // Indexed by vvl::Func, the PreCallValidate of the set entries is left out of the intercept vectors of the device
+                std::vector<bool> skipped_validate_calls;
+                // Prints the statistics of the layer allocator at vkDestroyDevice and vkDestroyInstance
+                bool allocation_statistics = false;
 
                 VkInstance instance = VK_NULL_HANDLE;
                 VkPhysicalDevice physical_device = VK_NULL_HANDLE;
@@ -453,6 +621,44 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 virtual ReadLockGuard ReadLock() const { return ReadLockGuard(validation_object_mutex); }
                 virtual WriteLockGuard WriteLock() { return WriteLockGuard(validation_object_mutex); }
 
+                // Objects that do their own locking return deferred guards from ReadLock()/WriteLock(). That choice only depends on
+                // settings known at creation time, so it is resolved once and the chassis skips the virtual call for them afterwards.
+                bool object_lock_required = true;
+                void UpdateObjectLockRequired() { object_lock_required = WriteLock().owns_lock(); }
+                ReadLockGuard ReadLockIfRequired() const { return object_lock_required ? ReadLock() : ReadLockGuard(); }
+                WriteLockGuard WriteLockIfRequired() { return object_lock_required ? WriteLock() : WriteLockGuard(); }
+
+                // Shared by all the objects of a device, null unless the call_profile_file setting is set
+                std::shared_ptr<vvl::CallProfiler> call_profiler;
+                // Shared by all the instances and devices of the process, null unless the trace_file setting is set
+                std::shared_ptr<vvl::TraceRecorder> tracer;
+                struct CallScope {
+                    vvl::CallProfiler::Scope profile;
+                    vvl::TraceRecorder::Span span;
+                };
+                CallScope ProfileCall(vvl::CallProfiler::Phase phase, vvl::Func function) const {
+                    return {call_profiler ? call_profiler->Begin(container_type, function, phase) : vvl::CallProfiler::Scope(),
+                            tracer ? tracer->Begin(LayerObjectTypeName(container_type), vvl::String(function),
+                                                   vvl::CallProfiler::PhaseName(phase))
+                                   : vvl::TraceRecorder::Span()};
+                }
+                // For the work done outside of the API calls, ex. retiring submissions or post processing GPU results
+                vvl::TraceRecorder::Span TraceSpan(const char* category, const char* name) const {
+                    return tracer ? tracer->Begin(category, name) : vvl::TraceRecorder::Span();
+                }
+                // Null unless the worker_threads setting is set. The features splitting their work across threads use it instead of
+                // their own threads, the messages of the tasks can be put back in order with DebugReport::OrderedMessages.
+                std::shared_ptr<vvl::WorkerPool> worker_pool;
+                // Null unless the queue_retire_threads setting is set. One per device, the state trackers of all the objects of the
+                // device retire their queues on the same threads.
+                std::shared_ptr<vvl::QueueRetirePool> queue_retire_pool;
+                // Null unless the frame_sampling_interval or frame_sampling_time_budget setting is set, only on the device dispatch object
+                std::shared_ptr<vvl::FrameSampler> frame_sampler;
+                // What the vkCmd* entry points use in place of intercept_vectors for their PreCallValidate
+                InterceptVectors::Range CommandValidateIntercepts(size_t id) const {
+                    return (frame_sampler && !frame_sampler->Sampled()) ? unsampled_intercept_vectors[id] : intercept_vectors[id];
+                }
+
                 // If the Record phase calls a function that blocks, we might need to release
                 // the lock that protects Record itself in order to avoid mutual waiting.
                 static thread_local WriteLockGuard* record_guard;
@@ -470,7 +676,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                         // reference only one frame of the callstack.
                         assert(validation_object->record_guard == nullptr);
 
-                        lock = validation_object->WriteLock();
+                        lock = validation_object->WriteLockIfRequired();
 
                         // Initialize record_guard only when Record is actually protected by the
                         // mutex. It's not the case when fine grained locking is enabled.
@@ -556,6 +762,19 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     return result;
                 }
 
+                // The message text is only built by |formatter| once the message is known to be delivered, for messages costly to format
+                bool LogError(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc, const MessageFormatter& formatter) const {
+                    return debug_report->LogMsg(kErrorBit, objlist, &loc, vuid_text, formatter);
+                }
+
+                bool LogWarning(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc, const MessageFormatter& formatter) const {
+                    return debug_report->LogMsg(kWarningBit, objlist, &loc, vuid_text, formatter);
+                }
+
+                bool LogPerformanceWarning(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc, const MessageFormatter& formatter) const {
+                    return debug_report->LogMsg(kPerformanceWarningBit, objlist, &loc, vuid_text, formatter);
+                }
+
                 void LogInternalError(std::string_view failure_location, const LogObjectList& obj_list, const Location& loc, std::string_view entrypoint,
                                     VkResult err) const {
                     const std::string_view err_string = string_VkResult(err);
@@ -595,13 +814,31 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 template <typename HandleType>
                 HandleType WrapNew(HandleType new_created_handle) {
                     if (new_created_handle == (HandleType)VK_NULL_HANDLE) return new_created_handle;
-                    auto unique_id = global_unique_id++;
-                    unique_id = HashedUint64::hash(unique_id);
+                    const uint64_t unique_id = unique_id_mapping.Insert(CastToUint64(new_created_handle));
                     assert(unique_id != 0);  // can't be 0, otherwise unwrap will apply special rule for VK_NULL_HANDLE
-                    unique_id_mapping.insert_or_assign(unique_id, CastToUint64(new_created_handle));
                     return (HandleType)unique_id;
                 }
 
+                // Wrap an array of newly created handles in place, for the calls that create many objects at once.
+                template <typename HandleType>
+                void WrapNewArray(HandleType* new_created_handles, uint32_t count) {
+                    small_vector<uint64_t, 32> handles;
+                    handles.reserve(count);
+                    for (uint32_t i = 0; i < count; ++i) {
+                        if (new_created_handles[i] != (HandleType)VK_NULL_HANDLE) {
+                            handles.emplace_back(CastToUint64(new_created_handles[i]));
+                        }
+                    }
+                    small_vector<uint64_t, 32> unique_ids(handles.size());
+                    unique_id_mapping.InsertBatch(handles.data(), static_cast<uint32_t>(handles.size()), unique_ids.data());
+                    uint32_t id_index = 0;
+                    for (uint32_t i = 0; i < count; ++i) {
+                        if (new_created_handles[i] != (HandleType)VK_NULL_HANDLE) {
+                            new_created_handles[i] = (HandleType)unique_ids[id_index++];
+                        }
+                    }
+                }
+
                 // VkDisplayKHR objects are statically created in the driver at VkCreateInstance.
                 // They live with the PhyiscalDevice and apps never created/destroy them.
                 // Apps needs will query for them and the first time we see it we wrap it
@@ -728,6 +965,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
     def generateSource(self):
         out = []
         out.append('''
+            #include <algorithm>
             #include <array>
             #include <cstring>
             #include <mutex>
@@ -745,7 +983,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
             std::atomic<uint64_t> global_unique_id(1ULL);
             // Map uniqueID to actual object handle. Accesses to the map itself are
             // internally synchronized.
-            vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+            UniqueIdMapping unique_id_mapping;
 
             // State we track in order to populate HandleData for things such as ignored pointers
             static vvl::unordered_map<VkCommandBuffer, VkCommandPool> secondary_cb_map{};
@@ -760,6 +998,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
         # Add #include directives for the used layers
         for layer in APISpecific.getValidationLayerList(self.targetApiName):
             out.append(f'#include "{layer["include"]}"\n')
+        out.append('#include "state_tracker/queue_state.h"\n')
         out.append('\n')
 
         out.append('// This header file must be included after the above validation object class definitions\n')
@@ -818,6 +1057,33 @@ class LayerChassisOutputGenerator(BaseGenerator):
         out.append('}\n')
 
         out.append('''
+            const char* LayerObjectTypeName(LayerObjectTypeId type_id) {
+                switch (type_id) {
+                    case LayerObjectTypeInstance:
+                        return "Instance";
+                    case LayerObjectTypeDevice:
+                        return "Device";
+                    case LayerObjectTypeThreading:
+                        return "ThreadSafety";
+                    case LayerObjectTypeParameterValidation:
+                        return "StatelessValidation";
+                    case LayerObjectTypeObjectTracker:
+                        return "ObjectLifetimes";
+                    case LayerObjectTypeCoreValidation:
+                        return "CoreChecks";
+                    case LayerObjectTypeBestPractices:
+                        return "BestPractices";
+                    case LayerObjectTypeGpuAssisted:
+                        return "GpuAssisted";
+                    case LayerObjectTypeDebugPrintf:
+                        return "DebugPrintf";
+                    case LayerObjectTypeSyncValidation:
+                        return "SyncValidation";
+                    default:
+                        return "Unknown";
+                }
+            }
+
             // Global list of sType,size identifiers
             std::vector<std::pair<uint32_t, uint32_t>> custom_stype_info{};
 
@@ -852,16 +1118,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                         layer_data->object_dispatch.erase(object_it);
 
-                        for (auto intercept_vector_it = layer_data->intercept_vectors.begin();
-                            intercept_vector_it != layer_data->intercept_vectors.end(); intercept_vector_it++) {
-                            for (auto intercept_object_it = intercept_vector_it->begin(); intercept_object_it != intercept_vector_it->end();
-                                intercept_object_it++) {
-                                if (object == *intercept_object_it) {
-                                    intercept_vector_it->erase(intercept_object_it);
-                                    break;
-                                }
-                            }
-                        }
+                        layer_data->intercept_vectors.Erase(object);
 
                         delete object;
                         break;
@@ -1091,16 +1348,46 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 bool lock_setting;
                 GpuAVSettings local_gpuav_settings = {};
                 DebugPrintfSettings local_printf_settings = {};
+                SyncValSettings local_syncval_settings = {};
+                std::string local_call_profile_file;
+                std::string local_trace_file;
+                uint32_t local_queue_retire_threads = 0;
+                std::string local_shader_validation_cache_path;
+                uint32_t local_shader_validation_threads = 0;
+                uint32_t local_worker_threads = 0;
+                bool local_worker_thread_affinity = false;
+                uint32_t local_frame_sampling_interval = 0;
+                uint32_t local_frame_sampling_time_budget = 0;
+                std::vector<bool> local_skipped_validate_calls;
+                vvl::AllocatorKind local_allocator_kind = vvl::AllocatorKind::System;
+                bool local_allocation_statistics = false;
+                uint32_t local_allocation_statistics_period = 0;
                 ConfigAndEnvSettings config_and_env_settings_data{OBJECT_LAYER_DESCRIPTION,
                                                                 pCreateInfo,
                                                                 local_enables,
                                                                 local_disables,
                                                                 debug_report->filter_message_ids,
                                                                 &debug_report->duplicate_message_limit,
+                                                                &debug_report->duplicate_message_limit_per_object,
                                                                 &debug_report->message_format_settings,
+                                                                &debug_report->async_message_delivery,
                                                                 &lock_setting,
                                                                 &local_gpuav_settings,
-                                                                &local_printf_settings};
+                                                                &local_printf_settings,
+                                                                &local_syncval_settings,
+                                                                &local_call_profile_file,
+                                                                &local_trace_file,
+                                                                &local_queue_retire_threads,
+                                                                &local_shader_validation_cache_path,
+                                                                &local_shader_validation_threads,
+                                                                &local_worker_threads,
+                                                                &local_worker_thread_affinity,
+                                                                &local_frame_sampling_interval,
+                                                                &local_frame_sampling_time_budget,
+                                                                &local_skipped_validate_calls,
+                                                                &local_allocator_kind,
+                                                                &local_allocation_statistics,
+                                                                &local_allocation_statistics_period};
                 ProcessConfigAndEnvSettings(&config_and_env_settings_data);
                 LayerDebugMessengerActions(debug_report, OBJECT_LAYER_DESCRIPTION);
 
@@ -1111,6 +1398,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 if (local_disables[handle_wrapping]) {
                     wrap_handles = false;
                 }
+                unique_id_mapping.UseSlabIds(local_enables[unique_handles_slab]);
 
                 // Initialize the validation objects
                 for (auto* intercept : local_object_dispatch) {
@@ -1132,7 +1420,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 bool skip = false;
                 ErrorObject error_obj(vvl::Func::vkCreateInstance, VulkanTypedHandle());
                 for (const ValidationObject* intercept : local_object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->ReadLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallValidate, error_obj.location.function);
                     skip |= intercept->PreCallValidateCreateInstance(pCreateInfo, pAllocator, pInstance, error_obj);
                     if (skip) {
                         cleanup_allocations();
@@ -1142,7 +1431,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkCreateInstance);
                 for (ValidationObject* intercept : local_object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallRecord, record_obj.location.function);
                     intercept->PreCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance, record_obj);
                 }
 
@@ -1161,6 +1451,21 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 framework->fine_grained_locking = lock_setting;
                 framework->gpuav_settings = local_gpuav_settings;
                 framework->printf_settings = local_printf_settings;
+                framework->syncval_settings = local_syncval_settings;
+                framework->call_profile_file = local_call_profile_file;
+                framework->trace_file = local_trace_file;
+                framework->queue_retire_threads = local_queue_retire_threads;
+                framework->shader_validation_cache_path = local_shader_validation_cache_path;
+                framework->shader_validation_threads = local_shader_validation_threads;
+                framework->worker_threads = local_worker_threads;
+                framework->worker_thread_affinity = local_worker_thread_affinity;
+                framework->frame_sampling_interval = local_frame_sampling_interval;
+                framework->frame_sampling_time_budget = local_frame_sampling_time_budget;
+                framework->skipped_validate_calls = local_skipped_validate_calls;
+                framework->allocation_statistics = local_allocation_statistics;
+                // Process wide, the allocations of the instances created before keep track of where they came from
+                vvl::SetAllocatorKind(local_allocator_kind);
+                vvl::SetAllocationReportPeriod(local_allocation_statistics_period);
 
                 framework->instance = *pInstance;
                 layer_init_instance_dispatch_table(*pInstance, &framework->instance_dispatch_table, fpGetInstanceProcAddr);
@@ -1174,6 +1479,17 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 OutputLayerStatusInfo(framework);
 
+                // One recorder for the process, the devices of every instance write their spans to the same file
+                if (!framework->trace_file.empty()) {
+                    framework->tracer = vvl::TraceRecorder::GetShared(framework->trace_file);
+                    if (!framework->tracer->IsOpen()) {
+                        framework->LogWarning(kVUIDUndefined, framework->instance, record_obj.location,
+                                              "Can not open the trace file %s, tracing is disabled.",
+                                              framework->tracer->GetOutputFile().c_str());
+                        framework->tracer.reset();
+                    }
+                }
+
                 for (auto* intercept : framework->object_dispatch) {
                     intercept->instance_dispatch_table = framework->instance_dispatch_table;
                     intercept->enabled = framework->enabled;
@@ -1181,11 +1497,22 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     intercept->fine_grained_locking = framework->fine_grained_locking;
                     intercept->gpuav_settings = framework->gpuav_settings;
                     intercept->printf_settings = framework->printf_settings;
+                    intercept->syncval_settings = framework->syncval_settings;
+                    intercept->call_profile_file = framework->call_profile_file;
+                    intercept->trace_file = framework->trace_file;
+                    intercept->tracer = framework->tracer;
+                    intercept->queue_retire_threads = framework->queue_retire_threads;
+                    intercept->shader_validation_cache_path = framework->shader_validation_cache_path;
+                    intercept->shader_validation_threads = framework->shader_validation_threads;
+                    intercept->worker_threads = framework->worker_threads;
+                    intercept->worker_thread_affinity = framework->worker_thread_affinity;
                     intercept->instance = *pInstance;
+                    intercept->UpdateObjectLockRequired();
                 }
 
                 for (ValidationObject* intercept : framework->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPostCallRecord, record_obj.location.function);
                     intercept->PostCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance, record_obj);
                 }
 
@@ -1201,20 +1528,23 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 ErrorObject error_obj(vvl::Func::vkDestroyInstance, VulkanTypedHandle(instance, kVulkanObjectTypeInstance));
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->ReadLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallValidate, error_obj.location.function);
                     intercept->PreCallValidateDestroyInstance(instance, pAllocator, error_obj);
                 }
 
                 RecordObject record_obj(vvl::Func::vkDestroyInstance);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallRecord, record_obj.location.function);
                     intercept->PreCallRecordDestroyInstance(instance, pAllocator, record_obj);
                 }
 
                 layer_data->instance_dispatch_table.DestroyInstance(instance, pAllocator);
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPostCallRecord, record_obj.location.function);
                     intercept->PostCallRecordDestroyInstance(instance, pAllocator, record_obj);
                 }
 
@@ -1223,10 +1553,15 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 LayerDebugUtilsDestroyInstance(layer_data->debug_report);
 
+                const bool allocation_statistics = layer_data->allocation_statistics;
                 for (auto item = layer_data->object_dispatch.begin(); item != layer_data->object_dispatch.end(); item++) {
                     delete *item;
                 }
                 FreeLayerDataPtr(key, layer_data_map);
+
+                if (allocation_statistics) {
+                    printf("Validation Allocation Statistics\\n%s", vvl::FormatAllocationStatistics().c_str());
+                }
             }
 
             VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDeviceCreateInfo* pCreateInfo,
@@ -1261,14 +1596,16 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 bool skip = false;
                 ErrorObject error_obj(vvl::Func::vkCreateDevice, VulkanTypedHandle(gpu, kVulkanObjectTypePhysicalDevice));
                 for (const ValidationObject* intercept : instance_interceptor->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->ReadLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallValidate, error_obj.location.function);
                     skip |= intercept->PreCallValidateCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
 
                 RecordObject record_obj(vvl::Func::vkCreateDevice);
                 for (ValidationObject* intercept : instance_interceptor->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallRecord, record_obj.location.function);
                     intercept->PreCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, record_obj, &modified_create_info);
                 }
 
@@ -1292,11 +1629,36 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 device_interceptor->physical_device = gpu;
                 device_interceptor->instance = instance_interceptor->instance;
                 device_interceptor->debug_report = instance_interceptor->debug_report;
+                device_interceptor->skipped_validate_calls = instance_interceptor->skipped_validate_calls;
+                device_interceptor->allocation_statistics = instance_interceptor->allocation_statistics;
 
                 instance_interceptor->debug_report->device_created++;
 
                 InitDeviceObjectDispatch(instance_interceptor, device_interceptor);
 
+                // All the objects of the device share one profiler, each one counts in the slots of its container_type
+                if (!instance_interceptor->call_profile_file.empty()) {
+                    device_interceptor->call_profiler =
+                        std::make_shared<vvl::CallProfiler>(instance_interceptor->call_profile_file, LayerObjectTypeMaxEnum);
+                    for (uint32_t type_id = 0; type_id < LayerObjectTypeMaxEnum; ++type_id) {
+                        device_interceptor->call_profiler->SetObjectName(type_id, LayerObjectTypeName(LayerObjectTypeId(type_id)));
+                    }
+                }
+                device_interceptor->tracer = instance_interceptor->tracer;
+                // One pool for the whole layer, the objects of every device split their work on the same threads
+                if (instance_interceptor->worker_threads > 0) {
+                    device_interceptor->worker_pool =
+                        vvl::WorkerPool::GetShared(instance_interceptor->worker_threads, instance_interceptor->worker_thread_affinity);
+                }
+                if (instance_interceptor->queue_retire_threads > 0) {
+                    device_interceptor->queue_retire_pool = std::make_shared<vvl::QueueRetirePool>(instance_interceptor->queue_retire_threads);
+                }
+                // Built before the intercept vectors, which are then also built without the sampled objects
+                if (instance_interceptor->frame_sampling_interval > 1 || instance_interceptor->frame_sampling_time_budget > 0) {
+                    device_interceptor->frame_sampler = std::make_shared<vvl::FrameSampler>(instance_interceptor->frame_sampling_interval,
+                                                                                            instance_interceptor->frame_sampling_time_budget);
+                }
+
                 // Initialize all of the objects with the appropriate data
                 for (auto* object : device_interceptor->object_dispatch) {
                     object->device = device_interceptor->device;
@@ -1310,13 +1672,32 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     object->fine_grained_locking = instance_interceptor->fine_grained_locking;
                     object->gpuav_settings = instance_interceptor->gpuav_settings;
                     object->printf_settings = instance_interceptor->printf_settings;
+                    object->syncval_settings = instance_interceptor->syncval_settings;
+                    object->call_profile_file = instance_interceptor->call_profile_file;
+                    object->trace_file = instance_interceptor->trace_file;
+                    object->queue_retire_threads = instance_interceptor->queue_retire_threads;
+                    object->shader_validation_cache_path = instance_interceptor->shader_validation_cache_path;
+                    object->shader_validation_threads = instance_interceptor->shader_validation_threads;
+                    object->worker_threads = instance_interceptor->worker_threads;
+                    object->worker_thread_affinity = instance_interceptor->worker_thread_affinity;
+                    object->call_profiler = device_interceptor->call_profiler;
+                    object->tracer = device_interceptor->tracer;
+                    object->worker_pool = device_interceptor->worker_pool;
+                    object->queue_retire_pool = device_interceptor->queue_retire_pool;
                     object->instance_dispatch_table = instance_interceptor->instance_dispatch_table;
                     object->instance_extensions = instance_interceptor->instance_extensions;
                     object->device_extensions = device_interceptor->device_extensions;
+                    object->UpdateObjectLockRequired();
                 }
 
+                // This is where each object sets itself up for the new device, the instance objects have no profiler so the time is
+                // counted in the device profiler to report the startup cost of each object
                 for (ValidationObject* intercept : instance_interceptor->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = device_interceptor->call_profiler
+                                       ? device_interceptor->call_profiler->Begin(intercept->container_type, record_obj.location.function,
+                                                                                  vvl::CallProfiler::kPostCallRecord)
+                                       : vvl::CallProfiler::Scope();
                     intercept->PostCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, record_obj);
                 }
 
@@ -1336,25 +1717,42 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 auto layer_data = GetLayerDataPtr(key, layer_data_map);
                 ErrorObject error_obj(vvl::Func::vkCreateDevice, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->ReadLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallValidate, error_obj.location.function);
                     intercept->PreCallValidateDestroyDevice(device, pAllocator, error_obj);
                 }
 
                 RecordObject record_obj(vvl::Func::vkDestroyDevice);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallRecord, record_obj.location.function);
                     intercept->PreCallRecordDestroyDevice(device, pAllocator, record_obj);
                 }
 
                 layer_data->device_dispatch_table.DestroyDevice(device, pAllocator);
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPostCallRecord, record_obj.location.function);
                     intercept->PostCallRecordDestroyDevice(device, pAllocator, record_obj);
                 }
 
                 auto instance_interceptor = GetLayerDataPtr(GetDispatchKey(layer_data->physical_device), layer_data_map);
                 instance_interceptor->debug_report->device_created--;
+                // Messages about the device must reach the application before its objects go away
+                instance_interceptor->debug_report->FlushMessages();
+
+                if (layer_data->call_profiler) {
+                    layer_data->call_profiler->Report(layer_data->FormatHandle(device).c_str());
+                }
+                if (layer_data->tracer) {
+                    layer_data->tracer->Flush();
+                }
+                // What the layer holds right before the objects of the device are torn down
+                if (layer_data->allocation_statistics) {
+                    printf("Validation Allocation Statistics at vkDestroyDevice of %s\\n%s", layer_data->FormatHandle(device).c_str(),
+                           vvl::FormatAllocationStatistics().c_str());
+                }
 
                 for (auto item = layer_data->object_dispatch.begin(); item != layer_data->object_dispatch.end(); item++) {
                     delete *item;
@@ -1376,7 +1774,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 chassis_state.pCreateInfos = pCreateInfos;
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->ReadLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallValidate, error_obj.location.function);
                     skip |= intercept->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                             pPipelines, error_obj, pipeline_states[intercept->container_type], chassis_state);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1384,7 +1783,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkCreateGraphicsPipelines);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallRecord, record_obj.location.function);
                     intercept->PreCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                     pPipelines, record_obj, pipeline_states[intercept->container_type], chassis_state);
                 }
@@ -1394,7 +1794,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPostCallRecord, record_obj.location.function);
                     intercept->PostCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                     pPipelines, record_obj, pipeline_states[intercept->container_type], chassis_state);
                 }
@@ -1414,7 +1815,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 chassis_state.pCreateInfos = pCreateInfos;
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->ReadLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallValidate, error_obj.location.function);
                     skip |= intercept->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                             pPipelines, error_obj, pipeline_states[intercept->container_type], chassis_state);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1422,7 +1824,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkCreateComputePipelines);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallRecord, record_obj.location.function);
                     intercept->PreCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, record_obj,
                                                                 pipeline_states[intercept->container_type], chassis_state);
                 }
@@ -1432,7 +1835,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPostCallRecord, record_obj.location.function);
                     intercept->PostCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                     pPipelines, record_obj, pipeline_states[intercept->container_type], chassis_state);
                 }
@@ -1451,7 +1855,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 chassis_state.pCreateInfos = pCreateInfos;
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->ReadLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallValidate, error_obj.location.function);
                     skip |=
                         intercept->PreCallValidateCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                             pPipelines, error_obj, pipeline_states[intercept->container_type], chassis_state);
@@ -1460,7 +1865,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkCreateRayTracingPipelinesNV);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallRecord, record_obj.location.function);
                     intercept->PreCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                         pPipelines, record_obj, pipeline_states[intercept->container_type], chassis_state);
                 }
@@ -1470,7 +1876,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPostCallRecord, record_obj.location.function);
                     intercept->PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                         pPipelines, record_obj, pipeline_states[intercept->container_type], chassis_state);
                 }
@@ -1490,7 +1897,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 chassis_state.pCreateInfos = pCreateInfos;
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->ReadLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallValidate, error_obj.location.function);
                     skip |= intercept->PreCallValidateCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount,
                                                                                 pCreateInfos, pAllocator, pPipelines, error_obj,
                                                                                 pipeline_states[intercept->container_type], chassis_state);
@@ -1499,7 +1907,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkCreateRayTracingPipelinesKHR);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallRecord, record_obj.location.function);
                     intercept->PreCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount,
                                                                         pCreateInfos, pAllocator, pPipelines, record_obj,
                                                                         pipeline_states[intercept->container_type], chassis_state);
@@ -1511,7 +1920,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPostCallRecord, record_obj.location.function);
                     intercept->PostCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount,
                                                                         pCreateInfos, pAllocator, pPipelines, record_obj,
                                                                         pipeline_states[intercept->container_type], chassis_state);
@@ -1527,7 +1937,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 ErrorObject error_obj(vvl::Func::vkCreatePipelineLayout, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
 
                 for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePipelineLayout]) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->ReadLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallValidate, error_obj.location.function);
                     skip |= intercept->PreCallValidateCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
@@ -1537,7 +1948,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkCreatePipelineLayout);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallRecord, record_obj.location.function);
                     intercept->PreCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, record_obj, chassis_state);
                 }
 
@@ -1545,7 +1957,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreatePipelineLayout]) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPostCallRecord, record_obj.location.function);
                     intercept->PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, record_obj);
                 }
                 return result;
@@ -1559,7 +1972,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 ErrorObject error_obj(vvl::Func::vkCreateShaderModule, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->ReadLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallValidate, error_obj.location.function);
                     skip |= intercept->PreCallValidateCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
@@ -1569,7 +1983,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkCreateShaderModule);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallRecord, record_obj.location.function);
                     intercept->PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, record_obj, chassis_state);
                 }
 
@@ -1580,7 +1995,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPostCallRecord, record_obj.location.function);
                     intercept->PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, record_obj, chassis_state);
                 }
                 return result;
@@ -1600,14 +2016,16 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 chassis::ShaderObject chassis_state(createInfoCount, new_shader_create_infos.data());
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->ReadLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallValidate, error_obj.location.function);
                     skip |= intercept->PreCallValidateCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
 
                 RecordObject record_obj(vvl::Func::vkCreateShadersEXT);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallRecord, record_obj.location.function);
                     intercept->PreCallRecordCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, record_obj, chassis_state);
                 }
 
@@ -1618,7 +2036,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPostCallRecord, record_obj.location.function);
                     intercept->PostCallRecordCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, record_obj,
                                                             chassis_state);
                 }
@@ -1635,7 +2054,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
                     ads_state[intercept->container_type].Init(pAllocateInfo->descriptorSetCount);
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->ReadLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallValidate, error_obj.location.function);
                     skip |= intercept->PreCallValidateAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, error_obj,
                                                                             ads_state[intercept->container_type]);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1643,7 +2063,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkAllocateDescriptorSets);
                 for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAllocateDescriptorSets]) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallRecord, record_obj.location.function);
                     intercept->PreCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, record_obj);
                 }
 
@@ -1651,7 +2072,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPostCallRecord, record_obj.location.function);
                     intercept->PostCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, record_obj,
                                                                     ads_state[intercept->container_type]);
                 }
@@ -1666,7 +2088,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 ErrorObject error_obj(vvl::Func::vkCreateBuffer, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
 
                 for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateBuffer]) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->ReadLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallValidate, error_obj.location.function);
                     skip |= intercept->PreCallValidateCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
@@ -1676,7 +2099,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkCreateBuffer);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallRecord, record_obj.location.function);
                     intercept->PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, record_obj, chassis_state);
                 }
 
@@ -1684,7 +2108,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreateBuffer]) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPostCallRecord, record_obj.location.function);
                     intercept->PostCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, record_obj);
                 }
                 return result;
@@ -1702,14 +2127,16 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 ErrorObject error_obj(vvl::Func::vkBeginCommandBuffer, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer),
                                     &handle_data);
                 for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBeginCommandBuffer]) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->ReadLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallValidate, error_obj.location.function);
                     skip |= intercept->PreCallValidateBeginCommandBuffer(commandBuffer, pBeginInfo, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
 
                 RecordObject record_obj(vvl::Func::vkBeginCommandBuffer, &handle_data);
                 for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordBeginCommandBuffer]) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallRecord, record_obj.location.function);
                     intercept->PreCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, record_obj);
                 }
 
@@ -1717,7 +2144,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordBeginCommandBuffer]) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPostCallRecord, record_obj.location.function);
                     intercept->PostCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, record_obj);
                 }
                 return result;
@@ -1750,7 +2178,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 }
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->ReadLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallValidate, error_obj.location.function);
                     skip |=
                         intercept->PreCallValidateGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1758,7 +2187,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkGetPhysicalDeviceToolPropertiesEXT);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallRecord, record_obj.location.function);
                     intercept->PreCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, record_obj);
                 }
 
@@ -1772,7 +2202,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 (*pToolCount)++;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPostCallRecord, record_obj.location.function);
                     intercept->PostCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, record_obj);
                 }
                 return result;
@@ -1794,7 +2225,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 }
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->ReadLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallValidate, error_obj.location.function);
                     skip |=
                         intercept->PreCallValidateGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1802,7 +2234,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkGetPhysicalDeviceToolProperties);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallRecord, record_obj.location.function);
                     intercept->PreCallRecordGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties, record_obj);
                 }
 
@@ -1816,7 +2249,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 (*pToolCount)++;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->WriteLockIfRequired();
+                    auto profile = intercept->ProfileCall(vvl::CallProfiler::kPostCallRecord, record_obj.location.function);
                     intercept->PostCallRecordGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties, record_obj);
                 }
                 return result;
@@ -1829,7 +2263,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                                                                     VkValidationCacheEXT* pValidationCache) {
                 auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
                 if (auto core_checks = layer_data->GetValidationObject<CoreChecks>()) {
-                    auto lock = core_checks->WriteLock();
+                    auto lock = core_checks->WriteLockIfRequired();
                     return core_checks->CoreLayerCreateValidationCacheEXT(device, pCreateInfo, pAllocator, pValidationCache);
                 }
                 return VK_SUCCESS;
@@ -1839,7 +2273,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                                                                 const VkAllocationCallbacks* pAllocator) {
                 auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
                 if (auto core_checks = layer_data->GetValidationObject<CoreChecks>()) {
-                    auto lock = core_checks->WriteLock();
+                    auto lock = core_checks->WriteLockIfRequired();
                     core_checks->CoreLayerDestroyValidationCacheEXT(device, validationCache, pAllocator);
                 }
             }
@@ -1848,7 +2282,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                                                                     const VkValidationCacheEXT* pSrcCaches) {
                 auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
                 if (auto core_checks = layer_data->GetValidationObject<CoreChecks>()) {
-                    auto lock = core_checks->WriteLock();
+                    auto lock = core_checks->WriteLockIfRequired();
                     return core_checks->CoreLayerMergeValidationCachesEXT(device, dstCache, srcCacheCount, pSrcCaches);
                 }
                 return VK_SUCCESS;
@@ -1858,7 +2292,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                                                                     void* pData) {
                 auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
                 if (auto core_checks = layer_data->GetValidationObject<CoreChecks>()) {
-                    auto lock = core_checks->WriteLock();
+                    auto lock = core_checks->WriteLockIfRequired();
                     return core_checks->CoreLayerGetValidationCacheDataEXT(device, validationCache, pDataSize, pData);
                 }
                 return VK_SUCCESS;
@@ -1894,12 +2328,16 @@ class LayerChassisOutputGenerator(BaseGenerator):
             out.append(f'ErrorObject error_obj(vvl::Func::{command.name}, VulkanTypedHandle({command.params[0].name}, kVulkanObjectType{command.params[0].type[2:]}));\n')
 
             # Generate pre-call validation source code
-            if not command.instance:
+            if command.name.startswith('vkCmd'):
+                # Recording commands can leave out the sampled objects, see FrameSampler
+                out.append(f'for (const ValidationObject* intercept : layer_data->CommandValidateIntercepts(InterceptIdPreCallValidate{command.name[2:]})) {{\n')
+            elif not command.instance:
                 out.append(f'for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidate{command.name[2:]}]) {{\n')
             else:
                 out.append('for (const ValidationObject* intercept : layer_data->object_dispatch) {\n')
             out.append(f'''
-                auto lock = intercept->ReadLock();
+                auto lock = intercept->ReadLockIfRequired();
+                auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallValidate, error_obj.location.function);
                     skip |= intercept->PreCallValidate{command.name[2:]}({paramsList}, error_obj);
                     if (skip) {return_map[command.returnType]}
                 }}\n''')
@@ -1911,7 +2349,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
             else:
                 out.append('for (ValidationObject* intercept : layer_data->object_dispatch) {\n')
             out.append(f'''
-                auto lock = intercept->WriteLock();
+                auto lock = intercept->WriteLockIfRequired();
+                auto profile = intercept->ProfileCall(vvl::CallProfiler::kPreCallRecord, record_obj.location.function);
                 intercept->PreCallRecord{command.name[2:]}({paramsList}, record_obj);
             }}\n''')
 
@@ -1941,6 +2380,12 @@ class LayerChassisOutputGenerator(BaseGenerator):
             if command.name in post_dispatch_debug_utils_functions:
                 out.append(f'    {post_dispatch_debug_utils_functions[command.name]}\n')
 
+            # Each present ends a frame of the frame sampling
+            if command.name == 'vkQueuePresentKHR':
+                out.append('if (layer_data->frame_sampler) {\n')
+                out.append('    layer_data->frame_sampler->NextFrame();\n')
+                out.append('}\n')
+
             if command.returnType == 'VkResult':
                 out.append('record_obj.result = result;\n')
             elif command.returnType == 'VkDeviceAddress':
@@ -1967,9 +2412,10 @@ class LayerChassisOutputGenerator(BaseGenerator):
             ]
 
             if command.name not in commands_with_blocking_operations:
-                out.append('auto lock = intercept->WriteLock();\n')
+                out.append('auto lock = intercept->WriteLockIfRequired();\n')
             else:
                 out.append('ValidationObject::BlockingOperationGuard lock(intercept);\n')
+            out.append('auto profile = intercept->ProfileCall(vvl::CallProfiler::kPostCallRecord, record_obj.location.function);\n')
 
             # Because each intercept is a copy of ValidationObject, we need to update it for each
             if command.errorCodes and 'VK_ERROR_DEVICE_LOST' in command.errorCodes:
@@ -2001,6 +2447,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                         }
                     }
                 ''')
+            elif command.name == 'vkDeviceWaitIdle':
+                out.append('layer_data->debug_report->FlushMessages();\n')
             elif command.name == 'vkDestroyCommandPool':
                 out.append('''
                     {
@@ -2163,11 +2611,33 @@ const vvl::unordered_map<std::string, function_data> name_to_funcptr_map = {
         for command in [x for x in self.vk.commands.values() if not x.instance and x.name not in skip_intercept_id_functions]:
             out.extend(guard_helper.add_guard(command.protect))
             if command.name not in skip_intercept_id_pre_validate:
-                out.append(f'    BUILD_DISPATCH_VECTOR(PreCallValidate{command.name[2:]});\n')
+                if command.name.startswith('vkCmd'):
+                    out.append(f'    BUILD_COMMAND_VALIDATE_DISPATCH_VECTOR({command.name[2:]});\n')
+                else:
+                    out.append(f'    BUILD_VALIDATE_DISPATCH_VECTOR({command.name[2:]});\n')
             if command.name not in skip_intercept_id_pre_record:
                 out.append(f'    BUILD_DISPATCH_VECTOR(PreCallRecord{command.name[2:]});\n')
             if command.name not in skip_intercept_id_post_record:
                 out.append(f'    BUILD_DISPATCH_VECTOR(PostCallRecord{command.name[2:]});\n')
         out.extend(guard_helper.add_guard(None))
-        out.append('}\n')
+        out.append('''
+    intercept_vectors.Assign(intercept_lists);
+
+    // Between the sampled frames the recording commands are only validated by the objects whose checks are cheap, the state
+    // is still recorded by all of them
+    if (frame_sampler) {
+        for (const InterceptId id : command_validate_ids) {
+            auto& list = intercept_lists[id];
+            list.erase(std::remove_if(list.begin(), list.end(),
+                                      [](const ValidationObject* object) {
+                                          return object->container_type == LayerObjectTypeCoreValidation ||
+                                                 object->container_type == LayerObjectTypeBestPractices ||
+                                                 object->container_type == LayerObjectTypeSyncValidation;
+                                      }),
+                       list.end());
+        }
+        unsampled_intercept_vectors.Assign(intercept_lists);
+    }
+}
+''')
         self.write("".join(out))
@@ -73,7 +73,8 @@ class StateTrackerHelperOutputGenerator(BaseGenerator):
             dictionary[name] = set()
         dictionary[name].add(value)
 
-    def generateHeader(self):
+    # Returns (origins, feature) of every member of DeviceFeatures, in the order they are declared
+    def getFeatures(self):
         # Map feature names to structs that have them
         featureMap = dict()
         for struct, info in self.vk.structs.items():
@@ -90,21 +91,55 @@ class StateTrackerHelperOutputGenerator(BaseGenerator):
 
         # Generate a comment for every feature regarding where it may be coming from, then sort the
         # features by that comment.  That ensures features of the same struct end up together.
-        featuresAndOrigins = sorted([(', '.join(sorted(structs)), feature)
-                                     for feature, structs in featureMap.items()])
+        return sorted([(', '.join(sorted(structs)), feature) for feature, structs in featureMap.items()])
+
+    def generateHeader(self):
+        featuresAndOrigins = self.getFeatures()
 
         out = []
         out.append('''
             #pragma once
 
+            #include <cstdint>
+            #include <initializer_list>
+
+            #include "containers/fixed_bitset.h"
+
+            // One value per member of DeviceFeatures, in the same order
+            enum class DeviceFeature : uint16_t {
+            ''')
+        for _, feature in featuresAndOrigins:
+            out.append(f'{feature},\n')
+        out.append(f'''}};
+            // Number of DeviceFeature values
+            constexpr uint32_t kDeviceFeatureCount = {len(featuresAndOrigins)};
+
+            // One bit per DeviceFeature, see DeviceFeatures::bits
+            using DeviceFeatureBits = vvl::FixedBitset<((kDeviceFeatureCount + 63) / 64) * 64>;
+
+            constexpr DeviceFeatureBits MakeDeviceFeatureBits(std::initializer_list<DeviceFeature> features) {{
+                DeviceFeatureBits bits;
+                for (const DeviceFeature feature : features) {{
+                    bits.set(static_cast<size_t>(feature));
+                }}
+                return bits;
+            }}
+
             // Union of all features defined in VkPhysicalDevice*Features* structs
-            struct DeviceFeatures {
+            struct DeviceFeatures {{
             ''')
         for origins, feature in featuresAndOrigins:
             out.append(f'// {origins}\n')
             out.append(f'bool {feature};\n')
 
-        out.append('''};
+        out.append('''
+            // The features above packed in a couple of cache lines. Checks that need several features test them all at once
+            // against a constexpr mask, with one AND per word, ex. enabled_features.IsAnyEnabled(kNullIndexBufferFeatures)
+            DeviceFeatureBits bits;
+
+            bool IsAllEnabled(const DeviceFeatureBits &mask) const { return mask.AndNot(bits).none(); }
+            bool IsAnyEnabled(const DeviceFeatureBits &mask) const { return bits.Intersects(mask); }
+            };
 
             void GetEnabledDeviceFeatures(const VkDeviceCreateInfo *pCreateInfo, DeviceFeatures *features, const APIVersion &api_version);
             ''')
@@ -210,6 +245,15 @@ class StateTrackerHelperOutputGenerator(BaseGenerator):
                 if (api_version >= VK_API_VERSION_1_3) {
                     features->texelBufferAlignment = true;
                 }
+
+                static constexpr bool DeviceFeatures::*kFeatureMembers[] = {
+            ''')
+        out.extend([f'&DeviceFeatures::{feature},\n' for _, feature in self.getFeatures()])
+        out.append('''};
+                static_assert(std::size(kFeatureMembers) == kDeviceFeatureCount);
+                for (uint32_t i = 0; i < kDeviceFeatureCount; ++i) {
+                    features->bits.set(i, features->*kFeatureMembers[i]);
+                }
             }
             ''')
 
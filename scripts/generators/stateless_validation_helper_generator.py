@@ -235,6 +235,7 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
 
         # Map of structs type names to generated validation code for that struct type
         self.validatedStructs = dict()
+        self.noValidationLine = '// No xml-driven validation\n'
         # Map of flags typenames
         self.flags = set()
         # Map of flag bits typename to list of values
@@ -349,7 +350,8 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
         for struct in self.vk.structs.values():
             # The string returned will be nested in an if check for a NULL pointer, so needs its indent incremented
             lines = self.genFuncBody(self.vk.structs[struct.name].members, '{funcName}', '{errorLoc}', '{valuePrefix}', '{displayNamePrefix}', struct.name, False)
-            if lines:
+            # Structs without any xml-driven validation are left out, so no empty loops get expanded for them
+            if lines and lines != [self.noValidationLine]:
                 self.validatedStructs[struct.name] = lines
 
         out = []
@@ -883,9 +885,11 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
                             indexName = length.replace('Count', 'Index')
                             # If the length value is a pointer, de-reference it for the count.
                             deref = '*' if lengthMember.pointer else ''
+                            # Built once, only its index changes for each element
+                            expr.append(f'[[maybe_unused]] Location {newErrorLoc} = {errorLoc}.dot(Field::{member.name});\n')
                             expr.append(f'for (uint32_t {indexName} = 0; {indexName} < {deref}{valuePrefix}{length}; ++{indexName})\n')
                             expr.append('{\n')
-                            expr.append(f'[[maybe_unused]] const Location {newErrorLoc} = {errorLoc}.dot(Field::{member.name}, {indexName});')
+                            expr.append(f'{newErrorLoc}.index = {indexName};')
                             # Prefix for value name to display in error message
                             connector = '->' if member.cDeclaration.count('*') == 2 else '.'
                             memberNamePrefix = f'{valuePrefix}{member.name}[{indexName}]{connector}'
@@ -974,7 +978,7 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
 
                 lines += usedLines
         if not lines:
-            lines.append('// No xml-driven validation\n')
+            lines.append(self.noValidationLine)
         return lines
 
     # This logic was broken into its own function because we need to fill multiple functions with these structs
@@ -219,7 +219,6 @@ class TestIcdGenerator(BaseGenerator):
                 out.append(f'{returnName}{command.alias[2:]}({params});')
             elif 'vkCreate' in command.name or 'vkAllocate' in command.name:
                 last_param = command.params[-1]
-                out.append('unique_lock_t lock(global_lock);\n')
                 if (last_param.length):
                     out.append(f'for (uint32_t i = 0; i < {last_param.length}; ++i) {{\n')
                     out.append(f'{last_param.name}[i] = ({last_param.type})global_unique_handle++;\n')
@@ -222,12 +222,16 @@ class ThreadSafetyOutputGenerator(BaseGenerator):
                                 if candidate.pointer:
                                     dereference = '*'
                         param_len = param.length.replace("::", "->")
-                        out.append(f'''
-                            if ({param.name}) {{
-                                for (uint32_t index = 0; index < {dereference}{param.length}; index++) {{
-                                    {prefix}ReadObject{GetParentInstance(param)}({param.name}[index], record_obj.location);
-                                }}
-                            }}\n''')
+                        if GetParentInstance(param):
+                            out.append(f'''
+                                if ({param.name}) {{
+                                    for (uint32_t index = 0; index < {dereference}{param.length}; index++) {{
+                                        {prefix}ReadObject{GetParentInstance(param)}({param.name}[index], record_obj.location);
+                                    }}
+                                }}\n''')
+                        else:
+                            # Arrays are looked up as one batch
+                            out.append(f'{prefix}ReadObjects({param.name}, {dereference}{param.length}, record_obj.location);\n')
                     elif not param.pointer:
                         # Pointer params are often being created.
                         # They are not being read from.
@@ -87,6 +87,9 @@ class ValidEnumValuesOutputGenerator(BaseGenerator):
             //
             //  Another key point to consider is being able to tell the user a value is invalid because it "doesn't exist" vs
             //  "forgot to enable an extension" is VERY important
+            //
+            //  The values of the core token block (below kValidEnumTableSize) are the ones checked the most, so
+            //  InitValidEnumTables precomputes them at vkCreateDevice and ValidateRangedEnum only comes here for the others.
 
             ''')
         guard_helper = PlatformGuardHelper()
@@ -125,6 +128,14 @@ class ValidEnumValuesOutputGenerator(BaseGenerator):
                 ''')
             out.extend(guard_helper.add_guard(None, extra_newline=True))
 
+        # Precompute the valid values of the core token block of every enum once the device extensions are known
+        out.append('void StatelessValidation::InitValidEnumTables() {\n')
+        for enum in [x for x in self.vk.enums.values() if x.name not in self.ignoreList and not x.returnedOnly]:
+            out.extend(guard_helper.add_guard(enum.protect))
+            out.append(f'    InitValidEnumTable<{enum.name}>(vvl::Enum::{enum.name});\n')
+        out.extend(guard_helper.add_guard(None))
+        out.append('}\n')
+
         # For those that had an extension on field, provide a way to get it to print a useful error message out
         for enum in [x for x in self.vk.enums.values() if x.name not in self.ignoreList and not x.returnedOnly]:
             out.extend(guard_helper.add_guard(enum.protect, extra_newline=True))
@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+# Copyright (c) 2024 The Khronos Group Inc.
+# Copyright (c) 2024 Valve Corporation
+# Copyright (c) 2024 LunarG, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Replays a GFXReconstruct capture through the Validation Layers of a build, on top of the VVL Test ICD, so an application
+# can be captured without any validation cost and validated offline (see docs/offline_validation.md).
+import argparse
+import collections
+import os
+import re
+import subprocess
+import sys
+
+# Matches the "[ VUID ]" of the messages of the default message format
+VUID_PATTERN = re.compile(r'^Validation (Error|Warning|Performance Warning|Information): \[ ([^\]]+) \]')
+
+def find_file(build_dir, relative_path):
+    path = os.path.join(build_dir, relative_path)
+    if not os.path.isfile(path):
+        sys.exit(f'Error: {path} not found, was {build_dir} built with -D BUILD_TESTS=ON?')
+    return path
+
+def replay_environment(args):
+    env = os.environ.copy()
+    icd_json = find_file(args.build_dir, os.path.join('tests', 'icd', 'VVL_Test_ICD.json'))
+    layer_dir = os.path.dirname(find_file(args.build_dir, os.path.join('layers', 'VkLayer_khronos_validation.json')))
+
+    env['VK_DRIVER_FILES'] = icd_json
+    # Loaders older than 1.3.207 only know the old name
+    env['VK_ICD_FILENAMES'] = icd_json
+    layer_path = [layer_dir] + ([env['VK_LAYER_PATH']] if env.get('VK_LAYER_PATH') else [])
+    env['VK_LAYER_PATH'] = os.pathsep.join(layer_path)
+
+    # The validation layer must be first so it sees the device the profile layer reports
+    layers = ['VK_LAYER_KHRONOS_validation']
+    if args.profile:
+        layers.append('VK_LAYER_KHRONOS_profiles')
+        env['VK_KHRONOS_PROFILES_PROFILE_FILE'] = os.path.abspath(args.profile)
+        env['VK_KHRONOS_PROFILES_SIMULATE_CAPABILITIES'] = ','.join([
+            'SIMULATE_API_VERSION_BIT', 'SIMULATE_FEATURES_BIT', 'SIMULATE_PROPERTIES_BIT', 'SIMULATE_EXTENSIONS_BIT',
+            'SIMULATE_FORMATS_BIT', 'SIMULATE_QUEUE_FAMILY_PROPERTIES_BIT'])
+        env['VK_KHRONOS_PROFILES_EMULATE_PORTABILITY'] = 'false'
+    env['VK_INSTANCE_LAYERS'] = os.pathsep.join(layers)
+
+    env['VK_KHRONOS_VALIDATION_DEBUG_ACTION'] = 'VK_DBG_LAYER_ACTION_LOG_MSG'
+    env['VK_KHRONOS_VALIDATION_LOG_FILENAME'] = os.path.abspath(args.log)
+    for setting in args.settings:
+        key, separator, value = setting.partition('=')
+        if not separator:
+            sys.exit(f'Error: -setting {setting} is not key=value')
+        env['VK_KHRONOS_VALIDATION_' + key.upper()] = value
+    return env
+
+def summarize(log_file, top):
+    counts = collections.Counter()
+    with open(log_file, encoding='utf-8', errors='replace') as file:
+        for line in file:
+            match = VUID_PATTERN.match(line)
+            if match:
+                counts[(match.group(1), match.group(2))] += 1
+    for (kind, vuid), count in counts.most_common(top):
+        print(f'{count:10} {kind:20} {vuid}')
+    if len(counts) > top:
+        print(f'... and {len(counts) - top} more, see {log_file}')
+    return sum(count for (kind, _), count in counts.items() if kind == 'Error')
+
+def main(argv):
+    parser = argparse.ArgumentParser(description='Validate a GFXReconstruct capture offline against the VVL Test ICD')
+    parser.add_argument('capture', help='.gfxr file written by the VK_LAYER_LUNARG_gfxreconstruct capture layer')
+    parser.add_argument('-build-dir', dest='build_dir', default='build',
+                        help='build directory of this repo, with the layer and the tests (default: build)')
+    parser.add_argument('-replay', default='gfxrecon-replay', help='gfxrecon-replay executable (default: from PATH)')
+    parser.add_argument('-profile', help='device profile the Test ICD reports through VK_LAYER_KHRONOS_profiles, '
+                        'ex. a vulkan.gpuinfo.org profile of the captured GPU or tests/device_profiles/max_profile.json')
+    parser.add_argument('-setting', dest='settings', action='append', default=[],
+                        help='validation setting as key=value, ex. -setting validate_sync=true (repeatable)')
+    parser.add_argument('-log', default='validation.txt', help='file the messages are written to (default: validation.txt)')
+    parser.add_argument('-top', type=int, default=25, help='number of message IDs in the summary (default: 25)')
+    parser.add_argument('replay_args', nargs=argparse.REMAINDER,
+                        help='extra gfxrecon-replay arguments after --, replacing the default ones')
+    args = parser.parse_args(argv)
+
+    # The memory types of the Test ICD rarely match the captured GPU: rebind places the resources in the replay memory
+    # types, and allocations that still fail are skipped instead of ending the replay. The Test ICD presents nothing.
+    replay_args = [arg for arg in args.replay_args if arg != '--']
+    if not replay_args:
+        replay_args = ['-m', 'rebind', '--sfa', '--remove-unsupported', '--wsi', 'headless']
+
+    if os.path.exists(args.log):
+        os.remove(args.log)
+    command = [args.replay] + replay_args + [args.capture]
+    print(' '.join(command))
+    result = subprocess.run(command, env=replay_environment(args), check=False)
+    if result.returncode != 0:
+        print(f'{args.replay} exited with {result.returncode}, the replay may have stopped early')
+
+    error_count = summarize(args.log, args.top) if os.path.exists(args.log) else 0
+    print(f'{error_count} validation errors')
+    sys.exit(1 if error_count or result.returncode != 0 else 0)
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "benchmark_helper.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <iomanip>
+
+namespace benchmark {
+
+const char *ValidationConfigName(ValidationConfig config) {
+    switch (config) {
+        case ValidationConfig::ChassisOnly:
+            return "ChassisOnly";
+        case ValidationConfig::CoreChecks:
+            return "CoreChecks";
+        case ValidationConfig::Stateless:
+            return "Stateless";
+        case ValidationConfig::ObjectLifetimes:
+            return "ObjectLifetimes";
+        case ValidationConfig::ThreadSafety:
+            return "ThreadSafety";
+        case ValidationConfig::SyncVal:
+            return "SyncVal";
+        case ValidationConfig::BestPractices:
+            return "BestPractices";
+        case ValidationConfig::All:
+            return "All";
+    }
+    return "Unknown";
+}
+
+static uint32_t GetRepetitionCount() {
+    const std::string repetitions = GetEnvironment("VVL_BENCHMARK_REPETITIONS");
+    if (!repetitions.empty()) {
+        const uint32_t count = static_cast<uint32_t>(std::strtoul(repetitions.c_str(), nullptr, 10));
+        if (count > 0) {
+            return count;
+        }
+    }
+    return 10;
+}
+
+Result Measure(uint32_t calls_per_repetition, const std::function<void(Stopwatch &)> &body) {
+    // The first round fills caches and lets the layer allocate its state, it is not representative of steady state
+    {
+        Stopwatch warm_up;
+        body(warm_up);
+    }
+
+    const uint32_t repetitions = GetRepetitionCount();
+    std::vector<double> ns_per_call;
+    ns_per_call.reserve(repetitions);
+    for (uint32_t i = 0; i < repetitions; ++i) {
+        Stopwatch stopwatch;
+        body(stopwatch);
+        ns_per_call.emplace_back(static_cast<double>(stopwatch.Elapsed().count()) / static_cast<double>(calls_per_repetition));
+    }
+
+    std::sort(ns_per_call.begin(), ns_per_call.end());
+    Result result;
+    result.min_ns_per_call = ns_per_call.front();
+    result.median_ns_per_call = ns_per_call[ns_per_call.size() / 2];
+    return result;
+}
+
+void Report(const char *entry_point, const Result &result) {
+    const ::testing::TestInfo *test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+    std::cout << "[ BENCH    ] " << test_info->test_suite_name() << "." << test_info->name() << " " << entry_point << " "
+              << std::fixed << std::setprecision(1) << "min " << result.min_ns_per_call << " ns/call, median "
+              << result.median_ns_per_call << " ns/call" << std::endl;
+
+    const std::string property = entry_point;
+    ::testing::Test::RecordProperty(property + "_min_ns", std::to_string(result.min_ns_per_call));
+    ::testing::Test::RecordProperty(property + "_median_ns", std::to_string(result.median_ns_per_call));
+}
+
+}  // namespace benchmark
+
+void VkBenchmark::InitBenchmark() {
+    using benchmark::ValidationConfig;
+    const ValidationConfig config = GetParam();
+
+    enables_.clear();
+    disables_.clear();
+    switch (config) {
+        case ValidationConfig::ChassisOnly:
+            disables_ = {VK_VALIDATION_FEATURE_DISABLE_ALL_EXT};
+            break;
+        case ValidationConfig::CoreChecks:
+            disables_ = {VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT,
+                         VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT};
+            break;
+        case ValidationConfig::Stateless:
+            disables_ = {VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT,
+                         VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT};
+            break;
+        case ValidationConfig::ObjectLifetimes:
+            disables_ = {VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT,
+                         VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT};
+            break;
+        case ValidationConfig::ThreadSafety:
+            disables_ = {VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT, VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT,
+                         VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT};
+            break;
+        case ValidationConfig::SyncVal:
+            enables_ = {VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION_EXT};
+            disables_ = {VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT,
+                         VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT, VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT};
+            break;
+        case ValidationConfig::BestPractices:
+            enables_ = {VK_VALIDATION_FEATURE_ENABLE_BEST_PRACTICES_EXT};
+            disables_ = {VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT,
+                         VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT, VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT};
+            break;
+        case ValidationConfig::All:
+            // GPU-AV and DebugPrintf need a real device to be meaningful, so "All" means every CPU side validation object
+            enables_ = {VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION_EXT, VK_VALIDATION_FEATURE_ENABLE_BEST_PRACTICES_EXT};
+            break;
+    }
+
+    features_ = vku::InitStructHelper();
+    features_.enabledValidationFeatureCount = static_cast<uint32_t>(enables_.size());
+    features_.pEnabledValidationFeatures = enables_.data();
+    features_.disabledValidationFeatureCount = static_cast<uint32_t>(disables_.size());
+    features_.pDisabledValidationFeatures = disables_.data();
+
+    // Breaks the time of the run down per validation object and entry point (call profile, one CSV per test) and prints
+    // the memory of each layer subsystem when the device is destroyed, to find out where a regression comes from
+    const std::string profile_dir = GetEnvironment("VVL_BENCHMARK_PROFILE_DIR");
+    if (!profile_dir.empty()) {
+        const ::testing::TestInfo *test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+        std::string test_name = std::string(test_info->test_suite_name()) + "." + test_info->name();
+        std::replace(test_name.begin(), test_name.end(), '/', '_');
+        profile_file_ = profile_dir + "/" + test_name + ".csv";
+        // The call profiler appends, a previous run must not be mixed in
+        std::remove(profile_file_.c_str());
+        profile_file_value_ = profile_file_.c_str();
+
+        profile_settings_ = {
+            {OBJECT_LAYER_NAME, "call_profile_file", VK_LAYER_SETTING_TYPE_STRING_EXT, 1, &profile_file_value_},
+            {OBJECT_LAYER_NAME, "allocation_statistics", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &allocation_statistics_},
+        };
+        profile_settings_info_ = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr,
+                                  static_cast<uint32_t>(profile_settings_.size()), profile_settings_.data()};
+        features_.pNext = &profile_settings_info_;
+    }
+
+    RETURN_IF_SKIP(InitFramework(&features_));
+    if (!IsPlatformMockICD()) {
+        GTEST_SKIP() << "Benchmarks are only meaningful against the Test ICD, set VK_DRIVER_FILES to " << VVL_BENCHMARK_ICD_JSON;
+    }
+    RETURN_IF_SKIP(InitState());
+}
+
+benchmark::Result VkBenchmark::MeasureReplay(const benchmark::ApiStream &stream) {
+    return benchmark::Measure(stream.Size(), [&](benchmark::Stopwatch &stopwatch) {
+        stopwatch.Start();
+        m_command_buffer.begin();
+        stream.Replay(m_command_buffer.handle());
+        m_command_buffer.end();
+        m_default_queue->Submit(m_command_buffer);
+        stopwatch.Stop();
+        m_default_queue->Wait();
+    });
+}
+
+std::string BenchmarkConfigParamName(const ::testing::TestParamInfo<benchmark::ValidationConfig> &info) {
+    return benchmark::ValidationConfigName(info.param);
+}
+
+#if !defined(VK_USE_PLATFORM_ANDROID_KHR)
+// Registered before the TestEnvironment from the framework main() so the loader picks up the Test ICD by default
+class BenchmarkEnvironment : public ::testing::Environment {
+  public:
+    void SetUp() override {
+        if (GetEnvironment("VK_DRIVER_FILES").empty() && GetEnvironment("VK_ICD_FILENAMES").empty()) {
+            SetEnvironment("VK_DRIVER_FILES", VVL_BENCHMARK_ICD_JSON);
+        }
+    }
+};
+
+static ::testing::Environment *const benchmark_environment = ::testing::AddGlobalTestEnvironment(new BenchmarkEnvironment);
+#endif
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../framework/layer_validation_tests.h"
+
+namespace benchmark {
+
+// Which validation objects are created by the chassis for a given run.
+// ChassisOnly loads the layer with every validation object disabled, it is the baseline of the pure dispatch cost.
+enum class ValidationConfig {
+    ChassisOnly,
+    CoreChecks,
+    Stateless,
+    ObjectLifetimes,
+    ThreadSafety,
+    SyncVal,
+    BestPractices,
+    All,
+};
+
+const char *ValidationConfigName(ValidationConfig config);
+
+// Only the time between Start() and Stop() is counted, so the benchmark body can do setup work (ex. vkBeginCommandBuffer) that is
+// not part of the entry point being measured
+class Stopwatch {
+  public:
+    void Start() { start_ = std::chrono::steady_clock::now(); }
+    void Stop() { elapsed_ += std::chrono::steady_clock::now() - start_; }
+    std::chrono::nanoseconds Elapsed() const { return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed_); }
+
+  private:
+    std::chrono::steady_clock::time_point start_;
+    std::chrono::steady_clock::duration elapsed_{};
+};
+
+struct Result {
+    double min_ns_per_call = 0.0;
+    double median_ns_per_call = 0.0;
+};
+
+// Runs |body| for a warm up round and then for a number of repetitions (VVL_BENCHMARK_REPETITIONS, default 10).
+// Each repetition must make |calls_per_repetition| calls to the entry point being measured while the stopwatch is running.
+Result Measure(uint32_t calls_per_repetition, const std::function<void(Stopwatch &)> &body);
+
+// Prints the result in a stable, grep friendly format and records it as a gtest property so --gtest_output=json:<file>
+// can be used by CI to track regressions
+void Report(const char *entry_point, const Result &result);
+
+// A stream of API calls recorded once by the setup of a scene and replayed into a command buffer by every repetition, so
+// building the parameters of the calls is not part of what is measured
+class ApiStream {
+  public:
+    using Command = std::function<void(VkCommandBuffer)>;
+
+    void Record(Command &&command) { commands_.emplace_back(std::move(command)); }
+    void Replay(VkCommandBuffer command_buffer) const {
+        for (const Command &command : commands_) {
+            command(command_buffer);
+        }
+    }
+    uint32_t Size() const { return static_cast<uint32_t>(commands_.size()); }
+
+  private:
+    std::vector<Command> commands_;
+};
+
+}  // namespace benchmark
+
+class VkBenchmark : public VkLayerTest, public ::testing::WithParamInterface<benchmark::ValidationConfig> {
+  public:
+    // Creates the instance and device with only the validation objects selected by the test parameter
+    void InitBenchmark();
+
+    // Replays |stream| into the default command buffer and submits it, both inside the stopwatch, so the submit time
+    // validation of the recorded commands is counted too
+    benchmark::Result MeasureReplay(const benchmark::ApiStream &stream);
+
+  protected:
+    std::vector<VkValidationFeatureEnableEXT> enables_;
+    std::vector<VkValidationFeatureDisableEXT> disables_;
+    VkValidationFeaturesEXT features_ = {};
+
+    // Set when VVL_BENCHMARK_PROFILE_DIR is, see InitBenchmark()
+    std::string profile_file_;
+    const char *profile_file_value_ = nullptr;
+    VkBool32 allocation_statistics_ = VK_TRUE;
+    std::vector<VkLayerSettingEXT> profile_settings_;
+    VkLayerSettingsCreateInfoEXT profile_settings_info_ = {};
+};
+
+std::string BenchmarkConfigParamName(const ::testing::TestParamInfo<benchmark::ValidationConfig> &info);
+
+#define INSTANTIATE_BENCHMARK_SUITE(suite)                                                                                     \
+    INSTANTIATE_TEST_SUITE_P(                                                                                                  \
+        Validation, suite,                                                                                                     \
+        ::testing::Values(benchmark::ValidationConfig::ChassisOnly, benchmark::ValidationConfig::CoreChecks,                  \
+                          benchmark::ValidationConfig::Stateless, benchmark::ValidationConfig::ObjectLifetimes,                \
+                          benchmark::ValidationConfig::ThreadSafety, benchmark::ValidationConfig::SyncVal,                     \
+                          benchmark::ValidationConfig::BestPractices, benchmark::ValidationConfig::All),                       \
+        BenchmarkConfigParamName)
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "benchmark_helper.h"
+#include "../framework/pipeline_helper.h"
+#include "../framework/descriptor_helper.h"
+
+// Measures the cost of going through the chassis (and each validation object) for the hot entry points of a renderer.
+// Everything is created up front so only the entry point being measured is inside the stopwatch.
+class ChassisDispatch : public VkBenchmark {};
+
+// Large enough to hide the cost of reading the clock, small enough that per command buffer state does not dominate
+static constexpr uint32_t kCallsPerRepetition = 1000;
+
+static const char kFragmentUniformGlsl[] = R"glsl(
+    #version 460
+    layout(location=0) out vec4 color;
+    layout(set=0, binding=0) uniform UBO { vec4 value; } ubo;
+    void main() {
+       color = ubo.value;
+    }
+)glsl";
+
+TEST_P(ChassisDispatch, CmdDraw) {
+    RETURN_IF_SKIP(InitBenchmark());
+    InitRenderTarget();
+
+    CreatePipelineHelper pipe(*this);
+    pipe.CreateGraphicsPipeline();
+
+    const auto result = benchmark::Measure(kCallsPerRepetition, [&](benchmark::Stopwatch &stopwatch) {
+        m_command_buffer.begin();
+        m_command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+        vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+        stopwatch.Start();
+        for (uint32_t i = 0; i < kCallsPerRepetition; ++i) {
+            vk::CmdDraw(m_command_buffer.handle(), 3, 1, 0, 0);
+        }
+        stopwatch.Stop();
+        m_command_buffer.EndRenderPass();
+        m_command_buffer.end();
+    });
+    benchmark::Report("vkCmdDraw", result);
+}
+
+TEST_P(ChassisDispatch, CmdDrawIndexed) {
+    RETURN_IF_SKIP(InitBenchmark());
+    InitRenderTarget();
+
+    CreatePipelineHelper pipe(*this);
+    pipe.CreateGraphicsPipeline();
+
+    vkt::Buffer index_buffer(*m_device, 1024, VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+
+    const auto result = benchmark::Measure(kCallsPerRepetition, [&](benchmark::Stopwatch &stopwatch) {
+        m_command_buffer.begin();
+        m_command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+        vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+        vk::CmdBindIndexBuffer(m_command_buffer.handle(), index_buffer.handle(), 0, VK_INDEX_TYPE_UINT32);
+        stopwatch.Start();
+        for (uint32_t i = 0; i < kCallsPerRepetition; ++i) {
+            vk::CmdDrawIndexed(m_command_buffer.handle(), 3, 1, 0, 0, 0);
+        }
+        stopwatch.Stop();
+        m_command_buffer.EndRenderPass();
+        m_command_buffer.end();
+    });
+    benchmark::Report("vkCmdDrawIndexed", result);
+}
+
+TEST_P(ChassisDispatch, CmdDrawWithDescriptorSet) {
+    RETURN_IF_SKIP(InitBenchmark());
+    InitRenderTarget();
+
+    vkt::Buffer uniform_buffer(*m_device, 256, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}});
+    descriptor_set.WriteDescriptorBufferInfo(0, uniform_buffer.handle(), 0, VK_WHOLE_SIZE);
+    descriptor_set.UpdateDescriptorSets();
+
+    VkShaderObj vs(this, kVertexMinimalGlsl, VK_SHADER_STAGE_VERTEX_BIT);
+    VkShaderObj fs(this, kFragmentUniformGlsl, VK_SHADER_STAGE_FRAGMENT_BIT);
+    CreatePipelineHelper pipe(*this);
+    pipe.shader_stages_ = {vs.GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.pipeline_layout_ = vkt::PipelineLayout(*m_device, {&descriptor_set.layout_});
+    pipe.CreateGraphicsPipeline();
+
+    const auto result = benchmark::Measure(kCallsPerRepetition, [&](benchmark::Stopwatch &stopwatch) {
+        m_command_buffer.begin();
+        m_command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+        vk::CmdBindPipeline(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+        vk::CmdBindDescriptorSets(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(), 0, 1,
+                                  &descriptor_set.set_, 0, nullptr);
+        stopwatch.Start();
+        for (uint32_t i = 0; i < kCallsPerRepetition; ++i) {
+            vk::CmdDraw(m_command_buffer.handle(), 3, 1, 0, 0);
+        }
+        stopwatch.Stop();
+        m_command_buffer.EndRenderPass();
+        m_command_buffer.end();
+    });
+    benchmark::Report("vkCmdDraw", result);
+}
+
+TEST_P(ChassisDispatch, CmdBindDescriptorSets) {
+    RETURN_IF_SKIP(InitBenchmark());
+
+    vkt::Buffer uniform_buffer(*m_device, 256, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+    descriptor_set.WriteDescriptorBufferInfo(0, uniform_buffer.handle(), 0, VK_WHOLE_SIZE);
+    descriptor_set.UpdateDescriptorSets();
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+
+    const auto result = benchmark::Measure(kCallsPerRepetition, [&](benchmark::Stopwatch &stopwatch) {
+        m_command_buffer.begin();
+        stopwatch.Start();
+        for (uint32_t i = 0; i < kCallsPerRepetition; ++i) {
+            vk::CmdBindDescriptorSets(m_command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                                      &descriptor_set.set_, 0, nullptr);
+        }
+        stopwatch.Stop();
+        m_command_buffer.end();
+    });
+    benchmark::Report("vkCmdBindDescriptorSets", result);
+}
+
+TEST_P(ChassisDispatch, UpdateDescriptorSets) {
+    RETURN_IF_SKIP(InitBenchmark());
+
+    vkt::Buffer uniform_buffer(*m_device, 256, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+
+    VkDescriptorBufferInfo buffer_info = {uniform_buffer.handle(), 0, VK_WHOLE_SIZE};
+    VkWriteDescriptorSet descriptor_write = vku::InitStructHelper();
+    descriptor_write.dstSet = descriptor_set.set_;
+    descriptor_write.dstBinding = 0;
+    descriptor_write.descriptorCount = 1;
+    descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    descriptor_write.pBufferInfo = &buffer_info;
+
+    const auto result = benchmark::Measure(kCallsPerRepetition, [&](benchmark::Stopwatch &stopwatch) {
+        stopwatch.Start();
+        for (uint32_t i = 0; i < kCallsPerRepetition; ++i) {
+            vk::UpdateDescriptorSets(device(), 1, &descriptor_write, 0, nullptr);
+        }
+        stopwatch.Stop();
+    });
+    benchmark::Report("vkUpdateDescriptorSets", result);
+}
+
+TEST_P(ChassisDispatch, QueueSubmit) {
+    RETURN_IF_SKIP(InitBenchmark());
+
+    // Simultaneous use so the same command buffer can be resubmitted before the layer has retired the previous submission
+    m_command_buffer.begin(VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT);
+    m_command_buffer.end();
+
+    VkSubmitInfo submit_info = vku::InitStructHelper();
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_command_buffer.handle();
+
+    // Retiring submissions is part of the cost an application pays, but is done outside of the stopwatch in batches so
+    // the numbers are not dominated by an ever growing submission queue
+    constexpr uint32_t kSubmitsPerWait = 100;
+    const auto result = benchmark::Measure(kCallsPerRepetition, [&](benchmark::Stopwatch &stopwatch) {
+        for (uint32_t i = 0; i < kCallsPerRepetition; i += kSubmitsPerWait) {
+            stopwatch.Start();
+            for (uint32_t j = 0; j < kSubmitsPerWait; ++j) {
+                vk::QueueSubmit(m_default_queue->handle(), 1, &submit_info, VK_NULL_HANDLE);
+            }
+            stopwatch.Stop();
+            m_default_queue->Wait();
+        }
+    });
+    benchmark::Report("vkQueueSubmit", result);
+}
+
+INSTANTIATE_BENCHMARK_SUITE(ChassisDispatch);
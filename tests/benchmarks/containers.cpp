@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "benchmark_helper.h"
+
+#include <algorithm>
+#include <random>
+
+#include "containers/custom_containers.h"
+#include "containers/dense_handle_map.h"
+#include "containers/range_vector.h"
+#include "containers/subresource_adapter.h"
+
+// Measures the containers of layers/containers on their own, with the access patterns of synchronization validation and
+// of the image layout tracking. No instance is created, so changes to a container can be compared without the noise of
+// the rest of the layer.
+
+using Range = sparse_container::range<uint64_t>;
+
+static constexpr uint64_t kRanges = 1024;
+static constexpr uint64_t kRangeSize = 64;
+
+// The infill/update pair of the access state updates of synchronization validation, reduced to an access count
+template <typename Map>
+struct CountAccessOps {
+    void infill(Map &map, const typename Map::iterator &pos, const typename Map::key_type &range) const {
+        map.insert(pos, std::make_pair(range, uint64_t(1)));
+    }
+    void update(const typename Map::iterator &pos) const { ++pos->second; }
+};
+
+// Writes every other region, then accesses regions that straddle the written ones, so every update splits two existing
+// entries and infills the gap between them
+template <typename Map>
+static void InfillUpdateSplitRegions(const char *entry_point) {
+    const auto result = benchmark::Measure(2 * kRanges, [](benchmark::Stopwatch &stopwatch) {
+        Map map;
+        const CountAccessOps<Map> ops;
+        stopwatch.Start();
+        for (uint64_t i = 0; i < kRanges; ++i) {
+            sparse_container::infill_update_range(map, Range(2 * i * kRangeSize, (2 * i + 1) * kRangeSize), ops);
+        }
+        for (uint64_t i = 0; i < kRanges; ++i) {
+            const uint64_t begin = (2 * i + 1) * kRangeSize - kRangeSize / 2;
+            sparse_container::infill_update_range(map, Range(begin, begin + kRangeSize), ops);
+        }
+        stopwatch.Stop();
+    });
+    benchmark::Report(entry_point, result);
+}
+
+TEST(ContainerBenchmark, RangeMapInfillUpdate) {
+    InfillUpdateSplitRegions<sparse_container::range_map<uint64_t, uint64_t>>("range_map");
+}
+
+TEST(ContainerBenchmark, PooledRangeMapInfillUpdate) {
+    InfillUpdateSplitRegions<sparse_container::pooled_range_map<uint64_t, uint64_t>>("pooled_range_map");
+}
+
+// A barrier over the whole resource after many small accesses: one overwrite_range collapses the map back to one entry
+template <typename Map>
+static void OverwriteAfterSplit(const char *entry_point) {
+    const auto result = benchmark::Measure(kRanges + 1, [](benchmark::Stopwatch &stopwatch) {
+        Map map;
+        stopwatch.Start();
+        for (uint64_t i = 0; i < kRanges; ++i) {
+            map.overwrite_range(std::make_pair(Range(i * kRangeSize, (i + 1) * kRangeSize), i));
+        }
+        map.overwrite_range(std::make_pair(Range(0, kRanges * kRangeSize), uint64_t(0)));
+        stopwatch.Stop();
+    });
+    benchmark::Report(entry_point, result);
+}
+
+TEST(ContainerBenchmark, RangeMapOverwriteRange) {
+    OverwriteAfterSplit<sparse_container::range_map<uint64_t, uint64_t>>("range_map");
+}
+
+TEST(ContainerBenchmark, PooledRangeMapOverwriteRange) {
+    OverwriteAfterSplit<sparse_container::pooled_range_map<uint64_t, uint64_t>>("pooled_range_map");
+}
+
+// Lookups at random offsets of a map with kRanges entries, like the validation of accesses scattered over a buffer
+TEST(ContainerBenchmark, RangeMapLowerBound) {
+    sparse_container::range_map<uint64_t, uint64_t> map;
+    for (uint64_t i = 0; i < kRanges; ++i) {
+        map.insert(map.end(), std::make_pair(Range(2 * i * kRangeSize, (2 * i + 1) * kRangeSize), i));
+    }
+    std::mt19937_64 random(0);
+    std::vector<uint64_t> offsets(kRanges);
+    for (uint64_t &offset : offsets) {
+        offset = random() % (2 * kRanges * kRangeSize);
+    }
+
+    uint64_t found = 0;
+    const auto result = benchmark::Measure(kRanges, [&](benchmark::Stopwatch &stopwatch) {
+        stopwatch.Start();
+        for (const uint64_t offset : offsets) {
+            found += map.lower_bound(Range(offset, offset + 1)) != map.end() ? 1 : 0;
+        }
+        stopwatch.Stop();
+    });
+    ASSERT_NE(0u, found);
+    benchmark::Report("lower_bound", result);
+}
+
+// Walks the whole map one entry at a time with seek(), the common case cached_lower_bound_impl avoids the lookup for
+TEST(ContainerBenchmark, CachedLowerBoundSeek) {
+    using Map = sparse_container::range_map<uint64_t, uint64_t>;
+    Map map;
+    for (uint64_t i = 0; i < kRanges; ++i) {
+        map.insert(map.end(), std::make_pair(Range(2 * i * kRangeSize, (2 * i + 1) * kRangeSize), i));
+    }
+
+    uint64_t valid = 0;
+    const auto result = benchmark::Measure(2 * kRanges, [&](benchmark::Stopwatch &stopwatch) {
+        stopwatch.Start();
+        sparse_container::cached_lower_bound_impl<Map> pos(map, 0);
+        for (uint64_t i = 1; i <= 2 * kRanges; ++i) {
+            valid += pos->valid ? 1 : 0;
+            pos.seek(i * kRangeSize);
+        }
+        stopwatch.Stop();
+    });
+    ASSERT_NE(0u, valid);
+    benchmark::Report("seek", result);
+}
+
+// The layout update of ImageSubresourceLayoutMap with the entries reduced to the layout: fills the gaps, overwrites the
+// entries with another layout, and steps over the others with a cached lower bound
+template <typename Map>
+static void UpdateLayout(Map &layouts, const Range &range, uint32_t layout) {
+    sparse_container::cached_lower_bound_impl<Map> pos(layouts, range.begin);
+    while (range.includes(pos->index)) {
+        if (!pos->valid) {
+            const auto start = pos->index;
+            auto it = pos->lower_bound;
+            const auto limit = (it != layouts.end()) ? std::min(it->first.begin, range.end) : range.end;
+            auto inserted = layouts.insert(it, std::make_pair(Range(start, limit), layout));
+            pos.invalidate(inserted, start);
+            pos.seek(limit);
+        }
+        if (pos->valid) {
+            const auto intersected = pos->lower_bound->first & range;
+            if (!intersected.empty() && pos->lower_bound->second != layout) {
+                auto overwritten = layouts.overwrite_range(pos->lower_bound, std::make_pair(intersected, layout));
+                pos.invalidate(overwritten, intersected.begin);
+                pos.seek(intersected.end);
+            } else {
+                pos.seek(pos->lower_bound->first.end);
+            }
+        }
+    }
+}
+
+// Every subresource on its own and then the whole image, the ImageLayout benchmark without the layer around it
+template <typename Map>
+static void TransitionSubresources(Map &layouts, uint64_t subresources) {
+    for (uint64_t i = 0; i < subresources; ++i) {
+        UpdateLayout(layouts, Range(i, i + 1), static_cast<uint32_t>(i % 3) + 1);
+    }
+    UpdateLayout(layouts, Range(0, subresources), 0);
+}
+
+static constexpr uint64_t kSmallSubresources = 12;
+static constexpr uint64_t kBigSubresources = 12 * 6;
+
+TEST(ContainerBenchmark, SmallRangeMapUpdateLayout) {
+    const auto result = benchmark::Measure(kSmallSubresources + 1, [](benchmark::Stopwatch &stopwatch) {
+        sparse_container::small_range_map<uint64_t, uint32_t, Range, 16> layouts(kSmallSubresources);
+        stopwatch.Start();
+        TransitionSubresources(layouts, kSmallSubresources);
+        stopwatch.Stop();
+    });
+    benchmark::Report("small_range_map", result);
+}
+
+TEST(ContainerBenchmark, BothRangeMapUpdateLayout) {
+    using LayoutMap = subresource_adapter::BothRangeMap<uint32_t, 16>;
+    // Like ImageSubresourceLayoutMap, the underlying map is unwrapped once per update and not in every call
+    const auto transition = [](LayoutMap &layouts, uint64_t subresources) {
+        if (layouts.SmallMode()) {
+            TransitionSubresources(layouts.GetSmallMap(), subresources);
+        } else {
+            TransitionSubresources(layouts.GetBigMap(), subresources);
+        }
+    };
+
+    for (const uint64_t subresources : {kSmallSubresources, kBigSubresources}) {
+        const auto result = benchmark::Measure(subresources + 1, [&](benchmark::Stopwatch &stopwatch) {
+            LayoutMap layouts(subresources);
+            stopwatch.Start();
+            transition(layouts, subresources);
+            stopwatch.Stop();
+        });
+        benchmark::Report(subresources == kSmallSubresources ? "small_mode" : "big_mode", result);
+    }
+}
+
+// Lookups through the wrapper, which checks the mode for every call
+TEST(ContainerBenchmark, BothRangeMapLowerBound) {
+    using LayoutMap = subresource_adapter::BothRangeMap<uint32_t, 16>;
+    for (const uint64_t subresources : {kSmallSubresources, kBigSubresources}) {
+        LayoutMap layouts(subresources);
+        for (uint64_t i = 0; i < subresources; ++i) {
+            layouts.insert(layouts.end(), std::make_pair(Range(i, i + 1), static_cast<uint32_t>(i)));
+        }
+
+        uint64_t found = 0;
+        const auto result = benchmark::Measure(static_cast<uint32_t>(subresources), [&](benchmark::Stopwatch &stopwatch) {
+            stopwatch.Start();
+            for (uint64_t i = 0; i < subresources; ++i) {
+                found += layouts.lower_bound(Range(i, i + 1)) != layouts.end() ? 1 : 0;
+            }
+            stopwatch.Stop();
+        });
+        ASSERT_NE(0u, found);
+        benchmark::Report(subresources == kSmallSubresources ? "small_mode" : "big_mode", result);
+    }
+}
+
+// The per command lists of the layer, which almost always fit the inline storage, and the spill to the heap when not
+template <size_t N>
+static void SmallVectorPushBack(uint32_t count, const char *entry_point) {
+    const uint32_t vectors = 1024 / count;
+    uint64_t sum = 0;
+    const auto result = benchmark::Measure(vectors * count, [&](benchmark::Stopwatch &stopwatch) {
+        stopwatch.Start();
+        for (uint32_t v = 0; v < vectors; ++v) {
+            small_vector<uint64_t, N> vector;
+            for (uint32_t i = 0; i < count; ++i) {
+                vector.emplace_back(i);
+            }
+            sum += vector.back();
+        }
+        stopwatch.Stop();
+    });
+    ASSERT_NE(0u, sum);
+    benchmark::Report(entry_point, result);
+}
+
+TEST(ContainerBenchmark, SmallVectorPushBack) {
+    SmallVectorPushBack<8>(8, "inline");
+    SmallVectorPushBack<8>(64, "spill");
+}
+
+// The image layout maps of a command buffer: a few images looked up many times per recording, then walked and cleared
+template <typename Map>
+static void RecordImageLayouts(uint64_t images, const char *entry_point) {
+    constexpr uint32_t kLookups = 256;
+    Map map;
+    uint64_t sum = 0;
+    const auto result = benchmark::Measure(kLookups, [&](benchmark::Stopwatch &stopwatch) {
+        stopwatch.Start();
+        for (uint32_t i = 0; i < kLookups; ++i) {
+            const uint64_t handle = (i % images + 1) << 12;
+            auto it = map.find(handle);
+            if (it == map.end()) {
+                it = map.emplace(handle, i).first;
+            }
+            sum += it->second;
+        }
+        for (const auto &entry : map) {
+            sum += entry.second;
+        }
+        map.clear();
+        stopwatch.Stop();
+    });
+    ASSERT_NE(0u, sum);
+    benchmark::Report(entry_point, result);
+}
+
+TEST(ContainerBenchmark, UnorderedMapImageLayouts) {
+    RecordImageLayouts<vvl::unordered_map<uint64_t, uint64_t>>(4, "few_images");
+    RecordImageLayouts<vvl::unordered_map<uint64_t, uint64_t>>(64, "many_images");
+}
+
+TEST(ContainerBenchmark, DenseHandleMapImageLayouts) {
+    RecordImageLayouts<vvl::DenseHandleMap<uint64_t, uint64_t>>(4, "few_images");
+    RecordImageLayouts<vvl::DenseHandleMap<uint64_t, uint64_t>>(64, "many_images");
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "benchmark_helper.h"
+
+// Measures the validation of a copy with a very large region array. The regions copy the first half of a buffer to its
+// second half, so source and destination share a memory and every region has to be tested for overlap with all others.
+class CopyRegions : public VkBenchmark {};
+
+static constexpr uint32_t kRegions = 10000;
+static constexpr VkDeviceSize kRegionSize = 16;
+static constexpr VkDeviceSize kHalfSize = kRegions * kRegionSize;
+
+TEST_P(CopyRegions, CmdCopyBufferSameMemory) {
+    RETURN_IF_SKIP(InitBenchmark());
+
+    vkt::Buffer buffer(*m_device, 2 * kHalfSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    std::vector<VkBufferCopy> regions(kRegions);
+    for (uint32_t i = 0; i < kRegions; ++i) {
+        // Reverse the destination order so the regions are not already sorted
+        regions[i] = {i * kRegionSize, kHalfSize + (kRegions - 1 - i) * kRegionSize, kRegionSize};
+    }
+
+    const auto result = benchmark::Measure(1, [&](benchmark::Stopwatch &stopwatch) {
+        m_command_buffer.begin();
+        stopwatch.Start();
+        vk::CmdCopyBuffer(m_command_buffer.handle(), buffer.handle(), buffer.handle(), kRegions, regions.data());
+        stopwatch.Stop();
+        m_command_buffer.end();
+    });
+    benchmark::Report("vkCmdCopyBuffer", result);
+}
+
+INSTANTIATE_BENCHMARK_SUITE(CopyRegions);
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "benchmark_helper.h"
+
+// Measures the image layout tracking done while recording barriers, on a cube image with a full mip chain. Each
+// subresource is transitioned on its own and then the whole image at once, so the command buffer layout map goes from
+// one entry per subresource back to a single entry in every repetition.
+class ImageLayout : public VkBenchmark {};
+
+static constexpr uint32_t kMipLevels = 12;
+static constexpr uint32_t kArrayLayers = 6;
+static constexpr uint32_t kBarriersPerRepetition = kMipLevels * kArrayLayers + 1;
+
+TEST_P(ImageLayout, CmdPipelineBarrierCubeMipChain) {
+    RETURN_IF_SKIP(InitBenchmark());
+
+    auto image_ci = vkt::Image::ImageCreateInfo2D(1u << (kMipLevels - 1), 1u << (kMipLevels - 1), kMipLevels, kArrayLayers,
+                                                  VK_FORMAT_R8G8B8A8_UNORM,
+                                                  VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT);
+    image_ci.flags = VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT;
+    vkt::Image image(*m_device, image_ci);
+
+    VkImageMemoryBarrier barrier = vku::InitStructHelper();
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = image.handle();
+
+    const auto result = benchmark::Measure(kBarriersPerRepetition, [&](benchmark::Stopwatch &stopwatch) {
+        m_command_buffer.begin();
+        stopwatch.Start();
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        for (uint32_t mip = 0; mip < kMipLevels; ++mip) {
+            for (uint32_t layer = 0; layer < kArrayLayers; ++layer) {
+                barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, mip, 1, layer, 1};
+                vk::CmdPipelineBarrier(m_command_buffer.handle(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                       VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+            }
+        }
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS};
+        vk::CmdPipelineBarrier(m_command_buffer.handle(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
+                               0, nullptr, 0, nullptr, 1, &barrier);
+        stopwatch.Stop();
+        m_command_buffer.end();
+    });
+    benchmark::Report("vkCmdPipelineBarrier", result);
+}
+
+INSTANTIATE_BENCHMARK_SUITE(ImageLayout);
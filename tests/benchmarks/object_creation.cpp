@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "benchmark_helper.h"
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Measures object creation and destruction from several threads at once, like the loading threads of a streaming system.
+// The time per call staying flat as threads are added means the counters and ids written by every creation do not make the
+// threads wait for each other.
+class ObjectCreation : public VkBenchmark {};
+
+static constexpr uint32_t kBatchSize = 64;
+static constexpr uint32_t kBatchesPerThread = 16;
+
+TEST_P(ObjectCreation, CreateDestroySamplerThreads) {
+    RETURN_IF_SKIP(InitBenchmark());
+    const VkSamplerCreateInfo sampler_ci = SafeSaneSamplerCreateInfo();
+    const uint32_t max_threads = std::max(1u, std::min(8u, std::thread::hardware_concurrency()));
+
+    for (uint32_t thread_count = 1; thread_count <= max_threads; thread_count *= 2) {
+        const uint32_t calls = 2 * thread_count * kBatchSize * kBatchesPerThread;
+        const auto result = benchmark::Measure(calls, [&](benchmark::Stopwatch &stopwatch) {
+            // The threads are started first and wait for go, so starting them is not measured
+            std::atomic<bool> go{false};
+            std::vector<std::thread> threads;
+            for (uint32_t t = 0; t < thread_count; ++t) {
+                threads.emplace_back([&]() {
+                    while (!go.load(std::memory_order_acquire)) {
+                        std::this_thread::yield();
+                    }
+                    VkSampler samplers[kBatchSize];
+                    for (uint32_t batch = 0; batch < kBatchesPerThread; ++batch) {
+                        for (VkSampler &sampler : samplers) {
+                            vk::CreateSampler(device(), &sampler_ci, nullptr, &sampler);
+                        }
+                        for (VkSampler sampler : samplers) {
+                            vk::DestroySampler(device(), sampler, nullptr);
+                        }
+                    }
+                });
+            }
+            stopwatch.Start();
+            go.store(true, std::memory_order_release);
+            for (auto &thread : threads) {
+                thread.join();
+            }
+            stopwatch.Stop();
+        });
+        const std::string entry_point = "vkCreateSampler+vkDestroySampler_" + std::to_string(thread_count) + "_threads";
+        benchmark::Report(entry_point.c_str(), result);
+    }
+}
+
+INSTANTIATE_BENCHMARK_SUITE(ObjectCreation);
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "benchmark_helper.h"
+#include "../framework/pipeline_helper.h"
+#include "../framework/descriptor_helper.h"
+#include "../framework/ray_tracing_objects.h"
+
+// Synthetic scenes shaped like the frames of real applications. Each scene records its API stream once, then every
+// repetition replays the whole stream into a command buffer and submits it, so the numbers follow what an application
+// pays for a frame rather than for a single entry point. The result is in ns per replayed call.
+class SceneReplay : public VkBenchmark {};
+
+static constexpr uint32_t kBindlessDescriptors = 1024;
+static constexpr uint32_t kBindlessDraws = 10000;
+
+static const char kFragmentBindlessGlsl[] = R"glsl(
+    #version 460
+    #extension GL_EXT_nonuniform_qualifier : enable
+    layout(location=0) out vec4 color;
+    layout(set=0, binding=0) buffer SSBO { vec4 value; } ssbos[];
+    layout(push_constant) uniform PushConstants { uint index; } pc;
+    void main() {
+       color = ssbos[pc.index].value;
+    }
+)glsl";
+
+// Every draw selects its buffer out of one large partially bound descriptor array with a push constant
+TEST_P(SceneReplay, BindlessDraws) {
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredExtensions(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::runtimeDescriptorArray);
+    AddRequiredFeature(vkt::Feature::descriptorBindingPartiallyBound);
+    RETURN_IF_SKIP(InitBenchmark());
+    InitRenderTarget();
+
+    vkt::Buffer storage_buffer(*m_device, 256, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    const VkDescriptorBindingFlags binding_flags = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT;
+    VkDescriptorSetLayoutBindingFlagsCreateInfo binding_flags_ci = vku::InitStructHelper();
+    binding_flags_ci.bindingCount = 1;
+    binding_flags_ci.pBindingFlags = &binding_flags;
+    OneOffDescriptorSet descriptor_set(
+        m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, kBindlessDescriptors, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}}, 0,
+        &binding_flags_ci);
+    for (uint32_t i = 0; i < kBindlessDescriptors; ++i) {
+        descriptor_set.WriteDescriptorBufferInfo(0, storage_buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                 i);
+    }
+    descriptor_set.UpdateDescriptorSets();
+
+    VkShaderObj vs(this, kVertexMinimalGlsl, VK_SHADER_STAGE_VERTEX_BIT);
+    VkShaderObj fs(this, kFragmentBindlessGlsl, VK_SHADER_STAGE_FRAGMENT_BIT, SPV_ENV_VULKAN_1_2);
+    const VkPushConstantRange push_constant_range = {VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(uint32_t)};
+    CreatePipelineHelper pipe(*this);
+    pipe.shader_stages_ = {vs.GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.pipeline_layout_ = vkt::PipelineLayout(*m_device, {&descriptor_set.layout_}, {push_constant_range});
+    pipe.CreateGraphicsPipeline();
+
+    const VkPipeline pipeline = pipe.Handle();
+    const VkPipelineLayout pipeline_layout = pipe.pipeline_layout_.handle();
+    const VkDescriptorSet set = descriptor_set.set_;
+
+    benchmark::ApiStream stream;
+    stream.Record([this](VkCommandBuffer command_buffer) {
+        vk::CmdBeginRenderPass(command_buffer, &m_renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
+    });
+    stream.Record([pipeline](VkCommandBuffer command_buffer) {
+        vk::CmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+    });
+    stream.Record([pipeline_layout, set](VkCommandBuffer command_buffer) {
+        vk::CmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout, 0, 1, &set, 0, nullptr);
+    });
+    for (uint32_t i = 0; i < kBindlessDraws; ++i) {
+        stream.Record([pipeline_layout, index = i % kBindlessDescriptors](VkCommandBuffer command_buffer) {
+            vk::CmdPushConstants(command_buffer, pipeline_layout, VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(index), &index);
+        });
+        stream.Record([](VkCommandBuffer command_buffer) { vk::CmdDraw(command_buffer, 3, 1, 0, 0); });
+    }
+    stream.Record([](VkCommandBuffer command_buffer) { vk::CmdEndRenderPass(command_buffer); });
+
+    benchmark::Report("replay", MeasureReplay(stream));
+}
+
+static constexpr uint32_t kBlasCount = 5000;
+
+// One vkCmdBuildAccelerationStructuresKHR rebuilding every bottom level acceleration structure of a scene
+TEST_P(SceneReplay, BlasRebuildBatch) {
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredExtensions(VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME);
+    AddRequiredExtensions(VK_KHR_DEFERRED_HOST_OPERATIONS_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::accelerationStructure);
+    AddRequiredFeature(vkt::Feature::bufferDeviceAddress);
+    RETURN_IF_SKIP(InitBenchmark());
+
+    std::vector<vkt::as::BuildGeometryInfoKHR> blases;
+    blases.reserve(kBlasCount);
+    std::vector<const VkAccelerationStructureGeometryKHR *> geometries(kBlasCount);
+    std::vector<VkAccelerationStructureBuildRangeInfoKHR> ranges(kBlasCount);
+    std::vector<const VkAccelerationStructureBuildRangeInfoKHR *> range_pointers(kBlasCount);
+    std::vector<VkAccelerationStructureBuildGeometryInfoKHR> build_infos(kBlasCount);
+    for (uint32_t i = 0; i < kBlasCount; ++i) {
+        blases.emplace_back(vkt::as::blueprint::BuildGeometryInfoSimpleOnDeviceBottomLevel(*m_device));
+        // Creates the acceleration structure and the scratch buffer, only the build itself is replayed
+        blases[i].SetupBuild(true);
+        const vkt::as::GeometryKHR &geometry = blases[i].GetGeometries()[0];
+        geometries[i] = &geometry.GetVkObj();
+        ranges[i] = geometry.GetFullBuildRange();
+        range_pointers[i] = &ranges[i];
+        build_infos[i] = blases[i].GetInfo();
+        build_infos[i].geometryCount = 1;
+        build_infos[i].pGeometries = nullptr;
+        build_infos[i].ppGeometries = &geometries[i];
+    }
+
+    benchmark::ApiStream stream;
+    stream.Record([&build_infos, &range_pointers](VkCommandBuffer command_buffer) {
+        vk::CmdBuildAccelerationStructuresKHR(command_buffer, kBlasCount, build_infos.data(), range_pointers.data());
+    });
+
+    benchmark::Report("replay", MeasureReplay(stream));
+}
+
+static constexpr uint32_t kSecondaryCommandBuffers = 3000;
+
+// A render pass made of secondary command buffers, each recorded once with a single draw
+TEST_P(SceneReplay, SecondaryCommandBuffers) {
+    RETURN_IF_SKIP(InitBenchmark());
+    InitRenderTarget();
+
+    CreatePipelineHelper pipe(*this);
+    pipe.CreateGraphicsPipeline();
+
+    VkCommandBufferInheritanceInfo inheritance_info = vku::InitStructHelper();
+    inheritance_info.renderPass = m_renderPass;
+    inheritance_info.subpass = 0;
+    inheritance_info.framebuffer = framebuffer();
+    VkCommandBufferBeginInfo begin_info = vku::InitStructHelper();
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    begin_info.pInheritanceInfo = &inheritance_info;
+
+    std::vector<vkt::CommandBuffer> secondaries;
+    secondaries.reserve(kSecondaryCommandBuffers);
+    for (uint32_t i = 0; i < kSecondaryCommandBuffers; ++i) {
+        vkt::CommandBuffer &secondary = secondaries.emplace_back(*m_device, m_command_pool, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+        secondary.begin(&begin_info);
+        vk::CmdBindPipeline(secondary.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+        vk::CmdDraw(secondary.handle(), 3, 1, 0, 0);
+        secondary.end();
+    }
+
+    benchmark::ApiStream stream;
+    stream.Record([this](VkCommandBuffer command_buffer) {
+        vk::CmdBeginRenderPass(command_buffer, &m_renderPassBeginInfo, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+    });
+    for (const vkt::CommandBuffer &secondary : secondaries) {
+        stream.Record([secondary_handle = secondary.handle()](VkCommandBuffer command_buffer) {
+            vk::CmdExecuteCommands(command_buffer, 1, &secondary_handle);
+        });
+    }
+    stream.Record([](VkCommandBuffer command_buffer) { vk::CmdEndRenderPass(command_buffer); });
+
+    benchmark::Report("replay", MeasureReplay(stream));
+}
+
+static constexpr uint32_t kSyncBuffers = 64;
+static constexpr uint32_t kSyncRounds = 16 * kSyncBuffers;
+static constexpr VkDeviceSize kSyncBufferSize = 4096;
+
+// Uploads that are read back right away, each behind its own buffer barrier. After every buffer was written once, a
+// global barrier orders the next writes after the previous reads and writes.
+TEST_P(SceneReplay, SyncBarriers) {
+    RETURN_IF_SKIP(InitBenchmark());
+
+    const VkBufferUsageFlags usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer staging(*m_device, kSyncBufferSize, usage);
+    vkt::Buffer readback(*m_device, kSyncBuffers * kSyncBufferSize, usage);
+    std::vector<vkt::Buffer> buffers;
+    buffers.reserve(kSyncBuffers);
+    for (uint32_t i = 0; i < kSyncBuffers; ++i) {
+        buffers.emplace_back(*m_device, kSyncBufferSize, usage);
+    }
+
+    VkMemoryBarrier global_barrier = vku::InitStructHelper();
+    global_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    global_barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+    benchmark::ApiStream stream;
+    for (uint32_t i = 0; i < kSyncRounds; ++i) {
+        const uint32_t index = i % kSyncBuffers;
+        const VkBuffer staging_handle = staging.handle();
+        const VkBuffer buffer_handle = buffers[index].handle();
+        const VkBuffer readback_handle = readback.handle();
+
+        stream.Record([staging_handle, buffer_handle](VkCommandBuffer command_buffer) {
+            const VkBufferCopy region = {0, 0, kSyncBufferSize};
+            vk::CmdCopyBuffer(command_buffer, staging_handle, buffer_handle, 1, &region);
+        });
+        stream.Record([buffer_handle](VkCommandBuffer command_buffer) {
+            VkBufferMemoryBarrier barrier = vku::InitStructHelper();
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.buffer = buffer_handle;
+            barrier.size = VK_WHOLE_SIZE;
+            vk::CmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr,
+                                   1, &barrier, 0, nullptr);
+        });
+        stream.Record([buffer_handle, readback_handle, index](VkCommandBuffer command_buffer) {
+            const VkBufferCopy region = {0, index * kSyncBufferSize, kSyncBufferSize};
+            vk::CmdCopyBuffer(command_buffer, buffer_handle, readback_handle, 1, &region);
+        });
+        if (index == kSyncBuffers - 1) {
+            stream.Record([global_barrier](VkCommandBuffer command_buffer) {
+                vk::CmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1,
+                                       &global_barrier, 0, nullptr, 0, nullptr);
+            });
+        }
+    }
+
+    benchmark::Report("replay", MeasureReplay(stream));
+}
+
+INSTANTIATE_BENCHMARK_SUITE(SceneReplay);
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "benchmark_helper.h"
+
+// Measures the access map updates done by synchronization validation when a buffer is accessed in many small pieces.
+// The first pass writes every other region of the destination buffer, and the second pass reads it back at regions
+// that straddle the written ones, so every copy splits existing entries of the access map and the access states are
+// copied over and over.
+class SyncAccessMap : public VkBenchmark {};
+
+static constexpr uint32_t kRegions = 256;
+static constexpr VkDeviceSize kRegionSize = 64;
+static constexpr VkDeviceSize kBufferSize = 2 * kRegions * kRegionSize;
+
+TEST_P(SyncAccessMap, CmdCopyBufferSplitRegions) {
+    RETURN_IF_SKIP(InitBenchmark());
+
+    const VkBufferUsageFlags usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer src(*m_device, kBufferSize, usage);
+    vkt::Buffer dst(*m_device, kBufferSize, usage);
+    vkt::Buffer readback(*m_device, kBufferSize, usage);
+
+    VkMemoryBarrier barrier = vku::InitStructHelper();
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+
+    const auto result = benchmark::Measure(2 * kRegions, [&](benchmark::Stopwatch &stopwatch) {
+        m_command_buffer.begin();
+        stopwatch.Start();
+        for (uint32_t i = 0; i < kRegions; ++i) {
+            const VkBufferCopy region = {0, 2 * i * kRegionSize, kRegionSize};
+            vk::CmdCopyBuffer(m_command_buffer.handle(), src.handle(), dst.handle(), 1, &region);
+        }
+        vk::CmdPipelineBarrier(m_command_buffer.handle(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1,
+                               &barrier, 0, nullptr, 0, nullptr);
+        for (uint32_t i = 0; i < kRegions - 1; ++i) {
+            const VkBufferCopy region = {(2 * i + 1) * kRegionSize - kRegionSize / 2, 2 * i * kRegionSize, kRegionSize};
+            vk::CmdCopyBuffer(m_command_buffer.handle(), dst.handle(), readback.handle(), 1, &region);
+        }
+        const VkBufferCopy last_region = {kBufferSize - kRegionSize, kBufferSize - kRegionSize, kRegionSize};
+        vk::CmdCopyBuffer(m_command_buffer.handle(), dst.handle(), readback.handle(), 1, &last_region);
+        stopwatch.Stop();
+        m_command_buffer.end();
+    });
+    benchmark::Report("vkCmdCopyBuffer", result);
+}
+
+INSTANTIATE_BENCHMARK_SUITE(SyncAccessMap);
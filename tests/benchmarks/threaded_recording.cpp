@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "benchmark_helper.h"
+#include "../framework/pipeline_helper.h"
+#include "../framework/descriptor_helper.h"
+
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Measures command buffer recording from 1 to 64 threads at once, each thread with its own command pool, like the render
+// threads of an engine. Every thread binds the same pipeline and descriptor set, so the state shared by the command buffers
+// (the locks of the chassis and of the object maps, the parent-child links of the bound objects) is what makes the threads
+// wait for each other. The scaling efficiency is the throughput of N threads over N times the one of a single thread.
+class ThreadedRecording : public VkBenchmark {};
+
+static constexpr uint32_t kMaxThreads = 64;
+static constexpr uint32_t kCommandBuffersPerThread = 4;
+static constexpr uint32_t kDrawsPerCommandBuffer = 256;
+// vkBeginCommandBuffer, vkCmdBeginRenderPass, vkCmdBindPipeline, vkCmdEndRenderPass, vkEndCommandBuffer and a
+// vkCmdBindDescriptorSets + vkCmdDraw per draw
+static constexpr uint32_t kCallsPerCommandBuffer = 5 + 2 * kDrawsPerCommandBuffer;
+
+static const char kFragmentUniformGlsl[] = R"glsl(
+    #version 460
+    layout(location=0) out vec4 color;
+    layout(set=0, binding=0) uniform UBO { vec4 value; } ubo;
+    void main() {
+       color = ubo.value;
+    }
+)glsl";
+
+// Prints the throughput and scaling efficiency next to the ns/call of Report(), and records them as gtest properties too
+static void ReportScaling(const std::string &entry_point, uint32_t thread_count, const benchmark::Result &single_thread,
+                          const benchmark::Result &result) {
+    const double calls_per_second = 1e9 / result.median_ns_per_call;
+    const double efficiency = single_thread.median_ns_per_call / (thread_count * result.median_ns_per_call);
+    const ::testing::TestInfo *test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+    std::cout << "[ BENCH    ] " << test_info->test_suite_name() << "." << test_info->name() << " " << entry_point << " "
+              << std::fixed << std::setprecision(1) << "median " << calls_per_second / 1e6 << " Mcalls/s, scaling efficiency "
+              << efficiency * 100.0 << "% (" << std::thread::hardware_concurrency() << " hardware threads)" << std::endl;
+
+    ::testing::Test::RecordProperty(entry_point + "_calls_per_second", std::to_string(calls_per_second));
+    ::testing::Test::RecordProperty(entry_point + "_scaling_efficiency", std::to_string(efficiency));
+}
+
+TEST_P(ThreadedRecording, CmdDrawThreads) {
+    RETURN_IF_SKIP(InitBenchmark());
+    InitRenderTarget();
+
+    vkt::Buffer uniform_buffer(*m_device, 256, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}});
+    descriptor_set.WriteDescriptorBufferInfo(0, uniform_buffer.handle(), 0, VK_WHOLE_SIZE);
+    descriptor_set.UpdateDescriptorSets();
+
+    VkShaderObj vs(this, kVertexMinimalGlsl, VK_SHADER_STAGE_VERTEX_BIT);
+    VkShaderObj fs(this, kFragmentUniformGlsl, VK_SHADER_STAGE_FRAGMENT_BIT);
+    CreatePipelineHelper pipe(*this);
+    pipe.shader_stages_ = {vs.GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.pipeline_layout_ = vkt::PipelineLayout(*m_device, {&descriptor_set.layout_});
+    pipe.CreateGraphicsPipeline();
+
+    // Command pools are externally synchronized, so every thread gets its own
+    struct ThreadState {
+        vkt::CommandPool pool;
+        std::vector<vkt::CommandBuffer> command_buffers;
+    };
+    std::vector<std::unique_ptr<ThreadState>> thread_states;
+    for (uint32_t t = 0; t < kMaxThreads; ++t) {
+        auto state = std::make_unique<ThreadState>();
+        state->pool.Init(*m_device, m_device->graphics_queue_node_index_, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+        state->command_buffers.reserve(kCommandBuffersPerThread);
+        for (uint32_t i = 0; i < kCommandBuffersPerThread; ++i) {
+            state->command_buffers.emplace_back(*m_device, state->pool);
+        }
+        thread_states.emplace_back(std::move(state));
+    }
+
+    const auto record = [&](vkt::CommandBuffer &command_buffer) {
+        command_buffer.begin();
+        command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+        vk::CmdBindPipeline(command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+        for (uint32_t i = 0; i < kDrawsPerCommandBuffer; ++i) {
+            vk::CmdBindDescriptorSets(command_buffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(), 0,
+                                      1, &descriptor_set.set_, 0, nullptr);
+            vk::CmdDraw(command_buffer.handle(), 3, 1, 0, 0);
+        }
+        command_buffer.EndRenderPass();
+        command_buffer.end();
+    };
+
+    benchmark::Result single_thread;
+    for (uint32_t thread_count = 1; thread_count <= kMaxThreads; thread_count *= 2) {
+        const uint32_t calls = thread_count * kCommandBuffersPerThread * kCallsPerCommandBuffer;
+        const auto result = benchmark::Measure(calls, [&](benchmark::Stopwatch &stopwatch) {
+            // The threads are started first and wait for go, so starting them is not measured
+            std::atomic<bool> go{false};
+            std::vector<std::thread> threads;
+            for (uint32_t t = 0; t < thread_count; ++t) {
+                threads.emplace_back([&, t]() {
+                    while (!go.load(std::memory_order_acquire)) {
+                        std::this_thread::yield();
+                    }
+                    // Beginning a recorded command buffer again resets it, as a frame of the engine would
+                    for (vkt::CommandBuffer &command_buffer : thread_states[t]->command_buffers) {
+                        record(command_buffer);
+                    }
+                });
+            }
+            stopwatch.Start();
+            go.store(true, std::memory_order_release);
+            for (auto &thread : threads) {
+                thread.join();
+            }
+            stopwatch.Stop();
+        });
+        if (thread_count == 1) {
+            single_thread = result;
+        }
+        const std::string entry_point = "vkCmdDraw_record_" + std::to_string(thread_count) + "_threads";
+        benchmark::Report(entry_point.c_str(), result);
+        ReportScaling(entry_point, thread_count, single_thread, result);
+    }
+}
+
+INSTANTIATE_BENCHMARK_SUITE(ThreadedRecording);
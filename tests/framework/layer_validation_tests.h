@@ -295,7 +295,8 @@ class NegativeGpuAVOOB : public GpuAVOOBTest {
     void ShaderBufferSizeTest(VkDeviceSize buffer_size, VkDeviceSize binding_offset, VkDeviceSize binding_range,
                               VkDescriptorType descriptor_type, const char *fragment_shader,
                               std::vector<const char *> expected_errors, bool shader_objects = false);
-    void ComputeStorageBufferTest(const char *expected_error, const char *shader, VkDeviceSize buffer_size);
+    void ComputeStorageBufferTest(const char *expected_error, const char *shader, VkDeviceSize buffer_size,
+                                  void *p_next = nullptr);
 };
 class PositiveGpuAVOOB : public GpuAVOOBTest {};
 
@@ -308,7 +309,7 @@ class PositiveGpuAVRayQuery : public GpuAVRayQueryTest {};
 
 class NegativeDebugPrintf : public VkLayerTest {
   public:
-    void InitDebugPrintfFramework();
+    void InitDebugPrintfFramework(void *p_next = nullptr);
 
   protected:
 };
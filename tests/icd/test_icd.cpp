@@ -611,8 +611,8 @@ static VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(VkQueue queue, uint32_t submit
 static VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
                                                      const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) {
     unique_lock_t lock(global_lock);
-    allocated_memory_size_map[(VkDeviceMemory)global_unique_handle] = pAllocateInfo->allocationSize;
     *pMemory = (VkDeviceMemory)global_unique_handle++;
+    allocated_memory_size_map[*pMemory] = pAllocateInfo->allocationSize;
     return VK_SUCCESS;
 }
 
@@ -2115,7 +2115,6 @@ static VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureBuildSizesKHR(
 static VKAPI_ATTR VkResult VKAPI_CALL RegisterDisplayEventEXT(VkDevice device, VkDisplayKHR display,
                                                               const VkDisplayEventInfoEXT* pDisplayEventInfo,
                                                               const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
-    unique_lock_t lock(global_lock);
     *pFence = (VkFence)global_unique_handle++;
     return VK_SUCCESS;
 }
@@ -21,6 +21,8 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <unordered_set>
 #include <unordered_map>
@@ -37,16 +39,48 @@ using lock_guard_t = std::lock_guard<mutex_t>;
 using unique_lock_t = std::unique_lock<mutex_t>;
 
 static mutex_t global_lock;
-static uint64_t global_unique_handle = 1;
+// Non-dispatchable handles are a counter bumped without the global lock, so creating objects from many threads does not
+// serialize in the driver and the benchmarks only measure the layer
+static std::atomic<uint64_t> global_unique_handle{1};
 static const uint32_t SUPPORTED_LOADER_ICD_INTERFACE_VERSION = 5;
 static uint32_t loader_interface_version = 0;
 static bool negotiate_loader_icd_interface_called = false;
+
+// Dispatchable handles (mostly command buffers) are carved out of slabs that are never freed, destroyed handles are kept
+// in a free list for the next ones
+class DispObjSlab {
+  public:
+    VK_LOADER_DATA* Allocate() {
+        lock_guard_t lock(lock_);
+        if (free_.empty()) {
+            slabs_.emplace_back(std::make_unique<VK_LOADER_DATA[]>(kSlabSize));
+            for (size_t i = 0; i < kSlabSize; ++i) {
+                free_.push_back(&slabs_.back()[kSlabSize - 1 - i]);
+            }
+        }
+        VK_LOADER_DATA* handle = free_.back();
+        free_.pop_back();
+        return handle;
+    }
+    void Free(VK_LOADER_DATA* handle) {
+        lock_guard_t lock(lock_);
+        free_.push_back(handle);
+    }
+
+  private:
+    static constexpr size_t kSlabSize = 256;
+    mutex_t lock_;
+    std::vector<std::unique_ptr<VK_LOADER_DATA[]>> slabs_;
+    std::vector<VK_LOADER_DATA*> free_;
+};
+static DispObjSlab disp_obj_slab;
+
 static void* CreateDispObjHandle() {
-    auto handle = new VK_LOADER_DATA;
+    auto handle = disp_obj_slab.Allocate();
     set_loader_magic_value(handle);
     return handle;
 }
-static void DestroyDispObjHandle(void* handle) { delete reinterpret_cast<VK_LOADER_DATA*>(handle); }
+static void DestroyDispObjHandle(void* handle) { disp_obj_slab.Free(reinterpret_cast<VK_LOADER_DATA*>(handle)); }
 
 static constexpr uint32_t icd_physical_device_count = 1;
 static std::unordered_map<VkInstance, std::array<VkPhysicalDevice, icd_physical_device_count>> physical_device_map;
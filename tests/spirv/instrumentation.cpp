@@ -26,6 +26,7 @@ static bool all_passes = false;
 static bool bindless_descriptor_pass = false;
 static bool buffer_device_address_pass = false;
 static bool ray_query_pass = false;
+static bool elide_static_descriptor_checks = false;
 
 void PrintUsage(const char* program) {
     printf(R"(
@@ -44,6 +45,8 @@ USAGE: %s <input> -o <output> <passes>
                Runs BufferDeviceAddressPass
   --ray-query
                Runs RayQueryPass
+  --elide-static-descriptor-checks
+               Skips the descriptor checks BindlessDescriptorPass proves valid
   --timer
                Prints time it takes to instrument entire module
   -h, --help
@@ -75,6 +78,8 @@ bool ParseFlags(int argc, char** argv, const char** out_file) {
             buffer_device_address_pass = true;
         } else if (0 == strcmp(cur_arg, "--ray-query")) {
             ray_query_pass = true;
+        } else if (0 == strcmp(cur_arg, "--elide-static-descriptor-checks")) {
+            elide_static_descriptor_checks = true;
         } else if (0 == strncmp(cur_arg, "--", 2)) {
             printf("Unknown pass %s\n", cur_arg);
             PrintUsage(argv[0]);
@@ -124,15 +129,8 @@ int main(int argc, char** argv) {
     }
 
     gpuav::spirv::Module module(spirv_data, kDefaultShaderId, kInstDefaultDescriptorSet);
-    if (all_passes || bindless_descriptor_pass) {
-        module.RunPassBindlessDescriptor();
-    }
-    if (all_passes || buffer_device_address_pass) {
-        module.RunPassBufferDeviceAddress();
-    }
-    if (all_passes || ray_query_pass) {
-        module.RunPassRayQuery();
-    }
+    module.RunPasses(all_passes || bindless_descriptor_pass, all_passes || buffer_device_address_pass,
+                     all_passes || ray_query_pass, elide_static_descriptor_checks);
 
     for (const auto info : module.link_info_) {
         module.LinkFunction(info);
@@ -547,6 +547,55 @@ TEST_F(VkArmBestPracticesLayerTest, PostTransformVertexCacheThrashingIndicesTest
     best_ibo.memory().unmap();
 }
 
+TEST_F(VkArmBestPracticesLayerTest, PostTransformVertexCacheThrashingIndicesRewritten) {
+    TEST_DESCRIPTION("Test that the index buffer is analysed again once its mapped memory is rewritten between two draws.");
+
+    RETURN_IF_SKIP(InitBestPracticesFramework(kEnableArmValidation));
+    RETURN_IF_SKIP(InitState());
+    InitRenderTarget();
+
+    if (IsPlatformMockICD()) {
+        GTEST_SKIP() << "Test not supported by MockICD";
+    }
+
+    CreatePipelineHelper pipe(*this);
+    pipe.CreateGraphicsPipeline();
+
+    std::vector<uint16_t> worst_indices(128 * 16);
+    std::vector<uint16_t> best_indices(128 * 16);
+    for (size_t i = 0; i < 16; i++) {
+        for (size_t j = 0; j < 128; j++) {
+            worst_indices[j + i * 128] = j;
+            best_indices[i + j * 16] = j;
+        }
+    }
+    const size_t size = worst_indices.size() * sizeof(uint16_t);
+    VkConstantBufferObj ibo(m_device, size, worst_indices.data(), VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+
+    m_commandBuffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+    vk::CmdBindIndexBuffer(m_commandBuffer->handle(), ibo.handle(), static_cast<VkDeviceSize>(0), VK_INDEX_TYPE_UINT16);
+
+    void* data = ibo.memory().map();
+    m_errorMonitor->SetDesiredFailureMsg(kPerformanceWarningBit, "BestPractices-vkCmdDrawIndexed-post-transform-cache-thrashing");
+    vk::CmdDrawIndexed(m_commandBuffer->handle(), worst_indices.size(), 1, 0, 0, 0);
+    m_errorMonitor->VerifyFound();
+
+    // Same buffer and range, the warning must not come from the results of the previous draw
+    memcpy(data, best_indices.data(), size);
+    vk::CmdDrawIndexed(m_commandBuffer->handle(), best_indices.size(), 1, 0, 0, 0);
+
+    memcpy(data, worst_indices.data(), size);
+    m_errorMonitor->SetDesiredFailureMsg(kPerformanceWarningBit, "BestPractices-vkCmdDrawIndexed-post-transform-cache-thrashing");
+    vk::CmdDrawIndexed(m_commandBuffer->handle(), worst_indices.size(), 1, 0, 0, 0);
+    m_errorMonitor->VerifyFound();
+    ibo.memory().unmap();
+
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+}
+
 TEST_F(VkArmBestPracticesLayerTest, PresentModeTest) {
     TEST_DESCRIPTION("Test for usage of Presentation Modes");
 
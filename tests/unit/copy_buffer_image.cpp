@@ -3307,3 +3307,40 @@ TEST_F(NegativeCopyBufferImage, InterleavedRegions) {
 
     m_commandBuffer->end();
 }
+
+TEST_F(NegativeCopyBufferImage, InterleavedRegionsUnordered) {
+    TEST_DESCRIPTION("Test copying between many interleaved regions where the last source region overlaps the first destination.");
+    RETURN_IF_SKIP(Init());
+
+    constexpr uint32_t region_count = 512;
+    constexpr VkDeviceSize region_size = 4;
+    std::vector<VkBufferCopy> copy_infos(region_count);
+    // Source regions are even slots, destination regions are odd slots in reverse order
+    for (uint32_t i = 0; i < region_count; ++i) {
+        copy_infos[i].srcOffset = 2 * i * region_size;
+        copy_infos[i].dstOffset = (2 * (region_count - 1 - i) + 1) * region_size;
+        copy_infos[i].size = region_size;
+    }
+
+    const VkBufferUsageFlags usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer buffer(*m_device, 2 * region_count * region_size, usage, 0);
+    vkt::Buffer buffer_shared_memory(*m_device, buffer.create_info(), vkt::no_mem);
+    buffer_shared_memory.bind_memory(buffer.memory(), 0u);
+
+    m_commandBuffer->begin();
+
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer.handle(), buffer.handle(), region_count, copy_infos.data());
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer.handle(), buffer_shared_memory.handle(), region_count, copy_infos.data());
+
+    // The last source region now overlaps the destination of the first region
+    copy_infos[region_count - 1].srcOffset = copy_infos[0].dstOffset - 1;
+    m_errorMonitor->SetDesiredError("VUID-vkCmdCopyBuffer-pRegions-00117");
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer.handle(), buffer.handle(), region_count, copy_infos.data());
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->SetDesiredError("VUID-vkCmdCopyBuffer-pRegions-00117");
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer.handle(), buffer_shared_memory.handle(), region_count, copy_infos.data());
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->end();
+}
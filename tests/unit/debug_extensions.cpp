@@ -264,6 +264,44 @@ TEST_F(NegativeDebugExtensions, DebugUtilsName) {
     vk::DestroyDebugUtilsMessengerEXT(instance(), my_messenger, nullptr);
 }
 
+TEST_F(NegativeDebugExtensions, DebugUtilsLongName) {
+    TEST_DESCRIPTION("Object names longer than the header buffer of the messages are printed in full");
+
+    AddRequiredExtensions(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    RETURN_IF_SKIP(Init());
+
+    if (IsPlatformMockICD()) {
+        GTEST_SKIP() << "Skipping object naming test with MockICD.";
+    }
+
+    VkBufferCreateInfo buffer_create_info = vku::InitStructHelper();
+    buffer_create_info.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    buffer_create_info.size = 1;
+    vkt::Buffer buffer(*m_device, buffer_create_info, vkt::no_mem);
+
+    VkMemoryRequirements mem_requirements;
+    vk::GetBufferMemoryRequirements(device(), buffer.handle(), &mem_requirements);
+    VkMemoryAllocateInfo memory_allocate_info = vku::InitStructHelper();
+    memory_allocate_info.allocationSize = mem_requirements.size;
+    memory_allocate_info.memoryTypeIndex = 0;
+    vkt::DeviceMemory memory_1(*m_device, memory_allocate_info);
+    vkt::DeviceMemory memory_2(*m_device, memory_allocate_info);
+
+    const std::string memory_name = std::string(4096, 'm') + "_end_of_name";
+    VkDebugUtilsObjectNameInfoEXT name_info = vku::InitStructHelper();
+    name_info.objectType = VK_OBJECT_TYPE_DEVICE_MEMORY;
+    name_info.objectHandle = (uint64_t)memory_2.handle();
+    name_info.pObjectName = memory_name.c_str();
+    vk::SetDebugUtilsObjectNameEXT(device(), &name_info);
+
+    vk::BindBufferMemory(device(), buffer.handle(), memory_1.handle(), 0);
+
+    // The end of the name and the text after it are not cut off
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, memory_name + ", type = VK_OBJECT_TYPE_DEVICE_MEMORY;");
+    vk::BindBufferMemory(device(), buffer.handle(), memory_2.handle(), 0);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeDebugExtensions, DebugMarkerSetUtils) {
     AddRequiredExtensions(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
     AddRequiredExtensions(VK_EXT_DEBUG_MARKER_EXTENSION_NAME);
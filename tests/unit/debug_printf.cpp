@@ -16,12 +16,12 @@
 #include "../framework/descriptor_helper.h"
 #include "../framework/gpu_av_helper.h"
 
-void NegativeDebugPrintf::InitDebugPrintfFramework() {
+void NegativeDebugPrintf::InitDebugPrintfFramework(void *p_next) {
     VkValidationFeatureEnableEXT enables[] = {VK_VALIDATION_FEATURE_ENABLE_DEBUG_PRINTF_EXT};
     VkValidationFeatureDisableEXT disables[] = {
         VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT,
         VK_VALIDATION_FEATURE_DISABLE_OBJECT_LIFETIMES_EXT, VK_VALIDATION_FEATURE_DISABLE_CORE_CHECKS_EXT};
-    VkValidationFeaturesEXT features = vku::InitStructHelper();
+    VkValidationFeaturesEXT features = vku::InitStructHelper(p_next);
     features.enabledValidationFeatureCount = 1;
     features.disabledValidationFeatureCount = 4;
     features.pEnabledValidationFeatures = enables;
@@ -71,6 +71,148 @@ TEST_F(NegativeDebugPrintf, BasicCompute) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeDebugPrintf, RepeatedFormatString) {
+    TEST_DESCRIPTION("Print the same format string from several invocations and submits");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    AddRequiredExtensions(VK_KHR_SHADER_NON_SEMANTIC_INFO_EXTENSION_NAME);
+    RETURN_IF_SKIP(InitDebugPrintfFramework());
+    RETURN_IF_SKIP(InitState());
+
+    char const *shader_source = R"glsl(
+        #version 450
+        #extension GL_EXT_debug_printf : enable
+        layout(local_size_x = 4) in;
+        void main() {
+            debugPrintfEXT("invocation %u at 100%%, %v2d", gl_LocalInvocationIndex, ivec2(-1, gl_LocalInvocationIndex));
+        }
+        )glsl";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, shader_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.CreateComputePipeline();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+    vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    m_commandBuffer->end();
+
+    // The second submit prints with the format string parsed by the first one
+    for (int i = 0; i < 2; ++i) {
+        m_errorMonitor->SetDesiredFailureMsg(kInformationBit, "invocation 0 at 100%, -1, 0");
+        m_errorMonitor->SetDesiredFailureMsg(kInformationBit, "invocation 1 at 100%, -1, 1");
+        m_errorMonitor->SetDesiredFailureMsg(kInformationBit, "invocation 2 at 100%, -1, 2");
+        m_errorMonitor->SetDesiredFailureMsg(kInformationBit, "invocation 3 at 100%, -1, 3");
+        m_default_queue->Submit(*m_commandBuffer);
+        m_default_queue->Wait();
+        m_errorMonitor->VerifyFound();
+    }
+}
+
+TEST_F(NegativeDebugPrintf, DeduplicateMessages) {
+    TEST_DESCRIPTION("Only report the first of the identical messages of a dispatch");
+    const VkBool32 deduplicate = VK_TRUE;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "printf_deduplicate", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &deduplicate};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitDebugPrintfFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    char const *shader_source = R"glsl(
+        #version 450
+        #extension GL_EXT_debug_printf : enable
+        layout(local_size_x = 4) in;
+        void main() {
+            debugPrintfEXT("value %u", gl_LocalInvocationIndex / 2);
+        }
+        )glsl";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, shader_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.CreateComputePipeline();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+    vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    m_commandBuffer->end();
+
+    m_errorMonitor->SetDesiredFailureMsg(kInformationBit, "value 0");
+    m_errorMonitor->SetDesiredFailureMsg(kInformationBit, "value 1");
+    m_errorMonitor->SetDesiredFailureMsg(kInformationBit, "2 duplicate and 0 over the limit Debug Printf messages");
+    m_default_queue->Submit(*m_commandBuffer);
+    m_default_queue->Wait();
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(NegativeDebugPrintf, MaxMessages) {
+    TEST_DESCRIPTION("Limit the number of messages reported for a dispatch");
+    const uint32_t max_messages = 3;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "printf_max_messages", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1,
+                                       &max_messages};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitDebugPrintfFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    char const *shader_source = R"glsl(
+        #version 450
+        #extension GL_EXT_debug_printf : enable
+        layout(local_size_x = 8) in;
+        void main() {
+            debugPrintfEXT("same value");
+        }
+        )glsl";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, shader_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.CreateComputePipeline();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+    vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    m_commandBuffer->end();
+
+    for (uint32_t i = 0; i < max_messages; ++i) {
+        m_errorMonitor->SetDesiredFailureMsg(kInformationBit, "same value");
+    }
+    m_errorMonitor->SetDesiredFailureMsg(kInformationBit, "0 duplicate and 5 over the limit Debug Printf messages");
+    m_default_queue->Submit(*m_commandBuffer);
+    m_default_queue->Wait();
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(NegativeDebugPrintf, OutputFile) {
+    TEST_DESCRIPTION("Write the messages to a file instead of the debug callback");
+    const char *output_file = "debug_printf_output.txt";
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "printf_output_file", VK_LAYER_SETTING_TYPE_STRING_EXT, 1,
+                                       &output_file};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitDebugPrintfFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    char const *shader_source = R"glsl(
+        #version 450
+        #extension GL_EXT_debug_printf : enable
+        void main() {
+            debugPrintfEXT("float == %f", 3.1415f);
+        }
+        )glsl";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, shader_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.CreateComputePipeline();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+    vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    m_commandBuffer->end();
+
+    // The message doesn't go through the debug callback
+    m_errorMonitor->ExpectSuccess(kErrorBit | kWarningBit | kInformationBit);
+    m_default_queue->Submit(*m_commandBuffer);
+    m_default_queue->Wait();
+}
+
 TEST_F(NegativeDebugPrintf, BasicUsage) {
     TEST_DESCRIPTION("Verify that calls to debugPrintfEXT are received in debug stream");
     RETURN_IF_SKIP(InitDebugPrintfFramework());
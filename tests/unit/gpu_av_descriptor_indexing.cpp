@@ -973,6 +973,72 @@ TEST_F(NegativeGpuAVDescriptorIndexing, ArrayOOBCompute) {
     }
 }
 
+TEST_F(NegativeGpuAVDescriptorIndexing, ArrayOOBComputeRebound) {
+    TEST_DESCRIPTION("GPU validation: Descriptors read after the same set was bound again are reported for each dispatch.");
+
+    RETURN_IF_SKIP(InitGpuVUDescriptorIndexing());
+
+    VkMemoryPropertyFlags mem_props = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    vkt::Buffer buffer0(*m_device, 1024, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, mem_props);
+    vkt::Buffer buffer1(*m_device, 1024, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, mem_props);
+
+    VkDescriptorBindingFlags ds_binding_flags[2] = {0, VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT};
+    VkDescriptorSetLayoutBindingFlagsCreateInfo layout_createinfo_binding_flags = vku::InitStructHelper();
+    layout_createinfo_binding_flags.bindingCount = 2;
+    layout_createinfo_binding_flags.pBindingFlags = ds_binding_flags;
+
+    OneOffDescriptorSet descriptor_set(m_device,
+                                       {
+                                           {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+                                           {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 6, VK_SHADER_STAGE_ALL, nullptr},
+                                       },
+                                       0, &layout_createinfo_binding_flags, 0);
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+
+    descriptor_set.WriteDescriptorBufferInfo(0, buffer0.handle(), 0, sizeof(uint32_t), VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+    // Intentionally don't write index 5
+    for (uint32_t i = 0; i < 5; i++) {
+        descriptor_set.WriteDescriptorBufferInfo(1, buffer1.handle(), 0, 4 * sizeof(float), VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, i);
+    }
+    descriptor_set.UpdateDescriptorSets();
+
+    char const *csSource = R"glsl(
+        #version 450
+        #extension GL_EXT_nonuniform_qualifier : enable
+        layout(set = 0, binding = 0) uniform ufoo { uint index; } u_index;
+        layout(set = 0, binding = 1) buffer StorageBuffer {
+            uint data;
+        } Data[];
+        void main() {
+            Data[0].data = Data[u_index.index].data;
+        }
+    )glsl";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, csSource, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.cp_ci_.layout = pipeline_layout.handle();
+    pipe.CreateComputePipeline();
+
+    // Every bind refers to the one version of the set recorded by the first
+    constexpr uint32_t bind_count = 4;
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+    for (uint32_t i = 0; i < bind_count; i++) {
+        vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout.handle(), 0, 1,
+                                  &descriptor_set.set_, 0, nullptr);
+        vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    }
+    m_commandBuffer->end();
+
+    uint32_t *data = (uint32_t *)buffer0.memory().map();
+    data[0] = 5;
+    buffer0.memory().unmap();
+    m_errorMonitor->SetDesiredError("VUID-vkCmdDispatch-None-08114", bind_count);
+    m_default_queue->Submit(*m_commandBuffer);
+    m_default_queue->Wait();
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeGpuAVDescriptorIndexing, ArrayEarlyDelete) {
     TEST_DESCRIPTION("GPU validation: Verify detection descriptors where resources have been deleted while in use.");
     RETURN_IF_SKIP(InitGpuVUDescriptorIndexing());
@@ -943,10 +943,11 @@ TEST_F(NegativeGpuAVOOB, StorageBuffer) {
     m_errorMonitor->VerifyFound();
 }
 
-void NegativeGpuAVOOB::ComputeStorageBufferTest(const char *expected_error, const char *shader, VkDeviceSize buffer_size) {
+void NegativeGpuAVOOB::ComputeStorageBufferTest(const char *expected_error, const char *shader, VkDeviceSize buffer_size,
+                                                void *p_next) {
     SetTargetApiVersion(VK_API_VERSION_1_2);
     AddDisabledFeature(vkt::Feature::robustBufferAccess);
-    RETURN_IF_SKIP(InitGpuAvFramework());
+    RETURN_IF_SKIP(InitGpuAvFramework(p_next));
     RETURN_IF_SKIP(InitState());
 
     CreateComputePipelineHelper pipe(*this);
@@ -1012,6 +1013,51 @@ TEST_F(NegativeGpuAVOOB, Matrix) {
     ComputeStorageBufferTest("VUID-vkCmdDispatch-storageBuffers-06936", shader_source, 30);
 }
 
+TEST_F(NegativeGpuAVOOB, RepeatedWrite) {
+    TEST_DESCRIPTION("Write twice to the same OOB location, the second write reuses the check of the first one");
+
+    char const *shader_source = R"glsl(
+        #version 450
+
+        // 28 bytes large
+        layout(set = 0, binding = 0, std430) buffer foo {
+            int a;
+            vec3 b; // offset 16
+        } in_buffer;
+
+        void main() {
+            in_buffer.b.y = 0.0;
+            in_buffer.a = 1;
+            in_buffer.b.y = 1.0;
+        }
+    )glsl";
+    ComputeStorageBufferTest("VUID-vkCmdDispatch-storageBuffers-06936", shader_source, 20);
+}
+
+TEST_F(NegativeGpuAVOOB, OverlappedErrorReadback) {
+    TEST_DESCRIPTION("The error is read back by the queue thread of gpuav_overlapped_error_readback");
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "gpuav_overlapped_error_readback", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1,
+                                       &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+
+    char const *shader_source = R"glsl(
+        #version 450
+
+        // 28 bytes large
+        layout(set = 0, binding = 0, std430) buffer foo {
+            int a;
+            vec3 b; // offset 16
+        } in_buffer;
+
+        void main() {
+            in_buffer.b.y = 0.0;
+        }
+    )glsl";
+    ComputeStorageBufferTest("VUID-vkCmdDispatch-storageBuffers-06936", shader_source, 20, &layer_settings_create_info);
+}
+
 TEST_F(NegativeGpuAVOOB, TexelFetch) {
     TEST_DESCRIPTION("index into a texelFetch OOB");
     SetTargetApiVersion(VK_API_VERSION_1_2);
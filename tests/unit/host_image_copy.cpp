@@ -66,6 +66,43 @@ TEST_F(NegativeHostImageCopy, ImageLayout) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeHostImageCopy, ImageLayoutSplitRegions) {
+    TEST_DESCRIPTION("Bad Image Layout for a subresource copied in several regions is reported once");
+    image_ci = vkt::Image::ImageCreateInfo2D(
+        width, height, 1, 1, format,
+        VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT);
+    RETURN_IF_SKIP(InitHostImageCopyTest(image_ci));
+
+    vkt::Image image(*m_device, image_ci);
+    image.SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+
+    std::vector<uint8_t> pixels(width * height * 4);
+
+    // Each region copies a quarter of the same subresource
+    VkMemoryToImageCopyEXT quarter_region = vku::InitStructHelper();
+    quarter_region.pHostPointer = pixels.data();
+    quarter_region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    quarter_region.imageSubresource.layerCount = 1;
+    quarter_region.imageExtent.width = width / 2;
+    quarter_region.imageExtent.height = height / 2;
+    quarter_region.imageExtent.depth = 1;
+    std::vector<VkMemoryToImageCopyEXT> regions(4, quarter_region);
+    for (uint32_t i = 0; i < 4; ++i) {
+        regions[i].imageOffset.x = static_cast<int32_t>((i % 2) * (width / 2));
+        regions[i].imageOffset.y = static_cast<int32_t>((i / 2) * (height / 2));
+    }
+
+    VkCopyMemoryToImageInfoEXT copy_to_image = vku::InitStructHelper();
+    copy_to_image.dstImage = image;
+    copy_to_image.dstImageLayout = VK_IMAGE_LAYOUT_GENERAL;
+    copy_to_image.regionCount = static_cast<uint32_t>(regions.size());
+    copy_to_image.pRegions = regions.data();
+
+    m_errorMonitor->SetDesiredError("VUID-VkCopyMemoryToImageInfoEXT-dstImageLayout-09059");
+    vk::CopyMemoryToImageEXT(*m_device, &copy_to_image);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeHostImageCopy, ImageOffset) {
     image_ci = vkt::Image::ImageCreateInfo2D(
         width, height, 1, 1, format,
@@ -130,6 +130,52 @@ TEST_F(PositiveImage, AliasedMemoryTracking) {
     image.bind_memory(mem, 0);
 }
 
+TEST_F(PositiveImage, AliasedImagesSuballocated) {
+    TEST_DESCRIPTION("Aliased images bound at the same offset of a memory also used by a buffer share their layout");
+
+    RETURN_IF_SKIP(Init());
+
+    auto image_ci = vkt::Image::ImageCreateInfo2D(64, 64, 1, 1, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+    image_ci.flags = VK_IMAGE_CREATE_ALIAS_BIT;
+    vkt::Image image(*m_device, image_ci, vkt::no_mem);
+    vkt::Image image_alias(*m_device, image_ci, vkt::no_mem);
+    vkt::Buffer buffer(*m_device, vkt::Buffer::create_info(256, VK_BUFFER_USAGE_TRANSFER_DST_BIT), vkt::no_mem);
+
+    const auto buffer_memory_requirements = buffer.memory_requirements();
+    const auto image_memory_requirements = image.memory_requirements();
+    const VkDeviceSize image_offset = ((buffer_memory_requirements.size + image_memory_requirements.alignment - 1) /
+                                       image_memory_requirements.alignment) *
+                                      image_memory_requirements.alignment;
+
+    VkMemoryAllocateInfo alloc_info = vku::InitStructHelper();
+    alloc_info.allocationSize = image_offset + image_memory_requirements.size;
+    bool has_memtype = m_device->phy().set_memory_type(
+        buffer_memory_requirements.memoryTypeBits & image_memory_requirements.memoryTypeBits, &alloc_info, 0);
+    if (!has_memtype) {
+        GTEST_SKIP() << "Failed to find a memory type for both a buffer and an image";
+    }
+    vkt::DeviceMemory mem(*m_device, alloc_info);
+
+    buffer.bind_memory(mem, 0);
+    image.bind_memory(mem, image_offset);
+    image_alias.bind_memory(mem, image_offset);
+
+    m_commandBuffer->begin();
+    image.SetLayout(m_commandBuffer, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_GENERAL);
+    m_commandBuffer->end();
+    m_default_queue->Submit(*m_commandBuffer);
+    m_default_queue->Wait();
+
+    // The alias was never transitioned itself
+    VkClearColorValue clear_color = {};
+    VkImageSubresourceRange range = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    m_commandBuffer->begin();
+    vk::CmdClearColorImage(m_commandBuffer->handle(), image_alias.handle(), VK_IMAGE_LAYOUT_GENERAL, &clear_color, 1, &range);
+    m_commandBuffer->end();
+    m_default_queue->Submit(*m_commandBuffer);
+    m_default_queue->Wait();
+}
+
 TEST_F(PositiveImage, CreateImageViewFollowsParameterCompatibilityRequirements) {
     TEST_DESCRIPTION("Verify that creating an ImageView with valid usage does not generate validation errors.");
 
@@ -191,6 +191,34 @@ TEST_F(NegativeMemory, MapMemory) {
     vk::FreeMemory(device(), mem, NULL);
 }
 
+TEST_F(NegativeMemory, FlushMappedMemoryRangesInterleaved) {
+    TEST_DESCRIPTION("Flush ranges of a mapped and an unmapped memory given in turns");
+    RETURN_IF_SKIP(Init());
+
+    VkMemoryAllocateInfo memory_info = vku::InitStructHelper();
+    memory_info.allocationSize = 64 << 10;
+    ASSERT_TRUE(m_device->phy().set_memory_type(vvl::kU32Max, &memory_info, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT));
+    vkt::DeviceMemory mapped_memory(*m_device, memory_info);
+    vkt::DeviceMemory unmapped_memory(*m_device, memory_info);
+
+    uint8_t *pData;
+    ASSERT_EQ(VK_SUCCESS, vk::MapMemory(device(), mapped_memory.handle(), 0, VK_WHOLE_SIZE, 0, (void **)&pData));
+
+    VkMappedMemoryRange ranges[4];
+    for (uint32_t i = 0; i < 4; ++i) {
+        ranges[i] = vku::InitStructHelper();
+        ranges[i].memory = (i % 2 == 0) ? mapped_memory.handle() : unmapped_memory.handle();
+        ranges[i].offset = 0;
+        ranges[i].size = VK_WHOLE_SIZE;
+    }
+    // Only the ranges of the unmapped memory are reported
+    m_errorMonitor->SetDesiredError("VUID-VkMappedMemoryRange-memory-00684", 2);
+    vk::FlushMappedMemoryRanges(device(), 4, ranges);
+    m_errorMonitor->VerifyFound();
+
+    vk::UnmapMemory(device(), mapped_memory.handle());
+}
+
 TEST_F(NegativeMemory, MapMemory2) {
     TEST_DESCRIPTION("Attempt to map memory in a number of incorrect ways");
 
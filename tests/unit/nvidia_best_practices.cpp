@@ -943,6 +943,70 @@ TEST_F(VkNvidiaBestPracticesLayerTest, BindPipeline_ZcullDirection)
     m_commandBuffer->end();
 }
 
+TEST_F(VkNvidiaBestPracticesLayerTest, ZcullDirectionDeferred) {
+    TEST_DESCRIPTION("With deferred vendor checks, the Z-cull direction is only evaluated when the command buffer ends");
+    SetTargetApiVersion(VK_API_VERSION_1_3);
+
+    const char *enables[] = {kEnableNVIDIAValidation};
+    const VkBool32 deferred = VK_TRUE;
+    const VkLayerSettingEXT settings[] = {
+        {OBJECT_LAYER_NAME, "enables", VK_LAYER_SETTING_TYPE_STRING_EXT, 1, enables},
+        {OBJECT_LAYER_NAME, "validate_best_practices_deferred_vendor_checks", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &deferred},
+    };
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr,
+                                                               static_cast<uint32_t>(std::size(settings)), settings};
+    features_.pNext = &layer_settings_create_info;
+    RETURN_IF_SKIP(InitFramework(&features_));
+
+    VkPhysicalDeviceDynamicRenderingFeaturesKHR dynamic_rendering_features = vku::InitStructHelper();
+    VkPhysicalDeviceFeatures2 features2 = GetPhysicalDeviceFeatures2(dynamic_rendering_features);
+    if (!dynamic_rendering_features.dynamicRendering) {
+        GTEST_SKIP() << "This test requires dynamicRendering";
+    }
+    RETURN_IF_SKIP(InitState(nullptr, &features2));
+
+    VkFormat depth_format = VK_FORMAT_D32_SFLOAT_S8_UINT;
+    VkPipelineRenderingCreateInfo pipeline_rendering_info = vku::InitStructHelper();
+    pipeline_rendering_info.depthAttachmentFormat = depth_format;
+    pipeline_rendering_info.stencilAttachmentFormat = depth_format;
+
+    vkt::Image image(*m_device, 32, 32, 1, depth_format, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT);
+    vkt::ImageView depth_image_view = image.CreateView(VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT);
+
+    VkRenderingAttachmentInfo depth_attachment = vku::InitStructHelper();
+    depth_attachment.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+    depth_attachment.imageView = depth_image_view.handle();
+    depth_attachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+
+    VkRenderingInfo begin_rendering_info = vku::InitStructHelper();
+    begin_rendering_info.renderArea.extent = {32, 32};
+    begin_rendering_info.layerCount = 1;
+    begin_rendering_info.pDepthAttachment = &depth_attachment;
+    begin_rendering_info.pStencilAttachment = &depth_attachment;
+
+    CreatePipelineHelper pipe(*this, &pipeline_rendering_info);
+    pipe.ds_ci_ = vku::InitStructHelper();
+    pipe.AddDynamicState(VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE);
+    pipe.AddDynamicState(VK_DYNAMIC_STATE_DEPTH_COMPARE_OP);
+    pipe.CreateGraphicsPipeline();
+
+    auto cmd = m_commandBuffer->handle();
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+    vk::CmdSetDepthTestEnable(cmd, VK_TRUE);
+    vk::CmdBeginRendering(cmd, &begin_rendering_info);
+    vk::CmdSetDepthCompareOp(cmd, VK_COMPARE_OP_LESS);
+    for (int i = 0; i < 60; ++i) vk::CmdDraw(cmd, 0, 0, 0, 0);
+    vk::CmdSetDepthCompareOp(cmd, VK_COMPARE_OP_GREATER);
+    for (int i = 0; i < 40; ++i) vk::CmdDraw(cmd, 0, 0, 0, 0);
+    // The balance is only found when the logged commands are replayed
+    vk::CmdEndRendering(cmd);
+
+    m_errorMonitor->SetDesiredFailureMsg(kPerformanceWarningBit, "BestPractices-Zcull-LessGreaterRatio");
+    m_commandBuffer->end();
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(VkNvidiaBestPracticesLayerTest, ClearColor_NotCompressed)
 {
     SetTargetApiVersion(VK_API_VERSION_1_3);
@@ -254,6 +254,77 @@ TEST_F(VkLayerTest, DuplicateMessageLimit) {
     vk::GetPhysicalDeviceProperties2KHR(gpu(), &properties2);
 }
 
+TEST_F(VkLayerTest, DuplicateMessageLimitPerObject) {
+    TEST_DESCRIPTION("Use duplicate_message_limit_scope VUID_AND_OBJECT and verify each object has its own limit");
+
+    uint32_t value = 1;
+    const char *scope = "VUID_AND_OBJECT";
+    const VkLayerSettingEXT settings[] = {
+        {OBJECT_LAYER_NAME, "duplicate_message_limit", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1, &value},
+        {OBJECT_LAYER_NAME, "duplicate_message_limit_scope", VK_LAYER_SETTING_TYPE_STRING_EXT, 1, &scope}};
+    VkLayerSettingsCreateInfoEXT create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 2, settings};
+
+    RETURN_IF_SKIP(InitFramework(&create_info));
+    RETURN_IF_SKIP(InitState());
+
+    // End command buffers that were never begun
+    vkt::CommandBuffer cb0(*m_device, m_command_pool);
+    vkt::CommandBuffer cb1(*m_device, m_command_pool);
+
+    m_errorMonitor->SetDesiredError("VUID-vkEndCommandBuffer-commandBuffer-00059");
+    vk::EndCommandBuffer(cb0.handle());
+    m_errorMonitor->VerifyFound();
+
+    // Same message for another object is still reported
+    m_errorMonitor->SetDesiredError("VUID-vkEndCommandBuffer-commandBuffer-00059");
+    vk::EndCommandBuffer(cb1.handle());
+    m_errorMonitor->VerifyFound();
+
+    // Both objects are at the limit now
+    vk::EndCommandBuffer(cb0.handle());
+    vk::EndCommandBuffer(cb1.handle());
+}
+
+#if GTEST_IS_THREADSAFE
+TEST_F(VkLayerTest, DuplicateMessageLimitThreaded) {
+    TEST_DESCRIPTION("Hit the duplicate_message_limit from several threads at once and get exactly the limit reported");
+    AddRequiredExtensions(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+
+    uint32_t value = 3;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "duplicate_message_limit", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1, &setting};
+
+    RETURN_IF_SKIP(InitFramework(&create_info));
+    RETURN_IF_SKIP(InitState());
+
+    VkBaseOutStructure bogus_struct{};
+    bogus_struct.sType = static_cast<VkStructureType>(0x33333333);
+
+    const auto query = [&]() {
+        VkPhysicalDeviceProperties2KHR properties2 = vku::InitStructHelper(&bogus_struct);
+        for (uint32_t i = 0; i < 16; ++i) {
+            vk::GetPhysicalDeviceProperties2KHR(gpu(), &properties2);
+        }
+    };
+
+    // Any report past the limit is an unexpected error
+    m_errorMonitor->SetDesiredError("VUID-VkPhysicalDeviceProperties2-pNext-pNext", 3);
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < 4; ++i) {
+        threads.emplace_back(query);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    m_errorMonitor->VerifyFound();
+
+    // Another message has its own count
+    m_errorMonitor->SetDesiredError("VUID-vkGetPhysicalDeviceFeatures-pFeatures-parameter");
+    vk::GetPhysicalDeviceFeatures(gpu(), nullptr);
+    m_errorMonitor->VerifyFound();
+}
+#endif  // GTEST_IS_THREADSAFE
+
 TEST_F(VkLayerTest, VuidCheckForHashCollisions) {
     TEST_DESCRIPTION("Ensure there are no VUID hash collisions");
 
@@ -376,6 +447,33 @@ TEST_F(VkLayerTest, VuidFilterInt) {
     TestRenderPassCreate(m_errorMonitor, *m_device, rpci, false, "VUID-VkInputAttachmentAspectReference-aspectMask-01964", nullptr);
 }
 
+TEST_F(VkLayerTest, SkipValidateEntryPoints) {
+    TEST_DESCRIPTION("Use the skip_validate_entry_points setting and verify only the listed entry points are not validated");
+
+    const char *entry_points[] = {"vkCmdFillBuffer"};
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "skip_validate_entry_points", VK_LAYER_SETTING_TYPE_STRING_EXT, 1,
+                                       entry_points};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1, &setting};
+
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    vkt::Buffer buffer(*m_device, 16, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    uint32_t update_data[4] = {0, 0, 0, 0};
+    m_commandBuffer->begin();
+
+    // dstOffset is past the end of the buffer, but vkCmdFillBuffer is not validated
+    vk::CmdFillBuffer(m_commandBuffer->handle(), buffer.handle(), 32, 4, 0x11111111);
+
+    // Other entry points are still validated
+    m_errorMonitor->SetDesiredError("VUID-vkCmdUpdateBuffer-dstOffset-00032");
+    vk::CmdUpdateBuffer(m_commandBuffer->handle(), buffer.handle(), 32, sizeof(update_data), update_data);
+    m_errorMonitor->VerifyFound();
+
+    // The recording state was still tracked through the skipped call
+    m_commandBuffer->end();
+}
+
 TEST_F(VkLayerTest, RequiredParameter) {
     TEST_DESCRIPTION("Specify VK_NULL_HANDLE, NULL, and 0 for required handle, pointer, array, and array count parameters");
 
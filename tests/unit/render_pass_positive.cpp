@@ -1433,4 +1433,36 @@ TEST_F(PositiveRenderPass, BeginRenderPassWithRenderPassStriped) {
     submit_info.pCommandBufferInfos = &cb_submit_info;
     vk::QueueSubmit2KHR(m_default_queue->handle(), 1, &submit_info, VK_NULL_HANDLE);
     m_default_queue->Wait();
-}
\ No newline at end of file
+}
+
+TEST_F(PositiveRenderPass, IdenticalRenderPassDestroyed) {
+    TEST_DESCRIPTION("Use a render pass after an identical one, which shares its subpass transitions, was destroyed");
+
+    RETURN_IF_SKIP(Init());
+
+    RenderPassSingleSubpass rp_destroyed(*this);
+    RenderPassSingleSubpass rp(*this);
+    for (RenderPassSingleSubpass *render_pass : {&rp_destroyed, &rp}) {
+        render_pass->AddAttachmentDescription(VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_LAYOUT_UNDEFINED,
+                                              VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+        render_pass->AddAttachmentReference({0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL});
+        render_pass->AddColorAttachment(0);
+        render_pass->AddSubpassDependency();
+        render_pass->CreateRenderPass();
+    }
+    rp_destroyed.Destroy();
+
+    vkt::Image image(*m_device, 32, 32, 1, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT);
+    image.SetLayout(VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+    vkt::ImageView view = image.CreateView();
+    vkt::Framebuffer fb(*m_device, rp.Handle(), 1, &view.handle());
+
+    // The barrier inside the render pass is only valid if the transition to the subpass layout was applied
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(rp.Handle(), fb.handle(), 32, 32);
+    image.ImageMemoryBarrier(m_commandBuffer, VK_IMAGE_ASPECT_COLOR_BIT, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                             VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                             VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+}
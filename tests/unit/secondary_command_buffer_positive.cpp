@@ -359,6 +359,30 @@ TEST_F(PositiveSecondaryCommandBuffer, EventsIn) {
     m_default_queue->Wait();
 }
 
+TEST_F(PositiveSecondaryCommandBuffer, WaitEventsAfterPrimaryEvents) {
+    TEST_DESCRIPTION("Wait in a secondary command buffer for an event set by the primary after other events");
+    RETURN_IF_SKIP(Init());
+
+    vkt::Event event_transfer(*m_device);
+    vkt::Event event_vertex(*m_device);
+
+    vkt::CommandBuffer secondary(*m_device, m_command_pool, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    secondary.begin();
+    vk::CmdWaitEvents(secondary.handle(), 1, &event_vertex.handle(), VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+                      VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, nullptr, 0, nullptr, 0, nullptr);
+    secondary.end();
+
+    // The events of the primary come first, the wait must still be checked against the event of the secondary
+    m_commandBuffer->begin();
+    vk::CmdSetEvent(m_commandBuffer->handle(), event_transfer.handle(), VK_PIPELINE_STAGE_TRANSFER_BIT);
+    vk::CmdSetEvent(m_commandBuffer->handle(), event_vertex.handle(), VK_PIPELINE_STAGE_VERTEX_SHADER_BIT);
+    vk::CmdExecuteCommands(m_commandBuffer->handle(), 1, &secondary.handle());
+    m_commandBuffer->end();
+
+    m_default_queue->Submit(*m_commandBuffer);
+    m_default_queue->Wait();
+}
+
 TEST_F(PositiveSecondaryCommandBuffer, Nested) {
     SetTargetApiVersion(VK_API_VERSION_1_1);
     AddRequiredExtensions(VK_EXT_NESTED_COMMAND_BUFFER_EXTENSION_NAME);
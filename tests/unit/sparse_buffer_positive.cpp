@@ -347,3 +347,52 @@ TEST_F(PositiveSparseBuffer, BindSparseEmpty) {
     vk::QueueBindSparse(sparse_queue->handle(), 0u, nullptr, VK_NULL_HANDLE);
     sparse_queue->Wait();
 }
+
+TEST_F(PositiveSparseBuffer, BindSparsePages) {
+    TEST_DESCRIPTION("Bind every page of a sparse buffer in reverse order in a single vkQueueBindSparse, then use it");
+    AddRequiredFeature(vkt::Feature::sparseBinding);
+    RETURN_IF_SKIP(Init());
+
+    if (m_device->QueuesWithSparseCapability().empty()) {
+        GTEST_SKIP() << "Required SPARSE_BINDING queue families not present";
+    }
+
+    VkBufferCreateInfo b_info = vkt::Buffer::create_info(0x10000, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, nullptr);
+    b_info.flags = VK_BUFFER_CREATE_SPARSE_BINDING_BIT;
+    vkt::Buffer buffer_sparse(*m_device, b_info, vkt::no_mem);
+    vkt::Buffer buffer_dst(*m_device, b_info.size, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    VkMemoryRequirements buffer_mem_reqs;
+    vk::GetBufferMemoryRequirements(device(), buffer_sparse.handle(), &buffer_mem_reqs);
+    VkMemoryAllocateInfo buffer_mem_alloc =
+        vkt::DeviceMemory::get_resource_alloc_info(*m_device, buffer_mem_reqs, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    vkt::DeviceMemory buffer_mem(*m_device, buffer_mem_alloc);
+
+    const VkDeviceSize page_size = buffer_mem_reqs.alignment;
+    const uint32_t page_count = static_cast<uint32_t>(buffer_mem_reqs.size / page_size);
+    std::vector<VkSparseMemoryBind> page_binds(page_count);
+    for (uint32_t i = 0; i < page_count; ++i) {
+        const VkDeviceSize offset = (page_count - 1 - i) * page_size;
+        page_binds[i] = {offset, page_size, buffer_mem.handle(), offset, 0};
+    }
+
+    VkSparseBufferMemoryBindInfo buffer_memory_bind_info = {};
+    buffer_memory_bind_info.buffer = buffer_sparse.handle();
+    buffer_memory_bind_info.bindCount = page_count;
+    buffer_memory_bind_info.pBinds = page_binds.data();
+
+    VkBindSparseInfo bind_info = vku::InitStructHelper();
+    bind_info.bufferBindCount = 1;
+    bind_info.pBufferBinds = &buffer_memory_bind_info;
+
+    vkt::Queue* sparse_queue = m_device->QueuesWithSparseCapability()[0];
+    vk::QueueBindSparse(sparse_queue->handle(), 1, &bind_info, VK_NULL_HANDLE);
+    sparse_queue->Wait();
+
+    m_commandBuffer->begin();
+    VkBufferCopy copy_info = {0, 0, b_info.size};
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer_sparse.handle(), buffer_dst.handle(), 1, &copy_info);
+    m_commandBuffer->end();
+    m_default_queue->Submit(*m_commandBuffer);
+    m_default_queue->Wait();
+}
@@ -208,6 +208,68 @@ TEST_F(NegativeSyncVal, BufferCopyHazards) {
     }
 }
 
+TEST_F(NegativeSyncVal, BufferCopyHazardsCoarseTracking) {
+    TEST_DESCRIPTION("Coarse buffer tracking reports the same hazards as exact tracking");
+    const VkBool32 coarse_tracking = VK_TRUE;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "syncval_coarse_buffer_tracking", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1,
+                                       &coarse_tracking};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    VkValidationFeatureEnableEXT enables[] = {VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION_EXT};
+    VkValidationFeaturesEXT features = vku::InitStructHelper(&layer_settings_create_info);
+    features.enabledValidationFeatureCount = 1;
+    features.pEnabledValidationFeatures = enables;
+    RETURN_IF_SKIP(InitFramework(&features));
+    RETURN_IF_SKIP(InitState());
+
+    VkBufferUsageFlags transfer_usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer buffer_a(*m_device, 256, transfer_usage);
+    vkt::Buffer buffer_b(*m_device, 256, transfer_usage);
+
+    VkBufferCopy front2front = {0, 0, 128};
+    VkBufferCopy front2back = {0, 128, 128};
+    VkBufferCopy back2back = {128, 128, 128};
+
+    m_commandBuffer->begin();
+    vk::CmdCopyBuffer(*m_commandBuffer, buffer_a.handle(), buffer_b.handle(), 1, &front2front);
+    // Disjoint from the first copy, the whole buffer conflict switches buffer_b to exact tracking
+    vk::CmdCopyBuffer(*m_commandBuffer, buffer_a.handle(), buffer_b.handle(), 1, &back2back);
+
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    vk::CmdCopyBuffer(*m_commandBuffer, buffer_a.handle(), buffer_b.handle(), 1, &front2back);
+    m_errorMonitor->VerifyFound();
+    m_commandBuffer->end();
+}
+
+TEST_F(NegativeSyncVal, RepeatedHazardReportedOnce) {
+    TEST_DESCRIPTION("The same hazard found again in a command buffer is reported once, until the command buffer is reset");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    VkBufferUsageFlags transfer_usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer buffer_a(*m_device, 256, transfer_usage);
+    vkt::Buffer buffer_b(*m_device, 256, transfer_usage);
+    VkBufferCopy region = {0, 0, 256};
+
+    m_commandBuffer->begin();
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    vk::CmdFillBuffer(m_commandBuffer->handle(), buffer_b.handle(), 0, 256, 1);
+    m_errorMonitor->VerifyFound();
+    // Same objects, usage and prior access as the fill above
+    vk::CmdFillBuffer(m_commandBuffer->handle(), buffer_b.handle(), 0, 256, 1);
+    m_commandBuffer->end();
+
+    // The reported hazards are forgotten with the rest of the recorded state
+    m_commandBuffer->reset();
+    m_commandBuffer->begin();
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    vk::CmdFillBuffer(m_commandBuffer->handle(), buffer_b.handle(), 0, 256, 1);
+    m_errorMonitor->VerifyFound();
+    m_commandBuffer->end();
+}
+
 TEST_F(NegativeSyncVal, BufferCopyHazardsSync2) {
     SetTargetApiVersion(VK_API_VERSION_1_2);
     AddRequiredExtensions(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
@@ -4514,6 +4576,52 @@ TEST_F(NegativeSyncVal, QSBufferCopyHazards) {
     test.DeviceWait();
 }
 
+TEST_F(NegativeSyncVal, QSHistoryMemoryBudget) {
+    TEST_DESCRIPTION("Hazards against submissions whose command details were discarded by the memory budget are still reported");
+    const uint32_t budget_mb = 1;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "syncval_history_memory_budget", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1,
+                                       &budget_mb};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    VkValidationFeatureEnableEXT enables[] = {VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION_EXT};
+    VkValidationFeaturesEXT features = vku::InitStructHelper(&layer_settings_create_info);
+    features.enabledValidationFeatureCount = 1;
+    features.pEnabledValidationFeatures = enables;
+    RETURN_IF_SKIP(InitFramework(&features));
+    RETURN_IF_SKIP(InitState());
+
+    QSTestContext test(m_device, m_device->QueuesWithGraphicsCapability()[0]);
+    if (!test.Valid()) {
+        GTEST_SKIP() << "Test requires a valid queue object.";
+    }
+
+    // The write to buffer_b is the oldest access in the queue history
+    test.BeginA();
+    test.CopyAToB();
+    test.End();
+    test.Submit0(test.cba);
+
+    // Enough access log to push the history of the first submission out of the budget
+    test.BeginB();
+    const VkBufferMemoryBarrier waw_barrier =
+        test.InitBufferBarrier(test.buffer_a, VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_TRANSFER_WRITE_BIT);
+    for (uint32_t i = 0; i < 32768; ++i) {
+        test.CopyCToA();
+        test.TransferBarrier(waw_barrier);
+    }
+    test.End();
+    test.Submit0(test.cbb);
+
+    test.BeginC();
+    test.CopyCToB();
+    test.End();
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    test.Submit0(test.cbc);
+    m_errorMonitor->VerifyFound();
+
+    test.DeviceWait();
+}
+
 TEST_F(NegativeSyncVal, QSSubmit2) {
     SetTargetApiVersion(VK_API_VERSION_1_3);
     AddRequiredFeature(vkt::Feature::synchronization2);
@@ -6285,3 +6393,40 @@ TEST_F(NegativeSyncVal, RenderPassStoreOpNone) {
     m_errorMonitor->VerifyFound();
     m_commandBuffer->end();
 }
+
+TEST_F(NegativeSyncVal, GlobalBarriersBetweenCopies) {
+    TEST_DESCRIPTION("Global memory barriers recorded between copies are applied to the accesses they cover");
+    RETURN_IF_SKIP(InitSyncVal());
+
+    const VkBufferUsageFlags transfer_usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer buffer_a(*m_device, 256, transfer_usage);
+    vkt::Buffer buffer_b(*m_device, 256, transfer_usage);
+    vkt::Buffer buffer_c(*m_device, 256, transfer_usage);
+
+    VkMemoryBarrier mem_barrier = vku::InitStructHelper();
+    mem_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    mem_barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+    m_commandBuffer->begin();
+    m_commandBuffer->Copy(buffer_a, buffer_b);
+
+    // The barrier makes the write visible to compute shaders only
+    vk::CmdPipelineBarrier(*m_commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1,
+                           &mem_barrier, 0, nullptr, 0, nullptr);
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-READ-AFTER-WRITE");
+    m_commandBuffer->Copy(buffer_b, buffer_c);
+    m_errorMonitor->VerifyFound();
+
+    // A second barrier chained to the first one makes the write visible to transfer reads
+    mem_barrier.srcAccessMask = 0;
+    mem_barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    vk::CmdPipelineBarrier(*m_commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1,
+                           &mem_barrier, 0, nullptr, 0, nullptr);
+    m_commandBuffer->Copy(buffer_b, buffer_c);
+
+    // The barriers were recorded before the write to c, so they don't protect it
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-WRITE");
+    m_commandBuffer->Copy(buffer_a, buffer_c);
+    m_errorMonitor->VerifyFound();
+    m_commandBuffer->end();
+}
@@ -1546,3 +1546,30 @@ TEST_F(PositiveSyncVal, SignalUnsignalSignalSingleSubmit) {
     vk::QueueSubmit2(*m_default_queue, 3, submits, VK_NULL_HANDLE);
     m_default_queue->Wait();
 }
+
+TEST_F(PositiveSyncVal, ChainedBufferBarriers) {
+    TEST_DESCRIPTION("Two buffer barriers form an execution dependency chain without any global memory barrier");
+    RETURN_IF_SKIP(InitSyncVal());
+
+    vkt::Buffer buffer_a(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_b(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_c(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    VkBufferMemoryBarrier buffer_barrier = vku::InitStructHelper();
+    buffer_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    buffer_barrier.dstAccessMask = 0;
+    buffer_barrier.buffer = buffer_a.handle();
+    buffer_barrier.size = VK_WHOLE_SIZE;
+
+    m_command_buffer.begin();
+    m_command_buffer.Copy(buffer_b, buffer_a);
+    vk::CmdPipelineBarrier(m_command_buffer.handle(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0,
+                           nullptr, 1, &buffer_barrier, 0, nullptr);
+    // The second barrier chains with the first one
+    buffer_barrier.srcAccessMask = 0;
+    buffer_barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    vk::CmdPipelineBarrier(m_command_buffer.handle(), VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
+                           nullptr, 1, &buffer_barrier, 0, nullptr);
+    m_command_buffer.Copy(buffer_a, buffer_c);
+    m_command_buffer.end();
+}
@@ -240,6 +240,67 @@ TEST_F(PositiveThreading, DebugObjectNames) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(PositiveThreading, OwnedCommandBufferHandover) {
+    TEST_DESCRIPTION("Record a command buffer from one thread long enough to be owned by it, then continue from another thread");
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "thread_safety_owned_command_buffers", VK_LAYER_SETTING_TYPE_BOOL32_EXT,
+                                       1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    vkt::Event event(*m_device);
+    const auto record = [&]() {
+        for (uint32_t i = 0; i < 64; ++i) {
+            vk::CmdSetEvent(m_commandBuffer->handle(), event.handle(), VK_PIPELINE_STAGE_TRANSFER_BIT);
+            vk::CmdResetEvent(m_commandBuffer->handle(), event.handle(), VK_PIPELINE_STAGE_TRANSFER_BIT);
+        }
+    };
+
+    m_commandBuffer->begin();
+    std::thread thread1(record);
+    thread1.join();
+    std::thread thread2(record);
+    thread2.join();
+    m_commandBuffer->end();
+    m_default_queue->Submit(*m_commandBuffer);
+    m_device->Wait();
+}
+
+TEST_F(PositiveThreading, LinkParentsWhileInvalidating) {
+    TEST_DESCRIPTION("Bind one buffer from several threads while another thread creates and destroys views of it");
+    RETURN_IF_SKIP(Init());
+
+    vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT);
+    const VkDeviceSize offset = 0;
+
+    const auto bind = [&]() {
+        vkt::CommandPool pool(*m_device, m_device->graphics_queue_node_index_, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+        vkt::CommandBuffer cb(*m_device, pool);
+        for (uint32_t i = 0; i < 64; ++i) {
+            cb.begin();
+            vk::CmdBindVertexBuffers(cb.handle(), 0, 1, &buffer.handle(), &offset);
+            cb.end();
+            cb.reset();
+        }
+    };
+    const auto create_views = [&]() {
+        for (uint32_t i = 0; i < 64; ++i) {
+            vkt::BufferView view(*m_device, vkt::BufferView::createInfo(buffer.handle(), VK_FORMAT_R32_SFLOAT));
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < 4; ++i) {
+        threads.emplace_back(bind);
+    }
+    threads.emplace_back(create_views);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
 #endif  // GTEST_IS_THREADSAFE
 
 TEST_F(PositiveThreading, Queue) {
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "utils/call_profiler.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(CallProfiler, ReportCountsCalls) {
+    const std::string filename = "vvl_call_profiler_test.csv";
+    std::remove(filename.c_str());
+    {
+        vvl::CallProfiler profiler(filename, 2);
+        profiler.SetObjectName(0, "First");
+        profiler.SetObjectName(1, "Second");
+
+        std::vector<std::thread> threads;
+        for (uint32_t t = 0; t < 4; ++t) {
+            threads.emplace_back([&profiler]() {
+                for (uint32_t i = 0; i < 100; ++i) {
+                    auto scope = profiler.Begin(1, vvl::Func::vkCmdDraw, vvl::CallProfiler::kPreCallValidate);
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        { auto scope = profiler.Begin(0, vvl::Func::vkQueueSubmit, vvl::CallProfiler::kPostCallRecord); }
+        // A default constructed scope is what objects get when profiling is disabled, it must not count anything
+        { vvl::CallProfiler::Scope scope; }
+        profiler.Report("test");
+    }
+
+    std::ifstream file(filename);
+    ASSERT_TRUE(file.is_open());
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(file, line);) {
+        lines.emplace_back(line);
+    }
+    file.close();
+    std::remove(filename.c_str());
+
+    ASSERT_EQ(3u, lines.size());
+    ASSERT_EQ(0u, lines[0].find("report,object,function,phase,calls"));
+    bool found_draw = false;
+    bool found_submit = false;
+    for (size_t i = 1; i < lines.size(); ++i) {
+        found_draw |= lines[i].find("test,Second,vkCmdDraw,PreCallValidate,400,") == 0;
+        found_submit |= lines[i].find("test,First,vkQueueSubmit,PostCallRecord,1,") == 0;
+    }
+    ASSERT_TRUE(found_draw);
+    ASSERT_TRUE(found_submit);
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/cow_chunked_array.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+using Array = vvl::CowChunkedArray<uint32_t, 4>;
+
+TEST(CustomContainer, CowChunkedArrayReadsDoNotAllocate) {
+    const uint32_t size = 100;
+    Array array(size);
+    ASSERT_EQ(size, array.size());
+    const Array &const_array = array;
+    for (uint32_t i = 0; i < size; ++i) {
+        ASSERT_EQ(0u, const_array[i]);
+    }
+    ASSERT_FALSE(array.IsChunkAllocated(0));
+
+    array[37] = 5;
+    ASSERT_TRUE(array.IsChunkAllocated(37));
+    ASSERT_TRUE(array.IsChunkAllocated(Array::kChunkSize * 2));
+    ASSERT_FALSE(array.IsChunkAllocated(0));
+    ASSERT_FALSE(array.IsChunkAllocated(size - 1));
+    for (uint32_t i = 0; i < size; ++i) {
+        ASSERT_EQ(i == 37 ? 5u : 0u, const_array[i]);
+    }
+}
+
+TEST(CustomContainer, CowChunkedArrayCopyOnWrite) {
+    Array array(64);
+    for (uint32_t i = 0; i < 64; ++i) {
+        array[i] = i;
+    }
+    Array copy(array);
+    const Array &const_array = array;
+    const Array &const_copy = copy;
+    // The copy shares the chunks until one side writes to them
+    ASSERT_EQ(&const_array[3], &const_copy[3]);
+    ASSERT_EQ(&const_array[40], &const_copy[40]);
+
+    copy[3] = 100;
+    ASSERT_EQ(3u, const_array[3]);
+    ASSERT_EQ(100u, const_copy[3]);
+    ASSERT_NE(&const_array[3], &const_copy[3]);
+    ASSERT_EQ(4u, const_copy[4]);
+    ASSERT_EQ(&const_array[40], &const_copy[40]);
+
+    array[40] = 200;
+    ASSERT_EQ(200u, const_array[40]);
+    ASSERT_EQ(40u, const_copy[40]);
+}
+
+TEST(CustomContainer, CowChunkedArrayCopyOwnsSharedChunks) {
+    auto value = std::make_shared<uint32_t>(7);
+    auto copy = std::make_unique<vvl::CowChunkedArray<std::shared_ptr<uint32_t>, 2>>(8);
+    {
+        vvl::CowChunkedArray<std::shared_ptr<uint32_t>, 2> array(8);
+        array[1] = value;
+        copy = std::make_unique<vvl::CowChunkedArray<std::shared_ptr<uint32_t>, 2>>(array);
+        ASSERT_EQ(2, value.use_count());
+    }
+    // The chunk outlives the array it was allocated by
+    const auto &const_copy = *copy;
+    ASSERT_EQ(7u, *const_copy[1]);
+    copy.reset();
+    ASSERT_EQ(1, value.use_count());
+}
+
+TEST(CustomContainer, CowChunkedArrayConcurrentAllocation) {
+    Array array(Array::kChunkSize * 8);
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&array, t]() {
+            for (uint32_t i = t; i < array.size(); i += 4) {
+                array[i] = i + 1;
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    const Array &const_array = array;
+    for (uint32_t i = 0; i < array.size(); ++i) {
+        ASSERT_EQ(i + 1, const_array[i]);
+    }
+}
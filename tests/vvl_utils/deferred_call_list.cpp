@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/deferred_call_list.h"
+
+#include <array>
+#include <memory>
+
+using CallList = vvl::DeferredCallList<uint32_t(uint32_t &total, uint32_t value)>;
+
+TEST(CustomContainer, DeferredCallListCallsInOrder) {
+    vvl::MonotonicArena arena;
+    CallList calls(&arena);
+    ASSERT_TRUE(calls.empty());
+
+    std::vector<uint32_t> order;
+    for (uint32_t i = 0; i < 3; ++i) {
+        calls.emplace_back([i, &order](uint32_t &total, uint32_t value) {
+            order.push_back(i);
+            total += value * i;
+            return i;
+        });
+    }
+    ASSERT_EQ(3u, calls.size());
+
+    uint32_t total = 0;
+    uint32_t last = 0;
+    for (const auto &call : calls) {
+        last = call(total, 2);
+    }
+    ASSERT_EQ(6u, total);
+    ASSERT_EQ(2u, last);
+    ASSERT_EQ((std::vector<uint32_t>{0, 1, 2}), order);
+}
+
+TEST(CustomContainer, DeferredCallListAppendCopiesCaptures) {
+    auto shared = std::make_shared<uint32_t>(5);
+    vvl::MonotonicArena secondary_arena;
+    vvl::MonotonicArena primary_arena;
+    CallList primary(&primary_arena);
+    {
+        CallList secondary(&secondary_arena);
+        secondary.emplace_back([shared](uint32_t &total, uint32_t) { return total += *shared; });
+        ASSERT_EQ(2, shared.use_count());
+
+        primary.append(secondary);
+        primary.push_back(*secondary.begin());
+        ASSERT_EQ(4, shared.use_count());
+    }
+    // The copies do not depend on the list or arena they were copied from
+    ASSERT_EQ(3, shared.use_count());
+    uint32_t total = 0;
+    for (const auto &call : primary) {
+        call(total, 0);
+    }
+    ASSERT_EQ(10u, total);
+
+    primary.clear();
+    ASSERT_TRUE(primary.empty());
+    ASSERT_EQ(1, shared.use_count());
+}
+
+TEST(CustomContainer, DeferredCallListReusesArena) {
+    vvl::MonotonicArena arena;
+    CallList calls(&arena);
+    // Larger than the capture buffer of std::function, so each of them would be a heap allocation there
+    std::array<uint32_t, 16> values{};
+    values[3] = 1;
+
+    auto record = [&]() {
+        for (uint32_t i = 0; i < 10000; ++i) {
+            calls.emplace_back([values](uint32_t &total, uint32_t) { return total += values[3]; });
+        }
+    };
+    record();
+    const size_t block_count = arena.BlockCount();
+    for (uint32_t i = 0; i < 4; ++i) {
+        calls.clear();
+        record();
+        ASSERT_EQ(block_count, arena.BlockCount());
+    }
+
+    uint32_t total = 0;
+    for (const auto &call : calls) {
+        call(total, 0);
+    }
+    ASSERT_EQ(10000u, total);
+}
+
+TEST(CustomContainer, DeferredCallListWithoutArena) {
+    auto shared = std::make_shared<uint32_t>(1);
+    {
+        CallList calls;
+        calls.emplace_back([shared](uint32_t &total, uint32_t value) { return total += value + *shared; });
+        uint32_t total = 0;
+        (*calls.begin())(total, 1);
+        ASSERT_EQ(2u, total);
+    }
+    ASSERT_EQ(1, shared.use_count());
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/dense_handle_map.h"
+
+#include <random>
+#include <unordered_map>
+
+TEST(CustomContainer, DenseHandleMapInsertFind) {
+    vvl::DenseHandleMap<uint64_t, uint32_t> map;
+    ASSERT_TRUE(map.empty());
+    // Past kLinearLimit, so the lookups go through the index
+    const uint64_t count = 4 * vvl::DenseHandleMap<uint64_t, uint32_t>::kLinearLimit;
+    for (uint64_t key = 1; key <= count; ++key) {
+        const auto inserted = map.emplace(key << 12, static_cast<uint32_t>(key));
+        ASSERT_TRUE(inserted.second);
+        ASSERT_EQ(key << 12, inserted.first->first);
+    }
+    ASSERT_FALSE(map.insert({1 << 12, 0}).second);
+    ASSERT_EQ(count, map.size());
+
+    // Walked in insertion order
+    uint32_t expected = 1;
+    for (const auto &entry : map) {
+        ASSERT_EQ(expected++, entry.second);
+    }
+    for (uint64_t key = 1; key <= count; ++key) {
+        const auto it = map.find(key << 12);
+        ASSERT_TRUE(it != map.end());
+        ASSERT_EQ(key, it->second);
+    }
+    ASSERT_TRUE(map.find(0) == map.end());
+    ASSERT_EQ(0u, map.count((count + 1) << 12));
+
+    map.clear();
+    ASSERT_TRUE(map.empty());
+    ASSERT_TRUE(map.find(1 << 12) == map.end());
+    map[7] = 3;
+    ASSERT_EQ(3u, map.find(7)->second);
+}
+
+TEST(CustomContainer, DenseHandleMapErase) {
+    using Map = vvl::DenseHandleMap<uint64_t, uint64_t>;
+    // Against a reference map, with few and with many entries, and keys that collide in the index
+    for (const uint64_t key_range : {uint64_t(6), uint64_t(64), uint64_t(1024)}) {
+        Map map;
+        std::unordered_map<uint64_t, uint64_t> reference;
+        std::mt19937_64 random(key_range);
+        for (uint32_t i = 0; i < 20000; ++i) {
+            const uint64_t key = (random() % key_range + 1) * 0x100000000ULL;
+            if (random() % 3 == 0) {
+                ASSERT_EQ(reference.erase(key), map.erase(key));
+            } else if (random() % 2 == 0) {
+                map.emplace(key, i);
+                reference.emplace(key, i);
+            } else {
+                const auto it = map.find(key);
+                if (it != map.end()) {
+                    map.erase(it);
+                    reference.erase(key);
+                }
+            }
+            ASSERT_EQ(reference.size(), map.size());
+        }
+        for (const auto &entry : reference) {
+            const auto it = map.find(entry.first);
+            ASSERT_TRUE(it != map.end());
+            ASSERT_EQ(entry.second, it->second);
+        }
+        for (const auto &entry : map) {
+            ASSERT_EQ(1u, reference.count(entry.first));
+        }
+    }
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "utils/hash_util.h"
+
+#include <thread>
+#include <vector>
+
+using Ranges = std::vector<uint32_t>;
+using RangesDict = hash_util::Dictionary<Ranges, hash_util::IsOrderedContainer<Ranges>>;
+
+TEST(CustomContainer, DictionaryLookUp) {
+    RangesDict dict;
+    const auto first = dict.LookUp(Ranges{1, 2, 3});
+    const Ranges same = {1, 2, 3};
+    ASSERT_EQ(first, dict.LookUp(same));
+    ASSERT_NE(first, dict.LookUp(Ranges{1, 2}));
+    ASSERT_EQ(same, *first);
+}
+
+TEST(CustomContainer, DictionaryEviction) {
+    RangesDict dict;
+    std::weak_ptr<const Ranges> released = dict.LookUp(Ranges{7});
+    ASSERT_TRUE(released.expired());
+
+    // Enough entries for the shards to be swept, the ones still referenced stay canonical
+    std::vector<RangesDict::Id> kept;
+    for (uint32_t i = 0; i < 4096; ++i) {
+        auto id = dict.LookUp(Ranges{i, i + 1});
+        if (i % 2 == 0) {
+            kept.emplace_back(std::move(id));
+        }
+    }
+    for (uint32_t i = 0; i < 4096; i += 2) {
+        ASSERT_EQ(kept[i / 2], dict.LookUp(Ranges{i, i + 1}));
+    }
+}
+
+TEST(CustomContainer, DictionaryThreads) {
+    RangesDict dict;
+    std::vector<std::vector<RangesDict::Id>> ids(4);
+    std::vector<std::thread> threads;
+    for (auto &thread_ids : ids) {
+        threads.emplace_back([&dict, &thread_ids]() {
+            for (uint32_t i = 0; i < 1024; ++i) {
+                thread_ids.emplace_back(dict.LookUp(Ranges{i % 64}));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    // Every thread got the same canonical values
+    for (const auto &thread_ids : ids) {
+        for (uint32_t i = 0; i < 1024; ++i) {
+            ASSERT_EQ(ids[0][i], thread_ids[i]);
+        }
+    }
+}
+
+TEST(CustomContainer, BulkHasher) {
+    struct Packed {
+        uint32_t a;
+        uint32_t b;
+    };
+    // The fields can be added one by one or as an array, only the packed bytes count
+    std::vector<uint32_t> words(200);
+    for (uint32_t i = 0; i < words.size(); ++i) {
+        words[i] = i * 7;
+    }
+    hash_util::BulkHasher by_array;
+    by_array << Packed{1, 2};
+    by_array.Add(words.data(), words.size());
+    hash_util::BulkHasher by_field;
+    by_field << 1u << 2u;
+    for (uint32_t word : words) {
+        by_field << word;
+    }
+    ASSERT_EQ(by_array.Value(), by_field.Value());
+
+    words.back() = 1;
+    hash_util::BulkHasher other;
+    other << Packed{1, 2};
+    other.Add(words.data(), words.size());
+    ASSERT_NE(by_array.Value(), other.Value());
+    ASSERT_EQ(hash_util::BulkHasher().Value(), hash_util::BulkHasher().Add(words.data(), 0).Value());
+}
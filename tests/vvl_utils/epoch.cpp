@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/slab_state_map.h"
+#include "utils/epoch.h"
+
+#include <memory>
+#include <thread>
+
+TEST(Epoch, RetireWithoutGuard) {
+    vvl::EpochRetireList retired;
+    auto object = std::make_shared<int>(1);
+    std::weak_ptr<int> weak = object;
+    retired.Retire(std::move(object));
+    // No guard could have found it
+    ASSERT_TRUE(weak.expired());
+}
+
+TEST(Epoch, RetireDuringGuard) {
+    vvl::EpochRetireList retired;
+    auto object = std::make_shared<int>(1);
+    std::weak_ptr<int> weak = object;
+    {
+        vvl::EpochGuard guard;
+        {
+            // Inner guards do not end the epoch of the outer one
+            vvl::EpochGuard nested;
+        }
+        retired.Retire(std::move(object));
+        ASSERT_FALSE(weak.expired());
+    }
+    ASSERT_FALSE(weak.expired());
+    // Released by the next retire, or by ReleaseAll()
+    retired.Retire(std::make_shared<int>(2));
+    ASSERT_TRUE(weak.expired());
+}
+
+TEST(Epoch, GuardStartedAfterRetire) {
+    vvl::EpochRetireList retired;
+    auto object = std::make_shared<int>(1);
+    std::weak_ptr<int> weak = object;
+    {
+        vvl::EpochGuard guard;
+        retired.Retire(std::move(object));
+    }
+    vvl::EpochGuard later_guard;
+    retired.Retire(std::make_shared<int>(2));
+    ASSERT_TRUE(weak.expired());
+}
+
+TEST(Epoch, ReleaseAll) {
+    vvl::EpochRetireList retired;
+    auto object = std::make_shared<int>(1);
+    std::weak_ptr<int> weak = object;
+    {
+        vvl::EpochGuard guard;
+        retired.Retire(std::move(object));
+        retired.ReleaseAll();
+    }
+    ASSERT_TRUE(weak.expired());
+}
+
+TEST(Epoch, ConcurrentBorrow) {
+    // Readers borrow values that writers pop and retire at the same time, a borrowed value must stay intact
+    using Map = vvl::SlabStateMap<uint64_t, std::shared_ptr<uint64_t>>;
+    auto id_map = std::make_unique<vvl::SlabIdMap>();
+    auto map = std::make_unique<Map>();
+    map->UseSlabIds();
+    vvl::EpochRetireList retired;
+
+    constexpr uint32_t kCount = 1024;
+    std::vector<std::atomic<uint64_t>> ids(kCount);
+    for (uint32_t i = 0; i < kCount; ++i) {
+        ids[i] = id_map->Insert(i + 1);
+        map->insert_or_assign(ids[i], std::make_shared<uint64_t>(i + 1));
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<bool> failed{false};
+    std::vector<std::thread> readers;
+    for (uint32_t t = 0; t < 3; ++t) {
+        readers.emplace_back([&]() {
+            while (!done) {
+                for (uint32_t i = 0; i < kCount; ++i) {
+                    vvl::EpochGuard guard;
+                    const uint64_t *value = map->FindBorrowed(ids[i].load());
+                    if (value && *value != i + 1) {
+                        failed = true;
+                    }
+                }
+            }
+        });
+    }
+    for (uint32_t round = 0; round < 64; ++round) {
+        for (uint32_t i = 0; i < kCount; ++i) {
+            const uint64_t id = ids[i].load();
+            auto popped = map->pop(id);
+            id_map->Pop(id);
+            retired.Retire(std::move(popped->second));
+            ids[i] = id_map->Insert(i + 1);
+            map->insert_or_assign(ids[i], std::make_shared<uint64_t>(i + 1));
+        }
+    }
+    done = true;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    ASSERT_FALSE(failed);
+}
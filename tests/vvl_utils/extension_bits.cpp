@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+
+#include "generated/vk_extension_helper.h"
+
+static_assert(MakeExtensionBits({vvl::Extension::_VK_KHR_swapchain}).test(static_cast<size_t>(vvl::Extension::_VK_KHR_swapchain)),
+              "ExtensionBits masks must be usable in constant expressions");
+
+// The bits must agree with IsExtEnabled() for every extension, including the ones enabled by the API version
+TEST(ExtensionBits, MatchesExtEnabled) {
+    InstanceExtensions instance_extensions;
+    const char *instance_extension_names[] = {VK_KHR_SURFACE_EXTENSION_NAME};
+    VkInstanceCreateInfo instance_ci = vku::InitStructHelper();
+    instance_ci.enabledExtensionCount = 1;
+    instance_ci.ppEnabledExtensionNames = instance_extension_names;
+    instance_extensions.InitFromInstanceCreateInfo(VK_API_VERSION_1_1, &instance_ci);
+
+    const char *device_extension_names[] = {VK_KHR_SWAPCHAIN_EXTENSION_NAME, VK_KHR_LINE_RASTERIZATION_EXTENSION_NAME};
+    VkDeviceCreateInfo device_ci = vku::InitStructHelper();
+    device_ci.enabledExtensionCount = 2;
+    device_ci.ppEnabledExtensionNames = device_extension_names;
+    DeviceExtensions device_extensions;
+    device_extensions.InitFromDeviceCreateInfo(&instance_extensions, VK_API_VERSION_1_1, &device_ci);
+
+    for (const auto &[extension, info] : InstanceExtensions::GetInfoMap()) {
+        ASSERT_EQ(IsExtEnabled(device_extensions.*(info.state)),
+                  device_extensions.enabled_bits.test(static_cast<size_t>(extension)));
+    }
+    for (const auto &[extension, info] : DeviceExtensions::GetInfoMap()) {
+        ASSERT_EQ(IsExtEnabled(device_extensions.*(info.state)),
+                  device_extensions.enabled_bits.test(static_cast<size_t>(extension)));
+    }
+
+    // Promoted to 1.1
+    ASSERT_TRUE(device_extensions.enabled_bits.test(static_cast<size_t>(vvl::Extension::_VK_KHR_maintenance1)));
+
+    constexpr ExtensionBits line_rasterization =
+        MakeExtensionBits({vvl::Extension::_VK_EXT_line_rasterization, vvl::Extension::_VK_KHR_line_rasterization});
+    ASSERT_TRUE(device_extensions.IsAnyExtEnabled(line_rasterization));
+    ASSERT_FALSE(device_extensions.IsAllExtEnabled(line_rasterization));
+    ASSERT_TRUE(device_extensions.IsAllExtEnabled(MakeExtensionBits(
+        {vvl::Extension::_VK_KHR_surface, vvl::Extension::_VK_KHR_swapchain, vvl::Extension::_VK_KHR_maintenance1})));
+}
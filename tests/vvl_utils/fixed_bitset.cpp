@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/fixed_bitset.h"
+
+#include <bitset>
+#include <random>
+#include <vector>
+
+using TestBitset = vvl::FixedBitset<192>;
+
+static_assert((TestBitset(1) << 130).test(130), "FixedBitset must be usable in constant expressions");
+static_assert(((TestBitset(1) << 3) | (TestBitset(1) << 70)) != (TestBitset(1) << 3), "FixedBitset must be usable in constant expressions");
+
+static void ExpectSame(const std::bitset<192> &expected, const TestBitset &actual) {
+    for (size_t i = 0; i < 192; ++i) {
+        ASSERT_EQ(expected.test(i), actual.test(i)) << "bit " << i;
+    }
+    ASSERT_EQ(expected.count(), actual.count());
+    ASSERT_EQ(expected.any(), actual.any());
+    ASSERT_EQ(expected.none(), actual.none());
+    ASSERT_EQ(expected.all(), actual.all());
+}
+
+TEST(CustomContainer, FixedBitsetMatchesStdBitset) {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<size_t> bit_distribution(0, 191);
+    for (uint32_t iteration = 0; iteration < 100; ++iteration) {
+        std::bitset<192> expected_a, expected_b;
+        TestBitset a, b;
+        for (uint32_t i = 0; i < 20; ++i) {
+            const size_t bit_a = bit_distribution(generator);
+            const size_t bit_b = bit_distribution(generator);
+            expected_a.set(bit_a);
+            a.set(bit_a);
+            expected_b.set(bit_b);
+            b.set(bit_b);
+        }
+        ExpectSame(expected_a, a);
+        ExpectSame(expected_a & expected_b, a & b);
+        ExpectSame(expected_a | expected_b, a | b);
+        ExpectSame(expected_a ^ expected_b, a ^ b);
+        ExpectSame(~expected_a, ~a);
+        ExpectSame(expected_a & ~expected_b, a.AndNot(b));
+        ASSERT_EQ((expected_a & expected_b).any(), a.Intersects(b));
+
+        const size_t shift = bit_distribution(generator);
+        ExpectSame(expected_a << shift, a << shift);
+        ExpectSame(expected_a >> shift, a >> shift);
+    }
+}
+
+TEST(CustomContainer, FixedBitsetIteration) {
+    TestBitset flags;
+    ASSERT_EQ(flags.size(), flags.FindFirst());
+    const std::vector<size_t> bits = {0, 1, 63, 64, 100, 127, 128, 191};
+    for (const size_t bit : bits) {
+        flags.set(bit);
+    }
+    ASSERT_EQ(0u, flags.FindFirst());
+
+    std::vector<size_t> visited;
+    flags.ForEachSetBit([&visited](size_t index) { visited.emplace_back(index); });
+    ASSERT_EQ(bits, visited);
+
+    flags.reset(0);
+    flags.reset(1);
+    ASSERT_EQ(63u, flags.FindFirst());
+    ASSERT_EQ(bits.size() - 2, flags.count());
+}
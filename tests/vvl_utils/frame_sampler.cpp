@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "utils/frame_sampler.h"
+
+TEST(FrameSampler, Interval) {
+    vvl::FrameSampler sampler(3, 0);
+    // The first frame is always sampled, then one out of every 3
+    for (uint32_t frame = 0; frame < 10; ++frame) {
+        ASSERT_EQ(frame, sampler.FrameIndex());
+        ASSERT_EQ(frame % 3 == 0, sampler.Sampled());
+        sampler.NextFrame();
+    }
+}
+
+TEST(FrameSampler, EveryFrame) {
+    for (const uint32_t interval : {0u, 1u}) {
+        vvl::FrameSampler sampler(interval, 0);
+        for (uint32_t frame = 0; frame < 4; ++frame) {
+            ASSERT_TRUE(sampler.Sampled());
+            sampler.NextFrame();
+        }
+    }
+}
+
+static int64_t fake_time_ns = 0;
+
+TEST(FrameSampler, TimeBudget) {
+    fake_time_ns = 0;
+    vvl::FrameSampler sampler(1, 50000, []() { return fake_time_ns; });
+    fake_time_ns = 49999999;
+    ASSERT_TRUE(sampler.Sampled());
+    fake_time_ns = 50000000;
+    ASSERT_FALSE(sampler.Sampled());
+    // The budget starts again with each frame
+    sampler.NextFrame();
+    ASSERT_TRUE(sampler.Sampled());
+    fake_time_ns += 50000000;
+    ASSERT_FALSE(sampler.Sampled());
+}
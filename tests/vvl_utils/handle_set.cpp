@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/handle_set.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+TEST(CustomContainer, HandleSetInsertErase) {
+    auto set = std::make_unique<vvl::ConcurrentHandleSet>();
+    // Enough aligned values to rebuild the table a few times
+    for (uint64_t i = 1; i <= 4096; ++i) {
+        ASSERT_TRUE(set->Insert(i * 64));
+    }
+    ASSERT_FALSE(set->Insert(64));
+    ASSERT_EQ(4096u, set->size());
+    for (uint64_t i = 1; i <= 4096; ++i) {
+        ASSERT_TRUE(set->Contains(i * 64));
+    }
+    ASSERT_FALSE(set->Contains(0));
+    ASSERT_FALSE(set->Contains(65));
+
+    for (uint64_t i = 1; i <= 4096; i += 2) {
+        ASSERT_TRUE(set->Erase(i * 64));
+    }
+    ASSERT_FALSE(set->Erase(64));
+    ASSERT_EQ(2048u, set->size());
+    for (uint64_t i = 1; i <= 4096; ++i) {
+        ASSERT_EQ((i % 2) == 0, set->Contains(i * 64));
+    }
+
+    // The all ones value is used as the tombstone marker internally
+    ASSERT_FALSE(set->Contains(~uint64_t(0)));
+    ASSERT_TRUE(set->Insert(~uint64_t(0)));
+    ASSERT_TRUE(set->Contains(~uint64_t(0)));
+    ASSERT_TRUE(set->Erase(~uint64_t(0)));
+    ASSERT_FALSE(set->Contains(~uint64_t(0)));
+
+    set->Clear();
+    ASSERT_EQ(0u, set->size());
+    ASSERT_FALSE(set->Contains(128));
+}
+
+TEST(CustomContainer, HandleSetConcurrentContains) {
+    auto set = std::make_unique<vvl::ConcurrentHandleSet>();
+    for (uint64_t i = 1; i <= 1024; ++i) {
+        set->Insert(i);
+    }
+
+    // Values that stay in the set are always found while other values are inserted and erased, and the table rebuilt
+    std::atomic<bool> done{false};
+    std::atomic<bool> missed{false};
+    std::thread reader([&]() {
+        while (!done.load()) {
+            for (uint64_t i = 1; i <= 1024; ++i) {
+                if (!set->Contains(i)) {
+                    missed.store(true);
+                }
+            }
+        }
+    });
+    for (uint32_t round = 0; round < 64; ++round) {
+        for (uint64_t i = 1; i <= 1024; ++i) {
+            set->Insert((uint64_t(1) << 32) + i);
+        }
+        for (uint64_t i = 1; i <= 1024; ++i) {
+            set->Erase((uint64_t(1) << 32) + i);
+        }
+    }
+    done.store(true);
+    reader.join();
+    ASSERT_FALSE(missed.load());
+    ASSERT_EQ(1024u, set->size());
+}
+
+TEST(CustomContainer, HandleSetInsertBatch) {
+    vvl::ConcurrentHandleSet set;
+    set.Insert(3);
+    std::vector<uint64_t> handles;
+    for (uint64_t handle = 1; handle <= 4096; ++handle) {
+        handles.emplace_back(handle);
+    }
+    // Already in the set, or repeated in the batch
+    handles.emplace_back(3);
+    handles.emplace_back(4096);
+    set.InsertBatch(handles.data(), handles.size());
+    ASSERT_EQ(4096u, set.size());
+    for (uint64_t handle = 1; handle <= 4096; ++handle) {
+        ASSERT_TRUE(set.Contains(handle));
+    }
+    ASSERT_FALSE(set.Contains(4097));
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/layer_allocator.h"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+TEST(CustomContainer, LayerAllocatorSwitchKind) {
+    using Vector = std::vector<uint32_t, vvl::LayerAllocator<uint32_t, vvl::AllocationSubsystem::Containers>>;
+    const vvl::AllocatorKind initial_kind = vvl::GetAllocatorKind();
+    const auto before = vvl::GetAllocationStatistics(vvl::AllocationSubsystem::Containers);
+
+    // Blocks remember the allocator they came from, so they can outlive a change of kind
+    std::vector<Vector> vectors;
+    for (const auto kind : {vvl::AllocatorKind::System, vvl::AllocatorKind::ThreadArena, vvl::AllocatorKind::Mimalloc}) {
+        vvl::SetAllocatorKind(kind);
+        ASSERT_EQ(vvl::IsAllocatorAvailable(kind) ? kind : vvl::AllocatorKind::System, vvl::GetAllocatorKind());
+        for (uint32_t size = 1; size < 64; ++size) {
+            vectors.emplace_back(size, size);
+        }
+    }
+    vvl::SetAllocatorKind(initial_kind);
+
+    for (const Vector &vector : vectors) {
+        for (const uint32_t value : vector) {
+            ASSERT_EQ(vector.size(), value);
+        }
+    }
+    const auto during = vvl::GetAllocationStatistics(vvl::AllocationSubsystem::Containers);
+    ASSERT_EQ(before.live_allocations + vectors.size(), during.live_allocations);
+    ASSERT_GE(during.peak_bytes, during.live_bytes);
+
+    vectors.clear();
+    const auto after = vvl::GetAllocationStatistics(vvl::AllocationSubsystem::Containers);
+    ASSERT_EQ(before.live_allocations, after.live_allocations);
+    ASSERT_EQ(before.live_bytes, after.live_bytes);
+}
+
+TEST(CustomContainer, LayerAllocatorThreadArenaCrossThreadFree) {
+    const vvl::AllocatorKind initial_kind = vvl::GetAllocatorKind();
+    vvl::SetAllocatorKind(vvl::AllocatorKind::ThreadArena);
+
+    // Every size class and the sizes that fall through to the system, freed on another thread than the allocating one
+    std::vector<std::vector<void *>> blocks(4);
+    std::vector<std::thread> threads;
+    for (auto &thread_blocks : blocks) {
+        threads.emplace_back([&thread_blocks]() {
+            for (size_t size = 0; size < 1024; ++size) {
+                thread_blocks.push_back(vvl::Allocate(size, vvl::AllocationSubsystem::StateTracker));
+                memset(thread_blocks.back(), 0xab, size);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (auto &thread_blocks : blocks) {
+        for (void *block : thread_blocks) {
+            vvl::Free(block);
+        }
+    }
+
+    auto shared = vvl::AllocateShared<std::vector<uint32_t>, vvl::AllocationSubsystem::StateTracker>(16, 7u);
+    ASSERT_EQ(7u, shared->at(15));
+    vvl::SetAllocatorKind(initial_kind);
+}
+
+TEST(CustomContainer, LayerAllocatorTrackedAllocator) {
+    using Vector = std::vector<uint64_t, vvl::TrackedAllocator<uint64_t, vvl::AllocationSubsystem::SyncValidation>>;
+    const auto before = vvl::GetAllocationStatistics(vvl::AllocationSubsystem::SyncValidation);
+
+    Vector vector;
+    vector.reserve(1000);
+    auto during = vvl::GetAllocationStatistics(vvl::AllocationSubsystem::SyncValidation);
+    ASSERT_EQ(before.live_allocations + 1, during.live_allocations);
+    ASSERT_EQ(before.live_bytes + 1000 * sizeof(uint64_t), during.live_bytes);
+
+    // Memory that does not come from an allocator is counted by hand
+    vvl::TrackAllocation(4096, vvl::AllocationSubsystem::SyncValidation);
+    during = vvl::GetAllocationStatistics(vvl::AllocationSubsystem::SyncValidation);
+    ASSERT_EQ(before.live_bytes + 1000 * sizeof(uint64_t) + 4096, during.live_bytes);
+    vvl::UntrackAllocation(4096, vvl::AllocationSubsystem::SyncValidation);
+
+    Vector().swap(vector);
+    const auto after = vvl::GetAllocationStatistics(vvl::AllocationSubsystem::SyncValidation);
+    ASSERT_EQ(before.live_allocations, after.live_allocations);
+    ASSERT_EQ(before.live_bytes, after.live_bytes);
+    ASSERT_GE(after.peak_bytes, 1000 * sizeof(uint64_t) + 4096);
+}
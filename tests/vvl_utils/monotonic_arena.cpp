@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/monotonic_arena.h"
+#include "containers/range_vector.h"
+
+using ArenaRangeMapAllocator = vvl::ArenaAllocator<std::pair<const sparse_container::range<uint64_t>, uint64_t>>;
+using ArenaRangeMap = sparse_container::range_map<
+    uint64_t, uint64_t, sparse_container::range<uint64_t>,
+    std::map<sparse_container::range<uint64_t>, uint64_t, std::less<sparse_container::range<uint64_t>>, ArenaRangeMapAllocator>>;
+
+static void FillRangeMap(ArenaRangeMap &map, uint64_t count) {
+    for (uint64_t i = 0; i < count; ++i) {
+        map.insert(std::make_pair(sparse_container::range<uint64_t>(i * 2, i * 2 + 1), i));
+    }
+}
+
+TEST(CustomContainer, MonotonicArenaReusesFreedMemory) {
+    vvl::MonotonicArena arena;
+    ArenaRangeMap map{ArenaRangeMapAllocator(&arena)};
+
+    FillRangeMap(map, 10000);
+    const size_t block_count = arena.BlockCount();
+    ASSERT_TRUE(block_count > 0);
+
+    // Re-recording the same amount of state must not need more memory from the system
+    for (uint32_t i = 0; i < 4; ++i) {
+        map.clear();
+        FillRangeMap(map, 10000);
+        ASSERT_EQ(block_count, arena.BlockCount());
+    }
+
+    // Big allocations are not served by the arena
+    void *big = arena.Allocate(vvl::MonotonicArena::kMaxRecycledSize + 1, alignof(std::max_align_t));
+    arena.Free(big, vvl::MonotonicArena::kMaxRecycledSize + 1);
+    ASSERT_EQ(block_count, arena.BlockCount());
+}
+
+TEST(CustomContainer, MonotonicArenaCopyDoesNotUseArena) {
+    auto arena = std::make_unique<vvl::MonotonicArena>();
+    auto map = std::make_unique<ArenaRangeMap>(ArenaRangeMapAllocator(arena.get()));
+    FillRangeMap(*map, 100);
+
+    // Copies can outlive the arena of the original
+    ArenaRangeMap copy(*map);
+    ASSERT_EQ(nullptr, copy.get_implementation_map().get_allocator().GetArena());
+    ArenaRangeMap assigned;
+    assigned = *map;
+    ASSERT_EQ(nullptr, assigned.get_implementation_map().get_allocator().GetArena());
+
+    map.reset();
+    arena.reset();
+    ASSERT_EQ(100u, copy.size());
+    ASSERT_EQ(100u, assigned.size());
+    FillRangeMap(copy, 200);
+    ASSERT_EQ(200u, copy.size());
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/mpsc_ring.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST(CustomContainer, MpscRingFull) {
+    vvl::MpscRing<std::unique_ptr<uint32_t>> ring(3);
+    ASSERT_EQ(4u, ring.Capacity());
+    ASSERT_TRUE(ring.Empty());
+    for (uint32_t i = 0; i < 4; ++i) {
+        ASSERT_TRUE(ring.TryPush(std::make_unique<uint32_t>(i)));
+    }
+    // A failed push must not consume the value
+    auto extra = std::make_unique<uint32_t>(4);
+    ASSERT_FALSE(ring.TryPush(std::move(extra)));
+    ASSERT_NE(nullptr, extra);
+
+    // Several laps over the same slots, values come out in push order
+    std::unique_ptr<uint32_t> value;
+    for (uint32_t i = 0; i < 16; ++i) {
+        ASSERT_TRUE(ring.TryPop(value));
+        ASSERT_EQ(i, *value);
+        ASSERT_TRUE(ring.TryPush(std::make_unique<uint32_t>(i + 4)));
+    }
+    for (uint32_t i = 16; i < 20; ++i) {
+        ASSERT_TRUE(ring.TryPop(value));
+        ASSERT_EQ(i, *value);
+    }
+    ASSERT_FALSE(ring.TryPop(value));
+    ASSERT_TRUE(ring.Empty());
+}
+
+TEST(CustomContainer, MpscRingConcurrentProducers) {
+    constexpr uint32_t kProducers = 4;
+    constexpr uint32_t kValuesPerProducer = 20000;
+    vvl::MpscRing<uint64_t> ring(64);
+
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&ring, p]() {
+            for (uint64_t i = 0; i < kValuesPerProducer; ++i) {
+                uint64_t value = (uint64_t(p) << 32) | i;
+                while (!ring.TryPush(std::move(value))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Every value arrives exactly once, and the values of one producer arrive in the order it pushed them
+    std::vector<uint64_t> next(kProducers, 0);
+    uint64_t value = 0;
+    for (uint64_t received = 0; received < uint64_t(kProducers) * kValuesPerProducer;) {
+        if (!ring.TryPop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        const uint32_t producer = static_cast<uint32_t>(value >> 32);
+        ASSERT_LT(producer, kProducers);
+        ASSERT_EQ(next[producer], value & 0xffffffff);
+        ++next[producer];
+        ++received;
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    ASSERT_TRUE(ring.Empty());
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/range_vector.h"
+
+#include <thread>
+#include <vector>
+
+TEST(CustomContainer, PooledRangeMapMatchesRangeMap) {
+    using Range = sparse_container::range<uint64_t>;
+    sparse_container::range_map<uint64_t, uint32_t> reference;
+    sparse_container::pooled_range_map<uint64_t, uint32_t> pooled;
+
+    for (uint32_t i = 0; i < 1000; ++i) {
+        const Range range(i * 4, i * 4 + 3);
+        reference.insert(std::make_pair(range, i));
+        pooled.insert(std::make_pair(range, i));
+    }
+    // Splits and merges ranges, which is where range_map relies on the iterators of its ImplMap staying valid
+    reference.overwrite_range(std::make_pair(Range(10, 2001), 0xffffffffu));
+    pooled.overwrite_range(std::make_pair(Range(10, 2001), 0xffffffffu));
+    reference.erase_range(Range(3001, 3500));
+    pooled.erase_range(Range(3001, 3500));
+
+    ASSERT_EQ(reference.size(), pooled.size());
+    auto pooled_it = pooled.cbegin();
+    for (const auto &entry : reference) {
+        ASSERT_EQ(entry.first, pooled_it->first);
+        ASSERT_EQ(entry.second, pooled_it->second);
+        ++pooled_it;
+    }
+
+    // The allocator is stateless, so moves and swaps work like with std::allocator
+    auto moved = std::move(pooled);
+    sparse_container::pooled_range_map<uint64_t, uint32_t> swapped;
+    std::swap(moved, swapped);
+    ASSERT_EQ(reference.size(), swapped.size());
+}
+
+TEST(CustomContainer, NodePoolAllocatorCrossThreadFree) {
+    using PooledMap = std::map<uint32_t, uint32_t, std::less<uint32_t>, vvl::NodePoolAllocator<std::pair<const uint32_t, uint32_t>>>;
+    constexpr uint32_t kCount = 8 * vvl::detail::NodePool<sizeof(uint32_t), alignof(uint32_t)>::kMaxCachedNodes;
+
+    // Nodes allocated on one thread and freed on another must be reusable by both
+    std::vector<PooledMap> maps(4);
+    std::vector<std::thread> threads;
+    for (auto &map : maps) {
+        threads.emplace_back([&map]() {
+            for (uint32_t i = 0; i < kCount; ++i) {
+                map.emplace(i, i);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    maps.clear();
+
+    PooledMap map;
+    for (uint32_t i = 0; i < kCount; ++i) {
+        map.emplace(i, i + 1);
+    }
+    for (uint32_t i = 0; i < kCount; ++i) {
+        ASSERT_EQ(i + 1, map.at(i));
+    }
+}
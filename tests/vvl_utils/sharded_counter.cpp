@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/sharded_counter.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+TEST(CustomContainer, ShardedCounterConcurrentAdd) {
+    vvl::ShardedCounter<uint32_t> counter;
+    ASSERT_EQ(0u, counter.Load());
+
+    constexpr uint32_t kThreads = 24;
+    constexpr uint32_t kAdds = 10000;
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&counter]() {
+            for (uint32_t i = 0; i < kAdds; ++i) {
+                counter.Add(2);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(2 * kThreads * kAdds, counter.Load());
+
+    counter.Reset();
+    ASSERT_EQ(0u, counter.Load());
+    counter.Add(3);
+    ASSERT_EQ(3u, counter.Load());
+}
+
+TEST(CustomContainer, ShardedCounterArrayConcurrentAddSubtract) {
+    vvl::ShardedCounterArray<uint64_t, 4> counters;
+    ASSERT_EQ(0u, counters.LoadTotal());
+
+    constexpr uint32_t kThreads = 24;
+    constexpr uint32_t kAdds = 10000;
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        // The odd threads remove what the even ones add, from other shards
+        threads.emplace_back([&counters, t]() {
+            for (uint32_t i = 0; i < kAdds; ++i) {
+                if (t % 2) {
+                    counters.Subtract(1, 1);
+                } else {
+                    counters.Add(1, 1);
+                }
+                counters.Add(t % 4 == 0 ? 2 : 3, 1);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(0u, counters.Load(0));
+    ASSERT_EQ(0u, counters.Load(1));
+    ASSERT_EQ(kThreads / 4 * kAdds, counters.Load(2));
+    ASSERT_EQ(3 * kThreads / 4 * kAdds, counters.Load(3));
+    ASSERT_EQ(kThreads * kAdds, counters.LoadTotal());
+}
+
+TEST(CustomContainer, BlockIdGeneratorUniqueIds) {
+    using Generator = vvl::BlockIdGenerator<uint32_t, 16>;
+    constexpr uint32_t kThreads = 8;
+    constexpr uint32_t kIds = 1000;
+    std::vector<std::vector<uint32_t>> thread_ids(kThreads);
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&ids = thread_ids[t]]() {
+            for (uint32_t i = 0; i < kIds; ++i) {
+                ids.emplace_back(Generator::Next());
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    std::vector<uint32_t> all_ids;
+    for (const auto &ids : thread_ids) {
+        // Increasing within a thread
+        ASSERT_TRUE(std::is_sorted(ids.begin(), ids.end()));
+        all_ids.insert(all_ids.end(), ids.begin(), ids.end());
+    }
+    std::sort(all_ids.begin(), all_ids.end());
+    ASSERT_TRUE(std::adjacent_find(all_ids.begin(), all_ids.end()) == all_ids.end());
+    ASSERT_NE(0u, all_ids.front());
+}
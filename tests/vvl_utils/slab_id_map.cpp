@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/slab_id_map.h"
+
+#include <memory>
+#include <thread>
+
+TEST(CustomContainer, SlabIdMapInsertFind) {
+    auto map = std::make_unique<vvl::SlabIdMap>();
+    std::vector<uint64_t> ids;
+    for (uint64_t value = 1; value <= 2 * vvl::SlabIdMap::kBlockSize; ++value) {
+        const uint64_t id = map->Insert(value);
+        ASSERT_TRUE(vvl::SlabIdMap::IsSlabId(id));
+        ids.emplace_back(id);
+    }
+    for (size_t i = 0; i < ids.size(); ++i) {
+        const auto value = map->Find(ids[i]);
+        ASSERT_TRUE(value.has_value());
+        ASSERT_EQ(i + 1, *value);
+    }
+
+    // Ids that were never handed out
+    ASSERT_FALSE(map->Find(0).has_value());
+    ASSERT_FALSE(map->Find(ids.back() & ~vvl::SlabIdMap::kIdTag).has_value());
+    ASSERT_FALSE(map->Find(vvl::SlabIdMap::kIdTag | (ids.size() + 1)).has_value());
+    ASSERT_FALSE(map->Find(vvl::SlabIdMap::kIdTag | vvl::SlabIdMap::kMaxSlots).has_value());
+}
+
+TEST(CustomContainer, SlabIdMapInsertBatch) {
+    auto map = std::make_unique<vvl::SlabIdMap>();
+    const uint64_t popped_id = map->Insert(1);
+    ASSERT_TRUE(map->Pop(popped_id).has_value());
+
+    // Spans a block boundary and reuses the freed slot
+    std::vector<uint64_t> values;
+    for (uint64_t value = 1; value <= vvl::SlabIdMap::kBlockSize + 16; ++value) {
+        values.emplace_back(value);
+    }
+    std::vector<uint64_t> ids(values.size());
+    const uint32_t count = static_cast<uint32_t>(values.size());
+    ASSERT_EQ(count, map->InsertBatch(values.data(), count, ids.data()));
+    for (size_t i = 0; i < ids.size(); ++i) {
+        ASSERT_EQ(values[i], *map->Find(ids[i]));
+    }
+    ASSERT_FALSE(map->Find(popped_id).has_value());
+}
+
+TEST(CustomContainer, SlabIdMapStaleId) {
+    auto map = std::make_unique<vvl::SlabIdMap>();
+    const uint64_t first_id = map->Insert(42);
+    const auto popped = map->Pop(first_id);
+    ASSERT_TRUE(popped.has_value());
+    ASSERT_EQ(42u, *popped);
+    ASSERT_FALSE(map->Find(first_id).has_value());
+    ASSERT_FALSE(map->Pop(first_id).has_value());
+
+    // The slot is reused, but the id of the destroyed value must not resolve to the new one
+    const uint64_t second_id = map->Insert(43);
+    ASSERT_NE(first_id, second_id);
+    ASSERT_EQ(static_cast<uint32_t>(first_id), static_cast<uint32_t>(second_id));
+    ASSERT_FALSE(map->Find(first_id).has_value());
+    ASSERT_FALSE(map->Pop(first_id).has_value());
+    ASSERT_EQ(43u, *map->Find(second_id));
+}
+
+TEST(CustomContainer, SlabIdMapConcurrentFind) {
+    auto map = std::make_unique<vvl::SlabIdMap>();
+    const uint64_t stable_id = map->Insert(1);
+
+    // Readers must always see the value of a live id while other threads create and destroy entries, including when
+    // new blocks are being published
+    std::atomic<bool> failed{false};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&map, &failed, stable_id, t]() {
+            for (uint64_t i = 0; i < 4 * vvl::SlabIdMap::kBlockSize; ++i) {
+                const uint64_t value = (uint64_t(t + 2) << 32) | (i + 1);
+                const uint64_t id = map->Insert(value);
+                if (map->Find(id) != value || map->Find(stable_id) != 1u) {
+                    failed = true;
+                }
+                if ((i % 2) == 0 && map->Pop(id) != value) {
+                    failed = true;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_FALSE(failed);
+}
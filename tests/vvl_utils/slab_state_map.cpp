@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/slab_state_map.h"
+
+#include <memory>
+#include <thread>
+
+using TestStateMap = vvl::SlabStateMap<uint64_t, std::shared_ptr<uint64_t>>;
+
+TEST(CustomContainer, SlabStateMapMixedKeys) {
+    auto id_map = std::make_unique<vvl::SlabIdMap>();
+    auto map = std::make_unique<TestStateMap>();
+    map->UseSlabIds();
+
+    // Slab ids go to the dense slots, anything else to the hash map
+    std::vector<uint64_t> keys;
+    for (uint64_t value = 1; value <= 2 * vvl::SlabIdMap::kBlockSize; ++value) {
+        keys.emplace_back((value % 3) == 0 ? value : id_map->Insert(value));
+        map->insert_or_assign(keys.back(), std::make_shared<uint64_t>(value));
+    }
+    ASSERT_EQ(keys.size(), map->size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        const auto found = map->find(keys[i]);
+        ASSERT_NE(map->end(), found);
+        ASSERT_EQ(i + 1, *found->second);
+    }
+    ASSERT_EQ(keys.size(), map->snapshot().size());
+
+    const auto popped = map->pop(keys[0]);
+    ASSERT_NE(map->end(), popped);
+    ASSERT_EQ(1u, *popped->second);
+    ASSERT_EQ(map->end(), map->find(keys[0]));
+    ASSERT_EQ(map->end(), map->pop(keys[0]));
+    ASSERT_EQ(keys.size() - 1, map->size());
+
+    map->clear();
+    ASSERT_TRUE(map->empty());
+    ASSERT_TRUE(map->snapshot().empty());
+    ASSERT_EQ(map->end(), map->find(keys[1]));
+}
+
+TEST(CustomContainer, SlabStateMapStaleKey) {
+    auto id_map = std::make_unique<vvl::SlabIdMap>();
+    auto map = std::make_unique<TestStateMap>();
+    map->UseSlabIds();
+
+    const uint64_t first_id = id_map->Insert(1);
+    map->insert_or_assign(first_id, std::make_shared<uint64_t>(1));
+    map->pop(first_id);
+    id_map->Pop(first_id);
+
+    // Same slot, next generation: the destroyed handle must not find the new object
+    const uint64_t second_id = id_map->Insert(2);
+    ASSERT_EQ(static_cast<uint32_t>(first_id), static_cast<uint32_t>(second_id));
+    map->insert_or_assign(second_id, std::make_shared<uint64_t>(2));
+    ASSERT_EQ(map->end(), map->find(first_id));
+    ASSERT_EQ(map->end(), map->pop(first_id));
+    ASSERT_EQ(2u, *map->find(second_id)->second);
+}
+
+TEST(CustomContainer, SlabStateMapWithoutSlabIds) {
+    // Without UseSlabIds() even tagged keys are hashed, as the handles are not known to come from a SlabIdMap
+    auto map = std::make_unique<TestStateMap>();
+    const uint64_t key = vvl::SlabIdMap::kIdTag | 5;
+    map->insert_or_assign(key, std::make_shared<uint64_t>(5));
+    ASSERT_EQ(5u, *map->find(key)->second);
+    ASSERT_EQ(1u, map->size());
+}
+
+TEST(CustomContainer, SlabStateMapConcurrent) {
+    auto id_map = std::make_unique<vvl::SlabIdMap>();
+    auto map = std::make_unique<TestStateMap>();
+    map->UseSlabIds();
+    const uint64_t stable_id = id_map->Insert(1);
+    map->insert_or_assign(stable_id, std::make_shared<uint64_t>(1));
+
+    std::atomic<bool> failed{false};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&id_map, &map, &failed, stable_id, t]() {
+            for (uint64_t i = 0; i < 2 * vvl::SlabIdMap::kBlockSize; ++i) {
+                const uint64_t value = (uint64_t(t + 2) << 32) | (i + 1);
+                const uint64_t id = id_map->Insert(value);
+                map->insert_or_assign(id, std::make_shared<uint64_t>(value));
+                const auto found = map->find(id);
+                const auto stable = map->find(stable_id);
+                if (found == map->end() || *found->second != value || stable == map->end() || *stable->second != 1u) {
+                    failed = true;
+                }
+                if ((i % 2) == 0) {
+                    map->pop(id);
+                    id_map->Pop(id);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_FALSE(failed);
+    ASSERT_EQ(1 + 4 * vvl::SlabIdMap::kBlockSize, map->size());
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/string_pool.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(CustomContainer, StringPoolIntern) {
+    vvl::StringPool pool;
+    std::string name = "shadow map";
+    const std::string_view first = pool.Intern(name);
+    name = "overwritten";
+    ASSERT_EQ(std::string_view("shadow map"), first);
+    ASSERT_EQ('\0', first.data()[first.size()]);
+
+    // Equal strings share the storage
+    ASSERT_EQ(first.data(), pool.Intern("shadow map").data());
+    ASSERT_NE(first.data(), pool.Intern("shadow map 2").data());
+    ASSERT_EQ(2u, pool.Size());
+
+    const std::string_view empty = pool.Intern("");
+    ASSERT_TRUE(empty.empty());
+    ASSERT_EQ('\0', empty.data()[0]);
+
+    // Strings larger than a block, and enough small ones to fill several blocks, keep their content
+    const std::string large(vvl::StringPool::kBlockSize * 2, 'x');
+    ASSERT_EQ(large, pool.Intern(large));
+    std::vector<std::string_view> views;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        views.emplace_back(pool.Intern("buffer " + std::to_string(i)));
+    }
+    for (uint32_t i = 0; i < 1000; ++i) {
+        ASSERT_EQ("buffer " + std::to_string(i), views[i]);
+    }
+    ASSERT_EQ(std::string_view("shadow map"), first);
+}
+
+TEST(CustomContainer, StringPoolConcurrentIntern) {
+    vvl::StringPool pool;
+    std::vector<std::vector<const char *>> results(4);
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&pool, &results, t]() {
+            for (uint32_t i = 0; i < 500; ++i) {
+                results[t].emplace_back(pool.Intern("image " + std::to_string(i)).data());
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(500u, pool.Size());
+    for (uint32_t t = 1; t < 4; ++t) {
+        ASSERT_EQ(results[0], results[t]);
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "utils/text_buffer.h"
+#include "error_message/error_location.h"
+
+TEST(TextBuffer, Append) {
+    vvl::StackTextBuffer<64> text;
+    ASSERT_TRUE(text.empty());
+    ASSERT_STREQ("", text.c_str());
+
+    text.Append("count = ").AppendUint(0).Append(", ").AppendUint(18446744073709551615ull).Append(' ');
+    text.AppendHex(0).Append(' ').AppendHex(0xdeadbeef);
+    ASSERT_STREQ("count = 0, 18446744073709551615 0x0 0xdeadbeef", text.c_str());
+    ASSERT_EQ(text.view().size(), text.size());
+    ASSERT_FALSE(text.Truncated());
+}
+
+TEST(TextBuffer, Truncate) {
+    vvl::StackTextBuffer<8> text;
+    text.Append("0123").Append("456789");
+    ASSERT_STREQ("0123456", text.c_str());
+    ASSERT_EQ(7u, text.size());
+    ASSERT_TRUE(text.Truncated());
+    text.AppendUint(1);
+    ASSERT_STREQ("0123456", text.c_str());
+    // Enough to write everything again without truncation
+    ASSERT_EQ(11u, text.RequiredSize());
+}
+
+TEST(TextBuffer, LocationMessage) {
+    const Location loc(vvl::Func::vkCmdPipelineBarrier2, vvl::Field::pDependencyInfo);
+    const Location barrier_loc = loc.dot(vvl::Struct::VkDependencyInfo, vvl::Field::pImageMemoryBarriers, 1);
+    const Location image_loc = barrier_loc.dot(vvl::Field::image);
+
+    vvl::StackTextBuffer<256> text;
+    image_loc.AppendMessage(text);
+    ASSERT_STREQ("vkCmdPipelineBarrier2(): pDependencyInfo->pImageMemoryBarriers[1].image", text.c_str());
+    ASSERT_EQ(image_loc.Message(), std::string(text.view()));
+
+    vvl::StackTextBuffer<256> fields;
+    image_loc.AppendFields(fields);
+    ASSERT_EQ(image_loc.Fields(), std::string(fields.view()));
+    ASSERT_STREQ("pDependencyInfo->pImageMemoryBarriers[1].image", fields.c_str());
+}
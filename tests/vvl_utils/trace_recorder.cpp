@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "utils/trace_recorder.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(TraceRecorder, WritesSpansOfEveryThread) {
+    const std::string filename = "vvl_trace_recorder_test.json";
+    std::remove(filename.c_str());
+    // More than a chunk per thread, so the full chunks are written and freed while the threads keep recording
+    constexpr uint32_t kThreadCount = 4;
+    constexpr uint32_t kSpansPerThread = 3000;
+    {
+        vvl::TraceRecorder recorder(filename);
+        std::vector<std::thread> threads;
+        for (uint32_t t = 0; t < kThreadCount; ++t) {
+            threads.emplace_back([&recorder]() {
+                for (uint32_t i = 0; i < kSpansPerThread; ++i) {
+                    auto span = recorder.Begin("Test", "Span");
+                }
+            });
+        }
+        recorder.Flush();
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        { auto span = recorder.Begin("Test", "Detail", "PreCallValidate"); }
+        // A default constructed span is what objects get when tracing is disabled, it must not record anything
+        { vvl::TraceRecorder::Span span; }
+    }
+
+    std::ifstream file(filename);
+    ASSERT_TRUE(file.is_open());
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(file, line);) {
+        lines.emplace_back(line);
+    }
+    file.close();
+    std::remove(filename.c_str());
+
+    ASSERT_EQ(kThreadCount * kSpansPerThread + 3, lines.size());
+    ASSERT_EQ("[", lines.front());
+    ASSERT_EQ("]", lines.back());
+    uint32_t span_count = 0;
+    uint32_t detail_count = 0;
+    for (size_t i = 1; i + 1 < lines.size(); ++i) {
+        span_count += lines[i].find("{\"name\":\"Span\",\"cat\":\"Test\",\"ph\":\"X\",") == 0;
+        detail_count += lines[i].find("\"args\":{\"detail\":\"PreCallValidate\"}") != std::string::npos;
+    }
+    ASSERT_EQ(kThreadCount * kSpansPerThread, span_count);
+    ASSERT_EQ(1u, detail_count);
+}
+
+TEST(TraceRecorder, SharedByTheProcess) {
+    const std::string filename = "vvl_trace_recorder_shared.json";
+    std::string first_file;
+    {
+        auto first = vvl::TraceRecorder::GetShared(filename);
+        auto second = vvl::TraceRecorder::GetShared(filename);
+        ASSERT_EQ(first, second);
+        ASSERT_TRUE(first->IsOpen());
+        first_file = first->GetOutputFile();
+    }
+    // Once the first one is gone, the next one must not truncate its trace
+    std::string next_file;
+    {
+        auto next = vvl::TraceRecorder::GetShared(filename);
+        ASSERT_TRUE(next->IsOpen());
+        next_file = next->GetOutputFile();
+    }
+    ASSERT_NE(first_file, next_file);
+    ASSERT_EQ(".json", next_file.substr(next_file.size() - 5));
+    std::ifstream first_trace(first_file);
+    ASSERT_TRUE(first_trace.is_open());
+    first_trace.close();
+    std::remove(first_file.c_str());
+    std::remove(next_file.c_str());
+}
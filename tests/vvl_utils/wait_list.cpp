@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "utils/wait_list.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Payload object like a timeline semaphore, the list is guarded by its lock
+struct WaitListTimeline {
+    std::mutex lock;
+    vvl::WaitList waiters;
+    uint64_t completed = 0;
+
+    bool Wait(uint64_t value, std::chrono::steady_clock::duration timeout) {
+        vvl::WaitList::Waiter waiter(value);
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            if (value <= completed) {
+                return true;
+            }
+            waiters.Add(waiter);
+        }
+        const bool woken = waiter.WaitUntil(std::chrono::steady_clock::now() + timeout);
+        std::lock_guard<std::mutex> guard(lock);
+        waiters.Remove(waiter);
+        return woken;
+    }
+
+    void Signal(uint64_t value) {
+        std::lock_guard<std::mutex> guard(lock);
+        completed = value;
+        waiters.Wake(value);
+    }
+};
+
+TEST(WaitList, WakeUpToValue) {
+    WaitListTimeline timeline;
+    constexpr uint64_t kThreads = 8;
+    std::atomic<uint64_t> woken{0};
+    std::vector<std::thread> threads;
+    for (uint64_t value = 1; value <= kThreads; ++value) {
+        threads.emplace_back([&timeline, &woken, value]() {
+            if (timeline.Wait(value, std::chrono::seconds(10))) {
+                woken.fetch_add(1);
+            }
+        });
+    }
+    // Half of the waiters are done with the first signal, the others with the second one
+    timeline.Signal(kThreads / 2);
+    timeline.Signal(kThreads);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(kThreads, woken.load());
+    ASSERT_TRUE(timeline.waiters.Empty());
+}
+
+TEST(WaitList, Timeout) {
+    WaitListTimeline timeline;
+    ASSERT_FALSE(timeline.Wait(1, std::chrono::milliseconds(1)));
+    ASSERT_TRUE(timeline.waiters.Empty());
+    // A value already reached does not wait
+    timeline.Signal(3);
+    ASSERT_TRUE(timeline.Wait(2, std::chrono::milliseconds(1)));
+    // The waiters before and after a removed one are still woken
+    std::thread late([&timeline]() { ASSERT_TRUE(timeline.Wait(5, std::chrono::seconds(10))); });
+    ASSERT_FALSE(timeline.Wait(6, std::chrono::milliseconds(1)));
+    timeline.Signal(5);
+    late.join();
+}
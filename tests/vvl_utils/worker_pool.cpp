@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "utils/worker_pool.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(WorkerPool, ParallelForVisitsEachIndexOnce) {
+    vvl::WorkerPool pool(3);
+    ASSERT_EQ(3u, pool.GetThreadCount());
+    for (uint32_t count : {0u, 1u, 2u, 7u, 1000u}) {
+        std::vector<std::atomic<uint32_t>> visits(count);
+        pool.ParallelFor(count, [&visits](uint32_t index) { visits[index].fetch_add(1); });
+        for (const auto &visit : visits) {
+            ASSERT_EQ(1u, visit.load());
+        }
+    }
+}
+
+TEST(WorkerPool, NoThreads) {
+    vvl::WorkerPool pool(0);
+    uint32_t sum = 0;
+    pool.ParallelFor(10, [&sum](uint32_t index) { sum += index; });
+    ASSERT_EQ(45u, sum);
+}
+
+TEST(WorkerPool, ConcurrentCallers) {
+    // The tasks of all the callers share the queues, every call must still cover its whole range
+    vvl::WorkerPool pool(2);
+    std::atomic<bool> failed{false};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&pool, &failed]() {
+            for (uint32_t i = 0; i < 100; ++i) {
+                std::atomic<uint32_t> sum{0};
+                pool.ParallelFor(64, [&sum](uint32_t index) { sum.fetch_add(index); });
+                if (sum.load() != 64 * 63 / 2) {
+                    failed = true;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_FALSE(failed);
+}
+
+TEST(WorkerPool, NestedParallelFor) {
+    // A task waiting for its own tasks runs queued ones meanwhile, even with every worker waiting there is progress
+    vvl::WorkerPool pool(2);
+    std::atomic<uint32_t> sum{0};
+    pool.ParallelFor(8, [&pool, &sum](uint32_t outer) {
+        pool.ParallelFor(16, [&sum, outer](uint32_t inner) { sum.fetch_add(outer * 16 + inner); });
+    });
+    ASSERT_EQ(128u * 127u / 2, sum.load());
+}
+
+TEST(WorkerPool, TaskGroup) {
+    vvl::WorkerPool pool(3);
+    std::vector<uint32_t> results(100, 0);
+    {
+        vvl::WorkerPool::TaskGroup group(&pool);
+        for (uint32_t i = 0; i < 100; ++i) {
+            group.Run([&results, i]() { results[i] = i * i; });
+        }
+        group.Wait();
+        for (uint32_t i = 0; i < 100; ++i) {
+            ASSERT_EQ(i * i, results[i]);
+        }
+        // Reusable after Wait(), the destructor waits for the tasks added since
+        group.Run([&results]() { results[0] = 1; });
+    }
+    ASSERT_EQ(1u, results[0]);
+
+    // Without a pool the tasks run right away
+    vvl::WorkerPool::TaskGroup inline_group(nullptr);
+    const std::thread::id thread_id = std::this_thread::get_id();
+    bool same_thread = false;
+    inline_group.Run([&same_thread, thread_id]() { same_thread = std::this_thread::get_id() == thread_id; });
+    ASSERT_TRUE(same_thread);
+}
+
+TEST(WorkerPool, Shared) {
+    auto pool = vvl::WorkerPool::GetShared(2, false);
+    ASSERT_EQ(2u, pool->GetThreadCount());
+    // Later callers get the pool already created
+    ASSERT_EQ(pool, vvl::WorkerPool::GetShared(4, true));
+    pool.reset();
+
+    auto pinned_pool = vvl::WorkerPool::GetShared(1, true);
+    ASSERT_EQ(1u, pinned_pool->GetThreadCount());
+    std::atomic<uint32_t> sum{0};
+    pinned_pool->ParallelFor(10, [&sum](uint32_t index) { sum.fetch_add(index); });
+    ASSERT_EQ(45u, sum.load());
+}